@@ -1,4 +1,5 @@
 using BenchmarkDotNet.Configs;
+using BenchmarkDotNet.Exporters.Json;
 using BenchmarkDotNet.Running;
 
 namespace Nexen.Benchmarks;
@@ -6,7 +7,8 @@ namespace Nexen.Benchmarks;
 public class Program {
 	public static void Main(string[] args) {
 		var config = DefaultConfig.Instance
-			.WithOptions(ConfigOptions.JoinSummary);
+			.WithOptions(ConfigOptions.JoinSummary)
+			.AddExporter(JsonExporter.Full); // Read by scripts/benchmark-compare.ps1
 
 		// Run all benchmarks from this assembly
 		BenchmarkSwitcher.FromAssembly(typeof(Program).Assembly).Run(args, config);
@@ -0,0 +1,54 @@
+#include "pch.h"
+#include "Shared/Emulator.h"
+#include "Atari2600/Atari2600Console.h"
+#include "Atari2600/Atari2600SmokeHarness.h"
+
+// =============================================================================
+// Atari 2600 TIA Benchmarks
+// =============================================================================
+// The TIA renders whole scanlines from a per-scanline register write log, and
+// jumps to the end of the scanline between writes. These benchmarks measure the
+// cost of a frame with no writes, with a few writes per scanline (e.g a
+// playfield kernel) and of the smoke harness.
+
+static void BM_Atari2600Tia_IdleFrame(benchmark::State& state) {
+	Emulator emu;
+	Atari2600Console console(&emu);
+	console.Reset();
+	for (auto _ : state) {
+		console.StepCpuCycles(Atari2600Console::CpuCyclesPerFrame);
+	}
+	benchmark::DoNotOptimize(console.GetTiaState());
+}
+BENCHMARK(BM_Atari2600Tia_IdleFrame);
+
+static void BM_Atari2600Tia_PlayfieldKernelFrame(benchmark::State& state) {
+	Emulator emu;
+	Atari2600Console console(&emu);
+	console.Reset();
+	for (auto _ : state) {
+		// One WSYNC and 4 register writes per scanline, spread over the visible area
+		for (uint32_t i = 0; i < Atari2600Console::ScanlinesPerFrame; i++) {
+			console.WriteTiaRegister(0x09, (uint8_t)(i << 1));
+			console.StepCpuCycles(26);
+			console.WriteTiaRegister(0x0D, 0xA0);
+			console.WriteTiaRegister(0x0E, (uint8_t)i);
+			console.StepCpuCycles(20);
+			console.WriteTiaRegister(0x0F, (uint8_t)~i);
+			console.RequestWsync();
+			console.StepCpuCycles(1);
+		}
+	}
+	benchmark::DoNotOptimize(console.GetPpuFrame().FrameBuffer);
+}
+BENCHMARK(BM_Atari2600Tia_PlayfieldKernelFrame);
+
+static void BM_Atari2600Tia_SmokeHarness(benchmark::State& state) {
+	Emulator emu;
+	Atari2600Console console(&emu);
+	for (auto _ : state) {
+		Atari2600HarnessResult result = Atari2600SmokeHarness::RunBaseline(console);
+		benchmark::DoNotOptimize(result.Digest);
+	}
+}
+BENCHMARK(BM_Atari2600Tia_SmokeHarness);
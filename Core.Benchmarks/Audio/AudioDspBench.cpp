@@ -4,6 +4,9 @@
 #include <cmath>
 #include <cstring>
 #include <random>
+#include "Utilities/Audio/Equalizer.h"
+#include "Utilities/Audio/HermiteResampler.h"
+#include "Utilities/Audio/SincResampler.h"
 
 // =============================================================================
 // Audio DSP Benchmarks
@@ -777,3 +780,99 @@ static void BM_Audio_EqGains_Array(benchmark::State& state) {
 	}
 }
 BENCHMARK(BM_Audio_EqGains_Array);
+
+// ===== Equalizer: per-sample orfanidis filters vs stereo block kernel =====
+
+static constexpr std::array<double, 20> kEqBenchGains = {6, 4, 2, 0, -2, -4, -6, 0, 3, 3, 0, -3, -12, 0, 5, 0, 0, 8, -8, 1};
+
+// Reference: one orfanidis equalizer per channel, every band's filter object called for each sample
+static void BM_Audio_Equalizer_PerSample(benchmark::State& state) {
+	static constexpr std::array<double, 22> bands = {
+		24, 40, 56, 80, 113, 160, 225, 320, 450, 600, 750, 1000,
+		2000, 3000, 4000, 5000, 6000, 7000, 10000, 12500, 13000, 13500
+	};
+	orfanidis_eq::freq_grid grid;
+	for (size_t i = 1; i < bands.size() - 1; i++) {
+		grid.add_band((bands[i] + bands[i - 1]) / 2, bands[i], (bands[i + 1] + bands[i]) / 2);
+	}
+	orfanidis_eq::eq1 left(&grid, orfanidis_eq::filter_type::butterworth);
+	orfanidis_eq::eq1 right(&grid, orfanidis_eq::filter_type::butterworth);
+	left.set_sample_rate(48000);
+	right.set_sample_rate(48000);
+	for (unsigned int i = 0; i < grid.get_number_of_bands(); i++) {
+		left.change_band_gain_db(i, kEqBenchGains[i]);
+		right.change_band_gain_db(i, kEqBenchGains[i]);
+	}
+
+	size_t count = state.range(0);
+	std::vector<int16_t> samples(count * 2);
+	GenerateStereoSineWave(samples.data(), count, 440.0, 660.0, 48000.0);
+
+	for (auto _ : state) {
+		double outL, outR;
+		for (size_t i = 0; i < count; i++) {
+			double inL = samples[i * 2];
+			double inR = samples[i * 2 + 1];
+			left.sbs_process(&inL, &outL);
+			right.sbs_process(&inR, &outR);
+			samples[i * 2] = (int16_t)std::max(std::min(outL, 32767.0), -32768.0);
+			samples[i * 2 + 1] = (int16_t)std::max(std::min(outR, 32767.0), -32768.0);
+		}
+		benchmark::DoNotOptimize(samples.data());
+	}
+	state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_Audio_Equalizer_PerSample)->Arg(kMediumBufferSize);
+
+// Optimized: Equalizer's 2-lane stereo sections, one band at a time over the block
+static void BM_Audio_Equalizer_StereoBlock(benchmark::State& state) {
+	Equalizer equalizer;
+	equalizer.UpdateEqualizers(kEqBenchGains, 48000);
+
+	size_t count = state.range(0);
+	std::vector<int16_t> source(count * 2);
+	GenerateStereoSineWave(source.data(), count, 440.0, 660.0, 48000.0);
+	std::vector<float> samples(source.begin(), source.end());
+
+	for (auto _ : state) {
+		equalizer.ApplyEqualizer((uint32_t)count, samples.data());
+		benchmark::DoNotOptimize(samples.data());
+	}
+	state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_Audio_Equalizer_StereoBlock)->Arg(kMediumBufferSize);
+
+// -----------------------------------------------------------------------------
+// Output Resampler Benchmarks
+// -----------------------------------------------------------------------------
+
+// One 60 fps frame of SNES audio (32040 Hz) resampled to 48000 Hz
+template <typename T>
+static void RunResamplerBench(benchmark::State& state, T& resampler) {
+	constexpr uint32_t frameSamples = 534;
+	std::vector<int16_t> input(frameSamples * 2);
+	GenerateStereoSineWave(input.data(), frameSamples, 440.0, 660.0, 32040.0);
+	std::vector<int16_t> output(0x10000);
+	resampler.SetSampleRates(32040.0, 48000.0 * 1.001);
+
+	for (auto _ : state) {
+		uint32_t count = resampler.template Resample<false>(input.data(), frameSamples, output.data(), output.size() / 2);
+		benchmark::DoNotOptimize(count);
+		benchmark::DoNotOptimize(output.data());
+	}
+	state.SetItemsProcessed(state.iterations() * frameSamples);
+}
+
+// Baseline: 4-point Hermite interpolation (double precision, scalar)
+static void BM_Audio_Resample_Hermite(benchmark::State& state) {
+	HermiteResampler resampler;
+	RunResamplerBench(state, resampler);
+}
+BENCHMARK(BM_Audio_Resample_Hermite);
+
+// Polyphase windowed sinc, 16 and 32 taps
+static void BM_Audio_Resample_Sinc(benchmark::State& state) {
+	SincResampler resampler((uint32_t)state.range(0));
+	RunResamplerBench(state, resampler);
+}
+BENCHMARK(BM_Audio_Resample_Sinc)->Arg(16)->Arg(32);
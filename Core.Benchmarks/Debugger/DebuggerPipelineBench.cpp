@@ -8,6 +8,7 @@
 #include <cstring>
 #include "Debugger/DebugTypes.h"
 #include "Debugger/CodeDataLogger.h"
+#include "Debugger/BreakpointAddressIndex.h"
 #include "Shared/MemoryType.h"
 
 // =============================================================================
@@ -1010,3 +1011,78 @@ static void BM_ExprEval_StringByConstRef(benchmark::State& state) {
 }
 BENCHMARK(BM_ExprEval_StringByConstRef);
 BENCHMARK(BM_CDLOnly_Pipeline);
+
+// =============================================================================
+// 11. Breakpoint matching: linear scan vs address index
+// =============================================================================
+// 50 single-address watch breakpoints spread over work RAM, checked against a stream of
+// accesses of which very few hit a breakpoint (typical reverse-engineering session).
+
+/// Mirrors Breakpoint's range fields (Breakpoint::Matches' absolute address path)
+struct BenchBreakpointRange {
+	MemoryType MemType;
+	int32_t Start;
+	int32_t End;
+};
+
+static vector<BenchBreakpointRange> GetBenchBreakpoints(int count) {
+	vector<BenchBreakpointRange> ranges;
+	std::mt19937 rng(1234);
+	for (int i = 0; i < count; i++) {
+		int32_t addr = (int32_t)(rng() % 0x20000);
+		ranges.push_back({MemoryType::SnesWorkRam, addr, addr + (int32_t)(rng() % 4)});
+	}
+	return ranges;
+}
+
+static vector<int32_t> GetBenchAccesses() {
+	vector<int32_t> accesses(4096);
+	std::mt19937 rng(5678);
+	for (int32_t& addr : accesses) {
+		addr = (int32_t)(rng() % 0x20000);
+	}
+	return accesses;
+}
+
+static void BM_Breakpoint_LinearScan(benchmark::State& state) {
+	vector<BenchBreakpointRange> ranges = GetBenchBreakpoints((int)state.range(0));
+	vector<int32_t> accesses = GetBenchAccesses();
+
+	for (auto _ : state) {
+		int matches = 0;
+		for (int32_t addr : accesses) {
+			for (const BenchBreakpointRange& bp : ranges) {
+				if (bp.MemType == MemoryType::SnesWorkRam && addr >= bp.Start && addr <= bp.End) {
+					matches++;
+				}
+			}
+		}
+		benchmark::DoNotOptimize(matches);
+	}
+	state.SetItemsProcessed(state.iterations() * accesses.size());
+}
+BENCHMARK(BM_Breakpoint_LinearScan)->Arg(5)->Arg(50)->Arg(200);
+
+static void BM_Breakpoint_AddressIndex(benchmark::State& state) {
+	vector<BenchBreakpointRange> ranges = GetBenchBreakpoints((int)state.range(0));
+	vector<int32_t> accesses = GetBenchAccesses();
+
+	auto index = std::make_unique<BreakpointAddressIndex>();
+	for (uint32_t i = 0; i < ranges.size(); i++) {
+		index->Add(ranges[i].MemType, ranges[i].Start, ranges[i].End, i);
+	}
+	index->Build();
+
+	vector<uint32_t> candidates;
+	for (auto _ : state) {
+		int matches = 0;
+		for (int32_t addr : accesses) {
+			candidates.clear();
+			index->GetCandidates<1>(MemoryType::SnesWorkRam, addr, candidates);
+			matches += (int)candidates.size();
+		}
+		benchmark::DoNotOptimize(matches);
+	}
+	state.SetItemsProcessed(state.iterations() * accesses.size());
+}
+BENCHMARK(BM_Breakpoint_AddressIndex)->Arg(5)->Arg(50)->Arg(200);
@@ -0,0 +1,68 @@
+#include "pch.h"
+// DisassemblerCacheBench.cpp
+// Benchmarks for the disassembly cache layout (DisassemblerSource).
+//
+// Old layout: vector<DisassemblyInfo>, 12 bytes per byte of memory (byte code, size, flags, CPU, initialized flag)
+// New layout: structure of arrays, OpSizes/CpuFlags/CpuTypes (3 bytes per byte of memory), byte code read from memory
+//
+// Measures the sequential scan done by the disassembly view (finding instruction starts) over a 4 MB ROM
+// with 1 instruction every 3 bytes in the first quarter (the rest was never executed).
+
+#include "benchmark/benchmark.h"
+#include "Debugger/Disassembler.h"
+
+namespace {
+	constexpr uint32_t RomSize = 0x400000;
+
+	vector<uint8_t> GetRom() {
+		vector<uint8_t> rom(RomSize);
+		for (uint32_t i = 0; i < RomSize; i++) {
+			rom[i] = (uint8_t)(i * 31);
+		}
+		return rom;
+	}
+}
+
+static void BM_DisassemblerCache_ScanArrayOfStructs(benchmark::State& state) {
+	vector<uint8_t> rom = GetRom();
+	vector<DisassemblyInfo> cache(RomSize);
+	for (uint32_t i = 0; i < RomSize / 4; i += 3) {
+		cache[i].Initialize(rom.data() + i, 3, 0, CpuType::Snes);
+	}
+
+	for (auto _ : state) {
+		uint32_t count = 0;
+		for (uint32_t i = 0; i < RomSize; i++) {
+			count += cache[i].IsInitialized() ? 1 : 0;
+		}
+		benchmark::DoNotOptimize(count);
+	}
+	state.SetBytesProcessed(state.iterations() * RomSize);
+	state.counters["cache_mb"] = (double)(cache.size() * sizeof(DisassemblyInfo)) / (1024 * 1024);
+}
+BENCHMARK(BM_DisassemblerCache_ScanArrayOfStructs)->Unit(benchmark::kMicrosecond);
+
+static void BM_DisassemblerCache_ScanStructOfArrays(benchmark::State& state) {
+	vector<uint8_t> rom = GetRom();
+	DisassemblerSource src;
+	src.OpSizes.assign(RomSize, 0);
+	src.CpuFlags.assign(RomSize, 0);
+	src.CpuTypes.assign(RomSize, {});
+	src.Memory = rom.data();
+	src.Size = RomSize;
+	for (uint32_t i = 0; i < RomSize / 4; i += 3) {
+		src.OpSizes[i] = 3;
+		src.CpuTypes[i] = CpuType::Snes;
+	}
+
+	for (auto _ : state) {
+		uint32_t count = 0;
+		for (uint32_t i = 0; i < RomSize; i++) {
+			count += src.IsInitialized(i) ? 1 : 0;
+		}
+		benchmark::DoNotOptimize(count);
+	}
+	state.SetBytesProcessed(state.iterations() * RomSize);
+	state.counters["cache_mb"] = (double)(src.OpSizes.size() + src.CpuFlags.size() + src.CpuTypes.size() * sizeof(CpuType)) / (1024 * 1024);
+}
+BENCHMARK(BM_DisassemblerCache_ScanStructOfArrays)->Unit(benchmark::kMicrosecond);
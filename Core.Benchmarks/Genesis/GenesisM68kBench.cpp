@@ -0,0 +1,83 @@
+#include "pch.h"
+#include "Genesis/GenesisM68kCpu.h"
+
+// =============================================================================
+// Genesis 68000 Benchmarks
+// =============================================================================
+// The 68000 core dispatches through a predecoded 64K-entry handler table and
+// accesses ROM/work RAM through direct page pointers. These benchmarks track
+// the instruction throughput of the hot path and the cost of the bus accessors
+// compared to the byte-sized virtual calls they replace.
+
+namespace {
+	void LoadProgram(GenesisPlatformBusStub& bus, GenesisM68kCpu& cpu, const vector<uint16_t>& program) {
+		vector<uint8_t> rom(0x10000, 0);
+		rom[5] = 0x00;
+		rom[6] = 0x02;
+		rom[7] = 0x00;
+		for (size_t i = 0; i < program.size(); i++) {
+			rom[0x200 + i * 2] = (uint8_t)(program[i] >> 8);
+			rom[0x200 + i * 2 + 1] = (uint8_t)program[i];
+		}
+		bus.LoadRom(rom);
+		cpu.AttachBus(&bus);
+		cpu.Reset();
+	}
+}
+
+// MOVE.W (A0)+,(A1)+ x4 / MOVEA.L #$FF0000,A0 / MOVEA.L #$FF8000,A1 / BRA (memory copy loop)
+static void BM_GenesisM68k_MoveLoop(benchmark::State& state) {
+	GenesisPlatformBusStub bus;
+	GenesisM68kCpu cpu;
+	LoadProgram(bus, cpu, {0x32D8, 0x32D8, 0x32D8, 0x32D8, 0x207C, 0x00FF, 0x0000, 0x227C, 0x00FF, 0x8000, 0x60EA});
+
+	for (auto _ : state) {
+		cpu.Run(cpu.GetState().CycleCount + 7670000 / 60);
+	}
+	benchmark::DoNotOptimize(cpu.GetState().A[0]);
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GenesisM68k_MoveLoop)->Unit(benchmark::kMicrosecond);
+
+// MOVEQ / BNE / NOP (register-only instructions, measures the dispatch itself)
+static void BM_GenesisM68k_RegisterLoop(benchmark::State& state) {
+	GenesisPlatformBusStub bus;
+	GenesisM68kCpu cpu;
+	LoadProgram(bus, cpu, {0x7001, 0x4E71, 0x4E71, 0x3200, 0x66F6});
+
+	for (auto _ : state) {
+		cpu.Run(cpu.GetState().CycleCount + 7670000 / 60);
+	}
+	benchmark::DoNotOptimize(cpu.GetState().D[1]);
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GenesisM68k_RegisterLoop)->Unit(benchmark::kMicrosecond);
+
+static void BM_GenesisM68k_BusRead16Pages(benchmark::State& state) {
+	GenesisPlatformBusStub bus;
+	bus.LoadRom(vector<uint8_t>(0x10000, 0x4E));
+	for (auto _ : state) {
+		uint32_t sum = 0;
+		for (uint32_t addr = 0; addr < 0x10000; addr += 2) {
+			sum += bus.Read16(addr);
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * 0x8000);
+}
+BENCHMARK(BM_GenesisM68k_BusRead16Pages);
+
+static void BM_GenesisM68k_BusRead16Virtual(benchmark::State& state) {
+	GenesisPlatformBusStub bus;
+	bus.LoadRom(vector<uint8_t>(0x10000, 0x4E));
+	IGenesisM68kBus& virtualBus = bus;
+	for (auto _ : state) {
+		uint32_t sum = 0;
+		for (uint32_t addr = 0; addr < 0x10000; addr += 2) {
+			sum += (virtualBus.ReadByte(addr) << 8) | virtualBus.ReadByte(addr + 1);
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * 0x8000);
+}
+BENCHMARK(BM_GenesisM68k_BusRead16Virtual);
@@ -0,0 +1,372 @@
+#include "pch.h"
+#include <benchmark/benchmark.h>
+#include <array>
+#include <vector>
+#include "Lua/lua.hpp"
+#include "Debugger/MemoryCallbackIndex.h"
+#include "Shared/Video/DebugHud.h"
+#include "Shared/Video/DrawPixelBatchCommand.h"
+#include "Shared/Video/DrawRectangleBatchCommand.h"
+#include "Utilities/Serializer.h"
+
+// =============================================================================
+// Lua Scripting Overhead Benchmarks
+// =============================================================================
+// End-to-end costs of the scripting paths, measured with the same Lua calls and core components the
+// ScriptingContext/LuaApi use (the console itself isn't needed):
+// - memory callback dispatch, for various watched range sizes and script counts
+// - emu.read per byte vs emu.readRange
+// - draw command throughput (individual vs batched commands)
+// - getState (full Map serialization) vs getStateValue (filtered)
+// - endFrame event callbacks per frame
+
+namespace {
+
+constexpr uint32_t kMemorySize = 0x2000;
+std::array<uint8_t, kMemorySize> g_memory = {};
+
+// Same calling sequence as ScriptingContext::InternalCallMemoryCallback/CallEventCallback
+void CallCallback(lua_State* L, int reference, int64_t arg1, int64_t arg2, int argCount) {
+	int top = lua_gettop(L);
+	lua_rawgeti(L, LUA_REGISTRYINDEX, reference);
+	lua_pushinteger(L, arg1);
+	if (argCount > 1) {
+		lua_pushinteger(L, arg2);
+	}
+	if (lua_pcall(L, argCount, LUA_MULTRET, 0) != LUA_OK) {
+		lua_pop(L, 1);
+	}
+	lua_settop(L, top);
+}
+
+int GetFunctionReference(lua_State* L, const char* script) {
+	if (luaL_dostring(L, script) != LUA_OK || !lua_isfunction(L, -1)) {
+		return LUA_NOREF;
+	}
+	return luaL_ref(L, LUA_REGISTRYINDEX);
+}
+
+// emu.read(address) equivalent
+int LuaRead(lua_State* L) {
+	lua_Integer address = luaL_checkinteger(L, 1);
+	lua_pushinteger(L, g_memory[address & (kMemorySize - 1)]);
+	return 1;
+}
+
+// emu.readRange(address, length) equivalent (string result)
+int LuaReadRange(lua_State* L) {
+	lua_Integer address = luaL_checkinteger(L, 1);
+	lua_Integer length = luaL_checkinteger(L, 2);
+	if (address < 0 || length < 0 || address + length > kMemorySize) {
+		return luaL_error(L, "range exceeds the memory size");
+	}
+	lua_pushlstring(L, (const char*)g_memory.data() + address, (size_t)length);
+	return 1;
+}
+
+lua_State* CreateReadState() {
+	lua_State* L = luaL_newstate();
+	luaL_openlibs(L);
+	lua_newtable(L);
+	lua_pushcfunction(L, LuaRead);
+	lua_setfield(L, -2, "read");
+	lua_pushcfunction(L, LuaReadRange);
+	lua_setfield(L, -2, "readRange");
+	lua_setglobal(L, "emu");
+	return L;
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+// Memory callbacks: index check + callback for each access, across 0x2000 addresses
+// Args: watched range size, script count
+// -----------------------------------------------------------------------------
+static void BM_LuaScripting_MemoryCallbacks(benchmark::State& state) {
+	uint32_t rangeSize = (uint32_t)state.range(0);
+	int scriptCount = (int)state.range(1);
+
+	vector<lua_State*> scripts;
+	vector<int> references;
+	MemoryCallbackIndex index;
+	for (int i = 0; i < scriptCount; i++) {
+		lua_State* L = luaL_newstate();
+		luaL_openlibs(L);
+		scripts.push_back(L);
+		references.push_back(GetFunctionReference(L, "local count = 0 return function(address, value) count = count + value end"));
+		index.AddRange(MemoryType::SnesMemory, 0x100, 0x100 + rangeSize - 1);
+	}
+
+	uint64_t callbackCount = 0;
+	for (auto _ : state) {
+		for (uint32_t addr = 0; addr < kMemorySize; addr++) {
+			AddressInfo relAddr = {(int32_t)addr, MemoryType::SnesMemory};
+			if (!index.Contains(relAddr)) {
+				continue;
+			}
+			for (int i = 0; i < scriptCount; i++) {
+				if (addr >= 0x100 && addr < 0x100 + rangeSize) {
+					CallCallback(scripts[i], references[i], addr, g_memory[addr], 2);
+					callbackCount++;
+				}
+			}
+		}
+	}
+
+	state.SetItemsProcessed(state.iterations() * kMemorySize);
+	state.counters["Callbacks"] = benchmark::Counter((double)callbackCount, benchmark::Counter::kAvgIterations);
+	for (lua_State* L : scripts) {
+		lua_close(L);
+	}
+}
+BENCHMARK(BM_LuaScripting_MemoryCallbacks)
+    ->Args({1, 1})
+    ->Args({16, 1})
+    ->Args({256, 1})
+    ->Args({4096, 1})
+    ->Args({1, 4})
+    ->Args({256, 4})
+    ->Args({4096, 4});
+
+// -----------------------------------------------------------------------------
+// Reading 4KB from a frame callback: emu.read per byte vs emu.readRange
+// -----------------------------------------------------------------------------
+static void BM_LuaScripting_Read_PerByte(benchmark::State& state) {
+	lua_State* L = CreateReadState();
+	int reference = GetFunctionReference(L, R"lua(
+		return function()
+			local sum = 0
+			for i = 0, 4095 do
+				sum = sum + emu.read(i)
+			end
+			return sum
+		end
+	)lua");
+
+	for (auto _ : state) {
+		CallCallback(L, reference, 0, 0, 1);
+	}
+	state.SetBytesProcessed(state.iterations() * 4096);
+	lua_close(L);
+}
+BENCHMARK(BM_LuaScripting_Read_PerByte);
+
+static void BM_LuaScripting_Read_RangeString(benchmark::State& state) {
+	lua_State* L = CreateReadState();
+	int reference = GetFunctionReference(L, R"lua(
+		return function()
+			local data = emu.readRange(0, 4096)
+			local sum = 0
+			for i = 1, 4096 do
+				sum = sum + string.byte(data, i)
+			end
+			return sum
+		end
+	)lua");
+
+	for (auto _ : state) {
+		CallCallback(L, reference, 0, 0, 1);
+	}
+	state.SetBytesProcessed(state.iterations() * 4096);
+	lua_close(L);
+}
+BENCHMARK(BM_LuaScripting_Read_RangeString);
+
+static void BM_LuaScripting_Read_RangeUnpack(benchmark::State& state) {
+	lua_State* L = CreateReadState();
+	int reference = GetFunctionReference(L, R"lua(
+		return function()
+			local data = emu.readRange(0, 4096)
+			local sum = 0
+			for i = 1, 4096, 256 do
+				local values = { string.byte(data, i, i + 255) }
+				for j = 1, 256 do
+					sum = sum + values[j]
+				end
+			end
+			return sum
+		end
+	)lua");
+
+	for (auto _ : state) {
+		CallCallback(L, reference, 0, 0, 1);
+	}
+	state.SetBytesProcessed(state.iterations() * 4096);
+	lua_close(L);
+}
+BENCHMARK(BM_LuaScripting_Read_RangeUnpack);
+
+// -----------------------------------------------------------------------------
+// Draw command throughput: queue N pixels/rectangles and draw one frame
+// -----------------------------------------------------------------------------
+namespace {
+constexpr FrameInfo kHudSize = {256, 240};
+}
+
+static void BM_LuaScripting_Draw_Pixels_Individual(benchmark::State& state) {
+	int count = (int)state.range(0);
+	DebugHud hud;
+	vector<uint32_t> surface(kHudSize.Width * kHudSize.Height);
+	uint32_t frame = 0;
+	for (auto _ : state) {
+		frame++;
+		for (int i = 0; i < count; i++) {
+			hud.DrawPixel(i & 0xFF, (i >> 8) % 240, 0xFF0000 | i, 1, frame);
+		}
+		hud.Draw(surface.data(), kHudSize, {}, frame, {}, true);
+	}
+	state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_LuaScripting_Draw_Pixels_Individual)->Arg(256)->Arg(4096);
+
+static void BM_LuaScripting_Draw_Pixels_Batch(benchmark::State& state) {
+	int count = (int)state.range(0);
+	DebugHud hud;
+	vector<uint32_t> surface(kHudSize.Width * kHudSize.Height);
+	uint32_t frame = 0;
+	for (auto _ : state) {
+		frame++;
+		unique_ptr<DrawPixelBatchCommand> batch(new DrawPixelBatchCommand(1, frame, count));
+		for (int i = 0; i < count; i++) {
+			batch->AddPixel(i & 0xFF, (i >> 8) % 240, 0xFF0000 | i);
+		}
+		hud.AddCommand(std::move(batch));
+		hud.Draw(surface.data(), kHudSize, {}, frame, {}, true);
+	}
+	state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_LuaScripting_Draw_Pixels_Batch)->Arg(256)->Arg(4096);
+
+static void BM_LuaScripting_Draw_Rectangles_Individual(benchmark::State& state) {
+	int count = (int)state.range(0);
+	DebugHud hud;
+	vector<uint32_t> surface(kHudSize.Width * kHudSize.Height);
+	uint32_t frame = 0;
+	for (auto _ : state) {
+		frame++;
+		for (int i = 0; i < count; i++) {
+			hud.DrawRectangle((i * 8) & 0xFF, (i * 3) % 224, 16, 16, 0x80FF0000, false, 1, frame);
+		}
+		hud.Draw(surface.data(), kHudSize, {}, frame, {}, true);
+	}
+	state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_LuaScripting_Draw_Rectangles_Individual)->Arg(64)->Arg(1024);
+
+static void BM_LuaScripting_Draw_Rectangles_Batch(benchmark::State& state) {
+	int count = (int)state.range(0);
+	DebugHud hud;
+	vector<uint32_t> surface(kHudSize.Width * kHudSize.Height);
+	uint32_t frame = 0;
+	for (auto _ : state) {
+		frame++;
+		unique_ptr<DrawRectangleBatchCommand> batch(new DrawRectangleBatchCommand(false, 1, frame, count));
+		for (int i = 0; i < count; i++) {
+			batch->AddRectangle((i * 8) & 0xFF, (i * 3) % 224, 16, 16, 0x80FF0000);
+		}
+		hud.AddCommand(std::move(batch));
+		hud.Draw(surface.data(), kHudSize, {}, frame, {}, true);
+	}
+	state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_LuaScripting_Draw_Rectangles_Batch)->Arg(64)->Arg(1024);
+
+// -----------------------------------------------------------------------------
+// State access: getState (whole console) vs getStateValue("cpu.a") (filtered)
+// -----------------------------------------------------------------------------
+namespace {
+class BenchCpuState : public ISerializable {
+public:
+	uint32_t pc = 0x8000;
+	uint16_t a = 0, x = 0, y = 0, sp = 0x1FF;
+	uint8_t ps = 0;
+	uint64_t cycleCount = 0;
+	bool irqPending = false;
+
+	void Serialize(Serializer& s) override {
+		SV(pc);
+		SV(a);
+		SV(x);
+		SV(y);
+		SV(sp);
+		SV(ps);
+		SV(cycleCount);
+		SV(irqPending);
+	}
+};
+
+class BenchRegisterBlock : public ISerializable {
+public:
+	uint8_t registers[48] = {};
+	uint16_t counters[16] = {};
+
+	void Serialize(Serializer& s) override {
+		SVArray(registers, 48);
+		SVArray(counters, 16);
+	}
+};
+
+class BenchConsole : public ISerializable {
+public:
+	BenchCpuState cpu;
+	BenchCpuState spc;
+	BenchRegisterBlock ppu;
+	BenchRegisterBlock dsp;
+	BenchRegisterBlock dma;
+	BenchRegisterBlock cart;
+
+	void Serialize(Serializer& s) override {
+		SV(cpu);
+		SV(spc);
+		SV(ppu);
+		SV(dsp);
+		SV(dma);
+		SV(cart);
+	}
+};
+} // namespace
+
+static void BM_LuaScripting_State_Full(benchmark::State& state) {
+	BenchConsole console;
+	for (auto _ : state) {
+		Serializer s(0, true, SerializeFormat::Map);
+		s.Stream(console, "", -1);
+		auto result = s.GetMapValues().find("cpu.a");
+		benchmark::DoNotOptimize(result);
+	}
+}
+BENCHMARK(BM_LuaScripting_State_Full);
+
+static void BM_LuaScripting_State_Filtered(benchmark::State& state) {
+	BenchConsole console;
+	for (auto _ : state) {
+		Serializer s(0, true, SerializeFormat::Map);
+		s.SetKeyFilter({"cpu.a"});
+		s.Stream(console, "", -1);
+		auto result = s.GetMapValues().find("cpu.a");
+		benchmark::DoNotOptimize(result);
+	}
+}
+BENCHMARK(BM_LuaScripting_State_Filtered);
+
+// -----------------------------------------------------------------------------
+// Event callbacks: N endFrame callbacks per frame
+// -----------------------------------------------------------------------------
+static void BM_LuaScripting_EventCallbacks(benchmark::State& state) {
+	int callbackCount = (int)state.range(0);
+	lua_State* L = luaL_newstate();
+	luaL_openlibs(L);
+	vector<int> references;
+	for (int i = 0; i < callbackCount; i++) {
+		references.push_back(GetFunctionReference(L, "local frames = 0 return function(cpuType) frames = frames + 1 end"));
+	}
+
+	for (auto _ : state) {
+		for (int reference : references) {
+			CallCallback(L, reference, 0, 0, 1);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * callbackCount);
+	lua_close(L);
+}
+BENCHMARK(BM_LuaScripting_EventCallbacks)->Arg(1)->Arg(8)->Arg(64);
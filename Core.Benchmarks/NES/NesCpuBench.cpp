@@ -1,5 +1,6 @@
 #include "pch.h"
 #include <array>
+#include <random>
 #include "NES/NesTypes.h"
 
 // =============================================================================
@@ -513,3 +514,144 @@ static void BM_NesCpu_ROR_Branchless(benchmark::State& state) {
 }
 BENCHMARK(BM_NesCpu_ROR_Branchless);
 
+
+// =============================================================================
+// Phase 3: Opcode Dispatch
+// =============================================================================
+// Small 6502 subset run two ways: NesCpu's dispatch (addressing mode table + switch,
+// then the handler), and one template instance per opcode with the operand fetch and
+// the operation fused at compile time. The fused table is slower here: it turns ~70
+// handlers into 256 indirect call targets, which the branch predictor handles worse
+// than the (well-predicted) addressing mode switch. NesCpu keeps the runtime switch.
+
+namespace {
+	enum class BenchAddrMode : uint8_t { Imp, Imm, Zero, ZeroX, Abs, AbsX };
+
+	class DispatchBenchCpu {
+	public:
+		typedef void (DispatchBenchCpu::*Func)();
+
+		std::array<uint8_t, 0x10000> Ram = {};
+		uint16_t PC = 0;
+		uint8_t A = 0, X = 0, PS = 0;
+		uint16_t Operand = 0;
+		BenchAddrMode InstAddrMode = BenchAddrMode::Imp;
+
+		std::array<Func, 256> OpTable = {};
+		std::array<BenchAddrMode, 256> AddrModes = {};
+		std::array<Func, 256> ExecTable = {};
+
+		__noinline uint8_t Read(uint16_t addr) { return Ram[addr]; }
+		uint8_t ReadByte() { return Read(PC++); }
+		uint16_t ReadWord() { uint8_t lo = ReadByte(); return lo | (ReadByte() << 8); }
+		void SetZeroNeg(uint8_t value) { PS = (PS & ~(PSFlags::Zero | PSFlags::Negative)) | (value == 0 ? PSFlags::Zero : 0) | (value & 0x80); }
+
+		uint8_t GetOperandValue() { return InstAddrMode >= BenchAddrMode::Zero ? Read(Operand) : (uint8_t)Operand; }
+
+		void NOP() {}
+		void LDA() { A = GetOperandValue(); SetZeroNeg(A); }
+		void ADC() { A += GetOperandValue(); SetZeroNeg(A); }
+		void STA() { Ram[Operand] = A; }
+		void INX() { X++; SetZeroNeg(X); }
+
+		uint16_t FetchOperand() {
+			switch (InstAddrMode) {
+				case BenchAddrMode::Imp: Read(PC); return 0;
+				case BenchAddrMode::Imm: return ReadByte();
+				case BenchAddrMode::Zero: return ReadByte();
+				case BenchAddrMode::ZeroX: return (uint8_t)(ReadByte() + X);
+				case BenchAddrMode::Abs: return ReadWord();
+				case BenchAddrMode::AbsX: return ReadWord() + X;
+			}
+			return 0;
+		}
+
+		template <BenchAddrMode mode>
+		uint16_t FetchOperand() {
+			if constexpr (mode == BenchAddrMode::Imp) { Read(PC); return 0; }
+			else if constexpr (mode == BenchAddrMode::Imm || mode == BenchAddrMode::Zero) { return ReadByte(); }
+			else if constexpr (mode == BenchAddrMode::ZeroX) { return (uint8_t)(ReadByte() + X); }
+			else if constexpr (mode == BenchAddrMode::Abs) { return ReadWord(); }
+			else { return ReadWord() + X; }
+		}
+
+		template <BenchAddrMode mode, Func op>
+		void ExecOpCode() {
+			InstAddrMode = mode;
+			Operand = FetchOperand<mode>();
+			(this->*op)();
+		}
+
+		template <uint8_t opCode, BenchAddrMode mode, Func op>
+		void Register() {
+			OpTable[opCode] = op;
+			AddrModes[opCode] = mode;
+			ExecTable[opCode] = &DispatchBenchCpu::ExecOpCode<mode, op>;
+		}
+
+		DispatchBenchCpu() {
+			OpTable.fill(&DispatchBenchCpu::NOP);
+			ExecTable.fill(&DispatchBenchCpu::ExecOpCode<BenchAddrMode::Imp, &DispatchBenchCpu::NOP>);
+			Register<0xA9, BenchAddrMode::Imm, &DispatchBenchCpu::LDA>();
+			Register<0xA5, BenchAddrMode::Zero, &DispatchBenchCpu::LDA>();
+			Register<0xBD, BenchAddrMode::AbsX, &DispatchBenchCpu::LDA>();
+			Register<0x65, BenchAddrMode::Zero, &DispatchBenchCpu::ADC>();
+			Register<0x6D, BenchAddrMode::Abs, &DispatchBenchCpu::ADC>();
+			Register<0x95, BenchAddrMode::ZeroX, &DispatchBenchCpu::STA>();
+			Register<0x8D, BenchAddrMode::Abs, &DispatchBenchCpu::STA>();
+			Register<0xE8, BenchAddrMode::Imp, &DispatchBenchCpu::INX>();
+
+			// Random mix of the opcodes above (fixed seed) in the first 4 KB, the rest of the address space is data.
+			// A repeating sequence would let the branch predictor learn the addressing mode switch, real code doesn't.
+			const uint8_t opCodes[] = { 0xA9, 0xA5, 0xBD, 0x65, 0x6D, 0x95, 0x8D, 0xE8, 0xEA };
+			const uint8_t lengths[] = { 2, 2, 3, 2, 3, 2, 3, 1, 1 };
+			std::mt19937 rng(1234);
+			for (uint32_t i = 0; i < 0x1000;) {
+				uint32_t index = rng() % sizeof(opCodes);
+				Ram[i] = opCodes[index];
+				for (uint32_t j = 1; j < lengths[index] && i + j < 0x1000; j++) {
+					Ram[i + j] = (uint8_t)rng();
+				}
+				i += lengths[index];
+			}
+		}
+
+		void RunSwitch() {
+			uint8_t opCode = ReadByte();
+			InstAddrMode = AddrModes[opCode];
+			Operand = FetchOperand();
+			(this->*OpTable[opCode])();
+			PC &= 0xFFF;
+		}
+
+		void RunFused() {
+			uint8_t opCode = ReadByte();
+			(this->*ExecTable[opCode])();
+			PC &= 0xFFF;
+		}
+	};
+}
+
+static void BM_NesCpu_Dispatch_RuntimeAddrMode(benchmark::State& state) {
+	DispatchBenchCpu cpu;
+	for (auto _ : state) {
+		for (int i = 0; i < 100; i++) {
+			cpu.RunSwitch();
+		}
+		benchmark::DoNotOptimize(cpu.A);
+	}
+	state.SetItemsProcessed(state.iterations() * 100);
+}
+BENCHMARK(BM_NesCpu_Dispatch_RuntimeAddrMode);
+
+static void BM_NesCpu_Dispatch_FusedTable(benchmark::State& state) {
+	DispatchBenchCpu cpu;
+	for (auto _ : state) {
+		for (int i = 0; i < 100; i++) {
+			cpu.RunFused();
+		}
+		benchmark::DoNotOptimize(cpu.A);
+	}
+	state.SetItemsProcessed(state.iterations() * 100);
+}
+BENCHMARK(BM_NesCpu_Dispatch_FusedTable);
@@ -1,6 +1,10 @@
 #include "pch.h"
 #include <array>
+#include <random>
 #include "SNES/SnesCpuTypes.h"
+#include "SNES/MemoryMappings.h"
+#include "SNES/RamHandler.h"
+#include "SNES/RomHandler.h"
 
 // =============================================================================
 // SNES CPU State Benchmarks (65816 Processor)
@@ -577,3 +581,77 @@ static void BM_SnesCpu_TestBits8_Branchless(benchmark::State& state) {
 }
 BENCHMARK(BM_SnesCpu_TestBits8_Branchless);
 
+// -----------------------------------------------------------------------------
+// Memory Access Benchmarks (MemoryMappings)
+// -----------------------------------------------------------------------------
+// Same memory map and access pattern as BM_VirtualDispatch_SnesStyleRead, but through
+// the real MemoryMappings: handler virtual call vs the direct page pointer table.
+
+namespace {
+	struct SnesMappingsFixture {
+		vector<uint8_t> ram = vector<uint8_t>(0x20000, 0x42);
+		vector<uint8_t> rom = vector<uint8_t>(0x400000, 0xAB);
+		vector<unique_ptr<IMemoryHandler>> ramHandlers;
+		vector<unique_ptr<IMemoryHandler>> romHandlers;
+		MemoryMappings mappings;
+		vector<uint32_t> addresses;
+
+		SnesMappingsFixture() {
+			for (uint32_t i = 0; i < ram.size(); i += 0x1000) {
+				ramHandlers.push_back(std::make_unique<RamHandler>(ram.data(), i, (uint32_t)ram.size(), MemoryType::SnesWorkRam));
+			}
+			for (uint32_t i = 0; i < rom.size(); i += 0x1000) {
+				romHandlers.push_back(std::make_unique<RomHandler>(rom.data(), i, (uint32_t)rom.size(), MemoryType::SnesPrgRom));
+			}
+
+			// LoROM-like: 00-3F/80-BF: RAM in the lower half, ROM in the upper half, 40-7D/C0-FF: ROM
+			mappings.RegisterHandler(0x00, 0x3F, 0x0000, 0x7FFF, ramHandlers);
+			mappings.RegisterHandler(0x80, 0xBF, 0x0000, 0x7FFF, ramHandlers);
+			mappings.RegisterHandler(0x00, 0x3F, 0x8000, 0xFFFF, romHandlers, 8);
+			mappings.RegisterHandler(0x80, 0xBF, 0x8000, 0xFFFF, romHandlers, 8);
+			mappings.RegisterHandler(0x40, 0x7D, 0x0000, 0xFFFF, romHandlers);
+			mappings.RegisterHandler(0xC0, 0xFF, 0x0000, 0xFFFF, romHandlers);
+
+			// 80% ROM reads, 20% RAM reads
+			std::mt19937 gen(42);
+			std::uniform_int_distribution<uint32_t> romDist(0x808000, 0xBFFFFF);
+			std::uniform_int_distribution<uint32_t> ramDist(0x000000, 0x3F7FFF);
+			std::bernoulli_distribution isRom(0.80);
+			addresses.resize(4096);
+			for (uint32_t& addr : addresses) {
+				addr = isRom(gen) ? romDist(gen) : ramDist(gen);
+			}
+		}
+	};
+}
+
+static void BM_SnesCpu_MemoryRead_Handler(benchmark::State& state) {
+	SnesMappingsFixture fixture;
+	for (auto _ : state) {
+		uint32_t sum = 0;
+		for (uint32_t addr : fixture.addresses) {
+			sum += fixture.mappings.GetHandler(addr)->Read(addr);
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * fixture.addresses.size());
+}
+BENCHMARK(BM_SnesCpu_MemoryRead_Handler);
+
+static void BM_SnesCpu_MemoryRead_DirectPage(benchmark::State& state) {
+	SnesMappingsFixture fixture;
+	for (auto _ : state) {
+		uint32_t sum = 0;
+		for (uint32_t addr : fixture.addresses) {
+			// Same fallback as SnesMemoryManager::Read
+			if (uint8_t* page = fixture.mappings.GetDirectReadPage(addr)) [[likely]] {
+				sum += page[addr & 0xFFF];
+			} else {
+				sum += fixture.mappings.GetHandler(addr)->Read(addr);
+			}
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations() * fixture.addresses.size());
+}
+BENCHMARK(BM_SnesCpu_MemoryRead_DirectPage);
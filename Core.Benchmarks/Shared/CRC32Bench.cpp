@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "Utilities/CRC32.h"
+#include "Utilities/sha1.h"
 
 // ===== Small Buffer (typical ROM header) =====
 
@@ -70,3 +71,27 @@ static void BM_CRC32_Vector_512KB(benchmark::State& state) {
 	state.SetBytesProcessed(state.iterations() * data.size());
 }
 BENCHMARK(BM_CRC32_Vector_512KB);
+
+// ===== Hardware Acceleration vs Table-Driven =====
+
+static void BM_CRC32_Portable_4MB(benchmark::State& state) {
+	std::vector<uint8_t> data(4 * 1024 * 1024);
+	for (size_t i = 0; i < data.size(); i++) data[i] = (uint8_t)((i * 37) & 0xFF);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(CRC32::GetCRCPortable(data.data(), data.size()));
+	}
+	state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_CRC32_Portable_4MB);
+
+// ===== SHA-1 (ROM identification, hashed alongside the CRC) =====
+
+static void BM_SHA1_4MB(benchmark::State& state) {
+	std::vector<uint8_t> data(4 * 1024 * 1024);
+	for (size_t i = 0; i < data.size(); i++) data[i] = (uint8_t)((i * 37) & 0xFF);
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(SHA1::GetHash(data.data(), data.size()));
+	}
+	state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_SHA1_4MB);
@@ -170,3 +170,52 @@ static void BM_CheatLookup_SortedVector_Miss(benchmark::State& state) {
 	}
 }
 BENCHMARK(BM_CheatLookup_SortedVector_Miss);
+
+// ===== Bank bitmap prefilter: SNES 64KB bank with a large Action Replay list =====
+
+static std::vector<std::pair<uint32_t, BenchCheatCode>> MakeBankCheats(uint32_t count) {
+	std::vector<std::pair<uint32_t, BenchCheatCode>> cheats;
+	std::mt19937 rng(12345);
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t addr = 0x7E0000 | (rng() & 0xFFFF);
+		cheats.emplace_back(addr, BenchCheatCode{addr, -1, 0xFF});
+	}
+	std::sort(cheats.begin(), cheats.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+	return cheats;
+}
+
+static void BM_CheatLookup_SortedVector_BankReads_100Cheats(benchmark::State& state) {
+	auto cheats = MakeBankCheats(100);
+
+	uint32_t addr = 0x7E0000;
+	for (auto _ : state) {
+		auto it = std::lower_bound(cheats.begin(), cheats.end(), addr,
+			[](const std::pair<uint32_t, BenchCheatCode>& p, uint32_t a) { return p.first < a; });
+		benchmark::DoNotOptimize(it != cheats.end() && it->first == addr);
+		addr = 0x7E0000 | ((addr + 1) & 0xFFFF);
+	}
+}
+BENCHMARK(BM_CheatLookup_SortedVector_BankReads_100Cheats);
+
+static void BM_CheatLookup_Bitmap_BankReads_100Cheats(benchmark::State& state) {
+	auto cheats = MakeBankCheats(100);
+	std::vector<uint64_t> bits(0x10000 / 64);
+	for (auto& cheat : cheats) {
+		uint32_t offset = cheat.first & 0xFFFF;
+		bits[offset >> 6] |= (uint64_t)1 << (offset & 0x3F);
+	}
+
+	uint32_t addr = 0x7E0000;
+	for (auto _ : state) {
+		uint32_t offset = addr & 0xFFFF;
+		bool hit = (bits[offset >> 6] >> (offset & 0x3F)) & 1;
+		if (hit) {
+			auto it = std::lower_bound(cheats.begin(), cheats.end(), addr,
+				[](const std::pair<uint32_t, BenchCheatCode>& p, uint32_t a) { return p.first < a; });
+			hit = it != cheats.end() && it->first == addr;
+		}
+		benchmark::DoNotOptimize(hit);
+		addr = 0x7E0000 | ((addr + 1) & 0xFFFF);
+	}
+}
+BENCHMARK(BM_CheatLookup_Bitmap_BankReads_100Cheats);
@@ -0,0 +1,138 @@
+#include "pch.h"
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include "Shared/FrameBenchmark.h"
+#include "Shared/AllocationTracker.h"
+
+// =============================================================================
+// Whole-System Frame Benchmarks
+// =============================================================================
+// Runs whole frames of real games on a headless emulator (see FrameBenchmark),
+// one benchmark per ROM, to validate optimizations end to end. The other
+// benchmarks only measure isolated components.
+//
+// ROMs are not shipped with the repo, the benchmarks are registered from
+// environment variables:
+//   - NEXEN_BENCH_ROMS: ROM files and/or folders (scanned, not recursive),
+//     separated by ';' - e.g one test/homebrew ROM per console (NES, SNES and
+//     its coprocessors, GB/GBC/SGB, GBA, PCE/CD, SMS/GG, WS, Lynx)
+//   - NEXEN_BENCH_INPUT: optional scripted input, movie format (one line per
+//     input frame, e.g a movie's Input.txt), looped
+//   - NEXEN_BENCH_FRAMES: frames measured per pass (default: 600)
+//
+// Counters (per frame): fps, emulation_us (no audio/video), output_us
+// (audio/video cost), savestate_us/loadstate_us (run-ahead serializer).
+// Instrumented builds (make ALLOC_TRACKING=true) also report allocating_frames,
+// and fail the benchmark when a measured (steady-state) frame allocates.
+// For tracking, use --benchmark_format=json or --benchmark_out=<file>.
+
+namespace {
+	vector<string> SplitList(const char* value) {
+		vector<string> items;
+		string text = value ? value : "";
+		size_t start = 0;
+		while (start <= text.size()) {
+			size_t end = text.find(';', start);
+			if (end == string::npos) {
+				end = text.size();
+			}
+			if (end > start) {
+				items.push_back(text.substr(start, end - start));
+			}
+			start = end + 1;
+		}
+		return items;
+	}
+
+	vector<string> GetRomFiles() {
+		vector<string> files;
+		for (const string& path : SplitList(std::getenv("NEXEN_BENCH_ROMS"))) {
+			std::error_code err;
+			if (std::filesystem::is_directory(path, err)) {
+				for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(path, err)) {
+					if (entry.is_regular_file(err)) {
+						files.push_back(entry.path().string());
+					}
+				}
+			} else {
+				files.push_back(path);
+			}
+		}
+		std::sort(files.begin(), files.end());
+		return files;
+	}
+
+	FrameBenchmarkOptions GetOptions() {
+		FrameBenchmarkOptions options;
+		if (const char* frames = std::getenv("NEXEN_BENCH_FRAMES")) {
+			options.FrameCount = std::max(1, std::atoi(frames));
+		}
+		if (const char* inputFile = std::getenv("NEXEN_BENCH_INPUT")) {
+			std::ifstream input(inputFile);
+			string line;
+			while (std::getline(input, line)) {
+				if (!line.empty() && line.back() == '\r') {
+					line.pop_back();
+				}
+				options.Input.push_back(line);
+			}
+		}
+		return options;
+	}
+
+	const char* GetConsoleName(ConsoleType console) {
+		switch (console) {
+			case ConsoleType::Snes: return "SNES";
+			case ConsoleType::Gameboy: return "GB";
+			case ConsoleType::Nes: return "NES";
+			case ConsoleType::PcEngine: return "PCE";
+			case ConsoleType::Sms: return "SMS";
+			case ConsoleType::Gba: return "GBA";
+			case ConsoleType::Ws: return "WS";
+			case ConsoleType::Lynx: return "Lynx";
+			case ConsoleType::Atari2600: return "Atari2600";
+		}
+		return "Unknown";
+	}
+
+	void BM_FullFrame(benchmark::State& state, const string& romFile, const FrameBenchmarkOptions& options) {
+		for (auto _ : state) {
+			FrameBenchmarkResult result;
+			if (!FrameBenchmark::Run(romFile, options, result)) {
+				state.SkipWithError("Could not load the ROM");
+				return;
+			}
+
+			// Reported time = one regular frame (emulation + output)
+			state.SetIterationTime((result.EmulationTime + result.OutputTime) / 1000000.0);
+			state.counters["fps"] = result.GetFps();
+			state.counters["emulation_us"] = result.EmulationTime;
+			state.counters["output_us"] = result.OutputTime;
+			state.counters["savestate_us"] = result.SaveStateTime;
+			state.counters["loadstate_us"] = result.LoadStateTime;
+			state.SetLabel(GetConsoleName(result.Console));
+
+			if (AllocationTracker::Enabled) {
+				state.counters["allocating_frames"] = result.AllocatingFrames;
+				if (result.AllocatingFrames > 0) {
+					state.SkipWithError("Heap allocations in steady-state frames (see AllocationTracker)");
+					return;
+				}
+			}
+		}
+	}
+
+	// Each run boots the game, a single iteration already averages FrameCount frames
+	const bool _registered = []() {
+		FrameBenchmarkOptions options = GetOptions();
+		for (const string& romFile : GetRomFiles()) {
+			string name = "BM_FullFrame/" + std::filesystem::path(romFile).filename().string();
+			benchmark::RegisterBenchmark(name.c_str(), BM_FullFrame, romFile, options)
+				->Iterations(1)
+				->UseManualTime()
+				->Unit(benchmark::kMicrosecond);
+		}
+		return true;
+	}();
+}
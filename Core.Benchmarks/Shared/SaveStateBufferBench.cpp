@@ -1,6 +1,7 @@
 #include "pch.h"
 #include <vector>
 #include <cstring>
+#include "Shared/RewindCompressor.h"
 
 // Benchmark: std::move (defeats buffer reuse) vs memcpy (preserves buffer)
 // Simulates the SaveStateManager::GetVideoData hot path during rewind
@@ -86,3 +87,56 @@ static void BM_VideoData_Copy_RewindBurst(benchmark::State& state) {
 	}
 }
 BENCHMARK(BM_VideoData_Copy_RewindBurst);
+
+// ===== Rewind state decode: full decode vs decode cache (RewindCompressor) =====
+// Simulates rewinding through consecutive states that only differ in a few blocks
+
+static constexpr uint32_t RewindStateSize = 256 * 1024;
+
+static vector<shared_ptr<RewindStateBlocks>> MakeRewindHistory(RewindCompressor& compressor, uint32_t count) {
+	vector<uint8_t> data(RewindStateSize);
+	for (uint32_t i = 0; i < RewindStateSize; i++) {
+		data[i] = (uint8_t)(i * 7);
+	}
+
+	vector<shared_ptr<RewindStateBlocks>> history;
+	for (uint32_t i = 0; i < count; i++) {
+		// Work RAM changes every frame, the rest of the state rarely does
+		for (uint32_t j = 0; j < RewindCompressor::BlockSize * 2; j++) {
+			data[j] += (uint8_t)(i + 1);
+		}
+		history.push_back(compressor.Enqueue(vector<uint8_t>(data), history.empty() ? nullptr : history.back()));
+	}
+	for (shared_ptr<RewindStateBlocks>& state : history) {
+		RewindCompressor::Wait(*state);
+	}
+	return history;
+}
+
+static void BM_RewindDecode_Full(benchmark::State& state) {
+	RewindCompressor compressor;
+	vector<shared_ptr<RewindStateBlocks>> history = MakeRewindHistory(compressor, 10);
+	vector<uint8_t> output;
+
+	for (auto _ : state) {
+		for (size_t i = history.size(); i-- > 0;) {
+			RewindCompressor::Decode(*history[i], output);
+		}
+		benchmark::DoNotOptimize(output.data());
+	}
+}
+BENCHMARK(BM_RewindDecode_Full);
+
+static void BM_RewindDecode_Cached(benchmark::State& state) {
+	RewindCompressor compressor;
+	vector<shared_ptr<RewindStateBlocks>> history = MakeRewindHistory(compressor, 10);
+	RewindDecodeCache cache;
+
+	for (auto _ : state) {
+		for (size_t i = history.size(); i-- > 0;) {
+			RewindCompressor::Decode(history[i], cache);
+		}
+		benchmark::DoNotOptimize(cache.Data.data());
+	}
+}
+BENCHMARK(BM_RewindDecode_Cached);
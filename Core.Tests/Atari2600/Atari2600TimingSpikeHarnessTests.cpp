@@ -66,4 +66,77 @@ namespace {
 		EXPECT_FALSE(runA.Digest.empty());
 		EXPECT_EQ(runA.Digest, runB.Digest);
 	}
+
+	TEST(Atari2600TimingSpikeHarnessTests, BatchedSteppingMatchesSingleCycleSteps) {
+		Emulator emu;
+		Atari2600Console batched(&emu);
+		Atari2600Console single(&emu);
+
+		batched.Reset();
+		single.Reset();
+		batched.StepCpuCycles(Atari2600Console::CpuCyclesPerFrame * 2 + 123);
+		for (uint32_t i = 0; i < Atari2600Console::CpuCyclesPerFrame * 2 + 123; i++) {
+			single.StepCpuCycles(1);
+		}
+
+		Atari2600TiaState a = batched.GetTiaState();
+		Atari2600TiaState b = single.GetTiaState();
+		EXPECT_EQ(a.FrameCount, b.FrameCount);
+		EXPECT_EQ(a.Scanline, b.Scanline);
+		EXPECT_EQ(a.ColorClock, b.ColorClock);
+		EXPECT_EQ(a.TotalColorClocks, b.TotalColorClocks);
+		EXPECT_EQ(batched.GetRiotState().CpuCycles, single.GetRiotState().CpuCycles);
+	}
+
+	TEST(Atari2600TimingSpikeHarnessTests, ScanlineIsRenderedInSpansBetweenRegisterWrites) {
+		Emulator emu;
+		Atari2600Console console(&emu);
+		console.Reset();
+
+		// Start of the first visible scanline, then change the background color at pixel 80
+		console.StepCpuCycles(Atari2600Console::FirstVisibleScanline * 76);
+		console.WriteTiaRegister(0x09, 0x1E);
+		console.StepCpuCycles((Atari2600Console::HBlankColorClocks + 80) / 3);
+		uint32_t splitPixel = console.GetTiaState().ColorClock - Atari2600Console::HBlankColorClocks;
+		console.WriteTiaRegister(0x09, 0x44);
+
+		// WSYNC ends the line, the next line uses the latest color
+		console.RequestWsync();
+		console.StepCpuCycles(1);
+		console.StepCpuCycles(76);
+
+		uint16_t* frame = reinterpret_cast<uint16_t*>(console.GetPpuFrame().FrameBuffer);
+		EXPECT_EQ(frame[0], 0x1E);
+		EXPECT_EQ(frame[splitPixel - 1], 0x1E);
+		EXPECT_EQ(frame[splitPixel], 0x44);
+		EXPECT_EQ(frame[Atari2600Console::ScreenWidth - 1], 0x44);
+		EXPECT_EQ(frame[Atari2600Console::ScreenWidth], 0x44);
+	}
+
+	TEST(Atari2600TimingSpikeHarnessTests, PlayfieldIsRepeatedOrReflected) {
+		Emulator emu;
+		Atari2600Console console(&emu);
+		console.Reset();
+
+		console.StepCpuCycles(Atari2600Console::FirstVisibleScanline * 76);
+		console.WriteTiaRegister(0x08, 0x0E);
+		console.WriteTiaRegister(0x09, 0x00);
+		console.WriteTiaRegister(0x0D, 0x10);
+		console.StepCpuCycles(76);
+		console.WriteTiaRegister(0x0A, 0x01);
+		console.StepCpuCycles(76);
+
+		// PF0 bit 4 = leftmost 4 pixels, repeated on the right half, then mirrored to the right edge
+		uint16_t* frame = reinterpret_cast<uint16_t*>(console.GetPpuFrame().FrameBuffer);
+		EXPECT_EQ(frame[3], 0x0E);
+		EXPECT_EQ(frame[4], 0x00);
+		EXPECT_EQ(frame[80], 0x0E);
+		EXPECT_EQ(frame[159], 0x00);
+
+		uint16_t* reflected = frame + Atari2600Console::ScreenWidth;
+		EXPECT_EQ(reflected[0], 0x0E);
+		EXPECT_EQ(reflected[80], 0x00);
+		EXPECT_EQ(reflected[156], 0x0E);
+		EXPECT_EQ(reflected[159], 0x0E);
+	}
 }
@@ -0,0 +1,58 @@
+#include "pch.h"
+#include "Debugger/AccessCounterPages.h"
+
+// =============================================================================
+// AccessCounterPages Unit Tests
+// =============================================================================
+// Pages are allocated on first access, untouched pages read as zeroes, and range copies that cross
+// pages match per-address reads.
+
+TEST(AccessCounterPagesTest, UntouchedAddressesReadAsZero) {
+	AccessCounterPages counters;
+	counters.Init(AccessCounterPages::PageSize * 4 + 10);
+	EXPECT_EQ(counters.GetSize(), AccessCounterPages::PageSize * 4 + 10);
+
+	AddressCounters value = counters.Peek(AccessCounterPages::PageSize * 4 + 5);
+	EXPECT_EQ(value.ReadStamp, 0u);
+	EXPECT_EQ(value.ExecCounter, 0u);
+	EXPECT_EQ(counters.Peek(AccessCounterPages::PageSize * 10).ReadCounter, 0u);
+}
+
+TEST(AccessCounterPagesTest, CopyRangeMatchesPeek) {
+	AccessCounterPages counters;
+	constexpr uint32_t size = AccessCounterPages::PageSize * 8;
+	counters.Init(size);
+
+	// Touch a few addresses in pages 1, 2 and 6 only
+	for (uint32_t addr : {AccessCounterPages::PageSize + 3, AccessCounterPages::PageSize * 3 - 1, AccessCounterPages::PageSize * 6}) {
+		AddressCounters& value = counters.Get(addr);
+		value.ReadCounter += addr;
+		value.WriteStamp = (uint64_t)addr << 32;
+	}
+
+	constexpr uint32_t offset = AccessCounterPages::PageSize - 7;
+	constexpr uint32_t length = AccessCounterPages::PageSize * 6;
+	vector<AddressCounters> range(length);
+	counters.CopyRange(offset, length, range.data());
+	for (uint32_t i = 0; i < length; i++) {
+		AddressCounters expected = counters.Peek(offset + i);
+		ASSERT_EQ(range[i].ReadCounter, expected.ReadCounter) << "address=" << offset + i;
+		ASSERT_EQ(range[i].WriteStamp, expected.WriteStamp) << "address=" << offset + i;
+	}
+	EXPECT_EQ(range[AccessCounterPages::PageSize + 3 - offset].ReadCounter, AccessCounterPages::PageSize + 3);
+	EXPECT_EQ(range[AccessCounterPages::PageSize * 6 - offset].WriteStamp, (uint64_t)(AccessCounterPages::PageSize * 6) << 32);
+}
+
+TEST(AccessCounterPagesTest, ResetClearsCounters) {
+	AccessCounterPages counters;
+	counters.Init(AccessCounterPages::PageSize * 2);
+	counters.Get(100).ExecCounter = 5;
+	counters.Get(100).ExecStamp = 1234;
+
+	counters.Reset();
+	EXPECT_EQ(counters.Peek(100).ExecCounter, 0u);
+	EXPECT_EQ(counters.Peek(100).ExecStamp, 0u);
+
+	counters.Get(100).ExecCounter++;
+	EXPECT_EQ(counters.Peek(100).ExecCounter, 1u);
+}
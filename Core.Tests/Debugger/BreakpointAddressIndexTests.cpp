@@ -0,0 +1,130 @@
+#include "pch.h"
+#include "Debugger/BreakpointAddressIndex.h"
+
+// =============================================================================
+// BreakpointAddressIndex Unit Tests
+// =============================================================================
+// Compares the candidates returned by the index with a linear scan using the same range check as
+// Breakpoint::Matches (any byte of the access inside [start, end]).
+
+namespace {
+	struct TestRange {
+		MemoryType MemType;
+		int32_t Start;
+		int32_t End;
+	};
+
+	template <uint8_t accessWidth>
+	vector<uint32_t> GetExpected(const vector<TestRange>& ranges, MemoryType memType, int32_t address) {
+		vector<uint32_t> result;
+		for (uint32_t i = 0; i < ranges.size(); i++) {
+			if (ranges[i].MemType != memType) {
+				continue;
+			}
+			for (int j = 0; j < accessWidth; j++) {
+				if ((int64_t)address + j >= ranges[i].Start && (int64_t)address + j <= ranges[i].End) {
+					result.push_back(i);
+					break;
+				}
+			}
+		}
+		return result;
+	}
+
+	template <uint8_t accessWidth>
+	vector<uint32_t> GetCandidates(BreakpointAddressIndex& index, MemoryType memType, int32_t address) {
+		vector<uint32_t> result;
+		index.GetCandidates<accessWidth>(memType, address, result);
+		std::sort(result.begin(), result.end());
+		return result;
+	}
+
+	void BuildIndex(BreakpointAddressIndex& index, const vector<TestRange>& ranges) {
+		index.Clear();
+		for (uint32_t i = 0; i < ranges.size(); i++) {
+			index.Add(ranges[i].MemType, ranges[i].Start, ranges[i].End, i);
+		}
+		index.Build();
+	}
+
+	uint32_t NextRandom(uint32_t& seed) {
+		seed = seed * 1103515245 + 12345;
+		return seed >> 8;
+	}
+}
+
+TEST(BreakpointAddressIndexTest, EmptyIndexHasNoCandidates) {
+	auto index = std::make_unique<BreakpointAddressIndex>();
+	index->Build();
+	EXPECT_TRUE((GetCandidates<1>(*index, MemoryType::SnesMemory, 0x7E0000)).empty());
+	EXPECT_TRUE((GetCandidates<4>(*index, MemoryType::GbaMemory, -1)).empty());
+}
+
+TEST(BreakpointAddressIndexTest, SingleAddressAndRange) {
+	auto index = std::make_unique<BreakpointAddressIndex>();
+	vector<TestRange> ranges = {
+		{MemoryType::SnesMemory, 0x7E0010, 0x7E0010},
+		{MemoryType::SnesMemory, 0x008000, 0x00FFFF},
+		{MemoryType::SnesWorkRam, 0x10, 0x10},
+	};
+	BuildIndex(*index, ranges);
+
+	EXPECT_EQ((GetCandidates<1>(*index, MemoryType::SnesMemory, 0x7E0010)), vector<uint32_t>{0});
+	EXPECT_TRUE((GetCandidates<1>(*index, MemoryType::SnesMemory, 0x7E0011)).empty());
+	EXPECT_TRUE((GetCandidates<1>(*index, MemoryType::SnesMemory, 0x7E000F)).empty());
+	EXPECT_EQ((GetCandidates<2>(*index, MemoryType::SnesMemory, 0x7E000F)), vector<uint32_t>{0});
+	EXPECT_EQ((GetCandidates<1>(*index, MemoryType::SnesMemory, 0x00C000)), vector<uint32_t>{1});
+	EXPECT_EQ((GetCandidates<1>(*index, MemoryType::SnesWorkRam, 0x10)), vector<uint32_t>{2});
+	EXPECT_TRUE((GetCandidates<1>(*index, MemoryType::SpcMemory, 0x10)).empty());
+}
+
+TEST(BreakpointAddressIndexTest, AccessAcrossPageBoundary) {
+	auto index = std::make_unique<BreakpointAddressIndex>();
+	vector<TestRange> ranges = {{MemoryType::GbaMemory, 0x03000400, 0x03000400}};
+	BuildIndex(*index, ranges);
+
+	EXPECT_EQ((GetCandidates<4>(*index, MemoryType::GbaMemory, 0x030003FE)), vector<uint32_t>{0});
+	EXPECT_TRUE((GetCandidates<2>(*index, MemoryType::GbaMemory, 0x030003FE)).empty());
+}
+
+TEST(BreakpointAddressIndexTest, NegativeAddresses) {
+	auto index = std::make_unique<BreakpointAddressIndex>();
+	vector<TestRange> ranges = {
+		{MemoryType::NesMemory, -1, 0x10},
+		{MemoryType::NesMemory, -5, -2},
+		{MemoryType::NesMemory, 0x20, 0x10},
+	};
+	BuildIndex(*index, ranges);
+
+	EXPECT_EQ((GetCandidates<1>(*index, MemoryType::NesMemory, -1)), vector<uint32_t>{0});
+	EXPECT_EQ((GetCandidates<1>(*index, MemoryType::NesMemory, -3)), vector<uint32_t>{1});
+	EXPECT_EQ((GetCandidates<2>(*index, MemoryType::NesMemory, -2)), (vector<uint32_t>{0, 1}));
+	EXPECT_EQ((GetCandidates<1>(*index, MemoryType::NesMemory, 0)), vector<uint32_t>{0});
+	EXPECT_TRUE((GetCandidates<1>(*index, MemoryType::NesMemory, 0x20)).empty());
+}
+
+TEST(BreakpointAddressIndexTest, RandomRangesMatchLinearScan) {
+	auto index = std::make_unique<BreakpointAddressIndex>();
+	constexpr MemoryType memTypes[] = {MemoryType::SnesMemory, MemoryType::SnesWorkRam, MemoryType::GbaMemory};
+
+	uint32_t seed = 0x5EED;
+	for (int pass = 0; pass < 20; pass++) {
+		vector<TestRange> ranges;
+		int count = 1 + (int)(NextRandom(seed) % 80);
+		for (int i = 0; i < count; i++) {
+			MemoryType memType = memTypes[NextRandom(seed) % 3];
+			int32_t start = (int32_t)(NextRandom(seed) & 0xFFFF) - 8;
+			int32_t length = (NextRandom(seed) & 0x03) ? (int32_t)(NextRandom(seed) & 0x07) : (int32_t)(NextRandom(seed) & 0x1FFF);
+			ranges.push_back({memType, start, start + length});
+		}
+		BuildIndex(*index, ranges);
+
+		for (int i = 0; i < 5000; i++) {
+			MemoryType memType = memTypes[NextRandom(seed) % 3];
+			int32_t address = (int32_t)(NextRandom(seed) & 0x1FFFF) - 16;
+			ASSERT_EQ((GetCandidates<1>(*index, memType, address)), (GetExpected<1>(ranges, memType, address))) << "address=" << address;
+			ASSERT_EQ((GetCandidates<2>(*index, memType, address)), (GetExpected<2>(ranges, memType, address))) << "address=" << address;
+			ASSERT_EQ((GetCandidates<4>(*index, memType, address)), (GetExpected<4>(ranges, memType, address))) << "address=" << address;
+		}
+	}
+}
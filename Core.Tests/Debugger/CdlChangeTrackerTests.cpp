@@ -0,0 +1,96 @@
+#include "pch.h"
+#include "Debugger/CdlChangeTracker.h"
+
+// =============================================================================
+// CdlChangeTracker Unit Tests
+// =============================================================================
+// Change tokens, changed page lists and the incremental code/data byte counts (compared with a full recount).
+
+namespace {
+	vector<uint32_t> GetChangedPages(CdlChangeTracker& tracker, uint32_t& token) {
+		vector<uint32_t> pages(64);
+		uint32_t count = tracker.GetChangedPages(token, pages.data(), (uint32_t)pages.size(), token);
+		pages.resize(count);
+		return pages;
+	}
+
+	void SetFlags(CdlChangeTracker& tracker, vector<uint8_t>& cdlData, uint32_t addr, uint8_t flags) {
+		uint8_t oldFlags = cdlData[addr];
+		cdlData[addr] |= flags;
+		if (cdlData[addr] != oldFlags) {
+			tracker.OnFlagsChanged(addr, oldFlags, cdlData[addr]);
+		}
+	}
+}
+
+TEST(CdlChangeTrackerTest, FirstQueryReturnsAllPages) {
+	CdlChangeTracker tracker;
+	tracker.Init(CdlChangeTracker::PageSize * 3 + 1);
+
+	uint32_t token = 0;
+	EXPECT_EQ(GetChangedPages(tracker, token), (vector<uint32_t>{0, 1, 2, 3}));
+	EXPECT_TRUE(GetChangedPages(tracker, token).empty());
+}
+
+TEST(CdlChangeTrackerTest, OnlyChangedPagesAreReported) {
+	CdlChangeTracker tracker;
+	vector<uint8_t> cdlData(CdlChangeTracker::PageSize * 8);
+	tracker.Init((uint32_t)cdlData.size());
+
+	uint32_t token = 0;
+	GetChangedPages(tracker, token);
+
+	SetFlags(tracker, cdlData, CdlChangeTracker::PageSize * 5 + 10, CdlFlags::Code);
+	SetFlags(tracker, cdlData, 3, CdlFlags::Data);
+	EXPECT_EQ(GetChangedPages(tracker, token), (vector<uint32_t>{0, 5}));
+	EXPECT_TRUE(GetChangedPages(tracker, token).empty());
+
+	tracker.MarkRangeChanged(CdlChangeTracker::PageSize - 1, CdlChangeTracker::PageSize * 2);
+	EXPECT_EQ(GetChangedPages(tracker, token), (vector<uint32_t>{0, 1, 2}));
+}
+
+TEST(CdlChangeTrackerTest, TokenIsUnchangedWhenOutputIsTooSmall) {
+	CdlChangeTracker tracker;
+	tracker.Init(CdlChangeTracker::PageSize * 4);
+
+	uint32_t pages[2];
+	uint32_t nextToken;
+	EXPECT_EQ(tracker.GetChangedPages(0, pages, 2, nextToken), 2u);
+	EXPECT_EQ(nextToken, 0u);
+}
+
+TEST(CdlChangeTrackerTest, CountsMatchFullRecount) {
+	CdlChangeTracker tracker;
+	vector<uint8_t> cdlData(0x10000);
+	tracker.Init((uint32_t)cdlData.size());
+
+	uint32_t seed = 0x1234;
+	for (int i = 0; i < 50000; i++) {
+		seed = seed * 1103515245 + 12345;
+		uint32_t addr = (seed >> 8) & 0xFFFF;
+		uint8_t flags = (uint8_t)((seed >> 24) & 0x0F);
+		SetFlags(tracker, cdlData, addr, flags);
+	}
+
+	uint32_t codeBytes = tracker.GetCodeBytes();
+	uint32_t dataBytes = tracker.GetDataBytes();
+	tracker.Recount(cdlData.data(), (uint32_t)cdlData.size());
+	EXPECT_EQ(codeBytes, tracker.GetCodeBytes());
+	EXPECT_EQ(dataBytes, tracker.GetDataBytes());
+	EXPECT_GT(codeBytes, 0u);
+	EXPECT_GT(dataBytes, 0u);
+}
+
+TEST(CdlChangeTrackerTest, PageStampsAreBelowTokenUntilChanged) {
+	CdlChangeTracker tracker;
+	vector<uint8_t> cdlData(CdlChangeTracker::PageSize * 2);
+	tracker.Init((uint32_t)cdlData.size());
+
+	uint32_t token = tracker.TakeToken();
+	EXPECT_LT(tracker.GetPageStamp(0), token);
+	EXPECT_LT(tracker.GetPageStamp(1), token);
+
+	SetFlags(tracker, cdlData, CdlChangeTracker::PageSize + 1, CdlFlags::Code);
+	EXPECT_LT(tracker.GetPageStamp(0), token);
+	EXPECT_GE(tracker.GetPageStamp(1), token);
+}
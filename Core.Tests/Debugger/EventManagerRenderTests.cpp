@@ -0,0 +1,125 @@
+#include "pch.h"
+#include <thread>
+#include "Debugger/BaseEventManager.h"
+
+// =============================================================================
+// BaseEventManager Render Thread Tests
+// =============================================================================
+// Tests for the event viewer's off-thread rendering: GetDisplayBuffer copies the
+// frame rendered by the render thread, and auto-refresh snapshots never wait for it.
+
+namespace {
+	class TestEventManager final : public BaseEventManager {
+	public:
+		static constexpr uint32_t Width = 8;
+		static constexpr uint32_t Height = 8;
+
+		uint32_t ScreenColor = 0xFF112233;
+		uint32_t SnapshotCount = 0;
+
+		~TestEventManager() override { StopRenderThread(); }
+
+		SimpleLock& GetLock() { return _lock; }
+
+		void SetConfiguration(BaseEventViewerConfig& config) override { InvalidateFilteredEvents(); }
+		void AddEvent(DebugEventType type, MemoryOperationInfo& operation, int32_t breakpointId = -1) override {}
+		void AddEvent(DebugEventType type) override {}
+		EventViewerCategoryCfg GetEventConfig(DebugEventInfo& evt) override { return {}; }
+		FrameInfo GetDisplayBufferSize() override { return {Width, Height}; }
+		DebugEventInfo GetEvent(uint16_t scanline, uint16_t cycle) override { return {}; }
+
+		uint32_t TakeEventSnapshot(bool forAutoRefresh) override {
+			EventSnapshotLock lock(_lock, forAutoRefresh);
+			if (!lock.IsAcquired()) {
+				return 0;
+			}
+			UpdateEventSnapshot();
+			_snapshotScanline = 0;
+			_forAutoRefresh = forAutoRefresh;
+			SnapshotCount++;
+			return Height;
+		}
+
+	protected:
+		bool ShowPreviousFrameEvents() override { return false; }
+		void ConvertScanlineCycleToRowColumn(int32_t& x, int32_t& y) override {}
+		void DrawScreen(uint32_t* buffer) override { buffer[Width * Height - 1] = ScreenColor; }
+	};
+}
+
+TEST(EventManagerRenderTest, NoOutputBeforeFirstSnapshot) {
+	TestEventManager manager;
+	vector<uint32_t> output(TestEventManager::Width * TestEventManager::Height, 0);
+	manager.GetDisplayBuffer(output.data(), (uint32_t)(output.size() * sizeof(uint32_t)));
+	EXPECT_EQ(output.back(), 0u);
+}
+
+TEST(EventManagerRenderTest, OutputMatchesLatestSnapshot) {
+	TestEventManager manager;
+	vector<uint32_t> output(TestEventManager::Width * TestEventManager::Height, 0);
+
+	manager.TakeEventSnapshot(true);
+	manager.GetDisplayBuffer(output.data(), (uint32_t)(output.size() * sizeof(uint32_t)));
+	EXPECT_EQ(output[0], 0xFF555555u);
+	EXPECT_EQ(output.back(), 0xFF112233u);
+
+	// A new snapshot is rendered before GetDisplayBuffer returns
+	manager.ScreenColor = 0xFF445566;
+	manager.TakeEventSnapshot(true);
+	manager.GetDisplayBuffer(output.data(), (uint32_t)(output.size() * sizeof(uint32_t)));
+	EXPECT_EQ(output.back(), 0xFF445566u);
+
+	// Manual snapshots draw the current scanline
+	manager.TakeEventSnapshot(false);
+	manager.GetDisplayBuffer(output.data(), (uint32_t)(output.size() * sizeof(uint32_t)));
+	EXPECT_EQ(output[TestEventManager::Width - 1], 0xFFFFFF55u);
+}
+
+TEST(EventManagerRenderTest, ConfigurationChangeIsRendered) {
+	TestEventManager manager;
+	vector<uint32_t> output(TestEventManager::Width * TestEventManager::Height, 0);
+
+	manager.TakeEventSnapshot(true);
+	manager.GetDisplayBuffer(output.data(), (uint32_t)(output.size() * sizeof(uint32_t)));
+
+	manager.ScreenColor = 0xFF778899;
+	BaseEventViewerConfig config;
+	manager.SetConfiguration(config);
+	manager.GetDisplayBuffer(output.data(), (uint32_t)(output.size() * sizeof(uint32_t)));
+	EXPECT_EQ(output.back(), 0xFF778899u);
+}
+
+TEST(EventManagerRenderTest, SmallBufferIsLeftUntouched) {
+	TestEventManager manager;
+	vector<uint32_t> output(4, 0);
+	manager.TakeEventSnapshot(true);
+	manager.GetDisplayBuffer(output.data(), (uint32_t)(output.size() * sizeof(uint32_t)));
+	EXPECT_EQ(output[0], 0u);
+}
+
+TEST(EventManagerRenderTest, AutoRefreshSnapshotSkippedWhileLocked) {
+	TestEventManager manager;
+
+	// Another thread (e.g the render thread) holds the lock
+	std::atomic<bool> locked = false;
+	std::atomic<bool> release = false;
+	std::thread holder([&]() {
+		auto lock = manager.GetLock().AcquireSafe();
+		locked = true;
+		while (!release) {
+			std::this_thread::yield();
+		}
+	});
+	while (!locked) {
+		std::this_thread::yield();
+	}
+
+	EXPECT_EQ(manager.TakeEventSnapshot(true), 0u);
+	EXPECT_EQ(manager.SnapshotCount, 0u);
+
+	release = true;
+	holder.join();
+
+	EXPECT_EQ(manager.TakeEventSnapshot(true), TestEventManager::Height);
+	EXPECT_EQ(manager.SnapshotCount, 1u);
+}
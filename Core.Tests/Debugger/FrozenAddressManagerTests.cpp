@@ -0,0 +1,57 @@
+#include "pch.h"
+#include "Debugger/FrozenAddressManager.h"
+
+// =============================================================================
+// FrozenAddressManager Unit Tests
+// =============================================================================
+// Tests for the bitmap used to block writes to addresses frozen in the memory viewer.
+
+TEST(FrozenAddressManagerTest, NothingFrozenByDefault) {
+	FrozenAddressManager manager;
+	EXPECT_EQ(manager.GetFrozenCount(), 0u);
+	EXPECT_FALSE(manager.IsFrozenAddress(0));
+	EXPECT_FALSE(manager.IsFrozenAddress(0xFFFFFFFF));
+}
+
+TEST(FrozenAddressManagerTest, FreezesUnalignedRange) {
+	FrozenAddressManager manager;
+	manager.UpdateFrozenAddresses(0x7E0035, 0x7E1102, true);
+
+	EXPECT_EQ(manager.GetFrozenCount(), 0x1102u - 0x35 + 1);
+	EXPECT_FALSE(manager.IsFrozenAddress(0x7E0034));
+	EXPECT_TRUE(manager.IsFrozenAddress(0x7E0035));
+	EXPECT_TRUE(manager.IsFrozenAddress(0x7E0800));
+	EXPECT_TRUE(manager.IsFrozenAddress(0x7E1102));
+	EXPECT_FALSE(manager.IsFrozenAddress(0x7E1103));
+}
+
+TEST(FrozenAddressManagerTest, RangeAcrossPagesAndOverlaps) {
+	FrozenAddressManager manager;
+	manager.UpdateFrozenAddresses(0x0300FFF0, 0x03010010, true);
+	manager.UpdateFrozenAddresses(0x03010000, 0x03010020, true);
+
+	EXPECT_EQ(manager.GetFrozenCount(), 0x31u);
+	EXPECT_TRUE(manager.IsFrozenAddress(0x0300FFFF));
+	EXPECT_TRUE(manager.IsFrozenAddress(0x03010020));
+
+	manager.UpdateFrozenAddresses(0x03000000, 0x03010000, false);
+	EXPECT_EQ(manager.GetFrozenCount(), 0x20u);
+	EXPECT_FALSE(manager.IsFrozenAddress(0x0300FFFF));
+	EXPECT_FALSE(manager.IsFrozenAddress(0x03010000));
+	EXPECT_TRUE(manager.IsFrozenAddress(0x03010001));
+}
+
+TEST(FrozenAddressManagerTest, TopOfAddressSpace) {
+	FrozenAddressManager manager;
+	manager.UpdateFrozenAddresses(0xFFFFFFF0, 0xFFFFFFFF, true);
+	EXPECT_EQ(manager.GetFrozenCount(), 16u);
+	EXPECT_TRUE(manager.IsFrozenAddress(0xFFFFFFFF));
+
+	bool state[16] = {};
+	manager.GetFrozenState(0xFFFFFFF0, 0xFFFFFFFF, state);
+	EXPECT_TRUE(std::all_of(std::begin(state), std::end(state), [](bool frozen) { return frozen; }));
+
+	manager.UpdateFrozenAddresses(0, 0xFFFFFFFF, false);
+	EXPECT_EQ(manager.GetFrozenCount(), 0u);
+	EXPECT_FALSE(manager.IsFrozenAddress(0xFFFFFFFF));
+}
@@ -0,0 +1,81 @@
+#include "pch.h"
+#include "Debugger/MemoryCallbackIndex.h"
+
+// =============================================================================
+// MemoryCallbackIndex Unit Tests
+// =============================================================================
+// Range merging and lookups, compared with a linear scan of the registered ranges.
+
+TEST(MemoryCallbackIndexTest, EmptyIndexMatchesNothing) {
+	MemoryCallbackIndex index;
+	EXPECT_TRUE(index.IsEmpty());
+	EXPECT_FALSE(index.Contains({0x100, MemoryType::NesMemory}));
+
+	index.AddAll();
+	EXPECT_FALSE(index.IsEmpty());
+	EXPECT_TRUE(index.Contains({0x100, MemoryType::NesMemory}));
+
+	index.Clear();
+	EXPECT_FALSE(index.Contains({0x100, MemoryType::NesMemory}));
+}
+
+TEST(MemoryCallbackIndexTest, SingleRange) {
+	MemoryCallbackIndex index;
+	index.AddRange(MemoryType::NesMemory, 0x10, 0x10);
+	EXPECT_TRUE(index.Contains({0x10, MemoryType::NesMemory}));
+	EXPECT_FALSE(index.Contains({0x0F, MemoryType::NesMemory}));
+	EXPECT_FALSE(index.Contains({0x11, MemoryType::NesMemory}));
+	EXPECT_FALSE(index.Contains({0x10, MemoryType::SnesMemory}));
+}
+
+TEST(MemoryCallbackIndexTest, OverlappingAndAdjacentRangesAreMerged) {
+	MemoryCallbackIndex index;
+	index.AddRange(MemoryType::NesMemory, 0x100, 0x1FF);
+	index.AddRange(MemoryType::NesMemory, 0x300, 0x3FF);
+	index.AddRange(MemoryType::SnesMemory, 0x200, 0x2FF);
+	EXPECT_EQ(index.GetRangeCount(), 3u);
+
+	index.AddRange(MemoryType::NesMemory, 0x200, 0x2FF);
+	EXPECT_EQ(index.GetRangeCount(), 2u);
+	EXPECT_TRUE(index.Contains({0x250, MemoryType::NesMemory}));
+	EXPECT_FALSE(index.Contains({0x400, MemoryType::NesMemory}));
+
+	index.AddRange(MemoryType::NesMemory, 0, 0xFFFFFFFF);
+	EXPECT_EQ(index.GetRangeCount(), 2u);
+	EXPECT_TRUE(index.Contains({0x7FFFFFFF, MemoryType::NesMemory}));
+	EXPECT_FALSE(index.Contains({0x100, MemoryType::SnesMemory}));
+}
+
+TEST(MemoryCallbackIndexTest, MatchesLinearScan) {
+	struct Range {
+		MemoryType MemType;
+		uint32_t Start;
+		uint32_t End;
+	};
+
+	MemoryCallbackIndex index;
+	vector<Range> ranges;
+	uint32_t seed = 0x4321;
+	auto next = [&]() {
+		seed = seed * 1103515245 + 12345;
+		return seed >> 8;
+	};
+
+	for (int i = 0; i < 40; i++) {
+		MemoryType memType = (next() & 1) ? MemoryType::NesMemory : MemoryType::SnesMemory;
+		uint32_t start = next() & 0xFFF;
+		uint32_t end = start + (next() & 0x3F);
+		ranges.push_back({memType, start, end});
+		index.AddRange(memType, start, end);
+	}
+
+	for (MemoryType memType : {MemoryType::NesMemory, MemoryType::SnesMemory, MemoryType::GameboyMemory}) {
+		for (uint32_t addr = 0; addr < 0x1100; addr++) {
+			bool expected = false;
+			for (Range& r : ranges) {
+				expected |= r.MemType == memType && addr >= r.Start && addr <= r.End;
+			}
+			ASSERT_EQ(index.Contains({(int32_t)addr, memType}), expected) << "address=" << addr;
+		}
+	}
+}
@@ -0,0 +1,172 @@
+#include "pch.h"
+#include "Debugger/MemorySearch.h"
+
+// =============================================================================
+// MemorySearch Tests
+// =============================================================================
+// Tests for the RAM search engine: filters over the candidate bitset, snapshots, undo and paging.
+
+namespace {
+	class MemorySearchTest : public ::testing::Test {
+	protected:
+		MemorySearch _search = MemorySearch(nullptr);
+		vector<uint8_t> _memory;
+
+		void SetUp() override {
+			// Not a multiple of 64, to cover the partial last bitset word
+			_memory.resize(1000);
+			for (size_t i = 0; i < _memory.size(); i++) {
+				_memory[i] = (uint8_t)(i & 0x0F);
+			}
+			_search.Reset(MemoryType::SnesWorkRam, _memory);
+		}
+
+		static MemorySearchFilter Filter(MemorySearchCompareTo compareTo, MemorySearchOperator op, int64_t value = 0, MemorySearchValueSize size = MemorySearchValueSize::Byte, MemorySearchFormat format = MemorySearchFormat::Hex) {
+			return {size, format, compareTo, op, value, 0};
+		}
+
+		vector<uint32_t> GetResults() {
+			vector<uint32_t> results(_search.GetResultCount());
+			results.resize(_search.GetResults(0, results.data(), (uint32_t)results.size()));
+			return results;
+		}
+	};
+}
+
+TEST_F(MemorySearchTest, ResetMakesEveryAddressACandidate) {
+	EXPECT_EQ(_search.GetResultCount(), 1000u);
+	vector<uint32_t> results = GetResults();
+	ASSERT_EQ(results.size(), 1000u);
+	EXPECT_EQ(results.front(), 0u);
+	EXPECT_EQ(results.back(), 999u);
+	EXPECT_FALSE(_search.CanUndo());
+}
+
+TEST_F(MemorySearchTest, SpecificValueFilter) {
+	EXPECT_EQ(_search.AddFilter(Filter(MemorySearchCompareTo::SpecificValue, MemorySearchOperator::Equal, 5), _memory), 63u);
+	for (uint32_t addr : GetResults()) {
+		EXPECT_EQ(addr & 0x0F, 5u);
+	}
+
+	// Filters only narrow down the remaining candidates
+	EXPECT_EQ(_search.AddFilter(Filter(MemorySearchCompareTo::SpecificValue, MemorySearchOperator::GreaterThanOrEqual, 6), _memory), 0u);
+}
+
+TEST_F(MemorySearchTest, PreviousRefreshValueFilter) {
+	vector<uint8_t> updated = _memory;
+	updated[10]++;
+	updated[700]--;
+	_search.Refresh(updated);
+
+	_search.AddFilter(Filter(MemorySearchCompareTo::PreviousRefreshValue, MemorySearchOperator::NotEqual), updated);
+	EXPECT_EQ(GetResults(), (vector<uint32_t>{10, 700}));
+
+	_search.AddFilter(Filter(MemorySearchCompareTo::PreviousRefreshValue, MemorySearchOperator::GreaterThan), updated);
+	EXPECT_EQ(GetResults(), (vector<uint32_t>{10}));
+}
+
+TEST_F(MemorySearchTest, PreviousSearchValueFilter) {
+	// The last search snapshot is taken after each filter
+	_search.AddFilter(Filter(MemorySearchCompareTo::SpecificValue, MemorySearchOperator::LessThan, 2), _memory);
+	vector<uint8_t> updated = _memory;
+	updated[16] = 0x80;
+	_search.Refresh(updated);
+
+	_search.AddFilter(Filter(MemorySearchCompareTo::PreviousSearchValue, MemorySearchOperator::LessThan), updated);
+	EXPECT_TRUE(GetResults().empty());
+	_search.Undo();
+
+	_search.AddFilter(Filter(MemorySearchCompareTo::PreviousSearchValue, MemorySearchOperator::GreaterThan), updated);
+	EXPECT_EQ(GetResults(), (vector<uint32_t>{16}));
+
+	// Signed values: 0x80 is less than the previous value (0)
+	_search.Undo();
+	_search.AddFilter(Filter(MemorySearchCompareTo::PreviousSearchValue, MemorySearchOperator::LessThan, 0, MemorySearchValueSize::Byte, MemorySearchFormat::Signed), updated);
+	EXPECT_EQ(GetResults(), (vector<uint32_t>{16}));
+}
+
+TEST_F(MemorySearchTest, MultiByteValues) {
+	std::fill(_memory.begin(), _memory.end(), 0);
+	_memory[100] = 0x34;
+	_memory[101] = 0x12;
+	_memory[998] = 0x78;
+	_memory[999] = 0x56;
+	_search.Reset(MemoryType::SnesWorkRam, _memory);
+
+	_search.AddFilter(Filter(MemorySearchCompareTo::SpecificValue, MemorySearchOperator::Equal, 0x1234, MemorySearchValueSize::Word), _memory);
+	EXPECT_EQ(GetResults(), (vector<uint32_t>{100}));
+
+	// Bytes past the end of memory read as 0
+	_search.Reset(MemoryType::SnesWorkRam, _memory);
+	_search.AddFilter(Filter(MemorySearchCompareTo::SpecificValue, MemorySearchOperator::Equal, 0x5678, MemorySearchValueSize::Dword), _memory);
+	EXPECT_EQ(GetResults(), (vector<uint32_t>{998}));
+	_search.Reset(MemoryType::SnesWorkRam, _memory);
+	_search.AddFilter(Filter(MemorySearchCompareTo::SpecificValue, MemorySearchOperator::Equal, 0x56, MemorySearchValueSize::Word), _memory);
+	EXPECT_EQ(GetResults(), (vector<uint32_t>{999}));
+
+	// Signed dword
+	std::fill(_memory.begin(), _memory.end(), 0xFF);
+	_search.Reset(MemoryType::SnesWorkRam, _memory);
+	EXPECT_EQ(_search.AddFilter(Filter(MemorySearchCompareTo::SpecificValue, MemorySearchOperator::Equal, -1, MemorySearchValueSize::Dword, MemorySearchFormat::Signed), _memory), 997u);
+}
+
+TEST_F(MemorySearchTest, SpecificAddressFilter) {
+	MemorySearchFilter filter = Filter(MemorySearchCompareTo::SpecificAddress, MemorySearchOperator::Equal);
+	filter.SpecificAddress = 3;
+	_search.AddFilter(filter, _memory);
+	vector<uint32_t> results = GetResults();
+	ASSERT_EQ(results.size(), 63u);
+	EXPECT_EQ(results[0], 3u);
+	EXPECT_EQ(results[1], 19u);
+}
+
+TEST_F(MemorySearchTest, UndoRestoresCandidatesAndSnapshot) {
+	_search.AddFilter(Filter(MemorySearchCompareTo::SpecificValue, MemorySearchOperator::Equal, 1), _memory);
+	vector<uint8_t> updated = _memory;
+	updated[0] = 0x42;
+	_search.AddFilter(Filter(MemorySearchCompareTo::SpecificValue, MemorySearchOperator::Equal, 2), updated);
+	EXPECT_EQ(_search.GetResultCount(), 0u);
+
+	uint8_t lastSearch = 0;
+	_search.GetSnapshot(MemorySearchSnapshot::LastSearch, &lastSearch, 1);
+	EXPECT_EQ(lastSearch, 0x42);
+
+	EXPECT_TRUE(_search.Undo());
+	EXPECT_EQ(_search.GetResultCount(), 63u);
+	_search.GetSnapshot(MemorySearchSnapshot::LastSearch, &lastSearch, 1);
+	EXPECT_EQ(lastSearch, 0);
+
+	EXPECT_TRUE(_search.CanUndo());
+	EXPECT_TRUE(_search.Undo());
+	EXPECT_EQ(_search.GetResultCount(), 1000u);
+	EXPECT_FALSE(_search.Undo());
+}
+
+TEST_F(MemorySearchTest, ResultsArePaged) {
+	_search.AddFilter(Filter(MemorySearchCompareTo::SpecificValue, MemorySearchOperator::Equal, 0), _memory);
+	vector<uint32_t> all = GetResults();
+	ASSERT_EQ(all.size(), 63u);
+
+	uint32_t page[10];
+	for (uint32_t start = 0; start < 63; start += 10) {
+		uint32_t count = _search.GetResults(start, page, 10);
+		EXPECT_EQ(count, std::min(10u, 63 - start));
+		for (uint32_t i = 0; i < count; i++) {
+			EXPECT_EQ(page[i], all[start + i]);
+		}
+	}
+	EXPECT_EQ(_search.GetResults(63, page, 10), 0u);
+}
+
+TEST_F(MemorySearchTest, SizeChangeRestartsSearch) {
+	_search.AddFilter(Filter(MemorySearchCompareTo::SpecificValue, MemorySearchOperator::Equal, 0), _memory);
+	vector<uint8_t> other(128, 0);
+	_search.Refresh(other);
+	EXPECT_EQ(_search.GetResultCount(), 128u);
+	EXPECT_FALSE(_search.CanUndo());
+
+	vector<uint8_t> snapshot(256, 0xFF);
+	EXPECT_EQ(_search.GetSnapshot(MemorySearchSnapshot::Current, snapshot.data(), (uint32_t)snapshot.size()), 128u);
+	EXPECT_EQ(snapshot[0], 0);
+	EXPECT_EQ(snapshot[128], 0xFF);
+}
@@ -0,0 +1,68 @@
+#include "pch.h"
+#include <thread>
+#include "Debugger/ProfilerEventQueue.h"
+
+// =============================================================================
+// ProfilerEventQueue Unit Tests
+// =============================================================================
+// Events come out in push order, a full queue rejects pushes, and a producer/consumer pair on two
+// threads loses nothing.
+
+namespace {
+	ProfilerEvent MakeEvent(uint64_t clock) {
+		return {clock, {(int32_t)clock, MemoryType::SnesPrgRom}, ProfilerEventType::Stack, StackFrameFlags::None};
+	}
+}
+
+TEST(ProfilerEventQueueTest, FullQueueRejectsPush) {
+	ProfilerEventQueue queue;
+	queue.Init(4);
+
+	for (uint64_t i = 0; i < 4; i++) {
+		EXPECT_TRUE(queue.TryPush(MakeEvent(i)));
+	}
+	EXPECT_FALSE(queue.TryPush(MakeEvent(4)));
+	EXPECT_EQ(queue.GetFillLevel(), 4u);
+
+	vector<uint64_t> clocks;
+	EXPECT_EQ(queue.Consume([&](ProfilerEvent& evt) { clocks.push_back(evt.Clock); }), 4u);
+	EXPECT_EQ(clocks, (vector<uint64_t>{0, 1, 2, 3}));
+	EXPECT_TRUE(queue.TryPush(MakeEvent(4)));
+}
+
+TEST(ProfilerEventQueueTest, DiscardDropsPendingEvents) {
+	ProfilerEventQueue queue;
+	queue.Init(8);
+	queue.TryPush(MakeEvent(1));
+	queue.TryPush(MakeEvent(2));
+	queue.Discard();
+	EXPECT_EQ(queue.GetFillLevel(), 0u);
+	EXPECT_EQ(queue.Consume([](ProfilerEvent&) { FAIL(); }), 0u);
+}
+
+TEST(ProfilerEventQueueTest, ConcurrentProducerAndConsumerKeepOrder) {
+	ProfilerEventQueue queue;
+	queue.Init(4096);
+
+	constexpr uint64_t EventCount = 200000;
+	std::thread producer([&]() {
+		for (uint64_t i = 0; i < EventCount; i++) {
+			while (!queue.TryPush(MakeEvent(i))) {
+				std::this_thread::yield();
+			}
+		}
+	});
+
+	uint64_t expected = 0;
+	bool inOrder = true;
+	while (expected < EventCount) {
+		queue.Consume([&](ProfilerEvent& evt) {
+			inOrder &= evt.Clock == expected && evt.Address.Address == (int32_t)expected;
+			expected++;
+		});
+	}
+	producer.join();
+
+	EXPECT_TRUE(inOrder);
+	EXPECT_EQ(queue.GetFillLevel(), 0u);
+}
@@ -0,0 +1,90 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include "Debugger/TraceLogFileSaver.h"
+
+// =============================================================================
+// TraceLogFileSaver Unit Tests
+// =============================================================================
+// Records are logged in binary form and converted to text rows (in logging order) when logging stops.
+
+namespace {
+	struct TestRecord {
+		uint32_t Pc;
+		uint8_t A;
+	};
+
+	string ReadTextFile(const string& filename) {
+		std::ifstream file(filename, ios::binary);
+		return string(std::istreambuf_iterator<char>(file), {});
+	}
+
+	void FormatTestRecord(CpuType cpuType, const uint8_t* data, uint32_t size, string& output) {
+		TestRecord record;
+		ASSERT_EQ(size, sizeof(TestRecord));
+		memcpy(&record, data, sizeof(TestRecord));
+		output += std::to_string((int)cpuType) + ":" + std::to_string(record.Pc) + ":" + std::to_string(record.A);
+	}
+}
+
+TEST(TraceLogFileSaverTest, RecordsAreConvertedInOrderOnStop) {
+	string filename = (std::filesystem::temp_directory_path() / "nexen_trace_log_test.txt").string();
+
+	TraceLogFileSaver saver;
+	EXPECT_FALSE(saver.IsEnabled());
+	saver.StartLogging(filename);
+	EXPECT_TRUE(saver.IsEnabled());
+
+	string expected;
+	for (uint32_t i = 0; i < 200000; i++) {
+		// Enough records to flush the buffer to the temp file several times
+		CpuType cpuType = (i % 3) ? CpuType::Snes : CpuType::Spc;
+		TestRecord record = {i * 3, (uint8_t)i};
+		saver.LogRecord(cpuType, record);
+
+		string row;
+		FormatTestRecord(cpuType, (uint8_t*)&record, sizeof(record), row);
+		expected += row + '\n';
+	}
+
+	saver.StopLogging(FormatTestRecord);
+	EXPECT_FALSE(saver.IsEnabled());
+
+	EXPECT_EQ(ReadTextFile(filename), expected);
+	EXPECT_FALSE(std::filesystem::exists(filename + ".tmp"));
+	std::filesystem::remove(filename);
+}
+
+TEST(TraceLogFileSaverTest, StopWithoutFormatterKeepsRecords) {
+	string filename = (std::filesystem::temp_directory_path() / "nexen_trace_log_raw.txt").string();
+
+	{
+		TraceLogFileSaver saver;
+		saver.StartLogging(filename);
+		TestRecord record = {0x8000, 0x12};
+		saver.LogRecord(CpuType::Nes, record);
+	}
+
+	EXPECT_FALSE(std::filesystem::exists(filename));
+	EXPECT_GT(std::filesystem::file_size(filename + ".tmp"), sizeof(TestRecord));
+	std::filesystem::remove(filename + ".tmp");
+}
+
+TEST(TraceLogFileSaverTest, RecordsAreCompressed) {
+	string filename = (std::filesystem::temp_directory_path() / "nexen_trace_log_compressed.txt").string();
+
+	constexpr uint32_t RecordCount = 100000;
+	{
+		TraceLogFileSaver saver;
+		saver.StartLogging(filename);
+		for (uint32_t i = 0; i < RecordCount; i++) {
+			TestRecord record = {0x8000 + (i & 0x0F), 0};
+			saver.LogRecord(CpuType::Nes, record);
+		}
+	}
+
+	// Each record is 8 bytes of header + 8 bytes of data before compression
+	EXPECT_LT(std::filesystem::file_size(filename + ".tmp"), RecordCount * 16 / 4);
+	std::filesystem::remove(filename + ".tmp");
+}
@@ -0,0 +1,48 @@
+#include "pch.h"
+#include "GBA/GbaColorBlender.h"
+
+// =============================================================================
+// GbaColorBlender Unit Tests
+// =============================================================================
+// Compares the 16-bit blend with the previous GbaPpu::BlendColors implementation.
+
+namespace {
+	uint16_t BlendColorsReference(uint16_t main, uint8_t aCoeff, uint16_t sub, uint8_t bCoeff) {
+		uint8_t aR = main & 0x1F;
+		uint8_t aG = (main >> 5) & 0x1F;
+		uint8_t aB = (main >> 10) & 0x1F;
+
+		uint8_t bR = sub & 0x1F;
+		uint8_t bG = (sub >> 5) & 0x1F;
+		uint8_t bB = (sub >> 10) & 0x1F;
+
+		uint32_t r = std::min(31, (aR * aCoeff + bR * bCoeff) >> 4);
+		uint32_t g = std::min(31, (aG * aCoeff + bG * bCoeff) >> 4);
+		uint32_t b = std::min(31, (aB * aCoeff + bB * bCoeff) >> 4);
+		return (uint16_t)(r | (g << 5) | (b << 10));
+	}
+
+	uint32_t NextRandom(uint32_t& seed) {
+		seed = seed * 1103515245 + 12345;
+		return seed >> 8;
+	}
+}
+
+TEST(GbaColorBlenderTest, BlendMatchesReference_AllCoefficients) {
+	uint32_t seed = 0x4321;
+	for (uint8_t aCoeff = 0; aCoeff <= 16; aCoeff++) {
+		for (uint8_t bCoeff = 0; bCoeff <= 16; bCoeff++) {
+			for (int i = 0; i < 500; i++) {
+				uint16_t a = (uint16_t)(NextRandom(seed) & 0x7FFF);
+				uint16_t b = (uint16_t)(NextRandom(seed) & 0x7FFF);
+				ASSERT_EQ(GbaColorBlender::BlendColors(a, aCoeff, b, bCoeff), BlendColorsReference(a, aCoeff, b, bCoeff));
+			}
+		}
+	}
+}
+
+TEST(GbaColorBlenderTest, NoEffectCoefficientsKeepMainColor) {
+	for (uint32_t color = 0; color < 0x8000; color++) {
+		ASSERT_EQ(GbaColorBlender::BlendColors((uint16_t)color, 16, 0x7FFF, 0), color);
+	}
+}
@@ -0,0 +1,130 @@
+#include "pch.h"
+#include "Genesis/GenesisM68kCpu.h"
+
+namespace {
+	/// 64 KB ROM (mapped as a direct page) with the reset vectors pointing to 0x200
+	class GenesisM68kCpuTest : public ::testing::Test {
+	protected:
+		GenesisPlatformBusStub _bus;
+		GenesisM68kCpu _cpu;
+
+		void LoadProgram(const vector<uint16_t>& program) {
+			vector<uint8_t> rom(0x10000, 0);
+			uint32_t ssp = 0xFFFF00;
+			uint32_t pc = 0x200;
+			for (int i = 0; i < 4; i++) {
+				rom[i] = (uint8_t)(ssp >> (24 - i * 8));
+				rom[4 + i] = (uint8_t)(pc >> (24 - i * 8));
+			}
+			for (size_t i = 0; i < program.size(); i++) {
+				rom[0x200 + i * 2] = (uint8_t)(program[i] >> 8);
+				rom[0x200 + i * 2 + 1] = (uint8_t)program[i];
+			}
+			_bus.LoadRom(rom);
+			_cpu.AttachBus(&_bus);
+			_cpu.Reset();
+		}
+	};
+
+	TEST_F(GenesisM68kCpuTest, ResetLoadsVectors) {
+		LoadProgram({0x4E71});
+		EXPECT_EQ(_cpu.GetState().A[7], 0xFFFF00u);
+		EXPECT_EQ(_cpu.GetState().PC, 0x200u);
+	}
+
+	TEST_F(GenesisM68kCpuTest, MoveQSignExtendsAndSetsFlags) {
+		// MOVEQ #-1,D1 / MOVEQ #0,D2
+		LoadProgram({0x72FF, 0x7400});
+		_cpu.Exec();
+		EXPECT_EQ(_cpu.GetState().D[1], 0xFFFFFFFFu);
+		EXPECT_TRUE(_cpu.GetState().SR & 0x08);
+		_cpu.Exec();
+		EXPECT_EQ(_cpu.GetState().D[2], 0u);
+		EXPECT_TRUE(_cpu.GetState().SR & 0x04);
+		EXPECT_EQ(_cpu.GetState().CycleCount, 8u);
+	}
+
+	TEST_F(GenesisM68kCpuTest, MoveCopiesWithPostIncrement) {
+		// MOVEA.L #$FF0000,A0 / MOVEA.L #$FF0100,A1 / MOVE.W (A0)+,(A1)+ / MOVE.L (A0)+,(A1)+
+		LoadProgram({0x207C, 0x00FF, 0x0000, 0x227C, 0x00FF, 0x0100, 0x32D8, 0x22D8});
+		for (uint32_t i = 0; i < 6; i++) {
+			_bus.WriteByte(0xFF0000 + i, (uint8_t)(0x11 * (i + 1)));
+		}
+
+		_cpu.Exec();
+		_cpu.Exec();
+		EXPECT_EQ(_cpu.GetState().A[0], 0xFF0000u);
+		EXPECT_EQ(_cpu.GetState().A[1], 0xFF0100u);
+
+		uint64_t cycles = _cpu.GetState().CycleCount;
+		_cpu.Exec();
+		EXPECT_EQ(_cpu.GetState().CycleCount - cycles, 12u);
+		_cpu.Exec();
+		EXPECT_EQ(_cpu.GetState().CycleCount - cycles, 12u + 20u);
+
+		EXPECT_EQ(_cpu.GetState().A[0], 0xFF0006u);
+		EXPECT_EQ(_cpu.GetState().A[1], 0xFF0106u);
+		for (uint32_t i = 0; i < 6; i++) {
+			EXPECT_EQ(_bus.ReadByte(0xFF0100 + i), (uint8_t)(0x11 * (i + 1)));
+		}
+	}
+
+	TEST_F(GenesisM68kCpuTest, MoveWordToAddressRegisterIsSignExtended) {
+		// MOVEQ #-2,D0 / MOVEA.W D0,A3
+		LoadProgram({0x70FE, 0x3640});
+		_cpu.Exec();
+		uint16_t flags = _cpu.GetState().SR;
+		_cpu.Exec();
+		EXPECT_EQ(_cpu.GetState().A[3], 0xFFFFFFFEu);
+		EXPECT_EQ(_cpu.GetState().SR, flags);
+	}
+
+	TEST_F(GenesisM68kCpuTest, BranchesFollowConditions) {
+		// MOVEQ #1,D0 / BEQ.S +2 (not taken) / BNE.S +2 (taken) / NOP / NOP
+		LoadProgram({0x7001, 0x6702, 0x6602, 0x4E71, 0x4E71});
+		_cpu.Exec();
+		_cpu.Exec();
+		EXPECT_EQ(_cpu.GetState().PC, 0x204u);
+		_cpu.Exec();
+		EXPECT_EQ(_cpu.GetState().PC, 0x208u);
+		EXPECT_EQ(_cpu.GetState().CycleCount, 4u + 8u + 10u);
+	}
+
+	TEST_F(GenesisM68kCpuTest, RunStopsAtTargetCycle) {
+		// BRA.S -2 (infinite loop, 10 cycles per iteration)
+		LoadProgram({0x60FE});
+		_cpu.Run(1000);
+		EXPECT_EQ(_cpu.GetState().CycleCount, 1000u);
+		EXPECT_EQ(_cpu.GetState().PC, 0x200u);
+		EXPECT_EQ(_cpu.GetState().UnimplementedCount, 0u);
+	}
+
+	TEST(GenesisM68kCpuTests, OpTableDecodesValidEncodingsOnly) {
+		EXPECT_TRUE(GenesisM68kCpu::IsImplemented(0x4E71));
+		EXPECT_TRUE(GenesisM68kCpu::IsImplemented(0x3040));  // MOVEA.W D0,A0
+		EXPECT_FALSE(GenesisM68kCpu::IsImplemented(0x1040)); // MOVE.B D0,A0 doesn't exist
+		EXPECT_FALSE(GenesisM68kCpu::IsImplemented(0x35C0)); // MOVE.W D0,d16(PC)
+		EXPECT_FALSE(GenesisM68kCpu::IsImplemented(0x6100)); // BSR
+		EXPECT_FALSE(GenesisM68kCpu::IsImplemented(0x7100)); // Bit 8 set isn't MOVEQ
+	}
+
+	TEST(GenesisM68kCpuTests, BusPagesMatchByteAccesses) {
+		GenesisPlatformBusStub bus;
+		vector<uint8_t> rom(0x200);
+		for (size_t i = 0; i < rom.size(); i++) {
+			rom[i] = (uint8_t)(i * 7);
+		}
+		bus.LoadRom(rom);
+
+		// Small ROMs are mirrored through ReadByte, work RAM is a direct page
+		EXPECT_EQ(bus.Read16(0x10202), (uint16_t)((bus.ReadByte(0x10202) << 8) | bus.ReadByte(0x10203)));
+		bus.Write32(0xFF1234, 0x12345678);
+		EXPECT_EQ(bus.ReadByte(0xFF1234), 0x12);
+		EXPECT_EQ(bus.ReadByte(0xFF1237), 0x78);
+		EXPECT_EQ(bus.Read32(0xFF1234), 0x12345678u);
+
+		// ROM isn't writable
+		bus.Write16(0x000010, 0xFFFF);
+		EXPECT_EQ(bus.Read8(0x000010), rom[0x10]);
+	}
+}
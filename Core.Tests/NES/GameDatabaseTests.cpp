@@ -0,0 +1,101 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <sstream>
+#include "NES/GameDatabase.h"
+#include "NES/NesHeader.h"
+
+// =============================================================================
+// GameDatabase Unit Tests
+// =============================================================================
+// Tests for the compiled (binary) NES game database: record layout, lookups and duplicate handling.
+
+namespace {
+	const char* TestDb =
+		"# CRC,System,Board,PCB,Chip,Mapper,PRG,CHR,CHRRAM,WRAM,SRAM,Battery,Mirroring,Input,BusConflicts,SubMapper,VsType,VsPpu\n"
+		"0000BEEF,NesNtsc,NES-SNROM,,MMC1B2,1,256,0,8,0,8,1,h,0,,,0,0\r\n"
+		"12345678,NesPal,NES-UNROM,,,2,128,0,8,0,0,0,v,0,Y,0,0,0\n"
+		"\n"
+		"ABCDEF01,Famicom,HVC-CNROM,,,3,32,32,0,0,0,0,h,0,,,0,0\n"
+		"12345678,NesPal,NES-UOROM,,,2,256,0,8,0,0,0,v,0,Y,0,0,0\n"
+		"invalid row\n";
+
+	void LoadTestDb() {
+		std::istringstream db(TestDb);
+		GameDatabase::LoadGameDb(db);
+	}
+}
+
+TEST(GameDatabaseTest, CompiledRecordsAreSortedAndUnique) {
+	std::istringstream db(TestDb);
+	vector<uint8_t> data = GameDatabase::CompileGameDb(db, 123, 456);
+	ASSERT_GE(data.size(), sizeof(GameDatabase::GameDbHeader));
+
+	GameDatabase::GameDbHeader header;
+	memcpy(&header, data.data(), sizeof(header));
+	EXPECT_EQ(header.Magic, GameDatabase::Magic);
+	EXPECT_EQ(header.Version, GameDatabase::Version);
+	EXPECT_EQ(header.EntryCount, 3u);
+	EXPECT_EQ(header.SourceSize, 123u);
+	EXPECT_EQ(header.SourceTime, 456);
+	EXPECT_EQ(header.StringTableOffset, sizeof(header) + 3 * sizeof(GameDatabase::GameDbRecord));
+	EXPECT_EQ(data.back(), 0);
+
+	uint32_t lastCrc = 0;
+	for (uint32_t i = 0; i < header.EntryCount; i++) {
+		GameDatabase::GameDbRecord record;
+		memcpy(&record, data.data() + sizeof(header) + i * sizeof(record), sizeof(record));
+		EXPECT_GT(record.Crc, lastCrc);
+		lastCrc = record.Crc;
+	}
+}
+
+TEST(GameDatabaseTest, LookupByCrc) {
+	LoadTestDb();
+
+	uint32_t prgSize = 0;
+	uint32_t chrSize = 0;
+	ASSERT_TRUE(GameDatabase::GetDbRomSize(0x0000BEEF, prgSize, chrSize));
+	EXPECT_EQ(prgSize, 256u * 1024);
+	EXPECT_EQ(chrSize, 0u);
+
+	ASSERT_TRUE(GameDatabase::GetDbRomSize(0xABCDEF01, prgSize, chrSize));
+	EXPECT_EQ(prgSize, 32u * 1024);
+	EXPECT_EQ(chrSize, 32u * 1024);
+
+	EXPECT_FALSE(GameDatabase::GetDbRomSize(0x11111111, prgSize, chrSize));
+	EXPECT_FALSE(GameDatabase::GetDbRomSize(0, prgSize, chrSize));
+	EXPECT_FALSE(GameDatabase::GetDbRomSize(0xFFFFFFFF, prgSize, chrSize));
+}
+
+TEST(GameDatabaseTest, LastDuplicateEntryWins) {
+	LoadTestDb();
+
+	uint32_t prgSize = 0;
+	uint32_t chrSize = 0;
+	ASSERT_TRUE(GameDatabase::GetDbRomSize(0x12345678, prgSize, chrSize));
+	EXPECT_EQ(prgSize, 256u * 1024);
+}
+
+TEST(GameDatabaseTest, HeaderBuiltFromRecord) {
+	LoadTestDb();
+
+	NesHeader header = {};
+	ASSERT_TRUE(GameDatabase::GetiNesHeader(0x0000BEEF, header));
+	EXPECT_EQ(header.PrgCount, 16);
+	EXPECT_EQ(header.ChrCount, 0);
+	EXPECT_EQ(header.Byte6, 0x12); // Mapper 1, battery, horizontal mirroring
+	EXPECT_EQ(header.Byte12, 0);
+
+	ASSERT_TRUE(GameDatabase::GetiNesHeader(0x12345678, header));
+	EXPECT_EQ(header.Byte6 & 0x01, 0x01); // Vertical mirroring
+	EXPECT_EQ(header.Byte12, 0x01);       // PAL
+}
+
+TEST(GameDatabaseTest, EmptyDatabase) {
+	std::istringstream db("");
+	GameDatabase::LoadGameDb(db);
+
+	uint32_t prgSize = 0;
+	uint32_t chrSize = 0;
+	EXPECT_FALSE(GameDatabase::GetDbRomSize(0x0000BEEF, prgSize, chrSize));
+}
@@ -0,0 +1,76 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <random>
+#include "NES/HdPacks/HdBlend.h"
+
+// =============================================================================
+// HdBlend Unit Tests
+// =============================================================================
+// Tests for the HD pack blending: the row functions (SSE2 on x64) must match the per-pixel code.
+
+namespace {
+	uint32_t RandomPixel(std::mt19937& rng) {
+		uint32_t pixel = rng();
+		switch (rng() % 4) {
+			case 0: return pixel & 0x00FFFFFF; // Transparent
+			case 1: return pixel | 0xFF000000; // Opaque
+			default: return pixel;
+		}
+	}
+
+	template <HdPackBlendMode blendMode>
+	void CheckRows() {
+		std::mt19937 rng(1234);
+		for (uint32_t count = 1; count <= 13; count++) {
+			for (int iteration = 0; iteration < 200; iteration++) {
+				vector<uint32_t> input(count);
+				vector<uint32_t> expected(count);
+				for (uint32_t i = 0; i < count; i++) {
+					input[i] = RandomPixel(rng);
+					expected[i] = RandomPixel(rng);
+				}
+				vector<uint32_t> actual = expected;
+
+				for (uint32_t i = 0; i < count; i++) {
+					HdBlend::DrawPixel<blendMode>(expected[i], input[i]);
+				}
+				HdBlend::DrawRow<blendMode>(actual.data(), input.data(), count);
+				ASSERT_EQ(actual, expected) << "count: " << count;
+			}
+		}
+	}
+}
+
+TEST(HdBlendTest, AlphaRowMatchesPixels) {
+	CheckRows<HdPackBlendMode::Alpha>();
+}
+
+TEST(HdBlendTest, AddRowMatchesPixels) {
+	CheckRows<HdPackBlendMode::Add>();
+}
+
+TEST(HdBlendTest, SubtractRowMatchesPixels) {
+	CheckRows<HdPackBlendMode::Subtract>();
+}
+
+TEST(HdBlendTest, AlphaEdgeCases) {
+	uint32_t output[4] = {0x11223344, 0x11223344, 0x11223344, 0x11223344};
+	uint32_t input[4] = {0x00FFFFFF, 0xFF102030, 0x80404040, 0x00000000};
+	HdBlend::DrawRow<HdPackBlendMode::Alpha>(output, input, 4);
+
+	EXPECT_EQ(output[0], 0x11223344u); // Transparent: unchanged (including alpha)
+	EXPECT_EQ(output[1], 0xFF102030u); // Opaque: copied
+	EXPECT_EQ(output[2], 0xFF515962u); // 0x40 + 0x11223344 / 2 (per channel)
+	EXPECT_EQ(output[3], 0x11223344u);
+}
+
+TEST(HdBlendTest, FillRow) {
+	for (uint32_t count = 1; count <= 13; count++) {
+		vector<uint32_t> output(count + 1, 0);
+		HdBlend::FillRow(output.data(), 0xFF123456, count);
+		for (uint32_t i = 0; i < count; i++) {
+			EXPECT_EQ(output[i], 0xFF123456u);
+		}
+		EXPECT_EQ(output[count], 0u);
+	}
+}
@@ -0,0 +1,83 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <thread>
+#include "NES/HdPacks/HdData.h"
+
+// =============================================================================
+// HdPackData Unit Tests
+// =============================================================================
+// Tests for the HD pack PNG loading: parallel decoding, lazy loading with prefetching.
+
+namespace {
+	unique_ptr<HdPackBitmapInfo> CreateBitmap(uint32_t color) {
+		vector<uint32_t> pixels(16 * 16, color);
+		std::stringstream stream;
+		PNGHelper::WritePNG(stream, pixels.data(), 16, 16, 32);
+		string png = stream.str();
+
+		auto bitmap = std::make_unique<HdPackBitmapInfo>();
+		bitmap->FileData = vector<uint8_t>(png.begin(), png.end());
+		bitmap->PngName = "test.png";
+		return bitmap;
+	}
+
+	void FillPack(HdPackData& data, uint32_t imageCount) {
+		data.BackgroundFileData.push_back(CreateBitmap(0xFF102030));
+		for (uint32_t i = 0; i < imageCount; i++) {
+			data.ImageFileData.push_back(CreateBitmap(0xFF000000 | i));
+		}
+	}
+
+	bool WaitUntilLoaded(HdPackBitmapInfo& bitmap) {
+		for (int i = 0; i < 500 && !bitmap.IsLoaded(); i++) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		}
+		return bitmap.IsLoaded();
+	}
+}
+
+TEST(HdPackDataTest, LoadAsyncDecodesAllFiles) {
+	HdPackData data;
+	FillPack(data, 20);
+	data.LoadAsync();
+
+	EXPECT_TRUE(data.BackgroundFileData[0]->IsLoaded());
+	for (uint32_t i = 0; i < 20; i++) {
+		HdPackBitmapInfo& bitmap = *data.ImageFileData[i];
+		ASSERT_TRUE(bitmap.IsLoaded());
+		EXPECT_EQ(bitmap.Width, 16u);
+		EXPECT_EQ(bitmap.Height, 16u);
+		EXPECT_EQ(bitmap.PixelData[0], 0xFF000000 | i);
+		EXPECT_TRUE(bitmap.FileData.empty());
+	}
+}
+
+TEST(HdPackDataTest, LazyLoadingOnlyDecodesPrefetchedFiles) {
+	HdPackData data;
+	FillPack(data, 4);
+	data.LazyLoadImages = true;
+	std::thread loader([&]() { data.LoadAsync(); });
+
+	EXPECT_TRUE(WaitUntilLoaded(*data.BackgroundFileData[0]));
+	data.PrefetchBitmap(data.ImageFileData[2].get());
+	EXPECT_TRUE(WaitUntilLoaded(*data.ImageFileData[2]));
+	EXPECT_EQ(data.ImageFileData[2]->PixelData[0], 0xFF000002u);
+
+	data.CancelLoad();
+	loader.join();
+
+	EXPECT_FALSE(data.ImageFileData[0]->IsLoaded());
+	EXPECT_FALSE(data.ImageFileData[1]->IsLoaded());
+	EXPECT_FALSE(data.ImageFileData[3]->IsLoaded());
+}
+
+TEST(HdPackDataTest, PrefetchIsIgnoredWithoutLazyLoading) {
+	HdPackData data;
+	FillPack(data, 1);
+	data.PrefetchBitmap(data.ImageFileData[0].get());
+	EXPECT_FALSE(data.ImageFileData[0]->IsLoaded());
+
+	// Decoding on first use still works
+	data.ImageFileData[0]->Init();
+	EXPECT_TRUE(data.ImageFileData[0]->IsLoaded());
+}
@@ -0,0 +1,59 @@
+#include "pch.h"
+#include <thread>
+#include "NES/HdPacks/HdPackBuilder.h"
+
+// =============================================================================
+// HdTileRecordQueue Unit Tests
+// =============================================================================
+// Records come out in push order, a full queue rejects pushes, and a producer/consumer pair on two
+// threads loses nothing (HD pack recording).
+
+namespace {
+	HdTileRecord MakeRecord(uint32_t index) {
+		HdTileRecord record;
+		record.Key.TileIndex = (int32_t)index;
+		record.Key.PaletteColors = index * 3;
+		record.UsageCount = index + 1;
+		return record;
+	}
+}
+
+TEST(HdTileRecordQueueTest, FullQueueRejectsPush) {
+	auto queue = std::make_unique<HdTileRecordQueue>();
+	for (uint32_t i = 0; i < HdTileRecordQueue::Capacity; i++) {
+		ASSERT_TRUE(queue->TryPush(MakeRecord(i)));
+	}
+	EXPECT_FALSE(queue->TryPush(MakeRecord(0)));
+
+	uint32_t expected = 0;
+	EXPECT_EQ(queue->Consume([&](HdTileRecord& record) {
+		EXPECT_EQ(record.Key.TileIndex, (int32_t)expected);
+		expected++;
+	}), HdTileRecordQueue::Capacity);
+	EXPECT_TRUE(queue->TryPush(MakeRecord(0)));
+}
+
+TEST(HdTileRecordQueueTest, ProducerConsumerThreads) {
+	auto queue = std::make_unique<HdTileRecordQueue>();
+	constexpr uint32_t recordCount = 200000;
+
+	std::thread producer([&]() {
+		for (uint32_t i = 0; i < recordCount; i++) {
+			while (!queue->TryPush(MakeRecord(i))) {
+				std::this_thread::yield();
+			}
+		}
+	});
+
+	uint32_t expected = 0;
+	bool inOrder = true;
+	while (expected < recordCount) {
+		queue->Consume([&](HdTileRecord& record) {
+			inOrder &= record.Key.TileIndex == (int32_t)expected && record.Key.PaletteColors == expected * 3 && record.UsageCount == expected + 1;
+			expected++;
+		});
+	}
+	producer.join();
+	EXPECT_TRUE(inOrder);
+	EXPECT_EQ(expected, recordCount);
+}
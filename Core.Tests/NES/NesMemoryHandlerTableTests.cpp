@@ -0,0 +1,69 @@
+#include "pch.h"
+#include "NES/NesMemoryHandlerTable.h"
+
+namespace {
+	class TestHandler : public INesMemoryHandler {
+	public:
+		void GetMemoryRanges(MemoryRanges& ranges) override {}
+		uint8_t ReadRam(uint16_t addr) override { return 0; }
+		void WriteRam(uint16_t addr, uint8_t value) override {}
+	};
+}
+
+/// <summary>
+/// Tests for the page-granular NES CPU handler table.
+/// </summary>
+class NesMemoryHandlerTableTest : public ::testing::Test {
+protected:
+	TestHandler _openBus;
+	TestHandler _apu;
+	TestHandler _mapper;
+	NesMemoryHandlerTable _table;
+
+	void SetUp() override {
+		_table.Reset(&_openBus);
+	}
+};
+
+TEST_F(NesMemoryHandlerTableTest, WholePagesUseASinglePointer) {
+	for (uint32_t addr = 0x8000; addr <= 0xFFFF; addr++) {
+		_table.Set(addr, &_mapper);
+	}
+	_table.Compact();
+
+	EXPECT_EQ(_table.GetSplitPageCount(), 0u);
+	EXPECT_EQ(_table.GetPageHandler(0x80), &_mapper);
+	EXPECT_EQ(_table.GetPageHandler(0xFF), &_mapper);
+	EXPECT_EQ(_table.Get(0xC123), &_mapper);
+	EXPECT_EQ(_table.Get(0x7FFF), &_openBus);
+}
+
+TEST_F(NesMemoryHandlerTableTest, SharedPagesKeepPerAddressHandlers) {
+	for (uint32_t addr = 0x4000; addr <= 0x4013; addr++) {
+		_table.Set(addr, &_apu);
+	}
+	_table.Set(0x4015, &_apu);
+	for (uint32_t addr = 0x4020; addr <= 0x40FF; addr++) {
+		_table.Set(addr, &_mapper);
+	}
+	_table.Compact();
+
+	EXPECT_EQ(_table.GetSplitPageCount(), 1u);
+	EXPECT_EQ(_table.GetPageHandler(0x40), nullptr);
+	EXPECT_EQ(_table.Get(0x4000), &_apu);
+	EXPECT_EQ(_table.Get(0x4014), &_openBus);
+	EXPECT_EQ(_table.Get(0x4015), &_apu);
+	EXPECT_EQ(_table.Get(0x4020), &_mapper);
+	EXPECT_EQ(_table.Get(0x40FF), &_mapper);
+	EXPECT_EQ(_table.Get(0x4100), &_openBus);
+}
+
+TEST_F(NesMemoryHandlerTableTest, UnregisteringMergesThePageBack) {
+	_table.Set(0x2000, &_apu);
+	EXPECT_EQ(_table.GetPageHandler(0x20), nullptr);
+
+	_table.Set(0x2000, &_openBus);
+	_table.Compact();
+	EXPECT_EQ(_table.GetSplitPageCount(), 0u);
+	EXPECT_EQ(_table.GetPageHandler(0x20), &_openBus);
+}
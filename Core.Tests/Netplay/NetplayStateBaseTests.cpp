@@ -0,0 +1,58 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "Netplay/NetplayStateBase.h"
+
+// =============================================================================
+// NetplayStateBase Unit Tests
+// =============================================================================
+
+namespace {
+	vector<uint8_t> MakeState(size_t size, uint8_t seed) {
+		vector<uint8_t> state(size);
+		for (size_t i = 0; i < size; i++) {
+			state[i] = (uint8_t)(i * 7 + seed);
+		}
+		return state;
+	}
+}
+
+TEST(NetplayStateBaseTest, IdsSkipZero) {
+	NetplayStateBase base;
+	EXPECT_EQ(base.GetId(), 0u);
+	EXPECT_EQ(base.GetNextId(), 1u);
+
+	base.Set(0xFFFFFFFF, {});
+	EXPECT_EQ(base.GetNextId(), 1u);
+
+	base.Clear();
+	EXPECT_EQ(base.GetId(), 0u);
+}
+
+TEST(NetplayStateBaseTest, UnchangedBytesBecomeZero) {
+	vector<uint8_t> previous = MakeState(1000, 1);
+	vector<uint8_t> state = previous;
+	state[3] ^= 0x55;
+	state[999] ^= 0x01;
+
+	NetplayStateBase base;
+	base.Set(1, previous);
+	base.ApplyDelta(state);
+
+	for (size_t i = 0; i < state.size(); i++) {
+		EXPECT_EQ(state[i], i == 3 ? 0x55 : (i == 999 ? 0x01 : 0)) << i;
+	}
+}
+
+TEST(NetplayStateBaseTest, DeltaRoundTrip) {
+	// Sizes that aren't multiples of 8, and bases shorter/longer than the state
+	for (size_t baseSize : {0, 5, 13, 64, 100}) {
+		vector<uint8_t> state = MakeState(61, 3);
+		vector<uint8_t> data = state;
+
+		NetplayStateBase base;
+		base.Set(1, MakeState(baseSize, 9));
+		base.ApplyDelta(data);
+		base.ApplyDelta(data);
+		EXPECT_EQ(data, state) << baseSize;
+	}
+}
@@ -0,0 +1,99 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "Netplay/NetplayUdpChannel.h"
+
+// =============================================================================
+// NetplayUdpChannel Unit Tests
+// =============================================================================
+// Packets are built and processed directly (no socket): dropping a packet is
+// simulated by not passing it to the other channel.
+
+namespace {
+	constexpr uint32_t Token = 0x12345678;
+	const UdpEndpoint ClientEndpoint = {0x0100007F, 0x1234};
+
+	NetplayInputEntry MakeEntry(uint32_t frame, uint16_t syncId = 0) {
+		NetplayInputEntry entry;
+		entry.Controller = {1, 0};
+		entry.SyncId = syncId;
+		entry.Frame = frame;
+		entry.State.State = {(uint8_t)frame, 0xAA};
+		return entry;
+	}
+
+	vector<NetplayInputEntry> Transfer(NetplayUdpChannel& from, NetplayUdpChannel& to) {
+		vector<uint8_t> packet;
+		from.BuildPacket(packet);
+		vector<NetplayInputEntry> delivered;
+		to.ProcessPacket(packet.data(), (int)packet.size(), ClientEndpoint, delivered);
+		return delivered;
+	}
+}
+
+TEST(NetplayUdpChannelTest, LostPacketIsRecoveredFromNextOne) {
+	NetplayUdpChannel sender(nullptr, Token, ClientEndpoint);
+	NetplayUdpChannel receiver(nullptr, Token, UdpEndpoint{});
+
+	sender.QueueInput(MakeEntry(10));
+	vector<uint8_t> lost;
+	sender.BuildPacket(lost);
+
+	sender.QueueInput(MakeEntry(11));
+	vector<NetplayInputEntry> delivered = Transfer(sender, receiver);
+	ASSERT_EQ(delivered.size(), 2u);
+	EXPECT_EQ(delivered[0].Frame, 10u);
+	EXPECT_EQ(delivered[1].Frame, 11u);
+	EXPECT_EQ(delivered[1].State.State[0], 11);
+}
+
+TEST(NetplayUdpChannelTest, DuplicatesAreNotDelivered) {
+	NetplayUdpChannel sender(nullptr, Token, ClientEndpoint);
+	NetplayUdpChannel receiver(nullptr, Token, UdpEndpoint{});
+
+	sender.QueueInput(MakeEntry(5));
+	EXPECT_EQ(Transfer(sender, receiver).size(), 1u);
+
+	// Not acknowledged yet, sent again but only delivered once
+	sender.QueueInput(MakeEntry(6));
+	vector<NetplayInputEntry> delivered = Transfer(sender, receiver);
+	ASSERT_EQ(delivered.size(), 1u);
+	EXPECT_EQ(delivered[0].Frame, 6u);
+}
+
+TEST(NetplayUdpChannelTest, AcknowledgedInputIsNotSentAgain) {
+	NetplayUdpChannel sender(nullptr, Token, ClientEndpoint);
+	NetplayUdpChannel receiver(nullptr, Token, UdpEndpoint{});
+
+	sender.QueueInput(MakeEntry(1));
+	sender.QueueInput(MakeEntry(2));
+	Transfer(sender, receiver);
+	Transfer(receiver, sender);
+
+	EXPECT_TRUE(sender.TakeUnacknowledged().empty());
+	EXPECT_TRUE(sender.IsAlive());
+}
+
+TEST(NetplayUdpChannelTest, ResyncRestartsFrames) {
+	NetplayUdpChannel sender(nullptr, Token, ClientEndpoint);
+	NetplayUdpChannel receiver(nullptr, Token, UdpEndpoint{});
+
+	sender.QueueInput(MakeEntry(100, 1));
+	Transfer(sender, receiver);
+
+	// Player was sent the state of frame 90, their frames restart
+	sender.ClearQueues();
+	sender.QueueInput(MakeEntry(90, 2));
+	vector<NetplayInputEntry> delivered = Transfer(sender, receiver);
+	ASSERT_EQ(delivered.size(), 1u);
+	EXPECT_EQ(delivered[0].Frame, 90u);
+	EXPECT_EQ(delivered[0].SyncId, 2);
+}
+
+TEST(NetplayUdpChannelTest, PacketsWithAnotherTokenAreIgnored) {
+	NetplayUdpChannel sender(nullptr, Token + 1, ClientEndpoint);
+	NetplayUdpChannel receiver(nullptr, Token, UdpEndpoint{});
+
+	sender.QueueInput(MakeEntry(1));
+	EXPECT_TRUE(Transfer(sender, receiver).empty());
+	EXPECT_FALSE(receiver.IsAlive());
+}
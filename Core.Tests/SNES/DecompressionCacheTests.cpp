@@ -0,0 +1,169 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "SNES/Coprocessors/DecompressionCache.h"
+
+// =============================================================================
+// DecompressionCache Unit Tests
+// =============================================================================
+// Tests for the S-DD1/SPC7110 decompression cache, with a stateful fake decoder:
+// replayed output and the decoder's state after catching up must match an uncached decoder.
+
+namespace {
+	/// Stateful decoder: each value depends on all previous ones (like the context models)
+	struct FakeDecoder {
+		uint32_t State = 0;
+		uint32_t DecodeCount = 0;
+
+		void Init(uint32_t origin) { State = origin * 2654435761u; }
+		uint8_t Decode() {
+			DecodeCount++;
+			State = State * 1103515245u + 12345u;
+			return (uint8_t)(State >> 16);
+		}
+	};
+
+	struct CachedDecoder {
+		FakeDecoder Decoder;
+		DecompressionCache<uint8_t> Cache;
+
+		void Init(uint32_t origin) {
+			Decoder.Init(origin);
+			Cache.BeginStream(origin);
+		}
+
+		uint8_t Decode() {
+			uint8_t value;
+			if (Cache.TryGetNext(value)) {
+				return value;
+			}
+			CatchUp();
+			value = Decoder.Decode();
+			Cache.AddLive(value);
+			return value;
+		}
+
+		void CatchUp() {
+			for (uint32_t i = Cache.GetLag(); i > 0; i--) {
+				(void)Decoder.Decode();
+			}
+			Cache.SetCaughtUp();
+		}
+	};
+
+	vector<uint8_t> DecodeStream(CachedDecoder& dec, uint32_t origin, uint32_t length) {
+		dec.Init(origin);
+		vector<uint8_t> out;
+		for (uint32_t i = 0; i < length; i++) {
+			out.push_back(dec.Decode());
+		}
+		return out;
+	}
+
+	vector<uint8_t> ReferenceStream(uint32_t origin, uint32_t length, uint32_t* state = nullptr) {
+		FakeDecoder dec;
+		dec.Init(origin);
+		vector<uint8_t> out;
+		for (uint32_t i = 0; i < length; i++) {
+			out.push_back(dec.Decode());
+		}
+		if (state) {
+			*state = dec.State;
+		}
+		return out;
+	}
+}
+
+TEST(DecompressionCacheTest, ReplaysRestartedStream) {
+	CachedDecoder dec;
+	EXPECT_EQ(DecodeStream(dec, 5, 1000), ReferenceStream(5, 1000));
+	EXPECT_EQ(dec.Decoder.DecodeCount, 1000u);
+
+	EXPECT_EQ(DecodeStream(dec, 5, 1000), ReferenceStream(5, 1000));
+	EXPECT_EQ(dec.Decoder.DecodeCount, 1000u);
+	EXPECT_EQ(dec.Cache.GetLag(), 1000u);
+}
+
+TEST(DecompressionCacheTest, ContinuesLivePastCachedOutput) {
+	CachedDecoder dec;
+	(void)DecodeStream(dec, 7, 300);
+	EXPECT_EQ(DecodeStream(dec, 7, 800), ReferenceStream(7, 800));
+
+	// The decoder caught up once, then decoded the 500 new values
+	EXPECT_EQ(dec.Decoder.DecodeCount, 300u + 300u + 500u);
+
+	// The longer stream is now cached
+	EXPECT_EQ(DecodeStream(dec, 7, 800), ReferenceStream(7, 800));
+	EXPECT_EQ(dec.Decoder.DecodeCount, 1100u);
+}
+
+TEST(DecompressionCacheTest, CatchUpRestoresDecoderState) {
+	CachedDecoder dec;
+	(void)DecodeStream(dec, 9, 500);
+	(void)DecodeStream(dec, 9, 250);
+
+	uint32_t expectedState = 0;
+	(void)ReferenceStream(9, 250, &expectedState);
+	EXPECT_NE(dec.Decoder.State, expectedState);
+
+	// e.g before saving a state
+	dec.CatchUp();
+	EXPECT_EQ(dec.Decoder.State, expectedState);
+	EXPECT_EQ(dec.Cache.GetLag(), 0u);
+
+	// Values after catching up still come from the cache, and the decoder lags again
+	vector<uint8_t> expected = ReferenceStream(9, 500);
+	for (uint32_t i = 250; i < 500; i++) {
+		EXPECT_EQ(dec.Decode(), expected[i]);
+	}
+	EXPECT_EQ(dec.Cache.GetLag(), 250u);
+}
+
+TEST(DecompressionCacheTest, EndStreamDecodesLive) {
+	CachedDecoder dec;
+	(void)DecodeStream(dec, 3, 100);
+	dec.Init(3);
+	for (int i = 0; i < 10; i++) {
+		(void)dec.Decode();
+	}
+
+	// e.g after loading a state: the decoder's state is restored, the position in the stream isn't known
+	FakeDecoder reference;
+	reference.Init(3);
+	for (int i = 0; i < 10; i++) {
+		(void)reference.Decode();
+	}
+	dec.Decoder.State = reference.State;
+	dec.Cache.EndStream();
+
+	uint32_t count = dec.Decoder.DecodeCount;
+	for (int i = 0; i < 20; i++) {
+		EXPECT_EQ(dec.Decode(), reference.Decode());
+	}
+	EXPECT_EQ(dec.Decoder.DecodeCount, count + 20);
+}
+
+TEST(DecompressionCacheTest, DistinctKeysAndEviction) {
+	CachedDecoder dec;
+	constexpr uint32_t streamLength = DecompressionCache<uint8_t>::MaxStreamBytes;
+	constexpr uint32_t streamCount = DecompressionCache<uint8_t>::MaxCachedBytes / streamLength + 4;
+
+	for (uint32_t i = 0; i < streamCount; i++) {
+		(void)DecodeStream(dec, i, streamLength);
+	}
+
+	// The oldest streams were evicted, the most recent ones are still cached
+	uint32_t count = dec.Decoder.DecodeCount;
+	EXPECT_EQ(DecodeStream(dec, streamCount - 1, 1000), ReferenceStream(streamCount - 1, 1000));
+	EXPECT_EQ(dec.Decoder.DecodeCount, count);
+	EXPECT_EQ(DecodeStream(dec, 0, 1000), ReferenceStream(0, 1000));
+	EXPECT_EQ(dec.Decoder.DecodeCount, count + 1000);
+}
+
+TEST(DecompressionCacheTest, LongStreamsAreOnlyPartiallyCached) {
+	CachedDecoder dec;
+	constexpr uint32_t maxLength = DecompressionCache<uint8_t>::MaxStreamBytes;
+	(void)DecodeStream(dec, 1, maxLength + 100);
+	uint32_t count = dec.Decoder.DecodeCount;
+	EXPECT_EQ(DecodeStream(dec, 1, maxLength + 100), ReferenceStream(1, maxLength + 100));
+	EXPECT_EQ(dec.Decoder.DecodeCount, count + maxLength + 100);
+}
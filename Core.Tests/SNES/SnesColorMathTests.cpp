@@ -0,0 +1,168 @@
+#include "pch.h"
+#include "SNES/SnesColorMath.h"
+
+// =============================================================================
+// SnesColorMath Unit Tests
+// =============================================================================
+// Compares the branch-free scanline color math with the per-pixel logic of SnesPpu::ApplyColorMathToPixel
+// followed by SnesPpu::ApplyBrightness.
+
+namespace {
+	struct ColorMathLine {
+		uint16_t Main[256];
+		uint16_t Sub[256];
+		uint8_t MainFlags[256];
+		uint8_t SubPriority[256];
+		bool Window[256];
+	};
+
+	void ApplyColorMathToPixelReference(uint16_t& pixelA, uint16_t pixelB, const ColorMathLine& line, int x,
+		ColorWindowMode clipMode, ColorWindowMode preventMode, bool subtractMode, bool addSubscreen,
+		uint16_t fixedColor, uint8_t halfShift) {
+		bool isInsideWindow = line.Window[x];
+
+		switch (clipMode) {
+			default:
+			case ColorWindowMode::Never: break;
+			case ColorWindowMode::OutsideWindow:
+				if (!isInsideWindow) {
+					pixelA = 0;
+					halfShift = 0;
+				}
+				break;
+			case ColorWindowMode::InsideWindow:
+				if (isInsideWindow) {
+					pixelA = 0;
+					halfShift = 0;
+				}
+				break;
+			case ColorWindowMode::Always: pixelA = 0; break;
+		}
+
+		if (!(line.MainFlags[x] & PixelFlags::AllowColorMath)) {
+			return;
+		}
+
+		switch (preventMode) {
+			default:
+			case ColorWindowMode::Never: break;
+			case ColorWindowMode::OutsideWindow:
+				if (!isInsideWindow) {
+					return;
+				}
+				break;
+			case ColorWindowMode::InsideWindow:
+				if (isInsideWindow) {
+					return;
+				}
+				break;
+			case ColorWindowMode::Always: return;
+		}
+
+		uint16_t otherPixel = fixedColor;
+		if (addSubscreen) {
+			if (line.SubPriority[x] > 0) {
+				otherPixel = pixelB;
+			} else {
+				halfShift = 0;
+			}
+		}
+
+		constexpr int mask = 0x1F;
+		int r, g, b;
+		if (subtractMode) {
+			r = std::max((pixelA & mask) - (otherPixel & mask), 0) >> halfShift;
+			g = std::max(((pixelA >> 5) & mask) - ((otherPixel >> 5) & mask), 0) >> halfShift;
+			b = std::max(((pixelA >> 10) & mask) - ((otherPixel >> 10) & mask), 0) >> halfShift;
+		} else {
+			r = std::min(((pixelA & mask) + (otherPixel & mask)) >> halfShift, mask);
+			g = std::min((((pixelA >> 5) & mask) + ((otherPixel >> 5) & mask)) >> halfShift, mask);
+			b = std::min((((pixelA >> 10) & mask) + ((otherPixel >> 10) & mask)) >> halfShift, mask);
+		}
+		pixelA = (uint16_t)(r | (g << 5) | (b << 10));
+	}
+
+	uint16_t ApplyBrightnessReference(uint16_t pixel, uint8_t brightness) {
+		uint16_t r = (pixel & 0x1F) * brightness / 15;
+		uint16_t g = ((pixel >> 5) & 0x1F) * brightness / 15;
+		uint16_t b = ((pixel >> 10) & 0x1F) * brightness / 15;
+		return r | (g << 5) | (b << 10);
+	}
+
+	uint32_t NextRandom(uint32_t& seed) {
+		seed = seed * 1103515245 + 12345;
+		return seed >> 8;
+	}
+
+	void CompareWithReference(bool subtractMode, uint32_t seed) {
+		constexpr ColorWindowMode modes[] = {ColorWindowMode::Never, ColorWindowMode::OutsideWindow, ColorWindowMode::InsideWindow, ColorWindowMode::Always};
+
+		for (int i = 0; i < 200; i++) {
+			ColorMathLine line;
+			for (int x = 0; x < 256; x++) {
+				line.Main[x] = (uint16_t)(NextRandom(seed) & 0x7FFF);
+				line.Sub[x] = (uint16_t)(NextRandom(seed) & 0x7FFF);
+				line.MainFlags[x] = (NextRandom(seed) & 0x03) ? PixelFlags::AllowColorMath : 0;
+				line.SubPriority[x] = (uint8_t)(NextRandom(seed) % 4);
+				line.Window[x] = NextRandom(seed) & 0x01;
+			}
+
+			ColorWindowMode clipMode = modes[NextRandom(seed) & 0x03];
+			ColorWindowMode preventMode = modes[NextRandom(seed) & 0x03];
+			bool addSubscreen = NextRandom(seed) & 0x01;
+			bool halve = NextRandom(seed) & 0x01;
+			uint16_t fixedColor = (uint16_t)(NextRandom(seed) & 0x7FFF);
+			uint8_t brightness = i < 16 ? 15 : (uint8_t)(NextRandom(seed) & 0x0F);
+			int start = i & 0x01 ? (int)(NextRandom(seed) & 0x7F) : 0;
+			int end = i & 0x01 ? 128 + (int)(NextRandom(seed) & 0x7F) : 255;
+
+			uint16_t expected[256];
+			memcpy(expected, line.Main, sizeof(expected));
+			for (int x = start; x <= end; x++) {
+				ApplyColorMathToPixelReference(expected[x], line.Sub[x], line, x, clipMode, preventMode, subtractMode, addSubscreen, fixedColor, halve);
+				expected[x] = ApplyBrightnessReference(expected[x], brightness);
+			}
+
+			SnesColorMathParams params(clipMode, preventMode, addSubscreen, halve, fixedColor, brightness);
+			if (subtractMode) {
+				SnesColorMath::ApplyLine<true>(line.Main, line.Sub, line.MainFlags, line.SubPriority, line.Window, start, end, params);
+			} else {
+				SnesColorMath::ApplyLine<false>(line.Main, line.Sub, line.MainFlags, line.SubPriority, line.Window, start, end, params);
+			}
+
+			for (int x = 0; x < 256; x++) {
+				ASSERT_EQ(line.Main[x], expected[x]) << "x=" << x << " clip=" << (int)clipMode << " prevent=" << (int)preventMode
+				                                     << " addSub=" << addSubscreen << " halve=" << halve << " brightness=" << (int)brightness;
+			}
+		}
+	}
+}
+
+TEST(SnesColorMathTest, AddMatchesPerPixel) {
+	CompareWithReference(false, 0x1234);
+}
+
+TEST(SnesColorMathTest, SubtractMatchesPerPixel) {
+	CompareWithReference(true, 0xBEEF);
+}
+
+TEST(SnesColorMathTest, BrightnessMatchesReference_AllColors) {
+	for (uint8_t brightness = 0; brightness < 16; brightness++) {
+		for (uint32_t color = 0; color < 0x8000; color++) {
+			ASSERT_EQ(SnesColorMath::ApplyBrightness((uint16_t)color, brightness), ApplyBrightnessReference((uint16_t)color, brightness));
+		}
+	}
+}
+
+TEST(SnesColorMathTest, BrightnessScanlineRange) {
+	uint16_t pixels[256];
+	for (int x = 0; x < 256; x++) {
+		pixels[x] = 0x7FFF;
+	}
+
+	SnesColorMath::ApplyBrightness(pixels, 10, 20, 0);
+	EXPECT_EQ(pixels[9], 0x7FFF);
+	EXPECT_EQ(pixels[10], 0);
+	EXPECT_EQ(pixels[20], 0);
+	EXPECT_EQ(pixels[21], 0x7FFF);
+}
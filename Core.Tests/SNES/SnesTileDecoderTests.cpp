@@ -0,0 +1,63 @@
+#include "pch.h"
+#include "SNES/SnesTileDecoder.h"
+
+// =============================================================================
+// SnesTileDecoder Unit Tests
+// =============================================================================
+// Compares the 8-pixel row decoder with the per-pixel bit extraction done by SnesPpu::GetTilePixelColor.
+
+namespace {
+	template <uint8_t bpp>
+	uint8_t GetTilePixelColorReference(const uint16_t chrData[4], uint8_t shift) {
+		uint8_t color = 0;
+		for (int plane = 0; plane < bpp / 2; plane++) {
+			color |= ((chrData[plane] >> shift) & 0x01) << (plane * 2);
+			color |= ((chrData[plane] >> (7 + shift)) & 0x02) << (plane * 2);
+		}
+		return color;
+	}
+
+	template <uint8_t bpp>
+	void CompareWithReference(uint32_t seed) {
+		for (int i = 0; i < 2000; i++) {
+			uint16_t chrData[4];
+			for (uint16_t& plane : chrData) {
+				seed = seed * 1103515245 + 12345;
+				plane = (uint16_t)(seed >> 8);
+			}
+
+			for (bool hMirror : {false, true}) {
+				uint64_t row = SnesTileDecoder::DecodeRow<bpp>(chrData, hMirror);
+				for (uint8_t xOffset = 0; xOffset < 8; xOffset++) {
+					uint8_t shift = hMirror ? xOffset : (7 - xOffset);
+					ASSERT_EQ(SnesTileDecoder::GetPixel(row, xOffset), GetTilePixelColorReference<bpp>(chrData, shift));
+				}
+			}
+		}
+	}
+}
+
+TEST(SnesTileDecoderTest, Decode2bppMatchesPerPixel) {
+	CompareWithReference<2>(1);
+}
+
+TEST(SnesTileDecoderTest, Decode4bppMatchesPerPixel) {
+	CompareWithReference<4>(2);
+}
+
+TEST(SnesTileDecoderTest, Decode8bppMatchesPerPixel) {
+	CompareWithReference<8>(3);
+}
+
+TEST(SnesTileDecoderTest, TransparentRowIsZero) {
+	uint16_t chrData[4] = {0, 0, 0, 0xFFFF};
+	EXPECT_EQ(SnesTileDecoder::DecodeRow<4>(chrData, false), 0u);
+	EXPECT_NE(SnesTileDecoder::DecodeRow<8>(chrData, true), 0u);
+}
+
+TEST(SnesTileDecoderTest, LeftmostPixelIsLowestByte) {
+	// Bit 7 of plane 0 = leftmost pixel (unless flipped)
+	uint16_t chrData[4] = {0x0080, 0, 0, 0};
+	EXPECT_EQ(SnesTileDecoder::DecodeRow<2>(chrData, false), 0x01u);
+	EXPECT_EQ(SnesTileDecoder::DecodeRow<2>(chrData, true), 0x01ull << 56);
+}
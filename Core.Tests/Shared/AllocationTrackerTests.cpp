@@ -0,0 +1,126 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <thread>
+#include "Shared/AllocationTracker.h"
+#include "Shared/FrameProfiler.h"
+
+// =============================================================================
+// AllocationTracker Unit Tests
+// =============================================================================
+// Only meaningful in instrumented builds (NEXEN_ALLOC_TRACKING), skipped otherwise.
+
+namespace {
+	class AllocationTrackerTest : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			if (!AllocationTracker::Enabled) {
+				GTEST_SKIP() << "Requires NEXEN_ALLOC_TRACKING";
+			}
+			AllocationTracker::TrackCurrentThread(true);
+		}
+
+		void TearDown() override {
+			AllocationTracker::TrackCurrentThread(false);
+		}
+	};
+
+	void* volatile _sink = nullptr;
+
+	// Keeps the compiler from eliding new/delete pairs
+	void Use(void* ptr) {
+		_sink = ptr;
+	}
+}
+
+TEST_F(AllocationTrackerTest, CountsTrackedThreadAllocations) {
+	int* value = new int(5);
+	Use(value);
+	vector<uint8_t>* buffer = new vector<uint8_t>(100);
+	Use(buffer);
+
+	AllocationStats stats = AllocationTracker::TakeStats();
+	EXPECT_EQ(stats.Count, 3u);
+	EXPECT_EQ(stats.Bytes, sizeof(int) + sizeof(vector<uint8_t>) + 100);
+	ASSERT_EQ(stats.SampleCount, 3u);
+	EXPECT_EQ(stats.Samples[0].Size, sizeof(int));
+	EXPECT_NE(stats.Samples[0].CallSite, nullptr);
+
+	delete value;
+	delete buffer;
+
+	// Frees aren't counted, the counters are reset by TakeStats
+	EXPECT_EQ(AllocationTracker::TakeStats().Count, 0u);
+}
+
+TEST_F(AllocationTrackerTest, OtherThreadsAreNotCounted) {
+	std::thread thread([]() {
+		EXPECT_FALSE(AllocationTracker::IsTrackingCurrentThread());
+		for (int i = 0; i < 10; i++) {
+			int* value = new int(i);
+			Use(value);
+			delete value;
+		}
+	});
+	thread.join();
+
+	// std::thread allocates its state on the calling thread
+	AllocationTracker::TakeStats();
+	EXPECT_EQ(AllocationTracker::TakeStats().Count, 0u);
+}
+
+TEST_F(AllocationTrackerTest, KeepsOnlyTheFirstSamples) {
+	for (int i = 0; i < 20; i++) {
+		int* value = new int(i);
+		Use(value);
+		delete value;
+	}
+
+	AllocationStats stats = AllocationTracker::TakeStats();
+	EXPECT_EQ(stats.Count, 20u);
+	EXPECT_EQ(stats.SampleCount, AllocationStats::MaxSamples);
+}
+
+TEST_F(AllocationTrackerTest, WarmupFramesAreNotReported) {
+	for (uint32_t i = 0; i < AllocationTracker::WarmupFrames; i++) {
+		int* value = new int(5);
+		Use(value);
+		delete value;
+		AllocationTracker::EndFrame();
+	}
+	EXPECT_EQ(AllocationTracker::GetAllocatingFrameCount(), 0u);
+
+	// Steady state
+	AllocationTracker::EndFrame();
+	EXPECT_EQ(AllocationTracker::GetAllocatingFrameCount(), 0u);
+
+	string* str = new string(100, 'a');
+	Use(str);
+	delete str;
+	AllocationTracker::EndFrame();
+	EXPECT_EQ(AllocationTracker::GetAllocatingFrameCount(), 1u);
+
+	// The report itself isn't counted
+	AllocationTracker::EndFrame();
+	EXPECT_EQ(AllocationTracker::GetAllocatingFrameCount(), 1u);
+}
+
+TEST_F(AllocationTrackerTest, FrameProfilerEndFrameDoesNotAllocate) {
+	FrameProfiler profiler;
+	profiler.EndFrame(true);
+	for (int i = 0; i < 10; i++) {
+		{
+			ProfilerScope scope(&profiler, ProfilerStage::Emulation);
+		}
+		profiler.EndFrame(true);
+	}
+	AllocationTracker::TakeStats();
+
+	// Steady state: recording frames must not allocate
+	for (uint32_t i = 0; i < FrameProfiler::HistorySize * 2; i++) {
+		{
+			ProfilerScope scope(&profiler, ProfilerStage::Emulation);
+		}
+		profiler.EndFrame(true);
+	}
+	EXPECT_EQ(AllocationTracker::TakeStats().Count, 0u);
+}
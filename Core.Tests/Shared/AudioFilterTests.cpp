@@ -0,0 +1,121 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <array>
+#include <cmath>
+#include <vector>
+#include "Utilities/Audio/Equalizer.h"
+#include "Utilities/Audio/ReverbFilter.h"
+#include "Utilities/Audio/CrossFeedFilter.h"
+#include "Utilities/Audio/SampleConverter.h"
+
+// =============================================================================
+// Audio Filter Unit Tests
+// =============================================================================
+// Tests for SoundMixer's float effect chain (equalizer, reverb, crossfeed, conversion).
+
+namespace {
+	vector<float> MakeStereoSignal(uint32_t sampleCount) {
+		vector<float> samples(sampleCount * 2);
+		for (uint32_t i = 0; i < sampleCount; i++) {
+			samples[i * 2] = (float)(12000 * std::sin(i * 0.05) + 3000 * std::sin(i * 0.9));
+			samples[i * 2 + 1] = (float)(9000 * std::sin(i * 0.013) - 5000 * std::sin(i * 0.4));
+		}
+		return samples;
+	}
+}
+
+TEST(AudioFilterTest, Equalizer_StereoKernel_MatchesOrfanidisReference) {
+	std::array<double, 20> gains = {6, 4, 2, 0, -2, -4, -6, 0, 3, 3, 0, -3, -12, 0, 5, 0, 0, 8, -8, 1};
+	constexpr uint32_t SampleRate = 48000;
+	constexpr uint32_t SampleCount = 2000;
+
+	// Reference: one orfanidis equalizer per channel, built the same way Equalizer does
+	static constexpr std::array<double, 22> bands = {
+		24, 40, 56, 80, 113, 160, 225, 320, 450, 600, 750, 1000,
+		2000, 3000, 4000, 5000, 6000, 7000, 10000, 12500, 13000, 13500
+	};
+	orfanidis_eq::freq_grid grid;
+	for (size_t i = 1; i < bands.size() - 1; i++) {
+		grid.add_band((bands[i] + bands[i - 1]) / 2, bands[i], (bands[i + 1] + bands[i]) / 2);
+	}
+	orfanidis_eq::eq1 left(&grid, orfanidis_eq::filter_type::butterworth);
+	orfanidis_eq::eq1 right(&grid, orfanidis_eq::filter_type::butterworth);
+	left.set_sample_rate(SampleRate);
+	right.set_sample_rate(SampleRate);
+	for (unsigned int i = 0; i < grid.get_number_of_bands(); i++) {
+		left.change_band_gain_db(i, gains[i]);
+		right.change_band_gain_db(i, gains[i]);
+	}
+
+	vector<float> samples = MakeStereoSignal(SampleCount);
+	vector<double> expected(samples.size());
+	for (uint32_t i = 0; i < SampleCount; i++) {
+		double inL = samples[i * 2];
+		double inR = samples[i * 2 + 1];
+		left.sbs_process(&inL, &expected[i * 2]);
+		right.sbs_process(&inR, &expected[i * 2 + 1]);
+	}
+
+	Equalizer equalizer;
+	equalizer.UpdateEqualizers(gains, SampleRate);
+	// Two blocks, so the filter state has to carry over between calls
+	equalizer.ApplyEqualizer(SampleCount / 2, samples.data());
+	equalizer.ApplyEqualizer(SampleCount / 2, samples.data() + SampleCount);
+
+	for (size_t i = 0; i < samples.size(); i++) {
+		ASSERT_NEAR(samples[i], expected[i], 0.01) << "sample " << i;
+	}
+}
+
+TEST(AudioFilterTest, SampleConverter_ToInt16_RoundsAndSaturates) {
+	float in[] = {0.4f, 0.6f, -0.6f, 1000.5f, 40000.0f, -40000.0f, 32767.4f, -32768.0f};
+	int16_t out[8];
+	SampleConverter::ToInt16(in, out, 8, 1.0f);
+
+	EXPECT_EQ(out[0], 0);
+	EXPECT_EQ(out[1], 1);
+	EXPECT_EQ(out[2], -1);
+	EXPECT_EQ(out[3], 1001);
+	EXPECT_EQ(out[4], 32767);
+	EXPECT_EQ(out[5], -32768);
+	EXPECT_EQ(out[6], 32767);
+	EXPECT_EQ(out[7], -32768);
+
+	SampleConverter::ToInt16(in + 3, out, 1, 0.5f);
+	EXPECT_EQ(out[0], 500);
+}
+
+TEST(AudioFilterTest, CrossFeed_Float_OnlyClampsAtConversion) {
+	float samples[] = {30000.0f, 10000.0f};
+	CrossFeedFilter filter;
+	filter.ApplyFilter(samples, 1, 50);
+	EXPECT_FLOAT_EQ(samples[0], 35000.0f);
+	EXPECT_FLOAT_EQ(samples[1], 25000.0f);
+
+	// A later stage (e.g. volume) can bring the level back without clipping artifacts
+	int16_t out[2];
+	SampleConverter::ToInt16(samples, out, 2, 0.5f);
+	EXPECT_EQ(out[0], 17500);
+	EXPECT_EQ(out[1], 12500);
+}
+
+TEST(AudioFilterTest, Reverb_EchoAppearsAfterDelay) {
+	constexpr uint32_t SampleRate = 48000;
+	constexpr size_t BlockSize = 1000;
+	// reverbDelay 0.1 -> the shortest delay line is 150 * 0.1 = 15ms = 720 samples
+	ReverbFilter filter;
+
+	vector<float> block(BlockSize * 2, 0.0f);
+	block[0] = 10000.0f;
+	filter.ApplyFilter(block.data(), BlockSize, SampleRate, 1.0, 0.1);
+	EXPECT_FLOAT_EQ(block[0], 10000.0f);
+
+	vector<float> silence(BlockSize * 2, 0.0f);
+	filter.ApplyFilter(silence.data(), BlockSize, SampleRate, 1.0, 0.1);
+	bool hasEcho = false;
+	for (size_t i = 0; i < BlockSize; i++) {
+		EXPECT_FLOAT_EQ(silence[i * 2 + 1], 0.0f);
+		hasEcho |= silence[i * 2] != 0.0f;
+	}
+	EXPECT_TRUE(hasEcho);
+}
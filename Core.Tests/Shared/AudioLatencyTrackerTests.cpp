@@ -0,0 +1,61 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "Shared/Audio/AudioLatencyTracker.h"
+
+// =============================================================================
+// AudioLatencyTracker Unit Tests
+// =============================================================================
+// Tests for the latency percentile window and the queued/consumed block matching.
+
+TEST(AudioLatencyTrackerTest, WindowPercentiles) {
+	LatencyWindow window;
+	EXPECT_EQ(window.GetPercentiles().Max, 0);
+
+	// 1..100 ms
+	for (uint32_t i = 1; i <= 100; i++) {
+		window.Add(i * 1000);
+	}
+
+	LatencyPercentiles result = window.GetPercentiles();
+	EXPECT_DOUBLE_EQ(result.P50, 51);
+	EXPECT_DOUBLE_EQ(result.P95, 96);
+	EXPECT_DOUBLE_EQ(result.P99, 100);
+	EXPECT_DOUBLE_EQ(result.Max, 100);
+	EXPECT_DOUBLE_EQ(result.Average, 50.5);
+}
+
+TEST(AudioLatencyTrackerTest, WindowKeepsLatestValues) {
+	LatencyWindow window;
+	for (uint32_t i = 0; i < LatencyWindow::WindowSize; i++) {
+		window.Add(500000);
+	}
+	for (uint32_t i = 0; i < LatencyWindow::WindowSize; i++) {
+		window.Add(2000);
+	}
+	EXPECT_DOUBLE_EQ(window.GetPercentiles().Max, 2);
+}
+
+TEST(AudioLatencyTrackerTest, BlockIsMeasuredWhenItsLastByteIsConsumed) {
+	AudioLatencyTracker tracker;
+	int64_t start = AudioLatencyTracker::GetTimestamp() - 40000;
+
+	tracker.OnQueued(1000, start);
+	tracker.OnQueued(1000, start);
+
+	// Only part of the first block
+	tracker.OnConsumed(999);
+	EXPECT_EQ(tracker.GetLatency().Max, 0);
+
+	tracker.OnConsumed(1);
+	LatencyPercentiles latency = tracker.GetLatency();
+	EXPECT_GE(latency.Max, 40);
+	EXPECT_LT(latency.Max, 1000);
+
+	// Blocks without a timestamp keep the positions aligned, but aren't measured
+	tracker.OnQueued(500, 0);
+	tracker.OnConsumed(1500);
+	EXPECT_GE(tracker.GetLatency().P50, 40);
+
+	tracker.Clear();
+	EXPECT_EQ(tracker.GetLatency().Max, 0);
+}
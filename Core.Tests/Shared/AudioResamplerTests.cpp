@@ -0,0 +1,184 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <vector>
+#include <cmath>
+#include "Utilities/Audio/SincResampler.h"
+#include "Utilities/Audio/HermiteResampler.h"
+#include "Utilities/Audio/AudioRateController.h"
+
+// =============================================================================
+// Audio Resampler Unit Tests
+// =============================================================================
+// Tests for the windowed-sinc resampler and the dynamic rate controller.
+
+namespace {
+	constexpr double Pi = 3.14159265358979323846;
+
+	vector<int16_t> MakeStereoSine(uint32_t count, double frequency, double sampleRate, double amplitude) {
+		vector<int16_t> samples(count * 2);
+		for (uint32_t i = 0; i < count; i++) {
+			int16_t value = (int16_t)std::lround(amplitude * std::sin(2 * Pi * frequency * i / sampleRate));
+			samples[i * 2] = value;
+			samples[i * 2 + 1] = (int16_t)-value;
+		}
+		return samples;
+	}
+
+	template <typename T>
+	vector<int16_t> ResampleInBlocks(T& resampler, vector<int16_t>& input, uint32_t blockSize) {
+		vector<int16_t> output;
+		vector<int16_t> buffer(0x10000);
+		uint32_t frameCount = (uint32_t)input.size() / 2;
+		for (uint32_t pos = 0; pos < frameCount; pos += blockSize) {
+			uint32_t count = std::min(blockSize, frameCount - pos);
+			uint32_t written = resampler.template Resample<false>(input.data() + pos * 2, count, buffer.data(), buffer.size() / 2);
+			output.insert(output.end(), buffer.begin(), buffer.begin() + written * 2);
+		}
+		return output;
+	}
+
+	// Amplitude of the given frequency in the left channel, by correlating with a sine and cosine
+	double MeasureAmplitude(const vector<int16_t>& samples, uint32_t skip, double frequency, double sampleRate) {
+		double sinSum = 0;
+		double cosSum = 0;
+		uint32_t count = (uint32_t)samples.size() / 2 - skip;
+		for (uint32_t i = 0; i < count; i++) {
+			double phase = 2 * Pi * frequency * i / sampleRate;
+			sinSum += samples[(skip + i) * 2] * std::sin(phase);
+			cosSum += samples[(skip + i) * 2] * std::cos(phase);
+		}
+		return 2 * std::sqrt(sinSum * sinSum + cosSum * cosSum) / count;
+	}
+
+	double MeasureRms(const vector<int16_t>& samples, uint32_t skip) {
+		double sum = 0;
+		uint32_t count = (uint32_t)samples.size() / 2 - skip;
+		for (uint32_t i = 0; i < count; i++) {
+			sum += (double)samples[(skip + i) * 2] * samples[(skip + i) * 2];
+		}
+		return std::sqrt(sum / count);
+	}
+}
+
+TEST(SincResamplerTest, OutputCountMatchesRateRatio) {
+	SincResampler resampler(32);
+	resampler.SetSampleRates(32040, 48000);
+
+	vector<int16_t> input = MakeStereoSine(32040, 1000, 32040, 10000);
+	vector<int16_t> output = ResampleInBlocks(resampler, input, 534);
+
+	// One second of input gives one second of output (minus the filter's delay)
+	EXPECT_NEAR((double)output.size() / 2, 48000.0, 48000.0 * 0.002);
+}
+
+TEST(SincResamplerTest, PreservesInBandTone) {
+	for (uint32_t taps : {16u, 32u}) {
+		SincResampler resampler(taps);
+		resampler.SetSampleRates(32040, 48000);
+
+		vector<int16_t> input = MakeStereoSine(32040, 3000, 32040, 10000);
+		vector<int16_t> output = ResampleInBlocks(resampler, input, 534);
+
+		double amplitude = MeasureAmplitude(output, 1000, 3000, 48000);
+		EXPECT_NEAR(amplitude, 10000, 100) << taps << " taps";
+
+		// Right channel is the inverted left channel
+		EXPECT_NEAR(output[5000 * 2], -output[5000 * 2 + 1], 1);
+	}
+}
+
+TEST(SincResamplerTest, RemovesContentAboveOutputNyquist) {
+	// 30 kHz tone at 96 kHz has nowhere to go at 48 kHz, Hermite folds it back to 18 kHz
+	vector<int16_t> input = MakeStereoSine(96000, 30000, 96000, 10000);
+
+	SincResampler sinc(32);
+	sinc.SetSampleRates(96000, 48000);
+	vector<int16_t> sincOutput = ResampleInBlocks(sinc, input, 1600);
+
+	HermiteResampler hermite;
+	hermite.SetSampleRates(96000, 48000);
+	vector<int16_t> hermiteOutput = ResampleInBlocks(hermite, input, 1600);
+
+	double sincRms = MeasureRms(sincOutput, 1000);
+	double hermiteRms = MeasureRms(hermiteOutput, 1000);
+	EXPECT_LT(sincRms, 10000 / std::sqrt(2.0) / 100); // at least -40 dB
+	EXPECT_GT(hermiteRms, sincRms * 10);
+}
+
+TEST(SincResamplerTest, BlockSizeDoesNotChangeOutput) {
+	vector<int16_t> input = MakeStereoSine(4800, 440, 44100, 12000);
+
+	SincResampler a(16);
+	a.SetSampleRates(44100, 48000);
+	vector<int16_t> small = ResampleInBlocks(a, input, 37);
+
+	SincResampler b(16);
+	b.SetSampleRates(44100, 48000);
+	vector<int16_t> large = ResampleInBlocks(b, input, 1000);
+
+	EXPECT_EQ(small, large);
+}
+
+TEST(SincResamplerTest, OverflowIsKeptForNextCall) {
+	SincResampler resampler(16);
+	resampler.SetSampleRates(24000, 48000);
+
+	vector<int16_t> input = MakeStereoSine(100, 440, 24000, 12000);
+	vector<int16_t> out(400 * 2);
+	uint32_t written = resampler.Resample<false>(input.data(), 100, out.data(), 150);
+	EXPECT_EQ(written, 150u);
+	EXPECT_GT(resampler.GetPendingCount(), 0u);
+
+	uint32_t pending = resampler.GetPendingCount();
+	written = resampler.Resample<false>(nullptr, 0, out.data(), 400);
+	EXPECT_EQ(written, pending);
+	EXPECT_EQ(resampler.GetPendingCount(), 0u);
+}
+
+TEST(AudioRateControllerTest, ConvergesOnTargetWithClockDrift) {
+	// Simulated sound card running 0.3% fast, consuming 10ms periods, fed once per 60 fps frame
+	constexpr double sampleRate = 48000;
+	constexpr double drift = 1.003;
+	constexpr double frameTime = 1.0 / 60;
+	constexpr double targetLatency = 30;
+
+	AudioRateController controller;
+	double buffered = sampleRate * 0.045;
+	double deviceTime = 0;
+	double minLatency = 1000;
+	double errorSum = 0;
+
+	for (int frame = 0; frame < 60 * 60; frame++) {
+		buffered += sampleRate * frameTime * controller.GetRateAdjustment();
+
+		double latency = buffered / sampleRate * 1000;
+		controller.Update(latency, targetLatency, frameTime);
+
+		for (deviceTime += frameTime; deviceTime >= 0.01; deviceTime -= 0.01) {
+			buffered -= sampleRate * 0.01 * drift;
+		}
+
+		if (frame > 60 * 5) {
+			// Lowest point of the buffer, just before the next frame is written
+			minLatency = std::min(minLatency, buffered / sampleRate * 1000);
+		}
+		if (frame >= 60 * 59) {
+			errorSum += latency - targetLatency;
+		}
+	}
+
+	EXPECT_NEAR(controller.GetRateAdjustment(), drift, 0.0005);
+	EXPECT_LT(std::abs(errorSum / 60), 1.5);
+	EXPECT_GT(minLatency, 5);
+}
+
+TEST(AudioRateControllerTest, AdjustmentIsBounded) {
+	AudioRateController controller;
+	for (int i = 0; i < 1000; i++) {
+		controller.Update(500, 30, 1.0 / 60);
+	}
+	EXPECT_DOUBLE_EQ(controller.GetRateAdjustment(), 1.0 - AudioRateController::MaxAdjustment);
+
+	controller.Reset();
+	EXPECT_DOUBLE_EQ(controller.GetRateAdjustment(), 1.0);
+}
@@ -0,0 +1,109 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "Shared/Audio/AudioRingBuffer.h"
+
+// =============================================================================
+// AudioRingBuffer Unit Tests
+// =============================================================================
+// Tests for the lock-free SPSC ring shared by the audio backends and their device callbacks.
+
+TEST(AudioRingBufferTest, CapacityIsRoundedToPowerOfTwo) {
+	AudioRingBuffer ring;
+	ring.Reset(0x30000);
+	EXPECT_EQ(ring.GetCapacity(), 0x40000u);
+	EXPECT_EQ(ring.GetFillLevel(), 0u);
+
+	ring.Reset(0);
+	EXPECT_EQ(ring.GetCapacity(), 0u);
+	uint8_t value = 1;
+	EXPECT_EQ(ring.Write(&value, 1), 0u);
+}
+
+TEST(AudioRingBufferTest, WrapsAround) {
+	AudioRingBuffer ring;
+	ring.Reset(16);
+
+	uint8_t data[12];
+	for (int i = 0; i < 12; i++) {
+		data[i] = (uint8_t)i;
+	}
+	uint8_t out[12] = {};
+
+	// Second write/read crosses the end of the buffer
+	for (int pass = 0; pass < 3; pass++) {
+		ASSERT_EQ(ring.Write(data, 12), 12u);
+		EXPECT_EQ(ring.GetFillLevel(), 12u);
+		ASSERT_EQ(ring.Read(out, 12), 12u);
+		EXPECT_EQ(memcmp(out, data, 12), 0) << "pass " << pass;
+		EXPECT_EQ(ring.GetFillLevel(), 0u);
+	}
+}
+
+TEST(AudioRingBufferTest, OverflowDropsAndUnderrunReturnsAvailable) {
+	AudioRingBuffer ring;
+	ring.Reset(16);
+
+	uint8_t data[20];
+	for (int i = 0; i < 20; i++) {
+		data[i] = (uint8_t)(i + 1);
+	}
+	EXPECT_EQ(ring.Write(data, 20), 16u);
+	EXPECT_EQ(ring.Write(data, 1), 0u);
+
+	uint8_t out[20] = {};
+	EXPECT_EQ(ring.Read(out, 10), 10u);
+	EXPECT_EQ(ring.Read(out + 10, 10), 6u);
+	EXPECT_EQ(memcmp(out, data, 16), 0);
+	EXPECT_EQ(ring.Read(out, 4), 0u);
+
+	ring.Write(data, 8);
+	ring.Clear();
+	EXPECT_EQ(ring.GetFillLevel(), 0u);
+}
+
+TEST(AudioRingBufferTest, ConcurrentProducerConsumerKeepsOrder) {
+	AudioRingBuffer ring;
+	ring.Reset(4096);
+
+	constexpr uint32_t totalBytes = 4 * 1024 * 1024;
+	std::thread producer([&]() {
+		uint8_t chunk[700];
+		uint32_t written = 0;
+		while (written < totalBytes) {
+			uint32_t len = std::min<uint32_t>(sizeof(chunk), totalBytes - written);
+			for (uint32_t i = 0; i < len; i++) {
+				chunk[i] = (uint8_t)((written + i) * 31);
+			}
+			uint32_t count = 0;
+			while (count < len) {
+				count += ring.Write(chunk + count, len - count);
+				if (count < len) {
+					std::this_thread::yield();
+				}
+			}
+			written += len;
+		}
+	});
+
+	uint8_t chunk[512];
+	uint32_t readTotal = 0;
+	uint32_t mismatches = 0;
+	while (readTotal < totalBytes) {
+		uint32_t count = ring.Read(chunk, sizeof(chunk));
+		for (uint32_t i = 0; i < count; i++) {
+			if (chunk[i] != (uint8_t)((readTotal + i) * 31)) {
+				mismatches++;
+			}
+		}
+		readTotal += count;
+		if (count == 0) {
+			std::this_thread::yield();
+		}
+	}
+	producer.join();
+
+	EXPECT_EQ(mismatches, 0u);
+	EXPECT_EQ(ring.GetFillLevel(), 0u);
+}
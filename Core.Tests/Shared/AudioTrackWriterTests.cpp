@@ -0,0 +1,128 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include "Shared/Audio/AudioTrackWriter.h"
+
+// =============================================================================
+// AudioTrackWriter Unit Tests
+// =============================================================================
+// Tests for the batch audio export's WAV output: track length, fade out, silence detection and trimming.
+
+namespace {
+	class AudioTrackWriterTest : public ::testing::Test {
+	protected:
+		static constexpr uint32_t SampleRate = 1000;
+		static constexpr uint32_t BlockSize = 100;
+
+		string _path;
+		AudioTrackExportOptions _options;
+
+		void SetUp() override {
+			_path = (std::filesystem::temp_directory_path() / "nexen_audiotrackwriter_test.wav").string();
+			_options.SampleRate = SampleRate;
+			_options.MaxLength = 10;
+			_options.SilenceLength = 1;
+			_options.SilenceThreshold = 64;
+		}
+
+		void TearDown() override {
+			std::filesystem::remove(_path);
+		}
+
+		static vector<int16_t> Tone(uint32_t sampleCount, int16_t amplitude, int16_t offset = 0) {
+			vector<int16_t> samples(sampleCount * 2);
+			for (uint32_t i = 0; i < sampleCount * 2; i++) {
+				samples[i] = (int16_t)(offset + ((i / 2) & 1 ? amplitude : -amplitude));
+			}
+			return samples;
+		}
+
+		/// Feeds blocks until the writer reports the end of the track, returns the number of blocks sent
+		static uint32_t Feed(AudioTrackWriter& writer, const vector<int16_t>& block, uint32_t maxBlocks) {
+			for (uint32_t i = 0; i < maxBlocks; i++) {
+				if (!writer.AddSamples(block.data(), (uint32_t)block.size() / 2)) {
+					return i + 1;
+				}
+			}
+			return maxBlocks;
+		}
+
+		vector<int16_t> ReadWav(uint32_t& dataSize, uint32_t& riffSize) {
+			std::ifstream in(_path, std::ios::binary);
+			vector<char> header(44);
+			in.read(header.data(), header.size());
+			memcpy(&riffSize, header.data() + 4, 4);
+			memcpy(&dataSize, header.data() + 40, 4);
+			EXPECT_EQ(string(header.data(), 4), "RIFF");
+			EXPECT_EQ(string(header.data() + 36, 4), "data");
+			vector<int16_t> samples(dataSize / 2);
+			in.read((char*)samples.data(), dataSize);
+			return samples;
+		}
+	};
+}
+
+TEST_F(AudioTrackWriterTest, StopsAtMaxLength) {
+	_options.SilenceLength = 0;
+	AudioTrackWriter writer;
+	ASSERT_TRUE(writer.Open(_path, _options, 0, 0));
+	EXPECT_EQ(Feed(writer, Tone(BlockSize, 1000), 1000), 100u);
+	EXPECT_TRUE(writer.IsDone());
+	ASSERT_TRUE(writer.Close());
+
+	uint32_t dataSize = 0, riffSize = 0;
+	vector<int16_t> samples = ReadWav(dataSize, riffSize);
+	EXPECT_EQ(dataSize, 10 * SampleRate * 4);
+	EXPECT_EQ(riffSize, dataSize + 36);
+	EXPECT_FALSE(writer.IsEndedBySilence());
+}
+
+TEST_F(AudioTrackWriterTest, TrackLengthAndFade) {
+	AudioTrackWriter writer;
+	ASSERT_TRUE(writer.Open(_path, _options, 2.0, 0.5));
+
+	// Silence detection is disabled when the file gives the track's length
+	(void)Feed(writer, Tone(BlockSize, 0), 1000);
+	writer.Close();
+	uint32_t dataSize = 0, riffSize = 0;
+	(void)ReadWav(dataSize, riffSize);
+	EXPECT_EQ(dataSize, 2 * SampleRate * 4);
+
+	AudioTrackWriter fadeWriter;
+	ASSERT_TRUE(fadeWriter.Open(_path, _options, 2.0, 0.5));
+	(void)Feed(fadeWriter, Tone(BlockSize, 1000), 1000);
+	fadeWriter.Close();
+	vector<int16_t> samples = ReadWav(dataSize, riffSize);
+	ASSERT_EQ(samples.size(), 2 * SampleRate * 2);
+	EXPECT_EQ(std::abs(samples[1000 * 2]), 1000);
+	EXPECT_EQ(std::abs(samples[1500 * 2]), 1000);
+	EXPECT_NEAR(std::abs(samples[1750 * 2]), 500, 2);
+	EXPECT_LE(std::abs(samples[1999 * 2]), 2);
+}
+
+TEST_F(AudioTrackWriterTest, TrailingSilenceIsTrimmed) {
+	AudioTrackWriter writer;
+	ASSERT_TRUE(writer.Open(_path, _options, 0, 0));
+	(void)Feed(writer, Tone(BlockSize, 1000), 20);
+
+	// Short silence followed by sound is kept
+	(void)Feed(writer, Tone(BlockSize, 10, 500), 5);
+	(void)Feed(writer, Tone(BlockSize, 1000), 10);
+
+	// DC offset only: silent
+	EXPECT_EQ(Feed(writer, Tone(BlockSize, 0, 2000), 1000), 10u);
+	EXPECT_TRUE(writer.IsEndedBySilence());
+	ASSERT_TRUE(writer.Close());
+
+	uint32_t dataSize = 0, riffSize = 0;
+	(void)ReadWav(dataSize, riffSize);
+	EXPECT_EQ(dataSize, 35 * BlockSize * 4);
+	EXPECT_EQ(writer.GetWrittenSampleCount(), 35 * BlockSize);
+}
+
+TEST_F(AudioTrackWriterTest, InvalidPathFails) {
+	AudioTrackWriter writer;
+	EXPECT_FALSE(writer.Open((std::filesystem::temp_directory_path() / "missing_folder" / "out.wav").string(), _options, 0, 0));
+	EXPECT_FALSE(writer.Close());
+}
@@ -0,0 +1,105 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include "Shared/BatteryManager.h"
+
+// =============================================================================
+// BatteryManager Unit Tests
+// =============================================================================
+// Atomic save data writes and the background flush (only changed files are
+// queued, and synchronous saves are never overwritten by older flushes).
+
+class BatteryManagerTest : public ::testing::Test {
+protected:
+	string _folder;
+	BatteryManager _manager;
+
+	void SetUp() override {
+		_folder = (std::filesystem::temp_directory_path() / ("NexenBatteryTest_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()))).string();
+		_manager.SetPerRomSaveDirectory(_folder);
+		_manager.Initialize("Game");
+	}
+
+	void TearDown() override {
+		_manager.WaitForPendingWrites();
+		std::error_code ec;
+		std::filesystem::remove_all(_folder, ec);
+	}
+
+	vector<uint8_t> ReadSave() {
+		vector<uint8_t> data;
+		std::ifstream file(_folder + "/Game.sav", std::ios::binary);
+		data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+		return data;
+	}
+};
+
+TEST_F(BatteryManagerTest, SaveWritesFileWithoutTempFile) {
+	vector<uint8_t> sram(8192, 0x42);
+	_manager.SaveBattery(".sav", sram);
+
+	EXPECT_EQ(ReadSave(), sram);
+	EXPECT_FALSE(std::filesystem::exists(_folder + "/Game.sav.tmp"));
+	EXPECT_TRUE(_manager.HasBattery());
+}
+
+TEST_F(BatteryManagerTest, FlushWritesChangedData) {
+	vector<uint8_t> sram(3 * BatteryManager::FlushPageSize + 100, 0);
+	_manager.BeginFlush();
+	_manager.SaveBattery(".sav", sram);
+	_manager.EndFlush();
+	_manager.WaitForPendingWrites();
+	EXPECT_EQ(ReadSave(), sram);
+
+	// Change the last (partial) page only
+	sram.back() = 0x55;
+	_manager.BeginFlush();
+	_manager.SaveBattery(".sav", sram);
+	_manager.EndFlush();
+	_manager.WaitForPendingWrites();
+	EXPECT_EQ(ReadSave(), sram);
+}
+
+TEST_F(BatteryManagerTest, FlushSkipsUnchangedData) {
+	vector<uint8_t> sram(8192, 0x11);
+	_manager.SaveBattery(".sav", sram);
+
+	// Replace the file behind the manager's back: an unchanged flush must not rewrite it
+	std::filesystem::remove(_folder + "/Game.sav");
+	_manager.BeginFlush();
+	_manager.SaveBattery(".sav", sram);
+	_manager.EndFlush();
+	_manager.WaitForPendingWrites();
+	EXPECT_FALSE(std::filesystem::exists(_folder + "/Game.sav"));
+}
+
+TEST_F(BatteryManagerTest, SynchronousSaveWinsOverPendingFlush) {
+	vector<uint8_t> sram(64 * 1024, 0x01);
+	_manager.BeginFlush();
+	_manager.SaveBattery(".sav", sram);
+	_manager.EndFlush();
+
+	vector<uint8_t> finalSram(64 * 1024, 0x02);
+	_manager.SaveBattery(".sav", finalSram);
+	_manager.WaitForPendingWrites();
+	EXPECT_EQ(ReadSave(), finalSram);
+}
+
+TEST_F(BatteryManagerTest, ReinitializeForgetsWrittenData) {
+	vector<uint8_t> sram(1024, 0x33);
+	_manager.SaveBattery(".sav", sram);
+	std::filesystem::remove(_folder + "/Game.sav");
+
+	// Same content, but a different game session: the flush writes it
+	_manager.Initialize("Game");
+	_manager.BeginFlush();
+	_manager.SaveBattery(".sav", sram);
+	_manager.EndFlush();
+	_manager.WaitForPendingWrites();
+	EXPECT_EQ(ReadSave(), sram);
+}
+
+TEST_F(BatteryManagerTest, WriteFileAtomicFailsForMissingFolder) {
+	vector<uint8_t> data(16, 0);
+	EXPECT_FALSE(BatteryManager::WriteFileAtomic(_folder + "/missing/Game.sav", data));
+}
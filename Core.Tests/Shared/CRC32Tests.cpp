@@ -106,3 +106,32 @@ TEST_F(CRC32Test, GetCRC_OrderMatters) {
 	std::vector<uint8_t> data2 = {0x34, 0x12};
 	EXPECT_NE(CRC32::GetCRC(data1), CRC32::GetCRC(data2));
 }
+
+// ===== Hardware Acceleration Tests =====
+
+TEST_F(CRC32Test, GetCRC_KnownVector_LargeBuffer) {
+	// "123456789" repeated: long enough for the accelerated path
+	std::string text;
+	for (int i = 0; i < 100; i++) {
+		text += "123456789";
+	}
+	const uint8_t* data = reinterpret_cast<const uint8_t*>(text.data());
+	EXPECT_EQ(CRC32::GetCRC(data, (std::streamoff)text.size()), CRC32::GetCRCPortable(data, text.size()));
+	EXPECT_EQ(CRC32::GetCRC(data, 9), 0xCBF43926u);
+}
+
+TEST_F(CRC32Test, GetCRC_MatchesPortable_AllLengthsAndAlignments) {
+	std::vector<uint8_t> data(1024 + 16);
+	uint32_t seed = 0x12345678;
+	for (uint8_t& value : data) {
+		seed = seed * 1103515245 + 12345;
+		value = (uint8_t)(seed >> 16);
+	}
+
+	for (size_t offset = 0; offset < 16; offset += 3) {
+		for (size_t length = 0; length <= 1024; length++) {
+			ASSERT_EQ(CRC32::GetCRC(data.data() + offset, (std::streamoff)length), CRC32::GetCRCPortable(data.data() + offset, length))
+			    << "offset " << offset << ", length " << length;
+		}
+	}
+}
@@ -0,0 +1,153 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include "Shared/CdReader.h"
+#include "Shared/CdSectorCache.h"
+
+// =============================================================================
+// CdSectorCache Unit Tests
+// =============================================================================
+// Tests for the CD sector cache: sector layout, pregaps, and read-ahead (forward, backward and seek prefetch).
+
+namespace {
+	class CdSectorCacheTest : public ::testing::Test {
+	protected:
+		static constexpr uint32_t AudioSectors = 200;
+		static constexpr uint32_t DataSectors = 100;
+		static constexpr uint32_t DataFirstSector = AudioSectors + 10; // 10 sector pregap
+
+		string _audioFile;
+		string _dataFile;
+		DiscInfo _disc = {};
+
+		static uint8_t GetByte(uint32_t file, uint32_t offset) {
+			return (uint8_t)(offset * 13 + (offset >> 9) + file * 101);
+		}
+
+		static string WriteFile(const char* name, uint32_t fileIndex, uint32_t size) {
+			string filename = (std::filesystem::temp_directory_path() / name).string();
+			vector<uint8_t> content(size);
+			for (uint32_t i = 0; i < size; i++) {
+				content[i] = GetByte(fileIndex, i);
+			}
+			std::ofstream out(filename, std::ios::binary);
+			out.write((char*)content.data(), content.size());
+			return filename;
+		}
+
+		void SetUp() override {
+			_audioFile = WriteFile("nexen_cd_cache_audio.bin", 0, AudioSectors * 2352);
+			_dataFile = WriteFile("nexen_cd_cache_data.bin", 1, DataSectors * 2048);
+
+			_disc.Files.push_back(_audioFile);
+			_disc.Files.push_back(_dataFile);
+
+			TrackInfo audio = {};
+			audio.Format = TrackFormat::Audio;
+			audio.FileIndex = 0;
+			audio.FirstSector = 0;
+			audio.LastSector = AudioSectors - 1;
+			_disc.Tracks.push_back(audio);
+
+			TrackInfo data = {};
+			data.Format = TrackFormat::Mode1_2048;
+			data.FileIndex = 1;
+			data.FirstSector = DataFirstSector;
+			data.LastSector = DataFirstSector + DataSectors - 1;
+			_disc.Tracks.push_back(data);
+
+			_disc.DiscSectorCount = data.LastSector + 1;
+		}
+
+		void TearDown() override {
+			_disc = {};
+			std::filesystem::remove(_audioFile);
+			std::filesystem::remove(_dataFile);
+		}
+
+		static bool WaitForCache(CdSectorCache& cache, uint32_t sector) {
+			for (int i = 0; i < 500 && !cache.IsCached(sector); i++) {
+				std::this_thread::sleep_for(std::chrono::milliseconds(2));
+			}
+			return cache.IsCached(sector);
+		}
+	};
+}
+
+TEST_F(CdSectorCacheTest, SectorsMatchFileContent) {
+	CdSectorCache cache(_disc);
+
+	for (uint32_t sector : {0u, 31u, 32u, 199u}) {
+		const uint8_t* data = cache.GetSector(sector);
+		ASSERT_NE(data, nullptr);
+		for (uint32_t i = 0; i < 2352; i++) {
+			ASSERT_EQ(data[i], GetByte(0, sector * 2352 + i));
+		}
+	}
+
+	for (uint32_t sector : {DataFirstSector, DataFirstSector + 50}) {
+		const uint8_t* data = cache.GetSector(sector);
+		ASSERT_NE(data, nullptr);
+		uint32_t fileOffset = (sector - DataFirstSector) * 2048;
+		for (uint32_t i = 0; i < 2048; i++) {
+			ASSERT_EQ(data[i], GetByte(1, fileOffset + i));
+		}
+	}
+}
+
+TEST_F(CdSectorCacheTest, PregapIsNotReadable) {
+	CdSectorCache cache(_disc);
+	EXPECT_EQ(cache.GetSector(AudioSectors), nullptr);
+	EXPECT_EQ(cache.GetSector(DataFirstSector - 1), nullptr);
+	EXPECT_NE(cache.GetSector(DataFirstSector), nullptr);
+}
+
+TEST_F(CdSectorCacheTest, DiscReadsUseCache) {
+	_disc.SectorCache = std::make_shared<CdSectorCache>(_disc);
+
+	vector<uint8_t> data;
+	_disc.ReadDataSector(DataFirstSector + 1, data);
+	ASSERT_EQ(data.size(), 2048u);
+	EXPECT_EQ(data[0], GetByte(1, 2048));
+
+	int16_t left = _disc.ReadLeftSample(3, 10);
+	EXPECT_EQ(left, (int16_t)(GetByte(0, 3 * 2352 + 40) | (GetByte(0, 3 * 2352 + 41) << 8)));
+	EXPECT_EQ(_disc.ReadLeftSample(AudioSectors + 1, 0), 0);
+}
+
+TEST_F(CdSectorCacheTest, SequentialReadsAreReadAhead) {
+	CdSectorCache cache(_disc);
+	ASSERT_NE(cache.GetSector(0), nullptr);
+	EXPECT_EQ(cache.GetMissCount(), 1u);
+
+	// The next blocks are loaded in the background
+	ASSERT_TRUE(WaitForCache(cache, CdSectorCache::SectorsPerBlock * CdSectorCache::ReadAheadBlocks));
+	for (uint32_t sector = 0; sector < CdSectorCache::SectorsPerBlock * 3; sector++) {
+		ASSERT_NE(cache.GetSector(sector), nullptr);
+	}
+	EXPECT_EQ(cache.GetMissCount(), 1u);
+}
+
+TEST_F(CdSectorCacheTest, BackwardReadsAreReadAhead) {
+	CdSectorCache cache(_disc);
+	uint32_t lastBlock = (AudioSectors - 1) / CdSectorCache::SectorsPerBlock;
+
+	// Moving back by one block sets the read direction
+	cache.GetSector(AudioSectors - 1);
+	cache.GetSector((lastBlock - 1) * CdSectorCache::SectorsPerBlock);
+	uint32_t misses = cache.GetMissCount();
+
+	ASSERT_TRUE(WaitForCache(cache, (lastBlock - 2) * CdSectorCache::SectorsPerBlock));
+	ASSERT_NE(cache.GetSector((lastBlock - 2) * CdSectorCache::SectorsPerBlock + 5), nullptr);
+	EXPECT_EQ(cache.GetMissCount(), misses);
+}
+
+TEST_F(CdSectorCacheTest, PrefetchLoadsSeekTarget) {
+	CdSectorCache cache(_disc);
+	cache.Prefetch(DataFirstSector + 40);
+	ASSERT_TRUE(WaitForCache(cache, DataFirstSector + 40));
+	ASSERT_NE(cache.GetSector(DataFirstSector + 40), nullptr);
+	EXPECT_EQ(cache.GetMissCount(), 0u);
+}
@@ -0,0 +1,171 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include "Shared/CdReader.h"
+#include "Shared/CompressedDiscImage.h"
+#include "Utilities/VirtualFile.h"
+
+// =============================================================================
+// CompressedDiscImage Unit Tests
+// =============================================================================
+// Tests for the hunk-compressed disc images (.ncd): round trip from CUE/BIN, random access and corruption checks.
+
+namespace {
+	class CompressedDiscImageTest : public ::testing::Test {
+	protected:
+		std::filesystem::path _folder;
+		string _cuePath;
+		string _imagePath;
+		vector<uint8_t> _audio;
+		vector<uint8_t> _data;
+		vector<uint8_t> _subcode;
+
+		static void Write(const std::filesystem::path& path, const void* data, size_t size) {
+			std::ofstream out(path, std::ios::binary);
+			out.write((const char*)data, size);
+		}
+
+		void SetUp() override {
+			_folder = std::filesystem::temp_directory_path() / "nexen_ncd_test";
+			std::filesystem::create_directories(_folder);
+
+			// Data track (compresses well), followed by an audio track (sine wave, compresses better as deltas)
+			_data.resize(40 * 2048);
+			for (size_t i = 0; i < _data.size(); i++) {
+				_data[i] = (uint8_t)((i / 512) ^ (i % 7));
+			}
+			_audio.resize(150 * 2352);
+			for (size_t i = 0; i < _audio.size() / 4; i++) {
+				int16_t sample = (int16_t)(std::sin(i * 0.01) * 12000);
+				memcpy(&_audio[i * 4], &sample, 2);
+				memcpy(&_audio[i * 4 + 2], &sample, 2);
+			}
+			_subcode.resize(190 * 96);
+			for (size_t i = 0; i < _subcode.size(); i++) {
+				_subcode[i] = (uint8_t)(i * 3);
+			}
+
+			Write(_folder / "data.iso", _data.data(), _data.size());
+			Write(_folder / "audio.bin", _audio.data(), _audio.size());
+			Write(_folder / "disc.sub", _subcode.data(), _subcode.size());
+
+			string cue =
+			    "FILE \"data.iso\" BINARY\n"
+			    "  TRACK 01 MODE1/2048\n"
+			    "    INDEX 01 00:00:00\n"
+			    "FILE \"audio.bin\" BINARY\n"
+			    "  TRACK 02 AUDIO\n"
+			    "    INDEX 01 00:00:00\n";
+			Write(_folder / "disc.cue", cue.data(), cue.size());
+
+			_cuePath = (_folder / "disc.cue").string();
+			_imagePath = (_folder / "disc.ncd").string();
+		}
+
+		void TearDown() override {
+			std::filesystem::remove_all(_folder);
+		}
+
+		bool CreateImage() {
+			VirtualFile cue = _cuePath;
+			return CompressedDiscImage::Create(cue, _imagePath);
+		}
+	};
+}
+
+TEST_F(CompressedDiscImageTest, LoadsSameDiscAsCue) {
+	ASSERT_TRUE(CreateImage());
+
+	VirtualFile cue = _cuePath;
+	DiscInfo original = {};
+	ASSERT_TRUE(CdReader::LoadCue(cue, original));
+
+	VirtualFile image = _imagePath;
+	DiscInfo compressed = {};
+	ASSERT_TRUE(CdReader::LoadCompressedDisc(image, compressed));
+
+	ASSERT_EQ(compressed.Tracks.size(), original.Tracks.size());
+	for (size_t i = 0; i < original.Tracks.size(); i++) {
+		EXPECT_EQ(compressed.Tracks[i].FirstSector, original.Tracks[i].FirstSector);
+		EXPECT_EQ(compressed.Tracks[i].LastSector, original.Tracks[i].LastSector);
+		EXPECT_EQ(compressed.Tracks[i].Format, original.Tracks[i].Format);
+	}
+	EXPECT_EQ(compressed.DiscSectorCount, original.DiscSectorCount);
+	EXPECT_EQ(compressed.SubCode, original.SubCode);
+	EXPECT_EQ(compressed.DecodedSubCode, _subcode);
+
+	// Random access, in both directions
+	for (uint32_t sector : {39u, 0u, 17u, 38u}) {
+		vector<uint8_t> expected;
+		vector<uint8_t> actual;
+		original.ReadDataSector(sector, expected);
+		compressed.ReadDataSector(sector, actual);
+		ASSERT_EQ(actual.size(), 2048u);
+		EXPECT_EQ(actual, expected);
+		EXPECT_TRUE(std::equal(actual.begin(), actual.end(), _data.begin() + sector * 2048));
+	}
+
+	uint32_t audioStart = compressed.Tracks[1].FirstSector;
+	for (uint32_t sector : {audioStart + 149, audioStart, audioStart + 75}) {
+		for (uint32_t sample : {0u, 300u, 587u}) {
+			EXPECT_EQ(compressed.ReadLeftSample(sector, sample), original.ReadLeftSample(sector, sample));
+			EXPECT_EQ(compressed.ReadRightSample(sector, sample), original.ReadRightSample(sector, sample));
+		}
+	}
+}
+
+TEST_F(CompressedDiscImageTest, ImageIsSmallerThanSource) {
+	ASSERT_TRUE(CreateImage());
+	size_t sourceSize = _data.size() + _audio.size() + _subcode.size();
+	EXPECT_LT(std::filesystem::file_size(_imagePath), sourceSize / 2);
+}
+
+TEST_F(CompressedDiscImageTest, ReadsAcrossHunks) {
+	ASSERT_TRUE(CreateImage());
+	CompressedDiscImage image;
+	ASSERT_TRUE(image.Open(_imagePath));
+	EXPECT_EQ(image.GetTrackFileCount(), 2u);
+	ASSERT_TRUE(image.HasSubcode());
+
+	vector<uint8_t> buffer(CompressedDiscImage::HunkSize + 1000);
+	uint64_t offset = CompressedDiscImage::HunkSize - 500;
+	ASSERT_EQ(image.Read(1, offset, buffer.data(), (uint32_t)buffer.size()), buffer.size());
+	EXPECT_TRUE(std::equal(buffer.begin(), buffer.end(), _audio.begin() + offset));
+
+	// Reads are truncated at the end of the file
+	EXPECT_EQ(image.Read(1, _audio.size() - 10, buffer.data(), 100), 10u);
+	EXPECT_EQ(image.Read(1, _audio.size(), buffer.data(), 100), 0u);
+}
+
+TEST_F(CompressedDiscImageTest, CorruptedHunkIsNotReturned) {
+	ASSERT_TRUE(CreateImage());
+	{
+		CompressedDiscImage image;
+		ASSERT_TRUE(image.Open(_imagePath));
+	}
+
+	// Flip bytes in the middle of the first hunk's data (right after the header, CUE sheet and file table)
+	std::fstream file(_imagePath, std::ios::in | std::ios::out | std::ios::binary);
+	CompressedDiscImage::Header header = {};
+	file.read((char*)&header, sizeof(header));
+	vector<CompressedDiscImage::HunkEntry> hunks(header.HunkCount);
+	file.seekg(header.IndexOffset);
+	file.read((char*)hunks.data(), hunks.size() * sizeof(CompressedDiscImage::HunkEntry));
+	file.seekp(hunks[0].Offset + hunks[0].CompressedSize / 2);
+	uint32_t garbage = 0xDEADBEEF;
+	file.write((char*)&garbage, sizeof(garbage));
+	file.close();
+
+	CompressedDiscImage image;
+	ASSERT_TRUE(image.Open(_imagePath));
+	uint8_t buffer[16];
+	EXPECT_EQ(image.Read(0, 0, buffer, sizeof(buffer)), 0u);
+	EXPECT_EQ(image.Read(0, CompressedDiscImage::HunkSize, buffer, sizeof(buffer)), sizeof(buffer));
+}
+
+TEST_F(CompressedDiscImageTest, InvalidFileIsRejected) {
+	CompressedDiscImage image;
+	EXPECT_FALSE(image.Open(_cuePath));
+	EXPECT_FALSE(image.Open((_folder / "missing.ncd").string()));
+}
@@ -0,0 +1,77 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <thread>
+#include "Shared/EmuSettings.h"
+
+// =============================================================================
+// ConfigSnapshot Unit Tests
+// =============================================================================
+// Tests for the versioned config snapshots used by the emulation code (EmuSettings::UpdateSnapshot).
+
+TEST(ConfigSnapshotTest, FirstUpdateCopiesConfig) {
+	EmuSettings settings(nullptr);
+	NesConfig cfg = {};
+	cfg.InputScanline = 123;
+	settings.SetNesConfig(cfg);
+
+	ConfigSnapshot<NesConfig> snapshot;
+	EXPECT_EQ(snapshot.GetVersion(), 0u);
+	EXPECT_TRUE(settings.UpdateSnapshot(snapshot));
+	EXPECT_EQ(snapshot->InputScanline, 123);
+	EXPECT_EQ(snapshot.GetVersion(), settings.GetConfigVersion(SettingsCategory::Nes));
+
+	// Nothing to do until the config changes
+	EXPECT_FALSE(settings.UpdateSnapshot(snapshot));
+}
+
+TEST(ConfigSnapshotTest, ChangesAreOnlyVisibleAfterUpdate) {
+	EmuSettings settings(nullptr);
+	ConfigSnapshot<NesConfig> snapshot;
+	settings.UpdateSnapshot(snapshot);
+
+	uint32_t version = settings.GetConfigVersion(SettingsCategory::Nes);
+	NesConfig cfg = {};
+	cfg.EnableOamDecay = !snapshot->EnableOamDecay;
+	settings.SetNesConfig(cfg);
+	EXPECT_GT(settings.GetConfigVersion(SettingsCategory::Nes), version);
+	EXPECT_NE(snapshot->EnableOamDecay, cfg.EnableOamDecay);
+
+	EXPECT_TRUE(settings.UpdateSnapshot(snapshot));
+	EXPECT_EQ(snapshot->EnableOamDecay, cfg.EnableOamDecay);
+}
+
+TEST(ConfigSnapshotTest, CategoriesAreVersionedSeparately) {
+	EmuSettings settings(nullptr);
+	ConfigSnapshot<NesConfig> nesSnapshot;
+	ConfigSnapshot<VideoConfig> videoSnapshot;
+	settings.UpdateSnapshot(nesSnapshot);
+	settings.UpdateSnapshot(videoSnapshot);
+
+	VideoConfig video = {};
+	settings.SetVideoConfig(video);
+	EXPECT_FALSE(settings.UpdateSnapshot(nesSnapshot));
+	EXPECT_TRUE(settings.UpdateSnapshot(videoSnapshot));
+}
+
+TEST(ConfigSnapshotTest, SnapshotIsNeverTorn) {
+	EmuSettings settings(nullptr);
+	atomic<bool> stop = false;
+
+	std::thread writer([&]() {
+		NesConfig cfg = {};
+		for (uint32_t i = 0; !stop; i++) {
+			// Both fields always hold the same value in every config written
+			cfg.InputScanline = (int32_t)i;
+			cfg.LightDetectionRadius = i;
+			settings.SetNesConfig(cfg);
+		}
+	});
+
+	ConfigSnapshot<NesConfig> snapshot;
+	for (int i = 0; i < 20000; i++) {
+		settings.UpdateSnapshot(snapshot);
+		ASSERT_EQ((uint32_t)snapshot->InputScanline, snapshot->LightDetectionRadius);
+	}
+	stop = true;
+	writer.join();
+}
@@ -0,0 +1,103 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <vector>
+#include "Shared/Video/DebugHud.h"
+#include "Shared/Video/DrawPixelBatchCommand.h"
+#include "Shared/Video/DrawRectangleBatchCommand.h"
+
+// =============================================================================
+// DebugHud Unit Tests
+// =============================================================================
+// Tests for retained drawing of the script HUD surface.
+
+namespace {
+	constexpr FrameInfo HudSize = {64, 48};
+
+	void QueueOverlay(DebugHud& hud, int color) {
+		hud.DrawRectangle(2, 2, 10, 6, color, true, 1);
+		hud.DrawLine(0, 40, 63, 40, 0x00FF00, 1);
+		hud.DrawString(4, 20, "HUD", 0xFFFFFF, 0x000000, 1);
+	}
+}
+
+TEST(DebugHudTest, DrawRetained_SkipsUnchangedCommandList) {
+	DebugHud hud;
+	vector<uint32_t> surface(HudSize.Width * HudSize.Height, 0);
+
+	QueueOverlay(hud, 0xFF0000);
+	EXPECT_TRUE(hud.DrawRetained(surface.data(), HudSize, {}, 1, {}));
+	vector<uint32_t> firstFrame = surface;
+	EXPECT_FALSE(hud.HasCommands());
+
+	// Script re-queues the same one-frame commands on the next frame
+	QueueOverlay(hud, 0xFF0000);
+	EXPECT_FALSE(hud.DrawRetained(surface.data(), HudSize, {}, 2, {}));
+	EXPECT_EQ(surface, firstFrame);
+	EXPECT_FALSE(hud.HasCommands());
+}
+
+TEST(DebugHudTest, DrawRetained_RedrawsChangedCommands) {
+	DebugHud hud;
+	vector<uint32_t> surface(HudSize.Width * HudSize.Height, 0);
+
+	QueueOverlay(hud, 0xFF0000);
+	ASSERT_TRUE(hud.DrawRetained(surface.data(), HudSize, {}, 1, {}));
+	uint32_t before = surface[4 * HudSize.Width + 4];
+
+	QueueOverlay(hud, 0x0000FF);
+	EXPECT_TRUE(hud.DrawRetained(surface.data(), HudSize, {}, 2, {}));
+	EXPECT_NE(surface[4 * HudSize.Width + 4], before);
+	EXPECT_EQ(surface[4 * HudSize.Width + 4], 0xFF0000FF);
+}
+
+TEST(DebugHudTest, DrawRetained_ClearsWhenCommandsStop) {
+	DebugHud hud;
+	vector<uint32_t> surface(HudSize.Width * HudSize.Height, 0);
+
+	QueueOverlay(hud, 0xFF0000);
+	ASSERT_TRUE(hud.DrawRetained(surface.data(), HudSize, {}, 1, {}));
+
+	EXPECT_TRUE(hud.DrawRetained(surface.data(), HudSize, {}, 2, {}));
+	EXPECT_EQ(surface, vector<uint32_t>(surface.size(), 0));
+}
+
+TEST(DebugHudTest, DrawRetained_DelayedCommandChangesSignature) {
+	DebugHud hud;
+	vector<uint32_t> surface(HudSize.Width * HudSize.Height, 0);
+
+	// Starts on frame 3, persists for 2 frames
+	hud.DrawPixel(5, 5, 0xFFFFFF, 2, 3);
+	EXPECT_TRUE(hud.DrawRetained(surface.data(), HudSize, {}, 2, {}));
+	EXPECT_EQ(surface[5 * HudSize.Width + 5], 0u);
+
+	EXPECT_TRUE(hud.DrawRetained(surface.data(), HudSize, {}, 3, {}));
+	EXPECT_EQ(surface[5 * HudSize.Width + 5], 0xFFFFFFFF);
+
+	EXPECT_FALSE(hud.DrawRetained(surface.data(), HudSize, {}, 4, {}));
+	EXPECT_FALSE(hud.HasCommands());
+}
+
+TEST(DebugHudTest, BatchCommandsMatchIndividualCommands) {
+	DebugHud singleHud;
+	DebugHud batchHud;
+	vector<uint32_t> singleSurface(HudSize.Width * HudSize.Height, 0);
+	vector<uint32_t> batchSurface(HudSize.Width * HudSize.Height, 0);
+
+	unique_ptr<DrawRectangleBatchCommand> rects(new DrawRectangleBatchCommand(false, 1, -1, 3));
+	unique_ptr<DrawPixelBatchCommand> pixels(new DrawPixelBatchCommand(1, -1, 20));
+	for (int i = 0; i < 3; i++) {
+		singleHud.DrawRectangle(i * 12, 5, i == 1 ? -8 : 8, 6, 0x40FF0000 + i, false, 1);
+		rects->AddRectangle(i * 12, 5, i == 1 ? -8 : 8, 6, 0x40FF0000 + i);
+	}
+	for (int i = 0; i < 20; i++) {
+		singleHud.DrawPixel(i * 3, 30 + (i % 4), 0x00FF00 | i, 1);
+		pixels->AddPixel(i * 3, 30 + (i % 4), 0x00FF00 | i);
+	}
+	batchHud.AddCommand(std::move(rects));
+	batchHud.AddCommand(std::move(pixels));
+
+	EXPECT_TRUE(singleHud.DrawRetained(singleSurface.data(), HudSize, {}, 1, {}));
+	EXPECT_TRUE(batchHud.DrawRetained(batchSurface.data(), HudSize, {}, 1, {}));
+	EXPECT_EQ(batchSurface, singleSurface);
+	EXPECT_NE(batchSurface, vector<uint32_t>(batchSurface.size(), 0));
+}
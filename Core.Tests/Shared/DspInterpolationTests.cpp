@@ -0,0 +1,68 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "SNES/DSP/DspInterpolation.h"
+
+// =============================================================================
+// SNES DSP Interpolation Unit Tests
+// =============================================================================
+// The interpolation functions read a mirrored 24-entry sample buffer without
+// wrapping, these check the results still match the 12-sample ring buffer.
+
+namespace {
+	struct SampleRing {
+		int16_t Ring[12] = {};
+		int16_t Mirrored[24] = {};
+
+		SampleRing(uint32_t seed) {
+			for (int i = 0; i < 12; i++) {
+				seed = seed * 1103515245 + 12345;
+				Ring[i] = (int16_t)(seed >> 16) & ~0x01;
+				Mirrored[i] = Ring[i];
+				Mirrored[i + 12] = Ring[i];
+			}
+		}
+	};
+
+	int16_t ReferenceGauss(int32_t interpolationPos, int16_t* samples, uint8_t bufferPos) {
+		int16_t unwrapped[4];
+		uint8_t pos = (interpolationPos >> 12) + bufferPos;
+		for (int i = 0; i < 4; i++) {
+			unwrapped[i] = samples[(pos + i) % 12];
+		}
+		return DspInterpolation::Gauss(interpolationPos & 0xFFF, unwrapped, 0);
+	}
+
+	int16_t ReferenceSinc(int32_t interpolationPos, int16_t* samples, uint8_t bufferPos) {
+		int16_t unwrapped[8];
+		uint8_t pos = (interpolationPos >> 12) + bufferPos;
+		for (int i = 0; i < 8; i++) {
+			unwrapped[i] = samples[(pos + i) % 12];
+		}
+		return DspInterpolation::Sinc(interpolationPos & 0xFFF, unwrapped, 0);
+	}
+}
+
+TEST(DspInterpolationTest, MirroredBufferMatchesRing) {
+	for (uint32_t seed = 1; seed <= 4; seed++) {
+		SampleRing samples(seed);
+		for (uint8_t bufferPos : {0, 4, 8}) {
+			for (int32_t interpolationPos = 0; interpolationPos <= 0x7FFF; interpolationPos += 7) {
+				ASSERT_EQ(DspInterpolation::Gauss(interpolationPos, samples.Mirrored, bufferPos), ReferenceGauss(interpolationPos, samples.Ring, bufferPos))
+				    << "pos " << interpolationPos << " buffer " << (int)bufferPos;
+				ASSERT_EQ(DspInterpolation::Sinc(interpolationPos, samples.Mirrored, bufferPos), ReferenceSinc(interpolationPos, samples.Ring, bufferPos))
+				    << "pos " << interpolationPos << " buffer " << (int)bufferPos;
+			}
+		}
+	}
+}
+
+TEST(DspInterpolationTest, GaussOfConstantSignalIsConstant) {
+	// The 4 taps of every phase sum to ~2048 (unity gain)
+	int16_t samples[24] = {};
+	for (int i = 0; i < 24; i++) {
+		samples[i] = 0x2000;
+	}
+	for (int32_t interpolationPos = 0; interpolationPos < 0x1000; interpolationPos += 0x10) {
+		EXPECT_NEAR(DspInterpolation::Gauss(interpolationPos, samples, 0), 0x2000, 0x20) << interpolationPos;
+	}
+}
@@ -0,0 +1,133 @@
+#include "pch.h"
+#include "Shared/EventScheduler.h"
+
+// ===== EventScheduler Tests =====
+// Verify clock ordering, the cached next event clock, cancellation and serialization
+
+namespace {
+	enum class TestEvent : uint8_t {
+		A,
+		B,
+		C
+	};
+
+	using Dispatched = vector<std::pair<TestEvent, uint64_t>>;
+
+	Dispatched Process(EventScheduler<TestEvent>& scheduler, uint64_t clock) {
+		Dispatched events;
+		scheduler.ProcessEvents(clock, [&](TestEvent evt, uint64_t evtClock) { events.push_back({evt, evtClock}); });
+		return events;
+	}
+}
+
+TEST(EventSchedulerTest, EmptySchedulerHasNoDueEvents) {
+	EventScheduler<TestEvent> scheduler;
+	EXPECT_FALSE(scheduler.HasEvents());
+	EXPECT_EQ(scheduler.GetNextEventClock(), UINT64_MAX);
+	EXPECT_FALSE(scheduler.IsEventDue(UINT64_MAX - 1));
+	EXPECT_TRUE(Process(scheduler, 1000).empty());
+}
+
+TEST(EventSchedulerTest, DispatchesInClockOrder) {
+	EventScheduler<TestEvent> scheduler;
+	scheduler.Schedule(30, TestEvent::C);
+	scheduler.Schedule(10, TestEvent::A);
+	scheduler.Schedule(20, TestEvent::B);
+	EXPECT_EQ(scheduler.GetNextEventClock(), 10u);
+
+	EXPECT_FALSE(scheduler.IsEventDue(9));
+	EXPECT_TRUE(Process(scheduler, 9).empty());
+
+	EXPECT_TRUE(scheduler.IsEventDue(10));
+	Dispatched events = Process(scheduler, 25);
+	ASSERT_EQ(events.size(), 2u);
+	EXPECT_EQ(events[0], std::make_pair(TestEvent::A, (uint64_t)10));
+	EXPECT_EQ(events[1], std::make_pair(TestEvent::B, (uint64_t)20));
+	EXPECT_EQ(scheduler.GetNextEventClock(), 30u);
+
+	events = Process(scheduler, 30);
+	ASSERT_EQ(events.size(), 1u);
+	EXPECT_EQ(events[0].first, TestEvent::C);
+	EXPECT_FALSE(scheduler.HasEvents());
+}
+
+TEST(EventSchedulerTest, SameEventCanBeScheduledTwice) {
+	EventScheduler<TestEvent> scheduler;
+	scheduler.Schedule(5, TestEvent::A);
+	scheduler.Schedule(7, TestEvent::A);
+	EXPECT_EQ(Process(scheduler, 5).size(), 1u);
+	EXPECT_EQ(Process(scheduler, 7).size(), 1u);
+}
+
+TEST(EventSchedulerTest, HandlerCanScheduleEvents) {
+	EventScheduler<TestEvent> scheduler;
+	scheduler.Schedule(10, TestEvent::A);
+
+	// Events scheduled by the handler before the current clock are dispatched by the same call
+	Dispatched events;
+	scheduler.ProcessEvents(20, [&](TestEvent evt, uint64_t clock) {
+		events.push_back({evt, clock});
+		if (evt == TestEvent::A) {
+			scheduler.Schedule(clock + 5, TestEvent::B);
+			scheduler.Schedule(clock + 50, TestEvent::C);
+		}
+	});
+	ASSERT_EQ(events.size(), 2u);
+	EXPECT_EQ(events[1], std::make_pair(TestEvent::B, (uint64_t)15));
+	EXPECT_EQ(scheduler.GetNextEventClock(), 60u);
+}
+
+TEST(EventSchedulerTest, CancelRemovesAllOccurrences) {
+	EventScheduler<TestEvent> scheduler;
+	scheduler.Schedule(10, TestEvent::A);
+	scheduler.Schedule(20, TestEvent::B);
+	scheduler.Schedule(30, TestEvent::A);
+
+	scheduler.Cancel(TestEvent::A);
+	EXPECT_EQ(scheduler.GetNextEventClock(), 20u);
+	Dispatched events = Process(scheduler, 100);
+	ASSERT_EQ(events.size(), 1u);
+	EXPECT_EQ(events[0].first, TestEvent::B);
+
+	scheduler.Schedule(10, TestEvent::C);
+	scheduler.Clear();
+	EXPECT_FALSE(scheduler.HasEvents());
+	EXPECT_EQ(scheduler.GetNextEventClock(), UINT64_MAX);
+}
+
+TEST(EventSchedulerTest, DelayEventsShiftsEverything) {
+	EventScheduler<TestEvent> scheduler;
+	scheduler.Schedule(10, TestEvent::A);
+	scheduler.Schedule(12, TestEvent::B);
+	scheduler.DelayEvents(5);
+	EXPECT_EQ(scheduler.GetNextEventClock(), 15u);
+	EXPECT_TRUE(Process(scheduler, 14).empty());
+	Dispatched events = Process(scheduler, 17);
+	ASSERT_EQ(events.size(), 2u);
+	EXPECT_EQ(events[1], std::make_pair(TestEvent::B, (uint64_t)17));
+}
+
+TEST(EventSchedulerTest, SerializationRoundTrip) {
+	EventScheduler<TestEvent> scheduler;
+	scheduler.Schedule(300, TestEvent::C);
+	scheduler.Schedule(100, TestEvent::A);
+	scheduler.Schedule(200, TestEvent::B);
+
+	Serializer saver(1, true, SerializeFormat::Binary);
+	saver.Stream(scheduler, "scheduler");
+	std::stringstream ss;
+	saver.SaveTo(ss);
+
+	EventScheduler<TestEvent> loaded;
+	ss.seekg(0);
+	Serializer loader(1, false, SerializeFormat::Binary);
+	loader.LoadFrom(ss);
+	loader.Stream(loaded, "scheduler");
+
+	EXPECT_EQ(loaded.GetNextEventClock(), 100u);
+	Dispatched events = Process(loaded, 1000);
+	ASSERT_EQ(events.size(), 3u);
+	EXPECT_EQ(events[0].first, TestEvent::A);
+	EXPECT_EQ(events[1].first, TestEvent::B);
+	EXPECT_EQ(events[2].first, TestEvent::C);
+}
@@ -0,0 +1,39 @@
+#include "pch.h"
+#include "Utilities/FastHash.h"
+
+// Test fixture for FastHash
+class FastHashTest : public ::testing::Test {};
+
+// ===== Reference XXH64 Test Vectors (seed 0) =====
+
+TEST_F(FastHashTest, Hash_Empty) {
+	EXPECT_EQ(FastHash::Hash("", 0), 0xEF46DB3751D8E999ull);
+}
+
+TEST_F(FastHashTest, Hash_ShortString) {
+	EXPECT_EQ(FastHash::Hash("a", 1), 0xD24EC4F1A98C6E5Bull);
+	EXPECT_EQ(FastHash::Hash("abc", 3), 0x44BC2CF5AD770999ull);
+}
+
+TEST_F(FastHashTest, Hash_LongBufferIsDeterministic) {
+	// Covers the 32-byte lane loop plus every tail path (8, 4 and 1 byte)
+	std::vector<uint8_t> data(32 * 10 + 8 + 4 + 3);
+	for (size_t i = 0; i < data.size(); i++) {
+		data[i] = (uint8_t)(i * 31 + 7);
+	}
+	uint64_t h1 = FastHash::Hash(data.data(), data.size());
+	uint64_t h2 = FastHash::Hash(data.data(), data.size());
+	EXPECT_EQ(h1, h2);
+}
+
+TEST_F(FastHashTest, Hash_SingleBitChangeChangesHash) {
+	std::vector<uint8_t> data(256 * 240 * 2, 0);
+	uint64_t before = FastHash::Hash(data.data(), data.size());
+	data[12345] ^= 0x01;
+	EXPECT_NE(FastHash::Hash(data.data(), data.size()), before);
+}
+
+TEST_F(FastHashTest, Hash_SeedChangesHash) {
+	std::string data = "123456789";
+	EXPECT_NE(FastHash::Hash(data.data(), data.size(), 0), FastHash::Hash(data.data(), data.size(), 1));
+}
@@ -0,0 +1,62 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "Shared/FrameLimiter.h"
+
+// =============================================================================
+// FrameLimiter Unit Tests
+// =============================================================================
+// Tests for the hybrid sleep/spin wait and the frame pacing statistics.
+// Timing tolerances are loose so the tests stay reliable on loaded machines.
+
+namespace {
+	void RunFrames(FrameLimiter& limiter, int count) {
+		for (int i = 0; i < count; i++) {
+			limiter.ProcessFrame();
+			while (limiter.WaitForNextFrame()) {
+			}
+		}
+	}
+}
+
+TEST(FrameLimiterTest, NoStatsBeforeFirstFrames) {
+	FrameLimiter limiter(5);
+	FramePacingStats stats = limiter.GetStats();
+	EXPECT_EQ(stats.FrameCount, 0u);
+	EXPECT_EQ(stats.AverageFrameTime, 0.0);
+}
+
+TEST(FrameLimiterTest, PacesFramesAtTargetDelay) {
+	FrameLimiter limiter(5);
+	Timer timer;
+	RunFrames(limiter, 21);
+	double elapsed = timer.GetElapsedMS();
+
+	// At least 21 frames of 5ms
+	EXPECT_GE(elapsed, 21 * 5 - 1);
+	EXPECT_LT(elapsed, 21 * 5 + 50);
+
+	FramePacingStats stats = limiter.GetStats();
+	EXPECT_EQ(stats.FrameCount, 20u);
+	EXPECT_NEAR(stats.AverageFrameTime, 5.0, 1.0);
+	EXPECT_GE(stats.MaxFrameTime, stats.MinFrameTime);
+	EXPECT_GE(stats.StdDeviation, 0.0);
+	EXPECT_EQ(stats.TargetFrameTime, 5.0);
+	EXPECT_GE(stats.WakeupSlack, 0.05);
+	EXPECT_LE(stats.WakeupSlack, 4.0);
+}
+
+TEST(FrameLimiterTest, HistoryIsCapped) {
+	FrameLimiter limiter(0.5);
+	RunFrames(limiter, FrameLimiter::HistorySize + 20);
+	EXPECT_EQ(limiter.GetStats().FrameCount, FrameLimiter::HistorySize);
+}
+
+TEST(FrameLimiterTest, SleepNeverReturnsEarly) {
+	Timer timer;
+	Timer::Sleep(2.5);
+	EXPECT_GE(timer.GetElapsedMS(), 2.5);
+
+	// No-op for non-positive delays
+	Timer::Sleep(0);
+	Timer::Sleep(-1);
+}
@@ -0,0 +1,74 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <thread>
+#include "Shared/FrameProfiler.h"
+
+// =============================================================================
+// FrameProfiler Unit Tests
+// =============================================================================
+// Tests for the scoped timers (self time of nested stages) and the per-frame history.
+
+namespace {
+	void Sleep(int ms) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+	}
+}
+
+TEST(FrameProfilerTest, DisabledScopesAreNotCounted) {
+	FrameProfiler profiler;
+	{
+		ProfilerScope scope(&profiler, ProfilerStage::Emulation);
+		Sleep(1);
+	}
+	profiler.EndFrame(false);
+	EXPECT_FALSE(profiler.IsEnabled());
+	EXPECT_EQ(profiler.GetStats().FrameCount, 0u);
+
+	// Null profiler (e.g component not attached to an emulator)
+	ProfilerScope scope(nullptr, ProfilerStage::Ppu);
+}
+
+TEST(FrameProfilerTest, NestedStagesAreExcludedFromTheirParent) {
+	FrameProfiler profiler;
+
+	// Timestamp counter frequency is measured over at least 100ms
+	Sleep(110);
+	profiler.EndFrame(true);
+	ASSERT_TRUE(profiler.IsEnabled());
+
+	{
+		ProfilerScope outer(&profiler, ProfilerStage::Emulation);
+		Sleep(2);
+		{
+			ProfilerScope inner(&profiler, ProfilerStage::Apu);
+			Sleep(20);
+		}
+	}
+	profiler.EndFrame(true);
+
+	FrameProfilerStats stats = profiler.GetStats();
+	ASSERT_EQ(stats.FrameCount, 1u);
+	double apu = stats.Average[(int)ProfilerStage::Apu];
+	double emulation = stats.Average[(int)ProfilerStage::Emulation];
+	EXPECT_GE(apu, 15);
+	EXPECT_GE(emulation, 1);
+	EXPECT_LT(emulation, apu);
+	EXPECT_DOUBLE_EQ(stats.Max[(int)ProfilerStage::Apu], apu);
+	EXPECT_EQ(stats.Average[(int)ProfilerStage::Ppu], 0);
+}
+
+TEST(FrameProfilerTest, RequestedKeepsProfilerEnabled) {
+	FrameProfiler profiler;
+	profiler.SetRequested(true);
+	profiler.EndFrame(false);
+	EXPECT_TRUE(profiler.IsEnabled());
+
+	for (uint32_t i = 0; i < FrameProfiler::HistorySize + 10; i++) {
+		profiler.EndFrame(false);
+	}
+	EXPECT_EQ(profiler.GetStats().FrameCount, FrameProfiler::HistorySize);
+
+	profiler.SetRequested(false);
+	profiler.EndFrame(false);
+	EXPECT_FALSE(profiler.IsEnabled());
+}
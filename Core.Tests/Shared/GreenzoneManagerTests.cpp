@@ -0,0 +1,162 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <vector>
+#include "Shared/GreenzoneManager.h"
+#include "Utilities/Serializer.h"
+
+// =============================================================================
+// GreenzoneManager Unit Tests
+// =============================================================================
+// Tests for the TAS editor savestate cache (lookup, invalidation, memory tiers).
+
+namespace {
+	class MockGreenzoneConsole : public ISerializable {
+	public:
+		vector<uint8_t> workRam = vector<uint8_t>(0x10000, 0);
+		uint32_t frame = 0;
+
+		void Serialize(Serializer& s) override {
+			SVArray(workRam.data(), (uint32_t)workRam.size());
+			SV(frame);
+		}
+	};
+
+	unique_ptr<RunAheadState> SaveState(MockGreenzoneConsole& console, uint32_t frame) {
+		console.frame = frame;
+		for (size_t i = 0; i < console.workRam.size(); i += 0x100) {
+			console.workRam[i] = (uint8_t)(frame + i);
+		}
+
+		unique_ptr<RunAheadState> state = std::make_unique<RunAheadState>();
+		state->Data.ResetForFastSave(1);
+		state->Ram.BeginSave(state->Data, {SerializeValue(console.workRam.data(), (uint32_t)console.workRam.size())});
+		state->Data.Stream(console, "");
+		state->Ram.EndSave(state->Data);
+		return state;
+	}
+
+	GreenzoneOptions GetOptions(uint32_t interval, uint32_t recentCount, uint64_t budget) {
+		GreenzoneOptions options;
+		options.Enabled = true;
+		options.Interval = interval;
+		options.RecentCount = recentCount;
+		options.MemoryBudget = budget;
+		return options;
+	}
+}
+
+TEST(GreenzoneManagerTest, FindsClosestPreviousState) {
+	MockGreenzoneConsole console;
+	GreenzoneManager greenzone;
+	greenzone.SetOptions(GetOptions(10, 100, 1ull << 30));
+
+	EXPECT_TRUE(greenzone.NeedsState(0));
+	EXPECT_FALSE(greenzone.NeedsState(5));
+	greenzone.AddState(0, SaveState(console, 0));
+	greenzone.AddState(10, SaveState(console, 10));
+	greenzone.AddState(20, SaveState(console, 20));
+	EXPECT_FALSE(greenzone.NeedsState(10));
+
+	uint32_t stateFrame = 0;
+	EXPECT_NE(greenzone.FindState(15, stateFrame), nullptr);
+	EXPECT_EQ(stateFrame, 10u);
+	EXPECT_NE(greenzone.FindState(20, stateFrame), nullptr);
+	EXPECT_EQ(stateFrame, 20u);
+	EXPECT_NE(greenzone.FindState(1000, stateFrame), nullptr);
+	EXPECT_EQ(stateFrame, 20u);
+}
+
+TEST(GreenzoneManagerTest, InvalidateDropsStatesAfterEdit) {
+	MockGreenzoneConsole console;
+	GreenzoneManager greenzone;
+	greenzone.SetOptions(GetOptions(10, 100, 1ull << 30));
+	for (uint32_t frame = 0; frame <= 50; frame += 10) {
+		greenzone.AddState(frame, SaveState(console, frame));
+	}
+
+	// Changing the input of frame 20 doesn't affect the state at frame 20 (taken before it was polled)
+	greenzone.Invalidate(20);
+	GreenzoneInfo info = greenzone.GetInfo();
+	EXPECT_EQ(info.StateCount, 3u);
+	EXPECT_EQ(info.LastFrame, 20u);
+	EXPECT_TRUE(greenzone.NeedsState(30));
+
+	uint32_t stateFrame = 0;
+	greenzone.FindState(45, stateFrame);
+	EXPECT_EQ(stateFrame, 20u);
+}
+
+TEST(GreenzoneManagerTest, StatesAwayFromPlayheadAreCompressed) {
+	MockGreenzoneConsole console;
+	GreenzoneManager greenzone;
+	greenzone.SetOptions(GetOptions(1, 3, 1ull << 30));
+	for (uint32_t frame = 0; frame < 10; frame++) {
+		greenzone.SetPlayhead(frame);
+		greenzone.AddState(frame, SaveState(console, frame));
+	}
+
+	// Playhead at 9: 7, 8 and 9 stay uncompressed
+	GreenzoneInfo info = greenzone.GetInfo();
+	EXPECT_EQ(info.StateCount, 10u);
+	EXPECT_EQ(info.CompressedCount, 7u);
+
+	// Compressed states still restore the exact content
+	uint32_t stateFrame = 0;
+	RunAheadState* state = greenzone.FindState(2, stateFrame);
+	ASSERT_NE(state, nullptr);
+	EXPECT_TRUE(state->Ram.IsCompressed());
+	SaveState(console, 99);
+	state->Ram.Restore();
+	state->Data.ResetForFastLoad();
+	state->Data.Stream(console, "");
+	EXPECT_EQ(console.frame, 2u);
+	EXPECT_EQ(console.workRam[0x100], (uint8_t)(2 + 0x100));
+}
+
+TEST(GreenzoneManagerTest, ThinningKeepsSparseStatesUnderBudget) {
+	MockGreenzoneConsole console;
+	GreenzoneManager greenzone;
+	greenzone.SetOptions(GetOptions(1, 2, 1ull << 30));
+	for (uint32_t frame = 0; frame < 64; frame++) {
+		greenzone.SetPlayhead(frame);
+		greenzone.AddState(frame, SaveState(console, frame));
+	}
+
+	GreenzoneInfo info = greenzone.GetInfo();
+	uint64_t fullUsage = info.MemoryUsage;
+	greenzone.SetOptions(GetOptions(1, 2, fullUsage / 3));
+
+	info = greenzone.GetInfo();
+	EXPECT_LE(info.MemoryUsage, fullUsage / 3);
+	EXPECT_LT(info.StateCount, 64u);
+	EXPECT_EQ(info.FirstFrame, 0u);
+	EXPECT_EQ(info.LastFrame, 63u);
+
+	// Odd frames go first, the playhead's neighbours are kept
+	uint32_t stateFrame = 0;
+	greenzone.FindState(33, stateFrame);
+	EXPECT_EQ(stateFrame % 2, 0u);
+	greenzone.FindState(62, stateFrame);
+	EXPECT_EQ(stateFrame, 62u);
+}
+
+TEST(GreenzoneManagerTest, DisablingClearsStates) {
+	MockGreenzoneConsole console;
+	GreenzoneManager greenzone;
+	greenzone.SetOptions(GetOptions(1, 10, 1ull << 30));
+	greenzone.AddState(0, SaveState(console, 0));
+
+	GreenzoneOptions options = greenzone.GetOptions();
+	options.Enabled = false;
+	greenzone.SetOptions(options);
+	EXPECT_EQ(greenzone.GetInfo().StateCount, 0u);
+	EXPECT_FALSE(greenzone.NeedsState(0));
+
+	uint32_t frame = 0;
+	EXPECT_FALSE(greenzone.TakeSeekRequest(frame));
+	greenzone.RequestSeek(42);
+	EXPECT_TRUE(greenzone.IsSeekPending());
+	EXPECT_TRUE(greenzone.TakeSeekRequest(frame));
+	EXPECT_EQ(frame, 42u);
+	EXPECT_FALSE(greenzone.IsSeekPending());
+}
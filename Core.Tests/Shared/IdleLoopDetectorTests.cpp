@@ -0,0 +1,132 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <vector>
+#include "Shared/IdleLoopDetector.h"
+
+// =============================================================================
+// IdleLoopDetector Unit Tests
+// =============================================================================
+// Tests for the busy-wait loop recorder shared by the CPU cores.
+
+namespace {
+	struct TestRegs {
+		uint8_t A;
+		uint8_t Flags;
+
+		bool operator==(const TestRegs&) const = default;
+	};
+
+	// Runs one iteration of "loop: cmp $10, #value / bne loop" at $200: 2 opcodes, 3 cycles each, 1 read
+	void RunIteration(IdleLoopDetector<TestRegs>& detector, TestRegs regs, uint8_t value) {
+		detector.ProcessOpCode(0x200, regs);
+		detector.RecordCycle(0, 2);
+		detector.RecordCycle(0, 2);
+		detector.RecordCycle(1, 4);
+		detector.RecordRead(0x10, value);
+		detector.ProcessOpCode(0x203, regs);
+		detector.RecordCycle(0, 2);
+		detector.RecordCycle(0, 2);
+		detector.RecordCycle(1, 4);
+	}
+
+	// Jumps back to the start of the loop from the branch
+	void StartLoop(IdleLoopDetector<TestRegs>& detector, TestRegs regs, uint8_t value) {
+		detector.ProcessOpCode(0x200, regs);
+		detector.ProcessOpCode(0x203, regs);
+		RunIteration(detector, regs, value);
+		detector.ProcessOpCode(0x200, regs);
+	}
+}
+
+TEST(IdleLoopDetectorTest, RecordsIterationAfterBackwardJump) {
+	IdleLoopDetector<TestRegs> detector;
+	TestRegs regs = {1, 2};
+
+	StartLoop(detector, regs, 0x55);
+	EXPECT_TRUE(detector.CanSkipAt(0x200));
+	EXPECT_FALSE(detector.CanSkipAt(0x203));
+	EXPECT_EQ(detector.GetLength(), 16u);
+	EXPECT_EQ(detector.GetStats().RecordedLoops, 1u);
+}
+
+TEST(IdleLoopDetectorTest, SkipsWholeIterationsBeforeTarget) {
+	IdleLoopDetector<TestRegs> detector;
+	TestRegs regs = {1, 2};
+	StartLoop(detector, regs, 0x55);
+
+	ASSERT_TRUE(detector.Matches(regs, [](uint32_t addr, uint8_t value) { return addr == 0x10 && value == 0x55; }));
+
+	vector<uint8_t> tags;
+	uint64_t cycle = 1000;
+	uint64_t count = detector.Skip(cycle, 1000 + 16 * 10, [&](uint8_t tag) {
+		tags.push_back(tag);
+		cycle += tag ? 4 : 2;
+	});
+
+	// The 10th iteration would end on the target, it has to run normally
+	EXPECT_EQ(count, 9u);
+	EXPECT_EQ(cycle, 1000u + 16 * 9);
+	ASSERT_EQ(tags.size(), 9u * 6);
+	EXPECT_EQ(tags[2], 1);
+	EXPECT_EQ(tags[3], 0);
+
+	EXPECT_EQ(detector.Skip(cycle, 1000 + 16 * 10, [](uint8_t) {}), 0u);
+	EXPECT_EQ(detector.GetStats().SkippedIterations, 9u);
+	EXPECT_EQ(detector.GetStats().SkippedCycles, 16u * 9);
+}
+
+TEST(IdleLoopDetectorTest, ChangedStateRejectsSkip) {
+	IdleLoopDetector<TestRegs> detector;
+	TestRegs regs = {1, 2};
+	StartLoop(detector, regs, 0x55);
+
+	EXPECT_FALSE(detector.Matches(regs, [](uint32_t, uint8_t value) { return value == 0x66; }));
+	EXPECT_FALSE(detector.CanSkipAt(0x200));
+	EXPECT_EQ(detector.GetStats().RejectedSkips, 1u);
+
+	StartLoop(detector, regs, 0x55);
+	EXPECT_FALSE(detector.Matches({3, 2}, [](uint32_t, uint8_t) { return true; }));
+}
+
+TEST(IdleLoopDetectorTest, AbortedOrChangingIterationIsNotKept) {
+	IdleLoopDetector<TestRegs> detector;
+	TestRegs regs = {1, 2};
+
+	detector.ProcessOpCode(0x203, regs);
+	detector.ProcessOpCode(0x200, regs);
+	EXPECT_TRUE(detector.IsRecording());
+	detector.Abort();
+	RunIteration(detector, regs, 0x55);
+	detector.ProcessOpCode(0x200, regs);
+	EXPECT_FALSE(detector.CanSkipAt(0x200));
+
+	// Registers differ at the end of the iteration (e.g. a counter), the recording starts over
+	IdleLoopDetector<TestRegs> counter;
+	counter.ProcessOpCode(0x203, regs);
+	counter.ProcessOpCode(0x200, regs);
+	RunIteration(counter, regs, 0x55);
+	counter.ProcessOpCode(0x200, {2, 2});
+	EXPECT_FALSE(counter.CanSkipAt(0x200));
+	EXPECT_TRUE(counter.IsRecording());
+}
+
+TEST(IdleLoopDetectorTest, LongIterationsAndJumpsAreIgnored) {
+	IdleLoopDetector<TestRegs, 8, 16> detector;
+	TestRegs regs = {1, 2};
+
+	// Backward jump longer than MaxLength
+	detector.ProcessOpCode(0x300, regs);
+	detector.ProcessOpCode(0x200, regs);
+	EXPECT_FALSE(detector.IsRecording());
+
+	// More than MaxCycles bus cycles
+	detector.ProcessOpCode(0x203, regs);
+	detector.ProcessOpCode(0x200, regs);
+	for (int i = 0; i < 9; i++) {
+		detector.RecordCycle(0, 2);
+	}
+	EXPECT_FALSE(detector.IsRecording());
+	detector.ProcessOpCode(0x203, regs);
+	detector.ProcessOpCode(0x200, regs);
+	EXPECT_FALSE(detector.CanSkipAt(0x200));
+}
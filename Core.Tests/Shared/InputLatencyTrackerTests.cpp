@@ -0,0 +1,39 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "Shared/InputLatencyTracker.h"
+
+// =============================================================================
+// InputLatencyTracker Unit Tests
+// =============================================================================
+// Tests for the event -> poll latency measurements.
+
+TEST(InputLatencyTrackerTest, PollWithoutEventIsNotMeasured) {
+	InputLatencyTracker tracker;
+	tracker.OnPolled(1000);
+	tracker.OnPolled(2000);
+	EXPECT_EQ(tracker.GetLatency().Max, 0);
+}
+
+TEST(InputLatencyTrackerTest, OldestEventIsMeasured) {
+	InputLatencyTracker tracker;
+	tracker.OnEvent(10000);
+	tracker.OnEvent(14000);
+	tracker.OnPolled(18000);
+
+	// 2nd poll has no new event
+	tracker.OnPolled(30000);
+
+	LatencyPercentiles result = tracker.GetLatency();
+	EXPECT_DOUBLE_EQ(result.Max, 8);
+	EXPECT_DOUBLE_EQ(result.Average, 8);
+}
+
+TEST(InputLatencyTrackerTest, ClearDropsPendingEvent) {
+	InputLatencyTracker tracker;
+	tracker.OnEvent(10000);
+	tracker.OnPolled(12000);
+	tracker.OnEvent(20000);
+	tracker.Clear();
+	tracker.OnPolled(50000);
+	EXPECT_EQ(tracker.GetLatency().Max, 0);
+}
@@ -0,0 +1,66 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include "Shared/LightweightCdlRecorder.h"
+
+// =============================================================================
+// LightweightCdlRecorder Unit Tests
+// =============================================================================
+// Compact CDL export and merging of CDL files from several sessions (file operations only, no console).
+
+namespace {
+	string GetCdlFilename(const char* name) {
+		return (std::filesystem::temp_directory_path() / name).string();
+	}
+}
+
+TEST(LightweightCdlRecorderTest, CompactFileMergesIntoEmptyRecorder) {
+	constexpr uint32_t size = 0x20000;
+	LightweightCdlRecorder source(nullptr, MemoryType::NesPrgRom, size, CpuType::Nes, 0x12345678);
+	vector<uint8_t> flags(size);
+	flags[10] = CdlFlags::Code;
+	flags[0x1FFFF] = CdlFlags::Data;
+	source.SetCdlData(flags.data(), size);
+
+	string filename = GetCdlFilename("NexenLightweightCdlTest1.cdl");
+	ASSERT_TRUE(source.SaveCompactCdlFile(filename));
+	EXPECT_LT(std::filesystem::file_size(filename), (uintmax_t)size / 16);
+
+	LightweightCdlRecorder target(nullptr, MemoryType::NesPrgRom, size, CpuType::Nes, 0x12345678);
+	ASSERT_TRUE(target.MergeCdlFile(filename));
+	EXPECT_EQ(target.GetFlags(10), CdlFlags::Code);
+	EXPECT_EQ(target.GetFlags(0x1FFFF), CdlFlags::Data);
+	EXPECT_EQ(target.GetStatistics().CodeBytes, 1u);
+	std::filesystem::remove(filename);
+}
+
+TEST(LightweightCdlRecorderTest, MergeCombinesFlags) {
+	constexpr uint32_t size = 0x1000;
+	LightweightCdlRecorder first(nullptr, MemoryType::SnesPrgRom, size, CpuType::Snes, 1);
+	vector<uint8_t> flags(size);
+	flags[5] = CdlFlags::Code;
+	first.SetCdlData(flags.data(), size);
+
+	string filename = GetCdlFilename("NexenLightweightCdlTest2.cdl");
+	ASSERT_TRUE(first.SaveCdlFile(filename));
+
+	LightweightCdlRecorder second(nullptr, MemoryType::SnesPrgRom, size, CpuType::Snes, 1);
+	flags[5] = CdlFlags::Data;
+	flags[6] = CdlFlags::Data;
+	second.SetCdlData(flags.data(), size);
+	ASSERT_TRUE(second.MergeCdlFile(filename));
+	EXPECT_EQ(second.GetFlags(5), CdlFlags::Code | CdlFlags::Data);
+	EXPECT_EQ(second.GetFlags(6), CdlFlags::Data);
+	std::filesystem::remove(filename);
+}
+
+TEST(LightweightCdlRecorderTest, MergeRejectsOtherRom) {
+	constexpr uint32_t size = 0x1000;
+	LightweightCdlRecorder source(nullptr, MemoryType::NesPrgRom, size, CpuType::Nes, 1);
+	string filename = GetCdlFilename("NexenLightweightCdlTest3.cdl");
+	ASSERT_TRUE(source.SaveCompactCdlFile(filename));
+
+	LightweightCdlRecorder target(nullptr, MemoryType::NesPrgRom, size, CpuType::Nes, 2);
+	EXPECT_FALSE(target.MergeCdlFile(filename));
+	std::filesystem::remove(filename);
+}
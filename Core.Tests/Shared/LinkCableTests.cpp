@@ -0,0 +1,92 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <thread>
+#include "Shared/LinkCable.h"
+
+// =============================================================================
+// LinkCable Unit Tests
+// =============================================================================
+// Message queues and transfer handshake of the in-process link cable, with the
+// ports used directly (one thread per side, like 2 emulator instances).
+
+TEST(LinkCableTest, MessagesCrossToTheOtherSide) {
+	LinkCable cable;
+	LinkCablePort* a = cable.GetPort(0);
+	LinkCablePort* b = cable.GetPort(1);
+
+	EXPECT_TRUE(a->Send({10, 1, LinkCableMessageType::Byte, 0x12}));
+	EXPECT_TRUE(a->Send({20, 2, LinkCableMessageType::Byte, 0x34}));
+
+	LinkCableMessage msg;
+	EXPECT_FALSE(a->TryReceive(msg));
+	ASSERT_TRUE(b->TryReceive(msg));
+	EXPECT_EQ(msg.Clock, 10u);
+	EXPECT_EQ(msg.Data, 0x12);
+	ASSERT_TRUE(b->TryReceive(msg));
+	EXPECT_EQ(msg.Data, 0x34);
+	EXPECT_FALSE(b->TryReceive(msg));
+}
+
+TEST(LinkCableTest, FullQueueDropsMessages) {
+	LinkCable cable;
+	LinkCablePort* a = cable.GetPort(0);
+	for (uint32_t i = 0; i < LinkCableQueue::Capacity; i++) {
+		EXPECT_TRUE(a->Send({i, i, LinkCableMessageType::Byte, (uint8_t)i}));
+	}
+	EXPECT_FALSE(a->Send({0, 0, LinkCableMessageType::Byte, 0}));
+
+	LinkCableMessage msg;
+	ASSERT_TRUE(cable.GetPort(1)->TryReceive(msg));
+	EXPECT_EQ(msg.Id, 0u);
+	EXPECT_TRUE(a->Send({0, 0, LinkCableMessageType::Byte, 0}));
+}
+
+TEST(LinkCableTest, WaitForReplyExchangesBytesBetweenThreads) {
+	LinkCable cable;
+	LinkCablePort* master = cable.GetPort(0);
+	LinkCablePort* slave = cable.GetPort(1);
+	master->SetAttached(true);
+	slave->SetAttached(true);
+
+	std::atomic<bool> stop = false;
+	std::thread slaveThread([&]() {
+		LinkCableMessage msg;
+		while (!stop) {
+			while (slave->TryReceive(msg)) {
+				if (msg.Type == LinkCableMessageType::TransferStart) {
+					slave->Send({0, msg.Id, LinkCableMessageType::TransferReply, (uint8_t)~msg.Data});
+				}
+			}
+			std::this_thread::yield();
+		}
+	});
+
+	for (uint32_t i = 1; i <= 100; i++) {
+		master->Send({0, i, LinkCableMessageType::TransferStart, (uint8_t)i});
+		uint8_t reply = 0;
+		EXPECT_TRUE(master->WaitForReply(i, reply, [](const LinkCableMessage&) {}));
+		EXPECT_EQ(reply, (uint8_t)~i);
+	}
+
+	stop = true;
+	slaveThread.join();
+}
+
+TEST(LinkCableTest, WaitForReplyFailsWithoutPeer) {
+	LinkCable cable;
+	LinkCablePort* master = cable.GetPort(0);
+	master->SetAttached(true);
+
+	// Messages received while waiting are passed on, stale replies are ignored
+	cable.GetPort(1)->Send({0, 5, LinkCableMessageType::TransferReply, 0x55});
+	cable.GetPort(1)->Send({0, 0, LinkCableMessageType::Byte, 0x66});
+
+	uint32_t otherMessages = 0;
+	uint8_t reply = 0;
+	EXPECT_FALSE(master->WaitForReply(6, reply, [&](const LinkCableMessage& msg) {
+		otherMessages++;
+		EXPECT_EQ(msg.Data, 0x66);
+	}));
+	EXPECT_EQ(otherMessages, 1u);
+	EXPECT_EQ(reply, 0);
+}
@@ -0,0 +1,96 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include "Shared/MemoryHeatmapRecorder.h"
+
+// =============================================================================
+// MemoryHeatmapRecorder Unit Tests
+// =============================================================================
+// Page sizes per CPU, per-frame counting and the streamed file format.
+
+namespace {
+	string GetHeatmapFilename(const char* name) {
+		return (std::filesystem::temp_directory_path() / name).string();
+	}
+
+	vector<uint32_t> ReadFile(const string& filename) {
+		std::ifstream file(filename, ios::binary);
+		vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+		vector<uint32_t> words(data.size() / 4);
+		memcpy(words.data(), data.data(), words.size() * 4);
+		return words;
+	}
+}
+
+TEST(MemoryHeatmapRecorderTest, PageSizeDependsOnAddressSpace) {
+	string filename = GetHeatmapFilename("NexenHeatmapTest1.bin");
+	{
+		MemoryHeatmapRecorder nes(CpuType::Nes, filename);
+		EXPECT_EQ(nes.GetPageShift(), MemoryHeatmapRecorder::MinPageShift);
+		EXPECT_EQ(nes.GetPageCount(), 256u);
+	}
+	{
+		MemoryHeatmapRecorder snes(CpuType::Snes, filename);
+		EXPECT_EQ(snes.GetPageShift(), 12u);
+		EXPECT_EQ(snes.GetPageCount(), MemoryHeatmapRecorder::MaxPageCount);
+	}
+	{
+		MemoryHeatmapRecorder gba(CpuType::Gba, filename);
+		EXPECT_EQ(gba.GetPageShift(), 20u);
+		EXPECT_EQ(gba.GetPageCount(), MemoryHeatmapRecorder::MaxPageCount);
+	}
+	std::filesystem::remove(filename);
+}
+
+TEST(MemoryHeatmapRecorderTest, CountsAccessesOfTheRecordedCpuOnly) {
+	string filename = GetHeatmapFilename("NexenHeatmapTest2.bin");
+	MemoryHeatmapRecorder recorder(CpuType::Snes, filename);
+	recorder.RecordRead<CpuType::Snes>(0x7E1234, MemoryOperationType::Read);
+	recorder.RecordRead<CpuType::Snes>(0x7E1FFF, MemoryOperationType::DummyRead);
+	recorder.RecordRead<CpuType::Snes>(0x808000, MemoryOperationType::ExecOpCode);
+	recorder.RecordRead<CpuType::Snes>(0x808001, MemoryOperationType::ExecOperand);
+	recorder.RecordWrite<CpuType::Snes>(0x7E1000, MemoryOperationType::Write);
+	recorder.RecordRead<CpuType::Spc>(0x1234, MemoryOperationType::Read);
+
+	const MemoryHeatmapRecorder::PageCounters& wram = recorder.GetPage(0x7E1);
+	EXPECT_EQ(wram.Reads, 1u);
+	EXPECT_EQ(wram.Writes, 1u);
+	EXPECT_EQ(recorder.GetPage(0x808).Execs, 2u);
+	EXPECT_EQ(recorder.GetPage(0x001).Reads, 0u);
+
+	recorder.DiscardFrame();
+	EXPECT_EQ(recorder.GetPage(0x7E1).Reads, 0u);
+	EXPECT_EQ(recorder.GetPage(0x808).Execs, 0u);
+	std::filesystem::remove(filename);
+}
+
+TEST(MemoryHeatmapRecorderTest, FramesAreStreamedToFile) {
+	string filename = GetHeatmapFilename("NexenHeatmapTest3.bin");
+	{
+		MemoryHeatmapRecorder recorder(CpuType::Nes, filename);
+		ASSERT_TRUE(recorder.IsOpen());
+		recorder.RecordRead<CpuType::Nes>(0x8000, MemoryOperationType::ExecOpCode);
+		recorder.RecordWrite<CpuType::Nes>(0x0200, MemoryOperationType::Write);
+		recorder.RecordWrite<CpuType::Nes>(0x0201, MemoryOperationType::Write);
+		recorder.EndFrame(10);
+		recorder.EndFrame(11);
+	}
+
+	vector<uint32_t> words = ReadFile(filename);
+	ASSERT_EQ(words.size(), 4u + 2u + 2u * 4u + 2u);
+	EXPECT_EQ(memcmp(words.data(), "NXHM", 4), 0);
+	EXPECT_EQ(words[1], MemoryHeatmapRecorder::FormatVersion);
+	EXPECT_EQ(words[2], (uint32_t)CpuType::Nes | (8u << 8));
+	EXPECT_EQ(words[3], 256u);
+
+	// Frame 10: pages $02 (2 writes) and $80 (1 exec), in page order
+	EXPECT_EQ(words[4], 10u);
+	EXPECT_EQ(words[5], 2u);
+	EXPECT_EQ((vector<uint32_t>(words.begin() + 6, words.begin() + 10)), (vector<uint32_t>{0x02, 0, 2, 0}));
+	EXPECT_EQ((vector<uint32_t>(words.begin() + 10, words.begin() + 14)), (vector<uint32_t>{0x80, 0, 0, 1}));
+
+	// Frame 11: counts were reset, no entries
+	EXPECT_EQ(words[14], 11u);
+	EXPECT_EQ(words[15], 0u);
+	std::filesystem::remove(filename);
+}
@@ -0,0 +1,57 @@
+#include "pch.h"
+#include "Shared/MemoryPageTable.h"
+
+// =============================================================================
+// MemoryPageTable Unit Tests
+// =============================================================================
+// Tests for the ROM/RAM page pointer table used by the SMS and WonderSwan memory managers.
+
+namespace {
+	std::vector<uint8_t> MakeBlock(uint32_t size) {
+		std::vector<uint8_t> block(size);
+		for (uint32_t i = 0; i < size; i++) {
+			block[i] = (uint8_t)(i >> 8);
+		}
+		return block;
+	}
+}
+
+TEST(MemoryPageTableTest, MapsPagesFromOffset) {
+	std::vector<uint8_t> rom = MakeBlock(0x4000);
+	MemoryPageTable<8, 0x100> pages;
+
+	pages.Map(0x8000, 0xBFFF, rom.data(), (uint32_t)rom.size(), 0x1000, true);
+	EXPECT_EQ(pages.GetReadPage(0x8000), rom.data() + 0x1000);
+	EXPECT_EQ(pages.Read(0x8123, 0xFF), 0x11);
+	EXPECT_EQ(pages.GetWritePage(0x8000), nullptr);
+	EXPECT_EQ(pages.Read(0x7FFF, 0xFF), 0xFF);
+}
+
+TEST(MemoryPageTableTest, MirrorsSmallBlocksAndWrapsOffset) {
+	std::vector<uint8_t> ram = MakeBlock(0x2000);
+	MemoryPageTable<12, 0x100> pages;
+
+	// Offset past the end wraps, the 8KB block is mirrored over the 32KB range
+	pages.Map(0x10000, 0x17FFF, ram.data(), (uint32_t)ram.size(), 0x3000, false);
+	EXPECT_EQ(pages.GetReadPage(0x10000), ram.data() + 0x1000);
+	EXPECT_EQ(pages.GetReadPage(0x11000), ram.data());
+	EXPECT_EQ(pages.GetReadPage(0x12000), ram.data() + 0x1000);
+	EXPECT_EQ(pages.GetReadPage(0x17000), ram.data());
+
+	pages.Write(0x12010, 0x5A);
+	EXPECT_EQ(ram[0x1010], 0x5A);
+}
+
+TEST(MemoryPageTableTest, EmptyBlockUnmaps) {
+	std::vector<uint8_t> ram = MakeBlock(0x1000);
+	MemoryPageTable<8, 0x100> pages;
+
+	pages.Map(0xC000, 0xCFFF, ram.data(), (uint32_t)ram.size(), 0, false);
+	pages.Map(0xC000, 0xCFFF, nullptr, 0, 0, false);
+	EXPECT_EQ(pages.GetReadPage(0xC000), nullptr);
+	EXPECT_EQ(pages.GetWritePage(0xCF00), nullptr);
+
+	// Writes to unmapped pages are ignored
+	pages.Write(0xC000, 0x12);
+	EXPECT_EQ(pages.Read(0xC000, 0x77), 0x77);
+}
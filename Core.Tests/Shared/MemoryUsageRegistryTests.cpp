@@ -0,0 +1,94 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "Shared/MemoryUsageRegistry.h"
+
+// =============================================================================
+// MemoryUsageRegistry Unit Tests
+// =============================================================================
+// Tests for the memory usage tree: totals, reporter registration and the flattened (interop) form.
+
+namespace {
+	class TestReporter : public IMemoryUsageReporter {
+	public:
+		uint64_t Buffer = 0;
+		uint64_t Cache = 0;
+
+		void ReportMemoryUsage(MemoryUsageNode& node) override {
+			node.Add("Buffer", Buffer);
+			node.Add("Cache", Cache);
+		}
+	};
+}
+
+TEST(MemoryUsageRegistryTest, TotalIncludesChildren) {
+	MemoryUsageNode root = {"Root", 10, {}};
+	MemoryUsageNode& child = root.Add("Child", 20);
+	child.Add("Grandchild", 30);
+	root.Add("Other", 40);
+
+	EXPECT_EQ(root.GetTotal(), 100u);
+	EXPECT_EQ(root.Children[0].GetTotal(), 50u);
+}
+
+TEST(MemoryUsageRegistryTest, ReportersAreCalledInRegistrationOrder) {
+	MemoryUsageRegistry registry;
+	TestReporter first;
+	first.Buffer = 100;
+	first.Cache = 28;
+	TestReporter second;
+	second.Buffer = 1000;
+
+	registry.Register("First", &first);
+	registry.Register("Second", &second);
+
+	MemoryUsageNode usage = registry.GetUsage();
+	ASSERT_EQ(usage.Children.size(), 2u);
+	EXPECT_EQ(usage.Children[0].Name, "First");
+	EXPECT_EQ(usage.Children[0].GetTotal(), 128u);
+	EXPECT_EQ(usage.Children[1].Name, "Second");
+	EXPECT_EQ(usage.GetTotal(), 1128u);
+
+	// Reports the current values on every call
+	second.Buffer = 2000;
+	EXPECT_EQ(registry.GetUsage().GetTotal(), 2128u);
+}
+
+TEST(MemoryUsageRegistryTest, Unregister) {
+	MemoryUsageRegistry registry;
+	TestReporter reporter;
+	reporter.Buffer = 100;
+
+	registry.Register("Reporter", &reporter);
+	registry.Register("Reporter again", &reporter); // Replaces the first registration
+	EXPECT_EQ(registry.GetUsage().Children.size(), 1u);
+
+	registry.Unregister(&reporter);
+	registry.Unregister(&reporter);
+	MemoryUsageNode usage = registry.GetUsage();
+	EXPECT_TRUE(usage.Children.empty());
+	EXPECT_EQ(usage.GetTotal(), 0u);
+}
+
+TEST(MemoryUsageRegistryTest, FlatUsageIsDepthFirst) {
+	MemoryUsageRegistry registry;
+	TestReporter reporter;
+	reporter.Buffer = 64;
+	reporter.Cache = 32;
+	registry.Register("A name that is much longer than the interop buffer, so it has to be truncated", &reporter);
+
+	vector<MemoryUsageEntry> entries = registry.GetFlatUsage();
+	ASSERT_EQ(entries.size(), 4u);
+	EXPECT_STREQ(entries[0].Name, "Total");
+	EXPECT_EQ(entries[0].Depth, 0u);
+	EXPECT_EQ(entries[0].Bytes, 96u);
+
+	EXPECT_EQ(strlen(entries[1].Name), sizeof(entries[1].Name) - 1);
+	EXPECT_EQ(entries[1].Depth, 1u);
+	EXPECT_EQ(entries[1].Bytes, 96u);
+
+	EXPECT_STREQ(entries[2].Name, "Buffer");
+	EXPECT_EQ(entries[2].Depth, 2u);
+	EXPECT_EQ(entries[2].Bytes, 64u);
+	EXPECT_STREQ(entries[3].Name, "Cache");
+	EXPECT_EQ(entries[3].Bytes, 32u);
+}
@@ -161,7 +161,6 @@ TEST_F(RewindDataTest, DefaultValues) {
 	RewindData rd;
 	EXPECT_EQ(rd.FrameCount, 0);
 	EXPECT_FALSE(rd.EndOfSegment);
-	EXPECT_FALSE(rd.IsFullState);
 	EXPECT_EQ(rd.GetStateSize(), 0u);
 }
 
@@ -208,15 +207,40 @@ TEST_F(RewindDataTest, InputLogs_MultiplePorts) {
 	EXPECT_EQ(rd.InputLogs[1][0].State[0], 0x0a);
 }
 
+TEST_F(RewindDataTest, InputLogs_PopFrontAndBack) {
+	RewindData rd;
+	for (int frame = 0; frame < 5; frame++) {
+		ControlDeviceState state;
+		state.State = {(uint8_t)frame};
+		rd.InputLogs[0].push_back(state);
+	}
+
+	rd.InputLogs[0].pop_front();
+	rd.InputLogs[0].pop_front();
+	EXPECT_EQ(rd.InputLogs[0].size(), 3u);
+	EXPECT_EQ(rd.InputLogs[0].front().State[0], 0x02);
+	EXPECT_EQ(rd.InputLogs[0][2].State[0], 0x04);
+
+	rd.InputLogs[0].pop_back();
+	EXPECT_EQ(rd.InputLogs[0].size(), 2u);
+
+	uint8_t expected = 2;
+	for (const ControlDeviceState& state : rd.InputLogs[0]) {
+		EXPECT_EQ(state.State[0], expected++);
+	}
+
+	rd.InputLogs[0].pop_front();
+	rd.InputLogs[0].pop_front();
+	EXPECT_TRUE(rd.InputLogs[0].empty());
+}
+
 TEST_F(RewindDataTest, SegmentMarkers) {
 	RewindData rd;
 	rd.FrameCount = 30;
 	rd.EndOfSegment = true;
-	rd.IsFullState = true;
 
 	EXPECT_EQ(rd.FrameCount, 30);
 	EXPECT_TRUE(rd.EndOfSegment);
-	EXPECT_TRUE(rd.IsFullState);
 }
 
 // ===== Movie Input Format Parsing Tests =====
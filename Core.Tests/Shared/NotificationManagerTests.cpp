@@ -1,4 +1,5 @@
 #include "pch.h"
+#include <thread>
 #include "Shared/NotificationManager.h"
 
 class TestNotificationListener : public INotificationListener {
@@ -59,3 +60,116 @@ TEST(NotificationManagerTests, SendNotification_PrunesExpiredListenersForSubsequ
 	EXPECT_EQ(liveListener->NotificationCount, 2);
 	EXPECT_TRUE(liveListener->LastType == ConsoleNotificationType::GamePaused);
 }
+
+TEST(NotificationManagerTests, UnregisteredListener_NoLongerReceivesNotifications) {
+	NotificationManager manager;
+	auto listener = std::make_shared<TestNotificationListener>();
+	auto other = std::make_shared<TestNotificationListener>();
+	manager.RegisterNotificationListener(listener);
+	manager.RegisterNotificationListener(other);
+
+	manager.UnregisterNotificationListener(listener.get());
+	manager.SendNotification(ConsoleNotificationType::GamePaused, nullptr);
+
+	EXPECT_EQ(listener->NotificationCount, 0);
+	EXPECT_EQ(other->NotificationCount, 1);
+}
+
+namespace {
+	class ReentrantListener : public INotificationListener {
+	public:
+		NotificationManager* Manager = nullptr;
+		shared_ptr<TestNotificationListener> Added = std::make_shared<TestNotificationListener>();
+
+		void ProcessNotification(ConsoleNotificationType type, void* parameter) override {
+			(void)parameter;
+			if (type == ConsoleNotificationType::GameLoaded) {
+				Manager->RegisterNotificationListener(Added);
+				Manager->UnregisterNotificationListener(this);
+			}
+		}
+	};
+}
+
+TEST(NotificationManagerTests, ListenersCanBeChangedFromCallbacks) {
+	NotificationManager manager;
+	auto listener = std::make_shared<ReentrantListener>();
+	listener->Manager = &manager;
+	manager.RegisterNotificationListener(listener);
+
+	// Changes made during a notification apply to the next ones
+	manager.SendNotification(ConsoleNotificationType::GameLoaded, nullptr);
+	EXPECT_EQ(listener->Added->NotificationCount, 0);
+
+	manager.SendNotification(ConsoleNotificationType::GameLoaded, nullptr);
+	manager.SendNotification(ConsoleNotificationType::GameLoaded, nullptr);
+	EXPECT_EQ(listener->Added->NotificationCount, 2);
+}
+
+namespace {
+	class ThreadRecordingListener : public INotificationListener {
+	public:
+		atomic<int> FrameCount = 0;
+		atomic<int> PauseCount = 0;
+		std::thread::id FrameThread;
+		std::thread::id PauseThread;
+
+		void ProcessNotification(ConsoleNotificationType type, void* parameter) override {
+			if (type == ConsoleNotificationType::PpuFrameDone) {
+				EXPECT_EQ(parameter, nullptr);
+				FrameThread = std::this_thread::get_id();
+				FrameCount++;
+			} else if (type == ConsoleNotificationType::GamePaused) {
+				PauseThread = std::this_thread::get_id();
+				PauseCount++;
+			}
+		}
+	};
+}
+
+TEST(NotificationManagerTests, QueuedListener_ReceivesFrequentNotificationsFromDispatchThread) {
+	NotificationManager manager;
+	auto queued = std::make_shared<ThreadRecordingListener>();
+	auto sync = std::make_shared<TestNotificationListener>();
+	manager.RegisterNotificationListener(queued, NotificationDelivery::Queued);
+	manager.RegisterNotificationListener(sync);
+
+	int frameBuffer = 0;
+	manager.SendNotification(ConsoleNotificationType::PpuFrameDone, &frameBuffer);
+	manager.SendNotification(ConsoleNotificationType::GamePaused, nullptr);
+
+	// Other notification types stay synchronous
+	EXPECT_EQ(queued->PauseCount, 1);
+	EXPECT_EQ(queued->PauseThread, std::this_thread::get_id());
+	EXPECT_EQ(sync->NotificationCount, 2);
+
+	for (int i = 0; i < 1000 && queued->FrameCount == 0; i++) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	EXPECT_EQ(queued->FrameCount, 1);
+	EXPECT_NE(queued->FrameThread, std::this_thread::get_id());
+}
+
+TEST(NotificationManagerTests, QueuedDeliveryDisabled_DropsFrequentNotificationsOnly) {
+	NotificationManager manager;
+	auto queued = std::make_shared<ThreadRecordingListener>();
+	auto sync = std::make_shared<TestNotificationListener>();
+	manager.RegisterNotificationListener(queued, NotificationDelivery::Queued);
+	manager.RegisterNotificationListener(sync);
+	manager.SetQueuedDeliveryEnabled(false);
+
+	manager.SendNotification(ConsoleNotificationType::PpuFrameDone, nullptr);
+	manager.SendNotification(ConsoleNotificationType::GamePaused, nullptr);
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	EXPECT_EQ(queued->FrameCount, 0);
+	EXPECT_EQ(queued->PauseCount, 1);
+	EXPECT_EQ(sync->NotificationCount, 2);
+
+	manager.SetQueuedDeliveryEnabled(true);
+	manager.SendNotification(ConsoleNotificationType::PpuFrameDone, nullptr);
+	for (int i = 0; i < 1000 && queued->FrameCount == 0; i++) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	EXPECT_EQ(queued->FrameCount, 1);
+}
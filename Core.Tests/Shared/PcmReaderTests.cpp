@@ -0,0 +1,138 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include "Shared/Audio/PcmReader.h"
+
+// =============================================================================
+// PcmReader Unit Tests
+// =============================================================================
+// Tests for the MSU-1 PCM streaming: read-ahead must not change the output, loop points, end of track.
+
+namespace {
+	class PcmReaderTest : public ::testing::Test {
+	protected:
+		static constexpr uint32_t FrameCount = 20000; // ~4.9 chunks
+		static constexpr uint32_t LoopFrame = 15000;
+		static constexpr uint32_t SampleRate = 48000;
+		static constexpr uint32_t SamplesPerCall = 800;
+
+		string _path;
+
+		void SetUp() override {
+			_path = (std::filesystem::temp_directory_path() / "nexen_pcmreader_test.pcm").string();
+			std::ofstream out(_path, std::ios::binary);
+			out.write("MSU1", 4);
+			uint32_t loopPoint = LoopFrame;
+			out.write((char*)&loopPoint, sizeof(loopPoint));
+			for (uint32_t i = 0; i < FrameCount; i++) {
+				int16_t samples[2] = {(int16_t)(i * 7), (int16_t)(-(int32_t)i * 3)};
+				out.write((char*)samples, sizeof(samples));
+			}
+		}
+
+		void TearDown() override {
+			std::filesystem::remove(_path);
+		}
+
+		static vector<int16_t> Play(PcmReader& reader, uint32_t callCount, vector<uint32_t>* offsets = nullptr) {
+			vector<int16_t> output(callCount * SamplesPerCall * 2);
+			reader.SetSampleRate(SampleRate);
+			for (uint32_t i = 0; i < callCount; i++) {
+				reader.ApplySamples(output.data() + i * SamplesPerCall * 2, SamplesPerCall, 255);
+				if (offsets) {
+					offsets->push_back(reader.GetOffset());
+				}
+			}
+			return output;
+		}
+	};
+}
+
+TEST_F(PcmReaderTest, ReadAheadDoesNotChangeOutput) {
+	PcmReader syncReader;
+	syncReader.Open(_path, true);
+	vector<uint32_t> syncOffsets;
+	vector<int16_t> expected = Play(syncReader, 60, &syncOffsets);
+
+	PcmReader streamedReader;
+	streamedReader.Open(_path, true);
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	vector<uint32_t> streamedOffsets;
+	vector<int16_t> actual = Play(streamedReader, 30, &streamedOffsets);
+
+	// ~22000 frames, less than what is read ahead
+	EXPECT_EQ(streamedReader.GetMissCount(), 0u);
+
+	vector<int16_t> end = Play(streamedReader, 30, &streamedOffsets);
+	actual.insert(actual.end(), end.begin(), end.end());
+	EXPECT_EQ(actual, expected);
+	EXPECT_EQ(streamedOffsets, syncOffsets);
+}
+
+TEST_F(PcmReaderTest, LoopsToLoopPoint) {
+	PcmReader reader;
+	reader.Open(_path, true);
+
+	// ~44100 frames, more than twice the track's length
+	vector<uint32_t> offsets;
+	(void)Play(reader, 60, &offsets);
+	EXPECT_FALSE(reader.IsPlaybackOver());
+
+	bool looped = false;
+	for (size_t i = 1; i < offsets.size(); i++) {
+		if (offsets[i] < offsets[i - 1]) {
+			looped = true;
+			EXPECT_GE(offsets[i], 8 + LoopFrame * 4);
+		}
+		EXPECT_LE(offsets[i], 8 + FrameCount * 4);
+	}
+	EXPECT_TRUE(looped);
+}
+
+TEST_F(PcmReaderTest, EndsWhenNotLooping) {
+	PcmReader reader;
+	reader.Open(_path, false);
+	(void)Play(reader, 10);
+	EXPECT_FALSE(reader.IsPlaybackOver());
+	(void)Play(reader, 30);
+	EXPECT_TRUE(reader.IsPlaybackOver());
+}
+
+TEST_F(PcmReaderTest, LoopFlagChangeAppliesToQueuedSamples) {
+	PcmReader reader;
+	reader.Open(_path, false);
+	(void)Play(reader, 20);
+
+	// The end of the track is read ahead without looping at this point
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	reader.SetLoopFlag(true);
+	(void)Play(reader, 40);
+	EXPECT_FALSE(reader.IsPlaybackOver());
+	EXPECT_GE(reader.GetOffset(), 8 + LoopFrame * 4);
+}
+
+TEST_F(PcmReaderTest, StartOffset) {
+	PcmReader reader;
+	uint32_t startOffset = 8 + 12345 * 4;
+	reader.Open(_path, false, startOffset);
+	EXPECT_EQ(reader.GetOffset(), startOffset);
+
+	// Samples up to the end of the file (7655 frames) only, ~737 frames per call
+	(void)Play(reader, 10);
+	EXPECT_FALSE(reader.IsPlaybackOver());
+	(void)Play(reader, 1);
+	EXPECT_TRUE(reader.IsPlaybackOver());
+}
+
+TEST_F(PcmReaderTest, MissingFileEndsPlayback) {
+	PcmReader reader;
+	reader.Open(_path + ".missing", true);
+	(void)Play(reader, 1);
+	EXPECT_TRUE(reader.IsPlaybackOver());
+
+	reader.Open(_path, true);
+	reader.Stop();
+	EXPECT_TRUE(reader.IsPlaybackOver());
+}
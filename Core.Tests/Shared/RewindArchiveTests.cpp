@@ -0,0 +1,177 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <vector>
+#include "Shared/RewindArchive.h"
+#include "Shared/RewindCompressor.h"
+
+// =============================================================================
+// RewindArchive Unit Tests
+// =============================================================================
+// Archived states decode to the original data, and blocks shared with the previous state are written once.
+
+namespace {
+	vector<uint8_t> MakeState(uint32_t size, uint8_t seed) {
+		vector<uint8_t> data(size);
+		for (uint32_t i = 0; i < size; i++) {
+			data[i] = (uint8_t)((i / 3) * 7 + seed);
+		}
+		return data;
+	}
+
+	string GetArchiveFilename(const char* name) {
+		return (std::filesystem::temp_directory_path() / name).string();
+	}
+}
+
+TEST(RewindArchiveTest, ArchivedStatesDecodeToOriginalData) {
+	RewindCompressor compressor;
+	RewindArchive archive(GetArchiveFilename("NexenRewindArchiveTest1.tmp"));
+
+	vector<uint8_t> first = MakeState(RewindCompressor::BlockSize * 3 + 50, 1);
+	vector<uint8_t> second = MakeState(RewindCompressor::BlockSize * 2, 9);
+	shared_ptr<RewindStateBlocks> s1 = compressor.Enqueue(vector<uint8_t>(first), nullptr);
+	shared_ptr<RewindStateBlocks> s2 = compressor.Enqueue(vector<uint8_t>(second), nullptr);
+
+	uint32_t index1 = 0;
+	uint32_t index2 = 0;
+	ASSERT_TRUE(archive.Append(*s1, index1));
+	ASSERT_TRUE(archive.Append(*s2, index2));
+	EXPECT_EQ(archive.GetCount(), 2u);
+	EXPECT_EQ(index1, 0u);
+	EXPECT_EQ(index2, 1u);
+
+	vector<uint8_t> decoded;
+	ASSERT_TRUE(archive.Decode(index2, decoded));
+	EXPECT_EQ(decoded, second);
+	ASSERT_TRUE(archive.Decode(index1, decoded));
+	EXPECT_EQ(decoded, first);
+	EXPECT_FALSE(archive.Decode(2, decoded));
+}
+
+TEST(RewindArchiveTest, SharedBlocksAreWrittenOnce) {
+	RewindCompressor compressor;
+	RewindArchive archive(GetArchiveFilename("NexenRewindArchiveTest2.tmp"));
+
+	vector<uint8_t> first = MakeState(RewindCompressor::BlockSize * 4, 1);
+	vector<uint8_t> second = first;
+	second[RewindCompressor::BlockSize + 10] ^= 0xFF;
+	shared_ptr<RewindStateBlocks> s1 = compressor.Enqueue(vector<uint8_t>(first), nullptr);
+	shared_ptr<RewindStateBlocks> s2 = compressor.Enqueue(vector<uint8_t>(second), s1);
+
+	uint32_t index;
+	ASSERT_TRUE(archive.Append(*s1, index));
+	uint64_t firstSize = archive.GetFileSize();
+	ASSERT_TRUE(archive.Append(*s2, index));
+	EXPECT_EQ(archive.GetFileSize(), firstSize + s2->Blocks[1]->size());
+
+	vector<uint8_t> decoded;
+	ASSERT_TRUE(archive.Decode(1, decoded));
+	EXPECT_EQ(decoded, second);
+	ASSERT_TRUE(archive.Decode(0, decoded));
+	EXPECT_EQ(decoded, first);
+}
+
+TEST(RewindArchiveTest, FileIsDeletedWithArchive) {
+	string filename = GetArchiveFilename("NexenRewindArchiveTest3.tmp");
+	{
+		RewindCompressor compressor;
+		RewindArchive archive(filename);
+		shared_ptr<RewindStateBlocks> state = compressor.Enqueue(MakeState(100, 2), nullptr);
+		uint32_t index;
+		ASSERT_TRUE(archive.Append(*state, index));
+		EXPECT_TRUE(std::filesystem::exists(filename));
+	}
+	EXPECT_FALSE(std::filesystem::exists(filename));
+}
+
+TEST(RewindArchiveTest, BlocksAreWrittenInTheBackground) {
+	string filename = GetArchiveFilename("NexenRewindArchiveTest4.tmp");
+	RewindCompressor compressor;
+	RewindArchive archive(filename);
+
+	vector<vector<uint8_t>> states;
+	shared_ptr<RewindStateBlocks> prev;
+	for (uint8_t i = 0; i < 20; i++) {
+		states.push_back(MakeState(RewindCompressor::BlockSize * 2 + i, i));
+		shared_ptr<RewindStateBlocks> state = compressor.Enqueue(vector<uint8_t>(states.back()), prev);
+		uint32_t index;
+		ASSERT_TRUE(archive.Append(*state, index));
+		prev = state;
+	}
+
+	// Readable right away (from memory, or from the file once written)
+	vector<uint8_t> decoded;
+	ASSERT_TRUE(archive.Decode(19, decoded));
+	EXPECT_EQ(decoded, states[19]);
+
+	archive.WaitForWrites();
+	EXPECT_EQ(std::filesystem::file_size(filename), archive.GetFileSize());
+	for (uint32_t i = 0; i < states.size(); i++) {
+		ASSERT_TRUE(archive.Decode(i, decoded));
+		EXPECT_EQ(decoded, states[i]);
+	}
+}
+
+TEST(RewindArchiveTest, AppendFailsWhenFileCannotBeCreated) {
+	RewindCompressor compressor;
+	RewindArchive archive((std::filesystem::temp_directory_path() / "NexenMissingFolder" / "Archive.tmp").string());
+	shared_ptr<RewindStateBlocks> state = compressor.Enqueue(MakeState(100, 2), nullptr);
+	uint32_t index;
+	EXPECT_FALSE(archive.Append(*state, index));
+	EXPECT_EQ(archive.GetCount(), 0u);
+}
+
+TEST(RewindArchiveTest, SealedArchiveCanBeReopened) {
+	string filename = GetArchiveFilename("NexenRewindArchiveTest6.tmp");
+	RewindCompressor compressor;
+	vector<uint8_t> first = MakeState(RewindCompressor::BlockSize * 2 + 10, 3);
+	vector<uint8_t> second = MakeState(RewindCompressor::BlockSize, 4);
+	vector<uint8_t> userData = {1, 2, 3, 4, 5};
+	{
+		RewindArchive archive(filename);
+		shared_ptr<RewindStateBlocks> state = compressor.Enqueue(vector<uint8_t>(first), nullptr);
+		uint32_t index;
+		ASSERT_TRUE(archive.Append(*state, index));
+		ASSERT_TRUE(archive.Seal("rom:state", userData));
+		EXPECT_FALSE(archive.Append(*state, index));
+	}
+	ASSERT_TRUE(std::filesystem::exists(filename));
+	EXPECT_EQ(RewindArchive::ReadSealedKey(filename), "rom:state");
+
+	{
+		vector<uint8_t> restoredData;
+		shared_ptr<RewindArchive> archive = RewindArchive::OpenSealed(filename, restoredData);
+		ASSERT_NE(archive, nullptr);
+		EXPECT_EQ(restoredData, userData);
+		ASSERT_EQ(archive->GetCount(), 1u);
+
+		// New states go after the previous index, old states are read from the mapped file
+		shared_ptr<RewindStateBlocks> state = compressor.Enqueue(vector<uint8_t>(second), nullptr);
+		uint32_t index;
+		ASSERT_TRUE(archive->Append(*state, index));
+		EXPECT_EQ(index, 1u);
+
+		vector<uint8_t> decoded;
+		ASSERT_TRUE(archive->Decode(0, decoded));
+		EXPECT_EQ(decoded, first);
+		ASSERT_TRUE(archive->Decode(1, decoded));
+		EXPECT_EQ(decoded, second);
+		ASSERT_TRUE(archive->Seal("rom:state2", {}));
+	}
+	EXPECT_EQ(RewindArchive::ReadSealedKey(filename), "rom:state2");
+
+	{
+		vector<uint8_t> restoredData;
+		shared_ptr<RewindArchive> archive = RewindArchive::OpenSealed(filename, restoredData);
+		ASSERT_NE(archive, nullptr);
+		EXPECT_TRUE(restoredData.empty());
+		vector<uint8_t> decoded;
+		ASSERT_TRUE(archive->Decode(1, decoded));
+		EXPECT_EQ(decoded, second);
+	}
+
+	// Not sealed again, deleted like a regular archive
+	EXPECT_FALSE(std::filesystem::exists(filename));
+	EXPECT_EQ(RewindArchive::ReadSealedKey(filename), "");
+}
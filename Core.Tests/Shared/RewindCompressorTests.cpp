@@ -0,0 +1,113 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <vector>
+#include "Shared/RewindCompressor.h"
+
+// =============================================================================
+// RewindCompressor Unit Tests
+// =============================================================================
+// Tests for the background block compressor used by the rewind history.
+
+namespace {
+	vector<uint8_t> MakeState(uint32_t size, uint8_t seed) {
+		vector<uint8_t> data(size);
+		for (uint32_t i = 0; i < size; i++) {
+			data[i] = (uint8_t)(i * 7 + seed);
+		}
+		return data;
+	}
+}
+
+TEST(RewindCompressorTest, DecodeRoundTrip) {
+	RewindCompressor compressor;
+	vector<uint8_t> original = MakeState(RewindCompressor::BlockSize * 3 + 123, 1);
+
+	shared_ptr<RewindStateBlocks> state = compressor.Enqueue(vector<uint8_t>(original), nullptr);
+
+	vector<uint8_t> decoded;
+	ASSERT_TRUE(RewindCompressor::Decode(*state, decoded));
+	EXPECT_EQ(decoded, original);
+	EXPECT_EQ(state->Blocks.size(), 4u);
+}
+
+TEST(RewindCompressorTest, UnchangedBlocksAreShared) {
+	RewindCompressor compressor;
+	vector<uint8_t> first = MakeState(RewindCompressor::BlockSize * 4, 1);
+	vector<uint8_t> second = first;
+	second[RewindCompressor::BlockSize * 2 + 5] ^= 0xff;
+
+	shared_ptr<RewindStateBlocks> s1 = compressor.Enqueue(vector<uint8_t>(first), nullptr);
+	shared_ptr<RewindStateBlocks> s2 = compressor.Enqueue(vector<uint8_t>(second), s1);
+
+	vector<uint8_t> decoded;
+	ASSERT_TRUE(RewindCompressor::Decode(*s2, decoded));
+	EXPECT_EQ(decoded, second);
+
+	EXPECT_EQ(s1->Blocks[0], s2->Blocks[0]);
+	EXPECT_EQ(s1->Blocks[1], s2->Blocks[1]);
+	EXPECT_NE(s1->Blocks[2], s2->Blocks[2]);
+	EXPECT_EQ(s1->Blocks[3], s2->Blocks[3]);
+	EXPECT_EQ(s2->OwnedBytes, (uint32_t)s2->Blocks[2]->size());
+}
+
+TEST(RewindCompressorTest, NoDedupAgainstUnrelatedPredecessor) {
+	RewindCompressor compressor;
+	vector<uint8_t> data = MakeState(RewindCompressor::BlockSize * 2, 3);
+
+	shared_ptr<RewindStateBlocks> s1 = compressor.Enqueue(vector<uint8_t>(data), nullptr);
+	shared_ptr<RewindStateBlocks> s2 = compressor.Enqueue(vector<uint8_t>(data), s1);
+
+	// s1 is not the last state processed anymore (e.g. after a rewind), s3 must be stored in full
+	shared_ptr<RewindStateBlocks> s3 = compressor.Enqueue(vector<uint8_t>(data), s1);
+	RewindCompressor::Wait(*s3);
+	EXPECT_NE(s3->Blocks[0], s1->Blocks[0]);
+	EXPECT_GT(s3->OwnedBytes, 0u);
+}
+
+TEST(RewindCompressorTest, InheritSharedBlocksTransfersOwnership) {
+	RewindCompressor compressor;
+	vector<uint8_t> first = MakeState(RewindCompressor::BlockSize * 2, 1);
+	vector<uint8_t> second = first;
+	second[0] ^= 0xff;
+
+	shared_ptr<RewindStateBlocks> s1 = compressor.Enqueue(vector<uint8_t>(first), nullptr);
+	shared_ptr<RewindStateBlocks> s2 = compressor.Enqueue(vector<uint8_t>(second), s1);
+	RewindCompressor::Wait(*s2);
+
+	uint32_t ownedBefore = s2->OwnedBytes;
+	uint32_t transferred = RewindCompressor::InheritSharedBlocks(*s2, *s1);
+	EXPECT_EQ(transferred, (uint32_t)s1->Blocks[1]->size());
+	EXPECT_EQ(s2->OwnedBytes, ownedBefore + transferred);
+}
+
+TEST(RewindCompressorTest, DecodeCacheMatchesFullDecode) {
+	RewindCompressor compressor;
+	vector<uint8_t> first = MakeState(RewindCompressor::BlockSize * 4 + 77, 1);
+	vector<uint8_t> second = first;
+	second[RewindCompressor::BlockSize + 3] ^= 0xff;
+	vector<uint8_t> unrelated = MakeState(RewindCompressor::BlockSize * 2, 9);
+
+	shared_ptr<RewindStateBlocks> s1 = compressor.Enqueue(vector<uint8_t>(first), nullptr);
+	shared_ptr<RewindStateBlocks> s2 = compressor.Enqueue(vector<uint8_t>(second), s1);
+	shared_ptr<RewindStateBlocks> s3 = compressor.Enqueue(vector<uint8_t>(unrelated), nullptr);
+
+	// Back and forth between states sharing blocks, then a state of another size
+	RewindDecodeCache cache;
+	ASSERT_TRUE(RewindCompressor::Decode(s2, cache));
+	EXPECT_EQ(cache.Data, second);
+	ASSERT_TRUE(RewindCompressor::Decode(s1, cache));
+	EXPECT_EQ(cache.Data, first);
+	ASSERT_TRUE(RewindCompressor::Decode(s1, cache));
+	EXPECT_EQ(cache.Data, first);
+	ASSERT_TRUE(RewindCompressor::Decode(s2, cache));
+	EXPECT_EQ(cache.Data, second);
+	ASSERT_TRUE(RewindCompressor::Decode(s3, cache));
+	EXPECT_EQ(cache.Data, unrelated);
+	EXPECT_EQ(cache.State, s3);
+
+	// A cleared cache decodes every block
+	cache.Data.assign(cache.Data.size(), 0);
+	cache.Clear();
+	ASSERT_TRUE(RewindCompressor::Decode(s3, cache));
+	EXPECT_EQ(cache.Data, unrelated);
+}
@@ -0,0 +1,204 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <vector>
+#include "Shared/RunAheadSnapshot.h"
+#include "Utilities/Serializer.h"
+
+// =============================================================================
+// RunAheadSnapshot Unit Tests
+// =============================================================================
+// Tests for the page-tracked RAM snapshot used by run-ahead.
+
+namespace {
+	/// <summary>Mock console with a large RAM block and scalar state</summary>
+	class MockRunAheadConsole : public ISerializable {
+	public:
+		vector<uint8_t> workRam = vector<uint8_t>(0x8000, 0);
+		uint8_t smallRegs[16] = {};
+		uint32_t pc = 0;
+
+		void Serialize(Serializer& s) override {
+			SVArray(workRam.data(), (uint32_t)workRam.size());
+			SVArray(smallRegs, 16);
+			SV(pc);
+		}
+
+		vector<SerializeValue> GetBlocks() {
+			return {SerializeValue(workRam.data(), (uint32_t)workRam.size())};
+		}
+	};
+
+	void SaveSnapshot(RunAheadSnapshot& snapshot, Serializer& s, MockRunAheadConsole& console) {
+		s.ResetForFastSave(1);
+		snapshot.BeginSave(s, console.GetBlocks());
+		s.Stream(console, "");
+		snapshot.EndSave(s);
+	}
+
+	void LoadSnapshot(RunAheadSnapshot& snapshot, Serializer& s, MockRunAheadConsole& console) {
+		snapshot.Restore();
+		s.ResetForFastLoad();
+		s.Stream(console, "");
+	}
+}
+
+TEST(RunAheadSnapshotTest, RoundTripRestoresRamAndScalars) {
+	MockRunAheadConsole console;
+	console.workRam[0x10] = 0x42;
+	console.smallRegs[3] = 0x99;
+	console.pc = 0x8000;
+
+	Serializer s;
+	RunAheadSnapshot snapshot;
+	SaveSnapshot(snapshot, s, console);
+
+	console.workRam[0x10] = 0x00;
+	console.workRam[0x7fff] = 0xff;
+	console.smallRegs[3] = 0x00;
+	console.pc = 0x1234;
+
+	LoadSnapshot(snapshot, s, console);
+	EXPECT_EQ(console.workRam[0x10], 0x42);
+	EXPECT_EQ(console.workRam[0x7fff], 0x00);
+	EXPECT_EQ(console.smallRegs[3], 0x99);
+	EXPECT_EQ(console.pc, 0x8000u);
+}
+
+TEST(RunAheadSnapshotTest, LargeBlockIsNotSerialized) {
+	MockRunAheadConsole console;
+	Serializer s;
+	RunAheadSnapshot snapshot;
+	SaveSnapshot(snapshot, s, console);
+
+	// Only the small array and the scalar go through the serializer
+	EXPECT_EQ(s.GetData().size(), 16u + sizeof(uint32_t));
+}
+
+TEST(RunAheadSnapshotTest, OnlyDirtyPagesAreCopied) {
+	MockRunAheadConsole console;
+	Serializer s;
+	RunAheadSnapshot snapshot;
+
+	// First save copies every page
+	SaveSnapshot(snapshot, s, console);
+	EXPECT_EQ(snapshot.GetCopiedPageCount(), 8u);
+
+	// Touch two pages
+	console.workRam[0x0001] = 1;
+	console.workRam[0x5001] = 1;
+	SaveSnapshot(snapshot, s, console);
+	EXPECT_EQ(snapshot.GetCopiedPageCount(), 2u);
+
+	// Touch one page, restore only that page
+	console.workRam[0x3000] = 7;
+	LoadSnapshot(snapshot, s, console);
+	EXPECT_EQ(snapshot.GetCopiedPageCount(), 1u);
+	EXPECT_EQ(console.workRam[0x3000], 0);
+	EXPECT_EQ(console.workRam[0x5001], 1);
+}
+
+TEST(RunAheadSnapshotTest, UnstreamedBlocksAreIgnored) {
+	MockRunAheadConsole console;
+	vector<uint8_t> unrelated(0x2000, 0x55);
+
+	Serializer s;
+	RunAheadSnapshot snapshot;
+	s.ResetForFastSave(1);
+	vector<SerializeValue> blocks = console.GetBlocks();
+	blocks.emplace_back(unrelated.data(), (uint32_t)unrelated.size());
+	snapshot.BeginSave(s, std::move(blocks));
+	s.Stream(console, "");
+	snapshot.EndSave(s);
+
+	unrelated[0] = 0;
+	LoadSnapshot(snapshot, s, console);
+	EXPECT_EQ(unrelated[0], 0);
+}
+
+TEST(RunAheadSnapshotTest, MatchesDetectsRamAndScalarChanges) {
+	MockRunAheadConsole console;
+	console.workRam[0x100] = 0x12;
+	console.pc = 0x8000;
+
+	RunAheadState a;
+	RunAheadState b;
+	SaveSnapshot(a.Ram, a.Data, console);
+	SaveSnapshot(b.Ram, b.Data, console);
+	EXPECT_TRUE(a.Matches(b));
+
+	console.workRam[0x7FFF] = 0x34;
+	SaveSnapshot(b.Ram, b.Data, console);
+	EXPECT_FALSE(a.Matches(b));
+
+	console.workRam[0x7FFF] = 0;
+	console.pc = 0x8001;
+	SaveSnapshot(b.Ram, b.Data, console);
+	EXPECT_FALSE(a.Matches(b));
+}
+
+TEST(RunAheadSnapshotTest, ChecksumFollowsStateContent) {
+	MockRunAheadConsole console;
+	console.workRam[0x200] = 0x56;
+
+	RunAheadState a;
+	RunAheadState b;
+	SaveSnapshot(a.Ram, a.Data, console);
+	SaveSnapshot(b.Ram, b.Data, console);
+	EXPECT_EQ(a.GetChecksum(), b.GetChecksum());
+
+	console.workRam[0x6000] = 0x78;
+	SaveSnapshot(b.Ram, b.Data, console);
+	EXPECT_NE(a.GetChecksum(), b.GetChecksum());
+
+	console.workRam[0x6000] = 0;
+	console.pc = 0x9000;
+	SaveSnapshot(b.Ram, b.Data, console);
+	EXPECT_NE(a.GetChecksum(), b.GetChecksum());
+}
+
+TEST(RunAheadSnapshotTest, CompressedSnapshotRestoresRam) {
+	MockRunAheadConsole console;
+	console.workRam[0x10] = 0x42;
+	console.workRam[0x7ffe] = 0x24;
+
+	Serializer s;
+	RunAheadSnapshot snapshot;
+	SaveSnapshot(snapshot, s, console);
+	size_t uncompressedSize = snapshot.GetMemoryUsage();
+
+	snapshot.Compress();
+	EXPECT_TRUE(snapshot.IsCompressed());
+	EXPECT_LT(snapshot.GetMemoryUsage(), uncompressedSize);
+
+	console.workRam[0x10] = 0;
+	console.workRam[0x3000] = 0x99;
+	LoadSnapshot(snapshot, s, console);
+	EXPECT_EQ(console.workRam[0x10], 0x42);
+	EXPECT_EQ(console.workRam[0x3000], 0);
+	EXPECT_EQ(console.workRam[0x7ffe], 0x24);
+	EXPECT_EQ(snapshot.GetCopiedPageCount(), 2u);
+
+	// Still compressed after a restore, can be restored again
+	EXPECT_TRUE(snapshot.IsCompressed());
+	console.workRam[0x7ffe] = 0;
+	LoadSnapshot(snapshot, s, console);
+	EXPECT_EQ(console.workRam[0x7ffe], 0x24);
+}
+
+TEST(RunAheadSnapshotTest, SaveAfterCompressDecompresses) {
+	MockRunAheadConsole console;
+	Serializer s;
+	RunAheadSnapshot snapshot;
+	SaveSnapshot(snapshot, s, console);
+	snapshot.Compress();
+
+	console.workRam[0x5000] = 0x11;
+	SaveSnapshot(snapshot, s, console);
+	EXPECT_FALSE(snapshot.IsCompressed());
+	EXPECT_EQ(snapshot.GetCopiedPageCount(), 1u);
+	EXPECT_EQ(snapshot.GetMemoryUsage(), console.workRam.size());
+
+	console.workRam[0x5000] = 0;
+	LoadSnapshot(snapshot, s, console);
+	EXPECT_EQ(console.workRam[0x5000], 0x11);
+}
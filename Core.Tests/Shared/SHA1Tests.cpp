@@ -0,0 +1,49 @@
+#include "pch.h"
+#include "Utilities/sha1.h"
+
+// =============================================================================
+// SHA1 Unit Tests
+// =============================================================================
+// Tests for the SHA-1 hash used for ROM identification (hardware accelerated when the CPU supports it).
+
+TEST(SHA1Test, KnownVectors) {
+	EXPECT_EQ(SHA1::GetHash((const uint8_t*)"", 0), "DA39A3EE5E6B4B0D3255BFEF95601890AFD80709");
+	EXPECT_EQ(SHA1::GetHash((const uint8_t*)"abc", 3), "A9993E364706816ABA3E25717850C26C9CD0D89D");
+
+	std::string twoBlocks = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+	EXPECT_EQ(SHA1::GetHash((const uint8_t*)twoBlocks.data(), twoBlocks.size()), "84983E441C3BD26EBAAE4AA1F95129E5E54670F1");
+}
+
+TEST(SHA1Test, MillionA) {
+	std::vector<uint8_t> data(1000000, 'a');
+	EXPECT_EQ(SHA1::GetHash(data), "34AA973CD4C4DAA4F61EEB2BDBAD27316534016F");
+}
+
+TEST(SHA1Test, StreamAndBufferHashesMatch) {
+	std::vector<uint8_t> data(5000);
+	for (size_t i = 0; i < data.size(); i++) {
+		data[i] = (uint8_t)(i * 31 + (i >> 8));
+	}
+
+	for (size_t size : {0, 1, 55, 56, 63, 64, 65, 127, 128, 4999}) {
+		std::stringstream ss;
+		ss.write((const char*)data.data(), size);
+		EXPECT_EQ(SHA1::GetHash(ss), SHA1::GetHash(data.data(), size)) << "size " << size;
+	}
+}
+
+TEST(SHA1Test, IncrementalUpdatesMatchSingleUpdate) {
+	std::vector<uint8_t> data(1000);
+	for (size_t i = 0; i < data.size(); i++) {
+		data[i] = (uint8_t)(i ^ 0x5A);
+	}
+
+	SHA1 checksum;
+	size_t pos = 0;
+	for (size_t chunk = 1; pos < data.size(); chunk = chunk * 2 + 1) {
+		size_t count = std::min(chunk, data.size() - pos);
+		checksum.update(data.data() + pos, count);
+		pos += count;
+	}
+	EXPECT_EQ(checksum.final(), SHA1::GetHash(data));
+}
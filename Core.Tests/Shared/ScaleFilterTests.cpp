@@ -0,0 +1,72 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <vector>
+#include "Utilities/xBRZ/xbrz.h"
+#include "Utilities/HQX/hqx.h"
+#include "Utilities/HQX/common.h"
+
+// =============================================================================
+// Scale Filter Slicing Tests
+// =============================================================================
+// ScaleFilter splits xBRZ/HQX into row slices processed on a worker pool.
+// Slicing must produce exactly the same output as scaling the whole frame.
+
+namespace {
+	constexpr int Width = 64;
+	constexpr int Height = 48;
+
+	vector<uint32_t> MakeFrame() {
+		vector<uint32_t> frame(Width * Height);
+		for (int y = 0; y < Height; y++) {
+			for (int x = 0; x < Width; x++) {
+				// Diagonal edges + blocks, so the scalers have patterns to blend
+				bool on = ((x + y) / 5 + (x / 9) + (y / 7)) & 1;
+				frame[y * Width + x] = on ? 0xFF20C040 : 0xFF802010 + (uint32_t)(x & 3);
+			}
+		}
+		return frame;
+	}
+
+	const int SliceBounds[] = {0, 7, 16, 30, 31, Height};
+}
+
+TEST(ScaleFilterTest, XbrzSlicesMatchFullFrame) {
+	vector<uint32_t> src = MakeFrame();
+	for (size_t scale = 2; scale <= 6; scale++) {
+		vector<uint32_t> full(src.size() * scale * scale);
+		vector<uint32_t> sliced(full.size());
+		xbrz::scale(scale, src.data(), full.data(), Width, Height, xbrz::ColorFormat::ARGB);
+		for (size_t i = 0; i + 1 < std::size(SliceBounds); i++) {
+			xbrz::scale(scale, src.data(), sliced.data(), Width, Height, xbrz::ColorFormat::ARGB, xbrz::ScalerCfg(), SliceBounds[i], SliceBounds[i + 1]);
+		}
+		EXPECT_EQ(full, sliced) << "scale " << scale;
+	}
+}
+
+TEST(ScaleFilterTest, HqxSlicesMatchFullFrame) {
+	hqxInit();
+	vector<uint32_t> src = MakeFrame();
+	for (uint32_t scale = 2; scale <= 4; scale++) {
+		vector<uint32_t> full(src.size() * scale * scale);
+		vector<uint32_t> sliced(full.size());
+		hqx(scale, src.data(), full.data(), Width, Height);
+		for (size_t i = 0; i + 1 < std::size(SliceBounds); i++) {
+			hqx(scale, src.data(), sliced.data(), Width, Height, SliceBounds[i], SliceBounds[i + 1]);
+		}
+		EXPECT_EQ(full, sliced) << "scale " << scale;
+	}
+}
+
+TEST(ScaleFilterTest, HqxYuvTableMatchesFormula) {
+	hqxInit();
+	for (uint32_t c = 0; c < 0xFFFFFF; c += 13) {
+		uint32_t r = (c & 0xFF0000) >> 16;
+		uint32_t g = (c & 0x00FF00) >> 8;
+		uint32_t b = c & 0x0000FF;
+		uint32_t y = (uint32_t)(int32_t)(0.299 * r + 0.587 * g + 0.114 * b);
+		uint32_t u = (uint32_t)(int32_t)(-0.169 * r - 0.331 * g + 0.5 * b) + 128;
+		uint32_t v = (uint32_t)(int32_t)(0.5 * r - 0.419 * g - 0.081 * b) + 128;
+		ASSERT_EQ(RGBtoYUV[c], (y << 16) + (u << 8) + v) << "color " << c;
+	}
+	EXPECT_EQ(RGBtoYUV[0xFFFFFF], 0u);
+}
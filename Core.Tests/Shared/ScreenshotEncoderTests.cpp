@@ -0,0 +1,102 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include "Shared/Video/ScreenshotEncoder.h"
+
+// =============================================================================
+// ScreenshotEncoder Unit Tests
+// =============================================================================
+// Thumbnail downscaling and the background queue (with unfiltered requests, which
+// don't need an emulator instance).
+
+static ScreenshotRequest GetRequest(uint32_t width, uint32_t height, uint32_t color) {
+	ScreenshotRequest request;
+	request.FrameBuffer.assign((size_t)width * height, color);
+	request.Frame = {width, height};
+	return request;
+}
+
+static bool IsPng(const string& data) {
+	return data.size() > 8 && (uint8_t)data[0] == 0x89 && data.substr(1, 3) == "PNG";
+}
+
+TEST(ScreenshotEncoderTest, DownscaleAveragesBlocks) {
+	// 4x2 image, each 2x2 block averages to a single color
+	uint32_t src[8] = {
+	    0xFF000000, 0xFF0000FF, 0xFF102030, 0xFF102030,
+	    0xFF000000, 0xFF0000FF, 0xFF102030, 0xFF102030};
+	vector<uint32_t> dst;
+	ScreenshotEncoder::Downscale(src, 4, 2, 2, dst);
+
+	ASSERT_EQ(dst.size(), 2u);
+	EXPECT_EQ(dst[0], 0xFF00007Fu);
+	EXPECT_EQ(dst[1], 0xFF102030u);
+}
+
+TEST(ScreenshotEncoderTest, DownscaleDropsPartialBlocks) {
+	vector<uint32_t> src(7 * 5, 0xFFFFFFFF);
+	vector<uint32_t> dst;
+	ScreenshotEncoder::Downscale(src.data(), 7, 5, 2, dst);
+	EXPECT_EQ(dst.size(), 3u * 2u);
+}
+
+TEST(ScreenshotEncoderTest, EncodeProducesPng) {
+	ScreenshotRequest request = GetRequest(16, 8, 0xFF336699);
+	std::stringstream png;
+	ASSERT_TRUE(ScreenshotEncoder::Encode(nullptr, request, png));
+	EXPECT_TRUE(IsPng(png.str()));
+}
+
+TEST(ScreenshotEncoderTest, EncodeFailsWithoutFrame) {
+	ScreenshotRequest request;
+	std::stringstream png;
+	EXPECT_FALSE(ScreenshotEncoder::Encode(nullptr, request, png));
+}
+
+TEST(ScreenshotEncoderTest, FastCompressionProducesPng) {
+	ScreenshotRequest request = GetRequest(64, 64, 0xFF000000);
+	request.CompressionLevel = PNGHelper::FastCompressionLevel;
+	std::stringstream png;
+	ASSERT_TRUE(ScreenshotEncoder::Encode(nullptr, request, png));
+
+	string encoded = png.str();
+	vector<uint8_t> data(encoded.begin(), encoded.end());
+	vector<uint32_t> pixels;
+	uint32_t width = 0, height = 0;
+	ASSERT_TRUE(PNGHelper::ReadPNG(data, pixels, width, height));
+	EXPECT_EQ(width, 64u);
+	EXPECT_EQ(height, 64u);
+}
+
+TEST(ScreenshotEncoderTest, QueuedRequestsAreAllEncoded) {
+	std::atomic<uint32_t> encodedCount = 0;
+	std::atomic<uint32_t> thumbnailCount = 0;
+	{
+		ScreenshotEncoder encoder(nullptr);
+		for (uint32_t i = 0; i < ScreenshotEncoder::MaxPendingRequests * 3; i++) {
+			ScreenshotRequest request = GetRequest(256, 960, 0xFF808080);
+			request.MaxHeight = 240;
+			request.OnEncoded = [&](std::stringstream& png) {
+				string encoded = png.str();
+				vector<uint8_t> data(encoded.begin(), encoded.end());
+				vector<uint32_t> pixels;
+				uint32_t width = 0, height = 0;
+				if (PNGHelper::ReadPNG(data, pixels, width, height) && width == 64 && height == 240) {
+					thumbnailCount++;
+				}
+				encodedCount++;
+			};
+			encoder.Enqueue(std::move(request));
+		}
+
+		encoder.WaitForIdle();
+		EXPECT_EQ(encodedCount, ScreenshotEncoder::MaxPendingRequests * 3);
+
+		// Pending requests are still encoded when the encoder is destroyed
+		ScreenshotRequest request = GetRequest(8, 8, 0);
+		request.OnEncoded = [&](std::stringstream&) { encodedCount++; };
+		encoder.Enqueue(std::move(request));
+	}
+	EXPECT_EQ(encodedCount, ScreenshotEncoder::MaxPendingRequests * 3 + 1);
+	EXPECT_EQ(thumbnailCount, ScreenshotEncoder::MaxPendingRequests * 3);
+}
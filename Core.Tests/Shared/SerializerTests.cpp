@@ -632,3 +632,358 @@ TEST_F(SerializerTest, Array_Uint32Array) {
 
 	EXPECT_EQ(original, loaded);
 }
+
+// =============================================================================
+// Positional Record Matching Tests
+// =============================================================================
+
+TEST_F(SerializerTest, Records_OutOfOrderLoadFallsBackToKeys) {
+	uint32_t a = 1, b = 2, c = 3;
+
+	Serializer saver(1, true, SerializeFormat::Binary);
+	saver.Stream(a, "a");
+	saver.Stream(b, "b");
+	saver.Stream(c, "c");
+
+	std::stringstream ss;
+	saver.SaveTo(ss);
+
+	// Read back in a different order, with an unknown key in the middle
+	uint32_t la = 0, lb = 0, lc = 0, missing = 42;
+	ss.seekg(0);
+	Serializer loader(1, false, SerializeFormat::Binary);
+	ASSERT_TRUE(loader.LoadFrom(ss));
+	loader.Stream(lc, "c");
+	loader.Stream(missing, "missing");
+	loader.Stream(la, "a");
+	loader.Stream(lb, "b");
+
+	EXPECT_EQ(la, 1u);
+	EXPECT_EQ(lb, 2u);
+	EXPECT_EQ(lc, 3u);
+	EXPECT_EQ(missing, 42u);
+}
+
+TEST_F(SerializerTest, Records_ContainsKeyDoesNotConsumeRecord) {
+	uint8_t a = 7;
+	Serializer saver(1, true, SerializeFormat::Binary);
+	saver.Stream(a, "a");
+
+	std::stringstream ss;
+	saver.SaveTo(ss);
+
+	uint8_t loaded = 0;
+	ss.seekg(0);
+	Serializer loader(1, false, SerializeFormat::Binary);
+	ASSERT_TRUE(loader.LoadFrom(ss));
+	EXPECT_TRUE(loader.ContainsKey("a"));
+	EXPECT_FALSE(loader.ContainsKey("b"));
+	loader.Stream(loaded, "a");
+	EXPECT_EQ(loaded, 7);
+}
+
+TEST_F(SerializerTest, Records_KeyPrefixRemapsRecords) {
+	MockCpuState original;
+	original.pc = 0x1234;
+	original.a = 0x56;
+
+	Serializer saver(1, true, SerializeFormat::Binary);
+	saver.Stream(original, "cpu");
+
+	std::stringstream ss;
+	saver.SaveTo(ss);
+
+	MockCpuState loaded;
+	ss.seekg(0);
+	Serializer loader(1, false, SerializeFormat::Binary);
+	ASSERT_TRUE(loader.LoadFrom(ss));
+	loader.AddKeyPrefix("gb.");
+	loader.Stream(loaded, "gb");
+	EXPECT_EQ(loaded.pc, 0u);
+
+	loader.RemoveKeyPrefix("gb.");
+	loader.Stream(loaded, "cpu");
+	EXPECT_EQ(loaded, original);
+}
+
+TEST_F(SerializerTest, LoadFromBuffer_MatchesStreamLoad) {
+	MockCpuState original;
+	original.pc = 0xbeef;
+	original.a = 0x12;
+
+	Serializer saver(1, true, SerializeFormat::Binary);
+	saver.Stream(original, "cpu");
+
+	MockCpuState loaded;
+	Serializer loader(1, false, SerializeFormat::Binary);
+	ASSERT_TRUE(loader.LoadFromBuffer(saver.GetData()));
+	loader.Stream(loaded, "cpu");
+	EXPECT_EQ(loaded, original);
+}
+
+TEST_F(SerializerTest, LoadFromBuffer_RejectsInvalidData) {
+	vector<uint8_t> garbage = {0x01, 0x02, 0x03};
+	Serializer loader(1, false, SerializeFormat::Binary);
+	EXPECT_FALSE(loader.LoadFromBuffer(garbage));
+}
+
+// =============================================================================
+// Map Format Key Filter Tests
+// =============================================================================
+
+namespace {
+	/// <summary>Counts how many times the object was streamed</summary>
+	class MockCountedState : public ISerializable {
+	public:
+		uint16_t value = 0;
+		int serializeCount = 0;
+
+		void Serialize(Serializer& s) override {
+			serializeCount++;
+			SV(value);
+		}
+	};
+
+	class MockFilteredConsole : public ISerializable {
+	public:
+		MockCpuState cpu;
+		MockCountedState ppu;
+
+		void Serialize(Serializer& s) override {
+			SV(cpu);
+			SV(ppu);
+		}
+	};
+}
+
+TEST_F(SerializerTest, MapFormat_KeyFilterSkipsOtherObjects) {
+	MockFilteredConsole console;
+	console.cpu.a = 0x42;
+	console.cpu.x = 0x10;
+	console.ppu.value = 123;
+
+	Serializer saver(0, true, SerializeFormat::Map);
+	saver.SetKeyFilter({"cpu.a"});
+	saver.Stream(console, "", -1);
+
+	auto& values = saver.GetMapValues();
+	ASSERT_EQ(values.size(), 1u);
+	EXPECT_EQ(values.find("cpu.a")->second.Value.Integer, 0x42);
+	EXPECT_EQ(console.ppu.serializeCount, 0);
+
+	Serializer allSaver(0, true, SerializeFormat::Map);
+	allSaver.Stream(console, "", -1);
+	EXPECT_EQ(console.ppu.serializeCount, 1);
+	EXPECT_EQ(allSaver.GetMapValues().find("ppu.value")->second.Value.Integer, 123);
+	EXPECT_GT(allSaver.GetMapValues().size(), values.size());
+}
+
+TEST_F(SerializerTest, MapFormat_KeyFilterOnlyLoadsFilteredKeys) {
+	MockFilteredConsole console;
+	unordered_map<string, SerializeMapValue> map;
+	map.try_emplace("cpu.a", SerializeMapValueFormat::Integer, (int64_t)0x33);
+	map.try_emplace("cpu.x", SerializeMapValueFormat::Integer, (int64_t)0x44);
+	map.try_emplace("ppu.value", SerializeMapValueFormat::Integer, (int64_t)500);
+
+	Serializer loader(0, false, SerializeFormat::Map);
+	loader.SetKeyFilter({"cpu.x", "ppu."});
+	loader.LoadFromMap(map);
+	loader.Stream(console, "", -1);
+
+	EXPECT_EQ(console.cpu.a, 0);
+	EXPECT_EQ(console.cpu.x, 0x44);
+	EXPECT_EQ(console.ppu.value, 500);
+	EXPECT_EQ(console.ppu.serializeCount, 1);
+}
+
+// =============================================================================
+// POD State Blocks
+// =============================================================================
+
+struct MockPodState {
+	uint64_t CycleCount = 0;
+	uint16_t PC = 0;
+	uint8_t A = 0;
+	bool Halted = false;
+	uint8_t Regs[4] = {};
+};
+
+/// <summary>Streams its state as a block</summary>
+class MockPodComponent : public ISerializable {
+public:
+	MockPodState _state;
+	uint32_t extra = 0;
+
+	void Serialize(Serializer& s) override {
+		s.StreamPod(_state, "_state", [&]() {
+			SV(_state.CycleCount);
+			SV(_state.PC);
+			SV(_state.A);
+			SV(_state.Halted);
+			SVArray(_state.Regs, 4);
+		});
+		SV(extra);
+	}
+};
+
+/// <summary>Same state, streamed field by field (states saved before the block existed)</summary>
+class MockLegacyPodComponent : public ISerializable {
+public:
+	MockPodState _state;
+	uint32_t extra = 0;
+
+	void Serialize(Serializer& s) override {
+		SV(_state.CycleCount);
+		SV(_state.PC);
+		SV(_state.A);
+		SV(_state.Halted);
+		SVArray(_state.Regs, 4);
+		SV(extra);
+	}
+};
+
+struct MockPodStateV2 {
+	uint8_t A = 0;
+	uint32_t NewField = 0;
+	uint64_t CycleCount = 0;
+	uint32_t PC = 0; ///< Size changed
+};
+
+/// <summary>Later version of MockPodComponent's layout (fields moved, added, resized and removed)</summary>
+class MockPodComponentV2 : public ISerializable {
+public:
+	MockPodStateV2 _state;
+
+	void Serialize(Serializer& s) override {
+		s.StreamPod(_state, "_state", [&]() {
+			SV(_state.CycleCount);
+			SV(_state.PC);
+			SV(_state.A);
+			SV(_state.NewField);
+		});
+	}
+};
+
+/// <summary>Field-wise code that streams a value outside of the block</summary>
+class MockInvalidPodComponent : public ISerializable {
+public:
+	MockPodState _state;
+	uint32_t _outside = 0;
+
+	void Serialize(Serializer& s) override {
+		s.StreamPod(_state, "_state", [&]() {
+			SV(_state.PC);
+			SV(_outside);
+		});
+	}
+};
+
+static MockPodComponent MakePodComponent() {
+	MockPodComponent c;
+	c._state.CycleCount = 0x123456789a;
+	c._state.PC = 0x8123;
+	c._state.A = 0x42;
+	c._state.Halted = true;
+	c._state.Regs[2] = 0x77;
+	c.extra = 99;
+	return c;
+}
+
+static void ExpectSameState(const MockPodState& a, const MockPodState& b) {
+	EXPECT_EQ(a.CycleCount, b.CycleCount);
+	EXPECT_EQ(a.PC, b.PC);
+	EXPECT_EQ(a.A, b.A);
+	EXPECT_EQ(a.Halted, b.Halted);
+	EXPECT_EQ(memcmp(a.Regs, b.Regs, sizeof(a.Regs)), 0);
+}
+
+TEST_F(SerializerTest, PodBlock_BinaryRoundtripUsesSingleRecord) {
+	MockPodComponent original = MakePodComponent();
+	Serializer saver(1, true, SerializeFormat::Binary);
+	saver.Stream(original, "cpu");
+
+	MockPodComponent loaded;
+	Serializer loader(1, false, SerializeFormat::Binary);
+	ASSERT_TRUE(loader.LoadFromBuffer(saver.GetData()));
+	EXPECT_TRUE(loader.ContainsKey("cpu.state"));
+	EXPECT_FALSE(loader.ContainsKey("cpu.pc"));
+	loader.Stream(loaded, "cpu");
+
+	ExpectSameState(loaded._state, original._state);
+	EXPECT_EQ(loaded.extra, 99u);
+}
+
+TEST_F(SerializerTest, PodBlock_FastBinaryRoundtrip) {
+	MockPodComponent original = MakePodComponent();
+	Serializer s;
+	s.ResetForFastSave(1);
+	s.Stream(original, "cpu");
+	EXPECT_EQ(s.GetBuffer().size(), sizeof(MockPodState) + sizeof(uint32_t));
+
+	MockPodComponent loaded;
+	s.ResetForFastLoad();
+	s.Stream(loaded, "cpu");
+	ExpectSameState(loaded._state, original._state);
+	EXPECT_EQ(loaded.extra, 99u);
+}
+
+TEST_F(SerializerTest, PodBlock_LoadsFieldWiseStates) {
+	MockLegacyPodComponent legacy;
+	legacy._state = MakePodComponent()._state;
+	legacy.extra = 5;
+	Serializer saver(1, true, SerializeFormat::Binary);
+	saver.Stream(legacy, "cpu");
+
+	MockPodComponent loaded;
+	Serializer loader(1, false, SerializeFormat::Binary);
+	ASSERT_TRUE(loader.LoadFromBuffer(saver.GetData()));
+	loader.Stream(loaded, "cpu");
+	ExpectSameState(loaded._state, legacy._state);
+	EXPECT_EQ(loaded.extra, 5u);
+}
+
+TEST_F(SerializerTest, PodBlock_MigratesMatchingFieldsWhenLayoutChanges) {
+	MockPodComponent original = MakePodComponent();
+	Serializer saver(1, true, SerializeFormat::Binary);
+	saver.Stream(original, "cpu");
+
+	MockPodComponentV2 loaded;
+	loaded._state.PC = 0xAAAA;
+	loaded._state.NewField = 0x1234;
+	Serializer loader(1, false, SerializeFormat::Binary);
+	ASSERT_TRUE(loader.LoadFromBuffer(saver.GetData()));
+	loader.Stream(loaded, "cpu");
+
+	EXPECT_EQ(loaded._state.CycleCount, original._state.CycleCount);
+	EXPECT_EQ(loaded._state.A, original._state.A);
+	// Resized and new fields keep their current value
+	EXPECT_EQ(loaded._state.PC, 0xAAAAu);
+	EXPECT_EQ(loaded._state.NewField, 0x1234u);
+}
+
+TEST_F(SerializerTest, PodBlock_MapFormatUsesFields) {
+	MockPodComponent original = MakePodComponent();
+	Serializer saver(0, true, SerializeFormat::Map);
+	saver.Stream(original, "cpu");
+
+	auto& values = saver.GetMapValues();
+	EXPECT_EQ(values.find("cpu.pc")->second.Value.Integer, 0x8123);
+	EXPECT_EQ(values.find("cpu.a")->second.Value.Integer, 0x42);
+	EXPECT_EQ(values.find("cpu.state"), values.end());
+}
+
+TEST_F(SerializerTest, PodBlock_FieldsOutsideBlockFallBackToFields) {
+	MockInvalidPodComponent original;
+	original._state.PC = 0x1234;
+	original._outside = 0x55;
+	Serializer saver(1, true, SerializeFormat::Binary);
+	saver.Stream(original, "cpu");
+
+	MockInvalidPodComponent loaded;
+	Serializer loader(1, false, SerializeFormat::Binary);
+	ASSERT_TRUE(loader.LoadFromBuffer(saver.GetData()));
+	EXPECT_FALSE(loader.ContainsKey("cpu.state"));
+	loader.Stream(loaded, "cpu");
+	EXPECT_EQ(loaded._state.PC, 0x1234);
+	EXPECT_EQ(loaded._outside, 0x55u);
+}
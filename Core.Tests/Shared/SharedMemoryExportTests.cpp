@@ -0,0 +1,134 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include "Shared/SharedMemoryExport.h"
+#include "Shared/RenderedFrame.h"
+
+// =============================================================================
+// SharedMemoryExport Unit Tests
+// =============================================================================
+// Producer and consumer sides of the shared memory export, opened in the same
+// process (the consumer maps the block by name, like an external tool would).
+
+static string GetTestBlockName(const char* test) {
+	return string("NexenTest_") + test + "_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+}
+
+TEST(SharedMemoryExportTest, ReaderSeesHeader) {
+	string name = GetTestBlockName("Header");
+	SharedMemoryExport exporter;
+	ASSERT_TRUE(exporter.Start(name));
+
+	SharedMemoryExportReader reader;
+	ASSERT_TRUE(reader.Open(name));
+	const SharedExportHeader* header = reader.GetHeader();
+	EXPECT_EQ(header->Magic, SharedExportHeader::MagicValue);
+	EXPECT_EQ(header->Version, SharedExportHeader::CurrentVersion);
+	EXPECT_EQ(header->VideoSlotCount, SharedMemoryExport::VideoSlotCount);
+	EXPECT_EQ(header->AudioOffset, SharedMemoryExport::AudioOffset);
+	EXPECT_EQ(header->VideoSequence.load(), 0u);
+
+	SharedVideoFrameHeader info;
+	vector<uint32_t> pixels;
+	EXPECT_FALSE(reader.ReadLatestFrame(info, pixels));
+}
+
+TEST(SharedMemoryExportTest, OpenFailsForUnknownBlock) {
+	SharedMemoryExportReader reader;
+	EXPECT_FALSE(reader.Open(GetTestBlockName("Missing")));
+}
+
+TEST(SharedMemoryExportTest, FrameRoundTrip) {
+	string name = GetTestBlockName("Frame");
+	SharedMemoryExport exporter;
+	ASSERT_TRUE(exporter.Start(name));
+	SharedMemoryExportReader reader;
+	ASSERT_TRUE(reader.Open(name));
+
+	vector<uint32_t> buffer(256 * 240);
+	for (uint32_t frameIndex = 0; frameIndex < SharedMemoryExport::VideoSlotCount + 2; frameIndex++) {
+		for (size_t i = 0; i < buffer.size(); i++) {
+			buffer[i] = 0xFF000000 | (uint32_t)(i * 7 + frameIndex);
+		}
+		RenderedFrame frame;
+		frame.FrameBuffer = buffer.data();
+		frame.Width = 256;
+		frame.Height = 240;
+		frame.FrameNumber = 100 + frameIndex;
+		exporter.PublishFrame(frame);
+
+		SharedVideoFrameHeader info;
+		vector<uint32_t> pixels;
+		ASSERT_TRUE(reader.ReadLatestFrame(info, pixels));
+		EXPECT_EQ(info.Sequence.load(), frameIndex + 1u);
+		EXPECT_EQ(info.FrameNumber, 100 + frameIndex);
+		EXPECT_EQ(info.Width, 256u);
+		EXPECT_EQ(info.Height, 240u);
+		EXPECT_EQ(info.Pitch, 256u * 4);
+		EXPECT_EQ(pixels, buffer);
+	}
+}
+
+TEST(SharedMemoryExportTest, OversizedFrameIsDropped) {
+	string name = GetTestBlockName("Oversized");
+	SharedMemoryExport exporter;
+	ASSERT_TRUE(exporter.Start(name));
+	SharedMemoryExportReader reader;
+	ASSERT_TRUE(reader.Open(name));
+
+	RenderedFrame frame;
+	frame.FrameBuffer = nullptr;
+	frame.Width = 4096;
+	frame.Height = 4096;
+	exporter.PublishFrame(frame);
+
+	EXPECT_EQ(reader.GetHeader()->DroppedFrames.load(), 1u);
+	EXPECT_EQ(reader.GetHeader()->VideoSequence.load(), 0u);
+}
+
+TEST(SharedMemoryExportTest, AudioIsSplitIntoBlocks) {
+	string name = GetTestBlockName("Audio");
+	SharedMemoryExport exporter;
+	ASSERT_TRUE(exporter.Start(name));
+	SharedMemoryExportReader reader;
+	ASSERT_TRUE(reader.Open(name));
+
+	uint32_t sampleCount = SharedMemoryExport::MaxAudioSamples + 100;
+	vector<int16_t> samples(sampleCount * 2);
+	for (size_t i = 0; i < samples.size(); i++) {
+		samples[i] = (int16_t)(i - 5000);
+	}
+	exporter.PublishAudio(samples.data(), sampleCount, 48000);
+	ASSERT_EQ(reader.GetHeader()->AudioSequence.load(), 2u);
+
+	SharedAudioBlockHeader info;
+	vector<int16_t> block;
+	ASSERT_TRUE(reader.ReadAudioBlock(1, info, block));
+	EXPECT_EQ(info.SampleRate, 48000u);
+	EXPECT_EQ(info.SampleCount, SharedMemoryExport::MaxAudioSamples);
+	EXPECT_TRUE(std::equal(block.begin(), block.end(), samples.begin()));
+
+	ASSERT_TRUE(reader.ReadAudioBlock(2, info, block));
+	EXPECT_EQ(info.SampleCount, 100u);
+	EXPECT_TRUE(std::equal(block.begin(), block.end(), samples.begin() + SharedMemoryExport::MaxAudioSamples * 2));
+
+	EXPECT_FALSE(reader.ReadAudioBlock(3, info, block));
+}
+
+TEST(SharedMemoryExportTest, OverwrittenAudioBlockIsUnavailable) {
+	string name = GetTestBlockName("AudioRing");
+	SharedMemoryExport exporter;
+	ASSERT_TRUE(exporter.Start(name));
+	SharedMemoryExportReader reader;
+	ASSERT_TRUE(reader.Open(name));
+
+	int16_t samples[2] = {1, -1};
+	for (uint32_t i = 0; i < SharedMemoryExport::AudioBlockCount + 1; i++) {
+		exporter.PublishAudio(samples, 1, 44100);
+	}
+
+	SharedAudioBlockHeader info;
+	vector<int16_t> block;
+	EXPECT_FALSE(reader.ReadAudioBlock(1, info, block));
+	EXPECT_TRUE(reader.ReadAudioBlock(2, info, block));
+	EXPECT_TRUE(reader.ReadAudioBlock(SharedMemoryExport::AudioBlockCount + 1, info, block));
+}
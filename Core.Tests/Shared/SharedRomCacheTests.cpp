@@ -0,0 +1,78 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <thread>
+#include <atomic>
+#include "Shared/SharedRomCache.h"
+
+// =============================================================================
+// SharedRomCache Unit Tests
+// =============================================================================
+// Instances asking for the same key share one buffer, which is freed with its last user.
+
+namespace {
+	vector<uint8_t> MakeRom(size_t size, uint8_t seed) {
+		vector<uint8_t> rom(size);
+		for (size_t i = 0; i < size; i++) {
+			rom[i] = (uint8_t)(i * 13 + seed);
+		}
+		return rom;
+	}
+}
+
+TEST(SharedRomCacheTest, SameKeySharesBuffer) {
+	uint32_t loadCount = 0;
+	auto load = [&]() {
+		loadCount++;
+		return MakeRom(1024, 1);
+	};
+
+	shared_ptr<const vector<uint8_t>> a = SharedRomCache::GetOrLoad("SharedRomCacheTest1", load);
+	shared_ptr<const vector<uint8_t>> b = SharedRomCache::GetOrLoad("SharedRomCacheTest1", load);
+	EXPECT_EQ(a.get(), b.get());
+	EXPECT_EQ(loadCount, 1u);
+	EXPECT_EQ(*a, MakeRom(1024, 1));
+
+	shared_ptr<const vector<uint8_t>> c = SharedRomCache::GetOrLoad("SharedRomCacheTest2", [] { return MakeRom(1024, 2); });
+	EXPECT_NE(a.get(), c.get());
+}
+
+TEST(SharedRomCacheTest, BufferIsReleasedWithLastUser) {
+	uint32_t countBefore = SharedRomCache::GetCount();
+	uint32_t loadCount = 0;
+	auto load = [&]() {
+		loadCount++;
+		return MakeRom(256, 3);
+	};
+
+	{
+		shared_ptr<const vector<uint8_t>> a = SharedRomCache::GetOrLoad("SharedRomCacheTest3", load);
+		EXPECT_EQ(SharedRomCache::GetCount(), countBefore + 1);
+	}
+	EXPECT_EQ(SharedRomCache::GetCount(), countBefore);
+
+	// Loaded again once nobody uses it
+	shared_ptr<const vector<uint8_t>> b = SharedRomCache::GetOrLoad("SharedRomCacheTest3", load);
+	EXPECT_EQ(loadCount, 2u);
+}
+
+TEST(SharedRomCacheTest, ConcurrentLoadsLoadOnce) {
+	std::atomic<uint32_t> loadCount = 0;
+	vector<shared_ptr<const vector<uint8_t>>> roms(8);
+	vector<std::thread> threads;
+	for (size_t i = 0; i < roms.size(); i++) {
+		threads.emplace_back([&, i]() {
+			roms[i] = SharedRomCache::GetOrLoad("SharedRomCacheTest4", [&]() {
+				loadCount++;
+				return MakeRom(64 * 1024, 4);
+			});
+		});
+	}
+	for (std::thread& t : threads) {
+		t.join();
+	}
+
+	EXPECT_EQ(loadCount.load(), 1u);
+	for (shared_ptr<const vector<uint8_t>>& rom : roms) {
+		EXPECT_EQ(rom.get(), roms[0].get());
+	}
+}
@@ -0,0 +1,113 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <thread>
+#include "Utilities/SimpleLock.h"
+#include "Utilities/Timer.h"
+
+// =============================================================================
+// SimpleLock Unit Tests
+// =============================================================================
+// Tests for the adaptive lock (spin, then park) and the contention counters of named locks.
+
+TEST(SimpleLockTest, RecursiveAcquire) {
+	SimpleLock lock;
+	lock.Acquire();
+	lock.Acquire();
+	EXPECT_TRUE(lock.IsLockedByCurrentThread());
+	lock.Release();
+	EXPECT_FALSE(lock.IsFree());
+	lock.Release();
+	EXPECT_TRUE(lock.IsFree());
+	EXPECT_FALSE(lock.IsLockedByCurrentThread());
+}
+
+TEST(SimpleLockTest, MutualExclusion) {
+	SimpleLock lock;
+	uint64_t counter = 0;
+
+	vector<std::thread> threads;
+	for (int i = 0; i < 4; i++) {
+		threads.emplace_back([&]() {
+			for (int j = 0; j < 20000; j++) {
+				auto guard = lock.AcquireSafe();
+				counter++;
+			}
+		});
+	}
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+	EXPECT_EQ(counter, 80000u);
+}
+
+TEST(SimpleLockTest, TryAcquireTimesOut) {
+	SimpleLock lock;
+	lock.Acquire();
+
+	bool acquired = true;
+	bool acquiredOnce = true;
+	double elapsed = 0;
+	std::thread other([&]() {
+		acquiredOnce = lock.TryAcquire(0);
+		Timer timer;
+		acquired = lock.TryAcquire(20);
+		elapsed = timer.GetElapsedMS();
+	});
+	other.join();
+
+	EXPECT_FALSE(acquiredOnce);
+	EXPECT_FALSE(acquired);
+	EXPECT_GE(elapsed, 20.0);
+	lock.Release();
+}
+
+TEST(SimpleLockTest, ParkedThreadIsWokenUp) {
+	SimpleLock lock;
+	lock.Acquire();
+
+	atomic<bool> acquired = false;
+	std::thread waiter([&]() {
+		auto guard = lock.AcquireSafe();
+		acquired = true;
+	});
+
+	// Long enough for the waiter to stop spinning and park
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	EXPECT_FALSE(acquired);
+	lock.Release();
+	waiter.join();
+	EXPECT_TRUE(acquired);
+	EXPECT_TRUE(lock.IsFree());
+}
+
+TEST(SimpleLockTest, ContentionCounters) {
+	SimpleLock::SetTelemetryEnabled(true);
+	SimpleLock lock("TestLock");
+	SimpleLock other("TestLock");
+
+	lock.Acquire();
+	std::thread waiter([&]() {
+		auto guard = lock.AcquireSafe();
+	});
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	lock.Release();
+	waiter.join();
+
+	// Locks with the same name share their counters
+	other.Acquire();
+	other.Release();
+	SimpleLock::SetTelemetryEnabled(false);
+
+	// Not counted while disabled
+	lock.Acquire();
+	lock.Release();
+
+	vector<LockContentionInfo> info = SimpleLock::GetContentionInfo();
+	auto result = std::find_if(info.begin(), info.end(), [](const LockContentionInfo& entry) { return entry.Name == "TestLock"; });
+	ASSERT_NE(result, info.end());
+	EXPECT_EQ(result->Acquisitions, 3u);
+	EXPECT_EQ(result->Contentions, 1u);
+	EXPECT_GE(result->TotalWait, 5.0);
+	EXPECT_GE(result->MaxWait, 5.0);
+	EXPECT_LE(result->MaxWait, result->TotalWait);
+}
@@ -0,0 +1,98 @@
+#include "pch.h"
+#include "Utilities/SmallVector.h"
+
+// ===== SmallVector Tests =====
+// Verify inline storage, heap fallback and copy/move semantics
+
+class SmallVectorTest : public ::testing::Test {
+protected:
+	using Vector = SmallVector<uint8_t, 4>;
+};
+
+TEST_F(SmallVectorTest, StaysInlineUpToCapacity) {
+	Vector v;
+	const uint8_t* inlineData = v.data();
+	for (uint8_t i = 0; i < 4; i++) {
+		v.push_back(i);
+	}
+	EXPECT_EQ(v.size(), 4u);
+	EXPECT_EQ(v.capacity(), 4u);
+	EXPECT_EQ(v.data(), inlineData);
+}
+
+TEST_F(SmallVectorTest, GrowsToHeap) {
+	Vector v;
+	for (uint8_t i = 0; i < 20; i++) {
+		v.push_back(i);
+	}
+	ASSERT_EQ(v.size(), 20u);
+	EXPECT_GE(v.capacity(), 20u);
+	for (uint8_t i = 0; i < 20; i++) {
+		EXPECT_EQ(v[i], i);
+	}
+}
+
+TEST_F(SmallVectorTest, CopyIsIndependent) {
+	Vector a = {1, 2, 3, 4, 5, 6};
+	Vector b = a;
+	b[0] = 9;
+	EXPECT_EQ(a[0], 1);
+	EXPECT_EQ(b[0], 9);
+	EXPECT_EQ(b.size(), 6u);
+
+	Vector c = {7};
+	c = a;
+	EXPECT_TRUE(c == a);
+}
+
+TEST_F(SmallVectorTest, MoveTakesHeapBuffer) {
+	Vector a = {1, 2, 3, 4, 5, 6};
+	const uint8_t* heapData = a.data();
+	Vector b = std::move(a);
+	EXPECT_EQ(b.data(), heapData);
+	EXPECT_EQ(b.size(), 6u);
+	EXPECT_TRUE(a.empty());
+
+	// The moved-from vector is still usable
+	a.push_back(3);
+	EXPECT_EQ(a.size(), 1u);
+	EXPECT_EQ(a[0], 3);
+}
+
+TEST_F(SmallVectorTest, MoveInlineCopiesValues) {
+	Vector a = {1, 2};
+	Vector b;
+	b = std::move(a);
+	EXPECT_EQ(b.size(), 2u);
+	EXPECT_EQ(b[1], 2);
+	EXPECT_TRUE(a.empty());
+}
+
+TEST_F(SmallVectorTest, InsertAndResize) {
+	Vector v = {1, 4};
+	uint8_t values[] = {2, 3};
+	v.insert(v.begin() + 1, std::begin(values), std::end(values));
+	ASSERT_EQ(v.size(), 4u);
+	EXPECT_EQ(v[1], 2);
+	EXPECT_EQ(v[2], 3);
+	EXPECT_EQ(v[3], 4);
+
+	v.insert(v.end(), 2, 0);
+	EXPECT_EQ(v.size(), 6u);
+	EXPECT_EQ(v[5], 0);
+
+	v.resize(8, 0xFF);
+	EXPECT_EQ(v[7], 0xFF);
+	v.resize(2);
+	EXPECT_EQ(v.size(), 2u);
+}
+
+TEST_F(SmallVectorTest, EqualityComparesContents) {
+	Vector a = {1, 2, 3};
+	Vector b = {1, 2, 3};
+	Vector c = {1, 2};
+	EXPECT_TRUE(a == b);
+	EXPECT_TRUE(a != c);
+	c.push_back(4);
+	EXPECT_TRUE(a != c);
+}
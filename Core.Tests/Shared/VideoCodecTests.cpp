@@ -0,0 +1,150 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+#include "Utilities/miniz.h"
+#include "Utilities/Video/CamstudioCodec.h"
+#include "Utilities/Video/ZmbvCodec.h"
+#include "Utilities/Video/GifRecorder.h"
+
+// =============================================================================
+// Video Codec Unit Tests
+// =============================================================================
+// Tests for the AVI codecs' multi-threaded compression paths and the GIF delta frames.
+
+namespace {
+	constexpr int Width = 256;
+	constexpr int Height = 240;
+
+	// Scrolling gradient with a moving block, so delta frames contain motion vectors
+	vector<uint32_t> MakeFrame(int frame) {
+		vector<uint32_t> pixels(Width * Height);
+		for (int y = 0; y < Height; y++) {
+			for (int x = 0; x < Width; x++) {
+				uint32_t value = (uint32_t)(((x + frame * 2) * 3) ^ (y * 5)) & 0xFF;
+				pixels[y * Width + x] = 0xFF000000 | (value << 16) | ((value * 7) & 0xFF) << 8 | (uint32_t)(y & 0xFF);
+			}
+		}
+		for (int y = 100; y < 140; y++) {
+			for (int x = 40 + frame * 3; x < 80 + frame * 3; x++) {
+				pixels[y * Width + x] = 0xFFFF00FF;
+			}
+		}
+		return pixels;
+	}
+
+	vector<uint8_t> Compress(BaseCodec& codec, int frame) {
+		vector<uint32_t> pixels = MakeFrame(frame);
+		uint8_t* data = nullptr;
+		int size = codec.CompressFrame(frame % 4 == 0, (uint8_t*)pixels.data(), &data);
+		return size > 0 ? vector<uint8_t>(data, data + size) : vector<uint8_t>();
+	}
+
+	vector<uint8_t> InflateCamstudio(const vector<uint8_t>& frame) {
+		vector<uint8_t> output(Width * 3 * Height);
+		mz_ulong length = (mz_ulong)output.size();
+		// Skip the 2 byte CSCD header, the rest must be a single valid zlib stream
+		EXPECT_EQ(mz_uncompress(output.data(), &length, frame.data() + 2, (mz_ulong)frame.size() - 2), MZ_OK);
+		EXPECT_EQ(length, (mz_ulong)output.size());
+		return output;
+	}
+
+	struct GifRect {
+		uint32_t Left, Top, Width, Height;
+		bool operator==(const GifRect&) const = default;
+	};
+
+	// Walks the blocks written by gif.h and returns each frame's image descriptor rectangle
+	vector<GifRect> ReadGifFrameRects(const string& filename) {
+		std::ifstream file(filename, std::ios::binary);
+		vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+		auto read16 = [&](size_t pos) { return (uint32_t)(data[pos] | (data[pos + 1] << 8)); };
+
+		vector<GifRect> rects;
+		size_t pos = 6 + 7 + 2 * 3; // Signature, screen descriptor, 2-color global table
+		while (pos < data.size() && data[pos] != 0x3B) {
+			if (data[pos] == 0x21) {
+				// Extension: label, then data sub-blocks
+				pos += 2;
+				while (data[pos] != 0) {
+					pos += data[pos] + 1;
+				}
+				pos++;
+			} else if (data[pos] == 0x2C) {
+				rects.push_back({read16(pos + 1), read16(pos + 3), read16(pos + 5), read16(pos + 7)});
+				uint8_t flags = data[pos + 9];
+				pos += 10 + ((flags & 0x80) ? 3 * (2 << (flags & 0x07)) : 0);
+				pos++; // LZW minimum code size
+				while (data[pos] != 0) {
+					pos += data[pos] + 1;
+				}
+				pos++;
+			} else {
+				ADD_FAILURE() << "Unexpected GIF block " << (int)data[pos];
+				break;
+			}
+		}
+		return rects;
+	}
+}
+
+TEST(VideoCodecTest, Camstudio_ParallelChunks_DecodeToSameData) {
+	CamstudioCodec serial(0);
+	CamstudioCodec parallel(3);
+	ASSERT_TRUE(serial.SetupCompress(Width, Height, 6));
+	ASSERT_TRUE(parallel.SetupCompress(Width, Height, 6));
+
+	for (int frame = 0; frame < 6; frame++) {
+		vector<uint8_t> expected = Compress(serial, frame);
+		vector<uint8_t> actual = Compress(parallel, frame);
+		ASSERT_FALSE(actual.empty());
+		EXPECT_EQ(actual[0], expected[0]);
+		EXPECT_EQ(actual[1], expected[1]);
+		EXPECT_EQ(InflateCamstudio(actual), InflateCamstudio(expected)) << "frame " << frame;
+	}
+}
+
+TEST(VideoCodecTest, Zmbv_ParallelMotionSearch_MatchesSerialOutput) {
+	ZmbvCodec serial(0);
+	ZmbvCodec parallel(3);
+	ASSERT_TRUE(serial.SetupCompress(Width, Height, 6));
+	ASSERT_TRUE(parallel.SetupCompress(Width, Height, 6));
+
+	for (int frame = 0; frame < 6; frame++) {
+		vector<uint8_t> expected = Compress(serial, frame);
+		vector<uint8_t> actual = Compress(parallel, frame);
+		ASSERT_FALSE(expected.empty());
+		EXPECT_EQ(actual, expected) << "frame " << frame;
+	}
+}
+
+TEST(VideoCodecTest, Gif_DeltaFrames_EncodeChangedRectOnly) {
+	string filename = (std::filesystem::temp_directory_path() / "nexen_gif_delta_test.gif").string();
+	constexpr uint32_t GifWidth = 64;
+	constexpr uint32_t GifHeight = 48;
+
+	vector<uint32_t> first(GifWidth * GifHeight, 0xFF204060);
+	vector<uint32_t> second = first;
+	second[10 * GifWidth + 5] = 0xFFFFFFFF;
+	second[20 * GifWidth + 30] = 0xFF00FF00;
+
+	{
+		GifRecorder recorder;
+		ASSERT_TRUE(recorder.Init(filename));
+		ASSERT_TRUE(recorder.StartRecording(GifWidth, GifHeight, 4, 0, 30.0));
+		EXPECT_TRUE(recorder.AddFrame(first.data(), GifWidth, GifHeight, 30.0));
+		EXPECT_TRUE(recorder.AddFrame(second.data(), GifWidth, GifHeight, 30.0));
+		EXPECT_TRUE(recorder.AddFrame(second.data(), GifWidth, GifHeight, 30.0));
+		recorder.StopRecording();
+	}
+
+	vector<GifRect> rects = ReadGifFrameRects(filename);
+	std::filesystem::remove(filename);
+
+	ASSERT_EQ(rects.size(), 3u);
+	EXPECT_EQ(rects[0], (GifRect{0, 0, GifWidth, GifHeight}));
+	EXPECT_EQ(rects[1], (GifRect{5, 10, 26, 11}));
+	// Unchanged frames keep their delay with a single transparent pixel
+	EXPECT_EQ(rects[2], (GifRect{0, 0, 1, 1}));
+}
@@ -1,6 +1,10 @@
 #include "pch.h"
 #include <array>
 #include <cstring>
+#include "Shared/Video/BaseVideoFilter.h"
+#include "Shared/Video/ScanlineFilter.h"
+#include "Shared/Video/GpuPostProcess.h"
+#include "Shared/Video/RotateFilter.h"
 
 // =============================================================================
 // Video Filter Optimization Tests
@@ -360,3 +364,281 @@ TEST_F(VideoFilterTests, ByteCodeHexFormat_MatchesOriginal) {
 		EXPECT_EQ(refStr, optStr) << "Length " << len;
 	}
 }
+
+// Bisqwit NTSC line decode: bounds-checked reads (original) vs zero-padded precomputed I/Q products
+namespace {
+	struct BisqwitLineParams {
+		int yWidth, iWidth, qWidth;
+		int y, ir, ig, ib, qr, qg, qb;
+		int brightness;
+		int leftOverscan, rightOverscan;
+		int resDivider;
+		// Last: wide filters make the original code compute (negative) indexes for samples that read as 0
+		int8_t sinetable[27];
+	};
+
+	BisqwitLineParams MakeBisqwitParams(int yWidth, int iWidth, int qWidth, int resDivider) {
+		BisqwitLineParams p = {};
+		for (int i = 0; i < 27; i++) {
+			p.sinetable[i] = (int8_t)(8 * std::sin(i * 2 * 3.14159265358979 / 12));
+		}
+		p.yWidth = yWidth;
+		p.iWidth = iWidth;
+		p.qWidth = qWidth;
+		p.y = 167941 / yWidth;
+		p.ir = 1200 / iWidth * 100;
+		p.ig = -350 / iWidth * 100;
+		p.ib = -1400 / iWidth * 100;
+		p.qr = 800 / qWidth * 100;
+		p.qg = -820 / qWidth * 100;
+		p.qb = 2150 / qWidth * 100;
+		p.brightness = 0;
+		p.leftOverscan = 8 * 8;
+		p.rightOverscan = 2048 - 8 * 8;
+		p.resDivider = resDivider;
+		return p;
+	}
+
+	uint32_t BisqwitToArgb(const BisqwitLineParams& p, int ysum, int isum, int qsum) {
+		int r = std::min(255, std::max(0, (ysum * p.y + isum * p.ir + qsum * p.qr) / 65536));
+		int g = std::min(255, std::max(0, (ysum * p.y + isum * p.ig + qsum * p.qg) / 65536));
+		int b = std::min(255, std::max(0, (ysum * p.y + isum * p.ib + qsum * p.qb) / 65536));
+		return 0xFF000000 | (r << 16) | (g << 8) | b;
+	}
+
+	void BisqwitDecodeLineReference(const BisqwitLineParams& p, int width, const int8_t* signal, uint32_t* target, int phase0) {
+		auto Read = [=](int pos) -> char { return pos >= 0 && pos < width ? signal[pos] : 0; };
+		auto Cos = [&](int pos) -> char { return p.sinetable[(pos + 36) % 12 + phase0]; };
+		auto Sin = [&](int pos) -> char { return p.sinetable[(pos + 36) % 12 + 3 + phase0]; };
+
+		int ysum = p.brightness, isum = 0, qsum = 0;
+		int maxFilter = std::max(p.yWidth, std::max(p.iWidth, p.qWidth)) / 2;
+		for (int s = -maxFilter; s < p.rightOverscan; s++) {
+			int sy = s + p.yWidth / 2;
+			int si = s + p.iWidth / 2;
+			int sq = s + p.qWidth / 2;
+			ysum += Read(sy) - Read(sy - p.yWidth);
+			isum += Read(si) * Cos(si) - Read(si - p.iWidth) * Cos(si - p.iWidth);
+			qsum += Read(sq) * Sin(sq) - Read(sq - p.qWidth) * Sin(sq - p.qWidth);
+			if (s >= p.leftOverscan && !(s % p.resDivider)) {
+				*(target++) = BisqwitToArgb(p, ysum, isum, qsum);
+			}
+		}
+	}
+
+	void BisqwitDecodeLinePadded(const BisqwitLineParams& p, int width, const int8_t* signal, uint32_t* target, int phase0, std::vector<int>& buffer) {
+		auto Cos = [&](int pos) -> char { return p.sinetable[(pos + 36) % 12 + phase0]; };
+		auto Sin = [&](int pos) -> char { return p.sinetable[(pos + 36) % 12 + 3 + phase0]; };
+
+		int maxWidth = std::max(p.yWidth, std::max(p.iWidth, p.qWidth));
+		int maxFilter = maxWidth / 2;
+		int padding = maxFilter + maxWidth;
+		int stride = width + padding * 2;
+		buffer.assign(stride * 3, 0);
+		int* ySignal = buffer.data() + padding;
+		int* iSignal = ySignal + stride;
+		int* qSignal = iSignal + stride;
+		for (int pos = 0; pos < width; pos++) {
+			ySignal[pos] = (char)signal[pos];
+			iSignal[pos] = (char)signal[pos] * Cos(pos);
+			qSignal[pos] = (char)signal[pos] * Sin(pos);
+		}
+
+		int ysum = p.brightness, isum = 0, qsum = 0;
+		for (int s = -maxFilter; s < p.rightOverscan; s++) {
+			int sy = s + p.yWidth / 2;
+			int si = s + p.iWidth / 2;
+			int sq = s + p.qWidth / 2;
+			ysum += ySignal[sy] - ySignal[sy - p.yWidth];
+			isum += iSignal[si] - iSignal[si - p.iWidth];
+			qsum += qSignal[sq] - qSignal[sq - p.qWidth];
+			if (s >= p.leftOverscan && !(s % p.resDivider)) {
+				*(target++) = BisqwitToArgb(p, ysum, isum, qsum);
+			}
+		}
+	}
+}
+
+// Verify the padded Bisqwit line decode matches the bounds-checked original, including wide filters
+TEST_F(VideoFilterTests, BisqwitDecodeLine_Padded_MatchesBoundsChecked) {
+	constexpr int Width = 256 * 8;
+	std::vector<int8_t> signal(Width);
+	for (int i = 0; i < Width; i++) {
+		signal[i] = (int8_t)(((i * 37) ^ (i >> 3)) % 140 - 20);
+	}
+
+	const int widths[][3] = {{12, 24, 24}, {12, 22, 26}, {1, 12, 12}, {108, 108, 108}};
+	std::vector<int> buffer;
+	for (const auto& w : widths) {
+		for (int resDivider : {1, 2, 4}) {
+			BisqwitLineParams p = MakeBisqwitParams(w[0], w[1], w[2], resDivider);
+			for (int phase0 = 0; phase0 < 12; phase0++) {
+				std::vector<uint32_t> refOutput(Width, 0);
+				std::vector<uint32_t> optOutput(Width, 0);
+				BisqwitDecodeLineReference(p, Width, signal.data(), refOutput.data(), phase0);
+				BisqwitDecodeLinePadded(p, Width, signal.data(), optOutput.data(), phase0, buffer);
+				EXPECT_EQ(refOutput, optOutput) << w[0] << "/" << w[1] << "/" << w[2] << " div " << resDivider << " phase " << phase0;
+			}
+		}
+	}
+}
+
+// Shared palette LUT conversion used by the default video filters
+namespace {
+	struct PaletteFilterAccess : public BaseVideoFilter {
+		using BaseVideoFilter::BlendArgb;
+		using BaseVideoFilter::ConvertFrame;
+		using BaseVideoFilter::ConvertFrameBlended;
+	};
+}
+
+// Verify ConvertFrame crops overscan and matches a per-pixel lookup
+TEST_F(VideoFilterTests, ConvertFrame_CroppedLut_MatchesPerPixelLookup) {
+	constexpr uint32_t SrcWidth = 256;
+	constexpr uint32_t SrcHeight = 239;
+	std::vector<uint32_t> palette(0x8000);
+	for (uint32_t i = 0; i < palette.size(); i++) {
+		palette[i] = 0xFF000000 | (i * 2654435761u >> 8);
+	}
+	std::vector<uint16_t> src(SrcWidth * SrcHeight);
+	for (uint32_t i = 0; i < src.size(); i++) {
+		src[i] = (uint16_t)(i * 40503u);
+	}
+
+	// Odd width exercises the unrolled loop's remainder
+	constexpr uint32_t Left = 8, Top = 7, Width = 239, Height = 224;
+	std::vector<uint32_t> refOutput(Width * Height);
+	for (uint32_t y = 0; y < Height; y++) {
+		for (uint32_t x = 0; x < Width; x++) {
+			refOutput[y * Width + x] = palette[src[(y + Top) * SrcWidth + x + Left] & 0x7FFF];
+		}
+	}
+
+	std::vector<uint32_t> optOutput(Width * Height);
+	PaletteFilterAccess::ConvertFrame(palette.data(), 0x7FFF, src.data(), SrcWidth, Left, Top, optOutput.data(), Width, Height);
+	EXPECT_EQ(refOutput, optOutput);
+}
+
+// Verify ConvertFrameBlended averages with the previous frame like the per-console GetPixel did
+TEST_F(VideoFilterTests, ConvertFrameBlended_MatchesPerPixelBlend) {
+	constexpr uint32_t Width = 160;
+	constexpr uint32_t Height = 144;
+	std::vector<uint32_t> palette(0x8000);
+	for (uint32_t i = 0; i < palette.size(); i++) {
+		palette[i] = 0xFF000000 | (i * 2654435761u >> 8);
+	}
+	std::vector<uint16_t> src(Width * Height);
+	std::vector<uint16_t> prev(Width * Height);
+	for (uint32_t i = 0; i < src.size(); i++) {
+		src[i] = (uint16_t)(i * 40503u) & 0x7FFF;
+		prev[i] = (uint16_t)(i * 9973u) & 0x7FFF;
+	}
+
+	std::vector<uint32_t> refOutput(Width * Height);
+	for (uint32_t i = 0; i < refOutput.size(); i++) {
+		uint32_t a = palette[prev[i]];
+		uint32_t b = palette[src[i]];
+		refOutput[i] = ((((a) ^ (b)) & 0xfffefefeL) >> 1) + ((a) & (b));
+	}
+
+	std::vector<uint32_t> optOutput(Width * Height);
+	PaletteFilterAccess::ConvertFrameBlended(palette.data(), 0x7FFF, src.data(), prev.data(), Width, 0, 0, optOutput.data(), Width, Height);
+	EXPECT_EQ(refOutput, optOutput);
+}
+
+// Verify the GPU overlay reproduces the CPU prescale + scanline chain
+TEST_F(VideoFilterTests, GpuPostProcessOverlay_MatchesCpuScanlines) {
+	constexpr uint32_t Width = 64;
+	constexpr uint32_t Height = 30;
+	constexpr uint32_t Scale = 3;
+	constexpr double Intensity = 0.35;
+	std::vector<uint32_t> src(Width * Height);
+	for (uint32_t i = 0; i < src.size(); i++) {
+		src[i] = 0xFF000000 | (i * 2654435761u >> 8);
+	}
+
+	// Nearest-neighbor upscale, what both paths start from
+	std::vector<uint32_t> scaled(Width * Scale * Height * Scale);
+	for (uint32_t y = 0; y < Height * Scale; y++) {
+		for (uint32_t x = 0; x < Width * Scale; x++) {
+			scaled[y * Width * Scale + x] = src[(y / Scale) * Width + x / Scale];
+		}
+	}
+
+	std::vector<uint32_t> cpuOutput = scaled;
+	ScanlineFilter::ApplyFilter(cpuOutput.data(), Width * Scale, Height * Scale, Intensity, Scale);
+
+	GpuPostProcess postProcess;
+	postProcess.Scale = Scale;
+	postProcess.ScanlineBrightness = (uint8_t)((1.0 - Intensity) * 255);
+	postProcess.ScanlineScale = Scale;
+	ASSERT_TRUE(postProcess.NeedsOverlay());
+
+	std::vector<uint32_t> overlay(scaled.size());
+	postProcess.BuildOverlay(overlay.data(), Width * Scale, Height * Scale);
+
+	// Emulate the renderer's multiply blend
+	for (size_t i = 0; i < scaled.size(); i++) {
+		uint32_t o = overlay[i] & 0xFF;
+		uint32_t c = scaled[i];
+		uint32_t r = ((c >> 16) & 0xFF) * o / 255;
+		uint32_t g = ((c >> 8) & 0xFF) * o / 255;
+		uint32_t b = (c & 0xFF) * o / 255;
+		ASSERT_EQ(cpuOutput[i], 0xFF000000 | (r << 16) | (g << 8) | b) << "pixel " << i;
+	}
+}
+
+// Verify the LCD grid overlay repeats the four brightness levels over 2x2 blocks
+TEST_F(VideoFilterTests, GpuPostProcessOverlay_LcdGridPattern) {
+	GpuPostProcess postProcess;
+	postProcess.Scale = 2;
+	postProcess.LcdGrid = true;
+	postProcess.LcdGridBrightness[0] = 255;
+	postProcess.LcdGridBrightness[1] = 200;
+	postProcess.LcdGridBrightness[2] = 150;
+	postProcess.LcdGridBrightness[3] = 100;
+
+	std::vector<uint32_t> overlay(8 * 4);
+	postProcess.BuildOverlay(overlay.data(), 8, 4);
+	for (uint32_t y = 0; y < 4; y++) {
+		for (uint32_t x = 0; x < 8; x++) {
+			uint32_t expected = postProcess.LcdGridBrightness[(y % 2) * 2 + (x % 2)];
+			EXPECT_EQ(overlay[y * 8 + x], 0xFF000000 | (expected * 0x010101));
+		}
+	}
+
+	GpuPostProcess inactive;
+	EXPECT_FALSE(inactive.IsActive());
+	EXPECT_TRUE(postProcess.IsActive());
+}
+
+// Verify the tiled rotation matches the per-pixel rotation, including partial edge tiles
+TEST_F(VideoFilterTests, RotateFilter_Tiled_MatchesPerPixelRotation) {
+	constexpr uint32_t Width = 227;
+	constexpr uint32_t Height = 145;
+	std::vector<uint32_t> src(Width * Height);
+	for (uint32_t i = 0; i < src.size(); i++) {
+		src[i] = i * 2654435761u;
+	}
+
+	for (uint32_t angle : {90u, 180u, 270u}) {
+		std::vector<uint32_t> refOutput(Width * Height);
+		const uint32_t* input = src.data();
+		for (uint32_t i = 0; i < Height; i++) {
+			for (uint32_t j = 0; j < Width; j++) {
+				if (angle == 90) {
+					refOutput[j * Height + (Height - 1 - i)] = *input;
+				} else if (angle == 180) {
+					refOutput[(Height - 1 - i) * Width + (Width - 1 - j)] = *input;
+				} else {
+					refOutput[(Width - 1 - j) * Height + i] = *input;
+				}
+				input++;
+			}
+		}
+
+		RotateFilter filter(angle);
+		uint32_t* output = filter.ApplyFilter(src.data(), Width, Height);
+		EXPECT_TRUE(std::equal(refOutput.begin(), refOutput.end(), output)) << "angle " << angle;
+	}
+}
@@ -0,0 +1,257 @@
+#include "pch.h"
+#include <filesystem>
+#include <fstream>
+#include "Utilities/VirtualFile.h"
+#include "Utilities/MemoryMappedFile.h"
+#include "Utilities/CRC32.h"
+#include "Utilities/ZipWriter.h"
+#include "Utilities/ZipReader.h"
+#include "Utilities/Patches/IpsPatcher.h"
+#include "Utilities/Patches/PatchedRomCache.h"
+
+// =============================================================================
+// VirtualFile Unit Tests
+// =============================================================================
+// Tests for reading uncompressed files through the read-only memory mapping, and for archive entries.
+
+namespace {
+	class VirtualFileTest : public ::testing::Test {
+	protected:
+		string _filename;
+		vector<uint8_t> _content;
+
+		void SetUp() override {
+			_filename = (std::filesystem::temp_directory_path() / "nexen_virtual_file_test.bin").string();
+			_content.resize(0x12345);
+			for (size_t i = 0; i < _content.size(); i++) {
+				_content[i] = (uint8_t)(i * 7 + (i >> 8));
+			}
+
+			std::ofstream out(_filename, std::ios::binary);
+			out.write((char*)_content.data(), _content.size());
+		}
+
+		void TearDown() override {
+			std::filesystem::remove(_filename);
+		}
+	};
+}
+
+TEST_F(VirtualFileTest, MemoryMappedFileMapsWholeFile) {
+	MemoryMappedFile file;
+	ASSERT_TRUE(file.Open(_filename));
+	ASSERT_EQ(file.GetSize(), _content.size());
+	EXPECT_EQ(memcmp(file.GetData(), _content.data(), _content.size()), 0);
+
+	file.Close();
+	EXPECT_FALSE(file.IsOpen());
+}
+
+TEST_F(VirtualFileTest, MemoryMappedFileRejectsMissingFile) {
+	MemoryMappedFile file;
+	EXPECT_FALSE(file.Open(_filename + ".missing"));
+	EXPECT_FALSE(file.IsOpen());
+}
+
+TEST_F(VirtualFileTest, DataSpanMatchesFileContent) {
+	VirtualFile file(_filename);
+	std::span<const uint8_t> data = file.GetDataSpan();
+	ASSERT_EQ(data.size(), _content.size());
+	EXPECT_TRUE(std::equal(data.begin(), data.end(), _content.begin()));
+	EXPECT_EQ(file.GetSize(), _content.size());
+}
+
+TEST_F(VirtualFileTest, ReadAndHashWithoutLoadingMatchLoadedData) {
+	VirtualFile file(_filename);
+	vector<uint8_t> out;
+	ASSERT_TRUE(file.ReadFile(out));
+	EXPECT_EQ(out, _content);
+	EXPECT_EQ(file.GetCrc32(), CRC32::GetCRC(_content));
+
+	// GetData() copies the mapped content, the span then returns the (modifiable) loaded data
+	vector<uint8_t>& loaded = file.GetData();
+	EXPECT_EQ(loaded, _content);
+	loaded[0] ^= 0xFF;
+	EXPECT_EQ(file.GetDataSpan()[0], (uint8_t)(_content[0] ^ 0xFF));
+}
+
+TEST_F(VirtualFileTest, ArchiveCrcComesFromDirectory) {
+	string zipFilename = _filename + ".zip";
+	{
+		ZipWriter writer;
+		ASSERT_TRUE(writer.Initialize(zipFilename));
+		writer.AddFile(_content, "game.gba");
+		ASSERT_TRUE(writer.Save());
+	}
+
+	VirtualFile byName(zipFilename, "game.gba");
+	EXPECT_EQ(byName.GetCrc32(), CRC32::GetCRC(_content));
+
+	VirtualFile byIndex(zipFilename + "\x1" + "game.gba" + "\x1" + "0");
+	EXPECT_EQ(byIndex.GetCrc32(), CRC32::GetCRC(_content));
+	EXPECT_EQ(byIndex.GetData(), _content);
+
+	VirtualFile missing(zipFilename, "other.gba");
+	EXPECT_EQ(missing.GetCrc32(), 0u);
+
+	std::filesystem::remove(zipFilename);
+}
+
+TEST_F(VirtualFileTest, ArchiveChunkedExtractionMatchesFile) {
+	string zipFilename = _filename + ".zip";
+	{
+		ZipWriter writer;
+		ASSERT_TRUE(writer.Initialize(zipFilename));
+		writer.AddFile(_content, "Input.txt");
+		ASSERT_TRUE(writer.Save());
+	}
+
+	ZipReader reader;
+	{
+		std::ifstream in(zipFilename, std::ios::binary);
+		ASSERT_TRUE(reader.LoadArchive(in));
+	}
+
+	vector<uint8_t> data;
+	int chunkCount = 0;
+	EXPECT_TRUE(reader.ExtractFile("Input.txt", [&](const uint8_t* chunk, size_t size) {
+		data.insert(data.end(), chunk, chunk + size);
+		chunkCount++;
+		return true;
+	}));
+	EXPECT_EQ(data, _content);
+	EXPECT_GT(chunkCount, 1);
+
+	// Aborted by the callback
+	EXPECT_FALSE(reader.ExtractFile("Input.txt", [](const uint8_t*, size_t) { return false; }));
+	EXPECT_FALSE(reader.ExtractFile("Missing.txt", [](const uint8_t*, size_t) { return true; }));
+
+	std::filesystem::remove(zipFilename);
+}
+
+TEST_F(VirtualFileTest, IncrementallyCompressedArchiveEntry) {
+	string zipFilename = _filename + ".zip";
+	{
+		ZipFileCompressor compressor;
+		for (size_t offset = 0; offset < _content.size(); offset += 1000) {
+			compressor.Write(_content.data() + offset, std::min<size_t>(1000, _content.size() - offset));
+		}
+		EXPECT_EQ(compressor.GetSize(), _content.size());
+
+		ZipWriter writer;
+		ASSERT_TRUE(writer.Initialize(zipFilename));
+		writer.AddFile(compressor, "Input.txt");
+		ASSERT_TRUE(writer.Save());
+	}
+
+	VirtualFile file(zipFilename, "Input.txt");
+	EXPECT_EQ(file.GetData(), _content);
+	EXPECT_EQ(file.GetCrc32(), CRC32::GetCRC(_content));
+
+	std::filesystem::remove(zipFilename);
+}
+
+TEST_F(VirtualFileTest, LargeArchiveEntryIsCompressedInChunks) {
+	// Several deflate chunks, with a partial last chunk
+	vector<uint8_t> large(0x2345678 / 16);
+	uint32_t seed = 1;
+	for (size_t i = 0; i < large.size(); i++) {
+		seed = seed * 1103515245 + 12345;
+		large[i] = (i & 0x100) ? (uint8_t)(seed >> 24) & 0x0F : (uint8_t)i;
+	}
+	vector<uint8_t> empty;
+
+	string zipFilename = _filename + ".zip";
+	{
+		ZipWriter writer;
+		ASSERT_TRUE(writer.Initialize(zipFilename));
+		writer.AddFile(large, "Large.bin");
+		writer.AddFile(_filename, "File.bin");
+		writer.AddFile(empty, "Empty.bin");
+		ASSERT_TRUE(writer.Save());
+	}
+
+	ZipReader reader;
+	{
+		std::ifstream in(zipFilename, std::ios::binary);
+		ASSERT_TRUE(reader.LoadArchive(in));
+	}
+	vector<string> files = reader.GetFileList();
+	ASSERT_EQ(files.size(), 3u);
+	EXPECT_EQ(files[0], "Large.bin");
+	EXPECT_EQ(files[1], "File.bin");
+	EXPECT_EQ(files[2], "Empty.bin");
+
+	vector<uint8_t> data;
+	ASSERT_TRUE(reader.ExtractFile("Large.bin", data));
+	EXPECT_EQ(data, large);
+	ASSERT_TRUE(reader.ExtractFile("File.bin", data));
+	EXPECT_EQ(data, _content);
+	ASSERT_TRUE(reader.ExtractFile("Empty.bin", data));
+	EXPECT_TRUE(data.empty());
+
+	VirtualFile file(zipFilename, "Large.bin");
+	EXPECT_EQ(file.GetCrc32(), CRC32::GetCRC(large));
+	EXPECT_LT(std::filesystem::file_size(zipFilename), large.size());
+
+	std::filesystem::remove(zipFilename);
+}
+
+TEST_F(VirtualFileTest, PatchedRomIsCached) {
+	std::filesystem::path cacheFolder = std::filesystem::temp_directory_path() / "nexen_patch_cache_test";
+	std::filesystem::remove_all(cacheFolder);
+	PatchedRomCache::SetFolder(cacheFolder.string());
+
+	// Large enough to be cached
+	vector<uint8_t> rom(PatchedRomCache::MinRomSize, 0x11);
+	vector<uint8_t> patchedRom = rom;
+	patchedRom[0x100] = 0x22;
+	patchedRom[0x8000] = 0x33;
+	vector<uint8_t> patchData = IpsPatcher::CreatePatch(rom, patchedRom);
+	{
+		std::ofstream out(_filename, std::ios::binary | std::ios::trunc);
+		out.write((char*)rom.data(), rom.size());
+	}
+
+	VirtualFile patch(patchData.data(), patchData.size(), "patch.ips");
+	VirtualFile file(_filename);
+	ASSERT_TRUE(file.ApplyPatch(patch));
+	EXPECT_EQ(file.GetData(), patchedRom);
+
+	vector<std::filesystem::path> entries;
+	for (const auto& entry : std::filesystem::directory_iterator(cacheFolder)) {
+		entries.push_back(entry.path());
+	}
+	ASSERT_EQ(entries.size(), 1u);
+	EXPECT_EQ(std::filesystem::file_size(entries[0]), patchedRom.size());
+
+	// The next load uses the cached file (edited here to prove it is used instead of the patch)
+	{
+		std::fstream cached(entries[0], std::ios::binary | std::ios::in | std::ios::out);
+		cached.seekp(0x200);
+		cached.put((char)0x44);
+	}
+	patchedRom[0x200] = 0x44;
+
+	VirtualFile cachedFile(_filename);
+	ASSERT_TRUE(cachedFile.ApplyPatch(patch));
+	EXPECT_TRUE(cachedFile.IsValid());
+	EXPECT_EQ(cachedFile.GetSize(), patchedRom.size());
+	EXPECT_EQ(cachedFile.GetCrc32(), CRC32::GetCRC(patchedRom));
+	std::span<const uint8_t> span = cachedFile.GetDataSpan();
+	EXPECT_TRUE(std::equal(span.begin(), span.end(), patchedRom.begin(), patchedRom.end()));
+	EXPECT_EQ(cachedFile.GetData(), patchedRom);
+
+	// A different patch gets its own entry
+	patchedRom[0x200] = 0x11;
+	patchedRom[0x300] = 0x55;
+	vector<uint8_t> otherPatchData = IpsPatcher::CreatePatch(rom, patchedRom);
+	VirtualFile otherPatch(otherPatchData.data(), otherPatchData.size(), "other.ips");
+	VirtualFile otherFile(_filename);
+	ASSERT_TRUE(otherFile.ApplyPatch(otherPatch));
+	EXPECT_EQ(otherFile.GetData()[0x300], 0x55);
+	EXPECT_EQ(otherFile.GetData()[0x200], 0x11);
+
+	PatchedRomCache::SetFolder("");
+	std::filesystem::remove_all(cacheFolder);
+}
@@ -0,0 +1,66 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+#include "Shared/Audio/WaveRecorder.h"
+
+// =============================================================================
+// WaveRecorder Unit Tests
+// =============================================================================
+// Tests for the WAV recorder and its background writer thread.
+
+namespace {
+	vector<uint8_t> ReadFile(const string& filename) {
+		std::ifstream file(filename, ios::binary);
+		return vector<uint8_t>(std::istreambuf_iterator<char>(file), {});
+	}
+
+	uint32_t ReadUint32(const vector<uint8_t>& data, size_t offset) {
+		uint32_t value = 0;
+		memcpy(&value, data.data() + offset, sizeof(value));
+		return value;
+	}
+}
+
+TEST(WaveRecorderTest, AllQueuedSamplesAreWrittenOnClose) {
+	string filename = (std::filesystem::temp_directory_path() / "nexen_wave_recorder_test.wav").string();
+	constexpr uint32_t BlockSize = 800;
+	constexpr uint32_t BlockCount = 300;
+
+	{
+		WaveRecorder recorder(filename, 48000, true);
+		vector<int16_t> block(BlockSize * 2);
+		for (uint32_t i = 0; i < BlockCount; i++) {
+			for (uint32_t j = 0; j < block.size(); j++) {
+				block[j] = (int16_t)(i * 31 + j);
+			}
+			ASSERT_TRUE(recorder.WriteSamples(block.data(), BlockSize, 48000, true));
+		}
+		EXPECT_EQ(recorder.GetDroppedSampleCount(), 0u);
+	}
+
+	vector<uint8_t> data = ReadFile(filename);
+	std::filesystem::remove(filename);
+
+	constexpr uint32_t dataSize = BlockSize * BlockCount * 4;
+	ASSERT_EQ(data.size(), 44u + dataSize);
+	EXPECT_EQ(ReadUint32(data, 4), dataSize + 36);
+	EXPECT_EQ(ReadUint32(data, 40), dataSize);
+
+	// Samples are in the order they were queued
+	int16_t sample;
+	memcpy(&sample, data.data() + 44 + (BlockCount - 1) * BlockSize * 4 + 6, sizeof(sample));
+	EXPECT_EQ(sample, (int16_t)((BlockCount - 1) * 31 + 3));
+}
+
+TEST(WaveRecorderTest, FormatChangeStopsRecording) {
+	string filename = (std::filesystem::temp_directory_path() / "nexen_wave_recorder_format.wav").string();
+	{
+		WaveRecorder recorder(filename, 48000, true);
+		vector<int16_t> block(200);
+		EXPECT_TRUE(recorder.WriteSamples(block.data(), 100, 48000, true));
+		EXPECT_FALSE(recorder.WriteSamples(block.data(), 100, 44100, true));
+	}
+	std::filesystem::remove(filename);
+}
@@ -0,0 +1,35 @@
+#include "pch.h"
+#include <gtest/gtest.h>
+#include <vector>
+#include "Utilities/WorkerPool.h"
+
+// =============================================================================
+// WorkerPool Unit Tests
+// =============================================================================
+// Tests for the slice worker pool used by the video filters.
+
+TEST(WorkerPoolTest, RunsEveryTaskOnce) {
+	WorkerPool pool(3);
+	vector<atomic<uint32_t>> counts(64);
+
+	for (int batch = 0; batch < 50; batch++) {
+		pool.Run((uint32_t)counts.size(), [&](uint32_t index) { counts[index]++; });
+	}
+
+	for (atomic<uint32_t>& count : counts) {
+		EXPECT_EQ(count.load(), 50u);
+	}
+}
+
+TEST(WorkerPoolTest, WithoutWorkersRunsOnCallingThread) {
+	WorkerPool pool(0);
+	EXPECT_EQ(pool.GetThreadCount(), 1u);
+
+	std::thread::id caller = std::this_thread::get_id();
+	uint32_t count = 0;
+	pool.Run(5, [&](uint32_t) {
+		EXPECT_EQ(std::this_thread::get_id(), caller);
+		count++;
+	});
+	EXPECT_EQ(count, 5u);
+}
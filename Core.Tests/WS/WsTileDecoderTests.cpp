@@ -0,0 +1,74 @@
+#include "pch.h"
+#include "WS/WsTileDecoder.h"
+
+// =============================================================================
+// WsTileDecoder Unit Tests
+// =============================================================================
+// Compares the 8-pixel row decoder with the per-pixel decoding previously done by WsPpu::GetPixelColor.
+
+namespace {
+	template <WsVideoMode mode>
+	uint8_t GetPixelColorReference(const uint8_t* tileData, uint8_t column) {
+		switch (mode) {
+			case WsVideoMode::Monochrome:
+			case WsVideoMode::Color2bpp:
+				return ((tileData[0] << column) & 0x80) >> 7 | ((tileData[1] << column) & 0x80) >> 6;
+
+			case WsVideoMode::Color4bpp:
+				return (
+				    ((tileData[0] << column) & 0x80) >> 7 |
+				    ((tileData[1] << column) & 0x80) >> 6 |
+				    ((tileData[2] << column) & 0x80) >> 5 |
+				    ((tileData[3] << column) & 0x80) >> 4);
+
+			case WsVideoMode::Color4bppPacked:
+				return (tileData[column / 2] >> (column & 0x01 ? 0 : 4)) & 0x0F;
+		}
+		return 0;
+	}
+
+	template <WsVideoMode mode>
+	void CompareWithReference(uint32_t seed) {
+		for (int i = 0; i < 2000; i++) {
+			uint8_t tileData[4];
+			for (uint8_t& value : tileData) {
+				seed = seed * 1103515245 + 12345;
+				value = (uint8_t)(seed >> 16);
+			}
+
+			for (bool hMirror : {false, true}) {
+				uint64_t row = WsTileDecoder::DecodeRow<mode>(tileData, hMirror);
+				for (uint8_t pixel = 0; pixel < 8; pixel++) {
+					uint8_t column = hMirror ? 7 - pixel : pixel;
+					ASSERT_EQ(WsTileDecoder::GetPixel(row, pixel), GetPixelColorReference<mode>(tileData, column)) << "pixel=" << (int)pixel << " hMirror=" << hMirror;
+				}
+			}
+		}
+	}
+}
+
+TEST(WsTileDecoderTest, Monochrome_MatchesPerPixel) {
+	CompareWithReference<WsVideoMode::Monochrome>(0x1234);
+}
+
+TEST(WsTileDecoderTest, Color2bpp_MatchesPerPixel) {
+	CompareWithReference<WsVideoMode::Color2bpp>(0x5678);
+}
+
+TEST(WsTileDecoderTest, Color4bpp_MatchesPerPixel) {
+	CompareWithReference<WsVideoMode::Color4bpp>(0x9ABC);
+}
+
+TEST(WsTileDecoderTest, Color4bppPacked_MatchesPerPixel) {
+	CompareWithReference<WsVideoMode::Color4bppPacked>(0xDEF0);
+}
+
+TEST(WsTileDecoderTest, Color2bpp_IgnoresUpperPlanes) {
+	uint8_t tileData[4] = {0x80, 0x01, 0xFF, 0xFF};
+	uint64_t row = WsTileDecoder::DecodeRow<WsVideoMode::Color2bpp>(tileData, false);
+	EXPECT_EQ(WsTileDecoder::GetPixel(row, 0), 1);
+	EXPECT_EQ(WsTileDecoder::GetPixel(row, 7), 2);
+	for (uint8_t pixel = 1; pixel < 7; pixel++) {
+		EXPECT_EQ(WsTileDecoder::GetPixel(row, pixel), 0);
+	}
+}
@@ -42,13 +42,13 @@ class Atari2600Mapper {
 		}
 
 		void StepCpuCycles(uint32_t cycles) {
-			for (uint32_t i = 0; i < cycles; i++) {
-				_state.CpuCycles++;
-				if (_state.Timer > 0) {
-					_state.Timer--;
-				} else {
-					_state.TimerUnderflow = true;
-				}
+			_state.CpuCycles += cycles;
+			if (cycles <= _state.Timer) {
+				_state.Timer -= cycles;
+			} else {
+				// The timer reached 0 and stayed there for at least one cycle
+				_state.Timer = 0;
+				_state.TimerUnderflow = true;
 			}
 		}
 
@@ -86,48 +86,155 @@ class Atari2600Mapper {
 		}
 	};
 
+	// Register writes that affect rendering are logged with the color clock they occurred on, and each
+	// scanline is rendered once it ends: the pixels between two writes are drawn as a single span
+	struct Atari2600TiaWrite {
+		uint8_t ColorClock;
+		uint8_t Addr;
+		uint8_t Value;
+	};
+
 	class Atari2600Tia {
 	private:
 		Atari2600TiaState _state = {};
+		vector<Atari2600TiaWrite> _lineWrites;
+		uint16_t* _frameBuffer = nullptr;
+
+		void ApplyWrite(const Atari2600TiaWrite& write) {
+			switch (write.Addr) {
+				case 0x08: _state.ColuPf = write.Value & 0xFE; break;
+				case 0x09: _state.ColuBk = write.Value & 0xFE; break;
+				case 0x0A: _state.CtrlPf = write.Value; break;
+				case 0x0D: _state.Pf0 = write.Value; break;
+				case 0x0E: _state.Pf1 = write.Value; break;
+				case 0x0F: _state.Pf2 = write.Value; break;
+			}
+		}
+
+		uint64_t GetPlayfieldMask() const {
+			// 1 bit per 4-pixel playfield cell, left half = PF0 bits 4-7, PF1 bits 7-0, PF2 bits 0-7
+			uint32_t left = (_state.Pf0 >> 4);
+			for (int i = 0; i < 8; i++) {
+				left |= ((_state.Pf1 >> (7 - i)) & 0x01) << (4 + i);
+			}
+			left |= (uint32_t)_state.Pf2 << 12;
+
+			uint32_t right = left;
+			if (_state.CtrlPf & 0x01) {
+				right = 0;
+				for (int i = 0; i < 20; i++) {
+					right |= ((left >> i) & 0x01) << (19 - i);
+				}
+			}
+			return (uint64_t)left | ((uint64_t)right << 20);
+		}
+
+		void RenderSpan(uint16_t* out, uint32_t start, uint32_t end) {
+			if (start >= end) {
+				return;
+			}
+
+			uint64_t playfield = GetPlayfieldMask();
+			if (playfield == 0 || _state.ColuPf == _state.ColuBk) {
+				std::fill(out + start, out + end, (uint16_t)_state.ColuBk);
+				return;
+			}
+
+			for (uint32_t x = start; x < end; x++) {
+				out[x] = (playfield >> (x >> 2)) & 0x01 ? _state.ColuPf : _state.ColuBk;
+			}
+		}
+
+		void RenderScanline() {
+			uint32_t line = _state.Scanline - Atari2600Console::FirstVisibleScanline;
+			if (!_frameBuffer || _state.Scanline < Atari2600Console::FirstVisibleScanline || line >= Atari2600Console::ScreenHeight) {
+				for (const Atari2600TiaWrite& write : _lineWrites) {
+					ApplyWrite(write);
+				}
+				_lineWrites.clear();
+				return;
+			}
+
+			uint16_t* out = _frameBuffer + line * Atari2600Console::ScreenWidth;
+			uint32_t x = 0;
+			for (const Atari2600TiaWrite& write : _lineWrites) {
+				uint32_t pos = std::clamp<uint32_t>(write.ColorClock, Atari2600Console::HBlankColorClocks, Atari2600Console::ColorClocksPerScanline) - Atari2600Console::HBlankColorClocks;
+				RenderSpan(out, x, pos);
+				ApplyWrite(write);
+				x = std::max(x, pos);
+			}
+			RenderSpan(out, x, Atari2600Console::ScreenWidth);
+			_lineWrites.clear();
+		}
 
 		void AdvanceScanline() {
+			RenderScanline();
 			_state.ColorClock = 0;
 			_state.Scanline++;
-			if (_state.Scanline >= 262) {
+			if (_state.Scanline >= Atari2600Console::ScanlinesPerFrame) {
 				_state.Scanline = 0;
 				_state.FrameCount++;
 			}
 		}
 
 		void StepColorClocks(uint32_t colorClocks) {
-			for (uint32_t i = 0; i < colorClocks; i++) {
-				_state.TotalColorClocks++;
-				_state.ColorClock++;
-				if (_state.ColorClock >= 228) {
-					AdvanceScanline();
+			// Nothing happens between register writes, jump straight to the end of each scanline
+			_state.TotalColorClocks += colorClocks;
+			while (colorClocks > 0) {
+				uint32_t remaining = Atari2600Console::ColorClocksPerScanline - _state.ColorClock;
+				if (colorClocks < remaining) {
+					_state.ColorClock += colorClocks;
+					return;
 				}
+				colorClocks -= remaining;
+				AdvanceScanline();
 			}
 		}
 
 	public:
+		Atari2600Tia() {
+			_lineWrites.reserve(64);
+		}
+
+		void SetFrameBuffer(uint16_t* frameBuffer) {
+			_frameBuffer = frameBuffer;
+		}
+
 		void Reset() {
 			_state = {};
+			_lineWrites.clear();
 		}
 
 		void StepCpuCycles(uint32_t cpuCycles) {
-			for (uint32_t i = 0; i < cpuCycles; i++) {
-				if (_state.WsyncHold) {
-					_state.WsyncHold = false;
-					AdvanceScanline();
-				}
-				StepColorClocks(3);
+			if (cpuCycles == 0) {
+				return;
+			}
+
+			if (_state.WsyncHold) {
+				// The rest of the scanline is skipped (and rendered as a single span)
+				_state.WsyncHold = false;
+				AdvanceScanline();
 			}
+			StepColorClocks(cpuCycles * 3);
 		}
 
 		void RequestWsync() {
 			_state.WsyncHold = true;
 		}
 
+		void WriteRegister(uint8_t addr, uint8_t value) {
+			addr &= 0x3F;
+			switch (addr) {
+				case 0x02:
+					RequestWsync();
+					break;
+
+				case 0x08: case 0x09: case 0x0A: case 0x0D: case 0x0E: case 0x0F:
+					_lineWrites.push_back({(uint8_t)_state.ColorClock, addr, value});
+					break;
+			}
+		}
+
 		Atari2600TiaState GetState() const {
 			return _state;
 		}
@@ -167,8 +274,8 @@ class Atari2600Mapper {
 				_mapper->Write(addr, value);
 				return;
 			}
-			if (_tia && ((addr & 0x3F) == 0x02)) {
-				_tia->RequestWsync();
+			if (_tia) {
+				_tia->WriteRegister((uint8_t)addr, value);
 			}
 		}
 	};
@@ -241,6 +348,7 @@ Atari2600Console::Atari2600Console(Emulator* emu)
 	  _frameBuffer(ScreenWidth * ScreenHeight, 0) {
 	_controlManager = std::make_unique<Atari2600ControlManager>(emu);
 	_bus->Attach(_riot.get(), _tia.get(), _mapper.get());
+	_tia->SetFrameBuffer(_frameBuffer.data());
 	_cpu->SetReadCallback([this](uint16_t addr) {
 		return _bus->Read(addr);
 	});
@@ -290,7 +398,6 @@ void Atari2600Console::RunFrame() {
 	_lastFrameSummary.CpuCyclesThisFrame = (uint32_t)(_cpu->GetCycleCount() - startCycles);
 	_lastFrameSummary.ScanlineAtFrameEnd = tiaState.Scanline;
 	_lastFrameSummary.ColorClockAtFrameEnd = tiaState.ColorClock;
-	RenderDebugFrame();
 	if (_controlManager) {
 		_controlManager->UpdateControlDevices();
 		_controlManager->UpdateInputState();
@@ -302,6 +409,10 @@ void Atari2600Console::RequestWsync() {
 	_tia->RequestWsync();
 }
 
+void Atari2600Console::WriteTiaRegister(uint8_t addr, uint8_t value) {
+	_tia->WriteRegister(addr, value);
+}
+
 Atari2600RiotState Atari2600Console::GetRiotState() const {
 	return _riot->GetState();
 }
@@ -310,17 +421,6 @@ Atari2600TiaState Atari2600Console::GetTiaState() const {
 	return _tia->GetState();
 }
 
-void Atari2600Console::RenderDebugFrame() {
-	uint32_t frame = _lastFrameSummary.FrameCount;
-	for (uint32_t y = 0; y < ScreenHeight; y++) {
-		uint8_t shade = (uint8_t)((y + frame) & 0x1F);
-		uint16_t pixel = (uint16_t)((shade << 11) | (shade << 6) | shade);
-		for (uint32_t x = 0; x < ScreenWidth; x++) {
-			_frameBuffer[y * ScreenWidth + x] = pixel;
-		}
-	}
-}
-
 void Atari2600Console::SaveBattery() {
 }
 
@@ -24,6 +24,13 @@ struct Atari2600TiaState {
 	uint32_t ColorClock = 0;
 	bool WsyncHold = false;
 	uint64_t TotalColorClocks = 0;
+
+	uint8_t ColuPf = 0;
+	uint8_t ColuBk = 0;
+	uint8_t CtrlPf = 0;
+	uint8_t Pf0 = 0;
+	uint8_t Pf1 = 0;
+	uint8_t Pf2 = 0;
 };
 
 struct Atari2600FrameStepSummary {
@@ -46,12 +53,14 @@ private:
 	Atari2600FrameStepSummary _lastFrameSummary = {};
 	bool _romLoaded = false;
 
-	void RenderDebugFrame();
-
 public:
 	static constexpr uint32_t ScreenWidth = 160;
 	static constexpr uint32_t ScreenHeight = 192;
 	static constexpr uint32_t CpuCyclesPerFrame = 19912;
+	static constexpr uint32_t ColorClocksPerScanline = 228;
+	static constexpr uint32_t HBlankColorClocks = 68;
+	static constexpr uint32_t ScanlinesPerFrame = 262;
+	static constexpr uint32_t FirstVisibleScanline = 40;
 
 	[[nodiscard]] static vector<string> GetSupportedExtensions() { return {".a26"}; }
 	[[nodiscard]] static vector<string> GetSupportedSignatures() { return {}; }
@@ -84,6 +93,7 @@ public:
 
 	void StepCpuCycles(uint32_t cpuCycles);
 	void RequestWsync();
+	void WriteTiaRegister(uint8_t addr, uint8_t value);
 	Atari2600RiotState GetRiotState() const;
 	Atari2600TiaState GetTiaState() const;
 	Atari2600FrameStepSummary GetLastFrameSummary() const { return _lastFrameSummary; }
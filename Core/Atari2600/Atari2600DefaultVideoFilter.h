@@ -5,12 +5,36 @@
 class Emulator;
 
 class Atari2600DefaultVideoFilter final : public BaseVideoFilter {
+private:
+	uint32_t _palette[128] = {};
+
+	void InitPalette() {
+		// Approximate NTSC palette: hue 0 is grayscale, hues 1-15 are spread around the color wheel
+		constexpr double pi = 3.14159265358979323846;
+		for (int i = 0; i < 128; i++) {
+			int hue = i >> 3;
+			double y = 0.1 + 0.8 * (i & 0x07) / 7.0;
+			double iq = 0, q = 0;
+			if (hue > 0) {
+				double angle = (hue - 1) * 2 * pi / 15 + pi;
+				iq = 0.25 * std::cos(angle);
+				q = 0.25 * std::sin(angle);
+			}
+			auto toByte = [](double v) { return (uint32_t)std::clamp((int)(v * 255), 0, 255); };
+			uint32_t r = toByte(y + 0.956 * iq + 0.621 * q);
+			uint32_t g = toByte(y - 0.272 * iq - 0.647 * q);
+			uint32_t b = toByte(y - 1.106 * iq + 1.703 * q);
+			_palette[i] = 0xFF000000 | (r << 16) | (g << 8) | b;
+		}
+	}
+
 public:
 	explicit Atari2600DefaultVideoFilter(Emulator* emu) : BaseVideoFilter(emu) {
 		FrameInfo info = {};
 		info.Width = 160;
 		info.Height = 192;
 		SetBaseFrameInfo(info);
+		InitPalette();
 	}
 
 	void ApplyFilter(uint16_t* ppuOutputBuffer) override {
@@ -23,12 +47,9 @@ public:
 			return;
 		}
 
+		// The TIA outputs its color register values (bits 1-7)
 		for (uint32_t i = 0; i < pixelCount; i++) {
-			uint16_t p = ppuOutputBuffer[i];
-			uint8_t r = (uint8_t)(((p >> 11) & 0x1F) << 3);
-			uint8_t g = (uint8_t)(((p >> 5) & 0x3F) << 2);
-			uint8_t b = (uint8_t)((p & 0x1F) << 3);
-			out[i] = 0xFF000000 | (r << 16) | (g << 8) | b;
+			out[i] = _palette[(ppuOutputBuffer[i] >> 1) & 0x7F];
 		}
 	}
 };
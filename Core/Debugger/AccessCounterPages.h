@@ -0,0 +1,125 @@
+#pragma once
+#include "pch.h"
+#include <atomic>
+
+/// <summary>
+/// Access counters and timestamps for a memory address.
+/// </summary>
+struct AddressCounters {
+	uint64_t ReadStamp;    ///< Last read timestamp (master clock)
+	uint64_t WriteStamp;   ///< Last write timestamp (master clock)
+	uint64_t ExecStamp;    ///< Last execute timestamp (master clock)
+	uint32_t ReadCounter;  ///< Total read count
+	uint32_t WriteCounter; ///< Total write count
+	uint32_t ExecCounter;  ///< Total execute count
+};
+
+/// <summary>
+/// AddressCounters for one memory type, stored in pages that are allocated on the first access to them.
+/// </summary>
+/// <remarks>
+/// Most of the memory of a debugging session is never accessed (e.g large parts of GBA ROMs, unused coprocessor
+/// memories), so only the pages that are accessed use memory (40 bytes per byte of memory). Pages that were never
+/// accessed read as all zeroes, which is the same as the counters of an address that was never accessed.
+///
+/// Pages are allocated by the emulation thread only, and are never freed before the destructor (Reset() clears
+/// them), so the UI thread can read them at any time.
+/// </remarks>
+class AccessCounterPages {
+public:
+	static constexpr uint32_t PageShift = 12;
+	static constexpr uint32_t PageSize = 1 << PageShift;
+
+private:
+	unique_ptr<std::atomic<AddressCounters*>[]> _pages;
+	uint32_t _pageCount = 0;
+	uint32_t _size = 0;
+
+	AddressCounters* AllocatePage(uint32_t page) {
+		AddressCounters* counters = new AddressCounters[AccessCounterPages::PageSize]();
+		_pages[page].store(counters, std::memory_order_release);
+		return counters;
+	}
+
+	void FreePages() {
+		for (uint32_t i = 0; i < _pageCount; i++) {
+			delete[] _pages[i].load();
+		}
+		_pages.reset();
+		_pageCount = 0;
+		_size = 0;
+	}
+
+public:
+	AccessCounterPages() = default;
+	~AccessCounterPages() { FreePages(); }
+
+	AccessCounterPages(const AccessCounterPages&) = delete;
+	AccessCounterPages& operator=(const AccessCounterPages&) = delete;
+
+	/// <summary>Sets the size of the memory (no pages are allocated)</summary>
+	void Init(uint32_t size) {
+		FreePages();
+		_size = size;
+		_pageCount = (size + AccessCounterPages::PageSize - 1) >> AccessCounterPages::PageShift;
+		_pages = std::make_unique<std::atomic<AddressCounters*>[]>(_pageCount);
+	}
+
+	[[nodiscard]] uint32_t GetSize() const { return _size; }
+
+	/// <summary>Memory used by the allocated pages and the page table, in bytes</summary>
+	[[nodiscard]] uint64_t GetMemoryUsage() const {
+		uint64_t size = (uint64_t)_pageCount * sizeof(std::atomic<AddressCounters*>);
+		for (uint32_t i = 0; i < _pageCount; i++) {
+			if (_pages[i].load(std::memory_order_relaxed)) {
+				size += AccessCounterPages::PageSize * sizeof(AddressCounters);
+			}
+		}
+		return size;
+	}
+
+	/// <summary>Returns the counters for an address (must be below the size), allocates its page if needed</summary>
+	__forceinline AddressCounters& Get(uint32_t address) {
+		AddressCounters* page = _pages[address >> AccessCounterPages::PageShift].load(std::memory_order_acquire);
+		if (!page) [[unlikely]] {
+			page = AllocatePage(address >> AccessCounterPages::PageShift);
+		}
+		return page[address & (AccessCounterPages::PageSize - 1)];
+	}
+
+	/// <summary>Returns the counters for an address without allocating (all zeroes if the page was never accessed)</summary>
+	[[nodiscard]] AddressCounters Peek(uint32_t address) const {
+		if (address >= _size) {
+			return {};
+		}
+		AddressCounters* page = _pages[address >> AccessCounterPages::PageShift].load(std::memory_order_acquire);
+		return page ? page[address & (AccessCounterPages::PageSize - 1)] : AddressCounters{};
+	}
+
+	/// <summary>Copies the counters for [offset, offset + length) (must be within the size)</summary>
+	void CopyRange(uint32_t offset, uint32_t length, AddressCounters out[]) const {
+		while (length > 0) {
+			uint32_t pageOffset = offset & (AccessCounterPages::PageSize - 1);
+			uint32_t count = std::min(length, AccessCounterPages::PageSize - pageOffset);
+			AddressCounters* page = _pages[offset >> AccessCounterPages::PageShift].load(std::memory_order_acquire);
+			if (page) {
+				memcpy(out, page + pageOffset, count * sizeof(AddressCounters));
+			} else {
+				memset(out, 0, count * sizeof(AddressCounters));
+			}
+			out += count;
+			offset += count;
+			length -= count;
+		}
+	}
+
+	/// <summary>Clears all counters (allocated pages are kept)</summary>
+	void Reset() {
+		for (uint32_t i = 0; i < _pageCount; i++) {
+			AddressCounters* page = _pages[i].load();
+			if (page) {
+				memset(page, 0, AccessCounterPages::PageSize * sizeof(AddressCounters));
+			}
+		}
+	}
+};
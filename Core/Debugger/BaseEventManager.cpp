@@ -1,32 +1,131 @@
 #include "pch.h"
 #include "Debugger/BaseEventManager.h"
 
+BaseEventManager::~BaseEventManager() {
+	StopRenderThread();
+}
+
+void BaseEventManager::UpdateEventSnapshot() {
+	auto lock = _lock.AcquireSafe();
+	if (_snapshotFrameId != _frameId || _snapshotCurrentFrame.size() > _debugEvents.size()) {
+		_snapshotFrameId = _frameId;
+		_snapshotPrevFrame = _prevDebugEvents;
+		_snapshotCurrentFrame = _debugEvents;
+		_visibleEventsDirty = true;
+	} else {
+		_snapshotCurrentFrame.insert(_snapshotCurrentFrame.end(), _debugEvents.begin() + _snapshotCurrentFrame.size(), _debugEvents.end());
+	}
+	_sentEventsDirty = true;
+	RequestRender();
+}
+
+void BaseEventManager::InvalidateFilteredEvents() {
+	auto lock = _lock.AcquireSafe();
+	_visibleEventsDirty = true;
+	_sentEventsDirty = true;
+	RequestRender();
+}
+
+void BaseEventManager::RequestRender() {
+	std::lock_guard<std::mutex> lock(_renderMutex);
+	_renderRequestId++;
+	_renderSignal.notify_one();
+}
+
+void BaseEventManager::StopRenderThread() {
+	{
+		std::lock_guard<std::mutex> lock(_renderMutex);
+		_stopRenderThread = true;
+		_renderSignal.notify_one();
+		_renderDone.notify_all();
+	}
+	if (_renderThread.joinable()) {
+		_renderThread.join();
+	}
+}
+
+void BaseEventManager::RenderThread() {
+	std::unique_lock<std::mutex> lock(_renderMutex);
+	while (true) {
+		_renderSignal.wait(lock, [this] { return _stopRenderThread || _renderedId != _renderRequestId; });
+		if (_stopRenderThread) {
+			break;
+		}
+
+		uint32_t requestId = _renderRequestId;
+		lock.unlock();
+		FrameInfo size = Render(_renderBackBuffer);
+		lock.lock();
+
+		std::swap(_renderBuffer, _renderBackBuffer);
+		_renderSize = size;
+		_renderedId = requestId;
+		_renderDone.notify_all();
+	}
+}
+
+FrameInfo BaseEventManager::Render(vector<uint32_t>& buffer) {
+	auto lock = _lock.AcquireSafe();
+	if (_snapshotScanline < 0) {
+		return {};
+	}
+
+	FrameInfo size = GetDisplayBufferSize();
+
+	// Clear buffer
+	buffer.assign(size.Width * size.Height, 0xFF555555);
+
+	// Draw output screen
+	DrawScreen(buffer.data());
+
+	// Draw events, current scanline/dot, etc.
+	DrawEvents(buffer.data(), size);
+	return size;
+}
+
 void BaseEventManager::FilterEvents() {
 	auto lock = _lock.AcquireSafe();
+	if (!_sentEventsDirty) {
+		return;
+	}
+	_sentEventsDirty = false;
+
+	if (_visibleEventsDirty) {
+		_visibleEventsDirty = false;
+		_visiblePrevFrame.clear();
+		_visibleCurrentFrame.clear();
+		_filteredEventCount = 0;
+		for (DebugEventInfo& evt : _snapshotPrevFrame) {
+			if (GetEventConfig(evt).Visible) {
+				_visiblePrevFrame.push_back(evt);
+				_visiblePrevFrame.back().Flags |= (uint32_t)EventFlags::PreviousFrame;
+			}
+		}
+	}
+
+	// Only filter the events added since the last call
+	for (size_t i = _filteredEventCount; i < _snapshotCurrentFrame.size(); i++) {
+		if (GetEventConfig(_snapshotCurrentFrame[i]).Visible) {
+			_visibleCurrentFrame.push_back(_snapshotCurrentFrame[i]);
+		}
+	}
+	_filteredEventCount = _snapshotCurrentFrame.size();
+
 	_sentEvents.clear();
-	_sentEvents.reserve(_snapshotPrevFrame.size() + _snapshotCurrentFrame.size());
+	_sentEvents.reserve(_visiblePrevFrame.size() + _visibleCurrentFrame.size());
 
 	if (ShowPreviousFrameEvents() && !_forAutoRefresh) {
 		int offset = GetScanlineOffset();
 		uint32_t key = (_snapshotScanline << 16) + _snapshotCycle;
-		for (DebugEventInfo& evt : _snapshotPrevFrame) {
+		for (DebugEventInfo& evt : _visiblePrevFrame) {
 			uint32_t evtKey = ((evt.Scanline + offset) << 16) + evt.Cycle;
 			if (evtKey > key) {
-				EventViewerCategoryCfg eventCfg = GetEventConfig(evt);
-				if (eventCfg.Visible) {
-					_sentEvents.push_back(evt);
-					_sentEvents.back().Flags |= (uint32_t)EventFlags::PreviousFrame;
-				}
+				_sentEvents.push_back(evt);
 			}
 		}
 	}
 
-	for (DebugEventInfo& evt : _snapshotCurrentFrame) {
-		EventViewerCategoryCfg eventCfg = GetEventConfig(evt);
-		if (eventCfg.Visible) {
-			_sentEvents.push_back(evt);
-		}
-	}
+	_sentEvents.insert(_sentEvents.end(), _visibleCurrentFrame.begin(), _visibleCurrentFrame.end());
 }
 
 void BaseEventManager::DrawDot(uint32_t x, uint32_t y, uint32_t color, bool drawBackground, uint32_t* buffer) {
@@ -78,25 +177,24 @@ void BaseEventManager::ClearFrameEvents() {
 	// O(1) swap instead of O(n) copy — _debugEvents gets _prevDebugEvents' old storage
 	std::swap(_prevDebugEvents, _debugEvents);
 	_debugEvents.clear();
+	_frameId++;
 }
 
 void BaseEventManager::GetDisplayBuffer(uint32_t* buffer, uint32_t bufferSize) {
-	auto lock = _lock.AcquireSafe();
-	FrameInfo size = GetDisplayBufferSize();
-	if (_snapshotScanline < 0 || bufferSize < size.Width * size.Height * sizeof(uint32_t)) {
-		return;
+	std::unique_lock<std::mutex> lock(_renderMutex);
+	if (!_renderThread.joinable() && !_stopRenderThread) {
+		// Only started once the viewer is open
+		_renderThread = std::thread(&BaseEventManager::RenderThread, this);
 	}
 
-	// Clear buffer
-	for (uint32_t i = 0; i < size.Width * size.Height; i++) {
-		buffer[i] = 0xFF555555;
-	}
-
-	// Draw output screen
-	DrawScreen(buffer);
+	// Wait for the latest snapshot/configuration to be rendered
+	_renderDone.wait(lock, [this] { return _stopRenderThread || _renderedId == _renderRequestId; });
 
-	// Draw events, current scanline/dot, etc.
-	DrawEvents(buffer, size);
+	uint32_t pixelCount = _renderSize.Width * _renderSize.Height;
+	if (pixelCount == 0 || _renderBuffer.size() < pixelCount || bufferSize < pixelCount * sizeof(uint32_t)) {
+		return;
+	}
+	memcpy(buffer, _renderBuffer.data(), pixelCount * sizeof(uint32_t));
 }
 
 void BaseEventManager::DrawLine(uint32_t* buffer, FrameInfo size, uint32_t color, uint32_t row) {
@@ -1,5 +1,8 @@
 #pragma once
 #include "pch.h"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include "Debugger/DebugTypes.h"
 #include "Shared/SettingTypes.h"
 #include "Utilities/SimpleLock.h"
@@ -53,6 +56,40 @@ struct EventViewerCategoryCfg {
 struct BaseEventViewerConfig {
 };
 
+/// <summary>
+/// Lock held by TakeEventSnapshot while it copies the events and the screen.
+/// </summary>
+/// <remarks>
+/// Auto-refresh snapshots are taken by the emulation thread: when the render thread is busy with the previous
+/// snapshot, the new one is skipped (the next frame will take one) instead of stalling the emulation.
+/// </remarks>
+class EventSnapshotLock {
+private:
+	SimpleLock& _lock;
+	bool _acquired;
+
+public:
+	EventSnapshotLock(SimpleLock& lock, bool forAutoRefresh) : _lock(lock) {
+		if (forAutoRefresh) {
+			_acquired = lock.TryAcquire(0);
+		} else {
+			lock.Acquire();
+			_acquired = true;
+		}
+	}
+
+	~EventSnapshotLock() {
+		if (_acquired) {
+			_lock.Release();
+		}
+	}
+
+	EventSnapshotLock(const EventSnapshotLock&) = delete;
+	EventSnapshotLock& operator=(const EventSnapshotLock&) = delete;
+
+	[[nodiscard]] bool IsAcquired() const { return _acquired; }
+};
+
 /// <summary>
 /// Base class for platform-specific event managers (event viewer tool).
 /// </summary>
@@ -73,12 +110,14 @@ struct BaseEventViewerConfig {
 /// - Manual mode: snapshot on request
 ///
 /// Event rendering:
-/// - GetDisplayBuffer(): Render events to ARGB bitmap
+/// - Done by a render thread (started when the viewer first asks for its output), into a double buffer
+/// - Each new snapshot/configuration queues a render, GetDisplayBuffer() copies the latest rendered frame
+/// - The emulation thread only copies the raw screen and events (TakeEventSnapshot)
 /// - DrawEvents(): Draw dots/lines at scanline/cycle positions
 /// - Platform-specific coordinate conversion (NTSC/PAL timing)
 ///
 /// Filtering:
-/// - FilterEvents(): Apply visibility filters
+/// - FilterEvents(): Apply visibility filters, incrementally (only new events are filtered)
 /// - GetEventConfig(): Get category color/visibility
 ///
 /// Use cases:
@@ -100,13 +139,61 @@ protected:
 	bool _forAutoRefresh = false;                 ///< True if auto-refresh mode
 	SimpleLock _lock;                             ///< Thread-safety lock
 
+	uint32_t _frameId = 0;                      ///< Incremented by ClearFrameEvents
+	uint32_t _snapshotFrameId = UINT32_MAX;     ///< _frameId when the snapshot's previous frame events were copied
+	vector<DebugEventInfo> _visiblePrevFrame;    ///< Visible events of _snapshotPrevFrame (with the PreviousFrame flag)
+	vector<DebugEventInfo> _visibleCurrentFrame; ///< Visible events of _snapshotCurrentFrame
+	size_t _filteredEventCount = 0;              ///< Number of _snapshotCurrentFrame events filtered into _visibleCurrentFrame
+	bool _visibleEventsDirty = true;             ///< Visible event lists must be rebuilt (new frame or new configuration)
+	bool _sentEventsDirty = true;                ///< _sentEvents must be rebuilt (new snapshot or new configuration)
+
+	std::thread _renderThread;
+	std::mutex _renderMutex;                 ///< Protects the render buffers and ids
+	std::condition_variable _renderSignal;   ///< Wakes the render thread up (new render request or stop)
+	std::condition_variable _renderDone;     ///< Signaled when a frame has been rendered
+	vector<uint32_t> _renderBuffer;          ///< Last rendered frame (ARGB)
+	vector<uint32_t> _renderBackBuffer;      ///< Frame being rendered
+	FrameInfo _renderSize = {};              ///< Size of _renderBuffer's frame
+	uint32_t _renderRequestId = 0;           ///< Incremented when the snapshot or configuration changes
+	uint32_t _renderedId = 0;                ///< _renderRequestId of the frame in _renderBuffer
+	bool _stopRenderThread = false;
+
+	/// <summary>
+	/// Queue a render of the current snapshot (called when the snapshot or the configuration changes).
+	/// </summary>
+	void RequestRender();
+
+	/// <summary>
+	/// Render thread, renders the snapshot into the back buffer and swaps the buffers.
+	/// </summary>
+	void RenderThread();
+
+	/// <summary>
+	/// Draw the snapshot's screen and events (render thread, under _lock).
+	/// </summary>
+	FrameInfo Render(vector<uint32_t>& buffer);
+
+	/// <summary>
+	/// Copy the frame's events to the snapshot (called by TakeEventSnapshot, emulation must be paused).
+	/// </summary>
+	/// <remarks>
+	/// Events are only ever appended during a frame, so when the frame didn't change since the last snapshot,
+	/// only the new events are copied (and filtered), instead of both frames' events.
+	/// </remarks>
+	void UpdateEventSnapshot();
+
+	/// <summary>
+	/// Discard the filtered events (called when the configuration changes).
+	/// </summary>
+	void InvalidateFilteredEvents();
+
 	/// <summary>
 	/// Check if previous frame events should be shown (platform-specific).
 	/// </summary>
 	virtual bool ShowPreviousFrameEvents() = 0;
 
 	/// <summary>
-	/// Apply visibility filters to events.
+	/// Apply visibility filters to events (no-op if neither the snapshot nor the configuration changed).
 	/// </summary>
 	void FilterEvents();
 
@@ -146,7 +233,12 @@ protected:
 	void DrawEvent(DebugEventInfo& evt, bool drawBackground, uint32_t* buffer);
 
 public:
-	virtual ~BaseEventManager() {}
+	virtual ~BaseEventManager();
+
+	/// <summary>
+	/// Stop the render thread (must be called before the derived event manager is destroyed, the thread uses its DrawScreen).
+	/// </summary>
+	void StopRenderThread();
 
 	/// <summary>
 	/// Set event viewer configuration (platform-specific).
@@ -200,7 +292,7 @@ public:
 	virtual DebugEventInfo GetEvent(uint16_t scanline, uint16_t cycle) = 0;
 
 	/// <summary>
-	/// Render events to ARGB display buffer.
+	/// Copy the latest rendered frame to an ARGB display buffer (waits for the render of the latest snapshot/configuration).
 	/// </summary>
 	void GetDisplayBuffer(uint32_t* buffer, uint32_t bufferSize);
 };
@@ -163,10 +163,22 @@ protected:
 	uint64_t* _rowIds = nullptr;
 	TraceLogPpuState* _ppuState = nullptr;
 
+	/// <summary>Binary row written to the trace log file, formatted to text when logging stops</summary>
+	struct FileRecord {
+		CpuStateType CpuState;
+		TraceLogPpuState PpuState;
+		DisassemblyInfo Disassembly;
+		EffectiveAddressInfo EffectiveAddress; ///< Captured at log time (the values in memory change afterwards)
+		uint16_t MemoryValue;
+	};
+
+	FileRecord _fileRecord = {};                   ///< Persistent buffer for the record written by AddRow
+	const FileRecord* _formattedRecord = nullptr; ///< Record being formatted by FormatFileRecord (uses its captured effective address)
+	bool _formatUsesEffectiveAddress = false;     ///< Format string contains [EffectiveAddress] or [MemoryValue]
+
 	unique_ptr<ExpressionEvaluator> _expEvaluator;
 	ExpressionData _conditionData;
 
-	string _rowBuffer;      ///< Persistent buffer for AddRow (avoids per-instruction alloc)
 	string _byteCodeBuffer; ///< Persistent buffer for WriteByteCode (avoids per-instruction alloc)
 
 	void WriteByteCode(DisassemblyInfo& info, RowPart& rowPart, string& output) {
@@ -197,7 +209,7 @@ protected:
 	}
 
 	void WriteEffectiveAddress(DisassemblyInfo& info, RowPart& rowPart, void* cpuState, string& output, MemoryType cpuMemoryType, CpuType cpuType) {
-		EffectiveAddressInfo effectiveAddress = info.GetEffectiveAddress(_debugger, cpuState, cpuType);
+		EffectiveAddressInfo effectiveAddress = _formattedRecord ? _formattedRecord->EffectiveAddress : info.GetEffectiveAddress(_debugger, cpuState, cpuType);
 		if (effectiveAddress.ShowAddress && effectiveAddress.Address >= 0) {
 			MemoryType effectiveMemType = effectiveAddress.Type == MemoryType::None ? cpuMemoryType : effectiveAddress.Type;
 			if (_options.UseLabels) {
@@ -219,10 +231,10 @@ protected:
 	}
 
 	void WriteMemoryValue(DisassemblyInfo& info, RowPart& rowPart, void* cpuState, string& output, MemoryType memType, CpuType cpuType) {
-		EffectiveAddressInfo effectiveAddress = info.GetEffectiveAddress(_debugger, cpuState, cpuType);
+		EffectiveAddressInfo effectiveAddress = _formattedRecord ? _formattedRecord->EffectiveAddress : info.GetEffectiveAddress(_debugger, cpuState, cpuType);
 		if (effectiveAddress.Address >= 0 && effectiveAddress.ValueSize > 0) {
 			MemoryType effectiveMemType = effectiveAddress.Type == MemoryType::None ? memType : effectiveAddress.Type;
-			uint16_t value = info.GetMemoryValue(effectiveAddress, _memoryDumper, effectiveMemType);
+			uint16_t value = _formattedRecord ? _formattedRecord->MemoryValue : info.GetMemoryValue(effectiveAddress, _memoryDumper, effectiveMemType);
 			if (rowPart.DisplayInHex) {
 				output += "= $";
 				if (effectiveAddress.ValueSize == 2) {
@@ -289,18 +301,23 @@ protected:
 
 		_pendingLog = false;
 
-		if (_debugger->GetTraceLogFileSaver()->IsEnabled()) {
-			_rowBuffer.clear();
-
-			// Display PC
-			RowPart rowPart = {};
-			rowPart.DisplayInHex = true;
-			rowPart.MinWidth = DebugUtilities::GetProgramCounterSize(_cpuType);
-			WriteIntValue(_rowBuffer, ((TraceLoggerType*)this)->GetProgramCounter(cpuState), rowPart);
-			_rowBuffer += "  ";
-
-			((TraceLoggerType*)this)->GetTraceRow(_rowBuffer, cpuState, _ppuState[_currentPos], disassemblyInfo);
-			_debugger->GetTraceLogFileSaver()->Log(_rowBuffer);
+		TraceLogFileSaver* fileSaver = _debugger->GetTraceLogFileSaver();
+		if (fileSaver->IsEnabled()) {
+			// Only copy the row's data, it is formatted to text when logging stops
+			_fileRecord.CpuState = cpuState;
+			_fileRecord.PpuState = _ppuState[_currentPos];
+			_fileRecord.Disassembly = disassemblyInfo;
+			_fileRecord.EffectiveAddress = {};
+			_fileRecord.MemoryValue = 0;
+			if (_formatUsesEffectiveAddress) {
+				EffectiveAddressInfo effectiveAddress = disassemblyInfo.GetEffectiveAddress(_debugger, &cpuState, _cpuType);
+				_fileRecord.EffectiveAddress = effectiveAddress;
+				if (effectiveAddress.Address >= 0 && effectiveAddress.ValueSize > 0) {
+					MemoryType effectiveMemType = effectiveAddress.Type == MemoryType::None ? _cpuMemoryType : effectiveAddress.Type;
+					_fileRecord.MemoryValue = disassemblyInfo.GetMemoryValue(effectiveAddress, _memoryDumper, effectiveMemType);
+				}
+			}
+			fileSaver->LogRecord(_cpuType, _fileRecord);
 		}
 
 		_currentPos = (_currentPos + 1) % ExecutionLogSize;
@@ -308,6 +325,7 @@ protected:
 
 	void ParseFormatString(const string& format) {
 		_rowParts.clear();
+		_formatUsesEffectiveAddress = false;
 
 		std::regex formatRegex = std::regex("(\\[\\s*([^[]*?)\\s*(,\\s*([\\d]*)\\s*(h){0,1}){0,1}\\s*\\])|([^[]*)", std::regex_constants::icase);
 		std::sregex_iterator start = std::sregex_iterator(format.cbegin(), format.cend(), formatRegex);
@@ -337,6 +355,7 @@ protected:
 					}
 				}
 				part.DisplayInHex = match.str(5) == "h";
+				_formatUsesEffectiveAddress |= part.DataType == RowDataType::EffectiveAddress || part.DataType == RowDataType::MemoryValue;
 
 				_rowParts.push_back(part);
 			}
@@ -525,6 +544,26 @@ public:
 		return true;
 	}
 
+	void FormatFileRecord(const uint8_t* record, uint32_t size, string& output) override {
+		if (size != sizeof(FileRecord)) {
+			return;
+		}
+
+		FileRecord fileRecord;
+		memcpy(&fileRecord, record, sizeof(FileRecord));
+
+		// Display PC
+		RowPart rowPart = {};
+		rowPart.DisplayInHex = true;
+		rowPart.MinWidth = DebugUtilities::GetProgramCounterSize(_cpuType);
+		WriteIntValue(output, ((TraceLoggerType*)this)->GetProgramCounter(fileRecord.CpuState), rowPart);
+		output += "  ";
+
+		_formattedRecord = &fileRecord;
+		((TraceLoggerType*)this)->GetTraceRow(output, fileRecord.CpuState, fileRecord.PpuState, fileRecord.Disassembly);
+		_formattedRecord = nullptr;
+	}
+
 	void GetExecutionTrace(TraceRow& row, uint32_t offset) override {
 		int pos = ((int)_currentPos - offset);
 		int index = (pos > 0 ? pos : BaseTraceLogger::ExecutionLogSize + pos) - 1;
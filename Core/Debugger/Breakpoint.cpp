@@ -33,6 +33,18 @@ CpuType Breakpoint::GetCpuType() {
 	return _cpuType;
 }
 
+MemoryType Breakpoint::GetMemoryType() {
+	return _memoryType;
+}
+
+int32_t Breakpoint::GetStartAddress() {
+	return _startAddr;
+}
+
+int32_t Breakpoint::GetEndAddress() {
+	return _endAddr;
+}
+
 bool Breakpoint::IsEnabled() {
 	return _enabled;
 }
@@ -102,6 +102,21 @@ public:
 	/// </summary>
 	CpuType GetCpuType();
 
+	/// <summary>
+	/// Get memory type the address range applies to.
+	/// </summary>
+	MemoryType GetMemoryType();
+
+	/// <summary>
+	/// Get range start address (inclusive).
+	/// </summary>
+	int32_t GetStartAddress();
+
+	/// <summary>
+	/// Get range end address (inclusive).
+	/// </summary>
+	int32_t GetEndAddress();
+
 	/// <summary>
 	/// Check if breakpoint enabled.
 	/// </summary>
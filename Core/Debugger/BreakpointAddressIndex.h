@@ -0,0 +1,126 @@
+#pragma once
+#include "pch.h"
+#include "Debugger/DebugUtilities.h"
+#include "Shared/MemoryType.h"
+
+/// <summary>
+/// Address index of the breakpoints for one operation type, used to find the breakpoints an access can match.
+/// </summary>
+/// <remarks>
+/// Each memory type has its breakpoint ranges sorted by start address (with the running max of their end
+/// addresses) and a bitmap of the 256-byte pages they cover:
+/// - Accesses to a page without breakpoints cost one bit test (the common case)
+/// - Otherwise, only the ranges that start at/before the access are scanned, backwards, until the running
+///   max end address is below the access (usually 0 or 1 range)
+///
+/// Rebuilt by BreakpointManager::SetBreakpoints, read-only afterwards.
+/// </remarks>
+class BreakpointAddressIndex {
+private:
+	static constexpr uint32_t PageShift = 8;
+
+	struct BreakpointRange {
+		int64_t Start;
+		int64_t End;
+		uint32_t Index; ///< Breakpoint index in BreakpointManager's list
+	};
+
+	struct MemoryTypeRanges {
+		vector<BreakpointRange> Ranges; ///< Sorted by start address
+		vector<int64_t> MaxEnd;         ///< MaxEnd[i] = highest end address in Ranges[0..i]
+		vector<uint64_t> Pages;         ///< 1 bit per page, starting at FirstPage
+		int64_t FirstPage = 0;
+	};
+
+	MemoryTypeRanges _memTypes[DebugUtilities::GetMemoryTypeCount()];
+
+	__forceinline static bool IsPageUsed(const MemoryTypeRanges& ranges, int64_t address) {
+		uint64_t page = (uint64_t)((address >> PageShift) - ranges.FirstPage);
+		return page < (uint64_t)ranges.Pages.size() * 64 && ((ranges.Pages[page >> 6] >> (page & 0x3F)) & 0x01);
+	}
+
+public:
+	/// <summary>Removes all breakpoints from the index</summary>
+	void Clear() {
+		for (MemoryTypeRanges& ranges : _memTypes) {
+			ranges.Ranges.clear();
+			ranges.MaxEnd.clear();
+			ranges.Pages.clear();
+			ranges.FirstPage = 0;
+		}
+	}
+
+	/// <summary>Adds a breakpoint's address range (inclusive), Build() must be called once all breakpoints are added</summary>
+	void Add(MemoryType memType, int32_t start, int32_t end, uint32_t index) {
+		if (start <= end) {
+			_memTypes[(int)memType].Ranges.push_back({start, end, index});
+		}
+	}
+
+	/// <summary>Sorts the ranges and builds the page bitmaps</summary>
+	void Build() {
+		for (MemoryTypeRanges& ranges : _memTypes) {
+			std::sort(ranges.Ranges.begin(), ranges.Ranges.end(), [](const BreakpointRange& a, const BreakpointRange& b) {
+				return a.Start < b.Start || (a.Start == b.Start && a.Index < b.Index);
+			});
+
+			ranges.MaxEnd.resize(ranges.Ranges.size());
+			int64_t maxEnd = INT64_MIN;
+			int64_t firstPage = INT64_MAX;
+			int64_t lastPage = -1;
+			for (size_t i = 0; i < ranges.Ranges.size(); i++) {
+				const BreakpointRange& range = ranges.Ranges[i];
+				maxEnd = std::max(maxEnd, range.End);
+				ranges.MaxEnd[i] = maxEnd;
+				if (range.End >= 0) {
+					firstPage = std::min(firstPage, std::max<int64_t>(range.Start, 0) >> PageShift);
+					lastPage = std::max(lastPage, range.End >> PageShift);
+				}
+			}
+
+			if (lastPage < 0) {
+				continue;
+			}
+
+			// Negative addresses are never in the bitmap, they always go through the range list
+			ranges.FirstPage = firstPage;
+			ranges.Pages.assign((size_t)((lastPage - firstPage) / 64 + 1), 0);
+			for (const BreakpointRange& range : ranges.Ranges) {
+				if (range.End >= 0) {
+					for (int64_t page = std::max<int64_t>(range.Start, 0) >> PageShift; page <= range.End >> PageShift; page++) {
+						ranges.Pages[(size_t)((page - firstPage) >> 6)] |= 1ULL << ((page - firstPage) & 0x3F);
+					}
+				}
+			}
+		}
+	}
+
+	/// <summary>
+	/// Appends the index of every breakpoint of the given memory type whose range overlaps [address, address + accessWidth - 1].
+	/// </summary>
+	/// <remarks>Candidates are appended in no particular order.</remarks>
+	template <uint8_t accessWidth>
+	__forceinline void GetCandidates(MemoryType memType, int32_t address, vector<uint32_t>& out) {
+		const MemoryTypeRanges& ranges = _memTypes[(int)memType];
+		if (ranges.Ranges.empty()) {
+			return;
+		}
+
+		int64_t start = address;
+		int64_t end = start + accessWidth - 1;
+		if (start >= 0 && !IsPageUsed(ranges, start) && (accessWidth == 1 || !IsPageUsed(ranges, end))) {
+			return;
+		}
+
+		// Ranges that start after the access can't match, and the scan can stop once no earlier range reaches the access
+		size_t i = std::upper_bound(ranges.Ranges.begin(), ranges.Ranges.end(), end, [](int64_t value, const BreakpointRange& range) {
+			return value < range.Start;
+		}) - ranges.Ranges.begin();
+
+		for (; i > 0 && ranges.MaxEnd[i - 1] >= start; i--) {
+			if (ranges.Ranges[i - 1].End >= start) {
+				out.push_back(ranges.Ranges[i - 1].Index);
+			}
+		}
+	}
+};
@@ -17,14 +17,20 @@ BreakpointManager::BreakpointManager(Debugger* debugger, IDebugger* cpuDebugger,
 	_hasBreakpoint = false;
 
 	_eventManager = eventManager;
+
+	for (int i = 0; i < BreakpointManager::BreakpointTypeCount; i++) {
+		_addressIndex[i] = std::make_unique<BreakpointAddressIndex>();
+	}
 }
 
 void BreakpointManager::SetBreakpoints(Breakpoint breakpoints[], uint32_t count) {
 	_hasBreakpoint = false;
+	_hasReadWriteBreakpoint = false;
 	for (int i = 0; i < BreakpointManager::BreakpointTypeCount; i++) {
 		_breakpoints[i].clear();
 		_rpnList[i].clear();
 		_hasBreakpointType[i] = false;
+		_addressIndex[i]->Clear();
 	}
 
 	_forbidBreakpoints.clear();
@@ -64,22 +70,31 @@ void BreakpointManager::SetBreakpoints(Breakpoint breakpoints[], uint32_t count)
 				}
 
 				if (bp.IsAllowedForOpType(opType)) {
+					_addressIndex[i]->Add(bp.GetMemoryType(), bp.GetStartAddress(), bp.GetEndAddress(), (uint32_t)_breakpoints[i].size());
 					_breakpoints[i].push_back(bp);
-				}
 
-				if (bp.HasCondition()) {
-					bool success = true;
-					ExpressionData data = _bpExpEval->GetRpnList(bp.GetCondition(), success);
-					_rpnList[i].push_back(success ? data : ExpressionData());
-				} else {
-					_rpnList[i].emplace_back();
+					// Keep _rpnList aligned with _breakpoints (the conditions are looked up by breakpoint index)
+					if (bp.HasCondition()) {
+						bool success = true;
+						ExpressionData data = _bpExpEval->GetRpnList(bp.GetCondition(), success);
+						_rpnList[i].push_back(success ? data : ExpressionData());
+					} else {
+						_rpnList[i].emplace_back();
+					}
 				}
 
 				_hasBreakpoint = true;
 				_hasBreakpointType[i] = true;
+				if (GetBreakpointType(opType) != BreakpointType::Execute) {
+					_hasReadWriteBreakpoint = true;
+				}
 			}
 		}
 	}
+
+	for (int i = 0; i < BreakpointManager::BreakpointTypeCount; i++) {
+		_addressIndex[i]->Build();
+	}
 }
 
 bool BreakpointManager::IsForbidden(MemoryOperationInfo* memoryOpPtr, AddressInfo& relAddr, AddressInfo& absAddr) {
@@ -126,20 +141,39 @@ BreakpointType BreakpointManager::GetBreakpointType(MemoryOperationType type) {
 
 template <uint8_t accessWidth>
 int BreakpointManager::InternalCheckBreakpoint(MemoryOperationInfo operationInfo, AddressInfo& address, bool processMarkedBreakpoints) {
+	// Same matching rules as Breakpoint::Matches: breakpoints on the operation's (CPU-relative) memory type are
+	// matched against its relative address, other breakpoints against the absolute address
+	int typeIndex = (int)operationInfo.Type;
+	BreakpointAddressIndex& index = *_addressIndex[typeIndex];
+	_candidates.clear();
+	bool isRelative = DebugUtilities::IsRelativeMemory(operationInfo.MemType);
+	if (isRelative) {
+		index.GetCandidates<accessWidth>(operationInfo.MemType, (int32_t)operationInfo.Address, _candidates);
+	}
+	if (!isRelative || address.Type != operationInfo.MemType) {
+		index.GetCandidates<accessWidth>(address.Type, address.Address, _candidates);
+	}
+
+	if (_candidates.empty()) {
+		return -1;
+	}
+	if (_candidates.size() > 1) {
+		// Process the candidates in the breakpoint list's order (marked breakpoints before the one that breaks, etc.)
+		std::sort(_candidates.begin(), _candidates.end());
+	}
+
 	EvalResultType resultType;
-	vector<Breakpoint>& breakpoints = _breakpoints[(int)operationInfo.Type];
-	for (size_t i = 0, len = breakpoints.size(); i < len; i++) {
-		if (breakpoints[i].Matches<accessWidth>(operationInfo, address)) {
-			if (breakpoints[i].HasCondition() && !_bpExpEval->Evaluate(_rpnList[(int)operationInfo.Type][i], resultType, operationInfo, address)) {
-				continue;
-			}
+	vector<Breakpoint>& breakpoints = _breakpoints[typeIndex];
+	for (uint32_t i : _candidates) {
+		if (breakpoints[i].HasCondition() && !_bpExpEval->Evaluate(_rpnList[typeIndex][i], resultType, operationInfo, address)) {
+			continue;
+		}
 
-			if (breakpoints[i].IsMarked() && processMarkedBreakpoints) {
-				_eventManager->AddEvent(DebugEventType::Breakpoint, operationInfo, breakpoints[i].GetId());
-			}
-			if (breakpoints[i].IsEnabled()) {
-				return breakpoints[i].GetId();
-			}
+		if (breakpoints[i].IsMarked() && processMarkedBreakpoints) {
+			_eventManager->AddEvent(DebugEventType::Breakpoint, operationInfo, breakpoints[i].GetId());
+		}
+		if (breakpoints[i].IsEnabled()) {
+			return breakpoints[i].GetId();
 		}
 	}
 
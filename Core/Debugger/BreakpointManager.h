@@ -1,6 +1,7 @@
 #pragma once
 #include "pch.h"
 #include "Debugger/Breakpoint.h"
+#include "Debugger/BreakpointAddressIndex.h"
 #include "Debugger/DebugTypes.h"
 #include "Debugger/DebugUtilities.h"
 
@@ -27,8 +28,8 @@ enum class MemoryOperationType;
 ///
 /// Breakpoint evaluation:
 /// 1. Fast path: Check if any breakpoints exist for operation type
-/// 2. Address match: Linear search through breakpoints for type
-/// 3. Condition eval: Evaluate RPN expression if breakpoint has condition
+/// 2. Address match: Per-type address index (page bitmap + sorted ranges) returns the candidate breakpoints
+/// 3. Condition eval: Evaluate RPN expression if breakpoint has condition (candidates only)
 /// 4. Result: Breakpoint ID if match, -1 if no match
 ///
 /// Forbidden breakpoints:
@@ -54,6 +55,10 @@ private:
 	vector<ExpressionData> _rpnList[BreakpointTypeCount]; ///< RPN expression cache per type
 	bool _hasBreakpoint;                                  ///< True if any breakpoints exist
 	bool _hasBreakpointType[BreakpointTypeCount] = {};    ///< Per-type existence flags
+	bool _hasReadWriteBreakpoint = false;                 ///< True if any breakpoint applies to non-execute operations
+
+	unique_ptr<BreakpointAddressIndex> _addressIndex[BreakpointTypeCount]; ///< Address index of _breakpoints, per type
+	vector<uint32_t> _candidates;                                          ///< Candidate breakpoints for the current access
 
 	vector<Breakpoint> _forbidBreakpoints; ///< Forbidden breakpoint list
 	vector<ExpressionData> _forbidRpn;     ///< Forbidden RPN expressions
@@ -104,6 +109,7 @@ public:
 	/// 2. Group breakpoints by operation type
 	/// 3. Compile conditional expressions to RPN
 	/// 4. Update per-type existence flags
+	/// 5. Rebuild the per-type address indexes
 	/// </remarks>
 	void SetBreakpoints(Breakpoint breakpoints[], uint32_t count);
 
@@ -128,6 +134,15 @@ public:
 	/// <returns>True if at least one breakpoint enabled</returns>
 	__forceinline bool HasBreakpoints() { return _hasBreakpoint; }
 
+	/// <summary>
+	/// Check if any breakpoint applies to read/write operations (as opposed to execute ones only).
+	/// </summary>
+	/// <remarks>
+	/// When false, the only predicted accesses of an instruction that can match a breakpoint are its
+	/// opcode/operand fetches, which don't require running the dummy CPU.
+	/// </remarks>
+	[[nodiscard]] __forceinline bool HasReadWriteBreakpoints() { return _hasReadWriteBreakpoint; }
+
 	/// <summary>
 	/// Check if breakpoints exist for operation type.
 	/// </summary>
@@ -46,9 +46,10 @@ class IDebugger;
 /// - Inline IsReturnAddrMatch() for performance (every RTS)
 /// </remarks>
 class CallstackManager {
-private:
+public:
 	static constexpr uint32_t MaxCallstackSize = 512;
 
+private:
 	Debugger* _debugger;                                           ///< Parent debugger instance
 	std::array<StackFrameInfo, MaxCallstackSize> _callstackArray;  ///< Contiguous ring buffer for callstack
 	uint32_t _callstackHead = 0;                                   ///< Write position (next slot to write)
@@ -0,0 +1,130 @@
+#pragma once
+#include "pch.h"
+#include <atomic>
+#include "Debugger/DebugTypes.h"
+
+/// <summary>
+/// Tracks which pages of a CodeDataLogger's flags changed, and maintains its code/data byte counts incrementally.
+/// </summary>
+/// <remarks>
+/// Each 4KB page holds the value of the change counter at the time of its last change. Queries pass the token
+/// returned by the previous query and get the pages changed since then, so the UI only needs to re-read those
+/// pages (instead of the whole CDL, up to 32MB for GBA ROMs) and the statistics don't need a full scan.
+///
+/// Only called when flags actually change (rare after the first few frames), on the emulation thread.
+/// Queries can run on another thread: a page changed while a query is running is reported by that query or by
+/// the next one, never missed (the stamp is re-written if the counter moved while it was being stored).
+/// </remarks>
+class CdlChangeTracker {
+public:
+	static constexpr uint32_t PageShift = 12;
+	static constexpr uint32_t PageSize = 1 << PageShift;
+
+private:
+	unique_ptr<std::atomic<uint32_t>[]> _pageStamps;
+	uint32_t _pageCount = 0;
+	std::atomic<uint32_t> _changeCounter = 1;
+	uint32_t _codeBytes = 0;
+	uint32_t _dataBytes = 0; ///< Bytes marked as data, but not as code
+
+	[[nodiscard]] static __forceinline uint32_t IsDataOnly(uint8_t flags) {
+		return (flags & (CdlFlags::Code | CdlFlags::Data)) == CdlFlags::Data;
+	}
+
+	void StampPage(uint32_t page) {
+		// If a query incremented the counter while the stamp was being written, the query may not have seen the
+		// stamp: write the new value, so the next query reports the page
+		uint32_t stamp = _changeCounter.load();
+		while (true) {
+			_pageStamps[page].store(stamp);
+			uint32_t counter = _changeCounter.load();
+			if (counter == stamp) {
+				break;
+			}
+			stamp = counter;
+		}
+	}
+
+public:
+	/// <summary>Sets the size of the tracked memory (all pages are considered changed)</summary>
+	void Init(uint32_t memSize) {
+		_pageCount = (memSize + CdlChangeTracker::PageSize - 1) >> CdlChangeTracker::PageShift;
+		_pageStamps = std::make_unique<std::atomic<uint32_t>[]>(_pageCount);
+		MarkAllChanged();
+	}
+
+	/// <summary>Updates the counts and page stamp for a byte whose flags changed</summary>
+	__forceinline void OnFlagsChanged(uint32_t addr, uint8_t oldFlags, uint8_t newFlags) {
+		UpdateCounts(oldFlags, newFlags);
+		StampPage(addr >> CdlChangeTracker::PageShift);
+	}
+
+	/// <summary>Updates the counts for a byte whose flags changed (the page must be marked with MarkRangeChanged)</summary>
+	__forceinline void UpdateCounts(uint8_t oldFlags, uint8_t newFlags) {
+		_codeBytes += (newFlags & CdlFlags::Code) - (oldFlags & CdlFlags::Code);
+		_dataBytes += IsDataOnly(newFlags) - IsDataOnly(oldFlags);
+	}
+
+	/// <summary>Marks pages [start, end] (by byte address) as changed, used after bulk updates</summary>
+	void MarkRangeChanged(uint32_t start, uint32_t end) {
+		for (uint32_t page = start >> CdlChangeTracker::PageShift; page <= (end >> CdlChangeTracker::PageShift) && page < _pageCount; page++) {
+			StampPage(page);
+		}
+	}
+
+	void MarkAllChanged() {
+		if (_pageCount > 0) {
+			MarkRangeChanged(0, (_pageCount - 1) << CdlChangeTracker::PageShift);
+		}
+	}
+
+	/// <summary>Recomputes the code/data byte counts with a full scan (after a bulk update)</summary>
+	void Recount(const uint8_t* cdlData, uint32_t size) {
+		uint32_t codeBytes = 0;
+		uint32_t dataBytes = 0;
+		for (uint32_t i = 0; i < size; i++) {
+			codeBytes += cdlData[i] & CdlFlags::Code;
+			dataBytes += IsDataOnly(cdlData[i]);
+		}
+		_codeBytes = codeBytes;
+		_dataBytes = dataBytes;
+	}
+
+	/// <summary>Returns a token, pages changed after this call get a stamp >= the token</summary>
+	uint32_t TakeToken() {
+		return _changeCounter.fetch_add(1) + 1;
+	}
+
+	/// <summary>Stamp of the page's last change (compare with a token from TakeToken/GetChangedPages)</summary>
+	[[nodiscard]] uint32_t GetPageStamp(uint32_t page) const {
+		return page < _pageCount ? _pageStamps[page].load() : 0;
+	}
+
+	[[nodiscard]] uint32_t GetCodeBytes() const { return _codeBytes; }
+	[[nodiscard]] uint32_t GetDataBytes() const { return _dataBytes; }
+
+	/// <summary>
+	/// Lists the pages changed since the given token.
+	/// </summary>
+	/// <param name="token">0 to get all pages, otherwise the token returned by the previous call</param>
+	/// <param name="pages">Output page indexes (byte address >> PageShift), in increasing order</param>
+	/// <param name="maxCount">Size of the pages array</param>
+	/// <param name="nextToken">Token to use for the next call (unchanged if the array was too small, call again with a bigger array)</param>
+	/// <returns>Number of pages written to the array</returns>
+	uint32_t GetChangedPages(uint32_t token, uint32_t pages[], uint32_t maxCount, uint32_t& nextToken) {
+		// Changes made from now on get a stamp >= nextToken, earlier ones are visible to the loop below
+		nextToken = TakeToken();
+
+		uint32_t count = 0;
+		for (uint32_t page = 0; page < _pageCount; page++) {
+			if (_pageStamps[page].load() >= token) {
+				if (count == maxCount) {
+					nextToken = token;
+					break;
+				}
+				pages[count++] = page;
+			}
+		}
+		return count;
+	}
+};
@@ -27,6 +27,15 @@ CdlStatistics CdlManager::GetCdlStatistics(MemoryType memType) {
 	return cdl ? cdl->GetStatistics() : CdlStatistics{};
 }
 
+uint32_t CdlManager::GetCdlChangedPages(MemoryType memType, uint32_t token, uint32_t pages[], uint32_t maxCount, uint32_t& nextToken) {
+	CodeDataLogger* cdl = GetCodeDataLogger(memType);
+	if (!cdl) {
+		nextToken = token;
+		return 0;
+	}
+	return cdl->GetChangedPages(token, pages, maxCount, nextToken);
+}
+
 uint32_t CdlManager::GetCdlFunctions(MemoryType memType, uint32_t functions[], uint32_t maxSize) {
 	CodeDataLogger* cdl = GetCodeDataLogger(memType);
 	return cdl ? cdl->GetFunctions(functions, maxSize) : 0;
@@ -118,3 +127,13 @@ int16_t CdlManager::GetCdlFlags(MemoryType memType, uint32_t addr) {
 CodeDataLogger* CdlManager::GetCodeDataLogger(MemoryType memType) {
 	return _codeDataLoggers[(int)memType];
 }
+
+uint64_t CdlManager::GetMemoryUsage() {
+	uint64_t size = 0;
+	for (CodeDataLogger* cdl : _codeDataLoggers) {
+		if (cdl) {
+			size += cdl->GetSize();
+		}
+	}
+	return size;
+}
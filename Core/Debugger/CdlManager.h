@@ -84,6 +84,17 @@ public:
 	/// </summary>
 	CdlStatistics GetCdlStatistics(MemoryType memType);
 
+	/// <summary>
+	/// Get the CDL pages (CdlChangeTracker::PageSize bytes) whose flags changed since the previous call.
+	/// </summary>
+	/// <param name="memType">Memory type</param>
+	/// <param name="token">0 to get all pages, otherwise the token returned by the previous call</param>
+	/// <param name="pages">Output page indexes</param>
+	/// <param name="maxCount">Size of the pages array</param>
+	/// <param name="nextToken">Token to pass to the next call</param>
+	/// <returns>Number of pages written to the array</returns>
+	uint32_t GetCdlChangedPages(MemoryType memType, uint32_t token, uint32_t pages[], uint32_t maxCount, uint32_t& nextToken);
+
 	/// <summary>
 	/// Get list of subroutine addresses.
 	/// </summary>
@@ -122,4 +133,9 @@ public:
 	/// Get CodeDataLogger for memory type.
 	/// </summary>
 	CodeDataLogger* GetCodeDataLogger(MemoryType memType);
+
+	/// <summary>
+	/// Get memory used by the CDL data of all memory types, in bytes.
+	/// </summary>
+	[[nodiscard]] uint64_t GetMemoryUsage();
 };
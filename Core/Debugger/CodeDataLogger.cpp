@@ -15,6 +15,7 @@ CodeDataLogger::CodeDataLogger(Debugger* debugger, MemoryType memType, uint32_t
 	_memSize = memSize;
 	_romCrc32 = romCrc32;
 	_cdlData = std::make_unique<uint8_t[]>(memSize);
+	_changeTracker.Init(memSize);
 	Reset();
 
 	debugger->GetCdlManager()->RegisterCdl(memType, this);
@@ -24,6 +25,12 @@ CodeDataLogger::~CodeDataLogger() = default;
 
 void CodeDataLogger::Reset() {
 	memset(_cdlData.get(), 0, _memSize);
+	OnCdlDataReplaced();
+}
+
+void CodeDataLogger::OnCdlDataReplaced() {
+	_changeTracker.Recount(_cdlData.get(), _memSize);
+	_changeTracker.MarkAllChanged();
 }
 
 uint8_t* CodeDataLogger::GetRawData() {
@@ -51,6 +58,7 @@ bool CodeDataLogger::LoadCdlFile(const string& cdlFilepath, bool autoResetCdl) {
 				uint32_t savedCrc = cdlData[5] | (cdlData[6] << 8) | (cdlData[7] << 16) | (cdlData[8] << 24);
 				if ((!autoResetCdl || savedCrc == _romCrc32) && fileSize >= _memSize + CodeDataLogger::HeaderSize) {
 					memcpy(_cdlData.get(), cdlData.data() + CodeDataLogger::HeaderSize, _memSize);
+					OnCdlDataReplaced();
 					InternalLoadCdlFile(cdlData.data() + CodeDataLogger::HeaderSize, (uint32_t)cdlData.size() - CodeDataLogger::HeaderSize);
 				}
 			} else {
@@ -58,6 +66,7 @@ bool CodeDataLogger::LoadCdlFile(const string& cdlFilepath, bool autoResetCdl) {
 
 				// Older CRC-less CDL file, use as-is without checking CRC to avoid data loss
 				memcpy(_cdlData.get(), cdlData.data(), _memSize);
+				OnCdlDataReplaced();
 				InternalLoadCdlFile(cdlData.data(), (uint32_t)cdlData.size());
 			}
 
@@ -88,27 +97,17 @@ string CodeDataLogger::GetCdlFilePath(const string& romName) {
 }
 
 CdlStatistics CodeDataLogger::GetStatistics() {
-	uint32_t codeSize = 0;
-	uint32_t dataSize = 0;
-	uint32_t bothSize = 0;
-
-	for (int i = 0, len = _memSize; i < len; i++) {
-		uint32_t isCode = (uint32_t)(_cdlData[i] & CdlFlags::Code);
-		uint32_t isData = (uint32_t)(_cdlData[i] & CdlFlags::Data) >> 1;
-		codeSize += isCode;
-		dataSize += isData;
-		bothSize += isCode & isData;
-	}
-
-	dataSize -= bothSize;
-
 	CdlStatistics stats = {};
-	stats.CodeBytes = codeSize;
-	stats.DataBytes = dataSize;
+	stats.CodeBytes = _changeTracker.GetCodeBytes();
+	stats.DataBytes = _changeTracker.GetDataBytes();
 	stats.TotalBytes = _memSize;
 	return stats;
 }
 
+uint32_t CodeDataLogger::GetChangedPages(uint32_t token, uint32_t pages[], uint32_t maxCount, uint32_t& nextToken) {
+	return _changeTracker.GetChangedPages(token, pages, maxCount, nextToken);
+}
+
 bool CodeDataLogger::IsCode(uint32_t absoluteAddr) {
 	return (_cdlData[absoluteAddr] & CdlFlags::Code) != 0;
 }
@@ -128,6 +127,7 @@ bool CodeDataLogger::IsData(uint32_t absoluteAddr) {
 void CodeDataLogger::SetCdlData(uint8_t* cdlData, uint32_t length) {
 	if (length <= _memSize) {
 		memcpy(_cdlData.get(), cdlData, length);
+		OnCdlDataReplaced();
 	}
 }
 
@@ -156,8 +156,11 @@ uint32_t CodeDataLogger::GetFunctions(uint32_t functions[], uint32_t maxSize) {
 
 void CodeDataLogger::MarkBytesAs(uint32_t start, uint32_t end, uint8_t flags) {
 	for (uint32_t i = start; i <= end; i++) {
-		_cdlData[i] = (_cdlData[i] & 0xFC) | (int)flags;
+		uint8_t oldFlags = _cdlData[i];
+		_cdlData[i] = (oldFlags & 0xFC) | (int)flags;
+		_changeTracker.UpdateCounts(oldFlags, _cdlData[i]);
 	}
+	_changeTracker.MarkRangeChanged(start, end);
 }
 
 void CodeDataLogger::StripData(uint8_t* romBuffer, CdlStripOption flag) {
@@ -2,6 +2,7 @@
 #include "pch.h"
 #include <memory>
 #include "Debugger/DebugTypes.h"
+#include "Debugger/CdlChangeTracker.h"
 
 class Disassembler;
 class Debugger;
@@ -32,6 +33,8 @@ class Debugger;
 /// - Template SetCode<flags, accessWidth>() for compile-time optimization
 /// - Direct byte array access (no overhead)
 /// - Inline flag checks
+/// - Bytes are only written when their flags change, changes update the statistics and dirty pages
+///   incrementally (see CdlChangeTracker), so the UI doesn't need to rescan/re-read the whole CDL
 ///
 /// Use cases:
 /// - ROM hacking: Identify unused code space
@@ -48,6 +51,20 @@ protected:
 	MemoryType _memType = {};            ///< Memory type being tracked
 	uint32_t _memSize = 0;               ///< Memory size
 	uint32_t _romCrc32 = 0;              ///< ROM CRC32 for file validation
+	CdlChangeTracker _changeTracker;     ///< Changed pages + code/data byte counts
+
+	/// <summary>Sets flags on a byte, tracks the change if its flags were not already set</summary>
+	__forceinline void AddFlags(int32_t absoluteAddr, uint8_t flags) {
+		uint8_t oldFlags = _cdlData[absoluteAddr];
+		uint8_t newFlags = oldFlags | flags;
+		if (newFlags != oldFlags) [[unlikely]] {
+			_cdlData[absoluteAddr] = newFlags;
+			_changeTracker.OnFlagsChanged(absoluteAddr, oldFlags, newFlags);
+		}
+	}
+
+	/// <summary>Updates the statistics and marks all pages as changed after a bulk update of the flags</summary>
+	void OnCdlDataReplaced();
 
 	/// <summary>
 	/// Load platform-specific CDL data.
@@ -137,7 +154,7 @@ public:
 	template <uint8_t flags = 0, uint8_t accessWidth = 1>
 	void SetCode(int32_t absoluteAddr) {
 		for (int i = 0; i < accessWidth; i++) {
-			_cdlData[absoluteAddr + i] |= CdlFlags::Code | flags;
+			AddFlags(absoluteAddr + i, CdlFlags::Code | flags);
 		}
 	}
 
@@ -153,10 +170,10 @@ public:
 	/// </remarks>
 	template <uint8_t accessWidth = 1>
 	void SetCode(int32_t absoluteAddr, uint8_t flags) {
-		_cdlData[absoluteAddr] |= CdlFlags::Code | flags; // only sets extra flags on first byte
+		AddFlags(absoluteAddr, CdlFlags::Code | flags); // only sets extra flags on first byte
 		if constexpr (accessWidth > 1) {
 			for (int i = 1; i < accessWidth; i++) {
-				_cdlData[absoluteAddr + i] |= CdlFlags::Code;
+				AddFlags(absoluteAddr + i, CdlFlags::Code);
 			}
 		}
 	}
@@ -170,7 +187,7 @@ public:
 	template <uint8_t flags = 0, uint8_t accessWidth = 1>
 	void SetData(int32_t absoluteAddr) {
 		for (int i = 0; i < accessWidth; i++) {
-			_cdlData[absoluteAddr + i] |= CdlFlags::Data | flags;
+			AddFlags(absoluteAddr + i, CdlFlags::Data | flags);
 		}
 	}
 
@@ -180,6 +197,21 @@ public:
 	/// <returns>CDL statistics</returns>
 	virtual CdlStatistics GetStatistics();
 
+	/// <summary>
+	/// Get the pages (CdlChangeTracker::PageSize bytes each) whose flags changed since the given token.
+	/// </summary>
+	/// <param name="token">0 to get all pages, otherwise the token returned by the previous call</param>
+	/// <param name="pages">Output page indexes</param>
+	/// <param name="maxCount">Size of the pages array</param>
+	/// <param name="nextToken">Token to pass to the next call</param>
+	/// <returns>Number of pages written to the array</returns>
+	uint32_t GetChangedPages(uint32_t token, uint32_t pages[], uint32_t maxCount, uint32_t& nextToken);
+
+	/// <summary>
+	/// Get the change tracker (page change stamps), used to validate data derived from the CDL flags.
+	/// </summary>
+	CdlChangeTracker& GetChangeTracker() { return _changeTracker; }
+
 	/// <summary>
 	/// Check if byte is marked as code.
 	/// </summary>
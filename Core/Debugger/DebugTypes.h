@@ -7,6 +7,7 @@
 
 enum class MemoryType;
 enum class CpuType : uint8_t;
+enum class ConsoleType;
 
 /// <summary>
 /// Memory operation information (read/write).
@@ -670,6 +671,34 @@ struct CpuInstructionProgress {
 	MemoryOperationInfo LastMemOperation = {}; ///< Last memory operation
 };
 
+/// <summary>
+/// Data fetched by a DebugSnapshotItem.
+/// </summary>
+enum class DebugSnapshotItemType : uint8_t {
+	CpuState,            ///< CPU state of Cpu (Length must be at least the size of its state struct)
+	PpuState,            ///< PPU state of Cpu (Length must be at least the size of its state struct)
+	ConsoleState,        ///< Console state of Console (Length must be at least the size of its state struct)
+	ProgramCounter,      ///< uint32_t program counter of Cpu (Start = 1 for the current instruction's start address)
+	InstructionProgress, ///< CpuInstructionProgress of Cpu
+	Memory,              ///< Length bytes of MemType, starting at address Start
+	Callstack,           ///< StackFrameInfo array of Cpu (Length must fit CallstackManager::MaxCallstackSize frames)
+	ExecutionTrace       ///< TraceRow array, starting Start rows from the most recent one (up to Length bytes)
+};
+
+/// <summary>
+/// One entry of a debug snapshot request (see Debugger::GetSnapshot): what to fetch and where to write it.
+/// </summary>
+struct DebugSnapshotItem {
+	DebugSnapshotItemType Type;
+	CpuType Cpu;
+	MemoryType MemType;
+	ConsoleType Console;
+	uint32_t Start;  ///< Start address/row (depends on Type)
+	uint32_t Length; ///< Number of bytes available at Offset
+	uint32_t Offset; ///< Position of the item's data in the snapshot buffer (multiple of 8)
+	uint32_t Size;   ///< [Out] Number of bytes written (0 when the item couldn't be fetched)
+};
+
 /// <summary>
 /// Debug controller state (for input recording/playback).
 /// </summary>
@@ -7,6 +7,7 @@
 #include "Debugger/CodeDataLogger.h"
 #include "Debugger/Disassembler.h"
 #include "Debugger/DisassemblySearch.h"
+#include "Debugger/MemorySearch.h"
 #include "Debugger/BreakpointManager.h"
 #include "Debugger/PpuTools.h"
 #include "Debugger/DebugBreakHelper.h"
@@ -48,6 +49,7 @@
 #include "Lynx/Debugger/LynxDebugger.h"
 #include "Shared/BaseControlManager.h"
 #include "Shared/EmuSettings.h"
+#include "Shared/MemoryUsageRegistry.h"
 #include "Shared/Audio/SoundMixer.h"
 #include "Shared/NotificationManager.h"
 #include "Shared/BaseState.h"
@@ -83,6 +85,7 @@ Debugger::Debugger(Emulator* emu, IConsole* console) {
 	_memoryDumper = std::make_unique<MemoryDumper>(this);          // Memory viewing/editing
 	_disassembler = std::make_unique<Disassembler>(console, this); // Code disassembly
 	_disassemblySearch = std::make_unique<DisassemblySearch>(_disassembler.get(), _labelManager.get());  // Search in disassembly
+	_memorySearch = std::make_unique<MemorySearch>(_memoryDumper.get());  // RAM search
 	_memoryAccessCounter = std::make_unique<MemoryAccessCounter>(this);  // Memory access tracking
 	_scriptManager = std::make_unique<ScriptManager>(this);        // Lua scripting
 	_traceLogSaver = std::make_unique<TraceLogFileSaver>();        // Trace log file output
@@ -158,6 +161,8 @@ Debugger::Debugger(Emulator* emu, IConsole* console) {
 
 	_executionStopped = false;
 
+	_emu->GetMemoryUsageRegistry()->Register("Debugger", this);
+
 #ifdef _DEBUG
 	if (_mainCpuType == CpuType::Snes) {
 		ExpressionEvaluator eval(this, _debuggers[(int)CpuType::Snes].Debugger.get(), CpuType::Snes);
@@ -167,7 +172,29 @@ Debugger::Debugger(Emulator* emu, IConsole* console) {
 }
 
 Debugger::~Debugger() {
+	_emu->GetMemoryUsageRegistry()->Unregister(this);
 	Release();
+
+	// The event viewer render threads use the event managers' virtual functions
+	for (CpuType cpuType : _cpuTypes) {
+		if (BaseEventManager* eventManager = GetEventManager(cpuType)) {
+			eventManager->StopRenderThread();
+		}
+	}
+
+	// Convert the logged rows while the trace loggers still exist
+	FinishTraceLogFile();
+}
+
+void Debugger::ReportMemoryUsage(MemoryUsageNode& node) {
+	node.Add("Access counters", _memoryAccessCounter->GetMemoryUsage());
+	node.Add("Code/data logs", _cdlManager->GetMemoryUsage());
+
+	uint64_t cacheSize = 0;
+	uint64_t bankCacheSize = 0;
+	_disassembler->GetMemoryUsage(cacheSize, bankCacheSize);
+	node.Add("Disassembly cache", cacheSize);
+	node.Add("Disassembled banks", bankCacheSize);
 }
 
 void Debugger::Release() {
@@ -791,6 +818,12 @@ void Debugger::ProcessEvent(EventType type, std::optional<CpuType> cpuTypeOpt) {
 	}
 }
 
+void Debugger::ProcessDmaBurst(CpuType cpuType, uint8_t channel, bool started) {
+	if (_scriptManager->HasDmaCallbacks()) {
+		_scriptManager->ProcessDmaBurst(cpuType, channel, started);
+	}
+}
+
 template <CpuType type, typename T>
 void Debugger::ProcessScripts(uint32_t addr, T& value, MemoryOperationType opType) {
 	MemoryOperationInfo memOp = GetDebugger<type, IDebugger>()->InstructionProgress.LastMemOperation;
@@ -831,6 +864,19 @@ int64_t Debugger::EvaluateExpression(const string& expression, CpuType cpuType,
 	return 0;
 }
 
+void Debugger::SetWatchExpressions(CpuType cpuType, const char* const expressions[], uint32_t count) {
+	if (_debuggers[(int)cpuType].Evaluator) {
+		_debuggers[(int)cpuType].Evaluator->SetWatchExpressions(expressions, count);
+	}
+}
+
+bool Debugger::EvaluateWatchExpressions(CpuType cpuType, int64_t values[], EvalResultType resultTypes[], uint32_t count) {
+	if (_debuggers[(int)cpuType].Evaluator) {
+		return _debuggers[(int)cpuType].Evaluator->EvaluateWatchExpressions(values, resultTypes, count);
+	}
+	return false;
+}
+
 void Debugger::Run() {
 	for (int i = 0; i <= (int)DebugUtilities::GetLastCpuType(); i++) {
 		if (_debuggers[i].Debugger) {
@@ -1364,6 +1410,20 @@ void Debugger::ClearExecutionTrace() {
 	}
 }
 
+void Debugger::StopTraceLogToFile() {
+	DebugBreakHelper helper(this);
+	FinishTraceLogFile();
+}
+
+void Debugger::FinishTraceLogFile() {
+	_traceLogSaver->StopLogging([this](CpuType cpuType, const uint8_t* record, uint32_t size, string& output) {
+		ITraceLogger* logger = GetTraceLogger(cpuType);
+		if (logger) {
+			logger->FormatFileRecord(record, size, output);
+		}
+	});
+}
+
 uint32_t Debugger::GetExecutionTrace(TraceRow output[], uint32_t startOffset, uint32_t maxLineCount) {
 	DebugBreakHelper helper(this);
 
@@ -1408,6 +1468,85 @@ uint32_t Debugger::GetExecutionTrace(TraceRow output[], uint32_t startOffset, ui
 	return count;
 }
 
+void Debugger::GetSnapshot(DebugSnapshotItem items[], uint32_t itemCount, uint8_t* buffer, uint32_t bufferSize) {
+	bool needBreak = false;
+	for (uint32_t i = 0; i < itemCount; i++) {
+		needBreak |= items[i].Type == DebugSnapshotItemType::Callstack || items[i].Type == DebugSnapshotItemType::ExecutionTrace;
+	}
+
+	// Nested DebugBreakHelpers (e.g in GetCallstack) don't pause the emulation again
+	std::optional<DebugBreakHelper> helper;
+	if (needBreak) {
+		helper.emplace(this);
+	}
+
+	for (uint32_t i = 0; i < itemCount; i++) {
+		DebugSnapshotItem& item = items[i];
+		item.Size = 0;
+		if (item.Length == 0 || item.Offset > bufferSize || item.Length > bufferSize - item.Offset || (item.Offset & 0x07) != 0) {
+			continue;
+		}
+
+		uint8_t* dst = buffer + item.Offset;
+		bool cpuItem = item.Type != DebugSnapshotItemType::ConsoleState && item.Type != DebugSnapshotItemType::Memory && item.Type != DebugSnapshotItemType::ExecutionTrace;
+		if (cpuItem && !HasCpuType(item.Cpu)) {
+			continue;
+		}
+
+		switch (item.Type) {
+			case DebugSnapshotItemType::CpuState:
+				GetCpuState(*(BaseState*)dst, item.Cpu);
+				item.Size = item.Length;
+				break;
+
+			case DebugSnapshotItemType::PpuState:
+				GetPpuState(*(BaseState*)dst, item.Cpu);
+				item.Size = item.Length;
+				break;
+
+			case DebugSnapshotItemType::ConsoleState:
+				GetConsoleState(*(BaseState*)dst, item.Console);
+				item.Size = item.Length;
+				break;
+
+			case DebugSnapshotItemType::ProgramCounter:
+				if (item.Length >= sizeof(uint32_t)) {
+					uint32_t pc = GetProgramCounter(item.Cpu, item.Start != 0);
+					memcpy(dst, &pc, sizeof(pc));
+					item.Size = sizeof(pc);
+				}
+				break;
+
+			case DebugSnapshotItemType::InstructionProgress:
+				if (item.Length >= sizeof(CpuInstructionProgress)) {
+					CpuInstructionProgress progress = GetInstructionProgress(item.Cpu);
+					memcpy(dst, &progress, sizeof(progress));
+					item.Size = sizeof(progress);
+				}
+				break;
+
+			case DebugSnapshotItemType::Memory:
+				_memoryDumper->GetMemoryValues(item.MemType, item.Start, item.Start + item.Length - 1, dst);
+				item.Size = item.Length;
+				break;
+
+			case DebugSnapshotItemType::Callstack: {
+				CallstackManager* callstackManager = GetCallstackManager(item.Cpu);
+				if (callstackManager && item.Length >= CallstackManager::MaxCallstackSize * sizeof(StackFrameInfo)) {
+					uint32_t frameCount = 0;
+					callstackManager->GetCallstack((StackFrameInfo*)dst, frameCount);
+					item.Size = frameCount * sizeof(StackFrameInfo);
+				}
+				break;
+			}
+
+			case DebugSnapshotItemType::ExecutionTrace:
+				item.Size = GetExecutionTrace((TraceRow*)dst, item.Start, item.Length / sizeof(TraceRow)) * sizeof(TraceRow);
+				break;
+		}
+	}
+}
+
 PpuTools* Debugger::GetPpuTools(CpuType cpuType) {
 	if (_debuggers[(int)cpuType].Debugger) {
 		return _debuggers[(int)cpuType].Debugger->GetPpuTools();
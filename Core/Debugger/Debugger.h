@@ -5,6 +5,7 @@
 #include "Debugger/DebugTypes.h"
 #include "Debugger/DebuggerFeatures.h"
 #include "Shared/SettingTypes.h"
+#include "Shared/Interfaces/IMemoryUsageReporter.h"
 
 class IConsole;
 class Emulator;
@@ -22,6 +23,7 @@ class MemoryDumper;
 class MemoryAccessCounter;
 class Disassembler;
 class DisassemblySearch;
+class MemorySearch;
 class BreakpointManager;
 class PpuTools;
 class CodeDataLogger;
@@ -95,8 +97,16 @@ struct CpuInfo {
 /// ProcessMemoryRead/Write: Called on every memory access
 /// - Template on CpuType for zero-overhead when not debugging
 /// - Checks breakpoints, updates access counters, logs traces
+///
+/// **Per-access cost by feature:**
+/// - No debugger: Emulator skips the hooks (_hasDebugHooks), or only runs the LightweightCdlRecorder
+/// - Breakpoints: BreakpointManager::CheckBreakpoint exits early when no breakpoint matches the operation type
+/// - Trace logger: TraceLogger::IsEnabled() checked before building the row
+/// - Scripts: ScriptManager::HasCpuMemoryCallbacks() checked before ProcessScripts
+/// - CDL, access counters and the event log are always updated: the tools showing them (hex editor,
+///   event viewer, CDL statistics) display past accesses, so they can't start recording when opened
 /// </remarks>
-class Debugger {
+class Debugger : public IMemoryUsageReporter {
 private:
 	Emulator* _emu = nullptr;      ///< Parent emulator
 	IConsole* _console = nullptr;  ///< Current console instance
@@ -117,6 +127,7 @@ private:
 	unique_ptr<CodeDataLogger> _codeDataLogger;         ///< Code/data classification
 	unique_ptr<Disassembler> _disassembler;             ///< Multi-CPU disassembly
 	unique_ptr<DisassemblySearch> _disassemblySearch;   ///< Search disassembly
+	unique_ptr<MemorySearch> _memorySearch;             ///< RAM search (cheat finder)
 	unique_ptr<LabelManager> _labelManager;             ///< Symbol/label database
 	unique_ptr<CdlManager> _cdlManager;                 ///< CDL file management
 
@@ -157,11 +168,16 @@ private:
 
 	[[nodiscard]] bool IsBreakpointForbidden(BreakSource source, CpuType sourceCpu, MemoryOperationInfo* operation);
 
+	void FinishTraceLogFile();
+
 public:
 	Debugger(Emulator* emu, IConsole* console);
 	~Debugger();
 	void Release();
 
+	/// <summary>Report access counters, CDL data and disassembly caches (IMemoryUsageReporter)</summary>
+	void ReportMemoryUsage(MemoryUsageNode& node) override;
+
 	template <CpuType type>
 	void ProcessInstruction();
 	template <CpuType type, uint8_t accessWidth = 1, MemoryAccessFlags flags = MemoryAccessFlags::None, typename T>
@@ -188,11 +204,14 @@ public:
 	void InternalProcessInterrupt(CpuType cpuType, IDebugger& dbg, StepRequest& stepRequest, AddressInfo& src, uint32_t srcAddr, AddressInfo& dest, uint32_t destAddr, AddressInfo& ret, uint32_t retAddr, uint32_t retSp, bool forNmi);
 
 	void ProcessEvent(EventType type, std::optional<CpuType> cpuType);
+	void ProcessDmaBurst(CpuType cpuType, uint8_t channel, bool started);
 
 	void ProcessConfigChange();
 
 	void GetTokenList(CpuType cpuType, char* tokenList);
 	int64_t EvaluateExpression(const string& expression, CpuType cpuType, EvalResultType& resultType, bool useCache);
+	void SetWatchExpressions(CpuType cpuType, const char* const expressions[], uint32_t count);
+	bool EvaluateWatchExpressions(CpuType cpuType, int64_t values[], EvalResultType resultTypes[], uint32_t count);
 
 	void Run();
 	void PauseOnNextFrame();
@@ -247,6 +266,15 @@ public:
 	void ClearExecutionTrace();
 	[[nodiscard]] uint32_t GetExecutionTrace(TraceRow output[], uint32_t startOffset, uint32_t maxLineCount);
 
+	/// <summary>
+	/// Fetches every item of a debug snapshot request into buffer, so a debugger window can refresh with a single call.
+	/// The emulation is paused once for the whole snapshot when an item needs it (callstack/trace), so the items are consistent.
+	/// </summary>
+	void GetSnapshot(DebugSnapshotItem items[], uint32_t itemCount, uint8_t* buffer, uint32_t bufferSize);
+
+	/// <summary>Stops logging the trace to a file and converts the logged rows to text</summary>
+	void StopTraceLogToFile();
+
 	[[nodiscard]] CpuType GetMainCpuType() { return _mainCpuType; }
 	IDebugger* GetMainDebugger();
 
@@ -255,6 +283,7 @@ public:
 	MemoryAccessCounter* GetMemoryAccessCounter() { return _memoryAccessCounter.get(); }
 	Disassembler* GetDisassembler() { return _disassembler.get(); }
 	DisassemblySearch* GetDisassemblySearch() { return _disassemblySearch.get(); }
+	MemorySearch* GetMemorySearch() { return _memorySearch.get(); }
 	LabelManager* GetLabelManager() { return _labelManager.get(); }
 	CdlManager* GetCdlManager() { return _cdlManager.get(); }
 	ScriptManager* GetScriptManager() { return _scriptManager.get(); }
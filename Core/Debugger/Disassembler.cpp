@@ -28,6 +28,17 @@
 #include "Utilities/HexUtilities.h"
 #include "Utilities/StringUtilities.h"
 
+namespace DisassembleOptions {
+	// Display options that affect the rows returned by Disassemble() (part of the cached banks' key)
+	enum DisassembleOptions : uint8_t {
+		DisassembleUnidentifiedData = 0x01,
+		DisassembleVerifiedData = 0x02,
+		ShowUnidentifiedData = 0x04,
+		ShowVerifiedData = 0x08,
+		ShowJumpLabels = 0x10
+	};
+}
+
 Disassembler::Disassembler(IConsole* console, Debugger* debugger) {
 	_debugger = debugger;
 	_labelManager = debugger->GetLabelManager();
@@ -42,41 +53,60 @@ Disassembler::Disassembler(IConsole* console, Debugger* debugger) {
 
 void Disassembler::InitSource(MemoryType type) {
 	uint32_t size = _memoryDumper->GetMemorySize(type);
-	_sources[(int)type] = {vector<DisassemblyInfo>(size), size};
+	DisassemblerSource& src = _sources[(int)type];
+	src.OpSizes.assign(size, 0);
+	src.CpuFlags.assign(size, 0);
+	src.CpuTypes.assign(size, {});
+	src.Memory = size > 0 ? _memoryDumper->GetMemoryBuffer(type) : nullptr;
+	src.Size = size;
+	src.PageStamps.assign((size >> Disassembler::PageShift) + 1, _changeCounter.load());
 }
 
 DisassemblerSource& Disassembler::GetSource(MemoryType type) {
 	return _sources[(int)type];
 }
 
+void Disassembler::ReadByteCode(DisassemblerSource& src, MemoryType type, uint32_t address, uint8_t byteCode[8]) {
+	// End of the memory (bytes past the end read as 0, like when the instruction was decoded) or no direct buffer
+	for (uint32_t i = 0; i < 8; i++) {
+		byteCode[i] = src.Memory ? (address + i < src.Size ? src.Memory[address + i] : 0) : _memoryDumper->GetMemoryValue(type, address + i);
+	}
+}
+
 uint32_t Disassembler::BuildCache(AddressInfo& addrInfo, uint8_t cpuFlags, CpuType type) {
 	DisassemblerSource& src = GetSource(addrInfo.Type);
 
 	int returnSize = 0;
 	int32_t address = addrInfo.Address;
 	do {
-		DisassemblyInfo& disInfo = src.Cache[address];
-		if (!disInfo.IsInitialized() || !disInfo.IsValid(cpuFlags)) {
-			disInfo.Initialize(address, cpuFlags, type, addrInfo.Type, _memoryDumper);
-			for (int i = 1; i < disInfo.GetOpSize() && address + i < src.Cache.size(); i++) {
+		if (!src.IsInitialized(address) || src.CpuFlags[address] != cpuFlags) {
+			DisassemblyInfo disInfo(address, cpuFlags, type, addrInfo.Type, _memoryDumper);
+			// 0 is reserved for bytes that don't start an instruction
+			uint8_t opSize = std::max<uint8_t>(disInfo.GetOpSize(), 1);
+			src.OpSizes[address] = opSize;
+			src.CpuFlags[address] = cpuFlags;
+			src.CpuTypes[address] = type;
+			for (int i = 1; i < opSize && address + i < (int32_t)src.Size; i++) {
 				// Clear any instructions that start in the middle of this one
 				//(can happen when resizing an instruction after X/M updates)
-				src.Cache[address + i] = DisassemblyInfo();
+				src.Reset(address + i);
+			}
+			StampPage(src, address);
+			StampPage(src, std::min<int32_t>(address + opSize - 1, (int32_t)src.Size - 1));
+			returnSize += opSize;
+
+			if (!disInfo.CanDisassembleNextOp()) {
+				// Can't assume what follows is code, stop disassembling
+				break;
 			}
-			returnSize += disInfo.GetOpSize();
-		} else {
-			returnSize += disInfo.GetOpSize();
-			break;
-		}
 
-		if (!disInfo.CanDisassembleNextOp()) {
-			// Can't assume what follows is code, stop disassembling
+			disInfo.UpdateCpuFlags(cpuFlags);
+			address += opSize;
+		} else {
+			returnSize += src.OpSizes[address];
 			break;
 		}
-
-		disInfo.UpdateCpuFlags(cpuFlags);
-		address += disInfo.GetOpSize();
-	} while (address >= 0 && address < (int32_t)src.Cache.size());
+	} while (address >= 0 && address < (int32_t)src.Size);
 
 	return returnSize;
 }
@@ -96,28 +126,144 @@ void Disassembler::InvalidateCache(AddressInfo addrInfo, CpuType type) {
 		DisassemblerSource& src = GetSource(addrInfo.Type);
 		for (int i = 0; i < 4; i++) {
 			if (addrInfo.Address >= i) {
-				src.Cache[addrInfo.Address - i].Reset();
+				src.Reset(addrInfo.Address - i);
 			}
 		}
+		StampPage(src, std::max(addrInfo.Address - 3, 0));
+		StampPage(src, addrInfo.Address);
 	}
 }
 
+void Disassembler::OnMemoryChanged(MemoryType type) {
+	DisassemblerSource& src = GetSource(type);
+	std::fill(src.PageStamps.begin(), src.PageStamps.end(), _changeCounter.load());
+}
+
+void Disassembler::GetMemoryUsage(uint64_t& cacheSize, uint64_t& bankCacheSize) {
+	cacheSize = 0;
+	for (DisassemblerSource& src : _sources) {
+		cacheSize += src.OpSizes.capacity() + src.CpuFlags.capacity() + src.CpuTypes.capacity() * sizeof(CpuType) + src.PageStamps.capacity() * sizeof(uint32_t);
+	}
+
+	auto lock = _cachedBanksLock.AcquireSafe();
+	bankCacheSize = 0;
+	for (CachedBank& entry : _cachedBanks) {
+		bankCacheSize += entry.Rows.capacity() * sizeof(DisassemblyResult) + entry.BlockMappings.capacity() * sizeof(AddressInfo) + entry.Pages.capacity() * sizeof(BankPageRef);
+	}
+}
+
+bool Disassembler::IsCachedBankValid(CachedBank& entry, uint8_t options, uint8_t cpuFlags[4]) {
+	if (entry.Options != options || memcmp(entry.CpuFlags, cpuFlags, sizeof(entry.CpuFlags)) != 0 || entry.LabelVersion != _labelManager->GetVersion()) {
+		return false;
+	}
+
+	// Mappings are linear within each block (checked when the bank was disassembled), checking the first byte is enough
+	AddressInfo relAddress = {entry.Bank << 16, DebugUtilities::GetCpuMemoryType(entry.Cpu)};
+	for (size_t i = 0; i < entry.BlockMappings.size(); i++) {
+		relAddress.Address = (entry.Bank << 16) + (int32_t)(i << Disassembler::MappingBlockShift);
+		AddressInfo addrInfo = _console->GetAbsoluteAddress(relAddress);
+		if (addrInfo.Address < 0 || addrInfo.Type == MemoryType::SnesRegister) {
+			addrInfo = {-1, MemoryType::None};
+		}
+		if (addrInfo.Address != entry.BlockMappings[i].Address || addrInfo.Type != entry.BlockMappings[i].Type) {
+			return false;
+		}
+	}
+
+	CdlManager* cdlManager = _debugger->GetCdlManager();
+	for (BankPageRef& ref : entry.Pages) {
+		DisassemblerSource& src = GetSource(ref.Type);
+		if (ref.Page >= src.PageStamps.size() || src.PageStamps[ref.Page] >= entry.Token) {
+			return false;
+		}
+
+		CodeDataLogger* cdl = cdlManager->GetCodeDataLogger(ref.Type);
+		if (cdl && cdl->GetChangeTracker().GetPageStamp(ref.Page) >= ref.CdlToken) {
+			return false;
+		}
+	}
+	return true;
+}
+
 vector<DisassemblyResult> Disassembler::Disassemble(CpuType cpuType, uint16_t bank) {
-	if (!_debugger->HasCpuType(cpuType)) {
+	if (!_debugger->HasCpuType(cpuType) || bank > GetMaxBank(cpuType)) {
 		return {};
 	}
 
+	DebugConfig& cfg = _settings->GetDebugConfig();
+	uint8_t options = (
+		(cfg.DisassembleUnidentifiedData ? DisassembleOptions::DisassembleUnidentifiedData : 0) |
+		(cfg.DisassembleVerifiedData ? DisassembleOptions::DisassembleVerifiedData : 0) |
+		(cfg.ShowUnidentifiedData ? DisassembleOptions::ShowUnidentifiedData : 0) |
+		(cfg.ShowVerifiedData ? DisassembleOptions::ShowVerifiedData : 0) |
+		(cfg.ShowJumpLabels ? DisassembleOptions::ShowJumpLabels : 0)
+	);
+
+	uint8_t cpuFlags[4] = {};
+	for (int i = 0; i < 4; i++) {
+		// Used by GBA to realign ARM code to 4 bytes when disassembly
+		// unidentified sections. (all 4 values are identical for other CPUs)
+		cpuFlags[i] = _debugger->GetMainDebugger()->GetCpuFlags(i);
+	}
+
+	{
+		auto lock = _cachedBanksLock.AcquireSafe();
+		for (CachedBank& cached : _cachedBanks) {
+			if (cached.Cpu == cpuType && cached.Bank == bank && IsCachedBankValid(cached, options, cpuFlags)) {
+				cached.LastUse = ++_cacheUseCounter;
+				return cached.Rows;
+			}
+		}
+	}
+
+	CachedBank entry = {};
+	entry.Cpu = cpuType;
+	entry.Bank = bank;
+	entry.Options = options;
+	memcpy(entry.CpuFlags, cpuFlags, sizeof(entry.CpuFlags));
+	entry.LabelVersion = _labelManager->GetVersion();
+
+	// Changes made after this point get a stamp >= the token and invalidate the result
+	entry.Token = ++_changeCounter;
+
+	bool cacheable = true;
+	vector<DisassemblyResult> results = InternalDisassemble(cpuType, bank, cpuFlags, entry, cacheable);
+
+	if (cacheable) {
+		entry.Rows = results;
+
+		auto lock = _cachedBanksLock.AcquireSafe();
+		entry.LastUse = ++_cacheUseCounter;
+		auto existing = std::find_if(_cachedBanks.begin(), _cachedBanks.end(), [&](const CachedBank& cached) {
+			return cached.Cpu == cpuType && cached.Bank == bank;
+		});
+		if (existing == _cachedBanks.end() && _cachedBanks.size() >= Disassembler::MaxCachedBanks) {
+			existing = std::min_element(_cachedBanks.begin(), _cachedBanks.end(), [](const CachedBank& a, const CachedBank& b) {
+				return a.LastUse < b.LastUse;
+			});
+		}
+
+		if (existing != _cachedBanks.end()) {
+			*existing = std::move(entry);
+		} else {
+			_cachedBanks.push_back(std::move(entry));
+		}
+	}
+
+	return results;
+}
+
+vector<DisassemblyResult> Disassembler::InternalDisassemble(CpuType cpuType, uint16_t bank, uint8_t cpuFlags[4], CachedBank& entry, bool& cacheable) {
 	constexpr int bytesPerRow = 8;
 
 	vector<DisassemblyResult> results;
 	results.reserve(20000);
 
-	DebugConfig& cfg = _settings->GetDebugConfig();
-	bool disUnident = cfg.DisassembleUnidentifiedData;
-	bool disData = cfg.DisassembleVerifiedData;
-	bool showUnident = cfg.ShowUnidentifiedData;
-	bool showData = cfg.ShowVerifiedData;
-	bool showJumpLabels = cfg.ShowJumpLabels;
+	bool disUnident = entry.Options & DisassembleOptions::DisassembleUnidentifiedData;
+	bool disData = entry.Options & DisassembleOptions::DisassembleVerifiedData;
+	bool showUnident = entry.Options & DisassembleOptions::ShowUnidentifiedData;
+	bool showData = entry.Options & DisassembleOptions::ShowVerifiedData;
+	bool showJumpLabels = entry.Options & DisassembleOptions::ShowJumpLabels;
 
 	bool inUnknownBlock = false;
 	bool inVerifiedBlock = false;
@@ -129,16 +275,56 @@ vector<DisassemblyResult> Disassembler::Disassemble(CpuType cpuType, uint16_t ba
 	AddressInfo relAddress = {};
 	relAddress.Type = DebugUtilities::GetCpuMemoryType(cpuType);
 
-	if (bank > GetMaxBank(cpuType)) {
-		return results;
-	}
-
 	int32_t bankStart = bank << 16;
 	int32_t bankEnd = (bank + 1) << 16;
 	bankEnd = std::min<int32_t>(bankEnd, (int32_t)_memoryDumper->GetMemorySize(relAddress.Type));
 
 	AddressInfo addrInfo = {};
 
+	CdlManager* cdlManager = _debugger->GetCdlManager();
+	entry.BlockMappings.resize(((bankEnd - bankStart) + (1 << Disassembler::MappingBlockShift) - 1) >> Disassembler::MappingBlockShift);
+	MemoryType lastPageType = MemoryType::None;
+	uint32_t lastPage = 0;
+
+	// Records the mapping of each block and the pages used (to validate the cached result), the result can only be
+	// cached when the bank only contains ROM (RAM can be modified without going through InvalidateCache, e.g by DMA)
+	auto trackMapping = [&](int32_t relAddr, AddressInfo absAddr) {
+		if (!cacheable) {
+			return;
+		}
+
+		bool unmapped = absAddr.Address < 0 || absAddr.Type == MemoryType::SnesRegister;
+		if (unmapped) {
+			absAddr = {-1, MemoryType::None};
+		} else if (!DebugUtilities::IsRom(absAddr.Type)) {
+			cacheable = false;
+			return;
+		}
+
+		int32_t offset = relAddr - bankStart;
+		int32_t blockOffset = offset & ((1 << Disassembler::MappingBlockShift) - 1);
+		AddressInfo& block = entry.BlockMappings[offset >> Disassembler::MappingBlockShift];
+		if (blockOffset == 0) {
+			block = absAddr;
+		} else if (block.Type != absAddr.Type || (!unmapped && block.Address + blockOffset != absAddr.Address)) {
+			// Mapping isn't linear within the block, validating the cached result would need to check every byte
+			cacheable = false;
+			return;
+		}
+
+		if (!unmapped && (absAddr.Type != lastPageType || ((uint32_t)absAddr.Address >> Disassembler::PageShift) != lastPage)) {
+			lastPageType = absAddr.Type;
+			lastPage = (uint32_t)absAddr.Address >> Disassembler::PageShift;
+			bool found = std::any_of(entry.Pages.begin(), entry.Pages.end(), [&](const BankPageRef& ref) {
+				return ref.Type == lastPageType && ref.Page == lastPage;
+			});
+			if (!found) {
+				CodeDataLogger* cdl = cdlManager->GetCodeDataLogger(lastPageType);
+				entry.Pages.push_back({lastPageType, lastPage, cdl ? cdl->GetChangeTracker().TakeToken() : 0});
+			}
+		}
+	};
+
 	auto pushEndBlock = [&]() {
 		if (inUnknownBlock || inVerifiedBlock) {
 			int flags = LineFlags::BlockEnd;
@@ -157,13 +343,6 @@ vector<DisassemblyResult> Disassembler::Disassemble(CpuType cpuType, uint16_t ba
 		}
 	};
 
-	uint8_t cpuFlags[4] = {};
-	for (int i = 0; i < 4; i++) {
-		// Used by GBA to realign ARM code to 4 bytes when disassembly
-		// unidentified sections. (all 4 values are identical for other CPUs)
-		cpuFlags[i] = _debugger->GetMainDebugger()->GetCpuFlags(i);
-	}
-
 	auto pushUnmappedBlock = [&]() {
 		int32_t prevAddress = results.size() > 0 ? results[results.size() - 1].CpuAddress + 1 : bankStart;
 		results.emplace_back(prevAddress, LineFlags::BlockStart | LineFlags::UnmappedMemory);
@@ -175,6 +354,7 @@ vector<DisassemblyResult> Disassembler::Disassemble(CpuType cpuType, uint16_t ba
 	for (int32_t i = bankStart; i < bankEnd; i++) {
 		relAddress.Address = i;
 		addrInfo = _console->GetAbsoluteAddress(relAddress);
+		trackMapping(i, addrInfo);
 
 		if (addrInfo.Address < 0 || addrInfo.Type == MemoryType::SnesRegister) {
 			pushEndBlock();
@@ -187,8 +367,8 @@ vector<DisassemblyResult> Disassembler::Disassemble(CpuType cpuType, uint16_t ba
 		}
 
 		DisassemblerSource& src = GetSource(addrInfo.Type);
-		DisassemblyInfo disassemblyInfo = src.Cache[addrInfo.Address];
-		CodeDataLogger* cdl = _debugger->GetCdlManager()->GetCodeDataLogger(addrInfo.Type);
+		DisassemblyInfo disassemblyInfo = GetCachedInfo(src, addrInfo.Type, addrInfo.Address);
+		CodeDataLogger* cdl = cdlManager->GetCodeDataLogger(addrInfo.Type);
 		uint8_t opSize = 0;
 
 		bool isCode = cdl ? cdl->IsCode(addrInfo.Address) : false;
@@ -251,7 +431,8 @@ vector<DisassemblyResult> Disassembler::Disassemble(CpuType cpuType, uint16_t ba
 			for (int j = 1; j < opSize && i + j < bankEnd; j++) {
 				relAddress.Address = i + 1;
 				addrInfo = _console->GetAbsoluteAddress(relAddress);
-				if (addrInfo.Type != prevMemType || addrInfo.Address < 0 || src.Cache[addrInfo.Address].IsInitialized()) {
+				trackMapping(i + 1, addrInfo);
+				if (addrInfo.Type != prevMemType || addrInfo.Address < 0 || src.IsInitialized(addrInfo.Address)) {
 					break;
 				}
 				i++;
@@ -368,7 +549,7 @@ void Disassembler::GetLineData(DisassemblyResult& row, CpuType type, MemoryType
 			memcpy(data.Text, label.c_str(), std::min<int>((int)label.size() + 1, 1000));
 		} else {
 			DisassemblerSource& src = GetSource(row.Address.Type);
-			DisassemblyInfo disInfo = src.Cache[row.Address.Address];
+			DisassemblyInfo disInfo = GetCachedInfo(src, row.Address.Type, row.Address.Address);
 
 			// Always use Sa1 as the cpu type when disassembling Sa1 address space
 			CpuType lineCpuType = type != CpuType::Sa1 && disInfo.IsInitialized() ? disInfo.GetCpuType() : type;
@@ -1,8 +1,10 @@
 #pragma once
 #include "pch.h"
+#include <atomic>
 #include "Debugger/DisassemblyInfo.h"
 #include "Debugger/DebugTypes.h"
 #include "Debugger/DebugUtilities.h"
+#include "Utilities/SimpleLock.h"
 
 class IConsole;
 class Debugger;
@@ -15,11 +17,23 @@ struct SnesCpuState;
 enum class CpuType : uint8_t;
 
 /// <summary>
-/// Cached disassembly data for a memory type.
+/// Cached disassembly data for a memory type, one entry per byte (structure of arrays).
 /// </summary>
+/// <remarks>
+/// Only what decoding an instruction produces is stored (3 bytes per byte of memory, instead of a full DisassemblyInfo):
+/// the byte code is read from the memory itself when a DisassemblyInfo is needed (Disassembler::GetCachedInfo), and
+/// scans that only check for instruction starts just read OpSizes.
+/// </remarks>
 struct DisassemblerSource {
-	vector<DisassemblyInfo> Cache; ///< Disassembly cache (one entry per byte in memory type)
-	uint32_t Size = 0;             ///< Cache size (matches memory type size)
+	vector<uint8_t> OpSizes;     ///< Size of the instruction that starts at each byte, 0 = no instruction decoded there
+	vector<uint8_t> CpuFlags;    ///< CPU flags each instruction was decoded with (e.g 65816 M/X flags)
+	vector<CpuType> CpuTypes;    ///< CPU that decoded each instruction
+	uint8_t* Memory = nullptr;   ///< Memory type's buffer (byte code), nullptr = read through MemoryDumper
+	uint32_t Size = 0;           ///< Cache size (matches memory type size)
+	vector<uint32_t> PageStamps; ///< Change stamp of each page (Disassembler::PageShift) of the cache/memory
+
+	[[nodiscard]] bool IsInitialized(uint32_t address) const { return OpSizes[address] != 0; }
+	void Reset(uint32_t address) { OpSizes[address] = 0; }
 };
 
 /// <summary>
@@ -29,11 +43,11 @@ struct DisassemblerSource {
 /// Architecture:
 /// - One disassembler shared across all CPUs
 /// - Separate cache per memory type (ROM, RAM, SRAM, etc.)
-/// - Cache stores DisassemblyInfo for each byte (opcode, operands, formatting)
+/// - Cache stores the decoded op size/flags/CPU of each byte, the byte code comes from the memory itself
 ///
 /// Cache organization:
 /// - _sources[]: One DisassemblerSource per memory type
-/// - Cache[address]: DisassemblyInfo at that address
+/// - GetCachedInfo(src, address): DisassemblyInfo at that address
 /// - Lazy initialization (built on first access)
 /// - Invalidation on code modification
 ///
@@ -47,6 +61,8 @@ struct DisassemblerSource {
 /// - __forceinline GetDisassemblyInfo() for hot path
 /// - Cached disassembly (parse once, display many times)
 /// - Early exit for uninitialized addresses
+/// - Disassemble() results (the rows of a 64KB bank) are cached for banks that only contain ROM, and reused
+///   while the bank's mappings, the cache/CDL pages it covers, the labels and the display options are unchanged
 ///
 /// Use cases:
 /// - Debugger disassembly view
@@ -64,8 +80,56 @@ private:
 	LabelManager* _labelManager; ///< Label manager for symbol lookup
 	MemoryDumper* _memoryDumper; ///< Memory dumper for byte reads
 
+	static constexpr uint32_t PageShift = 12;        ///< Granularity of the change stamps (4KB)
+	static constexpr uint32_t MappingBlockShift = 8; ///< Granularity of the mapping checks for cached banks (256 bytes)
+	static constexpr size_t MaxCachedBanks = 8;      ///< Max number of cached Disassemble() results
+
+	/// <summary>Page (cache + CDL) covered by a cached bank</summary>
+	struct BankPageRef {
+		MemoryType Type;
+		uint32_t Page;
+		uint32_t CdlToken; ///< CDL change token taken when the bank was disassembled
+	};
+
+	/// <summary>Disassemble() output for a bank, with what's needed to check if it is still up to date</summary>
+	struct CachedBank {
+		CpuType Cpu = {};
+		uint16_t Bank = 0;
+		uint32_t Token = 0; ///< Value of _changeCounter when the bank was disassembled
+		uint32_t LabelVersion = 0;
+		uint8_t Options = 0;
+		uint8_t CpuFlags[4] = {};
+		vector<AddressInfo> BlockMappings; ///< Absolute address of the first byte of each mapping block ({-1, None} if unmapped)
+		vector<BankPageRef> Pages;
+		vector<DisassemblyResult> Rows;
+		uint64_t LastUse = 0;
+	};
+
 	DisassemblerSource _sources[DebugUtilities::GetMemoryTypeCount()] = {}; ///< Disassembly cache per memory type
 
+	std::atomic<uint32_t> _changeCounter = 1; ///< Stamp written to changed pages, cached banks are valid while their pages' stamps are below their token
+	vector<CachedBank> _cachedBanks; ///< Recently disassembled ROM banks
+	uint64_t _cacheUseCounter = 0;
+	SimpleLock _cachedBanksLock;
+
+	/// <summary>
+	/// Marks the page containing the address as changed (invalidates the cached banks that contain it).
+	/// Must be called after the change, so a Disassemble() call that took its token earlier can't miss it.
+	/// </summary>
+	__forceinline void StampPage(DisassemblerSource& src, int32_t address) {
+		src.PageStamps[(uint32_t)address >> Disassembler::PageShift] = _changeCounter.load();
+	}
+
+	/// <summary>
+	/// Checks if a cached bank's rows are still up to date (same options, labels, mappings, and no changes to its pages).
+	/// </summary>
+	bool IsCachedBankValid(CachedBank& entry, uint8_t options, uint8_t cpuFlags[4]);
+
+	/// <summary>
+	/// Disassembles a bank, filling the entry's mappings/pages (cacheable is set to false if the bank can't be cached).
+	/// </summary>
+	vector<DisassemblyResult> InternalDisassemble(CpuType cpuType, uint16_t bank, uint8_t cpuFlags[4], CachedBank& entry, bool& cacheable);
+
 	/// <summary>
 	/// Initialize disassembly cache for memory type.
 	/// </summary>
@@ -79,6 +143,23 @@ private:
 	/// <returns>Disassembler source with cache</returns>
 	DisassemblerSource& GetSource(MemoryType type);
 
+	void ReadByteCode(DisassemblerSource& src, MemoryType type, uint32_t address, uint8_t byteCode[8]);
+
+	/// <summary>Builds the DisassemblyInfo of the instruction cached at address (uninitialized if there is none)</summary>
+	__forceinline DisassemblyInfo GetCachedInfo(DisassemblerSource& src, MemoryType type, uint32_t address) {
+		DisassemblyInfo info;
+		if (uint8_t opSize = src.OpSizes[address]) {
+			uint8_t byteCode[8];
+			if (src.Memory && address + 8 <= src.Size) [[likely]] {
+				memcpy(byteCode, src.Memory + address, 8);
+			} else {
+				ReadByteCode(src, type, address, byteCode);
+			}
+			info.Initialize(byteCode, opSize, src.CpuFlags[address], src.CpuTypes[address]);
+		}
+		return info;
+	}
+
 	/// <summary>
 	/// Get formatted line data for address.
 	/// </summary>
@@ -141,6 +222,19 @@ public:
 	/// <param name="type">CPU type</param>
 	void InvalidateCache(AddressInfo addrInfo, CpuType type);
 
+	/// <summary>
+	/// Marks a whole memory type as changed, after a bulk write (the cached Disassemble() results that use it are discarded).
+	/// </summary>
+	/// <param name="type">Memory type that was modified</param>
+	void OnMemoryChanged(MemoryType type);
+
+	/// <summary>
+	/// Get memory used by the disassembly caches (per memory type) and the cached Disassemble() results, in bytes.
+	/// </summary>
+	/// <param name="cacheSize">Memory used by the per-byte caches</param>
+	/// <param name="bankCacheSize">Memory used by the cached banks</param>
+	void GetMemoryUsage(uint64_t& cacheSize, uint64_t& bankCacheSize);
+
 	/// <summary>
 	/// Get disassembly info for address (hot path).
 	/// </summary>
@@ -156,7 +250,7 @@ public:
 	__forceinline DisassemblyInfo GetDisassemblyInfo(AddressInfo& info, uint32_t cpuAddress, uint8_t cpuFlags, CpuType type) {
 		DisassemblyInfo disassemblyInfo;
 		if (info.Address >= 0) {
-			disassemblyInfo = GetSource(info.Type).Cache[info.Address];
+			disassemblyInfo = GetCachedInfo(GetSource(info.Type), info.Type, info.Address);
 		}
 
 		if (!disassemblyInfo.IsInitialized()) {
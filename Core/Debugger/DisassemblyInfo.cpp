@@ -45,6 +45,14 @@ void DisassemblyInfo::Initialize(uint32_t cpuAddress, uint8_t cpuFlags, CpuType
 	_initialized = true;
 }
 
+void DisassemblyInfo::Initialize(const uint8_t byteCode[8], uint8_t opSize, uint8_t cpuFlags, CpuType cpuType) {
+	memcpy(_byteCode, byteCode, sizeof(_byteCode));
+	_opSize = opSize;
+	_flags = cpuFlags;
+	_cpuType = cpuType;
+	_initialized = true;
+}
+
 bool DisassemblyInfo::IsInitialized() {
 	return _initialized;
 }
@@ -44,6 +44,9 @@ public:
 	DisassemblyInfo(uint32_t cpuAddress, uint8_t cpuFlags, CpuType cpuType, MemoryType memType, MemoryDumper* memoryDumper);
 
 	void Initialize(uint32_t cpuAddress, uint8_t cpuFlags, CpuType cpuType, MemoryType memType, MemoryDumper* memoryDumper);
+
+	/// <summary>Initializes an already decoded instruction (see DisassemblerSource)</summary>
+	void Initialize(const uint8_t byteCode[8], uint8_t opSize, uint8_t cpuFlags, CpuType cpuType);
 	[[nodiscard]] bool IsInitialized();
 	[[nodiscard]] bool IsValid(uint8_t cpuFlags);
 	void Reset();
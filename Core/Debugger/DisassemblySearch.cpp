@@ -2,12 +2,15 @@
 #include "Debugger/Disassembler.h"
 #include "Debugger/DisassemblySearch.h"
 #include "Debugger/LabelManager.h"
+#include "Utilities/WorkerPool.h"
 
 DisassemblySearch::DisassemblySearch(Disassembler* disassembler, LabelManager* labelManager) {
 	_disassembler = disassembler;
 	_labelManager = labelManager;
 }
 
+DisassemblySearch::~DisassemblySearch() = default;
+
 int32_t DisassemblySearch::SearchDisassembly(CpuType cpuType, const char* searchString, int32_t startAddress, DisassemblySearchOptions options) {
 	CodeLineData results[1] = {};
 	uint32_t resultCount = SearchDisassembly(cpuType, searchString, startAddress, options, results, 1);
@@ -15,7 +18,135 @@ int32_t DisassemblySearch::SearchDisassembly(CpuType cpuType, const char* search
 }
 
 uint32_t DisassemblySearch::FindOccurrences(CpuType cpuType, const char* searchString, DisassemblySearchOptions options, CodeLineData output[], uint32_t maxResultCount) {
-	return SearchDisassembly(cpuType, searchString, 0, options, output, maxResultCount);
+	if (options.SearchBackwards || options.SkipFirstLine || maxResultCount == 0) {
+		// These start/stop at a specific row and can wrap around, use the sequential search
+		return SearchDisassembly(cpuType, searchString, 0, options, output, maxResultCount);
+	}
+	return FindOccurrencesParallel(cpuType, searchString, options, output, maxResultCount);
+}
+
+uint32_t DisassemblySearch::FindOccurrencesParallel(CpuType cpuType, const char* searchString, DisassemblySearchOptions options, CodeLineData searchResults[], uint32_t maxResultCount) {
+	// Same results as SearchDisassembly(cpuType, searchString, 0, ...): every bank in order, until a bank is
+	// empty, maxResultCount matches are found or MaxSearchRows rows were checked
+	struct BankMatches {
+		vector<std::pair<int32_t, DisassemblyResult>> Matches; ///< Row counter (within the bank) and row of each match
+		int32_t RowCount = 0;
+		bool Empty = false;
+		bool Done = false;
+	};
+
+	auto searchLock = std::unique_lock(_searchLock);
+	if (!_workerPool) {
+		_workerPool = std::make_unique<WorkerPool>(WorkerPool::GetDefaultWorkerCount(DisassemblySearch::MaxSearchWorkers));
+	}
+
+	MemoryType memType = DebugUtilities::GetCpuMemoryType(cpuType);
+	uint32_t bankCount = (uint32_t)_disassembler->GetMaxBank(cpuType) + 1;
+	vector<BankMatches> banks(bankCount);
+
+	// Banks before prefixEnd are done, stop once they are enough to produce the final result
+	std::mutex prefixLock;
+	uint32_t prefixEnd = 0;
+	uint32_t prefixMatches = 0;
+	int32_t prefixRows = 0;
+	std::atomic<bool> stop = false;
+
+	_workerPool->Run(bankCount, [&](uint32_t bank) {
+		if (stop) {
+			return;
+		}
+
+		BankMatches& result = banks[bank];
+		vector<DisassemblyResult> rows = _disassembler->Disassemble(cpuType, (uint16_t)bank);
+		result.Empty = rows.empty();
+
+		string searchStr = searchString;
+		CodeLineData lineData = {};
+		string txt;
+		for (DisassemblyResult& row : rows) {
+			if (row.CpuAddress < 0) {
+				continue;
+			}
+			if (IsMatch(cpuType, memType, row, searchStr, options, maxResultCount == 1, lineData, txt)) {
+				result.Matches.emplace_back(result.RowCount, row);
+				if (result.Matches.size() == maxResultCount) {
+					break;
+				}
+			}
+			result.RowCount++;
+			if (stop) {
+				return;
+			}
+		}
+
+		auto lock = std::unique_lock(prefixLock);
+		result.Done = true;
+		while (prefixEnd < bankCount && banks[prefixEnd].Done) {
+			BankMatches& prefixBank = banks[prefixEnd++];
+			prefixMatches += (uint32_t)prefixBank.Matches.size();
+			prefixRows += prefixBank.RowCount;
+			if (prefixBank.Empty || prefixMatches >= maxResultCount || prefixRows > DisassemblySearch::MaxSearchRows) {
+				stop = true;
+				break;
+			}
+		}
+	});
+
+	uint32_t resultCount = 0;
+	int32_t rowCounter = 0;
+	for (BankMatches& bank : banks) {
+		if (bank.Empty) {
+			// Matches SearchDisassembly's behavior when bank 0 is empty
+			return &bank == &banks[0] ? (uint32_t)-1 : resultCount;
+		}
+		for (auto& [rowIndex, row] : bank.Matches) {
+			if (rowCounter + rowIndex > DisassemblySearch::MaxSearchRows) {
+				return resultCount;
+			}
+			_disassembler->GetLineData(row, cpuType, memType, searchResults[resultCount]);
+			if (++resultCount == maxResultCount) {
+				return resultCount;
+			}
+		}
+		rowCounter += bank.RowCount;
+		if (rowCounter > DisassemblySearch::MaxSearchRows) {
+			return resultCount;
+		}
+	}
+	return resultCount;
+}
+
+bool DisassemblySearch::IsMatch(CpuType cpuType, MemoryType memType, DisassemblyResult& row, string& searchStr, DisassemblySearchOptions& options, bool checkValue, CodeLineData& lineData, string& txt) {
+	_disassembler->GetLineData(row, cpuType, memType, lineData);
+
+	if (TextContains(searchStr, lineData.Text, 1000, options) || TextContains(searchStr, lineData.Comment, 1000, options)) {
+		return true;
+	}
+
+	if (lineData.EffectiveAddress.ShowAddress && lineData.EffectiveAddress.Address >= 0) {
+		txt = _labelManager->GetLabel({(int32_t)lineData.EffectiveAddress.Address, lineData.EffectiveAddress.Type});
+		if (txt.empty()) {
+			txt.assign("[$");
+			txt.append(DebugUtilities::AddressToHex(lineData.LineCpuType, lineData.EffectiveAddress.Address));
+			txt.push_back(']');
+		} else {
+			txt.insert(0, "[");
+			txt.push_back(']');
+		}
+
+		if (TextContains(searchStr, txt.c_str(), (int)txt.size(), options)) {
+			return true;
+		}
+	}
+
+	if (checkValue && lineData.EffectiveAddress.ValueSize > 0) {
+		txt.assign("$");
+		txt.append(lineData.EffectiveAddress.ValueSize == 2 ? HexUtilities::ToHex((uint16_t)lineData.Value) : HexUtilities::ToHex((uint8_t)lineData.Value));
+		if (TextContains(searchStr, txt.c_str(), (int)txt.size(), options)) {
+			return true;
+		}
+	}
+	return false;
 }
 
 uint32_t DisassemblySearch::SearchDisassembly(CpuType cpuType, const char* searchString, int32_t startAddress, DisassemblySearchOptions options, CodeLineData searchResults[], uint32_t maxResultCount) {
@@ -60,7 +191,7 @@ uint32_t DisassemblySearch::SearchDisassembly(CpuType cpuType, const char* searc
 			if (
 			    (!options.SearchBackwards && prevAddress < startAddress && rows[i].CpuAddress >= startAddress) ||
 			    (options.SearchBackwards && prevAddress > startAddress && rows[i].CpuAddress <= startAddress) ||
-			    rowCounter > 500000) {
+			    rowCounter > DisassemblySearch::MaxSearchRows) {
 				if (rowCounter > 0) {
 					// Checked entire memory space without finding a match (or checked over 500k rows), give up
 					return resultCount;
@@ -71,54 +202,11 @@ uint32_t DisassemblySearch::SearchDisassembly(CpuType cpuType, const char* searc
 
 			prevAddress = rows[i].CpuAddress;
 
-			_disassembler->GetLineData(rows[i], cpuType, memType, lineData);
-
-			if (TextContains(searchStr, lineData.Text, 1000, options)) {
+			if (IsMatch(cpuType, memType, rows[i], searchStr, options, maxResultCount == 1, lineData, txt)) {
 				searchResults[resultCount] = lineData;
 				if (maxResultCount == ++resultCount) {
 					return resultCount;
 				}
-				continue;
-			}
-
-			if (TextContains(searchStr, lineData.Comment, 1000, options)) {
-				searchResults[resultCount] = lineData;
-				if (maxResultCount == ++resultCount) {
-					return resultCount;
-				}
-				continue;
-			}
-
-			if (lineData.EffectiveAddress.ShowAddress && lineData.EffectiveAddress.Address >= 0) {
-				txt = _labelManager->GetLabel({(int32_t)lineData.EffectiveAddress.Address, lineData.EffectiveAddress.Type});
-				if (txt.empty()) {
-					txt.assign("[$");
-					txt.append(DebugUtilities::AddressToHex(lineData.LineCpuType, lineData.EffectiveAddress.Address));
-					txt.push_back(']');
-				} else {
-					txt.insert(0, "[");
-					txt.push_back(']');
-				}
-
-				if (TextContains(searchStr, txt.c_str(), (int)txt.size(), options)) {
-					searchResults[resultCount] = lineData;
-					if (maxResultCount == ++resultCount) {
-						return resultCount;
-					}
-					continue;
-				}
-			}
-
-			if (maxResultCount == 1 && lineData.EffectiveAddress.ValueSize > 0) {
-				txt.assign("$");
-				txt.append(lineData.EffectiveAddress.ValueSize == 2 ? HexUtilities::ToHex((uint16_t)lineData.Value) : HexUtilities::ToHex((uint8_t)lineData.Value));
-				if (TextContains(searchStr, txt.c_str(), (int)txt.size(), options)) {
-					searchResults[resultCount] = lineData;
-					if (maxResultCount == ++resultCount) {
-						return resultCount;
-					}
-					continue;
-				}
 			}
 		}
 
@@ -1,11 +1,13 @@
 #pragma once
 #include "pch.h"
+#include <mutex>
 #include "Debugger/DisassemblyInfo.h"
 #include "Debugger/DebugTypes.h"
 #include "Debugger/DebugUtilities.h"
 
 class Disassembler;
 class LabelManager;
+class WorkerPool;
 enum class CpuType : uint8_t;
 
 /// <summary>
@@ -33,6 +35,11 @@ struct DisassemblySearchOptions {
 /// - Forward/backward search
 /// - Multi-result search (find all occurrences)
 ///
+/// Performance:
+/// - FindOccurrences() searches the banks in parallel (one task per bank on a WorkerPool) and merges the
+///   matches in bank order, so the results are identical to a sequential search
+/// - Banks after the point where the sequential search would stop (result count or row limit reached) are skipped
+///
 /// Text matching:
 /// - Template <matchCase> for compile-time branch elimination
 /// - IsWordSeparator(): Detects word boundaries (space, comma, etc)
@@ -46,9 +53,25 @@ struct DisassemblySearchOptions {
 /// </remarks>
 class DisassemblySearch {
 private:
+	static constexpr uint32_t MaxSearchWorkers = 8;
+	static constexpr int32_t MaxSearchRows = 500000; ///< Searches give up after checking this many rows
+
 	Disassembler* _disassembler; ///< Disassembler for generating disassembly
 	LabelManager* _labelManager; ///< Label manager for label resolution
 
+	unique_ptr<WorkerPool> _workerPool; ///< Worker threads for FindOccurrences (created on first use)
+	std::mutex _searchLock;             ///< Serializes FindOccurrences calls (WorkerPool::Run isn't reentrant)
+
+	/// <summary>
+	/// Checks if a row matches the search string (text, comment, effective address label, or value when checkValue is set).
+	/// </summary>
+	bool IsMatch(CpuType cpuType, MemoryType memType, DisassemblyResult& row, string& searchStr, DisassemblySearchOptions& options, bool checkValue, CodeLineData& lineData, string& txt);
+
+	/// <summary>
+	/// Forward search of all banks, starting at address 0, with one task per bank.
+	/// </summary>
+	uint32_t FindOccurrencesParallel(CpuType cpuType, const char* searchString, DisassemblySearchOptions options, CodeLineData searchResults[], uint32_t maxResultCount);
+
 	/// <summary>
 	/// Search disassembly for string.
 	/// </summary>
@@ -75,6 +98,7 @@ public:
 	/// Constructor for disassembly search.
 	/// </summary>
 	DisassemblySearch(Disassembler* disassembler, LabelManager* labelManager);
+	~DisassemblySearch();
 
 	/// <summary>
 	/// Search disassembly for next occurrence.
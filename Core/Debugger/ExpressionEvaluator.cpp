@@ -393,8 +393,147 @@ bool ExpressionEvaluator::ToRpn(const string& expression, ExpressionData& data)
 	return true;
 }
 
+namespace {
+	/// <summary>Applies an arithmetic/logical operator (not the memory read operators), returns false on division by 0</summary>
+	__forceinline bool ApplyOperator(EvalOpCode op, int64_t left, int64_t right, int64_t& result, EvalResultType& resultType) {
+		resultType = EvalResultType::Numeric;
+		switch (op) {
+			case EvalOpCode::Multiplication: result = left * right; break;
+			case EvalOpCode::Division:
+				if (right == 0) {
+					resultType = EvalResultType::DivideBy0;
+					return false;
+				}
+				result = left / right;
+				break;
+			case EvalOpCode::Modulo:
+				if (right == 0) {
+					resultType = EvalResultType::DivideBy0;
+					return false;
+				}
+				result = left % right;
+				break;
+			case EvalOpCode::Addition: result = left + right; break;
+			case EvalOpCode::Substration: result = left - right; break;
+			case EvalOpCode::ShiftLeft: result = left << right; break;
+			case EvalOpCode::ShiftRight: result = left >> right; break;
+			case EvalOpCode::SmallerThan: result = left < right; resultType = EvalResultType::Boolean; break;
+			case EvalOpCode::SmallerOrEqual: result = left <= right; resultType = EvalResultType::Boolean; break;
+			case EvalOpCode::GreaterThan: result = left > right; resultType = EvalResultType::Boolean; break;
+			case EvalOpCode::GreaterOrEqual: result = left >= right; resultType = EvalResultType::Boolean; break;
+			case EvalOpCode::Equal: result = left == right; resultType = EvalResultType::Boolean; break;
+			case EvalOpCode::NotEqual: result = left != right; resultType = EvalResultType::Boolean; break;
+			case EvalOpCode::BinaryAnd: result = left & right; break;
+			case EvalOpCode::BinaryXor: result = left ^ right; break;
+			case EvalOpCode::BinaryOr: result = left | right; break;
+			case EvalOpCode::LogicalAnd: result = (bool)(left && right); resultType = EvalResultType::Boolean; break;
+			case EvalOpCode::LogicalOr: result = (bool)(left || right); resultType = EvalResultType::Boolean; break;
+
+			// Unary operators
+			case EvalOpCode::Plus: result = right; break;
+			case EvalOpCode::Minus: result = -right; break;
+			case EvalOpCode::BinaryNot: result = ~right; break;
+			case EvalOpCode::LogicalNot: result = (bool)!right; break;
+
+			[[unlikely]] default: throw std::runtime_error("Invalid operator");
+		}
+		return true;
+	}
+
+	constexpr bool IsBinaryOpCode(EvalOpCode op) {
+		return op >= EvalOpCode::Multiplication && op <= EvalOpCode::LogicalOr;
+	}
+
+	constexpr bool IsMemoryOpCode(EvalOpCode op) {
+		return op >= EvalOpCode::AbsoluteAddress;
+	}
+}
+
+void ExpressionEvaluator::Compile(ExpressionData& data) {
+	auto compile = [&data](bool allowFolding) {
+		data.Program.clear();
+
+		// The operand stack depth at each token doesn't depend on the values, track which entries are constants
+		vector<bool> isConstant;
+		for (int64_t token : data.RpnQueue) {
+			if (token >= EvalValues::RegA) {
+				EvalOpCode opCode;
+				int64_t value = token;
+				if (token >= EvalValues::FirstLabelIndex) {
+					opCode = EvalOpCode::PushLabel;
+					value = token - EvalValues::FirstLabelIndex;
+				} else {
+					switch (token) {
+						case EvalValues::Value: opCode = EvalOpCode::PushValue; break;
+						case EvalValues::Address: opCode = EvalOpCode::PushAddress; break;
+						case EvalValues::MemoryAddress: opCode = EvalOpCode::PushMemoryAddress; break;
+						case EvalValues::IsWrite: opCode = EvalOpCode::PushIsWrite; break;
+						case EvalValues::IsRead: opCode = EvalOpCode::PushIsRead; break;
+						case EvalValues::IsDma: opCode = EvalOpCode::PushIsDma; break;
+						case EvalValues::IsDummy: opCode = EvalOpCode::PushIsDummy; break;
+						case EvalValues::OpProgramCounter: opCode = EvalOpCode::PushOpProgramCounter; break;
+						default: opCode = EvalOpCode::PushCpuToken; break;
+					}
+				}
+				data.Program.push_back({opCode, EvalResultType::Numeric, value});
+				isConstant.push_back(false);
+			} else if (token >= EvalOperators::Multiplication) {
+				EvalOpCode opCode = (EvalOpCode)((int64_t)EvalOpCode::Multiplication + (token - EvalOperators::Multiplication));
+				size_t operandCount = IsBinaryOpCode(opCode) ? 2 : 1;
+				if (isConstant.size() < operandCount) {
+					// Missing operand(s): invalid, or a binary operator that reuses the previous operator's left operand
+					if (allowFolding) {
+						return false;
+					}
+					data.Program.push_back({opCode, EvalResultType::Numeric, 0});
+					isConstant.resize(isConstant.empty() ? 0 : isConstant.size() - 1);
+					isConstant.push_back(false);
+					continue;
+				}
+
+				bool fold = allowFolding && !IsMemoryOpCode(opCode) && isConstant.back() && (operandCount == 1 || isConstant[isConstant.size() - 2]);
+				if (fold) {
+					// Constant operands are always the last instructions of the program
+					int64_t right = data.Program.back().Value;
+					int64_t left = operandCount == 2 ? data.Program[data.Program.size() - 2].Value : 0;
+					bool validShift = (opCode != EvalOpCode::ShiftLeft && opCode != EvalOpCode::ShiftRight) || (right >= 0 && right < 64);
+
+					int64_t result;
+					EvalResultType resultType;
+					if (validShift && ApplyOperator(opCode, left, right, result, resultType)) {
+						data.Program.resize(data.Program.size() - operandCount);
+						isConstant.resize(isConstant.size() - operandCount);
+						data.Program.push_back({EvalOpCode::PushFoldedConstant, resultType, result});
+						isConstant.push_back(true);
+						continue;
+					}
+				}
+
+				data.Program.push_back({opCode, EvalResultType::Numeric, 0});
+				isConstant.resize(isConstant.size() - operandCount);
+				isConstant.push_back(false);
+			} else {
+				data.Program.push_back({EvalOpCode::PushConstant, EvalResultType::Numeric, token});
+				isConstant.push_back(true);
+			}
+
+			if (isConstant.size() >= 100) {
+				// Evaluation stops with an error at this point, keep the program as is
+				if (allowFolding) {
+					return false;
+				}
+			}
+		}
+		return true;
+	};
+
+	if (!compile(true)) {
+		compile(false);
+	}
+}
+
 int64_t ExpressionEvaluator::Evaluate(ExpressionData& data, EvalResultType& resultType, MemoryOperationInfo& operationInfo, AddressInfo& addressInfo) {
-	if (data.RpnQueue.empty()) {
+	if (data.Program.empty()) {
 		resultType = EvalResultType::Invalid;
 		return 0;
 	}
@@ -405,218 +544,93 @@ int64_t ExpressionEvaluator::Evaluate(ExpressionData& data, EvalResultType& resu
 	int64_t operandStack[100];
 	resultType = EvalResultType::Numeric;
 
-	for (size_t i = 0, len = data.RpnQueue.size(); i < len; i++) {
-		int64_t token = data.RpnQueue[i];
+	for (const EvalInstruction& inst : data.Program) {
+		int64_t token;
+		switch (inst.OpCode) {
+			case EvalOpCode::PushConstant:
+				token = inst.Value;
+				break;
+			case EvalOpCode::PushFoldedConstant:
+				token = inst.Value;
+				resultType = inst.ResultType;
+				break;
 
-		if (token >= EvalValues::RegA) {
-			// Replace value with a special value
-			if (token >= EvalValues::FirstLabelIndex) {
-				int64_t labelIndex = token - EvalValues::FirstLabelIndex;
-				if ((size_t)labelIndex < data.Labels.size()) {
-					token = _labelManager->GetLabelRelativeAddress(data.Labels[(uint32_t)labelIndex], _cpuType);
-				} else {
-					token = -2;
-				}
+			case EvalOpCode::PushLabel:
+				token = (size_t)inst.Value < data.Labels.size() ? _labelManager->GetLabelRelativeAddress(data.Labels[(uint32_t)inst.Value], _cpuType) : -2;
 				if (token < 0) {
 					// Label is no longer valid
 					resultType = token == -1 ? EvalResultType::OutOfScope : EvalResultType::Invalid;
 					return 0;
 				}
-			} else {
-				switch (token) {
-					case EvalValues::Value:
-						token = operationInfo.Value;
-						break;
-					case EvalValues::Address:
-						token = operationInfo.Address;
-						break;
-					case EvalValues::MemoryAddress:
-						token = addressInfo.Address;
-						break;
-					case EvalValues::IsWrite:
-						token = operationInfo.Type == MemoryOperationType::Write || operationInfo.Type == MemoryOperationType::DmaWrite || operationInfo.Type == MemoryOperationType::DummyWrite;
-						break;
-					case EvalValues::IsRead:
-						token = operationInfo.Type != MemoryOperationType::Write && operationInfo.Type != MemoryOperationType::DmaWrite && operationInfo.Type != MemoryOperationType::DummyWrite;
+				break;
+
+			case EvalOpCode::PushValue:
+				token = operationInfo.Value;
+				break;
+			case EvalOpCode::PushAddress:
+				token = operationInfo.Address;
+				break;
+			case EvalOpCode::PushMemoryAddress:
+				token = addressInfo.Address;
+				break;
+			case EvalOpCode::PushIsWrite:
+				token = operationInfo.Type == MemoryOperationType::Write || operationInfo.Type == MemoryOperationType::DmaWrite || operationInfo.Type == MemoryOperationType::DummyWrite;
+				break;
+			case EvalOpCode::PushIsRead:
+				token = operationInfo.Type != MemoryOperationType::Write && operationInfo.Type != MemoryOperationType::DmaWrite && operationInfo.Type != MemoryOperationType::DummyWrite;
+				break;
+			case EvalOpCode::PushIsDma:
+				token = operationInfo.Type == MemoryOperationType::DmaRead || operationInfo.Type == MemoryOperationType::DmaWrite;
+				break;
+			case EvalOpCode::PushIsDummy:
+				token = operationInfo.Type == MemoryOperationType::DummyRead || operationInfo.Type == MemoryOperationType::DummyWrite;
+				break;
+			case EvalOpCode::PushOpProgramCounter:
+				token = _cpuDebugger->GetProgramCounter(true);
+				break;
+			case EvalOpCode::PushCpuToken:
+				token = _cpuDebugger ? (this->*_getCpuTokenValue)(inst.Value, resultType) : 0;
+				break;
+
+			default: {
+				if (pos <= 0) {
+					resultType = EvalResultType::Invalid;
+					return 0;
+				}
+
+				right = operandStack[--pos];
+				if (pos > 0 && IsBinaryOpCode(inst.OpCode)) {
+					// Only do this for binary operators
+					left = operandStack[--pos];
+				}
+
+				switch (inst.OpCode) {
+					case EvalOpCode::AbsoluteAddress:
+						resultType = EvalResultType::Numeric;
+						token = right >= 0 ? _debugger->GetAbsoluteAddress({(int32_t)right, _cpuMemory}).Address : -1;
 						break;
-					case EvalValues::IsDma:
-						token = operationInfo.Type == MemoryOperationType::DmaRead || operationInfo.Type == MemoryOperationType::DmaWrite;
+					case EvalOpCode::ReadDword:
+						resultType = EvalResultType::Numeric;
+						token = _debugger->GetMemoryDumper()->GetMemoryValue32(_cpuMemory, (uint32_t)right);
 						break;
-					case EvalValues::IsDummy:
-						token = operationInfo.Type == MemoryOperationType::DummyRead || operationInfo.Type == MemoryOperationType::DummyWrite;
+					case EvalOpCode::Bracket:
+						resultType = EvalResultType::Numeric;
+						token = _debugger->GetMemoryDumper()->GetMemoryValue(_cpuMemory, (uint32_t)right);
 						break;
-					case EvalValues::OpProgramCounter:
-						token = _cpuDebugger->GetProgramCounter(true);
+					case EvalOpCode::Braces:
+						resultType = EvalResultType::Numeric;
+						token = _debugger->GetMemoryDumper()->GetMemoryValue16(_cpuMemory, (uint32_t)right);
 						break;
-
 					default:
-						if (!_cpuDebugger) {
-							token = 0;
-						} else {
-							switch (_cpuType) {
-								case CpuType::Snes:
-									token = GetSnesTokenValue(token, resultType);
-									break;
-								case CpuType::Spc:
-									token = GetSpcTokenValue(token, resultType);
-									break;
-								case CpuType::NecDsp:
-									token = GetNecDspTokenValue(token, resultType);
-									break;
-								case CpuType::Sa1:
-									token = GetSnesTokenValue(token, resultType);
-									break;
-								case CpuType::Gsu:
-									token = GetGsuTokenValue(token, resultType);
-									break;
-								case CpuType::Cx4:
-									token = GetCx4TokenValue(token, resultType);
-									break;
-								case CpuType::St018:
-									token = GetSt018TokenValue(token, resultType);
-									break;
-								case CpuType::Gameboy:
-									token = GetGameboyTokenValue(token, resultType);
-									break;
-								case CpuType::Nes:
-									token = GetNesTokenValue(token, resultType);
-									break;
-								case CpuType::Pce:
-									token = GetPceTokenValue(token, resultType);
-									break;
-								case CpuType::Sms:
-									token = GetSmsTokenValue(token, resultType);
-									break;
-								case CpuType::Gba:
-									token = GetGbaTokenValue(token, resultType);
-									break;
-								case CpuType::Ws:
-									token = GetWsTokenValue(token, resultType);
-									break;
-								case CpuType::Lynx:
-									// Lynx uses 65C02, reuse NES token value getter
-									token = GetNesTokenValue(token, resultType);
-									break;
-							}
+						if (!ApplyOperator(inst.OpCode, left, right, token, resultType)) {
+							return 0;
 						}
 						break;
 				}
-			}
-		} else if (token >= EvalOperators::Multiplication) {
-			if (pos <= 0) {
-				resultType = EvalResultType::Invalid;
-				return 0;
-			}
-
-			right = operandStack[--pos];
-			if (pos > 0 && token <= EvalOperators::LogicalOr) {
-				// Only do this for binary operators
-				left = operandStack[--pos];
-			}
-
-			resultType = EvalResultType::Numeric;
-			switch (token) {
-				case EvalOperators::Multiplication:
-					token = left * right;
-					break;
-				case EvalOperators::Division:
-					if (right == 0) {
-						resultType = EvalResultType::DivideBy0;
-						return 0;
-					}
-					token = left / right;
-					break;
-				case EvalOperators::Modulo:
-					if (right == 0) {
-						resultType = EvalResultType::DivideBy0;
-						return 0;
-					}
-					token = left % right;
-					break;
-				case EvalOperators::Addition:
-					token = left + right;
-					break;
-				case EvalOperators::Substration:
-					token = left - right;
-					break;
-				case EvalOperators::ShiftLeft:
-					token = left << right;
-					break;
-				case EvalOperators::ShiftRight:
-					token = left >> right;
-					break;
-				case EvalOperators::SmallerThan:
-					token = left < right;
-					resultType = EvalResultType::Boolean;
-					break;
-				case EvalOperators::SmallerOrEqual:
-					token = left <= right;
-					resultType = EvalResultType::Boolean;
-					break;
-				case EvalOperators::GreaterThan:
-					token = left > right;
-					resultType = EvalResultType::Boolean;
-					break;
-				case EvalOperators::GreaterOrEqual:
-					token = left >= right;
-					resultType = EvalResultType::Boolean;
-					break;
-				case EvalOperators::Equal:
-					token = left == right;
-					resultType = EvalResultType::Boolean;
-					break;
-				case EvalOperators::NotEqual:
-					token = left != right;
-					resultType = EvalResultType::Boolean;
-					break;
-				case EvalOperators::BinaryAnd:
-					token = left & right;
-					break;
-				case EvalOperators::BinaryXor:
-					token = left ^ right;
-					break;
-				case EvalOperators::BinaryOr:
-					token = left | right;
-					break;
-				case EvalOperators::LogicalAnd:
-					token = (bool)(left && right);
-					resultType = EvalResultType::Boolean;
-					break;
-				case EvalOperators::LogicalOr:
-					token = (bool)(left || right);
-					resultType = EvalResultType::Boolean;
-					break;
-
-				// Unary operators
-				case EvalOperators::Plus:
-					token = right;
-					break;
-				case EvalOperators::Minus:
-					token = -right;
-					break;
-				case EvalOperators::BinaryNot:
-					token = ~right;
-					break;
-				case EvalOperators::LogicalNot:
-					token = (bool)!right;
-					break;
-				case EvalOperators::AbsoluteAddress:
-					token = right >= 0 ? _debugger->GetAbsoluteAddress({(int32_t)right, _cpuMemory}).Address : -1;
-					break;
-				case EvalOperators::ReadDword:
-					token = _debugger->GetMemoryDumper()->GetMemoryValue32(_cpuMemory, (uint32_t)right);
-					break;
-
-				case EvalOperators::Bracket:
-					token = _debugger->GetMemoryDumper()->GetMemoryValue(_cpuMemory, (uint32_t)right);
-					break;
-				case EvalOperators::Braces:
-					token = _debugger->GetMemoryDumper()->GetMemoryValue16(_cpuMemory, (uint32_t)right);
-					break;
-				[[unlikely]] default:
-					throw std::runtime_error("Invalid operator");
+				break;
 			}
 		}
+
 		operandStack[pos++] = token;
 		if (pos >= 100) {
 			resultType = EvalResultType::Invalid;
@@ -632,6 +646,25 @@ ExpressionEvaluator::ExpressionEvaluator(Debugger* debugger, IDebugger* cpuDebug
 	_labelManager = debugger->GetLabelManager();
 	_cpuType = cpuType;
 	_cpuMemory = DebugUtilities::GetCpuMemoryType(cpuType);
+
+	switch (cpuType) {
+		case CpuType::Snes: _getCpuTokenValue = &ExpressionEvaluator::GetSnesTokenValue; break;
+		case CpuType::Spc: _getCpuTokenValue = &ExpressionEvaluator::GetSpcTokenValue; break;
+		case CpuType::NecDsp: _getCpuTokenValue = &ExpressionEvaluator::GetNecDspTokenValue; break;
+		case CpuType::Sa1: _getCpuTokenValue = &ExpressionEvaluator::GetSnesTokenValue; break;
+		case CpuType::Gsu: _getCpuTokenValue = &ExpressionEvaluator::GetGsuTokenValue; break;
+		case CpuType::Cx4: _getCpuTokenValue = &ExpressionEvaluator::GetCx4TokenValue; break;
+		case CpuType::St018: _getCpuTokenValue = &ExpressionEvaluator::GetSt018TokenValue; break;
+		case CpuType::Gameboy: _getCpuTokenValue = &ExpressionEvaluator::GetGameboyTokenValue; break;
+		case CpuType::Nes: _getCpuTokenValue = &ExpressionEvaluator::GetNesTokenValue; break;
+		case CpuType::Pce: _getCpuTokenValue = &ExpressionEvaluator::GetPceTokenValue; break;
+		case CpuType::Sms: _getCpuTokenValue = &ExpressionEvaluator::GetSmsTokenValue; break;
+		case CpuType::Gba: _getCpuTokenValue = &ExpressionEvaluator::GetGbaTokenValue; break;
+		case CpuType::Ws: _getCpuTokenValue = &ExpressionEvaluator::GetWsTokenValue; break;
+
+		// Lynx uses 65C02, reuse NES token value getter
+		case CpuType::Lynx: _getCpuTokenValue = &ExpressionEvaluator::GetNesTokenValue; break;
+	}
 }
 
 bool ExpressionEvaluator::ReturnBool(int64_t value, EvalResultType& resultType) {
@@ -695,6 +728,8 @@ ExpressionData* ExpressionEvaluator::PrivateGetRpnList(const string& expression,
 		ExpressionData data;
 		success = ToRpn(fixedExp, data);
 		if (success) {
+			Compile(data);
+
 			LockHandler lock = _cacheLock.AcquireSafe();
 			auto [it, _] = _cache.emplace(expression, std::move(data));
 			cachedData = &it->second;
@@ -731,6 +766,46 @@ int64_t ExpressionEvaluator::Evaluate(const string& expression, EvalResultType&
 	return 0;
 }
 
+void ExpressionEvaluator::SetWatchExpressions(const char* const expressions[], uint32_t count) {
+	vector<ExpressionData*> watchExpressions;
+	watchExpressions.reserve(count);
+	for (uint32_t i = 0; i < count; i++) {
+		ExpressionData* data = nullptr;
+		try {
+			bool success;
+			data = PrivateGetRpnList(expressions[i], success);
+		} catch (std::exception&) {
+		}
+		watchExpressions.push_back(data);
+	}
+
+	LockHandler lock = _watchLock.AcquireSafe();
+	_watchExpressions = std::move(watchExpressions);
+}
+
+bool ExpressionEvaluator::EvaluateWatchExpressions(int64_t values[], EvalResultType resultTypes[], uint32_t count) {
+	LockHandler lock = _watchLock.AcquireSafe();
+	if (count != _watchExpressions.size()) {
+		return false;
+	}
+
+	MemoryOperationInfo operationInfo{0, 0, MemoryOperationType::Read, MemoryType::None};
+	AddressInfo addressInfo = {0, MemoryType::None};
+	for (uint32_t i = 0; i < count; i++) {
+		values[i] = 0;
+		resultTypes[i] = EvalResultType::Invalid;
+		if (_watchExpressions[i]) {
+			try {
+				values[i] = Evaluate(*_watchExpressions[i], resultTypes[i], operationInfo, addressInfo);
+			} catch (std::exception&) {
+				values[i] = 0;
+				resultTypes[i] = EvalResultType::Invalid;
+			}
+		}
+	}
+	return true;
+}
+
 bool ExpressionEvaluator::Validate(const string& expression) {
 	try {
 		EvalResultType type;
@@ -774,6 +849,10 @@ void ExpressionEvaluator::RunTests() {
 
 	test("(0 - 1 == 0 || 15 < 10", EvalResultType::Invalid, 0);
 	test("10 / 0", EvalResultType::DivideBy0, 0);
+	test("10 / (5 - 5)", EvalResultType::DivideBy0, 0);
+	test("(1 == 1) + 0", EvalResultType::Numeric, 1);
+	test("1 << 4", EvalResultType::Numeric, 16);
+	test("!(2 > 1)", EvalResultType::Numeric, 0);
 
 	uint8_t byte4500 = _debugger->GetMemoryDumper()->GetMemoryValue(_cpuMemory, 0x4500);
 	uint16_t word4500 = _debugger->GetMemoryDumper()->GetMemoryValue16(_cpuMemory, 0x4500);
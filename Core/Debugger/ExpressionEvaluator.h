@@ -263,12 +263,68 @@ public:
 	}
 };
 
+/// <summary>
+/// Instruction opcodes of a compiled expression (see ExpressionEvaluator::Compile).
+/// </summary>
+/// <remarks>The operators are in the same order as EvalOperators (Multiplication to Braces).</remarks>
+enum class EvalOpCode : uint8_t {
+	PushConstant,
+	PushFoldedConstant, ///< Result of an operation on constants, also sets the result type
+	PushLabel,
+	PushValue,
+	PushAddress,
+	PushMemoryAddress,
+	PushIsWrite,
+	PushIsRead,
+	PushIsDma,
+	PushIsDummy,
+	PushOpProgramCounter,
+	PushCpuToken,
+
+	Multiplication,
+	Division,
+	Modulo,
+	Addition,
+	Substration,
+	ShiftLeft,
+	ShiftRight,
+	SmallerThan,
+	SmallerOrEqual,
+	GreaterThan,
+	GreaterOrEqual,
+	Equal,
+	NotEqual,
+	BinaryAnd,
+	BinaryXor,
+	BinaryOr,
+	LogicalAnd,
+	LogicalOr,
+	Plus,
+	Minus,
+	BinaryNot,
+	LogicalNot,
+	AbsoluteAddress,
+	ReadDword,
+	Bracket,
+	Braces,
+};
+
+/// <summary>
+/// Compiled expression instruction.
+/// </summary>
+struct EvalInstruction {
+	EvalOpCode OpCode;
+	EvalResultType ResultType; ///< Result type set by PushFoldedConstant
+	int64_t Value;             ///< Constant, label index (PushLabel) or EvalValues token (PushCpuToken)
+};
+
 /// <summary>
 /// Compiled expression data (RPN + labels).
 /// </summary>
 struct ExpressionData {
-	vector<int64_t> RpnQueue; ///< Reverse Polish Notation queue (operators and operands)
-	vector<string> Labels;    ///< Referenced label names (for label → value lookup)
+	vector<int64_t> RpnQueue;        ///< Reverse Polish Notation queue (operators and operands)
+	vector<string> Labels;           ///< Referenced label names (for label → value lookup)
+	vector<EvalInstruction> Program; ///< RpnQueue compiled to instructions (what Evaluate runs)
 };
 
 /// <summary>
@@ -322,12 +378,18 @@ private:
 	unordered_map<string, ExpressionData, StringHasher> _cache; ///< RPN cache (expression → compiled data)
 	SimpleLock _cacheLock;                                      ///< Cache access lock
 
+	vector<ExpressionData*> _watchExpressions; ///< Registered watch expressions (entries in _cache, nullptr if invalid)
+	SimpleLock _watchLock;                     ///< Watch expression list lock
+
 	Debugger* _debugger;         ///< Main debugger instance
 	IDebugger* _cpuDebugger;     ///< CPU-specific debugger
 	LabelManager* _labelManager; ///< Label/symbol manager
 	CpuType _cpuType;            ///< Target CPU type
 	MemoryType _cpuMemory;       ///< Target CPU memory type
 
+	/// <summary>Platform-specific value getter for the target CPU (resolved once, in the constructor)</summary>
+	int64_t (ExpressionEvaluator::*_getCpuTokenValue)(int64_t token, EvalResultType& resultType) = nullptr;
+
 	/// <summary>
 	/// Check if token is an operator.
 	/// </summary>
@@ -442,6 +504,19 @@ private:
 	/// </remarks>
 	bool ToRpn(const string& expression, ExpressionData& data);
 
+	/// <summary>
+	/// Compile the RPN queue into the instruction list that Evaluate runs.
+	/// </summary>
+	/// <param name="data">RPN data, its Program is filled</param>
+	/// <remarks>
+	/// Each RPN token is classified once (value kinds and operators become dense opcodes instead of being
+	/// compared against the EvalValues/EvalOperators ranges on every evaluation), and operations on constants
+	/// are folded (e.g "$2000 + 5" or "1 << 4"). Folding is skipped for expressions the stack machine
+	/// evaluates in a non-obvious way (operand stack overflow, binary operator with a single operand),
+	/// so results are always identical to evaluating the RPN queue.
+	/// </remarks>
+	static void Compile(ExpressionData& data);
+
 	/// <summary>
 	/// Internal evaluation with caching.
 	/// </summary>
@@ -505,6 +580,22 @@ public:
 	/// <param name="tokenList">Output token list (tab-separated)</param>
 	void GetTokenList(char* tokenList);
 
+	/// <summary>
+	/// Replace the registered watch expressions (compiled once, evaluated by EvaluateWatchExpressions).
+	/// </summary>
+	/// <param name="expressions">Expression strings (invalid ones evaluate as EvalResultType::Invalid)</param>
+	/// <param name="count">Number of expressions</param>
+	void SetWatchExpressions(const char* const expressions[], uint32_t count);
+
+	/// <summary>
+	/// Evaluate all registered watch expressions.
+	/// </summary>
+	/// <param name="values">Output values, in registration order</param>
+	/// <param name="resultTypes">Output result types, in registration order</param>
+	/// <param name="count">Size of the output arrays</param>
+	/// <returns>False if count doesn't match the number of registered expressions (nothing is evaluated)</returns>
+	bool EvaluateWatchExpressions(int64_t values[], EvalResultType resultTypes[], uint32_t count);
+
 	/// <summary>
 	/// Validate expression syntax.
 	/// </summary>
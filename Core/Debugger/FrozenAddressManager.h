@@ -1,12 +1,13 @@
 #pragma once
 #include "pch.h"
+#include <bit>
 
 /// <summary>
 /// Manager for frozen memory addresses (prevent writes).
 /// </summary>
 /// <remarks>
 /// Architecture:
-/// - Maintains set of frozen addresses
+/// - Maintains a bitmap of frozen addresses (1 bit per address)
 /// - Prevents emulation from modifying frozen values
 /// - Range-based freeze/unfreeze operations
 ///
@@ -16,8 +17,10 @@
 /// - Original value maintained
 ///
 /// Performance:
-/// - Hash set for O(1) lookup
-/// - Size check before lookup (fast path if empty)
+/// - Two-level bitmap: 64K-address pages (8KB each), only allocated once something in them is frozen,
+///   so 32-bit address spaces (GBA) don't need a flat bitmap
+/// - Frozen address count checked first (fast path if empty), then one bit test
+/// - Ranges are updated 64 addresses at a time, freezing whole RAM regions is cheap
 ///
 /// Use cases:
 /// - Infinite health/lives (freeze HP/lives addresses)
@@ -26,7 +29,12 @@
 /// </remarks>
 class FrozenAddressManager {
 protected:
-	unordered_set<uint32_t> _frozenAddresses; ///< Set of frozen addresses
+	static constexpr uint32_t PageShift = 16;
+	static constexpr uint32_t PageMask = (1 << PageShift) - 1;
+	static constexpr uint32_t WordsPerPage = (1 << PageShift) / 64;
+
+	vector<unique_ptr<uint64_t[]>> _pages; ///< Frozen address bits, indexed by address >> PageShift (nullptr = nothing frozen)
+	uint64_t _frozenCount = 0;             ///< Number of frozen addresses
 
 public:
 	/// <summary>
@@ -36,14 +44,36 @@ public:
 	/// <param name="end">End address (inclusive)</param>
 	/// <param name="freeze">True to freeze, false to unfreeze</param>
 	void UpdateFrozenAddresses(uint32_t start, uint32_t end, bool freeze) {
-		if (freeze) {
-			for (uint32_t i = start; i <= end; i++) {
-				_frozenAddresses.emplace(i);
+		uint64_t addr = start;
+		while (addr <= end) {
+			uint32_t page = (uint32_t)(addr >> PageShift);
+			uint32_t bit = addr & 0x3F;
+			uint64_t count = std::min<uint64_t>(64 - bit, (uint64_t)end - addr + 1);
+			uint64_t mask = (count == 64 ? ~0ULL : ((1ULL << count) - 1)) << bit;
+
+			if (!freeze && (page >= _pages.size() || !_pages[page])) {
+				// Nothing frozen in this page
+				addr = (uint64_t)(page + 1) << PageShift;
+				continue;
+			}
+
+			if (page >= _pages.size()) {
+				_pages.resize(page + 1);
 			}
-		} else {
-			for (uint32_t i = start; i <= end; i++) {
-				_frozenAddresses.erase(i);
+			if (!_pages[page]) {
+				_pages[page] = std::make_unique<uint64_t[]>(WordsPerPage);
 			}
+
+			uint64_t& word = _pages[page][(addr & PageMask) >> 6];
+			uint64_t prev = word;
+			word = freeze ? (word | mask) : (word & ~mask);
+			_frozenCount += std::popcount(word);
+			_frozenCount -= std::popcount(prev);
+			addr += count;
+		}
+
+		if (_frozenCount == 0) {
+			_pages.clear();
 		}
 	}
 
@@ -53,12 +83,23 @@ public:
 	/// <param name="addr">Address to check</param>
 	/// <returns>True if frozen</returns>
 	/// <remarks>
-	/// Size check first for fast path when no addresses frozen.
+	/// Count check first for fast path when no addresses frozen.
 	/// </remarks>
-	bool IsFrozenAddress(uint32_t addr) {
-		return _frozenAddresses.size() > 0 && _frozenAddresses.contains(addr);
+	__forceinline bool IsFrozenAddress(uint32_t addr) {
+		if (_frozenCount == 0) {
+			return false;
+		}
+
+		uint32_t page = addr >> PageShift;
+		if (page >= _pages.size() || !_pages[page]) {
+			return false;
+		}
+		return (_pages[page][(addr & PageMask) >> 6] >> (addr & 0x3F)) & 1;
 	}
 
+	/// <summary>Number of frozen addresses</summary>
+	[[nodiscard]] uint64_t GetFrozenCount() { return _frozenCount; }
+
 	/// <summary>
 	/// Get frozen state for address range.
 	/// </summary>
@@ -66,8 +107,8 @@ public:
 	/// <param name="end">End address</param>
 	/// <param name="outState">Output boolean array (frozen state per address)</param>
 	void GetFrozenState(uint32_t start, uint32_t end, bool* outState) {
-		for (uint32_t i = start; i <= end; i++) {
-			outState[i - start] = _frozenAddresses.contains(i);
+		for (uint64_t i = start; i <= end; i++) {
+			outState[i - start] = IsFrozenAddress((uint32_t)i);
 		}
 	}
-};
\ No newline at end of file
+};
@@ -80,6 +80,14 @@ public:
 	/// <param name="offset">Offset from latest trace (0 = most recent)</param>
 	virtual void GetExecutionTrace(TraceRow& row, uint32_t offset) = 0;
 
+	/// <summary>
+	/// Format a binary record written to the trace log file (see TraceLogFileSaver).
+	/// </summary>
+	/// <param name="record">Record data, as logged by this trace logger</param>
+	/// <param name="size">Record size</param>
+	/// <param name="output">Output text row</param>
+	virtual void FormatFileRecord(const uint8_t* record, uint32_t size, string& output) = 0;
+
 	/// <summary>
 	/// Clear trace history buffer.
 	/// </summary>
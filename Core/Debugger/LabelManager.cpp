@@ -12,11 +12,26 @@ void LabelManager::ClearLabels() {
 	DebugBreakHelper helper(_debugger);
 	_codeLabels.clear();
 	_codeLabelReverseLookup.clear();
+	_version++;
 }
 
 void LabelManager::SetLabel(uint32_t address, MemoryType memType, const string& label, const string& comment) {
 	DebugBreakHelper helper(_debugger);
+	InternalSetLabel(address, memType, label, comment);
+}
+
+void LabelManager::SetLabels(uint32_t count, const uint32_t addresses[], const MemoryType memTypes[], const char* const labels[], const char* const comments[]) {
+	DebugBreakHelper helper(_debugger);
+	_codeLabels.reserve(_codeLabels.size() + count);
+	_codeLabelReverseLookup.reserve(_codeLabelReverseLookup.size() + count);
+	for (uint32_t i = 0; i < count; i++) {
+		InternalSetLabel(addresses[i], memTypes[i], labels[i] ? labels[i] : "", comments[i] ? comments[i] : "");
+	}
+}
+
+void LabelManager::InternalSetLabel(uint32_t address, MemoryType memType, const string& label, const string& comment) {
 	uint64_t key = GetLabelKey(address, memType);
+	_version++;
 
 	auto existingLabel = _codeLabels.find(key);
 	if (existingLabel != _codeLabels.end()) {
@@ -34,8 +49,8 @@ void LabelManager::SetLabel(uint32_t address, MemoryType memType, const string&
 		}
 		labelInfo.Comment = comment;
 
-		_codeLabels.emplace(key, labelInfo);
 		_codeLabelReverseLookup.emplace(labelInfo.Label, key);
+		_codeLabels.emplace(key, std::move(labelInfo));
 	}
 }
 
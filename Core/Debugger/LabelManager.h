@@ -70,7 +70,8 @@ private:
 	unordered_map<uint64_t, LabelInfo, AddressHasher> _codeLabels; ///< Address → Label/Comment map
 	unordered_map<string, uint64_t> _codeLabelReverseLookup;       ///< Label → Address map
 
-	Debugger* _debugger; ///< Parent debugger instance
+	Debugger* _debugger;   ///< Parent debugger instance
+	uint32_t _version = 0; ///< Incremented whenever a label/comment is added, changed or removed
 
 	/// <summary>
 	/// Pack memory type and address into 64-bit key.
@@ -100,6 +101,11 @@ private:
 	/// <returns>True if label found</returns>
 	bool InternalGetLabel(AddressInfo address, string& label);
 
+	/// <summary>
+	/// Add, update or remove a label (the emulation must be paused).
+	/// </summary>
+	void InternalSetLabel(uint32_t address, MemoryType memType, const string& label, const string& comment);
+
 public:
 	/// <summary>
 	/// Constructor for label manager.
@@ -126,11 +132,30 @@ public:
 	/// </remarks>
 	void SetLabel(uint32_t address, MemoryType memType, const string& label, const string& comment);
 
+	/// <summary>
+	/// Add, update or remove labels in bulk (same as calling SetLabel for each entry, in order).
+	/// </summary>
+	/// <param name="count">Number of entries</param>
+	/// <param name="addresses">Absolute addresses</param>
+	/// <param name="memTypes">Memory types</param>
+	/// <param name="labels">Symbol labels (empty to remove)</param>
+	/// <param name="comments">Code comments (empty to remove)</param>
+	/// <remarks>
+	/// Used by symbol file imports: the emulation is only paused once for the whole batch
+	/// (instead of once per label), and the hash maps are only grown once.
+	/// </remarks>
+	void SetLabels(uint32_t count, const uint32_t addresses[], const MemoryType memTypes[], const char* const labels[], const char* const comments[]);
+
 	/// <summary>
 	/// Clear all labels and comments.
 	/// </summary>
 	void ClearLabels();
 
+	/// <summary>
+	/// Get the labels' version, which changes every time labels/comments are modified (used to validate cached disassembly).
+	/// </summary>
+	[[nodiscard]] uint32_t GetVersion() { return _version; }
+
 	/// <summary>
 	/// Get absolute address for label.
 	/// </summary>
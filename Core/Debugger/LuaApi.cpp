@@ -20,6 +20,8 @@
 #include "Shared/Video/BaseVideoFilter.h"
 #include "Shared/Video/VideoRenderer.h"
 #include "Shared/Video/DrawScreenBufferCommand.h"
+#include "Shared/Video/DrawPixelBatchCommand.h"
+#include "Shared/Video/DrawRectangleBatchCommand.h"
 #include "Shared/Video/DrawStringCommand.h"
 #include "Shared/KeyManager.h"
 #include "Shared/Interfaces/IConsole.h"
@@ -98,10 +100,10 @@
 		error("This function must be called inside an exec memory operation callback for the main CPU"); \
 	}
 
-Debugger* LuaApi::_debugger = nullptr;
-Emulator* LuaApi::_emu = nullptr;
-MemoryDumper* LuaApi::_memoryDumper = nullptr;
-ScriptingContext* LuaApi::_context = nullptr;
+thread_local Debugger* LuaApi::_debugger = nullptr;
+thread_local Emulator* LuaApi::_emu = nullptr;
+thread_local MemoryDumper* LuaApi::_memoryDumper = nullptr;
+thread_local ScriptingContext* LuaApi::_context = nullptr;
 
 enum class AccessCounterType {
 	ReadCount,
@@ -135,6 +137,8 @@ int LuaApi::GetLibrary(lua_State* lua) {
 	    {"write16",              LuaApi::WriteMemory16           },
 	    {"read32",               LuaApi::ReadMemory32            },
 	    {"write32",              LuaApi::WriteMemory32           },
+	    {"readRange",            LuaApi::ReadMemoryRange         },
+	    {"writeRange",           LuaApi::WriteMemoryRange        },
 
 	    {"readWord",             LuaApi::ReadMemory16            }, //   for backward compatibility
 	    {"writeWord",            LuaApi::WriteMemory16           }, //   for backward compatibility
@@ -144,6 +148,8 @@ int LuaApi::GetLibrary(lua_State* lua) {
 
 	    {"addMemoryCallback",    LuaApi::RegisterMemoryCallback  },
 	    {"removeMemoryCallback", LuaApi::UnregisterMemoryCallback},
+	    {"addDmaCallback",       LuaApi::RegisterDmaCallback     },
+	    {"removeDmaCallback",    LuaApi::UnregisterDmaCallback   },
 	    {"addEventCallback",     LuaApi::RegisterEventCallback   },
 	    {"removeEventCallback",  LuaApi::UnregisterEventCallback },
 
@@ -153,6 +159,8 @@ int LuaApi::GetLibrary(lua_State* lua) {
 	    {"drawPixel",            LuaApi::DrawPixel               },
 	    {"drawLine",             LuaApi::DrawLine                },
 	    {"drawRectangle",        LuaApi::DrawRectangle           },
+	    {"drawPixels",           LuaApi::DrawPixels              },
+	    {"drawRectangles",       LuaApi::DrawRectangles          },
 	    {"clearScreen",          LuaApi::ClearScreen             },
 
 	    {"getScreenSize",        LuaApi::GetScreenSize           },
@@ -184,6 +192,12 @@ int LuaApi::GetLibrary(lua_State* lua) {
 
 	    {"getCdlData",           LuaApi::GetCdlData              },
 
+	    {"enableAsyncFrames",    LuaApi::EnableAsyncFrames       },
+
+	    {"openSocket",           LuaApi::OpenSocket              },
+	    {"sendSocket",           LuaApi::SendSocket              },
+	    {"closeSocket",          LuaApi::CloseSocket             },
+
 	    {"addCheat",             LuaApi::AddCheat                },
 	    {"clearCheats",          LuaApi::ClearCheats             },
 
@@ -192,6 +206,9 @@ int LuaApi::GetLibrary(lua_State* lua) {
 
 	    {"getState",             LuaApi::GetState                },
 	    {"setState",             LuaApi::SetState                },
+	    {"getStateValue",        LuaApi::GetStateValue           },
+	    {"setStateValue",        LuaApi::SetStateValue           },
+	    {"getStateKeys",         LuaApi::GetStateKeys            },
 
 	    {"selectDrawSurface",    LuaApi::SelectDrawSurface       },
 
@@ -222,6 +239,7 @@ int LuaApi::GetLibrary(lua_State* lua) {
 	GenerateEnumDefinition<AccessCounterType>(lua, "counterType");
 	GenerateEnumDefinition<CpuType>(lua, "cpuType");
 	GenerateEnumDefinition<ScriptDrawSurface>(lua, "drawSurface");
+	GenerateEnumDefinition<ScriptSocketEventType>(lua, "socketEventType");
 	GenerateEnumDefinition<EventType>(lua, "eventType", {EventType::LastValue});
 	GenerateEnumDefinition<StepType>(lua, "stepType", {StepType::StepBack});
 
@@ -242,6 +260,11 @@ void LuaApi::GenerateEnumDefinition(lua_State* lua, const string& enumName, unor
 	lua_settable(lua, -3);
 }
 
+bool LuaApi::IsReadingSnapshots() {
+	// While the script loads (and in its scriptEnded callbacks), the script runs on the emulation thread and reads the memory directly
+	return _context->IsAsyncMode() && _context->CheckInitDone();
+}
+
 DebugHud* LuaApi::GetHud() {
 	if (_context->GetDrawSurface() == ScriptDrawSurface::ConsoleScreen) {
 		return _emu->GetDebugHud();
@@ -288,7 +311,14 @@ int LuaApi::ReadMemory(lua_State* lua) {
 	checkminparams(2);
 	errorCond(address < 0, "address must be >= 0");
 	checkEnum(MemoryType, memType, "invalid memory type");
-	uint8_t value = _memoryDumper->GetMemoryValue(memType, address, disableSideEffects);
+	uint8_t value;
+	if (IsReadingSnapshots()) {
+		const uint8_t* data = _context->GetSnapshotData(memType, address, 1);
+		errorCond(!data, "address is not in the async frame snapshots");
+		value = data[0];
+	} else {
+		value = _memoryDumper->GetMemoryValue(memType, address, disableSideEffects);
+	}
 	l.Return(returnSignedValue ? (int8_t)value : value);
 	return l.ReturnCount();
 }
@@ -319,7 +349,14 @@ int LuaApi::ReadMemory16(lua_State* lua) {
 	checkminparams(2);
 	errorCond(address < 0, "address must be >= 0");
 	checkEnum(MemoryType, memType, "invalid memory type");
-	uint16_t value = _memoryDumper->GetMemoryValue16(memType, address, disableSideEffects);
+	uint16_t value;
+	if (IsReadingSnapshots()) {
+		const uint8_t* data = _context->GetSnapshotData(memType, address, 2);
+		errorCond(!data, "address is not in the async frame snapshots");
+		value = data[0] | (data[1] << 8);
+	} else {
+		value = _memoryDumper->GetMemoryValue16(memType, address, disableSideEffects);
+	}
 	l.Return(returnSignedValue ? (int16_t)value : value);
 	return l.ReturnCount();
 }
@@ -335,7 +372,14 @@ int LuaApi::ReadMemory32(lua_State* lua) {
 	checkminparams(2);
 	errorCond(address < 0, "address must be >= 0");
 	checkEnum(MemoryType, memType, "invalid memory type");
-	uint32_t value = _memoryDumper->GetMemoryValue32(memType, address, disableSideEffects);
+	uint32_t value;
+	if (IsReadingSnapshots()) {
+		const uint8_t* data = _context->GetSnapshotData(memType, address, 4);
+		errorCond(!data, "address is not in the async frame snapshots");
+		value = data[0] | (data[1] << 8) | (data[2] << 16) | ((uint32_t)data[3] << 24);
+	} else {
+		value = _memoryDumper->GetMemoryValue32(memType, address, disableSideEffects);
+	}
 	l.Return(returnSignedValue ? (int32_t)value : value);
 	return l.ReturnCount();
 }
@@ -369,6 +413,86 @@ int LuaApi::WriteMemory32(lua_State* lua) {
 	return l.ReturnCount();
 }
 
+int LuaApi::ReadMemoryRange(lua_State* lua) {
+	// Parameters are read directly from the stack, the optional output table is the last one
+	lua_settop(lua, 4);
+	int address = (int)luaL_checkinteger(lua, 1);
+	int length = (int)luaL_checkinteger(lua, 2);
+	int type = (int)luaL_checkinteger(lua, 3);
+	bool fillTable = lua_istable(lua, 4);
+	MemoryType memType = (MemoryType)(type & 0xFF);
+	errorCond(!fillTable && !lua_isnil(lua, 4), "output must be a table");
+	errorCond(address < 0, "address must be >= 0");
+	errorCond(length < 0, "length must be >= 0");
+	checkEnum(MemoryType, memType, "invalid memory type");
+	errorCond((uint64_t)address + length > _memoryDumper->GetMemorySize(memType), "range exceeds the memory size");
+
+	const uint8_t* snapshot = nullptr;
+	if (IsReadingSnapshots()) {
+		snapshot = _context->GetSnapshotData(memType, address, length);
+		errorCond(!snapshot, "range is not in the async frame snapshots");
+	}
+
+	// Reads never have side effects (same as emu.read), so the whole range is copied at once
+	vector<uint8_t> values(snapshot ? 0 : length);
+	if (!snapshot && length > 0) {
+		_memoryDumper->GetMemoryValues(memType, address, address + length - 1, values.data());
+	}
+
+	const uint8_t* data = snapshot ? snapshot : values.data();
+	if (fillTable) {
+		for (int i = 0; i < length; i++) {
+			lua_pushinteger(lua, data[i]);
+			lua_rawseti(lua, 4, i + 1);
+		}
+		lua_settop(lua, 4);
+	} else {
+		lua_pushlstring(lua, (const char*)data, length);
+	}
+	return 1;
+}
+
+int LuaApi::WriteMemoryRange(lua_State* lua) {
+	lua_settop(lua, 3);
+	int address = (int)luaL_checkinteger(lua, 1);
+	int type = (int)luaL_checkinteger(lua, 3);
+	bool disableSideEffects = (type & 0x100) == 0x100;
+	MemoryType memType = (MemoryType)(type & 0xFF);
+	errorCond(address < 0, "address must be >= 0");
+	checkEnum(MemoryType, memType, "invalid memory type");
+
+	// Validate everything before allocating, luaL_error doesn't unwind the C++ stack
+	bool isString = lua_type(lua, 2) == LUA_TSTRING;
+	errorCond(!isString && !lua_istable(lua, 2), "data must be a string or a table");
+	size_t length = (size_t)lua_rawlen(lua, 2);
+	errorCond((uint64_t)address + length > _memoryDumper->GetMemorySize(memType), "range exceeds the memory size");
+	if (!isString) {
+		for (size_t i = 0; i < length; i++) {
+			lua_rawgeti(lua, 2, (lua_Integer)i + 1);
+			lua_Integer value = lua_tointeger(lua, -1);
+			lua_pop(lua, 1);
+			errorCond(value > 255 || value < -128, "value out of range");
+		}
+	}
+
+	if (length == 0) {
+		return 0;
+	}
+
+	vector<uint8_t> values(length);
+	if (isString) {
+		memcpy(values.data(), lua_tostring(lua, 2), length);
+	} else {
+		for (size_t i = 0; i < length; i++) {
+			lua_rawgeti(lua, 2, (lua_Integer)i + 1);
+			values[i] = (uint8_t)lua_tointeger(lua, -1);
+			lua_pop(lua, 1);
+		}
+	}
+	_memoryDumper->SetMemoryValues(memType, address, values.data(), (uint32_t)length, disableSideEffects);
+	return 0;
+}
+
 int LuaApi::ConvertAddress(lua_State* lua) {
 	LuaCallHelper l(lua);
 	l.ForceParamCount(3);
@@ -481,6 +605,64 @@ int LuaApi::UnregisterMemoryCallback(lua_State* lua) {
 	return l.ReturnCount();
 }
 
+int LuaApi::RegisterDmaCallback(lua_State* lua) {
+	LuaCallHelper l(lua);
+	l.ForceParamCount(6);
+
+	MemoryType memType = (MemoryType)l.ReadInteger((int)_context->GetDefaultMemType());
+	CpuType cpuType = (CpuType)l.ReadInteger((int)_context->GetDefaultCpuType());
+	int32_t endAddr = l.ReadInteger(-1);
+	uint32_t startAddr = l.ReadInteger();
+	CallbackType callbackType = (CallbackType)l.ReadInteger();
+	int reference = l.GetReference();
+
+	checkminparams(3);
+
+	if (endAddr == -1) {
+		endAddr = startAddr;
+	}
+
+	errorCond(startAddr > (uint32_t)endAddr, "start address must be <= end address");
+	checkEnum(CallbackType, callbackType, "invalid callback type");
+	errorCond(callbackType == CallbackType::Exec, "DMA callbacks must be read or write callbacks");
+	checkEnum(MemoryType, memType, "invalid memory type");
+	checkEnum(CpuType, cpuType, "invalid cpu type");
+	errorCond(reference == LUA_NOREF, "callback function could not be found");
+
+	_context->RegisterDmaCallback(callbackType, startAddr, endAddr, memType, cpuType, reference);
+	_context->Log("Registered DMA callback from $" + HexUtilities::ToHex((uint32_t)startAddr) + " to $" + HexUtilities::ToHex((uint32_t)endAddr));
+	l.Return(reference);
+	return l.ReturnCount();
+}
+
+int LuaApi::UnregisterDmaCallback(lua_State* lua) {
+	LuaCallHelper l(lua);
+	l.ForceParamCount(6);
+
+	MemoryType memType = (MemoryType)l.ReadInteger((int)_context->GetDefaultMemType());
+	CpuType cpuType = (CpuType)l.ReadInteger((int)_context->GetDefaultCpuType());
+	int endAddr = l.ReadInteger(-1);
+	int startAddr = l.ReadInteger();
+	CallbackType callbackType = (CallbackType)l.ReadInteger();
+	int reference = l.ReadInteger();
+
+	checkminparams(3);
+
+	if (endAddr == -1) {
+		endAddr = startAddr;
+	}
+
+	errorCond(startAddr < 0, "start address must be >= 0");
+	errorCond(startAddr > endAddr, "start address must be <= end address");
+	checkEnum(CallbackType, callbackType, "invalid callback type");
+	checkEnum(MemoryType, memType, "invalid memory type");
+	checkEnum(CpuType, cpuType, "invalid cpu type");
+	errorCond(reference == LUA_NOREF, "callback function could not be found");
+
+	_context->UnregisterDmaCallback(callbackType, startAddr, endAddr, memType, cpuType, reference);
+	return l.ReturnCount();
+}
+
 int LuaApi::RegisterEventCallback(lua_State* lua) {
 	LuaCallHelper l(lua);
 	EventType type = (EventType)l.ReadInteger();
@@ -488,6 +670,7 @@ int LuaApi::RegisterEventCallback(lua_State* lua) {
 	checkparams();
 	checkEnum(EventType, type, "invalid event type");
 	errorCond(reference == LUA_NOREF, "callback function could not be found");
+	errorCond(_context->IsAsyncMode() && type != EventType::EndFrame && type != EventType::ScriptEnded, "only endFrame and scriptEnded callbacks can be used with async frames");
 	_context->RegisterEventCallback(type, reference);
 	l.Return(reference);
 	return l.ReturnCount();
@@ -591,6 +774,53 @@ int LuaApi::DrawRectangle(lua_State* lua) {
 	return l.ReturnCount();
 }
 
+int LuaApi::DrawPixels(lua_State* lua) {
+	// Flat array of x, y, color values (no table per pixel), drawn by a single command
+	lua_settop(lua, 3);
+	luaL_checktype(lua, 1, LUA_TTABLE);
+	int frameCount = (int)luaL_optinteger(lua, 2, 1);
+	int displayDelay = (int)luaL_optinteger(lua, 3, 0);
+	size_t length = (size_t)lua_rawlen(lua, 1);
+	errorCond(length % 3 != 0, "pixel array must contain x, y, color values for each pixel");
+
+	int startFrame = _emu->GetFrameCount() + displayDelay;
+	unique_ptr<DrawPixelBatchCommand> cmd(new DrawPixelBatchCommand(frameCount, startFrame, length / 3));
+	for (size_t i = 0; i < length; i += 3) {
+		lua_rawgeti(lua, 1, (lua_Integer)i + 1);
+		lua_rawgeti(lua, 1, (lua_Integer)i + 2);
+		lua_rawgeti(lua, 1, (lua_Integer)i + 3);
+		cmd->AddPixel((int)lua_tointeger(lua, -3), (int)lua_tointeger(lua, -2), (int)lua_tointeger(lua, -1));
+		lua_pop(lua, 3);
+	}
+
+	GetHud()->AddCommand(std::move(cmd));
+	return 0;
+}
+
+int LuaApi::DrawRectangles(lua_State* lua) {
+	// Flat array of x, y, width, height, color values (no table per rectangle), drawn by a single command
+	lua_settop(lua, 4);
+	luaL_checktype(lua, 1, LUA_TTABLE);
+	bool fill = lua_toboolean(lua, 2) != 0;
+	int frameCount = (int)luaL_optinteger(lua, 3, 1);
+	int displayDelay = (int)luaL_optinteger(lua, 4, 0);
+	size_t length = (size_t)lua_rawlen(lua, 1);
+	errorCond(length % 5 != 0, "rectangle array must contain x, y, width, height, color values for each rectangle");
+
+	int startFrame = _emu->GetFrameCount() + displayDelay;
+	unique_ptr<DrawRectangleBatchCommand> cmd(new DrawRectangleBatchCommand(fill, frameCount, startFrame, length / 5));
+	for (size_t i = 0; i < length; i += 5) {
+		for (int j = 1; j <= 5; j++) {
+			lua_rawgeti(lua, 1, (lua_Integer)i + j);
+		}
+		cmd->AddRectangle((int)lua_tointeger(lua, -5), (int)lua_tointeger(lua, -4), (int)lua_tointeger(lua, -3), (int)lua_tointeger(lua, -2), (int)lua_tointeger(lua, -1));
+		lua_pop(lua, 5);
+	}
+
+	GetHud()->AddCommand(std::move(cmd));
+	return 0;
+}
+
 int LuaApi::ClearScreen(lua_State* lua) {
 	LuaCallHelper l(lua);
 	checkparams();
@@ -978,6 +1208,104 @@ int LuaApi::GetCdlData(lua_State* lua) {
 	return 1;
 }
 
+int LuaApi::EnableAsyncFrames(lua_State* lua) {
+	lua_settop(lua, 1);
+	luaL_checktype(lua, 1, LUA_TTABLE);
+	errorCond(_context->CheckInitDone(), "async frames must be enabled while the script is loading");
+	errorCond(_context->IsAsyncMode(), "async frames are already enabled");
+
+	// Validate the memory types before allocating, luaL_error doesn't unwind the C++ stack
+	constexpr int maxMemTypes = (int)magic_enum::enum_count<MemoryType>();
+	MemoryType memTypes[maxMemTypes];
+	int count = (int)luaL_len(lua, 1);
+	errorCond(count > maxMemTypes, "too many memory types");
+	for (int i = 0; i < count; i++) {
+		lua_rawgeti(lua, 1, i + 1);
+		errorCond(!lua_isinteger(lua, -1), "memory types must be integers");
+		memTypes[i] = (MemoryType)(lua_tointeger(lua, -1) & 0xFF);
+		lua_pop(lua, 1);
+		checkEnum(MemoryType, memTypes[i], "invalid memory type");
+	}
+
+	bool enabled;
+	{
+		string errorMsg;
+		enabled = _context->EnableAsyncMode(vector<MemoryType>(memTypes, memTypes + count), errorMsg);
+		if (!enabled) {
+			lua_pushstring(lua, errorMsg.c_str());
+		}
+	}
+	if (!enabled) {
+		return lua_error(lua);
+	}
+
+	// The frame callbacks run on a worker thread, only functions that only read the snapshots or draw remain available
+	static constexpr const char* asyncFunctions[] = {
+	    "getMemorySize", "read", "read16", "read32", "readWord", "readRange",
+	    "addEventCallback", "removeEventCallback",
+	    "measureString", "drawString", "drawPixel", "drawLine", "drawRectangle", "drawPixels", "drawRectangles", "clearScreen",
+	    "log", "displayMessage", "getScriptDataFolder"};
+
+	lua_getglobal(lua, "emu");
+	if (lua_istable(lua, -1)) {
+		lua_pushnil(lua);
+		while (lua_next(lua, -2) != 0) {
+			// Existing fields can be assigned while iterating with lua_next
+			if (lua_type(lua, -2) == LUA_TSTRING && lua_iscfunction(lua, -1)) {
+				const char* name = lua_tostring(lua, -2);
+				bool allowed = std::any_of(std::begin(asyncFunctions), std::end(asyncFunctions), [=](const char* func) { return strcmp(func, name) == 0; });
+				if (!allowed) {
+					lua_pushvalue(lua, -2);
+					lua_pushvalue(lua, -1);
+					lua_pushcclosure(lua, LuaApi::AsyncUnavailable, 1);
+					lua_rawset(lua, -5);
+				}
+			}
+			lua_pop(lua, 1);
+		}
+	}
+	lua_settop(lua, 1);
+	return 0;
+}
+
+int LuaApi::OpenSocket(lua_State* lua) {
+	lua_settop(lua, 4);
+	const char* host = luaL_checkstring(lua, 1);
+	lua_Integer port = luaL_checkinteger(lua, 2);
+	luaL_checktype(lua, 3, LUA_TFUNCTION);
+	size_t delimiterLength = 0;
+	const char* delimiter = luaL_optlstring(lua, 4, "", &delimiterLength);
+	bool allowNetwork = _emu->GetSettings()->GetDebugConfig().ScriptAllowIoOsAccess && _emu->GetSettings()->GetDebugConfig().ScriptAllowNetworkAccess;
+	errorCond(!allowNetwork, "network access is disabled (Script->Settings->Script Window->Restrictions)");
+	errorCond(port < 1 || port > 65535, "port must be between 1 and 65535");
+
+	lua_pushvalue(lua, 3);
+	int reference = luaL_ref(lua, LUA_REGISTRYINDEX);
+	int id = _context->OpenSocket(host, (uint16_t)port, string(delimiter, delimiterLength), reference);
+	lua_pushinteger(lua, id);
+	return 1;
+}
+
+int LuaApi::SendSocket(lua_State* lua) {
+	lua_settop(lua, 2);
+	int id = (int)luaL_checkinteger(lua, 1);
+	size_t length = 0;
+	const char* data = luaL_checklstring(lua, 2, &length);
+	lua_pushboolean(lua, _context->SendSocket(id, data, length));
+	return 1;
+}
+
+int LuaApi::CloseSocket(lua_State* lua) {
+	lua_settop(lua, 1);
+	int id = (int)luaL_checkinteger(lua, 1);
+	_context->CloseSocket(id);
+	return 0;
+}
+
+int LuaApi::AsyncUnavailable(lua_State* lua) {
+	return luaL_error(lua, "emu.%s can't be used when async frames are enabled", lua_tostring(lua, lua_upvalueindex(1)));
+}
+
 int LuaApi::GetScriptDataFolder(lua_State* lua) {
 	LuaCallHelper l(lua);
 	checkparams();
@@ -1062,13 +1390,7 @@ int LuaApi::LoadSavestate(lua_State* lua) {
 	return l.ReturnCount();
 }
 
-int LuaApi::GetState(lua_State* lua) {
-	LuaCallHelper l(lua);
-	checkparams();
-
-	Serializer s(0, true, SerializeFormat::Map);
-	s.Stream(*_emu->GetConsole().get(), "", -1);
-
+void LuaApi::AddLuaStateValues(Serializer& s) {
 	// Add some more Lua-specific values
 	uint32_t frameCount = _emu->GetFrameCount();
 	uint32_t masterClock = _emu->GetMasterClock();
@@ -1081,31 +1403,182 @@ int LuaApi::GetState(lua_State* lua) {
 	SV(region);
 	SV(frameCount);
 	SV(masterClock);
+}
+
+void LuaApi::PushStateValue(lua_State* lua, SerializeMapValue& value) {
+	switch (value.Format) {
+		case SerializeMapValueFormat::Integer:
+			lua_pushinteger(lua, value.Value.Integer);
+			break;
+		case SerializeMapValueFormat::Double:
+			lua_pushnumber(lua, value.Value.Double);
+			break;
+		case SerializeMapValueFormat::Bool:
+			lua_pushboolean(lua, value.Value.Bool);
+			break;
+		case SerializeMapValueFormat::String:
+			lua_pushlstring(lua, value.StringValue.c_str(), value.StringValue.size());
+			break;
+	}
+}
+
+unordered_map<string, SerializeMapValueFormat>& LuaApi::GetStateSchema() {
+	unordered_map<string, SerializeMapValueFormat>& schema = _context->GetStateSchema();
+	if (schema.empty()) {
+		// The keys only depend on the console and its cartridge, they are listed once with a full serialization
+		Serializer s(0, true, SerializeFormat::Map);
+		s.Stream(*_emu->GetConsole().get(), "", -1);
+		AddLuaStateValues(s);
+		for (auto& kvp : s.GetMapValues()) {
+			schema[kvp.first] = kvp.second.Format;
+		}
+	}
+	return schema;
+}
+
+int LuaApi::GetState(lua_State* lua) {
+	LuaCallHelper l(lua);
+	checkparams();
+
+	Serializer s(0, true, SerializeFormat::Map);
+	s.Stream(*_emu->GetConsole().get(), "", -1);
+	AddLuaStateValues(s);
 
 	unordered_map<string, SerializeMapValue>& values = s.GetMapValues();
 
 	lua_newtable(lua);
 	for (auto& kvp : values) {
 		lua_pushlstring(lua, kvp.first.c_str(), kvp.first.size());
-		switch (kvp.second.Format) {
-			case SerializeMapValueFormat::Integer:
-				lua_pushinteger(lua, kvp.second.Value.Integer);
-				break;
-			case SerializeMapValueFormat::Double:
-				lua_pushnumber(lua, kvp.second.Value.Double);
-				break;
-			case SerializeMapValueFormat::Bool:
-				lua_pushboolean(lua, kvp.second.Value.Bool);
-				break;
-			case SerializeMapValueFormat::String:
-				lua_pushlstring(lua, kvp.second.StringValue.c_str(), kvp.second.StringValue.size());
-				break;
-		}
+		PushStateValue(lua, kvp.second);
 		lua_settable(lua, -3);
 	}
 	return 1;
 }
 
+int LuaApi::GetStateValue(lua_State* lua) {
+	lua_settop(lua, 1);
+	bool isTable = lua_istable(lua, 1);
+	errorCond(!isTable && lua_type(lua, 1) != LUA_TSTRING, "key must be a string or an array of strings");
+	int count = isTable ? (int)luaL_len(lua, 1) : 1;
+	for (int i = 1; isTable && i <= count; i++) {
+		lua_rawgeti(lua, 1, i);
+		errorCond(lua_type(lua, -1) != LUA_TSTRING, "keys must be strings");
+		lua_pop(lua, 1);
+	}
+
+	// Validate the keys before streaming anything, luaL_error doesn't unwind the C++ stack
+	const char* unknownKey = nullptr;
+	{
+		vector<string> keys;
+		for (int i = 1; i <= count; i++) {
+			if (isTable) {
+				lua_rawgeti(lua, 1, i);
+			} else {
+				lua_pushvalue(lua, 1);
+			}
+			size_t len = 0;
+			const char* name = lua_tolstring(lua, -1, &len);
+			keys.emplace_back(name, len);
+			lua_pop(lua, 1);
+			if (!unknownKey && !GetStateSchema().contains(keys.back())) {
+				// The string is still referenced by the key table/parameter after the pop
+				unknownKey = name;
+			}
+		}
+
+		if (!unknownKey) {
+			// Only the objects that contain the requested keys are serialized
+			Serializer s(0, true, SerializeFormat::Map);
+			s.SetKeyFilter(keys);
+			s.Stream(*_emu->GetConsole().get(), "", -1);
+			AddLuaStateValues(s);
+
+			unordered_map<string, SerializeMapValue>& values = s.GetMapValues();
+			if (isTable) {
+				lua_newtable(lua);
+			}
+			for (string& key : keys) {
+				auto result = values.find(key);
+				if (isTable) {
+					lua_pushlstring(lua, key.c_str(), key.size());
+				}
+				if (result != values.end()) {
+					PushStateValue(lua, result->second);
+				} else {
+					lua_pushnil(lua);
+				}
+				if (isTable) {
+					lua_settable(lua, -3);
+				}
+			}
+		}
+	}
+
+	if (unknownKey) {
+		return luaL_error(lua, "unknown state key: %s", unknownKey);
+	}
+	return 1;
+}
+
+int LuaApi::SetStateValue(lua_State* lua) {
+	lua_settop(lua, 2);
+	const char* name = luaL_checkstring(lua, 1);
+	int valueType = lua_type(lua, 2);
+	errorCond(valueType != LUA_TBOOLEAN && valueType != LUA_TNUMBER, "value must be a boolean or a number");
+
+	// Validate before returning an error, luaL_error doesn't unwind the C++ stack
+	const char* errorMsg = nullptr;
+	{
+		string key = name;
+		auto& schema = GetStateSchema();
+		auto entry = schema.find(key);
+		if (entry == schema.end()) {
+			errorMsg = "unknown state key";
+		} else {
+			unordered_map<string, SerializeMapValue> map;
+			if (entry->second == SerializeMapValueFormat::Bool && valueType == LUA_TBOOLEAN) {
+				map.try_emplace(key, SerializeMapValueFormat::Bool, (bool)lua_toboolean(lua, 2));
+			} else if (entry->second == SerializeMapValueFormat::Integer && lua_isinteger(lua, 2)) {
+				map.try_emplace(key, SerializeMapValueFormat::Integer, (int64_t)lua_tointeger(lua, 2));
+			} else if (entry->second == SerializeMapValueFormat::Double && valueType == LUA_TNUMBER) {
+				map.try_emplace(key, SerializeMapValueFormat::Double, (double)lua_tonumber(lua, 2));
+			} else {
+				errorMsg = "value type doesn't match the type of state key";
+			}
+
+			if (!errorMsg) {
+				Serializer s(0, false, SerializeFormat::Map);
+				s.SetKeyFilter({key});
+				s.LoadFromMap(map);
+				s.Stream(*_emu->GetConsole().get(), "", -1);
+			}
+		}
+	}
+
+	if (errorMsg) {
+		return luaL_error(lua, "%s: %s", errorMsg, name);
+	}
+	return 0;
+}
+
+int LuaApi::GetStateKeys(lua_State* lua) {
+	LuaCallHelper l(lua);
+	checkparams();
+
+	vector<const string*> keys;
+	for (auto& kvp : GetStateSchema()) {
+		keys.push_back(&kvp.first);
+	}
+	std::sort(keys.begin(), keys.end(), [](const string* a, const string* b) { return *a < *b; });
+
+	lua_newtable(lua);
+	for (size_t i = 0; i < keys.size(); i++) {
+		lua_pushlstring(lua, keys[i]->c_str(), keys[i]->size());
+		lua_rawseti(lua, -2, (lua_Integer)i + 1);
+	}
+	return 1;
+}
+
 int LuaApi::SetState(lua_State* lua) {
 	lua_settop(lua, 1);
 	luaL_checktype(lua, -1, LUA_TTABLE);
@@ -11,6 +11,9 @@ class Emulator;
 class MemoryDumper;
 class DebugHud;
 class BaseVideoFilter;
+class Serializer;
+struct SerializeMapValue;
+enum class SerializeMapValueFormat;
 
 class LuaApi {
 public:
@@ -31,12 +34,16 @@ public:
 	static int WriteMemory16(lua_State* lua);
 	static int ReadMemory32(lua_State* lua);
 	static int WriteMemory32(lua_State* lua);
+	static int ReadMemoryRange(lua_State* lua);
+	static int WriteMemoryRange(lua_State* lua);
 
 	static int GetLabelAddress(lua_State* lua);
 	static int ConvertAddress(lua_State* lua);
 
 	static int RegisterMemoryCallback(lua_State* lua);
 	static int UnregisterMemoryCallback(lua_State* lua);
+	static int RegisterDmaCallback(lua_State* lua);
+	static int UnregisterDmaCallback(lua_State* lua);
 	static int RegisterEventCallback(lua_State* lua);
 	static int UnregisterEventCallback(lua_State* lua);
 
@@ -46,6 +53,8 @@ public:
 	static int DrawLine(lua_State* lua);
 	static int DrawPixel(lua_State* lua);
 	static int DrawRectangle(lua_State* lua);
+	static int DrawPixels(lua_State* lua);
+	static int DrawRectangles(lua_State* lua);
 	static int ClearScreen(lua_State* lua);
 
 	static int GetScreenSize(lua_State* lua);
@@ -85,19 +94,37 @@ public:
 
 	static int SetState(lua_State* lua);
 	static int GetState(lua_State* lua);
+	static int GetStateValue(lua_State* lua);
+	static int SetStateValue(lua_State* lua);
+	static int GetStateKeys(lua_State* lua);
 
 	static int GetAccessCounters(lua_State* lua);
 	static int ResetAccessCounters(lua_State* lua);
 
 	static int GetCdlData(lua_State* lua);
 
+	static int EnableAsyncFrames(lua_State* lua);
+
+	static int OpenSocket(lua_State* lua);
+	static int SendSocket(lua_State* lua);
+	static int CloseSocket(lua_State* lua);
+
 private:
 	static FrameInfo InternalGetScreenSize();
+	static int AsyncUnavailable(lua_State* lua);
+
+	/// <summary>True when reads must use the async frame snapshots (async frames enabled and script loaded)</summary>
+	static bool IsReadingSnapshots();
+
+	// Thread local, a script's async frame callbacks run on its worker thread (see ScriptingContext::EnableAsyncMode)
+	static thread_local Emulator* _emu;
+	static thread_local Debugger* _debugger;
+	static thread_local MemoryDumper* _memoryDumper;
+	static thread_local ScriptingContext* _context;
 
-	static Emulator* _emu;
-	static Debugger* _debugger;
-	static MemoryDumper* _memoryDumper;
-	static ScriptingContext* _context;
+	static unordered_map<string, SerializeMapValueFormat>& GetStateSchema();
+	static void AddLuaStateValues(Serializer& s);
+	static void PushStateValue(lua_State* lua, SerializeMapValue& value);
 
 	static std::pair<unique_ptr<BaseVideoFilter>, FrameInfo> GetRenderedFrame();
 	template <typename T>
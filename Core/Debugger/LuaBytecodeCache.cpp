@@ -0,0 +1,132 @@
+#include "pch.h"
+#include <filesystem>
+#include "Lua/lua.hpp"
+#include "Debugger/LuaBytecodeCache.h"
+#include "Utilities/FolderUtilities.h"
+#include "Utilities/PathUtil.h"
+#include "Utilities/sha1.h"
+
+namespace fs = std::filesystem;
+
+string LuaBytecodeCache::GetCacheFolder() {
+	return FolderUtilities::CombinePath(FolderUtilities::CombinePath(FolderUtilities::GetHomeFolder(), "LuaScriptData"), "BytecodeCache");
+}
+
+static void CreateCacheFolder(const string& cacheFolder) {
+	FolderUtilities::CreateFolder(FolderUtilities::GetFolderName(cacheFolder));
+	FolderUtilities::CreateFolder(cacheFolder);
+}
+
+string LuaBytecodeCache::GetCacheFilename(const string& content, const string& chunkName) {
+	SHA1 sha;
+	sha.update(LUA_RELEASE);
+	sha.update(std::to_string(sizeof(void*)));
+	sha.update(chunkName);
+	sha.update(string(1, '\0'));
+	sha.update(content);
+	return FolderUtilities::CombinePath(GetCacheFolder(), sha.final() + ".luac");
+}
+
+static bool ReadFile(const string& filename, string& output) {
+	std::ifstream file(PathUtil::FromUtf8(filename), std::ios::in | std::ios::binary);
+	if (!file) {
+		return false;
+	}
+	output.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	return !file.bad();
+}
+
+static int WriteChunk(lua_State*, const void* data, size_t size, void* userData) {
+	((string*)userData)->append((const char*)data, size);
+	return 0;
+}
+
+int LuaBytecodeCache::Load(lua_State* lua, const string& content, const string& chunkName) {
+	string cacheFile = GetCacheFilename(content, chunkName);
+
+	string bytecode;
+	if (ReadFile(cacheFile, bytecode)) {
+		if (luaL_loadbufferx(lua, bytecode.data(), bytecode.size(), chunkName.c_str(), "b") == LUA_OK) {
+			return LUA_OK;
+		}
+		// Corrupted or truncated cache file, compile the source again (and overwrite the file)
+		lua_pop(lua, 1);
+	}
+
+	int result = luaL_loadbufferx(lua, content.c_str(), content.size(), chunkName.c_str(), "t");
+	if (result != LUA_OK) {
+		return result;
+	}
+
+	bytecode.clear();
+	if (lua_dump(lua, WriteChunk, &bytecode, 0) == 0 && !bytecode.empty()) {
+		// Write to a temporary file first, so another instance never reads a partial chunk
+		CreateCacheFolder(GetCacheFolder());
+		string tmpFile = cacheFile + ".tmp";
+		bool written = false;
+		{
+			std::ofstream file(PathUtil::FromUtf8(tmpFile), std::ios::out | std::ios::binary | std::ios::trunc);
+			if (file) {
+				file.write(bytecode.data(), bytecode.size());
+				written = file.good();
+			}
+		}
+
+		std::error_code err;
+		if (written) {
+			fs::rename(PathUtil::FromUtf8(tmpFile), PathUtil::FromUtf8(cacheFile), err);
+		}
+		if (!written || err) {
+			fs::remove(PathUtil::FromUtf8(tmpFile), err);
+		}
+	}
+	return LUA_OK;
+}
+
+int LuaBytecodeCache::SearchModule(lua_State* lua) {
+	// Same behavior as the package library's searcher_Lua, with Load() instead of luaL_loadfile
+	const char* name = luaL_checkstring(lua, 1);
+	lua_getglobal(lua, "package");
+	lua_getfield(lua, -1, "searchpath");
+	lua_pushstring(lua, name);
+	lua_getfield(lua, -3, "path");
+	lua_call(lua, 2, 2);
+	if (lua_isnil(lua, -2)) {
+		// Not found, return the list of files that were tried
+		return 1;
+	}
+
+	{
+		// luaL_error doesn't unwind the C++ stack, the error is raised once the strings are destroyed
+		string filename = lua_tostring(lua, -2);
+		string content;
+		if (!ReadFile(filename, content)) {
+			lua_pushfstring(lua, "error loading module '%s' from file '%s':\n\tcannot read file", name, filename.c_str());
+		} else {
+			// Skip the first line if it is a comment (e.g "#!/usr/bin/lua"), like luaL_loadfile
+			if (content[0] == '#') {
+				content.erase(0, std::min(content.find('\n'), content.size()));
+			}
+
+			if (Load(lua, content, "@" + filename) == LUA_OK) {
+				lua_pushstring(lua, filename.c_str());
+				return 2;
+			}
+			lua_pushfstring(lua, "error loading module '%s' from file '%s':\n\t%s", name, filename.c_str(), lua_tostring(lua, -1));
+		}
+	}
+	return lua_error(lua);
+}
+
+void LuaBytecodeCache::InstallModuleSearcher(lua_State* lua) {
+	lua_getglobal(lua, "package");
+	if (lua_istable(lua, -1)) {
+		lua_getfield(lua, -1, "searchers");
+		if (lua_istable(lua, -1)) {
+			lua_pushcfunction(lua, LuaBytecodeCache::SearchModule);
+			lua_rawseti(lua, -2, 2);
+		}
+		lua_pop(lua, 1);
+	}
+	lua_pop(lua, 1);
+}
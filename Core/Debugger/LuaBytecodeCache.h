@@ -0,0 +1,36 @@
+#pragma once
+#include "pch.h"
+
+struct lua_State;
+
+/// <summary>
+/// Loads Lua chunks through an on-disk cache of precompiled bytecode.
+/// </summary>
+/// <remarks>
+/// Cache files are named after the SHA-1 of the source code, the chunk name and the Lua version, so modified
+/// scripts (or another Lua build) never load a stale chunk: they are compiled again and the new bytecode is cached.
+/// Chunks are dumped with their debug information, so error messages and stack traces are the same as with
+/// the source code.
+///
+/// Load() is used for the main script, and InstallModuleSearcher() replaces the package library's Lua file
+/// searcher so require()'d modules go through the cache too. Any I/O error falls back to compiling the source.
+/// </remarks>
+class LuaBytecodeCache {
+private:
+	static string GetCacheFolder();
+	static string GetCacheFilename(const string& content, const string& chunkName);
+	static int SearchModule(lua_State* lua);
+
+public:
+	/// <summary>
+	/// Loads a chunk (like luaL_loadbufferx), from the bytecode cache when the same source was compiled before.
+	/// </summary>
+	/// <returns>A Lua status code, with the chunk (or the error message) pushed on the stack</returns>
+	static int Load(lua_State* lua, const string& content, const string& chunkName);
+
+	/// <summary>
+	/// Replaces package.searchers[2] (Lua files) with a searcher that loads the modules through the cache.
+	/// </summary>
+	/// <remarks>The package library must be loaded (the stack is unchanged).</remarks>
+	static void InstallModuleSearcher(lua_State* lua);
+};
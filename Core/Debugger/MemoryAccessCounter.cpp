@@ -15,7 +15,7 @@ MemoryAccessCounter::MemoryAccessCounter(Debugger* debugger) {
 	for (int i = (int)DebugUtilities::GetLastCpuMemoryType() + 1; i < DebugUtilities::GetMemoryTypeCount(); i++) {
 		uint32_t memSize = _debugger->GetMemoryDumper()->GetMemorySize((MemoryType)i);
 		if (memSize > 0) {
-			_counters[i] = vector<AddressCounters>(memSize);
+			_counters[i].Init(memSize);
 		}
 	}
 }
@@ -28,7 +28,7 @@ ReadResult MemoryAccessCounter::ProcessMemoryRead(AddressInfo& addressInfo, uint
 
 	ReadResult result = ReadResult::Normal;
 	for (int i = 0; i < accessWidth; i++) {
-		AddressCounters& counts = _counters[(int)addressInfo.Type][addressInfo.Address + i];
+		AddressCounters& counts = _counters[(int)addressInfo.Type].Get(addressInfo.Address + i);
 		if (_enableBreakOnUninitRead && counts.WriteStamp == 0 && DebugUtilities::IsVolatileRam(addressInfo.Type)) [[unlikely]] {
 			result = (ReadResult)((int)result | (int)(counts.ReadStamp == 0 ? ReadResult::FirstUninitRead : ReadResult::UninitRead));
 		}
@@ -45,7 +45,7 @@ void MemoryAccessCounter::ProcessMemoryWrite(AddressInfo& addressInfo, uint64_t
 	}
 
 	for (int i = 0; i < accessWidth; i++) {
-		AddressCounters& counts = _counters[(int)addressInfo.Type][addressInfo.Address + i];
+		AddressCounters& counts = _counters[(int)addressInfo.Type].Get(addressInfo.Address + i);
 		counts.WriteStamp = masterClock;
 		counts.WriteCounter++;
 	}
@@ -58,7 +58,7 @@ void MemoryAccessCounter::ProcessMemoryExec(AddressInfo& addressInfo, uint64_t m
 	}
 
 	for (int i = 0; i < accessWidth; i++) {
-		AddressCounters& counts = _counters[(int)addressInfo.Type][addressInfo.Address + i];
+		AddressCounters& counts = _counters[(int)addressInfo.Type].Get(addressInfo.Address + i);
 		counts.ExecStamp = masterClock;
 		counts.ExecCounter++;
 	}
@@ -67,7 +67,7 @@ void MemoryAccessCounter::ProcessMemoryExec(AddressInfo& addressInfo, uint64_t m
 void MemoryAccessCounter::ResetCounts() {
 	DebugBreakHelper helper(_debugger);
 	for (int i = 0; i < DebugUtilities::GetMemoryTypeCount(); i++) {
-		memset(_counters[i].data(), 0, _counters[i].size() * sizeof(AddressCounters));
+		_counters[i].Reset();
 	}
 	_enableBreakOnUninitRead = _debugger->GetConsole()->GetMasterClock() < 1000;
 }
@@ -80,16 +80,24 @@ void MemoryAccessCounter::GetAccessCounts(uint32_t offset, uint32_t length, Memo
 			addr.Address = offset + i;
 			AddressInfo info = _debugger->GetAbsoluteAddress(addr);
 			if (info.Address >= 0) {
-				counts[i] = _counters[(int)info.Type][info.Address];
+				counts[i] = _counters[(int)info.Type].Peek(info.Address);
 			}
 		}
 	} else {
-		if (offset + length <= _counters[(int)memoryType].size()) {
-			memcpy(counts, _counters[(int)memoryType].data() + offset, length * sizeof(AddressCounters));
+		if (offset + length <= _counters[(int)memoryType].GetSize()) {
+			_counters[(int)memoryType].CopyRange(offset, length, counts);
 		}
 	}
 }
 
+uint64_t MemoryAccessCounter::GetMemoryUsage() {
+	uint64_t size = 0;
+	for (int i = 0; i < DebugUtilities::GetMemoryTypeCount(); i++) {
+		size += _counters[i].GetMemoryUsage();
+	}
+	return size;
+}
+
 template ReadResult MemoryAccessCounter::ProcessMemoryRead<1>(AddressInfo& addressInfo, uint64_t masterClock);
 template ReadResult MemoryAccessCounter::ProcessMemoryRead<2>(AddressInfo& addressInfo, uint64_t masterClock);
 template ReadResult MemoryAccessCounter::ProcessMemoryRead<4>(AddressInfo& addressInfo, uint64_t masterClock);
@@ -1,5 +1,6 @@
 #pragma once
 #include "pch.h"
+#include "Debugger/AccessCounterPages.h"
 #include "Debugger/DebugTypes.h"
 #include "Debugger/DebugUtilities.h"
 #include "Shared/MemoryType.h"
@@ -13,18 +14,6 @@ class Gsu;
 class Cx4;
 class Gameboy;
 
-/// <summary>
-/// Access counters and timestamps for a memory address.
-/// </summary>
-struct AddressCounters {
-	uint64_t ReadStamp;    ///< Last read timestamp (master clock)
-	uint64_t WriteStamp;   ///< Last write timestamp (master clock)
-	uint64_t ExecStamp;    ///< Last execute timestamp (master clock)
-	uint32_t ReadCounter;  ///< Total read count
-	uint32_t WriteCounter; ///< Total write count
-	uint32_t ExecCounter;  ///< Total execute count
-};
-
 /// <summary>
 /// Result of memory read operation.
 /// </summary>
@@ -55,9 +44,8 @@ enum class ReadResult {
 /// - _enableBreakOnUninitRead: Break on first uninit read
 ///
 /// Data structure:
-/// - _counters[memType][address]: AddressCounters for each byte
-/// - One vector per memory type (ROM, RAM, VRAM, etc.)
-/// - Memory allocated on demand
+/// - _counters[memType]: AddressCounters for each byte, one AccessCounterPages per memory type (ROM, RAM, VRAM, etc.)
+/// - Memory allocated on demand, in 4KB pages (only the parts of each memory type that are accessed use memory)
 ///
 /// Template ProcessMemory functions:
 /// - accessWidth: 1/2/4 bytes (compile-time optimization)
@@ -71,7 +59,7 @@ enum class ReadResult {
 /// </remarks>
 class MemoryAccessCounter {
 private:
-	vector<AddressCounters> _counters[DebugUtilities::GetMemoryTypeCount()]; ///< Access counters per memory type
+	AccessCounterPages _counters[DebugUtilities::GetMemoryTypeCount()]; ///< Access counters per memory type
 
 	Debugger* _debugger = nullptr;         ///< Main debugger instance
 	bool _enableBreakOnUninitRead = false; ///< Break on uninitialized read
@@ -130,4 +118,7 @@ public:
 	/// <param name="memoryType">Memory type</param>
 	/// <param name="counts">Output counters array (must be length elements)</param>
 	void GetAccessCounts(uint32_t offset, uint32_t length, MemoryType memoryType, AddressCounters counts[]);
+
+	/// <summary>Memory used by the counters of all memory types (allocated pages only), in bytes</summary>
+	[[nodiscard]] uint64_t GetMemoryUsage();
 };
\ No newline at end of file
@@ -0,0 +1,84 @@
+#pragma once
+#include "pch.h"
+#include "Debugger/DebugTypes.h"
+
+/// <summary>
+/// Merged address ranges of the script memory callbacks of one CPU and callback type, across all scripts.
+/// </summary>
+/// <remarks>
+/// ScriptManager checks the relative address of every memory operation against this index before dispatching it
+/// to the scripts, so accesses outside of the watched ranges no longer loop over every script and callback.
+///
+/// Ranges are sorted by memory type and start address, and overlapping/adjacent ranges are merged, so a lookup is
+/// a binary search (a single compare for the common case of one watched range). Callbacks on absolute memory
+/// (e.g PRG ROM) can't be checked against the relative address, they make the index match every address.
+///
+/// Only updated when callbacks are registered/unregistered (on the emulation thread, or while it is paused).
+/// </remarks>
+class MemoryCallbackIndex {
+private:
+	struct Range {
+		MemoryType MemType;
+		uint32_t Start;
+		uint32_t End;
+	};
+
+	vector<Range> _ranges;
+	bool _matchAll = false;
+
+	[[nodiscard]] static bool IsBefore(const Range& a, MemoryType memType, uint32_t addr) {
+		return a.MemType < memType || (a.MemType == memType && a.End < addr);
+	}
+
+public:
+	/// <summary>Removes all ranges</summary>
+	void Clear() {
+		_ranges.clear();
+		_matchAll = false;
+	}
+
+	/// <summary>Makes the index match every address (callbacks that can't be filtered by relative address)</summary>
+	void AddAll() {
+		_matchAll = true;
+	}
+
+	/// <summary>Adds [start, end] for the given (relative) memory type, merging it with the existing ranges</summary>
+	void AddRange(MemoryType memType, uint32_t start, uint32_t end) {
+		// First range that ends at or after start - 1 (i.e could be merged with the new range)
+		uint32_t mergeStart = start > 0 ? start - 1 : 0;
+		auto it = std::lower_bound(_ranges.begin(), _ranges.end(), 0, [=](const Range& r, int) {
+			return IsBefore(r, memType, mergeStart);
+		});
+
+		Range range = {memType, start, end};
+		auto last = it;
+		while (last != _ranges.end() && last->MemType == memType && (end == UINT32_MAX || last->Start <= end + 1)) {
+			range.Start = std::min(range.Start, last->Start);
+			range.End = std::max(range.End, last->End);
+			last++;
+		}
+		it = _ranges.erase(it, last);
+		_ranges.insert(it, range);
+	}
+
+	[[nodiscard]] bool IsEmpty() const { return !_matchAll && _ranges.empty(); }
+	[[nodiscard]] uint32_t GetRangeCount() const { return (uint32_t)_ranges.size(); }
+
+	/// <summary>Returns true if a callback may be registered for this address</summary>
+	__forceinline bool Contains(AddressInfo addr) const {
+		if (_matchAll) {
+			return true;
+		}
+
+		uint32_t address = (uint32_t)addr.Address;
+		if (_ranges.size() == 1) {
+			const Range& r = _ranges[0];
+			return r.MemType == addr.Type && address >= r.Start && address <= r.End;
+		}
+
+		auto it = std::lower_bound(_ranges.begin(), _ranges.end(), 0, [=](const Range& r, int) {
+			return IsBefore(r, addr.Type, address);
+		});
+		return it != _ranges.end() && it->MemType == addr.Type && address >= it->Start;
+	}
+};
@@ -71,8 +71,9 @@ void MemoryDumper::SetMemoryState(MemoryType type, uint8_t* buffer, uint32_t len
 	}
 
 	uint8_t* dst = GetMemoryBuffer(type);
-	if (dst) {
+	if (dst && !_emu->GetMemory(type).Shared) {
 		memcpy(dst, buffer, length);
+		_debugger->GetDisassembler()->OnMemoryChanged(type);
 	}
 }
 
@@ -332,7 +333,7 @@ void MemoryDumper::InternalSetMemoryValues(MemoryType originalMemoryType, uint32
 
 			default:
 				uint8_t* src = GetMemoryBuffer(memoryType);
-				if (src) {
+				if (src && !_emu->GetMemory(memoryType).Shared) {
 					if (undoAllowed) {
 						if (undoEntry.MemType != memoryType) {
 							if (undoEntry.OriginalData.size() > 0) {
@@ -393,15 +394,28 @@ void MemoryDumper::SetMemoryValues(MemoryType memoryType, uint32_t address, uint
 	InternalSetMemoryValues(memoryType, address, data, length, true, true);
 }
 
+void MemoryDumper::SetMemoryValues(MemoryType memoryType, uint32_t address, uint8_t* data, uint32_t length, bool disableSideEffects) {
+	InternalSetMemoryValues(memoryType, address, data, length, disableSideEffects, true);
+}
+
 void MemoryDumper::SetMemoryValue(MemoryType memoryType, uint32_t address, uint8_t value, bool disableSideEffects) {
 	InternalSetMemoryValues(memoryType, address, &value, 1, disableSideEffects, true);
 }
 
 void MemoryDumper::GetMemoryValues(MemoryType memoryType, uint32_t start, uint32_t end, uint8_t* output) {
-	int x = 0;
+	uint32_t x = 0;
 	uint32_t size = GetMemorySize(memoryType);
-	for (uint32_t i = start; i <= end && i < size; i++) {
-		output[x++] = InternalGetMemoryValue(memoryType, i);
+	ConsoleMemoryInfo memInfo = IsDirectMemory(memoryType) ? _emu->GetMemory(memoryType) : ConsoleMemoryInfo{};
+	if (memInfo.Memory && memInfo.Size >= size) {
+		// Plain memory buffer, copy the range instead of reading it byte by byte
+		if (start < size) {
+			x = std::min(end, size - 1) - start + 1;
+			memcpy(output, (uint8_t*)memInfo.Memory + start, x);
+		}
+	} else {
+		for (uint32_t i = start; i <= end && i < size; i++) {
+			output[x++] = InternalGetMemoryValue(memoryType, i);
+		}
 	}
 
 	if (end >= size) {
@@ -409,6 +423,11 @@ void MemoryDumper::GetMemoryValues(MemoryType memoryType, uint32_t start, uint32
 	}
 }
 
+bool MemoryDumper::IsDirectMemory(MemoryType memoryType) {
+	// Same as the default case of InternalGetMemoryValue
+	return !DebugUtilities::IsRelativeMemory(memoryType) && memoryType != MemoryType::SmsPort && memoryType != MemoryType::WsPort;
+}
+
 uint8_t MemoryDumper::GetMemoryValue(MemoryType memoryType, uint32_t address, bool disableSideEffects) {
 	if (address >= GetMemorySize(memoryType)) {
 		return 0;
@@ -101,6 +101,13 @@ private:
 	/// <returns>Byte value</returns>
 	uint8_t InternalGetMemoryValue(MemoryType memoryType, uint32_t address, bool disableSideEffects = true);
 
+	/// <summary>
+	/// Check if the memory type is read straight from its buffer (not a CPU address space or I/O ports).
+	/// </summary>
+	/// <param name="memoryType">Memory type</param>
+	/// <returns>True if the memory buffer from Emulator::GetMemory() holds the memory's content</returns>
+	static bool IsDirectMemory(MemoryType memoryType);
+
 	/// <summary>
 	/// Internal memory write (platform-specific).
 	/// </summary>
@@ -212,6 +219,16 @@ public:
 	/// <param name="length">Data length</param>
 	void SetMemoryValues(MemoryType memoryType, uint32_t address, uint8_t* data, uint32_t length);
 
+	/// <summary>
+	/// Write byte array to memory from the emulation thread (e.g scripts), as a single undo entry.
+	/// </summary>
+	/// <param name="memoryType">Memory type</param>
+	/// <param name="address">Start address</param>
+	/// <param name="data">Data to write</param>
+	/// <param name="length">Data length</param>
+	/// <param name="disableSideEffects">True to write without side effects</param>
+	void SetMemoryValues(MemoryType memoryType, uint32_t address, uint8_t* data, uint32_t length, bool disableSideEffects);
+
 	/// <summary>
 	/// Set entire memory state (copy from buffer).
 	/// </summary>
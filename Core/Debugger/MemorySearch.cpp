@@ -0,0 +1,280 @@
+#include "pch.h"
+#include <bit>
+#include <cstring>
+#include "Debugger/MemorySearch.h"
+#include "Debugger/MemoryDumper.h"
+
+namespace {
+	template <MemorySearchOperator op>
+	__forceinline bool Compare(int64_t value, int64_t compareValue) {
+		if constexpr (op == MemorySearchOperator::Equal) {
+			return value == compareValue;
+		} else if constexpr (op == MemorySearchOperator::NotEqual) {
+			return value != compareValue;
+		} else if constexpr (op == MemorySearchOperator::LessThan) {
+			return value < compareValue;
+		} else if constexpr (op == MemorySearchOperator::GreaterThan) {
+			return value > compareValue;
+		} else if constexpr (op == MemorySearchOperator::LessThanOrEqual) {
+			return value <= compareValue;
+		} else {
+			return value >= compareValue;
+		}
+	}
+
+	/// <summary>Value at an address, with the bytes past the end of memory read as 0</summary>
+	template <typename T>
+	int64_t ReadValue(const uint8_t* mem, size_t size, size_t addr) {
+		if (addr + sizeof(T) <= size) {
+			T value;
+			memcpy(&value, mem + addr, sizeof(T));
+			return (int64_t)value;
+		}
+
+		std::make_unsigned_t<T> value = 0;
+		for (size_t i = 0; i < sizeof(T) && addr + i < size; i++) {
+			value |= (std::make_unsigned_t<T>)mem[addr + i] << (i * 8);
+		}
+		return (int64_t)(T)value;
+	}
+
+	/// <summary>Clears the candidates that don't match (compareMem = null to compare against a fixed value)</summary>
+	template <typename T, MemorySearchOperator op, bool useValue>
+	uint32_t FilterCandidates(uint64_t* candidates, const uint8_t* mem, const uint8_t* compareMem, size_t size, int64_t compareValue) {
+		uint32_t count = 0;
+		size_t wordCount = (size + 63) / 64;
+		for (size_t w = 0; w < wordCount; w++) {
+			uint64_t word = candidates[w];
+			if (word == 0) {
+				continue;
+			}
+
+			size_t base = w * 64;
+			uint64_t matches = 0;
+			if (base + 64 + sizeof(T) - 1 <= size) {
+				// Fast path: every value of the block is in range
+				for (size_t i = 0; i < 64; i++) {
+					T value;
+					memcpy(&value, mem + base + i, sizeof(T));
+					int64_t cmp = compareValue;
+					if constexpr (!useValue) {
+						T prev;
+						memcpy(&prev, compareMem + base + i, sizeof(T));
+						cmp = (int64_t)prev;
+					}
+					matches |= (uint64_t)Compare<op>((int64_t)value, cmp) << i;
+				}
+			} else {
+				for (size_t i = 0; i < 64 && base + i < size; i++) {
+					int64_t cmp = useValue ? compareValue : ReadValue<T>(compareMem, size, base + i);
+					matches |= (uint64_t)Compare<op>(ReadValue<T>(mem, size, base + i), cmp) << i;
+				}
+			}
+
+			word &= matches;
+			candidates[w] = word;
+			count += std::popcount(word);
+		}
+		return count;
+	}
+
+	template <typename T>
+	uint32_t FilterCandidates(MemorySearchOperator op, uint64_t* candidates, const uint8_t* mem, const uint8_t* compareMem, size_t size, int64_t compareValue) {
+		auto filter = [&]<MemorySearchOperator o>() {
+			return compareMem ? FilterCandidates<T, o, false>(candidates, mem, compareMem, size, 0) : FilterCandidates<T, o, true>(candidates, mem, nullptr, size, compareValue);
+		};
+
+		switch (op) {
+			default:
+			case MemorySearchOperator::Equal: return filter.template operator()<MemorySearchOperator::Equal>();
+			case MemorySearchOperator::NotEqual: return filter.template operator()<MemorySearchOperator::NotEqual>();
+			case MemorySearchOperator::LessThan: return filter.template operator()<MemorySearchOperator::LessThan>();
+			case MemorySearchOperator::GreaterThan: return filter.template operator()<MemorySearchOperator::GreaterThan>();
+			case MemorySearchOperator::LessThanOrEqual: return filter.template operator()<MemorySearchOperator::LessThanOrEqual>();
+			case MemorySearchOperator::GreaterThanOrEqual: return filter.template operator()<MemorySearchOperator::GreaterThanOrEqual>();
+		}
+	}
+
+	template <typename T>
+	uint32_t ApplyFilter(const MemorySearchFilter& filter, uint64_t* candidates, const vector<uint8_t>& current, const vector<uint8_t>& prevRefresh, const vector<uint8_t>& lastSearch) {
+		switch (filter.CompareTo) {
+			default:
+			case MemorySearchCompareTo::PreviousSearchValue:
+				return FilterCandidates<T>(filter.Operator, candidates, current.data(), lastSearch.data(), current.size(), 0);
+
+			case MemorySearchCompareTo::PreviousRefreshValue:
+				return FilterCandidates<T>(filter.Operator, candidates, current.data(), prevRefresh.data(), current.size(), 0);
+
+			case MemorySearchCompareTo::SpecificValue:
+				return FilterCandidates<T>(filter.Operator, candidates, current.data(), nullptr, current.size(), filter.SpecificValue);
+
+			case MemorySearchCompareTo::SpecificAddress:
+				return FilterCandidates<T>(filter.Operator, candidates, current.data(), nullptr, current.size(), ReadValue<T>(current.data(), current.size(), filter.SpecificAddress));
+		}
+	}
+}
+
+MemorySearch::MemorySearch(MemoryDumper* memoryDumper) {
+	_memoryDumper = memoryDumper;
+}
+
+void MemorySearch::ReadMemory(vector<uint8_t>& dst) {
+	dst.resize(_memoryDumper->GetMemorySize(_memType));
+	if (!dst.empty()) {
+		_memoryDumper->GetMemoryState(_memType, dst.data());
+	}
+}
+
+void MemorySearch::Reset(MemoryType memType) {
+	std::lock_guard<std::mutex> lock(_lock);
+	_memType = memType;
+	vector<uint8_t> memory;
+	ReadMemory(memory);
+	InternalReset(memType, memory);
+}
+
+void MemorySearch::Reset(MemoryType memType, std::span<const uint8_t> memory) {
+	std::lock_guard<std::mutex> lock(_lock);
+	InternalReset(memType, memory);
+}
+
+void MemorySearch::InternalReset(MemoryType memType, std::span<const uint8_t> memory) {
+	_memType = memType;
+	_current.assign(memory.begin(), memory.end());
+	_prevRefresh = _current;
+	_lastSearch = _current;
+
+	size_t size = _current.size();
+	_candidates.assign((size + 63) / 64, ~0ULL);
+	if (size & 0x3F) {
+		_candidates.back() = (1ULL << (size & 0x3F)) - 1;
+	}
+	_candidateCount = (uint32_t)size;
+	_undoHistory.clear();
+}
+
+void MemorySearch::Refresh() {
+	std::lock_guard<std::mutex> lock(_lock);
+	vector<uint8_t> memory;
+	ReadMemory(memory);
+	InternalRefresh(memory);
+}
+
+void MemorySearch::Refresh(std::span<const uint8_t> memory) {
+	std::lock_guard<std::mutex> lock(_lock);
+	InternalRefresh(memory);
+}
+
+void MemorySearch::InternalRefresh(std::span<const uint8_t> memory) {
+	if (memory.size() != _current.size()) {
+		InternalReset(_memType, memory);
+		return;
+	}
+	std::swap(_prevRefresh, _current);
+	memcpy(_current.data(), memory.data(), memory.size());
+}
+
+uint32_t MemorySearch::AddFilter(const MemorySearchFilter& filter) {
+	std::lock_guard<std::mutex> lock(_lock);
+	vector<uint8_t> memory;
+	ReadMemory(memory);
+	return InternalAddFilter(filter, memory);
+}
+
+uint32_t MemorySearch::AddFilter(const MemorySearchFilter& filter, std::span<const uint8_t> memory) {
+	std::lock_guard<std::mutex> lock(_lock);
+	return InternalAddFilter(filter, memory);
+}
+
+uint32_t MemorySearch::InternalAddFilter(const MemorySearchFilter& filter, std::span<const uint8_t> memory) {
+	if (memory.size() != _current.size()) {
+		InternalReset(_memType, memory);
+		return _candidateCount;
+	}
+
+	if (_undoHistory.size() >= MaxUndoHistory) {
+		_undoHistory.pop_front();
+	}
+	_undoHistory.push_back({_candidates, _candidateCount, _lastSearch});
+
+	bool isSigned = filter.Format == MemorySearchFormat::Signed;
+	uint64_t* candidates = _candidates.data();
+	switch (filter.ValueSize) {
+		default:
+		case MemorySearchValueSize::Byte:
+			_candidateCount = isSigned ? ApplyFilter<int8_t>(filter, candidates, _current, _prevRefresh, _lastSearch) : ApplyFilter<uint8_t>(filter, candidates, _current, _prevRefresh, _lastSearch);
+			break;
+
+		case MemorySearchValueSize::Word:
+			_candidateCount = isSigned ? ApplyFilter<int16_t>(filter, candidates, _current, _prevRefresh, _lastSearch) : ApplyFilter<uint16_t>(filter, candidates, _current, _prevRefresh, _lastSearch);
+			break;
+
+		case MemorySearchValueSize::Dword:
+			_candidateCount = isSigned ? ApplyFilter<int32_t>(filter, candidates, _current, _prevRefresh, _lastSearch) : ApplyFilter<uint32_t>(filter, candidates, _current, _prevRefresh, _lastSearch);
+			break;
+	}
+
+	_lastSearch.assign(memory.begin(), memory.end());
+	return _candidateCount;
+}
+
+bool MemorySearch::Undo() {
+	std::lock_guard<std::mutex> lock(_lock);
+	if (_undoHistory.empty()) {
+		return false;
+	}
+
+	UndoState& state = _undoHistory.back();
+	_candidates = std::move(state.Candidates);
+	_candidateCount = state.CandidateCount;
+	_lastSearch = std::move(state.LastSearch);
+	_undoHistory.pop_back();
+	return true;
+}
+
+bool MemorySearch::CanUndo() {
+	std::lock_guard<std::mutex> lock(_lock);
+	return !_undoHistory.empty();
+}
+
+uint32_t MemorySearch::GetResultCount() {
+	std::lock_guard<std::mutex> lock(_lock);
+	return _candidateCount;
+}
+
+uint32_t MemorySearch::GetResults(uint32_t start, uint32_t* results, uint32_t maxCount) {
+	std::lock_guard<std::mutex> lock(_lock);
+
+	uint32_t count = 0;
+	uint32_t skip = start;
+	for (size_t w = 0; w < _candidates.size() && count < maxCount; w++) {
+		uint64_t word = _candidates[w];
+		uint32_t bitCount = std::popcount(word);
+		if (skip >= bitCount) {
+			// Skip whole words until the first requested candidate
+			skip -= bitCount;
+			continue;
+		}
+
+		for (; skip > 0; skip--) {
+			word &= word - 1;
+		}
+
+		while (word && count < maxCount) {
+			results[count++] = (uint32_t)(w * 64 + std::countr_zero(word));
+			word &= word - 1;
+		}
+	}
+	return count;
+}
+
+uint32_t MemorySearch::GetSnapshot(MemorySearchSnapshot type, uint8_t* buffer, uint32_t size) {
+	std::lock_guard<std::mutex> lock(_lock);
+
+	vector<uint8_t>& snapshot = type == MemorySearchSnapshot::Current ? _current : (type == MemorySearchSnapshot::PreviousRefresh ? _prevRefresh : _lastSearch);
+	uint32_t length = std::min(size, (uint32_t)snapshot.size());
+	if (length > 0) {
+		memcpy(buffer, snapshot.data(), length);
+	}
+	return length;
+}
@@ -0,0 +1,139 @@
+#pragma once
+#include "pch.h"
+#include <mutex>
+#include <span>
+#include "Shared/MemoryType.h"
+
+class MemoryDumper;
+
+/// <summary>Size of the values compared by a memory search filter (must match the UI's enum)</summary>
+enum class MemorySearchValueSize {
+	Byte = 1,
+	Word = 2,
+	Dword = 4,
+};
+
+/// <summary>How values are interpreted (hex and unsigned compare as unsigned values)</summary>
+enum class MemorySearchFormat {
+	Hex,
+	Signed,
+	Unsigned,
+};
+
+enum class MemorySearchCompareTo {
+	PreviousSearchValue,
+	PreviousRefreshValue,
+	SpecificValue,
+	SpecificAddress
+};
+
+enum class MemorySearchOperator {
+	Equal,
+	NotEqual,
+	LessThan,
+	GreaterThan,
+	LessThanOrEqual,
+	GreaterThanOrEqual,
+};
+
+/// <summary>Snapshots kept by the memory search</summary>
+enum class MemorySearchSnapshot {
+	Current,         ///< Memory at the last refresh
+	PreviousRefresh, ///< Memory at the refresh before that
+	LastSearch       ///< Memory right after the last filter was applied
+};
+
+/// <summary>
+/// Memory search filter (layout must match the UI's InteropMemorySearchFilter).
+/// </summary>
+struct MemorySearchFilter {
+	MemorySearchValueSize ValueSize;
+	MemorySearchFormat Format;
+	MemorySearchCompareTo CompareTo;
+	MemorySearchOperator Operator;
+	int64_t SpecificValue;
+	uint32_t SpecificAddress;
+};
+
+/// <summary>
+/// RAM search engine used by the cheat finder (memory search window).
+/// </summary>
+/// <remarks>
+/// Architecture:
+/// - Keeps the snapshots the filters compare against (current/previous refresh/last search) for the searched memory type
+/// - Candidate addresses are a bitset (1 bit per address), each filter clears the bits of the addresses that don't match
+/// - Undo history stores the candidates and last search snapshot before each filter
+/// - The UI pages through the remaining candidates with GetResults() instead of filtering a copy of the memory itself
+///
+/// Performance:
+/// - Filters compare 64 addresses at a time into a match mask (branchless loop the compiler can vectorize),
+///   with the compare type, signedness and operator resolved at compile time
+/// - Bitset words with no candidates left are skipped, so later filters only touch the remaining addresses
+///
+/// An address' value is read over ValueSize bytes (little endian), bytes past the end of memory read as 0.
+/// Thread-safe: every public method takes the search's lock.
+/// </remarks>
+class MemorySearch {
+private:
+	static constexpr size_t MaxUndoHistory = 64;
+
+	struct UndoState {
+		vector<uint64_t> Candidates;
+		uint32_t CandidateCount;
+		vector<uint8_t> LastSearch;
+	};
+
+	MemoryDumper* _memoryDumper;
+	std::mutex _lock;
+
+	MemoryType _memType = MemoryType::None;
+	vector<uint8_t> _current;
+	vector<uint8_t> _prevRefresh;
+	vector<uint8_t> _lastSearch;
+
+	vector<uint64_t> _candidates; ///< Bit set = address still matches every filter
+	uint32_t _candidateCount = 0;
+	std::deque<UndoState> _undoHistory;
+
+	void ReadMemory(vector<uint8_t>& dst);
+	void InternalReset(MemoryType memType, std::span<const uint8_t> memory);
+	void InternalRefresh(std::span<const uint8_t> memory);
+	uint32_t InternalAddFilter(const MemorySearchFilter& filter, std::span<const uint8_t> memory);
+
+public:
+	/// <param name="memoryDumper">Used to read the searched memory (can be null when every call passes the memory explicitly)</param>
+	explicit MemorySearch(MemoryDumper* memoryDumper);
+
+	/// <summary>Starts a new search on a memory type: every address is a candidate, all snapshots are set to the current memory</summary>
+	void Reset(MemoryType memType);
+	void Reset(MemoryType memType, std::span<const uint8_t> memory);
+
+	/// <summary>Takes a new current snapshot (the previous one becomes the "previous refresh" snapshot)</summary>
+	/// <remarks>Restarts the search if the memory size changed (e.g a different game was loaded)</remarks>
+	void Refresh();
+	void Refresh(std::span<const uint8_t> memory);
+
+	/// <summary>Removes the candidates whose current value doesn't match the filter, then takes the "last search" snapshot</summary>
+	/// <returns>Number of candidates left</returns>
+	uint32_t AddFilter(const MemorySearchFilter& filter);
+	uint32_t AddFilter(const MemorySearchFilter& filter, std::span<const uint8_t> memory);
+
+	/// <summary>Reverts the last filter</summary>
+	/// <returns>False when there is nothing to undo</returns>
+	bool Undo();
+
+	[[nodiscard]] bool CanUndo();
+
+	uint32_t GetResultCount();
+
+	/// <summary>Copies a page of candidate addresses (in ascending order)</summary>
+	/// <param name="start">Index of the first candidate to return</param>
+	/// <param name="results">Output buffer</param>
+	/// <param name="maxCount">Size of the output buffer</param>
+	/// <returns>Number of addresses written</returns>
+	uint32_t GetResults(uint32_t start, uint32_t* results, uint32_t maxCount);
+
+	/// <summary>Copies a snapshot (up to size bytes)</summary>
+	/// <returns>Number of bytes written</returns>
+	uint32_t GetSnapshot(MemorySearchSnapshot type, uint8_t* buffer, uint32_t size);
+};
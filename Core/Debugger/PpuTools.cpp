@@ -19,65 +19,65 @@ void PpuTools::BlendColors(uint8_t output[4], uint8_t input[4]) {
 	output[3] = 0xFF;
 }
 
-void PpuTools::GetTileView(GetTileViewOptions options, uint8_t* source, uint32_t srcSize, const uint32_t* colors, uint32_t* outBuffer) {
+void PpuTools::GetTileView(GetTileViewOptions options, uint8_t* source, uint32_t srcSize, const uint32_t* colors, uint32_t colorCount, uint32_t* outBuffer) {
 	switch (options.Format) {
 		case TileFormat::Bpp2:
-			InternalGetTileView<TileFormat::Bpp2>(options, source, srcSize, colors, outBuffer);
+			InternalGetTileView<TileFormat::Bpp2>(options, source, srcSize, colors, colorCount, outBuffer);
 			break;
 		case TileFormat::Bpp4:
-			InternalGetTileView<TileFormat::Bpp4>(options, source, srcSize, colors, outBuffer);
+			InternalGetTileView<TileFormat::Bpp4>(options, source, srcSize, colors, colorCount, outBuffer);
 			break;
 		case TileFormat::Bpp8:
-			InternalGetTileView<TileFormat::Bpp8>(options, source, srcSize, colors, outBuffer);
+			InternalGetTileView<TileFormat::Bpp8>(options, source, srcSize, colors, colorCount, outBuffer);
 			break;
 		case TileFormat::DirectColor:
-			InternalGetTileView<TileFormat::DirectColor>(options, source, srcSize, colors, outBuffer);
+			InternalGetTileView<TileFormat::DirectColor>(options, source, srcSize, colors, colorCount, outBuffer);
 			break;
 		case TileFormat::Mode7:
-			InternalGetTileView<TileFormat::Mode7>(options, source, srcSize, colors, outBuffer);
+			InternalGetTileView<TileFormat::Mode7>(options, source, srcSize, colors, colorCount, outBuffer);
 			break;
 		case TileFormat::Mode7DirectColor:
-			InternalGetTileView<TileFormat::Mode7DirectColor>(options, source, srcSize, colors, outBuffer);
+			InternalGetTileView<TileFormat::Mode7DirectColor>(options, source, srcSize, colors, colorCount, outBuffer);
 			break;
 		case TileFormat::Mode7ExtBg:
-			InternalGetTileView<TileFormat::Mode7ExtBg>(options, source, srcSize, colors, outBuffer);
+			InternalGetTileView<TileFormat::Mode7ExtBg>(options, source, srcSize, colors, colorCount, outBuffer);
 			break;
 
 		case TileFormat::NesBpp2:
-			InternalGetTileView<TileFormat::NesBpp2>(options, source, srcSize, colors, outBuffer);
+			InternalGetTileView<TileFormat::NesBpp2>(options, source, srcSize, colors, colorCount, outBuffer);
 			break;
 
 		case TileFormat::PceSpriteBpp4:
-			InternalGetTileView<TileFormat::PceSpriteBpp4>(options, source, srcSize, colors, outBuffer);
+			InternalGetTileView<TileFormat::PceSpriteBpp4>(options, source, srcSize, colors, colorCount, outBuffer);
 			break;
 		case TileFormat::PceBackgroundBpp2Cg0:
-			InternalGetTileView<TileFormat::PceBackgroundBpp2Cg0>(options, source, srcSize, colors, outBuffer);
+			InternalGetTileView<TileFormat::PceBackgroundBpp2Cg0>(options, source, srcSize, colors, colorCount, outBuffer);
 			break;
 		case TileFormat::PceBackgroundBpp2Cg1:
-			InternalGetTileView<TileFormat::PceBackgroundBpp2Cg1>(options, source, srcSize, colors, outBuffer);
+			InternalGetTileView<TileFormat::PceBackgroundBpp2Cg1>(options, source, srcSize, colors, colorCount, outBuffer);
 			break;
 		case TileFormat::PceSpriteBpp2Sp01:
-			InternalGetTileView<TileFormat::PceSpriteBpp2Sp01>(options, source, srcSize, colors, outBuffer);
+			InternalGetTileView<TileFormat::PceSpriteBpp2Sp01>(options, source, srcSize, colors, colorCount, outBuffer);
 			break;
 		case TileFormat::PceSpriteBpp2Sp23:
-			InternalGetTileView<TileFormat::PceSpriteBpp2Sp23>(options, source, srcSize, colors, outBuffer);
+			InternalGetTileView<TileFormat::PceSpriteBpp2Sp23>(options, source, srcSize, colors, colorCount, outBuffer);
 			break;
 
 		case TileFormat::SmsBpp4:
-			InternalGetTileView<TileFormat::SmsBpp4>(options, source, srcSize, colors, outBuffer);
+			InternalGetTileView<TileFormat::SmsBpp4>(options, source, srcSize, colors, colorCount, outBuffer);
 			break;
 		case TileFormat::SmsSgBpp1:
-			InternalGetTileView<TileFormat::SmsSgBpp1>(options, source, srcSize, colors, outBuffer);
+			InternalGetTileView<TileFormat::SmsSgBpp1>(options, source, srcSize, colors, colorCount, outBuffer);
 			break;
 
 		case TileFormat::GbaBpp4:
-			InternalGetTileView<TileFormat::GbaBpp4>(options, source, srcSize, colors, outBuffer);
+			InternalGetTileView<TileFormat::GbaBpp4>(options, source, srcSize, colors, colorCount, outBuffer);
 			break;
 		case TileFormat::GbaBpp8:
-			InternalGetTileView<TileFormat::GbaBpp8>(options, source, srcSize, colors, outBuffer);
+			InternalGetTileView<TileFormat::GbaBpp8>(options, source, srcSize, colors, colorCount, outBuffer);
 			break;
 		case TileFormat::WsBpp4Packed:
-			InternalGetTileView<TileFormat::WsBpp4Packed>(options, source, srcSize, colors, outBuffer);
+			InternalGetTileView<TileFormat::WsBpp4Packed>(options, source, srcSize, colors, colorCount, outBuffer);
 			break;
 	}
 }
@@ -119,7 +119,7 @@ uint32_t PpuTools::GetSpriteBackgroundColor(SpriteBackground bgColor, const uint
 }
 
 template <TileFormat format>
-void PpuTools::InternalGetTileView(GetTileViewOptions options, uint8_t* source, uint32_t srcSize, const uint32_t* colors, uint32_t* outBuffer) {
+void PpuTools::InternalGetTileView(GetTileViewOptions options, uint8_t* source, uint32_t srcSize, const uint32_t* colors, uint32_t colorCount, uint32_t* outBuffer) {
 	uint8_t* ram = source;
 	uint8_t bpp;
 
@@ -214,6 +214,22 @@ void PpuTools::InternalGetTileView(GetTileViewOptions options, uint8_t* source,
 	int bytesPerTile = tileHeight * tileWidth * bpp / 8;
 	int tileCount = options.Width * options.Height;
 
+	// Tiles can only be drawn separately if each one has its own area in the output
+	bool separateTiles = (
+	    options.Layout == TileLayout::Normal ||
+	    (options.Layout == TileLayout::SingleLine8x16 && (options.Width & 0x01) == 0) ||
+	    (options.Layout == TileLayout::SingleLine16x16 && (options.Width & 0x03) == 0));
+
+	uint32_t outputSize = tileCount * tileWidth * tileHeight;
+
+	auto lock = _tileViewLock.AcquireSafe();
+	TileViewCache* cache = nullptr;
+	if (separateTiles && tileCount >= PpuTools::_minCachedTileCount) {
+		cache = GetTileViewCache(options, srcSize, colors, colorCount, tileCount, outputSize);
+	}
+	bool redrawAll = !cache || !cache->Valid;
+	uint32_t* output = cache ? cache->Output.data() : outBuffer;
+
 	uint8_t colorMask = 0xFF;
 	if (options.UseGrayscalePalette) {
 		options.Palette = 0;
@@ -235,9 +251,10 @@ void PpuTools::InternalGetTileView(GetTileViewOptions options, uint8_t* source,
 
 	uint32_t bgColor = GetBackgroundColor(options.Background, colors, options.Palette, bpp);
 
-	uint32_t outputSize = tileCount * tileWidth * tileHeight;
-	for (uint32_t i = 0; i < outputSize; i++) {
-		outBuffer[i] = bgColor;
+	if (redrawAll) {
+		for (uint32_t i = 0; i < outputSize; i++) {
+			output[i] = bgColor;
+		}
 	}
 
 	int rowCount = (int)std::ceil((double)tileCount / options.Width);
@@ -264,7 +281,29 @@ void PpuTools::InternalGetTileView(GetTileViewOptions options, uint8_t* source,
 				baseOutputOffset = row * options.Width * tileWidth * tileHeight + column * tileWidth;
 			}
 
-			if (IsTileHidden(options.MemType, addr, options)) {
+			bool hidden = IsTileHidden(options.MemType, addr, options);
+
+			if (cache) {
+				uint32_t tileIndex = row * options.Width + column;
+				if (!redrawAll) {
+					// Skip tiles whose data and visibility didn't change (tiles past the end of the source are always redrawn)
+					if (cache->HiddenTiles[tileIndex] == hidden && addr + bytesPerTile <= srcSize && memcmp(cache->Source.data() + addr, ram + addr, bytesPerTile) == 0) {
+						continue;
+					}
+
+					for (int y = 0; y < tileHeight; y++) {
+						for (int x = 0; x < tileWidth; x++) {
+							uint32_t pos = baseOutputOffset + (y * options.Width * tileWidth) + x;
+							if (pos < outputSize) {
+								output[pos] = bgColor;
+							}
+						}
+					}
+				}
+				cache->HiddenTiles[tileIndex] = hidden;
+			}
+
+			if (hidden) {
 				continue;
 			}
 
@@ -275,13 +314,58 @@ void PpuTools::InternalGetTileView(GetTileViewOptions options, uint8_t* source,
 					if (color != 0 || options.Background == TileBackground::PaletteColor) {
 						uint32_t pos = baseOutputOffset + (y * options.Width * tileWidth) + x;
 						if (pos < outputSize) {
-							outBuffer[pos] = GetRgbPixelColor<format>(colors, color & colorMask, options.Palette);
+							output[pos] = GetRgbPixelColor<format>(colors, color & colorMask, options.Palette);
 						}
 					}
 				}
 			}
 		}
 	}
+
+	if (cache) {
+		memcpy(cache->Source.data(), ram, srcSize);
+		cache->Valid = true;
+		memcpy(outBuffer, output, outputSize * sizeof(uint32_t));
+	}
+}
+
+PpuTools::TileViewCache* PpuTools::GetTileViewCache(GetTileViewOptions& options, uint32_t srcSize, const uint32_t* colors, uint32_t colorCount, uint32_t tileCount, uint32_t outputSize) {
+	auto isSameView = [&](TileViewCache& cache) {
+		GetTileViewOptions& cached = cache.Options;
+		return (
+		    cache.SrcSize == srcSize && cached.MemType == options.MemType && cached.Format == options.Format &&
+		    cached.Layout == options.Layout && cached.Filter == options.Filter && cached.Background == options.Background &&
+		    cached.Width == options.Width && cached.Height == options.Height && cached.StartAddress == options.StartAddress &&
+		    cached.Palette == options.Palette && cached.UseGrayscalePalette == options.UseGrayscalePalette);
+	};
+
+	auto result = std::find_if(_tileViewCaches.begin(), _tileViewCaches.end(), [&](unique_ptr<TileViewCache>& cache) { return isSameView(*cache); });
+	if (result == _tileViewCaches.end()) {
+		if (_tileViewCaches.size() < PpuTools::_maxTileViewCaches) {
+			_tileViewCaches.push_back(std::make_unique<TileViewCache>());
+		}
+		result = _tileViewCaches.end() - 1;
+		(*result)->Valid = false;
+	}
+
+	// Move to the front (most recently used)
+	std::rotate(_tileViewCaches.begin(), result, result + 1);
+	TileViewCache* cache = _tileViewCaches.front().get();
+
+	if (!cache->Valid) {
+		cache->Options = options;
+		cache->SrcSize = srcSize;
+		cache->Source.resize(srcSize);
+		cache->HiddenTiles.assign(tileCount, false);
+		cache->Output.resize(outputSize);
+	}
+
+	// The palette changes the color of every tile
+	if (cache->Colors.size() != colorCount || memcmp(cache->Colors.data(), colors, colorCount * sizeof(uint32_t)) != 0) {
+		cache->Colors.assign(colors, colors + colorCount);
+		cache->Valid = false;
+	}
+	return cache;
 }
 
 bool PpuTools::IsTileHidden(MemoryType memType, uint32_t addr, GetTileViewOptions& options) {
@@ -4,6 +4,7 @@
 #include "Shared/NotificationManager.h"
 #include "Shared/Emulator.h"
 #include "Shared/ColorUtilities.h"
+#include "Utilities/SimpleLock.h"
 
 class Debugger;
 
@@ -263,6 +264,7 @@ struct DebugPaletteInfo {
 /// - Template GetRgbPixelColor<format>(): Convert palette index to RGB
 /// - Template GetTilePixelColor<format>(): Extract pixel from tile data
 /// - Template InternalGetTileView<format>(): Render tile view with templates
+/// - Tile views are cached: only tiles whose data/visibility changed are decoded again
 ///
 /// Performance optimizations:
 /// - __forceinline template functions for tile rendering
@@ -284,9 +286,27 @@ protected:
 	    0xFF000000, 0xFF303030, 0xFF404040, 0xFF505050, 0xFF606060, 0xFF707070, 0xFF808080, 0xFF909090,
 	    0xFF989898, 0xFFA0A0A0, 0xFFAAAAAA, 0xFFBBBBBB, 0xFFCCCCCC, 0xFFDDDDDD, 0xFFEEEEEE, 0xFFFFFFFF};
 
+	static constexpr int _minCachedTileCount = 64; ///< Smaller views (e.g tile editor) are not cached
+	static constexpr size_t _maxTileViewCaches = 4;  ///< Number of tile views cached (one per open viewer)
+
+	/// <summary>
+	/// Last result of a tile view, used to only decode the tiles that changed since the previous refresh.
+	/// </summary>
+	struct TileViewCache {
+		GetTileViewOptions Options = {};
+		uint32_t SrcSize = 0;
+		vector<uint32_t> Colors;  ///< Palette colors used for the output
+		vector<uint8_t> Source;   ///< Source data used for the output
+		vector<bool> HiddenTiles; ///< Tile filter result for each tile
+		vector<uint32_t> Output;  ///< ARGB output
+		bool Valid = false;
+	};
+
 	Emulator* _emu;                                              ///< Emulator instance
 	Debugger* _debugger;                                         ///< Debugger instance
 	unordered_map<uint32_t, ViewerRefreshConfig> _updateTimings; ///< Viewer ID → refresh timing
+	vector<unique_ptr<TileViewCache>> _tileViewCaches;           ///< Most recently used first
+	SimpleLock _tileViewLock;                                    ///< Protects _tileViewCaches
 
 	/// <summary>
 	/// Blend two colors (alpha compositing).
@@ -357,6 +377,12 @@ protected:
 	/// <param name="forGet">True for get, false for set</param>
 	void GetSetTilePixel(AddressInfo tileAddress, TileFormat format, int32_t x, int32_t y, int32_t& color, bool forGet);
 
+	/// <summary>
+	/// Get the cached tile view for these options (a new, invalid entry is created if needed).
+	/// </summary>
+	/// <returns>Cache entry, Valid is false when all tiles must be drawn</returns>
+	TileViewCache* GetTileViewCache(GetTileViewOptions& options, uint32_t srcSize, const uint32_t* colors, uint32_t colorCount, uint32_t tileCount, uint32_t outputSize);
+
 public:
 	/// <summary>
 	/// Constructor for PPU tools.
@@ -385,8 +411,9 @@ public:
 	/// <param name="source">Source data (CHR ROM/VRAM)</param>
 	/// <param name="srcSize">Source size</param>
 	/// <param name="palette">Palette colors</param>
+	/// <param name="paletteSize">Number of palette colors</param>
 	/// <param name="outBuffer">Output ARGB buffer</param>
-	void GetTileView(GetTileViewOptions options, uint8_t* source, uint32_t srcSize, const uint32_t* palette, uint32_t* outBuffer);
+	void GetTileView(GetTileViewOptions options, uint8_t* source, uint32_t srcSize, const uint32_t* palette, uint32_t paletteSize, uint32_t* outBuffer);
 
 	/// <summary>
 	/// Get information for tilemap tile at position.
@@ -510,9 +537,10 @@ public:
 	/// <param name="source">Source data</param>
 	/// <param name="srcSize">Source size</param>
 	/// <param name="colors">Palette colors</param>
+	/// <param name="colorCount">Number of palette colors</param>
 	/// <param name="outBuffer">Output ARGB buffer</param>
 	template <TileFormat format>
-	void InternalGetTileView(GetTileViewOptions options, uint8_t* source, uint32_t srcSize, const uint32_t* colors, uint32_t* outBuffer);
+	void InternalGetTileView(GetTileViewOptions options, uint8_t* source, uint32_t srcSize, const uint32_t* colors, uint32_t colorCount, uint32_t* outBuffer);
 };
 
 template <TileFormat format>
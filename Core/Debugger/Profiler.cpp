@@ -17,68 +17,92 @@ Profiler::Profiler(Debugger* debugger, IDebugger* cpuDebugger) {
 }
 
 Profiler::~Profiler() {
+	StopAggregationThread();
 }
 
 void Profiler::StackFunction(AddressInfo& addr, StackFrameFlags stackFlag) {
-	if (addr.Address >= 0) {
-		uint32_t key = addr.Address | ((uint8_t)addr.Type << 24);
-
-		// Find or create the function entry
-		auto it = _functions.find(key);
-		if (it == _functions.end()) {
-			it = _functions.emplace(key, ProfiledFunction()).first;
-			it->second.Address = addr;
+	if (_backgroundMode) {
+		if (addr.Address >= 0) {
+			PushEvent({_cpuDebugger->GetCpuCycleCount(true), addr, ProfilerEventType::Stack, stackFlag});
 		}
+		return;
+	}
+	ProcessStackFunction(addr, stackFlag, _cpuDebugger->GetCpuCycleCount(true));
+}
+
+void Profiler::UnstackFunction() {
+	if (_backgroundMode) {
+		PushEvent({_cpuDebugger->GetCpuCycleCount(true), {}, ProfilerEventType::Unstack, {}});
+		return;
+	}
+	ProcessUnstackFunction(_cpuDebugger->GetCpuCycleCount(true));
+}
+
+void Profiler::ResetState() {
+	if (_backgroundMode) {
+		PushEvent({_cpuDebugger->GetCpuCycleCount(true), {}, ProfilerEventType::ResetState, {}});
+		return;
+	}
+	ProcessResetState(_cpuDebugger->GetCpuCycleCount(true));
+}
 
-		UpdateCycles();
+uint32_t Profiler::GetFunctionIndex(int32_t key, AddressInfo& addr) {
+	LookupCacheEntry& cached = _lookupCache[((uint32_t)key ^ ((uint32_t)key >> 12)) & (Profiler::LookupCacheSize - 1)];
+	if (cached.Index != Profiler::NoFunction && cached.Key == key) {
+		return cached.Index;
+	}
+
+	// Find or create the function entry
+	auto it = _functionIndex.find(key);
+	if (it == _functionIndex.end()) {
+		it = _functionIndex.emplace(key, (uint32_t)_functions.size()).first;
+		_functions.emplace_back().Address = addr;
+	}
+
+	cached = {key, it->second};
+	return it->second;
+}
+
+void Profiler::ProcessStackFunction(AddressInfo& addr, StackFrameFlags stackFlag, uint64_t masterClock) {
+	if (addr.Address >= 0) {
+		int32_t key = addr.Address | ((uint8_t)addr.Type << 24);
+		uint32_t index = GetFunctionIndex(key, addr);
 
-		// Don't push null onto stacks — can happen during reset window
-		if (!_currentFunctionPtr) return;
+		UpdateCycles(masterClock);
 
-		// Push current function onto stack (key + cached pointer)
-		_stackFlags.push_back(stackFlag);
-		_cycleCountStack.push_back(_currentCycleCount);
-		_functionStack.push_back(_currentFunction);
-		_functionPtrStack.push_back(_currentFunctionPtr);
+		// Don't push the reset window's (missing) function onto the stack
+		if (_currentFunction == Profiler::NoFunction) return;
 
-		if (_functionStack.size() > 100) {
+		if (_stackSize == Profiler::MaxStackSize) {
 			// Keep stack to 100 functions at most (to prevent performance issues, esp. in debug builds)
 			// Only happens when software doesn't use JSR/RTS normally to enter/leave functions
-			_functionStack.pop_front();
-			_functionPtrStack.pop_front();
-			_cycleCountStack.pop_front();
-			_stackFlags.pop_front();
+			_stackStart = (_stackStart + 1) % Profiler::MaxStackSize;
+			_stackSize--;
 		}
+		GetStackFrame(_stackSize++) = {_currentFunction, stackFlag, _currentCycleCount};
 
-		// Cache pointer to the new current function (avoids hash lookup in UpdateCycles)
-		ProfiledFunction& func = it->second;
+		ProfiledFunction& func = _functions[index];
 		func.CallCount++;
 		func.Flags = stackFlag;
 
-		_currentFunction = key;
-		_currentFunctionPtr = &func;
+		_currentFunction = index;
 		_currentCycleCount = 0;
 	}
 }
 
-void Profiler::UpdateCycles() {
-	if (!_currentFunctionPtr) return;
-
-	uint64_t masterClock = _cpuDebugger->GetCpuCycleCount(true);
+void Profiler::UpdateCycles(uint64_t masterClock) {
+	if (_currentFunction == Profiler::NoFunction) return;
 
-	// Use cached pointer instead of hash lookup (5.7-9.6× faster, see benchmarks)
-	ProfiledFunction& func = *_currentFunctionPtr;
+	ProfiledFunction& func = _functions[_currentFunction];
 	uint64_t clockGap = masterClock - _prevMasterClock;
 	func.ExclusiveCycles += clockGap;
 	func.InclusiveCycles += clockGap;
 
-	// Propagate inclusive cycles up the stack using cached pointers
-	// This avoids hash lookup per stack level (the main bottleneck before optimization)
-	int32_t len = (int32_t)_functionPtrStack.size();
-	for (int32_t i = len - 1; i >= 0; i--) {
-		if (!_functionPtrStack[i]) break;
-		_functionPtrStack[i]->InclusiveCycles += clockGap;
-		if (_stackFlags[i] != StackFrameFlags::None) {
+	// Propagate inclusive cycles up the stack (function indexes, no hash lookups)
+	for (int32_t i = (int32_t)_stackSize - 1; i >= 0; i--) {
+		StackFrame& frame = GetStackFrame(i);
+		_functions[frame.Function].InclusiveCycles += clockGap;
+		if (frame.Flags != StackFrameFlags::None) {
 			// Don't apply inclusive times to stack frames before an IRQ/NMI
 			break;
 		}
@@ -88,73 +112,125 @@ void Profiler::UpdateCycles() {
 	_prevMasterClock = masterClock;
 }
 
-void Profiler::UnstackFunction() {
-	if (!_functionStack.empty()) {
-		UpdateCycles();
+void Profiler::ProcessUnstackFunction(uint64_t masterClock) {
+	if (_stackSize > 0) {
+		UpdateCycles(masterClock);
 
-		if (!_currentFunctionPtr) return;
+		if (_currentFunction == Profiler::NoFunction) return;
 
-		// Return to the previous function — use cached pointer for min/max update
-		ProfiledFunction& func = *_currentFunctionPtr;
+		ProfiledFunction& func = _functions[_currentFunction];
 		func.MinCycles = std::min(func.MinCycles, _currentCycleCount);
 		func.MaxCycles = std::max(func.MaxCycles, _currentCycleCount);
 
-		// Restore previous function from stack (both key and cached pointer)
-		_currentFunction = _functionStack.back();
-		_currentFunctionPtr = _functionPtrStack.back();
-		_functionStack.pop_back();
-		_functionPtrStack.pop_back();
-		_stackFlags.pop_back();
-
-		// Add the subroutine's cycle count to the current routine's cycle count
-		_currentCycleCount = _cycleCountStack.back() + _currentCycleCount;
-		_cycleCountStack.pop_back();
+		// Return to the previous function, and add the subroutine's cycle count to its cycle count
+		StackFrame& frame = GetStackFrame(--_stackSize);
+		_currentFunction = frame.Function;
+		_currentCycleCount = frame.CycleCount + _currentCycleCount;
 	}
 }
 
 void Profiler::Reset() {
 	DebugBreakHelper helper(_debugger);
+	auto lock = std::unique_lock(_aggregationLock);
+	_events.Discard();
 	InternalReset();
 }
 
-void Profiler::ResetState() {
-	_prevMasterClock = _cpuDebugger->GetCpuCycleCount(true);
+void Profiler::ProcessResetState(uint64_t masterClock) {
+	_prevMasterClock = masterClock;
 	_currentCycleCount = 0;
-	_functionStack.clear();
-	_functionPtrStack.clear();
-	_stackFlags.clear();
-	_cycleCountStack.clear();
-	_currentFunction = ResetFunctionIndex;
-	_currentFunctionPtr = nullptr; // Will be set in InternalReset after _functions is populated
+	_stackStart = 0;
+	_stackSize = 0;
+
+	// Cycles after a reset are counted in the reset function (always the first function in the table)
+	_currentFunction = 0;
+}
+
+void Profiler::PushEvent(const ProfilerEvent& evt) {
+	while (!_events.TryPush(evt)) [[unlikely]] {
+		// Aggregation thread is behind, wait for it to make room
+		_eventsAvailable.notify_one();
+		std::this_thread::yield();
+	}
+
+	if ((_events.GetFillLevel() & (Profiler::EventNotifyInterval - 1)) == 0) {
+		_eventsAvailable.notify_one();
+	}
+}
+
+void Profiler::ProcessEvents() {
+	_events.Consume([this](ProfilerEvent& evt) {
+		switch (evt.Type) {
+			case ProfilerEventType::Stack: ProcessStackFunction(evt.Address, evt.Flags, evt.Clock); break;
+			case ProfilerEventType::Unstack: ProcessUnstackFunction(evt.Clock); break;
+			case ProfilerEventType::ResetState: ProcessResetState(evt.Clock); break;
+		}
+	});
+}
+
+void Profiler::AggregationLoop() {
+	auto lock = std::unique_lock(_aggregationLock);
+	while (!_stopAggregation) {
+		// Also wakes up periodically, in case a notification was missed
+		_eventsAvailable.wait_for(lock, std::chrono::milliseconds(10));
+		ProcessEvents();
+	}
+}
+
+void Profiler::StopAggregationThread() {
+	if (_aggregationThread.joinable()) {
+		{
+			auto lock = std::unique_lock(_aggregationLock);
+			_stopAggregation = true;
+		}
+		_eventsAvailable.notify_one();
+		_aggregationThread.join();
+	}
+}
+
+void Profiler::SetBackgroundMode(bool enabled) {
+	DebugBreakHelper helper(_debugger);
+	if (enabled == _backgroundMode) {
+		return;
+	}
+
+	if (enabled) {
+		_events.Init(Profiler::EventQueueSize);
+		_stopAggregation = false;
+		_backgroundMode = true;
+		_aggregationThread = std::thread(&Profiler::AggregationLoop, this);
+	} else {
+		_backgroundMode = false;
+		StopAggregationThread();
+		ProcessEvents();
+	}
 }
 
 void Profiler::InternalReset() {
-	// Clear all cached pointers FIRST before invalidating them via _functions.clear()
-	// This prevents dangling pointer access if UpdateCycles runs concurrently
-	_currentFunctionPtr = nullptr;
-	_functionPtrStack.clear();
-	_functionStack.clear();
-	_stackFlags.clear();
-	_cycleCountStack.clear();
+	_stackStart = 0;
+	_stackSize = 0;
 
 	_functions.clear();
-	_functions[ResetFunctionIndex] = ProfiledFunction();
-	_functions[ResetFunctionIndex].Address = {ResetFunctionIndex, MemoryType::None};
+	_functionIndex.clear();
+	_lookupCache.fill({0, Profiler::NoFunction});
+
+	AddressInfo resetAddr = {ResetFunctionIndex, MemoryType::None};
+	_currentFunction = GetFunctionIndex(ResetFunctionIndex, resetAddr);
 
 	_prevMasterClock = _cpuDebugger->GetCpuCycleCount(true);
 	_currentCycleCount = 0;
-	_currentFunction = ResetFunctionIndex;
-	_currentFunctionPtr = &_functions[_currentFunction];
 }
 
 void Profiler::GetProfilerData(ProfiledFunction* profilerData, uint32_t& functionCount) {
 	DebugBreakHelper helper(_debugger);
+	auto lock = std::unique_lock(_aggregationLock);
 
-	UpdateCycles();
+	ProcessEvents();
+	UpdateCycles(_cpuDebugger->GetCpuCycleCount(true));
 
 	functionCount = 0;
-	for (auto& func : _functions) {
-		profilerData[functionCount] = func.second;
+	for (ProfiledFunction& func : _functions) {
+		profilerData[functionCount] = func;
 		functionCount++;
 
 		if (functionCount >= 100000) {
@@ -0,0 +1,85 @@
+#pragma once
+#include "pch.h"
+#include <atomic>
+#include "Debugger/DebugTypes.h"
+
+/// <summary>
+/// Call/return events logged by the Profiler when it aggregates its data on a background thread.
+/// </summary>
+enum class ProfilerEventType : uint8_t {
+	Stack,     ///< Function called (StackFunction)
+	Unstack,   ///< Function returned (UnstackFunction)
+	ResetState ///< Call stack cleared (ResetState)
+};
+
+/// <summary>
+/// Profiler event, with the CPU cycle count at the time of the event.
+/// </summary>
+struct ProfilerEvent {
+	uint64_t Clock;
+	AddressInfo Address; ///< Function entry point (Stack only)
+	ProfilerEventType Type;
+	StackFrameFlags Flags; ///< Stack frame flags (Stack only)
+};
+
+/// <summary>
+/// Lock-free single-producer/single-consumer queue of profiler events.
+/// </summary>
+/// <remarks>
+/// The emulation thread pushes events, the consumer (the Profiler's aggregation thread, or the UI thread while
+/// the emulation is paused, serialized by the Profiler's lock) replays them in order. Positions are free-running
+/// counters and the capacity is a power of 2, like AudioRingBuffer.
+/// </remarks>
+class ProfilerEventQueue {
+private:
+	unique_ptr<ProfilerEvent[]> _events;
+	uint32_t _mask = 0;
+
+	// Separate cache lines, each is written by a different thread
+	alignas(64) std::atomic<uint32_t> _writePos{0};
+	alignas(64) std::atomic<uint32_t> _readPos{0};
+
+public:
+	/// <summary>Allocates the given capacity (must be a power of 2) and empties the queue (neither side may be running)</summary>
+	void Init(uint32_t capacity) {
+		_events = std::make_unique<ProfilerEvent[]>(capacity);
+		_mask = capacity - 1;
+		_writePos.store(0, std::memory_order_relaxed);
+		_readPos.store(0, std::memory_order_relaxed);
+	}
+
+	[[nodiscard]] uint32_t GetCapacity() const { return _mask + 1; }
+
+	/// <summary>Events waiting to be consumed</summary>
+	[[nodiscard]] uint32_t GetFillLevel() const {
+		return _writePos.load(std::memory_order_acquire) - _readPos.load(std::memory_order_acquire);
+	}
+
+	/// <summary>Producer: appends an event, returns false if the queue is full</summary>
+	__forceinline bool TryPush(const ProfilerEvent& evt) {
+		uint32_t writePos = _writePos.load(std::memory_order_relaxed);
+		if (writePos - _readPos.load(std::memory_order_acquire) > _mask) [[unlikely]] {
+			return false;
+		}
+		_events[writePos & _mask] = evt;
+		_writePos.store(writePos + 1, std::memory_order_release);
+		return true;
+	}
+
+	/// <summary>Consumer: calls process(event) for every event available, in order, returns the number of events consumed</summary>
+	template <typename T>
+	uint32_t Consume(T&& process) {
+		uint32_t readPos = _readPos.load(std::memory_order_relaxed);
+		uint32_t writePos = _writePos.load(std::memory_order_acquire);
+		for (uint32_t pos = readPos; pos != writePos; pos++) {
+			process(_events[pos & _mask]);
+		}
+		_readPos.store(writePos, std::memory_order_release);
+		return writePos - readPos;
+	}
+
+	/// <summary>Consumer: drops every event available</summary>
+	void Discard() {
+		_readPos.store(_writePos.load(std::memory_order_acquire), std::memory_order_release);
+	}
+};
@@ -18,6 +18,16 @@ string ScriptHost::GetLog() {
 	return context ? context->GetLog() : "";
 }
 
+uint32_t ScriptHost::GetCallbackProfiles(ScriptCallbackProfile* profiles, uint32_t maxCount) {
+	shared_ptr<ScriptingContext> context = _context.lock();
+	return context ? context->GetCallbackProfiles(profiles, maxCount) : 0;
+}
+
+ScriptProfileSummary ScriptHost::GetProfileSummary() {
+	shared_ptr<ScriptingContext> context = _context.lock();
+	return context ? context->GetProfileSummary() : ScriptProfileSummary{};
+}
+
 bool ScriptHost::LoadScript(const string& scriptName, const string& path, const string& scriptContent, Debugger* debugger) {
 	_context.reset(new ScriptingContext(debugger));
 	if (!_context->LoadScript(scriptName, path, scriptContent, debugger)) {
@@ -18,11 +18,14 @@ public:
 
 	int GetScriptId();
 	string GetLog();
+	uint32_t GetCallbackProfiles(ScriptCallbackProfile* profiles, uint32_t maxCount);
+	ScriptProfileSummary GetProfileSummary();
 
 	bool LoadScript(const string& scriptName, const string& path, const string& scriptContent, Debugger* debugger);
 	void RefreshMemoryCallbackFlags() { _context->RefreshMemoryCallbackFlags(); }
 
 	void ProcessEvent(EventType eventType, CpuType cpuType);
+	void ProcessDmaBurst(CpuType cpuType, uint8_t channel, bool started) { _context->ProcessDmaBurst(cpuType, channel, started); }
 
 	template <typename T>
 	__forceinline void CallMemoryCallback(AddressInfo relAddr, T& value, CallbackType callbackType, CpuType cpuType) {
@@ -9,6 +9,7 @@
 
 ScriptManager::ScriptManager(Debugger* debugger) {
 	_debugger = debugger;
+	_profiler = debugger->GetEmulator()->GetFrameProfiler();
 	_hasScript = false;
 	_nextScriptId = 1;
 }
@@ -69,11 +70,46 @@ void ScriptManager::RemoveScript(int32_t scriptId) {
 void ScriptManager::RefreshMemoryCallbackFlags() {
 	_isPpuMemoryCallbackEnabled = false;
 	_isCpuMemoryCallbackEnabled = false;
+	_isDmaCallbackEnabled = false;
+	for (auto& cpuIndexes : _callbackIndex) {
+		for (MemoryCallbackIndex& index : cpuIndexes) {
+			index.Clear();
+		}
+	}
+
 	for (unique_ptr<ScriptHost>& script : _scripts) {
 		script->RefreshMemoryCallbackFlags();
 	}
 }
 
+void ScriptManager::AddMemoryCallback(CallbackType type, const MemoryCallback& callback) {
+	if (DebugUtilities::IsPpuMemory(callback.MemType)) {
+		EnablePpuMemoryCallbacks();
+	} else {
+		EnableCpuMemoryCallbacks();
+	}
+
+	MemoryCallbackIndex& index = _callbackIndex[(int)callback.Cpu][(int)type];
+	if (DebugUtilities::IsRelativeMemory(callback.MemType)) {
+		index.AddRange(callback.MemType, callback.StartAddress, callback.EndAddress);
+	} else {
+		// Matched against the absolute address, which isn't known until the callbacks are called
+		index.AddAll();
+	}
+}
+
+void ScriptManager::AddDmaCallback(CallbackType type, const MemoryCallback& callback) {
+	_isDmaCallbackEnabled = true;
+	AddMemoryCallback(type, callback);
+}
+
+void ScriptManager::ProcessDmaBurst(CpuType cpuType, uint8_t channel, bool started) {
+	PROFILE_SCOPE(_profiler, ProfilerStage::Script);
+	for (unique_ptr<ScriptHost>& script : _scripts) {
+		script->ProcessDmaBurst(cpuType, channel, started);
+	}
+}
+
 string ScriptManager::GetScriptLog(int32_t scriptId) {
 	auto lock = _scriptLock.AcquireSafe();
 	for (unique_ptr<ScriptHost>& script : _scripts) {
@@ -84,7 +120,28 @@ string ScriptManager::GetScriptLog(int32_t scriptId) {
 	return "";
 }
 
+uint32_t ScriptManager::GetScriptCallbackProfiles(int32_t scriptId, ScriptCallbackProfile* profiles, uint32_t maxCount) {
+	auto lock = _scriptLock.AcquireSafe();
+	for (unique_ptr<ScriptHost>& script : _scripts) {
+		if (script->GetScriptId() == scriptId) {
+			return script->GetCallbackProfiles(profiles, maxCount);
+		}
+	}
+	return 0;
+}
+
+ScriptProfileSummary ScriptManager::GetScriptProfileSummary(int32_t scriptId) {
+	auto lock = _scriptLock.AcquireSafe();
+	for (unique_ptr<ScriptHost>& script : _scripts) {
+		if (script->GetScriptId() == scriptId) {
+			return script->GetProfileSummary();
+		}
+	}
+	return {};
+}
+
 void ScriptManager::ProcessEvent(EventType type, CpuType cpuType) {
+	PROFILE_SCOPE(_profiler, ProfilerStage::Script);
 	for (unique_ptr<ScriptHost>& script : _scripts) {
 		script->ProcessEvent(type, cpuType);
 	}
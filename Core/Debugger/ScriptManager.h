@@ -2,8 +2,11 @@
 #include "pch.h"
 #include "Debugger/DebugTypes.h"
 #include "Debugger/ScriptHost.h"
+#include "Debugger/MemoryCallbackIndex.h"
+#include "Debugger/DebugUtilities.h"
 #include "Utilities/SimpleLock.h"
 #include "Shared/EventType.h"
+#include "Shared/FrameProfiler.h"
 
 class Debugger;
 enum class MemoryOperationType;
@@ -36,6 +39,9 @@ enum class MemoryOperationType;
 /// - _isCpuMemoryCallbackEnabled: Enable CPU memory hooks
 /// - _isPpuMemoryCallbackEnabled: Enable PPU memory hooks
 /// - Template for compile-time optimization (1/2/4 byte access)
+/// - _callbackIndex: merged ranges of all scripts, per CPU and callback type (unwatched addresses skip the scripts)
+/// - DMA callbacks (emu.addDmaCallback): accesses made during a DMA channel's transfer are coalesced into
+///   address ranges, the scripts get one call per range when the transfer ends (ProcessDmaBurst)
 ///
 /// Performance:
 /// - __forceinline HasScript() for hot path checks
@@ -53,17 +59,28 @@ enum class MemoryOperationType;
 class ScriptManager {
 private:
 	Debugger* _debugger = nullptr;            ///< Main debugger instance
+	FrameProfiler* _profiler = nullptr;       ///< Script time in the frame breakdown
 	bool _hasScript = false;                  ///< True if any scripts loaded
 	SimpleLock _scriptLock;                   ///< Script list access lock
 	int _nextScriptId = 0;                    ///< Next script ID counter
 	bool _isCpuMemoryCallbackEnabled = false; ///< True if any script has CPU memory callbacks
 	bool _isPpuMemoryCallbackEnabled = false; ///< True if any script has PPU memory callbacks
+	bool _isDmaCallbackEnabled = false;       ///< True if any script has DMA callbacks
 	vector<unique_ptr<ScriptHost>> _scripts;  ///< Active script instances
 
-	/// <summary>
-	/// Refresh memory callback flags based on loaded scripts.
-	/// </summary>
-	void RefreshMemoryCallbackFlags();
+	/// <summary>Watched ranges of all scripts, per CPU type and callback type</summary>
+	MemoryCallbackIndex _callbackIndex[(int)DebugUtilities::GetLastCpuType() + 1][(int)CallbackType::Exec + 1];
+
+	template <typename T>
+	__forceinline void CallMemoryCallbacks(AddressInfo relAddr, T& value, CallbackType callbackType, CpuType cpuType) {
+		if (!_callbackIndex[(int)cpuType][(int)callbackType].Contains(relAddr)) {
+			return;
+		}
+		PROFILE_SCOPE(_profiler, ProfilerStage::Script);
+		for (unique_ptr<ScriptHost>& script : _scripts) {
+			script->CallMemoryCallback(relAddr, value, callbackType, cpuType);
+		}
+	}
 
 public:
 	/// <summary>
@@ -109,6 +126,22 @@ public:
 	/// <returns>Script log text</returns>
 	string GetScriptLog(int32_t scriptId);
 
+	/// <summary>
+	/// Get call counts and time spent in each of a script's callbacks.
+	/// </summary>
+	/// <param name="scriptId">Script ID</param>
+	/// <param name="profiles">Output array</param>
+	/// <param name="maxCount">Size of the output array</param>
+	/// <returns>Number of callbacks written to the array</returns>
+	uint32_t GetScriptCallbackProfiles(int32_t scriptId, ScriptCallbackProfile* profiles, uint32_t maxCount);
+
+	/// <summary>
+	/// Get the per-frame time spent in a script's callbacks.
+	/// </summary>
+	/// <param name="scriptId">Script ID</param>
+	/// <returns>Profiling summary (all zeroes if the script doesn't exist)</returns>
+	ScriptProfileSummary GetScriptProfileSummary(int32_t scriptId);
+
 	/// <summary>
 	/// Process emulator event for scripts.
 	/// </summary>
@@ -116,6 +149,40 @@ public:
 	/// <param name="cpuType">CPU type</param>
 	void ProcessEvent(EventType type, CpuType cpuType);
 
+	/// <summary>
+	/// Refresh memory callback flags and the address index based on loaded scripts.
+	/// </summary>
+	/// <remarks>Called when scripts are reloaded/removed and when a callback is unregistered.</remarks>
+	void RefreshMemoryCallbackFlags();
+
+	/// <summary>
+	/// Add a script's memory callback to the flags and address index.
+	/// </summary>
+	/// <param name="type">Callback type</param>
+	/// <param name="callback">Registered callback</param>
+	void AddMemoryCallback(CallbackType type, const MemoryCallback& callback);
+
+	/// <summary>
+	/// Add a script's DMA callback to the flags and address index.
+	/// </summary>
+	/// <param name="type">Callback type (read or write)</param>
+	/// <param name="callback">Registered callback</param>
+	void AddDmaCallback(CallbackType type, const MemoryCallback& callback);
+
+	/// <summary>
+	/// Check if any script has DMA callbacks.
+	/// </summary>
+	/// <returns>True if callbacks enabled</returns>
+	bool HasDmaCallbacks() { return _scripts.size() && _isDmaCallbackEnabled; }
+
+	/// <summary>
+	/// Notify the scripts that a DMA channel's transfer started or ended.
+	/// </summary>
+	/// <param name="cpuType">CPU type of the DMA controller</param>
+	/// <param name="channel">DMA channel</param>
+	/// <param name="started">True when the transfer starts, false when it ends (calls the DMA callbacks)</param>
+	void ProcessDmaBurst(CpuType cpuType, uint8_t channel, bool started);
+
 	/// <summary>
 	/// Enable CPU memory callbacks.
 	/// </summary>
@@ -149,6 +216,7 @@ public:
 	/// <param name="processExec">True to process exec callbacks</param>
 	/// <remarks>
 	/// Inline for performance (called on every memory access).
+	/// Addresses outside of the ranges registered by the scripts return without calling the scripts.
 	/// Invokes script callbacks based on operation type:
 	/// - Read: Read, DmaRead, PpuRenderingRead, DummyRead
 	/// - Write: Write, DummyWrite, DmaWrite
@@ -161,25 +229,19 @@ public:
 			case MemoryOperationType::DmaRead:
 			case MemoryOperationType::PpuRenderingRead:
 			case MemoryOperationType::DummyRead:
-				for (unique_ptr<ScriptHost>& script : _scripts) {
-					script->CallMemoryCallback(relAddr, value, CallbackType::Read, cpuType);
-				}
+				CallMemoryCallbacks(relAddr, value, CallbackType::Read, cpuType);
 				break;
 
 			case MemoryOperationType::Write:
 			case MemoryOperationType::DummyWrite:
 			case MemoryOperationType::DmaWrite:
-				for (unique_ptr<ScriptHost>& script : _scripts) {
-					script->CallMemoryCallback(relAddr, value, CallbackType::Write, cpuType);
-				}
+				CallMemoryCallbacks(relAddr, value, CallbackType::Write, cpuType);
 				break;
 
 			case MemoryOperationType::ExecOpCode:
 			case MemoryOperationType::ExecOperand:
 				if (processExec) {
-					for (unique_ptr<ScriptHost>& script : _scripts) {
-						script->CallMemoryCallback(relAddr, value, CallbackType::Exec, cpuType);
-					}
+					CallMemoryCallbacks(relAddr, value, CallbackType::Exec, cpuType);
 				}
 				break;
 
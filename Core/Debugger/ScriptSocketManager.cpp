@@ -0,0 +1,164 @@
+#include "pch.h"
+#include "Debugger/ScriptSocketManager.h"
+#include "Utilities/Socket.h"
+
+ScriptSocketManager::ScriptSocketManager() {
+	_thread = std::thread(&ScriptSocketManager::ThreadLoop, this);
+}
+
+ScriptSocketManager::~ScriptSocketManager() {
+	_stop = true;
+	_signal.Signal();
+	_thread.join();
+}
+
+int ScriptSocketManager::Open(const string& host, uint16_t port, const string& delimiter) {
+	shared_ptr<Connection> conn = std::make_shared<Connection>();
+	conn->Host = host;
+	conn->Port = port;
+	conn->Delimiter = delimiter;
+
+	{
+		auto lock = _lock.AcquireSafe();
+		conn->Id = _nextId++;
+		_connections.push_back(conn);
+	}
+	_signal.Signal();
+	return conn->Id;
+}
+
+bool ScriptSocketManager::Send(int id, const char* data, size_t length) {
+	{
+		auto lock = _lock.AcquireSafe();
+		auto it = std::find_if(_connections.begin(), _connections.end(), [=](const shared_ptr<Connection>& conn) { return conn->Id == id; });
+		if (it == _connections.end() || (*it)->CloseRequested) {
+			return false;
+		}
+		(*it)->SendBuffer.append(data, length);
+	}
+	_signal.Signal();
+	return true;
+}
+
+void ScriptSocketManager::Close(int id) {
+	{
+		auto lock = _lock.AcquireSafe();
+		for (shared_ptr<Connection>& conn : _connections) {
+			if (conn->Id == id) {
+				conn->CloseRequested = true;
+			}
+		}
+	}
+	_signal.Signal();
+}
+
+void ScriptSocketManager::TakeEvents(vector<ScriptSocketEvent>& events) {
+	auto lock = _lock.AcquireSafe();
+	for (ScriptSocketEvent& evt : _events) {
+		_pendingBytes -= (uint32_t)evt.Data.size();
+		events.push_back(std::move(evt));
+	}
+	_events.clear();
+	_hasEvents = false;
+}
+
+void ScriptSocketManager::AddEvent(int id, ScriptSocketEventType type, string data) {
+	auto lock = _lock.AcquireSafe();
+	_pendingBytes += (uint32_t)data.size();
+	_events.push_back({id, type, std::move(data)});
+	_hasEvents = true;
+}
+
+void ScriptSocketManager::ThreadLoop() {
+	vector<char> buffer(0x10000);
+	vector<shared_ptr<Connection>> connections;
+	while (!_stop) {
+		{
+			auto lock = _lock.AcquireSafe();
+			connections = _connections;
+		}
+
+		bool active = false;
+		for (shared_ptr<Connection>& conn : connections) {
+			if (_stop) {
+				break;
+			}
+
+			if (ProcessConnection(*conn, buffer)) {
+				active = true;
+			} else {
+				auto lock = _lock.AcquireSafe();
+				_connections.erase(std::remove(_connections.begin(), _connections.end(), conn), _connections.end());
+			}
+		}
+		connections.clear();
+
+		// Poll the sockets every few milliseconds, wake up immediately when the script opens/sends/closes a socket
+		_signal.Wait(active ? 5 : 0);
+	}
+}
+
+bool ScriptSocketManager::ProcessConnection(Connection& conn, vector<char>& buffer) {
+	if (!conn.Sock) {
+		// Connecting can take a few seconds (e.g remote host unavailable), this only delays the other sockets
+		conn.Sock.reset(new Socket());
+		if (!conn.Sock->Connect(conn.Host.c_str(), conn.Port)) {
+			AddEvent(conn.Id, ScriptSocketEventType::Closed, "Could not connect to " + conn.Host + ":" + std::to_string(conn.Port));
+			return false;
+		}
+		AddEvent(conn.Id, ScriptSocketEventType::Connected, "");
+	}
+
+	string sendBuffer;
+	bool closeRequested;
+	{
+		auto lock = _lock.AcquireSafe();
+		sendBuffer.swap(conn.SendBuffer);
+		closeRequested = conn.CloseRequested;
+	}
+
+	if (!sendBuffer.empty()) {
+		conn.Sock->Send(sendBuffer.data(), (int)sendBuffer.size(), 0);
+	}
+
+	if (closeRequested) {
+		conn.Sock->Close();
+		AddEvent(conn.Id, ScriptSocketEventType::Closed, "Closed by script");
+		return false;
+	}
+
+	while (!conn.Sock->ConnectionError() && _pendingBytes < ScriptSocketManager::MaxPendingBytes) {
+		int received = conn.Sock->Recv(buffer.data(), (int)buffer.size(), 0);
+		if (received <= 0) {
+			break;
+		}
+		conn.ReceiveBuffer.append(buffer.data(), received);
+		ReadMessages(conn);
+	}
+
+	if (conn.Sock->ConnectionError()) {
+		if (!conn.ReceiveBuffer.empty()) {
+			// Send the end of the stream, even if it doesn't end with the delimiter
+			AddEvent(conn.Id, ScriptSocketEventType::Data, std::move(conn.ReceiveBuffer));
+		}
+		AddEvent(conn.Id, ScriptSocketEventType::Closed, "Connection closed");
+		return false;
+	}
+	return true;
+}
+
+void ScriptSocketManager::ReadMessages(Connection& conn) {
+	if (conn.Delimiter.empty()) {
+		AddEvent(conn.Id, ScriptSocketEventType::Data, std::move(conn.ReceiveBuffer));
+		conn.ReceiveBuffer.clear();
+		return;
+	}
+
+	size_t start = 0;
+	size_t pos;
+	while ((pos = conn.ReceiveBuffer.find(conn.Delimiter, start)) != string::npos) {
+		AddEvent(conn.Id, ScriptSocketEventType::Data, conn.ReceiveBuffer.substr(start, pos - start));
+		start = pos + conn.Delimiter.size();
+	}
+	conn.ReceiveBuffer.erase(0, start);
+}
@@ -0,0 +1,89 @@
+#pragma once
+#include "pch.h"
+#include <atomic>
+#include <thread>
+#include "Utilities/AutoResetEvent.h"
+#include "Utilities/SimpleLock.h"
+
+class Socket;
+
+enum class ScriptSocketEventType {
+	Connected,
+	Data,
+	Closed
+};
+
+/// <summary>
+/// Connection status change or data received by one of a script's sockets.
+/// </summary>
+struct ScriptSocketEvent {
+	int Id;
+	ScriptSocketEventType Type;
+	string Data; ///< Received data (Data), or the reason the connection was closed (Closed)
+};
+
+/// <summary>
+/// TCP connections opened by a script (emu.openSocket), serviced on a network thread.
+/// </summary>
+/// <remarks>
+/// Connecting, sending and receiving never block the emulation thread: the script only queues data to send, and
+/// the network thread queues events (connected, data received, closed) that ScriptingContext dispatches to the
+/// script's callbacks at the end of each frame.
+///
+/// When a delimiter is given, received data is split into messages (without the delimiter), otherwise each event
+/// contains whatever data was received since the last event. Reading stops while too much data is waiting to be
+/// dispatched (e.g while the emulation is paused), so a fast sender can't use up all the memory.
+/// </remarks>
+class ScriptSocketManager {
+private:
+	static constexpr uint32_t MaxPendingBytes = 16 * 1024 * 1024;
+
+	struct Connection {
+		int Id = 0;
+		string Host;
+		uint16_t Port = 0;
+		string Delimiter;
+
+		// Only used by the network thread
+		unique_ptr<Socket> Sock;
+		string ReceiveBuffer;
+
+		// Protected by _lock
+		string SendBuffer;
+		bool CloseRequested = false;
+	};
+
+	SimpleLock _lock;
+	vector<shared_ptr<Connection>> _connections;
+	vector<ScriptSocketEvent> _events;
+	int _nextId = 1;
+
+	std::thread _thread;
+	AutoResetEvent _signal;
+	std::atomic<bool> _stop = false;
+	std::atomic<bool> _hasEvents = false;
+	std::atomic<uint32_t> _pendingBytes = 0;
+
+	void ThreadLoop();
+	bool ProcessConnection(Connection& conn, vector<char>& buffer);
+	void AddEvent(int id, ScriptSocketEventType type, string data);
+	void ReadMessages(Connection& conn);
+
+public:
+	ScriptSocketManager();
+	~ScriptSocketManager();
+
+	/// <summary>Starts connecting to host:port on the network thread, returns the socket's id</summary>
+	int Open(const string& host, uint16_t port, const string& delimiter);
+
+	/// <summary>Queues data to send, returns false if the socket is closed (or unknown)</summary>
+	bool Send(int id, const char* data, size_t length);
+
+	/// <summary>Closes the socket, a Closed event is sent once it's closed</summary>
+	void Close(int id);
+
+	[[nodiscard]] bool HasEvents() const { return _hasEvents; }
+
+	/// <summary>Moves the events received since the last call into events (in order)</summary>
+	void TakeEvents(vector<ScriptSocketEvent>& events);
+};
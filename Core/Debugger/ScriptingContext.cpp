@@ -6,6 +6,7 @@
 #include "Debugger/ScriptingContext.h"
 #include "Debugger/LuaApi.h"
 #include "Debugger/LuaCallHelper.h"
+#include "Debugger/LuaBytecodeCache.h"
 #include "Debugger/DebugTypes.h"
 #include "Debugger/Debugger.h"
 #include "Debugger/ScriptManager.h"
@@ -16,7 +17,7 @@
 #include "Utilities/magic_enum.hpp"
 #include "Utilities/StringUtilities.h"
 
-ScriptingContext* ScriptingContext::_context = nullptr;
+thread_local ScriptingContext* ScriptingContext::_context = nullptr;
 
 ScriptingContext::ScriptingContext(Debugger* debugger) {
 	_debugger = debugger;
@@ -26,6 +27,9 @@ ScriptingContext::ScriptingContext(Debugger* debugger) {
 }
 
 ScriptingContext::~ScriptingContext() {
+	StopAsyncThread();
+	_socketManager.reset();
+
 	if (_lua) {
 		// Cleanup all references, this is required to prevent crashes that can occur when calling lua_close
 		std::unordered_set<int> references;
@@ -36,11 +40,15 @@ ScriptingContext::~ScriptingContext() {
 		}
 
 		for (auto& entry : magic_enum::enum_entries<EventType>()) {
-			for (int& ref : _eventCallbacks[(int)entry.first]) {
-				references.emplace(ref);
+			for (EventCallback& callback : _eventCallbacks[(int)entry.first]) {
+				references.emplace(callback.Reference);
 			}
 		}
 
+		for (auto& socketCallback : _socketCallbacks) {
+			references.emplace(socketCallback.second);
+		}
+
 		for (const int& ref : references) {
 			luaL_unref(_lua, LUA_REGISTRYINDEX, ref);
 		}
@@ -83,17 +91,29 @@ bool ScriptingContext::LoadScript(const string& scriptName, const string& path,
 		// using require() without specifying an absolute path, etc.
 		string cmd = "package.path = package.path .. ';" + escapedPath + "?.lua'";
 		luaL_dostring(_lua, cmd.c_str());
+
+		// Load require()'d modules through the bytecode cache
+		LuaBytecodeCache::InstallModuleSearcher(_lua);
 	}
 
 	luaL_requiref(_lua, "emu", LuaApi::GetLibrary, 1);
 	Log("Loading script...");
-	if ((iErr = luaL_loadbufferx(_lua, scriptContent.c_str(), scriptContent.size(), ("@" + scriptName).c_str(), nullptr)) == 0) {
+	if ((iErr = LuaBytecodeCache::Load(_lua, scriptContent, "@" + scriptName)) == 0) {
 		_timer.Reset();
 		lua_setwatchdogtimer(_lua, ScriptingContext::ExecutionCountHook, 1000);
 		if ((iErr = lua_pcall(_lua, 0, LUA_MULTRET, 0)) == 0) {
 			// Script loaded properly
 			Log("Script loaded successfully.");
 			_initDone = true;
+			_gcStepBudget = settings->GetDebugConfig().ScriptGcStepBudget;
+			if (_gcStepBudget > 0) {
+				// Collect garbage between frames instead of during the callbacks
+				lua_gc(_lua, LUA_GCSTOP);
+				_gcHeapBaseline = lua_gc(_lua, LUA_GCCOUNT);
+			}
+			if (_asyncMode) {
+				_asyncThread = std::thread(&ScriptingContext::AsyncThreadLoop, this);
+			}
 			return true;
 		}
 	}
@@ -197,6 +217,10 @@ string ScriptingContext::GetScriptName() {
 
 template <typename T>
 void ScriptingContext::CallMemoryCallback(AddressInfo relAddr, T& value, CallbackType type, CpuType cpuType) {
+	if (!_dmaChannels.empty() && type != CallbackType::Exec && cpuType == _dmaCpuType && !_dmaCallbacks[(int)type].empty()) {
+		AddDmaAccess(relAddr, sizeof(T), type, cpuType);
+	}
+
 	_allowSaveState = type == CallbackType::Exec && cpuType == _defaultCpuType;
 	InternalCallMemoryCallback(relAddr, value, type, cpuType);
 	_allowSaveState = false;
@@ -222,23 +246,20 @@ void ScriptingContext::RegisterMemoryCallback(CallbackType type, int startAddr,
 	callback.Cpu = cpuType;
 	callback.MemType = memType;
 
-	if (DebugUtilities::IsPpuMemory(memType)) {
-		_debugger->GetScriptManager()->EnablePpuMemoryCallbacks();
-	} else {
-		_debugger->GetScriptManager()->EnableCpuMemoryCallbacks();
-	}
-
+	_debugger->GetScriptManager()->AddMemoryCallback(type, callback);
+	auto lock = _callbackLock.AcquireSafe();
 	_callbacks[(int)type].push_back(callback);
 }
 
 void ScriptingContext::RefreshMemoryCallbackFlags() {
 	for (int i = (int)CallbackType::Read; i <= (int)CallbackType::Exec; i++) {
-		for (size_t j = 0, len = _callbacks[i].size(); j < len; j++) {
-			if (DebugUtilities::IsPpuMemory(_callbacks[i][j].MemType)) {
-				_debugger->GetScriptManager()->EnablePpuMemoryCallbacks();
-			} else {
-				_debugger->GetScriptManager()->EnableCpuMemoryCallbacks();
-			}
+		for (MemoryCallback& callback : _callbacks[i]) {
+			_debugger->GetScriptManager()->AddMemoryCallback((CallbackType)i, callback);
+		}
+	}
+	for (int i = (int)CallbackType::Read; i <= (int)CallbackType::Write; i++) {
+		for (DmaCallback& callback : _dmaCallbacks[i]) {
+			_debugger->GetScriptManager()->AddDmaCallback((CallbackType)i, callback.Callback);
 		}
 	}
 }
@@ -257,7 +278,51 @@ void ScriptingContext::UnregisterMemoryCallback(CallbackType type, int startAddr
 		                (int)callback.EndAddress == endAddr);
 
 		if (isMatch) {
+			auto lock = _callbackLock.AcquireSafe();
 			_callbacks[(int)type].erase(_callbacks[(int)type].begin() + i);
+			_debugger->GetScriptManager()->RefreshMemoryCallbackFlags();
+			break;
+		}
+	}
+
+	luaL_unref(_lua, LUA_REGISTRYINDEX, reference);
+}
+
+void ScriptingContext::RegisterDmaCallback(CallbackType type, int startAddr, int endAddr, MemoryType memType, CpuType cpuType, int reference) {
+	if (endAddr < startAddr || type == CallbackType::Exec) {
+		return;
+	}
+
+	DmaCallback callback;
+	callback.Callback.StartAddress = (uint32_t)startAddr;
+	callback.Callback.EndAddress = (uint32_t)endAddr;
+	callback.Callback.Reference = reference;
+	callback.Callback.Cpu = cpuType;
+	callback.Callback.MemType = memType;
+
+	_debugger->GetScriptManager()->AddDmaCallback(type, callback.Callback);
+	auto lock = _callbackLock.AcquireSafe();
+	_dmaCallbacks[(int)type].push_back(callback);
+}
+
+void ScriptingContext::UnregisterDmaCallback(CallbackType type, int startAddr, int endAddr, MemoryType memType, CpuType cpuType, int reference) {
+	if (endAddr < startAddr || type == CallbackType::Exec) {
+		return;
+	}
+
+	vector<DmaCallback>& callbacks = _dmaCallbacks[(int)type];
+	for (size_t i = 0; i < callbacks.size(); i++) {
+		MemoryCallback& callback = callbacks[i].Callback;
+		bool isMatch = (callback.Reference == reference &&
+		                callback.Cpu == cpuType &&
+		                callback.MemType == memType &&
+		                (int)callback.StartAddress == startAddr &&
+		                (int)callback.EndAddress == endAddr);
+
+		if (isMatch) {
+			auto lock = _callbackLock.AcquireSafe();
+			callbacks.erase(callbacks.begin() + i);
+			_debugger->GetScriptManager()->RefreshMemoryCallbackFlags();
 			break;
 		}
 	}
@@ -265,13 +330,104 @@ void ScriptingContext::UnregisterMemoryCallback(CallbackType type, int startAddr
 	luaL_unref(_lua, LUA_REGISTRYINDEX, reference);
 }
 
+void ScriptingContext::ProcessDmaBurst(CpuType cpuType, uint8_t channel, bool started) {
+	if (started) {
+		// Report what the interrupted transfer accessed so far, the ranges of both transfers don't get merged
+		FlushDmaCallbacks();
+		_dmaCpuType = cpuType;
+		_dmaChannels.push_back(channel);
+	} else if (!_dmaChannels.empty()) {
+		FlushDmaCallbacks();
+		_dmaChannels.pop_back();
+	}
+}
+
+void ScriptingContext::AddDmaAccess(AddressInfo relAddr, uint32_t width, CallbackType type, CpuType cpuType) {
+	// Iterate by index, calling a callback can add or remove callbacks
+	vector<DmaCallback>& callbacks = _dmaCallbacks[(int)type];
+	for (size_t i = 0; i < callbacks.size(); i++) {
+		MemoryCallback& callback = callbacks[i].Callback;
+		if (callback.Cpu != cpuType) {
+			continue;
+		}
+
+		AddressInfo addr = DebugUtilities::IsRelativeMemory(callback.MemType) ? relAddr : _debugger->GetAbsoluteAddress(relAddr);
+		if (!IsAddressMatch(callback, addr)) {
+			continue;
+		}
+
+		uint32_t start = (uint32_t)addr.Address;
+		uint32_t end = std::min(start + width - 1, callback.EndAddress);
+		if (callbacks[i].HasRange) {
+			if (start <= callbacks[i].RangeEnd + 1 && end + 1 >= callbacks[i].RangeStart) {
+				// Contiguous with (or inside) the current range, e.g the next byte, or a fixed address (register)
+				callbacks[i].RangeStart = std::min(callbacks[i].RangeStart, start);
+				callbacks[i].RangeEnd = std::max(callbacks[i].RangeEnd, end);
+				continue;
+			}
+
+			// The transfer jumped to another address (e.g VRAM address increment larger than 1), report the current range first
+			int reference = callback.Reference;
+			CallDmaCallback(type, i);
+			if (i >= callbacks.size() || callbacks[i].Callback.Reference != reference) {
+				continue;
+			}
+		}
+
+		callbacks[i].HasRange = true;
+		callbacks[i].RangeStart = start;
+		callbacks[i].RangeEnd = end;
+	}
+}
+
+void ScriptingContext::FlushDmaCallbacks() {
+	for (int i = (int)CallbackType::Read; i <= (int)CallbackType::Write; i++) {
+		for (size_t j = 0; j < _dmaCallbacks[i].size(); j++) {
+			if (_dmaCallbacks[i][j].HasRange) {
+				CallDmaCallback((CallbackType)i, j);
+			}
+		}
+	}
+}
+
+void ScriptingContext::CallDmaCallback(CallbackType type, size_t index) {
+	DmaCallback& callback = _dmaCallbacks[(int)type][index];
+	callback.HasRange = false;
+	int reference = callback.Callback.Reference;
+	uint32_t start = callback.RangeStart;
+	uint32_t length = callback.RangeEnd - callback.RangeStart + 1;
+
+	_context = this;
+	lua_setwatchdogtimer(_lua, ScriptingContext::ExecutionCountHook, 1000);
+	LuaApi::SetContext(this);
+	_timer.Reset();
+
+	Timer callTimer;
+	lua_rawgeti(_lua, LUA_REGISTRYINDEX, reference);
+	lua_pushinteger(_lua, start);
+	lua_pushinteger(_lua, length);
+	lua_pushinteger(_lua, _dmaChannels.back());
+	if (lua_pcall(_lua, 3, 0, 0) != 0) {
+		ProcessLuaError();
+	}
+
+	double time = callTimer.GetElapsedMS();
+	_frameTime += time;
+	vector<DmaCallback>& callbacks = _dmaCallbacks[(int)type];
+	if (index < callbacks.size() && callbacks[index].Callback.Reference == reference) {
+		callbacks[index].Callback.Stats.Add(time);
+	}
+}
+
 void ScriptingContext::RegisterEventCallback(EventType type, int reference) {
-	_eventCallbacks[(int)type].push_back(reference);
+	auto lock = _callbackLock.AcquireSafe();
+	_eventCallbacks[(int)type].push_back({reference});
 }
 
 void ScriptingContext::UnregisterEventCallback(EventType type, int reference) {
-	vector<int>& callbacks = _eventCallbacks[(int)type];
-	callbacks.erase(std::remove(callbacks.begin(), callbacks.end(), reference), callbacks.end());
+	auto lock = _callbackLock.AcquireSafe();
+	vector<EventCallback>& callbacks = _eventCallbacks[(int)type];
+	callbacks.erase(std::remove_if(callbacks.begin(), callbacks.end(), [=](const EventCallback& callback) { return callback.Reference == reference; }), callbacks.end());
 	luaL_unref(_lua, LUA_REGISTRYINDEX, reference);
 }
 
@@ -289,7 +445,10 @@ void ScriptingContext::InternalCallMemoryCallback(AddressInfo relAddr, T& value,
 	bool needTimerReset = true;
 	lua_setwatchdogtimer(_lua, ScriptingContext::ExecutionCountHook, 1000);
 	LuaApi::SetContext(this);
-	for (MemoryCallback& callback : _callbacks[(int)type]) {
+	// Iterate by index, a callback can add or remove callbacks (which can reallocate the vector)
+	vector<MemoryCallback>& callbacks = _callbacks[(int)type];
+	for (size_t i = 0; i < callbacks.size(); i++) {
+		MemoryCallback& callback = callbacks[i];
 		if (callback.Cpu != cpuType) {
 			continue;
 		}
@@ -309,8 +468,10 @@ void ScriptingContext::InternalCallMemoryCallback(AddressInfo relAddr, T& value,
 			needTimerReset = false;
 		}
 
+		int reference = callback.Reference;
+		Timer callTimer;
 		int top = lua_gettop(_lua);
-		lua_rawgeti(_lua, LUA_REGISTRYINDEX, callback.Reference);
+		lua_rawgeti(_lua, LUA_REGISTRYINDEX, reference);
 		lua_pushinteger(_lua, relAddr.Address);
 		lua_pushinteger(_lua, value);
 		if (lua_pcall(_lua, 2, LUA_MULTRET, 0) != 0) {
@@ -323,11 +484,36 @@ void ScriptingContext::InternalCallMemoryCallback(AddressInfo relAddr, T& value,
 			}
 			lua_settop(_lua, top);
 		}
+
+		double time = callTimer.GetElapsedMS();
+		_frameTime += time;
+		if (i < callbacks.size() && callbacks[i].Reference == reference) {
+			callbacks[i].Stats.Add(time);
+		}
 	}
 }
 
 int ScriptingContext::CallEventCallback(EventType type, CpuType cpuType) {
-	if (_eventCallbacks[(int)type].empty()) {
+	if (_asyncThread.joinable()) {
+		if (type == EventType::EndFrame) {
+			QueueAsyncFrame(cpuType);
+			return 0;
+		} else if (type != EventType::ScriptEnded) {
+			// Only end of frame and script ended callbacks can be registered in async mode
+			return 0;
+		}
+		// Wait for the worker to finish, the script ended callbacks run on the emulation thread
+		StopAsyncThread();
+	}
+	return RunEventCallbacks(type, cpuType);
+}
+
+int ScriptingContext::RunEventCallbacks(EventType type, CpuType cpuType) {
+	bool hasSocketEvents = type == EventType::EndFrame && _socketManager && _socketManager->HasEvents();
+	if (_eventCallbacks[(int)type].empty() && !hasSocketEvents) {
+		if (type == EventType::EndFrame) {
+			EndProfileFrame();
+		}
 		return 0;
 	}
 
@@ -336,16 +522,257 @@ int ScriptingContext::CallEventCallback(EventType type, CpuType cpuType) {
 	lua_setwatchdogtimer(_lua, ScriptingContext::ExecutionCountHook, 1000);
 	LuaApi::SetContext(this);
 	LuaCallHelper l(_lua);
-	for (int& ref : _eventCallbacks[(int)type]) {
-		lua_rawgeti(_lua, LUA_REGISTRYINDEX, ref);
+	if (hasSocketEvents) {
+		ProcessSocketEvents();
+	}
+
+	vector<EventCallback>& callbacks = _eventCallbacks[(int)type];
+	for (size_t i = 0; i < callbacks.size(); i++) {
+		int reference = callbacks[i].Reference;
+		Timer callTimer;
+		lua_rawgeti(_lua, LUA_REGISTRYINDEX, reference);
 		lua_pushinteger(_lua, (int)cpuType);
 		if (lua_pcall(_lua, 1, 0, 0) != 0) {
 			ProcessLuaError();
 		}
+
+		double time = callTimer.GetElapsedMS();
+		_frameTime += time;
+		if (i < callbacks.size() && callbacks[i].Reference == reference) {
+			callbacks[i].Stats.Add(time);
+		}
+	}
+
+	if (type == EventType::EndFrame) {
+		EndProfileFrame();
 	}
 	return l.ReturnCount();
 }
 
+bool ScriptingContext::EnableAsyncMode(const vector<MemoryType>& memTypes, string& error) {
+	for (int i = (int)CallbackType::Read; i <= (int)CallbackType::Exec; i++) {
+		if (!_callbacks[i].empty() || (i != (int)CallbackType::Exec && !_dmaCallbacks[i].empty())) {
+			error = "memory callbacks can't be used with async frame callbacks";
+			return false;
+		}
+	}
+	for (int i = 0; i <= (int)EventType::LastValue; i++) {
+		if (!_eventCallbacks[i].empty() && i != (int)EventType::EndFrame && i != (int)EventType::ScriptEnded) {
+			error = "only endFrame and scriptEnded callbacks can be used with async frame callbacks";
+			return false;
+		}
+	}
+
+	Emulator* emu = _debugger->GetEmulator();
+	vector<ScriptMemorySnapshot> snapshots;
+	for (MemoryType memType : memTypes) {
+		ConsoleMemoryInfo mem = emu->GetMemory(memType);
+		if (!mem.Memory || mem.Size == 0) {
+			error = "memory type " + string(magic_enum::enum_name(memType)) + " can't be copied to a snapshot";
+			return false;
+		}
+		auto it = std::find_if(snapshots.begin(), snapshots.end(), [=](const ScriptMemorySnapshot& snapshot) { return snapshot.MemType == memType; });
+		if (it == snapshots.end()) {
+			snapshots.push_back({memType, vector<uint8_t>(mem.Size)});
+		}
+	}
+
+	_snapshots = std::move(snapshots);
+	_asyncMode = true;
+	return true;
+}
+
+const uint8_t* ScriptingContext::GetSnapshotData(MemoryType memType, uint32_t address, uint32_t length) {
+	for (ScriptMemorySnapshot& snapshot : _snapshots) {
+		if (snapshot.MemType == memType) {
+			return (uint64_t)address + length <= snapshot.Data.size() ? snapshot.Data.data() + address : nullptr;
+		}
+	}
+	return nullptr;
+}
+
+void ScriptingContext::QueueAsyncFrame(CpuType cpuType) {
+	if (_asyncBusy) {
+		// The previous frame's callbacks are still running, skip this frame rather than slowing down the emulation
+		_profile.FramesSkipped++;
+		return;
+	}
+
+	// The worker is idle, the snapshots can be updated without locking
+	Emulator* emu = _debugger->GetEmulator();
+	for (ScriptMemorySnapshot& snapshot : _snapshots) {
+		ConsoleMemoryInfo mem = emu->GetMemory(snapshot.MemType);
+		uint32_t size = std::min<uint32_t>(mem.Size, (uint32_t)snapshot.Data.size());
+		if (mem.Memory && size > 0) {
+			memcpy(snapshot.Data.data(), mem.Memory, size);
+		}
+	}
+
+	_asyncCpuType = cpuType;
+	_asyncBusy = true;
+	_asyncSignal.Signal();
+}
+
+void ScriptingContext::AsyncThreadLoop() {
+	while (true) {
+		_asyncSignal.Wait();
+		if (_asyncStop) {
+			break;
+		}
+		RunEventCallbacks(EventType::EndFrame, _asyncCpuType);
+		_asyncBusy = false;
+	}
+}
+
+void ScriptingContext::StopAsyncThread() {
+	if (_asyncThread.joinable()) {
+		_asyncStop = true;
+		_asyncSignal.Signal();
+		_asyncThread.join();
+	}
+}
+
+int ScriptingContext::OpenSocket(const string& host, uint16_t port, const string& delimiter, int reference) {
+	if (!_socketManager) {
+		_socketManager.reset(new ScriptSocketManager());
+	}
+	int id = _socketManager->Open(host, port, delimiter);
+	_socketCallbacks[id] = reference;
+	return id;
+}
+
+bool ScriptingContext::SendSocket(int id, const char* data, size_t length) {
+	return _socketManager && _socketManager->Send(id, data, length);
+}
+
+void ScriptingContext::CloseSocket(int id) {
+	if (_socketManager) {
+		_socketManager->Close(id);
+	}
+}
+
+void ScriptingContext::ProcessSocketEvents() {
+	_socketManager->TakeEvents(_socketEvents);
+	for (ScriptSocketEvent& evt : _socketEvents) {
+		auto result = _socketCallbacks.find(evt.Id);
+		if (result == _socketCallbacks.end()) {
+			continue;
+		}
+
+		Timer callTimer;
+		lua_rawgeti(_lua, LUA_REGISTRYINDEX, result->second);
+		lua_pushinteger(_lua, evt.Id);
+		lua_pushinteger(_lua, (int)evt.Type);
+		lua_pushlstring(_lua, evt.Data.c_str(), evt.Data.size());
+		if (lua_pcall(_lua, 3, 0, 0) != 0) {
+			ProcessLuaError();
+		}
+		_frameTime += callTimer.GetElapsedMS();
+
+		if (evt.Type == ScriptSocketEventType::Closed) {
+			// Last event for this socket
+			result = _socketCallbacks.find(evt.Id);
+			if (result != _socketCallbacks.end()) {
+				luaL_unref(_lua, LUA_REGISTRYINDEX, result->second);
+				_socketCallbacks.erase(result);
+			}
+		}
+	}
+	_socketEvents.clear();
+}
+
+void ScriptingContext::RunFrameGc() {
+	if (_gcStepBudget == 0 || lua_gc(_lua, LUA_GCISRUNNING)) {
+		// Automatic collector (disabled in the settings, or restarted by the script with collectgarbage())
+		return;
+	}
+
+	// Finalizers (__gc) can run Lua code
+	_context = this;
+	lua_setwatchdogtimer(_lua, ScriptingContext::ExecutionCountHook, 1000);
+	LuaApi::SetContext(this);
+	_timer.Reset();
+
+	// When the script allocates faster than the budget allows to collect, finish the cycle to keep the heap bounded
+	bool finishCycle = lua_gc(_lua, LUA_GCCOUNT) > _gcHeapBaseline * 2;
+	double budget = _gcStepBudget / 1000.0;
+	Timer gcTimer;
+	while (true) {
+		if (lua_gc(_lua, LUA_GCSTEP, 0)) {
+			// Cycle completed
+			_gcHeapBaseline = lua_gc(_lua, LUA_GCCOUNT);
+			break;
+		}
+		if (!finishCycle && gcTimer.GetElapsedMS() >= budget) {
+			break;
+		}
+	}
+
+	double time = gcTimer.GetElapsedMS();
+	_profile.LastGcTime = time;
+	_profile.MaxGcTime = std::max(_profile.MaxGcTime, time);
+	_profile.TotalGcTime += time;
+}
+
+void ScriptingContext::EndProfileFrame() {
+	RunFrameGc();
+
+	_profile.FrameCount++;
+	_profile.LastFrameTime = _frameTime;
+	_profile.MaxFrameTime = std::max(_profile.MaxFrameTime, _frameTime);
+	_profile.TotalTime += _frameTime;
+
+	uint32_t budget = _settings->GetDebugConfig().ScriptFrameBudget;
+	if (budget > 0 && _frameTime > budget) {
+		_profile.FramesOverBudget++;
+		// Warn at most once every 300 frames (~5 seconds)
+		if (_lastBudgetWarningFrame == 0 || _profile.FrameCount - _lastBudgetWarningFrame >= 300) {
+			_lastBudgetWarningFrame = _profile.FrameCount;
+			std::stringstream msg;
+			msg << std::fixed << std::setprecision(2) << "Warning: script callbacks took " << _frameTime << " ms during frame " << _profile.FrameCount << " (budget: " << budget << " ms)";
+			Log(msg.str());
+		}
+	}
+	_frameTime = 0;
+}
+
+uint32_t ScriptingContext::GetCallbackProfiles(ScriptCallbackProfile* profiles, uint32_t maxCount) {
+	auto lock = _callbackLock.AcquireSafe();
+	uint32_t count = 0;
+	for (int i = (int)CallbackType::Read; i <= (int)CallbackType::Exec; i++) {
+		for (MemoryCallback& callback : _callbacks[i]) {
+			if (count < maxCount) {
+				profiles[count] = {i, 0, callback.MemType, callback.StartAddress, callback.EndAddress, callback.Stats.CallCount, callback.Stats.TotalTime, callback.Stats.MaxTime};
+			}
+			count++;
+		}
+	}
+
+	for (int i = (int)CallbackType::Read; i <= (int)CallbackType::Write; i++) {
+		for (DmaCallback& dmaCallback : _dmaCallbacks[i]) {
+			MemoryCallback& callback = dmaCallback.Callback;
+			if (count < maxCount) {
+				profiles[count] = {i, 0, callback.MemType, callback.StartAddress, callback.EndAddress, callback.Stats.CallCount, callback.Stats.TotalTime, callback.Stats.MaxTime};
+			}
+			count++;
+		}
+	}
+
+	for (int i = 0; i < (int)EventType::LastValue; i++) {
+		for (EventCallback& callback : _eventCallbacks[i]) {
+			if (count < maxCount) {
+				profiles[count] = {-1, i, MemoryType::None, 0, 0, callback.Stats.CallCount, callback.Stats.TotalTime, callback.Stats.MaxTime};
+			}
+			count++;
+		}
+	}
+	return std::min(count, maxCount);
+}
+
+ScriptProfileSummary ScriptingContext::GetProfileSummary() {
+	return _profile;
+}
+
 template void ScriptingContext::CallMemoryCallback<uint8_t>(AddressInfo relAddr, uint8_t& value, CallbackType type, CpuType cpuType);
 template void ScriptingContext::CallMemoryCallback<uint16_t>(AddressInfo relAddr, uint16_t& value, CallbackType type, CpuType cpuType);
 template void ScriptingContext::CallMemoryCallback<uint32_t>(AddressInfo relAddr, uint32_t& value, CallbackType type, CpuType cpuType);
@@ -1,13 +1,18 @@
 #pragma once
 #include "pch.h"
 #include <deque>
+#include <thread>
+#include <atomic>
+#include "Utilities/AutoResetEvent.h"
 #include "Utilities/SimpleLock.h"
 #include "Utilities/Timer.h"
 #include "Debugger/DebugTypes.h"
+#include "Debugger/ScriptSocketManager.h"
 #include "Shared/EventType.h"
 
 class Debugger;
 struct lua_State;
+enum class SerializeMapValueFormat;
 
 enum class CallbackType {
 	Read = 0,
@@ -15,12 +20,80 @@ enum class CallbackType {
 	Exec = 2
 };
 
+/// <summary>
+/// Call count and wall time (in milliseconds) spent in a script callback.
+/// </summary>
+struct ScriptCallbackStats {
+	uint64_t CallCount = 0;
+	double TotalTime = 0;
+	double MaxTime = 0;
+
+	void Add(double time) {
+		CallCount++;
+		TotalTime += time;
+		MaxTime = std::max(MaxTime, time);
+	}
+};
+
 struct MemoryCallback {
 	uint32_t StartAddress;
 	uint32_t EndAddress;
 	CpuType Cpu;
 	MemoryType MemType;
 	int Reference;
+	ScriptCallbackStats Stats;
+};
+
+/// <summary>
+/// Memory callback called once per address range accessed during a DMA transfer (emu.addDmaCallback).
+/// </summary>
+struct DmaCallback {
+	MemoryCallback Callback;
+	bool HasRange = false; ///< True if the current transfer accessed the callback's range
+	uint32_t RangeStart = 0;
+	uint32_t RangeEnd = 0; ///< Inclusive
+};
+
+struct EventCallback {
+	int Reference;
+	ScriptCallbackStats Stats;
+};
+
+/// <summary>
+/// Profiling data for one of a script's callbacks (interop).
+/// </summary>
+struct ScriptCallbackProfile {
+	int32_t Type;          ///< CallbackType for memory callbacks, -1 for event callbacks
+	int32_t Event;         ///< EventType (event callbacks only)
+	MemoryType MemType;    ///< Memory type (memory callbacks only)
+	uint32_t StartAddress; ///< Range start (memory callbacks only)
+	uint32_t EndAddress;   ///< Range end, inclusive (memory callbacks only)
+	uint64_t CallCount;
+	double TotalTime; ///< Total wall time spent in the callback (ms)
+	double MaxTime;   ///< Longest single call (ms)
+};
+
+/// <summary>
+/// Time spent in all of a script's callbacks, per emulated frame (interop).
+/// </summary>
+struct ScriptProfileSummary {
+	uint64_t FrameCount;
+	uint64_t FramesOverBudget; ///< Frames that exceeded the per-frame budget (DebugConfig::ScriptFrameBudget)
+	double LastFrameTime;      ///< Time spent in the callbacks during the last frame (ms)
+	double MaxFrameTime;       ///< Longest frame (ms)
+	double TotalTime;          ///< Total time spent in the callbacks (ms)
+	uint64_t FramesSkipped;    ///< Frames not processed because the async frame callbacks were still running
+	double LastGcTime;         ///< Time spent collecting garbage at the end of the last frame (ms, DebugConfig::ScriptGcStepBudget)
+	double MaxGcTime;          ///< Longest end of frame collection (ms)
+	double TotalGcTime;        ///< Total time spent in end of frame collections (ms)
+};
+
+/// <summary>
+/// Copy of a memory type taken at the end of a frame, read by the async frame callbacks.
+/// </summary>
+struct ScriptMemorySnapshot {
+	MemoryType MemType;
+	vector<uint8_t> Data;
 };
 
 enum class ScriptDrawSurface {
@@ -30,7 +103,8 @@ enum class ScriptDrawSurface {
 
 class ScriptingContext {
 private:
-	static ScriptingContext* _context;
+	// Thread local, async frame callbacks run on the script's worker thread
+	static thread_local ScriptingContext* _context;
 	lua_State* _lua = nullptr;
 	Timer _timer;
 	EmuSettings* _settings = nullptr;
@@ -45,7 +119,48 @@ private:
 
 	ScriptDrawSurface _drawSurface = ScriptDrawSurface::ConsoleScreen;
 
+	SimpleLock _callbackLock; ///< Held while callbacks are added/removed, and while profiling data is read by the UI
+	ScriptProfileSummary _profile = {};
+	double _frameTime = 0;
+	uint64_t _lastBudgetWarningFrame = 0;
+
+	// Frame aligned garbage collection: the automatic collector is stopped, and stepped at the end of each frame instead
+	uint32_t _gcStepBudget = 0; ///< Time budget for the collector steps at the end of each frame (us, 0 = automatic collector)
+	int _gcHeapBaseline = 0;    ///< Heap size after the last completed cycle (KB)
+
+	// Async frame callbacks (emu.enableAsyncFrames): end of frame callbacks run on a worker thread, on snapshots
+	bool _asyncMode = false;
+	vector<ScriptMemorySnapshot> _snapshots;
+	std::thread _asyncThread;
+	AutoResetEvent _asyncSignal;
+	std::atomic<bool> _asyncBusy = false;
+	std::atomic<bool> _asyncStop = false;
+	CpuType _asyncCpuType = {};
+
+	unordered_map<string, SerializeMapValueFormat> _stateSchema;
+
+	// Sockets opened with emu.openSocket, their events are dispatched at the end of each frame
+	unique_ptr<ScriptSocketManager> _socketManager;
+	unordered_map<int, int> _socketCallbacks; ///< Socket id -> callback reference
+	vector<ScriptSocketEvent> _socketEvents;
+
+	// DMA callbacks: the accesses made during a DMA channel's transfer are reported as ranges when it ends
+	vector<DmaCallback> _dmaCallbacks[2];
+	vector<uint8_t> _dmaChannels; ///< Transfers in progress (a higher priority channel can interrupt another one)
+	CpuType _dmaCpuType = {};
+
+	void AddDmaAccess(AddressInfo relAddr, uint32_t width, CallbackType type, CpuType cpuType);
+	void CallDmaCallback(CallbackType type, size_t index);
+	void FlushDmaCallbacks();
+
 	static void ExecutionCountHook(lua_State* lua);
+	int RunEventCallbacks(EventType type, CpuType cpuType);
+	void QueueAsyncFrame(CpuType cpuType);
+	void AsyncThreadLoop();
+	void StopAsyncThread();
+	void EndProfileFrame();
+	void RunFrameGc();
+	void ProcessSocketEvents();
 	void LuaOpenLibs(lua_State* L, bool allowIoOsAccess);
 	void ProcessLuaError();
 
@@ -54,7 +169,7 @@ protected:
 	bool _initDone = false;
 
 	vector<MemoryCallback> _callbacks[3];
-	vector<int> _eventCallbacks[(int)EventType::LastValue + 1];
+	vector<EventCallback> _eventCallbacks[(int)EventType::LastValue + 1];
 
 	template <typename T>
 	void InternalCallMemoryCallback(AddressInfo relAddr, T& value, CallbackType type, CpuType cpuType);
@@ -86,8 +201,38 @@ public:
 
 	void RefreshMemoryCallbackFlags();
 
+	/// <summary>
+	/// Runs the end of frame callbacks on a worker thread, on snapshots of the given memory types (script init only).
+	/// Returns false (with an error message) if the script has callbacks that can't run asynchronously.
+	/// </summary>
+	bool EnableAsyncMode(const vector<MemoryType>& memTypes, string& error);
+	bool IsAsyncMode() { return _asyncMode; }
+
+	/// <summary>Returns the snapshot data for [address, address + length), or nullptr if it isn't in a snapshot</summary>
+	const uint8_t* GetSnapshotData(MemoryType memType, uint32_t address, uint32_t length);
+
+	/// <summary>
+	/// Keys and value types of the console's state (emu.getStateValue/setStateValue), filled on first use.
+	/// Scripts are reloaded with the debugger when a game is loaded, so the keys can't change during the script's lifetime.
+	/// </summary>
+	unordered_map<string, SerializeMapValueFormat>& GetStateSchema() { return _stateSchema; }
+
+	/// <summary>Copies the profiling data of each callback, returns the number of callbacks</summary>
+	uint32_t GetCallbackProfiles(ScriptCallbackProfile* profiles, uint32_t maxCount);
+	ScriptProfileSummary GetProfileSummary();
+
 	void RegisterMemoryCallback(CallbackType type, int startAddr, int endAddr, MemoryType memType, CpuType cpuType, int reference);
 	void UnregisterMemoryCallback(CallbackType type, int startAddr, int endAddr, MemoryType memType, CpuType cpuType, int reference);
+	/// <summary>Registers a read or write callback that is called with the ranges accessed by each DMA transfer</summary>
+	void RegisterDmaCallback(CallbackType type, int startAddr, int endAddr, MemoryType memType, CpuType cpuType, int reference);
+	void UnregisterDmaCallback(CallbackType type, int startAddr, int endAddr, MemoryType memType, CpuType cpuType, int reference);
+	/// <summary>Called when a DMA channel's transfer starts/ends, the DMA callbacks are called when it ends</summary>
+	void ProcessDmaBurst(CpuType cpuType, uint8_t channel, bool started);
+	/// <summary>Opens a TCP connection serviced on a network thread, the callback receives its events at the end of each frame</summary>
+	int OpenSocket(const string& host, uint16_t port, const string& delimiter, int reference);
+	bool SendSocket(int id, const char* data, size_t length);
+	void CloseSocket(int id);
+
 	void RegisterEventCallback(EventType type, int reference);
 	void UnregisterEventCallback(EventType type, int reference);
 };
@@ -45,7 +45,7 @@ bool StepBackManager::CheckStepBack() {
 
 	uint64_t clock = _debugger->GetStepBackConfig().CurrentCycle;
 
-	if (!_rewindManager->IsStepBack()) {
+	if (!_rewindManager->IsStepBack() && !_replayingFromCheckpoint) {
 		if (_cache.size() > 1) {
 			// Check to see if previous instruction is already in cache
 			if (_cache.back().Clock == _targetClock) {
@@ -66,20 +66,35 @@ bool StepBackManager::CheckStepBack() {
 			}
 		}
 
-		// Start rewinding on next instruction after StepBack() is called
 		_cache.clear();
+		if (LoadCheckpoint()) {
+			// Replay from a checkpoint in the current frame, no need to go through the rewind history
+			_replayingFromCheckpoint = true;
+			_prevClock = clock;
+			return false;
+		}
+
+		// Start rewinding on next instruction after StepBack() is called
+		_checkpoints.clear();
+		_checkpointMemory = 0;
 		_rewindManager->StartRewinding(true);
 		clock = _debugger->GetStepBackConfig().CurrentCycle;
 	}
 
-	if (clock < _targetClock && _targetClock - clock < _stateClockLimit) {
-		// Create a save state every instruction for the last X clocks
-		auto& entry = _cache.emplace_back();
-		entry.Clock = clock;
-		_emu->Serialize(entry.SaveState, true, 0);
+	if (clock < _targetClock) {
+		if (_targetClock - clock < _stateClockLimit) {
+			// Create a save state every instruction for the last X clocks
+			auto& entry = _cache.emplace_back();
+			entry.Clock = clock;
+			_emu->Serialize(entry.SaveState, true, 0);
+		} else {
+			TryAddCheckpoint(clock);
+		}
 	}
 
 	if (clock >= _targetClock) {
+		_replayingFromCheckpoint = false;
+
 		// If the CPU is back to where it was before step back, check if the cache contains data
 		if (_cache.size() > 0) {
 			(void)_emu->Deserialize(_cache.back().SaveState, SaveStateManager::FileFormatVersion, true, std::nullopt, false);
@@ -87,6 +102,8 @@ bool StepBackManager::CheckStepBack() {
 		} else if (_allowRetry && clock > _prevClock && (clock - _prevClock) > StepBackManager::DefaultClockLimit) {
 			// Cache is empty, this can happen when a single instruction takes more than X clocks (e.g block transfers, dma)
 			// In this case, re-run the step back process again but start recordings state earlier
+			_checkpoints.clear();
+			_checkpointMemory = 0;
 			_rewindManager->StopRewinding(true);
 			_rewindManager->StartRewinding(true);
 			_stateClockLimit = (clock - _prevClock) + StepBackManager::DefaultClockLimit;
@@ -104,3 +121,49 @@ bool StepBackManager::CheckStepBack() {
 	_prevClock = clock;
 	return false;
 }
+
+void StepBackManager::TryAddCheckpoint(uint64_t clock) {
+	// Spacing grows with the distance to the target: dense close to it, exponentially sparser further back
+	uint64_t spacing = std::max(StepBackManager::DefaultClockLimit, (_targetClock - clock) / StepBackManager::CheckpointsPerOctave);
+	if (!_checkpoints.empty() && clock < _checkpoints.back().Clock + spacing) {
+		return;
+	}
+
+	auto& entry = _checkpoints.emplace_back();
+	entry.Clock = clock;
+	entry.FrameCount = _emu->GetFrameCount();
+	_emu->Serialize(entry.SaveState, true, 0);
+	_checkpointMemory += (uint64_t)entry.SaveState.tellp();
+
+	// Over budget, drop the checkpoints furthest back first
+	while (_checkpointMemory > StepBackManager::MaxCheckpointMemory && _checkpoints.size() > 1) {
+		_checkpointMemory -= (uint64_t)_checkpoints.front().SaveState.tellp();
+		_checkpoints.pop_front();
+	}
+}
+
+bool StepBackManager::LoadCheckpoint() {
+	// Checkpoints at or after the target are in the "future" now
+	while (!_checkpoints.empty() && _checkpoints.back().Clock >= _targetClock) {
+		_checkpointMemory -= (uint64_t)_checkpoints.back().SaveState.tellp();
+		_checkpoints.pop_back();
+	}
+
+	if (_checkpoints.empty() || _checkpoints.back().FrameCount != _emu->GetFrameCount()) {
+		// Replaying across a frame boundary needs the rewind input logs
+		return false;
+	}
+
+	StepBackCacheEntry& checkpoint = _checkpoints.back();
+	checkpoint.SaveState.clear();
+	checkpoint.SaveState.seekg(0);
+	(void)_emu->Deserialize(checkpoint.SaveState, SaveStateManager::FileFormatVersion, true, std::nullopt, false);
+	return true;
+}
+
+void StepBackManager::ResetCache() {
+	_cache.clear();
+	_checkpoints.clear();
+	_checkpointMemory = 0;
+	_replayingFromCheckpoint = false;
+}
@@ -9,8 +9,9 @@ class IDebugger;
 /// Cached save state entry for step-back.
 /// </summary>
 struct StepBackCacheEntry {
-	stringstream SaveState; ///< Serialized emulator state
-	uint64_t Clock;         ///< Master clock at this state
+	stringstream SaveState;  ///< Serialized emulator state
+	uint64_t Clock;          ///< Master clock at this state
+	uint32_t FrameCount = 0; ///< Frame count at this state
 };
 
 /// <summary>
@@ -46,8 +47,13 @@ enum class StepBackType {
 /// - Frame: Step back 1 frame
 ///
 /// State caching:
-/// - Saves states at regular intervals
-/// - Default clock limit: 600 cycles (avoids NES sprite DMA ~512 cycles)
+/// - Saves a state every instruction for the last 600 cycles before the target (avoids NES sprite DMA ~512 cycles)
+/// - Further back, keeps sparse checkpoints spaced proportionally to their distance from the target
+///   (~CheckpointsPerOctave per doubling of distance), bounded by MaxCheckpointMemory
+/// - A later step back whose target is in the current frame replays from the nearest checkpoint
+///   instead of going back through the rewind history, so the replay length stays bounded
+/// - Checkpoints are only used within the frame they were taken in: input is latched per frame,
+///   so replaying without crossing a frame boundary reproduces the same execution
 /// - Retry mechanism if target not found
 ///
 /// Rewind integration:
@@ -71,17 +77,29 @@ private:
 	/// </summary>
 	static constexpr uint64_t DefaultClockLimit = 600;
 
+	static constexpr uint32_t CheckpointsPerOctave = 4;                ///< Sparse checkpoint density
+	static constexpr uint64_t MaxCheckpointMemory = 32 * 1024 * 1024; ///< Memory budget for sparse checkpoints
+
 	Emulator* _emu = nullptr;                ///< Emulator instance
 	RewindManager* _rewindManager = nullptr; ///< Rewind manager
 	IDebugger* _debugger = nullptr;          ///< Debugger instance
 
-	vector<StepBackCacheEntry> _cache;                              ///< Cached save states
+	vector<StepBackCacheEntry> _cache;                              ///< Cached save states (one per instruction)
+	deque<StepBackCacheEntry> _checkpoints;                         ///< Sparse checkpoints, oldest first
+	uint64_t _checkpointMemory = 0;                                 ///< Bytes used by _checkpoints
+	bool _replayingFromCheckpoint = false;                          ///< True while replaying from a checkpoint (rewind not used)
 	uint64_t _targetClock = 0;                                      ///< Target clock to step back to
 	uint64_t _prevClock = 0;                                        ///< Previous clock value
 	bool _active = false;                                           ///< True if step-back in progress
 	bool _allowRetry = false;                                       ///< True to retry if target missed
 	uint64_t _stateClockLimit = StepBackManager::DefaultClockLimit; ///< State save interval
 
+	/// <summary>Save a sparse checkpoint if far enough from the previous one</summary>
+	void TryAddCheckpoint(uint64_t clock);
+
+	/// <summary>Load the nearest usable checkpoint before the target, returns false if there is none</summary>
+	bool LoadCheckpoint();
+
 public:
 	/// <summary>
 	/// Constructor for step-back manager.
@@ -103,7 +121,7 @@ public:
 	/// <summary>
 	/// Reset state cache.
 	/// </summary>
-	void ResetCache() { _cache.clear(); }
+	void ResetCache();
 
 	/// <summary>
 	/// Check if rewinding in progress.
@@ -0,0 +1,126 @@
+#include "pch.h"
+#include "Debugger/TraceLogFileSaver.h"
+#include "Utilities/CompressionHelper.h"
+
+void TraceLogFileSaver::StartLogging(const string& filename) {
+	StopLogging(nullptr);
+
+	// Preallocate both buffers (records are small, the buffer exceeds FlushSize by less than 4KB)
+	_recordBuffer.clear();
+	_recordBuffer.reserve(FlushSize + 0x1000);
+	_writerBuffer.clear();
+	_writerBuffer.reserve(FlushSize + 0x1000);
+
+	_outputFilepath = filename;
+	_recordFilepath = filename + ".tmp";
+	_recordFile.open(_recordFilepath, ios::out | ios::binary);
+
+	_writerBufferReady = false;
+	_stopWriter = false;
+	_writerThread = std::thread(&TraceLogFileSaver::WriterLoop, this);
+	_enabled = true;
+}
+
+void TraceLogFileSaver::StopLogging(const RowFormatter& formatRow) {
+	if (!_enabled) {
+		return;
+	}
+
+	_enabled = false;
+	if (!_recordBuffer.empty()) {
+		QueueRecords();
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_writerLock);
+		_stopWriter = true;
+	}
+	_writerSignal.notify_all();
+	_writerThread.join();
+
+	_recordFile.close();
+	if (formatRow) {
+		ConvertToText(formatRow);
+		std::remove(_recordFilepath.c_str());
+	}
+}
+
+void TraceLogFileSaver::QueueRecords() {
+	std::unique_lock<std::mutex> lock(_writerLock);
+
+	// Only blocks if the disk can't keep up with the 1MB block that was queued previously
+	_writerSignal.wait(lock, [this]() { return !_writerBufferReady; });
+	std::swap(_recordBuffer, _writerBuffer);
+	_writerBufferReady = true;
+	_recordBuffer.clear();
+	lock.unlock();
+	_writerSignal.notify_all();
+}
+
+void TraceLogFileSaver::WriterLoop() {
+	while (true) {
+		{
+			std::unique_lock<std::mutex> lock(_writerLock);
+			_writerSignal.wait(lock, [this]() { return _writerBufferReady || _stopWriter; });
+			if (!_writerBufferReady) {
+				// Stop was requested and everything queued before it was written
+				break;
+			}
+		}
+
+		// _writerBuffer is only modified by QueueRecords once _writerBufferReady is cleared
+		_compressedBuffer.clear();
+		CompressionHelper::Compress(_writerBuffer.data(), _writerBuffer.size(), TraceLogFileSaver::CompressionLevel, _compressedBuffer);
+		_recordFile.write((char*)_compressedBuffer.data(), _compressedBuffer.size());
+
+		{
+			std::lock_guard<std::mutex> lock(_writerLock);
+			_writerBuffer.clear();
+			_writerBufferReady = false;
+		}
+		_writerSignal.notify_all();
+	}
+}
+
+void TraceLogFileSaver::ConvertToText(const RowFormatter& formatRow) {
+	ifstream recordFile(_recordFilepath, ios::in | ios::binary);
+	ofstream outputFile(_outputFilepath, ios::out | ios::binary);
+	if (!recordFile || !outputFile) {
+		return;
+	}
+
+	string outputBuffer;
+	string row;
+	vector<uint8_t> block;
+	vector<uint8_t> records;
+	uint32_t blockSizes[2];
+	while (recordFile.read((char*)blockSizes, sizeof(blockSizes))) {
+		block.resize(sizeof(blockSizes) + blockSizes[1]);
+		memcpy(block.data(), blockSizes, sizeof(blockSizes));
+		if (!recordFile.read((char*)block.data() + sizeof(blockSizes), blockSizes[1]) || !CompressionHelper::Decompress(block, records)) {
+			break;
+		}
+
+		size_t pos = 0;
+		RecordHeader header;
+		while (pos + sizeof(header) <= records.size()) {
+			memcpy(&header, records.data() + pos, sizeof(header));
+			pos += sizeof(header);
+			if (pos + header.Size > records.size()) {
+				break;
+			}
+
+			row.clear();
+			formatRow(header.Type, records.data() + pos, header.Size, row);
+			pos += header.Size;
+
+			outputBuffer += row;
+			outputBuffer += '\n';
+			if (outputBuffer.size() > 0x100000) {
+				outputFile << outputBuffer;
+				outputBuffer.clear();
+			}
+		}
+	}
+	outputFile << outputBuffer;
+}
@@ -1,64 +1,85 @@
 #pragma once
 #include "pch.h"
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include "Shared/CpuType.h"
 
 /// <summary>
-/// Trace log file saver with buffered writing.
+/// Trace log file saver with binary recording on a background writer thread and deferred text conversion.
 /// </summary>
 /// <remarks>
 /// Architecture:
-/// - Buffers trace log entries before writing to disk
-/// - Flushes buffer when full (32KB threshold)
-/// - Binary output mode for performance
+/// - While logging, each traced instruction is appended as a binary record (CPU type, size, raw row data)
+///   to a preallocated buffer, no text formatting is done on the emulation thread
+/// - Once the buffer is > 1MB, it is swapped with the writer thread's buffer (double buffering): the writer
+///   thread deflates it (miniz, fast level) and appends the block to "[filename].tmp"
+/// - When logging stops, the blocks are decompressed and the records are converted to text in "[filename]"
+///   by the trace logger of each record's CPU (the same formatting as the trace logger window), then the temp
+///   file is deleted
 ///
-/// Buffering strategy:
-/// - Accumulates log entries in-memory
-/// - Writes to disk when buffer > 32KB
-/// - Reduces disk I/O overhead for high-frequency logging
+/// Temp file format: sequence of blocks in CompressionHelper's format ([original size][compressed size][data]),
+/// records never span 2 blocks.
 ///
 /// Use cases:
 /// - Instruction trace logging (CPU execution)
-/// - PPU trace logging (PPU cycles)
-/// - Custom trace logs via Lua scripts
+/// - Long traces (entire levels), where formatting and writing every row while running was the bottleneck
+///
+/// Thread safety:
+/// - StartLogging/LogRecord/StopLogging must be called from one thread at a time (emulation thread, or with execution paused)
 /// </remarks>
 class TraceLogFileSaver {
+public:
+	/// <summary>Formats one record (as given to LogRecord) into a text row</summary>
+	using RowFormatter = std::function<void(CpuType cpuType, const uint8_t* record, uint32_t size, string& output)>;
+
 private:
-	bool _enabled = false;  ///< True if logging active
-	string _outputFilepath; ///< Output file path
-	string _outputBuffer;   ///< In-memory buffer
-	ofstream _outputFile;   ///< Output file stream
+	struct RecordHeader {
+		CpuType Type;
+		uint32_t Size;
+	};
+
+	static constexpr size_t FlushSize = 0x100000;
+	static constexpr int CompressionLevel = 1;
+
+	bool _enabled = false;         ///< True if logging active
+	string _outputFilepath;        ///< Output (text) file path
+	string _recordFilepath;        ///< Temporary binary record file path
+	vector<uint8_t> _recordBuffer; ///< Buffer filled by LogRecord
+	ofstream _recordFile;          ///< Binary record file stream (only used by the writer thread while logging)
+
+	std::thread _writerThread;
+	std::mutex _writerLock;
+	std::condition_variable _writerSignal;
+	vector<uint8_t> _writerBuffer;     ///< Buffer being compressed/written by the writer thread
+	vector<uint8_t> _compressedBuffer; ///< Writer thread's compression output
+	bool _writerBufferReady = false;   ///< _writerBuffer contains records to write
+	bool _stopWriter = false;
+
+	void WriterLoop();
+	void QueueRecords();
+	void ConvertToText(const RowFormatter& formatRow);
 
 public:
 	/// <summary>
-	/// Destructor - stops logging and flushes buffer.
+	/// Destructor - stops logging (the records are kept in the temp file if they were never converted).
 	/// </summary>
 	~TraceLogFileSaver() {
-		StopLogging();
+		StopLogging(nullptr);
 	}
 
 	/// <summary>
 	/// Start logging to file.
 	/// </summary>
 	/// <param name="filename">Output file path</param>
-	void StartLogging(const string& filename) {
-		_outputBuffer.clear();
-		_outputFile.open(filename, ios::out | ios::binary);
-		_enabled = true;
-	}
+	void StartLogging(const string& filename);
 
 	/// <summary>
-	/// Stop logging and flush buffer.
+	/// Stop logging and write the text log.
 	/// </summary>
-	void StopLogging() {
-		if (_enabled) {
-			_enabled = false;
-			if (_outputFile) {
-				if (!_outputBuffer.empty()) {
-					_outputFile << _outputBuffer;
-				}
-				_outputFile.close();
-			}
-		}
-	}
+	/// <param name="formatRow">Formatter used to convert the records to text (if null, the binary records are left as is)</param>
+	void StopLogging(const RowFormatter& formatRow);
 
 	/// <summary>
 	/// Check if logging enabled (hot path).
@@ -69,14 +90,20 @@ public:
 	__forceinline bool IsEnabled() { return _enabled; }
 
 	/// <summary>
-	/// Log entry with buffering.
+	/// Log a binary row record (hot path).
 	/// </summary>
-	/// <param name="log">Log entry text</param>
-	void Log(string& log) {
-		_outputBuffer += log + '\n';
-		if (_outputBuffer.size() > 32768) {
-			_outputFile << _outputBuffer;
-			_outputBuffer.clear();
+	/// <param name="cpuType">CPU whose trace logger will format the record</param>
+	/// <param name="record">Trivially copyable row data</param>
+	template <typename T>
+	void LogRecord(CpuType cpuType, const T& record) {
+		static_assert(std::is_trivially_copyable_v<T>);
+		RecordHeader header = {cpuType, (uint32_t)sizeof(T)};
+		size_t pos = _recordBuffer.size();
+		_recordBuffer.resize(pos + sizeof(header) + sizeof(T));
+		memcpy(_recordBuffer.data() + pos, &header, sizeof(header));
+		memcpy(_recordBuffer.data() + pos + sizeof(header), &record, sizeof(T));
+		if (_recordBuffer.size() > FlushSize) {
+			QueueRecords();
 		}
 	}
 };
@@ -8,6 +8,7 @@
 #include "GBA/GbaMemoryManager.h"
 #include "Shared/MessageManager.h"
 #include "Shared/Emulator.h"
+#include "Shared/FrameProfiler.h"
 #include "Shared/EmuSettings.h"
 #include "Shared/Audio/SoundMixer.h"
 #include "Utilities/HexUtilities.h"
@@ -68,11 +69,14 @@ GbaApu::~GbaApu() = default;
 
 template <bool sq1Enabled, bool sq2Enabled, bool waveEnabled, bool noiseEnabled>
 void GbaApu::InternalRun() {
+	PROFILE_SCOPE(_emu->GetFrameProfiler(), ProfilerStage::Apu);
 	uint64_t clockCount = _console->GetMasterClock() / 4;
 	if (clockCount == _prevClockCount) {
+		ApplyPendingFifoSamples(0);
 		return;
 	} else if (_console->GetPpu()->IsOverclockScanline()) {
 		_prevClockCount = clockCount;
+		ApplyPendingFifoSamples(0);
 		return;
 	}
 
@@ -99,6 +103,7 @@ void GbaApu::InternalRun() {
 	bool enabled = _state.ApuEnabled && !_memoryManager->IsSystemStopped();
 
 	bool changed = true;
+	uint32_t fifoIndex = 0;
 	while (clocksToRun > 0) {
 		uint32_t minTimer = samplingRate - (_prevClockCount & (samplingRate - 1));
 		if (minTimer > clocksToRun) {
@@ -139,6 +144,13 @@ void GbaApu::InternalRun() {
 		_prevClockCount += minTimer;
 		clocksToRun -= minTimer;
 
+		// FIFO samples popped before this sample point are part of its output
+		while (fifoIndex < _pendingFifoSampleCount && _pendingFifoSamples[fifoIndex].Clock < _prevClockCount) {
+			FifoSampleEvent& evt = _pendingFifoSamples[fifoIndex++];
+			(evt.Channel == 0 ? _state.DmaSampleA : _state.DmaSampleB) = evt.Sample;
+			changed = true;
+		}
+
 		if (changed) {
 			changed = false;
 
@@ -183,11 +195,22 @@ void GbaApu::InternalRun() {
 		_sampleCount += 2;
 	}
 
+	// Samples popped after the last sample point are applied now, the next call recalculates the output on its first sample
+	ApplyPendingFifoSamples(fifoIndex);
+
 	if (_sampleCount >= 2000) {
 		PlayQueuedAudio();
 	}
 }
 
+void GbaApu::ApplyPendingFifoSamples(uint32_t index) {
+	for (; index < _pendingFifoSampleCount; index++) {
+		FifoSampleEvent& evt = _pendingFifoSamples[index];
+		(evt.Channel == 0 ? _state.DmaSampleA : _state.DmaSampleB) = evt.Sample;
+	}
+	_pendingFifoSampleCount = 0;
+}
+
 void GbaApu::PlayQueuedAudio() {
 	_soundMixer->PlayAudioBuffer(_soundBuffer.get(), _sampleCount / 2, _sampleRate);
 	_sampleCount = 0;
@@ -341,7 +364,10 @@ uint8_t GbaApu::ReadRegister(uint32_t addr) {
 }
 
 void GbaApu::WriteRegister(GbaAccessModeVal mode, uint32_t addr, uint8_t value) {
-	Run();
+	if (addr < 0xA0) {
+		// FIFO writes (DMA refills) don't affect the output until the next ClockFifo, no need to catch up for them
+		Run();
+	}
 
 	if (!_state.ApuEnabled && addr <= 0x81) {
 		// Ignore all writes to these registers when APU is disabled
@@ -582,7 +608,11 @@ void GbaApu::ClockFifo(uint8_t timerIndex) {
 		return;
 	}
 
-	Run();
+	if (_pendingFifoSampleCount + 2 > MaxPendingFifoSamples) {
+		Run();
+	}
+
+	uint64_t clock = _console->GetMasterClock() / 4;
 
 	if (_state.TimerA == timerIndex) {
 		if (_fifo[0].Size() <= 3) {
@@ -590,7 +620,7 @@ void GbaApu::ClockFifo(uint8_t timerIndex) {
 		}
 
 		if (!_fifo[0].Empty()) {
-			_state.DmaSampleA = (int8_t)_fifo[0].Pop();
+			_pendingFifoSamples[_pendingFifoSampleCount++] = {clock, 0, (int8_t)_fifo[0].Pop()};
 		}
 	}
 
@@ -600,7 +630,7 @@ void GbaApu::ClockFifo(uint8_t timerIndex) {
 		}
 
 		if (!_fifo[1].Empty()) {
-			_state.DmaSampleB = (int8_t)_fifo[1].Pop();
+			_pendingFifoSamples[_pendingFifoSampleCount++] = {clock, 1, (int8_t)_fifo[1].Pop()};
 		}
 	}
 }
@@ -644,6 +674,7 @@ void GbaApu::Serialize(Serializer& s) {
 		PlayQueuedAudio();
 	} else {
 		_sampleCount = 0;
+		_pendingFifoSampleCount = 0;
 	}
 
 	SV(_state.DmaSampleA);
@@ -31,12 +31,24 @@ class SoundMixer;
 /// Sample rate is variable based on timer frequency for FIFO channels.
 /// </remarks>
 class GbaApu final : public ISerializable {
+	/// <summary>Direct Sound sample popped from a FIFO on a timer overflow, waiting to be mixed.</summary>
+	struct FifoSampleEvent {
+		/// <summary>APU clock (master clock / 4) at which the FIFO output changed.</summary>
+		uint64_t Clock;
+		/// <summary>FIFO index (0 = A, 1 = B).</summary>
+		uint8_t Channel;
+		int8_t Sample;
+	};
+
 	/// <summary>Maximum internal sample rate (256 KHz) for high-quality resampling.</summary>
 	static constexpr int MaxSampleRate = 256 * 1024;
 
 	/// <summary>Maximum samples per buffer based on max rate and 60fps minimum.</summary>
 	static constexpr int MaxSamples = MaxSampleRate * 8 / 60;
 
+	/// <summary>Number of FIFO samples that can be queued before the APU is forced to catch up.</summary>
+	static constexpr uint32_t MaxPendingFifoSamples = 256;
+
 private:
 	/// <summary>Emulator instance reference.</summary>
 	Emulator* _emu = nullptr;
@@ -80,6 +92,15 @@ private:
 	/// <summary>Direct Sound FIFO channels A and B for DMA-driven PCM audio.</summary>
 	GbaApuFifo _fifo[2] = {};
 
+	/// <summary>
+	/// FIFO outputs recorded by ClockFifo since the last Run, in clock order.
+	/// Mixed in blocks by InternalRun (always empty after Run, so it isn't saved in save states).
+	/// </summary>
+	FifoSampleEvent _pendingFifoSamples[MaxPendingFifoSamples] = {};
+
+	/// <summary>Number of entries in _pendingFifoSamples.</summary>
+	uint32_t _pendingFifoSampleCount = 0;
+
 	/// <summary>Output sample buffer.</summary>
 	std::unique_ptr<int16_t[]> _soundBuffer;
 
@@ -113,6 +134,9 @@ private:
 	/// <summary>Clocks the frame sequencer for length/envelope/sweep timing.</summary>
 	void ClockFrameSequencer();
 
+	/// <summary>Applies the queued FIFO samples starting at the given index to the DMA sample state and empties the queue.</summary>
+	void ApplyPendingFifoSamples(uint32_t index);
+
 	/// <summary>Updates the sample rate based on current timer configuration.</summary>
 	void UpdateSampleRate();
 
@@ -163,6 +187,10 @@ public:
 	void WriteRegister(GbaAccessModeVal mode, uint32_t addr, uint8_t value);
 
 	/// <summary>Clocks a FIFO channel when its associated timer overflows.</summary>
+	/// <remarks>
+	/// The popped sample is queued with its timestamp instead of catching up the APU on every overflow,
+	/// InternalRun applies it at the right output sample when it next runs.
+	/// </remarks>
 	/// <param name="timerIndex">Timer index (0 or 1) that triggered the clock.</param>
 	void ClockFifo(uint8_t timerIndex);
 
@@ -161,6 +161,21 @@ public:
 		return addr & 0x01 ? (addr >> 9) : (addr >> 1);
 	}
 
+	/// <summary>
+	/// Gets a pointer to the ROM data for an aligned halfword/word read without side effects.
+	/// </summary>
+	/// <param name="addr">Aligned address in banks $08-$0C (the EEPROM bank must use ReadRom).</param>
+	/// <param name="size">Access size in bytes (2 or 4).</param>
+	/// <returns>ROM data, or nullptr when the access hits the GPIO ports or goes past the end of the ROM.</returns>
+	__forceinline uint8_t* GetRomReadPtr(uint32_t addr, uint32_t size) {
+		if (_gpio && addr >= 0x80000C0 && addr < 0x80000D0) {
+			return nullptr;
+		}
+
+		addr &= 0x1FFFFFF;
+		return addr + size <= _prgRomSize ? _prgRom + addr : nullptr;
+	}
+
 	/// <summary>
 	/// Writes to cartridge ROM area (EEPROM/GPIO only).
 	/// </summary>
@@ -89,7 +89,10 @@ bool GbaEventManager::ShowPreviousFrameEvents() {
 }
 
 void GbaEventManager::SetConfiguration(BaseEventViewerConfig& config) {
+	// The render thread reads the configuration
+	auto lock = _lock.AcquireSafe();
 	_config = (GbaEventViewerConfig&)config;
+	InvalidateFilteredEvents();
 }
 
 EventViewerCategoryCfg GbaEventManager::GetEventConfig(DebugEventInfo& evt) {
@@ -145,7 +148,11 @@ void GbaEventManager::ConvertScanlineCycleToRowColumn(int32_t& x, int32_t& y) {
 
 uint32_t GbaEventManager::TakeEventSnapshot(bool forAutoRefresh) {
 	DebugBreakHelper breakHelper(_debugger);
-	auto lock = _lock.AcquireSafe();
+	EventSnapshotLock lock(_lock, forAutoRefresh);
+	if (!lock.IsAcquired()) {
+		// The render thread is drawing the previous snapshot
+		return _scanlineCount;
+	}
 
 	uint16_t cycle = _ppu->GetCycle();
 	uint16_t scanline = _ppu->GetScanline();
@@ -158,8 +165,7 @@ uint32_t GbaEventManager::TakeEventSnapshot(bool forAutoRefresh) {
 		memcpy(_ppuBuffer.get() + offset, _ppu->GetPreviousScreenBuffer() + offset, (GbaConstants::PixelCount - offset) * sizeof(uint16_t));
 	}
 
-	_snapshotCurrentFrame = _debugEvents;
-	_snapshotPrevFrame = _prevDebugEvents;
+	UpdateEventSnapshot();
 	_snapshotScanline = scanline;
 	_snapshotCycle = cycle;
 	_forAutoRefresh = forAutoRefresh;
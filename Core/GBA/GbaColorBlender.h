@@ -0,0 +1,20 @@
+#pragma once
+#include "pch.h"
+
+/// <summary>
+/// Color blending used by the GBA PPU's layer composition (alpha blending, brightness increase/decrease).
+/// </summary>
+/// <remarks>
+/// Every intermediate value fits in a signed 16-bit value (31 * 16 * 2 = 992), the channel math stays in
+/// 16-bit registers and the clamp is a signed min (the only 16-bit min available with SSE2).
+/// </remarks>
+class GbaColorBlender {
+public:
+	/// <summary>Blends 2 RGB555 colors: min(31, (a * aCoeff + b * bCoeff) / 16) for each channel</summary>
+	[[nodiscard]] static __forceinline uint16_t BlendColors(uint16_t a, uint16_t aCoeff, uint16_t b, uint16_t bCoeff) {
+		int16_t r = std::min<int16_t>(31, (int16_t)((a & 0x1F) * aCoeff + (b & 0x1F) * bCoeff) >> 4);
+		int16_t g = std::min<int16_t>(31, (int16_t)(((a >> 5) & 0x1F) * aCoeff + ((b >> 5) & 0x1F) * bCoeff) >> 4);
+		int16_t bl = std::min<int16_t>(31, (int16_t)(((a >> 10) & 0x1F) * aCoeff + ((b >> 10) & 0x1F) * bCoeff) >> 4);
+		return (uint16_t)(r | (g << 5) | (bl << 10));
+	}
+};
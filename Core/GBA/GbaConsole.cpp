@@ -20,9 +20,11 @@
 #include "Shared/EmuSettings.h"
 #include "Shared/FirmwareHelper.h"
 #include "Shared/MessageManager.h"
+#include "Shared/SharedRomCache.h"
 #include "Utilities/VirtualFile.h"
 #include "Utilities/Serializer.h"
 #include "Utilities/StringUtilities.h"
+#include "Utilities/sha1.h"
 
 static bool _needStaticInit = true;
 static SimpleLock _staticInitLock;
@@ -44,7 +46,9 @@ GbaConsole::GbaConsole(Emulator* emu) {
 
 GbaConsole::~GbaConsole() {
 	delete[] _saveRam;
-	delete[] _prgRom;
+	if (!_sharedPrgRom) {
+		delete[] _prgRom;
+	}
 
 	delete[] _spriteRam;
 	delete[] _paletteRam;
@@ -57,21 +61,18 @@ GbaConsole::~GbaConsole() {
 }
 
 LoadRomResult GbaConsole::LoadRom(VirtualFile& romFile) {
-	vector<uint8_t> romData;
-	if (!romFile.ReadFile(romData)) {
-		return LoadRomResult::Failure;
-	}
-
+	// Memory-mapped when the ROM isn't in an archive, the ROM is then only copied once (into _prgRom)
+	std::span<const uint8_t> romData = romFile.GetDataSpan();
 	if (romData.size() < 0xC0) {
 		return LoadRomResult::Failure;
 	}
 
 	InitCart(romFile, romData);
-
-	_prgRomSize = (uint32_t)romData.size();
-	_prgRom = new uint8_t[_prgRomSize];
-	memcpy(_prgRom, romData.data(), _prgRomSize);
-	_emu->RegisterMemory(MemoryType::GbaPrgRom, _prgRom, _prgRomSize);
+	if (_sharedPrgRom) {
+		_emu->RegisterSharedMemory(MemoryType::GbaPrgRom, _prgRom, _prgRomSize);
+	} else {
+		_emu->RegisterMemory(MemoryType::GbaPrgRom, _prgRom, _prgRomSize);
+	}
 
 	_bootRom = new uint8_t[GbaConsole::BootRomSize];
 	if (!FirmwareHelper::LoadGbaBootRom(_emu, &_bootRom)) {
@@ -128,7 +129,7 @@ LoadRomResult GbaConsole::LoadRom(VirtualFile& romFile) {
 	return LoadRomResult::Success;
 }
 
-void GbaConsole::InitCart(VirtualFile& romFile, vector<uint8_t>& romData) {
+void GbaConsole::InitCart(VirtualFile& romFile, std::span<const uint8_t> romData) {
 	string title = StringUtilities::GetString(&romData[0xA0], 12);
 	string gameCode = StringUtilities::GetString(&romData[0xAC], 4);
 	string makerCode = StringUtilities::GetString(&romData[0xB0], 2);
@@ -139,13 +140,33 @@ void GbaConsole::InitCart(VirtualFile& romFile, vector<uint8_t>& romData) {
 	MessageManager::Log("Game Code: " + gameCode);
 	MessageManager::Log("Maker Code: " + makerCode);
 
+	_prgRomSize = (uint32_t)romData.size();
 	if (gameCode.size() > 0 && gameCode[0] == 'F') {
 		MessageManager::Log("Classic series game detected.");
 		if (romData.size() == 0x100000) {
 			// Mirror up to 4 MB to fix input problems
-			romData.insert(romData.end(), romData.begin(), romData.end());
-			romData.insert(romData.end(), romData.begin(), romData.end());
+			_prgRomSize = 0x400000;
+		}
+	}
+
+	auto mirrorRom = [&](uint8_t* dst) {
+		for (uint32_t i = 0; i < _prgRomSize; i += (uint32_t)romData.size()) {
+			memcpy(dst + i, romData.data(), romData.size());
 		}
+	};
+
+	if (_emu->GetSettings()->CheckFlag(EmulationFlags::ShareRomData)) {
+		// The other instances running the same (patched) ROM use the same buffer
+		string key = SHA1::GetHash(romData.data(), romData.size()) + ":" + std::to_string(_prgRomSize);
+		_sharedPrgRom = SharedRomCache::GetOrLoad(key, [&]() {
+			vector<uint8_t> rom(_prgRomSize);
+			mirrorRom(rom.data());
+			return rom;
+		});
+		_prgRom = const_cast<uint8_t*>(_sharedPrgRom->data());
+	} else {
+		_prgRom = new uint8_t[_prgRomSize];
+		mirrorRom(_prgRom);
 	}
 
 	_cartType = GbaCartridgeType::Default;
@@ -174,7 +195,7 @@ void GbaConsole::InitCart(VirtualFile& romFile, vector<uint8_t>& romData) {
 	MessageManager::Log("-----------------------------");
 }
 
-void GbaConsole::InitSaveRam(string& gameCode, vector<uint8_t>& romData) {
+void GbaConsole::InitSaveRam(string& gameCode, std::span<const uint8_t> romData) {
 	_saveType = _emu->GetSettings()->GetGbaConfig().SaveType;
 
 	if (_saveType == GbaSaveType::AutoDetect) {
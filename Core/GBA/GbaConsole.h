@@ -1,5 +1,6 @@
 #pragma once
 #include "pch.h"
+#include <span>
 #include "GBA/GbaTypes.h"
 #include "Debugger/DebugTypes.h"
 #include "Shared/SettingTypes.h"
@@ -92,6 +93,7 @@ private:
 
 	uint8_t* _prgRom = nullptr;
 	uint32_t _prgRomSize = 0;
+	shared_ptr<const vector<uint8_t>> _sharedPrgRom; ///< Buffer _prgRom points to, with EmulationFlags::ShareRomData
 
 	uint8_t* _saveRam = nullptr;
 	uint32_t _saveRamSize = 0;
@@ -105,8 +107,8 @@ private:
 
 	uint8_t* _bootRom = nullptr;
 
-	void InitSaveRam(string& gameCode, vector<uint8_t>& romData);
-	void InitCart(VirtualFile& romFile, vector<uint8_t>& romData);
+	void InitSaveRam(string& gameCode, std::span<const uint8_t> romData);
+	void InitCart(VirtualFile& romFile, std::span<const uint8_t> romData);
 
 public:
 	GbaConsole(Emulator* emu);
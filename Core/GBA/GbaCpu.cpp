@@ -357,80 +357,82 @@ GbaCpuState& GbaCpu::GetState() {
 }
 
 void GbaCpu::Serialize(Serializer& s) {
-	SV(_state.Pipeline.Fetch.Address);
-	SV(_state.Pipeline.Fetch.OpCode);
-	SV(_state.Pipeline.Decode.Address);
-	SV(_state.Pipeline.Decode.OpCode);
-	SV(_state.Pipeline.Execute.Address);
-	SV(_state.Pipeline.Execute.OpCode);
-	SV(_state.Pipeline.ReloadRequested);
-	SV(_state.Pipeline.Mode);
-
-	SV(_state.CPSR.Mode);
-	SV(_state.CPSR.Thumb);
-	SV(_state.CPSR.FiqDisable);
-	SV(_state.CPSR.IrqDisable);
-	SV(_state.CPSR.Overflow);
-	SV(_state.CPSR.Carry);
-	SV(_state.CPSR.Zero);
-	SV(_state.CPSR.Negative);
-
-	SV(_state.Stopped);
-	SV(_state.Frozen);
-	SVArray(_state.R, 16);
-	SVArray(_state.UserRegs, 7);
-	SVArray(_state.FiqRegs, 7);
-	SVArray(_state.IrqRegs, 2);
-	SVArray(_state.SupervisorRegs, 2);
-	SVArray(_state.AbortRegs, 2);
-	SVArray(_state.UndefinedRegs, 2);
-
-	SV(_state.FiqSpsr.Mode);
-	SV(_state.FiqSpsr.Thumb);
-	SV(_state.FiqSpsr.FiqDisable);
-	SV(_state.FiqSpsr.IrqDisable);
-	SV(_state.FiqSpsr.Overflow);
-	SV(_state.FiqSpsr.Carry);
-	SV(_state.FiqSpsr.Zero);
-	SV(_state.FiqSpsr.Negative);
-
-	SV(_state.IrqSpsr.Mode);
-	SV(_state.IrqSpsr.Thumb);
-	SV(_state.IrqSpsr.FiqDisable);
-	SV(_state.IrqSpsr.IrqDisable);
-	SV(_state.IrqSpsr.Overflow);
-	SV(_state.IrqSpsr.Carry);
-	SV(_state.IrqSpsr.Zero);
-	SV(_state.IrqSpsr.Negative);
-
-	SV(_state.SupervisorSpsr.Mode);
-	SV(_state.SupervisorSpsr.Thumb);
-	SV(_state.SupervisorSpsr.FiqDisable);
-	SV(_state.SupervisorSpsr.IrqDisable);
-	SV(_state.SupervisorSpsr.Overflow);
-	SV(_state.SupervisorSpsr.Carry);
-	SV(_state.SupervisorSpsr.Zero);
-	SV(_state.SupervisorSpsr.Negative);
-
-	SV(_state.AbortSpsr.Mode);
-	SV(_state.AbortSpsr.Thumb);
-	SV(_state.AbortSpsr.FiqDisable);
-	SV(_state.AbortSpsr.IrqDisable);
-	SV(_state.AbortSpsr.Overflow);
-	SV(_state.AbortSpsr.Carry);
-	SV(_state.AbortSpsr.Zero);
-	SV(_state.AbortSpsr.Negative);
-
-	SV(_state.UndefinedSpsr.Mode);
-	SV(_state.UndefinedSpsr.Thumb);
-	SV(_state.UndefinedSpsr.FiqDisable);
-	SV(_state.UndefinedSpsr.IrqDisable);
-	SV(_state.UndefinedSpsr.Overflow);
-	SV(_state.UndefinedSpsr.Carry);
-	SV(_state.UndefinedSpsr.Zero);
-	SV(_state.UndefinedSpsr.Negative);
-
-	SV(_state.CycleCount);
+	s.StreamPod(_state, "_state", [&]() {
+		SV(_state.Pipeline.Fetch.Address);
+		SV(_state.Pipeline.Fetch.OpCode);
+		SV(_state.Pipeline.Decode.Address);
+		SV(_state.Pipeline.Decode.OpCode);
+		SV(_state.Pipeline.Execute.Address);
+		SV(_state.Pipeline.Execute.OpCode);
+		SV(_state.Pipeline.ReloadRequested);
+		SV(_state.Pipeline.Mode);
+
+		SV(_state.CPSR.Mode);
+		SV(_state.CPSR.Thumb);
+		SV(_state.CPSR.FiqDisable);
+		SV(_state.CPSR.IrqDisable);
+		SV(_state.CPSR.Overflow);
+		SV(_state.CPSR.Carry);
+		SV(_state.CPSR.Zero);
+		SV(_state.CPSR.Negative);
+
+		SV(_state.Stopped);
+		SV(_state.Frozen);
+		SVArray(_state.R, 16);
+		SVArray(_state.UserRegs, 7);
+		SVArray(_state.FiqRegs, 7);
+		SVArray(_state.IrqRegs, 2);
+		SVArray(_state.SupervisorRegs, 2);
+		SVArray(_state.AbortRegs, 2);
+		SVArray(_state.UndefinedRegs, 2);
+
+		SV(_state.FiqSpsr.Mode);
+		SV(_state.FiqSpsr.Thumb);
+		SV(_state.FiqSpsr.FiqDisable);
+		SV(_state.FiqSpsr.IrqDisable);
+		SV(_state.FiqSpsr.Overflow);
+		SV(_state.FiqSpsr.Carry);
+		SV(_state.FiqSpsr.Zero);
+		SV(_state.FiqSpsr.Negative);
+
+		SV(_state.IrqSpsr.Mode);
+		SV(_state.IrqSpsr.Thumb);
+		SV(_state.IrqSpsr.FiqDisable);
+		SV(_state.IrqSpsr.IrqDisable);
+		SV(_state.IrqSpsr.Overflow);
+		SV(_state.IrqSpsr.Carry);
+		SV(_state.IrqSpsr.Zero);
+		SV(_state.IrqSpsr.Negative);
+
+		SV(_state.SupervisorSpsr.Mode);
+		SV(_state.SupervisorSpsr.Thumb);
+		SV(_state.SupervisorSpsr.FiqDisable);
+		SV(_state.SupervisorSpsr.IrqDisable);
+		SV(_state.SupervisorSpsr.Overflow);
+		SV(_state.SupervisorSpsr.Carry);
+		SV(_state.SupervisorSpsr.Zero);
+		SV(_state.SupervisorSpsr.Negative);
+
+		SV(_state.AbortSpsr.Mode);
+		SV(_state.AbortSpsr.Thumb);
+		SV(_state.AbortSpsr.FiqDisable);
+		SV(_state.AbortSpsr.IrqDisable);
+		SV(_state.AbortSpsr.Overflow);
+		SV(_state.AbortSpsr.Carry);
+		SV(_state.AbortSpsr.Zero);
+		SV(_state.AbortSpsr.Negative);
+
+		SV(_state.UndefinedSpsr.Mode);
+		SV(_state.UndefinedSpsr.Thumb);
+		SV(_state.UndefinedSpsr.FiqDisable);
+		SV(_state.UndefinedSpsr.IrqDisable);
+		SV(_state.UndefinedSpsr.Overflow);
+		SV(_state.UndefinedSpsr.Carry);
+		SV(_state.UndefinedSpsr.Zero);
+		SV(_state.UndefinedSpsr.Negative);
+
+		SV(_state.CycleCount);
+	});
 
 	SV(_ldmGlitch);
 	SV(_hasPendingIrq);
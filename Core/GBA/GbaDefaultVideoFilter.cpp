@@ -30,12 +30,10 @@ FrameInfo GbaDefaultVideoFilter::GetFrameInfo() {
 void GbaDefaultVideoFilter::InitLookupTable() {
 	VideoConfig config = _emu->GetSettings()->GetVideoConfig();
 
-	InitConversionMatrix(config.Hue, config.Saturation);
-
-	for (int rgb555 = 0; rgb555 < 0x8000; rgb555++) {
-		uint8_t r = rgb555 & 0x1F;
-		uint8_t g = (rgb555 >> 5) & 0x1F;
-		uint8_t b = (rgb555 >> 10) & 0x1F;
+	InitPaletteLut(_calculatedPalette, 0x8000, config, [this](uint32_t rgb555, uint8_t& r, uint8_t& g, uint8_t& b) {
+		r = rgb555 & 0x1F;
+		g = (rgb555 >> 5) & 0x1F;
+		b = (rgb555 >> 10) & 0x1F;
 
 		if (_gbaAdjustColors) {
 			// Adjust colors to simulate LCD screen (uses the same formula as Ares)
@@ -52,14 +50,7 @@ void GbaDefaultVideoFilter::InitLookupTable() {
 			g = ColorUtilities::Convert5BitTo8Bit(g);
 			b = ColorUtilities::Convert5BitTo8Bit(b);
 		}
-
-		if (config.Hue != 0 || config.Saturation != 0 || config.Brightness != 0 || config.Contrast != 0) {
-			ApplyColorOptions(r, g, b, config.Brightness, config.Contrast);
-			_calculatedPalette[rgb555] = 0xFF000000 | (r << 16) | (g << 8) | b;
-		} else {
-			_calculatedPalette[rgb555] = 0xFF000000 | (r << 16) | (g << 8) | b;
-		}
-	}
+	});
 
 	_videoConfig = config;
 }
@@ -69,7 +60,7 @@ void GbaDefaultVideoFilter::OnBeforeApplyFilter() {
 	GbaConfig gbaConfig = _emu->GetSettings()->GetGbaConfig();
 
 	bool adjustColors = gbaConfig.GbaAdjustColors;
-	if (_videoConfig.Hue != config.Hue || _videoConfig.Saturation != config.Saturation || _videoConfig.Contrast != config.Contrast || _videoConfig.Brightness != config.Brightness || _gbaAdjustColors != adjustColors) {
+	if (PaletteOptionsChanged(_videoConfig, config) || _gbaAdjustColors != adjustColors) {
 		_gbaAdjustColors = adjustColors;
 		InitLookupTable();
 	}
@@ -85,9 +76,10 @@ void GbaDefaultVideoFilter::OnBeforeApplyFilter() {
 void GbaDefaultVideoFilter::ApplyFilter(uint16_t* ppuOutputBuffer) {
 	uint32_t* out = GetOutputBuffer();
 
-	// Flat loop eliminates per-pixel multiply (was i * ScreenWidth + j)
-	for (uint32_t idx = 0; idx < GbaConstants::PixelCount; idx++) {
-		out[idx] = GetPixel(ppuOutputBuffer, idx);
+	if (_blendFrames) {
+		ConvertFrameBlended(_calculatedPalette, 0x7FFF, ppuOutputBuffer, _prevFrame.get(), GbaConstants::ScreenWidth, 0, 0, out, GbaConstants::ScreenWidth, GbaConstants::ScreenHeight);
+	} else {
+		ConvertFrame(_calculatedPalette, 0x7FFF, ppuOutputBuffer, GbaConstants::ScreenWidth, 0, 0, out, GbaConstants::ScreenWidth, GbaConstants::ScreenHeight);
 	}
 
 	if (_blendFrames) {
@@ -99,14 +91,3 @@ void GbaDefaultVideoFilter::ApplyFilter(uint16_t* ppuOutputBuffer) {
 	}
 }
 
-uint32_t GbaDefaultVideoFilter::GetPixel(uint16_t* ppuFrame, uint32_t offset) {
-	if (_blendFrames) {
-		return BlendPixels(_calculatedPalette[_prevFrame[offset] & 0x7FFF], _calculatedPalette[ppuFrame[offset] & 0x7FFF]);
-	} else {
-		return _calculatedPalette[ppuFrame[offset] & 0x7FFF];
-	}
-}
-
-uint32_t GbaDefaultVideoFilter::BlendPixels(uint32_t a, uint32_t b) {
-	return ((((a) ^ (b)) & 0xfffefefeL) >> 1) + ((a) & (b));
-}
@@ -174,8 +174,19 @@ void GbaDmaController::RunDma(GbaDmaChannel& ch, uint8_t chIndex) {
 	bool forceNonSeq = false;
 
 	_dmaActiveChannel = chIndex;
+	_memoryManager->ProcessDmaBurst(chIndex, true);
 
 	while (length-- > 0) {
+		if (!forceNonSeq && srcAddr == ch.SrcLatch && length + 1u >= GbaMemoryManager::MinDmaBulkUnits) {
+			uint32_t count = RunBulkTransfer(ch, chIndex, length + 1, mode, srcMode, destMode);
+			if (count) {
+				srcAddr = ch.SrcLatch;
+				mode |= GbaAccessMode::Sequential;
+				length = length + 1 - count;
+				continue;
+			}
+		}
+
 		uint32_t value;
 		if (srcAddr >= 0x2000000) {
 			if (!isRomSrc) {
@@ -275,6 +286,7 @@ void GbaDmaController::RunDma(GbaDmaChannel& ch, uint8_t chIndex) {
 	}
 
 	_dmaActiveChannel = -1;
+	_memoryManager->ProcessDmaBurst(chIndex, false);
 
 	ch.Active = false;
 	ch.Pending = false;
@@ -303,6 +315,36 @@ void GbaDmaController::RunDma(GbaDmaChannel& ch, uint8_t chIndex) {
 	}
 }
 
+uint32_t GbaDmaController::RunBulkTransfer(GbaDmaChannel& ch, uint8_t chIndex, uint32_t count, GbaAccessModeVal mode, GbaDmaAddrMode srcMode, GbaDmaAddrMode destMode) {
+	// Decrementing addresses are uncommon, left to the per-unit path
+	bool incSrc = srcMode == GbaDmaAddrMode::Increment;
+	bool incDest = destMode == GbaDmaAddrMode::Increment || destMode == GbaDmaAddrMode::IncrementReload;
+	if ((!incSrc && srcMode != GbaDmaAddrMode::Fixed) || (!incDest && destMode != GbaDmaAddrMode::Fixed)) {
+		return 0;
+	}
+
+	// A higher priority channel would interrupt the transfer (no new channel can be triggered during the bulk transfer)
+	for (int i = 0; i < chIndex; i++) {
+		if (_state.Ch[i].Pending) {
+			return 0;
+		}
+	}
+
+	uint32_t lastValue = 0;
+	count = _memoryManager->RunDmaBulkTransfer(mode, ch.SrcLatch, incSrc, ch.DestLatch, incDest, count, lastValue);
+	if (count) {
+		uint8_t offset = (mode & GbaAccessMode::Word) ? 4 : 2;
+		ch.ReadValue = (mode & GbaAccessMode::Word) ? lastValue : (lastValue | (lastValue << 16));
+		if (incSrc) {
+			ch.SrcLatch += count * offset;
+		}
+		if (incDest) {
+			ch.DestLatch += count * offset;
+		}
+	}
+	return count;
+}
+
 bool GbaDmaController::CanRunInParallelWithDma() {
 	if (_idleCycleCounter) {
 		_idleCycleCounter--;
@@ -52,6 +52,13 @@ private:
 	/// <param name="chIndex">Channel index (0-3).</param>
 	void RunDma(GbaDmaChannel& ch, uint8_t chIndex);
 
+	/// <summary>
+	/// Runs the next units of a transfer in one step when possible (see GbaMemoryManager::RunDmaBulkTransfer),
+	/// updates the channel's latched addresses and read buffer.
+	/// </summary>
+	/// <returns>Number of units transferred (0 when the next unit must run through the regular path).</returns>
+	uint32_t RunBulkTransfer(GbaDmaChannel& ch, uint8_t chIndex, uint32_t count, GbaAccessModeVal mode, GbaDmaAddrMode srcMode, GbaDmaAddrMode destMode);
+
 public:
 	/// <summary>
 	/// Initializes DMA controller with hardware references.
@@ -39,6 +39,7 @@ GbaMemoryManager::GbaMemoryManager(Emulator* emu, GbaConsole* console, GbaPpu* p
 	// Get pointers to all memory regions
 	_prgRom = (uint8_t*)emu->GetMemory(MemoryType::GbaPrgRom).Memory;
 	_prgRomSize = emu->GetMemory(MemoryType::GbaPrgRom).Size;
+	_prgRomShared = emu->GetMemory(MemoryType::GbaPrgRom).Shared;
 	_bootRom = (uint8_t*)emu->GetMemory(MemoryType::GbaBootRom).Memory;
 	_intWorkRam = (uint8_t*)emu->GetMemory(MemoryType::GbaIntWorkRam).Memory;  // 32KB internal WRAM
 	_extWorkRam = (uint8_t*)emu->GetMemory(MemoryType::GbaExtWorkRam).Memory;  // 256KB external WRAM
@@ -92,6 +93,10 @@ void GbaMemoryManager::ProcessStoppedCycle() {
 	// What exactly is disabled when stopped?
 	// This at least works for the games that were tested (but is very likely inaccurate)
 	_masterClock++;
+	if (_pendingIrqs.HasEvents()) {
+		// Pending IRQs don't progress while stopped
+		_pendingIrqs.DelayEvents(1);
+	}
 	_ppu->Exec(); // keep PPU running to keep emulation running properly
 	_timer->Exec(_masterClock);
 }
@@ -130,16 +135,11 @@ void GbaMemoryManager::ProcessPendingUpdates(bool allowStartDma) {
 		_state.IME = _state.NewIME;
 	}
 
-	if (_pendingIrqs.size()) {
-		for (int i = (int)_pendingIrqs.size() - 1; i >= 0; i--) {
-			if (_pendingIrqs[i].Delay && --_pendingIrqs[i].Delay == 0) {
-				_state.NewIF |= (int)_pendingIrqs[i].Source;
-				// Swap-and-pop: O(1) removal since order doesn't matter and we iterate in reverse
-				_pendingIrqs[i] = _pendingIrqs.back();
-				_pendingIrqs.pop_back();
-				TriggerIrqUpdate();
-			}
-		}
+	if (_pendingIrqs.IsEventDue(_masterClock)) {
+		_pendingIrqs.ProcessEvents(_masterClock, [this](GbaIrqSource source, uint64_t clock) {
+			_state.NewIF |= (int)source;
+		});
+		TriggerIrqUpdate();
 	}
 
 	if (_timer->HasPendingTimers()) {
@@ -164,7 +164,7 @@ void GbaMemoryManager::ProcessPendingUpdates(bool allowStartDma) {
 	_hasPendingUpdates = (_dmaController->HasPendingDma() ||
 	                      _timer->HasPendingTimers() ||
 	                      _state.IrqUpdateCounter ||
-	                      _pendingIrqs.size() ||
+	                      _pendingIrqs.HasEvents() ||
 	                      _haltDelay ||
 	                      _objEnableDelay ||
 	                      (_dmaController->IsRunning() && _dmaIrqCounter < 10) ||
@@ -179,6 +179,7 @@ void GbaMemoryManager::ProcessPendingLateUpdates() {
 	_hasPendingLateUpdates = false;
 }
 
+template <int bank>
 void GbaMemoryManager::ProcessWaitStates(GbaAccessModeVal mode, uint32_t addr) {
 	uint8_t waitStates;
 
@@ -187,7 +188,8 @@ void GbaMemoryManager::ProcessWaitStates(GbaAccessModeVal mode, uint32_t addr) {
 	ProcessInternalCycle<true>();
 	_dmaController->ResetIdleCounter(mode);
 
-	if (addr < 0x8000000 || addr >= 0x10000000) {
+	bool isRom = bank == AnyBank ? (addr >= 0x8000000 && addr < 0x10000000) : bank == 0x08;
+	if (!isRom) {
 		waitStates = _waitStates.GetWaitStates(mode, addr);
 		if (_prefetch->NeedExec(_state.PrefetchEnabled)) {
 			_prefetch->Exec(waitStates, _state.PrefetchEnabled);
@@ -208,6 +210,10 @@ void GbaMemoryManager::ProcessWaitStates(GbaAccessModeVal mode, uint32_t addr) {
 	}
 	waitStates--;
 
+	if (waitStates >= 2 && TrySkipInternalCycles(waitStates)) {
+		return;
+	}
+
 	while (waitStates >= 3) {
 		ProcessInternalCycle();
 		ProcessInternalCycle();
@@ -225,6 +231,22 @@ void GbaMemoryManager::ProcessWaitStates(GbaAccessModeVal mode, uint32_t addr) {
 	}
 }
 
+bool GbaMemoryManager::TrySkipInternalCycles(uint8_t count) {
+	// Wait states are usually spent with nothing happening anywhere. Apply them in one step unless something
+	// (an update, an hblank, a timer overflow, the debugger's per-cycle hook) needs to see the individual cycles.
+	if (_hasPendingUpdates || _hasPendingLateUpdates || _emu->IsDebugging()) {
+		return false;
+	}
+	if (!_ppu->CanSkipCycles(count) || !_timer->CanSkipCycles(_masterClock, count)) {
+		return false;
+	}
+
+	_ppu->SkipCycles(count);
+	_timer->SkipCycles(_masterClock, count);
+	_masterClock += count;
+	return true;
+}
+
 void GbaMemoryManager::ProcessVramAccess(GbaAccessModeVal mode, uint32_t addr) {
 	uint8_t memType = (addr - 0x4000000) >> 24;
 	if (memType == 3) {
@@ -257,16 +279,16 @@ void GbaMemoryManager::ProcessVramStalling(uint8_t memType) {
 	}
 }
 
-template <uint8_t width>
+template <uint8_t width, int bank>
 void GbaMemoryManager::UpdateOpenBus(uint32_t addr, uint32_t value) {
-	if (addr >= 0x10000000) {
+	if (bank == AnyBank && addr >= 0x10000000) {
 		// Accessing open bus addresses should probably not update the current open bus value
 		// This is needed to pass the test rom that dumps the bios to save ram by abusing open bus (See: https://gist.github.com/profi200/c7fef99003fa5d07235d97296da23db3)
 		// TODOGBA reading other open bus addresses probably should behave the same? (e.g registers that don't exist, etc.)
 		return;
 	}
 
-	if ((addr & 0xFF000000) == 0x03000000) {
+	if (bank == AnyBank ? (addr & 0xFF000000) == 0x03000000 : bank == 0x03) {
 		// IWRAM appears to have its own open bus value, which overwrites
 		// the main bus' open bus value whenever IWRAM is read
 		// This is unverified, but passes the openbuster test
@@ -292,41 +314,65 @@ void GbaMemoryManager::UpdateOpenBus(uint32_t addr, uint32_t value) {
 }
 
 uint32_t GbaMemoryManager::Read(GbaAccessModeVal mode, uint32_t addr) {
-	if (addr < 0x8000000 && addr >= 0x5000000) {
+	// Opcode fetches and most loads/stores hit work ram or rom, their paths skip the other regions' checks
+	switch (addr >> 24) {
+		case 0x02: return ReadBank<0x02>(mode, addr);
+		case 0x03: return ReadBank<0x03>(mode, addr);
+		case 0x08: case 0x09: case 0x0A: case 0x0B: case 0x0C: return ReadBank<0x08>(mode, addr);
+		default: return ReadBank<AnyBank>(mode, addr);
+	}
+}
+
+template <int bank>
+uint32_t GbaMemoryManager::ReadBank(GbaAccessModeVal mode, uint32_t addr) {
+	if (bank == AnyBank && addr < 0x8000000 && addr >= 0x5000000) {
 		ProcessVramAccess(mode, addr);
 	} else {
-		ProcessWaitStates(mode, addr);
+		ProcessWaitStates<bank>(mode, addr);
 	}
 
 	uint32_t value;
 
 	if (mode & GbaAccessMode::Prefetch) {
-		_biosLocked = addr >= GbaConsole::BootRomSize;
+		_biosLocked = bank != AnyBank || addr >= GbaConsole::BootRomSize;
 	}
 
 	bool isSigned = mode & GbaAccessMode::Signed;
 	if (mode & GbaAccessMode::Byte) {
-		value = InternalRead(mode, addr, addr);
-		UpdateOpenBus<1>(addr, value);
+		if (uint8_t* src = bank != AnyBank ? GetDirectReadPtr<bank>(addr, 1) : nullptr) {
+			value = *src;
+		} else {
+			value = InternalRead(mode, addr, addr);
+		}
+		UpdateOpenBus<1, bank>(addr, value);
 		value = isSigned ? (uint32_t)(int8_t)value : (uint8_t)value;
 		_emu->ProcessMemoryRead<CpuType::Gba, 1>(addr, value, MemoryOperationType::Read);
 	} else if (mode & GbaAccessMode::HalfWord) {
-		uint8_t b0 = InternalRead(mode, addr & ~0x01, addr);
-		uint8_t b1 = InternalRead(mode, addr | 1, addr);
-		value = b0 | (b1 << 8);
-		UpdateOpenBus<2>(addr, value);
+		if (uint8_t* src = GetDirectReadPtr<bank>(addr & ~0x01, 2)) [[likely]] {
+			// Thumb fetches and most loads, same result as going through InternalRead byte by byte
+			value = src[0] | (src[1] << 8);
+		} else {
+			uint8_t b0 = InternalRead(mode, addr & ~0x01, addr);
+			uint8_t b1 = InternalRead(mode, addr | 1, addr);
+			value = b0 | (b1 << 8);
+		}
+		UpdateOpenBus<2, bank>(addr, value);
 		value = isSigned ? (uint32_t)(int16_t)value : (uint16_t)value;
 		if (!(mode & GbaAccessMode::NoRotate) && (addr & 0x01)) {
 			value = RotateValue(mode, addr, value, isSigned);
 		}
 		_emu->ProcessMemoryRead<CpuType::Gba, 2>(addr & ~0x01, value, mode & GbaAccessMode::Prefetch ? MemoryOperationType::ExecOpCode : MemoryOperationType::Read);
 	} else {
-		uint8_t b0 = InternalRead(mode, addr & ~0x03, addr);
-		uint8_t b1 = InternalRead(mode, (addr & ~0x03) | 1, addr);
-		uint8_t b2 = InternalRead(mode, (addr & ~0x03) | 2, addr);
-		uint8_t b3 = InternalRead(mode, addr | 3, addr);
-		value = b0 | (b1 << 8) | (b2 << 16) | (b3 << 24);
-		UpdateOpenBus<4>(addr, value);
+		if (uint8_t* src = GetDirectReadPtr<bank>(addr & ~0x03, 4)) [[likely]] {
+			value = src[0] | (src[1] << 8) | (src[2] << 16) | (src[3] << 24);
+		} else {
+			uint8_t b0 = InternalRead(mode, addr & ~0x03, addr);
+			uint8_t b1 = InternalRead(mode, (addr & ~0x03) | 1, addr);
+			uint8_t b2 = InternalRead(mode, (addr & ~0x03) | 2, addr);
+			uint8_t b3 = InternalRead(mode, addr | 3, addr);
+			value = b0 | (b1 << 8) | (b2 << 16) | (b3 << 24);
+		}
+		UpdateOpenBus<4, bank>(addr, value);
 		if (!(mode & GbaAccessMode::NoRotate) && (addr & 0x03)) {
 			value = RotateValue(mode, addr, value, isSigned);
 		}
@@ -353,10 +399,34 @@ uint32_t GbaMemoryManager::RotateValue(GbaAccessModeVal mode, uint32_t addr, uin
 }
 
 void GbaMemoryManager::Write(GbaAccessModeVal mode, uint32_t addr, uint32_t value) {
-	if (addr >= 0x5000000 && addr < 0x8000000) {
+	switch (addr >> 24) {
+		case 0x02: WriteBank<0x02>(mode, addr, value); break;
+		case 0x03: WriteBank<0x03>(mode, addr, value); break;
+		default: WriteBank<AnyBank>(mode, addr, value); break;
+	}
+}
+
+template <int bank>
+void GbaMemoryManager::WriteBank(GbaAccessModeVal mode, uint32_t addr, uint32_t value) {
+	if (bank == AnyBank && addr >= 0x5000000 && addr < 0x8000000) {
 		ProcessVramAccess(mode, addr);
 	} else {
-		ProcessWaitStates(mode, addr);
+		ProcessWaitStates<bank>(mode, addr);
+	}
+
+	if constexpr (bank == 0x02 || bank == 0x03) {
+		bool allowWrite;
+		if (mode & GbaAccessMode::Byte) {
+			allowWrite = _emu->ProcessMemoryWrite<CpuType::Gba, 1>(addr, value, MemoryOperationType::Write);
+		} else if (mode & GbaAccessMode::HalfWord) {
+			allowWrite = _emu->ProcessMemoryWrite<CpuType::Gba, 2>(addr & ~0x01, value, MemoryOperationType::Write);
+		} else {
+			allowWrite = _emu->ProcessMemoryWrite<CpuType::Gba, 4>(addr & ~0x03, value, MemoryOperationType::Write);
+		}
+		if (allowWrite) {
+			WriteWorkRam<bank>(mode, addr, value);
+		}
+		return;
 	}
 
 	if (mode & GbaAccessMode::Byte) {
@@ -437,6 +507,47 @@ uint8_t GbaMemoryManager::InternalRead(GbaAccessModeVal mode, uint32_t addr, uin
 	return _state.InternalOpenBus[addr & 0x03];
 }
 
+template <int bank>
+void GbaMemoryManager::WriteWorkRam(GbaAccessModeVal mode, uint32_t addr, uint32_t value) {
+	uint8_t width = (mode & GbaAccessMode::Byte) ? 1 : ((mode & GbaAccessMode::HalfWord) ? 2 : 4);
+	addr &= ~(width - 1);
+	uint8_t* dst = bank == 0x02 ? _extWorkRam + (addr & (GbaConsole::ExtWorkRamSize - 1)) : _intWorkRam + (addr & (GbaConsole::IntWorkRamSize - 1));
+	for (int i = 0; i < width; i++) {
+		uint8_t byte = (uint8_t)(value >> (i * 8));
+		_state.InternalOpenBus[(addr + i) & 0x03] = byte;
+		if constexpr (bank == 0x03) {
+			_state.IwramOpenBus[(addr + i) & 0x03] = byte;
+		}
+		dst[i] = byte;
+	}
+}
+
+template <int bank>
+uint8_t* GbaMemoryManager::GetDirectReadPtr(uint32_t addr, uint32_t size) {
+	if constexpr (bank == 0x02) {
+		return _extWorkRam + (addr & (GbaConsole::ExtWorkRamSize - 1));
+	} else if constexpr (bank == 0x03) {
+		return _intWorkRam + (addr & (GbaConsole::IntWorkRamSize - 1));
+	} else if constexpr (bank == 0x08) {
+		return _cart->GetRomReadPtr(addr, size);
+	}
+
+	switch (addr >> 24) {
+		case 0x02:
+			return _extWorkRam + (addr & (GbaConsole::ExtWorkRamSize - 1));
+		case 0x03:
+			return _intWorkRam + (addr & (GbaConsole::IntWorkRamSize - 1));
+
+		case 0x08:
+		case 0x09:
+		case 0x0A:
+		case 0x0B:
+		case 0x0C:
+			return _cart->GetRomReadPtr(addr, size);
+	}
+	return nullptr;
+}
+
 void GbaMemoryManager::InternalWrite(GbaAccessModeVal mode, uint32_t addr, uint8_t value, uint32_t writeAddr, uint32_t fullValue) {
 	uint8_t bank = (addr >> 24);
 	addr &= 0xFFFFFF;
@@ -706,6 +817,143 @@ void GbaMemoryManager::ProcessDmaStart() {
 	SetPendingUpdateFlag();
 }
 
+void GbaMemoryManager::ProcessDmaBurst(uint8_t channel, bool started) {
+	_emu->ProcessDmaBurst<CpuType::Gba>(channel, started);
+}
+
+uint32_t GbaMemoryManager::RunDmaBulkTransfer(GbaAccessModeVal mode, uint32_t src, bool incSrc, uint32_t dest, bool incDest, uint32_t count, uint32_t& lastValue) {
+	// The per-unit path runs every cycle through ProcessInternalCycle and syncs the PPU's renderer before each
+	// video memory write: skipping this is only safe when none of it has a visible effect during the transfer
+	if (_hasPendingUpdates || _hasPendingLateUpdates || _emu->HasDebugHooks() || !_ppu->IsVideoMemoryIdle()) {
+		return 0;
+	}
+
+	uint32_t width = (mode & GbaAccessMode::Word) ? 4 : 2;
+	uint8_t srcBank = src >> 24;
+	bool isRom = srcBank >= 0x08 && srcBank <= 0x0C;
+	if (isRom) {
+		// Each DMA read from rom resets the prefetcher, it's already reset after the transfer's first rom read.
+		// Fixed source addresses, the gpio ports and the unit before a 128kb boundary (non-sequential timing
+		// for the next read) are left to the regular path.
+		if (!incSrc || src < 0x80000D0 || !_prefetch->IsReset()) {
+			return 0;
+		}
+		count = std::min(count, (0x20000 - (src & 0x1FFFF)) / width - 1);
+	} else if (srcBank == 0x02 || srcBank == 0x03) {
+		// The prefetcher runs during non-rom accesses
+		if (_prefetch->NeedExec(_state.PrefetchEnabled)) {
+			return 0;
+		}
+		if (incSrc) {
+			uint32_t size = srcBank == 0x02 ? GbaConsole::ExtWorkRamSize : GbaConsole::IntWorkRamSize;
+			count = std::min(count, (size - (src & (size - 1))) / width);
+		}
+	} else {
+		return 0;
+	}
+
+	uint8_t destBank = dest >> 24;
+	uint8_t* destRam;
+	uint32_t destOffset;
+	uint32_t destSize;
+	switch (destBank) {
+		case 0x05:
+			destRam = _palette;
+			destSize = GbaConsole::PaletteRamSize;
+			destOffset = dest & (destSize - 1);
+			break;
+		case 0x06:
+			// Only the first 96kb, not the mirrors (which depend on the ppu's mode)
+			destRam = _vram;
+			destSize = GbaConsole::VideoRamSize;
+			destOffset = dest & 0xFFFFFF;
+			if (destOffset >= destSize) {
+				return 0;
+			}
+			break;
+		case 0x07:
+			destRam = _oam;
+			destSize = GbaConsole::SpriteRamSize;
+			destOffset = dest & (destSize - 1);
+			break;
+		default:
+			return 0;
+	}
+	if (incDest) {
+		count = std::min(count, (destSize - destOffset) / width);
+	}
+
+	// Same cycle counts as ProcessWaitStates/ProcessVramAccess, video memory never stalls while the PPU is idle
+	uint32_t writeCycles = (width == 4 && destBank != 0x07) ? 2 : 1;
+	uint32_t firstCycles = _waitStates.GetWaitStates(mode, src) + writeCycles;
+	uint32_t unitCycles = _waitStates.GetWaitStates(mode | GbaAccessMode::Sequential, incSrc ? src + width : src) + writeCycles;
+	uint32_t maxCycles = _ppu->GetSkippableCycles();
+	if (maxCycles < firstCycles) {
+		return 0;
+	}
+	count = std::min(count, (maxCycles - firstCycles) / unitCycles + 1);
+
+	uint32_t cycles;
+	while (true) {
+		if (count < GbaMemoryManager::MinDmaBulkUnits) {
+			return 0;
+		}
+		cycles = firstCycles + (count - 1) * unitCycles;
+		if (_timer->CanSkipCycles(_masterClock, cycles)) {
+			break;
+		}
+		// A timer overflows during the transfer (e.g audio fifo dma), transfer the units before it
+		count /= 2;
+	}
+
+	uint8_t* srcData;
+	if (isRom) {
+		srcData = _cart->GetRomReadPtr(src, incSrc ? count * width : width);
+		if (!srcData) {
+			return 0;
+		}
+	} else if (srcBank == 0x02) {
+		srcData = _extWorkRam + (src & (GbaConsole::ExtWorkRamSize - 1));
+	} else {
+		srcData = _intWorkRam + (src & (GbaConsole::IntWorkRamSize - 1));
+	}
+
+	uint8_t* destData = destRam + destOffset;
+	if (incSrc && incDest) {
+		memcpy(destData, srcData, count * width);
+	} else if (incDest) {
+		for (uint32_t i = 0; i < count; i++) {
+			memcpy(destData + i * width, srcData, width);
+		}
+	} else {
+		// Each unit overwrites the previous one
+		memcpy(destData, srcData + (incSrc ? (count - 1) * width : 0), width);
+	}
+
+	// Open bus values only depend on the last 2 units (a half-word unit only updates half of IWRAM's open bus value)
+	for (uint32_t i = count > 2 ? count - 2 : 0; i < count; i++) {
+		uint8_t* unitData = srcData + (incSrc ? i * width : 0);
+		uint32_t unitDest = incDest ? dest + i * width : dest;
+		if (width == 4) {
+			lastValue = unitData[0] | (unitData[1] << 8) | (unitData[2] << 16) | (unitData[3] << 24);
+			UpdateOpenBus<4>(incSrc ? src + i * width : src, lastValue);
+		} else {
+			lastValue = unitData[0] | (unitData[1] << 8);
+			UpdateOpenBus<2>(incSrc ? src + i * width : src, lastValue);
+		}
+		for (uint32_t j = 0; j < width; j++) {
+			_state.InternalOpenBus[(unitDest + j) & 0x03] = (uint8_t)(lastValue >> (j * 8));
+		}
+	}
+
+	_ppu->SkipCycles(cycles);
+	_timer->SkipCycles(_masterClock, cycles);
+	_masterClock += cycles;
+	_irqFirstAccessCycle = _state.IrqLine;
+	_dmaController->ResetIdleCounter();
+	return count;
+}
+
 void GbaMemoryManager::TriggerIrqUpdate() {
 	_state.IrqUpdateCounter = 3;
 	SetPendingUpdateFlag();
@@ -717,7 +965,7 @@ void GbaMemoryManager::TriggerObjEnableUpdate() {
 }
 
 void GbaMemoryManager::SetDelayedIrqSource(GbaIrqSource source, uint8_t delay) {
-	_pendingIrqs.emplace_back(source, delay);
+	_pendingIrqs.Schedule(_masterClock + delay, source);
 	SetPendingUpdateFlag();
 }
 
@@ -880,7 +1128,7 @@ void GbaMemoryManager::DebugWrite(uint32_t addr, uint8_t value) {
 		case 0x0B:
 		case 0x0C:
 		case 0x0D:
-			if (addr < _prgRomSize) {
+			if (addr < _prgRomSize && !_prgRomShared) {
 				_prgRom[addr] = value;
 			}
 			break;
@@ -990,7 +1238,7 @@ void GbaMemoryManager::Serialize(Serializer& s) {
 		SV(_hasPendingUpdates);
 		SV(_hasPendingLateUpdates);
 
-		SVVector(_pendingIrqs);
+		SV(_pendingIrqs);
 
 		SV(_haltModeUsed);
 		SV(_biosLocked);
@@ -7,6 +7,7 @@
 #include "GBA/GbaWaitStates.h"
 #include "GBA/GbaRomPrefetch.h"
 #include "Debugger/AddressInfo.h"
+#include "Shared/EventScheduler.h"
 #include "Utilities/ISerializable.h"
 
 class Emulator;
@@ -20,15 +21,6 @@ class GbaCart;
 class GbaSerial;
 class MgbaLogHandler;
 
-/// <summary>
-/// Pending IRQ with delay counter.
-/// IRQs are not instant - they have a small propagation delay.
-/// </summary>
-struct GbaPendingIrq {
-	GbaIrqSource Source;  ///< IRQ source type
-	uint8_t Delay;        ///< Cycles until IRQ triggers
-};
-
 /// <summary>
 /// Game Boy Advance memory manager - unified 32-bit bus system.
 /// Handles all memory access, wait states, and DMA coordination.
@@ -119,6 +111,9 @@ private:
 	/// <summary>Program ROM size.</summary>
 	uint32_t _prgRomSize = 0;
 
+	/// <summary>Program ROM buffer shared with other instances (SharedRomCache), debug writes are ignored.</summary>
+	bool _prgRomShared = false;
+
 	/// <summary>Program ROM data (up to 32MB).</summary>
 	uint8_t* _prgRom = nullptr;
 
@@ -146,8 +141,8 @@ private:
 	/// <summary>Save RAM size.</summary>
 	uint32_t _saveRamSize = 0;
 
-	/// <summary>Queue of pending IRQs with delays.</summary>
-	vector<GbaPendingIrq> _pendingIrqs;
+	/// <summary>Pending IRQs (IRQs are not instant - they have a small propagation delay), scheduled at the master clock where they trigger.</summary>
+	EventScheduler<GbaIrqSource> _pendingIrqs;
 
 	/// <summary>Whether HALT mode has been used.</summary>
 	bool _haltModeUsed = false;
@@ -173,9 +168,17 @@ private:
 	/// <summary>OBJ enable delay counter.</summary>
 	uint8_t _objEnableDelay = 0;
 
+	/// <summary>Region-specialized code paths, bank is bits 24-27 of the address: 2 (EWRAM), 3 (IWRAM), 8 (ROM, 08-0C) or AnyBank.</summary>
+	static constexpr int AnyBank = -1;
+
 	/// <summary>Processes wait states for memory access.</summary>
+	template <int bank = AnyBank>
 	__forceinline void ProcessWaitStates(GbaAccessModeVal mode, uint32_t addr);
 
+	/// <summary>Runs count internal cycles in one step when no PPU/timer event or pending update falls inside them.</summary>
+	/// <returns>False (nothing done) when the cycles must be run one at a time.</returns>
+	__forceinline bool TrySkipInternalCycles(uint8_t count);
+
 	/// <summary>Processes VRAM access with stalling.</summary>
 	__noinline void ProcessVramAccess(GbaAccessModeVal mode, uint32_t addr);
 
@@ -183,7 +186,7 @@ private:
 	__noinline void ProcessVramStalling(uint8_t memType);
 
 	/// <summary>Updates open bus value based on access width.</summary>
-	template <uint8_t width>
+	template <uint8_t width, int bank = AnyBank>
 	void UpdateOpenBus(uint32_t addr, uint32_t value);
 
 	/// <summary>Rotates misaligned read value.</summary>
@@ -193,6 +196,20 @@ private:
 	/// <summary>Internal memory read.</summary>
 	__forceinline uint8_t InternalRead(GbaAccessModeVal mode, uint32_t addr, uint32_t readAddr);
 
+	/// <summary>Pointer for aligned halfword/word reads from work ram/rom (no side effects), nullptr for everything else.</summary>
+	template <int bank = AnyBank>
+	__forceinline uint8_t* GetDirectReadPtr(uint32_t addr, uint32_t size);
+
+	/// <summary>Read/Write, with the region checks resolved at compile time when bank is known.</summary>
+	template <int bank>
+	__forceinline uint32_t ReadBank(GbaAccessModeVal mode, uint32_t addr);
+	template <int bank>
+	__forceinline void WriteBank(GbaAccessModeVal mode, uint32_t addr, uint32_t value);
+
+	/// <summary>Stores a byte/halfword/word to work ram (bank 2 or 3), same side effects as InternalWrite.</summary>
+	template <int bank>
+	__forceinline void WriteWorkRam(GbaAccessModeVal mode, uint32_t addr, uint32_t value);
+
 	/// <summary>Internal memory write.</summary>
 	__forceinline void InternalWrite(GbaAccessModeVal mode, uint32_t addr, uint8_t value, uint32_t writeAddr, uint32_t fullValue);
 
@@ -283,9 +300,31 @@ public:
 		}
 	}
 
+	/// <summary>Minimum number of units for RunDmaBulkTransfer, shorter runs go through Read/Write.</summary>
+	static constexpr uint32_t MinDmaBulkUnits = 4;
+
 	/// <summary>Processes DMA start request.</summary>
 	void ProcessDmaStart();
 
+	/// <summary>Notifies the debugger that a DMA channel's transfer started/ended.</summary>
+	void ProcessDmaBurst(uint8_t channel, bool started);
+
+	/// <summary>
+	/// Runs up to count units of a DMA transfer from work ram/rom to palette/vram/oam in one step: copies the data
+	/// and applies the cycles of all the accesses at once, with the same results as the per-unit Read/Write calls.
+	/// Only done when nothing can observe the individual accesses (no pending update, no PPU/timer event or video
+	/// memory access by the PPU during these cycles, no debugger hooks).
+	/// </summary>
+	/// <param name="mode">Access mode of the first unit (width, Dma, Sequential).</param>
+	/// <param name="src">Source address of the first unit (aligned).</param>
+	/// <param name="incSrc">False when the source address is fixed.</param>
+	/// <param name="dest">Destination address of the first unit (aligned).</param>
+	/// <param name="incDest">False when the destination address is fixed.</param>
+	/// <param name="count">Maximum number of units.</param>
+	/// <param name="lastValue">Value read by the last unit.</param>
+	/// <returns>Number of units transferred, 0 when the next unit must go through Read/Write.</returns>
+	uint32_t RunDmaBulkTransfer(GbaAccessModeVal mode, uint32_t src, bool incSrc, uint32_t dest, bool incDest, uint32_t count, uint32_t& lastValue);
+
 	/// <summary>Runs pending DMA transfers.</summary>
 	__forceinline void ProcessDma() {
 		if (_dmaController->HasPendingDma()) {
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "GBA/GbaPpu.h"
+#include "GBA/GbaColorBlender.h"
 #include "GBA/APU/GbaApu.h"
 #include "GBA/GbaTypes.h"
 #include "GBA/GbaConsole.h"
@@ -8,13 +9,13 @@
 #include "GBA/Debugger/GbaPpuTools.h"
 #include "Debugger/DebugTypes.h"
 #include "Shared/Emulator.h"
+#include "Shared/FrameProfiler.h"
 #include "Shared/EmuSettings.h"
 #include "Shared/BaseControlManager.h"
 #include "Shared/RewindManager.h"
 #include "Shared/MessageManager.h"
 #include "Shared/RenderedFrame.h"
 #include "Shared/Video/VideoDecoder.h"
-#include "Shared/Video/VideoRenderer.h"
 #include "Shared/EventType.h"
 #include "Shared/NotificationManager.h"
 #include "Utilities/BitUtilities.h"
@@ -157,11 +158,7 @@ void GbaPpu::ProcessEndOfScanline() {
 
 		_emu->ProcessEvent(EventType::StartFrame, CpuType::Gba);
 
-		_skipRender = (!cfg.DisableFrameSkipping &&
-		               !_emu->GetRewindManager()->IsRewinding() &&
-		               !_emu->GetVideoRenderer()->IsRecording() &&
-		               (settings->GetEmulationSpeed() == 0 || settings->GetEmulationSpeed() > 150) &&
-		               _frameSkipTimer.GetElapsedMS() < 15);
+		_skipRender = _emu->IsRenderSkipped(!cfg.DisableFrameSkipping, _frameSkipTimer, 15);
 		if (!_skipRender) {
 			_currentBuffer = _currentBuffer == _outputBuffers[0].get() ? _outputBuffers[1].get() : _outputBuffers[0].get();
 		}
@@ -208,6 +205,7 @@ void GbaPpu::DebugSendFrame() {
 }
 
 void GbaPpu::RenderScanline(bool forceRender) {
+	PROFILE_SCOPE(_emu->GetFrameProfiler(), ProfilerStage::Ppu);
 	ProcessLayerToggleDelay();
 
 	if (_skipRender && !forceRender) {
@@ -327,7 +325,7 @@ void GbaPpu::ProcessColorMath() {
 
 		if ((main.Color & (GbaPpu::SpriteBlendFlag | GbaPpu::DirectColorFlag)) == GbaPpu::SpriteBlendFlag && _state.BlendSub[sub.Layer]) {
 			// Sprite transparency is applied before anything else
-			BlendColors(dst, x, ReadColor<false>(x, main.Color), mainCoeff, ReadColor<true>(x, sub.Color), subCoeff);
+			dst[x] = GbaColorBlender::BlendColors(ReadColor<false>(x, main.Color), mainCoeff, ReadColor<true>(x, sub.Color), subCoeff);
 		} else {
 			if constexpr (effect == GbaPpuBlendEffect::None) {
 				dst[x] = ReadColor<false>(x, main.Color);
@@ -336,7 +334,7 @@ void GbaPpu::ProcessColorMath() {
 					if (!_state.BlendMain[main.Layer] || !_state.WindowActiveLayers[wnd][GbaPpu::EffectLayerIndex]) {
 						dst[x] = ReadColor<false>(x, main.Color);
 					} else {
-						BlendColors(dst, x, ReadColor<false>(x, main.Color), mainCoeff, ReadColor<true>(x, sub.Color), subCoeff);
+						dst[x] = GbaColorBlender::BlendColors(ReadColor<false>(x, main.Color), mainCoeff, ReadColor<true>(x, sub.Color), subCoeff);
 					}
 				} else {
 					dst[x] = ReadColor<false>(x, main.Color);
@@ -345,7 +343,7 @@ void GbaPpu::ProcessColorMath() {
 				if (brightness == 0 || !_state.BlendMain[main.Layer] || !_state.WindowActiveLayers[wnd][GbaPpu::EffectLayerIndex]) {
 					dst[x] = ReadColor<false>(x, main.Color);
 				} else {
-					BlendColors(dst, x, ReadColor<false>(x, main.Color), 16 - brightness, blendColor, brightness);
+					dst[x] = GbaColorBlender::BlendColors(ReadColor<false>(x, main.Color), 16 - brightness, blendColor, brightness);
 				}
 			}
 		}
@@ -371,22 +369,6 @@ uint16_t GbaPpu::ReadColor(int x, uint16_t addr) {
 	}
 }
 
-void GbaPpu::BlendColors(uint16_t* dst, int x, uint16_t main, uint8_t aCoeff, uint16_t sub, uint8_t bCoeff) {
-	uint8_t aR = main & 0x1F;
-	uint8_t aG = (main >> 5) & 0x1F;
-	uint8_t aB = (main >> 10) & 0x1F;
-
-	uint8_t bR = sub & 0x1F;
-	uint8_t bG = (sub >> 5) & 0x1F;
-	uint8_t bB = (sub >> 10) & 0x1F;
-
-	uint32_t r = std::min(31, (aR * aCoeff + bR * bCoeff) >> 4);
-	uint32_t g = std::min(31, (aG * aCoeff + bG * bCoeff) >> 4);
-	uint32_t b = std::min(31, (aB * aCoeff + bB * bCoeff) >> 4);
-
-	dst[x] = r | (g << 5) | (b << 10);
-}
-
 void GbaPpu::InitializeWindows() {
 	// Windows are enabled/disabled when the scanline reaches the start/end scanlines
 	// See window_midframe test - unsure about behavior when top==bottom
@@ -243,9 +243,6 @@ private:
 	template <GbaPpuBlendEffect effect, bool bg0Enabled, bool bg1Enabled, bool bg2Enabled, bool bg3Enabled, bool windowEnabled>
 	void ProcessColorMath();
 
-	/// <summary>Blends two colors with specified coefficients (alpha blending).</summary>
-	void BlendColors(uint16_t* dst, int x, uint16_t a, uint8_t aCoeff, uint16_t b, uint8_t bCoeff);
-
 	/// <summary>Reads a color from palette or direct color.</summary>
 	template <bool isSubColor>
 	uint16_t ReadColor(int x, uint16_t addr);
@@ -343,6 +340,39 @@ public:
 		_emu->ProcessPpuCycle<CpuType::Gba>();
 	}
 
+	/// <summary>Number of cycles that can run before reaching hblank, the scanline render or the end of the scanline.</summary>
+	__forceinline uint32_t GetSkippableCycles() {
+		uint32_t nextEvent = _state.Cycle < 1006 ? 1006 : (_state.Cycle < 1056 ? 1056 : 308 * 4);
+		return nextEvent - _state.Cycle - 1;
+	}
+
+	/// <summary>True when the next count cycles don't reach hblank, the scanline render or the end of the scanline.</summary>
+	__forceinline bool CanSkipCycles(uint32_t count) {
+		return count <= GetSkippableCycles();
+	}
+
+	/// <summary>
+	/// True when the PPU doesn't read VRAM/palette/OAM until the end of the current scanline (vblank, before the last
+	/// scanline's sprite evaluation) and catching up the renderer has no side effect (no pending layer toggle).
+	/// Writes to video memory don't need to be synchronized with the rendering until then.
+	/// </summary>
+	bool IsVideoMemoryIdle() {
+		if (_state.Scanline < 160 || _state.Scanline >= _lastScanline) {
+			return false;
+		}
+		for (int i = 0; i < 4; i++) {
+			if (_state.BgLayers[i].EnableTimer || _state.BgLayers[i].DisableTimer) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/// <summary>Same as calling Exec count times, only valid when CanSkipCycles returned true (and no debugger).</summary>
+	__forceinline void SkipCycles(uint32_t count) {
+		_state.Cycle += count;
+	}
+
 	/// <summary>Checks if PPU is accessing the specified memory type this cycle.</summary>
 	bool IsAccessingMemory(uint8_t memType) {
 		return _memoryAccess[_state.Cycle] & memType;
@@ -66,6 +66,11 @@ public:
 		return _state;
 	}
 
+	/// <summary>True when the prefetcher is in its reset state (calling Reset() has no effect).</summary>
+	[[nodiscard]] bool IsReset() {
+		return _state.ReadAddr == 0 && _state.PrefetchAddr == 0 && _state.ClockCounter == 0 && !_state.Started && !_state.Sequential && !_state.WasFilled && !_state.HitBoundary;
+	}
+
 	bool Reset() {
 		bool delay = _state.ClockCounter == 1;
 		_state.Started = false;
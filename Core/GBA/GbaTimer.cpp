@@ -180,22 +180,24 @@ uint8_t GbaTimer::ReadRegister(uint32_t addr) {
 }
 
 void GbaTimer::Serialize(Serializer& s) {
-	for (int i = 0; i < 4; i++) {
-		SVI(_state.Timer[i].ReloadValue);
-		SVI(_state.Timer[i].Control);
-		SVI(_state.Timer[i].Timer);
-
-		if (s.GetFormat() != SerializeFormat::Map) {
-			SVI(_state.Timer[i].PrescaleMask);
-			SVI(_state.Timer[i].Mode);
-			SVI(_state.Timer[i].IrqEnabled);
-			SVI(_state.Timer[i].Enabled);
-			SVI(_state.Timer[i].ProcessTimer);
-			SVI(_state.Timer[i].NewReloadValue);
-			SVI(_state.Timer[i].WritePending);
-			SVI(_state.Timer[i].EnableDelay);
+	s.StreamPod(_state, "_state", [&]() {
+		for (int i = 0; i < 4; i++) {
+			SVI(_state.Timer[i].ReloadValue);
+			SVI(_state.Timer[i].Control);
+			SVI(_state.Timer[i].Timer);
+
+			if (s.GetFormat() != SerializeFormat::Map) {
+				SVI(_state.Timer[i].PrescaleMask);
+				SVI(_state.Timer[i].Mode);
+				SVI(_state.Timer[i].IrqEnabled);
+				SVI(_state.Timer[i].Enabled);
+				SVI(_state.Timer[i].ProcessTimer);
+				SVI(_state.Timer[i].NewReloadValue);
+				SVI(_state.Timer[i].WritePending);
+				SVI(_state.Timer[i].EnableDelay);
+			}
 		}
-	}
+	});
 
 	if (s.GetFormat() != SerializeFormat::Map) {
 		SV(_hasPendingTimers);
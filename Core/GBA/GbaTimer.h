@@ -50,6 +50,13 @@ private:
 		}
 	}
 
+	/// <summary>Number of prescaler ticks in the cycles masterClock+1 to masterClock+count (inclusive).</summary>
+	__forceinline static uint32_t GetTickCount(GbaTimerState& timer, uint64_t masterClock, uint32_t count) {
+		// The prescale masks are all 2^n - 1
+		int shift = std::popcount(timer.PrescaleMask);
+		return (uint32_t)(((masterClock + count) >> shift) - (masterClock >> shift));
+	}
+
 	/// <summary>
 	/// Triggers a delayed update for timer enable/disable changes.
 	/// </summary>
@@ -80,6 +87,31 @@ public:
 		ProcessTimer<3>(masterClock);
 	}
 
+	/// <summary>
+	/// Checks whether the next count cycles can be applied in a single step (no timer overflows during them).
+	/// </summary>
+	/// <param name="masterClock">Master clock value before the first of these cycles.</param>
+	/// <param name="count">Number of cycles.</param>
+	__forceinline bool CanSkipCycles(uint64_t masterClock, uint32_t count) {
+		for (int i = 0; i < 4; i++) {
+			if (_state.Timer[i].ProcessTimer && _state.Timer[i].Timer + GetTickCount(_state.Timer[i], masterClock, count) > 0xFFFF) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/// <summary>
+	/// Same as calling Exec for each of the next count cycles, only valid when CanSkipCycles returned true.
+	/// </summary>
+	__forceinline void SkipCycles(uint64_t masterClock, uint32_t count) {
+		for (int i = 0; i < 4; i++) {
+			if (_state.Timer[i].ProcessTimer) {
+				_state.Timer[i].Timer += GetTickCount(_state.Timer[i], masterClock, count);
+			}
+		}
+	}
+
 	/// <summary>
 	/// Writes to a timer control register.
 	/// </summary>
@@ -3,6 +3,7 @@
 #include "Gameboy/Gameboy.h"
 #include "Gameboy/GbTimer.h"
 #include "Shared/Emulator.h"
+#include "Shared/FrameProfiler.h"
 #include "Shared/EmuSettings.h"
 #include "Shared/Audio/SoundMixer.h"
 #include "Utilities/Serializer.h"
@@ -70,6 +71,7 @@ uint64_t GbApu::GetElapsedApuCycles() {
 }
 
 void GbApu::Run() {
+	PROFILE_SCOPE(_emu->GetFrameProfiler(), ProfilerStage::Apu);
 	uint64_t clockCount = _gameboy->GetApuCycleCount();
 	uint32_t clocksToRun = (uint32_t)(clockCount - _prevClockCount);
 	_prevClockCount = clockCount;
@@ -73,7 +73,10 @@ bool GbEventManager::ShowPreviousFrameEvents() {
 }
 
 void GbEventManager::SetConfiguration(BaseEventViewerConfig& config) {
+	// The render thread reads the configuration
+	auto lock = _lock.AcquireSafe();
 	_config = (GbEventViewerConfig&)config;
+	InvalidateFilteredEvents();
 }
 
 EventViewerCategoryCfg GbEventManager::GetEventConfig(DebugEventInfo& evt) {
@@ -120,7 +123,11 @@ void GbEventManager::ConvertScanlineCycleToRowColumn(int32_t& x, int32_t& y) {
 
 uint32_t GbEventManager::TakeEventSnapshot(bool forAutoRefresh) {
 	DebugBreakHelper breakHelper(_debugger);
-	auto lock = _lock.AcquireSafe();
+	EventSnapshotLock lock(_lock, forAutoRefresh);
+	if (!lock.IsAcquired()) {
+		// The render thread is drawing the previous snapshot
+		return _scanlineCount;
+	}
 
 	uint16_t cycle = _ppu->GetState().Cycle;
 	uint16_t scanline = _ppu->GetState().Scanline;
@@ -134,8 +141,7 @@ uint32_t GbEventManager::TakeEventSnapshot(bool forAutoRefresh) {
 		memcpy(_ppuBuffer.get() + offset, _ppu->GetPreviousEventViewerBuffer() + offset, (size - offset) * sizeof(uint16_t));
 	}
 
-	_snapshotCurrentFrame = _debugEvents;
-	_snapshotPrevFrame = _prevDebugEvents;
+	UpdateEventSnapshot();
 	_snapshotScanline = scanline;
 	_snapshotCycle = cycle;
 	_forAutoRefresh = forAutoRefresh;
@@ -6,6 +6,7 @@
 #include "Gameboy/GbMemoryManager.h"
 #include "Gameboy/GbControlManager.h"
 #include "Shared/Emulator.h"
+#include "Shared/CheatManager.h"
 #include "Utilities/Serializer.h"
 
 // Initialize Game Boy CPU state and references
@@ -1026,6 +1027,13 @@ uint8_t GbCpu::ReadMemory(uint16_t addr) {
 	LogMemoryOperation(addr, value, type);
 	return value;
 #else
+	uint8_t* page = _memoryManager->GetDirectReadPage(addr);
+	if (page && !_emu->GetCheatManager()->HasCheats<CpuType::Gameboy>()) [[likely]] {
+		// Plain rom/ram, no need for the register/DMA conflict handling in GbMemoryManager::Read
+		uint8_t value = page[(uint8_t)addr];
+		_emu->ProcessMemoryRead<CpuType::Gameboy>(addr, value, type);
+		return value;
+	}
 	return _memoryManager->Read<type, oamCorruptionType>(addr);
 #endif
 }
@@ -2476,21 +2484,23 @@ void GbCpu::PREFIX() {
 }
 
 void GbCpu::Serialize(Serializer& s) {
-	SV(_state.PC);
-	SV(_state.SP);
-	SV(_state.A);
-	SV(_state.Flags);
-	SV(_state.B);
-	SV(_state.C);
-	SV(_state.D);
-	SV(_state.E);
-	SV(_state.H);
-	SV(_state.L);
-	SV(_state.IME);
-	SV(_state.HaltCounter);
-	SV(_state.EiPending);
-	SV(_state.CycleCount);
-	SV(_state.HaltBug);
-	SV(_state.Stopped);
+	s.StreamPod(_state, "_state", [&]() {
+		SV(_state.PC);
+		SV(_state.SP);
+		SV(_state.A);
+		SV(_state.Flags);
+		SV(_state.B);
+		SV(_state.C);
+		SV(_state.D);
+		SV(_state.E);
+		SV(_state.H);
+		SV(_state.L);
+		SV(_state.IME);
+		SV(_state.HaltCounter);
+		SV(_state.EiPending);
+		SV(_state.CycleCount);
+		SV(_state.HaltBug);
+		SV(_state.Stopped);
+	});
 	SV(_prevIrqVector);
 }
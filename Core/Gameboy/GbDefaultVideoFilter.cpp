@@ -39,12 +39,10 @@ FrameInfo GbDefaultVideoFilter::GetFrameInfo() {
 void GbDefaultVideoFilter::InitLookupTable() {
 	VideoConfig config = _emu->GetSettings()->GetVideoConfig();
 
-	InitConversionMatrix(config.Hue, config.Saturation);
-
-	for (int rgb555 = 0; rgb555 < 0x8000; rgb555++) {
-		uint8_t r = rgb555 & 0x1F;
-		uint8_t g = (rgb555 >> 5) & 0x1F;
-		uint8_t b = (rgb555 >> 10) & 0x1F;
+	InitPaletteLut(_calculatedPalette, 0x8000, config, [this](uint32_t rgb555, uint8_t& r, uint8_t& g, uint8_t& b) {
+		r = rgb555 & 0x1F;
+		g = (rgb555 >> 5) & 0x1F;
+		b = (rgb555 >> 10) & 0x1F;
 		if (_gbcAdjustColors) {
 			uint8_t r2 = std::min(240, (r * 26 + g * 4 + b * 2) >> 2);
 			uint8_t g2 = std::min(240, (g * 24 + b * 8) >> 2);
@@ -57,14 +55,7 @@ void GbDefaultVideoFilter::InitLookupTable() {
 			g = ColorUtilities::Convert5BitTo8Bit(g);
 			b = ColorUtilities::Convert5BitTo8Bit(b);
 		}
-
-		if (config.Hue != 0 || config.Saturation != 0 || config.Brightness != 0 || config.Contrast != 0) {
-			ApplyColorOptions(r, g, b, config.Brightness, config.Contrast);
-			_calculatedPalette[rgb555] = 0xFF000000 | (r << 16) | (g << 8) | b;
-		} else {
-			_calculatedPalette[rgb555] = 0xFF000000 | (r << 16) | (g << 8) | b;
-		}
-	}
+	});
 
 	_videoConfig = config;
 }
@@ -74,7 +65,7 @@ void GbDefaultVideoFilter::OnBeforeApplyFilter() {
 	GameboyConfig gbConfig = _emu->GetSettings()->GetGameboyConfig();
 
 	bool adjustColors = gbConfig.GbcAdjustColors && ((Gameboy*)_emu->GetConsole().get())->IsCgb();
-	if (_videoConfig.Hue != config.Hue || _videoConfig.Saturation != config.Saturation || _videoConfig.Contrast != config.Contrast || _videoConfig.Brightness != config.Brightness || _gbcAdjustColors != adjustColors) {
+	if (PaletteOptionsChanged(_videoConfig, config) || _gbcAdjustColors != adjustColors) {
 		_gbcAdjustColors = adjustColors;
 		InitLookupTable();
 	}
@@ -93,9 +84,10 @@ void GbDefaultVideoFilter::ApplyFilter(uint16_t* ppuOutputBuffer) {
 
 	uint32_t* out = GetOutputBuffer();
 
-	// Flat loop eliminates per-pixel multiply (was i * ScreenWidth + j)
-	for (uint32_t idx = 0; idx < GbConstants::PixelCount; idx++) {
-		out[idx] = GetPixel(ppuOutputBuffer, idx);
+	if (_blendFrames) {
+		ConvertFrameBlended(_calculatedPalette, 0x7FFF, ppuOutputBuffer, _prevFrame.get(), GbConstants::ScreenWidth, 0, 0, out, GbConstants::ScreenWidth, GbConstants::ScreenHeight);
+	} else {
+		ConvertFrame(_calculatedPalette, 0x7FFF, ppuOutputBuffer, GbConstants::ScreenWidth, 0, 0, out, GbConstants::ScreenWidth, GbConstants::ScreenHeight);
 	}
 
 	if (_blendFrames) {
@@ -107,14 +99,3 @@ void GbDefaultVideoFilter::ApplyFilter(uint16_t* ppuOutputBuffer) {
 	}
 }
 
-uint32_t GbDefaultVideoFilter::GetPixel(uint16_t* ppuFrame, uint32_t offset) {
-	if (_blendFrames) {
-		return BlendPixels(_calculatedPalette[_prevFrame[offset]], _calculatedPalette[ppuFrame[offset]]);
-	} else {
-		return _calculatedPalette[ppuFrame[offset]];
-	}
-}
-
-uint32_t GbDefaultVideoFilter::BlendPixels(uint32_t a, uint32_t b) {
-	return ((((a) ^ (b)) & 0xfffefefeL) >> 1) + ((a) & (b));
-}
@@ -66,18 +66,6 @@ private:
 	/// <summary>Initialize 32K-entry RGB lookup table from settings.</summary>
 	void InitLookupTable();
 
-	/// <summary>Fast pixel blending using bit manipulation (50% blend).</summary>
-	/// <param name="a">First pixel ARGB</param>
-	/// <param name="b">Second pixel ARGB</param>
-	/// <returns>Blended pixel ARGB</returns>
-	__forceinline static uint32_t BlendPixels(uint32_t a, uint32_t b);
-
-	/// <summary>Get pixel with optional frame blending.</summary>
-	/// <param name="ppuFrame">PPU output buffer</param>
-	/// <param name="offset">Pixel offset</param>
-	/// <returns>32-bit ARGB pixel</returns>
-	__forceinline uint32_t GetPixel(uint16_t* ppuFrame, uint32_t offset);
-
 protected:
 	/// <summary>Update settings before applying filter.</summary>
 	void OnBeforeApplyFilter() override;
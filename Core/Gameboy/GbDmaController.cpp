@@ -4,11 +4,14 @@
 #include "Gameboy/GbPpu.h"
 #include "Gameboy/Gameboy.h"
 #include "Gameboy/GbCpu.h"
+#include "Shared/Emulator.h"
+#include "Shared/CheatManager.h"
 #include "Utilities/Serializer.h"
 
 // Initialize Game Boy OAM DMA controller
 void GbDmaController::Init(Gameboy* gameboy, GbMemoryManager* memoryManager, GbPpu* ppu, GbCpu* cpu) {
 	_gameboy = gameboy;
+	_emu = gameboy->GetEmulator();
 	_memoryManager = memoryManager;
 	_ppu = ppu;  // DMA writes to OAM
 	_cpu = cpu;  // DMA halts when CPU is halted
@@ -80,10 +83,6 @@ uint16_t GbDmaController::ProcessOamDmaReadConflict(uint16_t addr) {
 	return addr;
 }
 
-bool GbDmaController::IsOamDmaRunning() {
-	return _state.OamDmaRunning;
-}
-
 uint16_t GbDmaController::GetOamReadAddress() {
 	return (_state.InternalDest << 8) + (160 - _state.DmaCounter);
 }
@@ -172,19 +171,42 @@ void GbDmaController::ProcessHdma() {
 
 void GbDmaController::ProcessDmaBlock() {
 	bool isInvalidSource = _state.CgbDmaSource >= 0x8000 && _state.CgbDmaSource <= 0x9FFF || _state.CgbDmaSource >= 0xE000;
+
+	// Blocks are 16-byte aligned and never cross a page: when the source is plain rom/ram (the usual case),
+	// read it directly and write straight to VRAM, skipping Read/Write's register and OAM DMA conflict handling.
+	// An OAM DMA can start during the block (the PPU/timers run between bytes), those bytes use the regular path.
+	uint8_t* srcPage = nullptr;
+	if (!isInvalidSource && !_emu->GetCheatManager()->HasCheats<CpuType::Gameboy>()) {
+		srcPage = _memoryManager->GetDirectReadPage(_state.CgbDmaSource);
+	}
+
 	for (int i = 0; i < 16; i++) {
+		uint16_t src = _state.CgbDmaSource + i;
 		uint16_t dst = 0x8000 | ((_state.CgbDmaDest + i) & 0x1FFF);
+		bool directAccess = srcPage && !_state.OamDmaRunning;
 
 		// 2 or 4 cycles per byte transfered (2x more cycles in high speed mode - effective speed is the same in both modes
 		_memoryManager->Exec();
-		uint8_t value = _memoryManager->Read<MemoryOperationType::DmaRead>(_state.CgbDmaSource + i);
-		if (isInvalidSource) {
-			value = 0xFF;
+		uint8_t value;
+		if (directAccess) {
+			value = srcPage[(uint8_t)src];
+			_emu->ProcessMemoryRead<CpuType::Gameboy>(src, value, MemoryOperationType::DmaRead);
+		} else {
+			value = _memoryManager->Read<MemoryOperationType::DmaRead>(src);
+			if (isInvalidSource) {
+				value = 0xFF;
+			}
 		}
 		if (_memoryManager->IsHighSpeed()) {
 			_memoryManager->Exec();
 		}
-		_memoryManager->Write<MemoryOperationType::DmaWrite>(dst, value);
+		if (directAccess && !_state.OamDmaRunning) {
+			if (_emu->ProcessMemoryWrite<CpuType::Gameboy>(dst, value, MemoryOperationType::DmaWrite)) {
+				_ppu->WriteVram(dst, value);
+			}
+		} else {
+			_memoryManager->Write<MemoryOperationType::DmaWrite>(dst, value);
+		}
 	}
 
 	// Source/Dest/Length are all modified by the DMA process and keep their last value after DMA completes
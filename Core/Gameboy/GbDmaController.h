@@ -7,6 +7,7 @@ class GbMemoryManager;
 class GbPpu;
 class GbCpu;
 class Gameboy;
+class Emulator;
 
 /// <summary>
 /// Game Boy OAM DMA controller implementation.
@@ -30,6 +31,9 @@ private:
 	/// <summary>Gameboy instance for CGB mode detection.</summary>
 	Gameboy* _gameboy = nullptr;
 
+	/// <summary>Emulator instance for the debugger hooks of the GDMA/HDMA fast path.</summary>
+	Emulator* _emu = nullptr;
+
 	/// <summary>Processes a block of HDMA data (CGB only).</summary>
 	void ProcessDmaBlock();
 
@@ -78,7 +82,7 @@ public:
 
 	/// <summary>Checks if OAM DMA is currently running.</summary>
 	/// <returns>True if DMA is active.</returns>
-	bool IsOamDmaRunning();
+	bool IsOamDmaRunning() { return _state.OamDmaRunning; }
 
 	/// <summary>Reads from DMA register ($FF46).</summary>
 	/// <returns>Last written DMA source high byte.</returns>
@@ -13,6 +13,7 @@
 #include "Shared/EmuSettings.h"
 #include "Shared/CheatManager.h"
 #include "Shared/MessageManager.h"
+#include "Shared/LinkCable.h"
 #include "SNES/Coprocessors/SGB/SuperGameboy.h"
 #include "SNES/SnesControlManager.h"
 #include "SNES/Input/SnesController.h"
@@ -88,16 +89,66 @@ void GbMemoryManager::ExecTimerDmaSerial() {
 		_dmaController->Exec();
 	}
 
-	if (_state.SerialBitCount && (_cpu->GetState().CycleCount & 0x1FF) == 0) {
-		_state.SerialData = (_state.SerialData << 1) | 0x01;
-		if (--_state.SerialBitCount == 0) {
-			//"It will be notified that the transfer is complete in two ways:
-			// SC's Bit 7 will be cleared"
-			_state.SerialControl &= 0x7F;
+	if ((_cpu->GetState().CycleCount & 0x1FF) == 0) {
+		if (_state.SerialBitCount) {
+			ShiftSerialBit();
+		}
+		if (LinkCablePort* port = _emu->GetLinkCablePort()) [[unlikely]] {
+			ProcessLinkCable(port);
+		}
+	}
+}
 
-			//"and the Serial Interrupt handler will be called"
-			RequestIrq(GbIrqSource::Serial);
+void GbMemoryManager::ShiftSerialBit() {
+	uint8_t bit = 0x01;
+	if (_linkTransferActive) {
+		LinkCablePort* port = _emu->GetLinkCablePort();
+		if (_state.SerialBitCount == 8) {
+			// The other side answers the next time it checks its serial port, wait for it
+			_linkReceivedData = 0xFF;
+			if (port) {
+				port->WaitForReply(_linkTransferId, _linkReceivedData, [this, port](const LinkCableMessage& msg) {
+					ProcessLinkMessage(port, msg);
+				});
+			}
 		}
+		bit = (_linkReceivedData >> (_state.SerialBitCount - 1)) & 0x01;
+	}
+
+	_state.SerialData = (_state.SerialData << 1) | bit;
+	if (--_state.SerialBitCount == 0) {
+		_linkTransferActive = false;
+
+		//"It will be notified that the transfer is complete in two ways:
+		// SC's Bit 7 will be cleared"
+		_state.SerialControl &= 0x7F;
+
+		//"and the Serial Interrupt handler will be called"
+		RequestIrq(GbIrqSource::Serial);
+	}
+}
+
+void GbMemoryManager::ProcessLinkMessage(LinkCablePort* port, const LinkCableMessage& msg) {
+	if (msg.Type != LinkCableMessageType::TransferStart) {
+		return;
+	}
+
+	// The other side is the clock master: the bytes are exchanged at once if a transfer is
+	// pending with an external clock, otherwise nothing is shifted out (line stays high)
+	uint8_t reply = 0xFF;
+	if ((_state.SerialControl & 0x81) == 0x80) {
+		reply = _state.SerialData;
+		_state.SerialData = (uint8_t)msg.Data;
+		_state.SerialControl &= 0x7F;
+		RequestIrq(GbIrqSource::Serial);
+	}
+	port->Send({_cpu->GetState().CycleCount, msg.Id, LinkCableMessageType::TransferReply, reply});
+}
+
+void GbMemoryManager::ProcessLinkCable(LinkCablePort* port) {
+	LinkCableMessage msg;
+	while (port->TryReceive(msg)) {
+		ProcessLinkMessage(port, msg);
 	}
 }
 
@@ -121,6 +172,7 @@ void GbMemoryManager::MapRegisters(uint16_t start, uint16_t end, RegisterAccess
 	for (int i = start; i < end; i += 0x100) {
 		_state.IsReadRegister[i >> 8] = ((int)access & (int)RegisterAccess::Read) != 0;
 		_state.IsWriteRegister[i >> 8] = ((int)access & (int)RegisterAccess::Write) != 0;
+		UpdateDirectRead(i >> 8);
 	}
 }
 
@@ -137,6 +189,7 @@ void GbMemoryManager::Map(uint16_t start, uint16_t end, GbMemoryType type, uint3
 		for (int i = start; i < end; i += 0x100) {
 			_reads[i >> 8] = src;
 			_writes[i >> 8] = readonly ? nullptr : src;
+			UpdateDirectRead(i >> 8);
 
 			_state.MemoryType[i >> 8] = type;
 			_state.MemoryOffset[i >> 8] = offset;
@@ -160,6 +213,7 @@ void GbMemoryManager::Unmap(uint16_t start, uint16_t end) {
 	for (int i = start; i < end; i += 0x100) {
 		_reads[i >> 8] = nullptr;
 		_writes[i >> 8] = nullptr;
+		_directReads[i >> 8] = nullptr;
 
 		_state.MemoryType[i >> 8] = GbMemoryType::None;
 		_state.MemoryOffset[i >> 8] = 0;
@@ -472,8 +526,13 @@ void GbMemoryManager::WriteRegister(uint16_t addr, uint8_t value) {
 				case 0xFF02:
 					// FF02 - SC - Serial Transfer Control (R/W)
 					_state.SerialControl = value & (_gameboy->IsCgb() ? 0x83 : 0x81);
+					_linkTransferActive = false;
 					if ((_state.SerialControl & 0x80) && (_state.SerialControl & 0x01)) {
 						_state.SerialBitCount = 8;
+						LinkCablePort* port = _emu->GetLinkCablePort();
+						if (port && port->IsPeerAttached()) {
+							_linkTransferActive = port->Send({_cpu->GetState().CycleCount, ++_linkTransferId, LinkCableMessageType::TransferStart, _state.SerialData});
+						}
 					} else {
 						_state.SerialBitCount = 0;
 					}
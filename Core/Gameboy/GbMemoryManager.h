@@ -2,6 +2,7 @@
 #include "pch.h"
 #include "Debugger/DebugTypes.h"
 #include "Utilities/ISerializable.h"
+#include "Gameboy/GbDmaController.h"
 
 class Gameboy;
 class GbCart;
@@ -14,6 +15,8 @@ class GbDmaController;
 class EmuSettings;
 class Emulator;
 class GbControlManager;
+class LinkCablePort;
+struct LinkCableMessage;
 
 enum class MemoryOperationType;
 
@@ -35,10 +38,21 @@ private:
 
 	uint8_t* _reads[0x100] = {};
 	uint8_t* _writes[0x100] = {};
+	uint8_t* _directReads[0x100] = {};  ///< _reads for the pages without read registers, null for the others
+
+	__forceinline void UpdateDirectRead(uint8_t page) { _directReads[page] = _state.IsReadRegister[page] ? nullptr : _reads[page]; }
 
 	GbMemoryManagerState _state = {};
 
+	// Serial transfer over a link cable (not saved in save states: a transfer in progress gets 0xFF after loading a state)
+	uint32_t _linkTransferId = 0;
+	bool _linkTransferActive = false; ///< Internal clock transfer started, the other side's byte is received on the first bit
+	uint8_t _linkReceivedData = 0xFF;
+
 	__forceinline void ExecTimerDmaSerial();
+	void ShiftSerialBit();
+	void ProcessLinkMessage(LinkCablePort* port, const LinkCableMessage& msg);
+	void ProcessLinkCable(LinkCablePort* port);
 
 public:
 	virtual ~GbMemoryManager();
@@ -57,6 +71,14 @@ public:
 	template <MemoryOperationType type, GbOamCorruptionType oamCorruptionType = GbOamCorruptionType::Read>
 	uint8_t Read(uint16_t addr);
 
+	/// <summary>
+	/// Page of plain memory (rom/ram) that contains addr, or null when the read has to go through Read()
+	/// (registers, unmapped pages, OAM DMA bus conflicts). Cheats and debugger hooks are up to the caller.
+	/// </summary>
+	__forceinline uint8_t* GetDirectReadPage(uint16_t addr) {
+		return _dmaController->IsOamDmaRunning() ? nullptr : _directReads[addr >> 8];
+	}
+
 	[[nodiscard]] bool IsOamDmaRunning();
 	void WriteDma(uint16_t addr, uint8_t value);
 	uint8_t ReadDma(uint16_t addr);
@@ -74,6 +74,7 @@ void GbPpu::Init(Emulator* emu, Gameboy* gameboy, GbMemoryManager* memoryManager
 	_isFirstFrame = true;      // First frame after power-on
 	_forceBlankFrame = true;   // Force blank on first frame
 	_rendererIdle = false;
+	_fastDrawEndCycle = 0;
 }
 
 GbPpu::~GbPpu() = default;
@@ -99,6 +100,7 @@ uint16_t* GbPpu::GetPreviousEventViewerBuffer() {
 }
 
 void GbPpu::SetCpuStopState(bool stopped) {
+	SyncFastDrawing();
 	if (!_gameboy->IsCgb()) {
 		if (stopped) {
 			_lcdDisabled = true;
@@ -166,7 +168,7 @@ void GbPpu::ExecCycle() {
 
 	if (_state.Mode == PpuMode::Drawing) {
 		RunDrawCycle();
-		if (_drawnPixels == 160) {
+		if (_drawnPixels == 160 && !_fastDrawEndCycle) {
 			// Mode turns to hblank on the same cycle as the last pixel is output
 			_state.IrqMode = PpuMode::HBlank;
 			if (_gameboy->IsSgb()) {
@@ -246,6 +248,7 @@ void GbPpu::ProcessVblankScanline() {
 			if (_state.Scanline == 154) {
 				_state.Scanline = 0;
 				_state.Ly = 0;
+				_skipRender = _emu->IsRenderSkipped();
 				_state.LyForCompare = 0;
 				_wyEnableFlag = _state.Scanline == _state.WindowY && _state.WindowEnabled;
 
@@ -345,6 +348,9 @@ void GbPpu::ProcessVisibleScanline() {
 		case 89:
 			ResetRenderer();
 			_rendererIdle = false;
+			if (CanDrawLineAtOnce()) {
+				DrawLineAtOnce();
+			}
 			break;
 
 		case 456:
@@ -384,6 +390,14 @@ void GbPpu::RunDrawCycle() {
 		return;
 	}
 
+	if (_fastDrawEndCycle) {
+		// The line was already drawn by DrawLineAtOnce, mode 3 ends on its last cycle
+		if (_state.Cycle == _fastDrawEndCycle) {
+			_fastDrawEndCycle = 0;
+		}
+		return;
+	}
+
 	// TODO fix/check behavior for WX=0 and WX=166
 	if (!_wxEnableFlag) {
 		_wxEnableFlag |= _drawnPixels == _state.WindowX - 7;
@@ -443,17 +457,7 @@ void GbPpu::RunDrawCycle() {
 				}
 				_lastPixelType = GbPixelType::Object;
 			} else {
-				if (!_cfgDisableBackground) {
-					if (_state.CgbEnabled) {
-						WriteBgPixel(entry.Color | ((entry.Attributes & 0x07) << 2));
-					} else {
-						WriteBgPixel(_state.BgEnabled ? ((_state.BgPalette >> (entry.Color * 2)) & 0x03) : (_state.BgPalette & 0x03));
-					}
-				} else {
-					WriteBgPixel(_state.BgPalette & 0x03);
-				}
-				_lastPixelType = GbPixelType::Background;
-				_lastBgColor = entry.Color;
+				WriteBgFifoPixel(entry);
 			}
 		}
 
@@ -471,9 +475,95 @@ void GbPpu::RunDrawCycle() {
 	ClockTileFetcher();
 }
 
+void GbPpu::WriteBgFifoPixel(GbFifoEntry entry) {
+	if (!_cfgDisableBackground) {
+		if (_state.CgbEnabled) {
+			WriteBgPixel(entry.Color | ((entry.Attributes & 0x07) << 2));
+		} else {
+			WriteBgPixel(_state.BgEnabled ? ((_state.BgPalette >> (entry.Color * 2)) & 0x03) : (_state.BgPalette & 0x03));
+		}
+	} else {
+		WriteBgPixel(_state.BgPalette & 0x03);
+	}
+	_lastPixelType = GbPixelType::Background;
+	_lastBgColor = entry.Color;
+}
+
+void GbPpu::RunBgOnlyDrawCycle() {
+	// Same as RunDrawCycle, for a line that can't fetch sprites, the window or insert the DMG glitch pixel
+	_wxEnableFlag |= _drawnPixels == _state.WindowX - 7;
+
+	if (_bgFifo.Size > 0) {
+		if (_drawnPixels >= 0) {
+			WriteBgFifoPixel(_bgFifo.Content[_bgFifo.Position]);
+		}
+		_bgFifo.Pop();
+		_drawnPixels++;
+	}
+
+	ClockTileFetcher();
+}
+
+bool GbPpu::CanDrawLineAtOnce() {
+	// Mode 3 timing only depends on SCX when there are no sprites and no window on the line
+	return (
+		!_emu->IsDebugging() &&
+		!_gbcTileGlitch &&
+		(_spriteCount == 0 || !(_state.SpritesEnabled || _state.CgbEnabled)) &&
+		!(_state.WindowEnabled && _wyEnableFlag) &&
+		(_gameboy->IsCgb() || _state.WindowEnabled || _windowCounter <= 0)
+	);
+}
+
+void GbPpu::DrawLineAtOnce() {
+	// Called on the first cycle of mode 3: run the whole pixel FIFO for the line now, and let the
+	// remaining mode 3 cycles run as idle cycles. Nothing the renderer reads can change during mode 3
+	// without going through Write/WriteCgbRegister/SetTileFetchGlitchState/SetCpuStopState (VRAM, OAM
+	// and palette writes are blocked), and those call SyncFastDrawing to rewind the line and run the
+	// cycles that have actually elapsed, before continuing cycle by cycle.
+	_fastDrawTileIndex = _tileIndex;
+	_fastDrawLastPixelType = _lastPixelType;
+	_fastDrawLastBgColor = _lastBgColor;
+
+	uint16_t cycleCount = 0;
+	while (_drawnPixels < 160) {
+		RunBgOnlyDrawCycle();
+		cycleCount++;
+	}
+
+	_fastDrawEndCycle = _state.Cycle + cycleCount - 1;
+	_state.IdleCycles = cycleCount - 2;
+}
+
+void GbPpu::SyncFastDrawing() {
+	if (_fastDrawEndCycle) [[unlikely]] {
+		CancelFastDrawing();
+	}
+}
+
+void GbPpu::CancelFastDrawing() {
+	// Rewind the renderer to the first cycle of mode 3 (cycle 89), and run the cycles the CPU has already seen
+	uint16_t cycleCount = _state.Cycle - 89 + 1;
+
+	ResetRenderer();
+	_wxEnableFlag = false;
+	_tileIndex = _fastDrawTileIndex;
+	_lastPixelType = _fastDrawLastPixelType;
+	_lastBgColor = _fastDrawLastBgColor;
+
+	for (uint16_t i = 0; i < cycleCount; i++) {
+		RunBgOnlyDrawCycle();
+	}
+
+	_state.IdleCycles = 0;
+	_fastDrawEndCycle = 0;
+}
+
 void GbPpu::WriteBgPixel(uint8_t colorIndex) {
 	uint16_t outOffset = _scanlineBufferOffset + _drawnPixels;
-	_currentBuffer[outOffset] = LcdReadBgPalette(colorIndex) & 0x7FFF;
+	if (!_skipRender) {
+		_currentBuffer[outOffset] = LcdReadBgPalette(colorIndex) & 0x7FFF;
+	}
 	if (_gameboy->IsSgb()) {
 		_gameboy->GetSgb()->WriteLcdColor(_state.Scanline, (uint8_t)_drawnPixels, colorIndex & 0x03);
 	}
@@ -481,7 +571,9 @@ void GbPpu::WriteBgPixel(uint8_t colorIndex) {
 
 void GbPpu::WriteObjPixel(uint8_t colorIndex) {
 	uint16_t outOffset = _scanlineBufferOffset + _drawnPixels;
-	_currentBuffer[outOffset] = LcdReadObjPalette(colorIndex) & 0x7FFF;
+	if (!_skipRender) {
+		_currentBuffer[outOffset] = LcdReadObjPalette(colorIndex) & 0x7FFF;
+	}
 	if (_gameboy->IsSgb()) {
 		_gameboy->GetSgb()->WriteLcdColor(_state.Scanline, (uint8_t)_drawnPixels, colorIndex & 0x03);
 	}
@@ -798,10 +890,13 @@ void GbPpu::SendFrame() {
 	_emu->ProcessEndOfFrame();
 	_gameboy->ProcessEndOfFrame();
 
-	_currentBuffer = _currentBuffer == _outputBuffers[0].get() ? _outputBuffers[1].get() : _outputBuffers[0].get();
+	if (!_skipRender) {
+		_currentBuffer = _currentBuffer == _outputBuffers[0].get() ? _outputBuffers[1].get() : _outputBuffers[0].get();
+	}
 }
 
 void GbPpu::DebugSendFrame() {
+	SyncFastDrawing();
 	if (_gameboy->IsSgb()) {
 		return;
 	}
@@ -879,6 +974,7 @@ uint8_t GbPpu::Read(uint16_t addr) {
 }
 
 void GbPpu::Write(uint16_t addr, uint8_t value) {
+	SyncFastDrawing();
 	switch (addr) {
 		case 0xFF40:
 			_state.Control = value;
@@ -912,6 +1008,7 @@ void GbPpu::Write(uint16_t addr, uint8_t value) {
 				} else {
 					_lcdDisabled = false;
 					_isFirstFrame = true;
+					_skipRender = _emu->IsRenderSkipped();
 					_forceBlankFrame = !_gameboy->IsCgb() || (_gameboy->GetApuCycleCount() - _lastFrameTime) > 5000;
 					_state.Cycle = 7;
 					_state.IdleCycles = 0;
@@ -1011,6 +1108,7 @@ void GbPpu::Write(uint16_t addr, uint8_t value) {
 }
 
 void GbPpu::SetTileFetchGlitchState() {
+	SyncFastDrawing();
 	_gbcTileGlitch = true;
 }
 
@@ -1186,6 +1284,7 @@ uint8_t GbPpu::ReadCgbRegister(uint16_t addr) {
 }
 
 void GbPpu::WriteCgbRegister(uint16_t addr, uint8_t value) {
+	SyncFastDrawing();
 	if (!_state.CgbEnabled && _memoryManager->IsBootRomDisabled()) {
 		return;
 	}
@@ -1249,6 +1348,7 @@ void GbPpu::WriteCgbPalette(uint8_t& pos, uint16_t* pal, bool autoInc, uint8_t v
 }
 
 void GbPpu::Serialize(Serializer& s) {
+	SyncFastDrawing();
 	SV(_state.Scanline);
 	SV(_state.Cycle);
 	SV(_state.Mode);
@@ -162,6 +162,9 @@ private:
 	bool _forceBlankFrame = true;
 	bool _rendererIdle = false;
 
+	/// <summary>Skip frame buffer writes for the current frame (run-ahead frames, see Emulator::IsRenderSkipped).</summary>
+	bool _skipRender = false;
+
 	uint8_t _tileIndex = 0;
 	uint8_t _gbcTileGlitch = 0;
 
@@ -174,6 +177,14 @@ private:
 	/// <summary>Cached config: disable background rendering (refreshed per scanline).</summary>
 	bool _cfgDisableBackground = false;
 
+	/// <summary>Last cycle of the current line's mode 3 when it was drawn at once by DrawLineAtOnce (0 = not active).</summary>
+	uint16_t _fastDrawEndCycle = 0;
+
+	/// <summary>Renderer state saved by DrawLineAtOnce, to rewind the line if something changes during mode 3.</summary>
+	uint8_t _fastDrawTileIndex = 0;
+	GbPixelType _fastDrawLastPixelType = {};
+	uint8_t _fastDrawLastBgColor = 0;
+
 	/// <summary>Refreshes cached GameboyConfig fields from settings. Called once per scanline at Drawing mode entry.</summary>
 	__forceinline void RefreshCachedConfig();
 
@@ -187,6 +198,12 @@ private:
 	void ProcessFirstScanlineAfterPowerOn();
 	__forceinline void ProcessVisibleScanline();
 	__forceinline void RunDrawCycle();
+	__forceinline void RunBgOnlyDrawCycle();
+	__forceinline void WriteBgFifoPixel(GbFifoEntry entry);
+	__forceinline bool CanDrawLineAtOnce();
+	void DrawLineAtOnce();
+	void CancelFastDrawing();
+	__forceinline void SyncFastDrawing();
 	__forceinline void RunSpriteEvaluation();
 	void ResetRenderer();
 	void ClockSpriteFetcher();
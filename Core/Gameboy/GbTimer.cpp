@@ -152,12 +152,14 @@ void GbTimer::Write(uint16_t addr, uint8_t value) {
 }
 
 void GbTimer::Serialize(Serializer& s) {
-	SV(_state.Divider);
-	SV(_state.Counter);
-	SV(_state.Modulo);
-	SV(_state.Control);
-	SV(_state.TimerEnabled);
-	SV(_state.TimerDivider);
-	SV(_state.NeedReload);
-	SV(_state.Reloaded);
+	s.StreamPod(_state, "_state", [&]() {
+		SV(_state.Divider);
+		SV(_state.Counter);
+		SV(_state.Modulo);
+		SV(_state.Control);
+		SV(_state.TimerEnabled);
+		SV(_state.TimerDivider);
+		SV(_state.NeedReload);
+		SV(_state.Reloaded);
+	});
 }
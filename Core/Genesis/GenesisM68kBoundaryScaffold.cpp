@@ -3,6 +3,7 @@
 
 GenesisPlatformBusStub::GenesisPlatformBusStub()
 	: _workRam(64 * 1024, 0) {
+	MapPages(0xFF0000, 0x10000, _workRam.data(), true);
 }
 
 void GenesisPlatformBusStub::LoadRom(const vector<uint8_t>& romData) {
@@ -10,6 +11,12 @@ void GenesisPlatformBusStub::LoadRom(const vector<uint8_t>& romData) {
 	if (_rom.empty()) {
 		_rom.resize(0x10000, 0);
 	}
+
+	// ROM mirrors are only mapped directly when they're made of whole pages (ReadByte handles the others)
+	bool pageAligned = _rom.size() % 0x10000 == 0;
+	for (uint32_t address = 0; address < 0x400000; address += 0x10000) {
+		MapPages(address, 0x10000, pageAligned ? _rom.data() + (address % _rom.size()) : nullptr, false);
+	}
 }
 
 void GenesisPlatformBusStub::Reset() {
@@ -1,11 +1,82 @@
 #pragma once
 #include "pch.h"
 
+/// <summary>
+/// 68000 bus (24-bit address space, big-endian).
+/// </summary>
+/// <remarks>
+/// The CPU uses the non-virtual Read8/16/32 and Write8/16/32 accessors. Implementations map
+/// plain memory (ROM, work RAM) as 64 KB pages, which are accessed directly, and only the
+/// remaining addresses (I/O, Z80 window, etc.) go through the virtual ReadByte/WriteByte.
+/// Word and long accesses are always even (odd accesses are address errors, handled by the CPU),
+/// so they never cross a page.
+/// </remarks>
 class IGenesisM68kBus {
+public:
+	static constexpr uint32_t PageCount = 0x100;
+
+protected:
+	uint8_t* _readPages[PageCount] = {};
+	uint8_t* _writePages[PageCount] = {};
+
+	/// <summary>Maps size bytes (multiple of 64 KB) of memory at address, or unmaps them (memory = nullptr)</summary>
+	void MapPages(uint32_t address, uint32_t size, uint8_t* memory, bool writable) {
+		for (uint32_t offset = 0; offset < size; offset += 0x10000) {
+			uint32_t page = ((address + offset) >> 16) & (PageCount - 1);
+			_readPages[page] = memory ? memory + offset : nullptr;
+			_writePages[page] = memory && writable ? memory + offset : nullptr;
+		}
+	}
+
 public:
 	virtual ~IGenesisM68kBus() = default;
 	virtual uint8_t ReadByte(uint32_t address) = 0;
 	virtual void WriteByte(uint32_t address, uint8_t value) = 0;
+
+	__forceinline uint8_t Read8(uint32_t address) {
+		if (uint8_t* page = _readPages[(address >> 16) & 0xFF]) {
+			return page[address & 0xFFFF];
+		}
+		return ReadByte(address & 0xFFFFFF);
+	}
+
+	__forceinline uint16_t Read16(uint32_t address) {
+		if (uint8_t* page = _readPages[(address >> 16) & 0xFF]) {
+			uint8_t* ptr = page + (address & 0xFFFE);
+			return (ptr[0] << 8) | ptr[1];
+		}
+		address &= 0xFFFFFE;
+		return (ReadByte(address) << 8) | ReadByte(address + 1);
+	}
+
+	__forceinline uint32_t Read32(uint32_t address) {
+		return ((uint32_t)Read16(address) << 16) | Read16(address + 2);
+	}
+
+	__forceinline void Write8(uint32_t address, uint8_t value) {
+		if (uint8_t* page = _writePages[(address >> 16) & 0xFF]) {
+			page[address & 0xFFFF] = value;
+			return;
+		}
+		WriteByte(address & 0xFFFFFF, value);
+	}
+
+	__forceinline void Write16(uint32_t address, uint16_t value) {
+		if (uint8_t* page = _writePages[(address >> 16) & 0xFF]) {
+			uint8_t* ptr = page + (address & 0xFFFE);
+			ptr[0] = (uint8_t)(value >> 8);
+			ptr[1] = (uint8_t)value;
+			return;
+		}
+		address &= 0xFFFFFE;
+		WriteByte(address, (uint8_t)(value >> 8));
+		WriteByte(address + 1, (uint8_t)value);
+	}
+
+	__forceinline void Write32(uint32_t address, uint32_t value) {
+		Write16(address, (uint16_t)(value >> 16));
+		Write16(address + 2, (uint16_t)value);
+	}
 };
 
 class GenesisPlatformBusStub final : public IGenesisM68kBus {
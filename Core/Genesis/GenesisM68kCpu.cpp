@@ -0,0 +1,288 @@
+#include "pch.h"
+#include <utility>
+#include "Genesis/GenesisM68kCpu.h"
+
+namespace {
+	using OpSize = GenesisM68kCpu::OpSize;
+	using EaMode = GenesisM68kCpu::EaMode;
+
+	constexpr uint32_t GetSizeMask(OpSize size) {
+		return size == OpSize::Byte ? 0xFF : (size == OpSize::Word ? 0xFFFF : 0xFFFFFFFF);
+	}
+
+	constexpr uint32_t GetSignBit(OpSize size) {
+		return size == OpSize::Byte ? 0x80 : (size == OpSize::Word ? 0x8000 : 0x80000000);
+	}
+
+	/// Effective-address calculation time (cycles), byte/word accesses - long accesses take 4 more cycles for memory operands
+	constexpr uint8_t GetEaCycles(OpSize size, EaMode mode) {
+		constexpr uint8_t cycles[GenesisM68kCpu::EaModeCount] = {0, 0, 4, 4, 6, 8, 10, 8, 12, 8, 10, 4};
+		uint8_t value = cycles[(int)mode];
+		return size == OpSize::Long && value > 0 ? value + 4 : value;
+	}
+
+	/// Writes to -(An) take the same time as (An) (no extra cycles for the decrement)
+	constexpr uint8_t GetDestEaCycles(OpSize size, EaMode mode) {
+		return GetEaCycles(size, mode == EaMode::AddrIndPreDec ? EaMode::AddrInd : mode);
+	}
+
+	constexpr bool IsValidMove(OpSize size, EaMode src, EaMode dst) {
+		if (src == EaMode::Invalid || dst == EaMode::Invalid || dst >= EaMode::PcDisp) {
+			return false;
+		}
+		// Byte accesses to address registers don't exist (MOVEA is word/long only)
+		return size != OpSize::Byte || (src != EaMode::AddrReg && dst != EaMode::AddrReg);
+	}
+}
+
+GenesisM68kCpu::GenesisM68kCpu() {
+	_opTable = GetOpTable().data();
+}
+
+void GenesisM68kCpu::Reset() {
+	_state = {};
+	_state.A[7] = _bus->Read32(0);
+	_state.PC = _bus->Read32(4) & 0xFFFFFF;
+}
+
+void GenesisM68kCpu::Run(uint64_t targetCycle) {
+	while (_state.CycleCount < targetCycle) {
+		Exec();
+	}
+}
+
+uint32_t GenesisM68kCpu::FetchLong() {
+	uint32_t high = FetchWord();
+	return (high << 16) | FetchWord();
+}
+
+void GenesisM68kCpu::SetNzFlags(uint32_t value, OpSize size) {
+	_state.SR &= ~(FlagN | FlagZ | FlagV | FlagC);
+	if ((value & GetSizeMask(size)) == 0) {
+		_state.SR |= FlagZ;
+	}
+	if (value & GetSignBit(size)) {
+		_state.SR |= FlagN;
+	}
+}
+
+bool GenesisM68kCpu::CheckCondition(uint8_t condition) {
+	bool c = _state.SR & FlagC;
+	bool v = _state.SR & FlagV;
+	bool z = _state.SR & FlagZ;
+	bool n = _state.SR & FlagN;
+	switch (condition & 0x0F) {
+		default:
+		case 0x00: return true;
+		case 0x01: return false;
+		case 0x02: return !c && !z;
+		case 0x03: return c || z;
+		case 0x04: return !c;
+		case 0x05: return c;
+		case 0x06: return !z;
+		case 0x07: return z;
+		case 0x08: return !v;
+		case 0x09: return v;
+		case 0x0A: return !n;
+		case 0x0B: return n;
+		case 0x0C: return n == v;
+		case 0x0D: return n != v;
+		case 0x0E: return !z && n == v;
+		case 0x0F: return z || n != v;
+	}
+}
+
+template <GenesisM68kCpu::OpSize size>
+__forceinline uint32_t GenesisM68kCpu::ReadMemory(uint32_t address) {
+	if constexpr (size == OpSize::Byte) {
+		return _bus->Read8(address);
+	} else if constexpr (size == OpSize::Word) {
+		return _bus->Read16(address);
+	} else {
+		return _bus->Read32(address);
+	}
+}
+
+template <GenesisM68kCpu::OpSize size>
+__forceinline void GenesisM68kCpu::WriteMemory(uint32_t address, uint32_t value) {
+	if constexpr (size == OpSize::Byte) {
+		_bus->Write8(address, (uint8_t)value);
+	} else if constexpr (size == OpSize::Word) {
+		_bus->Write16(address, (uint16_t)value);
+	} else {
+		_bus->Write32(address, value);
+	}
+}
+
+template <GenesisM68kCpu::OpSize size, GenesisM68kCpu::EaMode mode>
+__forceinline uint32_t GenesisM68kCpu::GetEaAddress(uint8_t reg) {
+	// A7 is always kept word-aligned, byte accesses move it by 2
+	constexpr uint32_t step = size == OpSize::Byte ? 1 : (size == OpSize::Word ? 2 : 4);
+
+	if constexpr (mode == EaMode::AddrInd) {
+		return _state.A[reg];
+	} else if constexpr (mode == EaMode::AddrIndPostInc) {
+		uint32_t address = _state.A[reg];
+		_state.A[reg] += (step == 1 && reg == 7) ? 2 : step;
+		return address;
+	} else if constexpr (mode == EaMode::AddrIndPreDec) {
+		_state.A[reg] -= (step == 1 && reg == 7) ? 2 : step;
+		return _state.A[reg];
+	} else if constexpr (mode == EaMode::AddrIndDisp) {
+		return _state.A[reg] + (int16_t)FetchWord();
+	} else if constexpr (mode == EaMode::AbsShort) {
+		return (uint32_t)(int32_t)(int16_t)FetchWord();
+	} else if constexpr (mode == EaMode::AbsLong) {
+		return FetchLong();
+	} else if constexpr (mode == EaMode::PcDisp) {
+		uint32_t base = _state.PC;
+		return base + (int16_t)FetchWord();
+	} else if constexpr (mode == EaMode::AddrIndIndex || mode == EaMode::PcIndex) {
+		uint32_t base = mode == EaMode::PcIndex ? _state.PC : _state.A[reg];
+		uint16_t ext = FetchWord();
+		uint32_t index = (ext & 0x8000) ? _state.A[(ext >> 12) & 0x07] : _state.D[(ext >> 12) & 0x07];
+		if (!(ext & 0x0800)) {
+			index = (uint32_t)(int32_t)(int16_t)index;
+		}
+		return base + index + (int8_t)ext;
+	} else {
+		return 0;
+	}
+}
+
+template <GenesisM68kCpu::OpSize size, GenesisM68kCpu::EaMode mode>
+__forceinline uint32_t GenesisM68kCpu::ReadEa(uint8_t reg) {
+	if constexpr (mode == EaMode::DataReg) {
+		return _state.D[reg] & GetSizeMask(size);
+	} else if constexpr (mode == EaMode::AddrReg) {
+		return _state.A[reg] & GetSizeMask(size);
+	} else if constexpr (mode == EaMode::Immediate) {
+		if constexpr (size == OpSize::Long) {
+			return FetchLong();
+		} else {
+			return FetchWord() & GetSizeMask(size);
+		}
+	} else {
+		return ReadMemory<size>(GetEaAddress<size, mode>(reg));
+	}
+}
+
+template <GenesisM68kCpu::OpSize size, GenesisM68kCpu::EaMode mode>
+__forceinline void GenesisM68kCpu::WriteEa(uint8_t reg, uint32_t value) {
+	if constexpr (mode == EaMode::DataReg) {
+		constexpr uint32_t mask = GetSizeMask(size);
+		_state.D[reg] = (_state.D[reg] & ~mask) | (value & mask);
+	} else if constexpr (mode == EaMode::AddrReg) {
+		// Word writes to address registers are sign-extended to 32 bits
+		_state.A[reg] = size == OpSize::Word ? (uint32_t)(int32_t)(int16_t)value : value;
+	} else if constexpr (mode >= EaMode::AddrInd && mode <= EaMode::AbsLong) {
+		WriteMemory<size>(GetEaAddress<size, mode>(reg), value);
+	}
+}
+
+template <GenesisM68kCpu::OpSize size, GenesisM68kCpu::EaMode src, GenesisM68kCpu::EaMode dst>
+void GenesisM68kCpu::OpMove(GenesisM68kCpu& cpu, uint16_t opcode) {
+	uint32_t value = cpu.ReadEa<size, src>(opcode & 0x07);
+	cpu.WriteEa<size, dst>((opcode >> 9) & 0x07, value);
+	if constexpr (dst != EaMode::AddrReg) {
+		// MOVEA doesn't affect the flags
+		cpu.SetNzFlags(value, size);
+	}
+	cpu._state.CycleCount += 4 + GetEaCycles(size, src) + GetDestEaCycles(size, dst);
+}
+
+void GenesisM68kCpu::OpMoveQ(GenesisM68kCpu& cpu, uint16_t opcode) {
+	uint32_t value = (uint32_t)(int32_t)(int8_t)opcode;
+	cpu._state.D[(opcode >> 9) & 0x07] = value;
+	cpu.SetNzFlags(value, OpSize::Long);
+	cpu._state.CycleCount += 4;
+}
+
+void GenesisM68kCpu::OpBcc(GenesisM68kCpu& cpu, uint16_t opcode) {
+	// The displacement is relative to the word after the opcode
+	uint32_t base = cpu._state.PC;
+	int32_t disp = (int8_t)opcode;
+	bool wordDisp = disp == 0;
+	if (wordDisp) {
+		disp = (int16_t)cpu.FetchWord();
+	}
+
+	if (cpu.CheckCondition(opcode >> 8)) {
+		cpu._state.PC = (base + disp) & 0xFFFFFF;
+		cpu._state.CycleCount += 10;
+	} else {
+		cpu._state.CycleCount += wordDisp ? 12 : 8;
+	}
+}
+
+void GenesisM68kCpu::OpNop(GenesisM68kCpu& cpu, uint16_t opcode) {
+	cpu._state.CycleCount += 4;
+}
+
+void GenesisM68kCpu::OpUnimplemented(GenesisM68kCpu& cpu, uint16_t opcode) {
+	cpu._state.UnimplementedCount++;
+	cpu._state.CycleCount += 4;
+}
+
+template <GenesisM68kCpu::OpSize size, size_t... i>
+constexpr std::array<GenesisM68kCpu::OpHandler, GenesisM68kCpu::EaModeCount * GenesisM68kCpu::EaModeCount> GenesisM68kCpu::GetMoveHandlers(std::index_sequence<i...>) {
+	// Index = src * EaModeCount + dst
+	return {&OpMove<size, (EaMode)(i / EaModeCount), (EaMode)(i % EaModeCount)>...};
+}
+
+std::array<GenesisM68kCpu::OpHandler, 0x10000> GenesisM68kCpu::BuildOpTable() {
+	constexpr auto indexes = std::make_index_sequence<EaModeCount * EaModeCount>();
+	static constexpr std::array<OpHandler, EaModeCount * EaModeCount> moveHandlers[3] = {
+		GetMoveHandlers<OpSize::Byte>(indexes),
+		GetMoveHandlers<OpSize::Word>(indexes),
+		GetMoveHandlers<OpSize::Long>(indexes)
+	};
+
+	std::array<OpHandler, 0x10000> table;
+	for (uint32_t i = 0; i < 0x10000; i++) {
+		uint16_t opcode = (uint16_t)i;
+		OpHandler handler = &OpUnimplemented;
+
+		switch (opcode >> 12) {
+			case 0x01:
+			case 0x02:
+			case 0x03: {
+				// Size encoding: 1 = byte, 3 = word, 2 = long
+				OpSize size = (opcode >> 12) == 1 ? OpSize::Byte : ((opcode >> 12) == 3 ? OpSize::Word : OpSize::Long);
+				EaMode src = GetEaMode((opcode >> 3) & 0x07, opcode & 0x07);
+				EaMode dst = GetEaMode((opcode >> 6) & 0x07, (opcode >> 9) & 0x07);
+				if (IsValidMove(size, src, dst)) {
+					handler = moveHandlers[(int)size][(int)src * EaModeCount + (int)dst];
+				}
+				break;
+			}
+
+			case 0x04:
+				if (opcode == 0x4E71) {
+					handler = &OpNop;
+				}
+				break;
+
+			case 0x06:
+				// Condition 1 is BSR
+				if ((opcode & 0x0F00) != 0x0100) {
+					handler = &OpBcc;
+				}
+				break;
+
+			case 0x07:
+				if (!(opcode & 0x0100)) {
+					handler = &OpMoveQ;
+				}
+				break;
+		}
+
+		table[i] = handler;
+	}
+	return table;
+}
+
+const std::array<GenesisM68kCpu::OpHandler, 0x10000>& GenesisM68kCpu::GetOpTable() {
+	static const std::array<OpHandler, 0x10000> table = BuildOpTable();
+	return table;
+}
@@ -0,0 +1,129 @@
+#pragma once
+#include "pch.h"
+#include "Genesis/GenesisM68kBoundaryScaffold.h"
+
+struct GenesisM68kState {
+	uint32_t D[8] = {};
+	uint32_t A[8] = {};
+	uint32_t PC = 0;
+	uint16_t SR = 0x2700;
+	uint64_t CycleCount = 0;
+	uint64_t UnimplementedCount = 0;
+};
+
+/// <summary>
+/// 68000 core for the Genesis, built around a predecoded dispatch table.
+/// </summary>
+/// <remarks>
+/// Every one of the 65536 opcodes maps to a handler specialized (by template) for its operation size and
+/// effective-address modes, so executing an instruction is a fetch and an indirect call: only the register
+/// numbers are decoded at runtime. The table is built once, when the first CPU is created.
+///
+/// Memory accesses go through the bus' word/long accessors (direct page pointers for ROM/RAM).
+///
+/// Only part of the instruction set is implemented so far (MOVE/MOVEA, MOVEQ, Bcc/BRA, NOP), the other
+/// opcodes use a placeholder handler (4 cycles, counted in UnimplementedCount).
+/// </remarks>
+class GenesisM68kCpu {
+public:
+	using OpHandler = void (*)(GenesisM68kCpu& cpu, uint16_t opcode);
+
+	enum class OpSize : uint8_t {
+		Byte,
+		Word,
+		Long
+	};
+
+	/// <summary>Effective-address modes, mode 7 is split by its register field</summary>
+	enum class EaMode : uint8_t {
+		DataReg,
+		AddrReg,
+		AddrInd,
+		AddrIndPostInc,
+		AddrIndPreDec,
+		AddrIndDisp,
+		AddrIndIndex,
+		AbsShort,
+		AbsLong,
+		PcDisp,
+		PcIndex,
+		Immediate,
+		Invalid
+	};
+
+	static constexpr uint32_t EaModeCount = (uint32_t)EaMode::Invalid;
+
+private:
+	static constexpr uint16_t FlagC = 0x01;
+	static constexpr uint16_t FlagV = 0x02;
+	static constexpr uint16_t FlagZ = 0x04;
+	static constexpr uint16_t FlagN = 0x08;
+
+	static const std::array<OpHandler, 0x10000>& GetOpTable();
+
+	GenesisM68kState _state = {};
+	IGenesisM68kBus* _bus = nullptr;
+	const OpHandler* _opTable = nullptr;
+
+	__forceinline uint16_t FetchWord() {
+		uint16_t value = _bus->Read16(_state.PC);
+		_state.PC = (_state.PC + 2) & 0xFFFFFF;
+		return value;
+	}
+
+	uint32_t FetchLong();
+	void SetNzFlags(uint32_t value, OpSize size);
+	bool CheckCondition(uint8_t condition);
+
+	template <OpSize size>
+	uint32_t ReadMemory(uint32_t address);
+	template <OpSize size>
+	void WriteMemory(uint32_t address, uint32_t value);
+
+	template <OpSize size, EaMode mode>
+	uint32_t GetEaAddress(uint8_t reg);
+	template <OpSize size, EaMode mode>
+	uint32_t ReadEa(uint8_t reg);
+	template <OpSize size, EaMode mode>
+	void WriteEa(uint8_t reg, uint32_t value);
+
+	template <OpSize size, EaMode src, EaMode dst>
+	static void OpMove(GenesisM68kCpu& cpu, uint16_t opcode);
+	static void OpMoveQ(GenesisM68kCpu& cpu, uint16_t opcode);
+	static void OpBcc(GenesisM68kCpu& cpu, uint16_t opcode);
+	static void OpNop(GenesisM68kCpu& cpu, uint16_t opcode);
+	static void OpUnimplemented(GenesisM68kCpu& cpu, uint16_t opcode);
+
+	template <OpSize size, size_t... i>
+	static constexpr std::array<OpHandler, EaModeCount * EaModeCount> GetMoveHandlers(std::index_sequence<i...>);
+	static std::array<OpHandler, 0x10000> BuildOpTable();
+
+public:
+	GenesisM68kCpu();
+
+	void AttachBus(IGenesisM68kBus* bus) { _bus = bus; }
+
+	/// <summary>Loads the stack pointer and PC from the reset vectors</summary>
+	void Reset();
+
+	/// <summary>Executes a single instruction</summary>
+	__forceinline void Exec() {
+		uint16_t opcode = FetchWord();
+		_opTable[opcode](*this, opcode);
+	}
+
+	/// <summary>Runs instructions until the cycle counter reaches (or passes) targetCycle</summary>
+	void Run(uint64_t targetCycle);
+
+	/// <summary>Decodes the effective-address mode of a mode/register field pair</summary>
+	[[nodiscard]] static constexpr EaMode GetEaMode(uint8_t mode, uint8_t reg) {
+		if (mode < 7) {
+			return (EaMode)mode;
+		}
+		return reg <= 4 ? (EaMode)(7 + reg) : EaMode::Invalid;
+	}
+
+	[[nodiscard]] static bool IsImplemented(uint16_t opcode) { return GetOpTable()[opcode] != &OpUnimplemented; }
+
+	GenesisM68kState& GetState() { return _state; }
+};
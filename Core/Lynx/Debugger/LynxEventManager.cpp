@@ -73,7 +73,10 @@ bool LynxEventManager::ShowPreviousFrameEvents() {
 }
 
 void LynxEventManager::SetConfiguration(BaseEventViewerConfig& config) {
+	// The render thread reads the configuration
+	auto lock = _lock.AcquireSafe();
 	_config = (LynxEventViewerConfig&)config;
+	InvalidateFilteredEvents();
 }
 
 EventViewerCategoryCfg LynxEventManager::GetEventConfig(DebugEventInfo& evt) {
@@ -125,7 +128,11 @@ void LynxEventManager::ConvertScanlineCycleToRowColumn(int32_t& x, int32_t& y) {
 
 uint32_t LynxEventManager::TakeEventSnapshot(bool forAutoRefresh) {
 	DebugBreakHelper breakHelper(_debugger);
-	auto lock = _lock.AcquireSafe();
+	EventSnapshotLock lock(_lock, forAutoRefresh);
+	if (!lock.IsAcquired()) {
+		// The render thread is drawing the previous snapshot
+		return _scanlineCount;
+	}
 
 	uint16_t scanline = _mikey->GetState().CurrentScanline;
 
@@ -135,8 +142,7 @@ uint32_t LynxEventManager::TakeEventSnapshot(bool forAutoRefresh) {
 		memcpy(_ppuBuffer.get(), fb, LynxConstants::PixelCount * sizeof(uint32_t));
 	}
 
-	_snapshotCurrentFrame = _debugEvents;
-	_snapshotPrevFrame = _prevDebugEvents;
+	UpdateEventSnapshot();
 	_snapshotScanline = scanline;
 	_snapshotCycle = static_cast<uint16_t>(_cpu->GetCycleCount() % LynxConstants::CpuCyclesPerScanline);
 	_forAutoRefresh = forAutoRefresh;
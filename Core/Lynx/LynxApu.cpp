@@ -2,6 +2,7 @@
 #include "Lynx/LynxApu.h"
 #include "Lynx/LynxConsole.h"
 #include "Shared/Emulator.h"
+#include "Shared/FrameProfiler.h"
 #include "Shared/Audio/SoundMixer.h"
 #include "Utilities/Serializer.h"
 
@@ -225,6 +226,7 @@ void LynxApu::PlayQueuedAudio() {
 }
 
 void LynxApu::EndFrame() {
+	PROFILE_SCOPE(_emu->GetFrameProfiler(), ProfilerStage::Apu);
 	if (_sampleCount > 0) {
 		PlayQueuedAudio();
 	}
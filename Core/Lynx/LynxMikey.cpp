@@ -5,6 +5,8 @@
 #include "Lynx/LynxMemoryManager.h"
 #include "Lynx/LynxApu.h"
 #include "Shared/Emulator.h"
+#include "Shared/FrameProfiler.h"
+#include "Shared/LinkCable.h"
 #include "Utilities/Serializer.h"
 
 #include "Lynx/LynxEeprom.h"
@@ -244,6 +246,7 @@ __forceinline void LynxMikey::UpdateIrqLine() {
 }
 
 void LynxMikey::RenderScanline() {
+	PROFILE_SCOPE(_emu->GetFrameProfiler(), ProfilerStage::Ppu);
 	uint16_t scanline = _state.CurrentScanline;
 	if (scanline >= LynxConstants::ScreenHeight) [[unlikely]] {
 		return; // VBlank period, nothing to render
@@ -863,6 +866,16 @@ void LynxMikey::TickUart() {
 	// Called on each Timer 4 underflow — drives one UART clock tick.
 	// 11 ticks = one serial frame (1 start + 8 data + 1 parity + 1 stop).
 
+	// Data sent by the other unit over the link cable (§11)
+	if (LinkCablePort* port = _emu->GetLinkCablePort()) [[unlikely]] {
+		LinkCableMessage msg;
+		while (port->TryReceive(msg)) {
+			if (msg.Type == LinkCableMessageType::Byte) {
+				ComLynxRxData(msg.Data);
+			}
+		}
+	}
+
 	// --- Receive ---
 	// See §7.3 — Timer 4 driven reception
 	if (_state.UartRxCountdown == 0) [[unlikely]] {
@@ -961,6 +974,12 @@ void LynxMikey::ComLynxTxLoopback(uint16_t data) {
 		_uartRxWaiting++;
 	}
 	// If queue is full, data is silently lost (same as ComLynxRxData).
+
+	// §11: the other unit on the bus receives it too (link cable between 2 instances)
+	LinkCablePort* port = _emu->GetLinkCablePort();
+	if (port && port->IsPeerAttached()) [[unlikely]] {
+		port->Send({_cpu->GetState().CycleCount, 0, LinkCableMessageType::Byte, data});
+	}
 }
 
 void LynxMikey::ComLynxRxData(uint16_t data) {
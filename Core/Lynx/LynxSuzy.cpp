@@ -5,6 +5,7 @@
 #include "Lynx/LynxMemoryManager.h"
 #include "Lynx/LynxCart.h"
 #include "Shared/Emulator.h"
+#include "Shared/FrameProfiler.h"
 #include "Utilities/Serializer.h"
 
 void LynxSuzy::Init(Emulator* emu, LynxConsole* console, LynxMemoryManager* memoryManager, LynxCart* cart) {
@@ -102,6 +103,7 @@ void LynxSuzy::DoDivide() {
 }
 
 void LynxSuzy::ProcessSpriteChain() {
+	PROFILE_SCOPE(_emu->GetFrameProfiler(), ProfilerStage::Ppu);
 	if (!_state.SpriteEnabled) {
 		_state.SpriteBusy = false;
 		return;
@@ -381,6 +383,7 @@ void LynxSuzy::ProcessSprite(uint16_t scbAddr) {
 
 				// Decode pixel data for this line
 				uint8_t pixelBuf[512];
+				uint8_t spanPens[LynxConstants::ScreenWidth];
 				int pixelCount = DecodeSpriteLinePixels(currentDataAddr, lineEnd, bpp, literalMode, pixelBuf, 512);
 				currentDataAddr = lineEnd;
 
@@ -401,8 +404,11 @@ void LynxSuzy::ProcessSprite(uint16_t scbAddr) {
 						if (loop == 0) hquadoff_sign = hsign;
 						if (hsign != hquadoff_sign) hoff += hsign;
 
-						// Render decoded pixels with horizontal scaling
+						// Render decoded pixels with horizontal scaling. The on-screen pixels of
+						// a line are contiguous, they're collected and written as one span.
 						bool onscreen = false;
+						int spanStart = 0;
+						int spanLength = 0;
 						for (int px = 0; px < pixelCount; px++) {
 							uint8_t pixel = pixelBuf[px];
 
@@ -416,11 +422,14 @@ void LynxSuzy::ProcessSprite(uint16_t scbAddr) {
 
 							for (int hloop = 0; hloop < pixelWidth; hloop++) {
 								if (hoff >= 0 && hoff < static_cast<int>(LynxConstants::ScreenWidth)) {
-									// Pass ALL pixels to WriteSpritePixel — per-type logic inside
+									// Pass ALL pixels to WriteSpriteSpan — per-type logic inside
 									// decides whether to draw and whether to collide.
 									// BackgroundShadow/BackgroundNonCollide draw pen 0;
-									// other types skip pen 0 inside WriteSpritePixel.
-									WriteSpritePixel(hoff, voff, penMapped, collNum, dontCollide, spriteType);
+									// other types skip pen 0 inside WriteSpriteSpan.
+									if (!onscreen) {
+										spanStart = hoff;
+									}
+									spanPens[spanLength++] = penMapped;
 									onscreen = true;
 									everOnScreen = true;
 								} else {
@@ -429,6 +438,10 @@ void LynxSuzy::ProcessSprite(uint16_t scbAddr) {
 								hoff += hsign;
 							}
 						}
+
+						if (spanLength > 0) {
+							WriteSpriteSpan(spanStart, voff, hsign, spanPens, spanLength, collNum, dontCollide, spriteType);
+						}
 					}
 
 					voff += vsign;
@@ -598,7 +611,21 @@ __forceinline void LynxSuzy::WriteRam(uint16_t addr, uint8_t value) {
 	_console->GetWorkRam()[addr & 0xFFFF] = value;
 }
 
-void LynxSuzy::WriteSpritePixel(int x, int y, uint8_t penIndex, uint8_t collNum, bool dontCollide, LynxSpriteType spriteType) {
+void LynxSuzy::WriteSpriteSpan(int x, int y, int step, const uint8_t* pens, int count, uint8_t collNum, bool dontCollide, LynxSpriteType spriteType) {
+	switch (spriteType) {
+		case LynxSpriteType::BackgroundShadow: WriteSpriteSpan<LynxSpriteType::BackgroundShadow>(x, y, step, pens, count, collNum, dontCollide); break;
+		case LynxSpriteType::BackgroundNonCollide: WriteSpriteSpan<LynxSpriteType::BackgroundNonCollide>(x, y, step, pens, count, collNum, dontCollide); break;
+		case LynxSpriteType::BoundaryShadow: WriteSpriteSpan<LynxSpriteType::BoundaryShadow>(x, y, step, pens, count, collNum, dontCollide); break;
+		case LynxSpriteType::Boundary: WriteSpriteSpan<LynxSpriteType::Boundary>(x, y, step, pens, count, collNum, dontCollide); break;
+		case LynxSpriteType::Normal: WriteSpriteSpan<LynxSpriteType::Normal>(x, y, step, pens, count, collNum, dontCollide); break;
+		case LynxSpriteType::NonCollidable: WriteSpriteSpan<LynxSpriteType::NonCollidable>(x, y, step, pens, count, collNum, dontCollide); break;
+		case LynxSpriteType::XorShadow: WriteSpriteSpan<LynxSpriteType::XorShadow>(x, y, step, pens, count, collNum, dontCollide); break;
+		case LynxSpriteType::Shadow: WriteSpriteSpan<LynxSpriteType::Shadow>(x, y, step, pens, count, collNum, dontCollide); break;
+	}
+}
+
+template <LynxSpriteType spriteType>
+void LynxSuzy::WriteSpriteSpan(int x, int y, int step, const uint8_t* pens, int count, uint8_t collNum, bool dontCollide) {
 	// LeftHand mode: mirror X coordinate for left-handed play.
 	// On real hardware, the sprite engine flips the horizontal addressing so
 	// the display appears mirrored. This allows players to hold the Lynx
@@ -606,158 +633,122 @@ void LynxSuzy::WriteSpritePixel(int x, int y, uint8_t penIndex, uint8_t collNum,
 	// Fix for #415: LeftHand flag was read but never applied to coordinates.
 	if (_state.LeftHand) [[unlikely]] {
 		x = static_cast<int>(LynxConstants::ScreenWidth) - 1 - x;
+		step = -step;
 	}
 
-	// Bounds check — unsigned comparison catches negative values (they wrap
-	// to large unsigned) in a single test per axis, halving the branch count.
-	if (static_cast<unsigned>(x) >= LynxConstants::ScreenWidth ||
-		static_cast<unsigned>(y) >= LynxConstants::ScreenHeight) [[unlikely]] {
-		return;
-	}
-
-	// Calculate video RAM address for this pixel (4bpp packed nibbles)
+	// The caller only passes on-screen pixels: y and every x of the span are in bounds
+	uint8_t* ram = _console->GetWorkRam();
 	uint16_t dispAddr = _state.VideoBase ? _state.VideoBase
 	                    : _console->GetMikey()->GetState().DisplayAddress;
-	uint16_t byteAddr = dispAddr + y * LynxConstants::BytesPerScanline + (x >> 1);
-	uint8_t byte = ReadRam(byteAddr);
-
-	uint8_t existingPixel;
-	if (x & 1) {
-		existingPixel = byte & 0x0f;
-	} else {
-		existingPixel = (byte >> 4) & 0x0f;
-	}
-
-	// Per-type pixel processing — matches Handy's ProcessPixel() switch
-	// Each type defines: which pixels are drawn, whether XOR is applied,
-	// and whether collision detection is performed.
-	uint8_t writePixel = penIndex & 0x0f;
-	bool doWrite = false;
-	bool doCollision = false;
-
-	switch (spriteType) {
-		case LynxSpriteType::BackgroundShadow:
-			// Type 0: Draw ALL pixels (including pen 0). No collision detect,
-			// but does write collision buffer unconditionally.
-			// Per Handy: dontCollide flag is NOT checked for type 0.
-			doWrite = true;
-			// Collision buffer write (no read/compare) for pen != 0x0E
-			if (!_state.NoCollide && writePixel != 0x0e) {
-				doCollision = true;
-			}
-			break;
-
-		case LynxSpriteType::BackgroundNonCollide:
-			// Type 1: Draw ALL pixels (including pen 0). No collision at all.
-			doWrite = true;
-			break;
-
-		case LynxSpriteType::BoundaryShadow:
-			// Type 2: Skip pen 0, 0x0E, 0x0F. Collision on pen != 0 && pen != 0x0E.
-			if (writePixel != 0x00 && writePixel != 0x0e && writePixel != 0x0f) {
+	uint16_t lineAddr = dispAddr + y * LynxConstants::BytesPerScanline;
+	uint16_t collLineAddr = _state.CollisionBase + y * LynxConstants::BytesPerScanline;
+
+	// BackgroundShadow (type 0) ignores the sprite's dontCollide flag (per Handy)
+	bool canCollide = !_state.NoCollide && (spriteType == LynxSpriteType::BackgroundShadow || !dontCollide);
+
+	// Bus accesses are counted here instead of in ReadRam/WriteRam: 1 read for the video byte,
+	// 1 write if the pixel is drawn, 1 read + 1 write if the collision buffer is updated
+	uint32_t busCycles = 0;
+
+	for (int i = 0; i < count; i++, x += step) {
+		// Per-type pixel processing — matches Handy's ProcessPixel() switch
+		// Each type defines: which pixels are drawn, whether XOR is applied,
+		// and whether collision detection is performed.
+		uint8_t pen = pens[i] & 0x0f;
+		bool doWrite;
+		bool doCollision;
+		switch (spriteType) {
+			case LynxSpriteType::BackgroundShadow:
+				// Type 0: Draw ALL pixels (including pen 0). No collision detect,
+				// but does write collision buffer unconditionally (for pen != 0x0E).
 				doWrite = true;
-			}
-			if (writePixel != 0x00 && writePixel != 0x0e) {
-				doCollision = !_state.NoCollide && !dontCollide;
-			}
-			break;
+				doCollision = pen != 0x0e;
+				break;
 
-		case LynxSpriteType::Boundary:
-			// Type 3: Skip pen 0, 0x0F for draw. Collision on ALL non-zero pixels
-			// (including 0x0E — only shadow types exclude 0x0E from collision).
-			if (writePixel != 0x00 && writePixel != 0x0f) {
+			case LynxSpriteType::BackgroundNonCollide:
+				// Type 1: Draw ALL pixels (including pen 0). No collision at all.
 				doWrite = true;
-			}
-			if (writePixel != 0x00) {
-				doCollision = !_state.NoCollide && !dontCollide;
-			}
-			break;
+				doCollision = false;
+				break;
 
-		case LynxSpriteType::Normal: [[likely]]
-			// Type 4: Skip pen 0 for draw. Collision on ALL non-zero pixels
-			// (including 0x0E — only shadow types exclude 0x0E from collision).
-			if (writePixel != 0x00) {
-				doWrite = true;
-			}
-			if (writePixel != 0x00) {
-				doCollision = !_state.NoCollide && !dontCollide;
-			}
-			break;
+			case LynxSpriteType::BoundaryShadow:
+				// Type 2: Skip pen 0, 0x0E, 0x0F. Collision on pen != 0 && pen != 0x0E.
+				doWrite = pen != 0x00 && pen != 0x0e && pen != 0x0f;
+				doCollision = pen != 0x00 && pen != 0x0e;
+				break;
 
-		case LynxSpriteType::NonCollidable:
-			// Type 5: Skip pen 0. No collision.
-			if (writePixel != 0x00) {
-				doWrite = true;
-			}
-			break;
+			case LynxSpriteType::Boundary:
+				// Type 3: Skip pen 0, 0x0F for draw. Collision on ALL non-zero pixels
+				// (including 0x0E — only shadow types exclude 0x0E from collision).
+				doWrite = pen != 0x00 && pen != 0x0f;
+				doCollision = pen != 0x00;
+				break;
 
-		case LynxSpriteType::XorShadow:
-			// Type 6: Skip pen 0. XOR with existing pixel. Collision on pen != 0 && pen != 0x0E.
-			if (writePixel != 0x00) {
-				writePixel = existingPixel ^ writePixel;
-				doWrite = true;
-			}
-			if ((penIndex & 0x0f) != 0x00 && (penIndex & 0x0f) != 0x0e) {
-				doCollision = !_state.NoCollide && !dontCollide;
-			}
-			break;
+			default:
+			case LynxSpriteType::Normal:
+				// Type 4: Skip pen 0 for draw. Collision on ALL non-zero pixels
+				// (including 0x0E — only shadow types exclude 0x0E from collision).
+				doWrite = pen != 0x00;
+				doCollision = pen != 0x00;
+				break;
 
-		case LynxSpriteType::Shadow:
-			// Type 7: Skip pen 0. Normal write. Collision on pen != 0 && pen != 0x0E.
-			if (writePixel != 0x00) {
-				doWrite = true;
-			}
-			if (writePixel != 0x00 && writePixel != 0x0e) {
-				doCollision = !_state.NoCollide && !dontCollide;
-			}
-			break;
-	}
+			case LynxSpriteType::NonCollidable:
+				// Type 5: Skip pen 0. No collision.
+				doWrite = pen != 0x00;
+				doCollision = false;
+				break;
 
-	// Write pixel to video RAM
-	if (doWrite) {
-		if (x & 1) {
-			byte = (byte & 0xF0) | writePixel;
-		} else {
-			byte = (byte & 0x0F) | (writePixel << 4);
+			case LynxSpriteType::XorShadow:
+			case LynxSpriteType::Shadow:
+				// Type 6: Skip pen 0. XOR with existing pixel. Collision on pen != 0 && pen != 0x0E.
+				// Type 7: Skip pen 0. Normal write. Collision on pen != 0 && pen != 0x0E.
+				doWrite = pen != 0x00;
+				doCollision = pen != 0x00 && pen != 0x0e;
+				break;
 		}
-		WriteRam(byteAddr, byte);
-	}
+		doCollision &= canCollide;
 
-	// Collision detection — RAM-based collision buffer at COLLBAS.
-	// Per Handy: each pixel position has a nibble in the collision buffer (same
-	// layout as video buffer, 80 bytes/line). ReadCollision reads from
-	// COLLBAS + y*stride + x/2, WriteCollision writes the sprite's collision
-	// number to the same position. _spriteCollision tracks the max collision
-	// number read during this sprite's rendering.
-	//
-	// dontCollide and NoCollide are already checked per-type when setting
-	// doCollision, so no additional gate needed here.
-	if (doCollision) {
-		uint16_t collAddr = _state.CollisionBase + y * LynxConstants::BytesPerScanline + (x >> 1);
-		uint8_t collByte = ReadRam(collAddr);
-		uint8_t existingColl;
-		if (x & 1) {
-			existingColl = collByte & 0x0f;
-		} else {
-			existingColl = (collByte >> 4) & 0x0f;
-		}
+		// Video RAM (4bpp packed nibbles, even pixel in the high nibble)
+		uint16_t byteAddr = lineAddr + (x >> 1);
+		uint8_t byte = ram[byteAddr];
+		busCycles++;
 
-		// BackgroundShadow (type 0) only writes collision buffer, no read/compare.
-		// All other collidable types read existing collision and track max.
-		if (spriteType != LynxSpriteType::BackgroundShadow) {
-			if (existingColl > _spriteCollision) {
-				_spriteCollision = existingColl;
-				_state.SpriteToSpriteCollision = true;
+		if (doWrite) {
+			uint8_t writePixel = pen;
+			if constexpr (spriteType == LynxSpriteType::XorShadow) {
+				writePixel ^= (x & 1) ? (byte & 0x0f) : (byte >> 4);
 			}
+			byte = (x & 1) ? ((byte & 0xF0) | writePixel) : ((byte & 0x0F) | (writePixel << 4));
+			ram[byteAddr] = byte;
+			busCycles++;
 		}
 
-		// Write this sprite's collision number to the collision buffer
-		if (x & 1) {
-			collByte = (collByte & 0xf0) | collNum;
-		} else {
-			collByte = (collByte & 0x0f) | (collNum << 4);
+		// Collision detection — RAM-based collision buffer at COLLBAS.
+		// Per Handy: each pixel position has a nibble in the collision buffer (same
+		// layout as video buffer, 80 bytes/line). _spriteCollision tracks the max
+		// collision number read during this sprite's rendering.
+		if (doCollision) {
+			uint16_t collAddr = collLineAddr + (x >> 1);
+			uint8_t collByte = ram[collAddr];
+
+			// BackgroundShadow (type 0) only writes collision buffer, no read/compare.
+			// All other collidable types read existing collision and track max.
+			if constexpr (spriteType != LynxSpriteType::BackgroundShadow) {
+				uint8_t existingColl = (x & 1) ? (collByte & 0x0f) : (collByte >> 4);
+				if (existingColl > _spriteCollision) {
+					_spriteCollision = existingColl;
+					_state.SpriteToSpriteCollision = true;
+				}
+			}
+
+			// Write this sprite's collision number to the collision buffer
+			ram[collAddr] = (x & 1) ? ((collByte & 0xf0) | collNum) : ((collByte & 0x0f) | (collNum << 4));
+			busCycles += 2;
 		}
-		WriteRam(collAddr, collByte);
+	}
+
+	if (_spriteProcessingActive) {
+		_spriteBusCycles += busCycles;
 	}
 }
 
@@ -92,14 +92,23 @@ private:
 	/// <param name="scbAddr">Address of SCB header in work RAM.</param>
 	void ProcessSprite(uint16_t scbAddr);
 
-	/// <summary>Write one sprite pixel with collision detection.</summary>
-	/// <param name="x">Screen X coordinate.</param>
+	/// <summary>Write a span of on-screen sprite pixels on one line, with collision detection.</summary>
+	/// <param name="x">Screen X coordinate of the first pixel.</param>
 	/// <param name="y">Screen Y coordinate.</param>
-	/// <param name="penIndex">Remapped palette index (0-15).</param>
+	/// <param name="step">X increment between pixels (+1 or -1, the sprite's horizontal direction).</param>
+	/// <param name="pens">Remapped palette indexes (0-15), in drawing order.</param>
+	/// <param name="count">Number of pixels.</param>
 	/// <param name="collNum">Collision number for this sprite (SPRCOLL bits 3:0).</param>
 	/// <param name="dontCollide">Per-sprite "don't collide" flag (SPRCOLL bit 5).</param>
 	/// <param name="spriteType">Controls visibility and collision behavior.</param>
-	void WriteSpritePixel(int x, int y, uint8_t penIndex, uint8_t collNum, bool dontCollide, LynxSpriteType spriteType);
+	/// <remarks>
+	/// Pixels are processed in order with the same RAM accesses as individual pixel writes (so XOR,
+	/// collisions and overlapping buffers behave the same), the bus cycles are added once per span.
+	/// </remarks>
+	void WriteSpriteSpan(int x, int y, int step, const uint8_t* pens, int count, uint8_t collNum, bool dontCollide, LynxSpriteType spriteType);
+
+	template <LynxSpriteType spriteType>
+	void WriteSpriteSpan(int x, int y, int step, const uint8_t* pens, int count, uint8_t collNum, bool dontCollide);
 
 	/// <summary>Decode packed sprite line data into pixel buffer.</summary>
 	/// <param name="dataAddr">Current address in sprite data (updated).</param>
@@ -238,12 +238,17 @@ public:
 		return cyclesRan;
 	}
 
-	bool NeedToRun(uint32_t cyclesToRun) {
+	/// <summary>Predicts when the APU needs to run again to keep the frame counter cycle-exact.</summary>
+	/// <returns>Number of CPU cycles until the next frame counter event (at least 1).</returns>
+	uint32_t GetCyclesToNextEvent() {
 		// Run APU when:
 		//  -A new value is pending
 		//  -The "blockFrameCounterTick" process is running
 		//  -We're at the before-last or last tick of the current step
-		return _newValue >= 0 || _blockFrameCounterTick > 0 || (_previousCycle + (int32_t)cyclesToRun >= _stepCycles[_stepMode][_currentStep] - 1);
+		if (_newValue >= 0 || _blockFrameCounterTick > 0) {
+			return 1;
+		}
+		return (uint32_t)std::max(1, _stepCycles[_stepMode][_currentStep] - 1 - _previousCycle);
 	}
 
 	void GetMemoryRanges(MemoryRanges& ranges) override {
@@ -257,6 +262,7 @@ public:
 	void WriteRam(uint16_t addr, uint8_t value) override {
 		_console->GetApu()->Run();
 		_newValue = value;
+		_console->GetApu()->SetNeedToRun();
 
 		// Reset sequence after $4017 is written to
 		if (_console->GetCpu()->GetCycleCount() & 0x01) {
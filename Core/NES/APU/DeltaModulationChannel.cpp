@@ -156,14 +156,11 @@ void DeltaModulationChannel::Run(uint32_t targetCycle) {
 	}
 }
 
-bool DeltaModulationChannel::IrqPending(uint32_t cyclesToRun) {
+uint32_t DeltaModulationChannel::GetCyclesToIrq() {
 	if (_irqEnabled && _bytesRemaining > 0) {
-		uint32_t cyclesToEmptyBuffer = (_bitsRemaining + (_bytesRemaining - 1) * 8) * _timer.GetPeriod();
-		if (cyclesToRun >= cyclesToEmptyBuffer) {
-			return true;
-		}
+		return (_bitsRemaining + (_bytesRemaining - 1) * 8) * _timer.GetPeriod();
 	}
-	return false;
+	return UINT32_MAX;
 }
 
 bool DeltaModulationChannel::GetStatus() {
@@ -107,10 +107,9 @@ public:
 	/// <param name="s">Serializer instance.</param>
 	void Serialize(Serializer& s) override;
 
-	/// <summary>Checks if IRQ will fire within given cycles.</summary>
-	/// <param name="cyclesToRun">Cycles to check ahead.</param>
-	/// <returns>True if IRQ pending.</returns>
-	bool IrqPending(uint32_t cyclesToRun);
+	/// <summary>Predicts when the DMC IRQ will fire.</summary>
+	/// <returns>Number of CPU cycles until the sample buffer empties and triggers an IRQ (UINT32_MAX if no IRQ is scheduled).</returns>
+	uint32_t GetCyclesToIrq();
 
 	/// <summary>Checks if DMC needs processing.</summary>
 	/// <returns>True if DMC needs to run.</returns>
@@ -11,6 +11,7 @@
 #include "NES/NesMemoryManager.h"
 #include "NES/NesSoundMixer.h"
 #include "Shared/Emulator.h"
+#include "Shared/FrameProfiler.h"
 #include "Utilities/Serializer.h"
 
 // Initialize NES APU (Audio Processing Unit) with all sound channels
@@ -18,6 +19,7 @@ NesApu::NesApu(NesConsole* console) {
 	_region = ConsoleRegion::Auto;
 	_apuEnabled = true;
 	_needToRun = false;
+	_cyclesToNextEvent = 0;
 
 	_console = console;
 	_mixer = _console->GetSoundMixer();
@@ -49,6 +51,7 @@ void NesApu::SetRegion(ConsoleRegion region, bool forceInit) {
 	// Finish the current apu frame before switching model
 	Run();
 	_frameCounter->SetRegion(region);
+	_needToRun = true;
 }
 
 // Frame counter tick callback - clocks envelope/length/sweep units
@@ -145,6 +148,7 @@ void NesApu::GetMemoryRanges(MemoryRanges& ranges) {
 }
 
 void NesApu::Run() {
+	PROFILE_SCOPE(_console->GetEmulator()->GetFrameProfiler(), ProfilerStage::Apu);
 	// Update framecounter and all channels
 	// This is called:
 	//-At the end of a frame
@@ -168,6 +172,10 @@ void NesApu::Run() {
 		_triangle->Run(_previousCycle);
 		_dmc->Run(_previousCycle);
 	}
+
+	// Predict the next cycle where the frame counter or DMC IRQ needs the APU to run, so that Exec
+	// doesn't need to re-evaluate the frame counter & DMC state on every CPU cycle.
+	_cyclesToNextEvent = std::min(_frameCounter->GetCyclesToNextEvent(), _dmc->GetCyclesToIrq());
 }
 
 void NesApu::SetNeedToRun() {
@@ -182,8 +190,7 @@ bool NesApu::NeedToRun(uint32_t currentCycle) {
 		return true;
 	}
 
-	uint32_t cyclesToRun = currentCycle - _previousCycle;
-	return _frameCounter->NeedToRun(cyclesToRun) || _dmc->IrqPending(cyclesToRun);
+	return currentCycle - _previousCycle >= _cyclesToNextEvent;
 }
 
 void NesApu::Exec() {
@@ -220,6 +227,7 @@ void NesApu::Reset(bool softReset) {
 	_apuEnabled = true;
 	_currentCycle = 0;
 	_previousCycle = 0;
+	_needToRun = true;
 	_square1->Reset(softReset);
 	_square2->Reset(softReset);
 	_triangle->Reset(softReset);
@@ -240,6 +248,11 @@ void NesApu::Serialize(Serializer& s) {
 	SV(_noise);
 	SV(_dmc);
 	SV(_frameCounter);
+
+	if (!s.IsSaving()) {
+		// Recompute the next event prediction based on the loaded state
+		_needToRun = true;
+	}
 }
 
 void NesApu::AddExpansionAudioDelta(AudioChannel channel, int16_t delta) {
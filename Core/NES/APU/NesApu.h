@@ -44,6 +44,9 @@ private:
 	/// <summary>Current CPU cycle count for timing calculations.</summary>
 	uint32_t _currentCycle;
 
+	/// <summary>Number of cycles after _previousCycle at which the next frame counter step or DMC IRQ is due (updated by Run).</summary>
+	uint32_t _cyclesToNextEvent;
+
 	/// <summary>Pulse wave channel 1 ($4000-$4003) - variable duty cycle square wave.</summary>
 	unique_ptr<SquareChannel> _square1;
 
@@ -75,7 +78,7 @@ private:
 	ConsoleRegion _region;
 
 private:
-	/// <summary>Checks if APU processing is needed at the given cycle.</summary>
+	/// <summary>Checks if APU processing is needed at the given cycle (register accesses and end of frame catch up on their own).</summary>
 	/// <param name="currentCycle">Current CPU cycle count.</param>
 	/// <returns>True if APU needs to process audio at this cycle.</returns>
 	__forceinline bool NeedToRun(uint32_t currentCycle);
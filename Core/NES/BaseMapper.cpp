@@ -45,6 +45,12 @@ uint16_t BaseMapper::InternalGetChrRamPageSize() {
 	return std::min((uint32_t)GetChrRamPageSize(), _chrRamSize);
 }
 
+void BaseMapper::UpdateChrPageSizes() {
+	_chrRomPageSize = InternalGetChrRomPageSize();
+	_chrRomPageCount = GetChrRomPageCount();
+	_chrRamPageSize = InternalGetChrRamPageSize();
+}
+
 // Validate that address range is aligned to 256-byte boundaries (NES mapper granularity)
 bool BaseMapper::ValidateAddressRange(uint16_t startAddr, uint16_t endAddr) {
 	if ((startAddr & 0xFF) || (endAddr & 0xFF) != 0xFF) {
@@ -202,11 +208,25 @@ void BaseMapper::SetCpuMemoryMapping(uint16_t startAddr, uint16_t endAddr, uint8
 			_prgPages[i] = nullptr;
 			_prgMemoryAccess[i] = MemoryAccessType::NoAccess;
 		}
+		UpdatePrgReadPage((uint8_t)i);
 
 		sourceOffset += 0x100;
 	}
 }
 
+void BaseMapper::UpdatePrgReadPage(uint8_t page) {
+	bool canReadDirectly = !_hasCustomReadRam && !_isReadRegisterPage[page] && (_prgMemoryAccess[page] & MemoryAccessType::Read);
+	_prgReadPages[page] = canReadDirectly ? _prgPages[page] : nullptr;
+}
+
+void BaseMapper::UpdateReadRegisterPages(uint16_t startAddr, uint16_t endAddr) {
+	for (int page = startAddr >> 8; page <= (endAddr >> 8); page++) {
+		bool* registers = &_isReadRegisterAddr[page << 8];
+		_isReadRegisterPage[page] = _allowRegisterRead && std::any_of(registers, registers + 0x100, [](bool isRegister) { return isRegister; });
+		UpdatePrgReadPage((uint8_t)page);
+	}
+}
+
 void BaseMapper::RemoveCpuMemoryMapping(uint16_t startAddr, uint16_t endAddr) {
 	// Unmap this section of memory (causing open bus behavior)
 	int firstSlot = startAddr >> 8;
@@ -239,18 +259,18 @@ void BaseMapper::SetPpuMemoryMapping(uint16_t startAddr, uint16_t endAddr, uint1
 	switch (type) {
 		case ChrMemoryType::Default:
 		case ChrMemoryType::ChrRom:
-			pageSize = InternalGetChrRomPageSize();
+			pageSize = _chrRomPageSize;
 			if (pageSize == 0) {
 #ifdef _DEBUG
 				MessageManager::DisplayMessage("Debug", "Tried to map undefined chr rom.");
 #endif
 				return;
 			}
-			pageCount = GetChrRomPageCount();
+			pageCount = _chrRomPageCount;
 			break;
 
 		case ChrMemoryType::ChrRam:
-			pageSize = InternalGetChrRamPageSize();
+			pageSize = _chrRamPageSize;
 			if (pageSize == 0) {
 #ifdef _DEBUG
 				MessageManager::DisplayMessage("Debug", "Tried to map undefined chr ram.");
@@ -331,8 +351,8 @@ void BaseMapper::SetPpuMemoryMapping(uint16_t startAddr, uint16_t endAddr, ChrMe
 	int slotCount = (endAddr - startAddr + 1) >> 8;
 	for (int i = 0; i < slotCount; i++) {
 		if (sourceSize == 0 || accessType == 0) {
-			_chrPages[i] = nullptr;
-			_chrMemoryAccess[i] = MemoryAccessType::NoAccess;
+			_chrPages[firstSlot + i] = nullptr;
+			_chrMemoryAccess[firstSlot + i] = MemoryAccessType::NoAccess;
 		} else {
 			while (sourceOffset >= sourceSize) {
 				sourceOffset -= sourceSize;
@@ -437,7 +457,7 @@ void BaseMapper::SelectChrPage(uint16_t slot, uint16_t page, ChrMemoryType memor
 		if (memoryType == ChrMemoryType::Default) {
 			memoryType = _chrRomSize > 0 ? ChrMemoryType::ChrRom : ChrMemoryType::ChrRam;
 		}
-		pageSize = memoryType == ChrMemoryType::ChrRam ? InternalGetChrRamPageSize() : InternalGetChrRomPageSize();
+		pageSize = memoryType == ChrMemoryType::ChrRam ? _chrRamPageSize : _chrRomPageSize;
 	}
 
 	uint16_t startAddr = slot * pageSize;
@@ -507,6 +527,7 @@ void BaseMapper::InitializeChrRam(int32_t chrRamSize) {
 		_emu->RegisterMemory(MemoryType::NesChrRam, _chrRam, _chrRamSize);
 		_console->InitializeRam(_chrRam, _chrRamSize);
 	}
+	UpdateChrPageSizes();
 }
 
 bool BaseMapper::HasDefaultWorkRam() {
@@ -539,6 +560,7 @@ void BaseMapper::AddRegisterRange(uint16_t startAddr, uint16_t endAddr, MemoryOp
 			_isWriteRegisterAddr[i] = true;
 		}
 	}
+	UpdateReadRegisterPages(startAddr, endAddr);
 }
 
 void BaseMapper::RemoveRegisterRange(uint16_t startAddr, uint16_t endAddr, MemoryOperation operation) {
@@ -550,6 +572,7 @@ void BaseMapper::RemoveRegisterRange(uint16_t startAddr, uint16_t endAddr, Memor
 			_isWriteRegisterAddr[i] = false;
 		}
 	}
+	UpdateReadRegisterPages(startAddr, endAddr);
 }
 
 void BaseMapper::Serialize(Serializer& s) {
@@ -632,6 +655,7 @@ void BaseMapper::Initialize(NesConsole* console, RomData& romData) {
 
 	memset(_isReadRegisterAddr, 0, sizeof(_isReadRegisterAddr));
 	memset(_isWriteRegisterAddr, 0, sizeof(_isWriteRegisterAddr));
+	memset(_isReadRegisterPage, 0, sizeof(_isReadRegisterPage));
 	AddRegisterRange(RegisterStartAddress(), RegisterEndAddress(), MemoryOperation::Any);
 
 	_prgSize = (uint32_t)romData.PrgRom.size();
@@ -649,6 +673,7 @@ void BaseMapper::Initialize(NesConsole* console, RomData& romData) {
 	if (_chrRomSize > 0) {
 		memcpy(_chrRom, romData.ChrRom.data(), _chrRomSize);
 	}
+	UpdateChrPageSizes();
 
 	_hasChrBattery = romData.SaveChrRamSize > 0 || ForceChrBattery();
 
@@ -696,6 +721,7 @@ void BaseMapper::Initialize(NesConsole* console, RomData& romData) {
 	for (int i = 0; i < 0x100; i++) {
 		// Allow us to map a different page every 256 bytes
 		_prgPages[i] = nullptr;
+		_prgReadPages[i] = nullptr;
 		_prgMemoryOffset[i] = -1;
 		_prgMemoryType[i] = PrgMemoryType::PrgRom;
 		_prgMemoryAccess[i] = MemoryAccessType::NoAccess;
@@ -60,6 +60,9 @@ private:
 	uint16_t InternalGetChrRomPageSize();
 	uint16_t InternalGetChrRamPageSize();
 	bool ValidateAddressRange(uint16_t startAddr, uint16_t endAddr);
+	void UpdatePrgReadPage(uint8_t page);
+	void UpdateReadRegisterPages(uint16_t startAddr, uint16_t endAddr);
+	void UpdateChrPageSizes();
 
 	uint8_t* _nametableRam = nullptr;   ///< Nametable RAM (CIRAM or cartridge RAM)
 	uint8_t _nametableCount = 2;        ///< Number of nametables (2 or 4)
@@ -77,12 +80,16 @@ private:
 
 	bool _allowRegisterRead = false;    ///< Mapper supports register reads
 	bool _isReadRegisterAddr[0x10000] = {};   ///< Address is a read register
+	bool _isReadRegisterPage[0x100] = {};     ///< 256-byte page contains a read register (only set when _allowRegisterRead)
 	bool _isWriteRegisterAddr[0x10000] = {};  ///< Address is a write register
 
 	/// PRG memory page pointers (256 x 256-byte pages = 64KB address space)
 	MemoryAccessType _prgMemoryAccess[0x100] = {};
 	uint8_t* _prgPages[0x100] = {};
 
+	/// _prgPages entries that ReadRamFast can read directly (readable, no read registers, no custom ReadRam), nullptr otherwise
+	uint8_t* _prgReadPages[0x100] = {};
+
 	/// CHR memory page pointers (256 x 256-byte pages for PPU address space)
 	MemoryAccessType _chrMemoryAccess[0x100] = {};
 	uint8_t* _chrPages[0x100] = {};
@@ -112,6 +119,12 @@ protected:
 	uint32_t _chrRomSize = 0;     ///< CHR ROM size in bytes
 	uint32_t _chrRamSize = 0;     ///< CHR RAM size in bytes
 
+	// CHR page geometry, cached by UpdateChrPageSizes() when the CHR ROM/RAM sizes are set.
+	// Mappers switch CHR banks several times per frame, this keeps the virtual page size getters out of SelectChrPage.
+	uint16_t _chrRomPageSize = 0;  ///< InternalGetChrRomPageSize()
+	uint32_t _chrRomPageCount = 0; ///< GetChrRomPageCount()
+	uint16_t _chrRamPageSize = 0;  ///< InternalGetChrRamPageSize()
+
 	// RAM data pointers and sizes
 	uint8_t* _saveRam = nullptr;    ///< Battery-backed save RAM
 	uint32_t _saveRamSize = 0;      ///< Save RAM size in bytes
@@ -261,14 +274,10 @@ public:
 	/// Mirrors the ReadVram/InternalReadVram pattern for VRAM reads.
 	/// </summary>
 	__forceinline uint8_t ReadRamFast(uint16_t addr) {
-		if (!_hasCustomReadRam) [[likely]] {
-			if (_allowRegisterRead && _isReadRegisterAddr[addr]) [[unlikely]] {
-				return ReadRegister(addr);
-			}
-			if (_prgMemoryAccess[addr >> 8] & MemoryAccessType::Read) [[likely]] {
-				return _prgPages[addr >> 8][(uint8_t)addr];
-			}
-			// Open bus fallback: use qualified (non-virtual) call to avoid
+		if (uint8_t* page = _prgReadPages[addr >> 8]) [[likely]] {
+			return page[(uint8_t)addr];
+		} else if (!_hasCustomReadRam) {
+			// Registers and open bus: use qualified (non-virtual) call to avoid
 			// repeating NesMemoryManager::GetOpenBus() header dependency.
 			return BaseMapper::ReadRam(addr);
 		} else {
@@ -8,6 +8,8 @@
 #include "Shared/SettingTypes.h"
 
 void BaseNesPpu::GetState(NesPpuState& state) {
+	CatchUpPixels();
+
 	state.Control = _control;
 	state.Mask = _mask;
 	state.StatusFlags = _statusFlags;
@@ -29,6 +31,8 @@ void BaseNesPpu::GetState(NesPpuState& state) {
 }
 
 void BaseNesPpu::SetState(NesPpuState& state) {
+	CatchUpPixels();
+
 	_control = state.Control;
 	_mask = state.Mask;
 	_statusFlags = state.StatusFlags;
@@ -76,6 +80,8 @@ uint8_t BaseNesPpu::ReadPaletteRam(uint16_t addr) {
 }
 
 void BaseNesPpu::WritePaletteRam(uint16_t addr, uint8_t value) {
+	CatchUpPixels();
+
 	addr &= 0x1F;
 	value &= 0x3F;
 	if (addr == 0x00 || addr == 0x10) {
@@ -97,6 +103,8 @@ void BaseNesPpu::WritePaletteRam(uint16_t addr, uint8_t value) {
 }
 
 void BaseNesPpu::DebugSendFrame() {
+	CatchUpPixels();
+
 	int offset = std::max(0, (int)(_cycle + _scanline * NesConstants::ScreenWidth));
 	int pixelsToClear = NesConstants::ScreenPixelCount - offset;
 	if (pixelsToClear > 0) {
@@ -109,6 +117,8 @@ void BaseNesPpu::DebugSendFrame() {
 
 /* Applies the effect of grayscale/intensify bits to the output buffer (batched) */
 void BaseNesPpu::UpdateGrayscaleAndIntensifyBits() {
+	CatchUpPixels();
+
 	if (_scanline < 0 || _scanline > _nmiScanline) {
 		UpdateColorBitMasks();
 		return;
@@ -151,10 +161,74 @@ void BaseNesPpu::UpdateColorBitMasks() {
 }
 
 void BaseNesPpu::UpdateMinimumDrawCycles() {
-	_minimumDrawBgCycle = _mask.BackgroundEnabled ? ((_mask.BackgroundMask || _console->GetNesConfig().ForceBackgroundFirstColumn) ? 0 : 8) : 300;
-	_minimumDrawSpriteCycle = _mask.SpritesEnabled ? ((_mask.SpriteMask || _console->GetNesConfig().ForceSpritesFirstColumn) ? 0 : 8) : 300;
+	CatchUpPixels();
+
+	_minimumDrawBgCycle = _mask.BackgroundEnabled ? ((_mask.BackgroundMask || _nesCfg->ForceBackgroundFirstColumn) ? 0 : 8) : 300;
+	_minimumDrawSpriteCycle = _mask.SpritesEnabled ? ((_mask.SpriteMask || _nesCfg->ForceSpritesFirstColumn) ? 0 : 8) : 300;
 	_minimumDrawSpriteStandardCycle = _mask.SpritesEnabled ? (_mask.SpriteMask ? 0 : 8) : 300;
 
-	_emulatorBgEnabled = _console->GetNesConfig().BackgroundEnabled;
-	_emulatorSpritesEnabled = _console->GetNesConfig().SpritesEnabled;
+	_emulatorBgEnabled = _nesCfg->BackgroundEnabled;
+	_emulatorSpritesEnabled = _nesCfg->SpritesEnabled;
+}
+
+/* Same composition as NesPpu::GetPixelColor, for the span of pixels deferred by DefaultNesPpu::DrawPixel */
+void BaseNesPpu::RenderPendingPixels() {
+	uint16_t* out = _currentOutputBuffer + (_scanline << 8) - 1;
+	uint8_t offset = _xScroll;
+
+	for (uint32_t i = 0; i < _pendingShifterCount; i++) {
+		PendingShifterState& state = _pendingShifters[i];
+		uint32_t lastCycle = (i + 1 < _pendingShifterCount) ? _pendingShifters[i + 1].Cycle - 1 : _pendingPixelEnd;
+		lastCycle = std::min<uint32_t>(lastCycle, _pendingPixelEnd);
+
+		for (uint32_t cycle = state.Cycle; cycle <= lastCycle; cycle++) {
+			// The shifters are shifted once per pixel after the reload
+			uint32_t shift = cycle - state.Cycle;
+			uint16_t lowBitShift = shift < 16 ? (uint16_t)(state.LowBitShift << shift) : 0;
+			uint16_t highBitShift = shift < 16 ? (uint16_t)(state.HighBitShift << shift) : 0;
+
+			uint8_t backgroundColor = 0;
+			uint8_t spriteBgColor = 0;
+			if (cycle > _minimumDrawBgCycle) {
+				spriteBgColor = (((lowBitShift << offset) & 0x8000) >> 15) | (((highBitShift << offset) & 0x8000) >> 14);
+				if (_emulatorBgEnabled) {
+					backgroundColor = spriteBgColor;
+				}
+			}
+
+			uint8_t color = ((offset + ((cycle - 1) & 0x07) < 8) ? state.PreviousTilePalette : state.CurrentTilePalette) + backgroundColor;
+
+			if (_hasSprite[cycle] && cycle > _minimumDrawSpriteCycle) [[unlikely]] {
+				for (uint8_t j = 0; j < _spriteCount; j++) {
+					NesSpriteInfo& sprite = _spriteTiles[j];
+					int32_t spriteShift = (int32_t)cycle - sprite.SpriteX - 1;
+					if (spriteShift >= 0 && spriteShift < 8) {
+						uint8_t spriteColor;
+						if (sprite.HorizontalMirror) {
+							spriteColor = ((sprite.LowByte >> spriteShift) & 0x01) | ((sprite.HighByte >> spriteShift) & 0x01) << 1;
+						} else {
+							spriteColor = ((sprite.LowByte << spriteShift) & 0x80) >> 7 | ((sprite.HighByte << spriteShift) & 0x80) >> 6;
+						}
+
+						if (spriteColor != 0) {
+							if (j == 0 && spriteBgColor != 0 && _sprite0Visible && cycle != 256 && _mask.BackgroundEnabled && !_statusFlags.Sprite0Hit && cycle > _minimumDrawSpriteStandardCycle) [[unlikely]] {
+								_statusFlags.Sprite0Hit = true;
+								_emu->AddDebugEvent<CpuType::Nes>(DebugEventType::SpriteZeroHit);
+							}
+
+							if (_emulatorSpritesEnabled && (backgroundColor == 0 || !sprite.BackgroundPriority)) {
+								color = sprite.PaletteOffset + spriteColor;
+							}
+							break;
+						}
+					}
+				}
+			}
+
+			out[cycle] = _paletteRam[color & 0x03 ? color : 0];
+		}
+	}
+
+	_pendingPixelStart = 0;
+	_pendingShifterCount = 0;
 }
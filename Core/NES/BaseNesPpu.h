@@ -5,6 +5,8 @@
 #include "NES/INesMemoryHandler.h"
 #include "Utilities/ISerializable.h"
 #include "NES/NesTypes.h"
+#include "Shared/SettingTypes.h"
+#include "Shared/ConfigSnapshot.h"
 
 enum class ConsoleRegion;
 
@@ -94,6 +96,7 @@ protected:
 
 	Emulator* _emu = nullptr;
 	EmuSettings* _settings = nullptr;
+	ConfigSnapshot<NesConfig> _nesCfg; ///< NES settings, refreshed on reset and at the end of each frame
 	std::array<std::unique_ptr<uint16_t[]>, 2> _outputBuffers;
 
 	ConsoleRegion _region = {};
@@ -117,6 +120,46 @@ protected:
 	uint64_t _oamDecayCycles[0x40] = {};
 	bool _corruptOamRow[32] = {};
 
+	/// <summary>Background shifter values seen by the first pixel of a span of deferred pixels</summary>
+	struct PendingShifterState {
+		uint16_t Cycle;
+		uint16_t LowBitShift;
+		uint16_t HighBitShift;
+		uint8_t PreviousTilePalette;
+		uint8_t CurrentTilePalette;
+	};
+
+	// Catch-up rendering: pixels are composed in batches by RenderPendingPixels() rather than one at a time.
+	// Until then, only the shifter reloads are recorded (one span per reload, the shifters only shift in between)
+	bool _allowCatchUpRendering = false;
+	uint16_t _pendingPixelStart = 0; // First deferred cycle (0 = nothing pending)
+	uint16_t _pendingPixelEnd = 0;   // Last deferred cycle
+	uint8_t _pendingShifterCount = 0;
+	PendingShifterState _pendingShifters[34] = {};
+
+	/// <summary>Starts deferring pixels at the current cycle</summary>
+	__forceinline void BeginPendingPixels() {
+		_pendingPixelStart = (uint16_t)_cycle;
+		_pendingShifterCount = 0;
+		RecordPendingShifters();
+	}
+
+	/// <summary>Records the shifters after a reload, when pixels are being deferred</summary>
+	__forceinline void RecordPendingShifters() {
+		_pendingShifters[_pendingShifterCount++] = {(uint16_t)_cycle, _lowBitShift, _highBitShift, _previousTilePalette, _currentTilePalette};
+	}
+
+	/// <summary>
+	/// Renders the deferred pixels. Must be called before anything the pixels depend on changes (scroll, mask,
+	/// palette, sprites) and before the output buffer or the sprite 0 hit flag are read.
+	/// </summary>
+	__forceinline void CatchUpPixels() {
+		if (_pendingPixelStart != 0) [[unlikely]] {
+			RenderPendingPixels();
+		}
+	}
+	__noinline void RenderPendingPixels();
+
 	bool IsRenderingEnabled();
 	void UpdateGrayscaleAndIntensifyBits();
 	void UpdateColorBitMasks();
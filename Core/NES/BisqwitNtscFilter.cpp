@@ -11,8 +11,6 @@
 
 BisqwitNtscFilter::BisqwitNtscFilter(Emulator* emu) : BaseVideoFilter(emu) {
 	_resDivider = 1;
-	_stopThread = false;
-	_workDone = false;
 
 	// from https ://forums.nesdev.org/viewtopic.php?p=159266#p159266
 	const double signalLumaLow[2][4] = {
@@ -48,34 +46,9 @@ BisqwitNtscFilter::BisqwitNtscFilter(Emulator* emu) : BaseVideoFilter(emu) {
 			_signalHigh[(h ? 0x40 : 0) | i] = int8_t(std::floor(((q - signal_blank) / (signal_white - signal_blank)) * 100));
 		}
 	}
-
-	_extraThread = std::thread([=]() {
-		// Worker thread to improve decode speed
-		while (!_stopThread) {
-			_waitWork.Wait();
-			if (_stopThread) {
-				break;
-			}
-
-			uint32_t* outputBuffer = GetOutputBuffer();
-			FrameInfo frameInfo = _frameInfo;
-
-			// Adjust outputbuffer to start at the middle of the picture
-			int scale = 8 / _resDivider;
-			outputBuffer += frameInfo.Width * ((120 - GetOverscan().Top) * scale);
-
-			DecodeFrame(120, 239 - GetOverscan().Bottom, _ppuOutputBuffer, outputBuffer, GetVideoPhaseOffset() + 120 * 341 * _signalsPerPixel);
-
-			_workDone = true;
-		}
-	});
 }
 
-BisqwitNtscFilter::~BisqwitNtscFilter() {
-	_stopThread = true;
-	_waitWork.Signal();
-	_extraThread.join();
-}
+BisqwitNtscFilter::~BisqwitNtscFilter() = default;
 
 void BisqwitNtscFilter::ApplyFilter(uint16_t* ppuOutputBuffer) {
 	_ppuOutputBuffer = ppuOutputBuffer;
@@ -84,10 +57,16 @@ void BisqwitNtscFilter::ApplyFilter(uint16_t* ppuOutputBuffer) {
 		NesDefaultVideoFilter::ApplyPalBorder(ppuOutputBuffer);
 	}
 
-	_workDone = false;
-	_waitWork.Signal();
-	DecodeFrame(GetOverscan().Top, 120, ppuOutputBuffer, GetOutputBuffer(), GetVideoPhaseOffset() + GetOverscan().Top * 341 * _signalsPerPixel);
-	while (!_workDone) {}
+	// All rows must be decoded before blending: the blend for a row reads the next row,
+	// which may belong to another slice
+	int startRow = GetOverscan().Top;
+	uint32_t rowCount = 240 - GetOverscan().Top - GetOverscan().Bottom;
+	ProcessRowSlices(rowCount, [=, this](uint32_t firstRow, uint32_t lastRow) {
+		DecodeRows(startRow + firstRow, startRow + lastRow - 1);
+	});
+	ProcessRowSlices(rowCount, [=, this](uint32_t firstRow, uint32_t lastRow) {
+		BlendRows(startRow + firstRow, startRow + lastRow - 1);
+	});
 }
 
 FrameInfo BisqwitNtscFilter::GetFrameInfo() {
@@ -211,14 +190,16 @@ void BisqwitNtscFilter::GenerateNtscSignal(int8_t* ntscSignal, int& phase, int r
 	phase += (341 - 256) * _signalsPerPixel;
 }
 
-void BisqwitNtscFilter::DecodeFrame(int startRow, int endRow, uint16_t* ppuOutputBuffer, uint32_t* outputBuffer, int startPhase) {
+uint32_t* BisqwitNtscFilter::GetRowOutput(int row) {
 	int pixelsPerCycle = 8 / _resDivider;
-	int phase = startPhase;
+	return GetOutputBuffer() + _frameInfo.Width * ((row - GetOverscan().Top) * pixelsPerCycle);
+}
+
+void BisqwitNtscFilter::DecodeRows(int startRow, int endRow) {
+	int phase = GetVideoPhaseOffset() + startRow * 341 * _signalsPerPixel;
 	constexpr int lineWidth = 256;
 	int8_t rowSignal[lineWidth * _signalsPerPixel];
-	uint32_t rowPixelGap = _frameInfo.Width * pixelsPerCycle;
-
-	uint32_t* orgBuffer = outputBuffer;
+	LineBuffers buffers;
 
 	for (int y = startRow; y <= endRow; y++) {
 		int startCycle = phase % 12;
@@ -227,23 +208,23 @@ void BisqwitNtscFilter::DecodeFrame(int startRow, int endRow, uint16_t* ppuOutpu
 		GenerateNtscSignal(rowSignal, phase, y);
 
 		// Convert the NTSC signal to RGB
-		NtscDecodeLine(lineWidth * _signalsPerPixel, rowSignal, outputBuffer, (startCycle + 7) % 12);
-
-		outputBuffer += rowPixelGap;
+		NtscDecodeLine(lineWidth * _signalsPerPixel, rowSignal, GetRowOutput(y), (startCycle + 7) % 12, buffers);
 	}
+}
 
+void BisqwitNtscFilter::BlendRows(int startRow, int endRow) {
 	// Generate the missing vertical lines
-	outputBuffer = orgBuffer;
+	int pixelsPerCycle = 8 / _resDivider;
+	uint32_t rowPixelGap = _frameInfo.Width * pixelsPerCycle;
 	int lastRow = 239 - GetOverscan().Bottom;
 	bool verticalBlend = false; //_emu->GetSettings()->GetVideoConfig();
 	for (int y = startRow; y <= endRow; y++) {
+		uint32_t* outputBuffer = GetRowOutput(y);
 		uint64_t* currentLine = (uint64_t*)outputBuffer;
 		uint64_t* nextLine = y == lastRow ? currentLine : (uint64_t*)(outputBuffer + rowPixelGap);
 		uint64_t* buffer = (uint64_t*)(outputBuffer + rowPixelGap / 2);
 
 		RecursiveBlend(4 / _resDivider, buffer, currentLine, nextLine, pixelsPerCycle, verticalBlend);
-
-		outputBuffer += rowPixelGap;
 	}
 }
 
@@ -274,9 +255,13 @@ void BisqwitNtscFilter::DecodeFrame(int startRow, int endRow, uint16_t* ppuOutpu
  *         Would be generated from the PPU clock cycle counter at the start of the scanline.
  *         In essence it conveys in one integer the same information that real NTSC signal
  *         would convey in the colorburst period in the beginning of each scanline.
+ *
+ * Buffers: Scratch space reused between lines. The signal and its I/Q products are
+ *          precomputed into zero-padded arrays, so the filter loop has no bounds checks
+ *          or modulo operations (the output is unchanged).
  */
-void BisqwitNtscFilter::NtscDecodeLine(int width, const int8_t* signal, uint32_t* target, int phase0) {
-	auto Read = [=](int pos) -> char { return pos >= 0 && pos < width ? signal[pos] : 0; };
+void BisqwitNtscFilter::NtscDecodeLine(int width, const int8_t* signal, uint32_t* target, int phase0, LineBuffers& buffers) {
+	auto Read = [=](int pos) -> char { return signal[pos]; };
 	auto Cos = [=](int pos) -> char { return _sinetable[(pos + 36) % 12 + phase0]; };
 	auto Sin = [=](int pos) -> char { return _sinetable[(pos + 36) % 12 + 3 + phase0]; };
 
@@ -284,15 +269,33 @@ void BisqwitNtscFilter::NtscDecodeLine(int width, const int8_t* signal, uint32_t
 	int leftOverscan = GetOverscan().Left * 8;
 	int rightOverscan = width - GetOverscan().Right * 8;
 
-	int maxFilter = std::max(_yWidth, std::max(_iWidth, _qWidth)) / 2;
+	int maxWidth = std::max(_yWidth, std::max(_iWidth, _qWidth));
+	int maxFilter = maxWidth / 2;
+
+	// Samples outside of [0, width) read as 0
+	int padding = maxFilter + maxWidth;
+	if (buffers.Padding != padding || buffers.Y.size() != (size_t)(width + padding * 2)) {
+		buffers.Padding = padding;
+		buffers.Y.assign(width + padding * 2, 0);
+		buffers.I.assign(width + padding * 2, 0);
+		buffers.Q.assign(width + padding * 2, 0);
+	}
+	int* ySignal = buffers.Y.data() + padding;
+	int* iSignal = buffers.I.data() + padding;
+	int* qSignal = buffers.Q.data() + padding;
+	for (int pos = 0; pos < width; pos++) {
+		ySignal[pos] = Read(pos);
+		iSignal[pos] = Read(pos) * Cos(pos);
+		qSignal[pos] = Read(pos) * Sin(pos);
+	}
 
 	for (int s = -maxFilter; s < rightOverscan; s++) {
 		int sy = s + _yWidth / 2;
 		int si = s + _iWidth / 2;
 		int sq = s + _qWidth / 2;
-		ysum += Read(sy) - Read(sy - _yWidth);
-		isum += Read(si) * Cos(si) - Read(si - _iWidth) * Cos(si - _iWidth);
-		qsum += Read(sq) * Sin(sq) - Read(sq - _qWidth) * Sin(sq - _qWidth);
+		ysum += ySignal[sy] - ySignal[sy - _yWidth];
+		isum += iSignal[si] - iSignal[si - _iWidth];
+		qsum += qSignal[sq] - qSignal[sq - _qWidth];
 
 		if (s >= leftOverscan && !(s % _resDivider)) {
 			int r = std::min(255, std::max(0, (ysum * _y + isum * _ir + qsum * _qr) / 65536));
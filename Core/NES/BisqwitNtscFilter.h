@@ -4,7 +4,6 @@
 #pragma once
 #include "pch.h"
 #include "Shared/Video/BaseVideoFilter.h"
-#include "Utilities/AutoResetEvent.h"
 
 class BisqwitNtscFilter : public BaseVideoFilter {
 private:
@@ -12,10 +11,13 @@ private:
 	static constexpr int _signalsPerPixel = 8;
 	static constexpr int _signalWidth = 258;
 
-	std::thread _extraThread;
-	AutoResetEvent _waitWork;
-	atomic<bool> _stopThread;
-	atomic<bool> _workDone;
+	/// <summary>Per-slice scratch buffers: one line of signal and its I/Q products, zero-padded on both sides</summary>
+	struct LineBuffers {
+		vector<int> Y;
+		vector<int> I;
+		vector<int> Q;
+		int Padding = -1;
+	};
 
 	int _resDivider = 1;
 	uint16_t* _ppuOutputBuffer = nullptr;
@@ -41,10 +43,12 @@ private:
 
 	void RecursiveBlend(int iterationCount, uint64_t* output, uint64_t* currentLine, uint64_t* nextLine, int pixelsPerCycle, bool verticalBlend);
 
-	void NtscDecodeLine(int width, const int8_t* signal, uint32_t* target, int phase0);
+	void NtscDecodeLine(int width, const int8_t* signal, uint32_t* target, int phase0, LineBuffers& buffers);
 
 	void GenerateNtscSignal(int8_t* ntscSignal, int& phase, int rowNumber);
-	void DecodeFrame(int startRow, int endRow, uint16_t* ppuOutputBuffer, uint32_t* outputBuffer, int startPhase);
+	void DecodeRows(int startRow, int endRow);
+	void BlendRows(int startRow, int endRow);
+	[[nodiscard]] uint32_t* GetRowOutput(int row);
 	void OnBeforeApplyFilter() override;
 
 public:
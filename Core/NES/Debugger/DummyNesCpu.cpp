@@ -41,4 +41,33 @@ void DummyNesCpu::LogMemoryOperation(uint32_t addr, uint8_t value, MemoryOperati
 
 MemoryOperationInfo DummyNesCpu::GetOperationInfo(uint32_t index) {
 	return _memOperations[index];
-}
\ No newline at end of file
+}
+int DummyNesCpu::GetOperandFetchCount(uint8_t opCode) {
+	// Same fetches as FetchOperand()
+	switch (_addrMode[opCode]) {
+		case NesAddrMode::Acc:
+		case NesAddrMode::Imp:
+			return 0;
+
+		case NesAddrMode::Imm:
+		case NesAddrMode::Rel:
+		case NesAddrMode::Zero:
+		case NesAddrMode::ZeroX:
+		case NesAddrMode::ZeroY:
+		case NesAddrMode::IndX:
+		case NesAddrMode::IndY:
+		case NesAddrMode::IndYW:
+			return 1;
+
+		case NesAddrMode::Abs:
+		case NesAddrMode::AbsX:
+		case NesAddrMode::AbsXW:
+		case NesAddrMode::AbsY:
+		case NesAddrMode::AbsYW:
+		case NesAddrMode::Ind:
+			return 2;
+
+		default:
+			return -1;
+	}
+}
@@ -145,13 +145,27 @@ void NesDebugger::ProcessInstruction() {
 	}
 
 	if (_step->StepCount != 0 && _breakpointManager->HasBreakpoints() && _settings->GetDebugConfig().UsePredictiveBreakpoints) {
-		_dummyCpu->SetDummyState(_cpu);
-		_dummyCpu->Exec();
-		for (uint32_t i = 1; i < _dummyCpu->GetOperationCount(); i++) {
-			MemoryOperationInfo memOp = _dummyCpu->GetOperationInfo(i);
-			if (_breakpointManager->HasBreakpointForType(memOp.Type)) {
-				AddressInfo absAddr = _mapper->GetAbsoluteAddress(memOp.Address);
-				_debugger->ProcessPredictiveBreakpoint(CpuType::Nes, _breakpointManager.get(), memOp, absAddr);
+		int operandCount = _breakpointManager->HasReadWriteBreakpoints() ? -1 : DummyNesCpu::GetOperandFetchCount(opCode);
+		if (operandCount >= 0) {
+			// Execute breakpoints only: the operand fetches are the only predicted accesses that can match,
+			// and their addresses only depend on the opcode, so the instruction doesn't need to be executed
+			if (_breakpointManager->HasBreakpointForType(MemoryOperationType::ExecOperand)) {
+				for (int i = 1; i <= operandCount; i++) {
+					uint16_t operandAddr = pc + i;
+					MemoryOperationInfo memOp(operandAddr, _memoryManager->DebugRead(operandAddr), MemoryOperationType::ExecOperand, MemoryType::NesMemory);
+					AddressInfo absAddr = _mapper->GetAbsoluteAddress(operandAddr);
+					_debugger->ProcessPredictiveBreakpoint(CpuType::Nes, _breakpointManager.get(), memOp, absAddr);
+				}
+			}
+		} else {
+			_dummyCpu->SetDummyState(_cpu);
+			_dummyCpu->Exec();
+			for (uint32_t i = 1; i < _dummyCpu->GetOperationCount(); i++) {
+				MemoryOperationInfo memOp = _dummyCpu->GetOperationInfo(i);
+				if (_breakpointManager->HasBreakpointForType(memOp.Type)) {
+					AddressInfo absAddr = _mapper->GetAbsoluteAddress(memOp.Address);
+					_debugger->ProcessPredictiveBreakpoint(CpuType::Nes, _breakpointManager.get(), memOp, absAddr);
+				}
 			}
 		}
 	}
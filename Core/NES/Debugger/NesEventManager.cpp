@@ -130,7 +130,10 @@ bool NesEventManager::ShowPreviousFrameEvents() {
 }
 
 void NesEventManager::SetConfiguration(BaseEventViewerConfig& config) {
+	// The render thread reads the configuration
+	auto lock = _lock.AcquireSafe();
 	_config = (NesEventViewerConfig&)config;
+	InvalidateFilteredEvents();
 }
 
 EventViewerCategoryCfg NesEventManager::GetEventConfig(DebugEventInfo& evt) {
@@ -208,7 +211,11 @@ void NesEventManager::ConvertScanlineCycleToRowColumn(int32_t& x, int32_t& y) {
 uint32_t NesEventManager::TakeEventSnapshot(bool forAutoRefresh) {
 	BaseNesPpu* ppu = _console->GetPpu();
 	DebugBreakHelper breakHelper(_debugger);
-	auto lock = _lock.AcquireSafe();
+	EventSnapshotLock lock(_lock, forAutoRefresh);
+	if (!lock.IsAcquired()) {
+		// The render thread is drawing the previous snapshot
+		return _scanlineCount;
+	}
 
 	uint16_t cycle = _console->GetPpu()->GetCurrentCycle();
 	uint16_t scanline = ppu->GetCurrentScanline() + 1;
@@ -221,8 +228,7 @@ uint32_t NesEventManager::TakeEventSnapshot(bool forAutoRefresh) {
 		memcpy(_ppuBuffer.get() + offset, ppu->GetScreenBuffer(true) + offset, (NesConstants::ScreenPixelCount - offset) * sizeof(uint16_t));
 	}
 
-	_snapshotCurrentFrame = _debugEvents;
-	_snapshotPrevFrame = _prevDebugEvents;
+	UpdateEventSnapshot();
 	_snapshotScanline = scanline;
 	_snapshotCycle = cycle;
 	_forAutoRefresh = forAutoRefresh;
@@ -9,8 +9,8 @@ public:
 
 	__forceinline void StoreSpriteInformation(bool verticalMirror, uint16_t tileAddr, uint8_t lineOffset) {}
 	__forceinline void StoreTileInformation() {}
-	__forceinline bool RemoveSpriteLimit() { return _console->GetNesConfig().RemoveSpriteLimit; }
-	__forceinline bool UseAdaptiveSpriteLimit() { return _console->GetNesConfig().AdaptiveSpriteLimit; }
+	__forceinline bool RemoveSpriteLimit() { return _nesCfg->RemoveSpriteLimit; }
+	__forceinline bool UseAdaptiveSpriteLimit() { return _nesCfg->AdaptiveSpriteLimit; }
 
 	void* OnBeforeSendFrame() { return nullptr; }
 
@@ -20,6 +20,21 @@ public:
 
 	__forceinline void DrawPixel() {
 		// This is called 3.7 million times per second - needs to be as fast as possible.
+		if (IsRenderingEnabled() && _allowCatchUpRendering) [[likely]] {
+			// Catch-up rendering: the pixel is composed later by RenderPendingPixels, along with the rest of
+			// the span (at the end of the visible part of the scanline, or before a register write/read)
+			if (_pendingPixelStart == 0) {
+				BeginPendingPixels();
+			}
+			_pendingPixelEnd = (uint16_t)_cycle;
+			if (_cycle == 256) {
+				// Sprite evaluation ends on this cycle and changes the sprites used for the current scanline
+				RenderPendingPixels();
+			}
+			return;
+		}
+
+		CatchUpPixels();
 		if (IsRenderingEnabled() || ((_videoRamAddr & 0x3F00) != 0x3F00)) {
 			uint32_t color = GetPixelColor();
 			_currentOutputBuffer[(_scanline << 8) + _cycle - 1] = _paletteRam[color & 0x03 ? color : 0];
@@ -62,6 +62,16 @@ void Epsm::Exec() {
 	uint64_t targetClock = GetTargetClock();
 
 	while (_clockCounter < targetClock) {
+		// Skip directly to the next clock where something happens (a sample is generated
+		// or a timer expires) and run that clock normally
+		uint32_t clocks = (uint32_t)std::min<uint64_t>(targetClock - _clockCounter, clocksPerSample - _sampleClockCounter);
+		clocks = _opn.GetClocksUntilTimer(clocks);
+		if (clocks > 1) {
+			_opn.Skip(clocks - 1);
+			_clockCounter += clocks - 1;
+			_sampleClockCounter += clocks - 1;
+		}
+
 		_clockCounter++;
 		_opn.Exec();
 
@@ -8,12 +8,19 @@
 #include "Utilities/FolderUtilities.h"
 #include "Utilities/StringUtilities.h"
 #include "Utilities/HexUtilities.h"
+#include "Utilities/PathUtil.h"
 
-std::unordered_map<uint32_t, GameInfo> GameDatabase::_gameDatabase;
+MemoryMappedFile GameDatabase::_dbFile;
+vector<uint8_t> GameDatabase::_dbBuffer;
+std::span<const uint8_t> GameDatabase::_db;
+uint32_t GameDatabase::_entryCount = 0;
 bool GameDatabase::_enabled = true;
-bool GameDatabase::_initialized = false;
+atomic<bool> GameDatabase::_initialized = false;
 SimpleLock GameDatabase::_loadLock;
 
+static_assert(sizeof(GameDatabase::GameDbHeader) == 32);
+static_assert(sizeof(GameDatabase::GameDbRecord) == 60);
+
 template <typename T>
 T GameDatabase::ToInt(const string& value) {
 	if (value.empty()) {
@@ -22,10 +29,21 @@ T GameDatabase::ToInt(const string& value) {
 	return std::stoi(value);
 }
 
-void GameDatabase::LoadGameDb(const vector<string>& data) {
-	for (const string& row : data) {
+vector<GameInfo> GameDatabase::ParseGameDb(std::istream& db) {
+	vector<GameInfo> games;
+	games.reserve(6000);
+	while (db.good()) {
+		string row;
+		std::getline(db, row);
+		if (!row.empty() && row[row.size() - 1] == '\r') {
+			row.pop_back();
+		}
+		if (row.empty() || row[0] == '#') {
+			continue;
+		}
+
 		vector<string> values = StringUtilities::Split(row, ',');
-		if (values.size() >= 16) {
+		if (values.size() >= 18) {
 			GameInfo gameInfo;
 			gameInfo.Crc = (uint32_t)std::stoll(values[0], nullptr, 16);
 			gameInfo.System = values[1];
@@ -50,29 +68,154 @@ void GameDatabase::LoadGameDb(const vector<string>& data) {
 				gameInfo.MapperID = UnifLoader::GetMapperID(gameInfo.Board);
 			}
 
-			_gameDatabase[gameInfo.Crc] = gameInfo;
+			games.push_back(std::move(gameInfo));
 		}
 	}
-
-	MessageManager::Log();
-	MessageManager::Log(std::format("[DB] Initialized - {} games in DB", _gameDatabase.size()));
+	return games;
 }
 
-void GameDatabase::LoadGameDb(std::istream& db) {
-	vector<string> dbData;
-	dbData.reserve(6000);
-	while (db.good()) {
-		string lineContent;
-		std::getline(db, lineContent);
-		if (lineContent[lineContent.size() - 1] == '\r') {
-			lineContent = lineContent.substr(0, lineContent.size() - 1);
+vector<uint8_t> GameDatabase::CompileGameDb(std::istream& db, uint64_t sourceSize, int64_t sourceTime) {
+	vector<GameInfo> games = ParseGameDb(db);
+
+	// Sorted by CRC (binary search), the last entry wins for duplicate CRCs (same as the text database)
+	std::stable_sort(games.begin(), games.end(), [](const GameInfo& a, const GameInfo& b) { return a.Crc < b.Crc; });
+	vector<GameInfo> uniqueGames;
+	uniqueGames.reserve(games.size());
+	for (GameInfo& game : games) {
+		if (!uniqueGames.empty() && uniqueGames.back().Crc == game.Crc) {
+			uniqueGames.back() = std::move(game);
+		} else {
+			uniqueGames.push_back(std::move(game));
 		}
-		if (lineContent.empty() || lineContent[0] == '#') {
-			continue;
+	}
+
+	vector<char> strings = {'\0'};
+	std::unordered_map<string, uint32_t> stringOffsets = {{"", 0}};
+	auto addString = [&](const string& str) -> uint32_t {
+		auto result = stringOffsets.try_emplace(str, (uint32_t)strings.size());
+		if (result.second) {
+			strings.insert(strings.end(), str.begin(), str.end());
+			strings.push_back('\0');
+		}
+		return result.first->second;
+	};
+
+	vector<GameDbRecord> records;
+	records.reserve(uniqueGames.size());
+	for (GameInfo& game : uniqueGames) {
+		GameDbRecord record = {};
+		record.Crc = game.Crc;
+		record.PrgRomSize = game.PrgRomSize;
+		record.ChrRomSize = game.ChrRomSize;
+		record.ChrRamSize = game.ChrRamSize;
+		record.WorkRamSize = game.WorkRamSize;
+		record.SaveRamSize = game.SaveRamSize;
+		record.MapperID = game.MapperID;
+		record.HasBattery = game.HasBattery ? 1 : 0;
+		record.InputType = (uint8_t)game.InputType;
+		record.VsType = (uint8_t)game.VsType;
+		record.VsPpuModel = (uint8_t)game.VsPpuModel;
+		record.System = addString(game.System);
+		record.Board = addString(game.Board);
+		record.Pcb = addString(game.Pcb);
+		record.Chip = addString(game.Chip);
+		record.Mirroring = addString(game.Mirroring);
+		record.BusConflicts = addString(game.BusConflicts);
+		record.SubmapperID = addString(game.SubmapperID);
+		records.push_back(record);
+	}
+
+	GameDbHeader header = {};
+	header.Magic = GameDatabase::Magic;
+	header.Version = GameDatabase::Version;
+	header.EntryCount = (uint32_t)records.size();
+	header.StringTableOffset = (uint32_t)(sizeof(GameDbHeader) + records.size() * sizeof(GameDbRecord));
+	header.SourceSize = sourceSize;
+	header.SourceTime = sourceTime;
+
+	vector<uint8_t> output(header.StringTableOffset + strings.size());
+	memcpy(output.data(), &header, sizeof(header));
+	if (!records.empty()) {
+		memcpy(output.data() + sizeof(header), records.data(), records.size() * sizeof(GameDbRecord));
+	}
+	memcpy(output.data() + header.StringTableOffset, strings.data(), strings.size());
+	return output;
+}
+
+bool GameDatabase::SetDatabase(std::span<const uint8_t> db) {
+	GameDbHeader header;
+	if (db.size() < sizeof(header)) {
+		return false;
+	}
+	memcpy(&header, db.data(), sizeof(header));
+	if (header.Magic != GameDatabase::Magic || header.Version != GameDatabase::Version ||
+		header.StringTableOffset != sizeof(GameDbHeader) + (uint64_t)header.EntryCount * sizeof(GameDbRecord) ||
+		header.StringTableOffset >= db.size() || db.back() != 0) {
+		// Truncated/corrupted file, or built by another version
+		return false;
+	}
+
+	_db = db;
+	_entryCount = header.EntryCount;
+	return true;
+}
+
+bool GameDatabase::FindGame(uint32_t romCrc, GameInfo& info) {
+	const uint8_t* records = _db.data() + sizeof(GameDbHeader);
+	auto readRecord = [&](uint32_t index) {
+		GameDbRecord record;
+		memcpy(&record, records + (size_t)index * sizeof(GameDbRecord), sizeof(record));
+		return record;
+	};
+
+	uint32_t start = 0;
+	uint32_t end = _entryCount;
+	while (start < end) {
+		uint32_t mid = start + (end - start) / 2;
+		GameDbRecord record = readRecord(mid);
+		if (record.Crc < romCrc) {
+			start = mid + 1;
+		} else if (record.Crc > romCrc) {
+			end = mid;
+		} else {
+			// Offsets are validated against the table size, strings are null-terminated (the table ends with 0)
+			const char* strings = (const char*)_db.data() + sizeof(GameDbHeader) + (size_t)_entryCount * sizeof(GameDbRecord);
+			size_t stringTableSize = _db.size() - (sizeof(GameDbHeader) + (size_t)_entryCount * sizeof(GameDbRecord));
+			auto getString = [&](uint32_t offset) { return offset < stringTableSize ? string(strings + offset) : string(); };
+
+			info.Crc = record.Crc;
+			info.System = getString(record.System);
+			info.Board = getString(record.Board);
+			info.Pcb = getString(record.Pcb);
+			info.Chip = getString(record.Chip);
+			info.MapperID = record.MapperID;
+			info.PrgRomSize = record.PrgRomSize;
+			info.ChrRomSize = record.ChrRomSize;
+			info.ChrRamSize = record.ChrRamSize;
+			info.WorkRamSize = record.WorkRamSize;
+			info.SaveRamSize = record.SaveRamSize;
+			info.HasBattery = record.HasBattery != 0;
+			info.Mirroring = getString(record.Mirroring);
+			info.InputType = (GameInputType)record.InputType;
+			info.BusConflicts = getString(record.BusConflicts);
+			info.SubmapperID = getString(record.SubmapperID);
+			info.VsType = (VsSystemType)record.VsType;
+			info.VsPpuModel = (PpuModel)record.VsPpuModel;
+			return true;
 		}
-		dbData.push_back(std::move(lineContent));
 	}
-	LoadGameDb(dbData);
+	return false;
+}
+
+void GameDatabase::LoadGameDb(std::istream& db) {
+	auto lock = _loadLock.AcquireSafe();
+	_dbFile.Close();
+	_dbBuffer = CompileGameDb(db);
+	SetDatabase(_dbBuffer);
+	_initialized = true;
+
+	MessageManager::Log();
+	MessageManager::Log(std::format("[DB] Initialized - {} games in DB", _entryCount));
 }
 
 void GameDatabase::InitDatabase() {
@@ -80,8 +223,39 @@ void GameDatabase::InitDatabase() {
 		auto lock = _loadLock.AcquireSafe();
 		if (!_initialized) {
 			string dbPath = FolderUtilities::CombinePath(FolderUtilities::GetHomeFolder(), "NexenNesDB.txt");
-			ifstream db(dbPath, ios::in | ios::binary);
-			LoadGameDb(db);
+			string binPath = FolderUtilities::CombinePath(FolderUtilities::GetHomeFolder(), "NexenNesDB.bin");
+
+			std::error_code ec;
+			fs::path sourcePath = PathUtil::FromUtf8(dbPath);
+			uint64_t sourceSize = fs::file_size(sourcePath, ec);
+			sourceSize = ec ? 0 : sourceSize;
+			fs::file_time_type writeTime = fs::last_write_time(sourcePath, ec);
+			int64_t sourceTime = ec ? 0 : (int64_t)writeTime.time_since_epoch().count();
+
+			// Use the compiled database if it was built from the current text database (or if there is no text database)
+			bool loaded = false;
+			if (_dbFile.Open(binPath) && SetDatabase(_dbFile.GetSpan())) {
+				GameDbHeader header;
+				memcpy(&header, _dbFile.GetData(), sizeof(header));
+				loaded = sourceSize == 0 || (header.SourceSize == sourceSize && header.SourceTime == sourceTime);
+			}
+
+			if (!loaded) {
+				_dbFile.Close();
+				ifstream db(dbPath, ios::in | ios::binary);
+				_dbBuffer = CompileGameDb(db, sourceSize, sourceTime);
+				SetDatabase(_dbBuffer);
+
+				if (sourceSize > 0) {
+					ofstream output(binPath, ios::out | ios::binary);
+					output.write((const char*)_dbBuffer.data(), _dbBuffer.size());
+					output.close();
+					MessageManager::Log("[DB] Compiled game database");
+				}
+			}
+
+			MessageManager::Log();
+			MessageManager::Log(std::format("[DB] Initialized - {} games in DB", _entryCount));
 			_initialized = true;
 		}
 	}
@@ -123,10 +297,10 @@ uint8_t GameDatabase::GetSubMapper(GameInfo& info) {
 
 bool GameDatabase::GetDbRomSize(uint32_t romCrc, uint32_t& prgSize, uint32_t& chrSize) {
 	InitDatabase();
-	auto result = _gameDatabase.find(romCrc);
-	if (result != _gameDatabase.end()) {
-		prgSize = result->second.PrgRomSize;
-		chrSize = result->second.ChrRomSize;
+	GameInfo info;
+	if (FindGame(romCrc, info)) {
+		prgSize = info.PrgRomSize;
+		chrSize = info.ChrRomSize;
 		return true;
 	}
 	return false;
@@ -135,10 +309,7 @@ bool GameDatabase::GetDbRomSize(uint32_t romCrc, uint32_t& prgSize, uint32_t& ch
 bool GameDatabase::GetiNesHeader(uint32_t romCrc, NesHeader& nesHeader) {
 	GameInfo info = {};
 	InitDatabase();
-	auto result = _gameDatabase.find(romCrc);
-	if (result != _gameDatabase.end()) {
-		info = result->second;
-
+	if (FindGame(romCrc, info)) {
 		nesHeader.Byte9 = 0;
 		if (info.PrgRomSize > 4096 * 1024) {
 			uint16_t prgSize = info.PrgRomSize / 0x4000;
@@ -204,10 +375,8 @@ void GameDatabase::SetGameInfo(uint32_t romCrc, RomData& romData, bool updateRom
 
 	InitDatabase();
 
-	auto result = _gameDatabase.find(romCrc);
-	bool foundInDatabase = result != _gameDatabase.end();
+	bool foundInDatabase = FindGame(romCrc, info);
 	if (foundInDatabase) {
-		info = result->second;
 		MessageManager::Log("[DB] Game found in database");
 
 		if (info.MapperID < UnifBoards::UnknownBoard) {
@@ -1,16 +1,67 @@
 #pragma once
 #include "pch.h"
-#include <unordered_map>
+#include <span>
 #include "NES/RomData.h"
+#include "Utilities/MemoryMappedFile.h"
 #include "Utilities/SimpleLock.h"
 
 struct NesHeader;
 
+/// <summary>
+/// NES game database (correct mapper/sizes/system for known dumps, by PRG+CHR CRC32).
+/// </summary>
+/// <remarks>
+/// The text database (NexenNesDB.txt, CSV) is compiled once into NexenNesDB.bin: a table of fixed size records
+/// sorted by CRC32, followed by a string table. The binary file is memory-mapped and looked up with a binary search,
+/// so no parsing or allocation happens at startup (it is only rebuilt when the text file's size/date changes, or
+/// when the format version changes). The database is only opened on the first lookup.
+///
+/// Binary format (little endian): GameDbHeader, then EntryCount GameDbRecord, then the null-terminated strings
+/// (offsets relative to StringTableOffset, offset 0 is the empty string).
+/// </remarks>
 class GameDatabase {
+public:
+	static constexpr uint32_t Magic = 0x4244584E; ///< "NXDB"
+	static constexpr uint32_t Version = 1;        ///< Increment when the format or the compiled values change (e.g UNIF board IDs)
+
+	struct GameDbHeader {
+		uint32_t Magic;
+		uint32_t Version;
+		uint32_t EntryCount;
+		uint32_t StringTableOffset;
+		uint64_t SourceSize; ///< Size of the text database the file was compiled from
+		int64_t SourceTime;  ///< Modification time of the text database
+	};
+
+	struct GameDbRecord {
+		uint32_t Crc;
+		uint32_t PrgRomSize;
+		uint32_t ChrRomSize;
+		uint32_t ChrRamSize;
+		uint32_t WorkRamSize;
+		uint32_t SaveRamSize;
+		uint16_t MapperID;
+		uint8_t HasBattery;
+		uint8_t InputType;
+		uint8_t VsType;
+		uint8_t VsPpuModel;
+		uint16_t Reserved;
+		uint32_t System;
+		uint32_t Board;
+		uint32_t Pcb;
+		uint32_t Chip;
+		uint32_t Mirroring;
+		uint32_t BusConflicts;
+		uint32_t SubmapperID;
+	};
+
 private:
-	static std::unordered_map<uint32_t, GameInfo> _gameDatabase;
+	static MemoryMappedFile _dbFile;    ///< Mapped binary database
+	static vector<uint8_t> _dbBuffer;   ///< Binary database built in memory (when it can't be written/mapped)
+	static std::span<const uint8_t> _db; ///< Binary database in use (mapped file or buffer)
+	static uint32_t _entryCount;
 	static bool _enabled;
-	static bool _initialized;
+	static atomic<bool> _initialized;
 	static SimpleLock _loadLock;
 
 	template <typename T>
@@ -22,11 +73,19 @@ private:
 
 	static void InitDatabase();
 	static void UpdateRomData(GameInfo& info, RomData& romData);
-	static void LoadGameDb(const vector<string>& data);
+	static vector<GameInfo> ParseGameDb(std::istream& db);
+	static bool SetDatabase(std::span<const uint8_t> db);
+	static bool FindGame(uint32_t romCrc, GameInfo& info);
 
 public:
+	/// <summary>Replaces the database with the content of a text database (CSV)</summary>
 	static void LoadGameDb(std::istream& db);
 
+	/// <summary>Compiles a text database (CSV) into the binary format</summary>
+	/// <param name="sourceSize">Stored in the header, to detect changes to the text file</param>
+	/// <param name="sourceTime">Stored in the header, to detect changes to the text file</param>
+	static vector<uint8_t> CompileGameDb(std::istream& db, uint64_t sourceSize = 0, int64_t sourceTime = 0);
+
 	static void SetGameInfo(uint32_t romCrc, RomData& romData, bool updateRomData, bool forHeaderlessRom);
 	static bool GetiNesHeader(uint32_t romCrc, NesHeader& nesHeader);
 	static bool GetDbRomSize(uint32_t romCrc, uint32_t& prgSize, uint32_t& chrSize);
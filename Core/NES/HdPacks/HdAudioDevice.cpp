@@ -70,6 +70,12 @@ bool HdAudioDevice::PlayBgmTrack(int trackId, uint32_t startOffset) {
 }
 
 bool HdAudioDevice::PlaySfx(uint8_t sfxNumber) {
+	auto decoded = _hdData->SfxSamplesById.find(_album * 256 + sfxNumber);
+	if (decoded != _hdData->SfxSamplesById.end()) {
+		_oggMixer->PlaySfx(decoded->second);
+		return false;
+	}
+
 	auto result = _hdData->SfxFilesById.find(_album * 256 + sfxNumber);
 	if (result != _hdData->SfxFilesById.end()) {
 		return !_oggMixer->Play(result->second, true, 0, 0);
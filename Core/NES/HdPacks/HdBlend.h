@@ -0,0 +1,122 @@
+#pragma once
+#include "pch.h"
+#include "NES/HdPacks/HdData.h"
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(__SSE2__)
+#include <emmintrin.h>
+#define NEXEN_HD_BLEND_SSE2 1
+#endif
+
+/// <summary>
+/// Pixel blending used by HdNesPack to draw HD tiles and backgrounds (ARGB pixels, premultiplied alpha).
+/// </summary>
+/// <remarks>
+/// The row functions process 4 pixels at a time with SSE2 (baseline on x64), with the same results as the scalar
+/// per-pixel code, which is used for the last pixels of a row and on other architectures.
+///
+/// Alpha blending: opaque source pixels are copied, fully transparent ones leave the output unchanged,
+/// the others are blended (output = src + (256 - srcAlpha) * output / 256). Add/Subtract blend every pixel
+/// with saturation. The output's alpha is always set to 0xFF.
+/// </remarks>
+namespace HdBlend {
+	template <HdPackBlendMode blendMode>
+	__forceinline void BlendColors(uint8_t output[4], const uint8_t input[4]) {
+		if constexpr (blendMode == HdPackBlendMode::Alpha) {
+			uint8_t invertedAlpha = 256 - input[3];
+			output[0] = input[0] + (uint8_t)((invertedAlpha * output[0]) >> 8);
+			output[1] = input[1] + (uint8_t)((invertedAlpha * output[1]) >> 8);
+			output[2] = input[2] + (uint8_t)((invertedAlpha * output[2]) >> 8);
+			output[3] = 0xFF;
+		} else if constexpr (blendMode == HdPackBlendMode::Add) {
+			output[0] = (uint8_t)std::min(255, (int)input[0] + (int)output[0]);
+			output[1] = (uint8_t)std::min(255, (int)input[1] + (int)output[1]);
+			output[2] = (uint8_t)std::min(255, (int)input[2] + (int)output[2]);
+			output[3] = 0xFF;
+		} else if constexpr (blendMode == HdPackBlendMode::Subtract) {
+			output[0] = (uint8_t)std::max(0, (int)output[0] - (int)input[0]);
+			output[1] = (uint8_t)std::max(0, (int)output[1] - (int)input[1]);
+			output[2] = (uint8_t)std::max(0, (int)output[2] - (int)input[2]);
+			output[3] = 0xFF;
+		}
+	}
+
+	/// <summary>Draws a single pixel (see remarks for the alpha mode's rules)</summary>
+	template <HdPackBlendMode blendMode>
+	__forceinline void DrawPixel(uint32_t& output, uint32_t input) {
+		if constexpr (blendMode == HdPackBlendMode::Alpha) {
+			if (input >= 0xFF000000) {
+				output = input;
+			} else if (input >= 0x01000000) {
+				BlendColors<blendMode>((uint8_t*)&output, (uint8_t*)&input);
+			}
+		} else {
+			BlendColors<blendMode>((uint8_t*)&output, (uint8_t*)&input);
+		}
+	}
+
+#ifdef NEXEN_HD_BLEND_SSE2
+	template <HdPackBlendMode blendMode>
+	__forceinline __m128i Blend4(__m128i dst, __m128i src) {
+		const __m128i alphaMask = _mm_set1_epi32((int)0xFF000000);
+		if constexpr (blendMode == HdPackBlendMode::Alpha) {
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i byteMask = _mm_set1_epi16(0xFF);
+
+			// 256 - alpha, for each channel of each pixel (16-bit lanes)
+			__m128i alpha = _mm_srli_epi32(src, 24);
+			alpha = _mm_or_si128(alpha, _mm_slli_epi32(alpha, 16));
+			__m128i inverted = _mm_sub_epi16(_mm_set1_epi16(256), alpha);
+			__m128i invertedLo = _mm_shuffle_epi32(inverted, _MM_SHUFFLE(1, 1, 0, 0));
+			__m128i invertedHi = _mm_shuffle_epi32(inverted, _MM_SHUFFLE(3, 3, 2, 2));
+
+			__m128i dstLo = _mm_unpacklo_epi8(dst, zero);
+			__m128i dstHi = _mm_unpackhi_epi8(dst, zero);
+			__m128i srcLo = _mm_unpacklo_epi8(src, zero);
+			__m128i srcHi = _mm_unpackhi_epi8(src, zero);
+
+			// Wraps around like the scalar code's uint8_t arithmetic
+			__m128i lo = _mm_and_si128(_mm_add_epi16(srcLo, _mm_srli_epi16(_mm_mullo_epi16(invertedLo, dstLo), 8)), byteMask);
+			__m128i hi = _mm_and_si128(_mm_add_epi16(srcHi, _mm_srli_epi16(_mm_mullo_epi16(invertedHi, dstHi), 8)), byteMask);
+			__m128i blended = _mm_or_si128(_mm_packus_epi16(lo, hi), alphaMask);
+
+			// Fully transparent source pixels leave the output unchanged (opaque ones give src)
+			__m128i transparent = _mm_cmpeq_epi32(_mm_and_si128(src, alphaMask), zero);
+			return _mm_or_si128(_mm_and_si128(transparent, dst), _mm_andnot_si128(transparent, blended));
+		} else if constexpr (blendMode == HdPackBlendMode::Add) {
+			return _mm_or_si128(_mm_adds_epu8(dst, src), alphaMask);
+		} else {
+			return _mm_or_si128(_mm_subs_epu8(dst, src), alphaMask);
+		}
+	}
+#endif
+
+	/// <summary>Draws count consecutive source pixels over count consecutive output pixels</summary>
+	template <HdPackBlendMode blendMode>
+	__forceinline void DrawRow(uint32_t* output, const uint32_t* input, uint32_t count) {
+		uint32_t i = 0;
+#ifdef NEXEN_HD_BLEND_SSE2
+		for (; i + 4 <= count; i += 4) {
+			__m128i dst = _mm_loadu_si128((const __m128i*)(output + i));
+			__m128i src = _mm_loadu_si128((const __m128i*)(input + i));
+			_mm_storeu_si128((__m128i*)(output + i), Blend4<blendMode>(dst, src));
+		}
+#endif
+		for (; i < count; i++) {
+			DrawPixel<blendMode>(output[i], input[i]);
+		}
+	}
+
+	/// <summary>Fills count consecutive output pixels with a color</summary>
+	__forceinline void FillRow(uint32_t* output, uint32_t color, uint32_t count) {
+		uint32_t i = 0;
+#ifdef NEXEN_HD_BLEND_SSE2
+		__m128i value = _mm_set1_epi32((int)color);
+		for (; i + 4 <= count; i += 4) {
+			_mm_storeu_si128((__m128i*)(output + i), value);
+		}
+#endif
+		for (; i < count; i++) {
+			output[i] = color;
+		}
+	}
+} // namespace HdBlend
@@ -21,8 +21,8 @@ private:
 	NesTileInfoEx _nextTileEx = {};
 
 public:
-	__forceinline bool RemoveSpriteLimit() { return _console->GetNesConfig().RemoveSpriteLimit; }
-	__forceinline bool UseAdaptiveSpriteLimit() { return _console->GetNesConfig().AdaptiveSpriteLimit; }
+	__forceinline bool RemoveSpriteLimit() { return _nesCfg->RemoveSpriteLimit; }
+	__forceinline bool UseAdaptiveSpriteLimit() { return _nesCfg->AdaptiveSpriteLimit; }
 	void* OnBeforeSendFrame() { return nullptr; }
 
 	__forceinline void StoreSpriteInformation(bool verticalMirror, uint16_t tileAddr, uint8_t lineOffset) {
@@ -6,6 +6,8 @@
 #include "Utilities/PNGHelper.h"
 #include "Utilities/HexUtilities.h"
 #include "Utilities/SimpleLock.h"
+#include "Utilities/AutoResetEvent.h"
+#include "Utilities/WorkerPool.h"
 #include "Utilities/Timer.h"
 
 class BaseHdNesPack;
@@ -192,7 +194,8 @@ protected:
 
 struct HdPackBitmapInfo {
 private:
-	bool _initDone = false;
+	std::atomic<bool> _initDone = false;
+	std::atomic<bool> _prefetchQueued = false;
 	SimpleLock _lock;
 
 public:
@@ -223,6 +226,16 @@ public:
 		_initDone = true;
 	}
 
+	/// <summary>True once the PNG file has been decoded</summary>
+	[[nodiscard]] bool IsLoaded() const {
+		return _initDone;
+	}
+
+	/// <summary>Returns true the first time it's called (used to only queue the file once for prefetching)</summary>
+	[[nodiscard]] bool MarkPrefetchQueued() {
+		return !_prefetchQueued.exchange(true);
+	}
+
 	void PremultiplyAlpha() {
 		for (size_t i = 0; i < PixelData.size(); i++) {
 			if (PixelData[i] < 0xFF000000) {
@@ -254,6 +267,7 @@ public:
 	bool TransparencyRequired;
 	bool IsFullyTransparent;
 	vector<uint32_t> HdTileData;
+	uint32_t* AtlasData = nullptr; ///< Slot in HdPackData::TileAtlas, used instead of HdTileData when set
 	uint32_t ChrBankId;
 
 	vector<HdPackCondition*> Conditions;
@@ -289,18 +303,24 @@ public:
 		return rgbBuffer;
 	}
 
+	__forceinline const uint32_t* GetTileData() const {
+		return AtlasData ? AtlasData : HdTileData.data();
+	}
+
 	void UpdateFlags() {
 		Blank = true;
 		HasTransparentPixels = false;
 		IsFullyTransparent = true;
-		for (size_t i = 0; i < HdTileData.size(); i++) {
-			if (HdTileData[i] != HdTileData[0]) {
+		const uint32_t* tileData = GetTileData();
+		size_t pixelCount = AtlasData ? (size_t)Width * Height : HdTileData.size();
+		for (size_t i = 0; i < pixelCount; i++) {
+			if (tileData[i] != tileData[0]) {
 				Blank = false;
 			}
-			if ((HdTileData[i] & 0xFF000000) != 0xFF000000) {
+			if ((tileData[i] & 0xFF000000) != 0xFF000000) {
 				HasTransparentPixels = true;
 			}
-			if (HdTileData[i] & 0xFF000000) {
+			if (tileData[i] & 0xFF000000) {
 				IsFullyTransparent = false;
 			}
 		}
@@ -317,10 +337,14 @@ public:
 		uint32_t bitmapOffset = Y * Bitmap->Width + X;
 		uint32_t* pngData = Bitmap->PixelData.data();
 
-		HdTileData.resize(Width * Height);
+		uint32_t* tileData = AtlasData;
+		if (!tileData) {
+			HdTileData.resize(Width * Height);
+			tileData = HdTileData.data();
+		}
 		if (Bitmap->PixelData.size() >= bitmapOffset + ((Height - 1) * Bitmap->Width) + Width) {
 			for (uint32_t y = 0; y < Height; y++) {
-				memcpy(HdTileData.data() + (y * Width), pngData + bitmapOffset, Width * sizeof(uint32_t));
+				memcpy(tileData + (y * Width), pngData + bitmapOffset, Width * sizeof(uint32_t));
 				bitmapOffset += Bitmap->Width;
 			}
 		}
@@ -416,6 +440,8 @@ struct FallbackTileInfo {
 	int32_t FallbackTileIndex;
 };
 
+struct OggSoundData;
+
 struct BgmTrackInfo {
 	string Filename;
 	uint32_t LoopPosition = 0;
@@ -423,7 +449,21 @@ struct BgmTrackInfo {
 
 struct HdPackData {
 private:
-	bool _cancelLoad = false;
+	std::atomic<bool> _cancelLoad = false;
+
+	SimpleLock _prefetchLock;
+	vector<HdPackBitmapInfo*> _prefetchQueue;
+	AutoResetEvent _prefetchSignal;
+
+	static constexpr uint32_t MaxLoadWorkers = 8;
+
+	void LoadBitmaps(WorkerPool& pool, const vector<HdPackBitmapInfo*>& bitmaps) {
+		pool.Run((uint32_t)bitmaps.size(), [&](uint32_t i) {
+			if (!_cancelLoad) {
+				bitmaps[i]->Init();
+			}
+		});
+	}
 
 public:
 	static constexpr int BgLayerCount = 40;
@@ -437,9 +477,11 @@ public:
 	vector<FallbackTileInfo> FallbackTiles;
 	unordered_set<uint32_t> WatchedMemoryAddresses;
 	unordered_map<HdTileKey, vector<HdPackTileInfo*>> TileByKey;
+	vector<uint32_t> TileAtlas; ///< Pixels of all tiles, in one contiguous buffer (see BuildTileAtlas)
 	unordered_map<string, string> PatchesByHash;
 	unordered_map<int, BgmTrackInfo> BgmFilesById;
 	unordered_map<int, string> SfxFilesById;
+	unordered_map<int, shared_ptr<OggSoundData>> SfxSamplesById; ///< SFX decoded when the pack is loaded
 	vector<uint32_t> Palette;
 
 	bool HasOverscanConfig = false;
@@ -449,29 +491,108 @@ public:
 	uint32_t Version = 0;
 	uint32_t OptionFlags = 0;
 
+	/// <summary>Only decode the tiles' PNG files when they are needed (set before calling LoadAsync)</summary>
+	bool LazyLoadImages = false;
+
 	HdPackData() {}
 	~HdPackData() {}
 
 	HdPackData(const HdPackData&) = delete;
 	HdPackData& operator=(const HdPackData&) = delete;
 
+	/// <summary>
+	/// Decodes the pack's PNG files on a pool of worker threads (blocks until done, or until CancelLoad is called)
+	/// </summary>
+	/// <remarks>
+	/// With LazyLoadImages, only the backgrounds are decoded up front. The tiles' PNG files are decoded when
+	/// PrefetchBitmap is called for them (i.e when a tile that uses them is first seen on screen), and this
+	/// keeps running until CancelLoad is called.
+	/// </remarks>
 	void LoadAsync() {
+		WorkerPool pool(WorkerPool::GetDefaultWorkerCount(HdPackData::MaxLoadWorkers));
+
+		vector<HdPackBitmapInfo*> bitmaps;
 		for (auto& bitmap : BackgroundFileData) {
-			bitmap->Init();
-			if (_cancelLoad) {
-				return;
+			bitmaps.push_back(bitmap.get());
+		}
+		if (!LazyLoadImages) {
+			for (auto& bitmap : ImageFileData) {
+				bitmaps.push_back(bitmap.get());
 			}
 		}
-		for (auto& bitmap : ImageFileData) {
-			bitmap->Init();
-			if (_cancelLoad) {
-				return;
+		LoadBitmaps(pool, bitmaps);
+
+		while (LazyLoadImages && !_cancelLoad) {
+			_prefetchSignal.Wait();
+			{
+				auto lock = _prefetchLock.AcquireSafe();
+				bitmaps.swap(_prefetchQueue);
+				_prefetchQueue.clear();
 			}
+			LoadBitmaps(pool, bitmaps);
+		}
+	}
+
+	/// <summary>Queues a PNG file to be decoded by LoadAsync (when LazyLoadImages is enabled)</summary>
+	void PrefetchBitmap(HdPackBitmapInfo* bitmap) {
+		if (LazyLoadImages && !bitmap->IsLoaded() && bitmap->MarkPrefetchQueued()) {
+			{
+				auto lock = _prefetchLock.AcquireSafe();
+				_prefetchQueue.push_back(bitmap);
+			}
+			_prefetchSignal.Signal();
 		}
 	}
 
 	void CancelLoad() {
 		_cancelLoad = true;
+		_prefetchSignal.Signal();
+	}
+
+	/// <summary>
+	/// Allocates a slot in TileAtlas for each tile that hasn't been initialized yet
+	/// </summary>
+	/// <remarks>
+	/// Tiles that use the same region of the same PNG file share a slot. The tiles' pixels are still
+	/// copied from the PNG files the first time they are used (HdPackTileInfo::Init).
+	/// </remarks>
+	void BuildTileAtlas() {
+		if (!TileAtlas.empty()) {
+			return;
+		}
+
+		struct Region {
+			uint32_t BitmapIndex;
+			uint32_t X;
+			uint32_t Y;
+			bool operator==(const Region& other) const { return BitmapIndex == other.BitmapIndex && X == other.X && Y == other.Y; }
+		};
+		struct RegionHash {
+			size_t operator()(const Region& r) const { return ((size_t)r.BitmapIndex << 40) ^ ((size_t)r.X << 20) ^ r.Y; }
+		};
+
+		unordered_map<Region, size_t, RegionHash> slots;
+		vector<size_t> tileOffsets(Tiles.size(), SIZE_MAX);
+		size_t atlasSize = 0;
+		for (size_t i = 0; i < Tiles.size(); i++) {
+			HdPackTileInfo& tile = *Tiles[i];
+			if (!tile.NeedInit() || tile.Width == 0 || tile.Height == 0) {
+				continue;
+			}
+			auto result = slots.try_emplace(Region{tile.BitmapIndex, tile.X, tile.Y}, atlasSize);
+			if (result.second) {
+				atlasSize += tile.Width * tile.Height;
+			}
+			tileOffsets[i] = result.first->second;
+		}
+
+		// All tiles of a pack have the same size, so shared slots are always large enough
+		TileAtlas.resize(atlasSize);
+		for (size_t i = 0; i < Tiles.size(); i++) {
+			if (tileOffsets[i] != SIZE_MAX) {
+				Tiles[i]->AtlasData = TileAtlas.data() + tileOffsets[i];
+			}
+		}
 	}
 };
 
@@ -3,6 +3,7 @@
 #include <unordered_map>
 #include "NES/HdPacks/HdNesPack.h"
 #include "NES/HdPacks/HdPackLoader.h"
+#include "NES/HdPacks/HdBlend.h"
 #include "NES/NesConsole.h"
 #include "NES/BaseMapper.h"
 #include "NES/NesDefaultVideoFilter.h"
@@ -19,6 +20,7 @@ HdNesPack<scale>::HdNesPack(NesConsole* console, EmuSettings* settings, HdPackDa
 
 	InitializeFallbackTiles();
 	CleanupInvalidRules();
+	_hdData->BuildTileAtlas();
 }
 
 template <uint32_t scale>
@@ -75,29 +77,7 @@ void HdNesPack<scale>::InitializeFallbackTiles() {
 }
 
 template <uint32_t scale>
-template <HdPackBlendMode blendMode>
-void HdNesPack<scale>::BlendColors(uint8_t output[4], uint8_t input[4]) {
-	if constexpr (blendMode == HdPackBlendMode::Alpha) {
-		uint8_t invertedAlpha = 256 - input[3];
-		output[0] = input[0] + (uint8_t)((invertedAlpha * output[0]) >> 8);
-		output[1] = input[1] + (uint8_t)((invertedAlpha * output[1]) >> 8);
-		output[2] = input[2] + (uint8_t)((invertedAlpha * output[2]) >> 8);
-		output[3] = 0xFF;
-	} else if constexpr (blendMode == HdPackBlendMode::Add) {
-		output[0] = (uint8_t)std::min(255, (int)input[0] + (int)output[0]);
-		output[1] = (uint8_t)std::min(255, (int)input[1] + (int)output[1]);
-		output[2] = (uint8_t)std::min(255, (int)input[2] + (int)output[2]);
-		output[3] = 0xFF;
-	} else if constexpr (blendMode == HdPackBlendMode::Subtract) {
-		output[0] = (uint8_t)std::max(0, (int)output[0] - (int)input[0]);
-		output[1] = (uint8_t)std::max(0, (int)output[1] - (int)input[1]);
-		output[2] = (uint8_t)std::max(0, (int)output[2] - (int)input[2]);
-		output[3] = 0xFF;
-	}
-}
-
-template <uint32_t scale>
-uint32_t HdNesPack<scale>::AdjustBrightness(uint8_t input[4], int brightness) {
+uint32_t HdNesPack<scale>::AdjustBrightness(const uint8_t input[4], int brightness) {
 	return (
 	    std::min(255, (brightness * ((int)input[0] + 1)) >> 8) |
 	    (std::min(255, (brightness * ((int)input[1] + 1)) >> 8) << 8) |
@@ -116,7 +96,7 @@ void HdNesPack<scale>::DrawColor(uint32_t color, uint32_t* outputBuffer, uint32_
 		outputBuffer[screenWidth + 1] = color;
 	} else {
 		for (uint32_t i = 0; i < scale; i++) {
-			std::fill(outputBuffer, outputBuffer + scale, color);
+			HdBlend::FillRow(outputBuffer, color, scale);
 			outputBuffer += screenWidth;
 		}
 	}
@@ -130,35 +110,17 @@ void HdNesPack<scale>::DrawCustomBackground(HdBackgroundInfo& bgInfo, uint32_t*
 
 	if (bgInfo.Brightness == 255) {
 		for (uint32_t i = 0; i < scale; i++) {
-			for (uint32_t j = 0; j < scale; j++) {
-				uint32_t pixelColor = pngData[j];
-				if constexpr (blendMode == HdPackBlendMode::Alpha) {
-					if (pixelColor >= 0xFF000000) {
-						outputBuffer[j] = pixelColor;
-					} else if (pixelColor >= 0x01000000) {
-						BlendColors<blendMode>((uint8_t*)(outputBuffer + j), (uint8_t*)(&pixelColor));
-					}
-				} else {
-					BlendColors<blendMode>((uint8_t*)(outputBuffer + j), (uint8_t*)(&pixelColor));
-				}
-			}
+			HdBlend::DrawRow<blendMode>(outputBuffer, pngData, scale);
 			outputBuffer += screenWidth;
 			pngData += width;
 		}
 	} else {
+		uint32_t row[scale];
 		for (uint32_t i = 0; i < scale; i++) {
 			for (uint32_t j = 0; j < scale; j++) {
-				uint32_t pixelColor = AdjustBrightness((uint8_t*)(pngData + j), bgInfo.Brightness);
-				if constexpr (blendMode == HdPackBlendMode::Alpha) {
-					if (pixelColor >= 0xFF000000) {
-						outputBuffer[j] = pixelColor;
-					} else if (pixelColor >= 0x01000000) {
-						BlendColors<blendMode>((uint8_t*)(outputBuffer + j), (uint8_t*)(&pixelColor));
-					}
-				} else {
-					BlendColors<blendMode>((uint8_t*)(outputBuffer + j), (uint8_t*)(&pixelColor));
-				}
+				row[j] = AdjustBrightness((uint8_t*)(pngData + j), bgInfo.Brightness);
 			}
+			HdBlend::DrawRow<blendMode>(outputBuffer, row, scale);
 			outputBuffer += screenWidth;
 			pngData += width;
 		}
@@ -171,7 +133,7 @@ void HdNesPack<scale>::DrawTile(HdPpuTileInfo& tileInfo, HdPackTileInfo& hdPackT
 		return;
 	}
 
-	uint32_t* bitmapData = hdPackTileInfo.HdTileData.data();
+	const uint32_t* bitmapData = hdPackTileInfo.GetTileData();
 	uint32_t tileWidth = 8 * scale;
 	uint8_t tileOffsetX = tileInfo.HorizontalMirroring ? 7 - tileInfo.OffsetX : tileInfo.OffsetX;
 	uint32_t bitmapOffset = (tileInfo.OffsetY * scale) * tileWidth + tileOffsetX * scale;
@@ -187,38 +149,32 @@ void HdNesPack<scale>::DrawTile(HdPpuTileInfo& tileInfo, HdPackTileInfo& hdPackT
 		bitmapLargeInc = (tileInfo.HorizontalMirroring ? (int32_t)scale : -(int32_t)scale) - (int32_t)tileWidth;
 	}
 
-	uint32_t rgbValue;
 	if (hdPackTileInfo.HasTransparentPixels || hdPackTileInfo.Brightness != 255) {
+		uint32_t row[scale];
 		for (uint32_t y = 0; y < scale; y++) {
 			for (uint32_t x = 0; x < scale; x++) {
 				if (hdPackTileInfo.Brightness == 255) {
-					rgbValue = *(bitmapData + bitmapOffset);
-				} else {
-					rgbValue = AdjustBrightness((uint8_t*)(bitmapData + bitmapOffset), hdPackTileInfo.Brightness);
-				}
-
-				if (!hdPackTileInfo.HasTransparentPixels || (bitmapData[bitmapOffset] & 0xFF000000) == 0xFF000000) {
-					*outputBuffer = rgbValue;
+					row[x] = bitmapData[bitmapOffset];
 				} else {
-					if (bitmapData[bitmapOffset] & 0xFF000000) {
-						BlendColors<HdPackBlendMode::Alpha>((uint8_t*)outputBuffer, (uint8_t*)&rgbValue);
-					}
+					row[x] = AdjustBrightness((const uint8_t*)(bitmapData + bitmapOffset), hdPackTileInfo.Brightness);
 				}
-				outputBuffer++;
 				bitmapOffset += bitmapSmallInc;
 			}
+			HdBlend::DrawRow<HdPackBlendMode::Alpha>(outputBuffer, row, scale);
 			bitmapOffset += bitmapLargeInc;
-			outputBuffer += screenWidth - scale;
+			outputBuffer += screenWidth;
 		}
 	} else {
 		for (uint32_t y = 0; y < scale; y++) {
-			for (uint32_t x = 0; x < scale; x++) {
-				*outputBuffer = *(bitmapData + bitmapOffset);
-				outputBuffer++;
-				bitmapOffset += bitmapSmallInc;
+			if (bitmapSmallInc == 1) {
+				memcpy(outputBuffer, bitmapData + bitmapOffset, scale * sizeof(uint32_t));
+			} else {
+				for (uint32_t x = 0; x < scale; x++) {
+					outputBuffer[x] = bitmapData[bitmapOffset - x];
+				}
 			}
-			bitmapOffset += bitmapLargeInc;
-			outputBuffer += screenWidth - scale;
+			bitmapOffset += bitmapSmallInc * (int32_t)scale + bitmapLargeInc;
+			outputBuffer += screenWidth;
 		}
 	}
 }
@@ -421,35 +377,71 @@ HdPackTileInfo* HdNesPack<scale>::GetCachedMatchingTile(uint32_t x, uint32_t y,
 }
 
 template <uint32_t scale>
-HdPackTileInfo* HdNesPack<scale>::GetMatchingTile(uint32_t x, uint32_t y, HdPpuTileInfo* tile, bool* disableCache) {
-	auto hdTile = _hdData->TileByKey.find(*tile);
+const typename HdNesPack<scale>::HdTileMatch& HdNesPack<scale>::FindTileMatch(HdPpuTileInfo* tile) {
+	// The same tiles are drawn on every frame, only do the key lookups (and fallback tile checks) once per tile
+	HdTileKey key = tile->GetKey(false);
+	auto cachedMatch = _tileMatches.find(key);
+	if (cachedMatch != _tileMatches.end()) {
+		return cachedMatch->second;
+	}
+
+	if (_tileMatches.size() >= HdNesPack::MaxTileMatches) {
+		// e.g CHR RAM games that keep generating new tile data
+		_tileMatches.clear();
+	}
+
+	HdTileMatch match;
+	auto hdTile = _hdData->TileByKey.find(key);
 	if (hdTile == _hdData->TileByKey.end()) {
-		int32_t fallbackTileIndex = GetFallbackTile(tile->TileIndex);
+		int32_t fallbackTileIndex = GetFallbackTile(key.TileIndex);
 		if (fallbackTileIndex >= 0) {
-			int32_t orgIndex = tile->TileIndex;
-			tile->TileIndex = fallbackTileIndex;
-			hdTile = _hdData->TileByKey.find(*tile);
+			HdTileKey fallbackKey = key;
+			fallbackKey.TileIndex = fallbackTileIndex;
+			hdTile = _hdData->TileByKey.find(fallbackKey);
 			if (hdTile == _hdData->TileByKey.end()) {
-				hdTile = _hdData->TileByKey.find(tile->GetKey(true));
-				if (hdTile == _hdData->TileByKey.end()) {
-					tile->TileIndex = orgIndex;
-				}
+				hdTile = _hdData->TileByKey.find(fallbackKey.GetKey(true));
+			}
+			if (hdTile != _hdData->TileByKey.end()) {
+				match.FallbackTileIndex = fallbackTileIndex;
 			}
 		}
 
 		if (hdTile == _hdData->TileByKey.end()) {
-			hdTile = _hdData->TileByKey.find(tile->GetKey(true));
+			hdTile = _hdData->TileByKey.find(key.GetKey(true));
 		}
 	}
 
 	if (hdTile != _hdData->TileByKey.end()) {
+		match.Candidates = &hdTile->second;
+
+		// With lazy loading, start decoding the PNG files of all the tile's variants (for all conditions)
 		for (HdPackTileInfo* hdPackTile : hdTile->second) {
+			_hdData->PrefetchBitmap(hdPackTile->Bitmap);
+		}
+	}
+	return _tileMatches[key] = match;
+}
+
+template <uint32_t scale>
+HdPackTileInfo* HdNesPack<scale>::GetMatchingTile(uint32_t x, uint32_t y, HdPpuTileInfo* tile, bool* disableCache) {
+	const HdTileMatch& match = FindTileMatch(tile);
+	if (match.FallbackTileIndex >= 0) {
+		tile->TileIndex = match.FallbackTileIndex;
+	}
+
+	if (match.Candidates) {
+		for (HdPackTileInfo* hdPackTile : *match.Candidates) {
 			if (disableCache != nullptr && hdPackTile->ForceDisableCache) {
 				*disableCache = true;
 			}
 
 			if (hdPackTile->MatchesCondition(x, y, tile)) {
 				if (hdPackTile->NeedInit()) {
+					if (_hdData->LazyLoadImages && !hdPackTile->Bitmap->IsLoaded()) {
+						// Draw the original tile until the PNG file is decoded, instead of pausing rendering
+						_hdData->PrefetchBitmap(hdPackTile->Bitmap);
+						return nullptr;
+					}
 					hdPackTile->Init();
 				}
 				return hdPackTile;
@@ -42,6 +42,20 @@ private:
 		int16_t BgMaxX = -1;
 	};
 
+	/// <summary>Result of the tile key lookups for a given tile (conditions are still checked for every pixel)</summary>
+	struct HdTileMatch {
+		vector<HdPackTileInfo*>* Candidates = nullptr;
+		int32_t FallbackTileIndex = -1; ///< Tile index to use instead of the tile's own index (fallback tile was matched)
+	};
+
+	/// <summary>Also compares the tile index for CHR RAM tiles, since the fallback tiles depend on it</summary>
+	struct HdTileMatchKeyEqual {
+		bool operator()(const HdTileKey& a, const HdTileKey& b) const {
+			return a == b && a.TileIndex == b.TileIndex;
+		}
+	};
+
+	static constexpr size_t MaxTileMatches = 0x10000;
 	static constexpr uint8_t PriorityLevelsPerLayer = 10;
 	static constexpr uint8_t BehindBgSpritesPriority = 0 * PriorityLevelsPerLayer;
 	static constexpr uint8_t BehindBgPriority = 1 * PriorityLevelsPerLayer;
@@ -62,15 +76,14 @@ private:
 	int32_t _scrollX = 0;
 
 	unordered_map<HdTileKey, vector<HdPackAdditionalSpriteInfo>> _additionalTilesByKey;
+	unordered_map<HdTileKey, HdTileMatch, std::hash<HdTileKey>, HdTileMatchKeyEqual> _tileMatches;
 
-	template <HdPackBlendMode blendMode>
-	__forceinline void BlendColors(uint8_t output[4], uint8_t input[4]);
-
-	__forceinline uint32_t AdjustBrightness(uint8_t input[4], int brightness);
+	__forceinline uint32_t AdjustBrightness(const uint8_t input[4], int brightness);
 	__forceinline void DrawColor(uint32_t color, uint32_t* outputBuffer, uint32_t screenWidth);
 	__forceinline void DrawTile(HdPpuTileInfo& tileInfo, HdPackTileInfo& hdPackTileInfo, uint32_t* outputBuffer, uint32_t screenWidth);
 
 	__forceinline HdPackTileInfo* GetCachedMatchingTile(uint32_t x, uint32_t y, HdPpuTileInfo* tile);
+	__forceinline const HdTileMatch& FindTileMatch(HdPpuTileInfo* tile);
 	__forceinline HdPackTileInfo* GetMatchingTile(uint32_t x, uint32_t y, HdPpuTileInfo* tile, bool* disableCache = nullptr);
 
 	__forceinline void DrawBackgroundLayer(uint8_t priority, uint32_t x, uint32_t y, uint32_t* outputBuffer, uint32_t screenWidth);
@@ -38,8 +38,8 @@ public:
 
 	void* OnBeforeSendFrame();
 
-	__forceinline bool RemoveSpriteLimit() { return _forceRemoveSpriteLimit || _console->GetNesConfig().RemoveSpriteLimit; }
-	__forceinline bool UseAdaptiveSpriteLimit() { return _forceRemoveSpriteLimit || _console->GetNesConfig().AdaptiveSpriteLimit; }
+	__forceinline bool RemoveSpriteLimit() { return _forceRemoveSpriteLimit || _nesCfg->RemoveSpriteLimit; }
+	__forceinline bool UseAdaptiveSpriteLimit() { return _forceRemoveSpriteLimit || _nesCfg->AdaptiveSpriteLimit; }
 
 	__forceinline void StoreSpriteInformation(bool verticalMirror, uint16_t tileAddr, uint8_t lineOffset) {
 		NesSpriteInfoEx& info = _exSpriteInfo[_spriteIndex];
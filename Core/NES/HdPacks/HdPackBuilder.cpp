@@ -51,9 +51,46 @@ HdPackBuilder::HdPackBuilder(Emulator* emu, PpuModel ppuModel, bool isChrRam, Hd
 	}
 
 	_romName = FolderUtilities::GetFilename(_emu->GetRomInfo().RomFile.GetFileName(), false);
+
+	_workerThread = std::make_unique<std::thread>(&HdPackBuilder::WorkerThread, this);
 }
 
 HdPackBuilder::~HdPackBuilder() {
+	// The worker processes the remaining records and saves the pack before exiting
+	FlushPendingRecords();
+	_stopWorker = true;
+	_recordsAvailable.Signal();
+	_workerThread->join();
+}
+
+void HdPackBuilder::PushRecord(const HdTileRecord& record) {
+	while (!_records.TryPush(record)) [[unlikely]] {
+		// Worker is behind, wait for it to make room
+		_recordsAvailable.Signal();
+		std::this_thread::yield();
+	}
+}
+
+void HdPackBuilder::FlushPendingRecords() {
+	for (HdTileRecord& record : _pendingRecords) {
+		if (record.UsageCount) {
+			PushRecord(record);
+			record.UsageCount = 0;
+		}
+	}
+	_callsSinceFlush = 0;
+	_recordsAvailable.Signal();
+}
+
+void HdPackBuilder::WorkerThread() {
+	auto processRecord = [this](HdTileRecord& record) { ProcessRecord(record); };
+	while (!_stopWorker) {
+		_recordsAvailable.Wait();
+		_records.Consume(processRecord);
+	}
+
+	// Records pushed before the stop request
+	_records.Consume(processRecord);
 	SaveHdPack();
 }
 
@@ -107,30 +144,55 @@ void HdPackBuilder::ProcessTile(uint32_t x, uint32_t y, uint16_t tileAddr, HdPpu
 		}
 	}
 
-	auto result = _tileUsageCount.find(tile.GetKey(false));
+	// Consecutive pixels usually use the same tile, merge them into a single record
+	HdTileKey key = tile.GetKey(false);
+	HdTileRecord& record = _pendingRecords[key.GetHashCode() & (HdPackBuilder::PendingRecordCount - 1)];
+	if (record.UsageCount && record.Key == key) {
+		if (record.UsageCount < 0x7FFFFFFF) {
+			record.UsageCount++;
+		}
+		record.TransparencyRequired |= transparencyRequired;
+	} else {
+		if (record.UsageCount) {
+			PushRecord(record);
+		}
+		record.Key = key;
+		record.ChrBankId = _isChrRam ? chrBankHash : (tileAddr / 16 / 256);
+		record.UsageCount = 1;
+		record.TransparencyRequired = transparencyRequired;
+	}
+
+	if (++_callsSinceFlush >= HdPackBuilder::FlushInterval) {
+		FlushPendingRecords();
+	}
+}
+
+void HdPackBuilder::ProcessRecord(const HdTileRecord& record) {
+	HdTileKey key = record.Key;
+	auto result = _tileUsageCount.find(key);
 	if (result == _tileUsageCount.end()) {
 		// Check to see if a default tile matches
-		result = _tileUsageCount.find(tile.GetKey(true));
+		result = _tileUsageCount.find(key.GetKey(true));
 	}
 
 	if (result == _tileUsageCount.end()) {
 		// First time seeing this tile/palette combination, store it
 		HdPackTileInfo* hdTile = new HdPackTileInfo();
-		hdTile->PaletteColors = tile.PaletteColors;
-		hdTile->TileIndex = tile.TileIndex;
+		hdTile->PaletteColors = key.PaletteColors;
+		hdTile->TileIndex = key.TileIndex;
 		hdTile->DefaultTile = false;
 		hdTile->IsChrRamTile = _isChrRam;
 		hdTile->Brightness = 255;
-		hdTile->ChrBankId = _isChrRam ? chrBankHash : (tileAddr / 16 / 256);
-		hdTile->TransparencyRequired = transparencyRequired;
+		hdTile->ChrBankId = record.ChrBankId;
+		hdTile->TransparencyRequired = record.TransparencyRequired;
 
-		memcpy(hdTile->TileData, tile.TileData, 16);
+		memcpy(hdTile->TileData, key.TileData, 16);
 
 		_hdData.Tiles.push_back(unique_ptr<HdPackTileInfo>(hdTile));
-		AddTile(hdTile, 1);
+		AddTile(hdTile, record.UsageCount);
 	} else {
-		if (transparencyRequired) {
-			auto existingTile = _tilesByKey.find(tile.GetKey(false));
+		if (record.TransparencyRequired) {
+			auto existingTile = _tilesByKey.find(key);
 			if (existingTile != _tilesByKey.end()) {
 				existingTile->second->TransparencyRequired = true;
 			}
@@ -138,7 +200,7 @@ void HdPackBuilder::ProcessTile(uint32_t x, uint32_t y, uint16_t tileAddr, HdPpu
 
 		if (result->second < 0x7FFFFFFF) {
 			// Increase usage count
-			result->second++;
+			result->second = (uint32_t)std::min<uint64_t>((uint64_t)result->second + record.UsageCount, 0x7FFFFFFF);
 		}
 	}
 }
@@ -3,7 +3,10 @@
 #include "NES/HdPacks/HdData.h"
 #include "NES/NesTypes.h"
 #include "Shared/SettingTypes.h"
+#include "Utilities/AutoResetEvent.h"
+#include <atomic>
 #include <map>
+#include <thread>
 
 class Emulator;
 class BaseMapper;
@@ -20,10 +23,84 @@ struct HdPackBuilderOptions {
 	bool IgnoreOverscan;
 };
 
+/// <summary>
+/// Tile/palette combination seen by the PPU, with the number of pixels it was seen on since the previous record
+/// </summary>
+struct HdTileRecord {
+	HdTileKey Key;
+	uint32_t ChrBankId = 0;
+	uint32_t UsageCount = 0; ///< 0 = unused slot
+	bool TransparencyRequired = false;
+};
+
+/// <summary>
+/// Lock-free single-producer/single-consumer queue of tile records (same layout as ProfilerEventQueue).
+/// </summary>
+class HdTileRecordQueue {
+public:
+	static constexpr uint32_t Capacity = 0x4000;
+
+private:
+	static constexpr uint32_t Mask = Capacity - 1;
+
+	unique_ptr<HdTileRecord[]> _records = std::make_unique<HdTileRecord[]>(HdTileRecordQueue::Capacity);
+
+	// Separate cache lines, each is written by a different thread
+	alignas(64) std::atomic<uint32_t> _writePos{0};
+	alignas(64) std::atomic<uint32_t> _readPos{0};
+
+public:
+	/// <summary>Producer: appends a record, returns false if the queue is full</summary>
+	__forceinline bool TryPush(const HdTileRecord& record) {
+		uint32_t writePos = _writePos.load(std::memory_order_relaxed);
+		if (writePos - _readPos.load(std::memory_order_acquire) > HdTileRecordQueue::Mask) [[unlikely]] {
+			return false;
+		}
+		_records[writePos & HdTileRecordQueue::Mask] = record;
+		_writePos.store(writePos + 1, std::memory_order_release);
+		return true;
+	}
+
+	/// <summary>Consumer: calls process(record) for every record available, in order, returns the number of records consumed</summary>
+	template <typename T>
+	uint32_t Consume(T&& process) {
+		uint32_t readPos = _readPos.load(std::memory_order_relaxed);
+		uint32_t writePos = _writePos.load(std::memory_order_acquire);
+		for (uint32_t pos = readPos; pos != writePos; pos++) {
+			process(_records[pos & HdTileRecordQueue::Mask]);
+		}
+		_readPos.store(writePos, std::memory_order_release);
+		return writePos - readPos;
+	}
+};
+
+/// <summary>
+/// Records the tiles drawn by the PPU (HdBuilderPpu) and saves them as an HD pack.
+/// </summary>
+/// <remarks>
+/// ProcessTile is called for every pixel on the emulation thread, and only merges consecutive calls for the
+/// same tile in a small direct-mapped table. Evicted table entries are sent to a worker thread through a
+/// lock-free queue, and the worker does the bookkeeping (deduplication, usage counts, PNG sheet layout).
+/// When recording stops, the worker composes and writes the PNG files and hires.txt.
+/// </remarks>
 class HdPackBuilder {
 private:
+	static constexpr uint32_t PendingRecordCount = 512;
+	static constexpr uint32_t FlushInterval = 0x4000; ///< ProcessTile calls between 2 flushes of the pending records
+
 	Emulator* _emu = nullptr;
 
+	// Emulation thread
+	HdTileRecord _pendingRecords[HdPackBuilder::PendingRecordCount] = {};
+	uint32_t _callsSinceFlush = 0;
+
+	HdTileRecordQueue _records;
+	AutoResetEvent _recordsAvailable;
+	std::atomic<bool> _stopWorker = false;
+	unique_ptr<std::thread> _workerThread;
+
+	// Worker thread (or the constructor, before the worker starts)
+
 	HdPackData _hdData;
 	unordered_map<HdTileKey, uint32_t> _tileUsageCount;
 	unordered_map<HdTileKey, HdPackTileInfo*> _tilesByKey;
@@ -38,6 +115,11 @@ private:
 	uint32_t _blankTileIndex = 0;
 	int _blankTilePalette = 0;
 
+	void PushRecord(const HdTileRecord& record);
+	void FlushPendingRecords();
+	void WorkerThread();
+	void ProcessRecord(const HdTileRecord& record);
+
 	void AddTile(HdPackTileInfo* tile, uint32_t usageCount);
 	void GenerateHdTile(HdPackTileInfo* tile);
 	void DrawTile(HdPackTileInfo* tile, int tileIndex, uint32_t* pngBuffer, int pageNumber, bool containsSpritesOnly);
@@ -47,6 +129,8 @@ public:
 	~HdPackBuilder();
 
 	void ProcessTile(uint32_t x, uint32_t y, uint16_t tileAddr, HdPpuTileInfo& tile, BaseMapper* mapper, bool isSprite, uint32_t chrBankHash, bool transparencyRequired);
+
+	/// <summary>Writes the PNG files and hires.txt (worker thread, once all records are processed)</summary>
 	void SaveHdPack();
 
 	// static void GetChrBankList(uint32_t *banks);
@@ -6,6 +6,7 @@
 #include "NES/HdPacks/HdPackLoader.h"
 #include "NES/HdPacks/HdPackConditions.h"
 #include "NES/HdPacks/HdNesPack.h"
+#include "NES/HdPacks/OggReader.h"
 #include "NES/NesConsole.h"
 #include "Shared/MessageManager.h"
 #include "Utilities/ZipReader.h"
@@ -777,6 +778,12 @@ void HdPackLoader::ProcessSfxTag(vector<string>& tokens) {
 		} else {
 			_data->SfxFilesById[trackId] = FolderUtilities::CombinePath(_hdPackFolder, tokens[2]);
 		}
+
+		// Decode short sound effects now, so playing them doesn't need to read/decode the file
+		shared_ptr<OggSoundData> sound = OggReader::Decode(_data->SfxFilesById[trackId], HdPackLoader::MaxPreloadedSfxLength);
+		if (sound) {
+			_data->SfxSamplesById[trackId] = sound;
+		}
 	}
 }
 
@@ -12,6 +12,8 @@ public:
 	static bool LoadHdNesPack(VirtualFile& romFile, HdPackData& outData);
 
 private:
+	static constexpr uint32_t MaxPreloadedSfxLength = 10; ///< In seconds, longer SFX are streamed from the file when played
+
 	HdPackData* _data = nullptr;
 	bool _loadFromZip = false;
 	int _currentLine = 0;
@@ -82,6 +82,12 @@ bool OggMixer::Play(const string& filename, bool isSfx, uint32_t startOffset, ui
 	return false;
 }
 
+void OggMixer::PlaySfx(shared_ptr<const OggSoundData> sound) {
+	shared_ptr<OggReader> reader(new OggReader());
+	reader->Init(sound, _sampleRate);
+	_sfx.push_back(reader);
+}
+
 int OggMixer::GetBgmOffset() {
 	if (_bgm) {
 		return _bgm->GetOffset();
@@ -3,6 +3,7 @@
 #include "Shared/Interfaces/IAudioProvider.h"
 
 class OggReader;
+struct OggSoundData;
 
 class OggMixer : public IAudioProvider {
 private:
@@ -23,6 +24,8 @@ public:
 
 	void Reset(uint32_t sampleRate);
 	[[nodiscard]] bool Play(const string& filename, bool isSfx, uint32_t startOffset, uint32_t loopPosition);
+	/// <summary>Play an already decoded sound effect</summary>
+	void PlaySfx(shared_ptr<const OggSoundData> sound);
 	void SetPlaybackOptions(uint8_t options);
 	void SetPausedFlag(bool paused);
 	void StopBgm();
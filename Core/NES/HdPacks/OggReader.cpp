@@ -9,35 +9,138 @@ OggReader::OggReader() {
 }
 
 OggReader::~OggReader() {
+	if (_decodeThread.joinable()) {
+		{
+			std::lock_guard<std::mutex> lock(_decodeLock);
+			_stopDecoder = true;
+		}
+		_decodeSignal.notify_one();
+		_decodeThread.join();
+	}
+
 	if (_vorbis) {
 		stb_vorbis_close(_vorbis);
 	}
 }
 
-bool OggReader::Init(const string& filename, bool loop, uint32_t sampleRate, uint32_t startOffset, uint32_t loopPosition) {
+bool OggReader::Open(const string& filename) {
 	int error;
 	VirtualFile file = filename;
 	_fileData = vector<uint8_t>(100000);
 	if (file.ReadFile(_fileData)) {
 		_vorbis = stb_vorbis_open_memory(_fileData.data(), (int)_fileData.size(), &error, nullptr);
 		if (_vorbis) {
-			_loop = loop;
-			if (loopPosition > 0) {
-				unsigned int sampleCount = stb_vorbis_stream_length_in_samples(_vorbis);
-				_loopPosition = loopPosition < sampleCount ? loopPosition : 0;
-			} else {
-				_loopPosition = 0;
-			}
 			_oggSampleRate = stb_vorbis_get_info(_vorbis).sample_rate;
-			if (startOffset > 0) {
-				stb_vorbis_seek(_vorbis, startOffset);
-			}
 			return true;
 		}
 	}
 	return false;
 }
 
+shared_ptr<OggSoundData> OggReader::Decode(const string& filename, uint32_t maxLength) {
+	OggReader reader;
+	if (!reader.Open(filename)) {
+		return nullptr;
+	}
+
+	uint32_t length = stb_vorbis_stream_length_in_samples(reader._vorbis);
+	if (length == 0 || length > maxLength * (uint32_t)reader._oggSampleRate) {
+		return nullptr;
+	}
+
+	shared_ptr<OggSoundData> sound = std::make_shared<OggSoundData>();
+	sound->SampleRate = reader._oggSampleRate;
+	sound->Samples.resize(length * 2);
+	uint32_t samplesLoaded = (uint32_t)stb_vorbis_get_samples_short_interleaved(reader._vorbis, 2, sound->Samples.data(), (int)sound->Samples.size());
+	sound->Samples.resize(samplesLoaded * 2);
+	return sound;
+}
+
+bool OggReader::Init(const string& filename, bool loop, uint32_t sampleRate, uint32_t startOffset, uint32_t loopPosition) {
+	if (!Open(filename)) {
+		return false;
+	}
+
+	_loop = loop;
+	if (loopPosition > 0) {
+		unsigned int sampleCount = stb_vorbis_stream_length_in_samples(_vorbis);
+		_loopPosition = loopPosition < sampleCount ? loopPosition : 0;
+	} else {
+		_loopPosition = 0;
+	}
+
+	// Keep ~0.5 seconds of decoded audio ahead of playback
+	_readAhead.Reset(_oggSampleRate * 2);
+	_decodeThread = std::thread(&OggReader::DecodeLoop, this, startOffset);
+	return true;
+}
+
+bool OggReader::Init(shared_ptr<const OggSoundData> sound, uint32_t sampleRate) {
+	_sound = sound;
+	_soundPos = 0;
+	_oggSampleRate = sound->SampleRate;
+	return true;
+}
+
+void OggReader::DecodeLoop(uint32_t startOffset) {
+	if (startOffset > 0) {
+		stb_vorbis_seek(_vorbis, startOffset);
+	}
+
+	constexpr uint32_t chunkBytes = DecodeChunkSize * 2 * sizeof(int16_t);
+	int16_t chunk[DecodeChunkSize * 2];
+	bool restarted = false;
+
+	while (!_stopDecoder) {
+		if (_readAhead.GetCapacity() - _readAhead.GetFillLevel() < chunkBytes) {
+			// Read-ahead buffer is full, wait for playback to consume some of it
+			std::unique_lock<std::mutex> lock(_decodeLock);
+			_decodeSignal.wait_for(lock, std::chrono::milliseconds(10), [this]() {
+				return _stopDecoder || _readAhead.GetCapacity() - _readAhead.GetFillLevel() >= chunkBytes;
+			});
+			continue;
+		}
+
+		uint32_t samplesLoaded = (uint32_t)stb_vorbis_get_samples_short_interleaved(_vorbis, 2, chunk, DecodeChunkSize * 2);
+		if (samplesLoaded == 0) {
+			// Reached the end of the file (a loop point that gives nothing back also ends the track)
+			if (_loop && !restarted) {
+				stb_vorbis_seek(_vorbis, _loopPosition);
+				restarted = true;
+				continue;
+			}
+			_decodeDone = true;
+			break;
+		}
+
+		restarted = false;
+		_readAhead.Write((uint8_t*)chunk, samplesLoaded * 2 * sizeof(int16_t));
+		_fileOffset = stb_vorbis_get_file_offset(_vorbis);
+	}
+}
+
+uint32_t OggReader::ReadSamples(int16_t* out, uint32_t sampleCount) {
+	if (_sound) {
+		uint32_t samplesLoaded = std::min(sampleCount, (uint32_t)_sound->Samples.size() / 2 - _soundPos);
+		std::copy(_sound->Samples.begin() + _soundPos * 2, _sound->Samples.begin() + (_soundPos + samplesLoaded) * 2, out);
+		_soundPos += samplesLoaded;
+		if (samplesLoaded < sampleCount) {
+			_done = true;
+		}
+		return samplesLoaded;
+	}
+
+	// Check the decoder flag first, so no samples can be written after the buffer was read
+	bool decodeDone = _decodeDone;
+	uint32_t samplesLoaded = _readAhead.Read((uint8_t*)out, sampleCount * 2 * sizeof(int16_t)) / (2 * sizeof(int16_t));
+	_decodeSignal.notify_one();
+
+	if (samplesLoaded < sampleCount && decodeDone) {
+		_done = true;
+	}
+	return samplesLoaded;
+}
+
 bool OggReader::IsPlaybackOver() {
 	return _done;
 }
@@ -57,15 +160,7 @@ void OggReader::ApplySamples(int16_t* buffer, size_t sampleCount, uint8_t volume
 	uint32_t samplesRead = 0;
 	if (samplesNeeded > 0) {
 		uint32_t samplesToLoad = samplesNeeded * _oggSampleRate / _sampleRate + 2;
-		uint32_t samplesLoaded = (uint32_t)stb_vorbis_get_samples_short_interleaved(_vorbis, 2, _oggBuffer.get(), samplesToLoad * 2);
-		if (samplesLoaded < samplesToLoad) {
-			if (_loop) {
-				stb_vorbis_seek(_vorbis, _loopPosition);
-				samplesLoaded += stb_vorbis_get_samples_short_interleaved(_vorbis, 2, _oggBuffer.get() + samplesLoaded * 2, (samplesToLoad - samplesLoaded) * 2);
-			} else {
-				_done = true;
-			}
-		}
+		uint32_t samplesLoaded = ReadSamples(_oggBuffer.get(), samplesToLoad);
 		_resampler.SetSampleRates(_oggSampleRate, _sampleRate);
 		samplesRead = _resampler.Resample<false>(_oggBuffer.get(), samplesLoaded, _outputBuffer.get(), sampleCount);
 	}
@@ -77,5 +172,5 @@ void OggReader::ApplySamples(int16_t* buffer, size_t sampleCount, uint8_t volume
 }
 
 uint32_t OggReader::GetOffset() {
-	return stb_vorbis_get_file_offset(_vorbis);
+	return _sound ? _soundPos : _fileOffset.load();
 }
@@ -1,20 +1,57 @@
 #pragma once
 #include "pch.h"
+#include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include "Utilities/VirtualFile.h"
 #include "Utilities/Audio/HermiteResampler.h"
+#include "Shared/Audio/AudioRingBuffer.h"
 
 struct stb_vorbis;
 
+/// <summary>Fully decoded (stereo, interleaved) sound, shared between all readers playing it</summary>
+struct OggSoundData {
+	vector<int16_t> Samples;
+	uint32_t SampleRate = 0;
+};
+
+/// <summary>
+/// Plays an ogg file, mixed into the output by ApplySamples().
+/// </summary>
+/// <remarks>
+/// Streamed files are decoded by a worker thread into a read-ahead ring buffer, so starting
+/// (or seeking in) a track never blocks the emulation thread on vorbis decoding. If the
+/// worker falls behind, the missing samples are simply skipped for that mix call.
+/// Short sounds (SFX) can instead be decoded once up front and played from memory.
+/// </remarks>
 class OggReader {
 private:
+	static constexpr uint32_t DecodeChunkSize = 1024; // Sample pairs decoded per worker iteration
+
 	stb_vorbis* _vorbis = nullptr;
+	vector<uint8_t> _fileData;
+
 	std::unique_ptr<int16_t[]> _outputBuffer;
 	std::unique_ptr<int16_t[]> _oggBuffer;
 
 	HermiteResampler _resampler;
 
-	bool _loop = false;
+	// Streaming: decoded by _decodeThread (producer), consumed by ApplySamples
+	AudioRingBuffer _readAhead;
+	std::thread _decodeThread;
+	std::mutex _decodeLock;
+	std::condition_variable _decodeSignal;
+	std::atomic<bool> _stopDecoder{false};
+	std::atomic<bool> _decodeDone{false};
+	std::atomic<uint32_t> _fileOffset{0};
+
+	// Pre-decoded sound
+	shared_ptr<const OggSoundData> _sound;
+	uint32_t _soundPos = 0;
+
+	std::atomic<bool> _loop{false};
 	bool _done = false;
 
 	uint32_t _loopPosition = 0;
@@ -22,13 +59,22 @@ private:
 	int _sampleRate = 0;
 	int _oggSampleRate = 0;
 
-	vector<uint8_t> _fileData;
+	bool Open(const string& filename);
+	void DecodeLoop(uint32_t startOffset);
+	uint32_t ReadSamples(int16_t* out, uint32_t sampleCount);
 
 public:
 	OggReader();
 	~OggReader();
 
+	/// <summary>Decode the whole file in memory</summary>
+	/// <param name="filename">Ogg file to decode</param>
+	/// <param name="maxLength">Max length in seconds, longer files are not decoded</param>
+	/// <returns>The decoded sound, or nullptr on error or if the file is too long</returns>
+	static shared_ptr<OggSoundData> Decode(const string& filename, uint32_t maxLength);
+
 	bool Init(const string& filename, bool loop, uint32_t sampleRate, uint32_t startOffset = 0, uint32_t loopPosition = 0);
+	bool Init(shared_ptr<const OggSoundData> sound, uint32_t sampleRate);
 	bool IsPlaybackOver();
 	void SetSampleRate(int sampleRate);
 	void SetLoopFlag(bool loop);
@@ -29,8 +29,8 @@ protected:
 	}
 
 	void InitBarcodeStream() {
-		vector<uint8_t> state = GetRawState().State;
-		string barcodeText(state.begin(), state.end());
+		ControlDeviceState state = GetRawState();
+		string barcodeText(state.State.begin(), state.State.end());
 
 		// Signature at the end, needed for code to be recognized
 		barcodeText += "EPOCH\xD\xA";
@@ -218,6 +218,7 @@ void NesConsole::LoadHdPack(VirtualFile& romFile) {
 
 			shared_ptr<HdPackData> data = _hdData.lock();
 			if (data) {
+				data->LazyLoadImages = GetNesConfig().HdPackLazyLoading;
 				thread asyncLoadData([data]() {
 					data->LoadAsync();
 				});
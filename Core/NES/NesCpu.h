@@ -66,8 +66,8 @@ private:
 	uint8_t _endClockCount;       ///< Cycles at instruction end
 	uint16_t _operand;            ///< Current instruction operand address
 
-	Func _opTable[256];                ///< Opcode handler table (all 256 opcodes)
-	NesAddrMode _addrMode[256];        ///< Addressing mode per opcode
+	static Func const _opTable[256];         ///< Opcode handler table (all 256 opcodes)
+	static NesAddrMode const _addrMode[256]; ///< Addressing mode per opcode
 	NesAddrMode _instAddrMode;         ///< Current instruction's addressing mode
 
 	// DMA state
@@ -101,6 +101,7 @@ private:
 	// Cycle-accurate execution helpers
 	__forceinline void StartCpuCycle(bool forRead);
 	__forceinline void ProcessPendingDma(uint16_t readAddress, MemoryOperationType opType);
+	__noinline void RunPendingDma(uint16_t readAddress, MemoryOperationType opType);
 	uint8_t ProcessDmaRead(uint16_t addr, uint16_t& prevReadAddress, bool enableInternalRegReads, bool isNesBehavior);
 	__forceinline uint16_t FetchOperand();
 	__forceinline void EndCpuCycle(bool forRead);
@@ -830,6 +831,12 @@ public:
 	uint32_t GetOperationCount();
 	void LogMemoryOperation(uint32_t addr, uint8_t value, MemoryOperationType type);
 	MemoryOperationInfo GetOperationInfo(uint32_t index);
+
+	/// <summary>
+	/// Number of operand bytes fetched by an opcode (ExecOperand reads at PC+1 and PC+2).
+	/// </summary>
+	/// <returns>-1 if the instruction handles its own fetches (Other/None addressing modes)</returns>
+	static int GetOperandFetchCount(uint8_t opCode);
 #else
 	friend DummyNesCpu;
 #endif
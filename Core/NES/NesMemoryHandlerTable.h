@@ -0,0 +1,78 @@
+#pragma once
+#include "pch.h"
+#include <memory>
+#include "NES/INesMemoryHandler.h"
+
+/// <summary>
+/// Maps each CPU address to the INesMemoryHandler that responds to it, at 256-byte page granularity.
+/// </summary>
+/// <remarks>
+/// Most pages belong to a single handler (internal RAM, PPU registers, the mapper's PRG space), so they
+/// only need one pointer. Pages shared by several handlers (e.g. $4000-$40FF: APU, controllers and
+/// expansion devices) get a per-address table, allocated when the page is first split and freed by
+/// Compact() once it belongs to a single handler again.
+///
+/// Lookups are cheap enough for every CPU access: one load for a whole page, two for a split one.
+/// Set() and Compact() are only meant for (un)registering devices.
+/// </remarks>
+class NesMemoryHandlerTable {
+private:
+	/// <summary>Handler of each page, nullptr when the page is split</summary>
+	INesMemoryHandler* _pages[0x100] = {};
+
+	/// <summary>Per-address handlers of the split pages</summary>
+	std::unique_ptr<INesMemoryHandler*[]> _splitPages[0x100];
+
+public:
+	/// <summary>Maps the whole address space to a single handler</summary>
+	void Reset(INesMemoryHandler* handler) {
+		for (int i = 0; i < 0x100; i++) {
+			_pages[i] = handler;
+			_splitPages[i].reset();
+		}
+	}
+
+	/// <summary>Handler for the address</summary>
+	[[nodiscard]] __forceinline INesMemoryHandler* Get(uint16_t addr) const {
+		INesMemoryHandler* handler = _pages[addr >> 8];
+		return handler ? handler : _splitPages[addr >> 8][(uint8_t)addr];
+	}
+
+	/// <summary>Handler for the whole page, nullptr when the page is split between several handlers</summary>
+	[[nodiscard]] __forceinline INesMemoryHandler* GetPageHandler(uint8_t page) const { return _pages[page]; }
+
+	void Set(uint16_t addr, INesMemoryHandler* handler) {
+		uint8_t page = addr >> 8;
+		if (_pages[page]) {
+			if (_pages[page] == handler) {
+				return;
+			}
+
+			// Split the page
+			_splitPages[page] = std::make_unique<INesMemoryHandler*[]>(0x100);
+			std::fill(_splitPages[page].get(), _splitPages[page].get() + 0x100, _pages[page]);
+			_pages[page] = nullptr;
+		}
+		_splitPages[page][(uint8_t)addr] = handler;
+	}
+
+	/// <summary>Merges back the split pages that now belong to a single handler</summary>
+	void Compact() {
+		for (int i = 0; i < 0x100; i++) {
+			if (_pages[i]) {
+				continue;
+			}
+
+			INesMemoryHandler** handlers = _splitPages[i].get();
+			if (std::all_of(handlers, handlers + 0x100, [=](INesMemoryHandler* h) { return h == handlers[0]; })) {
+				_pages[i] = handlers[0];
+				_splitPages[i].reset();
+			}
+		}
+	}
+
+	/// <summary>Number of split pages (for tests)</summary>
+	[[nodiscard]] uint32_t GetSplitPageCount() const {
+		return (uint32_t)std::count(std::begin(_pages), std::end(_pages), nullptr);
+	}
+};
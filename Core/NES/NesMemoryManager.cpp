@@ -33,15 +33,9 @@ NesMemoryManager::NesMemoryManager(NesConsole* console, BaseMapper* mapper) {
 		throw std::runtime_error("unsupported memory size");
 	}
 
-	// Allocate read/write handler arrays (64KB address space)
-	_ramReadHandlers = std::make_unique<INesMemoryHandler*[]>(NesMemoryManager::CpuMemorySize);
-	_ramWriteHandlers = std::make_unique<INesMemoryHandler*[]>(NesMemoryManager::CpuMemorySize);
-
 	// Initialize all handlers to open bus (default unmapped behavior)
-	for (int i = 0; i < NesMemoryManager::CpuMemorySize; i++) {
-		_ramReadHandlers[i] = &_openBusHandler;
-		_ramWriteHandlers[i] = &_openBusHandler;
-	}
+	_ramReadHandlers.Reset(&_openBusHandler);
+	_ramWriteHandlers.Reset(&_openBusHandler);
 
 	// Register internal RAM handler for $0000-$07FF (mirrored to $1FFF)
 	RegisterIODevice(_internalRamHandler.get());
@@ -57,33 +51,37 @@ void NesMemoryManager::Reset(bool softReset) {
 	_mapper->Reset(softReset);
 }
 
-void NesMemoryManager::InitializeMemoryHandlers(INesMemoryHandler** memoryHandlers, INesMemoryHandler* handler, vector<uint16_t>* addresses, bool allowOverride) {
+void NesMemoryManager::InitializeMemoryHandlers(NesMemoryHandlerTable& memoryHandlers, INesMemoryHandler* handler, vector<uint16_t>* addresses, bool allowOverride) {
 	for (uint16_t address : *addresses) {
-		if (!allowOverride && memoryHandlers[address] != &_openBusHandler && memoryHandlers[address] != handler) [[unlikely]] {
+		INesMemoryHandler* current = memoryHandlers.Get(address);
+		if (!allowOverride && current != &_openBusHandler && current != handler) [[unlikely]] {
 			throw std::runtime_error("Can't override existing mapping");
 		}
-		memoryHandlers[address] = handler;
+		memoryHandlers.Set(address, handler);
 	}
+	memoryHandlers.Compact();
 }
 
 void NesMemoryManager::RegisterIODevice(INesMemoryHandler* handler) {
 	MemoryRanges ranges;
 	handler->GetMemoryRanges(ranges);
 
-	InitializeMemoryHandlers(_ramReadHandlers.get(), handler, ranges.GetRAMReadAddresses(), ranges.GetAllowOverride());
-	InitializeMemoryHandlers(_ramWriteHandlers.get(), handler, ranges.GetRAMWriteAddresses(), ranges.GetAllowOverride());
+	InitializeMemoryHandlers(_ramReadHandlers, handler, ranges.GetRAMReadAddresses(), ranges.GetAllowOverride());
+	InitializeMemoryHandlers(_ramWriteHandlers, handler, ranges.GetRAMWriteAddresses(), ranges.GetAllowOverride());
 }
 
 void NesMemoryManager::RegisterWriteHandler(INesMemoryHandler* handler, uint32_t start, uint32_t end) {
 	for (uint32_t i = start; i <= end; i++) {
-		_ramWriteHandlers[i] = handler;
+		_ramWriteHandlers.Set(i, handler);
 	}
+	_ramWriteHandlers.Compact();
 }
 
 void NesMemoryManager::RegisterReadHandler(INesMemoryHandler* handler, uint32_t start, uint32_t end) {
 	for (uint32_t i = start; i <= end; i++) {
-		_ramReadHandlers[i] = handler;
+		_ramReadHandlers.Set(i, handler);
 	}
+	_ramReadHandlers.Compact();
 }
 
 void NesMemoryManager::UnregisterIODevice(INesMemoryHandler* handler) {
@@ -91,12 +89,15 @@ void NesMemoryManager::UnregisterIODevice(INesMemoryHandler* handler) {
 	handler->GetMemoryRanges(ranges);
 
 	for (uint16_t address : *ranges.GetRAMReadAddresses()) {
-		_ramReadHandlers[address] = &_openBusHandler;
+		_ramReadHandlers.Set(address, &_openBusHandler);
 	}
 
 	for (uint16_t address : *ranges.GetRAMWriteAddresses()) {
-		_ramWriteHandlers[address] = &_openBusHandler;
+		_ramWriteHandlers.Set(address, &_openBusHandler);
 	}
+
+	_ramReadHandlers.Compact();
+	_ramWriteHandlers.Compact();
 }
 
 uint8_t* NesMemoryManager::GetInternalRam() {
@@ -104,7 +105,7 @@ uint8_t* NesMemoryManager::GetInternalRam() {
 }
 
 uint8_t NesMemoryManager::DebugRead(uint16_t addr) {
-	uint8_t value = _ramReadHandlers[addr]->PeekRam(addr);
+	uint8_t value = _ramReadHandlers.Get(addr)->PeekRam(addr);
 	if (_cheatManager->HasCheats<CpuType::Nes>()) {
 		_cheatManager->ApplyCheat<CpuType::Nes>(addr, value);
 	}
@@ -116,13 +117,17 @@ uint16_t NesMemoryManager::DebugReadWord(uint16_t addr) {
 }
 
 uint8_t NesMemoryManager::Read(uint16_t addr, MemoryOperationType operationType) {
-	INesMemoryHandler* handler = _ramReadHandlers[addr];
+	INesMemoryHandler* handler = _ramReadHandlers.GetPageHandler(addr >> 8);
 	uint8_t value;
 	if (handler == _mapper) [[likely]] {
 		// Fast path: ~60% of reads hit the mapper (PRG ROM).
 		// ReadRamFast inlines the page table lookup, avoiding virtual dispatch.
 		value = _mapper->ReadRamFast(addr);
 	} else {
+		if (!handler) {
+			// Page shared by several handlers
+			handler = _ramReadHandlers.Get(addr);
+		}
 		value = handler->ReadRam(addr);
 	}
 
@@ -138,16 +143,16 @@ uint8_t NesMemoryManager::Read(uint16_t addr, MemoryOperationType operationType)
 
 void NesMemoryManager::Write(uint16_t addr, uint8_t value, MemoryOperationType operationType) {
 	if (_emu->ProcessMemoryWrite<CpuType::Nes>(addr, value, operationType)) {
-		_ramWriteHandlers[addr]->WriteRam(addr, value);
+		_ramWriteHandlers.Get(addr)->WriteRam(addr, value);
 		_openBusHandler.SetOpenBus(value, false);
 	}
 }
 
 void NesMemoryManager::DebugWrite(uint16_t addr, uint8_t value, bool disableSideEffects) {
 	if (addr <= 0x1FFF) {
-		_ramWriteHandlers[addr]->WriteRam(addr, value);
+		_ramWriteHandlers.Get(addr)->WriteRam(addr, value);
 	} else {
-		INesMemoryHandler* handler = _ramReadHandlers[addr];
+		INesMemoryHandler* handler = _ramReadHandlers.Get(addr);
 		if (handler) {
 			if (disableSideEffects) {
 				if (handler == _mapper) {
@@ -6,6 +6,7 @@
 #include "NES/INesMemoryHandler.h"
 #include "NES/OpenBusHandler.h"
 #include "NES/InternalRamHandler.h"
+#include "NES/NesMemoryHandlerTable.h"
 #include "Shared/MemoryOperationType.h"
 #include "Utilities/ISerializable.h"
 
@@ -29,6 +30,8 @@ class NesConsole;
 /// - Each address range is mapped to an INesMemoryHandler
 /// - Handlers provide Read() and Write() implementations
 /// - Supports handler override for expansion audio, FDS, etc.
+/// - Handlers are looked up per 256-byte page (see NesMemoryHandlerTable), reads from
+///   pages owned by the mapper use its inlined PRG page lookup instead of a virtual call
 ///
 /// **Open Bus:**
 /// - Reads from unmapped addresses return last bus value
@@ -54,15 +57,15 @@ private:
 
 	OpenBusHandler _openBusHandler = {};  ///< Handler for unmapped addresses
 	unique_ptr<INesMemoryHandler> _internalRamHandler;  ///< Handler for $0000-$1FFF
-	std::unique_ptr<INesMemoryHandler*[]> _ramReadHandlers;   ///< Read handler per address
-	std::unique_ptr<INesMemoryHandler*[]> _ramWriteHandlers;  ///< Write handler per address
+	NesMemoryHandlerTable _ramReadHandlers;   ///< Read handler per address
+	NesMemoryHandlerTable _ramWriteHandlers;  ///< Write handler per address
 
-	/// <summary>Initialize handler array for an address range.</summary>
-	/// <param name="memoryHandlers">Handler array to populate</param>
+	/// <summary>Initialize handler table for an address range.</summary>
+	/// <param name="memoryHandlers">Handler table to populate</param>
 	/// <param name="handler">Handler to assign</param>
 	/// <param name="addresses">Address list (or nullptr for all)</param>
 	/// <param name="allowOverride">Allow overwriting existing handlers</param>
-	void InitializeMemoryHandlers(INesMemoryHandler** memoryHandlers, INesMemoryHandler* handler, vector<uint16_t>* addresses, bool allowOverride);
+	void InitializeMemoryHandlers(NesMemoryHandlerTable& memoryHandlers, INesMemoryHandler* handler, vector<uint16_t>* addresses, bool allowOverride);
 
 protected:
 	void Serialize(Serializer& s) override;
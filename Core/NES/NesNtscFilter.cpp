@@ -74,7 +74,11 @@ void NesNtscFilter::ApplyFilter(uint16_t* ppuOutputBuffer) {
 		NesDefaultVideoFilter::ApplyPalBorder(ppuOutputBuffer);
 	}
 
-	nes_ntsc_blit(&_ntscData, ppuOutputBuffer, _baseFrameInfo.Width, GetVideoPhaseOffset() / 4, _baseFrameInfo.Width, _baseFrameInfo.Height, _ntscBuffer.get(), NES_NTSC_OUT_WIDTH(_baseFrameInfo.Width) * 4);
+	// Rows are independent, each slice starts at the burst phase its first row would have
+	int burstPhase = GetVideoPhaseOffset() / 4;
+	ProcessRowSlices(_baseFrameInfo.Height, [=, this](uint32_t firstRow, uint32_t lastRow) {
+		nes_ntsc_blit(&_ntscData, ppuOutputBuffer + firstRow * _baseFrameInfo.Width, _baseFrameInfo.Width, (burstPhase + firstRow) % nes_ntsc_burst_count, _baseFrameInfo.Width, lastRow - firstRow, _ntscBuffer.get() + firstRow * baseWidth, baseWidth * 4);
+	});
 
 	for (uint32_t i = 0; i < frameInfo.Height; i += 2) {
 		memcpy(GetOutputBuffer() + i * frameInfo.Width, _ntscBuffer.get() + yOffset + xOffset + (i / 2) * baseWidth, frameInfo.Width * sizeof(uint32_t));
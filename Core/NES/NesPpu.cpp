@@ -88,9 +88,10 @@ void NesPpu<T>::Reset(bool softReset) {
 
 	// Reset OAM decay timestamps regardless of the reset PPU option
 	memset(_oamDecayCycles, 0, sizeof(_oamDecayCycles));
-	_enableOamDecay = _console->GetNesConfig().EnableOamDecay;
+	_settings->UpdateSnapshot(_nesCfg);
+	_enableOamDecay = _nesCfg->EnableOamDecay;
 
-	if (softReset && _settings->GetNesConfig().DisablePpuReset) {
+	if (softReset && _nesCfg->DisablePpuReset) {
 		return; // Skip PPU reset if disabled in settings
 	}
 
@@ -119,7 +120,7 @@ void NesPpu<T>::Reset(bool softReset) {
 	if (!softReset) {
 		// "The VBL flag (PPUSTATUS bit 7) is random at power, and unchanged by reset."
 		_statusFlags = {};
-		_statusFlags.VerticalBlank = _settings->GetNesConfig().RandomizeMapperPowerOnState ? _settings->GetRandomBool() : false;
+		_statusFlags.VerticalBlank = _nesCfg->RandomizeMapperPowerOnState ? _settings->GetRandomBool() : false;
 	}
 
 	// Clear tile fetch state
@@ -132,6 +133,8 @@ void NesPpu<T>::Reset(bool softReset) {
 	_paletteRamMask = 0x3F;
 	_lastUpdatedPixel = -1;
 	_lastSprite = nullptr;
+	_pendingPixelStart = 0;
+	_pendingShifterCount = 0;
 	_oamCopybuffer = 0;
 	_spriteInRange = false;
 	_sprite0Added = false;
@@ -307,6 +310,8 @@ void NesPpu<T>::ProcessStatusRegOpenBus(uint8_t& openBusMask, uint8_t& returnVal
 template <class T>
 uint8_t NesPpu<T>::PeekRam(uint16_t addr) {
 	// Used by debugger to get register values without side-effects (heavily edited copy of ReadRAM)
+	CatchUpPixels();
+
 	uint8_t openBusMask = 0xFF;
 	uint8_t returnValue = 0;
 	switch (GetRegisterID(addr)) {
@@ -321,7 +326,7 @@ uint8_t NesPpu<T>::PeekRam(uint16_t addr) {
 			break;
 
 		case PpuRegisters::SpriteData:
-			if (!_console->GetNesConfig().DisablePpu2004Reads) {
+			if (!_nesCfg->DisablePpu2004Reads) {
 				if (_scanline <= 239 && IsRenderingEnabled()) {
 					if (_cycle >= 257 && _cycle <= 320) {
 						uint8_t step = ((_cycle - 257) % 8) > 3 ? 3 : ((_cycle - 257) % 8);
@@ -340,7 +345,7 @@ uint8_t NesPpu<T>::PeekRam(uint16_t addr) {
 		case PpuRegisters::VideoMemoryData:
 			returnValue = _memoryReadBuffer;
 
-			if ((_videoRamAddr & 0x3FFF) >= 0x3F00 && !_console->GetNesConfig().DisablePaletteRead) {
+			if ((_videoRamAddr & 0x3FFF) >= 0x3F00 && !_nesCfg->DisablePaletteRead) {
 				returnValue = (ReadPaletteRam(_videoRamAddr) & _paletteRamMask) | (_openBus & 0xC0);
 				openBusMask = 0xC0;
 			} else {
@@ -356,6 +361,8 @@ uint8_t NesPpu<T>::PeekRam(uint16_t addr) {
 
 template <class T>
 uint8_t NesPpu<T>::ReadRam(uint16_t addr) {
+	CatchUpPixels();
+
 	uint8_t openBusMask = 0xFF;
 	uint8_t returnValue = 0;
 	switch (GetRegisterID(addr)) {
@@ -371,7 +378,7 @@ uint8_t NesPpu<T>::ReadRam(uint16_t addr) {
 			break;
 
 		case PpuRegisters::SpriteData:
-			if (!_console->GetNesConfig().DisablePpu2004Reads) {
+			if (!_nesCfg->DisablePpu2004Reads) {
 				if (_scanline <= 239 && IsRenderingEnabled()) {
 					// While the screen is begin drawn
 					if (_cycle >= 257 && _cycle <= 320) {
@@ -392,7 +399,7 @@ uint8_t NesPpu<T>::ReadRam(uint16_t addr) {
 			break;
 
 		case PpuRegisters::VideoMemoryData:
-			if (!_allowFullPpuAccess && _settings->GetNesConfig().RestrictPpuAccessOnFirstFrame) {
+			if (!_allowFullPpuAccess && _nesCfg->RestrictPpuAccessOnFirstFrame) {
 				openBusMask = 0x00;
 				returnValue = 0;
 			} else if (_ignoreVramRead) {
@@ -403,7 +410,7 @@ uint8_t NesPpu<T>::ReadRam(uint16_t addr) {
 				returnValue = _memoryReadBuffer;
 				_memoryReadBuffer = ReadVram(_ppuBusAddress & 0x3FFF, MemoryOperationType::Read);
 
-				if ((_ppuBusAddress & 0x3FFF) >= 0x3F00 && !_console->GetNesConfig().DisablePaletteRead) {
+				if ((_ppuBusAddress & 0x3FFF) >= 0x3F00 && !_nesCfg->DisablePaletteRead) {
 					// Note: When grayscale is turned on, the read values also have the grayscale mask applied to them
 					returnValue = (ReadPaletteRam(_ppuBusAddress) & _paletteRamMask) | (_openBus & 0xC0);
 					_emu->ProcessPpuRead<CpuType::Nes>(_ppuBusAddress, returnValue, MemoryType::NesPpuMemory);
@@ -430,6 +437,8 @@ uint8_t NesPpu<T>::ReadRam(uint16_t addr) {
 
 template <class T>
 void NesPpu<T>::WriteRam(uint16_t addr, uint8_t value) {
+	CatchUpPixels();
+
 	if (addr != 0x4014) {
 		SetOpenBus(0xFF, value);
 	}
@@ -473,7 +482,7 @@ void NesPpu<T>::WriteRam(uint16_t addr, uint8_t value) {
 			break;
 
 		case PpuRegisters::ScrollOffsets:
-			if (!_allowFullPpuAccess && _settings->GetNesConfig().RestrictPpuAccessOnFirstFrame) {
+			if (!_allowFullPpuAccess && _nesCfg->RestrictPpuAccessOnFirstFrame) {
 				return;
 			}
 
@@ -489,7 +498,7 @@ void NesPpu<T>::WriteRam(uint16_t addr, uint8_t value) {
 			break;
 
 		case PpuRegisters::VideoMemoryAddr:
-			if (!_allowFullPpuAccess && _settings->GetNesConfig().RestrictPpuAccessOnFirstFrame) {
+			if (!_allowFullPpuAccess && _nesCfg->RestrictPpuAccessOnFirstFrame) {
 				return;
 			}
 
@@ -536,7 +545,7 @@ void NesPpu<T>::WriteRam(uint16_t addr, uint8_t value) {
 template <class T>
 void NesPpu<T>::ProcessTmpAddrScrollGlitch(uint16_t normalAddr, uint16_t value, uint16_t mask) {
 	_tmpVideoRamAddr = normalAddr;
-	if (_cycle == 257 && _console->GetNesConfig().EnablePpu2000ScrollGlitch && _scanline < 240 && IsRenderingEnabled()) {
+	if (_cycle == 257 && _nesCfg->EnablePpu2000ScrollGlitch && _scanline < 240 && IsRenderingEnabled()) {
 		// Use open bus to set some parts of V (glitch that occurs when writing to $2000/$2005/$2006 on cycle 257)
 		_videoRamAddr = (_videoRamAddr & ~mask) | (value & mask);
 		_emu->BreakIfDebugging(CpuType::Nes, BreakSource::NesBreakOnPpuScrollGlitch);
@@ -545,7 +554,7 @@ void NesPpu<T>::ProcessTmpAddrScrollGlitch(uint16_t normalAddr, uint16_t value,
 
 template <class T>
 void NesPpu<T>::SetControlRegister(uint8_t value) {
-	if (!_allowFullPpuAccess && _settings->GetNesConfig().RestrictPpuAccessOnFirstFrame) {
+	if (!_allowFullPpuAccess && _nesCfg->RestrictPpuAccessOnFirstFrame) {
 		return;
 	}
 
@@ -575,7 +584,7 @@ void NesPpu<T>::SetControlRegister(uint8_t value) {
 
 template <class T>
 void NesPpu<T>::SetMaskRegister(uint8_t value) {
-	if (!_allowFullPpuAccess && _settings->GetNesConfig().RestrictPpuAccessOnFirstFrame) {
+	if (!_allowFullPpuAccess && _nesCfg->RestrictPpuAccessOnFirstFrame) {
 		return;
 	}
 
@@ -699,6 +708,9 @@ void NesPpu<T>::LoadTileInfo() {
 
 				_lowBitShift |= _tile.LowByte;
 				_highBitShift |= _tile.HighByte;
+				if (_pendingPixelStart != 0) {
+					RecordPendingShifters();
+				}
 
 				uint8_t tileIndex = ReadVram(GetNameTableAddr());
 				_tile.TileAddr = (tileIndex << 4) | (_videoRamAddr >> 12) | _control.BackgroundPatternAddr;
@@ -916,7 +928,7 @@ void NesPpu<T>::ProcessScanlineImpl() {
 				_statusFlags.VerticalBlank = false;
 				_console->GetCpu()->ClearNmiFlag();
 			}
-			if (_spriteRamAddr >= 0x08 && IsRenderingEnabled() && !_settings->GetNesConfig().DisableOamAddrBug) {
+			if (_spriteRamAddr >= 0x08 && IsRenderingEnabled() && !_nesCfg->DisableOamAddrBug) {
 				// This should only be done if rendering is enabled (otherwise oam_stress test fails immediately)
 				//"If OAMADDR is not less than eight when rendering starts, the eight bytes starting at OAMADDR & 0xF8 are copied to the first eight bytes of OAM"
 				WriteSpriteRam(_cycle - 1, ReadSpriteRam((_spriteRamAddr & 0xF8) + _cycle - 1));
@@ -1017,7 +1029,7 @@ void NesPpu<T>::ProcessSpriteEvaluationEnd() {
 	// be stopped mid-sprite (e.g only 1 to 3 bytes are copied to secondary OAM)
 	_spriteCount = ((_secondaryOamAddr + 3) >> 2);
 
-	if (_settings->GetNesConfig().EnablePpuSpriteEvalBug) {
+	if (_nesCfg->EnablePpuSpriteEvalBug) {
 		//(Not entirely confirmed - but matches observed behavior)
 		// For early PPUs (2C02B and earlier), after sprite eval wraps back to the start of OAM,
 		// all subsequent sprites appear to be considered as "out of range", causing only their
@@ -1053,7 +1065,7 @@ void NesPpu<T>::ProcessSpriteEvaluation() {
 					ProcessSpriteEvaluationEnd();
 				}
 
-				if (_oamCopyDone && !_settings->GetNesConfig().EnablePpuSpriteEvalBug) {
+				if (_oamCopyDone && !_nesCfg->EnablePpuSpriteEvalBug) {
 					_spriteAddrH = (_spriteAddrH + 1) & 0x3F;
 					if (_secondaryOamAddr >= 0x20) {
 						//"As seen above, a side effect of the OAM write disable signal is to turn writes to the secondary OAM into reads from it."
@@ -1196,6 +1208,7 @@ void NesPpu<T>::WriteSpriteRam(uint8_t addr, uint8_t value) {
 
 template <class T>
 uint16_t* NesPpu<T>::GetScreenBuffer(bool previousBuffer, bool processGrayscaleEmphasisBits) {
+	CatchUpPixels();
 	if (!previousBuffer && processGrayscaleEmphasisBits) {
 		UpdateGrayscaleAndIntensifyBits();
 	}
@@ -1204,6 +1217,7 @@ uint16_t* NesPpu<T>::GetScreenBuffer(bool previousBuffer, bool processGrayscaleE
 
 template <class T>
 void NesPpu<T>::DebugCopyOutputBuffer(uint16_t* target) {
+	CatchUpPixels();
 	memcpy(target, _currentOutputBuffer, NesConstants::ScreenPixelCount * sizeof(uint16_t));
 }
 
@@ -1241,7 +1255,10 @@ void NesPpu<T>::SendFrame() {
 		_emu->ProcessEndOfFrame();
 	}
 
-	_enableOamDecay = _settings->GetNesConfig().EnableOamDecay;
+	// Settings changed by the UI during the frame take effect on the next frame
+	if (_settings->UpdateSnapshot(_nesCfg)) {
+		_enableOamDecay = _nesCfg->EnableOamDecay;
+	}
 }
 
 template <class T>
@@ -1306,6 +1323,8 @@ void NesPpu<T>::UpdateApuStatus() {
 
 template <class T>
 void NesPpu<T>::DebugUpdateFrameBuffer(bool toGrayscale) {
+	CatchUpPixels();
+
 	// Clear output buffer for "Draw partial frame" feature
 	if (toGrayscale) {
 		for (int i = 0; i < NesConstants::ScreenPixelCount; i++) {
@@ -1318,7 +1337,7 @@ void NesPpu<T>::DebugUpdateFrameBuffer(bool toGrayscale) {
 
 template <class T>
 void NesPpu<T>::SetOamCorruptionFlags() {
-	if (!_console->GetNesConfig().EnablePpuOamRowCorruption) {
+	if (!_nesCfg->EnablePpuOamRowCorruption) {
 		return;
 	}
 
@@ -1344,7 +1363,7 @@ void NesPpu<T>::SetOamCorruptionFlags() {
 
 template <class T>
 void NesPpu<T>::ProcessOamCorruption() {
-	if (!_console->GetNesConfig().EnablePpuOamRowCorruption) {
+	if (!_nesCfg->EnablePpuOamRowCorruption) {
 		return;
 	}
 
@@ -1415,9 +1434,12 @@ void NesPpu<T>::ProcessScanlineFirstCycle() {
 		UpdateMinimumDrawCycles();
 	}
 
+	// Pixels are rendered one at a time while debugging, so events (e.g sprite 0 hit) are logged on the right cycle
+	_allowCatchUpRendering = !_emu->IsDebugging();
+
 	UpdateApuStatus();
 
-	if (_scanline == _console->GetNesConfig().InputScanline) {
+	if (_scanline == _nesCfg->InputScanline) {
 		_console->GetControlManager()->UpdateControlDevices();
 		_console->GetControlManager()->UpdateInputState();
 	}
@@ -1494,7 +1516,7 @@ void NesPpu<T>::UpdateState() {
 	if (_updateVramAddrDelay > 0) {
 		_updateVramAddrDelay--;
 		if (_updateVramAddrDelay == 0) {
-			if (_console->GetNesConfig().EnablePpu2006ScrollGlitch && _scanline < 240 && IsRenderingEnabled()) {
+			if (_nesCfg->EnablePpu2006ScrollGlitch && _scanline < 240 && IsRenderingEnabled()) {
 				// When a $2006 address update lands on the Y or X increment, the written value is bugged and is ANDed with the incremented value
 				if (_cycle == 257) {
 					_videoRamAddr &= _updateVramAddr;
@@ -1545,12 +1567,15 @@ void NesPpu<T>::UpdateState() {
 template <class T>
 uint32_t NesPpu<T>::GetPixelBrightness(uint8_t x, uint8_t y) {
 	// Used by Zapper, gives a rough approximation of the brightness level of the specific pixel
+	CatchUpPixels();
 	uint16_t pixelData = (_currentOutputBuffer[y << 8 | x] & _paletteRamMask) | _intensifyColorBits;
 	return NesDefaultVideoFilter::GetDefaultPixelBrightness(pixelData, GetPpuModel());
 }
 
 template <class T>
 void NesPpu<T>::Serialize(Serializer& s) {
+	CatchUpPixels();
+
 	SVArray(_paletteRam, 0x20);
 	SVArray(_spriteRam, 0x100);
 	SVArray(_secondarySpriteRam, 0x20);
@@ -1635,6 +1660,7 @@ void NesPpu<T>::Serialize(Serializer& s) {
 	}
 
 	if (!s.IsSaving()) {
+		_settings->UpdateSnapshot(_nesCfg);
 		UpdateTimings(_region);
 		UpdateMinimumDrawCycles();
 		UpdateGrayscaleAndIntensifyBits();
@@ -50,6 +50,8 @@ enum PpuRegisters {
 /// - Scanline 240: Post-render (idle)
 /// - Scanlines 241-260: V-blank (NMI triggered at start of 241)
 /// - Scanline 261: Pre-render (setup for next frame)
+/// - DefaultNesPpu composes pixels in batches (catch-up rendering, see BaseNesPpu::RenderPendingPixels).
+///   VRAM fetches still happen on their exact cycles, so mapper A12/scanline IRQ timing is unaffected.
 ///
 /// **Key Timing Events:**
 /// - Sprite 0 hit: When BG and sprite 0 opaque pixels overlap
@@ -173,6 +175,7 @@ public:
 	uint32_t GetPixelBrightness(uint8_t x, uint8_t y) override;
 
 	uint16_t GetPixel(uint8_t x, uint8_t y) {
+		CatchUpPixels();
 		return _currentOutputBuffer[y << 8 | x];
 	}
 };
@@ -70,6 +70,29 @@ public:
 		}
 	}
 
+	/// <summary>Number of clocks (up to maxClocks) until the next clock where a timer expires</summary>
+	uint32_t GetClocksUntilTimer(uint32_t maxClocks) {
+		for (uint32_t timer : _timers) {
+			if (timer && timer < maxClocks) {
+				maxClocks = timer;
+			}
+		}
+		return maxClocks;
+	}
+
+	/// <summary>
+	/// Same as calling Exec() the given number of times, when no timer expires during
+	/// those clocks (clocks &lt; GetClocksUntilTimer())
+	/// </summary>
+	void Skip(uint32_t clocks) {
+		_busyCounter = _busyCounter > clocks ? _busyCounter - clocks : 0;
+		for (uint32_t& timer : _timers) {
+			if (timer) {
+				timer -= clocks;
+			}
+		}
+	}
+
 	void Write(uint8_t addr, uint8_t value) {
 		_opn.write(addr, value);
 	}
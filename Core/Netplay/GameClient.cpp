@@ -51,6 +51,7 @@ void GameClient::Exec() {
 			if (!_connection->ConnectionError()) {
 				_connection->ProcessMessages();
 				_connection->SendInput();
+				_connection->ProcessUdp();
 			} else {
 				break;
 			}
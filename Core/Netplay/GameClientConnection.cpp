@@ -10,6 +10,11 @@
 #include "Netplay/PlayerListMessage.h"
 #include "Netplay/ForceDisconnectMessage.h"
 #include "Netplay/ServerInformationMessage.h"
+#include "Netplay/RollbackInputMessage.h"
+#include "Netplay/RollbackChecksumMessage.h"
+#include "Netplay/NetplayRollback.h"
+#include "Netplay/UdpSetupMessage.h"
+#include "Netplay/StateRequestMessage.h"
 #include "Netplay/GameServer.h"
 #include "Shared/BaseControlManager.h"
 #include "Shared/Emulator.h"
@@ -37,6 +42,10 @@ void GameClientConnection::Shutdown() {
 		DisableControllers();
 
 		_emu->UnregisterInputProvider(this);
+		if (_rollback) {
+			_emu->UnregisterInputProvider(_rollback.get());
+			_emu->SetNetplayRollback(nullptr);
+		}
 
 		MessageManager::DisplayMessage("NetPlay", "ConnectionLost");
 		_emu->GetSettings()->ClearFlag(EmulationFlags::MaximumSpeed);
@@ -73,11 +82,27 @@ void GameClientConnection::ProcessMessage(NetMessage* message) {
 
 		case MessageType::SaveState:
 			if (_gameLoaded) {
+				if (!((SaveStateMessage*)message)->CanLoad(_stateBase)) {
+					// Delta against a state that wasn't loaded (e.g received before the game was loaded)
+					StateRequestMessage request;
+					SendNetMessage(request);
+					break;
+				}
+
 				DisableControllers();
 
 				auto lock = _emu->AcquireLock();
 				ClearInputData();
-				((SaveStateMessage*)message)->LoadState(_emu);
+				((SaveStateMessage*)message)->LoadState(_emu, _stateBase);
+				if (_rollback) {
+					_rollback->Reset(((SaveStateMessage*)message)->GetFrame());
+					UpdateRollbackPlayers();
+				}
+				_syncId = ((SaveStateMessage*)message)->GetSyncId();
+				if (_udp) {
+					// Input sent before the resync is ignored by the server
+					_udp->ClearQueues();
+				}
 				_enableControllers = true;
 				InitControlDevice();
 			}
@@ -89,12 +114,27 @@ void GameClientConnection::ProcessMessage(NetMessage* message) {
 			}
 			break;
 
+		case MessageType::RollbackInput:
+			if (_gameLoaded && _rollback) {
+				NetplayInputEntry entry = ((RollbackInputMessage*)message)->GetEntry();
+				_rollback->AddRemoteInput(entry.Controller, entry.Frame, entry.State);
+			}
+			break;
+
+		case MessageType::UdpSetup:
+			EnableUdp(((UdpSetupMessage*)message)->GetToken());
+			break;
+
 		case MessageType::ForceDisconnect:
 			MessageManager::DisplayMessage("NetPlay", ((ForceDisconnectMessage*)message)->GetMessage());
 			break;
 
 		case MessageType::PlayerList:
 			_playerList = ((PlayerListMessage*)message)->GetPlayerList();
+			if (_rollback) {
+				auto lock = _emu->AcquireLock();
+				UpdateRollbackPlayers();
+			}
 			break;
 
 		case MessageType::GameInformation:
@@ -110,12 +150,16 @@ void GameClientConnection::ProcessMessage(NetMessage* message) {
 				ClearInputData();
 			}
 
+			if (gameInfo->GetRollbackFrames() > 0) {
+				EnableRollback(gameInfo->GetRollbackFrames());
+			}
+
 			_gameLoaded = AttemptLoadGame(gameInfo->GetRomFilename(), gameInfo->GetCrc32());
 			if (!_gameLoaded) {
 				_emu->Stop(true);
 			} else {
-				_emu->UnregisterInputProvider(this);
-				_emu->RegisterInputProvider(this);
+				_emu->UnregisterInputProvider(GetInputProvider());
+				_emu->RegisterInputProvider(GetInputProvider());
 				if (gameInfo->IsPaused()) {
 					_emu->Pause();
 				} else {
@@ -215,11 +259,104 @@ void GameClientConnection::ProcessNotification(ConsoleNotificationType type, voi
 	if (type == ConsoleNotificationType::ConfigChanged) {
 		InitControlDevice();
 	} else if (type == ConsoleNotificationType::GameLoaded) {
-		_emu->RegisterInputProvider(this);
+		_emu->RegisterInputProvider(GetInputProvider());
 	}
 }
 
+void GameClientConnection::EnableRollback(uint32_t rollbackFrames) {
+	if (_rollback) {
+		return;
+	}
+
+	_rollback = std::make_shared<NetplayRollback>(
+	    _emu, rollbackFrames,
+	    [this](NetplayControllerInfo controller, uint32_t frame, const ControlDeviceState& state) {
+		    SendRollbackInput(NetplayInputEntry{controller, _syncId, frame, state});
+	    },
+	    [this](uint32_t frame, uint32_t checksum) {
+		    RollbackChecksumMessage message(frame, checksum);
+		    SendNetMessage(message);
+	    });
+	_emu->UnregisterInputProvider(this);
+	_emu->SetNetplayRollback(_rollback);
+}
+
+void GameClientConnection::UpdateRollbackPlayers() {
+	// Every other player's input is received from the server (the host's, and relayed for the other clients)
+	vector<NetplayControllerInfo> remotePlayers;
+	for (PlayerInfo& player : _playerList) {
+		if (player.ControllerPort.Port != _controllerPort.Port || player.ControllerPort.SubPort != _controllerPort.SubPort) {
+			remotePlayers.push_back(player.ControllerPort);
+		}
+	}
+	_rollback->SetPlayers(remotePlayers, _controllerPort);
+}
+
+void GameClientConnection::EnableUdp(uint32_t token) {
+	UdpEndpoint endpoint;
+	if (_udp || !UdpSocket::Resolve(_connectionData.Host.c_str(), _connectionData.Port, endpoint)) {
+		return;
+	}
+
+	unique_ptr<UdpSocket> socket = std::make_unique<UdpSocket>();
+	if (socket->Bind(0, false)) {
+		// The channel starts sending keep alive packets, the server learns our address from them
+		auto lock = _emu->AcquireLock();
+		_udp = std::make_unique<NetplayUdpChannel>(socket.get(), token, endpoint);
+		_udpSocket = std::move(socket);
+	}
+}
+
+void GameClientConnection::SendRollbackInput(const NetplayInputEntry& entry) {
+	if (_udp) {
+		if (_udp->IsAlive()) {
+			_udp->QueueInput(entry);
+			return;
+		}
+
+		// No UDP packet received from the server recently, send whatever it may not have received over TCP
+		for (NetplayInputEntry& unacknowledged : _udp->TakeUnacknowledged()) {
+			RollbackInputMessage message(unacknowledged);
+			SendNetMessage(message);
+		}
+	}
+
+	RollbackInputMessage message(entry);
+	SendNetMessage(message);
+}
+
+void GameClientConnection::ProcessUdp() {
+	if (!_udp) {
+		return;
+	}
+
+	uint8_t buffer[NetplayUdpChannel::MaxPacketSize];
+	UdpEndpoint from;
+	int length;
+	vector<NetplayInputEntry> entries;
+	while ((length = _udpSocket->RecvFrom(buffer, sizeof(buffer), from)) >= 0) {
+		_udp->ProcessPacket(buffer, length, from, entries);
+	}
+
+	if (_gameLoaded && _rollback) {
+		for (NetplayInputEntry& entry : entries) {
+			_rollback->AddRemoteInput(entry.Controller, entry.Frame, entry.State);
+		}
+	}
+
+	_udp->Flush();
+}
+
+IInputProvider* GameClientConnection::GetInputProvider() {
+	return _rollback ? (IInputProvider*)_rollback.get() : this;
+}
+
 void GameClientConnection::SendInput() {
+	if (_rollback) {
+		// Rollback mode, the input is sent by NetplayRollback on the emulation thread
+		return;
+	}
+
 	if (_gameLoaded) {
 		if (!_controlDevice || _controllerType != _controlDevice->GetControllerType()) {
 			// Pretend we are using port 0 (to use player 1's keybindings during netplay)
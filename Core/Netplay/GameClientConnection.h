@@ -10,6 +10,11 @@
 #include "Netplay/GameConnection.h"
 #include "Netplay/ClientConnectionData.h"
 #include "Netplay/NetplayTypes.h"
+#include "Netplay/NetplayStateBase.h"
+#include "Netplay/NetplayUdpChannel.h"
+#include "Utilities/UdpSocket.h"
+
+class NetplayRollback;
 
 class Emulator;
 
@@ -72,6 +77,11 @@ private:
 	bool _gameLoaded = false;                                                   ///< True if ROM loaded and emulation running
 	NetplayControllerInfo _controllerPort = {GameConnection::SpectatorPort, 0}; ///< Assigned port
 	ClientConnectionData _connectionData = {};                                  ///< Connection parameters (host, port, password, name)
+	shared_ptr<NetplayRollback> _rollback;                                      ///< Rollback mode state (null for delay-based netplay)
+	atomic<uint16_t> _syncId = 0;                                               ///< Resync counter of the last state received (rollback mode)
+	unique_ptr<UdpSocket> _udpSocket;                                           ///< UDP socket (when the server accepts rollback input over UDP)
+	unique_ptr<NetplayUdpChannel> _udp;                                         ///< UDP input channel to the server
+	NetplayStateBase _stateBase;                                                ///< Last state loaded (base of the next state's delta)
 	string _serverSalt;                                                         ///< Authentication salt from server
 
 private:
@@ -120,6 +130,31 @@ private:
 	/// </summary>
 	void DisableControllers();
 
+	/// <summary>
+	/// Switch to rollback mode with the server's rollback window.
+	/// </summary>
+	void EnableRollback(uint32_t rollbackFrames);
+
+	/// <summary>
+	/// Update the rollback mode's remote/local players from the player list.
+	/// </summary>
+	void UpdateRollbackPlayers();
+
+	/// <summary>
+	/// Input provider to register: the rollback state in rollback mode, the connection otherwise.
+	/// </summary>
+	IInputProvider* GetInputProvider();
+
+	/// <summary>
+	/// Open the UDP input channel to the server.
+	/// </summary>
+	void EnableUdp(uint32_t token);
+
+	/// <summary>
+	/// Send local input for a frame (rollback mode, emulation thread).
+	/// </summary>
+	void SendRollbackInput(const NetplayInputEntry& entry);
+
 	/// <summary>
 	/// Attempt to load ROM matching server.
 	/// </summary>
@@ -223,6 +258,14 @@ public:
 	/// </remarks>
 	void SendInput();
 
+	/// <summary>
+	/// Process the UDP packets received from the server and send pending UDP input/acknowledgments.
+	/// </summary>
+	/// <remarks>
+	/// Called by GameClient's thread, only does something when the server sent UdpSetup.
+	/// </remarks>
+	void ProcessUdp();
+
 	/// <summary>
 	/// Select controller port.
 	/// </summary>
@@ -10,6 +10,10 @@
 #include "Netplay/ClientConnectionData.h"
 #include "Netplay/ForceDisconnectMessage.h"
 #include "Netplay/ServerInformationMessage.h"
+#include "Netplay/RollbackInputMessage.h"
+#include "Netplay/RollbackChecksumMessage.h"
+#include "Netplay/UdpSetupMessage.h"
+#include "Netplay/StateRequestMessage.h"
 
 GameConnection::GameConnection(Emulator* emu, unique_ptr<Socket> socket) {
 	_emu = emu;
@@ -73,6 +77,14 @@ NetMessage* GameConnection::ReadMessage() {
 					return new ForceDisconnectMessage(_messageBuffer, messageLength);
 				case MessageType::ServerInformation:
 					return new ServerInformationMessage(_messageBuffer, messageLength);
+				case MessageType::RollbackInput:
+					return new RollbackInputMessage(_messageBuffer, messageLength);
+				case MessageType::RollbackChecksum:
+					return new RollbackChecksumMessage(_messageBuffer, messageLength);
+				case MessageType::UdpSetup:
+					return new UdpSetupMessage(_messageBuffer, messageLength);
+				case MessageType::StateRequest:
+					return new StateRequestMessage(_messageBuffer, messageLength);
 			}
 		}
 	}
@@ -80,12 +92,67 @@ NetMessage* GameConnection::ReadMessage() {
 }
 
 void GameConnection::SendNetMessage(NetMessage& message) {
+	SendEncodedMessage(std::make_shared<const string>(message.Encode()));
+}
+
+void GameConnection::SendEncodedMessage(const shared_ptr<const string>& data) {
+	auto lock = _socketLock.AcquireSafe();
+	if (_socket->ConnectionError()) {
+		return;
+	}
+
+	if (_queuedBytes + data->size() > GameConnection::MaxQueuedBytes) {
+		// The peer stopped reading (or its connection is much too slow to keep up)
+		MessageManager::Log("[Netplay] Send queue full, closing connection.");
+		_socket->Close();
+		return;
+	}
+
+	_sendQueue.push_back(data);
+	_queuedBytes += data->size();
+	FlushSendQueue();
+}
+
+void GameConnection::FlushSendQueue() {
+	auto lock = _socketLock.AcquireSafe();
+	while (!_sendQueue.empty() && !_socket->ConnectionError()) {
+		const string& data = *_sendQueue.front();
+		int sent = _socket->TrySend(data.data() + _sendOffset, (int)(data.size() - _sendOffset));
+		if (sent <= 0) {
+			// Socket buffer is full, the rest is sent by the connection's thread once there is room
+			break;
+		}
+
+		_sendOffset += sent;
+		_queuedBytes -= sent;
+		if (_sendOffset == data.size()) {
+			_sendQueue.pop_front();
+			_sendOffset = 0;
+		}
+	}
+}
+
+bool GameConnection::HasPendingData() {
 	auto lock = _socketLock.AcquireSafe();
-	message.Send(*_socket.get());
+	return !_sendQueue.empty();
+}
+
+uintptr_t GameConnection::GetSocketHandle() {
+	return _socket->GetHandle();
 }
 
 void GameConnection::Disconnect() {
 	auto lock = _socketLock.AcquireSafe();
+	// Finish sending what is still queued (e.g ForceDisconnect message) before closing
+	while (!_sendQueue.empty() && !_socket->ConnectionError()) {
+		string data = _sendQueue.front()->substr(_sendOffset);
+		_socket->Send(data.data(), (int)data.size(), 0);
+		_sendQueue.pop_front();
+		_sendOffset = 0;
+	}
+	_sendQueue.clear();
+	_sendOffset = 0;
+	_queuedBytes = 0;
 	_socket->Close();
 }
 
@@ -94,6 +161,8 @@ bool GameConnection::ConnectionError() {
 }
 
 void GameConnection::ProcessMessages() {
+	FlushSendQueue();
+
 	NetMessage* message;
 	while ((message = ReadMessage()) != nullptr) {
 		// Loop until all messages have been processed
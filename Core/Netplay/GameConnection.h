@@ -1,5 +1,6 @@
 #pragma once
 #include "pch.h"
+#include <deque>
 #include "Utilities/SimpleLock.h"
 
 class Socket;
@@ -24,7 +25,9 @@ class Emulator;
 ///
 /// Thread model:
 /// - ProcessMessages() called from connection thread (server/client threads)
-/// - SendNetMessage() may be called from emulation thread
+/// - SendNetMessage() may be called from emulation thread, it never waits for the socket: what doesn't fit in the
+///   socket's buffer is queued and sent by FlushSendQueue() (connection thread), so a slow peer doesn't stall the
+///   emulation (or the other peers)
 /// - Socket operations protected by _socketLock
 ///
 /// Error handling:
@@ -34,7 +37,8 @@ class Emulator;
 /// </remarks>
 class GameConnection {
 protected:
-	static constexpr int MaxMsgLength = 1500000; ///< Max message size (1.5MB for save states)
+	static constexpr int MaxMsgLength = 1500000;     ///< Max message size (1.5MB for save states)
+	static constexpr size_t MaxQueuedBytes = 0x800000; ///< Connection is closed when more data than this is waiting to be sent
 
 	unique_ptr<Socket> _socket; ///< TCP socket for communication
 	Emulator* _emu;             ///< Emulator instance reference
@@ -44,6 +48,10 @@ protected:
 	int _readPosition = 0;                                     ///< Current read position in buffer
 	SimpleLock _socketLock;                                    ///< Socket operation synchronization
 
+	std::deque<shared_ptr<const string>> _sendQueue; ///< Encoded messages not sent yet (shared between connections for broadcasts)
+	size_t _sendOffset = 0;                          ///< Bytes of the first queued message already sent
+	size_t _queuedBytes = 0;                         ///< Bytes waiting to be sent
+
 private:
 	/// <summary>
 	/// Read available data from socket into buffer.
@@ -129,9 +137,24 @@ public:
 	/// <param name="message">Message to send</param>
 	/// <remarks>
 	/// Thread-safe send:
-	/// - Locks socket during transmission
 	/// - Serializes message to wire format
-	/// - Blocks until sent or error
+	/// - Sends what fits in the socket's buffer, queues the rest (messages are always sent in order)
 	/// </remarks>
 	void SendNetMessage(NetMessage& message);
+
+	/// <summary>
+	/// Send a message encoded with NetMessage::Encode() (the same buffer can be queued to several connections).
+	/// </summary>
+	void SendEncodedMessage(const shared_ptr<const string>& data);
+
+	/// <summary>
+	/// Send the queued data the socket's buffer has room for (called by ProcessMessages()).
+	/// </summary>
+	void FlushSendQueue();
+
+	/// <summary>True if some data is still waiting to be sent</summary>
+	bool HasPendingData();
+
+	/// <summary>Socket handle, to wait for socket events (Socket::WaitForEvents)</summary>
+	uintptr_t GetSocketHandle();
 };
\ No newline at end of file
@@ -11,6 +11,7 @@ private:
 	uint32_t _crc32 = 0;
 	NetplayControllerInfo _controller = {};
 	bool _paused = false;
+	uint32_t _rollbackFrames = 0;
 
 protected:
 	void Serialize(Serializer& s) override {
@@ -19,16 +20,18 @@ protected:
 		SV(_controller.Port);
 		SV(_controller.SubPort);
 		SV(_paused);
+		SV(_rollbackFrames);
 	}
 
 public:
 	GameInformationMessage(void* buffer, uint32_t length) : NetMessage(buffer, length) {}
 
-	GameInformationMessage(const string& filepath, uint32_t crc32, NetplayControllerInfo controller, bool paused) : NetMessage(MessageType::GameInformation) {
+	GameInformationMessage(const string& filepath, uint32_t crc32, NetplayControllerInfo controller, bool paused, uint32_t rollbackFrames) : NetMessage(MessageType::GameInformation) {
 		_romFilename = FolderUtilities::GetFilename(filepath, true);
 		_crc32 = crc32;
 		_controller = controller;
 		_paused = paused;
+		_rollbackFrames = rollbackFrames;
 	}
 
 	[[nodiscard]] NetplayControllerInfo GetPort() {
@@ -46,4 +49,9 @@ public:
 	[[nodiscard]] bool IsPaused() {
 		return _paused;
 	}
+
+	/// <summary>Rollback window used by the server (0 = delay-based netplay)</summary>
+	[[nodiscard]] uint32_t GetRollbackFrames() {
+		return _rollbackFrames;
+	}
 };
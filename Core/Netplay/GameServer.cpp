@@ -2,6 +2,7 @@
 #include "Netplay/GameServer.h"
 #include "Netplay/GameServerConnection.h"
 #include "Netplay/PlayerListMessage.h"
+#include "Netplay/MovieDataMessage.h"
 #include "Shared/Emulator.h"
 #include "Shared/BaseControlManager.h"
 #include "Shared/NotificationManager.h"
@@ -20,15 +21,19 @@ GameServer::~GameServer() {
 }
 
 void GameServer::RegisterServerInput() {
-	_emu->RegisterInputProvider(this);
-	_emu->RegisterInputRecorder(this);
+	if (_rollback) {
+		_emu->RegisterInputProvider(_rollback.get());
+	} else {
+		_emu->RegisterInputProvider(this);
+		_emu->RegisterInputRecorder(this);
+	}
 }
 
 void GameServer::AcceptConnections() {
 	while (true) {
 		unique_ptr<Socket> socket = _listener->Accept();
 		if (!socket->ConnectionError()) {
-			_openConnections.push_back(std::make_unique<GameServerConnection>(this, _emu, std::move(socket), _password));
+			_openConnections.push_back(std::make_unique<GameServerConnection>(this, _emu, std::move(socket), _password, _udpSocket.get()));
 		} else {
 			break;
 		}
@@ -43,12 +48,57 @@ void GameServer::UpdateConnections() {
 			// Pause emu thread to ensure nothing else modifies/accesses the _openConnections list while removing dead connections
 			auto lock = _emu->AcquireLock();
 			_openConnections.erase(_openConnections.begin() + i);
+			SendPlayerList();
 		} else {
 			_openConnections[i]->ProcessMessages();
 		}
 	}
 }
 
+void GameServer::ProcessUdpPackets() {
+	if (!_udpSocket) {
+		return;
+	}
+
+	uint8_t buffer[NetplayUdpChannel::MaxPacketSize];
+	UdpEndpoint from;
+	int length;
+	while ((length = _udpSocket->RecvFrom(buffer, sizeof(buffer), from)) >= 0) {
+		uint32_t token;
+		if (NetplayUdpChannel::ReadToken(buffer, length, token)) {
+			for (unique_ptr<GameServerConnection>& connection : _openConnections) {
+				if (connection->GetUdpToken() == token) {
+					connection->ProcessUdpPacket(buffer, length, from);
+					break;
+				}
+			}
+		}
+	}
+
+	for (unique_ptr<GameServerConnection>& connection : _openConnections) {
+		connection->FlushUdp();
+	}
+}
+
+void GameServer::WaitForEvents() {
+	vector<uintptr_t> readHandles;
+	vector<uintptr_t> writeHandles;
+	readHandles.push_back(_listener->GetHandle());
+	if (_udpSocket) {
+		readHandles.push_back(_udpSocket->GetHandle());
+	}
+	for (unique_ptr<GameServerConnection>& connection : _openConnections) {
+		readHandles.push_back(connection->GetSocketHandle());
+		if (connection->HasPendingData()) {
+			writeHandles.push_back(connection->GetSocketHandle());
+		}
+	}
+
+	// Messages sent by the emulation thread don't need this thread (they are sent right away, unless the socket's
+	// buffer is full), the timeout is only needed for the UDP keep alives
+	Socket::WaitForEvents(readHandles, writeHandles, GameServer::MaxWaitTime);
+}
+
 bool GameServer::SetInput(BaseControlDevice* device) {
 	uint8_t port = device->GetPort();
 	IControllerHub* hub = dynamic_cast<IControllerHub*>(device);
@@ -79,17 +129,29 @@ bool GameServer::SetInput(BaseControlDevice* device) {
 }
 
 void GameServer::RecordInput(const vector<shared_ptr<BaseControlDevice>>& devices) {
+	if (_openConnections.empty()) {
+		return;
+	}
+
 	for (const shared_ptr<BaseControlDevice>& device : devices) {
+		// Encoded once, every connection queues the same buffer
+		MovieDataMessage message(device->GetRawState(), device->GetPort());
+		shared_ptr<const string> data = std::make_shared<const string>(message.Encode());
 		for (unique_ptr<GameServerConnection>& connection : _openConnections) {
 			if (!connection->ConnectionError()) {
 				// Send movie stream
-				connection->SendMovieData(device->GetPort(), device->GetRawState());
+				connection->SendMovieData(data);
 			}
 		}
 	}
 }
 
 void GameServer::ProcessNotification(ConsoleNotificationType type, void* parameter) {
+	if (_rollback && (type == ConsoleNotificationType::GameLoaded || type == ConsoleNotificationType::GameReset || type == ConsoleNotificationType::StateLoaded)) {
+		// The states saved before this point no longer match the emulation, the clients are sent the new state
+		_rollback->ClearHistory();
+	}
+
 	for (unique_ptr<GameServerConnection>& connection : _openConnections) {
 		connection->ProcessNotification(type, parameter);
 	}
@@ -105,21 +167,49 @@ void GameServer::Exec() {
 	_listener->Bind(_port);
 	_listener->Listen(10);
 	_stop = false;
+
+	if (_useUdp) {
+		_udpSocket = std::make_unique<UdpSocket>();
+		if (!_udpSocket->Bind(_port, true)) {
+			// Clients use TCP for everything
+			_udpSocket.reset();
+		}
+	}
+
 	_initialized = true;
 	MessageManager::DisplayMessage("NetPlay", "ServerStarted", std::format("{}", _port));
 
 	while (!_stop) {
 		AcceptConnections();
 		UpdateConnections();
-
-		std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(1));
+		ProcessUdpPackets();
+		WaitForEvents();
 	}
 }
 
-void GameServer::StartServer(uint16_t port, const string& password) {
+void GameServer::StartServer(uint16_t port, const string& password, uint32_t rollbackFrames, bool useUdp) {
 	_port = port;
 	_password = password;
 
+	// Only the rollback input (tagged with frame numbers, sent redundantly) can be sent over UDP
+	_useUdp = useUdp && rollbackFrames > 0;
+
+	if (rollbackFrames > 0) {
+		_rollback = std::make_shared<NetplayRollback>(
+		    _emu, rollbackFrames,
+		    [this](NetplayControllerInfo controller, uint32_t frame, const ControlDeviceState& state) {
+			    // Host input, the server's frames never restart (sync id 0)
+			    SendRollbackInput(NetplayInputEntry{controller, 0, frame, state}, nullptr);
+		    },
+		    nullptr);
+		{
+			auto lock = _emu->AcquireLock();
+			_rollback->Reset(0);
+			_rollback->SetPlayers({}, _hostControllerPort);
+		}
+		_emu->SetNetplayRollback(_rollback);
+	}
+
 	_emu->GetNotificationManager()->RegisterNotificationListener(shared_from_this());
 
 	// If a game is already running, register ourselves as an input recorder/provider
@@ -143,10 +233,17 @@ void GameServer::StopServer() {
 	_openConnections.clear();
 	_initialized = false;
 	_listener.reset();
+	_udpSocket.reset();
 	MessageManager::DisplayMessage("NetPlay", "ServerStopped");
 
 	_emu->UnregisterInputRecorder(this);
 	_emu->UnregisterInputProvider(this);
+
+	if (_rollback) {
+		_emu->UnregisterInputProvider(_rollback.get());
+		_emu->SetNetplayRollback(nullptr);
+		_rollback.reset();
+	}
 }
 
 bool GameServer::Started() {
@@ -172,6 +269,9 @@ void GameServer::SetHostControllerPort(NetplayControllerInfo controller) {
 
 		// Port is available
 		_hostControllerPort = controller;
+		if (_rollback) {
+			_rollback->ResyncPlayer(controller);
+		}
 		SendPlayerList();
 	}
 }
@@ -232,10 +332,45 @@ vector<PlayerInfo> GameServer::GetPlayerList() {
 void GameServer::SendPlayerList() {
 	vector<PlayerInfo> playerList = GetPlayerList();
 
+	if (_rollback) {
+		// Called while the emulation is paused (player connected/disconnected or changed controller)
+		vector<NetplayControllerInfo> remotePlayers;
+		for (unique_ptr<GameServerConnection>& connection : _openConnections) {
+			remotePlayers.push_back(connection->GetControllerPort());
+		}
+		_rollback->SetPlayers(remotePlayers, _hostControllerPort);
+	}
+
+	PlayerListMessage message(playerList);
+	shared_ptr<const string> data = std::make_shared<const string>(message.Encode());
 	for (unique_ptr<GameServerConnection>& connection : _openConnections) {
 		// Send player list update to all connections
-		PlayerListMessage message(playerList);
-		connection->SendNetMessage(message);
+		connection->SendEncodedMessage(data);
+	}
+}
+
+void GameServer::SendRollbackInput(const NetplayInputEntry& entry, GameServerConnection* source) {
+	for (unique_ptr<GameServerConnection>& connection : _openConnections) {
+		if (connection.get() != source && !connection->ConnectionError()) {
+			connection->SendRollbackInput(entry);
+		}
+	}
+}
+
+void GameServer::ProcessRollbackInput(GameServerConnection* source, const NetplayInputEntry& entry) {
+	// Use the connection's controller, the client can't send input for another player
+	NetplayControllerInfo controller = source->GetControllerPort();
+	if (_rollback && controller.Port != GameConnection::SpectatorPort) {
+		_rollback->AddRemoteInput(controller, entry.Frame, entry.State);
+		SendRollbackInput(NetplayInputEntry{controller, entry.SyncId, entry.Frame, entry.State}, source);
+	}
+}
+
+void GameServer::ClearRelayedInput(GameServerConnection* source) {
+	for (unique_ptr<GameServerConnection>& connection : _openConnections) {
+		if (connection.get() != source) {
+			connection->ClearUdpQueue(source->GetControllerPort());
+		}
 	}
 }
 
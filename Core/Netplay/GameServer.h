@@ -2,11 +2,13 @@
 #include "pch.h"
 #include <thread>
 #include "Netplay/GameServerConnection.h"
+#include "Netplay/NetplayRollback.h"
 #include "Netplay/NetplayTypes.h"
 #include "Shared/Interfaces/INotificationListener.h"
 #include "Shared/Interfaces/IInputProvider.h"
 #include "Shared/Interfaces/IInputRecorder.h"
 #include "Shared/IControllerHub.h"
+#include "Utilities/UdpSocket.h"
 
 class Emulator;
 
@@ -16,8 +18,9 @@ class Emulator;
 /// </summary>
 /// <remarks>
 /// Architecture:
-/// - Dedicated accept thread for incoming connections
-/// - Per-client GameServerConnection (one thread per client)
+/// - A single server thread accepts the connections and reads/writes every client's socket (Exec), it waits for
+///   socket events with select() instead of polling
+/// - Per-client GameServerConnection, messages broadcast to every client (input, player list) are encoded once
 /// - Host player uses local input (IInputProvider)
 /// - Remote clients send input over TCP (IInputRecorder broadcasts)
 ///
@@ -26,6 +29,9 @@ class Emulator;
 /// - Server waits for all inputs before running frame
 /// - Input lag compensation for network latency
 /// - Deterministic replay ensures perfect sync
+/// - Rollback mode (rollbackFrames > 0): no waiting, every peer predicts the remote input and re-simulates
+///   mispredicted frames (see NetplayRollback), the server relays each player's input to the other clients
+/// - Optional UDP transport for the rollback input (see NetplayUdpChannel), on the same port number
 ///
 /// Controller management:
 /// - Up to 8 virtual ports (4 standard + 4 expansion)
@@ -54,6 +60,9 @@ private:
 	atomic<bool> _stop;
 	uint16_t _port = 0;
 	string _password;
+	shared_ptr<NetplayRollback> _rollback;
+	bool _useUdp = false;
+	unique_ptr<UdpSocket> _udpSocket;
 	vector<unique_ptr<GameServerConnection>> _openConnections;
 	bool _initialized = false;
 
@@ -61,8 +70,14 @@ private:
 
 	NetplayControllerInfo _hostControllerPort = {};
 
+	static constexpr int MaxWaitTime = 10; ///< Max time the server thread waits for socket events (ms)
+
 	void AcceptConnections();
 	void UpdateConnections();
+	void ProcessUdpPackets();
+
+	/// <summary>Waits until a socket can be read/written (new connection, message, UDP packet) or MaxWaitTime</summary>
+	void WaitForEvents();
 
 	void Exec();
 
@@ -72,7 +87,7 @@ public:
 
 	void RegisterServerInput();
 
-	void StartServer(uint16_t port, const string& password);
+	void StartServer(uint16_t port, const string& password, uint32_t rollbackFrames, bool useUdp);
 	void StopServer();
 	[[nodiscard]] bool Started();
 
@@ -82,6 +97,18 @@ public:
 	vector<PlayerInfo> GetPlayerList();
 	void SendPlayerList();
 
+	/// <summary>Rollback mode state (null for delay-based netplay)</summary>
+	[[nodiscard]] NetplayRollback* GetRollback() { return _rollback.get(); }
+
+	/// <summary>Sends a player's input to every client except the one it was received from (source)</summary>
+	void SendRollbackInput(const NetplayInputEntry& entry, GameServerConnection* source);
+
+	/// <summary>Input received from a client (rollback mode)</summary>
+	void ProcessRollbackInput(GameServerConnection* source, const NetplayInputEntry& entry);
+
+	/// <summary>A client was resynced: drops its old input that wasn't sent to the other clients yet</summary>
+	void ClearRelayedInput(GameServerConnection* source);
+
 	static vector<NetplayControllerUsageInfo> GetControllerList(Emulator* emu, vector<PlayerInfo>& players);
 
 	bool SetInput(BaseControlDevice* device) override;
@@ -12,17 +12,28 @@
 #include "Netplay/GameServer.h"
 #include "Netplay/ForceDisconnectMessage.h"
 #include "Netplay/ServerInformationMessage.h"
+#include "Netplay/RollbackInputMessage.h"
+#include "Netplay/RollbackChecksumMessage.h"
+#include "Netplay/UdpSetupMessage.h"
+#include "Netplay/NetplayRollback.h"
 #include "Netplay/NetplayTypes.h"
 #include "Shared/MessageManager.h"
 #include "Shared/Emulator.h"
 #include "Shared/EmuSettings.h"
 #include "Shared/BaseControlDevice.h"
 
-GameServerConnection::GameServerConnection(GameServer* gameServer, Emulator* emu, unique_ptr<Socket> socket, const string& serverPassword) : GameConnection(emu, std::move(socket)) {
+GameServerConnection::GameServerConnection(GameServer* gameServer, Emulator* emu, unique_ptr<Socket> socket, const string& serverPassword, UdpSocket* udpSocket) : GameConnection(emu, std::move(socket)) {
 	// Server-side connection
 	_server = gameServer;
 	_serverPassword = serverPassword;
 	_controllerPort = NetplayControllerInfo{GameConnection::SpectatorPort, 0};
+
+	if (udpSocket) {
+		std::random_device rd;
+		std::mt19937 engine(rd());
+		std::uniform_int_distribution<uint32_t> dist(1, UINT32_MAX);
+		_udp = std::make_unique<NetplayUdpChannel>(udpSocket, dist(engine), UdpEndpoint{});
+	}
 	SendServerInformation();
 }
 
@@ -50,16 +61,108 @@ void GameServerConnection::SendServerInformation() {
 void GameServerConnection::SendGameInformation() {
 	auto lock = _emu->AcquireLock();
 	RomInfo romInfo = _emu->GetRomInfo();
-	GameInformationMessage gameInfo(romInfo.RomFile.GetFileName(), _emu->GetCrc32(), _controllerPort, _emu->IsPaused());
+	NetplayRollback* rollback = _server->GetRollback();
+	uint32_t frame = rollback ? rollback->GetFrame() : 0;
+	if (rollback) {
+		// The client restarts from this state, the input it sent before receiving it is ignored
+		_syncId++;
+		_server->ClearRelayedInput(this);
+	}
+
+	GameInformationMessage gameInfo(romInfo.RomFile.GetFileName(), _emu->GetCrc32(), _controllerPort, _emu->IsPaused(), rollback ? rollback->GetWindow() : 0);
 	SendNetMessage(gameInfo);
-	SaveStateMessage saveState(_emu);
+	SaveStateMessage saveState(_emu, frame, _syncId, _stateBase);
 	SendNetMessage(saveState);
+
+	if (rollback) {
+		// Its input for the frames before this state will never be received
+		rollback->ResyncPlayer(_controllerPort);
+		_resyncFrame = frame;
+	}
 }
 
-void GameServerConnection::SendMovieData(uint8_t port, ControlDeviceState state) {
+void GameServerConnection::SendMovieData(const shared_ptr<const string>& data) {
 	if (_handshakeCompleted) {
-		MovieDataMessage message(state, port);
-		SendNetMessage(message);
+		SendEncodedMessage(data);
+	}
+}
+
+void GameServerConnection::SendRollbackInput(const NetplayInputEntry& entry) {
+	if (!_handshakeCompleted) {
+		return;
+	}
+
+	if (_udp) {
+		if (_udp->IsAlive()) {
+			// Sent right away, the server thread only flushes the channels after receiving packets (acks) and for keep alives
+			_udp->QueueInput(entry);
+			_udp->Flush();
+			return;
+		}
+
+		// No UDP packet received from the client recently, send whatever it may not have received over TCP
+		for (NetplayInputEntry& unacknowledged : _udp->TakeUnacknowledged()) {
+			SendTcpRollbackInput(unacknowledged);
+		}
+	}
+	SendTcpRollbackInput(entry);
+}
+
+void GameServerConnection::SendTcpRollbackInput(const NetplayInputEntry& entry) {
+	RollbackInputMessage message(entry);
+	SendNetMessage(message);
+}
+
+void GameServerConnection::ProcessUdpPacket(const uint8_t* data, int length, const UdpEndpoint& from) {
+	vector<NetplayInputEntry> entries;
+	_udp->ProcessPacket(data, length, from, entries);
+	if (_handshakeCompleted) {
+		for (NetplayInputEntry& entry : entries) {
+			if (entry.SyncId == _syncId) {
+				_server->ProcessRollbackInput(this, entry);
+			}
+		}
+	}
+}
+
+void GameServerConnection::FlushUdp() {
+	if (_udp && _handshakeCompleted) {
+		_udp->Flush();
+	}
+}
+
+void GameServerConnection::ClearUdpQueue(NetplayControllerInfo controller) {
+	if (_udp) {
+		_udp->ClearQueue(controller);
+	}
+}
+
+void GameServerConnection::ProcessRollbackChecksum(uint32_t frame, uint32_t checksum) {
+	NetplayRollback* rollback = _server->GetRollback();
+	if (!rollback || frame < _resyncFrame) {
+		return;
+	}
+
+	_pendingChecksums.push_back({frame, checksum});
+	for (auto it = _pendingChecksums.begin(); it != _pendingChecksums.end();) {
+		uint32_t serverChecksum;
+		if (!rollback->GetChecksum(it->Frame, serverChecksum)) {
+			// Not computed yet (the server is still waiting for some input)
+			it++;
+		} else if (serverChecksum != it->Checksum) {
+			// Client is out of sync, send it the server's state
+			MessageManager::DisplayMessage("NetPlay", "NetplayDesync", std::to_string(it->Frame));
+			_pendingChecksums.clear();
+			SendGameInformation();
+			return;
+		} else {
+			it = _pendingChecksums.erase(it);
+		}
+	}
+
+	if (_pendingChecksums.size() > GameServerConnection::MaxPendingChecksums) {
+		// The server's checksum for this frame is no longer available
+		_pendingChecksums.erase(_pendingChecksums.begin());
 	}
 }
 
@@ -100,6 +203,11 @@ void GameServerConnection::ProcessHandshakeResponse(HandShakeMessage* message) {
 			_handshakeCompleted = true;
 			_server->RegisterNetPlayDevice(this, _controllerPort);
 			_server->SendPlayerList();
+
+			if (_udp && _server->GetRollback()) {
+				UdpSetupMessage udpSetup(_udp->GetToken());
+				SendNetMessage(udpSetup);
+			}
 		} else {
 			SendForceDisconnectMessage("The password you provided did not match - you have been disconnected.");
 		}
@@ -131,6 +239,36 @@ void GameServerConnection::ProcessMessage(NetMessage* message) {
 			SelectControllerPort(((SelectControllerMessage*)message)->GetController());
 			break;
 
+		case MessageType::RollbackInput:
+			if (!_handshakeCompleted) {
+				SendForceDisconnectMessage("Handshake has not been completed - invalid packet");
+				return;
+			}
+			if (((RollbackInputMessage*)message)->GetEntry().SyncId == _syncId) {
+				_server->ProcessRollbackInput(this, ((RollbackInputMessage*)message)->GetEntry());
+			}
+			break;
+
+		case MessageType::StateRequest:
+			if (!_handshakeCompleted) {
+				SendForceDisconnectMessage("Handshake has not been completed - invalid packet");
+				return;
+			}
+			{
+				auto lock = _emu->AcquireLock();
+				_stateBase.Clear();
+				SendGameInformation();
+			}
+			break;
+
+		case MessageType::RollbackChecksum:
+			if (!_handshakeCompleted) {
+				SendForceDisconnectMessage("Handshake has not been completed - invalid packet");
+				return;
+			}
+			ProcessRollbackChecksum(((RollbackChecksumMessage*)message)->GetFrame(), ((RollbackChecksumMessage*)message)->GetChecksum());
+			break;
+
 		default:
 			break;
 	}
@@ -189,7 +327,7 @@ void GameServerConnection::ProcessNotification(ConsoleNotificationType type, voi
 
 		case ConsoleNotificationType::BeforeEmulationStop: {
 			// Make clients unload the current game
-			GameInformationMessage gameInfo("", 0, _controllerPort, true);
+			GameInformationMessage gameInfo("", 0, _controllerPort, true, 0);
 			SendNetMessage(gameInfo);
 			break;
 		}
@@ -3,6 +3,8 @@
 #include <deque>
 #include "Netplay/GameConnection.h"
 #include "Netplay/NetplayTypes.h"
+#include "Netplay/NetplayStateBase.h"
+#include "Netplay/NetplayUdpChannel.h"
 #include "Shared/Interfaces/INotificationListener.h"
 #include "Shared/BaseControlDevice.h"
 #include "Shared/ControlDeviceState.h"
@@ -61,6 +63,28 @@ private:
 	string _serverPassword;                     ///< Server password (hashed)
 	bool _handshakeCompleted = false;           ///< True after successful authentication
 
+	/// <summary>Checksum received from the client (rollback mode)</summary>
+	struct ClientChecksum {
+		uint32_t Frame;
+		uint32_t Checksum;
+	};
+	static constexpr size_t MaxPendingChecksums = 4;
+	vector<ClientChecksum> _pendingChecksums; ///< Checksums not compared yet (the server's is not computed yet)
+	atomic<uint32_t> _resyncFrame = 0;        ///< Rollback frame of the last state sent (older checksums are ignored)
+	atomic<uint16_t> _syncId = 0;             ///< Incremented each time the state is sent (older input is ignored)
+	unique_ptr<NetplayUdpChannel> _udp;       ///< UDP input channel (null when the server doesn't use UDP)
+	NetplayStateBase _stateBase;              ///< Last state sent to the client (the next one is sent as a delta), emu lock
+
+	/// <summary>
+	/// Send rollback input over TCP.
+	/// </summary>
+	void SendTcpRollbackInput(const NetplayInputEntry& entry);
+
+	/// <summary>
+	/// Compare a client's state checksum with the server's, and resend the state on mismatch.
+	/// </summary>
+	void ProcessRollbackChecksum(uint32_t frame, uint32_t checksum);
+
 	/// <summary>
 	/// Store input state from client.
 	/// </summary>
@@ -139,6 +163,7 @@ protected:
 	/// - HandShake: Authenticate client
 	/// - InputData: Store input for current frame
 	/// - SelectController: Assign controller port
+	/// - RollbackInput/RollbackChecksum: Client input/state checksum (rollback mode)
 	/// </remarks>
 	void ProcessMessage(NetMessage* message) override;
 
@@ -150,7 +175,8 @@ public:
 	/// <param name="emu">Emulator instance</param>
 	/// <param name="socket">Connected client socket</param>
 	/// <param name="serverPassword">Server password hash</param>
-	GameServerConnection(GameServer* gameServer, Emulator* emu, unique_ptr<Socket> socket, const string& serverPassword);
+	/// <param name="udpSocket">Server's UDP socket (null if the server doesn't use UDP)</param>
+	GameServerConnection(GameServer* gameServer, Emulator* emu, unique_ptr<Socket> socket, const string& serverPassword, UdpSocket* udpSocket);
 	virtual ~GameServerConnection();
 
 	/// <summary>
@@ -166,13 +192,39 @@ public:
 	/// <summary>
 	/// Send movie data frame to client.
 	/// </summary>
-	/// <param name="port">Controller port</param>
-	/// <param name="state">Input state for this port</param>
+	/// <param name="data">Encoded MovieDataMessage (shared by all connections)</param>
 	/// <remarks>
 	/// Called by GameServer::RecordInput() to broadcast inputs.
-	/// Sends MovieDataMessage containing all player inputs for frame.
 	/// </remarks>
-	void SendMovieData(uint8_t port, ControlDeviceState state);
+	void SendMovieData(const shared_ptr<const string>& data);
+
+	/// <summary>
+	/// Send a player's input for a frame to client (rollback mode).
+	/// </summary>
+	/// <remarks>
+	/// Sent over UDP when the client's UDP packets are being received, over TCP otherwise.
+	/// </remarks>
+	void SendRollbackInput(const NetplayInputEntry& entry);
+
+	/// <summary>
+	/// Token identifying this connection in UDP packets (0 if UDP is not used).
+	/// </summary>
+	[[nodiscard]] uint32_t GetUdpToken() { return _udp ? _udp->GetToken() : 0; }
+
+	/// <summary>
+	/// Process a UDP packet received from this client (server thread).
+	/// </summary>
+	void ProcessUdpPacket(const uint8_t* data, int length, const UdpEndpoint& from);
+
+	/// <summary>
+	/// Send pending UDP input/acknowledgments (server thread).
+	/// </summary>
+	void FlushUdp();
+
+	/// <summary>
+	/// Drop the input of a player queued for UDP (player was resynced).
+	/// </summary>
+	void ClearUdpQueue(NetplayControllerInfo controller);
 
 	/// <summary>
 	/// Get assigned controller port.
@@ -9,6 +9,7 @@
 /// 1. Client → Server: HandShake (password, version, player name)
 /// 2. Server → Client: ServerInformation (ROM CRC, settings, player list)
 /// 3. Server → Client: SaveState (if late-join, sync to current game state)
+///    - Later SaveStates are a delta against the previous one, the client replies StateRequest if it can't apply it
 /// 4. Client → Server: SelectController (choose controller port)
 /// 5. Gameplay:
 ///    - Client → Server: InputData (every frame)
@@ -16,6 +17,12 @@
 /// 6. Server → Client: GameInformation (on ROM change/reset)
 /// 7. Server → Client: ForceDisconnect (kick/ban player)
 ///
+/// Rollback mode (GameInformation with a rollback window) replaces step 5:
+///    - Client → Server → Other Clients: RollbackInput (each player's input, tagged with the frame number)
+///    - Server → All Clients: RollbackInput (host input)
+///    - Client → Server: RollbackChecksum (state checksum, server resends SaveState on mismatch)
+///    - Server → Client: UdpSetup (optional, RollbackInput is then sent over UDP, see NetplayUdpChannel)
+///
 /// Message format:
 /// - 4 bytes: Message length (uint32_t)
 /// - 1 byte: MessageType enum
@@ -30,5 +37,9 @@ enum class MessageType : uint8_t {
 	PlayerList = 5,       ///< Connected player list update
 	SelectController = 6, ///< Controller port selection request
 	ForceDisconnect = 7,  ///< Server disconnect command (kick/ban)
-	ServerInformation = 8 ///< Server info (name, version, password required)
+	ServerInformation = 8, ///< Server info (name, version, password required)
+	RollbackInput = 9,     ///< Player input for a given frame (rollback mode)
+	RollbackChecksum = 10, ///< State checksum for a given frame (rollback mode)
+	UdpSetup = 11,         ///< UDP input channel token (rollback mode)
+	StateRequest = 12      ///< Client can't apply a SaveState delta, asks for a full state
 };
\ No newline at end of file
@@ -89,21 +89,17 @@ public:
 	}
 
 	/// <summary>
-	/// Serialize and send message over socket.
+	/// Serialize message to the wire format (see GameConnection::SendNetMessage).
 	/// </summary>
-	/// <param name="socket">TCP socket for transmission</param>
 	/// <remarks>
 	/// Wire format:
 	/// - 4 bytes: uint32_t message length (including type byte)
 	/// - 1 byte: MessageType
 	/// - N bytes: Serialized message data
 	///
-	/// Blocking send:
-	/// - May block if socket send buffer is full
-	/// - Typically < 1ms for small messages (input data)
-	/// - May take 100ms+ for large messages (save states)
+	/// A message sent to several connections is only encoded once (see GameConnection::SendEncodedMessage).
 	/// </remarks>
-	void Send(Socket& socket) {
+	string Encode() {
 		Serializer s(SaveStateManager::FileFormatVersion, true);
 		Serialize(s);
 
@@ -112,8 +108,7 @@ public:
 
 		string data = out.str();
 		uint32_t messageLength = (uint32_t)data.size() + 1;
-		data = string((char*)&messageLength, 4) + (char)_type + data;
-		socket.Send((char*)data.c_str(), (int)data.size(), 0);
+		return string((char*)&messageLength, 4) + (char)_type + data;
 	}
 
 protected:
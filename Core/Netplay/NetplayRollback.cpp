@@ -0,0 +1,283 @@
+#include "pch.h"
+#include "Netplay/NetplayRollback.h"
+#include "Netplay/GameConnection.h"
+#include "Shared/Emulator.h"
+#include "Shared/BaseControlManager.h"
+#include "Shared/Interfaces/IConsole.h"
+
+NetplayRollback::NetplayRollback(Emulator* emu, uint32_t window, InputHandler sendInput, ChecksumHandler sendChecksum) {
+	_emu = emu;
+	_window = std::clamp<uint32_t>(window, 1, NetplayRollback::MaxFrames);
+	_sendInput = sendInput;
+	_sendChecksum = sendChecksum;
+
+	for (int i = 0; i < NetplayRollback::SlotCount; i++) {
+		_players.push_back(std::make_unique<PlayerHistory>());
+	}
+	for (uint32_t i = 0; i <= _window; i++) {
+		_frames.push_back(std::make_unique<FrameState>());
+	}
+	Reset(0);
+}
+
+void NetplayRollback::Reset(uint32_t frame) {
+	_currentFrame = frame;
+	_frame = frame;
+	_firstFrame = frame;
+	_lastChecksumFrame = -1;
+
+	for (unique_ptr<FrameState>& state : _frames) {
+		state->Frame = -1;
+	}
+
+	for (unique_ptr<PlayerHistory>& player : _players) {
+		std::fill(std::begin(player->Frames), std::end(player->Frames), -1);
+		player->LastFrame = (int64_t)frame - 1;
+	}
+
+	auto lock = _lock.AcquireSafe();
+	for (FrameChecksum& checksum : _checksums) {
+		checksum = {};
+	}
+}
+
+void NetplayRollback::ClearHistory() {
+	_firstFrame = _currentFrame;
+}
+
+void NetplayRollback::SetPlayers(const vector<NetplayControllerInfo>& remotePlayers, NetplayControllerInfo localPlayer) {
+	for (unique_ptr<PlayerHistory>& player : _players) {
+		// Keep the input history: a player that left keeps their last input, the same way on every peer
+		player->IsRemote = false;
+	}
+
+	for (const NetplayControllerInfo& controller : remotePlayers) {
+		int slot = GetSlot(controller);
+		if (controller.Port != GameConnection::SpectatorPort && slot < NetplayRollback::SlotCount) {
+			_players[slot]->IsRemote = true;
+		}
+	}
+
+	int localSlot = GetSlot(localPlayer);
+	localSlot = localPlayer.Port != GameConnection::SpectatorPort && localSlot < NetplayRollback::SlotCount ? localSlot : -1;
+	if (localSlot != _localSlot) {
+		_localSlot = localSlot;
+		_localDevice.reset();
+	}
+}
+
+void NetplayRollback::ResyncPlayer(NetplayControllerInfo controller) {
+	int slot = GetSlot(controller);
+	if (controller.Port != GameConnection::SpectatorPort && slot < NetplayRollback::SlotCount) {
+		PlayerHistory& player = *_players[slot];
+		player.LastFrame = std::max<int64_t>(player.LastFrame, (int64_t)_currentFrame - 1);
+	}
+}
+
+void NetplayRollback::AddRemoteInput(NetplayControllerInfo controller, uint32_t frame, const ControlDeviceState& state) {
+	int slot = GetSlot(controller);
+	if (controller.Port == GameConnection::SpectatorPort || slot >= NetplayRollback::SlotCount) {
+		return;
+	}
+
+	{
+		auto lock = _lock.AcquireSafe();
+		_received.push_back({slot, frame, state});
+	}
+	_inputReceived.Signal();
+}
+
+bool NetplayRollback::GetChecksum(uint32_t frame, uint32_t& checksum) {
+	auto lock = _lock.AcquireSafe();
+	for (FrameChecksum& entry : _checksums) {
+		if (entry.Frame == frame) {
+			checksum = entry.Checksum;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool NetplayRollback::IsSaved(uint32_t frame) {
+	return frame >= _firstFrame && frame < _currentFrame && GetFrameState(frame).Frame == frame;
+}
+
+bool NetplayRollback::IsConfirmed(uint32_t frame) {
+	for (int i = 0; i < NetplayRollback::SlotCount; i++) {
+		if (_players[i]->IsRemote && i != _localSlot && _players[i]->LastFrame < (int64_t)frame - 1) {
+			return false;
+		}
+	}
+	return true;
+}
+
+uint32_t NetplayRollback::ProcessReceivedInput() {
+	vector<ReceivedInput> received;
+	{
+		auto lock = _lock.AcquireSafe();
+		received.swap(_received);
+	}
+
+	uint32_t rollbackFrame = _currentFrame;
+	for (ReceivedInput& input : received) {
+		if (input.Frame < _firstFrame) {
+			// Sent before the last reset/resync, the state it applies to is gone
+			continue;
+		}
+
+		PlayerHistory& player = *_players[input.Slot];
+		uint32_t index = input.Frame % NetplayRollback::HistorySize;
+		player.Inputs[index] = input.State;
+		player.Frames[index] = input.Frame;
+		player.LastFrame = std::max<int64_t>(player.LastFrame, input.Frame);
+
+		if (input.Frame < _currentFrame && IsSaved(input.Frame)) {
+			FrameState& state = GetFrameState(input.Frame);
+			if (!state.HasInput[input.Slot] || state.Used[input.Slot] != input.State) {
+				// Misprediction, the frame (and every frame after it) must be run again
+				rollbackFrame = std::min(rollbackFrame, input.Frame);
+			}
+		}
+		// Input received for a frame that is already out of the window can't be corrected anymore,
+		// the desync is fixed by the checksum check
+	}
+	return rollbackFrame;
+}
+
+void NetplayRollback::ProcessChecksums() {
+	uint32_t firstFrame = std::max(_firstFrame, _currentFrame > _window ? _currentFrame - _window : 0);
+	for (uint32_t frame = firstFrame; frame < _currentFrame; frame++) {
+		if (frame % NetplayRollback::ChecksumInterval != 0 || (int64_t)frame <= _lastChecksumFrame || !IsSaved(frame) || !IsConfirmed(frame)) {
+			continue;
+		}
+
+		uint32_t checksum = GetFrameState(frame).State.GetChecksum();
+		{
+			auto lock = _lock.AcquireSafe();
+			_checksums[(frame / NetplayRollback::ChecksumInterval) % NetplayRollback::ChecksumHistorySize] = {frame, checksum};
+		}
+		_lastChecksumFrame = frame;
+
+		if (_sendChecksum) {
+			_sendChecksum(frame, checksum);
+		}
+	}
+}
+
+bool NetplayRollback::CanRunFrame() {
+	for (int i = 0; i < NetplayRollback::SlotCount; i++) {
+		if (_players[i]->IsRemote && i != _localSlot && (int64_t)_currentFrame - _players[i]->LastFrame > _window) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void NetplayRollback::WaitForInput() {
+	_inputReceived.Wait(5);
+}
+
+RunAheadState& NetplayRollback::GetState(uint32_t frame) {
+	return GetFrameState(frame).State;
+}
+
+void NetplayRollback::BeginFrame(uint32_t frame) {
+	FrameState& state = GetFrameState(frame);
+	state.Frame = frame;
+	std::fill(std::begin(state.HasInput), std::end(state.HasInput), false);
+	_frame = frame;
+}
+
+void NetplayRollback::EndFrame() {
+	_currentFrame++;
+}
+
+bool NetplayRollback::SetInput(BaseControlDevice* device) {
+	uint8_t port = device->GetPort();
+	IControllerHub* hub = dynamic_cast<IControllerHub*>(device);
+	if (hub) {
+		for (int i = 0, len = hub->GetHubPortCount(); i < len; i++) {
+			shared_ptr<BaseControlDevice> hubController = hub->GetController(i);
+			if (hubController) {
+				SetControllerInput(hubController.get(), NetplayControllerInfo{port, (uint8_t)i});
+			}
+		}
+		hub->RefreshHubState();
+	} else {
+		SetControllerInput(device, NetplayControllerInfo{port, 0});
+	}
+	return true;
+}
+
+void NetplayRollback::SetControllerInput(BaseControlDevice* device, NetplayControllerInfo controller) {
+	int slot = GetSlot(controller);
+	if (slot >= NetplayRollback::SlotCount) {
+		return;
+	}
+
+	FrameState& frameState = GetFrameState(_frame);
+	ControlDeviceState state;
+	if (frameState.HasInput[slot]) {
+		// Polled more than once in the same frame
+		state = frameState.Used[slot];
+	} else if (slot == _localSlot) {
+		state = GetLocalInput(device, controller);
+	} else {
+		state = GetRemoteInput(device, slot);
+	}
+
+	frameState.Used[slot] = state;
+	frameState.HasInput[slot] = true;
+	device->SetRawState(state);
+}
+
+ControlDeviceState NetplayRollback::GetLocalInput(BaseControlDevice* device, NetplayControllerInfo controller) {
+	PlayerHistory& player = *_players[_localSlot];
+	uint32_t index = _frame % NetplayRollback::HistorySize;
+	if (player.Frames[index] == _frame) {
+		// Frame is being re-simulated, use the input that was sent for it
+		return player.Inputs[index];
+	}
+
+	if (!_localDevice || _localDevice->GetControllerType() != device->GetControllerType()) {
+		// Pretend we are using port 0 (to use player 1's keybindings during netplay)
+		_localDevice = _emu->GetConsole()->GetControlManager()->CreateControllerDevice(device->GetControllerType(), 0);
+	}
+
+	ControlDeviceState state;
+	if (_localDevice) {
+		_localDevice->SetStateFromInput();
+		state = _localDevice->GetRawState();
+	} else {
+		device->ClearState();
+		state = device->GetRawState();
+	}
+
+	player.Inputs[index] = state;
+	player.Frames[index] = _frame;
+	player.LastFrame = _frame;
+	if (_sendInput) {
+		_sendInput(controller, _frame, state);
+	}
+	return state;
+}
+
+ControlDeviceState NetplayRollback::GetRemoteInput(BaseControlDevice* device, int slot) {
+	PlayerHistory& player = *_players[slot];
+	uint32_t index = _frame % NetplayRollback::HistorySize;
+	if (player.Frames[index] == _frame) {
+		return player.Inputs[index];
+	}
+
+	if (player.LastFrame >= 0 && player.LastFrame < _frame) {
+		// Not received yet, predict that the player is still pressing the same buttons
+		uint32_t lastIndex = player.LastFrame % NetplayRollback::HistorySize;
+		if (player.Frames[lastIndex] == player.LastFrame) {
+			return player.Inputs[lastIndex];
+		}
+	}
+
+	// No input received for this controller
+	device->ClearState();
+	return device->GetRawState();
+}
@@ -0,0 +1,160 @@
+#pragma once
+#include "pch.h"
+#include <functional>
+#include "Netplay/NetplayTypes.h"
+#include "Shared/BaseControlDevice.h"
+#include "Shared/ControlDeviceState.h"
+#include "Shared/IControllerHub.h"
+#include "Shared/Interfaces/IInputProvider.h"
+#include "Shared/RunAheadSnapshot.h"
+#include "Utilities/AutoResetEvent.h"
+#include "Utilities/SimpleLock.h"
+
+class Emulator;
+
+/// <summary>
+/// Rollback netplay: runs the remote players with predicted input, and re-simulates the frames that were
+/// mispredicted once their real input is received.
+/// </summary>
+/// <remarks>
+/// Every peer (server and clients) runs the same frames, numbered from the frame at which the server sent its
+/// save state. Each peer sends its local input for every frame, tagged with the frame number (the server relays
+/// the clients' input to the other clients). Remote input that hasn't been received yet is predicted by repeating
+/// the last input received for that player.
+///
+/// Before each frame runs, its state is saved with the run-ahead snapshot path (FastBinary serializer + page
+/// tracked RAM copies) in a ring of "rollback window + 1" states. When the input received for a past frame doesn't
+/// match the input that was used, Emulator::RunFrameWithRollback loads that frame's state and re-runs every frame
+/// up to the current one, with rendering and audio skipped like run-ahead frames. A peer that gets more than the
+/// rollback window ahead of the last input received from a remote player waits for it instead of running ahead.
+///
+/// Desyncs (e.g input received too late to be corrected) are detected with a checksum of the state of every
+/// ChecksumInterval-th frame, computed once all the input before that frame is known. Clients send theirs to the
+/// server, which sends its save state again when they don't match.
+///
+/// Thread safety: input and checksums are received on the network threads (protected by _lock), everything else is
+/// only used by the emulation thread, or while it is paused (Emulator::AcquireLock).
+/// </remarks>
+class NetplayRollback final : public IInputProvider {
+public:
+	static constexpr uint32_t MaxFrames = 10;        ///< Largest rollback window (a state is kept for each frame)
+	static constexpr uint32_t ChecksumInterval = 60; ///< Frames between desync checks
+
+	using InputHandler = std::function<void(NetplayControllerInfo controller, uint32_t frame, const ControlDeviceState& state)>;
+	using ChecksumHandler = std::function<void(uint32_t frame, uint32_t checksum)>;
+
+private:
+	static constexpr int SlotCount = BaseControlDevice::PortCount * IControllerHub::MaxSubPorts;
+	static constexpr uint32_t HistorySize = 128; ///< Input kept per player, must be larger than the window
+	static constexpr uint32_t ChecksumHistorySize = 8;
+
+	struct PlayerHistory {
+		ControlDeviceState Inputs[HistorySize];
+		int64_t Frames[HistorySize];
+		int64_t LastFrame = -1; ///< Last frame received (input is received in order)
+		bool IsRemote = false;  ///< A remote player is using this controller (the local peer waits for its input)
+	};
+
+	struct FrameState {
+		int64_t Frame = -1;
+		RunAheadState State;                  ///< State at the start of the frame
+		ControlDeviceState Used[SlotCount];   ///< Input used for each controller during the frame
+		bool HasInput[SlotCount] = {};
+	};
+
+	struct ReceivedInput {
+		int Slot;
+		uint32_t Frame;
+		ControlDeviceState State;
+	};
+
+	struct FrameChecksum {
+		int64_t Frame = -1;
+		uint32_t Checksum = 0;
+	};
+
+	Emulator* _emu = nullptr;
+	uint32_t _window = 0;
+	InputHandler _sendInput;
+	ChecksumHandler _sendChecksum;
+
+	vector<unique_ptr<PlayerHistory>> _players;
+	vector<unique_ptr<FrameState>> _frames;
+	int _localSlot = -1;
+	shared_ptr<BaseControlDevice> _localDevice;
+
+	uint32_t _currentFrame = 0;    ///< Next frame to run
+	uint32_t _frame = 0;           ///< Frame being run or re-simulated
+	uint32_t _firstFrame = 0;      ///< Oldest frame that can be re-simulated (last reset/resync)
+	int64_t _lastChecksumFrame = -1;
+
+	SimpleLock _lock;
+	vector<ReceivedInput> _received;
+	FrameChecksum _checksums[ChecksumHistorySize] = {};
+	AutoResetEvent _inputReceived;
+
+	[[nodiscard]] static int GetSlot(NetplayControllerInfo controller) {
+		return controller.Port * IControllerHub::MaxSubPorts + controller.SubPort;
+	}
+
+	[[nodiscard]] FrameState& GetFrameState(uint32_t frame) { return *_frames[frame % _frames.size()]; }
+	[[nodiscard]] bool IsSaved(uint32_t frame);
+	[[nodiscard]] bool IsConfirmed(uint32_t frame);
+
+	void SetControllerInput(BaseControlDevice* device, NetplayControllerInfo controller);
+	ControlDeviceState GetLocalInput(BaseControlDevice* device, NetplayControllerInfo controller);
+	ControlDeviceState GetRemoteInput(BaseControlDevice* device, int slot);
+
+public:
+	/// <param name="window">Rollback window, in frames (1 to MaxFrames)</param>
+	/// <param name="sendInput">Called on the emulation thread with the local input, once per frame</param>
+	/// <param name="sendChecksum">Called on the emulation thread with the checksum of each checked frame (clients only)</param>
+	NetplayRollback(Emulator* emu, uint32_t window, InputHandler sendInput, ChecksumHandler sendChecksum);
+
+	[[nodiscard]] uint32_t GetWindow() const { return _window; }
+
+	/// <summary>Next frame to run</summary>
+	[[nodiscard]] uint32_t GetFrame() const { return _currentFrame; }
+
+	/// <summary>Restarts at the given frame (e.g the server's save state was loaded), forgetting all input and states</summary>
+	void Reset(uint32_t frame);
+
+	/// <summary>States saved before the current frame can no longer be loaded (e.g the console was reset)</summary>
+	void ClearHistory();
+
+	/// <summary>Sets the controllers used by the remote players and the local player (SpectatorPort for none)</summary>
+	void SetPlayers(const vector<NetplayControllerInfo>& remotePlayers, NetplayControllerInfo localPlayer);
+
+	/// <summary>The player was sent the current state: their input starts at the current frame</summary>
+	void ResyncPlayer(NetplayControllerInfo controller);
+
+	/// <summary>Network threads: queues the input a remote player used for a frame</summary>
+	void AddRemoteInput(NetplayControllerInfo controller, uint32_t frame, const ControlDeviceState& state);
+
+	/// <summary>Network threads: gets the checksum computed for a frame, if it's still in the history</summary>
+	[[nodiscard]] bool GetChecksum(uint32_t frame, uint32_t& checksum);
+
+	/// <summary>Processes the input received since the last call</summary>
+	/// <returns>First frame that must be re-simulated (the current frame when no input was mispredicted)</returns>
+	uint32_t ProcessReceivedInput();
+
+	/// <summary>Computes the checksum of the frames whose input is now known</summary>
+	void ProcessChecksums();
+
+	/// <summary>False if running the next frame would get further ahead of a remote player than the window allows</summary>
+	[[nodiscard]] bool CanRunFrame();
+
+	/// <summary>Waits (a few milliseconds at most) for remote input to be received</summary>
+	void WaitForInput();
+
+	/// <summary>State saved at the start of the given frame (must be within the window)</summary>
+	[[nodiscard]] RunAheadState& GetState(uint32_t frame);
+
+	/// <summary>Starts running (or re-simulating) the given frame, after its state was saved or loaded</summary>
+	void BeginFrame(uint32_t frame);
+
+	/// <summary>The current frame was run, moves on to the next one</summary>
+	void EndFrame();
+
+	bool SetInput(BaseControlDevice* device) override;
+};
@@ -0,0 +1,33 @@
+#include "pch.h"
+#include <cstring>
+#include "Netplay/NetplayStateBase.h"
+
+void NetplayStateBase::Set(uint32_t id, vector<uint8_t> data) {
+	_id = id;
+	_data = std::move(data);
+}
+
+void NetplayStateBase::Clear() {
+	_id = 0;
+	_data.clear();
+	_data.shrink_to_fit();
+}
+
+void NetplayStateBase::ApplyDelta(vector<uint8_t>& data) const {
+	// Bytes past the end of the shorter buffer are left as is
+	size_t size = std::min(data.size(), _data.size());
+	uint8_t* dst = data.data();
+	const uint8_t* src = _data.data();
+
+	size_t i = 0;
+	for (; i + 8 <= size; i += 8) {
+		uint64_t a, b;
+		memcpy(&a, dst + i, 8);
+		memcpy(&b, src + i, 8);
+		a ^= b;
+		memcpy(dst + i, &a, 8);
+	}
+	for (; i < size; i++) {
+		dst[i] ^= src[i];
+	}
+}
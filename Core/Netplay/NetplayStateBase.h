@@ -0,0 +1,32 @@
+#pragma once
+#include "pch.h"
+
+/// <summary>
+/// Last save state sent to (server) or loaded by (client) a netplay client, used as the base of the next state's delta.
+/// </summary>
+/// <remarks>
+/// Consecutive states of the same game are mostly identical (the CPU/PPU registers and the parts of the RAM that
+/// changed), so the state is sent XORed with the previous one: the unchanged bytes become zeroes, which the message's
+/// compression reduces to almost nothing. This keeps the resyncs (checksum mismatch, pause, settings change) cheap,
+/// the first state sent to a client is still a full state.
+///
+/// XOR is lossless whatever the 2 states contain (even if their size differs), the only requirement is for both
+/// sides to use the same base, which is identified by its id (0 = no base).
+/// </remarks>
+class NetplayStateBase {
+private:
+	uint32_t _id = 0;
+	vector<uint8_t> _data;
+
+public:
+	[[nodiscard]] uint32_t GetId() const { return _id; }
+
+	/// <summary>Next id to use (never 0)</summary>
+	[[nodiscard]] uint32_t GetNextId() const { return _id + 1 == 0 ? 1 : _id + 1; }
+
+	void Set(uint32_t id, vector<uint8_t> data);
+	void Clear();
+
+	/// <summary>XORs data with the base (the same call encodes and decodes the delta)</summary>
+	void ApplyDelta(vector<uint8_t>& data) const;
+};
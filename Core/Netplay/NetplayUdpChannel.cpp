@@ -0,0 +1,235 @@
+#include "pch.h"
+#include "Netplay/NetplayUdpChannel.h"
+
+namespace {
+	void Write8(vector<uint8_t>& out, uint8_t value) {
+		out.push_back(value);
+	}
+
+	void Write16(vector<uint8_t>& out, uint16_t value) {
+		out.push_back((uint8_t)value);
+		out.push_back((uint8_t)(value >> 8));
+	}
+
+	void Write32(vector<uint8_t>& out, uint32_t value) {
+		Write16(out, (uint16_t)value);
+		Write16(out, (uint16_t)(value >> 16));
+	}
+
+	/// <summary>Bounds-checked reader for received packets (reads 0 and sets Error past the end)</summary>
+	struct PacketReader {
+		const uint8_t* Data;
+		int Length;
+		int Pos = 0;
+		bool Error = false;
+
+		uint8_t Read8() {
+			if (Pos >= Length) {
+				Error = true;
+				return 0;
+			}
+			return Data[Pos++];
+		}
+
+		uint16_t Read16() {
+			uint16_t value = Read8();
+			return value | (Read8() << 8);
+		}
+
+		uint32_t Read32() {
+			uint32_t value = Read16();
+			return value | ((uint32_t)Read16() << 16);
+		}
+	};
+}
+
+NetplayUdpChannel::NetplayUdpChannel(UdpSocket* socket, uint32_t token, UdpEndpoint endpoint) {
+	_socket = socket;
+	_token = token;
+	_endpoint = endpoint;
+	_learnEndpoint = !endpoint.IsValid();
+}
+
+bool NetplayUdpChannel::ReadToken(const uint8_t* data, int length, uint32_t& token) {
+	PacketReader reader{data, length};
+	uint16_t magic = reader.Read16();
+	token = reader.Read32();
+	return !reader.Error && magic == NetplayUdpChannel::Magic;
+}
+
+bool NetplayUdpChannel::IsAlive() {
+	auto lock = _lock.AcquireSafe();
+	return _hasReceived && _lastReceive.GetElapsedMS() < NetplayUdpChannel::Timeout;
+}
+
+void NetplayUdpChannel::QueueInput(const NetplayInputEntry& entry) {
+	int slot = GetSlot(entry.Controller);
+	if (slot >= NetplayUdpChannel::SlotCount || entry.State.State.size() > 0xFF) {
+		return;
+	}
+
+	auto lock = _lock.AcquireSafe();
+	std::deque<NetplayInputEntry>& queue = _queues[slot];
+	if (queue.size() >= NetplayUdpChannel::MaxQueueSize) {
+		// Peer stopped acknowledging (the sender falls back to TCP before this happens)
+		queue.pop_front();
+	}
+	queue.push_back(entry);
+	_sendPending = true;
+}
+
+vector<NetplayInputEntry> NetplayUdpChannel::TakeUnacknowledged() {
+	vector<NetplayInputEntry> entries;
+	auto lock = _lock.AcquireSafe();
+	for (std::deque<NetplayInputEntry>& queue : _queues) {
+		entries.insert(entries.end(), queue.begin(), queue.end());
+		queue.clear();
+	}
+	return entries;
+}
+
+void NetplayUdpChannel::ClearQueue(NetplayControllerInfo controller) {
+	int slot = GetSlot(controller);
+	if (slot < NetplayUdpChannel::SlotCount) {
+		auto lock = _lock.AcquireSafe();
+		_queues[slot].clear();
+	}
+}
+
+void NetplayUdpChannel::ClearQueues() {
+	auto lock = _lock.AcquireSafe();
+	for (std::deque<NetplayInputEntry>& queue : _queues) {
+		queue.clear();
+	}
+}
+
+void NetplayUdpChannel::ProcessPacket(const uint8_t* data, int length, const UdpEndpoint& from, vector<NetplayInputEntry>& delivered) {
+	PacketReader reader{data, length};
+	if (reader.Read16() != NetplayUdpChannel::Magic || reader.Read32() != _token) {
+		return;
+	}
+
+	auto lock = _lock.AcquireSafe();
+	if (_learnEndpoint) {
+		// Reply to the address the packets come from (the client's public address/port, when behind a NAT)
+		_endpoint = from;
+	}
+	_hasReceived = true;
+	_lastReceive.Reset();
+
+	// Acknowledgments: drop the input the peer already has
+	uint8_t ackCount = reader.Read8();
+	for (int i = 0; i < ackCount && !reader.Error; i++) {
+		NetplayControllerInfo controller;
+		controller.Port = reader.Read8();
+		controller.SubPort = reader.Read8();
+		uint16_t syncId = reader.Read16();
+		uint32_t frame = reader.Read32();
+
+		int slot = GetSlot(controller);
+		if (reader.Error || slot >= NetplayUdpChannel::SlotCount) {
+			break;
+		}
+
+		std::deque<NetplayInputEntry>& queue = _queues[slot];
+		while (!queue.empty() && queue.front().SyncId == syncId && (int32_t)(frame - queue.front().Frame) >= 0) {
+			queue.pop_front();
+		}
+	}
+
+	uint8_t entryCount = reader.Read8();
+	for (int i = 0; i < entryCount && !reader.Error; i++) {
+		NetplayInputEntry entry;
+		entry.Controller.Port = reader.Read8();
+		entry.Controller.SubPort = reader.Read8();
+		entry.SyncId = reader.Read16();
+		entry.Frame = reader.Read32();
+		uint8_t size = reader.Read8();
+		entry.State.State.resize(size);
+		for (int j = 0; j < size; j++) {
+			entry.State.State[j] = reader.Read8();
+		}
+
+		int slot = GetSlot(entry.Controller);
+		if (reader.Error || slot >= NetplayUdpChannel::SlotCount) {
+			break;
+		}
+
+		ReceiveState& received = _received[slot];
+		if (!received.Valid || (int16_t)(entry.SyncId - received.SyncId) > 0) {
+			// First input for this controller, or the player was resynced (frames restart)
+			received.Valid = true;
+			received.SyncId = entry.SyncId;
+			received.Frame = entry.Frame - 1;
+		} else if (entry.SyncId != received.SyncId) {
+			// Late packet from before the resync
+			continue;
+		}
+
+		if (entry.Frame == received.Frame + 1) {
+			received.Frame = entry.Frame;
+			delivered.push_back(std::move(entry));
+			_sendPending = true;
+		}
+		// Otherwise: already received, or after a gap (the peer sends it again until it's acknowledged)
+	}
+}
+
+void NetplayUdpChannel::Flush() {
+	vector<uint8_t> packet;
+	auto lock = _lock.AcquireSafe();
+	if (!_endpoint.IsValid() || (!_sendPending && _lastSend.GetElapsedMS() < NetplayUdpChannel::KeepAliveDelay)) {
+		return;
+	}
+
+	BuildPacket(packet);
+	_socket->SendTo(_endpoint, packet.data(), (int)packet.size());
+}
+
+void NetplayUdpChannel::BuildPacket(vector<uint8_t>& packet) {
+	auto lock = _lock.AcquireSafe();
+	packet.clear();
+	packet.reserve(NetplayUdpChannel::MaxPacketSize);
+	Write16(packet, NetplayUdpChannel::Magic);
+	Write32(packet, _token);
+
+	size_t countPos = packet.size();
+	uint8_t ackCount = 0;
+	Write8(packet, 0);
+	for (int slot = 0; slot < NetplayUdpChannel::SlotCount; slot++) {
+		if (_received[slot].Valid) {
+			Write8(packet, (uint8_t)(slot / IControllerHub::MaxSubPorts));
+			Write8(packet, (uint8_t)(slot % IControllerHub::MaxSubPorts));
+			Write16(packet, _received[slot].SyncId);
+			Write32(packet, _received[slot].Frame);
+			ackCount++;
+		}
+	}
+	packet[countPos] = ackCount;
+
+	// Oldest input first, so the peer always receives it in order (a frame after a gap is dropped)
+	countPos = packet.size();
+	uint8_t entryCount = 0;
+	Write8(packet, 0);
+	for (std::deque<NetplayInputEntry>& queue : _queues) {
+		uint32_t count = 0;
+		for (NetplayInputEntry& entry : queue) {
+			size_t size = entry.State.State.size();
+			if (count >= NetplayUdpChannel::MaxEntriesPerController || entryCount == 0xFF || packet.size() + 9 + size > NetplayUdpChannel::MaxPacketSize) {
+				break;
+			}
+			Write8(packet, entry.Controller.Port);
+			Write8(packet, entry.Controller.SubPort);
+			Write16(packet, entry.SyncId);
+			Write32(packet, entry.Frame);
+			Write8(packet, (uint8_t)size);
+			packet.insert(packet.end(), entry.State.State.begin(), entry.State.State.end());
+			count++;
+			entryCount++;
+		}
+	}
+	packet[countPos] = entryCount;
+
+	_sendPending = false;
+	_lastSend.Reset();
+}
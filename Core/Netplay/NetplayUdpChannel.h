@@ -0,0 +1,111 @@
+#pragma once
+#include "pch.h"
+#include <deque>
+#include "Netplay/NetplayTypes.h"
+#include "Shared/BaseControlDevice.h"
+#include "Shared/ControlDeviceState.h"
+#include "Shared/IControllerHub.h"
+#include "Utilities/SimpleLock.h"
+#include "Utilities/Timer.h"
+#include "Utilities/UdpSocket.h"
+
+/// <summary>
+/// Input used by a player for a frame (rollback mode).
+/// </summary>
+struct NetplayInputEntry {
+	NetplayControllerInfo Controller = {};
+	uint16_t SyncId = 0; ///< Incremented each time the server sends its state to the player (their frames restart)
+	uint32_t Frame = 0;
+	ControlDeviceState State = {};
+};
+
+/// <summary>
+/// Sends rollback input over UDP to one peer, with redundancy instead of retransmissions.
+/// </summary>
+/// <remarks>
+/// TCP delivers everything in order, so a single lost packet holds back all the input sent after it until it is
+/// retransmitted (hundreds of milliseconds on a lossy Wi-Fi connection). Over UDP, every packet contains all the
+/// input the peer hasn't acknowledged yet (up to MaxEntriesPerController frames per controller), so a lost packet's
+/// input is normally in the next one. Acknowledgments (last frame received in order, per controller) are
+/// piggybacked on the packets going the other way.
+///
+/// Input is only delivered in order (a frame after a gap is dropped and will be sent again), which is what
+/// NetplayRollback expects. Handshake, save states and everything else still use the TCP connection, which is also
+/// the fallback while no UDP packet has been received from the peer recently (e.g UDP blocked by a firewall).
+///
+/// Packet format (little endian):
+/// - u16 magic, u32 token (identifies the connection, sent to the client over TCP)
+/// - u8 ack count, then per ack: u8 port, u8 subport, u16 sync id, u32 frame
+/// - u8 input count, then per input: u8 port, u8 subport, u16 sync id, u32 frame, u8 size, state data
+///
+/// Thread safety: all functions can be called from any thread (protected by _lock).
+/// </remarks>
+class NetplayUdpChannel {
+public:
+	static constexpr uint32_t MaxEntriesPerController = 16; ///< Most input frames sent per controller in each packet
+	static constexpr uint32_t MaxPacketSize = 1200;         ///< Stays below the usual MTU
+	static constexpr uint32_t KeepAliveDelay = 100;         ///< Max delay between 2 packets (ms)
+	static constexpr uint32_t Timeout = 1000;               ///< Delay without packets before falling back to TCP (ms)
+
+private:
+	static constexpr uint16_t Magic = 0x584E;
+	static constexpr int SlotCount = BaseControlDevice::PortCount * IControllerHub::MaxSubPorts;
+	static constexpr size_t MaxQueueSize = 128;
+
+	struct ReceiveState {
+		bool Valid = false;
+		uint16_t SyncId = 0;
+		uint32_t Frame = 0; ///< Last frame received in order
+	};
+
+	UdpSocket* _socket = nullptr;
+	uint32_t _token = 0;
+	UdpEndpoint _endpoint;
+	bool _learnEndpoint = false;
+
+	SimpleLock _lock;
+	std::deque<NetplayInputEntry> _queues[NetplayUdpChannel::SlotCount];
+	ReceiveState _received[NetplayUdpChannel::SlotCount];
+	bool _sendPending = false;
+	bool _hasReceived = false;
+	Timer _lastSend;
+	Timer _lastReceive;
+
+	[[nodiscard]] static int GetSlot(NetplayControllerInfo controller) {
+		return controller.Port * IControllerHub::MaxSubPorts + controller.SubPort;
+	}
+
+public:
+	/// <param name="socket">Socket used to send the packets (can be shared by several channels)</param>
+	/// <param name="endpoint">Peer's address, or an invalid endpoint to use the address of the first packet received (server)</param>
+	NetplayUdpChannel(UdpSocket* socket, uint32_t token, UdpEndpoint endpoint);
+
+	[[nodiscard]] uint32_t GetToken() const { return _token; }
+
+	/// <summary>Reads the token of a packet, returns false if it's not a valid packet</summary>
+	static bool ReadToken(const uint8_t* data, int length, uint32_t& token);
+
+	/// <summary>True if a packet was received from the peer recently (input can be sent over UDP)</summary>
+	[[nodiscard]] bool IsAlive();
+
+	/// <summary>Queues input to send with the next packets, until the peer acknowledges it</summary>
+	void QueueInput(const NetplayInputEntry& entry);
+
+	/// <summary>Removes and returns the input that wasn't acknowledged (to send it over TCP instead)</summary>
+	vector<NetplayInputEntry> TakeUnacknowledged();
+
+	/// <summary>Drops the queued input of a controller (player was resynced, their old input is obsolete)</summary>
+	void ClearQueue(NetplayControllerInfo controller);
+
+	/// <summary>Drops all queued input</summary>
+	void ClearQueues();
+
+	/// <summary>Processes a packet received from the peer, adds the new input (in order) to delivered</summary>
+	void ProcessPacket(const uint8_t* data, int length, const UdpEndpoint& from, vector<NetplayInputEntry>& delivered);
+
+	/// <summary>Sends a packet if there is new input/acknowledgments to send, or as a keep alive</summary>
+	void Flush();
+
+	/// <summary>Builds the next packet (acknowledgments and unacknowledged input), Flush() sends it</summary>
+	void BuildPacket(vector<uint8_t>& packet);
+};
@@ -0,0 +1,34 @@
+#pragma once
+#include "pch.h"
+#include "Netplay/NetMessage.h"
+
+/// <summary>
+/// Checksum of a client's state at the start of a frame (rollback mode), used by the server to detect desyncs.
+/// </summary>
+class RollbackChecksumMessage : public NetMessage {
+private:
+	uint32_t _frame = 0;
+	uint32_t _checksum = 0;
+
+protected:
+	void Serialize(Serializer& s) override {
+		SV(_frame);
+		SV(_checksum);
+	}
+
+public:
+	RollbackChecksumMessage(void* buffer, uint32_t length) : NetMessage(buffer, length) {}
+
+	RollbackChecksumMessage(uint32_t frame, uint32_t checksum) : NetMessage(MessageType::RollbackChecksum) {
+		_frame = frame;
+		_checksum = checksum;
+	}
+
+	uint32_t GetFrame() {
+		return _frame;
+	}
+
+	uint32_t GetChecksum() {
+		return _checksum;
+	}
+};
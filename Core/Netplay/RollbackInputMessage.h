@@ -0,0 +1,40 @@
+#pragma once
+#include "pch.h"
+#include "Netplay/NetMessage.h"
+#include "Netplay/NetplayTypes.h"
+#include "Netplay/NetplayUdpChannel.h"
+#include "Shared/ControlDeviceState.h"
+
+/// <summary>
+/// Input used by a player for a given frame (rollback mode), sent by every peer and relayed by the server.
+/// </summary>
+class RollbackInputMessage : public NetMessage {
+private:
+	NetplayControllerInfo _controller = {};
+	uint16_t _syncId = 0;
+	uint32_t _frame = 0;
+	ControlDeviceState _inputState = {};
+
+protected:
+	void Serialize(Serializer& s) override {
+		SV(_controller.Port);
+		SV(_controller.SubPort);
+		SV(_syncId);
+		SV(_frame);
+		SVVector(_inputState.State);
+	}
+
+public:
+	RollbackInputMessage(void* buffer, uint32_t length) : NetMessage(buffer, length) {}
+
+	RollbackInputMessage(const NetplayInputEntry& entry) : NetMessage(MessageType::RollbackInput) {
+		_controller = entry.Controller;
+		_syncId = entry.SyncId;
+		_frame = entry.Frame;
+		_inputState = entry.State;
+	}
+
+	NetplayInputEntry GetEntry() {
+		return NetplayInputEntry{_controller, _syncId, _frame, _inputState};
+	}
+};
@@ -1,43 +1,90 @@
 #pragma once
 #include "pch.h"
 #include "Netplay/NetMessage.h"
+#include "Netplay/NetplayStateBase.h"
 #include "Shared/Emulator.h"
 #include "Shared/EmuSettings.h"
 #include "Shared/CheatManager.h"
 #include "Shared/SaveStateManager.h"
 
+/// <summary>
+/// Emulator state sent to a client (late join, resync), as a delta against the previous state sent to the client
+/// when there is one (see NetplayStateBase).
+/// </summary>
 class SaveStateMessage : public NetMessage {
 private:
 	vector<CheatCode> _activeCheats;
-	vector<uint8_t> _stateData;
+	vector<uint8_t> _stateData; ///< Uncompressed state (the message is compressed), XORed with the base state if _baseId != 0
+	uint32_t _stateId = 0;
+	uint32_t _baseId = 0;
+	uint32_t _frame = 0;
+	uint16_t _syncId = 0;
 
 protected:
 	void Serialize(Serializer& s) override {
 		SVVector(_stateData);
 		SVVector(_activeCheats);
+		SV(_frame);
+		SV(_syncId);
+		SV(_stateId);
+		SV(_baseId);
 	}
 
 public:
 	SaveStateMessage(void* buffer, uint32_t length) : NetMessage(buffer, length) {}
 
-	SaveStateMessage(Emulator* emu) : NetMessage(MessageType::SaveState) {
-		// Used when sending state to clients
+	/// <summary>Used when sending state to clients</summary>
+	/// <param name="base">Last state sent to the client, replaced by this one</param>
+	SaveStateMessage(Emulator* emu, uint32_t frame, uint16_t syncId, NetplayStateBase& base) : NetMessage(MessageType::SaveState) {
+		_frame = frame;
+		_syncId = syncId;
 		stringstream state;
 		{
 			auto lock = emu->AcquireLock();
 			_activeCheats = emu->GetCheatManager()->GetCheats();
-			emu->Serialize(state, true);
+
+			// Not compressed here, Send() compresses the whole message (and the delta compresses much better)
+			emu->Serialize(state, true, 0);
 		}
 
 		uint32_t dataSize = (uint32_t)state.tellp();
 		_stateData.resize(dataSize);
 		state.read((char*)_stateData.data(), dataSize);
+
+		_stateId = base.GetNextId();
+		_baseId = base.GetId();
+		vector<uint8_t> fullState = _stateData;
+		if (_baseId != 0) {
+			base.ApplyDelta(_stateData);
+		}
+		base.Set(_stateId, std::move(fullState));
 	}
 
-	void LoadState(Emulator* emu) {
+	/// <summary>Rollback frame number at which the state was saved</summary>
+	uint32_t GetFrame() {
+		return _frame;
+	}
+
+	/// <summary>Resync counter, the client tags its rollback input with it (the server ignores input from before the resync)</summary>
+	uint16_t GetSyncId() {
+		return _syncId;
+	}
+
+	/// <summary>False if the state is a delta against a state the client doesn't have (it must request a full state)</summary>
+	bool CanLoad(const NetplayStateBase& base) {
+		return _baseId == 0 || _baseId == base.GetId();
+	}
+
+	/// <param name="base">Last state loaded, replaced by this one</param>
+	void LoadState(Emulator* emu, NetplayStateBase& base) {
+		if (_baseId != 0) {
+			base.ApplyDelta(_stateData);
+		}
+
 		std::stringstream ss;
 		ss.write((char*)_stateData.data(), _stateData.size());
 		(void)emu->Deserialize(ss, SaveStateManager::FileFormatVersion, true);
+		base.Set(_stateId, std::move(_stateData));
 
 		emu->GetCheatManager()->SetCheats(_activeCheats);
 	}
@@ -0,0 +1,18 @@
+#pragma once
+#include "pch.h"
+#include "Netplay/NetMessage.h"
+
+/// <summary>
+/// Sent by the client when it received a state delta it can't apply (it doesn't have the base state, e.g it was
+/// received while no game was loaded), the server then sends a full state.
+/// </summary>
+class StateRequestMessage : public NetMessage {
+protected:
+	void Serialize(Serializer& s) override {
+	}
+
+public:
+	StateRequestMessage(void* buffer, uint32_t length) : NetMessage(buffer, length) {}
+
+	StateRequestMessage() : NetMessage(MessageType::StateRequest) {}
+};
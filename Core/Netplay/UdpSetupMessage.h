@@ -0,0 +1,28 @@
+#pragma once
+#include "pch.h"
+#include "Netplay/NetMessage.h"
+
+/// <summary>
+/// Tells the client that the server accepts rollback input over UDP (on the server's port), and the token that
+/// identifies the connection in the UDP packets.
+/// </summary>
+class UdpSetupMessage : public NetMessage {
+private:
+	uint32_t _token = 0;
+
+protected:
+	void Serialize(Serializer& s) override {
+		SV(_token);
+	}
+
+public:
+	UdpSetupMessage(void* buffer, uint32_t length) : NetMessage(buffer, length) {}
+
+	UdpSetupMessage(uint32_t token) : NetMessage(MessageType::UdpSetup) {
+		_token = token;
+	}
+
+	uint32_t GetToken() {
+		return _token;
+	}
+};
@@ -197,8 +197,30 @@ uint8_t PceAdpcm::GetClocksToNextSlot(bool forRead) {
 	return (nextSlotClock - _console->GetMasterClock()) / 3;
 }
 
+void PceAdpcm::ApplySkippedExecs() {
+	// Same additions as the skipped Exec calls, to keep the counter's rounding identical
+	for (uint32_t i = _idleExecs; i < _plannedIdleExecs; i++) {
+		_nextSampleCounter += 3;
+	}
+	_idleExecs = 0;
+	_plannedIdleExecs = 0;
+}
+
+void PceAdpcm::PlanIdleExecs(bool dmaRequested) {
+	bool playbackOnly = (_state.Playing || (_state.Control & 0x20)) && !_state.PlayRequest && !(_state.Control & 0x90);
+	if (!_needExec || !playbackOnly || _state.ReadClockCounter || _state.WriteClockCounter || dmaRequested || (_state.DmaControl & 0x03) || _dmaWriteCounter) {
+		return;
+	}
+
+	// Keep one Exec call of margin for the rounding of the counter's additions
+	double remaining = _clocksPerSample - _nextSampleCounter;
+	_idleExecs = remaining >= 6 ? (uint32_t)(remaining / 3) - 1 : 0;
+	_plannedIdleExecs = _idleExecs;
+}
+
 void PceAdpcm::Exec() {
 	// Called every 3 master clocks
+	ApplySkippedExecs();
 	ProcessFlags();
 
 	if (_state.Playing || _state.PlayRequest || (_state.Control & 0x20)) {
@@ -225,9 +247,11 @@ void PceAdpcm::Exec() {
 	ProcessFlags();
 
 	_needExec = _state.Playing || _state.PlayRequest || (_state.Control & 0x20) || _state.ReadClockCounter || _state.WriteClockCounter || dmaRequested || _dmaWriteCounter;
+	PlanIdleExecs(dmaRequested);
 }
 
 void PceAdpcm::Write(uint16_t addr, uint8_t value) {
+	ApplySkippedExecs();
 	switch (addr & 0x3FF) {
 		case 0x08:
 			_state.AddressPort = (_state.AddressPort & 0xFF00) | value;
@@ -270,6 +294,7 @@ void PceAdpcm::Write(uint16_t addr, uint8_t value) {
 }
 
 uint8_t PceAdpcm::Read(uint16_t addr) {
+	ApplySkippedExecs();
 	switch (addr & 0x3FF) {
 		case 0x0A:
 			_state.ReadClockCounter = GetClocksToNextSlot(true);
@@ -358,6 +383,7 @@ void PceAdpcm::MixAudio(int16_t* out, uint32_t sampleCount, uint32_t sampleRate)
 }
 
 void PceAdpcm::Serialize(Serializer& s) {
+	ApplySkippedExecs();
 	SVArray(_ram, 0x10000);
 
 	SV(_state.Nibble);
@@ -30,6 +30,11 @@ private:
 	double _clocksPerSample = PceConstants::MasterClockRate / 32000.0;
 	double _nextSampleCounter = 0;
 
+	// While the ADPCM only plays samples, the Exec calls between two samples don't change anything but the
+	// sample counter: they are skipped, and the counter is updated for them when needed (ApplySkippedExecs)
+	uint32_t _idleExecs = 0;        ///< Exec calls left to skip
+	uint32_t _plannedIdleExecs = 0; ///< Exec calls skipped since the last Exec, including the remaining ones
+
 	constexpr static int _stepSize[392] =
 	    {
 	        0x0002, 0x0006, 0x000A, 0x000E, 0x0012, 0x0016, 0x001A, 0x001E,
@@ -95,12 +100,20 @@ private:
 	void ProcessDmaRequest();
 	uint8_t GetClocksToNextSlot(bool forRead);
 	void PlaySample();
+	void ApplySkippedExecs();
+	void PlanIdleExecs(bool dmaRequested);
 
 public:
 	PceAdpcm(PceConsole* console, Emulator* emu, PceCdRom* cdrom, PceScsiBus* scsi);
 	~PceAdpcm();
 
-	bool NeedExec() { return _needExec; }
+	__forceinline bool NeedExec() {
+		if (_idleExecs) {
+			_idleExecs--;
+			return false;
+		}
+		return _needExec;
+	}
 	__noinline void Exec();
 
 	PceAdpcmState& GetState() { return _state; }
@@ -21,6 +21,7 @@ void PceCdAudioPlayer::Play(uint32_t startSector, bool pause) {
 	if (track >= 0) {
 		uint32_t startLba = _cdrom->GetCurrentSector();
 		_seekDelay = (uint32_t)((PceCdSeekDelay::GetSeekTimeMs(startLba, startSector) / 1000.0) * _emu->GetMasterClockRate());
+		_disc->Prefetch(startSector);
 
 		_state.StartSector = startSector;
 		_state.Status = pause ? CdAudioStatus::Paused : CdAudioStatus::Playing;
@@ -261,6 +261,7 @@ void PceScsiBus::CmdRead() {
 	_needExec = true;
 	_state.Sector = sector;
 	_state.SectorsToRead = sectorsToRead;
+	_disc->Prefetch(sector);
 
 	// Set the phase to "data in" right away
 	// Ys IV appears to expect this to happen relatively quickly after
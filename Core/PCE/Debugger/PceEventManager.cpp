@@ -98,7 +98,10 @@ bool PceEventManager::ShowPreviousFrameEvents() {
 }
 
 void PceEventManager::SetConfiguration(BaseEventViewerConfig& config) {
+	// The render thread reads the configuration
+	auto lock = _lock.AcquireSafe();
 	_config = (PceEventViewerConfig&)config;
+	InvalidateFilteredEvents();
 }
 
 EventViewerCategoryCfg PceEventManager::GetEventConfig(DebugEventInfo& evt) {
@@ -199,7 +202,11 @@ void PceEventManager::ConvertScanlineCycleToRowColumn(int32_t& x, int32_t& y) {
 
 uint32_t PceEventManager::TakeEventSnapshot(bool forAutoRefresh) {
 	DebugBreakHelper breakHelper(_debugger);
-	auto lock = _lock.AcquireSafe();
+	EventSnapshotLock lock(_lock, forAutoRefresh);
+	if (!lock.IsAcquired()) {
+		// The render thread is drawing the previous snapshot
+		return _scanlineCount;
+	}
 
 	uint16_t cycle = _vdc->GetHClock();
 	uint16_t scanline = _vdc->GetScanline();
@@ -218,8 +225,7 @@ uint32_t PceEventManager::TakeEventSnapshot(bool forAutoRefresh) {
 		memcpy(_rowClockDividers + scanlineOffset, _vpc->GetPreviousScreenBuffer() + size + scanlineOffset, (PceConstants::ScreenHeight - scanlineOffset) * sizeof(uint16_t));
 	}
 
-	_snapshotCurrentFrame = _debugEvents;
-	_snapshotPrevFrame = _prevDebugEvents;
+	UpdateEventSnapshot();
 	_snapshotScanline = scanline;
 	_snapshotCycle = cycle;
 	_forAutoRefresh = forAutoRefresh;
@@ -50,9 +50,10 @@ LoadRomResult PceConsole::LoadRom(VirtualFile& romFile) {
 			return LoadRomResult::Failure;
 		}
 		romData = _hesData->RomData;
-	} else if (romFile.GetFileExtension() == ".cue") {
+	} else if (romFile.GetFileExtension() == ".cue" || romFile.GetFileExtension() == ".ncd") {
 		DiscInfo disc = {};
-		if (!CdReader::LoadCue(romFile, disc)) {
+		bool loaded = romFile.GetFileExtension() == ".ncd" ? CdReader::LoadCompressedDisc(romFile, disc) : CdReader::LoadCue(romFile, disc);
+		if (!loaded) {
 			return LoadRomResult::Failure;
 		}
 
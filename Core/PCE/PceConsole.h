@@ -78,7 +78,7 @@ public:
 	PceConsole(Emulator* emu);
 	virtual ~PceConsole();
 
-	static vector<string> GetSupportedExtensions() { return {".pce", ".cue", ".sgx", ".hes"}; }
+	static vector<string> GetSupportedExtensions() { return {".pce", ".cue", ".ncd", ".sgx", ".hes"}; }
 	static vector<string> GetSupportedSignatures() { return {"HESM"}; }
 
 	void Serialize(Serializer& s) override;
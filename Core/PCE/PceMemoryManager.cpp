@@ -158,6 +158,18 @@ void PceMemoryManager::UpdateCdRomBanks() {
 	if (_cdrom) {
 		_cdrom->InitMemoryBanks(_readBanks, _writeBanks, _bankMemType, _unmappedBank);
 	}
+	UpdateDirectPages();
+}
+
+void PceMemoryManager::UpdateDirectPages() {
+	for (int i = 0; i < 8; i++) {
+		uint8_t bank = _state.Mpr[i];
+		bool isPlainBank = bank != 0xFF && !(_mapper && _mapper->IsBankMapped(bank));
+		_directReads[i] = isPlainBank ? _readBanks[bank] : nullptr;
+
+		// Save RAM (F7) is not mirrored, its writes keep using the slow path
+		_directWrites[i] = isPlainBank && bank != 0xF7 ? _writeBanks[bank] : nullptr;
+	}
 }
 
 void PceMemoryManager::UpdateExecCallback() {
@@ -362,6 +374,7 @@ void PceMemoryManager::SetMprValue(uint8_t regSelect, uint8_t value) {
 			_state.Mpr[i] = value;
 		}
 	}
+	UpdateDirectPages();
 }
 
 uint8_t PceMemoryManager::GetMprValue(uint8_t regSelect) {
@@ -450,5 +463,6 @@ void PceMemoryManager::Serialize(Serializer& s) {
 
 	if (!s.IsSaving()) {
 		UpdateExecCallback();
+		UpdateDirectPages();
 	}
 }
@@ -104,6 +104,13 @@ private:
 	/// <summary>Memory type for each bank.</summary>
 	MemoryType _bankMemType[0x100] = {};
 
+	/// <summary>
+	/// Read/write pointers for each 8KB CPU region, following the MPRs (null when the bank needs the slow path:
+	/// I/O registers, mapper-handled banks, save RAM writes, read-only banks for writes).
+	/// </summary>
+	uint8_t* _directReads[8] = {};
+	uint8_t* _directWrites[8] = {};
+
 	/// <summary>Work RAM (8KB standard, larger with CD-ROM).</summary>
 	uint8_t* _workRam = nullptr;
 
@@ -153,6 +160,9 @@ public:
 	/// <summary>Updates CD-ROM specific bank mappings.</summary>
 	void UpdateCdRomBanks();
 
+	/// <summary>Rebuilds the direct access pointers (after an MPR or bank mapping change).</summary>
+	void UpdateDirectPages();
+
 	/// <summary>Updates execution callback for current mode.</summary>
 	void UpdateExecCallback();
 
@@ -219,19 +229,24 @@ public:
 };
 
 __forceinline uint8_t PceMemoryManager::Read(uint16_t addr, MemoryOperationType type) {
-	uint8_t bank = _state.Mpr[(addr & 0xE000) >> 13];
 	uint8_t value;
-	if (bank != 0xFF) [[likely]] {
-		value = _readBanks[bank][addr & 0x1FFF];
+	if (uint8_t* page = _directReads[addr >> 13]) [[likely]] {
+		value = page[addr & 0x1FFF];
 	} else {
-		value = ReadRegister(addr & 0x1FFF);
-	}
+		uint8_t bank = _state.Mpr[(addr & 0xE000) >> 13];
+		if (bank != 0xFF) {
+			value = _readBanks[bank][addr & 0x1FFF];
+		} else {
+			value = ReadRegister(addr & 0x1FFF);
+		}
 
-	if (_mapper && _mapper->IsBankMapped(bank)) {
-		value = _mapper->Read(bank, addr, value);
+		if (_mapper && _mapper->IsBankMapped(bank)) {
+			value = _mapper->Read(bank, addr, value);
+		}
 	}
 
 	if (_cheatManager->HasCheats<CpuType::Pce>()) {
+		uint8_t bank = _state.Mpr[(addr & 0xE000) >> 13];
 		_cheatManager->ApplyCheat<CpuType::Pce>((bank << 13) | (addr & 0x1FFF), value);
 	}
 	_emu->ProcessMemoryRead<CpuType::Pce>(addr, value, type);
@@ -240,6 +255,11 @@ __forceinline uint8_t PceMemoryManager::Read(uint16_t addr, MemoryOperationType
 
 __forceinline void PceMemoryManager::Write(uint16_t addr, uint8_t value, MemoryOperationType type) {
 	if (_emu->ProcessMemoryWrite<CpuType::Pce>(addr, value, type)) {
+		if (uint8_t* page = _directWrites[addr >> 13]) [[likely]] {
+			page[addr & 0x1FFF] = value;
+			return;
+		}
+
 		uint8_t bank = _state.Mpr[(addr & 0xE000) >> 13];
 		if (_mapper && _mapper->IsBankMapped(bank)) {
 			_mapper->Write(bank, addr, value);
@@ -9,6 +9,8 @@
 PceNtscFilter::PceNtscFilter(Emulator* emu) : PceDefaultVideoFilter(emu) {
 	memset(&_ntscData, 0, sizeof(_ntscData));
 	_ntscSetup = {};
+	// Build the tables for the current settings right away (instead of the default settings, followed by a rebuild on the first frame)
+	GenericNtscFilter::InitNtscFilter(_ntscSetup, _emu->GetSettings()->GetVideoConfig());
 	snes_ntsc_init(&_ntscData, &_ntscSetup);
 	_ntscBuffer = std::make_unique<uint32_t[]>(SNES_NTSC_OUT_WIDTH(PceConstants::InternalOutputWidth / 2) * PceConstants::ScreenHeight);
 	_rgb555Buffer = std::make_unique<uint16_t[]>(PceConstants::InternalOutputWidth * PceConstants::ScreenHeight);
@@ -2,6 +2,7 @@
 #include "PCE/PcePsg.h"
 #include "PCE/PceConsole.h"
 #include "Shared/Emulator.h"
+#include "Shared/FrameProfiler.h"
 #include "Shared/EmuSettings.h"
 #include "Shared/MessageManager.h"
 #include "Shared/Audio/SoundMixer.h"
@@ -96,9 +97,15 @@ void PcePsg::Write(uint16_t addr, uint8_t value) {
 }
 
 void PcePsg::Run() {
+	PROFILE_SCOPE(_emu->GetFrameProfiler(), ProfilerStage::Apu);
 	uint64_t clock = _console->GetMasterClock();
 	uint32_t clocksToRun = clock - _lastClock;
 	PcEngineConfig& cfg = _emu->GetSettings()->GetPcEngineConfig();
+	if (clocksToRun >= 6 && CanRenderBlock(cfg)) {
+		RenderBlock(clocksToRun / 6, cfg);
+		clocksToRun %= 6;
+	}
+
 	while (clocksToRun >= 6) {
 		uint32_t minTimer = clocksToRun / 6;
 		for (int i = 0; i < 6; i++) {
@@ -125,6 +132,100 @@ void PcePsg::Run() {
 	_lastClock = clock - clocksToRun;
 }
 
+bool PcePsg::CanRenderBlock(PcEngineConfig& cfg) {
+	if (IsLfoEnabled()) {
+		// Channel 1's period depends on channel 2's output, the channels can't be rendered separately
+		return false;
+	}
+
+	// The channels are mixed into an int16 - when the sum could wrap around, the stepped loop reproduces that
+	int32_t maxLeftOutput = 0;
+	int32_t maxRightOutput = 0;
+	for (int i = 0; i < 6; i++) {
+		PcePsgChannel& ch = _channels[i];
+		if (!ch.CanRunBlock()) {
+			return false;
+		}
+		int32_t magnitude = ch.GetMaxOutputMagnitude();
+		maxLeftOutput += magnitude * ch.GetVolume(true, _state.LeftVolume) * (int32_t)cfg.ChannelVol[i] / 100;
+		maxRightOutput += magnitude * ch.GetVolume(false, _state.RightVolume) * (int32_t)cfg.ChannelVol[i] / 100;
+	}
+	return maxLeftOutput <= INT16_MAX && maxRightOutput <= INT16_MAX;
+}
+
+void PcePsg::RenderBlock(uint32_t clocks, PcEngineConfig& cfg) {
+	// Same result as the stepped loop in Run(): each channel is rendered on its own over the whole block,
+	// then the changes are merged in clock order (blip_buf rounds each delta, so simultaneous changes are summed first)
+	uint32_t latchClock = clocks;
+	for (int i = 0; i < 6; i++) {
+		uint16_t timer = _channels[i].GetTimer();
+		if (timer != 0 && timer < latchClock) {
+			latchClock = timer;
+		}
+	}
+
+	_blockChanges.clear();
+	int32_t startLeft = 0;
+	int32_t startRight = 0;
+	int32_t endLeft = 0;
+	int32_t endRight = 0;
+	for (int i = 0; i < 6; i++) {
+		PcePsgChannel& ch = _channels[i];
+		int32_t leftVolume = ch.GetVolume(true, _state.LeftVolume);
+		int32_t rightVolume = ch.GetVolume(false, _state.RightVolume);
+		int32_t channelVolume = (int32_t)cfg.ChannelVol[i];
+
+		int8_t output = ch.GetState().CurrentOutput;
+		int32_t left = (int16_t)(output * leftVolume) * channelVolume / 100;
+		int32_t right = (int16_t)(output * rightVolume) * channelVolume / 100;
+		startLeft += left;
+		startRight += right;
+
+		ch.RunBlock(clocks, latchClock, [&](uint32_t clock, int8_t newOutput) {
+			int32_t newLeft = (int16_t)(newOutput * leftVolume) * channelVolume / 100;
+			int32_t newRight = (int16_t)(newOutput * rightVolume) * channelVolume / 100;
+			if (newLeft != left || newRight != right) {
+				_blockChanges.push_back({clock, newLeft - left, newRight - right});
+				left = newLeft;
+				right = newRight;
+			}
+		});
+
+		endLeft += left;
+		endRight += right;
+	}
+
+	// The first step also applies any volume/setting change made since the last output update
+	if (startLeft != _prevLeftOutput || startRight != _prevRightOutput) {
+		_blockChanges.push_back({latchClock, startLeft - _prevLeftOutput, startRight - _prevRightOutput});
+	}
+
+	std::sort(_blockChanges.begin(), _blockChanges.end(), [](const OutputChange& a, const OutputChange& b) { return a.Clock < b.Clock; });
+	for (size_t i = 0; i < _blockChanges.size();) {
+		uint32_t clock = _blockChanges[i].Clock;
+		int32_t left = 0;
+		int32_t right = 0;
+		for (; i < _blockChanges.size() && _blockChanges[i].Clock == clock; i++) {
+			left += _blockChanges[i].Left;
+			right += _blockChanges[i].Right;
+		}
+
+		if (left != 0) {
+			_leftDeltas[_leftDeltaCount++] = {_clockCounter + clock, left};
+		}
+		if (right != 0) {
+			_rightDeltas[_rightDeltaCount++] = {_clockCounter + clock, right};
+		}
+		if (_leftDeltaCount == MaxPendingDeltas || _rightDeltaCount == MaxPendingDeltas) {
+			FlushDeltas();
+		}
+	}
+
+	_prevLeftOutput = (int16_t)endLeft;
+	_prevRightOutput = (int16_t)endRight;
+	_clockCounter += clocks;
+}
+
 void PcePsg::UpdateOutput(PcEngineConfig& cfg) {
 	int16_t leftOutput = 0;
 	int16_t rightOutput = 0;
@@ -135,14 +236,25 @@ void PcePsg::UpdateOutput(PcEngineConfig& cfg) {
 	}
 
 	if (_prevLeftOutput != leftOutput) {
-		blip_add_delta(_leftChannel, _clockCounter, leftOutput - _prevLeftOutput);
+		_leftDeltas[_leftDeltaCount++] = {_clockCounter, leftOutput - _prevLeftOutput};
 		_prevLeftOutput = leftOutput;
 	}
 
 	if (_prevRightOutput != rightOutput) {
-		blip_add_delta(_rightChannel, _clockCounter, rightOutput - _prevRightOutput);
+		_rightDeltas[_rightDeltaCount++] = {_clockCounter, rightOutput - _prevRightOutput};
 		_prevRightOutput = rightOutput;
 	}
+
+	if (_leftDeltaCount == MaxPendingDeltas || _rightDeltaCount == MaxPendingDeltas) {
+		FlushDeltas();
+	}
+}
+
+void PcePsg::FlushDeltas() {
+	blip_add_deltas(_leftChannel, _leftDeltas, _leftDeltaCount);
+	blip_add_deltas(_rightChannel, _rightDeltas, _rightDeltaCount);
+	_leftDeltaCount = 0;
+	_rightDeltaCount = 0;
 }
 
 void PcePsg::UpdateSoundOffset() {
@@ -153,6 +265,7 @@ void PcePsg::UpdateSoundOffset() {
 }
 
 void PcePsg::PlayQueuedAudio() {
+	FlushDeltas();
 	blip_end_frame(_leftChannel, _clockCounter);
 	blip_end_frame(_rightChannel, _clockCounter);
 
@@ -5,18 +5,19 @@
 #include "PCE/PceTypes.h"
 #include "PCE/PcePsgChannel.h"
 #include "Utilities/ISerializable.h"
+#include "Utilities/Audio/blip_buf.h"
 
 class Emulator;
 class PceConsole;
 class SoundMixer;
 struct PcEngineConfig;
-struct blip_t;
 
 class PcePsg final : public ISerializable {
 private:
 	static constexpr int MaxSamples = 4000;
 	static constexpr int SampleRate = 96000;
 	static constexpr int PsgFrequency = PceConstants::MasterClockRate / 6;
+	static constexpr int MaxPendingDeltas = 256;
 
 	Emulator* _emu = nullptr;
 	PceConsole* _console = nullptr;
@@ -31,9 +32,25 @@ private:
 	int16_t _prevLeftOutput = 0;
 	int16_t _prevRightOutput = 0;
 
+	// Output changes are queued and submitted to blip_buf in batches
+	blip_delta_t _leftDeltas[MaxPendingDeltas] = {};
+	blip_delta_t _rightDeltas[MaxPendingDeltas] = {};
+	int _leftDeltaCount = 0;
+	int _rightDeltaCount = 0;
+
 	uint32_t _clockCounter = 0;
 
+	struct OutputChange {
+		uint32_t Clock;
+		int32_t Left;
+		int32_t Right;
+	};
+	vector<OutputChange> _blockChanges; ///< Output changes of the channels rendered by RenderBlock
+
+	bool CanRenderBlock(PcEngineConfig& cfg);
+	void RenderBlock(uint32_t clocks, PcEngineConfig& cfg);
 	void UpdateOutput(PcEngineConfig& cfg);
+	void FlushDeltas();
 	void UpdateSoundOffset();
 
 public:
@@ -43,6 +43,31 @@ uint32_t PcePsgChannel::GetPeriod() {
 	return period;
 }
 
+void PcePsgChannel::ClockNoise() {
+	// Clock noise LSFR
+	//"The LFSR was 18 bits, with bits (LSB) 0, 1, 11, 12, and 17 (MSB) tapped. Assuming a right-shift on each clock pulse,
+	// the bit shifted out is the noise sample. The tapped bits are XOR'd together and inserted into bit 17. After /RESET is
+	// asserted the LFSR is initialized with bit 0 set and all other bits reset. It has a maximum sequence of 131071 bits before repeating."
+	uint32_t v = _state.NoiseLfsr;
+	uint32_t bit = ((v >> 0) ^ (v >> 1) ^ (v >> 11) ^ (v >> 12) ^ (v >> 17)) & 0x01;
+
+	_state.NoiseOutput = (int8_t)((_state.NoiseLfsr & 0x01) ? 0x1F : 0);
+	_state.NoiseLfsr >>= 1;
+	_state.NoiseLfsr |= (bit << 17);
+}
+
+int8_t PcePsgChannel::GetStateOutput() {
+	if (!_state.Enabled) {
+		return 0;
+	} else if (_state.DdaEnabled) {
+		return (int8_t)_state.DdaOutputValue - _outputOffset;
+	} else if (!_state.NoiseEnabled) {
+		return (int8_t)_state.WaveData[_state.WaveAddr] - _outputOffset;
+	} else {
+		return _state.NoiseOutput - _outputOffset;
+	}
+}
+
 void PcePsgChannel::Run(uint32_t clocks) {
 	if (_chIndex >= 4) {
 		// Source: https://web.archive.org/web/20080311065543/http://cgfm2.emuviews.com:80/blog/index.php
@@ -51,17 +76,7 @@ void PcePsgChannel::Run(uint32_t clocks) {
 		// the specified noise frequency. Apart from a reset, the LFSR state can't be changed."
 		if (_state.NoiseTimer <= clocks) {
 			_state.NoiseTimer = GetNoisePeriod();
-
-			// Clock noise LSFR
-			//"The LFSR was 18 bits, with bits (LSB) 0, 1, 11, 12, and 17 (MSB) tapped. Assuming a right-shift on each clock pulse,
-			// the bit shifted out is the noise sample. The tapped bits are XOR'd together and inserted into bit 17. After /RESET is
-			// asserted the LFSR is initialized with bit 0 set and all other bits reset. It has a maximum sequence of 131071 bits before repeating."
-			uint32_t v = _state.NoiseLfsr;
-			uint32_t bit = ((v >> 0) ^ (v >> 1) ^ (v >> 11) ^ (v >> 12) ^ (v >> 17)) & 0x01;
-
-			_state.NoiseOutput = (int8_t)((_state.NoiseLfsr & 0x01) ? 0x1F : 0);
-			_state.NoiseLfsr >>= 1;
-			_state.NoiseLfsr |= (bit << 17);
+			ClockNoise();
 		} else {
 			_state.NoiseTimer -= clocks;
 		}
@@ -88,6 +103,10 @@ void PcePsgChannel::Run(uint32_t clocks) {
 }
 
 int16_t PcePsgChannel::GetOutput(bool forLeftChannel, uint8_t masterVolume) {
+	return (int16_t)_state.CurrentOutput * GetVolume(forLeftChannel, masterVolume);
+}
+
+uint8_t PcePsgChannel::GetVolume(bool forLeftChannel, uint8_t masterVolume) {
 	// Sound reduction constants (in -1.5dB steps)
 	constexpr uint8_t volumeReduction[30] = {255, 214, 180, 151, 127, 107, 90, 76, 64, 53, 45, 38, 32, 27, 22, 19, 16, 13, 11, 9, 8, 6, 5, 4, 4, 3, 2, 2, 2, 1};
 
@@ -97,7 +116,7 @@ int16_t PcePsgChannel::GetOutput(bool forLeftChannel, uint8_t masterVolume) {
 		return 0;
 	}
 
-	return (int16_t)_state.CurrentOutput * volumeReduction[reductionFactor];
+	return volumeReduction[reductionFactor];
 }
 
 uint16_t PcePsgChannel::GetTimer() {
@@ -108,6 +127,32 @@ uint16_t PcePsgChannel::GetTimer() {
 	return minTimer;
 }
 
+bool PcePsgChannel::CanRunBlock() {
+	if (_state.Enabled && !_state.DdaEnabled && (_state.Timer == 0 || _state.Timer > 0xFFFF)) {
+		// e.g channel 2's period right after the LFO is disabled
+		return false;
+	}
+	return _chIndex < 4 || _state.NoiseTimer <= 0xFFFF;
+}
+
+uint8_t PcePsgChannel::GetMaxOutputMagnitude() {
+	int maxOutput = std::abs(_state.CurrentOutput);
+	auto check = [&](int8_t output) { maxOutput = std::max<int>(maxOutput, std::abs(output)); };
+	if (_state.Enabled) {
+		if (_state.DdaEnabled) {
+			check((int8_t)_state.DdaOutputValue - _outputOffset);
+		} else if (_state.NoiseEnabled) {
+			check(0 - _outputOffset);
+			check(0x1F - _outputOffset);
+		} else {
+			for (int i = 0; i < 0x20; i++) {
+				check((int8_t)_state.WaveData[i] - _outputOffset);
+			}
+		}
+	}
+	return (uint8_t)maxOutput;
+}
+
 void PcePsgChannel::Write(uint16_t addr, uint8_t value) {
 	switch (addr & 0x0F) {
 		case 2:
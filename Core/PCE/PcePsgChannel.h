@@ -15,6 +15,8 @@ private:
 
 	uint32_t GetNoisePeriod();
 	uint32_t GetPeriod();
+	void ClockNoise();
+	int8_t GetStateOutput();
 
 public:
 	PcePsgChannel();
@@ -26,8 +28,81 @@ public:
 
 	void Run(uint32_t clocks);
 	int16_t GetOutput(bool forLeftChannel, uint8_t masterVolume);
+	uint8_t GetVolume(bool forLeftChannel, uint8_t masterVolume);
 	uint16_t GetTimer();
+
+	/// <summary>True when the channel's timers can be rendered with RunBlock (they fit in what GetTimer reports)</summary>
+	bool CanRunBlock();
+
+	/// <summary>Largest output magnitude the channel can produce until its state is changed by a write</summary>
+	uint8_t GetMaxOutputMagnitude();
+
+	/// <summary>
+	/// Runs the channel for a block of clocks (with the LFO disabled), with the same result as calling Run() for each
+	/// of the PSG's steps over the block.
+	/// </summary>
+	/// <param name="clocks">Length of the block</param>
+	/// <param name="latchClock">End of the PSG's first step, where Run() would first update the output</param>
+	/// <param name="onOutputChange">Called with (clock offset in the block, new output) each time the output changes</param>
+	template <typename TOutputHandler>
+	void RunBlock(uint32_t clocks, uint32_t latchClock, TOutputHandler&& onOutputChange);
+
 	void Write(uint16_t addr, uint8_t value);
 
 	void Serialize(Serializer& s) override;
 };
+
+template <typename TOutputHandler>
+void PcePsgChannel::RunBlock(uint32_t clocks, uint32_t latchClock, TOutputHandler&& onOutputChange) {
+	// Changes made by writes only show up at the end of the first step (latchClock), the
+	// output then only changes when the waveform or noise timer (whichever is audible) expires
+	int8_t output = _state.CurrentOutput;
+	bool latched = false;
+	auto update = [&](uint32_t clock) {
+		int8_t newOutput = GetStateOutput();
+		if (newOutput != output) {
+			output = newOutput;
+			onOutputChange(clock, newOutput);
+		}
+	};
+
+	bool playing = _state.Enabled && !_state.DdaEnabled;
+	if (_chIndex >= 4) {
+		// The LFSR always runs, even when the noise isn't audible
+		uint32_t period = GetNoisePeriod();
+		uint32_t next = _state.NoiseTimer ? _state.NoiseTimer : latchClock;
+		bool audible = playing && _state.NoiseEnabled;
+		for (; next <= clocks; next += period) {
+			if (audible && !latched && next > latchClock) {
+				update(latchClock);
+				latched = true;
+			}
+			ClockNoise();
+			if (latched) {
+				update(next);
+			}
+		}
+		_state.NoiseTimer = next - clocks;
+	}
+
+	if (playing && !_state.NoiseEnabled) {
+		uint32_t period = GetPeriod();
+		uint32_t next = _state.Timer;
+		for (; next <= clocks; next += period) {
+			if (!latched && next > latchClock) {
+				update(latchClock);
+				latched = true;
+			}
+			_state.WaveAddr = (_state.WaveAddr + 1) & 0x1F;
+			if (latched) {
+				update(next);
+			}
+		}
+		_state.Timer = next - clocks;
+	}
+
+	if (!latched) {
+		update(latchClock);
+	}
+	_state.CurrentOutput = output;
+}
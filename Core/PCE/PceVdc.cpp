@@ -6,6 +6,8 @@
 #include "PCE/PceConstants.h"
 #include "PCE/PceConsole.h"
 #include "Shared/EmuSettings.h"
+#include "Shared/Emulator.h"
+#include "Shared/FrameProfiler.h"
 #include "Shared/EventType.h"
 #include "Shared/MessageManager.h"
 #include "Utilities/Serializer.h"
@@ -832,6 +834,7 @@ uint8_t PceVdc::GetSpritePixelColor(const uint16_t chrData[4], const uint8_t shi
 }
 
 void PceVdc::DrawScanline() {
+	PROFILE_SCOPE(_emu->GetFrameProfiler(), ProfilerStage::Ppu);
 	if (_state.Scanline < 14 || _state.Scanline >= 256) {
 		// Only 242 rows can be shown
 		return;
@@ -2,6 +2,7 @@
 #include "PCE/PceVpc.h"
 #include "PCE/PceVdc.h"
 #include "PCE/PceVce.h"
+#include "PCE/PceVpcMixer.h"
 #include "PCE/PcePsg.h"
 #include "PCE/PceMemoryManager.h"
 #include "PCE/PceControlManager.h"
@@ -9,11 +10,12 @@
 #include "Shared/EmuSettings.h"
 #include "Shared/RewindManager.h"
 #include "Shared/Video/VideoDecoder.h"
-#include "Shared/Video/VideoRenderer.h"
 #include "Shared/NotificationManager.h"
 #include "Utilities/Serializer.h"
 #include "Shared/EventType.h"
 
+static_assert(PceVpc::SpritePixelFlag == 0x8000 && PceVpc::TransparentPixelFlag == 0x4000, "PceVpcMixer expects the sprite/transparent flags in bits 15 and 14");
+
 PceVpc::PceVpc(Emulator* emu, PceConsole* console, PceVce* vce) {
 	_emu = emu;
 	_console = console;
@@ -186,14 +188,11 @@ void PceVpc::ProcessStartFrame() {
 		_frameSkipTimer.Reset();
 	}
 
-	if (_emu->IsRunAheadFrame()) {
+	if (_emu->GetAudioPlayerHud()) {
+		// HES player: the video filter ignores the VDC's output, only the player's HUD is shown
 		_skipRender = true;
 	} else {
-		_skipRender = (!_emu->GetSettings()->GetPcEngineConfig().DisableFrameSkipping &&
-		               !_emu->GetRewindManager()->IsRewinding() &&
-		               !_emu->GetVideoRenderer()->IsRecording() &&
-		               (_emu->GetSettings()->GetEmulationSpeed() == 0 || _emu->GetSettings()->GetEmulationSpeed() > 150) &&
-		               _frameSkipTimer.GetElapsedMS() < 10);
+		_skipRender = _emu->IsRenderSkipped(!_emu->GetSettings()->GetPcEngineConfig().DisableFrameSkipping, _frameSkipTimer, 10);
 	}
 }
 
@@ -231,63 +230,21 @@ void PceVpc::ProcessScanline() {
 
 	uint16_t wnd1 = std::max(0, (int16_t)_state.Window1 - 16);
 	uint16_t wnd2 = std::max(0, (int16_t)_state.Window2 - 16);
-	for (uint32_t i = _xStart; i < xMax; i++) {
-		PceVpcPixelWindow wndType = (PceVpcPixelWindow)((i < wnd1) | ((i < wnd2) << 1));
-		PceVpcPriorityConfig& cfg = _state.WindowCfg[(int)wndType];
-		uint8_t enabledLayers = (uint8_t)cfg.Vdc1Enabled | ((uint8_t)cfg.Vdc2Enabled << 1);
-		uint16_t color;
-		switch (enabledLayers) {
-			default:
-			case 0:
-				color = _vce->GetPalette(0);
-				break;
-			case 1:
-				color = rowBuffer[i];
-				break;
-			case 2:
-				color = rowBufferVdc2[i];
-				break;
 
-			case 3: {
-				bool isSpriteVdc1 = (rowBuffer[i] & PceVpc::SpritePixelFlag) != 0;
-				bool isSpriteVdc2 = (rowBufferVdc2[i] & PceVpc::SpritePixelFlag) != 0;
-				bool isTransparentVdc1 = (rowBuffer[i] & PceVpc::TransparentPixelFlag) != 0;
-
-				switch (cfg.PriorityMode) {
-					default:
-					case PceVpcPriorityMode::Default:
-						color = isTransparentVdc1 ? rowBufferVdc2[i] : rowBuffer[i];
-						break;
-
-					case PceVpcPriorityMode::Vdc2SpritesAboveVdc1Bg:
-						// VDC2 sprites are shown above VDC1 background, but below VDC1 sprites
-						if (isTransparentVdc1 || (isSpriteVdc2 && !isSpriteVdc1)) {
-							// VDC1 transparent, show VDC2, or
-							// VDC2 is a sprite and VDC1 is not a sprite, show VDC2
-							color = rowBufferVdc2[i];
-						} else {
-							color = rowBuffer[i];
-						}
-						break;
-
-					case PceVpcPriorityMode::Vdc1SpritesBelowVdc2Bg: {
-						// VDC1 sprites are shown behind VDC2 background, but above VDC2 sprites(?)
-						bool isTransparentVdc2 = (rowBufferVdc2[i] & PceVpc::TransparentPixelFlag) != 0;
-						if (isTransparentVdc1 || (isSpriteVdc1 && !isSpriteVdc2 && !isTransparentVdc2)) {
-							// VDC1 transparent, show VDC2, or
-							// VDC1 is a sprite, show VDC2 (unless VDC2 is a transparent color or the background layer)
-							color = rowBufferVdc2[i];
-						} else {
-							color = rowBuffer[i];
-						}
-						break;
-					}
-				}
-				break;
-			}
+	// Mix each run of pixels that share the same window region at once
+	uint32_t x = _xStart;
+	while (x < xMax) {
+		PceVpcPixelWindow wndType = (PceVpcPixelWindow)((x < wnd1) | ((x < wnd2) << 1));
+		uint32_t end = xMax;
+		if (x < wnd1) {
+			end = std::min<uint32_t>(end, wnd1);
+		}
+		if (x < wnd2) {
+			end = std::min<uint32_t>(end, wnd2);
 		}
 
-		_currentOutBuffer[offset + i] = color;
+		PceVpcMixer::MixSegment(_currentOutBuffer + offset, rowBuffer, rowBufferVdc2, x, end, _state.WindowCfg[(int)wndType], _vce->GetPalette(0));
+		x = end;
 	}
 
 	_xStart = xMax;
@@ -320,7 +277,8 @@ void PceVpc::SendFrame(PceVdc* vdc) {
 
 	bool forRewind = _emu->GetRewindManager()->IsRewinding();
 
-	if (!_skipRender) {
+	if (!_skipRender || _emu->GetAudioPlayerHud()) {
+		// The HES player never renders, but still needs frames to display its HUD
 		if (_console->GetRomFormat() == RomFormat::PceHes) {
 			RenderedFrame frame(_currentOutBuffer, 256, 240, 1.0, _vdc1->GetState().FrameCount, _console->GetControlManager()->GetPortStates());
 			_emu->GetVideoDecoder()->UpdateFrame(frame, forRewind, forRewind);
@@ -112,7 +112,10 @@ bool SmsEventManager::ShowPreviousFrameEvents() {
 }
 
 void SmsEventManager::SetConfiguration(BaseEventViewerConfig& config) {
+	// The render thread reads the configuration
+	auto lock = _lock.AcquireSafe();
 	_config = (SmsEventViewerConfig&)config;
+	InvalidateFilteredEvents();
 }
 
 EventViewerCategoryCfg SmsEventManager::GetEventConfig(DebugEventInfo& evt) {
@@ -169,7 +172,11 @@ void SmsEventManager::ConvertScanlineCycleToRowColumn(int32_t& x, int32_t& y) {
 
 uint32_t SmsEventManager::TakeEventSnapshot(bool forAutoRefresh) {
 	DebugBreakHelper breakHelper(_debugger);
-	auto lock = _lock.AcquireSafe();
+	EventSnapshotLock lock(_lock, forAutoRefresh);
+	if (!lock.IsAcquired()) {
+		// The render thread is drawing the previous snapshot
+		return _scanlineCount;
+	}
 
 	uint16_t cycle = _vdp->GetCycle();
 	uint16_t scanline = _vdp->GetScanline();
@@ -182,8 +189,7 @@ uint32_t SmsEventManager::TakeEventSnapshot(bool forAutoRefresh) {
 		memcpy(_ppuBuffer.get() + offset, _vdp->GetScreenBuffer(true) + offset, (256 * 240 - offset) * sizeof(uint16_t));
 	}
 
-	_snapshotCurrentFrame = _debugEvents;
-	_snapshotPrevFrame = _prevDebugEvents;
+	UpdateEventSnapshot();
 	_snapshotScanline = scanline;
 	_snapshotCycle = cycle;
 	_forAutoRefresh = forAutoRefresh;
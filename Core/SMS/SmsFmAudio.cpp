@@ -27,13 +27,18 @@ SmsFmAudio::~SmsFmAudio() {
 
 void SmsFmAudio::Run() {
 	if (_fmEnabled && _emu->GetSettings()->GetSmsConfig().EnableFmAudio) {
-		uint64_t clocksToRun = _console->GetMasterClock() - _prevMasterClock;
-		while (clocksToRun >= 72) {
-			int16_t output = OPLL_calc(_opll);
-			_samplesToPlay.push_back(output);
-			_samplesToPlay.push_back(output);
-			_prevMasterClock += 72;
-			clocksToRun -= 72;
+		uint32_t sampleCount = (uint32_t)((_console->GetMasterClock() - _prevMasterClock) / 72);
+		if (sampleCount) {
+			// Render all samples since the last register write/mix in one block
+			size_t pos = _samplesToPlay.size();
+			_samplesToPlay.resize(pos + sampleCount * 2);
+			int16_t* out = _samplesToPlay.data() + pos;
+			for (uint32_t i = 0; i < sampleCount; i++) {
+				int16_t output = OPLL_calc(_opll);
+				out[i * 2] = output;
+				out[i * 2 + 1] = output;
+			}
+			_prevMasterClock += (uint64_t)sampleCount * 72;
 		}
 	} else {
 		_prevMasterClock = _console->GetMasterClock();
@@ -177,7 +177,7 @@ void SmsMemoryManager::SaveBattery() {
 AddressInfo SmsMemoryManager::GetAbsoluteAddress(uint16_t addr) {
 	AddressInfo addrInfo = {-1, MemoryType::None};
 
-	uint8_t* ptr = _reads[addr >> 8];
+	uint8_t* ptr = _pages.GetReadPage(addr);
 	if (!ptr) {
 		return addrInfo;
 	}
@@ -211,38 +211,12 @@ int32_t SmsMemoryManager::GetRelativeAddress(AddressInfo& absAddress) {
 }
 
 void SmsMemoryManager::Map(uint16_t start, uint16_t end, MemoryType type, uint32_t offset, bool readonly) {
-	uint8_t* src = (uint8_t*)_emu->GetMemory(type).Memory;
-	uint32_t size = _emu->GetMemory(type).Size;
-
-	if (size > 0) {
-		while (offset >= size) {
-			offset -= size;
-		}
-
-		src += offset;
-		for (int i = start; i < end; i += 0x100) {
-			_reads[i >> 8] = src;
-			_writes[i >> 8] = readonly ? nullptr : src;
-
-			if (src) {
-				src += 0x100;
-				offset = (offset + 0x100);
-				if (offset >= size) {
-					offset = 0;
-					src = (uint8_t*)_emu->GetMemory(type).Memory;
-				}
-			}
-		}
-	} else {
-		Unmap(start, end);
-	}
+	ConsoleMemoryInfo memory = _emu->GetMemory(type);
+	_pages.Map(start, end, (uint8_t*)memory.Memory, memory.Size, offset, readonly);
 }
 
 void SmsMemoryManager::Unmap(uint16_t start, uint16_t end) {
-	for (int i = start; i < end; i += 0x100) {
-		_reads[i >> 8] = nullptr;
-		_writes[i >> 8] = nullptr;
-	}
+	_pages.Unmap(start, end);
 }
 
 void SmsMemoryManager::MapRegisters(uint16_t start, uint16_t end, SmsRegisterAccess access) {
@@ -261,8 +235,7 @@ uint8_t SmsMemoryManager::DebugRead(uint16_t addr) {
 		return _cart->PeekRegister(addr);
 	}
 
-	uint8_t* data = _reads[addr >> 8];
-	return data ? data[(uint8_t)addr] : GetOpenBus();
+	return _pages.Read(addr, GetOpenBus());
 }
 
 void SmsMemoryManager::Write(uint16_t addr, uint8_t value) {
@@ -275,19 +248,14 @@ void SmsMemoryManager::Write(uint16_t addr, uint8_t value) {
 				_biosMapper->WriteRegister(addr, value);
 			}
 		}
-		if (_writes[addr >> 8]) {
-			_writes[addr >> 8][(uint8_t)addr] = value;
-		}
+		_pages.Write(addr, value);
 		_state.OpenBus = value;
 	}
 }
 
 void SmsMemoryManager::DebugWrite(uint16_t addr, uint8_t value) {
 	// TODOSMS - allow side-effects for debugger
-	uint8_t* data = _writes[addr >> 8];
-	if (data) {
-		data[(uint8_t)addr] = value;
-	}
+	_pages.Write(addr, value);
 }
 
 uint8_t SmsMemoryManager::DebugReadPort(uint8_t port) {
@@ -5,6 +5,7 @@
 #include "SMS/Carts/SmsCart.h"
 #include "Shared/Emulator.h"
 #include "Shared/CheatManager.h"
+#include "Shared/MemoryPageTable.h"
 #include "Debugger/AddressInfo.h"
 #include "Shared/MemoryOperationType.h"
 #include "Utilities/ISerializable.h"
@@ -116,11 +117,8 @@ private:
 	/// <summary>Master clock cycle counter.</summary>
 	uint64_t _masterClock = 0;
 
-	/// <summary>Read mapping table (256 pages).</summary>
-	uint8_t* _reads[0x100] = {};
-
-	/// <summary>Write mapping table (256 pages).</summary>
-	uint8_t* _writes[0x100] = {};
+	/// <summary>Read/write mapping tables (256-byte pages).</summary>
+	MemoryPageTable<8, 0x100> _pages;
 
 	/// <summary>SG-1000 RAM mapping address (-1 if none).</summary>
 	int32_t _sgRamMapAddress = -1;
@@ -208,8 +206,8 @@ public:
 		uint8_t value;
 		if (_state.IsReadRegister[addr >> 8]) {
 			value = _cart->ReadRegister(addr);
-		} else if (_reads[addr >> 8]) {
-			value = _reads[addr >> 8][(uint8_t)addr];
+		} else if (uint8_t* page = _pages.GetReadPage(addr)) {
+			value = page[(uint8_t)addr];
 		} else {
 			value = GetOpenBus();
 		}
@@ -10,17 +10,11 @@
 
 SmsNtscFilter::SmsNtscFilter(Emulator* emu, SmsConsole* console) : BaseVideoFilter(emu) {
 	_console = console;
-	_ntscData = std::make_unique<sms_ntsc_t>();
 	_ntscSetup = std::make_unique<sms_ntsc_setup_t>();
-	memset(_ntscData.get(), 0, sizeof(sms_ntsc_t));
 	memset(_ntscSetup.get(), 0, sizeof(sms_ntsc_setup_t));
-	sms_ntsc_init(_ntscData.get(), _ntscSetup.get());
-
-	_snesNtscData = std::make_unique<snes_ntsc_t>();
 	_snesNtscSetup = std::make_unique<snes_ntsc_setup_t>();
-	memset(_snesNtscData.get(), 0, sizeof(snes_ntsc_t));
 	memset(_snesNtscSetup.get(), 0, sizeof(snes_ntsc_setup_t));
-	snes_ntsc_init(_snesNtscData.get(), _snesNtscSetup.get());
+	InitNtscData();
 
 	uint32_t max = std::max(SMS_NTSC_OUT_WIDTH(256), SNES_NTSC_OUT_WIDTH(256));
 	_ntscBuffer = std::make_unique<uint32_t[]>(max * 240);
@@ -56,13 +50,38 @@ HudScaleFactors SmsNtscFilter::GetScaleFactor() {
 	}
 }
 
-void SmsNtscFilter::OnBeforeApplyFilter() {
-	if (GenericNtscFilter::NtscFilterOptionsChanged(*_ntscSetup.get(), _emu->GetSettings()->GetVideoConfig())) {
-		GenericNtscFilter::InitNtscFilter(*_ntscSetup.get(), _emu->GetSettings()->GetVideoConfig());
-		sms_ntsc_init(_ntscData.get(), _ntscSetup.get());
+void SmsNtscFilter::InitNtscData() {
+	VideoConfig& cfg = _emu->GetSettings()->GetVideoConfig();
 
-		GenericNtscFilter::InitNtscFilter(*_snesNtscSetup.get(), _emu->GetSettings()->GetVideoConfig());
+	// Only build (and allocate) the tables used by this console: the Game Gear uses the SNES filter, other models use the SMS filter
+	if (_console->GetModel() == SmsModel::GameGear) {
+		if (!_snesNtscData) {
+			_snesNtscData = std::make_unique<snes_ntsc_t>();
+			memset(_snesNtscData.get(), 0, sizeof(snes_ntsc_t));
+		}
+		GenericNtscFilter::InitNtscFilter(*_snesNtscSetup.get(), cfg);
 		snes_ntsc_init(_snesNtscData.get(), _snesNtscSetup.get());
+	} else {
+		if (!_ntscData) {
+			_ntscData = std::make_unique<sms_ntsc_t>();
+			memset(_ntscData.get(), 0, sizeof(sms_ntsc_t));
+		}
+		GenericNtscFilter::InitNtscFilter(*_ntscSetup.get(), cfg);
+		sms_ntsc_init(_ntscData.get(), _ntscSetup.get());
+	}
+}
+
+void SmsNtscFilter::OnBeforeApplyFilter() {
+	VideoConfig& cfg = _emu->GetSettings()->GetVideoConfig();
+	bool changed;
+	if (_console->GetModel() == SmsModel::GameGear) {
+		changed = GenericNtscFilter::NtscFilterOptionsChanged(*_snesNtscSetup.get(), cfg);
+	} else {
+		changed = GenericNtscFilter::NtscFilterOptionsChanged(*_ntscSetup.get(), cfg);
+	}
+
+	if (changed) {
+		InitNtscData();
 	}
 }
 
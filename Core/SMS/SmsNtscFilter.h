@@ -19,6 +19,9 @@ private:
 	std::unique_ptr<uint32_t[]> _ntscBuffer;
 	SmsConsole* _console = nullptr;
 
+	/// <summary>Builds the NTSC tables used by the console's model for the current settings</summary>
+	void InitNtscData();
+
 protected:
 	void OnBeforeApplyFilter() override;
 	FrameInfo GetFrameInfo() override;
@@ -1,6 +1,9 @@
 #include "pch.h"
 #include "SMS/SmsPsg.h"
 #include "SMS/SmsFmAudio.h"
+#include "SMS/SmsConsole.h"
+#include "Shared/Emulator.h"
+#include "Shared/FrameProfiler.h"
 #include "Utilities/Serializer.h"
 
 SmsPsg::SmsPsg(Emulator* emu, SmsConsole* console) {
@@ -63,6 +66,7 @@ void SmsPsg::RunNoise(SmsNoiseChannelState& noise) {
 }
 
 void SmsPsg::Run() {
+	PROFILE_SCOPE(_console->GetEmulator()->GetFrameProfiler(), ProfilerStage::Apu);
 	uint64_t runTo = _console->GetMasterClock();
 	uint32_t* volumes = _console->GetModel() == SmsModel::ColecoVision ? _settings->GetCvConfig().ChannelVolumes : _settings->GetSmsConfig().ChannelVolumes;
 
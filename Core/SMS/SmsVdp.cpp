@@ -545,10 +545,11 @@ uint8_t SmsVdp::ReverseBitOrder(uint8_t val) {
 }
 
 void SmsVdp::DrawPixel() {
-	int offset = _state.Scanline * 256 + GetVisiblePixelIndex();
-	_currentOutputBuffer[offset] = GetPixelColor();
-	if (_needCramDot) {
-		_currentOutputBuffer[offset] = _cramDotColor;
+	// GetPixelColor also shifts the sprite data and sets the sprite collision flag, it runs even when the frame isn't rendered
+	uint16_t color = GetPixelColor();
+	if (!_skipRender) {
+		int offset = _state.Scanline * 256 + GetVisiblePixelIndex();
+		_currentOutputBuffer[offset] = _needCramDot ? _cramDotColor : color;
 	}
 	_bgShifters[0] <<= 1;
 	_bgShifters[1] <<= 1;
@@ -632,7 +633,10 @@ void SmsVdp::ProcessEndOfScanline() {
 		_state.Scanline = 0;
 		_state.VerticalScrollLatch = _state.VerticalScroll;
 		_emu->ProcessEvent(EventType::StartFrame, CpuType::Sms);
-		_currentOutputBuffer = _currentOutputBuffer == _outputBuffers[0].get() ? _outputBuffers[1].get() : _outputBuffers[0].get();
+		_skipRender = _emu->IsRenderSkipped();
+		if (!_skipRender) {
+			_currentOutputBuffer = _currentOutputBuffer == _outputBuffers[0].get() ? _outputBuffers[1].get() : _outputBuffers[0].get();
+		}
 	}
 
 	_bgShifters[0] = 0;
@@ -747,6 +751,7 @@ uint16_t SmsVdp::GetSmsSpriteTileAddr(uint8_t sprTileIndex, uint8_t spriteRow, u
 }
 
 void SmsVdp::LoadSpriteTilesSms() {
+	_spriteLineMaskDirty = true;
 	uint16_t spriteAddr = _state.SpriteTableAddress & 0x3F00;
 
 	// Cycles 264 to 325
@@ -871,6 +876,7 @@ void SmsVdp::LoadExtraSpritesSms() {
 }
 
 void SmsVdp::LoadSpriteTilesSg() {
+	_spriteLineMaskDirty = true;
 	if (_state.M1_Use224LineMode) {
 		// No sprites in text mode
 		return;
@@ -1081,7 +1087,13 @@ uint16_t SmsVdp::GetPixelColor() {
 	bool spriteDrawn = false;
 	uint8_t spritePixelColor = 0;
 	uint16_t xPos = GetVisiblePixelIndex();
-	for (int i = 0; i < _spriteCount; i++) {
+	if (_spriteCount > 0 && _spriteLineMaskDirty) {
+		UpdateSpriteLineMask();
+	}
+
+	// Most pixels aren't covered by any sprite, skip the sprite loop for them
+	uint8_t spriteCount = ((_spriteLineMask[xPos >> 6] >> (xPos & 0x3F)) & 0x01) ? _spriteCount : 0;
+	for (int i = 0; i < spriteCount; i++) {
 		if (xPos >= _spriteShifters[i].SpriteX && xPos < _spriteShifters[i].SpriteX + (8 << (uint8_t)IsZoomedSpriteAllowed(i))) {
 			if (_state.UseMode4) {
 				uint8_t sprColor = (((_spriteShifters[i].TileData[0] >> 7) & 0x01) |
@@ -1153,6 +1165,21 @@ uint16_t SmsVdp::GetPixelColor() {
 	}
 }
 
+void SmsVdp::UpdateSpriteLineMask() {
+	// Sprites are only loaded during hblank, so this runs once per line (on its first pixel with sprites).
+	// Uses the largest possible sprite width (16 pixels, zoomed), so changes to the zoom flag mid-line
+	// can't make the mask miss a pixel - the per-sprite range check in GetPixelColor stays the same.
+	memset(_spriteLineMask, 0, sizeof(_spriteLineMask));
+	for (int i = 0; i < _spriteCount; i++) {
+		int start = std::max<int>(0, _spriteShifters[i].SpriteX);
+		int end = std::min<int>(256, _spriteShifters[i].SpriteX + 16);
+		for (int x = start; x < end; x++) {
+			_spriteLineMask[x >> 6] |= 1ULL << (x & 0x3F);
+		}
+	}
+	_spriteLineMaskDirty = false;
+}
+
 void SmsVdp::WriteRegister(uint8_t reg, uint8_t value) {
 	if (reg >= 8 && _model == SmsModel::ColecoVision) {
 		// These registers don't exist on the TMS9918A
@@ -1563,4 +1590,8 @@ void SmsVdp::Serialize(Serializer& s) {
 		SV(_needCramDot);
 		SV(_cramDotColor);
 	}
+
+	if (!s.IsSaving()) {
+		_spriteLineMaskDirty = true;
+	}
 }
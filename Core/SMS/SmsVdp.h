@@ -139,6 +139,9 @@ private:
 	/// <summary>Current output buffer pointer.</summary>
 	uint16_t* _currentOutputBuffer = nullptr;
 
+	/// <summary>Skip frame buffer writes for the current frame (run-ahead frames, see Emulator::IsRenderSkipped).</summary>
+	bool _skipRender = false;
+
 	/// <summary>VDP register state.</summary>
 	SmsVdpState _state = {};
 
@@ -204,6 +207,12 @@ private:
 	/// <summary>Sprite shifter data for rendering.</summary>
 	SpriteShifter _spriteShifters[64];
 
+	/// <summary>1 bit per pixel of the line, set if any loaded sprite can cover it (built from _spriteShifters).</summary>
+	uint64_t _spriteLineMask[4] = {};
+
+	/// <summary>Sprites were (re)loaded since _spriteLineMask was built.</summary>
+	bool _spriteLineMaskDirty = true;
+
 	/// <summary>Color RAM (6-bit SMS or raw GG).</summary>
 	uint8_t _paletteRam[0x40] = {};
 
@@ -319,6 +328,9 @@ private:
 	/// <summary>Gets final pixel color.</summary>
 	__forceinline uint16_t GetPixelColor();
 
+	/// <summary>Builds _spriteLineMask from the loaded sprites' X positions.</summary>
+	void UpdateSpriteLineMask();
+
 	/// <summary>Loads sprite tiles (legacy modes).</summary>
 	void LoadSpriteTilesSg();
 
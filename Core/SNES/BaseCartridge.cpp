@@ -55,6 +55,7 @@ unique_ptr<BaseCartridge> BaseCartridge::CreateCartridge(SnesConsole* console, V
 
 		cart->_console = console;
 		cart->_emu = console->GetEmulator();
+		cart->_profiler = cart->_emu->GetFrameProfiler();
 		cart->_romPath = romFile;
 
 		string fileExt = FolderUtilities::GetExtension(romFile.GetFileName());
@@ -567,7 +568,7 @@ void BaseCartridge::InitCoprocessor() {
 	} else if (_coprocessorType == CoprocessorType::SGB) {
 		_coprocessor = std::make_unique<SuperGameboy>(_console, _gameboy.get());
 		_sgb = dynamic_cast<SuperGameboy*>(_coprocessor.get());
-		_needCoprocSync = true;
+		// The Game Boy only talks to the SNES through the SGB registers, it is run when they are accessed (and at the end of the frame)
 		_gameboy->PowerOn(_sgb);
 	}
 }
@@ -948,6 +949,7 @@ Gameboy* BaseCartridge::GetGameboy() {
 
 void BaseCartridge::RunCoprocessors() {
 	// These coprocessors are run at the end of the frame, or as needed
+	PROFILE_SCOPE(_profiler, ProfilerStage::Coprocessor);
 	if (_necDsp) {
 		_necDsp->Run();
 	}
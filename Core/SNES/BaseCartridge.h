@@ -3,6 +3,7 @@
 #include "SNES/IMemoryHandler.h"
 #include "SNES/CartTypes.h"
 #include "SNES/Coprocessors/BaseCoprocessor.h"
+#include "Shared/FrameProfiler.h"
 #include "Utilities/ISerializable.h"
 #include "Shared/RomInfo.h"
 
@@ -65,6 +66,7 @@ class BaseCartridge : public ISerializable {
 private:
 	Emulator* _emu = nullptr;
 	SnesConsole* _console = nullptr;
+	FrameProfiler* _profiler = nullptr; ///< Cached, SyncCoprocessors is inlined in the CPU's memory accesses
 
 	vector<unique_ptr<IMemoryHandler>> _prgRomHandlers;
 	vector<unique_ptr<IMemoryHandler>> _saveRamHandlers;
@@ -178,10 +180,20 @@ public:
 
 	__forceinline void SyncCoprocessors() {
 		if (_needCoprocSync) [[unlikely]] {
+			PROFILE_SCOPE(_profiler, ProfilerStage::Coprocessor);
 			_coprocessor->Run();
 		}
 	}
 
+	/// <summary>
+	/// Turns the per-cycle coprocessor sync on or off. A coprocessor that has nothing to do until the CPU
+	/// accesses it again can turn it off, it must then catch up (Run) on its own when it is accessed.
+	/// </summary>
+	void SetCoprocessorSync(bool enabled) { _needCoprocSync = enabled; }
+
+	/// <summary>True when the coprocessor runs on every master clock step (SyncCoprocessors).</summary>
+	[[nodiscard]] bool IsCoprocessorSyncEnabled() { return _needCoprocSync; }
+
 	BaseCoprocessor* GetCoprocessor();
 
 	vector<unique_ptr<IMemoryHandler>>& GetPrgRomHandlers();
@@ -143,5 +143,9 @@ public:
 		/// <param name="addr">Address to write.</param>
 		/// <param name="value">Command/data byte.</param>
 		void Write(uint32_t addr, uint8_t value) override;
+
+		// Reads/writes go through the flash protocol
+		uint8_t* GetDirectReadPage() override { return nullptr; }
+		uint8_t* GetDirectWritePage() override { return nullptr; }
 	};
 };
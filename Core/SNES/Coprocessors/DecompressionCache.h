@@ -0,0 +1,100 @@
+#pragma once
+#include "pch.h"
+
+/// <summary>
+/// Cache of decompressed streams for the S-DD1 and SPC7110 decompressors.
+/// </summary>
+/// <remarks>
+/// Games often restart the decompression of the same data (e.g graphics reloaded on every screen change),
+/// and running the context-model decoders again is expensive. The output of each stream is recorded,
+/// keyed by everything the output depends on (source address, mode, ROM mapping), and replayed the
+/// next time the same stream starts.
+///
+/// While a stream is replayed, the decoder's own state isn't updated: it lags behind by GetLag() values.
+/// The decoder must decode (and discard) the missing values before it decodes past the end of the cached
+/// output, or before its state is saved (save states, rewind). Its state is then exactly the same as
+/// if the cache didn't exist.
+///
+/// Usage, for each value read by the emulated chip:
+///   if (!_cache.TryGetNext(value)) { CatchUp(); value = DecodeNext(); _cache.AddLive(value); }
+/// </remarks>
+template<typename T>
+class DecompressionCache {
+public:
+	static constexpr size_t MaxCachedBytes = 4 * 1024 * 1024;
+	static constexpr size_t MaxStreamBytes = 256 * 1024;
+
+private:
+	struct Entry {
+		vector<T> Output;
+		uint64_t LastUse = 0;
+	};
+
+	std::unordered_map<uint64_t, Entry> _entries;
+	size_t _cachedValues = 0;
+	uint64_t _useCounter = 0;
+
+	Entry* _stream = nullptr;
+	uint32_t _streamPos = 0; ///< Number of values read by the emulated chip since the stream started
+	uint32_t _livePos = 0;   ///< Number of values decoded by the decoder since the stream started
+
+	void EvictEntries() {
+		while (_cachedValues > DecompressionCache::MaxCachedBytes / sizeof(T) && _entries.size() > 1) {
+			// The current stream was just used, it's never the least recently used entry
+			auto oldest = std::min_element(_entries.begin(), _entries.end(), [](const auto& a, const auto& b) {
+				return a.second.LastUse < b.second.LastUse;
+			});
+			_cachedValues -= oldest->second.Output.size();
+			_entries.erase(oldest);
+		}
+	}
+
+public:
+	/// <summary>Starts a new stream (the decoder was just initialized)</summary>
+	void BeginStream(uint64_t key) {
+		_stream = &_entries[key];
+		_stream->LastUse = ++_useCounter;
+		_streamPos = 0;
+		_livePos = 0;
+		EvictEntries();
+	}
+
+	/// <summary>Stops recording/replaying the current stream (e.g after loading a state in the middle of a stream)</summary>
+	void EndStream() {
+		_stream = nullptr;
+		_streamPos = 0;
+		_livePos = 0;
+	}
+
+	/// <summary>Returns the next value of the stream if it was cached</summary>
+	__forceinline bool TryGetNext(T& value) {
+		if (_stream && _streamPos < _stream->Output.size()) {
+			value = _stream->Output[_streamPos++];
+			return true;
+		}
+		return false;
+	}
+
+	/// <summary>Number of values the decoder needs to decode (and discard) to catch up with the stream</summary>
+	[[nodiscard]] uint32_t GetLag() { return _streamPos - _livePos; }
+
+	/// <summary>Called once the decoder decoded the values returned by GetLag()</summary>
+	void SetCaughtUp() { _livePos = _streamPos; }
+
+	/// <summary>Records a value decoded by the decoder (after catching up)</summary>
+	void AddLive(T value) {
+		if (_stream && _stream->Output.size() == _streamPos && _stream->Output.size() < DecompressionCache::MaxStreamBytes / sizeof(T)) {
+			_stream->Output.push_back(value);
+			_cachedValues++;
+		}
+		_streamPos++;
+		_livePos++;
+	}
+
+	/// <summary>Discards all cached streams</summary>
+	void Clear() {
+		EndStream();
+		_entries.clear();
+		_cachedValues = 0;
+	}
+};
@@ -19,6 +19,7 @@ Gsu::Gsu(SnesConsole* console, uint32_t gsuRamSize) {
 	_emu = console->GetEmulator();
 	_console = console;
 	_memoryManager = console->GetMemoryManager();
+	_cart = console->GetCartridge();
 	_cpu = console->GetCpu();
 	_settings = _emu->GetSettings();
 
@@ -74,6 +75,8 @@ Gsu::Gsu(SnesConsole* console, uint32_t gsuRamSize) {
 Gsu::~Gsu() = default;
 
 void Gsu::ProcessEndOfFrame() {
+	WakeUp();
+
 	uint8_t clockMultiplier = std::max(1u, _settings->GetSnesConfig().GsuClockSpeed / 100);
 	if (_clockMultiplier != clockMultiplier) {
 		_state.CycleCount = (uint64_t)((double)_state.CycleCount / _clockMultiplier * clockMultiplier);
@@ -91,6 +94,21 @@ void Gsu::Run() {
 	if (targetCycle > _state.CycleCount) {
 		Step(targetCycle - _state.CycleCount);
 	}
+
+	if (_stopped && !_state.SFR.Running && !_state.RomDelay && !_state.RamDelay && !_emu->IsDebugging()) {
+		// Nothing changes (other than the cycle counter) until the CPU writes to the registers again
+		_idle = true;
+		_cart->SetCoprocessorSync(false);
+	}
+}
+
+void Gsu::WakeUp() {
+	if (_idle) {
+		// Catch up the cycle counter and sync on every cycle again
+		Run();
+		_idle = false;
+		_cart->SetCoprocessorSync(true);
+	}
 }
 
 void Gsu::Exec() {
@@ -775,6 +793,8 @@ uint8_t Gsu::Read(uint32_t addr) {
 }
 
 void Gsu::Write(uint32_t addr, uint8_t value) {
+	WakeUp();
+
 	addr &= 0x33FF;
 	if (_state.SFR.Running && addr != 0x3030 && addr != 0x303A) {
 		//"During GSU operation, only SFR, SCMR, and VCR may be accessed."
@@ -918,6 +938,8 @@ AddressInfo Gsu::GetAbsoluteAddress(uint32_t address) {
 }
 
 void Gsu::Serialize(Serializer& s) {
+	WakeUp();
+
 	SV(_state.CycleCount);
 	SV(_state.RegisterLatch);
 	SV(_state.ProgramBank);
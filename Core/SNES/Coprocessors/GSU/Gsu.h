@@ -10,6 +10,7 @@ class Emulator;
 class SnesConsole;
 class SnesCpu;
 class SnesMemoryManager;
+class BaseCartridge;
 class EmuSettings;
 
 enum class MemoryOperationType;
@@ -43,6 +44,9 @@ private:
 	/// <summary>Pointer to the SNES memory manager for memory access.</summary>
 	SnesMemoryManager* _memoryManager;
 
+	/// <summary>Cartridge, syncs the GSU on every CPU cycle while it runs.</summary>
+	BaseCartridge* _cart;
+
 	/// <summary>Pointer to the main SNES CPU for synchronization.</summary>
 	SnesCpu* _cpu;
 
@@ -70,6 +74,9 @@ private:
 	/// <summary>Flag indicating GSU has stopped execution.</summary>
 	bool _stopped = true;
 
+	/// <summary>GSU is stopped with no pending ROM/RAM operation, the cartridge doesn't sync it until the CPU writes to it.</summary>
+	bool _idle = false;
+
 	/// <summary>Flag indicating R15 (PC) was modified and cache may need refresh.</summary>
 	bool _r15Changed = false;
 
@@ -489,6 +496,9 @@ public:
 	/// <summary>Main execution loop - runs GSU until stopped.</summary>
 	void Run() override;
 
+	/// <summary>Catches up and turns the per-cycle sync back on if the GSU was idle.</summary>
+	void WakeUp();
+
 	/// <summary>Resets the GSU to initial power-on state.</summary>
 	void Reset() override;
 
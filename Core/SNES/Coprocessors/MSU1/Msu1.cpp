@@ -5,6 +5,7 @@
 #include "Shared/Audio/SoundMixer.h"
 #include "Utilities/Serializer.h"
 #include "Utilities/FolderUtilities.h"
+#include "Utilities/PathUtil.h"
 
 Msu1* Msu1::Init(Emulator* emu, VirtualFile& romFile, Spc* spc) {
 	string romFolder = romFile.GetFolderPath();
@@ -23,19 +24,22 @@ Msu1::Msu1(Emulator* emu, VirtualFile& romFile, Spc* spc) {
 	_spc = spc;
 	_romFolder = romFile.GetFolderPath();
 	_romName = FolderUtilities::GetFilename(romFile.GetFileName(), false);
-	_dataFile.open(FolderUtilities::CombinePath(_romFolder, _romName) + ".msu", ios::binary);
-	if (_dataFile) {
+	if (_dataFile.Open(FolderUtilities::CombinePath(_romFolder, _romName) + ".msu")) {
 		_trackPath = FolderUtilities::CombinePath(_romFolder, _romName);
 	} else {
-		_dataFile.open(FolderUtilities::CombinePath(_romFolder, "msu1.rom"), ios::binary);
+		(void)_dataFile.Open(FolderUtilities::CombinePath(_romFolder, "msu1.rom"));
 		_trackPath = FolderUtilities::CombinePath(_romFolder, "track");
 	}
 
-	if (_dataFile) {
-		_dataFile.seekg(0, ios::end);
-		_dataSize = (uint32_t)_dataFile.tellg();
-	} else {
-		_dataSize = 0;
+	_dataSize = (uint32_t)std::min<size_t>(_dataFile.GetSize(), UINT32_MAX);
+
+	// List the tracks once, so track changes don't need to check if the file exists
+	for (const string& file : FolderUtilities::GetFilesInFolder(_romFolder, {".pcm"}, false)) {
+		std::error_code errorCode;
+		uint64_t size = fs::file_size(PathUtil::FromUtf8(file), errorCode);
+		if (!errorCode) {
+			_trackFiles[FolderUtilities::GetFilename(file, true)] = size;
+		}
 	}
 
 	_emu->GetSoundMixer()->RegisterAudioProvider(this);
@@ -59,7 +63,6 @@ void Msu1::Write(uint16_t addr, uint8_t value) {
 		case 0x2003:
 			_tmpDataPointer = (_tmpDataPointer & 0x00FFFFFF) | (value << 24);
 			_dataPointer = _tmpDataPointer;
-			_dataFile.seekg(_dataPointer, ios::beg);
 			break;
 
 		case 0x2004:
@@ -92,8 +95,7 @@ uint8_t Msu1::Read(uint16_t addr) {
 		case 0x2001:
 			// data
 			if (!_dataBusy && _dataPointer < _dataSize) {
-				_dataPointer++;
-				return (uint8_t)_dataFile.get();
+				return _dataFile.GetData()[_dataPointer++];
 			}
 			return 0;
 
@@ -123,8 +125,26 @@ void Msu1::MixAudio(int16_t* buffer, uint32_t sampleCount, uint32_t sampleRate)
 	}
 }
 
+bool Msu1::IsTrackAvailable(const string& path) {
+	auto result = _trackFiles.find(FolderUtilities::GetFilename(path, true));
+	if (result != _trackFiles.end()) {
+		return result->second >= 12;
+	}
+
+	// Not found when the game was loaded (or the filename's case doesn't match), check the disk
+	ifstream file(path, ios::binary | ios::ate);
+	return file && file.tellg() >= 12;
+}
+
 void Msu1::LoadTrack(uint32_t startOffset) {
-	_trackMissing = !_pcmReader.Init(_trackPath + "-" + std::to_string(_trackSelect) + ".pcm", _repeat, startOffset);
+	string path = _trackPath + "-" + std::to_string(_trackSelect) + ".pcm";
+	_trackMissing = !IsTrackAvailable(path);
+	if (_trackMissing) {
+		_pcmReader.Stop();
+	} else {
+		// The file is opened and read ahead by the streaming thread
+		_pcmReader.Open(path, _repeat, startOffset);
+	}
 }
 
 void Msu1::Serialize(Serializer& s) {
@@ -140,7 +160,6 @@ void Msu1::Serialize(Serializer& s) {
 	SV(_dataBusy);
 	SV(offset);
 	if (!s.IsSaving()) {
-		_dataFile.seekg(_dataPointer, ios::beg);
 		LoadTrack(offset);
 	}
 }
@@ -4,6 +4,7 @@
 #include "Shared/Audio/PcmReader.h"
 #include "Utilities/ISerializable.h"
 #include "Utilities/VirtualFile.h"
+#include "Utilities/MemoryMappedFile.h"
 
 class Spc;
 class Emulator;
@@ -78,12 +79,20 @@ private:
 	/// <summary>True when requested audio track file is not found.</summary>
 	bool _trackMissing = false;
 
-	/// <summary>Input stream for .msu data file.</summary>
-	ifstream _dataFile;
+	/// <summary>Read-only mapping of the .msu data file ($2001 reads are served directly from it).</summary>
+	MemoryMappedFile _dataFile;
 
 	/// <summary>Size of currently loaded data file.</summary>
 	uint32_t _dataSize;
 
+	/// <summary>Sizes of the .pcm files found in the ROM's folder when the game was loaded, by filename.</summary>
+	std::unordered_map<string, uint64_t> _trackFiles;
+
+	/// <summary>
+	/// Returns true if the track file exists and is valid, without accessing the disk for known tracks.
+	/// </summary>
+	bool IsTrackAvailable(const string& path);
+
 	/// <summary>
 	/// Loads an audio track file.
 	/// </summary>
@@ -568,7 +568,11 @@ void Sa1::WriteSa1(uint32_t addr, uint8_t value, MemoryOperationType type) {
 		if (handler) {
 			_lastAccessMemType = handler->GetMemoryType();
 			_openBus = value;
-			handler->Write(addr, value);
+			if (uint8_t* page = _mappings.GetDirectWritePage(addr)) {
+				page[addr & 0xFFF] = value;
+			} else {
+				handler->Write(addr, value);
+			}
 		} else {
 			LogDebug("[Debug] Write SA1 - missing handler: $" + HexUtilities::ToHex(addr));
 		}
@@ -579,7 +583,8 @@ uint8_t Sa1::ReadSa1(uint32_t addr, MemoryOperationType type) {
 	IMemoryHandler* handler = _mappings.GetHandler(addr);
 	uint8_t value;
 	if (handler) {
-		value = handler->Read(addr);
+		uint8_t* page = _mappings.GetDirectReadPage(addr);
+		value = page ? page[addr & 0xFFF] : handler->Read(addr);
 		_lastAccessMemType = handler->GetMemoryType();
 		_openBus = value;
 	} else {
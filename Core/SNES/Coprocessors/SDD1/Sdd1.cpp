@@ -43,6 +43,7 @@ Sdd1::Sdd1(SnesConsole* console) {
 }
 
 void Sdd1::Reset() {
+	_sdd1Mmc->CatchUpDecompressor();
 	_state = {};
 	_state.NeedInit = true;
 	_state.SelectedBanks[0] = 0;
@@ -85,6 +86,8 @@ void Sdd1::Write(uint32_t addr, uint8_t value) {
 			case 5:
 			case 6:
 			case 7:
+				// The decompressor's lagging reads must be done with the banks that were used when the stream started
+				_sdd1Mmc->CatchUpDecompressor();
 				_state.SelectedBanks[addr & 0x03] = value;
 				break;
 		}
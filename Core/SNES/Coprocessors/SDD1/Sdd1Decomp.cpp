@@ -639,13 +639,38 @@ void Sdd1Decomp::Init(Sdd1Mmc* mmc, uint32_t readAddr) {
 	PEM.prepareDecomp();
 	CM.prepareDecomp(firstByte);
 	OL.prepareDecomp(firstByte);
+
+	// The output depends on the ROM's content (which can't change) and on the bank registers
+	_cache.BeginStream(((uint64_t)mmc->GetSelectedBanks() << 32) | readAddr);
 }
 
 uint8_t Sdd1Decomp::GetDecompressedByte() {
-	return OL.decompressByte();
+	uint8_t value;
+	if (_cache.TryGetNext(value)) {
+		return value;
+	}
+
+	CatchUp();
+	value = OL.decompressByte();
+	_cache.AddLive(value);
+	return value;
+}
+
+void Sdd1Decomp::CatchUp() {
+	for (uint32_t i = _cache.GetLag(); i > 0; i--) {
+		(void)OL.decompressByte();
+	}
+	_cache.SetCaughtUp();
 }
 
 void Sdd1Decomp::Serialize(Serializer& s) {
+	if (s.IsSaving()) {
+		CatchUp();
+	} else {
+		// The position in the stream isn't saved, continue without the cache until the next stream starts
+		_cache.EndStream();
+	}
+
 	SV(IM);
 	SV(BG0);
 	SV(BG1);
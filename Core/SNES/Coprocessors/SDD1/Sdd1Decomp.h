@@ -1,6 +1,7 @@
 #pragma once
 #include "pch.h"
 #include "Utilities/ISerializable.h"
+#include "SNES/Coprocessors/DecompressionCache.h"
 
 /************************************************************************
 
@@ -144,12 +145,19 @@ private:
 	SDD1_CM* const CM;
 };
 
+/// <summary>
+/// S-DD1 decompressor. The output of each stream is recorded in a DecompressionCache keyed by
+/// (source address, bank registers) and replayed when a DMA restarts a stream that was already decompressed.
+/// </summary>
 class Sdd1Decomp : public ISerializable {
 public:
 	Sdd1Decomp();
 	void Init(Sdd1Mmc* mmc, uint32_t readAddr);
 	uint8_t GetDecompressedByte();
 
+	/// <summary>Decodes the bytes that were replayed from the cache, to bring the decoder's state up to date.</summary>
+	void CatchUp();
+
 	void Serialize(Serializer& s) override;
 
 private:
@@ -166,4 +174,6 @@ private:
 	SDD1_PEM PEM;
 	SDD1_CM CM;
 	SDD1_OL OL;
+
+	DecompressionCache<uint8_t> _cache;
 };
\ No newline at end of file
@@ -15,6 +15,14 @@ uint8_t Sdd1Mmc::ReadRom(uint32_t addr) {
 	return GetHandler(addr)->Read(addr);
 }
 
+uint32_t Sdd1Mmc::GetSelectedBanks() {
+	return _state->SelectedBanks[0] | (_state->SelectedBanks[1] << 8) | (_state->SelectedBanks[2] << 16) | (_state->SelectedBanks[3] << 24);
+}
+
+void Sdd1Mmc::CatchUpDecompressor() {
+	_decompressor.CatchUp();
+}
+
 uint16_t Sdd1Mmc::ProcessRomMirroring(uint32_t addr) {
 	if (((addr & 0x800000) && _state->SelectedBanks[3] & 0x80) || (!(addr & 0x800000) && (_state->SelectedBanks[1] & 0x80))) {
 		// Force mirroring: $20-$3F mirrors $00-$1F, $A0-$BF mirrors $80-$9F
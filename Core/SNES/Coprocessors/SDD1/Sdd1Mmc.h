@@ -60,6 +60,12 @@ public:
 	/// <returns>ROM data byte.</returns>
 	uint8_t ReadRom(uint32_t addr);
 
+	/// <summary>Bank registers used by ReadRom() ($4804-$4807), packed in a single value.</summary>
+	[[nodiscard]] uint32_t GetSelectedBanks();
+
+	/// <summary>Brings the decompressor's state up to date, must be called before the bank registers change.</summary>
+	void CatchUpDecompressor();
+
 	/// <summary>
 	/// Reads from MMC address space with decompression.
 	/// </summary>
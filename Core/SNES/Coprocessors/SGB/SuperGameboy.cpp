@@ -13,6 +13,7 @@
 #include "Shared/MessageManager.h"
 #include "Shared/Audio/SoundMixer.h"
 #include "Utilities/HexUtilities.h"
+#include "Utilities/Serializer.h"
 #include "Utilities/Audio/HermiteResampler.h"
 
 SuperGameboy::SuperGameboy(SnesConsole* console, Gameboy* gameboy) {
@@ -67,6 +68,8 @@ void SuperGameboy::Reset() {
 }
 
 uint8_t SuperGameboy::Read(uint32_t addr) {
+	Run();
+
 	addr &= 0xF80F;
 
 	if (addr >= 0x7000 && addr <= 0x700F) {
@@ -105,6 +108,8 @@ uint8_t SuperGameboy::Read(uint32_t addr) {
 }
 
 void SuperGameboy::Write(uint32_t addr, uint8_t value) {
+	Run();
+
 	addr &= 0xF80F;
 
 	switch (addr & 0xFFFF) {
@@ -341,6 +346,14 @@ void SuperGameboy::MixAudio(int16_t* out, uint32_t sampleCount, uint32_t sampleR
 	}
 }
 
+void SuperGameboy::ProcessEndOfFrame() {
+	// Keep the Game Boy in lockstep with the SNES while debugging (breakpoints, stepping)
+	_cart->SetCoprocessorSync(_emu->IsDebugging());
+
+	// Catch up before the end of frame audio mixing
+	Run();
+}
+
 void SuperGameboy::Run() {
 	if (!(_control & 0x80)) {
 		return;
@@ -418,6 +431,10 @@ AddressInfo SuperGameboy::GetAbsoluteAddress(uint32_t address) {
 }
 
 void SuperGameboy::Serialize(Serializer& s) {
+	if (s.IsSaving()) {
+		Run();
+	}
+
 	SV(_control);
 	SV(_resetClock);
 	SV(_input[0]);
@@ -170,6 +170,9 @@ public:
 	/// <summary>Main execution loop - runs Game Boy CPU.</summary>
 	void Run() override;
 
+	/// <summary>Catches up the Game Boy at the end of the SNES frame.</summary>
+	void ProcessEndOfFrame() override;
+
 	/// <summary>
 	/// Processes joypad port writes for packet communication.
 	/// </summary>
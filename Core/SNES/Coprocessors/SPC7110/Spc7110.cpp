@@ -355,6 +355,7 @@ void Spc7110::Write(uint32_t addr, uint8_t value) {
 			UpdateMappings();
 			break;
 		case 0x4834:
+			_decomp->CatchUp();
 			_dataRomSize = value & 0x07;
 			break;
 
@@ -428,10 +429,13 @@ void Spc7110::ProcessDivision() {
 	_aluState &= 0x7F;
 }
 
-uint8_t Spc7110::ReadDataRom(uint32_t addr) {
+uint32_t Spc7110::GetDataRomSize() {
 	uint32_t configSize = 0x100000 * (1 << (_dataRomSize & 0x03));
-	uint32_t dataRomSize = std::min(configSize, _realDataRomSize);
-	if (addr >= dataRomSize) {
+	return std::min(configSize, _realDataRomSize);
+}
+
+uint8_t Spc7110::ReadDataRom(uint32_t addr) {
+	if (addr >= GetDataRomSize()) {
 		return 0x00;
 	}
 
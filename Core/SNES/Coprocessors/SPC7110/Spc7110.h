@@ -188,6 +188,9 @@ public:
 	/// <returns>Data byte.</returns>
 	uint8_t ReadDataRom(uint32_t addr);
 
+	/// <summary>Size of the data ROM visible to the decompressor (depends on the $4834 configuration).</summary>
+	[[nodiscard]] uint32_t GetDataRomSize();
+
 	/// <summary>Serializes SPC7110 state for save states.</summary>
 	void Serialize(Serializer& s) override;
 
@@ -53,9 +53,29 @@ void Spc7110Decomp::Initialize(uint32_t mode, uint32_t origin) {
 	_output = 0;
 	_pixels = 0;
 	_colormap = 0xfedcba9876543210ull;
+
+	// The output only depends on the data ROM's content, which can't change
+	_cache.BeginStream(((uint64_t)_spc->GetDataRomSize() << 32) | (mode << 24) | (origin & 0xFFFFFF));
 }
 
 void Spc7110Decomp::Decode() {
+	if (_cache.TryGetNext(_result)) {
+		return;
+	}
+
+	CatchUp();
+	DecodeRow();
+	_cache.AddLive(_result);
+}
+
+void Spc7110Decomp::CatchUp() {
+	for (uint32_t i = _cache.GetLag(); i > 0; i--) {
+		DecodeRow();
+	}
+	_cache.SetCaughtUp();
+}
+
+void Spc7110Decomp::DecodeRow() {
 	for (uint32_t pixel = 0; pixel < 8; pixel++) {
 		uint64_t map = _colormap;
 		uint32_t diff = 0;
@@ -155,6 +175,13 @@ uint8_t Spc7110Decomp::GetBpp() {
 }
 
 void Spc7110Decomp::Serialize(Serializer& s) {
+	if (s.IsSaving()) {
+		CatchUp();
+	} else {
+		// The position in the stream isn't saved, continue without the cache until the next stream starts
+		_cache.EndStream();
+	}
+
 	SV(_bpp);
 	SV(_offset);
 	SV(_bits);
@@ -1,6 +1,7 @@
 #pragma once
 #include "pch.h"
 #include "Utilities/ISerializable.h"
+#include "SNES/Coprocessors/DecompressionCache.h"
 
 // Based on bsnes' code (by byuu)
 // original implementation: neviksti
@@ -26,6 +27,9 @@ class Spc7110;
 /// with probability values and next-state transitions for MPS/LPS outcomes.
 /// 
 /// Original implementation by neviksti, optimized by talarubi for bsnes.
+///
+/// Decoded rows are recorded in a DecompressionCache keyed by (mode, origin, data ROM size) and replayed
+/// when a game restarts a stream it already decompressed.
 /// </remarks>
 class Spc7110Decomp : public ISerializable {
 private:
@@ -97,6 +101,9 @@ private:
 	/// <summary>Decoded tile data after calling Decode().</summary>
 	uint32_t _result;
 
+	/// <summary>Rows decoded by previous streams.</summary>
+	DecompressionCache<uint32_t> _cache;
+
 private:
 	/// <summary>
 	/// Reads next byte from compressed data stream.
@@ -120,6 +127,10 @@ private:
 	/// <returns>Updated MRU list.</returns>
 	uint64_t MoveToFront(uint64_t list, uint32_t nibble);
 
+	/// <summary>Decodes the next row with the context model, into _result.</summary>
+	void DecodeRow();
+
+
 public:
 	/// <summary>
 	/// Creates a new SPC7110 decompressor.
@@ -157,6 +168,10 @@ public:
 	/// <returns>BPP value (1, 2, or 4).</returns>
 	uint8_t GetBpp();
 
+	/// <summary>Decodes the rows that were replayed from the cache, to bring the decoder's state up to date.</summary>
+	/// <remarks>Must be called before the data ROM size configuration changes.</remarks>
+	void CatchUp();
+
 	/// <summary>Serializes decompressor state for save states.</summary>
 	void Serialize(Serializer& s) override;
 };
\ No newline at end of file
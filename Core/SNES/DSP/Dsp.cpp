@@ -256,6 +256,22 @@ void Dsp::EchoStep30() {
 	_state.EchoOut[1] = 0;
 }
 
+bool Dsp::CanEchoWrite(uint16_t addr) {
+	if (!_state.EchoEnabled && (ReadReg(DspGlobalRegs::Flags) & 0x20)) {
+		return false;
+	}
+
+	if ((uint16_t)(addr - _state.EchoPointer) < 4) {
+		return true;
+	}
+
+	// The buffer moves to the address in ESA on the next sample, and grows to the size in EDL the next time the offset wraps
+	uint32_t length = std::max<uint32_t>({_state.EchoLength, (uint32_t)(ReadReg(DspGlobalRegs::EchoDelay) & 0x0F) << 11, _state.EchoOffset}) + 4;
+	uint16_t latchedStart = _state.EchoRingBufferAddress << 8;
+	uint16_t regStart = ReadReg(DspGlobalRegs::EchoRingBufferAddress) << 8;
+	return (uint16_t)(addr - latchedStart) < length || (uint16_t)(addr - regStart) < length;
+}
+
 void Dsp::Exec() {
 	uint8_t step = _state.Step;
 	_state.Step = (_state.Step + 1) & 0x1F;
@@ -120,6 +120,13 @@ public:
 	/// <returns>Reference to internal state.</returns>
 	DspState& GetState() { return _state; }
 
+	/// <summary>
+	/// Checks if the echo buffer can write to an address before the echo registers are written to again.
+	/// </summary>
+	/// <param name="addr">SPC RAM address.</param>
+	/// <returns>True if the address is (or can become) part of the echo buffer while echo writes are enabled.</returns>
+	bool CanEchoWrite(uint16_t addr);
+
 	/// <summary>Checks if DSP output is muted.</summary>
 	/// <returns>True if muted (always false currently).</returns>
 	[[nodiscard]] bool IsMuted() { return false; }
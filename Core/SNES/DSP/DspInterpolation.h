@@ -520,15 +520,17 @@ private:
 	};
 
 public:
+	// The sample buffer is mirrored (see DspVoice::_sampleBuffer), all taps are read
+	// from consecutive entries without wrapping around the 12-sample ring.
 	static int16_t Gauss(int32_t interpolationPos, int16_t* samples, uint8_t bufferPos) {
 		uint8_t pos = (interpolationPos >> 12) + bufferPos;
 		uint8_t offset = (interpolationPos >> 4) & 0xFF;
 
 		//"The above 3 wrap at 15 bits signed. The last is added to that, and is clamped rather than wrapped.
-		int32_t out = (int16_t)(((gauss[255 - offset] * (int32_t)samples[pos % 12]) >> 11) +
-		                        ((gauss[511 - offset] * (int32_t)samples[(pos + 1) % 12]) >> 11) +
-		                        ((gauss[256 + offset] * (int32_t)samples[(pos + 2) % 12]) >> 11)) +
-		              ((gauss[offset] * (int32_t)samples[(pos + 3) % 12]) >> 11);
+		int32_t out = (int16_t)(((gauss[255 - offset] * (int32_t)samples[pos]) >> 11) +
+		                        ((gauss[511 - offset] * (int32_t)samples[pos + 1]) >> 11) +
+		                        ((gauss[256 + offset] * (int32_t)samples[pos + 2]) >> 11)) +
+		              ((gauss[offset] * (int32_t)samples[pos + 3]) >> 11);
 
 		return Dsp::Clamp16(out) & ~0x01;
 	}
@@ -536,10 +538,10 @@ public:
 	static int16_t Cubic(int32_t interpolationPos, int16_t* samples, uint8_t bufferPos) {
 		uint8_t pos = (interpolationPos >> 12) + bufferPos;
 
-		float v0 = samples[pos % 12] / 32768.0f;
-		float v1 = samples[(pos + 1) % 12] / 32768.0f;
-		float v2 = samples[(pos + 2) % 12] / 32768.0f;
-		float v3 = samples[(pos + 3) % 12] / 32768.0f;
+		float v0 = samples[pos] / 32768.0f;
+		float v1 = samples[pos + 1] / 32768.0f;
+		float v2 = samples[pos + 2] / 32768.0f;
+		float v3 = samples[pos + 3] / 32768.0f;
 
 		float a = (v3 - v2) - (v0 - v1);
 		float b = (v0 - v1) - a;
@@ -556,14 +558,14 @@ public:
 		uint16_t offset = ((interpolationPos >> 4) & 0xFF) * 8;
 
 		return Dsp::Clamp16((
-		                        (_sincTable[offset + 0] * samples[(pos + 0) % 12]) +
-		                        (_sincTable[offset + 1] * samples[(pos + 1) % 12]) +
-		                        (_sincTable[offset + 2] * samples[(pos + 2) % 12]) +
-		                        (_sincTable[offset + 3] * samples[(pos + 3) % 12]) +
-		                        (_sincTable[offset + 4] * samples[(pos + 4) % 12]) +
-		                        (_sincTable[offset + 5] * samples[(pos + 5) % 12]) +
-		                        (_sincTable[offset + 6] * samples[(pos + 6) % 12]) +
-		                        (_sincTable[offset + 7] * samples[(pos + 7) % 12])) >>
+		                        (_sincTable[offset + 0] * samples[pos + 0]) +
+		                        (_sincTable[offset + 1] * samples[pos + 1]) +
+		                        (_sincTable[offset + 2] * samples[pos + 2]) +
+		                        (_sincTable[offset + 3] * samples[pos + 3]) +
+		                        (_sincTable[offset + 4] * samples[pos + 4]) +
+		                        (_sincTable[offset + 5] * samples[pos + 5]) +
+		                        (_sincTable[offset + 6] * samples[pos + 6]) +
+		                        (_sincTable[offset + 7] * samples[pos + 7])) >>
 		                    14);
 	}
 
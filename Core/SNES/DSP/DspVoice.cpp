@@ -64,9 +64,11 @@ void DspVoice::DecodeBrrSample() {
 		//"The calculations above are preformed in some higher number of bits, clamped to
 		// 16 bits at the end and then clipped to 15 bits. This 15-bit value is the value
 		// output and the value used as S(x-1) or S(x-2) as needed for future filter iterations."
-		_sampleBuffer[_bufferPos + i] = Dsp::Clamp16(s) * 2;
+		int16_t sample = Dsp::Clamp16(s) * 2;
+		_sampleBuffer[_bufferPos + i] = sample;
+		_sampleBuffer[_bufferPos + i + 12] = sample;
 		prev2 = prev1;
-		prev1 = _sampleBuffer[_bufferPos + i] >> 1;
+		prev1 = sample >> 1;
 	}
 
 	if (_bufferPos <= 4) {
@@ -188,7 +190,11 @@ void DspVoice::UpdateOutput(bool right) {
 	//"Load and apply VxVOL[L/R] register."
 	int32_t voiceOut = ((int32_t)_shared->VoiceOutput * (int8_t)ReadReg((DspVoiceRegs)((int)DspVoiceRegs::VolLeft + (int)right))) >> 7;
 
-	voiceOut = voiceOut * (int32_t)_cfg->ChannelVolumes[_voiceIndex] / 100;
+	int32_t channelVolume = (int32_t)_cfg->ChannelVolumes[_voiceIndex];
+	if (channelVolume != 100) {
+		// Skip the division in the default (100%) case, this runs twice per voice per sample
+		voiceOut = voiceOut * channelVolume / 100;
+	}
 
 	_shared->OutSamples[(int)right] = Dsp::Clamp16(_shared->OutSamples[(int)right] + voiceOut);
 
@@ -276,7 +282,7 @@ void DspVoice::Step3c() {
 			output = DspInterpolation::Sinc(_interpolationPos, _sampleBuffer, _bufferPos);
 			break;
 		case DspInterpolationType::None:
-			output = _sampleBuffer[((_interpolationPos >> 12) + _bufferPos) % 12];
+			output = _sampleBuffer[(_interpolationPos >> 12) + _bufferPos];
 			break;
 	}
 
@@ -398,4 +404,7 @@ void DspVoice::Serialize(Serializer& s) {
 	SV(_bufferPos);
 
 	SVArray(_sampleBuffer, 12);
+	if (!s.IsSaving()) {
+		std::copy(_sampleBuffer, _sampleBuffer + 12, _sampleBuffer + 12);
+	}
 }
@@ -75,8 +75,10 @@ private:
 	/// <summary>
 	/// Decoded sample ring buffer (12 samples for Gaussian interpolation).
 	/// The last 4 samples from previous BRR block plus 8 from current block.
+	/// Entries 12-23 mirror entries 0-11, so the interpolation functions can read
+	/// up to 8 consecutive samples from any position without wrapping.
 	/// </summary>
-	int16_t _sampleBuffer[12] = {};
+	int16_t _sampleBuffer[24] = {};
 
 	/// <summary>Reads a voice register value.</summary>
 	/// <param name="reg">Register to read.</param>
@@ -23,4 +23,10 @@ public:
 	}
 
 	virtual AddressInfo GetAbsoluteAddress(uint32_t address) = 0;
+
+	/// <summary>4KB block that Read() returns (without side effects) for this page, or nullptr if reads must go through Read()</summary>
+	virtual uint8_t* GetDirectReadPage() { return nullptr; }
+
+	/// <summary>4KB block that Write() stores to (without side effects) for this page, or nullptr if writes must go through Write()</summary>
+	virtual uint8_t* GetDirectWritePage() { return nullptr; }
 };
\ No newline at end of file
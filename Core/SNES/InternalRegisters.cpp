@@ -161,6 +161,29 @@ uint8_t InternalRegisters::ReadControllerData(uint8_t port, bool getMsb) {
 	return value;
 }
 
+uint32_t InternalRegisters::GetSkippableIrqCounterTicks() {
+	if (_needIrq) {
+		return 0;
+	}
+	if (!_irqEnabled) {
+		return UINT32_MAX;
+	}
+
+	if (_state.EnableHorizontalIrq) {
+		// The IRQ level can only rise once the H counter matches
+		return _state.HorizontalTimer > _hCounter ? _state.HorizontalTimer - _hCounter - 1 : UINT32_MAX;
+	}
+
+	// Only the V counter is compared, it doesn't change during the scanline
+	bool irqLevel = !_state.EnableVerticalIrq || _state.VerticalTimer == _vCounter;
+	return !_irqLevel && irqLevel ? 0 : UINT32_MAX;
+}
+
+void InternalRegisters::SkipIrqCounterTicks(uint32_t count) {
+	_hCounter += count;
+	UpdateIrqLevel();
+}
+
 uint8_t InternalRegisters::GetIoPortOutput() {
 	return _state.IoPortOutput;
 }
@@ -89,6 +89,12 @@ public:
 
 	__forceinline void ProcessIrqCounters();
 
+	/// <summary>Number of IRQ counter ticks that can run without changing the IRQ state (on H clocks > 10, within the scanline).</summary>
+	[[nodiscard]] uint32_t GetSkippableIrqCounterTicks();
+
+	/// <summary>Same as count calls to ProcessIrqCounters on H clocks > 10, only valid when GetSkippableIrqCounterTicks returned at least count.</summary>
+	void SkipIrqCounterTicks(uint32_t count);
+
 	uint8_t GetIoPortOutput();
 	void SetNmiFlag(bool nmiFlag);
 
@@ -188,3 +194,4 @@ void InternalRegisters::ProcessIrqCounters() {
 
 	UpdateIrqLevel();
 }
+
@@ -8,11 +8,23 @@ class MemoryMappings {
 private:
 	IMemoryHandler* _handlers[0x100 * 0x10] = {};
 
+	// Plain RAM/ROM pages (see IMemoryHandler::GetDirectReadPage), nullptr when the handler must be called
+	uint8_t* _directReads[0x100 * 0x10] = {};
+	uint8_t* _directWrites[0x100 * 0x10] = {};
+
+	void SetHandler(uint32_t index, IMemoryHandler* handler);
+
 public:
 	void RegisterHandler(uint8_t startBank, uint8_t endBank, uint16_t startPage, uint16_t endPage, vector<unique_ptr<IMemoryHandler>>& handlers, uint16_t pageIncrement = 0, uint16_t startPageNumber = 0);
 	void RegisterHandler(uint8_t startBank, uint8_t endBank, uint16_t startAddr, uint16_t endAddr, IMemoryHandler* handler);
 
 	IMemoryHandler* GetHandler(uint32_t addr);
+
+	/// <summary>Memory of the 4KB page containing addr when it can be read without calling its handler, nullptr otherwise</summary>
+	__forceinline uint8_t* GetDirectReadPage(uint32_t addr) { return _directReads[addr >> 12]; }
+
+	/// <summary>Memory of the 4KB page containing addr when it can be written without calling its handler, nullptr otherwise</summary>
+	__forceinline uint8_t* GetDirectWritePage(uint32_t addr) { return _directWrites[addr >> 12]; }
 	AddressInfo GetAbsoluteAddress(uint32_t addr);
 	int GetRelativeAddress(AddressInfo& absAddress, uint8_t startBank = 0);
 
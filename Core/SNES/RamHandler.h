@@ -48,6 +48,10 @@ public:
 
 	uint32_t GetOffset() { return _offset; }
 
+	// Mirrored pages (smaller than 4KB) use the handler's mask
+	uint8_t* GetDirectReadPage() override { return _mask == 0xFFF ? _ram : nullptr; }
+	uint8_t* GetDirectWritePage() override { return _mask == 0xFFF ? _ram : nullptr; }
+
 	AddressInfo GetAbsoluteAddress(uint32_t address) override {
 		AddressInfo info;
 		info.Address = _offset + (address & _mask);
@@ -1325,22 +1325,24 @@ bool SnesCpu::CheckFlag(uint8_t flag) {
 }
 
 void SnesCpu::Serialize(Serializer& s) {
-	SV(_state.A);
-	SV(_state.CycleCount);
-	SV(_state.D);
-	SV(_state.DBR);
-	SV(_state.EmulationMode);
-	SV(_state.IrqSource);
-	SV(_state.K);
-	SV(_state.NmiFlagCounter);
-	SV(_state.PC);
-	SV(_state.PrevIrqSource);
-	SV(_state.PS);
-	SV(_state.SP);
-	SV(_state.StopState);
-	SV(_state.X);
-	SV(_state.Y);
-	SV(_state.IrqLock);
-	SV(_state.NeedNmi);
+	s.StreamPod(_state, "_state", [&]() {
+		SV(_state.A);
+		SV(_state.CycleCount);
+		SV(_state.D);
+		SV(_state.DBR);
+		SV(_state.EmulationMode);
+		SV(_state.IrqSource);
+		SV(_state.K);
+		SV(_state.NmiFlagCounter);
+		SV(_state.PC);
+		SV(_state.PrevIrqSource);
+		SV(_state.PS);
+		SV(_state.SP);
+		SV(_state.StopState);
+		SV(_state.X);
+		SV(_state.Y);
+		SV(_state.IrqLock);
+		SV(_state.NeedNmi);
+	});
 	SV(_waiOver);
 }
@@ -41,20 +41,11 @@ OverscanDimensions SnesDefaultVideoFilter::GetOverscan() {
 void SnesDefaultVideoFilter::InitLookupTable() {
 	VideoConfig config = _emu->GetSettings()->GetVideoConfig();
 
-	InitConversionMatrix(config.Hue, config.Saturation);
-
-	for (int rgb555 = 0; rgb555 < 0x8000; rgb555++) {
-		uint8_t r = ColorUtilities::Convert5BitTo8Bit(rgb555 & 0x1F);
-		uint8_t g = ColorUtilities::Convert5BitTo8Bit((rgb555 >> 5) & 0x1F);
-		uint8_t b = ColorUtilities::Convert5BitTo8Bit((rgb555 >> 10) & 0x1F);
-
-		if (config.Hue != 0 || config.Saturation != 0 || config.Brightness != 0 || config.Contrast != 0) {
-			ApplyColorOptions(r, g, b, config.Brightness, config.Contrast);
-			_calculatedPalette[rgb555] = 0xFF000000 | (r << 16) | (g << 8) | b;
-		} else {
-			_calculatedPalette[rgb555] = 0xFF000000 | (r << 16) | (g << 8) | b;
-		}
-	}
+	InitPaletteLut(_calculatedPalette, 0x8000, config, [](uint32_t rgb555, uint8_t& r, uint8_t& g, uint8_t& b) {
+		r = ColorUtilities::Convert5BitTo8Bit(rgb555 & 0x1F);
+		g = ColorUtilities::Convert5BitTo8Bit((rgb555 >> 5) & 0x1F);
+		b = ColorUtilities::Convert5BitTo8Bit((rgb555 >> 10) & 0x1F);
+	});
 
 	_videoConfig = config;
 }
@@ -63,7 +54,7 @@ void SnesDefaultVideoFilter::OnBeforeApplyFilter() {
 	VideoConfig& config = _emu->GetSettings()->GetVideoConfig();
 	SnesConfig& snesConfig = _emu->GetSettings()->GetSnesConfig();
 
-	if (_videoConfig.Hue != config.Hue || _videoConfig.Saturation != config.Saturation || _videoConfig.Contrast != config.Contrast || _videoConfig.Brightness != config.Brightness) {
+	if (PaletteOptionsChanged(_videoConfig, config)) {
 		InitLookupTable();
 	}
 	_forceFixedRes = snesConfig.ForceFixedResolution;
@@ -93,15 +84,7 @@ void SnesDefaultVideoFilter::ApplyFilter(uint16_t* ppuOutputBuffer) {
 			}
 		}
 	} else {
-		// Hoist row offset outside inner loop to eliminate per-pixel multiply
-		uint32_t outIdx = 0;
-		uint32_t srcOffset = yOffset + xOffset;
-		for (uint32_t i = 0; i < frameInfo.Height; i++) {
-			for (uint32_t j = 0; j < frameInfo.Width; j++) {
-				out[outIdx++] = GetPixel(ppuOutputBuffer, srcOffset + j);
-			}
-			srcOffset += width;
-		}
+		ConvertFrame(_calculatedPalette, 0x7FFF, ppuOutputBuffer, width, overscan.Left, overscan.Top, out, frameInfo.Width, frameInfo.Height);
 	}
 
 	if (_baseFrameInfo.Width == 512 && _blendHighRes) {
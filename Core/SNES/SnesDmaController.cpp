@@ -88,6 +88,11 @@ void SnesDmaController::RunDma(DmaChannelConfig& channel) {
 
 	uint32_t i = 0;
 	do {
+		if (uint32_t count = RunBlockTransfer(channel, i)) {
+			i += count;
+			continue;
+		}
+
 		// Manual DMA transfers run to the end of the transfer when started
 		CopyDmaByte(
 		    (channel.SrcBank << 16) | channel.SrcAddress,
@@ -108,6 +113,26 @@ void SnesDmaController::RunDma(DmaChannelConfig& channel) {
 	channel.DmaActive = false;
 }
 
+uint32_t SnesDmaController::RunBlockTransfer(DmaChannelConfig& channel, uint32_t i) {
+	// Not while an HDMA transfer/init or another DMA is waiting to run (ProcessPendingTransfers after each byte),
+	// no new one can be triggered during the block (events stop the block transfer)
+	if (channel.InvertDirection || _hdmaPending || _hdmaInitPending || _dmaStartDelay || _dmaPending) {
+		return 0;
+	}
+
+	// A transfer size of 0 is 65536 bytes
+	uint32_t remaining = channel.TransferSize ? channel.TransferSize : 0x10000;
+	if (remaining < SnesDmaController::MinBlockTransferBytes) {
+		return 0;
+	}
+
+	int8_t srcStep = channel.FixedTransfer ? 0 : (channel.Decrement ? -1 : 1);
+	uint32_t count = _memoryManager->RunDmaBlockTransfer((channel.SrcBank << 16) | channel.SrcAddress, srcStep, channel.DestAddress, _transferOffset[channel.TransferMode], i, remaining);
+	channel.SrcAddress = (uint16_t)(channel.SrcAddress + srcStep * (int32_t)count);
+	channel.TransferSize -= count;
+	return count;
+}
+
 bool SnesDmaController::InitHdmaChannels() {
 	_hdmaInitPending = false;
 
@@ -386,7 +411,9 @@ bool SnesDmaController::ProcessPendingTransfers() {
 		for (int i = 0; i < 8; i++) {
 			if (_state.Channel[i].DmaActive) {
 				_activeChannel = i;
+				_memoryManager->ProcessDmaBurst(i, true);
 				RunDma(_state.Channel[i]);
+				_memoryManager->ProcessDmaBurst(i, false);
 			}
 		}
 
@@ -28,6 +28,9 @@ private:
 	/// <summary>Flag bit indicating HDMA channel mode in channel enable register.</summary>
 	static constexpr uint8_t HdmaChannelFlag = 0x40;
 
+	/// <summary>Minimum remaining transfer size for RunBlockTransfer, shorter transfers go byte by byte.</summary>
+	static constexpr uint32_t MinBlockTransferBytes = 16;
+
 	/// <summary>DMA controller register state.</summary>
 	SnesDmaControllerState _state = {};
 
@@ -65,6 +68,15 @@ private:
 	/// <param name="channel">Channel configuration to process.</param>
 	void RunDma(DmaChannelConfig& channel);
 
+	/// <summary>
+	/// Runs the next bytes of a general-purpose DMA to the PPU's data ports (VRAM, CGRAM, OAM) in one step when
+	/// possible (see SnesMemoryManager::RunDmaBlockTransfer), and updates the channel's address and size.
+	/// </summary>
+	/// <param name="channel">Channel configuration to process.</param>
+	/// <param name="i">Number of bytes already transferred by RunDma.</param>
+	/// <returns>Number of bytes transferred (0 when the next byte must go through CopyDmaByte).</returns>
+	uint32_t RunBlockTransfer(DmaChannelConfig& channel, uint32_t i);
+
 	/// <summary>Executes HDMA transfer for one channel during H-blank.</summary>
 	/// <param name="channel">Channel configuration to process.</param>
 	void RunHdmaTransfer(DmaChannelConfig& channel);
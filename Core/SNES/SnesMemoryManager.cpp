@@ -289,7 +289,12 @@ uint8_t SnesMemoryManager::Read(uint32_t addr, MemoryOperationType type) {
 
 	uint8_t value;
 	IMemoryHandler* handler = _mappings.GetHandler(addr);
-	if (handler) [[likely]] {
+	if (uint8_t* page = _mappings.GetDirectReadPage(addr)) [[likely]] {
+		// Plain RAM/ROM, no need to call the handler
+		value = page[addr & 0xFFF];
+		_memTypeBusA = handler->GetMemoryType();
+		_openBus = value;
+	} else if (handler) {
 		value = handler->Read(addr);
 		_memTypeBusA = handler->GetMemoryType();
 		if (handler != _registerHandlerA.get()) {
@@ -345,6 +350,45 @@ uint8_t SnesMemoryManager::ReadDma(uint32_t addr, bool forBusA) {
 	return value;
 }
 
+uint32_t SnesMemoryManager::RunDmaBlockTransfer(uint32_t srcAddr, int8_t srcStep, uint8_t destAddr, const uint8_t offsets[4], uint32_t phase, uint32_t count) {
+	if (_emu->HasDebugHooks() || _cheatManager->HasCheats<CpuType::Snes>() || _cart->IsCoprocessorSyncEnabled() || !_ppu->CanWriteDmaBlock(destAddr, offsets)) {
+		return 0;
+	}
+
+	uint8_t* page = _mappings.GetDirectReadPage(srcAddr);
+	if (!page) {
+		return 0;
+	}
+
+	// Stay within the source page
+	uint16_t pageOffset = srcAddr & 0xFFF;
+	if (srcStep > 0) {
+		count = std::min<uint32_t>(count, 0x1000 - pageOffset);
+	} else if (srcStep < 0) {
+		count = std::min<uint32_t>(count, pageOffset + 1);
+	}
+
+	// Stop before the next event, each byte is 2 IRQ counter ticks (on H clocks 2, 6, etc.)
+	if (_hClock <= 10 || _nextEventClock <= _hClock) {
+		return 0;
+	}
+	count = std::min<uint32_t>(count, (_nextEventClock - _hClock - 1) / 8);
+	count = std::min<uint32_t>(count, _regs->GetSkippableIrqCounterTicks() / 2);
+	if (count == 0) {
+		return 0;
+	}
+
+	_ppu->WriteDmaBlock(destAddr, offsets, phase, page + pageOffset, srcStep, count);
+
+	_openBus = page[(pageOffset + (int32_t)(count - 1) * srcStep) & 0xFFF];
+	_memTypeBusA = _mappings.GetHandler(srcAddr)->GetMemoryType();
+
+	_regs->SkipIrqCounterTicks(count * 2);
+	_masterClock += count * 8;
+	_hClock += count * 8;
+	return count;
+}
+
 uint8_t SnesMemoryManager::Peek(uint32_t addr) {
 	return _mappings.Peek(addr);
 }
@@ -362,7 +406,10 @@ void SnesMemoryManager::Write(uint32_t addr, uint8_t value, MemoryOperationType
 
 	if (_emu->ProcessMemoryWrite<CpuType::Snes>(addr, value, type)) {
 		IMemoryHandler* handler = _mappings.GetHandler(addr);
-		if (handler) [[likely]] {
+		if (uint8_t* page = _mappings.GetDirectWritePage(addr)) [[likely]] {
+			page[addr & 0xFFF] = value;
+			_memTypeBusA = handler->GetMemoryType();
+		} else if (handler) {
 			handler->Write(addr, value);
 			_memTypeBusA = handler->GetMemoryType();
 		} else {
@@ -461,6 +508,10 @@ bool SnesMemoryManager::IsRegister(uint32_t cpuAddress) {
 	return handler == _registerHandlerA.get() || handler == _registerHandlerB.get();
 }
 
+void SnesMemoryManager::ProcessDmaBurst(uint8_t channel, bool started) {
+	_emu->ProcessDmaBurst<CpuType::Snes>(channel, started);
+}
+
 bool SnesMemoryManager::IsWorkRam(uint32_t cpuAddress) {
 	IMemoryHandler* handler = _mappings.GetHandler(cpuAddress);
 	return handler && handler->GetMemoryType() == MemoryType::SnesWorkRam;
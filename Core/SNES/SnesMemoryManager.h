@@ -192,6 +192,21 @@ public:
 	/// <summary>DMA read from memory.</summary>
 	uint8_t ReadDma(uint32_t addr, bool forBusA);
 
+	/// <summary>
+	/// Runs up to count bytes of an A-bus to B-bus DMA from plain RAM/ROM to the PPU's data ports in one step, with the
+	/// same result as ReadDma/WriteDma for each byte (8 master clocks per byte).
+	/// Only done when nothing can happen during these clocks: no event (HDMA, DRAM refresh, end of scanline),
+	/// IRQ state change, coprocessor sync, debugger hook or cheat, and the PPU isn't rendering.
+	/// </summary>
+	/// <param name="srcAddr">A-bus address of the first byte.</param>
+	/// <param name="srcStep">A-bus address increment (1, -1 or 0 for fixed transfers).</param>
+	/// <param name="destAddr">B-bus address (low byte) of the channel.</param>
+	/// <param name="offsets">B-bus address offsets of the transfer mode.</param>
+	/// <param name="phase">Number of bytes already transferred (position in the offsets).</param>
+	/// <param name="count">Maximum number of bytes.</param>
+	/// <returns>Number of bytes transferred, 0 when the next byte must go through ReadDma/WriteDma.</returns>
+	uint32_t RunDmaBlockTransfer(uint32_t srcAddr, int8_t srcStep, uint8_t destAddr, const uint8_t offsets[4], uint32_t phase, uint32_t count);
+
 	/// <summary>Peek byte (no side effects).</summary>
 	uint8_t Peek(uint32_t addr);
 
@@ -207,6 +222,9 @@ public:
 	/// <summary>DMA write to memory.</summary>
 	void WriteDma(uint32_t addr, uint8_t value, bool forBusA);
 
+	/// <summary>Notifies the debugger that a DMA channel's transfer started/ended.</summary>
+	void ProcessDmaBurst(uint8_t channel, bool started);
+
 	/// <summary>Gets current open bus value.</summary>
 	[[nodiscard]] uint8_t GetOpenBus();
 
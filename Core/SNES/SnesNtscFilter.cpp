@@ -8,6 +8,8 @@
 SnesNtscFilter::SnesNtscFilter(Emulator* emu) : BaseVideoFilter(emu) {
 	memset(&_ntscData, 0, sizeof(_ntscData));
 	_ntscSetup = {};
+	// Build the tables for the current settings right away (instead of the default settings, followed by a rebuild on the first frame)
+	GenericNtscFilter::InitNtscFilter(_ntscSetup, _emu->GetSettings()->GetVideoConfig());
 	snes_ntsc_init(&_ntscData, &_ntscSetup);
 	_ntscBuffer = std::make_unique<uint32_t[]>(SNES_NTSC_OUT_WIDTH(256) * 480);
 }
@@ -52,15 +54,25 @@ void SnesNtscFilter::ApplyFilter(uint16_t* ppuOutputBuffer) {
 	uint32_t xOffset = overscan.Left;
 	uint32_t yOffset = overscan.Top / 2 * baseWidth;
 
+	// Rows are independent, each slice starts at the burst phase its first row would have
+	int burstPhase = IsOddFrame() ? 0 : 1;
+	ProcessRowSlices(_baseFrameInfo.Height, [=, this](uint32_t firstRow, uint32_t lastRow) {
+		uint16_t* input = ppuOutputBuffer + firstRow * _baseFrameInfo.Width;
+		uint32_t* output = _ntscBuffer.get() + firstRow * baseWidth;
+		int rowBurstPhase = (burstPhase + firstRow) % snes_ntsc_burst_count;
+		if (useHighResOutput) {
+			snes_ntsc_blit_hires(&_ntscData, input, _baseFrameInfo.Width, rowBurstPhase, _baseFrameInfo.Width, lastRow - firstRow, output, baseWidth * 4);
+		} else {
+			snes_ntsc_blit(&_ntscData, input, _baseFrameInfo.Width, rowBurstPhase, _baseFrameInfo.Width, lastRow - firstRow, output, baseWidth * 4);
+		}
+	});
+
 	if (useHighResOutput) {
-		snes_ntsc_blit_hires(&_ntscData, ppuOutputBuffer, _baseFrameInfo.Width, IsOddFrame() ? 0 : 1, _baseFrameInfo.Width, _baseFrameInfo.Height, _ntscBuffer.get(), baseWidth * 4);
 
 		for (uint32_t i = 0; i < frameInfo.Height; i++) {
 			memcpy(GetOutputBuffer() + i * frameInfo.Width, _ntscBuffer.get() + yOffset * 2 + xOffset + i * baseWidth, frameInfo.Width * sizeof(uint32_t));
 		}
 	} else {
-		snes_ntsc_blit(&_ntscData, ppuOutputBuffer, _baseFrameInfo.Width, IsOddFrame() ? 0 : 1, _baseFrameInfo.Width, _baseFrameInfo.Height, _ntscBuffer.get(), baseWidth * 4);
-
 		for (uint32_t i = 0; i < frameInfo.Height; i += 2) {
 			memcpy(GetOutputBuffer() + i * frameInfo.Width, _ntscBuffer.get() + yOffset + xOffset + i / 2 * baseWidth, frameInfo.Width * sizeof(uint32_t));
 			memcpy(GetOutputBuffer() + (i + 1) * frameInfo.Width, _ntscBuffer.get() + yOffset + xOffset + i / 2 * baseWidth, frameInfo.Width * sizeof(uint32_t));
@@ -1,5 +1,7 @@
 #include "pch.h"
 #include "SNES/SnesPpu.h"
+#include "SNES/SnesTileDecoder.h"
+#include "SNES/SnesColorMath.h"
 #include "SNES/SnesConsole.h"
 #include "SNES/SnesMemoryManager.h"
 #include "SNES/SnesCpu.h"
@@ -10,9 +12,9 @@
 #include "SNES/Debugger/SnesPpuTools.h"
 #include "Debugger/Debugger.h"
 #include "Shared/Emulator.h"
+#include "Shared/FrameProfiler.h"
 #include "Shared/EmuSettings.h"
 #include "Shared/Video/VideoDecoder.h"
-#include "Shared/Video/VideoRenderer.h"
 #include "Shared/NotificationManager.h"
 #include "Shared/RenderedFrame.h"
 #include "Shared/MessageManager.h"
@@ -584,14 +586,11 @@ bool SnesPpu::ProcessEndOfScanline(uint16_t& hClock) {
 			_timeOver = false;
 			_emu->ProcessEvent(EventType::StartFrame);
 
-			_skipRender = (!_settings->GetSnesConfig().DisableFrameSkipping &&
-			               (!_interlacedFrame || (_frameCount & 0x02)) &&
-			               !_emu->GetRewindManager()->IsRewinding() &&
-			               !_emu->GetVideoRenderer()->IsRecording() &&
-			               (_settings->GetEmulationSpeed() == 0 || _settings->GetEmulationSpeed() > 150) &&
-			               _frameSkipTimer.GetElapsedMS() < 10);
+			bool allowFrameSkip = !_settings->GetSnesConfig().DisableFrameSkipping && (!_interlacedFrame || (_frameCount & 0x02));
+			_skipRender = _emu->IsRenderSkipped(allowFrameSkip, _frameSkipTimer, 10);
 
-			if (_emu->IsRunAheadFrame()) {
+			if (_emu->GetAudioPlayerHud()) {
+				// SPC player: the video filter ignores the PPU's output, only the player's HUD is shown
 				_skipRender = true;
 			}
 
@@ -600,6 +599,9 @@ bool SnesPpu::ProcessEndOfScanline(uint16_t& hClock) {
 		}
 
 		UpdateSpcState();
+
+		// Multithreaded SPC mode: let the SPC run in the background while the S-CPU runs the next scanline
+		_spc->RunAsync();
 		return true;
 	}
 	return false;
@@ -934,6 +936,7 @@ void SnesPpu::RenderMode7() {
 }
 
 void SnesPpu::RenderScanline() {
+	PROFILE_SCOPE(_emu->GetFrameProfiler(), ProfilerStage::Ppu);
 	int32_t hPos = GetCycle();
 
 	if (hPos <= 255 || _spriteEvalEnd < 255) {
@@ -994,7 +997,6 @@ void SnesPpu::RenderScanline() {
 		}
 
 		ApplyColorMath();
-		ApplyBrightness<true>();
 		ApplyHiResMode();
 
 		_drawStartX = _drawEndX + 1;
@@ -1070,6 +1072,38 @@ void SnesPpu::RenderTilemap() {
 	uint8_t hiresSubColor;
 	uint8_t pixelFlags = (((_state.ColorMathEnabled >> layerIndex) & 0x01) ? PixelFlags::AllowColorMath : 0);
 
+	if constexpr (!hiResMode && !applyMosaic) {
+		// Decode each tile row 8 pixels at a time, tiles that are fully transparent on this row are skipped
+		uint8_t fineScroll = hScroll & 0x07;
+		int x = _drawStartX;
+		while (x <= _drawEndX) {
+			uint32_t tileIndex = (x + fineScroll) >> 3;
+			int tileEndX = std::min<int>(_drawEndX, (int)(tileIndex << 3) + 7 - fineScroll);
+
+			uint16_t tilemapData = tileData[tileIndex].TilemapData;
+			uint64_t row = SnesTileDecoder::DecodeRow<bpp>(tileData[tileIndex].ChrData, (tilemapData & 0x4000) != 0);
+			if (row != 0) {
+				uint8_t paletteIndex = (tilemapData >> 10) & 0x07;
+				uint8_t priority = (tilemapData & 0x2000) ? highPriority : normalPriority;
+
+				for (int px = x; px <= tileEndX; px++) {
+					uint8_t color = SnesTileDecoder::GetPixel(row, (px + fineScroll) & 0x07);
+					if (color > 0) {
+						uint16_t rgbColor = GetRgbColor<bpp, directColorMode, basePaletteOffset>(paletteIndex, color);
+						if (drawMain && (_mainScreenFlags[px] & 0x0F) < priority && !(_mainWindowCount[layerIndex] && _windowMask[layerIndex][px])) {
+							DrawMainPixel(px, rgbColor, priority | pixelFlags);
+						}
+						if (drawSub && _subScreenPriority[px] < priority && !(_subWindowCount[layerIndex] && _windowMask[layerIndex][px])) {
+							DrawSubPixel(px, rgbColor, priority);
+						}
+					}
+				}
+			}
+			x = tileEndX + 1;
+		}
+		return;
+	}
+
 	for (int x = _drawStartX; x <= _drawEndX; x++) {
 		if constexpr (hiResMode) {
 			lookupIndex = (x + (hScrollOriginal & 0x07)) >> 2;
@@ -1364,11 +1398,15 @@ void SnesPpu::ApplyColorMath() {
 			ApplyColorMathToPixel(_mainScreenBuffer[x], subPixel, x, isInsideWindow,
 				clipMode, preventMode, subtractMode, addSubscreen, fixedColor, baseHalfShift);
 		}
+
+		ApplyBrightness<true>();
 	} else {
-		for (int x = _drawStartX; x <= _drawEndX; x++) {
-			bool isInsideWindow = _windowMask[SnesPpu::ColorWindowIndex][x];
-			ApplyColorMathToPixel(_mainScreenBuffer[x], _subScreenBuffer[x], x, isInsideWindow,
-				clipMode, preventMode, subtractMode, addSubscreen, fixedColor, baseHalfShift);
+		// Branch-free version of ApplyColorMathToPixel, with the master brightness applied in the same pass
+		SnesColorMathParams params(clipMode, preventMode, addSubscreen, baseHalfShift, fixedColor, _state.ScreenBrightness);
+		if (subtractMode) {
+			SnesColorMath::ApplyLine<true>(_mainScreenBuffer, _subScreenBuffer, _mainScreenFlags, _subScreenPriority, _windowMask[SnesPpu::ColorWindowIndex], _drawStartX, _drawEndX, params);
+		} else {
+			SnesColorMath::ApplyLine<false>(_mainScreenBuffer, _subScreenBuffer, _mainScreenFlags, _subScreenPriority, _windowMask[SnesPpu::ColorWindowIndex], _drawStartX, _drawEndX, params);
 		}
 	}
 }
@@ -1461,31 +1499,10 @@ void SnesPpu::ApplyColorMathToPixel(
 	}
 }
 
-/// Precomputed brightness LUT: _brightnessLut[brightness][component] = component * brightness / 15
-/// 512 bytes total (16 brightness levels x 32 component values), fits in a single cache line per row
-static constexpr auto MakeBrightnessLut() {
-	std::array<std::array<uint8_t, 32>, 16> lut{};
-	for (int b = 0; b < 16; b++) {
-		for (int c = 0; c < 32; c++) {
-			lut[b][c] = static_cast<uint8_t>(c * b / 15);
-		}
-	}
-	return lut;
-}
-
-static constexpr auto _brightnessLut = MakeBrightnessLut();
-
 template <bool forMainScreen>
 void SnesPpu::ApplyBrightness() {
 	if (_state.ScreenBrightness != 15) {
-		const auto& lut = _brightnessLut[_state.ScreenBrightness];
-		for (int x = _drawStartX; x <= _drawEndX; x++) {
-			uint16_t& pixel = (forMainScreen ? _mainScreenBuffer : _subScreenBuffer)[x];
-			uint16_t r = lut[pixel & 0x1F];
-			uint16_t g = lut[(pixel >> 5) & 0x1F];
-			uint16_t b = lut[(pixel >> 10) & 0x1F];
-			pixel = r | (g << 5) | (b << 10);
-		}
+		SnesColorMath::ApplyBrightness(forMainScreen ? _mainScreenBuffer : _subScreenBuffer, _drawStartX, _drawEndX, _state.ScreenBrightness);
 	}
 }
 
@@ -1538,16 +1555,17 @@ void SnesPpu::ApplyHiResMode() {
 		uint32_t screenY = _state.ScreenInterlace ? (_oddFrame ? ((scanline << 1) + 1) : (scanline << 1)) : (scanline << 1);
 		uint32_t baseAddr = (screenY << 9);
 
+		uint16_t* out = _currentBuffer + baseAddr;
 		if (IsDoubleWidth()) {
 			ApplyBrightness<false>();
 			for (int x = _drawStartX; x <= _drawEndX; x++) {
-				_currentBuffer[baseAddr + (x << 1)] = _subScreenBuffer[x];
-				_currentBuffer[baseAddr + (x << 1) + 1] = _mainScreenBuffer[x];
+				out[x << 1] = _subScreenBuffer[x];
+				out[(x << 1) + 1] = _mainScreenBuffer[x];
 			}
 		} else {
 			for (int x = _drawStartX; x <= _drawEndX; x++) {
-				_currentBuffer[baseAddr + (x << 1)] = _mainScreenBuffer[x];
-				_currentBuffer[baseAddr + (x << 1) + 1] = _mainScreenBuffer[x];
+				out[x << 1] = _mainScreenBuffer[x];
+				out[(x << 1) + 1] = _mainScreenBuffer[x];
 			}
 		}
 
@@ -2007,6 +2025,124 @@ uint8_t SnesPpu::Read(uint16_t addr) {
 	return _console->GetMemoryManager()->GetOpenBus();
 }
 
+void SnesPpu::WriteOamData(uint8_t value) {
+	// When trying to read/write during rendering, the internal address used by the PPU's sprite rendering is used
+	// This is approximated by _oamRenderAddress (but is not cycle accurate) - needed for Uniracers
+	uint16_t oamAddr = GetOamAddress();
+
+	if (oamAddr < 512) {
+		if (oamAddr & 0x01) {
+			_emu->ProcessPpuWrite<CpuType::Snes>(oamAddr - 1, _oamWriteBuffer, MemoryType::SnesSpriteRam);
+			_oamRam[oamAddr - 1] = _oamWriteBuffer;
+
+			_emu->ProcessPpuWrite<CpuType::Snes>(oamAddr, value, MemoryType::SnesSpriteRam);
+			_oamRam[oamAddr] = value;
+		} else {
+			_oamWriteBuffer = value;
+		}
+	}
+
+	if (!_state.ForcedBlank && _scanline < _nmiScanline) {
+		// During rendering the high table is also written to when writing to OAM
+		oamAddr = 0x200 | ((oamAddr & 0x1F0) >> 4);
+	}
+
+	if (oamAddr >= 512) {
+		uint16_t address = 0x200 | (oamAddr & 0x1F);
+		if ((oamAddr & 0x01) == 0) {
+			_oamWriteBuffer = value;
+		}
+		_emu->ProcessPpuWrite<CpuType::Snes>(address, value, MemoryType::SnesSpriteRam);
+		_oamRam[address] = value;
+	}
+	_state.InternalOamAddress = (_state.InternalOamAddress + 1) & 0x3FF;
+}
+
+template <bool highByte>
+void SnesPpu::WriteVramData(uint8_t value) {
+	if (CanAccessVram()) {
+		// Only write the value if in vblank or forced blank (writes to VRAM outside vblank/forced blank are not allowed)
+		uint16_t vramAddr = GetVramAddress();
+		if constexpr (highByte) {
+			_emu->ProcessPpuWrite<CpuType::Snes>((vramAddr << 1) + 1, value, MemoryType::SnesVideoRam);
+			_vram[vramAddr] = (value << 8) | (_vram[vramAddr] & 0xFF);
+		} else {
+			_emu->ProcessPpuWrite<CpuType::Snes>(vramAddr << 1, value, MemoryType::SnesVideoRam);
+			_vram[vramAddr] = value | (_vram[vramAddr] & 0xFF00);
+		}
+	}
+
+	// The VRAM address is incremented even outside of vblank/forced blank
+	if (_state.VramAddrIncrementOnSecondReg == highByte) {
+		_state.VramAddress = (_state.VramAddress + _state.VramIncrementValue) & 0x7FFF;
+	}
+}
+
+void SnesPpu::WriteCgramData(uint8_t value) {
+	if (_state.CgramAddressLatch) {
+		// MSB ignores the 7th bit (colors are 15-bit only)
+		value &= 0x7F;
+
+		// During rendering, writes to CGRAM end up writing to the address the PPU is currently reading
+		uint16_t cgAddr = CanAccessCgram() ? _state.CgramAddress : _state.InternalCgramAddress;
+
+		_emu->ProcessPpuWrite<CpuType::Snes>(cgAddr << 1, _state.CgramWriteBuffer, MemoryType::SnesCgRam);
+		_emu->ProcessPpuWrite<CpuType::Snes>((cgAddr << 1) + 1, value, MemoryType::SnesCgRam);
+
+		_cgram[cgAddr] = _state.CgramWriteBuffer | (value << 8);
+		_state.CgramAddress++;
+	} else {
+		_state.CgramWriteBuffer = value;
+	}
+	_state.CgramAddressLatch = !_state.CgramAddressLatch;
+}
+
+bool SnesPpu::CanWriteDmaBlock(uint8_t destAddr, const uint8_t offsets[4]) {
+	// No rendering to catch up on (see Write), and OAM/CGRAM addresses that don't depend on the H position
+	if (_scanline < _vblankStartScanline) {
+		return false;
+	}
+	for (int i = 0; i < 4; i++) {
+		switch ((uint8_t)(destAddr + offsets[i])) {
+			case 0x04:
+			case 0x18:
+			case 0x19:
+				break;
+
+			case 0x22:
+				if (_scanline < _nmiScanline && !_state.ForcedBlank) {
+					return false;
+				}
+				break;
+
+			default:
+				return false;
+		}
+	}
+	return true;
+}
+
+void SnesPpu::WriteDmaBlock(uint8_t destAddr, const uint8_t offsets[4], uint32_t phase, const uint8_t* src, int8_t srcStep, uint32_t count) {
+	for (uint32_t i = 0; i < count; i++) {
+		uint8_t value = *src;
+		src += srcStep;
+		switch ((uint8_t)(destAddr + offsets[(phase + i) & 0x03])) {
+			case 0x04:
+				WriteOamData(value);
+				break;
+			case 0x18:
+				WriteVramData<false>(value);
+				break;
+			case 0x19:
+				WriteVramData<true>(value);
+				break;
+			case 0x22:
+				WriteCgramData(value);
+				break;
+		}
+	}
+}
+
 void SnesPpu::Write(uint32_t addr, uint8_t value) {
 	if (_scanline < _vblankStartScanline) {
 		RenderScanline();
@@ -2040,39 +2176,9 @@ void SnesPpu::Write(uint32_t addr, uint8_t value) {
 			_state.EnableOamPriority = (value & 0x80) != 0;
 			break;
 
-		case 0x2104: {
-			// When trying to read/write during rendering, the internal address used by the PPU's sprite rendering is used
-			// This is approximated by _oamRenderAddress (but is not cycle accurate) - needed for Uniracers
-			uint16_t oamAddr = GetOamAddress();
-
-			if (oamAddr < 512) {
-				if (oamAddr & 0x01) {
-					_emu->ProcessPpuWrite<CpuType::Snes>(oamAddr - 1, _oamWriteBuffer, MemoryType::SnesSpriteRam);
-					_oamRam[oamAddr - 1] = _oamWriteBuffer;
-
-					_emu->ProcessPpuWrite<CpuType::Snes>(oamAddr, value, MemoryType::SnesSpriteRam);
-					_oamRam[oamAddr] = value;
-				} else {
-					_oamWriteBuffer = value;
-				}
-			}
-
-			if (!_state.ForcedBlank && _scanline < _nmiScanline) {
-				// During rendering the high table is also written to when writing to OAM
-				oamAddr = 0x200 | ((oamAddr & 0x1F0) >> 4);
-			}
-
-			if (oamAddr >= 512) {
-				uint16_t address = 0x200 | (oamAddr & 0x1F);
-				if ((oamAddr & 0x01) == 0) {
-					_oamWriteBuffer = value;
-				}
-				_emu->ProcessPpuWrite<CpuType::Snes>(address, value, MemoryType::SnesSpriteRam);
-				_oamRam[address] = value;
-			}
-			_state.InternalOamAddress = (_state.InternalOamAddress + 1) & 0x3FF;
+		case 0x2104:
+			WriteOamData(value);
 			break;
-		}
 
 		case 0x2105:
 			_state.BgMode = value & 0x07;
@@ -2186,30 +2292,12 @@ void SnesPpu::Write(uint32_t addr, uint8_t value) {
 
 		case 0x2118:
 			// VMDATAL - VRAM Data Write low byte
-			if (CanAccessVram()) {
-				// Only write the value if in vblank or forced blank (writes to VRAM outside vblank/forced blank are not allowed)
-				_emu->ProcessPpuWrite<CpuType::Snes>(GetVramAddress() << 1, value, MemoryType::SnesVideoRam);
-				_vram[GetVramAddress()] = value | (_vram[GetVramAddress()] & 0xFF00);
-			}
-
-			// The VRAM address is incremented even outside of vblank/forced blank
-			if (!_state.VramAddrIncrementOnSecondReg) {
-				_state.VramAddress = (_state.VramAddress + _state.VramIncrementValue) & 0x7FFF;
-			}
+			WriteVramData<false>(value);
 			break;
 
 		case 0x2119:
 			// VMDATAH - VRAM Data Write high byte
-			if (CanAccessVram()) {
-				// Only write the value if in vblank or forced blank (writes to VRAM outside vblank/forced blank are not allowed)
-				_emu->ProcessPpuWrite<CpuType::Snes>((GetVramAddress() << 1) + 1, value, MemoryType::SnesVideoRam);
-				_vram[GetVramAddress()] = (value << 8) | (_vram[GetVramAddress()] & 0xFF);
-			}
-
-			// The VRAM address is incremented even outside of vblank/forced blank
-			if (_state.VramAddrIncrementOnSecondReg) {
-				_state.VramAddress = (_state.VramAddress + _state.VramIncrementValue) & 0x7FFF;
-			}
+			WriteVramData<true>(value);
 			break;
 
 		case 0x211A:
@@ -2249,22 +2337,7 @@ void SnesPpu::Write(uint32_t addr, uint8_t value) {
 
 		case 0x2122:
 			// CGRAM Data write (CGDATA)
-			if (_state.CgramAddressLatch) {
-				// MSB ignores the 7th bit (colors are 15-bit only)
-				value &= 0x7F;
-
-				// During rendering, writes to CGRAM end up writing to the address the PPU is currently reading
-				uint16_t cgAddr = CanAccessCgram() ? _state.CgramAddress : _state.InternalCgramAddress;
-
-				_emu->ProcessPpuWrite<CpuType::Snes>(cgAddr << 1, _state.CgramWriteBuffer, MemoryType::SnesCgRam);
-				_emu->ProcessPpuWrite<CpuType::Snes>((cgAddr << 1) + 1, value, MemoryType::SnesCgRam);
-
-				_cgram[cgAddr] = _state.CgramWriteBuffer | (value << 8);
-				_state.CgramAddress++;
-			} else {
-				_state.CgramWriteBuffer = value;
-			}
-			_state.CgramAddressLatch = !_state.CgramAddressLatch;
+			WriteCgramData(value);
 			break;
 
 		case 0x2123:
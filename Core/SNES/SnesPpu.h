@@ -260,7 +260,7 @@ private:
 	__forceinline void DrawSubPixel(uint8_t x, uint16_t color, uint8_t priority);
 
 	/// <summary>
-	/// Applies color math effects (add/subtract) between main and sub screens.
+	/// Applies color math effects (add/subtract) between main and sub screens, then the master brightness.
 	/// Used for transparency, shadows, and special effects.
 	/// </summary>
 	void ApplyColorMath();
@@ -316,6 +316,12 @@ private:
 	void UpdateOamAddress();
 	uint16_t GetOamAddress();
 
+	/// <summary>Data port writes ($2104, $2118/$2119, $2122), shared by Write and WriteDmaBlock.</summary>
+	void WriteOamData(uint8_t value);
+	template <bool highByte>
+	__forceinline void WriteVramData(uint8_t value);
+	void WriteCgramData(uint8_t value);
+
 	void RandomizeState();  ///< Randomizes PPU state for testing
 
 	__noinline void DebugProcessMode7Overlay();
@@ -370,5 +376,17 @@ public:
 	/// <summary>Handles PPU register writes ($2100-$2133).</summary>
 	void Write(uint32_t addr, uint8_t value);
 
+	/// <summary>
+	/// True when a DMA with this B-bus address/transfer pattern can use WriteDmaBlock: every register is a data port
+	/// ($2104, $2118, $2119, $2122) and the PPU isn't rendering (vblank), so the writes don't depend on the H position.
+	/// </summary>
+	[[nodiscard]] bool CanWriteDmaBlock(uint8_t destAddr, const uint8_t offsets[4]);
+
+	/// <summary>
+	/// Same result as calling Write for count DMA bytes (only valid when CanWriteDmaBlock returned true).
+	/// Byte i goes to $2100 + destAddr + offsets[(phase + i) % 4] and is read from src + i * srcStep.
+	/// </summary>
+	void WriteDmaBlock(uint8_t destAddr, const uint8_t offsets[4], uint32_t phase, const uint8_t* src, int8_t srcStep, uint32_t count);
+
 	void Serialize(Serializer& s) override;
 };
@@ -0,0 +1,57 @@
+#pragma once
+#include "pch.h"
+#include <array>
+
+/// <summary>Lookup table that spreads the 8 bits of a bitplane byte to bit 0 of 8 pixel bytes</summary>
+constexpr std::array<uint64_t, 256> BuildSnesTileSpreadTable(bool mirrored) {
+	std::array<uint64_t, 256> table = {};
+	for (uint32_t value = 0; value < 256; value++) {
+		for (uint32_t pixel = 0; pixel < 8; pixel++) {
+			uint32_t bit = mirrored ? pixel : (7 - pixel);
+			table[value] |= (uint64_t)((value >> bit) & 0x01) << (pixel * 8);
+		}
+	}
+	return table;
+}
+
+/// <summary>
+/// Planar to chunky conversion of SNES background tile rows, 8 pixels at a time.
+/// </summary>
+/// <remarks>
+/// Each bitplane byte is spread to 1 bit per pixel with a lookup table, so a row costs one lookup, shift and OR
+/// per bitplane instead of 8 bit extractions per pixel. The colors are returned as the bytes of a uint64_t,
+/// leftmost pixel in the lowest byte (a row of transparent pixels is 0).
+///
+/// The bitplanes are in the format used by TileData::ChrData: low byte = even plane, high byte = odd plane.
+/// </remarks>
+class SnesTileDecoder {
+private:
+	static constexpr std::array<uint64_t, 256> _spreadBits = BuildSnesTileSpreadTable(false);
+	static constexpr std::array<uint64_t, 256> _spreadBitsMirrored = BuildSnesTileSpreadTable(true);
+
+public:
+	/// <summary>Decodes the 8 pixels of a tile row (color indexes, 0 = transparent).</summary>
+	/// <typeparam name="bpp">Color depth: 2, 4, or 8 bits per pixel.</typeparam>
+	/// <param name="chrData">Bitplanes (bpp / 2 words)</param>
+	/// <param name="hMirror">Tile is flipped horizontally</param>
+	template <uint8_t bpp>
+	[[nodiscard]] static __forceinline uint64_t DecodeRow(const uint16_t chrData[4], bool hMirror) {
+		static_assert(bpp == 2 || bpp == 4 || bpp == 8, "unsupported bpp");
+		const uint64_t* spread = hMirror ? _spreadBitsMirrored.data() : _spreadBits.data();
+
+		uint64_t row = spread[chrData[0] & 0xFF] | (spread[chrData[0] >> 8] << 1);
+		if constexpr (bpp >= 4) {
+			row |= (spread[chrData[1] & 0xFF] << 2) | (spread[chrData[1] >> 8] << 3);
+		}
+		if constexpr (bpp == 8) {
+			row |= (spread[chrData[2] & 0xFF] << 4) | (spread[chrData[2] >> 8] << 5);
+			row |= (spread[chrData[3] & 0xFF] << 6) | (spread[chrData[3] >> 8] << 7);
+		}
+		return row;
+	}
+
+	/// <summary>Color index of one pixel of a row returned by DecodeRow (0 = leftmost)</summary>
+	[[nodiscard]] static __forceinline uint8_t GetPixel(uint64_t row, uint32_t pixel) {
+		return (uint8_t)(row >> (pixel * 8));
+	}
+};
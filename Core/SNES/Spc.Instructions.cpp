@@ -2,9 +2,28 @@
 #include "SNES/Spc.h"
 #include "SNES/SnesMemoryManager.h"
 #include "Shared/Emulator.h"
+#include "Shared/FrameProfiler.h"
+#ifndef DUMMYSPC
+#include "SNES/SpcThread.h"
+#endif
 #include "Utilities/HexUtilities.h"
 
 void Spc::Run() {
+#ifndef DUMMYSPC
+	PROFILE_SCOPE(_emu->GetFrameProfiler(), ProfilerStage::Apu);
+	if (_thread) [[unlikely]] {
+		if (!_emu->HasDebugHooks()) {
+			_thread->Run(_memoryManager->GetMasterClock());
+			return;
+		}
+		// The debugger's hooks must run on the emulation thread
+		_thread.reset();
+	}
+#endif
+	RunUntil(_memoryManager->GetMasterClock());
+}
+
+void Spc::RunUntil(uint64_t masterClock) {
 	if (!_enabled) {
 		// Used to temporarily disable the SPC when overclocking is enabled
 		return;
@@ -14,9 +33,16 @@ void Spc::Run() {
 		return;
 	}
 
+	_runMasterClock = masterClock;
+
 	// Minus 1 because each call to ProcessCycle increments _state.Cycle by 2
-	int64_t targetCycle = (int64_t)(_memoryManager->GetMasterClock() * _clockRatio) - 1;
+	int64_t targetCycle = (int64_t)(masterClock * _clockRatio) - 1;
 	while ((int64_t)_state.Cycle < targetCycle) {
+#ifndef DUMMYSPC
+		if (_idleLoop.CanSkipAt(_state.PC) && _opStep == SpcOpStep::ReadOpCode) [[unlikely]] {
+			SkipIdleLoop(targetCycle);
+		}
+#endif
 		ProcessCycle();
 	}
 }
@@ -25,6 +51,7 @@ void Spc::ProcessCycle() {
 	if (_opStep == SpcOpStep::ReadOpCode) {
 #ifndef DUMMYSPC
 		_emu->ProcessInstruction<CpuType::Spc>();
+		UpdateIdleLoop();
 #endif
 		_opCode = GetOpCode();
 		_opStep = SpcOpStep::Addressing;
@@ -5,6 +5,7 @@
 #include "SNES/SpcFileData.h"
 #ifndef DUMMYSPC
 #include "SNES/DSP/Dsp.h"
+#include "SNES/SpcThread.h"
 #else
 #undef Spc
 #undef DUMMYSPC
@@ -67,6 +68,9 @@ Spc::~Spc() = default;
 
 // Reset SPC700 state (preserves some register values for compatibility)
 void Spc::Reset() {
+#ifndef DUMMYSPC
+	WaitForThread();
+#endif
 	_state.StopState = SnesCpuStopState::Running;
 
 	// Reset all three hardware timers
@@ -116,6 +120,9 @@ void Spc::Reset() {
 void Spc::SetSpcState(bool enabled) {
 	// Used by overclocking logic to disable SPC during the extra scanlines added to the PPU
 	if (_enabled != enabled) {
+#ifndef DUMMYSPC
+		WaitForThread();
+#endif
 		if (enabled) {
 			// When re-enabling, adjust the cycle counter to prevent running extra cycles
 			UpdateClockRatio();
@@ -141,7 +148,7 @@ void Spc::UpdateClockRatio() {
 
 void Spc::ExitExecLoop() {
 #ifndef DUMMYSPC
-	_state.Cycle = _memoryManager->GetMasterClock() * _clockRatio;
+	_state.Cycle = _runMasterClock * _clockRatio;
 #endif
 }
 
@@ -158,9 +165,6 @@ void Spc::DummyRead(uint16_t addr) {
 }
 
 void Spc::IncCycleCount(int32_t addr) {
-	static constexpr uint8_t cpuWait[4] = {2, 4, 10, 20};
-	static constexpr uint8_t timerMultiplier[4] = {2, 4, 8, 16};
-
 	uint8_t speedSelect;
 	if (addr < 0 || ((addr & 0xFFF0) == 0x00F0) || (addr >= 0xFFC0 && _state.RomEnabled)) [[unlikely]] {
 		// Use internal speed (bits 4-5) for idle cycles, register access or IPL rom access
@@ -169,12 +173,22 @@ void Spc::IncCycleCount(int32_t addr) {
 		speedSelect = _state.ExternalSpeed;
 	}
 
-	_state.Cycle += cpuWait[speedSelect];
+#ifndef DUMMYSPC
+	if (_idleLoop.IsRecording()) [[unlikely]] {
+		_idleLoop.RecordCycle(speedSelect, CpuWait[speedSelect]);
+	}
+#endif
+
+	RunBusCycle(speedSelect);
+}
+
+void Spc::RunBusCycle(uint8_t speedSelect) {
+	_state.Cycle += CpuWait[speedSelect];
 #ifndef DUMMYSPC
 	_dsp->Exec();
 #endif
 
-	uint8_t timerInc = timerMultiplier[speedSelect];
+	uint8_t timerInc = TimerMultiplier[speedSelect];
 	_state.Timer0.Run(timerInc);
 	_state.Timer1.Run(timerInc);
 	_state.Timer2.Run(timerInc);
@@ -310,6 +324,15 @@ uint8_t Spc::Read(uint16_t addr, MemoryOperationType type) {
 	}
 
 #ifndef DUMMYSPC
+	if (_idleLoop.IsRecording()) [[unlikely]] {
+		// Reading the other registers has side effects (timer outputs) or depends on the DSP's state
+		if ((addr & 0xFFF0) != 0x00F0 || (addr >= 0xF4 && addr <= 0xF7)) {
+			_idleLoop.RecordRead(addr, value);
+		} else {
+			_idleLoop.Abort();
+		}
+	}
+
 	_emu->ProcessMemoryRead<CpuType::Spc>(addr, value, type);
 #else
 	LogMemoryOperation(addr, value, type);
@@ -324,6 +347,8 @@ void Spc::Write(uint16_t addr, uint8_t value, MemoryOperationType type) {
 #ifdef DUMMYSPC
 	LogMemoryOperation(addr, value, type);
 #else
+	// Loops that write anything are never skipped
+	_idleLoop.Abort();
 
 	// Writes always affect the underlying RAM
 	if (_state.WriteEnabled) {
@@ -419,7 +444,22 @@ uint8_t Spc::CpuReadRegister(uint16_t addr) {
 }
 
 void Spc::CpuWriteRegister(uint32_t addr, uint8_t value) {
-	Run();
+	uint64_t masterClock = _memoryManager->GetMasterClock();
+#ifndef DUMMYSPC
+	if (_thread) [[unlikely]] {
+		if (!_emu->HasDebugHooks()) {
+			// Only port reads need to wait for the SPC thread
+			_thread->WriteCpuRegister(masterClock, (uint8_t)addr, value);
+			return;
+		}
+		_thread.reset();
+	}
+#endif
+	RunUntil(masterClock);
+	WriteCpuRegister(masterClock, (uint8_t)addr, value);
+}
+
+void Spc::WriteCpuRegister(uint64_t masterClock, uint8_t addr, uint8_t value) {
 	if (_state.NewCpuRegs[addr & 0x03] != value) {
 		_state.NewCpuRegs[addr & 0x03] = value;
 
@@ -429,7 +469,7 @@ void Spc::CpuWriteRegister(uint32_t addr, uint8_t value) {
 		// However, always delaying to the next SPC cycle causes Kawasaki Superbike Challenge to freeze on boot.
 		// Delaying only when the write occurs in the SPC cycle's second half allows both games to work (at the default 32040hz.)
 		// This solution behaves as if the CPU values were latched/updated every 2mhz tick (which matches the SPC's input clock)
-		if (_memoryManager->GetMasterClock() * _clockRatio - _state.Cycle <= 1) {
+		if (masterClock * _clockRatio - _state.Cycle <= 1) {
 			_state.CpuRegs[addr & 0x03] = value;
 		} else {
 			_pendingCpuRegUpdate = true;
@@ -452,6 +492,42 @@ void Spc::DspWriteRam(uint16_t addr, uint8_t value) {
 	_ram[addr] = value;
 }
 
+#ifndef DUMMYSPC
+Spc::IdleLoopRegs Spc::GetIdleLoopRegs() {
+	return {_state.A, _state.X, _state.Y, _state.SP, _state.PS, _state.RomEnabled, _state.InternalSpeed, _state.ExternalSpeed};
+}
+
+// Called at every opcode fetch, records the next iteration after a short backward jump
+void Spc::UpdateIdleLoop() {
+	if (_idleLoop.ProcessOpCode(_state.PC, GetIdleLoopRegs())) {
+		_idleLoopTemps = {_opCode, _operandA, _operandB, _tmp1, _tmp2, _tmp3};
+	}
+}
+
+void Spc::SkipIdleLoop(int64_t targetCycle) {
+	if (_pendingCpuRegUpdate || _emu->IsDebugging()) {
+		return;
+	}
+
+	// The values can't change while the loop runs (the S-CPU only runs once Run() returns), unless the DSP's echo buffer overwrites them
+	bool matches = _idleLoop.Matches(GetIdleLoopRegs(), [this](uint32_t addr, uint8_t value) {
+		return DebugRead(addr) == value && !_dsp->CanEchoWrite(addr);
+	});
+
+	if (matches) {
+		// The DSP and timers still run on every bus cycle, only the instructions are skipped
+		if (_idleLoop.Skip(_state.Cycle, targetCycle, [this](uint8_t speedSelect) { RunBusCycle(speedSelect); })) {
+			_opCode = _idleLoopTemps.OpCode;
+			_operandA = _idleLoopTemps.OperandA;
+			_operandB = _idleLoopTemps.OperandB;
+			_tmp1 = _idleLoopTemps.Tmp1;
+			_tmp2 = _idleLoopTemps.Tmp2;
+			_tmp3 = _idleLoopTemps.Tmp3;
+		}
+	}
+}
+#endif
+
 void Spc::ProcessEndFrame() {
 	Run();
 
@@ -462,8 +538,38 @@ void Spc::ProcessEndFrame() {
 		_emu->GetSoundMixer()->PlayAudioBuffer(_dsp->GetSamples(), sampleCount / 2, _spcSampleRate);
 	}
 	_dsp->ResetOutput();
+
+#ifndef DUMMYSPC
+	UpdateThreadMode();
+#endif
 }
 
+void Spc::RunAsync() {
+#ifndef DUMMYSPC
+	if (_thread && !_emu->HasDebugHooks()) {
+		_thread->RunAsync(_memoryManager->GetMasterClock());
+	}
+#endif
+}
+
+#ifndef DUMMYSPC
+void Spc::WaitForThread() {
+	if (_thread) {
+		_thread->WaitForIdle();
+	}
+}
+
+void Spc::UpdateThreadMode() {
+	// Only switched at the end of a frame, once the SPC has caught up (the debugger's hooks always run single-threaded)
+	bool useThread = _emu->GetSettings()->GetSnesConfig().RunSpcOnSeparateThread && !_emu->HasDebugHooks();
+	if (useThread && !_thread) {
+		_thread = std::make_unique<SpcThread>(this);
+	} else if (!useThread && _thread) {
+		_thread.reset();
+	}
+}
+#endif
+
 SpcState& Spc::GetState() {
 	return _state;
 }
@@ -509,6 +615,9 @@ void Spc::Serialize(Serializer& s) {
 		// Catch up SPC to main CPU before creating the state
 		Run();
 	}
+#ifndef DUMMYSPC
+	WaitForThread();
+#endif
 
 	SV(_state.A);
 	SV(_state.Cycle);
@@ -639,6 +748,9 @@ uint16_t Spc::GetDirectAddress(uint8_t offset) {
 }
 
 void Spc::LoadSpcFile(SpcFileData* data) {
+#ifndef DUMMYSPC
+	WaitForThread();
+#endif
 	memcpy(_ram.get(), data->SpcRam, Spc::SpcRamSize);
 
 	if (data->HasExtraRam) {
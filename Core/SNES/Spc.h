@@ -12,6 +12,7 @@
 #include "SNES/SnesCpuTypes.h"
 #include "SNES/SpcTimer.h"
 #include "Shared/MemoryOperationType.h"
+#include "Shared/IdleLoopDetector.h"
 #include "Utilities/ISerializable.h"
 
 class SnesConsole;
@@ -19,6 +20,7 @@ class Emulator;
 class SnesMemoryManager;
 class SpcFileData;
 class Dsp;
+class SpcThread;
 struct AddressInfo;
 
 /// <summary>
@@ -69,6 +71,9 @@ private:
 	static constexpr int SampleBufferSize = 0x20000;  ///< Audio sample buffer
 	static constexpr uint16_t ResetVector = 0xFFFE;   ///< Reset vector address
 
+	static constexpr uint8_t CpuWait[4] = {2, 4, 10, 20};          ///< SPC clocks per bus cycle, for each speed setting
+	static constexpr uint8_t TimerMultiplier[4] = {2, 4, 8, 16};   ///< Timer clocks per bus cycle, for each speed setting
+
 	Emulator* _emu = nullptr;
 	SnesConsole* _console = nullptr;
 	SnesMemoryManager* _memoryManager = nullptr;
@@ -89,10 +94,38 @@ private:
 	bool _enabled = false;              ///< SPC is running
 	bool _pendingCpuRegUpdate = false;  ///< Pending CPU register sync
 	uint32_t _spcSampleRate = Spc::SpcSampleRate;
+	uint64_t _runMasterClock = 0;       ///< Master clock the current Run call is catching up to
 
 	SpcState _state;                     ///< CPU registers and flags
 	std::unique_ptr<uint8_t[]> _ram;     ///< 64KB RAM
 
+	/// <summary>Registers that must match for a busy-wait loop iteration to be replayed (see IdleLoopDetector)</summary>
+	struct IdleLoopRegs {
+		uint8_t A;
+		uint8_t X;
+		uint8_t Y;
+		uint8_t SP;
+		uint8_t PS;
+		bool RomEnabled;
+		uint8_t InternalSpeed;
+		uint8_t ExternalSpeed;
+
+		bool operator==(const IdleLoopRegs&) const = default;
+	};
+
+	/// <summary>Temporary values at the end of the recorded iteration, restored after a replay</summary>
+	struct IdleLoopTemps {
+		uint8_t OpCode;
+		uint16_t OperandA;
+		uint16_t OperandB;
+		uint16_t Tmp1;
+		uint16_t Tmp2;
+		uint16_t Tmp3;
+	};
+
+	IdleLoopDetector<IdleLoopRegs> _idleLoop;
+	IdleLoopTemps _idleLoopTemps = {};
+
 	/// 64-byte IPL (Initial Program Loader) ROM - boots SPC and loads audio driver
 	uint8_t _spcBios[64]{
 	    0xCD, 0xEF, 0xBD, 0xE8, 0x00, 0xC6, 0x1D, 0xD0,
@@ -324,6 +357,11 @@ private:
 	uint8_t ReadOperandByte();
 
 	__forceinline void IncCycleCount(int32_t addr);
+	__forceinline void RunBusCycle(uint8_t speedSelect);
+
+	IdleLoopRegs GetIdleLoopRegs();
+	void UpdateIdleLoop();
+	void SkipIdleLoop(int64_t targetCycle);
 	void EndOp();
 	void EndAddr();
 	__forceinline void ProcessCycle();
@@ -332,6 +370,19 @@ private:
 	void UpdateClockRatio();
 	void ExitExecLoop();
 
+	void RunUntil(uint64_t masterClock);
+	void WriteCpuRegister(uint64_t masterClock, uint8_t addr, uint8_t value);
+
+#ifndef DUMMYSPC
+	friend class SpcThread;
+
+	/// Only set in the optional multithreaded mode - declared last to stop the thread before anything else is destroyed
+	unique_ptr<SpcThread> _thread;
+
+	void WaitForThread();
+	void UpdateThreadMode();
+#endif
+
 public:
 	Spc(SnesConsole* console);
 	virtual ~Spc();
@@ -341,6 +392,9 @@ public:
 	void Run();
 	void Reset();
 
+	/// <summary>Lets the SPC thread catch up with the S-CPU in the background (does nothing in the default single-thread mode)</summary>
+	void RunAsync();
+
 	uint8_t DebugRead(uint16_t addr);
 	void DebugWrite(uint16_t addr, uint8_t value);
 
@@ -357,6 +411,9 @@ public:
 	SpcState& GetState();
 	DspState& GetDspState();
 
+	/// <summary>Busy-wait loop skipping counters, for profiling</summary>
+	[[nodiscard]] const IdleLoopStats& GetIdleLoopStats() { return _idleLoop.GetStats(); }
+
 	bool IsMuted();
 	AddressInfo GetAbsoluteAddress(uint16_t addr);
 	int GetRelativeAddress(AddressInfo& absAddress);
@@ -0,0 +1,62 @@
+#include "pch.h"
+#include "SNES/SpcThread.h"
+#include "SNES/Spc.h"
+
+SpcThread::SpcThread(Spc* spc) {
+	_spc = spc;
+	_thread = std::thread(&SpcThread::ThreadLoop, this);
+}
+
+SpcThread::~SpcThread() {
+	Push({0, SpcThreadCommandType::Stop, 0, 0});
+	_thread.join();
+}
+
+void SpcThread::Push(const SpcThreadCommand& cmd) {
+	uint32_t writePos = _writePos.load(std::memory_order_relaxed);
+	while (writePos - _readPos.load(std::memory_order_acquire) >= QueueSize) [[unlikely]] {
+		// Full, the SPC thread is far behind
+		std::this_thread::yield();
+	}
+	_commands[writePos & (QueueSize - 1)] = cmd;
+	_writePos.store(writePos + 1, std::memory_order_release);
+	_writePos.notify_one();
+}
+
+void SpcThread::WaitForIdle() {
+	uint32_t writePos = _writePos.load(std::memory_order_relaxed);
+	while (_readPos.load(std::memory_order_acquire) != writePos) {
+		std::this_thread::yield();
+	}
+}
+
+void SpcThread::ThreadLoop() {
+	uint32_t readPos = _readPos.load(std::memory_order_relaxed);
+	uint32_t spinCount = 0;
+	while (true) {
+		if (readPos == _writePos.load(std::memory_order_acquire)) {
+			// Spin for a while (commands are sent on every scanline), then sleep until the next command (e.g paused)
+			if (++spinCount < SpinCount) {
+				std::this_thread::yield();
+			} else {
+				_writePos.wait(readPos, std::memory_order_acquire);
+				spinCount = 0;
+			}
+			continue;
+		}
+		spinCount = 0;
+
+		SpcThreadCommand cmd = _commands[readPos & (QueueSize - 1)];
+		switch (cmd.Type) {
+			case SpcThreadCommandType::Run: _spc->RunUntil(cmd.MasterClock); break;
+			case SpcThreadCommandType::WriteCpuRegister: _spc->WriteCpuRegister(cmd.MasterClock, cmd.Addr, cmd.Value); break;
+			case SpcThreadCommandType::Stop: break;
+		}
+
+		// Publishes the SPC's state along with the position, for WaitForIdle
+		_readPos.store(++readPos, std::memory_order_release);
+		if (cmd.Type == SpcThreadCommandType::Stop) {
+			break;
+		}
+	}
+}
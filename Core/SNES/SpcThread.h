@@ -0,0 +1,69 @@
+#pragma once
+#include "pch.h"
+#include <atomic>
+#include <thread>
+
+class Spc;
+
+enum class SpcThreadCommandType : uint8_t {
+	Run,              ///< Catch up to MasterClock
+	WriteCpuRegister, ///< S-CPU write to port Addr ($2140-$2143) at MasterClock
+	Stop              ///< Exit the thread (after all previous commands)
+};
+
+struct SpcThreadCommand {
+	uint64_t MasterClock;
+	SpcThreadCommandType Type;
+	uint8_t Addr;
+	uint8_t Value;
+};
+
+/// <summary>
+/// Runs the SPC700 and its DSP on their own thread, alongside the S-CPU (optional, see SnesConfig::RunSpcOnSeparateThread).
+/// </summary>
+/// <remarks>
+/// The S-CPU and the SPC only communicate through the 4 I/O ports, so the emulation thread never needs to wait for
+/// the SPC, except when it reads a port (or needs the SPC's state, e.g at the end of the frame or to save a state).
+/// Port writes are sent to the SPC thread through a lock-free single-producer/single-consumer queue, tagged with
+/// the master clock at which they occurred, along with "catch up to this clock" commands sent on every scanline.
+///
+/// The SPC thread never runs past the last master clock it was given, so it can never miss a port write and there
+/// is nothing to roll back: the SPC sees every write at the same cycle it would in the single-thread model.
+/// </remarks>
+class SpcThread {
+private:
+	static constexpr uint32_t QueueSize = 1024;
+	static constexpr uint32_t SpinCount = 2000;
+
+	Spc* _spc = nullptr;
+	SpcThreadCommand _commands[QueueSize] = {};
+
+	// Separate cache lines, each is written by a different thread
+	alignas(64) std::atomic<uint32_t> _writePos{0};
+	alignas(64) std::atomic<uint32_t> _readPos{0};
+
+	std::thread _thread;
+
+	void Push(const SpcThreadCommand& cmd);
+	void ThreadLoop();
+
+public:
+	SpcThread(Spc* spc);
+
+	/// <summary>Stops the thread once every pending command is processed</summary>
+	~SpcThread();
+
+	/// <summary>Lets the SPC catch up to masterClock in the background</summary>
+	void RunAsync(uint64_t masterClock) { Push({masterClock, SpcThreadCommandType::Run, 0, 0}); }
+
+	/// <summary>Catches up to masterClock and waits for the SPC thread to get there</summary>
+	void Run(uint64_t masterClock) {
+		RunAsync(masterClock);
+		WaitForIdle();
+	}
+
+	void WriteCpuRegister(uint64_t masterClock, uint8_t addr, uint8_t value) { Push({masterClock, SpcThreadCommandType::WriteCpuRegister, addr, value}); }
+
+	/// <summary>Waits until all commands are processed, the SPC's state can then be used by the emulation thread</summary>
+	void WaitForIdle();
+};
@@ -0,0 +1,186 @@
+#include "pch.h"
+#include "Shared/AllocationTracker.h"
+
+#ifdef NEXEN_ALLOC_TRACKING
+#include <cstdlib>
+#include <new>
+#include "Shared/MessageManager.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#include <malloc.h>
+#define NEXEN_RETURN_ADDRESS() _ReturnAddress()
+#else
+#include <dlfcn.h>
+#define NEXEN_RETURN_ADDRESS() __builtin_return_address(0)
+#endif
+
+namespace {
+	thread_local bool _tracking = false;
+	thread_local AllocationStats _stats;
+	thread_local uint32_t _frameCount = 0;
+	thread_local uint32_t _lastReportFrame = 0;
+	thread_local uint32_t _allocatingFrameCount = 0;
+
+	string GetCallSiteName(void* callSite) {
+#ifndef _MSC_VER
+		Dl_info info = {};
+		if (dladdr(callSite, &info) && info.dli_fname) {
+			string name = std::format("{}+0x{:x}", info.dli_fname, (uintptr_t)callSite - (uintptr_t)info.dli_fbase);
+			if (info.dli_sname) {
+				name += std::format(" ({})", info.dli_sname);
+			}
+			return name;
+		}
+#endif
+		return std::format("0x{:x}", (uintptr_t)callSite);
+	}
+
+	__forceinline void* Allocate(size_t size, void* callSite) {
+		if (_tracking) [[unlikely]] {
+			AllocationTracker::RecordAllocation(size, callSite);
+		}
+		return malloc(size ? size : 1);
+	}
+
+	__forceinline void* AllocateAligned(size_t size, std::align_val_t align, void* callSite) {
+		if (_tracking) [[unlikely]] {
+			AllocationTracker::RecordAllocation(size, callSite);
+		}
+#ifdef _MSC_VER
+		return _aligned_malloc(size ? size : 1, (size_t)align);
+#else
+		void* ptr = nullptr;
+		return posix_memalign(&ptr, std::max((size_t)align, sizeof(void*)), size ? size : 1) == 0 ? ptr : nullptr;
+#endif
+	}
+
+	__forceinline void FreeAligned(void* ptr) {
+#ifdef _MSC_VER
+		_aligned_free(ptr);
+#else
+		free(ptr);
+#endif
+	}
+}
+
+void AllocationTracker::TrackCurrentThread(bool enabled) {
+	_stats = {};
+	_frameCount = 0;
+	_lastReportFrame = 0;
+	_allocatingFrameCount = 0;
+	_tracking = enabled;
+}
+
+bool AllocationTracker::IsTrackingCurrentThread() {
+	return _tracking;
+}
+
+AllocationStats AllocationTracker::TakeStats() {
+	AllocationStats stats = _stats;
+	_stats = {};
+	return stats;
+}
+
+void AllocationTracker::RecordAllocation(size_t size, void* callSite) {
+	if (_stats.SampleCount < AllocationStats::MaxSamples) {
+		_stats.Samples[_stats.SampleCount++] = {callSite, size};
+	}
+	_stats.Count++;
+	_stats.Bytes += size;
+}
+
+void AllocationTracker::EndFrame() {
+	if (!_tracking) {
+		return;
+	}
+
+	AllocationStats stats = TakeStats();
+	_frameCount++;
+	if (stats.Count == 0 || _frameCount <= WarmupFrames) {
+		return;
+	}
+
+	_allocatingFrameCount++;
+	if (_lastReportFrame != 0 && _frameCount - _lastReportFrame < ReportInterval) {
+		return;
+	}
+	_lastReportFrame = _frameCount;
+
+	// Building the report allocates, don't count it
+	_tracking = false;
+	string report = std::format("[Alloc] Frame {}: {} allocation(s), {} bytes ({} allocating frames so far)", _frameCount, stats.Count, stats.Bytes, _allocatingFrameCount);
+	for (uint32_t i = 0; i < stats.SampleCount; i++) {
+		report += std::format("\n  {} bytes at {}", stats.Samples[i].Size, GetCallSiteName(stats.Samples[i].CallSite));
+	}
+	MessageManager::Log(std::move(report));
+	_stats = {};
+	_tracking = true;
+}
+
+uint32_t AllocationTracker::GetAllocatingFrameCount() {
+	return _allocatingFrameCount;
+}
+
+// Replacements for the global allocation functions (the default ones also use malloc/free)
+void* operator new(size_t size) {
+	void* ptr = Allocate(size, NEXEN_RETURN_ADDRESS());
+	if (!ptr) {
+		throw std::bad_alloc();
+	}
+	return ptr;
+}
+
+void* operator new[](size_t size) {
+	void* ptr = Allocate(size, NEXEN_RETURN_ADDRESS());
+	if (!ptr) {
+		throw std::bad_alloc();
+	}
+	return ptr;
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+	return Allocate(size, NEXEN_RETURN_ADDRESS());
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+	return Allocate(size, NEXEN_RETURN_ADDRESS());
+}
+
+void* operator new(size_t size, std::align_val_t align) {
+	void* ptr = AllocateAligned(size, align, NEXEN_RETURN_ADDRESS());
+	if (!ptr) {
+		throw std::bad_alloc();
+	}
+	return ptr;
+}
+
+void* operator new[](size_t size, std::align_val_t align) {
+	void* ptr = AllocateAligned(size, align, NEXEN_RETURN_ADDRESS());
+	if (!ptr) {
+		throw std::bad_alloc();
+	}
+	return ptr;
+}
+
+void* operator new(size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+	return AllocateAligned(size, align, NEXEN_RETURN_ADDRESS());
+}
+
+void* operator new[](size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+	return AllocateAligned(size, align, NEXEN_RETURN_ADDRESS());
+}
+
+void operator delete(void* ptr) noexcept { free(ptr); }
+void operator delete[](void* ptr) noexcept { free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { FreeAligned(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { FreeAligned(ptr); }
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept { FreeAligned(ptr); }
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept { FreeAligned(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { FreeAligned(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { FreeAligned(ptr); }
+#endif
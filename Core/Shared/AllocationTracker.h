@@ -0,0 +1,66 @@
+#pragma once
+#include "pch.h"
+
+/// <summary>Heap allocation recorded by AllocationTracker</summary>
+struct AllocationSample {
+	void* CallSite; ///< Return address of the operator new call
+	size_t Size;
+};
+
+/// <summary>Heap allocations made by a thread since the last AllocationTracker::TakeStats() call</summary>
+struct AllocationStats {
+	static constexpr uint32_t MaxSamples = 8;
+
+	uint64_t Count = 0;
+	uint64_t Bytes = 0;
+	uint32_t SampleCount = 0;
+	AllocationSample Samples[MaxSamples] = {}; ///< The first MaxSamples allocations
+};
+
+/// <summary>
+/// Counts the heap allocations made by the emulation thread, to catch allocations creeping into the per-frame hot path.
+/// </summary>
+/// <remarks>
+/// Only available in instrumented builds (NEXEN_ALLOC_TRACKING, make ALLOC_TRACKING=true), which replace the global
+/// operator new/delete. The counters are thread-local: only threads that called TrackCurrentThread(true) are counted,
+/// and the other threads only pay for a thread-local flag check. In regular builds, every function is an empty inline.
+///
+/// The emulation thread calls EndFrame() after each frame. Once the emulation is past its first WarmupFrames frames
+/// (buffers are still growing to their final size), any frame that allocates is logged with its call sites, at most
+/// once every ReportInterval frames. Call sites are printed as module+offset (for addr2line) when available.
+///
+/// Tests and benchmarks can use TrackCurrentThread/TakeStats directly to fail when a steady-state frame allocates.
+/// </remarks>
+class AllocationTracker {
+public:
+	static constexpr uint32_t WarmupFrames = 120;
+	static constexpr uint32_t ReportInterval = 60;
+
+#ifdef NEXEN_ALLOC_TRACKING
+	static constexpr bool Enabled = true;
+
+	/// <summary>Starts/stops counting the current thread's allocations (starting resets the counters)</summary>
+	static void TrackCurrentThread(bool enabled);
+	[[nodiscard]] static bool IsTrackingCurrentThread();
+
+	/// <summary>Returns the current thread's allocations since the last call, and resets the counters</summary>
+	static AllocationStats TakeStats();
+
+	/// <summary>Ends the current thread's frame: reports its allocations if it is past the warm-up frames</summary>
+	static void EndFrame();
+
+	/// <summary>Number of frames that allocated after the warm-up, since tracking started on this thread</summary>
+	[[nodiscard]] static uint32_t GetAllocatingFrameCount();
+
+	/// <summary>Called by the replaced operator new when the current thread is tracked</summary>
+	static void RecordAllocation(size_t size, void* callSite);
+#else
+	static constexpr bool Enabled = false;
+
+	static void TrackCurrentThread(bool enabled) {}
+	[[nodiscard]] static bool IsTrackingCurrentThread() { return false; }
+	static AllocationStats TakeStats() { return {}; }
+	static void EndFrame() {}
+	[[nodiscard]] static uint32_t GetAllocatingFrameCount() { return 0; }
+#endif
+};
@@ -0,0 +1,144 @@
+#pragma once
+#include "pch.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+
+/// <summary>Percentiles of a set of latency measurements, in milliseconds</summary>
+struct LatencyPercentiles {
+	double P50 = 0;
+	double P95 = 0;
+	double P99 = 0;
+	double Max = 0;
+	double Average = 0;
+};
+
+/// <summary>
+/// Last WindowSize measurements (in microseconds), written by one thread and readable from any other.
+/// </summary>
+class LatencyWindow {
+public:
+	static constexpr uint32_t WindowSize = 512;
+
+private:
+	std::atomic<uint32_t> _values[WindowSize] = {};
+	std::atomic<uint32_t> _count{0};
+
+public:
+	void Add(uint32_t value) {
+		uint32_t count = _count.load(std::memory_order_relaxed);
+		_values[count % WindowSize].store(value, std::memory_order_relaxed);
+		_count.store(count + 1, std::memory_order_release);
+	}
+
+	void Reset() {
+		_count.store(0, std::memory_order_release);
+	}
+
+	/// <summary>Percentiles of the current window (values may be a mix of old/new ones while the writer runs)</summary>
+	[[nodiscard]] LatencyPercentiles GetPercentiles() const {
+		uint32_t count = std::min(_count.load(std::memory_order_acquire), WindowSize);
+		if (count == 0) {
+			return {};
+		}
+
+		uint32_t values[WindowSize];
+		uint64_t sum = 0;
+		for (uint32_t i = 0; i < count; i++) {
+			values[i] = _values[i].load(std::memory_order_relaxed);
+			sum += values[i];
+		}
+		std::sort(values, values + count);
+
+		auto percentile = [&](uint32_t p) { return values[std::min(count - 1, count * p / 100)] / 1000.0; };
+
+		LatencyPercentiles result;
+		result.P50 = percentile(50);
+		result.P95 = percentile(95);
+		result.P99 = percentile(99);
+		result.Max = values[count - 1] / 1000.0;
+		result.Average = (double)sum / count / 1000.0;
+		return result;
+	}
+};
+
+/// <summary>
+/// Measures the time between the start of mixing of an audio block (SoundMixer::PlayAudioBuffer)
+/// and the moment the audio device consumes the last byte of that block.
+/// </summary>
+/// <remarks>
+/// The producer (emulation thread) calls OnQueued() after writing a block to the device's buffer,
+/// the consumer (device callback, or the end of frame processing for cursor based backends) calls
+/// OnConsumed() with the amount of bytes it read. Blocks are matched by byte position through a
+/// small lock-free queue, neither side ever blocks. Any buffering done by the OS/driver after
+/// the consume point is not included.
+///
+/// Clear() must only be called while the consumer is stopped.
+/// </remarks>
+class AudioLatencyTracker {
+private:
+	struct BlockMark {
+		uint64_t EndPosition;
+		int64_t Timestamp;
+	};
+
+	static constexpr uint32_t MarkCount = 256;
+
+	BlockMark _marks[MarkCount] = {};
+	alignas(64) std::atomic<uint32_t> _markWrite{0};
+	alignas(64) std::atomic<uint32_t> _markRead{0};
+
+	uint64_t _queuedBytes = 0;   // Producer only
+	uint64_t _consumedBytes = 0; // Consumer only
+
+	LatencyWindow _latencies;
+
+public:
+	/// <summary>Current time, in microseconds</summary>
+	[[nodiscard]] static int64_t GetTimestamp() {
+		return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	/// <summary>Producer: a block of the given size, whose mixing started at timestamp, was written to the device's buffer</summary>
+	void OnQueued(uint32_t bytes, int64_t timestamp) {
+		_queuedBytes += bytes;
+		if (bytes == 0 || timestamp == 0) {
+			// Nothing to measure, the bytes still count so the following blocks stay aligned
+			return;
+		}
+
+		uint32_t write = _markWrite.load(std::memory_order_relaxed);
+		if (write - _markRead.load(std::memory_order_acquire) < MarkCount) {
+			_marks[write % MarkCount] = {_queuedBytes, timestamp};
+			_markWrite.store(write + 1, std::memory_order_release);
+		}
+	}
+
+	/// <summary>Consumer: the device read the given number of bytes from its buffer</summary>
+	void OnConsumed(uint32_t bytes) {
+		_consumedBytes += bytes;
+
+		uint32_t read = _markRead.load(std::memory_order_relaxed);
+		uint32_t write = _markWrite.load(std::memory_order_acquire);
+		if (read == write) {
+			return;
+		}
+
+		int64_t now = GetTimestamp();
+		while (read != write && _marks[read % MarkCount].EndPosition <= _consumedBytes) {
+			_latencies.Add((uint32_t)std::clamp<int64_t>(now - _marks[read % MarkCount].Timestamp, 0, UINT32_MAX));
+			read++;
+		}
+		_markRead.store(read, std::memory_order_release);
+	}
+
+	void Clear() {
+		_markWrite.store(0, std::memory_order_relaxed);
+		_markRead.store(0, std::memory_order_relaxed);
+		_queuedBytes = 0;
+		_consumedBytes = 0;
+		_latencies.Reset();
+	}
+
+	[[nodiscard]] LatencyPercentiles GetLatency() const { return _latencies.GetPercentiles(); }
+};
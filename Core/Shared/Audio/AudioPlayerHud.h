@@ -38,5 +38,5 @@ public:
 
 	void Draw(uint32_t frameCounter, double fps);
 	uint32_t GetVolume();
-	void ProcessSamples(int16_t* samples, size_t sampleCount, uint32_t sampleRate);
+	void ProcessSamples(const float* samples, size_t sampleCount, uint32_t sampleRate);
 };
\ No newline at end of file
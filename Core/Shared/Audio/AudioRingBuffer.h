@@ -0,0 +1,81 @@
+#pragma once
+#include "pch.h"
+
+/// <summary>
+/// Lock-free single-producer/single-consumer byte ring between the emulation thread
+/// (SoundMixer -> PlayBuffer) and an audio device callback.
+/// </summary>
+/// <remarks>
+/// The producer only writes _writePos and the consumer only writes _readPos, so neither
+/// side ever waits on the other (no priority inversion with the audio thread). Positions
+/// are free-running counters, the capacity is a power of 2 so they can wrap at 2^32.
+///
+/// Write() drops what doesn't fit and Read() returns what is available, the caller decides
+/// what to do with the rest (e.g. output silence). Reset() is not thread-safe, the
+/// consumer must be stopped (device paused/closed) while it runs.
+/// </remarks>
+class AudioRingBuffer {
+private:
+	vector<uint8_t> _buffer;
+	uint32_t _mask = 0;
+
+	// Separate cache lines, each is written by a different thread
+	alignas(64) std::atomic<uint32_t> _writePos{0};
+	alignas(64) std::atomic<uint32_t> _readPos{0};
+
+public:
+	/// <summary>Allocate (at least) the given capacity, rounded up to a power of 2, and empty the buffer</summary>
+	void Reset(uint32_t minCapacity) {
+		uint32_t capacity = minCapacity ? 1 : 0;
+		while (capacity < minCapacity) {
+			capacity <<= 1;
+		}
+		_buffer.assign(capacity, 0);
+		_mask = capacity ? capacity - 1 : 0;
+		_writePos.store(0, std::memory_order_relaxed);
+		_readPos.store(0, std::memory_order_relaxed);
+	}
+
+	/// <summary>Empty the buffer, keeps the current capacity (consumer must be stopped)</summary>
+	void Clear() {
+		_writePos.store(0, std::memory_order_relaxed);
+		_readPos.store(0, std::memory_order_relaxed);
+	}
+
+	[[nodiscard]] uint32_t GetCapacity() const { return (uint32_t)_buffer.size(); }
+
+	/// <summary>Bytes waiting to be read (exact on either thread for its own side, approximate for the other)</summary>
+	[[nodiscard]] uint32_t GetFillLevel() const {
+		return _writePos.load(std::memory_order_acquire) - _readPos.load(std::memory_order_acquire);
+	}
+
+	/// <summary>Producer: append up to len bytes, returns the number of bytes written</summary>
+	uint32_t Write(const uint8_t* data, uint32_t len) {
+		uint32_t writePos = _writePos.load(std::memory_order_relaxed);
+		uint32_t readPos = _readPos.load(std::memory_order_acquire);
+		len = std::min(len, GetCapacity() - (writePos - readPos));
+
+		uint32_t offset = writePos & _mask;
+		uint32_t firstPart = std::min(len, GetCapacity() - offset);
+		memcpy(_buffer.data() + offset, data, firstPart);
+		memcpy(_buffer.data(), data + firstPart, len - firstPart);
+
+		_writePos.store(writePos + len, std::memory_order_release);
+		return len;
+	}
+
+	/// <summary>Consumer: copy up to len bytes out, returns the number of bytes read</summary>
+	uint32_t Read(uint8_t* output, uint32_t len) {
+		uint32_t readPos = _readPos.load(std::memory_order_relaxed);
+		uint32_t writePos = _writePos.load(std::memory_order_acquire);
+		len = std::min(len, writePos - readPos);
+
+		uint32_t offset = readPos & _mask;
+		uint32_t firstPart = std::min(len, GetCapacity() - offset);
+		memcpy(output, _buffer.data() + offset, firstPart);
+		memcpy(output + firstPart, _buffer.data(), len - firstPart);
+
+		_readPos.store(readPos + len, std::memory_order_release);
+		return len;
+	}
+};
@@ -0,0 +1,119 @@
+#include "pch.h"
+#include <thread>
+#include "Shared/Audio/AudioTrackExporter.h"
+#include "Shared/Audio/SoundMixer.h"
+#include "Shared/Emulator.h"
+#include "Shared/EmuSettings.h"
+#include "Shared/NotificationManager.h"
+#include "Shared/Interfaces/IConsole.h"
+#include "Utilities/VirtualFile.h"
+
+AudioTrackExporter::AudioTrackExporter(Emulator* emu, const string& outputFile, const AudioTrackExportOptions& options) {
+	_emu = emu;
+	_outputFile = outputFile;
+	_options = options;
+}
+
+void AudioTrackExporter::StartCapture() {
+	// Emulation thread, right after the reset that starts the selected track
+	AudioTrackInfo track = _emu->GetAudioTrackInfo();
+	if (_writer.Open(_outputFile, _options, track.Length, track.FadeLength)) {
+		_capturing = true;
+	} else {
+		_openFailed = true;
+		_done = true;
+		_doneSignal.Signal();
+	}
+}
+
+void AudioTrackExporter::ProcessNotification(ConsoleNotificationType type, void* parameter) {
+	if (type == ConsoleNotificationType::GameReset && !_capturing && !_done) {
+		StartCapture();
+	}
+}
+
+void AudioTrackExporter::MixAudio(int16_t* out, uint32_t sampleCount, uint32_t sampleRate) {
+	// Only reads the output, the emulation keeps running until ExportTrack stops it
+	if (_capturing && !_done && !_writer.AddSamples(out, sampleCount)) {
+		_done = true;
+		_doneSignal.Signal();
+	}
+}
+
+AudioTrackExportResult AudioTrackExporter::ExportTrack(const string& filename, uint32_t trackNumber, const string& outputFile, const AudioTrackExportOptions& options) {
+	AudioTrackExportResult result = {};
+
+	unique_ptr<Emulator> emu(new Emulator());
+	emu->Initialize(false);
+
+	EmuSettings* settings = emu->GetSettings();
+	settings->SetFlag(EmulationFlags::TestMode);
+	settings->GetPreferences().RewindBufferSize = 0;
+	AudioConfig& audioCfg = settings->GetAudioConfig();
+	audioCfg.SampleRate = options.SampleRate;
+	audioCfg.DisableDynamicSampleRate = true;
+	audioCfg.AudioPlayerAutoDetectSilence = false;
+
+	shared_ptr<AudioTrackExporter> exporter(new AudioTrackExporter(emu.get(), outputFile, options));
+	emu->GetNotificationManager()->RegisterNotificationListener(exporter);
+	emu->GetSoundMixer()->RegisterAudioProvider(exporter.get());
+
+	emu->Lock();
+	if (emu->LoadRom((VirtualFile)filename, VirtualFile(""))) {
+		// Selecting the track resets the console, the capture starts after the reset
+		AudioPlayerActionParams params = {};
+		params.Action = AudioPlayerAction::SelectTrack;
+		params.TrackNumber = trackNumber;
+		emu->ProcessAudioPlayerAction(params);
+		settings->SetFlag(EmulationFlags::MaximumSpeed);
+
+		emu->Unlock();
+		while (!exporter->_doneSignal.Wait(1000)) {
+			if (!emu->IsRunning()) {
+				// Emulation stopped on its own (e.g crash), keep what was rendered
+				break;
+			}
+		}
+		emu->Stop(false);
+
+		if (exporter->_openFailed) {
+			result.ErrorCode = -2;
+		} else {
+			result.ErrorCode = exporter->_writer.Close() ? 0 : -2;
+			result.SampleCount = exporter->_writer.GetWrittenSampleCount();
+			result.EndedBySilence = exporter->_writer.IsEndedBySilence();
+		}
+	} else {
+		emu->Unlock();
+		result.ErrorCode = -1;
+	}
+
+	emu->GetSoundMixer()->UnregisterAudioProvider(exporter.get());
+	emu->Release();
+	return result;
+}
+
+void AudioTrackExporter::ExportTracks(char** filenames, uint32_t* trackNumbers, char** outputFiles, uint32_t count, const AudioTrackExportOptions& options, AudioTrackExportResult* results, uint32_t threadCount) {
+	// Each track gets its own headless emulator instance, workers pull the next track from a shared index
+	if (threadCount == 0) {
+		threadCount = std::max(1u, std::thread::hardware_concurrency());
+	}
+	threadCount = std::min(threadCount, count);
+
+	std::atomic<uint32_t> nextTrack = 0;
+	auto worker = [&]() {
+		uint32_t i;
+		while ((i = nextTrack++) < count) {
+			results[i] = ExportTrack(filenames[i], trackNumbers[i], outputFiles[i], options);
+		}
+	};
+
+	vector<std::thread> workers;
+	workers.reserve(threadCount);
+	for (uint32_t i = 0; i < threadCount; i++) {
+		workers.emplace_back(worker);
+	}
+	for (std::thread& t : workers) {
+		t.join();
+	}
+}
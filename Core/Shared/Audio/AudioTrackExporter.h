@@ -0,0 +1,45 @@
+#pragma once
+#include "pch.h"
+#include <atomic>
+#include "Shared/Audio/AudioTrackWriter.h"
+#include "Shared/Interfaces/IAudioProvider.h"
+#include "Shared/Interfaces/INotificationListener.h"
+#include "Utilities/AutoResetEvent.h"
+
+class Emulator;
+
+/// <summary>
+/// Renders audio player tracks (NSF/NSFe, and the other audio formats supported by the audio player) to WAV files,
+/// faster than real time.
+/// </summary>
+/// <remarks>
+/// Each track runs on its own headless emulator instance at maximum speed, with rewind, the frame limiter and
+/// most of the video output disabled. The mixed output (including expansion audio) is captured before the
+/// volume, equalizer and other effects are applied. Several tracks can be exported in parallel (ExportTracks).
+/// </remarks>
+class AudioTrackExporter final : public INotificationListener, public IAudioProvider, public std::enable_shared_from_this<AudioTrackExporter> {
+private:
+	Emulator* _emu = nullptr;
+	AudioTrackExportOptions _options = {};
+	string _outputFile;
+
+	AudioTrackWriter _writer;
+	bool _capturing = false;
+	bool _openFailed = false;
+	std::atomic<bool> _done = false;
+	AutoResetEvent _doneSignal;
+
+	void StartCapture();
+
+public:
+	AudioTrackExporter(Emulator* emu, const string& outputFile, const AudioTrackExportOptions& options);
+
+	void ProcessNotification(ConsoleNotificationType type, void* parameter) override;
+	void MixAudio(int16_t* out, uint32_t sampleCount, uint32_t sampleRate) override;
+
+	/// <summary>Renders a track (0-based) of the given file to a WAV file</summary>
+	static AudioTrackExportResult ExportTrack(const string& filename, uint32_t trackNumber, const string& outputFile, const AudioTrackExportOptions& options);
+
+	/// <summary>Renders count tracks, on threadCount threads (0 = one per core)</summary>
+	static void ExportTracks(char** filenames, uint32_t* trackNumbers, char** outputFiles, uint32_t count, const AudioTrackExportOptions& options, AudioTrackExportResult* results, uint32_t threadCount);
+};
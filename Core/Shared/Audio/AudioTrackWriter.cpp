@@ -0,0 +1,140 @@
+#include "pch.h"
+#include "Shared/Audio/AudioTrackWriter.h"
+
+bool AudioTrackWriter::Open(const string& filename, const AudioTrackExportOptions& options, double trackLength, double fadeLength) {
+	_options = options;
+	_maxSamples = (uint64_t)options.MaxLength * options.SampleRate;
+	_fadeStart = _maxSamples;
+	if (options.UseTrackLength && trackLength > 0) {
+		_maxSamples = (uint64_t)(trackLength * options.SampleRate);
+		_fadeStart = _maxSamples - std::min(_maxSamples, (uint64_t)(fadeLength * options.SampleRate));
+
+		// The file gives the track's length, don't cut it short
+		_options.SilenceLength = 0;
+	}
+
+	// Large buffer, the tracks are written much faster than real time
+	_fileBuffer.resize(1024 * 1024);
+	_file.rdbuf()->pubsetbuf(_fileBuffer.data(), _fileBuffer.size());
+	_file.open(filename, ios::out | ios::binary);
+	if (!_file) {
+		return false;
+	}
+
+	_file << "RIFF";
+	uint32_t size = 0;
+	_file.write((char*)&size, sizeof(size));
+	_file << "WAVE";
+	_file << "fmt ";
+
+	uint32_t chunkSize = 16;
+	uint16_t format = 1; // PCM
+	uint16_t channelCount = 2;
+	uint32_t sampleRate = options.SampleRate;
+	uint32_t byteRate = sampleRate * 4;
+	uint16_t blockAlign = 4;
+	uint16_t bitsPerSample = 16;
+	_file.write((char*)&chunkSize, sizeof(chunkSize));
+	_file.write((char*)&format, sizeof(format));
+	_file.write((char*)&channelCount, sizeof(channelCount));
+	_file.write((char*)&sampleRate, sizeof(sampleRate));
+	_file.write((char*)&byteRate, sizeof(byteRate));
+	_file.write((char*)&blockAlign, sizeof(blockAlign));
+	_file.write((char*)&bitsPerSample, sizeof(bitsPerSample));
+
+	_file << "data";
+	_file.write((char*)&size, sizeof(size));
+	return (bool)_file;
+}
+
+bool AudioTrackWriter::IsSilent(const int16_t* samples, uint32_t sampleCount) {
+	if (sampleCount == 0) {
+		return true;
+	}
+
+	int16_t minValue[2] = {samples[0], samples[1]};
+	int16_t maxValue[2] = {samples[0], samples[1]};
+	for (uint32_t i = 0; i < sampleCount * 2; i++) {
+		minValue[i & 1] = std::min(minValue[i & 1], samples[i]);
+		maxValue[i & 1] = std::max(maxValue[i & 1], samples[i]);
+	}
+	return (uint32_t)(maxValue[0] - minValue[0]) <= _options.SilenceThreshold && (uint32_t)(maxValue[1] - minValue[1]) <= _options.SilenceThreshold;
+}
+
+void AudioTrackWriter::Write(const int16_t* samples, uint32_t sampleCount) {
+	_file.write((const char*)samples, sampleCount * 4);
+	_dataSize += sampleCount * 4;
+}
+
+bool AudioTrackWriter::AddSamples(const int16_t* samples, uint32_t sampleCount) {
+	if (_done) {
+		return false;
+	}
+
+	uint64_t remaining = _maxSamples - _sampleCount;
+	if (sampleCount >= remaining) {
+		sampleCount = (uint32_t)remaining;
+		_done = true;
+	}
+
+	int16_t block[4096];
+	for (uint32_t offset = 0; offset < sampleCount; offset += 2048) {
+		uint32_t count = std::min<uint32_t>(2048, sampleCount - offset);
+		memcpy(block, samples + offset * 2, count * 4);
+
+		if (_sampleCount + count > _fadeStart) {
+			// Linear fade out, down to 0 at the end of the track
+			uint64_t fadeLength = _maxSamples - _fadeStart;
+			for (uint32_t i = 0; i < count; i++) {
+				uint64_t pos = _sampleCount + i;
+				if (pos >= _fadeStart) {
+					double volume = (double)(_maxSamples - pos) / fadeLength;
+					block[i * 2] = (int16_t)(block[i * 2] * volume);
+					block[i * 2 + 1] = (int16_t)(block[i * 2 + 1] * volume);
+				}
+			}
+		}
+
+		if (_options.SilenceLength > 0 && IsSilent(block, count)) {
+			_pendingSilence.insert(_pendingSilence.end(), block, block + count * 2);
+			_silentSamples += count;
+			if (_silentSamples >= (uint64_t)_options.SilenceLength * _options.SampleRate) {
+				// End of the track, the trailing silence isn't written
+				_endedBySilence = true;
+				_done = true;
+				return false;
+			}
+		} else {
+			if (!_pendingSilence.empty()) {
+				Write(_pendingSilence.data(), (uint32_t)_pendingSilence.size() / 2);
+				_pendingSilence.clear();
+			}
+			_silentSamples = 0;
+			Write(block, count);
+		}
+		_sampleCount += count;
+	}
+	return !_done;
+}
+
+bool AudioTrackWriter::Close() {
+	if (!_file.is_open()) {
+		return false;
+	}
+
+	if (!_done && !_pendingSilence.empty()) {
+		// Stopped before the end of the track (e.g emulation error), keep everything
+		Write(_pendingSilence.data(), (uint32_t)_pendingSilence.size() / 2);
+	}
+	_pendingSilence = {};
+
+	_file.seekp(4, ios::beg);
+	uint32_t fileSize = _dataSize + 36;
+	_file.write((char*)&fileSize, sizeof(fileSize));
+	_file.seekp(40, ios::beg);
+	_file.write((char*)&_dataSize, sizeof(_dataSize));
+
+	bool result = (bool)_file;
+	_file.close();
+	return result;
+}
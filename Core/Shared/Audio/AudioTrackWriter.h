@@ -0,0 +1,61 @@
+#pragma once
+#include "pch.h"
+
+/// <summary>Options for AudioTrackExporter/AudioTrackWriter (passed as-is through the interop API)</summary>
+struct AudioTrackExportOptions {
+	uint32_t SampleRate = 48000;
+	uint32_t MaxLength = 600;       ///< In seconds
+	uint32_t SilenceLength = 5;     ///< In seconds, the track ends after this much silence (0 = disabled)
+	uint32_t SilenceThreshold = 64; ///< Peak-to-peak amplitude below which a block of samples is silent
+	bool UseTrackLength = true;     ///< Use the track's length and fade from the file when available (NSFe, etc.)
+};
+
+/// <summary>Result of an export</summary>
+struct AudioTrackExportResult {
+	int32_t ErrorCode;    ///< 0 = success, -1 = file could not be loaded, -2 = output could not be written
+	uint32_t SampleCount; ///< Length of the WAV file, in samples (frames)
+	bool EndedBySilence;  ///< True if the track's end was found by silence detection
+};
+
+/// <summary>
+/// Writes the samples of a track to a WAV file, applies the fade out and stops at the end of the track.
+/// </summary>
+/// <remarks>
+/// Silence detection works on blocks of samples (one emulated frame): a block is silent when the peak-to-peak
+/// amplitude of both channels is below the threshold (constant DC offsets count as silence). Silent blocks are only
+/// written once non-silent samples follow them, so the trailing silence is trimmed from the file.
+/// </remarks>
+class AudioTrackWriter {
+private:
+	ofstream _file;
+	AudioTrackExportOptions _options = {};
+	vector<char> _fileBuffer;
+	vector<int16_t> _pendingSilence; ///< Silent samples not written yet (trimmed if the track ends)
+
+	uint64_t _sampleCount = 0;  ///< Samples received (written + pending)
+	uint64_t _maxSamples = 0;   ///< Track length
+	uint64_t _fadeStart = 0;    ///< Fade out starts at this sample (== _maxSamples when there is no fade)
+	uint64_t _silentSamples = 0; ///< Length of the current silence
+	uint32_t _dataSize = 0;
+	bool _endedBySilence = false;
+	bool _done = false;
+
+	void Write(const int16_t* samples, uint32_t sampleCount);
+	[[nodiscard]] bool IsSilent(const int16_t* samples, uint32_t sampleCount);
+
+public:
+	/// <summary>Creates the WAV file</summary>
+	/// <param name="trackLength">Track length from the file in seconds, including the fade (0 = unknown)</param>
+	/// <param name="fadeLength">Fade out length in seconds</param>
+	bool Open(const string& filename, const AudioTrackExportOptions& options, double trackLength, double fadeLength);
+
+	/// <summary>Adds stereo samples, returns false once the end of the track is reached</summary>
+	bool AddSamples(const int16_t* samples, uint32_t sampleCount);
+
+	/// <summary>Updates the WAV header and closes the file, returns false if it could not be written</summary>
+	bool Close();
+
+	[[nodiscard]] bool IsDone() const { return _done; }
+	[[nodiscard]] bool IsEndedBySilence() const { return _endedBySilence; }
+	[[nodiscard]] uint32_t GetWrittenSampleCount() const { return _dataSize / 4; }
+};
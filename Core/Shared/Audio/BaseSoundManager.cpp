@@ -3,12 +3,18 @@
 
 void BaseSoundManager::ProcessLatency(uint32_t readPosition, uint32_t writePosition) {
 	// Record latency between read & write cursors once per frame
-	int32_t cursorGap;
 	if (writePosition < readPosition) {
-		cursorGap = writePosition - readPosition + _bufferSize;
+		ProcessLatency(writePosition - readPosition + _bufferSize);
 	} else {
-		cursorGap = writePosition - readPosition;
+		ProcessLatency(writePosition - readPosition);
 	}
+}
+
+void BaseSoundManager::ProcessLatency(uint32_t bufferedBytes) {
+	int32_t cursorGap = (int32_t)bufferedBytes;
+
+	uint32_t bytesPerSample = _isStereo ? 4 : 2;
+	_currentLatency = _sampleRate ? (cursorGap / bytesPerSample) / (double)_sampleRate * 1000 : 0;
 
 	_cursorGaps[_cursorGapIndex] = cursorGap;
 	_cursorGapIndex = (_cursorGapIndex + 1) % 60;
@@ -19,8 +25,6 @@ void BaseSoundManager::ProcessLatency(uint32_t readPosition, uint32_t writePosit
 	if (_cursorGapFilled) {
 		// Once we have 60+ frames worth of data to work with, adjust playback frequency by +/- 0.5%
 		// To speed up or slow down playback in order to reach our latency goal.
-		uint32_t bytesPerSample = _isStereo ? 4 : 2;
-
 		int32_t gapSum = 0;
 		for (int i = 0; i < 60; i++) {
 			gapSum += _cursorGaps[i];
@@ -34,8 +38,15 @@ void BaseSoundManager::ProcessLatency(uint32_t readPosition, uint32_t writePosit
 AudioStatistics BaseSoundManager::GetStatistics() {
 	AudioStatistics stats;
 	stats.AverageLatency = _averageLatency;
+	stats.CurrentLatency = _currentLatency;
 	stats.BufferUnderrunEventCount = _bufferUnderrunEventCount;
 	stats.BufferSize = _bufferSize;
+
+	LatencyPercentiles latency = _latencyTracker.GetLatency();
+	stats.OutputLatencyP50 = latency.P50;
+	stats.OutputLatencyP95 = latency.P95;
+	stats.OutputLatencyP99 = latency.P99;
+	stats.OutputLatencyMax = latency.Max;
 	return stats;
 }
 
@@ -44,4 +55,6 @@ void BaseSoundManager::ResetStats() {
 	_cursorGapFilled = false;
 	_bufferUnderrunEventCount = 0;
 	_averageLatency = 0;
+	_currentLatency = 0;
+	_latencyTracker.Clear();
 }
@@ -1,5 +1,7 @@
 #pragma once
 #include "Core/Shared/Interfaces/IAudioDevice.h"
+#include "Core/Shared/Audio/AudioRingBuffer.h"
+#include "Core/Shared/Audio/AudioLatencyTracker.h"
 
 /// <summary>
 /// Base class for platform-specific audio device implementations.
@@ -17,8 +19,15 @@
 /// - Averages over 60-sample window
 /// - Reports buffer underruns (audio starvation)
 ///
+/// Callback-driven backends (SDL) exchange samples through _ringBuffer: PlayBuffer() writes
+/// to it on the emulation thread and the device callback reads from it directly, lock-free.
+///
+/// Output latency: derived classes report the bytes they queue (with _mixStartTime) and the
+/// bytes the device consumes to _latencyTracker, which gives end-to-end latency percentiles.
+///
 /// Statistics provided:
 /// - Average latency (milliseconds)
+/// - Current latency (last measurement, drives dynamic rate control)
 /// - Buffer size
 /// - Underrun event count
 ///
@@ -31,15 +40,23 @@
 class BaseSoundManager : public IAudioDevice {
 public:
 	void ProcessLatency(uint32_t readPosition, uint32_t writePosition);
+	void ProcessLatency(uint32_t bufferedBytes);
 	AudioStatistics GetStatistics();
+	void SetMixStartTime(int64_t timestamp) override { _mixStartTime = timestamp; }
 
 protected:
 	bool _isStereo;
 	uint32_t _sampleRate = 0;
 
 	double _averageLatency = 0;
+	double _currentLatency = 0;
 	uint32_t _bufferSize = 0x10000;
-	uint32_t _bufferUnderrunEventCount = 0;
+	std::atomic<uint32_t> _bufferUnderrunEventCount = 0;
+
+	AudioRingBuffer _ringBuffer;
+
+	AudioLatencyTracker _latencyTracker;
+	int64_t _mixStartTime = 0;
 
 	int32_t _cursorGaps[60];
 	int32_t _cursorGapIndex = 0;
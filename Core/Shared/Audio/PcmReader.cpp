@@ -9,45 +9,50 @@ PcmReader::PcmReader() {
 	_outputBuffer = std::make_unique<int16_t[]>(20000);
 }
 
-PcmReader::~PcmReader() = default;
-
-bool PcmReader::Init(const string& filename, bool loop, uint32_t startOffset) {
-	if (_file) {
-		_file.close();
+PcmReader::~PcmReader() {
+	if (_streamThread) {
+		_stopStreaming = true;
+		_streamSignal.Signal();
+		_streamThread->join();
 	}
+}
 
-	_file.open(filename, ios::binary);
-	if (_file) {
-		_file.seekg(0, ios::end);
-		_fileSize = (uint32_t)_file.tellg();
-		if (_fileSize < 12) {
-			return false;
-		}
-
-		_file.seekg(4, ios::beg);
-		uint32_t loopOffset = (uint8_t)_file.get();
-		loopOffset |= ((uint8_t)_file.get()) << 8;
-		loopOffset |= ((uint8_t)_file.get()) << 16;
-		loopOffset |= ((uint8_t)_file.get()) << 24;
+void PcmReader::Open(const string& filename, bool loop, uint32_t startOffset) {
+	{
+		auto fileLock = _fileLock.AcquireSafe();
+		_pendingFile = filename;
+		_openPending = true;
+		_loop = loop;
+		_readOffset = startOffset;
+		_endQueued = false;
 
-		_loopOffset = (uint32_t)loopOffset;
+		auto queueLock = _queueLock.AcquireSafe();
+		_chunks.clear();
+	}
 
-		_prevLeft = 0;
-		_prevRight = 0;
-		_done = false;
-		_loop = loop;
-		_fileOffset = startOffset;
-		_file.seekg(_fileOffset, ios::beg);
+	_chunkPos = 0;
+	_fileOffset = startOffset;
+	_done = false;
+	_pcmBuffer.clear();
+	_resampler.Reset();
 
-		_leftoverSampleCount = 0;
-		_pcmBuffer.clear();
-		_resampler.Reset();
+	if (!_streamThread) {
+		_streamThread = std::make_unique<std::thread>(&PcmReader::StreamThread, this);
+	}
+	_streamSignal.Signal();
+}
 
-		return true;
-	} else {
-		_done = true;
-		return false;
+void PcmReader::Stop() {
+	auto fileLock = _fileLock.AcquireSafe();
+	_openPending = false;
+	_endQueued = true;
+	if (_file.is_open()) {
+		_file.close();
 	}
+
+	auto queueLock = _queueLock.AcquireSafe();
+	_chunks.clear();
+	_done = true;
 }
 
 bool PcmReader::IsPlaybackOver() {
@@ -63,49 +68,150 @@ void PcmReader::SetSampleRate(uint32_t sampleRate) {
 }
 
 void PcmReader::SetLoopFlag(bool loop) {
+	if (_loop == loop) {
+		// Only written by this thread, no need to lock to read it
+		return;
+	}
+
+	auto fileLock = _fileLock.AcquireSafe();
 	_loop = loop;
+	if (!_done) {
+		// The samples read ahead were read with the previous loop flag, read them again
+		auto queueLock = _queueLock.AcquireSafe();
+		_chunks.clear();
+		_chunkPos = 0;
+		_readOffset = _fileOffset;
+		_endQueued = false;
+	}
+	_streamSignal.Signal();
 }
 
-void PcmReader::ReadSample(int16_t& left, int16_t& right) {
-	uint8_t val[4];
-	_file.get(((char*)val)[0]);
-	_file.get(((char*)val)[1]);
-	_file.get(((char*)val)[2]);
-	_file.get(((char*)val)[3]);
+void PcmReader::OpenFile() {
+	_openPending = false;
+	if (_file.is_open()) {
+		_file.close();
+	}
+	_file.clear();
+	_fileSize = 0;
 
-	left = val[0] | (val[1] << 8);
-	right = val[2] | (val[3] << 8);
+	_file.open(_pendingFile, ios::binary);
+	if (_file) {
+		_file.seekg(0, ios::end);
+		uint32_t fileSize = (uint32_t)_file.tellg();
+		if (fileSize >= 12) {
+			uint8_t header[4] = {};
+			_file.seekg(4, ios::beg);
+			_file.read((char*)header, sizeof(header));
+			_loopOffset = header[0] | (header[1] << 8) | (header[2] << 16) | (header[3] << 24);
+			_fileSize = fileSize;
+		}
+	}
 }
 
-void PcmReader::LoadSamples(uint32_t samplesToLoad) {
-	uint32_t samplesRead = 0;
+PcmReader::Chunk PcmReader::ReadChunk() {
+	if (_openPending) {
+		OpenFile();
+	}
 
-	_pcmBuffer.reserve(_pcmBuffer.size() + samplesToLoad * 2);
+	Chunk chunk;
+	if (_readOffset + 4 > _fileSize && _loop) {
+		_readOffset = _loopOffset * 4 + 8;
+	}
+	chunk.Offset = _readOffset;
+
+	if (_readOffset + 4 > _fileSize) {
+		// End of the track (or invalid file/loop point)
+		chunk.EndOfTrack = true;
+		_endQueued = true;
+		return chunk;
+	}
+
+	uint32_t frameCount = std::min(PcmReader::ChunkFrames, (_fileSize - _readOffset) / 4);
+	_readBuffer.resize(frameCount * 4);
+	_file.clear();
+	_file.seekg(_readOffset, ios::beg);
+	_file.read((char*)_readBuffer.data(), _readBuffer.size());
+	frameCount = (uint32_t)_file.gcount() / 4;
+
+	chunk.Samples.resize(frameCount * 2);
+	for (uint32_t i = 0; i < frameCount * 2; i++) {
+		chunk.Samples[i] = (int16_t)(_readBuffer[i * 2] | (_readBuffer[i * 2 + 1] << 8));
+	}
+	_readOffset += frameCount * 4;
+
+	if (frameCount == 0 || (_readOffset + 4 > _fileSize && !_loop)) {
+		chunk.EndOfTrack = true;
+		_endQueued = true;
+	}
+	return chunk;
+}
 
-	int16_t left = 0;
-	int16_t right = 0;
-	for (uint32_t i = _fileOffset; i < _fileSize && samplesRead < samplesToLoad; i += 4) {
-		ReadSample(left, right);
+void PcmReader::StreamChunk() {
+	// _fileLock must be held by the caller
+	Chunk chunk = ReadChunk();
+	auto queueLock = _queueLock.AcquireSafe();
+	_chunks.push_back(std::move(chunk));
+}
 
-		_pcmBuffer.push_back(left);
-		_pcmBuffer.push_back(right);
+size_t PcmReader::GetQueuedChunkCount() {
+	auto queueLock = _queueLock.AcquireSafe();
+	return _chunks.size();
+}
 
-		_prevLeft = left;
-		_prevRight = right;
+void PcmReader::StreamThread() {
+	while (!_stopStreaming) {
+		_streamSignal.Wait();
 
-		_fileOffset += 4;
-		samplesRead++;
+		while (!_stopStreaming) {
+			auto fileLock = _fileLock.AcquireSafe();
+			if (_endQueued || GetQueuedChunkCount() >= PcmReader::MaxQueuedChunks) {
+				break;
+			}
+			StreamChunk();
+		}
+	}
+}
 
-		if (samplesRead < samplesToLoad && i + 4 >= _fileSize) {
-			if (_loop) {
-				i = _loopOffset * 4 + 8;
-				_fileOffset = i;
-				_file.seekg(_fileOffset, ios::beg);
-			} else {
-				_done = true;
+void PcmReader::LoadSamples(uint32_t samplesToLoad) {
+	_pcmBuffer.reserve(_pcmBuffer.size() + samplesToLoad * 2);
+
+	uint32_t samplesRead = 0;
+	while (samplesRead < samplesToLoad && !_done) {
+		{
+			auto queueLock = _queueLock.AcquireSafe();
+			if (!_chunks.empty()) {
+				Chunk& chunk = _chunks.front();
+				uint32_t frameCount = (uint32_t)chunk.Samples.size() / 2;
+				uint32_t count = std::min(samplesToLoad - samplesRead, frameCount - _chunkPos);
+				_pcmBuffer.insert(_pcmBuffer.end(), chunk.Samples.begin() + _chunkPos * 2, chunk.Samples.begin() + (_chunkPos + count) * 2);
+				_chunkPos += count;
+				samplesRead += count;
+				_fileOffset = chunk.Offset + _chunkPos * 4;
+
+				if (_chunkPos >= frameCount) {
+					if (chunk.EndOfTrack) {
+						_done = true;
+					}
+					_chunks.pop_front();
+					_chunkPos = 0;
+					if (!_chunks.empty()) {
+						_fileOffset = _chunks.front().Offset;
+					}
+				}
+				continue;
 			}
 		}
+
+		// Not read ahead yet (track just started, or the disk is too slow), read it now
+		auto fileLock = _fileLock.AcquireSafe();
+		if (GetQueuedChunkCount() == 0) {
+			_missCount++;
+			StreamChunk();
+		}
 	}
+
+	// Refill the queue
+	_streamSignal.Signal();
 }
 
 void PcmReader::ApplySamples(int16_t* buffer, size_t sampleCount, uint8_t volume) {
@@ -1,43 +1,98 @@
 #pragma once
 #include "pch.h"
+#include <thread>
 #include "Utilities/Audio/stb_vorbis.h"
 #include "Utilities/Audio/HermiteResampler.h"
+#include "Utilities/SimpleLock.h"
+#include "Utilities/AutoResetEvent.h"
 
+/// <summary>
+/// Streams a MSU-1 .pcm track (44.1KHz 16-bit stereo, with a loop point) and resamples it to the output rate.
+/// </summary>
+/// <remarks>
+/// The track is opened and read by a background thread, which keeps up to MaxQueuedChunks chunks of samples
+/// decoded ahead of playback. Open() only queues the request, so switching tracks doesn't block the emulation
+/// thread on the file system.
+///
+/// When the queue is empty (track just started, or the disk can't keep up), ApplySamples() reads the next chunk
+/// itself: the output is always the same as reading the file synchronously, it doesn't depend on timing.
+///
+/// Thread safety: all public functions are called by the emulation thread only.
+/// </remarks>
 class PcmReader {
 private:
 	static constexpr int PcmSampleRate = 44100;
-	static constexpr int SamplesToRead = 100;
+	static constexpr uint32_t ChunkFrames = 4096;
+	static constexpr uint32_t MaxQueuedChunks = 8;
+
+	struct Chunk {
+		uint32_t Offset = 0;         ///< File offset of the first sample
+		vector<int16_t> Samples;     ///< Interleaved left/right samples
+		bool EndOfTrack = false;     ///< Last chunk of the track (not looping)
+	};
 
 	std::unique_ptr<int16_t[]> _outputBuffer;
 
+	// File and read position, used by both threads (_fileLock)
+	SimpleLock _fileLock;
 	ifstream _file;
-	uint32_t _fileOffset = 0;
+	string _pendingFile;
+	bool _openPending = false;
+	uint32_t _readOffset = 0;
 	uint32_t _fileSize = 0;
 	uint32_t _loopOffset = 0;
+	bool _loop = false;
+	bool _endQueued = true;
+	vector<uint8_t> _readBuffer;
 
-	int16_t _prevLeft = 0;
-	int16_t _prevRight = 0;
+	// Samples read ahead (_queueLock, always acquired after _fileLock when both are needed)
+	SimpleLock _queueLock;
+	std::deque<Chunk> _chunks;
 
-	bool _loop = false;
+	// Emulation thread only
+	uint32_t _chunkPos = 0;
+	uint32_t _fileOffset = 0;
 	bool _done = false;
+	uint32_t _missCount = 0;
 
 	HermiteResampler _resampler;
 	vector<int16_t> _pcmBuffer;
-	uint32_t _leftoverSampleCount = 0;
 
 	uint32_t _sampleRate = 0;
 
+	unique_ptr<std::thread> _streamThread;
+	AutoResetEvent _streamSignal;
+	atomic<bool> _stopStreaming = false;
+
 	void LoadSamples(uint32_t samplesToLoad);
-	void ReadSample(int16_t& left, int16_t& right);
+	void OpenFile();
+	[[nodiscard]] Chunk ReadChunk();
+	void StreamChunk();
+	[[nodiscard]] size_t GetQueuedChunkCount();
+	void StreamThread();
 
 public:
 	PcmReader();
 	~PcmReader();
 
-	bool Init(const string& filename, bool loop, uint32_t startOffset = 0);
+	PcmReader(const PcmReader&) = delete;
+	PcmReader& operator=(const PcmReader&) = delete;
+
+	/// <summary>Starts playing a track, the file is opened by the streaming thread</summary>
+	/// <param name="startOffset">File offset of the first sample to play (8 = start of the track)</param>
+	void Open(const string& filename, bool loop, uint32_t startOffset = 8);
+
+	/// <summary>Stops playback and closes the file</summary>
+	void Stop();
+
 	bool IsPlaybackOver();
 	void SetSampleRate(uint32_t sampleRate);
 	void SetLoopFlag(bool loop);
 	void ApplySamples(int16_t* buffer, size_t sampleCount, uint8_t volume);
+
+	/// <summary>File offset of the next sample to play</summary>
 	uint32_t GetOffset();
+
+	/// <summary>Number of chunks that had to be read by the emulation thread</summary>
+	[[nodiscard]] uint32_t GetMissCount() { return _missCount; }
 };
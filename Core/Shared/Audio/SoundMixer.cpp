@@ -3,21 +3,25 @@
 #include "Shared/Audio/AudioPlayerHud.h"
 #include "Shared/Emulator.h"
 #include "Shared/EmuSettings.h"
+#include "Shared/FrameProfiler.h"
 #include "Shared/Audio/SoundResampler.h"
 #include "Shared/RewindManager.h"
 #include "Shared/Video/VideoRenderer.h"
 #include "Shared/Audio/WaveRecorder.h"
+#include "Shared/SharedMemoryExport.h"
 #include "Shared/Interfaces/IAudioProvider.h"
 #include "Utilities/Audio/Equalizer.h"
 #include "Utilities/Audio/ReverbFilter.h"
 #include "Utilities/Audio/CrossFeedFilter.h"
+#include "Utilities/Audio/SampleConverter.h"
 
 SoundMixer::SoundMixer(Emulator* emu) {
 	_emu = emu;
 	_audioDevice = nullptr;
 	_resampler = std::make_unique<SoundResampler>(emu);
-	_sampleBuffer = std::make_unique<int16_t[]>(0x10000);
-	_pitchAdjustBuffer = std::make_unique<int16_t[]>(0x8000);
+	_sampleBuffer = std::make_unique<int16_t[]>(SoundMixer::SampleBufferSize);
+	_effectBuffer = std::make_unique<float[]>(SoundMixer::SampleBufferSize);
+	_pitchAdjustBuffer = std::make_unique<int16_t[]>(SoundMixer::PitchAdjustBufferSize);
 	_reverbFilter = std::make_unique<ReverbFilter>();
 	_crossFeedFilter = std::make_unique<CrossFeedFilter>();
 }
@@ -39,11 +43,16 @@ void SoundMixer::UnregisterAudioProvider(IAudioProvider* provider) {
 }
 
 AudioStatistics SoundMixer::GetStatistics() {
-	if (_audioDevice) {
-		return _audioDevice->GetStatistics();
-	} else {
-		return AudioStatistics();
+	AudioStatistics stats = _audioDevice ? _audioDevice->GetStatistics() : AudioStatistics();
+
+	shared_ptr<WaveRecorder> recorder = _waveRecorder.lock();
+	if (recorder) {
+		stats.RecordingDropCount = recorder->GetDroppedSampleCount();
 	}
+
+	stats.ResampleTime = _resampleTimes.GetPercentiles().Average;
+	stats.MixTime = _mixTimes.GetPercentiles().Average;
+	return stats;
 }
 
 void SoundMixer::StopAudio(bool clearBuffer) {
@@ -61,13 +70,20 @@ void SoundMixer::PlayAudioBuffer(int16_t* samples, uint32_t sampleCount, uint32_
 		return;
 	}
 
+	PROFILE_SCOPE(_emu->GetFrameProfiler(), ProfilerStage::Audio);
+	int64_t mixStartTime = AudioLatencyTracker::GetTimestamp();
 	EmuSettings* settings = _emu->GetSettings();
 	AudioPlayerHud* audioPlayer = _emu->GetAudioPlayerHud();
 	const AudioConfig& cfg = settings->GetAudioConfig();
 	bool isRecording = _waveRecorder || _emu->GetVideoRenderer()->IsRecording();
+	bool isExporting = _emu->IsSharedMemoryExportActive();
+	if (!_audioDevice && !isRecording && !isExporting && _emu->IsHeadless()) {
+		// Nothing would ever play or store the mixed audio
+		return;
+	}
 
 	uint32_t masterVolume = audioPlayer ? audioPlayer->GetVolume() : cfg.MasterVolume;
-	if (!isRecording) {
+	if (!isRecording && !isExporting) {
 		if (!audioPlayer && settings->CheckFlag(EmulationFlags::InBackground)) {
 			if (cfg.MuteSoundInBackground) {
 				masterVolume = 0;
@@ -83,34 +99,42 @@ void SoundMixer::PlayAudioBuffer(int16_t* samples, uint32_t sampleCount, uint32_
 	_rightSample = samples[1];
 
 	int16_t* out = _sampleBuffer.get();
-	uint32_t count = _resampler->Resample(samples, sampleCount, sourceRate, cfg.SampleRate, out, 0x10000 / 2);
+	uint32_t count = _resampler->Resample(samples, sampleCount, sourceRate, cfg.SampleRate, out, SoundMixer::SampleBufferSize / 2);
+	_resampleTimes.Add((uint32_t)(AudioLatencyTracker::GetTimestamp() - mixStartTime));
 
 	uint32_t targetRate = (uint32_t)(cfg.SampleRate * _resampler->GetRateAdjustment());
 	for (IAudioProvider* provider : _audioProviders) {
 		provider->MixAudio(out, count, targetRate);
 	}
 
-	if (cfg.EnableEqualizer) {
-		ProcessEqualizer(out, count, targetRate);
+	bool reverbActive = cfg.ReverbEnabled && cfg.ReverbStrength > 0;
+	if (cfg.ReverbEnabled && !reverbActive) {
+		_reverbFilter->ResetFilter();
 	}
 
-	if (audioPlayer) {
-		audioPlayer->ProcessSamples(out, count, targetRate);
-	}
+	if (cfg.EnableEqualizer || audioPlayer || reverbActive || cfg.CrossFeedEnabled) {
+		// Run every effect on one float copy of the block, with a single clamp back to int16
+		float* effectOut = _effectBuffer.get();
+		SampleConverter::ToFloat(out, effectOut, count * 2);
 
-	if (cfg.ReverbEnabled) {
-		if (cfg.ReverbStrength > 0) {
-			_reverbFilter->ApplyFilter(out, count, cfg.SampleRate, cfg.ReverbStrength / 10.0, cfg.ReverbDelay / 10.0);
-		} else {
-			_reverbFilter->ResetFilter();
+		if (cfg.EnableEqualizer) {
+			ProcessEqualizer(effectOut, count, targetRate);
 		}
-	}
 
-	if (cfg.CrossFeedEnabled) {
-		_crossFeedFilter->ApplyFilter(out, count, cfg.CrossFeedRatio);
-	}
+		if (audioPlayer) {
+			audioPlayer->ProcessSamples(effectOut, count, targetRate);
+		}
 
-	if (masterVolume < 100) {
+		if (reverbActive) {
+			_reverbFilter->ApplyFilter(effectOut, count, cfg.SampleRate, cfg.ReverbStrength / 10.0, cfg.ReverbDelay / 10.0);
+		}
+
+		if (cfg.CrossFeedEnabled) {
+			_crossFeedFilter->ApplyFilter(effectOut, count, cfg.CrossFeedRatio);
+		}
+
+		SampleConverter::ToInt16(effectOut, out, count * 2, masterVolume / 100.0f);
+	} else if (masterVolume < 100) {
 		// Apply volume if not using the default value
 		for (uint32_t i = 0; i < count * 2; i++) {
 			out[i] = (int32_t)out[i] * (int32_t)masterVolume / 100;
@@ -129,6 +153,13 @@ void SoundMixer::PlayAudioBuffer(int16_t* samples, uint32_t sampleCount, uint32_
 			_emu->GetVideoRenderer()->AddRecordingSound(out, count, cfg.SampleRate);
 		}
 
+		if (isExporting) {
+			shared_ptr<SharedMemoryExport> sharedExport = _emu->GetSharedMemoryExport();
+			if (sharedExport) {
+				sharedExport->PublishAudio(out, count, cfg.SampleRate);
+			}
+		}
+
 		// Only send the audio to the device if the emulation is running
 		//(this is to prevent playing an audio blip when loading a save state)
 		if (!_emu->IsPaused() && _audioDevice) {
@@ -144,14 +175,16 @@ void SoundMixer::PlayAudioBuffer(int16_t* samples, uint32_t sampleCount, uint32_
 						// < 100%: stretch samples (slow motion), > 100%: compress samples (fast forward)
 						// This prevents buffer overflow at turbo speed and underflow at slow speed
 						_pitchAdjust.SetSampleRates(targetRate, targetRate * 100.0 / emulationSpeed);
-						count = _pitchAdjust.Resample<false>(_sampleBuffer.get(), count, _pitchAdjustBuffer.get(), 0x8000 / 2);
+						count = _pitchAdjust.Resample<false>(_sampleBuffer.get(), count, _pitchAdjustBuffer.get(), SoundMixer::PitchAdjustBufferSize / 2);
 						if (count >= 0x4000) {
 							// Mute when buffer overflow from extreme speed differential
-							memset(_pitchAdjustBuffer.get(), 0, 0x8000 * sizeof(int16_t));
+							memset(_pitchAdjustBuffer.get(), 0, SoundMixer::PitchAdjustBufferSize * sizeof(int16_t));
 						}
 						out = _pitchAdjustBuffer.get();
 					}
 
+					_mixTimes.Add((uint32_t)(AudioLatencyTracker::GetTimestamp() - mixStartTime));
+					_audioDevice->SetMixStartTime(mixStartTime);
 					_audioDevice->PlayBuffer(out, count, cfg.SampleRate, true);
 					_audioDevice->ProcessEndOfFrame();
 				}
@@ -162,7 +195,7 @@ void SoundMixer::PlayAudioBuffer(int16_t* samples, uint32_t sampleCount, uint32_
 	}
 }
 
-void SoundMixer::ProcessEqualizer(int16_t* samples, uint32_t sampleCount, uint32_t targetRate) {
+void SoundMixer::ProcessEqualizer(float* samples, uint32_t sampleCount, uint32_t targetRate) {
 	const AudioConfig& cfg = _emu->GetSettings()->GetAudioConfig();
 	if (!_equalizer) {
 		_equalizer = std::make_unique<Equalizer>();
@@ -198,3 +231,7 @@ void SoundMixer::GetLastSamples(int16_t& left, int16_t& right) {
 	left = _leftSample;
 	right = _rightSample;
 }
+
+void SoundMixer::ReportMemoryUsage(MemoryUsageNode& node) {
+	node.Add("Mixing buffers", SoundMixer::SampleBufferSize * (sizeof(int16_t) + sizeof(float)) + SoundMixer::PitchAdjustBufferSize * sizeof(int16_t));
+}
@@ -1,8 +1,10 @@
 #pragma once
 #include "pch.h"
 #include "Core/Shared/Interfaces/IAudioDevice.h"
+#include "Core/Shared/Interfaces/IMemoryUsageReporter.h"
 #include "Utilities/safe_ptr.h"
 #include "Utilities/Audio/HermiteResampler.h"
+#include "Core/Shared/Audio/AudioLatencyTracker.h"
 
 class Emulator;
 class Equalizer;
@@ -20,7 +22,8 @@ class ReverbFilter;
 /// Architecture:
 /// - Multi-source mixing (combines NES/SNES/PCE/etc. audio channels)
 /// - Hermite resampling for pitch adjustment (turbo mode, speed changes)
-/// - Effect chain: Equalizer → CrossFeed → Reverb
+/// - Effect chain: Equalizer → Reverb → CrossFeed → volume, on a float copy of the block
+///   converted back to int16 (with a single clamp) at the end
 ///
 /// Audio sources (IAudioProvider):
 /// - APU (Audio Processing Unit) from each console
@@ -46,8 +49,11 @@ class ReverbFilter;
 /// - safe_ptr guards recorder lifecycle
 /// - Providers register/unregister from different threads
 /// </remarks>
-class SoundMixer {
+class SoundMixer : public IMemoryUsageReporter {
 private:
+	static constexpr uint32_t SampleBufferSize = 0x10000;
+	static constexpr uint32_t PitchAdjustBufferSize = 0x8000;
+
 	IAudioDevice* _audioDevice;
 	vector<IAudioProvider*> _audioProviders;
 	Emulator* _emu;
@@ -55,6 +61,7 @@ private:
 	unique_ptr<SoundResampler> _resampler;
 	safe_ptr<WaveRecorder> _waveRecorder;
 	std::unique_ptr<int16_t[]> _sampleBuffer;
+	std::unique_ptr<float[]> _effectBuffer;
 
 	HermiteResampler _pitchAdjust;
 	std::unique_ptr<int16_t[]> _pitchAdjustBuffer;
@@ -65,7 +72,10 @@ private:
 	unique_ptr<CrossFeedFilter> _crossFeedFilter;
 	unique_ptr<ReverbFilter> _reverbFilter;
 
-	void ProcessEqualizer(int16_t* samples, uint32_t sampleCount, uint32_t targetRate);
+	LatencyWindow _resampleTimes;
+	LatencyWindow _mixTimes;
+
+	void ProcessEqualizer(float* samples, uint32_t sampleCount, uint32_t targetRate);
 
 public:
 	SoundMixer(Emulator* emu);
@@ -86,4 +96,7 @@ public:
 	void StopRecording();
 	bool IsRecording();
 	void GetLastSamples(int16_t& left, int16_t& right);
+
+	/// <summary>Report the mixing buffers (IMemoryUsageReporter)</summary>
+	void ReportMemoryUsage(MemoryUsageNode& node) override;
 };
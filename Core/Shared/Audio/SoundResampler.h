@@ -1,6 +1,9 @@
 #pragma once
 #include "pch.h"
 #include "Utilities/Audio/HermiteResampler.h"
+#include "Utilities/Audio/SincResampler.h"
+#include "Utilities/Audio/AudioRateController.h"
+#include "Shared/SettingTypes.h"
 
 class Emulator;
 
@@ -11,12 +14,16 @@ private:
 	double _rateAdjustment = 1.0;
 	double _previousTargetRate = 0;
 	double _prevInputRate = 0;
-	int32_t _underTarget = 0;
+
+	AudioRateController _rateController;
+	AudioResamplerQuality _quality = AudioResamplerQuality::Standard;
 
 	HermiteResampler _resampler;
+	unique_ptr<SincResampler> _sincResampler;
 
-	double GetTargetRateAdjustment();
-	void UpdateTargetSampleRate(uint32_t sourceRate, uint32_t sampleRate);
+	double GetTargetRateAdjustment(double elapsed);
+	void UpdateQuality(AudioResamplerQuality quality);
+	void UpdateTargetSampleRate(uint32_t sourceRate, uint32_t sampleRate, double elapsed);
 
 public:
 	SoundResampler(Emulator* emu);
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "Shared/Audio/WaveRecorder.h"
 #include "Shared/MessageManager.h"
+#include "Utilities/Timer.h"
 
 WaveRecorder::WaveRecorder(const string& outputFile, uint32_t sampleRate, bool isStereo) {
 	_stream = ofstream(outputFile, ios::out | ios::binary);
@@ -11,6 +12,8 @@ WaveRecorder::WaveRecorder(const string& outputFile, uint32_t sampleRate, bool i
 
 	if (_stream) {
 		WriteHeader();
+		_buffer.Reset(WaveRecorder::BufferSize);
+		_writerThread = std::thread(&WaveRecorder::WriterLoop, this);
 		MessageManager::DisplayMessage("SoundRecorder", "SoundRecorderStarted", _outputFile);
 	}
 }
@@ -53,11 +56,46 @@ bool WaveRecorder::WriteSamples(int16_t* samples, uint32_t sampleCount, uint32_t
 	if (_sampleRate != sampleRate || _isStereo != isStereo) {
 		// Format changed, stop recording
 		return false;
-	} else {
+	} else if (_writerThread.joinable()) {
 		uint32_t sampleBytes = sampleCount * (isStereo ? 4 : 2);
-		_stream.write((char*)samples, sampleBytes);
-		_streamSize += sampleBytes;
-		return true;
+		if (_buffer.GetCapacity() - _buffer.GetFillLevel() >= sampleBytes) {
+			_buffer.Write((uint8_t*)samples, sampleBytes);
+			_writerSignal.notify_one();
+		} else {
+			// Drop the whole block rather than a part of it, so the file stays aligned on samples
+			_droppedSampleCount += sampleCount;
+		}
+	}
+	return true;
+}
+
+void WaveRecorder::WriterLoop() {
+	vector<uint8_t> chunk(64 * 1024);
+	Timer headerTimer;
+	bool stopping = false;
+
+	while (!stopping) {
+		{
+			std::unique_lock<std::mutex> lock(_writerLock);
+			_writerSignal.wait_for(lock, std::chrono::milliseconds(100), [this]() {
+				return _stopWriter || _buffer.GetFillLevel() >= 64 * 1024;
+			});
+			stopping = _stopWriter;
+		}
+
+		// Once stopping, this also writes everything that was queued before the stop request
+		while (uint32_t len = _buffer.Read(chunk.data(), (uint32_t)chunk.size())) {
+			_stream.write((char*)chunk.data(), len);
+			_streamSize += len;
+		}
+
+		if (!stopping && headerTimer.GetElapsedMS() >= WaveRecorder::HeaderUpdateDelay) {
+			// Keep the header's sizes up to date, so the file is still usable if the recording isn't closed properly
+			UpdateSizeValues();
+			_stream.seekp(0, ios::end);
+			_stream.flush();
+			headerTimer.Reset();
+		}
 	}
 }
 
@@ -71,6 +109,15 @@ void WaveRecorder::UpdateSizeValues() {
 }
 
 void WaveRecorder::CloseFile() {
+	if (_writerThread.joinable()) {
+		{
+			std::lock_guard<std::mutex> lock(_writerLock);
+			_stopWriter = true;
+		}
+		_writerSignal.notify_one();
+		_writerThread.join();
+	}
+
 	if (_stream && _stream.is_open()) {
 		UpdateSizeValues();
 		_stream.close();
@@ -1,4 +1,9 @@
 #include "pch.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "Shared/Audio/AudioRingBuffer.h"
 
 /// <summary>
 /// WAV file recorder for audio capture to disk.
@@ -12,24 +17,39 @@
 /// - Sample rate configurable (typically 48000 Hz)
 ///
 /// File lifecycle:
-/// 1. Constructor creates file and writes initial header
-/// 2. WriteSamples() appends sample data
-/// 3. Destructor/CloseFile() updates header with final size
+/// 1. Constructor creates file, writes initial header and starts the writer thread
+/// 2. WriteSamples() queues sample data, the writer thread appends it to the file
+/// 3. The header's sizes are updated about once per second (the file stays valid if the process dies)
+/// 4. Destructor/CloseFile() writes the remaining data and updates header with final size
+///
+/// Disk writes never block the caller: samples go through a lock-free ring buffer
+/// (~20 seconds of audio) and are dropped (and counted) if the disk can't keep up.
 ///
 /// Thread safety:
-/// - Not thread-safe, caller must synchronize
+/// - WriteSamples must only be called from one thread at a time
 /// - Used via safe_ptr in SoundMixer for protection
 /// </remarks>
 class WaveRecorder {
 private:
+	static constexpr uint32_t BufferSize = 4 * 1024 * 1024;
+	static constexpr uint32_t HeaderUpdateDelay = 1000; ///< In ms
+
 	std::ofstream _stream;
 	uint32_t _streamSize;
 	uint32_t _sampleRate;
 	bool _isStereo;
 	string _outputFile;
 
+	AudioRingBuffer _buffer;
+	std::thread _writerThread;
+	std::mutex _writerLock;
+	std::condition_variable _writerSignal;
+	std::atomic<bool> _stopWriter{false};
+	std::atomic<uint32_t> _droppedSampleCount{0};
+
 	void WriteHeader();
 	void UpdateSizeValues();
+	void WriterLoop();
 	void CloseFile();
 
 public:
@@ -37,4 +57,7 @@ public:
 	~WaveRecorder();
 
 	bool WriteSamples(int16_t* samples, uint32_t sampleCount, uint32_t sampleRate, bool isStereo);
+
+	/// <summary>Number of samples (frames) lost because the disk could not keep up</summary>
+	[[nodiscard]] uint32_t GetDroppedSampleCount() const { return _droppedSampleCount; }
 };
@@ -138,6 +138,7 @@ void BaseControlManager::ClearDevices() {
 
 void BaseControlManager::UpdateInputState() {
 	KeyManager::RefreshKeyState();
+	KeyManager::OnInputPolled();
 
 	auto lock = _deviceLock.AcquireSafe();
 
@@ -3,8 +3,22 @@
 #include "Utilities/VirtualFile.h"
 #include "Utilities/FolderUtilities.h"
 #include "Utilities/StringUtilities.h"
+#include "Utilities/PathUtil.h"
+
+BatteryManager::~BatteryManager() {
+	{
+		std::lock_guard<std::mutex> lock(_writeMutex);
+		_stopWriteThread = true;
+	}
+	_writeCv.notify_one();
+	if (_writeThread.joinable()) {
+		_writeThread.join();
+	}
+}
 
 void BatteryManager::Initialize(const string& romName, bool setBatteryFlag) {
+	WaitForPendingWrites();
+	_writtenData.clear();
 	_romName = romName;
 	_hasBattery = setBatteryFlag;
 }
@@ -40,10 +54,106 @@ void BatteryManager::SaveBattery(const string& extension, std::span<const uint8_
 	}
 
 	_hasBattery = true;
-	ofstream out(GetBasePath(extension), ios::binary);
-	if (out) {
+	string path = GetBasePath(extension);
+	if (!_flushing) {
+		// An older background write of the same file must not land after this one
+		WaitForPendingWrites();
+		UpdateWrittenData(path, data);
+		WriteFileAtomic(path, data);
+		return;
+	}
+
+	if (!UpdateWrittenData(path, data)) {
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_writeMutex);
+		if (!_writeThread.joinable()) {
+			_writeThread = std::thread([this]() { WriteLoop(); });
+		}
+		// Only the last queued content of a file matters
+		auto existing = std::find_if(_pendingWrites.begin(), _pendingWrites.end(), [&](const PendingWrite& write) { return write.Path == path; });
+		if (existing != _pendingWrites.end()) {
+			existing->Data = _writtenData[path];
+		} else {
+			_pendingWrites.push_back({path, _writtenData[path]});
+		}
+	}
+	_writeCv.notify_one();
+}
+
+bool BatteryManager::UpdateWrittenData(const string& path, std::span<const uint8_t> data) {
+	vector<uint8_t>& written = _writtenData[path];
+	if (written.size() != data.size()) {
+		written.assign(data.begin(), data.end());
+		return true;
+	}
+
+	// Only copy the pages that changed since the last write
+	bool changed = false;
+	for (size_t offset = 0; offset < data.size(); offset += FlushPageSize) {
+		size_t size = std::min<size_t>(FlushPageSize, data.size() - offset);
+		if (memcmp(written.data() + offset, data.data() + offset, size) != 0) {
+			memcpy(written.data() + offset, data.data() + offset, size);
+			changed = true;
+		}
+	}
+	return changed;
+}
+
+void BatteryManager::WaitForPendingWrites() {
+	std::unique_lock<std::mutex> lock(_writeMutex);
+	_writeDoneCv.wait(lock, [this] { return _pendingWrites.empty() && !_writing; });
+}
+
+void BatteryManager::WriteLoop() {
+	while (true) {
+		PendingWrite write;
+		{
+			std::unique_lock<std::mutex> lock(_writeMutex);
+			_writeCv.wait(lock, [this] { return _stopWriteThread || !_pendingWrites.empty(); });
+			if (_pendingWrites.empty()) {
+				return;
+			}
+			write = std::move(_pendingWrites.front());
+			_pendingWrites.pop_front();
+			_writing = true;
+		}
+
+		WriteFileAtomic(write.Path, write.Data);
+
+		{
+			std::lock_guard<std::mutex> lock(_writeMutex);
+			_writing = false;
+		}
+		_writeDoneCv.notify_all();
+	}
+}
+
+bool BatteryManager::WriteFileAtomic(const string& path, std::span<const uint8_t> data) {
+	string tmpPath = path + ".tmp";
+	{
+		ofstream out(tmpPath, ios::binary);
+		if (!out) {
+			return false;
+		}
 		out.write(reinterpret_cast<const char*>(data.data()), data.size());
+		out.close();
+		if (out.fail()) {
+			std::error_code ec;
+			fs::remove(PathUtil::FromUtf8(tmpPath), ec);
+			return false;
+		}
+	}
+
+	std::error_code ec;
+	fs::rename(PathUtil::FromUtf8(tmpPath), PathUtil::FromUtf8(path), ec);
+	if (ec) {
+		fs::remove(PathUtil::FromUtf8(tmpPath), ec);
+		return false;
 	}
+	return true;
 }
 
 vector<uint8_t> BatteryManager::LoadBattery(const string& extension) {
@@ -1,5 +1,9 @@
 #pragma once
 #include "pch.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 
 /// <summary>
 /// Interface for custom battery (save data) loading providers.
@@ -35,9 +39,37 @@ public:
 /// Battery data is typically stored as .sav files in the same directory as the ROM.
 /// Supports custom providers for alternative storage (network, archives, etc.).
 /// Uses weak_ptr to avoid circular dependencies with emulator core.
+///
+/// Files are written atomically (to a temporary file, renamed over the previous one), so a crash never
+/// leaves a truncated save. The emulator can also flush the save data periodically (see BeginFlush): during a
+/// flush, SaveBattery() only copies the pages that changed since the last write and queues the file for a
+/// background thread, so the emulation thread never waits for the disk.
 /// </remarks>
 class BatteryManager {
+public:
+	static constexpr uint32_t FlushPageSize = 4096;
+
 private:
+	struct PendingWrite {
+		string Path;
+		vector<uint8_t> Data;
+	};
+
+	/// <summary>Content of each battery file, as of its last write (used to find the changed pages when flushing)</summary>
+	std::unordered_map<string, vector<uint8_t>> _writtenData;
+	bool _flushing = false;
+
+	std::thread _writeThread;
+	std::mutex _writeMutex;
+	std::condition_variable _writeCv;
+	std::condition_variable _writeDoneCv;
+	std::deque<PendingWrite> _pendingWrites;
+	bool _writing = false;
+	bool _stopWriteThread = false;
+
+	void WriteLoop();
+
+
 	string _romName;          ///< ROM name for constructing save file paths
 	string _perRomSaveDir;    ///< Per-ROM save directory override (set by C# GameDataManager on ROM load)
 	bool _hasBattery = false; ///< Battery-backed save flag
@@ -52,7 +84,12 @@ private:
 	/// <returns>Full path to battery file</returns>
 	string GetBasePath(const string& extension);
 
+	/// <summary>Updates the copy of the last written data, returns false if nothing changed</summary>
+	bool UpdateWrittenData(const string& path, std::span<const uint8_t> data);
+
 public:
+	~BatteryManager();
+
 	/// <summary>
 	/// Initialize battery manager with ROM name.
 	/// </summary>
@@ -99,6 +136,19 @@ public:
 	/// </remarks>
 	void SaveBattery(const string& extension, std::span<const uint8_t> data);
 
+	/// <summary>
+	/// Starts a background flush: until EndFlush(), SaveBattery() queues the files whose content changed
+	/// since they were last written, instead of writing them (call IConsole::SaveBattery() in between)
+	/// </summary>
+	void BeginFlush() { _flushing = true; }
+	void EndFlush() { _flushing = false; }
+
+	/// <summary>Waits until the files queued by the background flushes are written</summary>
+	void WaitForPendingWrites();
+
+	/// <summary>Writes a file to a temporary file, then renames it over the previous one</summary>
+	static bool WriteFileAtomic(const string& path, std::span<const uint8_t> data);
+
 	/// <summary>
 	/// Load battery data from file into new vector.
 	/// </summary>
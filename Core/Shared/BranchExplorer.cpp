@@ -0,0 +1,242 @@
+#include "pch.h"
+#include "Shared/BranchExplorer.h"
+#include "Shared/Emulator.h"
+#include "Shared/EmuSettings.h"
+#include "Shared/BatteryManager.h"
+#include "Shared/CheatManager.h"
+#include "Shared/SaveStateManager.h"
+#include "Shared/BaseControlManager.h"
+#include "Shared/BaseControlDevice.h"
+#include "Shared/RunAheadSnapshot.h"
+#include "Shared/Interfaces/IConsole.h"
+#include "Shared/Interfaces/IInputProvider.h"
+#include "Utilities/FastHash.h"
+#include "Utilities/StringUtilities.h"
+
+/// <summary>Headless emulator and the input of the branch it is running</summary>
+struct BranchExplorer::Worker : public IInputProvider {
+	unique_ptr<Emulator> Emu;
+	BaseControlManager* ControlManager = nullptr;
+	RunAheadState Start;
+
+	vector<string_view> Lines;
+	uint32_t FirstPoll = 0;
+	uint32_t LastFrame = 0;
+	uint32_t DeviceIndex = 0;
+
+	void SetSequence(const string& sequence) {
+		Lines.clear();
+		string_view text = sequence;
+		while (!text.empty()) {
+			size_t end = text.find('\n');
+			string_view line = text.substr(0, end);
+			text = end == string_view::npos ? string_view() : text.substr(end + 1);
+
+			if (!line.empty() && line.back() == '\r') {
+				line.remove_suffix(1);
+			}
+			if (!line.empty() && line.front() == '|') {
+				// Movie format, the line starts with a separator
+				line.remove_prefix(1);
+			}
+			Lines.push_back(line);
+		}
+
+		FirstPoll = ControlManager->GetPollCounter();
+		LastFrame = ~0u;
+		DeviceIndex = 0;
+	}
+
+	bool SetInput(BaseControlDevice* device) override {
+		uint32_t frame = ControlManager->GetPollCounter() - FirstPoll;
+		if (frame != LastFrame) {
+			LastFrame = frame;
+			DeviceIndex = 0;
+		}
+
+		if (frame < Lines.size()) {
+			device->SetTextState(StringUtilities::GetNthSegmentView(Lines[frame], '|', DeviceIndex));
+		} else {
+			// Past the end of the branch's input (extra frames)
+			device->ClearState();
+		}
+		DeviceIndex++;
+		return true;
+	}
+};
+
+BranchExplorer::BranchExplorer() {
+}
+
+BranchExplorer::~BranchExplorer() {
+	Release();
+}
+
+bool BranchExplorer::InitWorker(Worker& worker, Emulator* mainEmu, const vector<uint8_t>& state) {
+	if (!worker.Emu) {
+		worker.Emu = std::make_unique<Emulator>();
+		worker.Emu->Initialize(false);
+		worker.Emu->GetSettings()->CopySettings(*mainEmu->GetSettings());
+
+		// Disable rewind history to reduce memory usage
+		worker.Emu->GetSettings()->GetPreferences().RewindBufferSize = 0;
+
+		// Not stopping a previous game: the emulation thread isn't started, Run() drives the worker
+		if (!worker.Emu->LoadRom(_romFile, _patchFile, false)) {
+			return false;
+		}
+
+		// Disable battery saving for this instance
+		worker.Emu->GetBatteryManager()->Initialize("");
+
+		worker.ControlManager = worker.Emu->_console->GetControlManager();
+		worker.Emu->RegisterInputProvider(&worker);
+	}
+
+	Emulator* emu = worker.Emu.get();
+	emu->GetCheatManager()->SetCheats(mainEmu->GetCheatManager()->GetCheats());
+	if (emu->Deserialize(state, SaveStateManager::FileFormatVersion, std::nullopt, false) != DeserializeResult::Success) {
+		return false;
+	}
+
+	emu->SaveRunAheadState(worker.Start);
+	return true;
+}
+
+bool BranchExplorer::Initialize(Emulator* mainEmu, uint32_t workerCount) {
+	if (workerCount == 0) {
+		workerCount = std::max(1u, std::thread::hardware_concurrency());
+	}
+
+	vector<uint8_t> state;
+	string romFile;
+	string patchFile;
+	{
+		auto lock = mainEmu->AcquireLock();
+		if (!mainEmu->IsRunning()) {
+			return false;
+		}
+		state = mainEmu->SerializeToBuffer();
+		romFile = (string)mainEmu->GetRomInfo().RomFile;
+		patchFile = (string)mainEmu->GetRomInfo().PatchFile;
+	}
+
+	if (romFile != _romFile || patchFile != _patchFile) {
+		Release();
+		_romFile = romFile;
+		_patchFile = patchFile;
+	}
+
+	while (_workers.size() > workerCount) {
+		if (_workers.back()->Emu) {
+			_workers.back()->Emu->Release();
+		}
+		_workers.pop_back();
+	}
+	while (_workers.size() < workerCount) {
+		_workers.push_back(std::make_unique<Worker>());
+	}
+
+	// Loading the game is the slow part, load every worker in parallel
+	atomic<bool> success = true;
+	vector<std::thread> threads;
+	threads.reserve(_workers.size());
+	for (unique_ptr<Worker>& worker : _workers) {
+		threads.emplace_back([&, w = worker.get()]() {
+			if (!InitWorker(*w, mainEmu, state)) {
+				success = false;
+			}
+		});
+	}
+	for (std::thread& t : threads) {
+		t.join();
+	}
+
+	if (!success) {
+		Release();
+	}
+	return success;
+}
+
+void BranchExplorer::RunBranch(Worker& worker, const string& sequence, const vector<BranchWatch>& watches, uint32_t extraFrames, BranchResult& result) {
+	Emulator* emu = worker.Emu.get();
+	emu->LoadRunAheadState(worker.Start);
+	worker.SetSequence(sequence);
+
+	uint32_t frameCount = 0;
+	uint32_t framesWithoutPoll = 0;
+	uint32_t polled = 0;
+	while (polled < worker.Lines.size() && framesWithoutPoll < BranchExplorer::MaxFramesWithoutPoll) {
+		emu->_console->RunFrame();
+		frameCount++;
+
+		uint32_t newPolled = worker.ControlManager->GetPollCounter() - worker.FirstPoll;
+		framesWithoutPoll = newPolled == polled ? framesWithoutPoll + 1 : 0;
+		polled = newPolled;
+	}
+
+	for (uint32_t i = 0; i < extraFrames; i++) {
+		emu->_console->RunFrame();
+		frameCount++;
+	}
+
+	result.Values.clear();
+	for (const BranchWatch& watch : watches) {
+		ConsoleMemoryInfo memory = emu->GetMemory(watch.Type);
+		uint8_t* data = (uint8_t*)memory.Memory;
+		for (uint32_t i = 0; i < watch.Length; i++) {
+			uint64_t address = (uint64_t)watch.Address + i;
+			result.Values.push_back(data && address < memory.Size ? data[address] : 0);
+		}
+	}
+	result.Hash = FastHash::Hash(result.Values.data(), result.Values.size());
+	result.FrameCount = frameCount;
+}
+
+vector<BranchResult> BranchExplorer::Run(const vector<string>& sequences, const vector<BranchWatch>& watches, uint32_t extraFrames) {
+	if (_workers.empty()) {
+		return {};
+	}
+
+	vector<BranchResult> results(sequences.size());
+	atomic<uint32_t> nextBranch = 0;
+	auto work = [&](Worker& worker) {
+		Emulator* emu = worker.Emu.get();
+		auto lock = emu->_runLock.AcquireSafe();
+
+		// This thread acts as the worker's emulation thread, every frame is run without audio/video
+		emu->_emulationThreadId = std::this_thread::get_id();
+		emu->_isRunAheadFrame = true;
+
+		uint32_t i;
+		while ((i = nextBranch++) < sequences.size()) {
+			RunBranch(worker, sequences[i], watches, extraFrames, results[i]);
+		}
+
+		emu->LoadRunAheadState(worker.Start);
+		emu->_isRunAheadFrame = false;
+		emu->_emulationThreadId = thread::id();
+	};
+
+	uint32_t threadCount = std::min<uint32_t>((uint32_t)_workers.size(), (uint32_t)sequences.size());
+	vector<std::thread> threads;
+	threads.reserve(threadCount);
+	for (uint32_t i = 0; i < threadCount; i++) {
+		threads.emplace_back(work, std::ref(*_workers[i]));
+	}
+	for (std::thread& t : threads) {
+		t.join();
+	}
+	return results;
+}
+
+void BranchExplorer::Release() {
+	for (unique_ptr<Worker>& worker : _workers) {
+		if (worker->Emu) {
+			worker->Emu->Release();
+		}
+	}
+	_workers.clear();
+	_romFile.clear();
+	_patchFile.clear();
+}
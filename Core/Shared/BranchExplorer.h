@@ -0,0 +1,68 @@
+#pragma once
+#include "pch.h"
+#include "Shared/MemoryType.h"
+
+class Emulator;
+
+/// <summary>Memory range read after each branch (see BranchExplorer::Run)</summary>
+struct BranchWatch {
+	MemoryType Type;
+	uint32_t Address;
+	uint32_t Length;
+};
+
+/// <summary>Memory values at the end of a branch</summary>
+struct BranchResult {
+	vector<uint8_t> Values; ///< Content of every watched range, in order (0 past the end of a memory type)
+	uint64_t Hash = 0;      ///< FastHash of Values
+	uint32_t FrameCount = 0; ///< Frames emulated for this branch
+};
+
+/// <summary>
+/// Brute-forces input sequences (RNG manipulation, frame-perfect searches) from a common starting
+/// state, on headless clones of the emulator running in parallel.
+/// </summary>
+/// <remarks>
+/// Initialize() loads the main emulator's game and state into one worker emulator per thread. The
+/// workers have no emulation thread: Run() drives them from its own threads, one branch at a time,
+/// restoring the starting state with the run-ahead serializer (RunAheadState) before each branch and
+/// running every frame with audio/video skipped.
+///
+/// A branch is a list of input frames in the movie format (one line per input frame, the state of each
+/// device separated by '|', e.g from a movie's Input.txt), applied to the controllers in polling order.
+/// Once the input runs out, extraFrames more frames are run with no buttons pressed, then the watched
+/// memory ranges are copied into the branch's result.
+///
+/// Thread safety: Initialize(), Run() and Release() are not reentrant (call them from a single thread).
+/// </remarks>
+class BranchExplorer {
+private:
+	struct Worker;
+
+	static constexpr uint32_t MaxFramesWithoutPoll = 600; ///< Give up on a branch when the game stops polling input
+
+	vector<unique_ptr<Worker>> _workers;
+	string _romFile;
+	string _patchFile;
+
+	bool InitWorker(Worker& worker, Emulator* mainEmu, const vector<uint8_t>& state);
+	void RunBranch(Worker& worker, const string& sequence, const vector<BranchWatch>& watches, uint32_t extraFrames, BranchResult& result);
+
+public:
+	BranchExplorer();
+	~BranchExplorer();
+
+	/// <summary>Clone the main emulator's current state into the workers (reloads the game only if it changed)</summary>
+	/// <param name="workerCount">Number of workers/threads, 0 = one per core</param>
+	/// <returns>False if the game couldn't be loaded or the state couldn't be loaded by the workers</returns>
+	bool Initialize(Emulator* mainEmu, uint32_t workerCount);
+
+	/// <summary>Run every branch from the starting state, spread over the workers</summary>
+	/// <returns>One result per sequence (empty if not initialized)</returns>
+	vector<BranchResult> Run(const vector<string>& sequences, const vector<BranchWatch>& watches, uint32_t extraFrames);
+
+	[[nodiscard]] uint32_t GetWorkerCount() const { return (uint32_t)_workers.size(); }
+
+	/// <summary>Unload the workers</summary>
+	void Release();
+};
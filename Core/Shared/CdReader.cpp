@@ -29,11 +29,49 @@ struct CueFileEntry {
 };
 
 bool CdReader::LoadCue(VirtualFile& cueFile, DiscInfo& disc) {
-	vector<CueFileEntry> files;
-
 	stringstream ss;
 	(void)cueFile.ReadFile(ss);
 
+	if (!ParseCue(ss, cueFile, disc)) {
+		return false;
+	}
+
+	LoadSubcodeFile(cueFile, disc);
+	disc.SectorCache = std::make_shared<CdSectorCache>(disc);
+
+	return disc.Tracks.size() > 0;
+}
+
+bool CdReader::LoadCompressedDisc(VirtualFile& file, DiscInfo& disc) {
+	if (file.IsArchive()) {
+		MessageManager::Log("[NCD] Compressed disc images can't be loaded from archives");
+		return false;
+	}
+
+	shared_ptr<CompressedDiscImage> image = std::make_shared<CompressedDiscImage>();
+	if (!image->Open(file.GetFilePath())) {
+		return false;
+	}
+
+	disc.Image = image;
+	stringstream ss(image->GetCue());
+	if (!ParseCue(ss, file, disc)) {
+		return false;
+	}
+
+	if (image->HasSubcode()) {
+		vector<uint8_t> subCode((size_t)image->GetFileSize(image->GetSubcodeFileIndex()));
+		subCode.resize(image->Read(image->GetSubcodeFileIndex(), 0, subCode.data(), (uint32_t)subCode.size()));
+		DecodeSubcode(subCode, disc);
+	}
+	disc.SectorCache = std::make_shared<CdSectorCache>(disc);
+
+	return disc.Tracks.size() > 0;
+}
+
+bool CdReader::ParseCue(std::istream& ss, VirtualFile& cueFile, DiscInfo& disc) {
+	vector<CueFileEntry> files;
+
 	string line;
 	while (std::getline(ss, line)) {
 		line = StringUtilities::TrimLeft(StringUtilities::TrimRight(line));
@@ -155,10 +193,18 @@ bool CdReader::LoadCue(VirtualFile& cueFile, DiscInfo& disc) {
 
 	uint32_t totalPregapLbaLength = 0;
 	for (size_t i = 0; i < files.size(); i++) {
-		VirtualFile physicalFile = files[i].Filename;
-		if (!physicalFile.IsValid()) {
-			MessageManager::Log("[CUE] Missing or invalid file: " + files[i].Filename);
-			return false;
+		if (disc.Image) {
+			// The files are stored in the image in the same order as in the CUE sheet
+			if (i >= disc.Image->GetTrackFileCount()) {
+				MessageManager::Log("[NCD] Missing file: " + files[i].Filename);
+				return false;
+			}
+		} else {
+			VirtualFile physicalFile = files[i].Filename;
+			if (!physicalFile.IsValid()) {
+				MessageManager::Log("[CUE] Missing or invalid file: " + files[i].Filename);
+				return false;
+			}
 		}
 
 		disc.Files.push_back(files[i].Filename);
@@ -228,7 +274,8 @@ bool CdReader::LoadCue(VirtualFile& cueFile, DiscInfo& disc) {
 
 		// Set end position for last track to be the end of the current file
 		TrackInfo& lastTrk = disc.Tracks[disc.Tracks.size() - 1];
-		lastTrk.Size = (uint32_t)((disc.Files[lastTrk.FileIndex].GetSize() - lastTrk.FileOffset) / lastTrk.GetSectorSize() * lastTrk.GetSectorSize());
+		uint64_t fileSize = disc.Image ? disc.Image->GetFileSize(lastTrk.FileIndex) : disc.Files[lastTrk.FileIndex].GetSize();
+		lastTrk.Size = (uint32_t)((fileSize - lastTrk.FileOffset) / lastTrk.GetSectorSize() * lastTrk.GetSectorSize());
 		lastTrk.SectorCount = lastTrk.Size / lastTrk.GetSectorSize();
 		lastTrk.EndPosition = DiscPosition::FromLba(lastTrk.FirstSector + lastTrk.SectorCount - 1);
 		lastTrk.LastSector = lastTrk.EndPosition.ToLba();
@@ -252,37 +299,44 @@ bool CdReader::LoadCue(VirtualFile& cueFile, DiscInfo& disc) {
 		i++;
 	}
 	MessageManager::Log("---- END TRACKS ----");
+	return true;
+}
 
-	LoadSubcodeFile(cueFile, disc);
-
-	return disc.Tracks.size() > 0;
+VirtualFile CdReader::GetSubcodeFile(VirtualFile& cueFile) {
+	return FolderUtilities::CombinePath(FolderUtilities::GetFolderName(cueFile.GetFilePath()), FolderUtilities::GetFilename(cueFile.GetFileName(), false)) + ".sub";
 }
 
 void CdReader::LoadSubcodeFile(VirtualFile& cueFile, DiscInfo& disc) {
-	VirtualFile subFile = FolderUtilities::CombinePath(FolderUtilities::GetFolderName(cueFile.GetFilePath()), FolderUtilities::GetFilename(cueFile.GetFileName(), false)) + ".sub";
+	VirtualFile subFile = GetSubcodeFile(cueFile);
 	if (subFile.IsValid()) {
-		vector<uint8_t>& subCode = disc.DecodedSubCode;
+		vector<uint8_t> subCode;
 		(void)subFile.ReadFile(subCode);
-		// Pre-allocate: each 96-byte sector produces 2 + 12*8 = 98 bytes of subchannel data
-		size_t sectorCount = disc.DecodedSubCode.size() / 96;
-		disc.SubCode.reserve(sectorCount * 98);
-		for (int i = 0; i < disc.DecodedSubCode.size() / 96; i++) {
-			disc.SubCode.push_back(0x00);
-			disc.SubCode.push_back(0x80);
-
-			for (int j = 0; j < 12; j++) {
-				for (int k = 7; k >= 0; k--) {
-					uint8_t encoded = ((((subCode[i * 96 + j + 0] >> k) & 0x01) << 7) |
-					                   (((subCode[i * 96 + j + 12] >> k) & 0x01) << 6) |
-					                   (((subCode[i * 96 + j + 24] >> k) & 0x01) << 5) |
-					                   (((subCode[i * 96 + j + 36] >> k) & 0x01) << 4) |
-					                   (((subCode[i * 96 + j + 48] >> k) & 0x01) << 3) |
-					                   (((subCode[i * 96 + j + 60] >> k) & 0x01) << 2) |
-					                   (((subCode[i * 96 + j + 72] >> k) & 0x01) << 1) |
-					                   (((subCode[i * 96 + j + 84] >> k) & 0x01) << 0));
-
-					disc.SubCode.push_back(encoded);
-				}
+		DecodeSubcode(subCode, disc);
+	}
+}
+
+void CdReader::DecodeSubcode(vector<uint8_t>& data, DiscInfo& disc) {
+	disc.DecodedSubCode = std::move(data);
+	vector<uint8_t>& subCode = disc.DecodedSubCode;
+	// Pre-allocate: each 96-byte sector produces 2 + 12*8 = 98 bytes of subchannel data
+	size_t sectorCount = disc.DecodedSubCode.size() / 96;
+	disc.SubCode.reserve(sectorCount * 98);
+	for (int i = 0; i < disc.DecodedSubCode.size() / 96; i++) {
+		disc.SubCode.push_back(0x00);
+		disc.SubCode.push_back(0x80);
+
+		for (int j = 0; j < 12; j++) {
+			for (int k = 7; k >= 0; k--) {
+				uint8_t encoded = ((((subCode[i * 96 + j + 0] >> k) & 0x01) << 7) |
+				                   (((subCode[i * 96 + j + 12] >> k) & 0x01) << 6) |
+				                   (((subCode[i * 96 + j + 24] >> k) & 0x01) << 5) |
+				                   (((subCode[i * 96 + j + 36] >> k) & 0x01) << 4) |
+				                   (((subCode[i * 96 + j + 48] >> k) & 0x01) << 3) |
+				                   (((subCode[i * 96 + j + 60] >> k) & 0x01) << 2) |
+				                   (((subCode[i * 96 + j + 72] >> k) & 0x01) << 1) |
+				                   (((subCode[i * 96 + j + 84] >> k) & 0x01) << 0));
+
+				disc.SubCode.push_back(encoded);
 			}
 		}
 	}
@@ -2,6 +2,8 @@
 #include "pch.h"
 #include "Utilities/VirtualFile.h"
 #include "Shared/MessageManager.h"
+#include "Shared/CdSectorCache.h"
+#include "Shared/CompressedDiscImage.h"
 
 /// <summary>Track format types for CD-ROM/CD-DA discs</summary>
 enum class TrackFormat {
@@ -91,6 +93,9 @@ struct DiscInfo {
 	uint32_t DiscSectorCount;       ///< Total sector count
 	DiscPosition EndPosition;       ///< Disc end position (MSF)
 
+	shared_ptr<CdSectorCache> SectorCache; ///< Sector cache and read-ahead (created by CdReader::LoadCue, shared by copies)
+	shared_ptr<CompressedDiscImage> Image; ///< Compressed image that contains the track files (.ncd), Files only hold their names
+
 	/// <summary>
 	/// Find track containing sector.
 	/// </summary>
@@ -164,6 +169,16 @@ struct DiscInfo {
 			TrackInfo& trk = Tracks[track];
 			uint32_t sectorSize = trk.GetSectorSize();
 			uint32_t sectorHeaderSize = trk.Format == TrackFormat::Mode1_2352 ? Mode1_2352_SectorHeaderSize : 0;
+			if (SectorCache) {
+				const uint8_t* data = SectorCache->GetSector(sector);
+				if (data) {
+					outData.insert(outData.end(), data + sectorHeaderSize, data + sectorHeaderSize + 2048);
+				} else {
+					LogDebug("Invalid read offsets");
+				}
+				return;
+			}
+
 			uint32_t byteOffset = trk.FileOffset + (sector - trk.FirstSector) * sectorSize;
 			if (!Files[trk.FileIndex].ReadChunk(outData, byteOffset + sectorHeaderSize, 2048)) {
 				LogDebug("Invalid read offsets");
@@ -179,6 +194,16 @@ struct DiscInfo {
 	/// <param name="byteOffset">Channel offset (0=left, 2=right)</param>
 	/// <returns>16-bit audio sample, or 0 if invalid</returns>
 	int16_t ReadAudioSample(uint32_t sector, uint32_t sample, uint32_t byteOffset) {
+		if (SectorCache) {
+			// Called for every sample, the cache returns the sector without searching the tracks
+			const uint8_t* data = SectorCache->GetSector(sector);
+			if (!data) {
+				LogDebug("Invalid sector/track");
+				return 0;
+			}
+			return (int16_t)(data[sample * 4 + byteOffset] | (data[sample * 4 + 1 + byteOffset] << 8));
+		}
+
 		int32_t track = GetTrack(sector);
 		if (track < 0) {
 			LogDebug("Invalid sector/track");
@@ -190,6 +215,13 @@ struct DiscInfo {
 		return (int16_t)(Files[fileIndex].ReadByte(startByte + sample * 4 + byteOffset) | (Files[fileIndex].ReadByte(startByte + sample * 4 + 1 + byteOffset) << 8));
 	}
 
+	/// <summary>Starts loading the sector in the background (seek target), if the disc has a sector cache</summary>
+	void Prefetch(uint32_t sector) {
+		if (SectorCache) {
+			SectorCache->Prefetch(sector);
+		}
+	}
+
 	/// <summary>Read left channel audio sample</summary>
 	int16_t ReadLeftSample(uint32_t sector, uint32_t sample) {
 		return ReadAudioSample(sector, sample, 0);
@@ -222,9 +254,15 @@ struct DiscInfo {
 /// CD-ROM CUE/BIN file parser for PC Engine CD, Sega CD, PlayStation.
 /// </summary>
 class CdReader {
+	/// <summary>Parses the CUE sheet and builds the track list (files are read from disc.Image when it is set)</summary>
+	static bool ParseCue(std::istream& cue, VirtualFile& cueFile, DiscInfo& disc);
+
 	/// <summary>Load .sub subchannel file (if present)</summary>
 	static void LoadSubcodeFile(VirtualFile& cueFile, DiscInfo& disc);
 
+	/// <summary>Stores the raw subchannel data (96 bytes per sector) and its interleaved version</summary>
+	static void DecodeSubcode(vector<uint8_t>& data, DiscInfo& disc);
+
 public:
 	/// <summary>
 	/// Load CUE sheet and associated BIN files.
@@ -234,6 +272,17 @@ public:
 	/// <returns>True if loaded successfully</returns>
 	static bool LoadCue(VirtualFile& file, DiscInfo& disc);
 
+	/// <summary>
+	/// Load a compressed disc image (.ncd, see CompressedDiscImage).
+	/// </summary>
+	/// <param name="file">Compressed image file</param>
+	/// <param name="disc">Output disc info</param>
+	/// <returns>True if loaded successfully</returns>
+	static bool LoadCompressedDisc(VirtualFile& file, DiscInfo& disc);
+
+	/// <summary>.sub subchannel file that belongs to a CUE sheet (may not exist)</summary>
+	static VirtualFile GetSubcodeFile(VirtualFile& cueFile);
+
 	/// <summary>
 	/// Convert binary value to BCD (Binary Coded Decimal).
 	/// </summary>
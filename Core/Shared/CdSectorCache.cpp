@@ -0,0 +1,189 @@
+#include "pch.h"
+#include "Shared/CdSectorCache.h"
+#include "Shared/CdReader.h"
+
+CdSectorCache::CdSectorCache(DiscInfo& disc) {
+	_files = disc.Files;
+	_image = disc.Image;
+	_streams.resize(_files.size());
+	_blockCount = (disc.DiscSectorCount + CdSectorCache::SectorsPerBlock - 1) / CdSectorCache::SectorsPerBlock;
+
+	for (TrackInfo& trk : disc.Tracks) {
+		_tracks.push_back({trk.FirstSector, trk.LastSector, trk.FileIndex, trk.FileOffset, trk.GetSectorSize()});
+	}
+}
+
+CdSectorCache::~CdSectorCache() {
+	if (_readAheadThread) {
+		_stopReadAhead = true;
+		_readAheadSignal.Signal();
+		_readAheadThread->join();
+	}
+}
+
+void CdSectorCache::LoadCurrentBlock(uint32_t blockIndex) {
+	bool backwards = _currentBlock && blockIndex < _currentBlockIndex;
+
+	shared_ptr<const Block> block;
+	{
+		auto lock = _cacheLock.AcquireSafe();
+		auto result = _blocks.find(blockIndex);
+		if (result != _blocks.end()) {
+			result->second.LastUse = ++_useCounter;
+			block = result->second.Data;
+		}
+	}
+
+	if (!block) {
+		// Not loaded by the read-ahead thread (yet), read it now
+		_missCount++;
+		block = ReadBlock(blockIndex);
+		InsertBlock(blockIndex, block);
+	}
+
+	_currentBlock = block;
+	_currentBlockIndex = blockIndex;
+
+	if (backwards) {
+		if (blockIndex > 0) {
+			QueueBlocks(blockIndex - 1, true);
+		}
+	} else {
+		QueueBlocks(blockIndex + 1, false);
+	}
+}
+
+void CdSectorCache::Prefetch(uint32_t sector) {
+	QueueBlocks(sector / CdSectorCache::SectorsPerBlock, false);
+}
+
+bool CdSectorCache::IsCached(uint32_t sector) {
+	auto lock = _cacheLock.AcquireSafe();
+	return _blocks.contains(sector / CdSectorCache::SectorsPerBlock);
+}
+
+void CdSectorCache::QueueBlocks(uint32_t firstBlock, bool backwards) {
+	bool queued = false;
+	{
+		auto lock = _cacheLock.AcquireSafe();
+
+		// The previous read-ahead requests are obsolete once the reads move elsewhere
+		_readAheadQueue.clear();
+
+		for (uint32_t i = 0; i < CdSectorCache::ReadAheadBlocks; i++) {
+			int64_t blockIndex = backwards ? (int64_t)firstBlock - i : (int64_t)firstBlock + i;
+			if (blockIndex < 0 || blockIndex >= _blockCount) {
+				break;
+			}
+			if (!_blocks.contains((uint32_t)blockIndex)) {
+				_readAheadQueue.push_back((uint32_t)blockIndex);
+				queued = true;
+			}
+		}
+	}
+
+	if (queued) {
+		if (!_readAheadThread) {
+			_readAheadThread = std::make_unique<std::thread>(&CdSectorCache::ReadAheadThread, this);
+		}
+		_readAheadSignal.Signal();
+	}
+}
+
+void CdSectorCache::ReadAheadThread() {
+	while (!_stopReadAhead) {
+		_readAheadSignal.Wait();
+
+		while (!_stopReadAhead) {
+			uint32_t blockIndex;
+			{
+				auto lock = _cacheLock.AcquireSafe();
+				if (_readAheadQueue.empty()) {
+					break;
+				}
+				blockIndex = _readAheadQueue.front();
+				_readAheadQueue.pop_front();
+				if (_blocks.contains(blockIndex)) {
+					continue;
+				}
+			}
+
+			InsertBlock(blockIndex, ReadBlock(blockIndex));
+		}
+	}
+}
+
+void CdSectorCache::InsertBlock(uint32_t blockIndex, shared_ptr<const Block> block) {
+	auto lock = _cacheLock.AcquireSafe();
+	_blocks[blockIndex] = {block, ++_useCounter};
+
+	if (_blocks.size() > CdSectorCache::MaxBlocks) {
+		// Discard the least recently used block (the emulation thread keeps its current block alive)
+		auto oldest = std::min_element(_blocks.begin(), _blocks.end(), [](const auto& a, const auto& b) {
+			return a.second.LastUse < b.second.LastUse;
+		});
+		_blocks.erase(oldest);
+	}
+}
+
+shared_ptr<const CdSectorCache::Block> CdSectorCache::ReadBlock(uint32_t blockIndex) {
+	shared_ptr<Block> block = std::make_shared<Block>();
+	block->Data.resize(CdSectorCache::SectorsPerBlock * CdSectorCache::SectorSize);
+
+	auto lock = _fileLock.AcquireSafe();
+	uint32_t firstSector = blockIndex * CdSectorCache::SectorsPerBlock;
+	uint32_t i = 0;
+	while (i < CdSectorCache::SectorsPerBlock) {
+		uint32_t sector = firstSector + i;
+		auto trk = std::find_if(_tracks.begin(), _tracks.end(), [=](const TrackRange& range) {
+			return sector >= range.FirstSector && sector <= range.LastSector;
+		});
+		if (trk == _tracks.end()) {
+			// Pregap or end of disc
+			i++;
+			continue;
+		}
+
+		// Read all sectors of the block that belong to this track at once
+		uint32_t sectorCount = std::min(CdSectorCache::SectorsPerBlock - i, trk->LastSector - sector + 1);
+		uint32_t offset = trk->FileOffset + (sector - trk->FirstSector) * trk->SectorSize;
+		_readBuffer.resize(sectorCount * trk->SectorSize);
+		uint32_t sectorsRead = ReadFile(trk->FileIndex, offset, _readBuffer.data(), (uint32_t)_readBuffer.size()) / trk->SectorSize;
+
+		for (uint32_t j = 0; j < sectorsRead; j++) {
+			memcpy(block->Data.data() + (i + j) * CdSectorCache::SectorSize, _readBuffer.data() + j * trk->SectorSize, trk->SectorSize);
+			block->ValidSectors |= 1u << (i + j);
+		}
+		i += sectorCount;
+	}
+
+	return block;
+}
+
+uint32_t CdSectorCache::ReadFile(uint32_t fileIndex, uint32_t offset, uint8_t* dst, uint32_t length) {
+	if (_image) {
+		return _image->Read(fileIndex, offset, dst, length);
+	}
+
+	VirtualFile& file = _files[fileIndex];
+	if (file.IsArchive()) {
+		// Extracted in memory on first use
+		std::span<const uint8_t> data = file.GetDataSpan();
+		if (offset >= data.size()) {
+			return 0;
+		}
+		uint32_t size = (uint32_t)std::min<size_t>(length, data.size() - offset);
+		memcpy(dst, data.data() + offset, size);
+		return size;
+	}
+
+	unique_ptr<std::ifstream>& stream = _streams[fileIndex];
+	if (!stream) {
+		stream = std::make_unique<std::ifstream>(file.GetFilePath(), std::ios::in | std::ios::binary);
+	}
+
+	stream->clear();
+	stream->seekg(offset, std::ios::beg);
+	stream->read((char*)dst, length);
+	return (uint32_t)stream->gcount();
+}
@@ -0,0 +1,123 @@
+#pragma once
+#include "pch.h"
+#include <thread>
+#include <fstream>
+#include "Utilities/VirtualFile.h"
+#include "Utilities/SimpleLock.h"
+#include "Utilities/AutoResetEvent.h"
+
+struct DiscInfo;
+class CompressedDiscImage;
+
+/// <summary>
+/// Cache of raw CD sectors with a background read-ahead thread (used by DiscInfo for PC Engine CD discs).
+/// </summary>
+/// <remarks>
+/// Sectors are cached in blocks of SectorsPerBlock consecutive sectors, in 2352-byte slots (the sectors of
+/// Mode1_2048 tracks only use the start of their slot).
+///
+/// Reading a sector that isn't cached reads its block synchronously (like before), and every time the reads move
+/// to another block, the next ReadAheadBlocks blocks in the current read direction (forward or backward) are queued
+/// for the read-ahead thread. The CD-ROM drive also calls Prefetch() when a seek starts (data reads and CD-DA
+/// playback), so the target is usually loaded while the emulated seek delay runs. The emulated timing is not
+/// affected, it is still determined by PceCdSeekDelay.
+///
+/// The least recently used blocks are discarded when more than MaxBlocks blocks are cached (~9.6 MB).
+///
+/// For compressed images (.ncd), the hunks are decompressed by the thread that reads them, so usually the
+/// read-ahead thread.
+///
+/// Thread safety: GetSector() and Prefetch() are called by the emulation thread only.
+/// Files are read by the read-ahead thread, or by the emulation thread on a cache miss.
+/// </remarks>
+class CdSectorCache {
+public:
+	static constexpr uint32_t SectorSize = 2352;
+	static constexpr uint32_t SectorsPerBlock = 32;
+	static constexpr uint32_t MaxBlocks = 128;
+	static constexpr uint32_t ReadAheadBlocks = 4;
+
+private:
+	struct Block {
+		vector<uint8_t> Data;
+		uint32_t ValidSectors = 0; ///< Bit N set = sector N of the block was read successfully
+	};
+
+	struct CachedBlock {
+		shared_ptr<const Block> Data;
+		uint64_t LastUse = 0;
+	};
+
+	struct TrackRange {
+		uint32_t FirstSector;
+		uint32_t LastSector;
+		uint32_t FileIndex;
+		uint32_t FileOffset;
+		uint32_t SectorSize;
+	};
+
+	vector<TrackRange> _tracks;
+	uint32_t _blockCount = 0;
+
+	// File access, used by both threads (_fileLock)
+	SimpleLock _fileLock;
+	vector<VirtualFile> _files;
+	shared_ptr<CompressedDiscImage> _image;
+	vector<unique_ptr<std::ifstream>> _streams;
+	vector<uint8_t> _readBuffer;
+
+	// Cached blocks and read-ahead queue (_cacheLock)
+	SimpleLock _cacheLock;
+	std::unordered_map<uint32_t, CachedBlock> _blocks;
+	std::deque<uint32_t> _readAheadQueue;
+	uint64_t _useCounter = 0;
+
+	// Emulation thread only
+	shared_ptr<const Block> _currentBlock;
+	uint32_t _currentBlockIndex = 0;
+	uint32_t _missCount = 0;
+
+	unique_ptr<std::thread> _readAheadThread;
+	AutoResetEvent _readAheadSignal;
+	atomic<bool> _stopReadAhead = false;
+
+	void LoadCurrentBlock(uint32_t blockIndex);
+	[[nodiscard]] shared_ptr<const Block> ReadBlock(uint32_t blockIndex);
+	void InsertBlock(uint32_t blockIndex, shared_ptr<const Block> block);
+	void QueueBlocks(uint32_t firstBlock, bool backwards);
+	[[nodiscard]] uint32_t ReadFile(uint32_t fileIndex, uint32_t offset, uint8_t* dst, uint32_t length);
+	void ReadAheadThread();
+
+public:
+	CdSectorCache(DiscInfo& disc);
+	~CdSectorCache();
+
+	CdSectorCache(const CdSectorCache&) = delete;
+	CdSectorCache& operator=(const CdSectorCache&) = delete;
+
+	/// <summary>
+	/// Returns the sector's data (SectorSize bytes), or nullptr if the sector couldn't be read (pregap, invalid offset).
+	/// </summary>
+	/// <remarks>The pointer is valid until the next call.</remarks>
+	__forceinline const uint8_t* GetSector(uint32_t sector) {
+		uint32_t blockIndex = sector / CdSectorCache::SectorsPerBlock;
+		if (!_currentBlock || blockIndex != _currentBlockIndex) [[unlikely]] {
+			LoadCurrentBlock(blockIndex);
+		}
+
+		uint32_t index = sector % CdSectorCache::SectorsPerBlock;
+		if (!(_currentBlock->ValidSectors & (1u << index))) {
+			return nullptr;
+		}
+		return _currentBlock->Data.data() + index * CdSectorCache::SectorSize;
+	}
+
+	/// <summary>Queues the sector (and the following ones) for the read-ahead thread, e.g when a seek starts</summary>
+	void Prefetch(uint32_t sector);
+
+	/// <summary>Number of reads that had to load a block on the emulation thread</summary>
+	[[nodiscard]] uint32_t GetMissCount() { return _missCount; }
+
+	/// <summary>True when the sector is cached (any thread)</summary>
+	[[nodiscard]] bool IsCached(uint32_t sector);
+};
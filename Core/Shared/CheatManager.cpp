@@ -63,7 +63,14 @@ bool CheatManager::AddCheat(CheatCode code) {
 			[](const std::pair<uint32_t, InternalCheatCode>& p, uint32_t addr) { return p.first < addr; });
 		vec.emplace(it, convertedCode->Address, convertedCode.value());
 		_hasCheats[cpuIndex] = true;
-		_bankHasCheats[cpuIndex][convertedCode->Address >> GetBankShift(convertedCode->Cpu)] = true;
+
+		int shift = GetBankShift(convertedCode->Cpu);
+		std::unique_ptr<uint64_t[]>& bits = _cheatBits[cpuIndex][convertedCode->Address >> shift];
+		if (!bits) {
+			bits = std::make_unique<uint64_t[]>(std::max(1, (1 << shift) / 64));
+		}
+		uint32_t offset = convertedCode->Address & ((1 << shift) - 1);
+		bits[offset >> 6] |= (uint64_t)1 << (offset & 0x3F);
 	}
 
 	return true;
@@ -103,7 +110,11 @@ void CheatManager::InternalClearCheats() {
 		_ramRefreshCheats[i].clear();
 	}
 	memset(_hasCheats, 0, sizeof(_hasCheats));
-	memset(_bankHasCheats, 0, sizeof(_bankHasCheats));
+	for (auto& cpuBits : _cheatBits) {
+		for (std::unique_ptr<uint64_t[]>& bits : cpuBits) {
+			bits.reset();
+		}
+	}
 }
 
 void CheatManager::ClearCheats(bool showMessage) {
@@ -448,7 +459,7 @@ void CheatManager::RefreshRamCheats(CpuType cpuType) {
 	for (InternalCheatCode& code : _ramRefreshCheats[(int)cpuType]) {
 		if (code.IsAbsoluteAddress) {
 			ConsoleMemoryInfo mem = _emu->GetMemory(code.MemType);
-			if (code.Address < mem.Size) {
+			if (code.Address < mem.Size && !mem.Shared) {
 				((uint8_t*)mem.Memory)[code.Address] = code.Value;
 			}
 		}
@@ -456,24 +467,22 @@ void CheatManager::RefreshRamCheats(CpuType cpuType) {
 }
 
 template <CpuType cpuType>
-void CheatManager::ApplyCheat(uint32_t addr, uint8_t& value) {
-	if (_bankHasCheats[(int)cpuType][addr >> GetBankShift(cpuType)]) {
-		// Binary search through sorted contiguous vector — cache-friendly, O(log N)
-		// Typical cheat count is 1-10, so this is faster than unordered_map hash + pointer chasing
-		auto& vec = _cheatsByAddress[(int)cpuType];
-		auto it = std::lower_bound(vec.begin(), vec.end(), addr,
-			[](const std::pair<uint32_t, InternalCheatCode>& p, uint32_t a) { return p.first < a; });
-		if (it != vec.end() && it->first == addr) {
-			if (it->second.Compare == -1 || it->second.Compare == value) {
-				value = it->second.Value;
-				_emu->GetConsoleUnsafe()->ProcessCheatCode(it->second, addr, value);
-			}
+void CheatManager::ApplyMatchedCheat(uint32_t addr, uint8_t& value) {
+	// Binary search through sorted contiguous vector — cache-friendly, O(log N)
+	// Only reached for addresses that have a cheat, the rest of the bank is filtered out by _cheatBits
+	auto& vec = _cheatsByAddress[(int)cpuType];
+	auto it = std::lower_bound(vec.begin(), vec.end(), addr,
+		[](const std::pair<uint32_t, InternalCheatCode>& p, uint32_t a) { return p.first < a; });
+	if (it != vec.end() && it->first == addr) {
+		if (it->second.Compare == -1 || it->second.Compare == value) {
+			value = it->second.Value;
+			_emu->GetConsoleUnsafe()->ProcessCheatCode(it->second, addr, value);
 		}
 	}
 }
 
-template void CheatManager::ApplyCheat<CpuType::Nes>(uint32_t addr, uint8_t& value);
-template void CheatManager::ApplyCheat<CpuType::Snes>(uint32_t addr, uint8_t& value);
-template void CheatManager::ApplyCheat<CpuType::Pce>(uint32_t addr, uint8_t& value);
-template void CheatManager::ApplyCheat<CpuType::Gameboy>(uint32_t addr, uint8_t& value);
-template void CheatManager::ApplyCheat<CpuType::Sms>(uint32_t addr, uint8_t& value);
+template void CheatManager::ApplyMatchedCheat<CpuType::Nes>(uint32_t addr, uint8_t& value);
+template void CheatManager::ApplyMatchedCheat<CpuType::Snes>(uint32_t addr, uint8_t& value);
+template void CheatManager::ApplyMatchedCheat<CpuType::Pce>(uint32_t addr, uint8_t& value);
+template void CheatManager::ApplyMatchedCheat<CpuType::Gameboy>(uint32_t addr, uint8_t& value);
+template void CheatManager::ApplyMatchedCheat<CpuType::Sms>(uint32_t addr, uint8_t& value);
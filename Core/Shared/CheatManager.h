@@ -63,7 +63,7 @@ struct CheatCode {
 /// Cheat application:
 /// - Template method ApplyCheat<cpuType>() called during memory reads
 /// - HasCheats<cpuType>() checks if any cheats active for CPU
-/// - Bank-aware caching (_bankHasCheats) for fast lookup
+/// - Per-bank address bitmaps (_cheatBits) so reads without cheats only cost a bit test
 ///
 /// Thread safety: Not thread-safe - modify cheats only when emulation paused.
 /// </remarks>
@@ -71,7 +71,6 @@ class CheatManager {
 private:
 	Emulator* _emu;                                                       ///< Emulator instance
 	bool _hasCheats[CpuTypeUtilities::GetCpuTypeCount()] = {};            ///< Per-CPU cheat flags
-	bool _bankHasCheats[CpuTypeUtilities::GetCpuTypeCount()][0x100] = {}; ///< Per-bank cheat flags
 	vector<CheatCode> _cheats;                                            ///< Active external cheats
 
 	/// <summary>RAM cheats to refresh each frame (per CPU)</summary>
@@ -80,6 +79,12 @@ private:
 	/// <summary>Address-indexed cheat lookup (per CPU) — sorted by address for cache-friendly binary search</summary>
 	vector<std::pair<uint32_t, InternalCheatCode>> _cheatsByAddress[CpuTypeUtilities::GetCpuTypeCount()];
 
+	/// <summary>
+	/// Prefilter for ApplyCheat: one bit per address of each bank that contains cheats (per CPU), nullptr for the
+	/// banks without cheats. Reads that miss only cost the bit test, the binary search is only done on a hit.
+	/// </summary>
+	std::unique_ptr<uint64_t[]> _cheatBits[CpuTypeUtilities::GetCpuTypeCount()][0x100];
+
 	/// <summary>Try to convert external cheat code to internal format</summary>
 	optional<InternalCheatCode> TryConvertCode(CheatCode code);
 
@@ -127,7 +132,7 @@ private:
 	/// - GB/NES/SMS: 256-byte banks (shift 8)
 	/// - PCE: 8KB banks (shift 13)
 	/// </remarks>
-	__forceinline constexpr int GetBankShift(CpuType cpuType) {
+	__forceinline static constexpr int GetBankShift(CpuType cpuType) {
 		switch (cpuType) {
 			case CpuType::Snes:
 				return 16;
@@ -198,10 +203,21 @@ public:
 	/// <param name="addr">Memory address being read</param>
 	/// <param name="value">Value to potentially patch (modified if cheat active)</param>
 	/// <remarks>
-	/// Fast path: Checks bank flag first (cache optimization)
+	/// Fast path: Tests the address' bit in its bank's bitmap (inlined in the memory read path)
 	/// Slow path: Looks up cheat in address map, applies if found
 	/// Compare value checked if cheat has compare condition
 	/// </remarks>
 	template <CpuType cpuType>
-	__noinline void ApplyCheat(uint32_t addr, uint8_t& value);
+	__forceinline void ApplyCheat(uint32_t addr, uint8_t& value) {
+		constexpr int shift = GetBankShift(cpuType);
+		uint64_t* bits = _cheatBits[(int)cpuType][addr >> shift].get();
+		uint32_t offset = addr & ((1 << shift) - 1);
+		if (bits && ((bits[offset >> 6] >> (offset & 0x3F)) & 1)) [[unlikely]] {
+			ApplyMatchedCheat<cpuType>(addr, value);
+		}
+	}
+
+	/// <summary>Applies the cheat at an address whose bit is set in _cheatBits</summary>
+	template <CpuType cpuType>
+	__noinline void ApplyMatchedCheat(uint32_t addr, uint8_t& value);
 };
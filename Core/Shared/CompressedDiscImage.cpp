@@ -0,0 +1,269 @@
+#include "pch.h"
+#include "Shared/CompressedDiscImage.h"
+#include "Shared/CdReader.h"
+#include "Shared/MessageManager.h"
+#include "Utilities/VirtualFile.h"
+#include "Utilities/FolderUtilities.h"
+#include "Utilities/CRC32.h"
+#include "Utilities/miniz.h"
+
+namespace {
+	// Stores each 16-bit sample as the difference with the previous sample of the same channel
+	void DeltaEncode(const uint8_t* src, uint8_t* dst, uint32_t length) {
+		int16_t prev[2] = {};
+		for (uint32_t i = 0; i + 1 < length; i += 2) {
+			int16_t sample = (int16_t)(src[i] | (src[i + 1] << 8));
+			uint16_t delta = (uint16_t)(sample - prev[(i >> 1) & 0x01]);
+			prev[(i >> 1) & 0x01] = sample;
+			dst[i] = (uint8_t)delta;
+			dst[i + 1] = (uint8_t)(delta >> 8);
+		}
+		if (length & 0x01) {
+			dst[length - 1] = src[length - 1];
+		}
+	}
+
+	void DeltaDecode(uint8_t* data, uint32_t length) {
+		int16_t prev[2] = {};
+		for (uint32_t i = 0; i + 1 < length; i += 2) {
+			int16_t sample = (int16_t)(prev[(i >> 1) & 0x01] + (int16_t)(data[i] | (data[i + 1] << 8)));
+			prev[(i >> 1) & 0x01] = sample;
+			data[i] = (uint8_t)sample;
+			data[i + 1] = (uint8_t)(sample >> 8);
+		}
+	}
+}
+
+bool CompressedDiscImage::Open(const string& path) {
+	_stream.open(path, std::ios::in | std::ios::binary);
+	if (!_stream) {
+		return false;
+	}
+
+	_stream.read((char*)&_header, sizeof(_header));
+	if (!_stream || _header.Magic != CompressedDiscImage::Magic || _header.Version != CompressedDiscImage::Version || _header.HunkSize == 0) {
+		MessageManager::Log("[NCD] Invalid or unsupported compressed disc image");
+		return false;
+	}
+
+	_cue.resize(_header.CueSize);
+	_stream.read(_cue.data(), _header.CueSize);
+
+	for (uint32_t i = 0; i < _header.FileCount && _stream; i++) {
+		FileEntry entry = {};
+		uint32_t nameLength = 0;
+		_stream.read((char*)&nameLength, sizeof(nameLength));
+		if (nameLength > 4096) {
+			break;
+		}
+		entry.Name.resize(nameLength);
+		_stream.read(entry.Name.data(), nameLength);
+		_stream.read((char*)&entry.Size, sizeof(entry.Size));
+		_stream.read((char*)&entry.FirstHunk, sizeof(entry.FirstHunk));
+
+		uint64_t hunkCount = (entry.Size + _header.HunkSize - 1) / _header.HunkSize;
+		if (entry.FirstHunk + hunkCount > _header.HunkCount) {
+			break;
+		}
+		_files.push_back(entry);
+	}
+
+	_hunks.resize(_header.HunkCount);
+	_stream.seekg(_header.IndexOffset, std::ios::beg);
+	_stream.read((char*)_hunks.data(), _hunks.size() * sizeof(HunkEntry));
+
+	if (!_stream || _files.size() != _header.FileCount || (_header.HasSubcode && _files.empty())) {
+		MessageManager::Log("[NCD] Invalid file table or hunk index");
+		return false;
+	}
+	return true;
+}
+
+uint32_t CompressedDiscImage::Read(uint32_t fileIndex, uint64_t offset, uint8_t* dst, uint32_t length) {
+	if (fileIndex >= _files.size() || offset >= _files[fileIndex].Size) {
+		return 0;
+	}
+
+	auto lock = _lock.AcquireSafe();
+	FileEntry& file = _files[fileIndex];
+	length = (uint32_t)std::min<uint64_t>(length, file.Size - offset);
+
+	uint32_t bytesRead = 0;
+	while (bytesRead < length) {
+		uint64_t pos = offset + bytesRead;
+		const vector<uint8_t>* hunk = GetHunk(file.FirstHunk + (uint32_t)(pos / _header.HunkSize));
+		uint32_t hunkOffset = (uint32_t)(pos % _header.HunkSize);
+		if (!hunk || hunkOffset >= hunk->size()) {
+			break;
+		}
+
+		uint32_t size = std::min(length - bytesRead, (uint32_t)hunk->size() - hunkOffset);
+		memcpy(dst + bytesRead, hunk->data() + hunkOffset, size);
+		bytesRead += size;
+	}
+	return bytesRead;
+}
+
+const vector<uint8_t>* CompressedDiscImage::GetHunk(uint32_t hunkIndex) {
+	for (CachedHunk& entry : _cache) {
+		if (entry.Index == hunkIndex) {
+			entry.LastUse = ++_useCounter;
+			return &entry.Data;
+		}
+	}
+
+	CachedHunk* target;
+	if (_cache.size() < CompressedDiscImage::CachedHunkCount) {
+		target = &_cache.emplace_back();
+	} else {
+		target = &*std::min_element(_cache.begin(), _cache.end(), [](const CachedHunk& a, const CachedHunk& b) {
+			return a.LastUse < b.LastUse;
+		});
+	}
+
+	if (!DecompressHunk(_hunks[hunkIndex], target->Data)) {
+		target->Index = UINT32_MAX;
+		target->LastUse = 0;
+		MessageManager::Log(std::format("[NCD] Hunk {} is corrupted", hunkIndex));
+		return nullptr;
+	}
+
+	target->Index = hunkIndex;
+	target->LastUse = ++_useCounter;
+	return &target->Data;
+}
+
+bool CompressedDiscImage::DecompressHunk(const HunkEntry& hunk, vector<uint8_t>& out) {
+	_compressedBuffer.resize(hunk.CompressedSize);
+	_stream.clear();
+	_stream.seekg(hunk.Offset, std::ios::beg);
+	_stream.read((char*)_compressedBuffer.data(), hunk.CompressedSize);
+	if (!_stream) {
+		return false;
+	}
+
+	if (hunk.Type == HunkType::Stored) {
+		out = _compressedBuffer;
+	} else {
+		out.resize(_header.HunkSize);
+		mz_ulong size = _header.HunkSize;
+		if (mz_uncompress(out.data(), &size, _compressedBuffer.data(), hunk.CompressedSize) != MZ_OK) {
+			return false;
+		}
+		out.resize(size);
+		if (hunk.Type == HunkType::DeltaDeflate) {
+			DeltaDecode(out.data(), (uint32_t)out.size());
+		}
+	}
+
+	return CRC32::GetCRC(out.data(), out.size()) == hunk.Crc32;
+}
+
+bool CompressedDiscImage::CompressFile(std::ostream& out, VirtualFile& file, vector<HunkEntry>& hunks) {
+	std::span<const uint8_t> data = file.GetDataSpan();
+	if (data.size() != file.GetSize()) {
+		return false;
+	}
+
+	vector<uint8_t> deltaData(CompressedDiscImage::HunkSize);
+	vector<uint8_t> deflated(mz_compressBound(CompressedDiscImage::HunkSize));
+	vector<uint8_t> deltaDeflated(deflated.size());
+
+	for (size_t pos = 0; pos < data.size(); pos += CompressedDiscImage::HunkSize) {
+		const uint8_t* src = data.data() + pos;
+		uint32_t length = (uint32_t)std::min<size_t>(CompressedDiscImage::HunkSize, data.size() - pos);
+
+		HunkEntry hunk = {};
+		hunk.Offset = (uint64_t)out.tellp();
+		hunk.Crc32 = CRC32::GetCRC(src, length);
+
+		mz_ulong deflatedSize = (mz_ulong)deflated.size();
+		mz_ulong deltaSize = (mz_ulong)deltaDeflated.size();
+		DeltaEncode(src, deltaData.data(), length);
+		if (mz_compress2(deflated.data(), &deflatedSize, src, length, MZ_BEST_COMPRESSION) != MZ_OK) {
+			deflatedSize = length;
+		}
+		if (mz_compress2(deltaDeflated.data(), &deltaSize, deltaData.data(), length, MZ_BEST_COMPRESSION) != MZ_OK) {
+			deltaSize = length;
+		}
+
+		// Keep the smallest result (audio usually compresses better with the delta encoding, data without it)
+		const uint8_t* hunkData = src;
+		hunk.Type = HunkType::Stored;
+		hunk.CompressedSize = length;
+		if (deflatedSize < hunk.CompressedSize && deflatedSize <= deltaSize) {
+			hunkData = deflated.data();
+			hunk.Type = HunkType::Deflate;
+			hunk.CompressedSize = (uint32_t)deflatedSize;
+		} else if (deltaSize < hunk.CompressedSize) {
+			hunkData = deltaDeflated.data();
+			hunk.Type = HunkType::DeltaDeflate;
+			hunk.CompressedSize = (uint32_t)deltaSize;
+		}
+
+		out.write((char*)hunkData, hunk.CompressedSize);
+		hunks.push_back(hunk);
+	}
+	return (bool)out;
+}
+
+bool CompressedDiscImage::Create(VirtualFile& cueFile, const string& outPath) {
+	DiscInfo disc = {};
+	if (!CdReader::LoadCue(cueFile, disc)) {
+		return false;
+	}
+
+	vector<VirtualFile> sources = disc.Files;
+	VirtualFile subFile = CdReader::GetSubcodeFile(cueFile);
+	bool hasSubcode = subFile.IsValid();
+	if (hasSubcode) {
+		sources.push_back(subFile);
+	}
+
+	stringstream cue;
+	(void)cueFile.ReadFile(cue);
+	string cueText = cue.str();
+
+	std::ofstream out(outPath, std::ios::out | std::ios::binary);
+	if (!out) {
+		MessageManager::Log("[NCD] Could not create file: " + outPath);
+		return false;
+	}
+
+	Header header = {};
+	header.Magic = CompressedDiscImage::Magic;
+	header.Version = CompressedDiscImage::Version;
+	header.HunkSize = CompressedDiscImage::HunkSize;
+	header.FileCount = (uint32_t)sources.size();
+	header.CueSize = (uint32_t)cueText.size();
+	header.HasSubcode = hasSubcode ? 1 : 0;
+	out.write((char*)&header, sizeof(header));
+	out.write(cueText.data(), cueText.size());
+
+	uint32_t firstHunk = 0;
+	for (VirtualFile& file : sources) {
+		string name = file.GetFileName();
+		uint32_t nameLength = (uint32_t)name.size();
+		uint64_t size = file.GetSize();
+		out.write((char*)&nameLength, sizeof(nameLength));
+		out.write(name.data(), nameLength);
+		out.write((char*)&size, sizeof(size));
+		out.write((char*)&firstHunk, sizeof(firstHunk));
+		firstHunk += (uint32_t)((size + CompressedDiscImage::HunkSize - 1) / CompressedDiscImage::HunkSize);
+	}
+
+	vector<HunkEntry> hunks;
+	for (VirtualFile& file : sources) {
+		if (!CompressFile(out, file, hunks)) {
+			MessageManager::Log("[NCD] Could not read file: " + file.GetFilePath());
+			return false;
+		}
+	}
+
+	header.HunkCount = (uint32_t)hunks.size();
+	header.IndexOffset = (uint64_t)out.tellp();
+	out.write((char*)hunks.data(), hunks.size() * sizeof(HunkEntry));
+	out.seekp(0, std::ios::beg);
+	out.write((char*)&header, sizeof(header));
+	return (bool)out;
+}
@@ -0,0 +1,114 @@
+#pragma once
+#include "pch.h"
+#include <fstream>
+#include "Utilities/SimpleLock.h"
+
+class VirtualFile;
+
+/// <summary>
+/// Hunk-compressed, randomly seekable disc image (.ncd): a CUE sheet and its track files, compressed in hunks.
+/// </summary>
+/// <remarks>
+/// File layout (little endian):
+/// - Header
+/// - CUE sheet (CueSize bytes, FILE entries are matched to the files by order)
+/// - File table: for each file, uint32 name length, name, uint64 size, uint32 first hunk
+///   (the .sub subcode file is stored after the track files when HasSubcode is set)
+/// - Hunk data
+/// - Hunk index (HunkCount entries, at IndexOffset)
+///
+/// Each file is split into HunkSize-byte hunks (the last one can be shorter), compressed independently:
+/// - Stored: uncompressed
+/// - Deflate: zlib stream
+/// - DeltaDeflate: zlib stream of 16-bit stereo samples stored as the difference with the previous sample
+///   of the same channel - usually much smaller than Deflate for CD-DA audio
+///
+/// Decompressed hunks are kept in a small LRU cache, since sector reads are often smaller than a hunk.
+/// Reads are usually done by the CdSectorCache read-ahead thread.
+///
+/// Thread safety: Read() can be called from any thread (serialized by an internal lock).
+/// </remarks>
+class CompressedDiscImage {
+public:
+	static constexpr uint32_t Magic = 0x4443584E; // NXCD
+	static constexpr uint32_t Version = 1;
+	static constexpr uint32_t HunkSize = 16 * 2352;
+	static constexpr uint32_t CachedHunkCount = 8;
+
+	enum class HunkType : uint8_t {
+		Stored = 0,
+		Deflate = 1,
+		DeltaDeflate = 2
+	};
+
+	struct Header {
+		uint32_t Magic;
+		uint32_t Version;
+		uint32_t HunkSize;
+		uint32_t FileCount;
+		uint32_t HunkCount;
+		uint32_t CueSize;
+		uint32_t HasSubcode;
+		uint32_t Reserved;
+		uint64_t IndexOffset;
+	};
+
+	struct HunkEntry {
+		uint64_t Offset;
+		uint32_t CompressedSize;
+		uint32_t Crc32; ///< CRC32 of the uncompressed hunk
+		HunkType Type;
+		uint8_t Reserved[7];
+	};
+
+	struct FileEntry {
+		string Name;
+		uint64_t Size;
+		uint32_t FirstHunk;
+	};
+
+private:
+	struct CachedHunk {
+		uint32_t Index;
+		uint64_t LastUse;
+		vector<uint8_t> Data;
+	};
+
+	SimpleLock _lock;
+	std::ifstream _stream;
+	Header _header = {};
+	string _cue;
+	vector<FileEntry> _files;
+	vector<HunkEntry> _hunks;
+
+	vector<CachedHunk> _cache;
+	uint64_t _useCounter = 0;
+	vector<uint8_t> _compressedBuffer;
+
+	[[nodiscard]] const vector<uint8_t>* GetHunk(uint32_t hunkIndex);
+	[[nodiscard]] bool DecompressHunk(const HunkEntry& hunk, vector<uint8_t>& out);
+
+	static bool CompressFile(std::ostream& out, VirtualFile& file, vector<HunkEntry>& hunks);
+
+public:
+	/// <summary>Opens an image (filesystem path). Returns false if the file isn't a valid image.</summary>
+	bool Open(const string& path);
+
+	[[nodiscard]] const string& GetCue() { return _cue; }
+
+	/// <summary>Number of track files (not including the subcode file)</summary>
+	[[nodiscard]] uint32_t GetTrackFileCount() { return (uint32_t)_files.size() - (_header.HasSubcode ? 1 : 0); }
+	[[nodiscard]] uint64_t GetFileSize(uint32_t fileIndex) { return fileIndex < _files.size() ? _files[fileIndex].Size : 0; }
+
+	[[nodiscard]] bool HasSubcode() { return _header.HasSubcode != 0; }
+	[[nodiscard]] uint32_t GetSubcodeFileIndex() { return (uint32_t)_files.size() - 1; }
+
+	/// <summary>Reads the decompressed content of a file</summary>
+	/// <returns>Number of bytes read (less than length at the end of the file, or if a hunk is corrupted)</returns>
+	uint32_t Read(uint32_t fileIndex, uint64_t offset, uint8_t* dst, uint32_t length);
+
+	/// <summary>
+	/// Creates a compressed image from a CUE sheet, its track files and its .sub file (if any).
+	/// </summary>
+	static bool Create(VirtualFile& cueFile, const string& outPath);
+};
@@ -0,0 +1,32 @@
+#pragma once
+#include "pch.h"
+
+class EmuSettings;
+
+/// <summary>
+/// Private copy of one of the emulator's config structures, refreshed by EmuSettings::UpdateSnapshot().
+/// </summary>
+/// <remarks>
+/// Hot code (PPUs, APUs, filters) keeps a snapshot and refreshes it at a safe point (e.g once per frame) instead of
+/// reading the shared config structures, which the UI thread can overwrite at any time.
+/// UpdateSnapshot() only compares a version number unless the config was changed, so it is cheap to call often,
+/// and its return value tells the consumer when fields derived from the config must be recalculated.
+///
+/// String pointers in the copied config (e.g AudioConfig::AudioDevice) still point to the strings owned by
+/// EmuSettings, and are only valid until the next change of that config.
+/// </remarks>
+template <typename T>
+class ConfigSnapshot {
+private:
+	friend class EmuSettings;
+
+	T _config = {};
+	uint32_t _version = 0; ///< Version of the copied config (0 = never loaded)
+
+public:
+	[[nodiscard]] const T& Get() const { return _config; }
+	const T* operator->() const { return &_config; }
+
+	/// <summary>Version of the config when it was copied</summary>
+	[[nodiscard]] uint32_t GetVersion() const { return _version; }
+};
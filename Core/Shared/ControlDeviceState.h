@@ -1,6 +1,7 @@
 #pragma once
 #include "pch.h"
 #include "Shared/SettingTypes.h"
+#include "Utilities/SmallVector.h"
 
 /// <summary>
 /// Represents current button/input state for a controller or input device.
@@ -13,12 +14,16 @@
 /// - Keyboard: Scancode matrix
 /// - Zapper: X/Y coordinates + trigger state
 ///
-/// State vector size varies by device type.
-/// Comparison uses vector equality for byte-wise check.
+/// State size varies by device type. States up to InlineSize bytes (every gamepad, mouse and keyboard) are
+/// stored inline, so the per-frame copies (input recorders, rendered frames) don't allocate. Larger states
+/// (e.g barcodes, tape data) are stored on the heap.
+/// Comparison is a byte-wise check.
 /// </remarks>
 struct ControlDeviceState {
+	static constexpr uint32_t InlineSize = 32;
+
 	/// <summary>Raw device state bytes (device-specific encoding)</summary>
-	vector<uint8_t> State;
+	SmallVector<uint8_t, InlineSize> State;
 
 	/// <summary>
 	/// Compare device states for equality.
@@ -226,7 +226,7 @@ public:
 		auto lock = _stateLock.AcquireSafe();
 		_state = state;
 
-		const vector<uint8_t>& data = state.State;
+		const auto& data = state.State;
 		int pos = 0;
 
 		for (int i = 0; i < HubPortCount; i++) {
@@ -6,6 +6,7 @@
 #include "Shared/Emulator.h"
 #include "Shared/DebuggerRequest.h"
 #include "Shared/NotificationManager.h"
+#include "Shared/Video/ScaleFilter.h"
 #include "Utilities/FolderUtilities.h"
 #include "Utilities/Serializer.h"
 
@@ -13,6 +14,9 @@ EmuSettings::EmuSettings(Emulator* emu) {
 	_emu = emu;
 	_flags = 0;
 	_debuggerFlags = 0;
+	for (atomic<uint32_t>& version : _configVersions) {
+		version = 1;
+	}
 
 	std::random_device rd;
 	_mt = std::mt19937(rd());
@@ -39,6 +43,7 @@ void EmuSettings::Serialize(Serializer& s) {
 	// Save/load settings that have an impact on emulation (for movies), netplay, etc.)
 	// TODOv2: These should probably not be loaded except for movie playback and netplay clients
 	// TODOv2: Desyncs are possible when random state options are turned on
+	auto lock = _configLock.AcquireSafe();
 	SV(_video.IntegerFpsMode);
 	SV(_emulation.RunAheadFrames);
 	SV(_game.DipSwitches);
@@ -157,6 +162,12 @@ void EmuSettings::Serialize(Serializer& s) {
 		default:
 			[[unlikely]] throw std::runtime_error("unsupported console type");
 	}
+
+	if (!s.IsSaving()) {
+		for (atomic<uint32_t>& version : _configVersions) {
+			version++;
+		}
+	}
 }
 
 uint32_t EmuSettings::GetVersion() {
@@ -183,7 +194,10 @@ void EmuSettings::ProcessString(string& str, const char** strPointer) {
 }
 
 void EmuSettings::SetVideoConfig(VideoConfig& config) {
-	_video = config;
+	UpdateConfig(_video, config, SettingsCategory::Video);
+
+	// Build the filter's tables while the game loads (or before the video thread switches filters)
+	ScaleFilter::PrecomputeTables(config.VideoFilter);
 }
 
 VideoConfig& EmuSettings::GetVideoConfig() {
@@ -191,8 +205,10 @@ VideoConfig& EmuSettings::GetVideoConfig() {
 }
 
 void EmuSettings::SetAudioConfig(AudioConfig& config) {
+	auto lock = _configLock.AcquireSafe();
 	_audio = config;
 	ProcessString(_audioDevice, &_audio.AudioDevice);
+	_configVersions[(int)SettingsCategory::Audio]++;
 }
 
 AudioConfig& EmuSettings::GetAudioConfig() {
@@ -200,7 +216,7 @@ AudioConfig& EmuSettings::GetAudioConfig() {
 }
 
 void EmuSettings::SetInputConfig(InputConfig& config) {
-	_input = config;
+	UpdateConfig(_input, config, SettingsCategory::Input);
 }
 
 InputConfig& EmuSettings::GetInputConfig() {
@@ -208,7 +224,7 @@ InputConfig& EmuSettings::GetInputConfig() {
 }
 
 void EmuSettings::SetEmulationConfig(EmulationConfig& config) {
-	_emulation = config;
+	UpdateConfig(_emulation, config, SettingsCategory::Emulation);
 }
 
 EmulationConfig& EmuSettings::GetEmulationConfig() {
@@ -216,7 +232,7 @@ EmulationConfig& EmuSettings::GetEmulationConfig() {
 }
 
 void EmuSettings::SetSnesConfig(SnesConfig& config) {
-	_snes = config;
+	UpdateConfig(_snes, config, SettingsCategory::Snes);
 }
 
 SnesConfig& EmuSettings::GetSnesConfig() {
@@ -224,7 +240,7 @@ SnesConfig& EmuSettings::GetSnesConfig() {
 }
 
 void EmuSettings::SetNesConfig(NesConfig& config) {
-	_nes = config;
+	UpdateConfig(_nes, config, SettingsCategory::Nes);
 }
 
 NesConfig& EmuSettings::GetNesConfig() {
@@ -232,7 +248,7 @@ NesConfig& EmuSettings::GetNesConfig() {
 }
 
 void EmuSettings::SetGameboyConfig(GameboyConfig& config) {
-	_gameboy = config;
+	UpdateConfig(_gameboy, config, SettingsCategory::Gameboy);
 }
 
 GameboyConfig& EmuSettings::GetGameboyConfig() {
@@ -240,7 +256,7 @@ GameboyConfig& EmuSettings::GetGameboyConfig() {
 }
 
 void EmuSettings::SetGbaConfig(GbaConfig& config) {
-	_gba = config;
+	UpdateConfig(_gba, config, SettingsCategory::Gba);
 }
 
 GbaConfig& EmuSettings::GetGbaConfig() {
@@ -248,7 +264,7 @@ GbaConfig& EmuSettings::GetGbaConfig() {
 }
 
 void EmuSettings::SetPcEngineConfig(PcEngineConfig& config) {
-	_pce = config;
+	UpdateConfig(_pce, config, SettingsCategory::PcEngine);
 }
 
 PcEngineConfig& EmuSettings::GetPcEngineConfig() {
@@ -256,7 +272,7 @@ PcEngineConfig& EmuSettings::GetPcEngineConfig() {
 }
 
 void EmuSettings::SetSmsConfig(SmsConfig& config) {
-	_sms = config;
+	UpdateConfig(_sms, config, SettingsCategory::Sms);
 }
 
 SmsConfig& EmuSettings::GetSmsConfig() {
@@ -264,7 +280,7 @@ SmsConfig& EmuSettings::GetSmsConfig() {
 }
 
 void EmuSettings::SetCvConfig(CvConfig& config) {
-	_cv = config;
+	UpdateConfig(_cv, config, SettingsCategory::Cv);
 }
 
 CvConfig& EmuSettings::GetCvConfig() {
@@ -272,7 +288,7 @@ CvConfig& EmuSettings::GetCvConfig() {
 }
 
 void EmuSettings::SetWsConfig(WsConfig& config) {
-	_ws = config;
+	UpdateConfig(_ws, config, SettingsCategory::Ws);
 }
 
 WsConfig& EmuSettings::GetWsConfig() {
@@ -280,7 +296,7 @@ WsConfig& EmuSettings::GetWsConfig() {
 }
 
 void EmuSettings::SetLynxConfig(LynxConfig& config) {
-	_lynx = config;
+	UpdateConfig(_lynx, config, SettingsCategory::Lynx);
 }
 
 LynxConfig& EmuSettings::GetLynxConfig() {
@@ -288,7 +304,7 @@ LynxConfig& EmuSettings::GetLynxConfig() {
 }
 
 void EmuSettings::SetGameConfig(GameConfig& config) {
-	_game = config;
+	UpdateConfig(_game, config, SettingsCategory::Game);
 }
 
 GameConfig& EmuSettings::GetGameConfig() {
@@ -298,11 +314,15 @@ GameConfig& EmuSettings::GetGameConfig() {
 void EmuSettings::SetPreferences(PreferencesConfig& config) {
 	MessageManager::SetOptions(!config.DisableOsd, CheckFlag(EmulationFlags::OutputToStdout));
 
-	_preferences = config;
+	{
+		auto lock = _configLock.AcquireSafe();
+		_preferences = config;
 
-	ProcessString(_saveFolder, &_preferences.SaveFolderOverride);
-	ProcessString(_saveStateFolder, &_preferences.SaveStateFolderOverride);
-	ProcessString(_screenshotFolder, &_preferences.ScreenshotFolderOverride);
+		ProcessString(_saveFolder, &_preferences.SaveFolderOverride);
+		ProcessString(_saveStateFolder, &_preferences.SaveStateFolderOverride);
+		ProcessString(_screenshotFolder, &_preferences.ScreenshotFolderOverride);
+		_configVersions[(int)SettingsCategory::Preferences]++;
+	}
 
 	FolderUtilities::SetFolderOverrides(
 	    _saveFolder,
@@ -316,7 +336,7 @@ PreferencesConfig& EmuSettings::GetPreferences() {
 }
 
 void EmuSettings::SetAudioPlayerConfig(AudioPlayerConfig& config) {
-	_audioPlayer = config;
+	UpdateConfig(_audioPlayer, config, SettingsCategory::AudioPlayer);
 }
 
 AudioPlayerConfig& EmuSettings::GetAudioPlayerConfig() {
@@ -324,7 +344,7 @@ AudioPlayerConfig& EmuSettings::GetAudioPlayerConfig() {
 }
 
 void EmuSettings::SetDebugConfig(DebugConfig& config) {
-	_debug = config;
+	UpdateConfig(_debug, config, SettingsCategory::Debug);
 
 	DebuggerRequest req = _emu->GetDebugger(false);
 	Debugger* dbg = req.GetDebugger();
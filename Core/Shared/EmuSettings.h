@@ -1,12 +1,35 @@
 #pragma once
 #include "pch.h"
 #include "Shared/SettingTypes.h"
+#include "Shared/ConfigSnapshot.h"
 #include "Utilities/SimpleLock.h"
 #include "Utilities/ISerializable.h"
 #include <random>
 
 class Emulator;
 
+/// <summary>Config structures that are versioned separately (see EmuSettings::GetConfigVersion)</summary>
+enum class SettingsCategory {
+	Video,
+	Audio,
+	Input,
+	Emulation,
+	Preferences,
+	AudioPlayer,
+	Debug,
+	Game,
+	Snes,
+	Gameboy,
+	Nes,
+	PcEngine,
+	Sms,
+	Cv,
+	Gba,
+	Ws,
+	Lynx,
+	Count
+};
+
 /// <summary>
 /// Global emulator configuration manager.
 /// Centralizes all settings for video, audio, input, emulation, and platform-specific configs.
@@ -32,7 +55,9 @@ class Emulator;
 ///
 /// Thread safety:
 /// - Flag checks use atomic operations (lock-free)
-/// - Config updates use SimpleLock for mutual exclusion
+/// - Config updates use SimpleLock for mutual exclusion, and increment the version of the config
+/// - Emulation code reads configs through a ConfigSnapshot (UpdateSnapshot), which only takes the lock
+///   to copy a config after it changed, so it never sees a partially written config
 /// - Shortcut key updates use dedicated lock
 /// </remarks>
 class EmuSettings final : public ISerializable {
@@ -60,6 +85,9 @@ private:
 	WsConfig _ws;
 	LynxConfig _lynx;
 
+	SimpleLock _configLock{"Settings"};
+	atomic<uint32_t> _configVersions[(int)SettingsCategory::Count];
+
 	atomic<uint32_t> _flags;
 	atomic<uint64_t> _debuggerFlags;
 
@@ -75,6 +103,71 @@ private:
 
 	void ProcessString(string& str, const char** strPointer);
 
+	template <typename T>
+	void UpdateConfig(T& target, const T& config, SettingsCategory category) {
+		auto lock = _configLock.AcquireSafe();
+		target = config;
+		_configVersions[(int)category]++;
+	}
+
+	template <typename T>
+	T& GetConfig(SettingsCategory& category) {
+		using enum SettingsCategory;
+		if constexpr (std::is_same_v<T, VideoConfig>) {
+			category = Video;
+			return _video;
+		} else if constexpr (std::is_same_v<T, AudioConfig>) {
+			category = Audio;
+			return _audio;
+		} else if constexpr (std::is_same_v<T, InputConfig>) {
+			category = Input;
+			return _input;
+		} else if constexpr (std::is_same_v<T, EmulationConfig>) {
+			category = Emulation;
+			return _emulation;
+		} else if constexpr (std::is_same_v<T, PreferencesConfig>) {
+			category = Preferences;
+			return _preferences;
+		} else if constexpr (std::is_same_v<T, AudioPlayerConfig>) {
+			category = AudioPlayer;
+			return _audioPlayer;
+		} else if constexpr (std::is_same_v<T, DebugConfig>) {
+			category = Debug;
+			return _debug;
+		} else if constexpr (std::is_same_v<T, GameConfig>) {
+			category = Game;
+			return _game;
+		} else if constexpr (std::is_same_v<T, SnesConfig>) {
+			category = Snes;
+			return _snes;
+		} else if constexpr (std::is_same_v<T, GameboyConfig>) {
+			category = Gameboy;
+			return _gameboy;
+		} else if constexpr (std::is_same_v<T, NesConfig>) {
+			category = Nes;
+			return _nes;
+		} else if constexpr (std::is_same_v<T, PcEngineConfig>) {
+			category = PcEngine;
+			return _pce;
+		} else if constexpr (std::is_same_v<T, SmsConfig>) {
+			category = Sms;
+			return _sms;
+		} else if constexpr (std::is_same_v<T, CvConfig>) {
+			category = Cv;
+			return _cv;
+		} else if constexpr (std::is_same_v<T, GbaConfig>) {
+			category = Gba;
+			return _gba;
+		} else if constexpr (std::is_same_v<T, WsConfig>) {
+			category = Ws;
+			return _ws;
+		} else {
+			static_assert(std::is_same_v<T, LynxConfig>, "unsupported config type");
+			category = Lynx;
+			return _lynx;
+		}
+	}
+
 	void ClearShortcutKeys();
 	void SetShortcutKey(EmulatorShortcut shortcut, KeyCombination keyCombination, int keySetIndex);
 
@@ -139,6 +232,31 @@ public:
 	void SetDebugConfig(DebugConfig& config);
 	DebugConfig& GetDebugConfig();
 
+	/// <summary>
+	/// Version of a config structure, incremented every time it is modified (starts at 1).
+	/// </summary>
+	[[nodiscard]] uint32_t GetConfigVersion(SettingsCategory category) {
+		return _configVersions[(int)category].load(std::memory_order_acquire);
+	}
+
+	/// <summary>
+	/// Copies the current config into the snapshot, if it was modified since the snapshot was taken.
+	/// </summary>
+	/// <returns>True when the snapshot was updated (always true for a snapshot that was never updated)</returns>
+	template <typename T>
+	bool UpdateSnapshot(ConfigSnapshot<T>& snapshot) {
+		SettingsCategory category;
+		T& config = GetConfig<T>(category);
+		if (_configVersions[(int)category].load(std::memory_order_acquire) == snapshot._version) [[likely]] {
+			return false;
+		}
+
+		auto lock = _configLock.AcquireSafe();
+		snapshot._config = config;
+		snapshot._version = _configVersions[(int)category];
+		return true;
+	}
+
 	void SetShortcutKeys(const vector<ShortcutKeyInfo>& shortcuts);
 	KeyCombination GetShortcutKey(EmulatorShortcut shortcut, int keySetIndex);
 	vector<KeyCombination> GetShortcutSupersets(EmulatorShortcut shortcut, int keySetIndex);
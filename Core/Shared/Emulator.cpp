@@ -23,8 +23,15 @@
 #include "Shared/SystemActionManager.h"
 #include "Shared/TimingInfo.h"
 #include "Shared/HistoryViewer.h"
+#include "Shared/GreenzoneManager.h"
+#include "Shared/FrameProfiler.h"
+#include "Shared/MemoryUsageRegistry.h"
 #include "Netplay/GameServer.h"
 #include "Netplay/GameClient.h"
+#include "Netplay/NetplayRollback.h"
+#include "Shared/LinkCable.h"
+#include "Shared/SharedMemoryExport.h"
+#include "Shared/AllocationTracker.h"
 #include "Shared/Interfaces/IConsole.h"
 #include "Shared/Interfaces/IBarcodeReader.h"
 #include "Shared/Interfaces/ITapeRecorder.h"
@@ -52,7 +59,8 @@
 #include "Shared/EventType.h"
 
 // Initialize emulator with all core subsystems
-Emulator::Emulator() : _settings(new EmuSettings(this)),
+Emulator::Emulator() : _memoryUsage(new MemoryUsageRegistry()),              // Memory footprint reporters
+                       _settings(new EmuSettings(this)),
                        _debugHud(new DebugHud()),           // Debug overlay rendering
                        _scriptHud(new DebugHud()),          // Script-driven overlay rendering
                        _notificationManager(new NotificationManager()),  // Event notification system
@@ -64,6 +72,9 @@ Emulator::Emulator() : _settings(new EmuSettings(this)),
                        _cheatManager(new CheatManager(this)),            // Cheat code handling
                        _movieManager(new MovieManager(this)),            // Movie recording/playback
                        _historyViewer(new HistoryViewer(this)),          // Rewind history viewer
+                       _greenzoneManager(new GreenzoneManager()),        // TAS editor savestate cache
+                       _frameProfiler(new FrameProfiler()),              // Per-frame time breakdown
+                       _frameLimiter(new FrameLimiter(0)),               // Frame pacing
                        _gameServer(new GameServer(this)),                // Netplay server
                        _gameClient(new GameClient(this)),                // Netplay client
                        _rewindManager(new RewindManager(this)) {         // Rewind state management
@@ -78,9 +89,19 @@ Emulator::Emulator() : _settings(new EmuSettings(this)),
 	_blockDebuggerRequestCount = 0;
 
 	_videoDecoder->Init();
+
+	_memoryUsage->Register("Emulator", this);
+	_memoryUsage->Register("Rewind", _rewindManager.get());
+	_memoryUsage->Register("Greenzone", _greenzoneManager.get());
+	_memoryUsage->Register("Audio", _soundMixer.get());
+	_memoryUsage->Register("Video decoder", _videoDecoder.get());
+	_memoryUsage->Register("Video renderer", _videoRenderer.get());
 }
 
 Emulator::~Emulator() {
+	if (_linkCablePort) {
+		_linkCablePort->SetAttached(false);
+	}
 }
 
 void Emulator::Initialize(bool enableShortcuts) {
@@ -90,8 +111,26 @@ void Emulator::Initialize(bool enableShortcuts) {
 		_notificationManager->RegisterNotificationListener(_shortcutKeyHandler);
 	}
 
-	_videoDecoder->StartThread();
-	_videoRenderer->StartThread();
+	StartVideoThreads();
+}
+
+void Emulator::StartVideoThreads() {
+	if (!_headless) {
+		_videoDecoder->StartThread();
+		_videoRenderer->StartThread();
+	}
+}
+
+void Emulator::SetHeadless(bool headless) {
+	auto lock = AcquireLock();
+	_headless = headless;
+	_notificationManager->SetQueuedDeliveryEnabled(!headless);
+	if (headless) {
+		_videoDecoder->StopThread();
+		_videoRenderer->StopThread();
+	} else {
+		StartVideoThreads();
+	}
 }
 
 void Emulator::Release() {
@@ -118,29 +157,52 @@ void Emulator::Run() {
 
 	_stopFlag = false;
 	_isRunAheadFrame = false;
+	_renderCurrentFrame = _frameRenderRequested.exchange(false);
 
 	PlatformUtilities::EnableHighResolutionTimer();
 	PlatformUtilities::DisableScreensaver();
 
 	_emulationThreadId = std::this_thread::get_id();
+	AllocationTracker::TrackCurrentThread(true);
 
 	_frameDelay = GetFrameDelay();
 	_stats = std::make_unique<DebugStats>();
-	_frameLimiter = std::make_unique<FrameLimiter>(_frameDelay);
+	_frameLimiter->SetDelay(_frameDelay);
 	_lastFrameTimer.Reset();
 
 	while (!_stopFlag) {
+		// Only replaced while the emulation thread is paused in WaitForLock
+		shared_ptr<NetplayRollback> rollback = _netplayRollback;
+
+		bool frameDone = true;
 		bool useRunAhead = _settings->GetEmulationConfig().RunAheadFrames > 0 && !_debugger && !_audioPlayerHud && !_rewindManager->IsRewinding() && _settings->GetEmulationSpeed() > 0 && _settings->GetEmulationSpeed() <= 100;
-		if (useRunAhead) {
-			RunFrameWithRunAhead();
-		} else {
-			_console->RunFrame();
-			_rewindManager->ProcessEndOfFrame();
-			_historyViewer->ProcessEndOfFrame();
-			ProcessSystemActions();
+		uint32_t seekFrame = 0;
+		{
+			PROFILE_SCOPE(_frameProfiler.get(), ProfilerStage::Emulation);
+			if (rollback) {
+				frameDone = RunFrameWithRollback(*rollback);
+			} else if (_greenzoneManager->TakeSeekRequest(seekFrame)) {
+				ProcessGreenzoneSeek(seekFrame);
+				frameDone = false;
+			} else if (useRunAhead) {
+				RunFrameWithRunAhead();
+			} else {
+				_console->RunFrame();
+				_rewindManager->ProcessEndOfFrame();
+				_historyViewer->ProcessEndOfFrame();
+				if (!ProcessSystemActions()) {
+					ProcessGreenzoneFrame();
+				}
+			}
 		}
 
-		ProcessAutoSaveState();
+		if (frameDone) {
+			ProcessAutoSaveState();
+			ProcessSaveDataFlush();
+			_frameProfiler->EndFrame(_settings->GetPreferences().ShowDebugInfo);
+			SimpleLock::SetTelemetryEnabled(_settings->GetPreferences().ShowDebugInfo);
+			AllocationTracker::EndFrame();
+		}
 
 		WaitForLock();
 
@@ -155,6 +217,7 @@ void Emulator::Run() {
 	}
 
 	_emulationThreadId = thread::id();
+	AllocationTracker::TrackCurrentThread(false);
 
 	if (_runLock.IsLockedByCurrentThread()) {
 		// Lock might not be held by current frame is _stopFlag was set to interrupt the thread
@@ -179,6 +242,23 @@ void Emulator::ProcessAutoSaveState() {
 	}
 }
 
+void Emulator::ProcessSaveDataFlush() {
+	if (_saveDataFlushFrameCounter > 0) {
+		_saveDataFlushFrameCounter--;
+		if (_saveDataFlushFrameCounter == 0 && _batteryManager->HasBattery()) {
+			// Only copies the save data that changed, the files are written by the battery manager's thread
+			_batteryManager->BeginFlush();
+			_console->SaveBattery();
+			_batteryManager->EndFlush();
+		}
+	} else {
+		uint32_t flushDelay = _settings->GetPreferences().SaveDataFlushDelay;
+		if (flushDelay > 0) {
+			_saveDataFlushFrameCounter = (uint32_t)(GetFps() * flushDelay);
+		}
+	}
+}
+
 bool Emulator::ProcessSystemActions() {
 	if (_systemActionManager->IsResetPressed()) {
 		Reset();
@@ -197,19 +277,32 @@ bool Emulator::ProcessSystemActions() {
 }
 
 void Emulator::RunFrameWithRunAhead() {
-	// FastBinary serializer: positional read/write, no string keys, persistent buffer
-	_runAheadSerializer.ResetForFastSave(SaveStateManager::FileFormatVersion);
 	uint32_t frameCount = _settings->GetEmulationConfig().RunAheadFrames;
 
 	// Run a single frame and save the state (no audio/video)
 	_isRunAheadFrame = true;
 	_console->RunFrame();
-	_runAheadSerializer.Stream(_console, "");
-
-	while (frameCount > 1) {
-		// Run extra frames if the requested run ahead frame count is higher than 1
-		frameCount--;
-		_console->RunFrame();
+	SaveRunAheadState(_runAheadBase);
+
+	if (frameCount > 1 && _runAheadChain.size() == frameCount && _runAheadChain[0]->Matches(_runAheadBase)) {
+		// The authoritative frame ended in the same state as the first speculative frame of the
+		// previous pass (same input, nothing modified the state in between), so the rest of that
+		// pass is still valid: continue from its last state instead of re-running frameCount-1 frames
+		std::rotate(_runAheadChain.begin(), _runAheadChain.begin() + 1, _runAheadChain.end());
+		LoadRunAheadState(*_runAheadChain[frameCount - 2]);
+	} else if (frameCount > 1) {
+		// Misprediction (or first pass): run the extra frames, keeping the state after each one
+		_runAheadChain.resize(frameCount);
+		for (uint32_t i = 0; i < frameCount - 1; i++) {
+			_console->RunFrame();
+			if (!_runAheadChain[i]) {
+				_runAheadChain[i] = std::make_unique<RunAheadState>();
+			}
+			SaveRunAheadState(*_runAheadChain[i]);
+		}
+		if (!_runAheadChain.back()) {
+			_runAheadChain.back() = std::make_unique<RunAheadState>();
+		}
 	}
 	_isRunAheadFrame = false;
 
@@ -220,12 +313,180 @@ void Emulator::RunFrameWithRunAhead() {
 
 	bool wasReset = ProcessSystemActions();
 	if (!wasReset) {
+		_isRunAheadFrame = true;
+		if (frameCount > 1) {
+			// Keep the displayed state as the tip of the speculative chain
+			SaveRunAheadState(*_runAheadChain.back());
+		}
+
 		// Load the state we saved earlier
+		LoadRunAheadState(_runAheadBase);
+		_isRunAheadFrame = false;
+	} else {
+		_runAheadChain.clear();
+	}
+}
+
+bool Emulator::RunFrameWithRollback(NetplayRollback& rollback) {
+	uint32_t frame = rollback.GetFrame();
+	uint32_t rollbackFrame = rollback.ProcessReceivedInput();
+	if (rollbackFrame < frame) {
+		// Remote input was mispredicted: load the state saved before the first mispredicted frame,
+		// and run every frame since then again with the correct input (no audio/video)
 		_isRunAheadFrame = true;
-		_runAheadSerializer.ResetForFastLoad();
-		_runAheadSerializer.Stream(_console, "");
+		LoadRunAheadState(rollback.GetState(rollbackFrame));
+		for (uint32_t i = rollbackFrame; i < frame; i++) {
+			if (i > rollbackFrame) {
+				SaveRunAheadState(rollback.GetState(i));
+			}
+			rollback.BeginFrame(i);
+			_console->RunFrame();
+		}
 		_isRunAheadFrame = false;
 	}
+
+	rollback.ProcessChecksums();
+
+	if (!rollback.CanRunFrame()) {
+		// Too far ahead of a remote player, wait for their input (returns to WaitForLock/pause handling in between)
+		rollback.WaitForInput();
+		return false;
+	}
+
+	SaveRunAheadState(rollback.GetState(frame));
+	rollback.BeginFrame(frame);
+	_console->RunFrame();
+	rollback.EndFrame();
+	_rewindManager->ProcessEndOfFrame();
+	_historyViewer->ProcessEndOfFrame();
+
+	if (ProcessSystemActions()) {
+		// The saved states are from before the reset
+		rollback.ClearHistory();
+	}
+	return true;
+}
+
+void Emulator::ProcessGreenzoneFrame() {
+	if (!_greenzoneManager->IsEnabled()) {
+		return;
+	}
+
+	_greenzoneManager->SetPlayhead(_console->GetControlManager()->GetPollCounter());
+	CaptureGreenzoneState();
+}
+
+void Emulator::CaptureGreenzoneState() {
+	uint32_t frame = _console->GetControlManager()->GetPollCounter();
+	if (_greenzoneManager->NeedsState(frame)) {
+		unique_ptr<RunAheadState> state = std::make_unique<RunAheadState>();
+		SaveRunAheadState(*state);
+		_greenzoneManager->AddState(frame, std::move(state));
+	}
+}
+
+void Emulator::ProcessGreenzoneSeek(uint32_t frame) {
+	// Start from the closest state before the target, so at least the last frame is rendered
+	uint32_t stateFrame = 0;
+	RunAheadState* state = _greenzoneManager->FindState(frame > 0 ? frame - 1 : 0, stateFrame);
+	if (!state) {
+		return;
+	}
+
+	BaseControlManager* controlManager = _console->GetControlManager();
+	_greenzoneManager->SetPlayhead(frame);
+	_isRunAheadFrame = true;
+	LoadRunAheadState(*state);
+
+	// Give up if the game stops polling input (e.g it is stuck on a crash screen)
+	constexpr uint32_t maxFramesWithoutPoll = 600;
+	uint32_t framesWithoutPoll = 0;
+	uint32_t pollCounter = controlManager->GetPollCounter();
+	while (pollCounter < frame && framesWithoutPoll < maxFramesWithoutPoll && !_stopFlag) {
+		// Fill the gaps left by invalidated states on the way, only render the frame that reaches the target
+		CaptureGreenzoneState();
+		_isRunAheadFrame = pollCounter + 1 < frame;
+		_console->RunFrame();
+
+		uint32_t prevCounter = pollCounter;
+		pollCounter = controlManager->GetPollCounter();
+		framesWithoutPoll = pollCounter == prevCounter ? framesWithoutPoll + 1 : 0;
+	}
+	_isRunAheadFrame = false;
+	CaptureGreenzoneState();
+}
+
+void Emulator::SetNetplayRollback(shared_ptr<NetplayRollback> rollback) {
+	auto lock = AcquireLock();
+	_netplayRollback = rollback;
+}
+
+void Emulator::SetLinkCable(shared_ptr<LinkCable> cable, uint8_t side) {
+	auto lock = AcquireLock();
+	if (_linkCablePort) {
+		_linkCablePort->SetAttached(false);
+	}
+	_linkCable = cable;
+	_linkCablePort = cable ? cable->GetPort(side) : nullptr;
+	if (_linkCablePort) {
+		_linkCablePort->SetAttached(true);
+	}
+}
+
+bool Emulator::StartSharedMemoryExport(const string& name) {
+	shared_ptr<SharedMemoryExport> sharedExport = std::make_shared<SharedMemoryExport>();
+	if (!sharedExport->Start(name)) {
+		MessageManager::Log("[Export] Could not create shared memory block: " + name);
+		return false;
+	}
+	_sharedMemoryExport.reset(sharedExport);
+	MessageManager::Log("[Export] Publishing video and audio to shared memory block: " + name);
+	return true;
+}
+
+void Emulator::StopSharedMemoryExport() {
+	_sharedMemoryExport.reset();
+}
+
+bool Emulator::IsRenderSkipped(bool allowFrameSkip, Timer& frameSkipTimer, double frameSkipMaxMs) {
+	if (_isRunAheadFrame || IsHeadlessFrameSkipped()) {
+		return true;
+	}
+
+	uint32_t emulationSpeed = _settings->GetEmulationSpeed();
+	return (allowFrameSkip &&
+	        !_rewindManager->IsRewinding() &&
+	        !_videoRenderer->IsRecording() &&
+	        (emulationSpeed == 0 || emulationSpeed > 150) &&
+	        frameSkipTimer.GetElapsedMS() < frameSkipMaxMs);
+}
+
+void Emulator::SaveRunAheadState(RunAheadState& state) {
+	PROFILE_SCOPE(_frameProfiler.get(), ProfilerStage::RunAheadSave);
+	// FastBinary serializer: positional read/write, no string keys, persistent buffer
+	// Large RAM blocks bypass the serializer and only their dirtied pages are copied
+	state.Data.ResetForFastSave(SaveStateManager::FileFormatVersion);
+	state.Ram.BeginSave(state.Data, GetRunAheadSnapshotBlocks());
+	state.Data.Stream(_console, "");
+	state.Ram.EndSave(state.Data);
+}
+
+void Emulator::LoadRunAheadState(RunAheadState& state) {
+	PROFILE_SCOPE(_frameProfiler.get(), ProfilerStage::RunAheadLoad);
+	state.Ram.Restore();
+	state.Data.ResetForFastLoad();
+	state.Data.Stream(_console, "");
+}
+
+vector<SerializeValue> Emulator::GetRunAheadSnapshotBlocks() {
+	vector<SerializeValue> blocks;
+	magic_enum::enum_for_each<MemoryType>([&](MemoryType memType) {
+		ConsoleMemoryInfo& mem = _consoleMemory[(int)memType];
+		if (mem.Memory && mem.Size > 0 && !DebugUtilities::IsRom(memType)) {
+			blocks.emplace_back((uint8_t*)mem.Memory, mem.Size);
+		}
+	});
+	return blocks;
 }
 
 void Emulator::OnBeforeSendFrame() {
@@ -244,11 +505,16 @@ void Emulator::OnBeforeSendFrame() {
 
 void Emulator::ProcessEndOfFrame() {
 	if (!_isRunAheadFrame) {
-		_frameLimiter->ProcessFrame();
-		while (_frameLimiter->WaitForNextFrame()) {
-			if (_stopFlag || _frameDelay != GetFrameDelay() || _paused || _pauseOnNextFrame || _lockCounter > 0) {
-				// Need to process another event, stop sleeping
-				break;
+		{
+			PROFILE_SCOPE(_frameProfiler.get(), ProfilerStage::FrameLimiter);
+			// Align with the renderer's presents when it waits for vsync (not when fast forwarding/slowed down)
+			_frameLimiter->SetPresentAlignment(_settings->GetVideoConfig().VerticalSync && _settings->GetEmulationSpeed() == 100);
+			_frameLimiter->ProcessFrame();
+			while (_frameLimiter->WaitForNextFrame()) {
+				if (_stopFlag || _frameDelay != GetFrameDelay() || _paused || _pauseOnNextFrame || _lockCounter > 0) {
+					// Need to process another event, stop sleeping
+					break;
+				}
 			}
 		}
 
@@ -259,6 +525,16 @@ void Emulator::ProcessEndOfFrame() {
 		}
 
 		_console->GetControlManager()->ProcessEndOfFrame();
+
+		// Headless mode: a frame requested during this frame is rendered next
+		_renderCurrentFrame = _frameRenderRequested.exchange(false);
+	}
+	if (_heatmapRecorder) {
+		if (_isRunAheadFrame) {
+			_heatmapRecorder->DiscardFrame();
+		} else {
+			_heatmapRecorder->EndFrame(GetFrameCount());
+		}
 	}
 	_frameRunning = false;
 }
@@ -282,6 +558,9 @@ void Emulator::Stop(bool sendNotification, bool preventRecentGameSave, bool save
 		_emuThread.release();
 	}
 
+	// Closes the file, once the emulation thread is done with the recorder
+	StopMemoryHeatmap();
+
 	if (_console && saveBattery) {
 		// Only save battery on power off, otherwise SaveBattery() is called by LoadRom()
 		_console->SaveBattery();
@@ -303,7 +582,13 @@ void Emulator::Stop(bool sendNotification, bool preventRecentGameSave, bool save
 
 	_movieManager->Stop();
 	_videoDecoder->StopThread();
+	if (_console) {
+		_rewindManager->PersistHistory();
+	}
 	_rewindManager->Reset();
+	_greenzoneManager->Clear();
+	_runAheadBase.Ram.Reset();
+	_runAheadChain.clear();
 
 	if (_console) {
 		_console.reset();
@@ -311,6 +596,9 @@ void Emulator::Stop(bool sendNotification, bool preventRecentGameSave, bool save
 
 	OnBeforePause(true);
 
+	// The game selection screen shown on EmulationStopped lists the recent game files
+	_videoDecoder->WaitForPendingScreenshots();
+
 	if (sendNotification) {
 		_notificationManager->SendNotification(ConsoleNotificationType::EmulationStopped);
 	}
@@ -369,8 +657,7 @@ bool Emulator::LoadRom(VirtualFile romFile, VirtualFile patchFile, bool stopRom,
 	try {
 		result = InternalLoadRom(romFile, patchFile, stopRom, forPowerCycle);
 	} catch (std::exception& ex) {
-		_videoDecoder->StartThread();
-		_videoRenderer->StartThread();
+		StartVideoThreads();
 
 		MessageManager::DisplayMessage("Error", "UnexpectedError", ex.what());
 		Stop(false, true, false);
@@ -446,6 +733,7 @@ bool Emulator::InternalLoadRom(VirtualFile romFile, VirtualFile patchFile, bool
 		MessageManager::DisplayMessage("Error", "CouldNotLoadFile", romFile.GetFileName());
 		if (debugger) {
 			_debugger.reset(debugger);
+			UpdateDebugHooks();
 			debugger->ResetSuspendCounter();
 		}
 		_blockDebuggerRequestCount--;
@@ -495,6 +783,9 @@ bool Emulator::InternalLoadRom(VirtualFile romFile, VirtualFile patchFile, bool
 
 	_rewindManager->InitHistory();
 
+	// The saved states point to the previous console's memory
+	_greenzoneManager->Clear();
+
 	if (debuggerActive || _settings->CheckFlag(EmulationFlags::ConsoleMode)) {
 		InitDebugger();
 	}
@@ -508,6 +799,7 @@ bool Emulator::InternalLoadRom(VirtualFile romFile, VirtualFile patchFile, bool
 	_console->GetControlManager()->UpdateInputState();
 
 	_autoSaveStateFrameCounter = 0;
+	_saveDataFlushFrameCounter = 0;
 
 	// Mark the thread as paused, and release the debugger lock to avoid
 	// deadlocks with DebugBreakHelper if GameLoaded event starts the debugger
@@ -532,8 +824,7 @@ bool Emulator::InternalLoadRom(VirtualFile romFile, VirtualFile patchFile, bool
 		MessageManager::DisplayMessage(modelName, FolderUtilities::GetFilename(GetRomInfo().RomFile.GetFileName(), false));
 	}
 
-	_videoDecoder->StartThread();
-	_videoRenderer->StartThread();
+	StartVideoThreads();
 
 	if (stopRom) {
 		_stopFlag = false;
@@ -549,7 +840,7 @@ void Emulator::InitConsole(unique_ptr<IConsole>& newConsole, ConsoleMemoryInfo o
 		magic_enum::enum_for_each<MemoryType>([&](MemoryType memType) {
 			if (DebugUtilities::IsRom(memType)) {
 				uint32_t orgSize = originalConsoleMemory[(int)memType].Size;
-				if (orgSize > 0 && GetMemory(memType).Size == orgSize) {
+				if (orgSize > 0 && GetMemory(memType).Size == orgSize && !GetMemory(memType).Shared && !originalConsoleMemory[(int)memType].Shared) {
 					memcpy(_consoleMemory[(int)memType].Memory, originalConsoleMemory[(int)memType].Memory, orgSize);
 				}
 			}
@@ -802,7 +1093,7 @@ void Emulator::WaitForPauseEnd() {
 	PlatformUtilities::EnableScreensaver();
 	PlatformUtilities::RestoreTimerResolution();
 
-	while (_paused && !_rewindManager->IsRewinding() && !_stopFlag && !_debugger) {
+	while (_paused && !_rewindManager->IsRewinding() && !_greenzoneManager->IsSeekPending() && !_stopFlag && !_debugger) {
 		// Sleep until emulation is resumed
 		std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(30));
 
@@ -899,7 +1190,18 @@ DeserializeResult Emulator::Deserialize(istream& in, uint32_t fileFormatVersion,
 	if (!s.LoadFrom(in)) {
 		return DeserializeResult::InvalidFile;
 	}
+	return Deserialize(s, includeSettings, srcConsoleType, sendNotification);
+}
+
+DeserializeResult Emulator::Deserialize(const vector<uint8_t>& stateData, uint32_t fileFormatVersion, optional<ConsoleType> srcConsoleType, bool sendNotification) {
+	Serializer s(fileFormatVersion, false);
+	if (!s.LoadFromBuffer(stateData)) {
+		return DeserializeResult::InvalidFile;
+	}
+	return Deserialize(s, false, srcConsoleType, sendNotification);
+}
 
+DeserializeResult Emulator::Deserialize(Serializer& s, bool includeSettings, optional<ConsoleType> srcConsoleType, bool sendNotification) {
 	if (includeSettings) {
 		SV(_settings);
 	}
@@ -1017,10 +1319,12 @@ void Emulator::ResetDebugger(bool startDebugger) {
 
 	if (_emulationThreadId == std::this_thread::get_id()) {
 		_debugger.reset(startDebugger ? new Debugger(this, _console.get()) : nullptr);
+		UpdateDebugHooks();
 	} else {
 		// Need to pause emulator to change _debugger (when not called from the emulation thread)
 		auto emuLock = AcquireLock();
 		_debugger.reset(startDebugger ? new Debugger(this, _console.get()) : nullptr);
+		UpdateDebugHooks();
 	}
 }
 
@@ -1096,6 +1400,7 @@ void Emulator::StartLightweightCdl() {
 		FolderUtilities::GetFilename(_rom.RomFile.GetFileName(), false) + ".cdl"
 	);
 	_cdlRecorder->LoadCdlFile(cdlFilePath);
+	UpdateDebugHooks();
 
 	MessageManager::Log("[LightweightCDL] Started recording for " + _rom.RomFile.GetFileName());
 }
@@ -1114,6 +1419,42 @@ void Emulator::StopLightweightCdl() {
 
 	MessageManager::Log("[LightweightCDL] Stopped recording, CDL saved.");
 	_cdlRecorder.reset();
+	UpdateDebugHooks();
+}
+
+bool Emulator::StartMemoryHeatmap(const string& path) {
+	auto lock = AcquireLock();
+	if (!_console) {
+		return false;
+	}
+
+	unique_ptr<MemoryHeatmapRecorder> recorder = std::make_unique<MemoryHeatmapRecorder>(_console->GetCpuTypes()[0], path);
+	if (!recorder->IsOpen()) {
+		return false;
+	}
+	_heatmapRecorder = std::move(recorder);
+	UpdateDebugHooks();
+	return true;
+}
+
+void Emulator::StopMemoryHeatmap() {
+	if (!_heatmapRecorder) {
+		return;
+	}
+
+	auto lock = AcquireLock();
+	_heatmapRecorder.reset();
+	UpdateDebugHooks();
+}
+
+bool Emulator::ExportLightweightCdl(const string& path) {
+	auto lock = AcquireLock();
+	return _cdlRecorder && _cdlRecorder->SaveCompactCdlFile(path);
+}
+
+bool Emulator::MergeLightweightCdl(const string& path) {
+	auto lock = AcquireLock();
+	return _cdlRecorder && _cdlRecorder->MergeCdlFile(path);
 }
 
 void Emulator::SetStopCode(int32_t stopCode) {
@@ -1132,10 +1473,48 @@ void Emulator::SetStopCode(int32_t stopCode) {
 	}
 }
 
+void Emulator::ReportMemoryUsage(MemoryUsageNode& node) {
+	if (IsRunning()) {
+		// Memory types are registered by the console (absolute memory only, relative types are views into them)
+		MemoryUsageNode& consoleMemory = node.Add("Console memory");
+		uint64_t romSize = 0;
+		uint64_t videoRamSize = 0;
+		uint64_t ramSize = 0;
+		for (int i = 0; i < DebugUtilities::GetMemoryTypeCount(); i++) {
+			MemoryType memType = (MemoryType)i;
+			if (!_consoleMemory[i].Memory || DebugUtilities::IsRelativeMemory(memType)) {
+				continue;
+			}
+			if (DebugUtilities::IsRom(memType)) {
+				romSize += _consoleMemory[i].Size;
+			} else if (DebugUtilities::IsPpuMemory(memType)) {
+				videoRamSize += _consoleMemory[i].Size;
+			} else {
+				ramSize += _consoleMemory[i].Size;
+			}
+		}
+		consoleMemory.Add("ROM", romSize);
+		consoleMemory.Add("Video RAM", videoRamSize);
+		consoleMemory.Add("RAM", ramSize);
+	}
+
+	uint64_t runAheadSize = _runAheadBase.GetMemoryUsage();
+	for (unique_ptr<RunAheadState>& state : _runAheadChain) {
+		if (state) {
+			runAheadSize += state->GetMemoryUsage();
+		}
+	}
+	node.Add("Run-ahead states", runAheadSize);
+}
+
 void Emulator::RegisterMemory(MemoryType type, void* memory, uint32_t size) {
 	_consoleMemory[(int)type] = {memory, size};
 }
 
+void Emulator::RegisterSharedMemory(MemoryType type, const void* memory, uint32_t size) {
+	_consoleMemory[(int)type] = {const_cast<void*>(memory), size, true};
+}
+
 ConsoleMemoryInfo Emulator::GetMemory(MemoryType type) {
 	return _consoleMemory[(int)type];
 }
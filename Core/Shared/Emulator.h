@@ -5,7 +5,10 @@
 #include "Core/Debugger/DebugUtilities.h"
 #include "Core/Shared/EmulatorLock.h"
 #include "Core/Shared/Interfaces/IConsole.h"
+#include "Core/Shared/Interfaces/IMemoryUsageReporter.h"
 #include "Core/Shared/LightweightCdlRecorder.h"
+#include "Core/Shared/MemoryHeatmapRecorder.h"
+#include "Core/Shared/RunAheadSnapshot.h"
 #include "Core/Shared/Audio/AudioPlayerTypes.h"
 #include "Utilities/Timer.h"
 #include "Utilities/safe_ptr.h"
@@ -26,7 +29,10 @@ class BatteryManager;
 class CheatManager;
 class MovieManager;
 class HistoryViewer;
+class GreenzoneManager;
+class FrameProfiler;
 class FrameLimiter;
+class MemoryUsageRegistry;
 class DebugStats;
 class BaseControlManager;
 class VirtualFile;
@@ -36,6 +42,10 @@ class SystemActionManager;
 class AudioPlayerHud;
 class GameServer;
 class GameClient;
+class NetplayRollback;
+class LinkCable;
+class LinkCablePort;
+class SharedMemoryExport;
 
 class IInputRecorder;
 class IInputProvider;
@@ -53,8 +63,9 @@ enum class TapeRecorderAction;
 
 /// <summary>Memory region information for debugger access</summary>
 struct ConsoleMemoryInfo {
-	void* Memory;  ///< Pointer to memory region
-	uint32_t Size; ///< Size in bytes
+	void* Memory;        ///< Pointer to memory region
+	uint32_t Size;       ///< Size in bytes
+	bool Shared = false; ///< Read-only buffer shared with other instances (SharedRomCache), must not be written to
 };
 
 /// <summary>
@@ -95,10 +106,15 @@ struct ConsoleMemoryInfo {
 /// - Run-ahead support: Speculative execution for input lag reduction
 /// - Frame limiting: Precise timing via FrameLimiter
 /// </remarks>
-class Emulator {
+class Emulator : public IMemoryUsageReporter {
 private:
 	friend class DebuggerRequest;
 	friend class EmulatorLock;
+	friend class BranchExplorer;
+	friend class FrameBenchmark;
+
+	/// <summary>Memory footprint reporters (first member, so it outlives everything that unregisters from it)</summary>
+	const unique_ptr<MemoryUsageRegistry> _memoryUsage;
 
 	// Subsystems (unique_ptr = owned, shared_ptr = shared, safe_ptr = thread-safe)
 	unique_ptr<thread> _emuThread;              ///< Emulation worker thread
@@ -108,7 +124,10 @@ private:
 	shared_ptr<ShortcutKeyHandler> _shortcutKeyHandler;   ///< Keyboard shortcuts
 	safe_ptr<Debugger> _debugger;                         ///< Debugger (optional, created on demand)
 	unique_ptr<LightweightCdlRecorder> _cdlRecorder;      ///< Lightweight CDL recorder (no debugger overhead)
+	unique_ptr<MemoryHeatmapRecorder> _heatmapRecorder;   ///< Per-page access counts streamed to a file (no debugger overhead)
+	bool _hasDebugHooks = false;                          ///< _debugger || _cdlRecorder || _heatmapRecorder, single test for the per-access hooks
 	shared_ptr<SystemActionManager> _systemActionManager; ///< System action queue
+	safe_ptr<SharedMemoryExport> _sharedMemoryExport;     ///< Frame/audio export to shared memory (optional)
 
 	const unique_ptr<EmuSettings> _settings;                    ///< Global settings
 	const unique_ptr<DebugHud> _debugHud;                       ///< Debug overlay (FPS, lag, etc.)
@@ -122,6 +141,9 @@ private:
 	const unique_ptr<CheatManager> _cheatManager;               ///< Cheat code support
 	const unique_ptr<MovieManager> _movieManager;               ///< TAS recording/playback
 	const unique_ptr<HistoryViewer> _historyViewer;
+	const unique_ptr<GreenzoneManager> _greenzoneManager;
+	const unique_ptr<FrameProfiler> _frameProfiler;       ///< Per-frame time breakdown (debug stats)
+	const unique_ptr<FrameLimiter> _frameLimiter;         ///< Frame pacing (kept between runs for its statistics)
 
 	const shared_ptr<GameServer> _gameServer;
 	const shared_ptr<GameClient> _gameClient;
@@ -131,10 +153,10 @@ private:
 	thread::id _emulationThreadId;
 
 	atomic<uint32_t> _lockCounter;
-	SimpleLock _runLock;
-	SimpleLock _loadLock;
+	SimpleLock _runLock{"Emulator run"};
+	SimpleLock _loadLock{"Emulator load"};
 
-	SimpleLock _debuggerLock;
+	SimpleLock _debuggerLock{"Debugger"};
 	atomic<bool> _stopFlag;
 	atomic<bool> _paused;
 	atomic<bool> _pauseOnNextFrame;
@@ -146,8 +168,23 @@ private:
 	atomic<bool> _isRunAheadFrame;
 	bool _frameRunning = false;
 
-	/// <summary>Persistent FastBinary serializer for run-ahead (eliminates all string key overhead + buffer reuse)</summary>
-	Serializer _runAheadSerializer;
+	/// <summary>Headless mode: no video/audio output, frames are only rendered on request (see SetHeadless)</summary>
+	bool _headless = false;
+	atomic<bool> _frameRenderRequested = false; ///< Set by RequestFrameRender(), applies to the next frame
+	bool _renderCurrentFrame = false;           ///< Headless mode: the current frame was requested and is rendered
+
+	/// <summary>Authoritative run-ahead state (FastBinary serializer + page-tracked RAM, buffers reused every frame)</summary>
+	RunAheadState _runAheadBase;
+
+	/// <summary>States after each speculative frame of the last run-ahead pass (index 0 = 1 frame ahead)</summary>
+	vector<unique_ptr<RunAheadState>> _runAheadChain;
+
+	/// <summary>Rollback netplay state (set by GameServer/GameClient, only replaced while the emulation is paused)</summary>
+	shared_ptr<NetplayRollback> _netplayRollback;
+
+	/// <summary>Link cable to another instance (only replaced while the emulation is paused)</summary>
+	shared_ptr<LinkCable> _linkCable;
+	LinkCablePort* _linkCablePort = nullptr;
 
 	RomInfo _rom;
 	ConsoleType _consoleType = {};
@@ -155,11 +192,11 @@ private:
 	ConsoleMemoryInfo _consoleMemory[DebugUtilities::GetMemoryTypeCount()] = {};
 
 	unique_ptr<DebugStats> _stats;
-	unique_ptr<FrameLimiter> _frameLimiter;
 	Timer _lastFrameTimer;
 	double _frameDelay = 0;
 
 	uint32_t _autoSaveStateFrameCounter = 0;
+	uint32_t _saveDataFlushFrameCounter = 0;
 	int32_t _stopCode = 0;
 	bool _stopRequested = false;
 
@@ -167,11 +204,25 @@ private:
 	void WaitForPauseEnd();
 
 	void ProcessAutoSaveState();
+	void ProcessSaveDataFlush();
 	bool ProcessSystemActions();
 	void RunFrameWithRunAhead();
+	bool RunFrameWithRollback(NetplayRollback& rollback);
+	void ProcessGreenzoneFrame();
+	void CaptureGreenzoneState();
+	void ProcessGreenzoneSeek(uint32_t frame);
+	vector<SerializeValue> GetRunAheadSnapshotBlocks();
+	void SaveRunAheadState(RunAheadState& state);
+	void LoadRunAheadState(RunAheadState& state);
+	DeserializeResult Deserialize(Serializer& s, bool includeSettings, optional<ConsoleType> consoleType, bool sendNotification);
 
 	void BlockDebuggerRequests();
 	void ResetDebugger(bool startDebugger = false);
+	void UpdateDebugHooks() { _hasDebugHooks = _debugger || _cdlRecorder || _heatmapRecorder; }
+	void StartVideoThreads();
+
+	/// <summary>Headless mode, frames nobody asked for (the debugger and scripts can read the screen at any time)</summary>
+	[[nodiscard]] bool IsHeadlessFrameSkipped() { return _headless && !_renderCurrentFrame && !_hasDebugHooks; }
 
 	double GetFrameDelay();
 
@@ -319,6 +370,16 @@ public:
 	/// <returns>Deserialization result</returns>
 	[[nodiscard]] DeserializeResult Deserialize(istream& in, uint32_t fileFormatVersion, bool includeSettings, optional<ConsoleType> consoleType = std::nullopt, bool sendNotification = true);
 
+	/// <summary>
+	/// Deserialize emulator state from an uncompressed in-memory state (see SerializeToBuffer).
+	/// </summary>
+	/// <param name="stateData">Uncompressed serializer data</param>
+	/// <param name="fileFormatVersion">Save state file format version</param>
+	/// <param name="consoleType">Expected console type (for validation)</param>
+	/// <param name="sendNotification">Send StateLoaded notification if true</param>
+	/// <returns>Deserialization result</returns>
+	[[nodiscard]] DeserializeResult Deserialize(const vector<uint8_t>& stateData, uint32_t fileFormatVersion, optional<ConsoleType> consoleType = std::nullopt, bool sendNotification = true);
+
 	// Subsystem accessors (getters return raw pointers for performance)
 
 	/// <summary>Get sound mixer</summary>
@@ -364,12 +425,44 @@ public:
 	/// <summary>Get history viewer</summary>
 	HistoryViewer* GetHistoryViewer() { return _historyViewer.get(); }
 
+	/// <summary>Get TAS editor greenzone (savestate cache)</summary>
+	GreenzoneManager* GetGreenzoneManager() { return _greenzoneManager.get(); }
+
+	/// <summary>Get per-frame time breakdown (see PROFILE_SCOPE)</summary>
+	FrameProfiler* GetFrameProfiler() { return _frameProfiler.get(); }
+
+	/// <summary>Get frame limiter (frame pacing statistics)</summary>
+	FrameLimiter* GetFrameLimiter() { return _frameLimiter.get(); }
+
+	/// <summary>Get memory usage registry (memory footprint of the subsystems)</summary>
+	MemoryUsageRegistry* GetMemoryUsageRegistry() { return _memoryUsage.get(); }
+
+	/// <summary>Report console memory and run-ahead states (IMemoryUsageReporter)</summary>
+	void ReportMemoryUsage(MemoryUsageNode& node) override;
+
 	/// <summary>Get netplay server</summary>
 	GameServer* GetGameServer() { return _gameServer.get(); }
 
 	/// <summary>Get netplay client</summary>
 	GameClient* GetGameClient() { return _gameClient.get(); }
 
+	/// <summary>Enable rollback netplay (null to disable), the emulation then runs frames through NetplayRollback</summary>
+	void SetNetplayRollback(shared_ptr<NetplayRollback> rollback);
+
+	/// <summary>Plugs this instance into one side (0 or 1) of a link cable (null to unplug), see LinkCable::Connect</summary>
+	void SetLinkCable(shared_ptr<LinkCable> cable, uint8_t side);
+
+	/// <summary>Link cable port for the serial ports (null when no cable is plugged in)</summary>
+	[[nodiscard]] LinkCablePort* GetLinkCablePort() { return _linkCablePort; }
+
+	/// <summary>Starts publishing the presented frames and the mixed audio to a named shared memory block (see SharedMemoryExport)</summary>
+	bool StartSharedMemoryExport(const string& name);
+	void StopSharedMemoryExport();
+
+	/// <summary>Fast check for the video/audio output paths (not thread-safe, use GetSharedMemoryExport to publish)</summary>
+	[[nodiscard]] bool IsSharedMemoryExportActive() { return (bool)_sharedMemoryExport; }
+	[[nodiscard]] shared_ptr<SharedMemoryExport> GetSharedMemoryExport() { return _sharedMemoryExport.lock(); }
+
 	/// <summary>Get system action manager</summary>
 	shared_ptr<SystemActionManager> GetSystemActionManager() { return _systemActionManager; }
 
@@ -412,6 +505,9 @@ public:
 	/// <summary>Check if debugger active</summary>
 	[[nodiscard]] bool IsDebugging() { return !!_debugger; }
 
+	/// <summary>Check if the per-access hooks (debugger, CDL or heatmap recording) need to see each memory access</summary>
+	[[nodiscard]] bool HasDebugHooks() { return _hasDebugHooks; }
+
 	/// <summary>Get debugger instance (unsafe - use GetDebugger() for RAII instead)</summary>
 	Debugger* InternalGetDebugger() { return _debugger.get(); }
 
@@ -423,6 +519,18 @@ public:
 	/// <summary>Stop lightweight CDL recording.</summary>
 	void StopLightweightCdl();
 
+	/// <summary>Export the lightweight CDL data to a compact (compressed) file.</summary>
+	[[nodiscard]] bool ExportLightweightCdl(const string& path);
+
+	/// <summary>Merge a CDL file (standard or compact) into the lightweight CDL data, e.g the coverage of other runs.</summary>
+	[[nodiscard]] bool MergeLightweightCdl(const string& path);
+
+	/// <summary>Start streaming per-page memory access counts of the main CPU to a file (see MemoryHeatmapRecorder).</summary>
+	[[nodiscard]] bool StartMemoryHeatmap(const string& path);
+
+	/// <summary>Stop the memory access heatmap recording and close its file.</summary>
+	void StopMemoryHeatmap();
+
 	/// <summary>Check if lightweight CDL recording is active.</summary>
 	[[nodiscard]] bool IsLightweightCdlActive() { return !!_cdlRecorder; }
 
@@ -449,6 +557,9 @@ public:
 	/// <param name="size">Size in bytes</param>
 	void RegisterMemory(MemoryType type, void* memory, uint32_t size);
 
+	/// <summary>Register a read-only ROM buffer shared with other instances (see SharedRomCache)</summary>
+	void RegisterSharedMemory(MemoryType type, const void* memory, uint32_t size);
+
 	/// <summary>Get registered memory region</summary>
 	[[nodiscard]] ConsoleMemoryInfo GetMemory(MemoryType type);
 
@@ -467,6 +578,31 @@ public:
 	/// <summary>Check if currently executing run-ahead frame</summary>
 	[[nodiscard]] bool IsRunAheadFrame() { return _isRunAheadFrame; }
 
+	/// <summary>
+	/// Render-skip check shared by all PPUs, called when a frame starts: when true, the PPU skips its frame
+	/// buffer writes for that frame, but still runs everything that affects emulation (timing, IRQs,
+	/// sprite 0 hit/overflow, collision flags, etc.)
+	/// </summary>
+	/// <param name="allowFrameSkip">Frame skipping is supported and enabled for this console</param>
+	/// <param name="frameSkipTimer">PPU timer, reset whenever the PPU sends a rendered frame</param>
+	/// <param name="frameSkipMaxMs">Frames are only skipped until this much time has passed since the last rendered frame</param>
+	/// <returns>True for run-ahead frames (never displayed), and for frames dropped while fast-forwarding</returns>
+	[[nodiscard]] bool IsRenderSkipped(bool allowFrameSkip, Timer& frameSkipTimer, double frameSkipMaxMs);
+
+	/// <summary>Render-skip check for PPUs without frame skipping (only run-ahead frames and unrequested headless frames are skipped)</summary>
+	[[nodiscard]] bool IsRenderSkipped() { return _isRunAheadFrame || IsHeadlessFrameSkipped(); }
+
+	/// <summary>
+	/// Headless mode (no video output, e.g test runner): the video decoder and renderer threads are stopped, the PPUs
+	/// skip rendering, and the audio is not mixed when there is no audio device. Only the frames requested with
+	/// RequestFrameRender() are rendered and decoded (synchronously), everything that affects emulation still runs.
+	/// </summary>
+	void SetHeadless(bool headless);
+	[[nodiscard]] bool IsHeadless() { return _headless; }
+
+	/// <summary>Headless mode: renders the next frame (e.g for a screenshot or a frame hash), can be called from any thread</summary>
+	void RequestFrameRender() { _frameRenderRequested = true; }
+
 	/// <summary>Get timing info for CPU type</summary>
 	TimingInfo GetTimingInfo(CpuType cpuType);
 
@@ -500,6 +636,7 @@ public:
 
 	// Debugger hooks - templated for zero-cost abstraction when debugger disabled
 	// These are __forceinline and check if(_debugger) before calling, so they compile to nothing when not debugging
+	// The hooks that also serve the lightweight CDL recorder test _hasDebugHooks first, one branch instead of two
 
 	/// <summary>
 	/// Process CPU instruction for debugger (breakpoints, step, etc.).
@@ -509,10 +646,12 @@ public:
 	/// </remarks>
 	template <CpuType type>
 	__forceinline void ProcessInstruction() {
-		if (_debugger) [[unlikely]] {
-			_debugger->ProcessInstruction<type>();
-		} else if (_cdlRecorder) [[unlikely]] {
-			_cdlRecorder->RecordInstruction();
+		if (_hasDebugHooks) [[unlikely]] {
+			if (_debugger) {
+				_debugger->ProcessInstruction<type>();
+			} else if (_cdlRecorder) {
+				_cdlRecorder->RecordInstruction<type>();
+			}
 		}
 	}
 
@@ -525,10 +664,15 @@ public:
 	/// <typeparam name="flags">Memory access flags</typeparam>
 	template <CpuType type, uint8_t accessWidth = 1, MemoryAccessFlags flags = MemoryAccessFlags::None, typename T>
 	__forceinline void ProcessMemoryRead(uint32_t addr, T& value, MemoryOperationType opType) {
-		if (_debugger) [[unlikely]] {
-			_debugger->ProcessMemoryRead<type, accessWidth, flags>(addr, value, opType);
-		} else if (_cdlRecorder) [[unlikely]] {
-			_cdlRecorder->RecordRead(addr, DebugUtilities::GetCpuMemoryType(type), opType);
+		if (_hasDebugHooks) [[unlikely]] {
+			if (_heatmapRecorder) {
+				_heatmapRecorder->RecordRead<type>(addr, opType);
+			}
+			if (_debugger) {
+				_debugger->ProcessMemoryRead<type, accessWidth, flags>(addr, value, opType);
+			} else if (_cdlRecorder) {
+				_cdlRecorder->RecordRead<type>(addr, opType);
+			}
 		}
 	}
 
@@ -538,8 +682,13 @@ public:
 	/// <returns>True if write allowed, false if frozen by debugger</returns>
 	template <CpuType type, uint8_t accessWidth = 1, MemoryAccessFlags flags = MemoryAccessFlags::None, typename T>
 	__forceinline bool ProcessMemoryWrite(uint32_t addr, T& value, MemoryOperationType opType) {
-		if (_debugger) [[unlikely]] {
-			return _debugger->ProcessMemoryWrite<type, accessWidth, flags>(addr, value, opType);
+		if (_hasDebugHooks) [[unlikely]] {
+			if (_heatmapRecorder) {
+				_heatmapRecorder->RecordWrite<type>(addr, opType);
+			}
+			if (_debugger) {
+				return _debugger->ProcessMemoryWrite<type, accessWidth, flags>(addr, value, opType);
+			}
 		}
 		return true;
 	}
@@ -594,6 +743,16 @@ public:
 		}
 	}
 
+	/// <summary>
+	/// Process start/end of a DMA channel's transfer for debugger (coalesced script DMA callbacks).
+	/// </summary>
+	template <CpuType type>
+	__forceinline void ProcessDmaBurst(uint8_t channel, bool started) {
+		if (_debugger) [[unlikely]] {
+			_debugger->ProcessDmaBurst(type, channel, started);
+		}
+	}
+
 	/// <summary>
 	/// Process PPU cycle for debugger (scanline tracking).
 	/// </summary>
@@ -0,0 +1,99 @@
+#pragma once
+#include "pch.h"
+#include <algorithm>
+#include "Utilities/ISerializable.h"
+#include "Utilities/Serializer.h"
+
+/// <summary>
+/// Timestamped event queue for console cores: components schedule events at an absolute clock value
+/// instead of counting down a delay on every cycle.
+/// </summary>
+/// <remarks>
+/// Events are kept in a min-heap ordered by clock, and the clock of the earliest event is cached so the
+/// core's loop only needs a single comparison (IsEventDue) to know whether anything needs to be processed.
+/// The same event can be scheduled multiple times, each occurrence is dispatched separately.
+///
+/// Clocks are in whatever unit the core uses for its master clock, and must keep increasing for the
+/// lifetime of the scheduled events (save states keep the absolute values, so the clock must be saved too).
+/// </remarks>
+/// <typeparam name="TEvent">Event identifier (typically an enum), passed back to the handler</typeparam>
+template <typename TEvent>
+class EventScheduler final : public ISerializable {
+	static_assert(std::is_trivially_copyable<TEvent>::value, "EventScheduler events must be trivially copyable");
+
+private:
+	struct ScheduledEvent {
+		uint64_t Clock;
+		TEvent Event;
+	};
+
+	static bool IsLater(const ScheduledEvent& a, const ScheduledEvent& b) { return a.Clock > b.Clock; }
+
+	vector<ScheduledEvent> _events;
+	uint64_t _nextEventClock = UINT64_MAX;
+
+	void UpdateNextEventClock() {
+		_nextEventClock = _events.empty() ? UINT64_MAX : _events.front().Clock;
+	}
+
+public:
+	/// <summary>Schedules an event to be dispatched once the clock reaches the given value</summary>
+	void Schedule(uint64_t clock, TEvent evt) {
+		_events.push_back({clock, evt});
+		std::push_heap(_events.begin(), _events.end(), IsLater);
+		UpdateNextEventClock();
+	}
+
+	/// <summary>Removes every scheduled occurrence of the event</summary>
+	void Cancel(TEvent evt) {
+		auto it = std::remove_if(_events.begin(), _events.end(), [=](const ScheduledEvent& e) { return e.Event == evt; });
+		if (it != _events.end()) {
+			_events.erase(it, _events.end());
+			std::make_heap(_events.begin(), _events.end(), IsLater);
+			UpdateNextEventClock();
+		}
+	}
+
+	/// <summary>Pushes every scheduled event back by the given number of clocks (e.g while the component that counts them is paused)</summary>
+	void DelayEvents(uint64_t delay) {
+		for (ScheduledEvent& evt : _events) {
+			evt.Clock += delay;
+		}
+		UpdateNextEventClock();
+	}
+
+	void Clear() {
+		_events.clear();
+		_nextEventClock = UINT64_MAX;
+	}
+
+	[[nodiscard]] bool HasEvents() const { return !_events.empty(); }
+
+	/// <summary>Clock of the earliest scheduled event (UINT64_MAX when there are none)</summary>
+	[[nodiscard]] uint64_t GetNextEventClock() const { return _nextEventClock; }
+
+	/// <summary>True when at least one event is scheduled at or before the given clock (checked on every cycle, keep it cheap)</summary>
+	[[nodiscard]] bool IsEventDue(uint64_t clock) const { return clock >= _nextEventClock; }
+
+	/// <summary>Dispatches every event scheduled at or before the given clock, in clock order</summary>
+	/// <param name="clock">Current clock</param>
+	/// <param name="handler">Called with (event, scheduled clock), may schedule new events</param>
+	template <typename THandler>
+	void ProcessEvents(uint64_t clock, THandler&& handler) {
+		while (clock >= _nextEventClock) {
+			std::pop_heap(_events.begin(), _events.end(), IsLater);
+			ScheduledEvent evt = _events.back();
+			_events.pop_back();
+			UpdateNextEventClock();
+			handler(evt.Event, evt.Clock);
+		}
+	}
+
+	void Serialize(Serializer& s) override {
+		SVVector(_events);
+		if (!s.IsSaving()) {
+			std::make_heap(_events.begin(), _events.end(), IsLater);
+			UpdateNextEventClock();
+		}
+	}
+};
@@ -0,0 +1,126 @@
+#include "pch.h"
+#include "Shared/FrameBenchmark.h"
+#include "Shared/Emulator.h"
+#include "Shared/EmuSettings.h"
+#include "Shared/BatteryManager.h"
+#include "Shared/BaseControlManager.h"
+#include "Shared/BaseControlDevice.h"
+#include "Shared/RunAheadSnapshot.h"
+#include "Shared/AllocationTracker.h"
+#include "Shared/Interfaces/IConsole.h"
+#include "Shared/Interfaces/IInputProvider.h"
+#include "Utilities/StringUtilities.h"
+#include "Utilities/VirtualFile.h"
+
+/// <summary>Applies the scripted input to the controllers, in polling order</summary>
+struct FrameBenchmark::InputScript : public IInputProvider {
+	BaseControlManager* ControlManager = nullptr;
+	const vector<string>* Lines = nullptr;
+	uint32_t LastFrame = ~0u;
+	uint32_t DeviceIndex = 0;
+
+	bool SetInput(BaseControlDevice* device) override {
+		if (Lines->empty()) {
+			device->ClearState();
+			return true;
+		}
+
+		uint32_t frame = ControlManager->GetPollCounter();
+		if (frame != LastFrame) {
+			LastFrame = frame;
+			DeviceIndex = 0;
+		}
+
+		string_view line = (*Lines)[frame % Lines->size()];
+		if (!line.empty() && line.front() == '|') {
+			line.remove_prefix(1);
+		}
+		device->SetTextState(StringUtilities::GetNthSegmentView(line, '|', DeviceIndex));
+		DeviceIndex++;
+		return true;
+	}
+};
+
+bool FrameBenchmark::Run(const string& romFile, const FrameBenchmarkOptions& options, FrameBenchmarkResult& result) {
+	unique_ptr<Emulator> emu = std::make_unique<Emulator>();
+	emu->Initialize(false);
+	emu->GetSettings()->GetPreferences().RewindBufferSize = 0;
+
+	// Not stopping a previous game: the emulation thread isn't started, the frames are run below
+	if (!emu->LoadRom((VirtualFile)romFile, VirtualFile(), false)) {
+		emu->Release();
+		return false;
+	}
+
+	// No battery files for benchmark runs
+	emu->GetBatteryManager()->Initialize("");
+
+	// Don't wait for the video decoder/renderer, they would limit the output pass
+	emu->GetSettings()->SetFlag(EmulationFlags::MaximumSpeed);
+
+	InputScript script;
+	script.ControlManager = emu->_console->GetControlManager();
+	script.Lines = &options.Input;
+	emu->RegisterInputProvider(&script);
+
+	result = {};
+	result.Console = emu->GetConsoleType();
+	{
+		auto lock = emu->_runLock.AcquireSafe();
+		emu->_emulationThreadId = std::this_thread::get_id();
+
+		auto runFrames = [&](uint32_t count) {
+			for (uint32_t i = 0; i < count; i++) {
+				emu->_console->RunFrame();
+				if (AllocationTracker::IsTrackingCurrentThread() && AllocationTracker::TakeStats().Count > 0) {
+					result.AllocatingFrames++;
+				}
+			}
+		};
+
+		auto measure = [&](auto&& func) {
+			auto start = std::chrono::steady_clock::now();
+			func();
+			std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+			return options.FrameCount > 0 ? elapsed.count() / options.FrameCount : 0;
+		};
+
+		emu->_isRunAheadFrame = true;
+		runFrames(options.WarmupFrames);
+
+		RunAheadState start;
+		emu->SaveRunAheadState(start);
+
+		// Steady state: the measured frames shouldn't allocate
+		AllocationTracker::TrackCurrentThread(true);
+		result.EmulationTime = measure([&]() { runFrames(options.FrameCount); });
+
+		AllocationTracker::TrackCurrentThread(false);
+		emu->LoadRunAheadState(start);
+		emu->_isRunAheadFrame = false;
+		AllocationTracker::TrackCurrentThread(true);
+		double frameTime = measure([&]() { runFrames(options.FrameCount); });
+		result.OutputTime = std::max(0.0, frameTime - result.EmulationTime);
+		AllocationTracker::TrackCurrentThread(false);
+
+		emu->_isRunAheadFrame = true;
+		RunAheadState state;
+		result.SaveStateTime = measure([&]() {
+			for (uint32_t i = 0; i < options.FrameCount; i++) {
+				emu->SaveRunAheadState(state);
+			}
+		});
+		result.LoadStateTime = measure([&]() {
+			for (uint32_t i = 0; i < options.FrameCount; i++) {
+				emu->LoadRunAheadState(state);
+			}
+		});
+
+		emu->_isRunAheadFrame = false;
+		emu->_emulationThreadId = thread::id();
+	}
+
+	emu->UnregisterInputProvider(&script);
+	emu->Release();
+	return true;
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include "pch.h"
+#include "Shared/SettingTypes.h"
+
+/// <summary>Settings of a FrameBenchmark run</summary>
+struct FrameBenchmarkOptions {
+	uint32_t WarmupFrames = 120; ///< Frames run before measuring (boot, BIOS logos)
+	uint32_t FrameCount = 600;   ///< Frames measured in each pass
+
+	/// <summary>Scripted input, in the movie format (one line per input frame, looped), empty = no buttons pressed</summary>
+	vector<string> Input;
+};
+
+/// <summary>Time spent in each pass, in microseconds per frame</summary>
+struct FrameBenchmarkResult {
+	ConsoleType Console = ConsoleType::Snes;
+	double EmulationTime = 0; ///< RunFrame with audio/video skipped (CPUs, PPU, APU, coprocessors)
+	double OutputTime = 0;    ///< Extra cost of a frame with audio mixing and the video hand-off
+	double SaveStateTime = 0; ///< Run-ahead/rollback state save (SaveRunAheadState)
+	double LoadStateTime = 0; ///< Run-ahead/rollback state load (LoadRunAheadState)
+	uint32_t AllocatingFrames = 0; ///< Measured frames that made heap allocations (instrumented builds only, see AllocationTracker)
+
+	/// <summary>Frames per second of regular emulation (emulation + output)</summary>
+	[[nodiscard]] double GetFps() const {
+		double frameTime = EmulationTime + OutputTime;
+		return frameTime > 0 ? 1000000.0 / frameTime : 0;
+	}
+};
+
+/// <summary>
+/// Measures the cost of whole frames for a game, on a headless emulator (whole-system benchmark).
+/// </summary>
+/// <remarks>
+/// The game is loaded without an emulation thread, Run() drives it from the calling thread. After the
+/// warmup frames, the same frames are run in each pass (the starting state is restored between passes
+/// with the run-ahead serializer) so every pass measures the same workload:
+/// - emulation: frames run the way run-ahead runs its hidden frames (no audio/video)
+/// - output: regular frames, the difference with the emulation pass is the audio/video cost
+/// - save/load state: one state save and load per frame, the cost paid by rewind, run-ahead and rollback
+///
+/// Thread safety: an instance can only be used by one thread, separate instances can run in parallel.
+/// </remarks>
+class FrameBenchmark {
+private:
+	struct InputScript;
+
+public:
+	/// <summary>Run the benchmark passes on a game</summary>
+	/// <returns>False if the game couldn't be loaded</returns>
+	static bool Run(const string& romFile, const FrameBenchmarkOptions& options, FrameBenchmarkResult& result);
+};
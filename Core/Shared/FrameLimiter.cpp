@@ -0,0 +1,145 @@
+#include "pch.h"
+#include <thread>
+#include "Shared/FrameLimiter.h"
+
+FrameLimiter::FrameLimiter(double delay) {
+	_delay = delay;
+	_targetTime = _delay;
+	_resetRunTimers = false;
+	_minPresentLatency = _delay;
+	_lastPresent = 0;
+}
+
+void FrameLimiter::OnFramePresented() {
+	_lastPresent = duration_cast<nanoseconds>(high_resolution_clock::now().time_since_epoch()).count();
+}
+
+void FrameLimiter::ProcessFrame() {
+	if (_resetRunTimers || (_clockTimer.GetElapsedMS() - _targetTime) > 100) {
+		// Reset the timers, this can happen in 3 scenarios:
+		// 1) Target frame rate changed
+		// 2) The console was reset/power cycled or the emulation was paused (with or without the debugger)
+		// 3) As a satefy net, if we overshoot our target by over 100 milliseconds, the timer is reset, too.
+		//    This can happen when something slows the emulator down severely (or when breaking execution in VS when debugging Nexen itself, etc.)
+		_clockTimer.Reset();
+		_targetTime = 0;
+		_resetRunTimers = false;
+		_lastFrameEnd = -1;
+		_lastFrameSent = -1;
+		_minPresentLatency = _delay;
+	}
+
+	if (_alignToPresent) {
+		AlignToPresent();
+	}
+
+	_lastFrameSent = _clockTimer.GetElapsedMS();
+	_targetTime += _delay;
+}
+
+void FrameLimiter::AlignToPresent() {
+	int64_t present = _lastPresent;
+	if (present == _processedPresent || _lastFrameSent < 0) {
+		return;
+	}
+	_processedPresent = present;
+
+	// The frame sent to the renderer just before the previous ProcessFrame() call was presented at "presentTime"
+	int64_t now = duration_cast<nanoseconds>(high_resolution_clock::now().time_since_epoch()).count();
+	double presentTime = _clockTimer.GetElapsedMS() - (now - present) / 1000000.0;
+	double latency = presentTime - _lastFrameSent;
+	if (latency < 0 || latency > _delay) {
+		// Present of an older frame, or the renderer is falling behind
+		return;
+	}
+
+	// The lowest latency is the time the renderer needs when the display is ready for the frame (VRR, or frame
+	// completed just before a vblank). It is allowed to rise slowly in case the render time increases.
+	_minPresentLatency = std::min(latency, _minPresentLatency + 0.01);
+
+	// Latency above that = the frame waited for the next vblank, so delay the next frames a bit to end closer to it.
+	// Only delays (never advances): at the same refresh rate this locks the frames' phase to the vblanks.
+	double extraWait = latency - _minPresentLatency - 0.5;
+	if (extraWait > 0) {
+		_targetTime += std::min(extraWait * 0.1, FrameLimiter::MaxPresentShift);
+	}
+}
+
+bool FrameLimiter::WaitForNextFrame() {
+	double remaining = _targetTime - _clockTimer.GetElapsedMS();
+	if (remaining > 50) {
+		// When sleeping for a long time (e.g <= 25% speed), sleep in small chunks and check to see if we need to stop sleeping between each sleep call
+		Timer::Sleep(40);
+		return true;
+	}
+
+	if (remaining > _slack) {
+		// Sleep until shortly before the target time, then adjust the margin based on how much the sleep overshot
+		double requested = remaining - _slack;
+		double sleepStart = _clockTimer.GetElapsedMS();
+		Timer::Sleep(requested);
+		double overshoot = _clockTimer.GetElapsedMS() - sleepStart - requested;
+
+		// Grows immediately when sleeps overshoot more than the margin, decays slowly otherwise
+		_slack = std::clamp(std::max(overshoot * 1.25 + FrameLimiter::MinSlack, _slack * 0.99), FrameLimiter::MinSlack, FrameLimiter::MaxSlack);
+	}
+
+	// Spin for the remaining time (usually well under 1ms)
+	double spinStart = _clockTimer.GetElapsedMS();
+	double now = spinStart;
+	while (now < _targetTime) {
+		std::this_thread::yield();
+		now = _clockTimer.GetElapsedMS();
+	}
+
+	RecordFrame(now, now - spinStart);
+	return false;
+}
+
+void FrameLimiter::RecordFrame(double frameEnd, double spinTime) {
+	auto lock = _statsLock.AcquireSafe();
+	_lastStats.TargetFrameTime = _delay;
+	_lastStats.WakeupSlack = _slack;
+	if (_lastFrameEnd >= 0) {
+		_frameTimes[_historyPos] = frameEnd - _lastFrameEnd;
+		_spinTimes[_historyPos] = spinTime;
+		_historyPos = (_historyPos + 1) % FrameLimiter::HistorySize;
+		_historyCount = std::min(_historyCount + 1, FrameLimiter::HistorySize);
+	}
+	_lastFrameEnd = frameEnd;
+}
+
+FramePacingStats FrameLimiter::GetStats() {
+	auto lock = _statsLock.AcquireSafe();
+	FramePacingStats stats = {};
+	stats.TargetFrameTime = _lastStats.TargetFrameTime;
+	stats.WakeupSlack = _lastStats.WakeupSlack;
+	stats.FrameCount = _historyCount;
+	if (_historyCount == 0) {
+		return stats;
+	}
+
+	double total = 0;
+	double spin = 0;
+	stats.MinFrameTime = _frameTimes[0];
+	stats.MaxFrameTime = _frameTimes[0];
+	for (uint32_t i = 0; i < _historyCount; i++) {
+		total += _frameTimes[i];
+		spin += _spinTimes[i];
+		stats.MinFrameTime = std::min(stats.MinFrameTime, _frameTimes[i]);
+		stats.MaxFrameTime = std::max(stats.MaxFrameTime, _frameTimes[i]);
+		if (_frameTimes[i] > stats.TargetFrameTime + 1) {
+			stats.LateFrames++;
+		}
+	}
+	stats.AverageFrameTime = total / _historyCount;
+	stats.AverageSpin = spin / _historyCount;
+
+	double variance = 0;
+	for (uint32_t i = 0; i < _historyCount; i++) {
+		double diff = _frameTimes[i] - stats.AverageFrameTime;
+		variance += diff * diff;
+	}
+	stats.StdDeviation = std::sqrt(variance / _historyCount);
+	return stats;
+}
@@ -1,5 +1,22 @@
 #pragma once
+#include "pch.h"
 #include "Utilities/Timer.h"
+#include "Utilities/SimpleLock.h"
+
+/// <summary>
+/// Frame pacing statistics over the last FrameLimiter::HistorySize frames (all times in ms).
+/// </summary>
+struct FramePacingStats {
+	double TargetFrameTime; ///< Delay per frame requested by the emulator
+	double AverageFrameTime;
+	double StdDeviation; ///< Jitter (standard deviation of the frame times)
+	double MinFrameTime;
+	double MaxFrameTime;
+	double WakeupSlack;   ///< Calibrated margin before the target time at which sleeping stops (spin-wait after this)
+	double AverageSpin;   ///< Average time spent spin-waiting per frame
+	uint32_t LateFrames;  ///< Frames that took more than 1ms longer than the target frame time
+	uint32_t FrameCount;  ///< Number of frames in the statistics
+};
 
 /// <summary>
 /// Frame rate limiter using precise timing to maintain target FPS.
@@ -11,6 +28,16 @@
 /// 2. WaitForNextFrame() sleeps until target time reached
 /// 3. Automatically recovers from timing drift and emulation pauses
 ///
+/// Waiting is hybrid: the thread sleeps until WakeupSlack before the target time, then spin-waits (yielding) for
+/// the rest. The slack is calibrated from the measured oversleep of every sleep call, so it stays small (and the
+/// spinning short) when the OS timers are precise (high resolution waitable timer on Windows, nanosleep on Linux),
+/// and grows on systems where sleeps overshoot, instead of frames ending late.
+///
+/// Present alignment (vsync or VRR displays): the renderer reports when it presents each frame (OnFramePresented).
+/// When a frame has to wait noticeably longer than usual for its present (i.e it was completed just after a vblank
+/// on a fixed refresh rate display), the next target times are pushed back slightly, which aligns the end of the
+/// frames with the vblanks. On a VRR display, presents follow the frames immediately and nothing is adjusted.
+///
 /// Target delay calculation:
 /// - 60 FPS (NTSC):  16.667ms per frame
 /// - 50 FPS (PAL):   20.000ms per frame
@@ -31,25 +58,50 @@
 /// }
 /// </code>
 ///
-/// Thread safety: Not thread-safe - use from emulation thread only.
+/// Thread safety: use from emulation thread only, except OnFramePresented() (renderer thread) and GetStats().
 /// </remarks>
 class FrameLimiter {
+public:
+	static constexpr uint32_t HistorySize = 120;
+
 private:
+	static constexpr double MinSlack = 0.05;       ///< Smallest wakeup margin (ms)
+	static constexpr double MaxSlack = 4.0;        ///< Largest wakeup margin (ms), when sleeps are very imprecise
+	static constexpr double MaxPresentShift = 0.25; ///< Largest target time correction per frame (ms) for present alignment
+
 	Timer _clockTimer;    ///< High-resolution timer for frame timing
 	double _targetTime;   ///< Next frame target time in milliseconds
 	double _delay;        ///< Delay per frame in milliseconds
 	bool _resetRunTimers; ///< Flag to reset timers on next frame
 
+	double _slack = 1.0;          ///< Calibrated wakeup margin (ms)
+	double _lastFrameEnd = -1;    ///< Time at which the last wait ended (-1 after a reset)
+	double _lastFrameSent = -1;   ///< Time at which the last frame was completed/sent to the renderer (-1 after a reset)
+	double _minPresentLatency = 0; ///< Lowest delay seen between the end of a frame and its present
+
+	bool _alignToPresent = false;
+	atomic<int64_t> _lastPresent; ///< Time of the last present (high_resolution_clock, ns)
+	int64_t _processedPresent = 0;
+
+	SimpleLock _statsLock;
+	FramePacingStats _lastStats = {}; ///< Target frame time and slack, as of the last frame
+	double _frameTimes[FrameLimiter::HistorySize] = {};
+	double _spinTimes[FrameLimiter::HistorySize] = {};
+	uint32_t _historyPos = 0;
+	uint32_t _historyCount = 0;
+
+	void RecordFrame(double frameEnd, double spinTime);
+	void AlignToPresent();
+
 public:
 	/// <summary>
 	/// Construct frame limiter with target delay.
 	/// </summary>
 	/// <param name="delay">Milliseconds per frame (e.g., 16.667 for 60 FPS)</param>
-	FrameLimiter(double delay) {
-		_delay = delay;
-		_targetTime = _delay;
-		_resetRunTimers = false;
-	}
+	FrameLimiter(double delay);
+
+	FrameLimiter(const FrameLimiter&) = delete;
+	FrameLimiter& operator=(const FrameLimiter&) = delete;
 
 	/// <summary>
 	/// Change target frame rate.
@@ -64,6 +116,12 @@ public:
 		_resetRunTimers = true;
 	}
 
+	/// <summary>Enables present alignment (vsync enabled and running at normal speed)</summary>
+	void SetPresentAlignment(bool enabled) { _alignToPresent = enabled; }
+
+	/// <summary>Called by the renderer thread after presenting a new frame</summary>
+	void OnFramePresented();
+
 	/// <summary>
 	/// Process frame completion and advance target time.
 	/// </summary>
@@ -74,20 +132,7 @@ public:
 	/// - Delay changed (frame rate changed)
 	/// - Timing drift > 100ms (emulation paused, debugger break, etc.)
 	/// </remarks>
-	void ProcessFrame() {
-		if (_resetRunTimers || (_clockTimer.GetElapsedMS() - _targetTime) > 100) {
-			// Reset the timers, this can happen in 3 scenarios:
-			// 1) Target frame rate changed
-			// 2) The console was reset/power cycled or the emulation was paused (with or without the debugger)
-			// 3) As a satefy net, if we overshoot our target by over 100 milliseconds, the timer is reset, too.
-			//    This can happen when something slows the emulator down severely (or when breaking execution in VS when debugging Nexen itself, etc.)
-			_clockTimer.Reset();
-			_targetTime = 0;
-			_resetRunTimers = false;
-		}
-
-		_targetTime += _delay;
-	}
+	void ProcessFrame();
 
 	/// <summary>
 	/// Wait until next frame time.
@@ -96,17 +141,11 @@ public:
 	/// <remarks>
 	/// Sleeps until target time reached.
 	/// For slow speeds (<= 25%), sleeps in 40ms chunks to allow early exit.
-	/// For normal speeds, sleeps precise amount until target time.
+	/// For normal speeds, sleeps until WakeupSlack before the target time, then spin-waits.
 	/// Call after ProcessFrame() to maintain consistent frame rate.
 	/// </remarks>
-	bool WaitForNextFrame() {
-		if (_targetTime - _clockTimer.GetElapsedMS() > 50) {
-			// When sleeping for a long time (e.g <= 25% speed), sleep in small chunks and check to see if we need to stop sleeping between each sleep call
-			_clockTimer.WaitUntil(_clockTimer.GetElapsedMS() + 40);
-			return true;
-		}
-
-		_clockTimer.WaitUntil(_targetTime);
-		return false;
-	}
+	bool WaitForNextFrame();
+
+	/// <summary>Frame time statistics over the last frames (any thread)</summary>
+	[[nodiscard]] FramePacingStats GetStats();
 };
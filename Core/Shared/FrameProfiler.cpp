@@ -0,0 +1,82 @@
+#include "pch.h"
+#include "Shared/FrameProfiler.h"
+
+FrameProfiler::FrameProfiler() {
+	_calibrationTicks = GetTicks();
+}
+
+void FrameProfiler::EndFrame(bool showStats) {
+	bool enabled = showStats || _requested;
+	if (!enabled && !_enabled) {
+		return;
+	}
+
+	if (enabled != _enabled) {
+		_enabled = enabled;
+		if (enabled) {
+			// Drop what was accumulated by scopes that were still running when the profiler was disabled
+			Reset();
+			return;
+		}
+	}
+
+	// The frequency estimate gets more precise the longer the profiler runs
+	double elapsedMs = _calibrationTimer.GetElapsedMS();
+	if (elapsedMs >= 100) {
+		_ticksPerMs = (GetTicks() - _calibrationTicks) / elapsedMs;
+	}
+
+	auto lock = _lock.AcquireSafe();
+	for (int i = 0; i < (int)ProfilerStage::Count; i++) {
+		uint64_t ticks = _ticks[i].exchange(0, std::memory_order_relaxed);
+		_history[_historyPos][i] = _ticksPerMs > 0 ? (float)(ticks / _ticksPerMs) : 0;
+	}
+	_historyPos = (_historyPos + 1) % FrameProfiler::HistorySize;
+	_historyCount = std::min(_historyCount + 1, FrameProfiler::HistorySize);
+}
+
+void FrameProfiler::Reset() {
+	auto lock = _lock.AcquireSafe();
+	for (std::atomic<uint64_t>& ticks : _ticks) {
+		ticks = 0;
+	}
+	_historyPos = 0;
+	_historyCount = 0;
+}
+
+FrameProfilerStats FrameProfiler::GetStats() {
+	FrameProfilerStats stats;
+	auto lock = _lock.AcquireSafe();
+	stats.FrameCount = _historyCount;
+	for (uint32_t frame = 0; frame < _historyCount; frame++) {
+		for (int i = 0; i < (int)ProfilerStage::Count; i++) {
+			stats.Average[i] += _history[frame][i];
+			stats.Max[i] = std::max<double>(stats.Max[i], _history[frame][i]);
+		}
+	}
+	if (_historyCount > 0) {
+		for (double& average : stats.Average) {
+			average /= _historyCount;
+		}
+	}
+	return stats;
+}
+
+const char* FrameProfiler::GetStageName(ProfilerStage stage) {
+	switch (stage) {
+		case ProfilerStage::Emulation: return "Core";
+		case ProfilerStage::Ppu: return "PPU";
+		case ProfilerStage::Apu: return "APU";
+		case ProfilerStage::Coprocessor: return "Coproc.";
+		case ProfilerStage::Audio: return "Mixer";
+		case ProfilerStage::Script: return "Script";
+		case ProfilerStage::RunAheadSave: return "State save";
+		case ProfilerStage::RunAheadLoad: return "State load";
+		case ProfilerStage::Rewind: return "Rewind";
+		case ProfilerStage::FrameLimiter: return "Idle";
+		case ProfilerStage::VideoFilter: return "Filter";
+		case ProfilerStage::Hud: return "HUD";
+		case ProfilerStage::Count: break;
+	}
+	return "";
+}
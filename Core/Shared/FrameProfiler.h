@@ -0,0 +1,147 @@
+#pragma once
+#include "pch.h"
+#include <atomic>
+#include "Utilities/CpuFeatures.h"
+#include "Utilities/SimpleLock.h"
+#include "Utilities/Timer.h"
+
+#ifdef NEXEN_ARCH_X86
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+/// <summary>Stages measured by FrameProfiler (each one excludes the time spent in the stages nested inside it)</summary>
+enum class ProfilerStage : uint8_t {
+	Emulation,    ///< Console's frame (CPUs and everything not measured separately)
+	Ppu,          ///< Scanline rendering
+	Apu,          ///< Audio chip emulation (catch-up runs)
+	Coprocessor,  ///< Cartridge coprocessors
+	Audio,        ///< SoundMixer (resampling, effects, output)
+	Script,       ///< Lua callbacks
+	RunAheadSave, ///< Run-ahead/rollback state save
+	RunAheadLoad, ///< Run-ahead/rollback state load
+	Rewind,       ///< Rewind history recording
+	FrameLimiter, ///< Waiting for the next frame (idle time)
+	VideoFilter,  ///< VideoDecoder: video filters (decoding thread)
+	Hud,          ///< VideoDecoder: HUD drawing (decoding thread)
+	Count
+};
+
+/// <summary>Time spent in each stage, in milliseconds per frame, over the last frames</summary>
+struct FrameProfilerStats {
+	double Average[(int)ProfilerStage::Count] = {};
+	double Max[(int)ProfilerStage::Count] = {};
+	uint32_t FrameCount = 0;
+};
+
+/// <summary>
+/// Low-overhead per-frame breakdown of where the time goes (core, PPU, APU, coprocessor, audio, video, scripts...).
+/// </summary>
+/// <remarks>
+/// The hot paths are wrapped in PROFILE_SCOPE macros. Each scope reads the CPU's timestamp counter (rdtsc on x86,
+/// steady_clock elsewhere) and only counts its own time: nested scopes on the same thread are subtracted from their
+/// parent, so the stages add up to the frame time. Scopes do nothing but check a flag while the profiler is
+/// disabled, and the whole instrumentation can be compiled out with NEXEN_NO_PROFILER (make PROFILER=false).
+///
+/// The emulation thread calls EndFrame() after each frame to move the accumulated time into a ring of the last
+/// HistorySize frames. Stages on other threads (video decoding) are counted in the frame they end in.
+///
+/// Thread safety: scopes can run on any thread (atomic accumulators), GetStats() can be called from any thread.
+/// </remarks>
+class FrameProfiler {
+public:
+	static constexpr uint32_t HistorySize = 120;
+
+private:
+	std::atomic<bool> _enabled = false;
+	std::atomic<bool> _requested = false;
+	std::atomic<uint64_t> _ticks[(int)ProfilerStage::Count] = {};
+
+	SimpleLock _lock;
+	float _history[FrameProfiler::HistorySize][(int)ProfilerStage::Count] = {};
+	uint32_t _historyPos = 0;
+	uint32_t _historyCount = 0;
+
+	// Timestamp counter frequency, measured against the system clock
+	Timer _calibrationTimer;
+	uint64_t _calibrationTicks = 0;
+	double _ticksPerMs = 0;
+
+public:
+	FrameProfiler();
+
+	[[nodiscard]] static uint64_t GetTicks() {
+#ifdef NEXEN_ARCH_X86
+		return __rdtsc();
+#else
+		return (uint64_t)std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+	}
+
+	[[nodiscard]] bool IsEnabled() const { return _enabled.load(std::memory_order_relaxed); }
+
+	/// <summary>Turn profiling on for the interop API (the debug stats overlay also turns it on)</summary>
+	void SetRequested(bool requested) { _requested = requested; }
+
+	void AddTicks(ProfilerStage stage, uint64_t ticks) {
+		_ticks[(int)stage].fetch_add(ticks, std::memory_order_relaxed);
+	}
+
+	/// <summary>Emulation thread: end of a frame, stores the time accumulated since the previous call</summary>
+	/// <param name="showStats">Debug stats overlay is visible (profiling is enabled while it is, or while requested)</param>
+	void EndFrame(bool showStats);
+
+	void Reset();
+
+	[[nodiscard]] FrameProfilerStats GetStats();
+
+	[[nodiscard]] static const char* GetStageName(ProfilerStage stage);
+};
+
+/// <summary>Measures the time until the end of the scope (see PROFILE_SCOPE)</summary>
+class ProfilerScope {
+private:
+	static inline thread_local ProfilerScope* _current = nullptr;
+
+	FrameProfiler* _profiler = nullptr;
+	ProfilerScope* _parent = nullptr;
+	ProfilerStage _stage;
+	uint64_t _start = 0;
+	uint64_t _childTicks = 0;
+
+public:
+	ProfilerScope(FrameProfiler* profiler, ProfilerStage stage) : _stage(stage) {
+		if (profiler && profiler->IsEnabled()) [[unlikely]] {
+			_profiler = profiler;
+			_parent = _current;
+			_current = this;
+			_start = FrameProfiler::GetTicks();
+		}
+	}
+
+	~ProfilerScope() {
+		if (_profiler) [[unlikely]] {
+			uint64_t elapsed = FrameProfiler::GetTicks() - _start;
+			_profiler->AddTicks(_stage, elapsed > _childTicks ? elapsed - _childTicks : 0);
+			if (_parent) {
+				_parent->_childTicks += elapsed;
+			}
+			_current = _parent;
+		}
+	}
+
+	ProfilerScope(const ProfilerScope&) = delete;
+	ProfilerScope& operator=(const ProfilerScope&) = delete;
+};
+
+#ifndef NEXEN_NO_PROFILER
+#define PROFILE_SCOPE_NAME2(a, b) a##b
+#define PROFILE_SCOPE_NAME(a, b) PROFILE_SCOPE_NAME2(a, b)
+/// <summary>Counts the time until the end of the current scope in a FrameProfiler stage</summary>
+#define PROFILE_SCOPE(profiler, stage) ProfilerScope PROFILE_SCOPE_NAME(_profilerScope, __LINE__)(profiler, stage)
+#else
+#define PROFILE_SCOPE(profiler, stage)
+#endif
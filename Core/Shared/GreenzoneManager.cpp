@@ -0,0 +1,138 @@
+#include "pch.h"
+#include "Shared/GreenzoneManager.h"
+
+size_t GreenzoneManager::GetStateSize(const RunAheadState& state) {
+	return state.GetMemoryUsage();
+}
+
+bool GreenzoneManager::IsRecent(uint32_t frame) const {
+	uint64_t distance = frame > _playhead ? frame - _playhead : _playhead - frame;
+	return distance < (uint64_t)_options.RecentCount * _options.Interval;
+}
+
+void GreenzoneManager::Remove(std::map<uint32_t, Entry>::iterator it) {
+	_memoryUsage -= it->second.Size;
+	_states.erase(it);
+}
+
+void GreenzoneManager::SetOptions(const GreenzoneOptions& options) {
+	_options = options;
+	_options.Interval = std::max<uint32_t>(_options.Interval, 1);
+	if (!_options.Enabled) {
+		Clear();
+	} else {
+		EnforceBudget();
+	}
+}
+
+bool GreenzoneManager::NeedsState(uint32_t frame) const {
+	return _options.Enabled && frame % _options.Interval == 0 && _states.find(frame) == _states.end();
+}
+
+void GreenzoneManager::AddState(uint32_t frame, unique_ptr<RunAheadState> state) {
+	auto it = _states.find(frame);
+	if (it != _states.end()) {
+		Remove(it);
+	}
+
+	Entry entry;
+	entry.Size = GetStateSize(*state);
+	entry.State = std::move(state);
+	_memoryUsage += entry.Size;
+	_states[frame] = std::move(entry);
+
+	EnforceBudget();
+}
+
+RunAheadState* GreenzoneManager::FindState(uint32_t frame, uint32_t& stateFrame) {
+	auto it = _states.upper_bound(frame);
+	if (it == _states.begin()) {
+		return nullptr;
+	}
+	--it;
+	stateFrame = it->first;
+	return it->second.State.get();
+}
+
+void GreenzoneManager::Invalidate(uint32_t firstChangedFrame) {
+	// The state of frame N only depends on the input of frames 0 to N-1
+	while (!_states.empty() && std::prev(_states.end())->first > firstChangedFrame) {
+		Remove(std::prev(_states.end()));
+	}
+}
+
+void GreenzoneManager::Clear() {
+	_states.clear();
+	_memoryUsage = 0;
+}
+
+bool GreenzoneManager::TakeSeekRequest(uint32_t& frame) {
+	int64_t target = _seekTarget.exchange(-1);
+	if (target < 0) {
+		return false;
+	}
+	frame = (uint32_t)target;
+	return true;
+}
+
+void GreenzoneManager::EnforceBudget() {
+	for (auto& [frame, entry] : _states) {
+		if (!entry.State->Ram.IsCompressed() && !IsRecent(frame)) {
+			entry.State->Ram.Compress();
+			_memoryUsage -= entry.Size;
+			entry.Size = GetStateSize(*entry.State);
+			_memoryUsage += entry.Size;
+		}
+	}
+
+	if (_memoryUsage <= _options.MemoryBudget || _states.empty()) {
+		return;
+	}
+
+	// Thin out the states away from the playhead, keeping an increasingly sparse set (oldest first)
+	uint32_t lastFrame = std::prev(_states.end())->first;
+	for (uint64_t step = (uint64_t)_options.Interval * 2; _memoryUsage > _options.MemoryBudget && step <= lastFrame; step *= 2) {
+		for (auto it = _states.begin(); it != _states.end() && _memoryUsage > _options.MemoryBudget;) {
+			auto current = it++;
+			if (current->first != 0 && current->first % step != 0 && !IsRecent(current->first)) {
+				Remove(current);
+			}
+		}
+	}
+
+	// Still over budget (the recent states alone don't fit), drop the oldest ones
+	while (_memoryUsage > _options.MemoryBudget && _states.size() > 1) {
+		auto oldest = _states.begin();
+		if (oldest->first == 0) {
+			oldest++;
+		}
+		Remove(oldest);
+	}
+}
+
+GreenzoneInfo GreenzoneManager::GetInfo() const {
+	GreenzoneInfo info = {};
+	info.StateCount = (uint32_t)_states.size();
+	for (auto& [frame, entry] : _states) {
+		if (entry.State->Ram.IsCompressed()) {
+			info.CompressedCount++;
+		}
+	}
+	info.MemoryUsage = _memoryUsage;
+	if (!_states.empty()) {
+		info.FirstFrame = _states.begin()->first;
+		info.LastFrame = std::prev(_states.end())->first;
+	}
+	info.SeekPending = IsSeekPending();
+	return info;
+}
+
+void GreenzoneManager::ReportMemoryUsage(MemoryUsageNode& node) {
+	uint64_t uncompressed = 0;
+	uint64_t compressed = 0;
+	for (auto& [frame, entry] : _states) {
+		(entry.State->Ram.IsCompressed() ? compressed : uncompressed) += entry.Size;
+	}
+	node.Add("Recent states", uncompressed);
+	node.Add("Compressed states", compressed);
+}
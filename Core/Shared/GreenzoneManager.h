@@ -0,0 +1,106 @@
+#pragma once
+#include "pch.h"
+#include <map>
+#include "Shared/RunAheadSnapshot.h"
+#include "Shared/Interfaces/IMemoryUsageReporter.h"
+
+/// <summary>Greenzone configuration (set by the TAS editor)</summary>
+struct GreenzoneOptions {
+	bool Enabled = false;
+	uint32_t Interval = 1;                           ///< Capture a state every N input frames
+	uint32_t RecentCount = 120;                      ///< States around the playhead that are kept uncompressed
+	uint64_t MemoryBudget = 512ull * 1024 * 1024;    ///< Max memory used by the states, in bytes
+};
+
+/// <summary>Greenzone statistics (for the TAS editor)</summary>
+struct GreenzoneInfo {
+	uint32_t StateCount;
+	uint32_t CompressedCount;
+	uint64_t MemoryUsage;
+	uint32_t FirstFrame; ///< Oldest state, or 0 if empty
+	uint32_t LastFrame;  ///< Newest state, or 0 if empty
+	bool SeekPending;
+};
+
+/// <summary>
+/// Native savestate cache for the TAS editor ("greenzone"): states of the frames that were
+/// already emulated with the current input, so the editor can seek to any of them.
+/// </summary>
+/// <remarks>
+/// States are keyed by input frame (the control manager's poll counter: the state for frame N
+/// is taken at the end of the first video frame after N input polls) and use the run-ahead
+/// serializer (RunAheadState), which is much faster than regular savestates.
+///
+/// Memory is managed in tiers, under MemoryBudget:
+/// 1. States within RecentCount intervals of the playhead stay uncompressed (instant seeks while editing)
+/// 2. Older states have their RAM blocks compressed (Restore() inflates them on the fly)
+/// 3. When over budget, states are thinned out away from the playhead: first those not on a
+///    multiple of 2*Interval, then 4*Interval, etc. Frame 0 is always kept
+///
+/// Seeking (Emulator::ProcessGreenzoneSeek) loads the closest state before the target frame and
+/// runs the remaining frames with rendering skipped. Editing the input of a frame only invalidates
+/// the states after it, so the next seek re-emulates from the closest state before the edit.
+///
+/// Thread safety: emulation thread, or any thread holding the emulator lock (the states hold
+/// pointers to the console's memory). RequestSeek() can be called from any thread.
+/// </remarks>
+class GreenzoneManager : public IMemoryUsageReporter {
+private:
+	struct Entry {
+		unique_ptr<RunAheadState> State;
+		size_t Size = 0; ///< Memory used by State when it was last measured
+	};
+
+	std::map<uint32_t, Entry> _states;
+	GreenzoneOptions _options;
+	uint64_t _memoryUsage = 0;
+	uint32_t _playhead = 0;
+	atomic<int64_t> _seekTarget = -1;
+
+	[[nodiscard]] static size_t GetStateSize(const RunAheadState& state);
+	[[nodiscard]] bool IsRecent(uint32_t frame) const;
+	void Remove(std::map<uint32_t, Entry>::iterator it);
+
+	/// <summary>Compress states away from the playhead, then thin them out until under budget</summary>
+	void EnforceBudget();
+
+public:
+	void SetOptions(const GreenzoneOptions& options);
+	[[nodiscard]] const GreenzoneOptions& GetOptions() const { return _options; }
+
+	[[nodiscard]] bool IsEnabled() const { return _options.Enabled; }
+
+	/// <summary>True if a state should be captured for this input frame</summary>
+	[[nodiscard]] bool NeedsState(uint32_t frame) const;
+
+	/// <summary>Add the state of an input frame (replaces any existing state)</summary>
+	void AddState(uint32_t frame, unique_ptr<RunAheadState> state);
+
+	/// <summary>Closest state at or before frame</summary>
+	/// <param name="stateFrame">Input frame of the returned state</param>
+	/// <returns>nullptr if there is no state before frame</returns>
+	RunAheadState* FindState(uint32_t frame, uint32_t& stateFrame);
+
+	/// <summary>Remove the states that depend on the input of firstChangedFrame (all states after it)</summary>
+	void Invalidate(uint32_t firstChangedFrame);
+
+	/// <summary>Remove every state (game loaded/unloaded)</summary>
+	void Clear();
+
+	/// <summary>Ask the emulation thread to seek to frame (processed at the start of the next frame, or while paused)</summary>
+	void RequestSeek(uint32_t frame) { _seekTarget = frame; }
+
+	/// <summary>Take the pending seek request</summary>
+	/// <returns>False if there is no pending request</returns>
+	bool TakeSeekRequest(uint32_t& frame);
+
+	[[nodiscard]] bool IsSeekPending() const { return _seekTarget >= 0; }
+
+	/// <summary>Current input frame, states around it are kept uncompressed</summary>
+	void SetPlayhead(uint32_t frame) { _playhead = frame; }
+
+	[[nodiscard]] GreenzoneInfo GetInfo() const;
+
+	/// <summary>Report the uncompressed and compressed states (IMemoryUsageReporter)</summary>
+	void ReportMemoryUsage(MemoryUsageNode& node) override;
+};
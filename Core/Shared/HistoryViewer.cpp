@@ -42,6 +42,7 @@ bool HistoryViewer::Initialize(Emulator* mainEmu) {
 	_emu->GetBatteryManager()->Initialize("");
 
 	_history = mainEmu->GetRewindManager()->GetHistory();
+	_seekCache.clear();
 
 	// Cache segment boundaries (immutable after init)
 	_segmentFrames.clear();
@@ -95,14 +96,39 @@ void HistoryViewer::SeekTo(uint32_t seekPosition) {
 		auto lock = _emu->AcquireLock();
 
 		_position = seekPosition;
-		RewindData rewindData = _history[_position];
-		rewindData.LoadState(_emu, _history, _position);
+		const vector<uint8_t>* state = GetDecodedState(_position);
+		if (state) {
+			RewindData::LoadDecodedState(_emu, *state);
+		}
 
 		_emu->GetSoundMixer()->StopAudio(true);
 		_pollCounter = 0;
 	}
 }
 
+const vector<uint8_t>* HistoryViewer::GetDecodedState(uint32_t position) {
+	auto entry = std::find_if(_seekCache.begin(), _seekCache.end(), [=](const SeekCacheEntry& e) { return e.Position == position; });
+	if (entry != _seekCache.end()) {
+		if (entry != _seekCache.begin()) {
+			std::rotate(_seekCache.begin(), entry, entry + 1);
+		}
+		return &_seekCache.front().Data;
+	}
+
+	SeekCacheEntry newEntry;
+	if (_seekCache.size() >= HistoryViewer::SeekCacheSize) {
+		// Reuse the least recently used buffer's allocation
+		newEntry = std::move(_seekCache.back());
+		_seekCache.pop_back();
+	}
+	newEntry.Position = position;
+	if (!_history[position].DecodeState(newEntry.Data)) {
+		return nullptr;
+	}
+	_seekCache.push_front(std::move(newEntry));
+	return &_seekCache.front().Data;
+}
+
 bool HistoryViewer::CreateSaveState(const string& outputFile, uint32_t position) {
 	if (_history.empty()) {
 		return false;
@@ -113,7 +139,7 @@ bool HistoryViewer::CreateSaveState(const string& outputFile, uint32_t position)
 
 	std::stringstream stateData;
 	_emu->GetSaveStateManager()->GetSaveStateHeader(stateData);
-	_history[position].GetStateData(stateData, _history, position);
+	_history[position].GetStateData(stateData);
 
 	ofstream output(outputFile, ios::binary);
 	if (output) {
@@ -158,16 +184,16 @@ void HistoryViewer::ResumeGameplay(uint32_t resumePosition) {
 	}
 
 	if (resumePosition < _history.size()) {
-		_history[resumePosition].LoadState(_mainEmu, _history, resumePosition);
+		_history[resumePosition].LoadState(_mainEmu);
 	} else {
-		_history[_history.size() - 1].LoadState(_mainEmu, _history, (int32_t)_history.size() - 1);
+		_history[_history.size() - 1].LoadState(_mainEmu);
 	}
 }
 
 bool HistoryViewer::SetInput(BaseControlDevice* device) {
 	uint8_t port = device->GetPort();
 	if (_position < _history.size()) {
-		std::deque<ControlDeviceState>& stateData = _history[_position].InputLogs[port];
+		RewindInputLog& stateData = _history[_position].InputLogs[port];
 		if (_pollCounter < stateData.size()) {
 			ControlDeviceState state = stateData[_pollCounter];
 			device->SetRawState(state);
@@ -195,7 +221,6 @@ void HistoryViewer::ProcessEndOfFrame() {
 			return;
 		}
 
-		RewindData rewindData = _history[_position];
-		rewindData.LoadState(_emu, _history, _position);
+		_history[_position].LoadState(_emu);
 	}
 }
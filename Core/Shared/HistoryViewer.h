@@ -57,6 +57,8 @@ struct HistoryViewerOptions {
 ///
 /// Performance:
 /// - Fast seeking via savestate snapshots (every 30 frames)
+/// - Every snapshot is self-contained, a seek costs at most one snapshot decode
+/// - The last SeekCacheSize decoded snapshots are kept, so scrubbing around the cursor skips decompression
 /// - Reuses existing RewindData compression
 /// - Separate thread avoids blocking main emulator
 ///
@@ -71,6 +73,18 @@ private:
 	uint32_t _position = 0;       ///< Current playback position (frames)
 	uint32_t _pollCounter = 0;    ///< Input poll counter
 
+	static constexpr uint32_t SeekCacheSize = 8; ///< Decoded snapshots kept for scrubbing
+
+	/// <summary>Decoded snapshot kept around the scrub cursor</summary>
+	struct SeekCacheEntry {
+		uint32_t Position;
+		vector<uint8_t> Data;
+	};
+	deque<SeekCacheEntry> _seekCache; ///< Most recently used first
+
+	/// <summary>Get the decoded snapshot at a history position (from cache, or decode it)</summary>
+	const vector<uint8_t>* GetDecodedState(uint32_t position);
+
 public:
 	/// <summary>Construct history viewer for emulator</summary>
 	HistoryViewer(Emulator* emu);
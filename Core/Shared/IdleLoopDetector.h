@@ -0,0 +1,178 @@
+#pragma once
+#include "pch.h"
+
+/// <summary>Counters for profiling how much emulation time the idle loop detection saves</summary>
+struct IdleLoopStats {
+	uint64_t RecordedLoops = 0;      ///< Iterations recorded (loop found and kept)
+	uint64_t Skips = 0;              ///< Calls that replayed at least one iteration
+	uint64_t RejectedSkips = 0;      ///< Replays refused because the state no longer matched the recording
+	uint64_t SkippedIterations = 0;  ///< Iterations replayed instead of executed
+	uint64_t SkippedCycles = 0;      ///< Clocks covered by the replayed iterations (in the CPU's own clock)
+};
+
+/// <summary>
+/// Records one iteration of a short busy-wait loop (e.g. polling a status register) so a CPU core can
+/// replay its bus cycles without fetching and executing the instructions again.
+/// </summary>
+/// <remarks>
+/// Opt-in, each core decides which accesses are allowed in a loop and what "the same state" means:
+/// - ProcessOpCode() at every opcode fetch, starts a recording after a short backward jump
+/// - RecordCycle() for every bus cycle, with whatever the core needs to replay it (e.g. its speed setting)
+/// - RecordRead() for every read that's allowed in a loop, Abort() for anything else (writes, reads with side effects)
+///
+/// An iteration that starts from the same registers and reads the same values behaves exactly like the
+/// recorded one, so before skipping the core checks its registers with Matches() and every recorded read
+/// with the callback, and only skips when nothing else can change them until the skip ends (typically
+/// because the other chips only run when the core returns). The skip is then exact, the hardware that is
+/// clocked by the bus cycles (timers, sound, video) still runs for each replayed cycle.
+/// </remarks>
+/// <typeparam name="TRegs">Register snapshot, compared with ==</typeparam>
+/// <typeparam name="MaxCycles">Longest iteration, in bus cycles</typeparam>
+/// <typeparam name="MaxLength">Longest backward jump (in bytes) that starts a recording</typeparam>
+template <typename TRegs, int MaxCycles = 32, int MaxLength = 16>
+class IdleLoopDetector {
+private:
+	TRegs _regs = {};
+	uint32_t _startPc = 0;
+	uint32_t _lastPc = 0;
+
+	uint8_t _cycleCount = 0;
+	uint8_t _cycles[MaxCycles] = {};
+	uint32_t _length = 0;
+
+	uint8_t _readCount = 0;
+	uint32_t _readAddr[MaxCycles] = {};
+	uint8_t _readValue[MaxCycles] = {};
+
+	bool _recording = false;
+	bool _ready = false;
+
+	IdleLoopStats _stats = {};
+
+public:
+	[[nodiscard]] bool IsRecording() const { return _recording; }
+
+	/// <summary>True when an iteration starting at pc can be replayed (checked on every cycle, keep it cheap)</summary>
+	[[nodiscard]] bool CanSkipAt(uint32_t pc) const { return _ready && pc == _startPc; }
+
+	/// <summary>Length of the recorded iteration, in the clocks given to RecordCycle</summary>
+	[[nodiscard]] uint32_t GetLength() const { return _length; }
+
+	[[nodiscard]] const IdleLoopStats& GetStats() const { return _stats; }
+	void ResetStats() { _stats = {}; }
+
+	/// <summary>
+	/// Called at every opcode fetch.
+	/// </summary>
+	/// <param name="pc">Address of the opcode</param>
+	/// <param name="regs">Current registers</param>
+	/// <returns>True when this completed an iteration (the core can save its temporary values)</returns>
+	bool ProcessOpCode(uint32_t pc, const TRegs& regs) {
+		if (_recording) [[unlikely]] {
+			if (pc != _startPc) {
+				_lastPc = pc;
+				return false;
+			}
+
+			_recording = false;
+			if (regs == _regs && _cycleCount > 0) {
+				// Back at the start with the same registers, the iteration can be replayed
+				_ready = true;
+				_lastPc = pc;
+				_stats.RecordedLoops++;
+				return true;
+			}
+		}
+
+		if (pc < _lastPc && _lastPc - pc <= (uint32_t)MaxLength && !CanSkipAt(pc)) [[unlikely]] {
+			_startPc = pc;
+			_regs = regs;
+			_cycleCount = 0;
+			_readCount = 0;
+			_length = 0;
+			_recording = true;
+			_ready = false;
+		}
+		_lastPc = pc;
+		return false;
+	}
+
+	/// <summary>Records a bus cycle of the current iteration</summary>
+	/// <param name="tag">Value given back to the callback when the cycle is replayed</param>
+	/// <param name="clocks">Duration of the cycle</param>
+	void RecordCycle(uint8_t tag, uint32_t clocks) {
+		if (_cycleCount < MaxCycles) {
+			_cycles[_cycleCount++] = tag;
+			_length += clocks;
+		} else {
+			// Too long to be a wait loop
+			_recording = false;
+		}
+	}
+
+	/// <summary>Records a read of the current iteration, must follow its RecordCycle call</summary>
+	void RecordRead(uint32_t addr, uint8_t value) {
+		if (_readCount < _cycleCount) {
+			_readAddr[_readCount] = addr;
+			_readValue[_readCount] = value;
+			_readCount++;
+		} else {
+			_recording = false;
+		}
+	}
+
+	/// <summary>Stops the current recording (the loop does something that can't be replayed)</summary>
+	void Abort() { _recording = false; }
+
+	/// <summary>Forgets the recorded iteration</summary>
+	void Reset() {
+		_recording = false;
+		_ready = false;
+	}
+
+	/// <summary>
+	/// Checks if the next iteration behaves like the recorded one. Forgets the recording when it doesn't,
+	/// so it is recorded again the next time the loop runs.
+	/// </summary>
+	/// <param name="regs">Current registers</param>
+	/// <param name="isSameRead">bool(uint32_t addr, uint8_t value): true if reading addr returns value, and will until the skip ends</param>
+	template <typename TFunc>
+	bool Matches(const TRegs& regs, TFunc isSameRead) {
+		bool result = regs == _regs;
+		for (int i = 0; result && i < _readCount; i++) {
+			result = isSameRead(_readAddr[i], _readValue[i]);
+		}
+
+		if (!result) {
+			_ready = false;
+			_stats.RejectedSkips++;
+		}
+		return result;
+	}
+
+	/// <summary>
+	/// Replays the recorded iteration until the next one would reach targetCycle (the last one runs normally).
+	/// </summary>
+	/// <param name="cycle">Current cycle, in the clocks given to RecordCycle</param>
+	/// <param name="targetCycle">First cycle the skip must not reach</param>
+	/// <param name="runCycle">void(uint8_t tag): runs a bus cycle, called for every recorded cycle of every iteration</param>
+	/// <returns>Number of iterations replayed</returns>
+	template <typename TFunc>
+	uint64_t Skip(uint64_t cycle, int64_t targetCycle, TFunc runCycle) {
+		if (_length == 0 || (int64_t)(cycle + _length) >= targetCycle) {
+			return 0;
+		}
+
+		uint64_t count = ((uint64_t)targetCycle - cycle - 1) / _length;
+		for (uint64_t i = 0; i < count; i++) {
+			for (int j = 0; j < _cycleCount; j++) {
+				runCycle(_cycles[j]);
+			}
+		}
+
+		_stats.Skips++;
+		_stats.SkippedIterations += count;
+		_stats.SkippedCycles += count * _length;
+		return count;
+	}
+};
@@ -117,7 +117,7 @@ void InputHud::DrawOutline(int width, int height) {
 	_outlineHeight = height;
 }
 
-void InputHud::DrawController(ControllerData& data, BaseControlManager* controlManager) {
+void InputHud::DrawController(const ControllerData& data, BaseControlManager* controlManager) {
 	shared_ptr<BaseControlDevice> controller = controlManager->CreateControllerDevice(data.Type, data.Port);
 	if (!controller) {
 		return;
@@ -171,7 +171,7 @@ void InputHud::EndDrawController() {
 	_controllerIndex++;
 }
 
-void InputHud::DrawControllers(FrameInfo size, vector<ControllerData> controllerData) {
+void InputHud::DrawControllers(FrameInfo size, std::span<const ControllerData> controllerData) {
 	if (_emu->GetAudioPlayerHud()) {
 		// Don't draw controllers when playing an audio file
 		return;
@@ -214,7 +214,7 @@ void InputHud::DrawControllers(FrameInfo size, vector<ControllerData> controller
 	}
 
 	_controllerIndex = 0;
-	for (ControllerData& portData : controllerData) {
+	for (const ControllerData& portData : controllerData) {
 		DrawController(portData, console->GetControlManager());
 	}
 }
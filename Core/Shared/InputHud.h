@@ -1,5 +1,6 @@
 #pragma once
 #include "pch.h"
+#include <span>
 #include "Shared/SettingTypes.h"
 #include "Shared/ControlDeviceState.h"
 #include "Shared/Interfaces/IKeyManager.h"
@@ -55,7 +56,7 @@ private:
 	/// </summary>
 	/// <param name="data">Controller button/axis state</param>
 	/// <param name="controlManager">Control manager for device info</param>
-	void DrawController(ControllerData& data, BaseControlManager* controlManager);
+	void DrawController(const ControllerData& data, BaseControlManager* controlManager);
 
 public:
 	/// <summary>Construct input HUD for emulator</summary>
@@ -103,5 +104,5 @@ public:
 	/// </summary>
 	/// <param name="size">Frame size for layout</param>
 	/// <param name="controllerData">Controller states to visualize</param>
-	void DrawControllers(FrameInfo size, vector<ControllerData> controllerData);
+	void DrawControllers(FrameInfo size, std::span<const ControllerData> controllerData);
 };
@@ -0,0 +1,47 @@
+#pragma once
+#include "pch.h"
+#include <atomic>
+#include "Shared/Audio/AudioLatencyTracker.h"
+
+/// <summary>
+/// Measures the time between a host input event (key press, gamepad button/axis change) and the
+/// moment the emulated game polls its controllers (BaseControlManager::UpdateInputState).
+/// </summary>
+/// <remarks>
+/// Input backends call OnEvent() from whatever thread receives the event (UI thread for the keyboard
+/// and mouse, evdev reader threads for Linux gamepads), the emulation thread calls OnPolled() on each
+/// input poll. Only the oldest event since the last poll is kept (a single atomic timestamp), so
+/// neither side ever blocks. Backends that are polled instead (XInput/DirectInput) are sampled right
+/// before each poll and have no event latency to measure.
+/// </remarks>
+class InputLatencyTracker {
+private:
+	alignas(64) std::atomic<int64_t> _pendingEvent{0}; ///< Timestamp of the oldest event not polled yet (0 = none)
+	LatencyWindow _latencies;
+
+public:
+	/// <summary>Any thread: an input changed state at timestamp (microseconds, see AudioLatencyTracker::GetTimestamp)</summary>
+	void OnEvent(int64_t timestamp) {
+		int64_t expected = 0;
+		_pendingEvent.compare_exchange_strong(expected, timestamp, std::memory_order_release, std::memory_order_relaxed);
+	}
+
+	/// <summary>Emulation thread: the game polled its controllers at timestamp</summary>
+	void OnPolled(int64_t timestamp) {
+		if (_pendingEvent.load(std::memory_order_relaxed) == 0) {
+			return;
+		}
+
+		int64_t eventTime = _pendingEvent.exchange(0, std::memory_order_acquire);
+		if (eventTime != 0) {
+			_latencies.Add((uint32_t)std::clamp<int64_t>(timestamp - eventTime, 0, UINT32_MAX));
+		}
+	}
+
+	void Clear() {
+		_pendingEvent.store(0, std::memory_order_relaxed);
+		_latencies.Reset();
+	}
+
+	[[nodiscard]] LatencyPercentiles GetLatency() const { return _latencies.GetPercentiles(); }
+};
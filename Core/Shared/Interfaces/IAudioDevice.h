@@ -7,8 +7,17 @@
 /// </summary>
 struct AudioStatistics {
 	double AverageLatency = 0;             ///< Average audio latency in milliseconds
+	double CurrentLatency = 0;             ///< Latest measured latency (buffer fill) in milliseconds
 	uint32_t BufferUnderrunEventCount = 0; ///< Number of buffer underruns (audio starvation)
 	uint32_t BufferSize = 0;               ///< Current buffer size in bytes
+	uint32_t RecordingDropCount = 0;       ///< Samples dropped by the WAV recorder because the disk was too slow
+
+	double ResampleTime = 0;     ///< Average time from the start of PlayAudioBuffer to the resampler's output, in ms
+	double MixTime = 0;          ///< Average time from the start of PlayAudioBuffer until the block is handed to the device, in ms
+	double OutputLatencyP50 = 0; ///< Median time from the start of mixing a block until the device consumes it, in ms
+	double OutputLatencyP95 = 0; ///< 95th percentile of the output latency, in ms
+	double OutputLatencyP99 = 0; ///< 99th percentile of the output latency, in ms
+	double OutputLatencyMax = 0; ///< Highest output latency in the measurement window, in ms
 };
 
 /// <summary>
@@ -61,6 +70,12 @@ public:
 	/// </remarks>
 	virtual void PlayBuffer(int16_t* soundBuffer, uint32_t bufferSize, uint32_t sampleRate, bool isStereo) = 0;
 
+	/// <summary>
+	/// Set when the samples of the next PlayBuffer() call started being mixed (for latency statistics).
+	/// </summary>
+	/// <param name="timestamp">AudioLatencyTracker::GetTimestamp() value</param>
+	virtual void SetMixStartTime(int64_t timestamp) = 0;
+
 	/// <summary>
 	/// Stop audio playback and clear buffers.
 	/// </summary>
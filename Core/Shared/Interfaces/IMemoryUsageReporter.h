@@ -0,0 +1,53 @@
+#pragma once
+#include "pch.h"
+
+/// <summary>
+/// Node of the memory usage tree (see MemoryUsageRegistry).
+/// </summary>
+/// <remarks>
+/// Bytes is the memory held directly by the node, the total of a node includes its children.
+/// Sizes are what the subsystem allocated (buffer sizes/capacities), not allocator overhead.
+/// </remarks>
+struct MemoryUsageNode {
+	string Name;
+	uint64_t Bytes = 0;
+	vector<MemoryUsageNode> Children;
+
+	/// <summary>Adds a child node and returns it (reference is invalidated by the next Add() call)</summary>
+	MemoryUsageNode& Add(const string& name, uint64_t bytes = 0) {
+		Children.push_back({name, bytes, {}});
+		return Children.back();
+	}
+
+	/// <summary>Memory used by this node and all of its children</summary>
+	[[nodiscard]] uint64_t GetTotal() const {
+		uint64_t total = Bytes;
+		for (const MemoryUsageNode& child : Children) {
+			total += child.GetTotal();
+		}
+		return total;
+	}
+};
+
+/// <summary>
+/// Interface for subsystems that report their memory footprint to the MemoryUsageRegistry.
+/// </summary>
+/// <remarks>
+/// Implementers:
+/// - Emulator (console memory, run-ahead states)
+/// - RewindManager, GreenzoneManager (savestate history)
+/// - SoundMixer, VideoDecoder, VideoRenderer (audio/video buffers)
+/// - Debugger (access counters, CDL, disassembly cache)
+///
+/// Called with the emulator lock held, or from the emulation thread.
+/// </remarks>
+class IMemoryUsageReporter {
+public:
+	virtual ~IMemoryUsageReporter() = default;
+
+	/// <summary>
+	/// Fill the subsystem's node (its name is already set) with its memory usage.
+	/// </summary>
+	/// <param name="node">Node to fill (set Bytes and/or add children)</param>
+	virtual void ReportMemoryUsage(MemoryUsageNode& node) = 0;
+};
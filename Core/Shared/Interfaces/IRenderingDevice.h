@@ -46,6 +46,11 @@ struct RenderSurfaceInfo {
 		return false;
 	}
 
+	/// <summary>Size of the pixel buffer in bytes</summary>
+	[[nodiscard]] uint64_t GetBufferSize() const {
+		return (uint64_t)Width * Height * sizeof(uint32_t);
+	}
+
 	/// <summary>
 	/// Clear surface to transparent black (0x00000000).
 	/// </summary>
@@ -135,6 +140,16 @@ public:
 	/// </remarks>
 	virtual void OnRendererThreadStarted() {}
 
+	/// <summary>
+	/// True if the device applies RenderedFrame::PostProcess itself.
+	/// </summary>
+	/// <remarks>
+	/// When true, VideoDecoder skips its CPU prescale/LCD grid/scanline passes and sends
+	/// the smaller pre-upscale frame instead. Called from the video decode thread.
+	/// Optional - default implementation keeps everything on the CPU.
+	/// </remarks>
+	virtual bool SupportsGpuPostProcess() { return false; }
+
 	/// <summary>
 	/// Enter/exit exclusive fullscreen mode.
 	/// </summary>
@@ -12,6 +12,7 @@ double KeyManager::_xMouseMovement;
 double KeyManager::_yMouseMovement;
 EmuSettings* KeyManager::_settings = nullptr;
 SimpleLock KeyManager::_lock;
+InputLatencyTracker KeyManager::_inputLatency;
 
 void KeyManager::RegisterKeyManager(IKeyManager* keyManager) {
 	_xMouseMovement = 0;
@@ -131,3 +132,15 @@ void KeyManager::SetForceFeedback(uint16_t magnitudeRight, uint16_t magnitudeLef
 void KeyManager::SetForceFeedback(uint16_t magnitude) {
 	SetForceFeedback(magnitude, magnitude);
 }
+
+void KeyManager::OnInputEvent() {
+	_inputLatency.OnEvent(AudioLatencyTracker::GetTimestamp());
+}
+
+void KeyManager::OnInputPolled() {
+	_inputLatency.OnPolled(AudioLatencyTracker::GetTimestamp());
+}
+
+LatencyPercentiles KeyManager::GetInputLatency() {
+	return _inputLatency.GetLatency();
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include "pch.h"
 #include "Shared/Interfaces/IKeyManager.h"
+#include "Shared/InputLatencyTracker.h"
 #include "Utilities/SimpleLock.h"
 
 class Emulator;
@@ -44,6 +45,7 @@ private:
 	static double _yMouseMovement;       ///< Accumulated Y movement
 	static EmuSettings* _settings;       ///< Settings reference
 	static SimpleLock _lock;             ///< Thread synchronization
+	static InputLatencyTracker _inputLatency; ///< Host input event to emulated poll latency
 
 public:
 	/// <summary>Register platform-specific keyboard/mouse backend</summary>
@@ -133,4 +135,13 @@ public:
 	/// <param name="magnitudeRight">Right motor strength (0-65535)</param>
 	/// <param name="magnitudeLeft">Left motor strength (0-65535)</param>
 	static void SetForceFeedback(uint16_t magnitudeRight, uint16_t magnitudeLeft);
+
+	/// <summary>Called by the input backends (any thread) when a key, button or axis changes state</summary>
+	static void OnInputEvent();
+
+	/// <summary>Called by the emulation thread each time the game polls its controllers</summary>
+	static void OnInputPolled();
+
+	/// <summary>Time between the input events and the polls that read them (see InputLatencyTracker)</summary>
+	[[nodiscard]] static LatencyPercentiles GetInputLatency();
 };
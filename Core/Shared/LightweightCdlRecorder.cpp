@@ -4,6 +4,7 @@
 #include "Utilities/VirtualFile.h"
 #include "Utilities/FolderUtilities.h"
 #include "Shared/MessageManager.h"
+#include "Utilities/CompressionHelper.h"
 #include <fstream>
 
 LightweightCdlRecorder::LightweightCdlRecorder(IConsole* console, MemoryType prgRomType, uint32_t prgRomSize, CpuType cpuType, uint32_t romCrc32) {
@@ -74,14 +75,18 @@ bool LightweightCdlRecorder::LoadCdlFile(const string& cdlFilepath) {
 	return false;
 }
 
+void LightweightCdlRecorder::WriteHeader(ofstream& cdlFile, const char* magic) {
+	cdlFile.write(magic, 5);
+	cdlFile.put(_romCrc32 & 0xFF);
+	cdlFile.put((_romCrc32 >> 8) & 0xFF);
+	cdlFile.put((_romCrc32 >> 16) & 0xFF);
+	cdlFile.put((_romCrc32 >> 24) & 0xFF);
+}
+
 bool LightweightCdlRecorder::SaveCdlFile(const string& cdlFilepath) {
 	ofstream cdlFile(cdlFilepath, ios::out | ios::binary);
 	if (cdlFile) {
-		cdlFile.write("CDLv2", 5);
-		cdlFile.put(_romCrc32 & 0xFF);
-		cdlFile.put((_romCrc32 >> 8) & 0xFF);
-		cdlFile.put((_romCrc32 >> 16) & 0xFF);
-		cdlFile.put((_romCrc32 >> 24) & 0xFF);
+		WriteHeader(cdlFile, "CDLv2");
 		cdlFile.write((char*)_cdlData.get(), _cdlSize);
 		cdlFile.close();
 		return true;
@@ -89,6 +94,55 @@ bool LightweightCdlRecorder::SaveCdlFile(const string& cdlFilepath) {
 	return false;
 }
 
+bool LightweightCdlRecorder::SaveCompactCdlFile(const string& cdlFilepath) {
+	vector<uint8_t> compressed;
+	CompressionHelper::Compress(_cdlData.get(), _cdlSize, 9, compressed);
+
+	ofstream cdlFile(cdlFilepath, ios::out | ios::binary);
+	if (cdlFile) {
+		WriteHeader(cdlFile, "CDLz2");
+		cdlFile.write((char*)compressed.data(), compressed.size());
+		cdlFile.close();
+		return true;
+	}
+	return false;
+}
+
+bool LightweightCdlRecorder::MergeCdlFile(const string& cdlFilepath) {
+	VirtualFile cdlFile = cdlFilepath;
+	if (!cdlFile.IsValid()) {
+		return false;
+	}
+
+	vector<uint8_t>& fileData = cdlFile.GetData();
+	if (fileData.size() < (size_t)HeaderSize) {
+		return false;
+	}
+
+	uint32_t savedCrc = fileData[5] | (fileData[6] << 8) | (fileData[7] << 16) | (fileData[8] << 24);
+	if (savedCrc != _romCrc32) {
+		return false;
+	}
+
+	vector<uint8_t> flags;
+	if (memcmp(fileData.data(), "CDLz2", 5) == 0) {
+		vector<uint8_t> compressed(fileData.begin() + HeaderSize, fileData.end());
+		flags.resize(_cdlSize);
+		if (!CompressionHelper::Decompress(compressed, flags.data(), _cdlSize)) {
+			return false;
+		}
+	} else if (memcmp(fileData.data(), "CDLv2", 5) == 0 && fileData.size() >= _cdlSize + HeaderSize) {
+		flags.assign(fileData.begin() + HeaderSize, fileData.begin() + HeaderSize + _cdlSize);
+	} else {
+		return false;
+	}
+
+	for (uint32_t i = 0; i < _cdlSize; i++) {
+		_cdlData[i] |= flags[i];
+	}
+	return true;
+}
+
 void LightweightCdlRecorder::GetCdlData(uint32_t offset, uint32_t length, uint8_t* cdlData) {
 	if (offset + length <= _cdlSize) {
 		memcpy(cdlData, _cdlData.get() + offset, length);
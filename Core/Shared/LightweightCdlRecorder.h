@@ -3,6 +3,7 @@
 #include <memory>
 #include "Debugger/AddressInfo.h"
 #include "Debugger/DebugTypes.h"
+#include "Debugger/DebugUtilities.h"
 #include "Shared/MemoryOperationType.h"
 #include "Shared/Interfaces/IConsole.h"
 
@@ -25,6 +26,7 @@
 /// 2. ProcessInstruction/ProcessMemoryRead check _cdlRecorder before _debugger
 /// 3. IConsole::GetPcAbsoluteAddress() provides the current PC's absolute address
 /// 4. CDL data can be saved/loaded in standard CDL file format
+/// 5. Compact (compressed) files can be exported and merged, to combine the coverage of many runs
 ///
 /// Thread safety: Only accessed from emulation thread (same as standard CDL).
 /// </remarks>
@@ -40,6 +42,9 @@ private:
 
 	static constexpr int HeaderSize = 9;    ///< CDL file header: "CDLv2" (5) + CRC32 (4)
 
+	/// <summary>Write a CDL file header with the given 5-byte magic</summary>
+	void WriteHeader(ofstream& cdlFile, const char* magic);
+
 public:
 	/// <summary>
 	/// Create a lightweight CDL recorder.
@@ -58,7 +63,16 @@ public:
 	/// Called from Emulator::ProcessInstruction() on every CPU instruction.
 	/// Cost: ~10-15ns (one virtual call for PC + one byte OR).
 	/// </summary>
+	/// <remarks>
+	/// The console only provides the main CPU's PC: the other CPUs (SA-1, GSU, CX4, etc.) are
+	/// recorded from their opcode fetches instead (see RecordRead).
+	/// </remarks>
+	template <CpuType type>
 	__forceinline void RecordInstruction() {
+		if (type != _cpuType) {
+			return;
+		}
+
 		AddressInfo absAddr = GetPcAbsoluteAddress();
 		if (absAddr.Address >= 0 && absAddr.Type == _prgRomType) {
 			_cdlData[absAddr.Address] |= CdlFlags::Code;
@@ -70,26 +84,43 @@ public:
 	/// Called from Emulator::ProcessMemoryRead() for non-exec reads.
 	/// Only records if the read address maps to PRG ROM.
 	/// </summary>
+	/// <remarks>
+	/// CPUs that can't access the recorded ROM (e.g the SPC, or the NEC DSP/ST018 which have their own ROMs)
+	/// return after a single compare, without translating the address.
+	/// </remarks>
 	/// <param name="relAddr">Relative address in CPU address space</param>
-	/// <param name="memType">CPU memory type</param>
 	/// <param name="opType">Memory operation type (to filter exec vs data reads)</param>
-	__forceinline void RecordRead(uint32_t relAddr, MemoryType memType, MemoryOperationType opType) {
-		if (opType == MemoryOperationType::ExecOperand) {
+	template <CpuType type>
+	__forceinline void RecordRead(uint32_t relAddr, MemoryOperationType opType) {
+		if (DebugUtilities::GetPrgRomMemoryType(type) != _prgRomType) {
+			return;
+		}
+
+		uint8_t flags;
+		switch (opType) {
+			case MemoryOperationType::ExecOpCode:
+				if (type == _cpuType) {
+					// Recorded by RecordInstruction (opcode fetches can be prefetches that are never executed, e.g on GBA)
+					return;
+				}
+				flags = CdlFlags::Code;
+				break;
+
 			// Operand bytes are part of the instruction — mark as code
-			AddressInfo addrInfo = { (int32_t)relAddr, memType };
-			AddressInfo absAddr = _console->GetAbsoluteAddress(addrInfo);
-			if (absAddr.Address >= 0 && absAddr.Type == _prgRomType) {
-				_cdlData[absAddr.Address] |= CdlFlags::Code;
-			}
-		} else if (opType == MemoryOperationType::Read) {
+			case MemoryOperationType::ExecOperand: flags = CdlFlags::Code; break;
+
 			// Data read from ROM
-			AddressInfo addrInfo = { (int32_t)relAddr, memType };
-			AddressInfo absAddr = _console->GetAbsoluteAddress(addrInfo);
-			if (absAddr.Address >= 0 && absAddr.Type == _prgRomType) {
-				_cdlData[absAddr.Address] |= CdlFlags::Data;
-			}
+			case MemoryOperationType::Read: flags = CdlFlags::Data; break;
+
+			// DummyRead, DmaRead, InternalOperation, etc. — skip for lightweight CDL
+			default: return;
+		}
+
+		AddressInfo addrInfo = { (int32_t)relAddr, DebugUtilities::GetCpuMemoryType(type) };
+		AddressInfo absAddr = _console->GetAbsoluteAddress(addrInfo);
+		if (absAddr.Address >= 0 && absAddr.Type == _prgRomType) {
+			_cdlData[absAddr.Address] |= flags;
 		}
-		// DummyRead, DmaRead, InternalOperation, etc. — skip for lightweight CDL
 	}
 
 	/// <summary>Reset all CDL flags to zero.</summary>
@@ -113,6 +144,18 @@ public:
 	/// <summary>Save CDL data to file.</summary>
 	[[nodiscard]] bool SaveCdlFile(const string& cdlFilepath);
 
+	/// <summary>
+	/// Save CDL data to a compressed file, for exporting the coverage of a session.
+	/// </summary>
+	/// <remarks>Format: "CDLz2" + ROM CRC32 + CompressionHelper data (most of a CDL is zeroes, files are a few KB).</remarks>
+	[[nodiscard]] bool SaveCompactCdlFile(const string& cdlFilepath);
+
+	/// <summary>
+	/// Merge the flags of a CDL file (standard or compact) into the current data.
+	/// </summary>
+	/// <remarks>Used to combine the coverage of several sessions, files for another ROM (CRC mismatch) are rejected.</remarks>
+	[[nodiscard]] bool MergeCdlFile(const string& cdlFilepath);
+
 	/// <summary>Get CDL data for a range.</summary>
 	void GetCdlData(uint32_t offset, uint32_t length, uint8_t* cdlData);
 
@@ -0,0 +1,18 @@
+#include "pch.h"
+#include "Shared/LinkCable.h"
+#include "Shared/Emulator.h"
+
+LinkCable::LinkCable() {
+	for (int i = 0; i < 2; i++) {
+		_ports[i]._in = &_queues[i];
+		_ports[i]._out = &_queues[i ^ 1];
+		_ports[i]._peer = &_ports[i ^ 1];
+	}
+}
+
+shared_ptr<LinkCable> LinkCable::Connect(Emulator* a, Emulator* b) {
+	shared_ptr<LinkCable> cable = std::make_shared<LinkCable>();
+	a->SetLinkCable(cable, 0);
+	b->SetLinkCable(cable, 1);
+	return cable;
+}
@@ -0,0 +1,151 @@
+#pragma once
+#include "pch.h"
+#include <atomic>
+#include <chrono>
+
+class Emulator;
+
+/// <summary>
+/// Link cable messages, the meaning of Data depends on the console's serial protocol (e.g the Lynx
+/// UART also sends its parity and break bits).
+/// </summary>
+enum class LinkCableMessageType : uint8_t {
+	TransferStart, ///< Clock master started a synchronous transfer (Data = master's byte)
+	TransferReply, ///< Clock slave's answer to TransferStart with the same Id (Data = slave's byte)
+	Byte           ///< Asynchronous (UART) byte
+};
+
+/// <summary>
+/// Message sent over a link cable, with the sender's clock at the time it was sent.
+/// </summary>
+struct LinkCableMessage {
+	uint64_t Clock;
+	uint32_t Id;
+	LinkCableMessageType Type;
+	uint16_t Data;
+};
+
+/// <summary>
+/// Lock-free single-producer/single-consumer queue of link cable messages (one per direction).
+/// </summary>
+/// <remarks>
+/// Same design as ProfilerEventQueue: free-running positions and a power of 2 capacity.
+/// </remarks>
+class LinkCableQueue {
+public:
+	static constexpr uint32_t Capacity = 256;
+
+private:
+	LinkCableMessage _messages[Capacity] = {};
+
+	// Separate cache lines, each is written by a different thread
+	alignas(64) std::atomic<uint32_t> _writePos{0};
+	alignas(64) std::atomic<uint32_t> _readPos{0};
+
+public:
+	/// <summary>Producer: appends a message, returns false if the queue is full</summary>
+	bool TryPush(const LinkCableMessage& msg) {
+		uint32_t writePos = _writePos.load(std::memory_order_relaxed);
+		if (writePos - _readPos.load(std::memory_order_acquire) >= Capacity) [[unlikely]] {
+			return false;
+		}
+		_messages[writePos & (Capacity - 1)] = msg;
+		_writePos.store(writePos + 1, std::memory_order_release);
+		return true;
+	}
+
+	/// <summary>Consumer: pops the oldest message, returns false if the queue is empty</summary>
+	__forceinline bool TryPop(LinkCableMessage& msg) {
+		uint32_t readPos = _readPos.load(std::memory_order_relaxed);
+		if (readPos == _writePos.load(std::memory_order_acquire)) {
+			return false;
+		}
+		msg = _messages[readPos & (Capacity - 1)];
+		_readPos.store(readPos + 1, std::memory_order_release);
+		return true;
+	}
+};
+
+class LinkCable;
+
+/// <summary>
+/// One end of a link cable, used by a single emulator instance (its emulation thread).
+/// </summary>
+class LinkCablePort {
+private:
+	friend class LinkCable;
+
+	LinkCableQueue* _in = nullptr;
+	LinkCableQueue* _out = nullptr;
+	LinkCablePort* _peer = nullptr;
+	std::atomic<bool> _attached{false};
+
+public:
+	/// <summary>True when an emulator instance is plugged in at the other end</summary>
+	[[nodiscard]] bool IsPeerAttached() const { return _peer->_attached.load(std::memory_order_acquire); }
+
+	void SetAttached(bool attached) { _attached.store(attached, std::memory_order_release); }
+
+	/// <summary>Sends a message to the other end (dropped if the peer's queue is full)</summary>
+	bool Send(const LinkCableMessage& msg) { return _out->TryPush(msg); }
+
+	/// <summary>Pops the next message sent by the other end</summary>
+	__forceinline bool TryReceive(LinkCableMessage& msg) { return _in->TryPop(msg); }
+
+	/// <summary>
+	/// Waits for the reply to a TransferStart message, calls processMessage for every other message received in
+	/// the meantime. Returns false if the peer is detached or doesn't answer within ReplyTimeoutMs (e.g paused).
+	/// </summary>
+	template <typename T>
+	bool WaitForReply(uint32_t id, uint8_t& reply, T&& processMessage);
+};
+
+/// <summary>
+/// In-process link cable between 2 emulator instances, each running on its own thread.
+/// </summary>
+/// <remarks>
+/// The instances run freely and exchange timestamped messages through 2 lock-free queues. They only
+/// synchronize while a synchronous transfer (e.g Game Boy serial with an internal clock) is active:
+/// the clock master waits (spinning, up to ReplyTimeoutMs) for the other instance to answer, which it
+/// does the next time it checks its serial port. Asynchronous (UART) bytes never block.
+/// </remarks>
+class LinkCable {
+private:
+	LinkCableQueue _queues[2];
+	LinkCablePort _ports[2];
+
+public:
+	static constexpr uint32_t ReplyTimeoutMs = 250;
+
+	LinkCable();
+
+	/// <summary>Port for side 0 or 1</summary>
+	LinkCablePort* GetPort(uint8_t side) { return &_ports[side & 0x01]; }
+
+	/// <summary>Plugs a new cable between 2 emulator instances (replaces any cable they were using)</summary>
+	static shared_ptr<LinkCable> Connect(Emulator* a, Emulator* b);
+};
+
+template <typename T>
+bool LinkCablePort::WaitForReply(uint32_t id, uint8_t& reply, T&& processMessage) {
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(LinkCable::ReplyTimeoutMs);
+	while (true) {
+		LinkCableMessage msg;
+		while (TryReceive(msg)) {
+			if (msg.Type == LinkCableMessageType::TransferReply) {
+				if (msg.Id == id) {
+					reply = (uint8_t)msg.Data;
+					return true;
+				}
+				// Late reply to a transfer that timed out
+				continue;
+			}
+			processMessage(msg);
+		}
+
+		if (!IsPeerAttached() || std::chrono::steady_clock::now() >= deadline) {
+			return false;
+		}
+		std::this_thread::yield();
+	}
+}
@@ -0,0 +1,54 @@
+#include "pch.h"
+#include "Shared/MemoryHeatmapRecorder.h"
+
+MemoryHeatmapRecorder::MemoryHeatmapRecorder(CpuType cpuType, const string& filepath) {
+	_cpuType = cpuType;
+
+	// Program counter size is in hex digits
+	uint32_t addressBits = DebugUtilities::GetProgramCounterSize(cpuType) * 4;
+	uint32_t maxBits = MemoryHeatmapRecorder::MaxPageCountBits;
+	_pageShift = std::max(MemoryHeatmapRecorder::MinPageShift, addressBits > maxBits ? addressBits - maxBits : 0);
+
+	uint32_t pageCount = _pageShift >= addressBits ? 1 : (1u << (addressBits - _pageShift));
+	_pageMask = pageCount - 1;
+	_pages.resize(pageCount);
+	_frameBuffer.reserve(2 + pageCount * 4);
+
+	_file.open(filepath, ios::out | ios::binary | ios::trunc);
+	if (_file) {
+		uint32_t header[4] = {
+			0, MemoryHeatmapRecorder::FormatVersion,
+			(uint32_t)cpuType | (_pageShift << 8), pageCount
+		};
+		memcpy(header, "NXHM", 4);
+		_file.write((char*)header, sizeof(header));
+	}
+}
+
+void MemoryHeatmapRecorder::EndFrame(uint32_t frameNumber) {
+	_frameBuffer.clear();
+	_frameBuffer.push_back(frameNumber);
+	_frameBuffer.push_back(0);
+
+	uint32_t entryCount = 0;
+	for (uint32_t i = 0; i < (uint32_t)_pages.size(); i++) {
+		PageCounters& page = _pages[i];
+		if (page.Reads | page.Writes | page.Execs) {
+			_frameBuffer.push_back(i);
+			_frameBuffer.push_back(page.Reads);
+			_frameBuffer.push_back(page.Writes);
+			_frameBuffer.push_back(page.Execs);
+			page = {};
+			entryCount++;
+		}
+	}
+	_frameBuffer[1] = entryCount;
+
+	if (_file) {
+		_file.write((char*)_frameBuffer.data(), _frameBuffer.size() * sizeof(uint32_t));
+	}
+}
+
+void MemoryHeatmapRecorder::DiscardFrame() {
+	std::fill(_pages.begin(), _pages.end(), PageCounters{});
+}
@@ -0,0 +1,104 @@
+#pragma once
+#include "pch.h"
+#include "Debugger/DebugTypes.h"
+#include "Debugger/DebugUtilities.h"
+#include "Shared/MemoryOperationType.h"
+
+/// <summary>
+/// Per-page read/write/execute counters of the main CPU's address space, streamed to a file once per frame.
+/// </summary>
+/// <remarks>
+/// A much cheaper alternative to MemoryAccessCounter (no debugger, no address translation, no timestamps),
+/// meant to stay enabled during long automated runs to show the memory hot spots of a whole playthrough.
+///
+/// The address space is split into at most MaxPageCount pages (256 bytes minimum). Each access is a shift and
+/// an increment, counts are reset after every frame.
+///
+/// File format (little endian):
+/// - Header: "NXHM" + uint32 version (1) + uint8 CpuType + uint8 page shift + uint16 reserved + uint32 page count
+/// - For each frame: uint32 frame number + uint32 entry count, then for each page accessed during the frame:
+///   uint32 page index + uint32 reads + uint32 writes + uint32 executes (opcode and operand fetches)
+///
+/// Thread safety: Only accessed from emulation thread.
+/// </remarks>
+class MemoryHeatmapRecorder {
+public:
+	static constexpr uint32_t MaxPageCountBits = 12;
+	static constexpr uint32_t MaxPageCount = 1 << MaxPageCountBits;
+	static constexpr uint32_t MinPageShift = 8;
+	static constexpr uint32_t FormatVersion = 1;
+
+	/// <summary>Access counts of a page for the current frame</summary>
+	struct PageCounters {
+		uint32_t Reads;
+		uint32_t Writes;
+		uint32_t Execs;
+	};
+
+private:
+	CpuType _cpuType = {};
+	uint32_t _pageShift = 0;
+	uint32_t _pageMask = 0;
+	vector<PageCounters> _pages;
+	vector<uint32_t> _frameBuffer; ///< Reused serialization buffer
+	ofstream _file;
+
+public:
+	/// <summary>
+	/// Create a heatmap recorder for a CPU and start writing to a file.
+	/// </summary>
+	/// <param name="cpuType">CPU whose accesses are counted (accesses from other CPUs are ignored)</param>
+	/// <param name="filepath">Output file, overwritten</param>
+	MemoryHeatmapRecorder(CpuType cpuType, const string& filepath);
+
+	/// <summary>True if the output file could be created</summary>
+	[[nodiscard]] bool IsOpen() const { return _file.is_open() && _file.good(); }
+
+	[[nodiscard]] uint32_t GetPageShift() const { return _pageShift; }
+	[[nodiscard]] uint32_t GetPageCount() const { return (uint32_t)_pages.size(); }
+
+	/// <summary>Counters of a page for the current frame</summary>
+	[[nodiscard]] const PageCounters& GetPage(uint32_t page) const { return _pages[page]; }
+
+	/// <summary>Count a memory read (called from Emulator::ProcessMemoryRead)</summary>
+	template <CpuType type>
+	__forceinline void RecordRead(uint32_t addr, MemoryOperationType opType) {
+		if (type != _cpuType) {
+			return;
+		}
+
+		PageCounters& page = _pages[(addr >> _pageShift) & _pageMask];
+		switch (opType) {
+			case MemoryOperationType::ExecOpCode:
+			case MemoryOperationType::ExecOperand:
+				page.Execs++;
+				break;
+
+			case MemoryOperationType::Read:
+			case MemoryOperationType::DmaRead:
+				page.Reads++;
+				break;
+
+			default:
+				break;
+		}
+	}
+
+	/// <summary>Count a memory write (called from Emulator::ProcessMemoryWrite)</summary>
+	template <CpuType type>
+	__forceinline void RecordWrite(uint32_t addr, MemoryOperationType opType) {
+		if (type != _cpuType) {
+			return;
+		}
+
+		if (opType == MemoryOperationType::Write || opType == MemoryOperationType::DmaWrite) {
+			_pages[(addr >> _pageShift) & _pageMask].Writes++;
+		}
+	}
+
+	/// <summary>Write the counts of the pages accessed during the frame to the file and reset them</summary>
+	void EndFrame(uint32_t frameNumber);
+
+	/// <summary>Reset the counts without writing them (e.g for run-ahead frames)</summary>
+	void DiscardFrame();
+};
@@ -0,0 +1,70 @@
+#pragma once
+#include "pch.h"
+
+/// <summary>
+/// Direct read/write pointers for each page of a CPU address space.
+/// </summary>
+/// <remarks>
+/// The memory managers map ROM/RAM banks here when the mapper registers change, so accesses only cost a
+/// table lookup. A null page means the access is not plain memory (open bus, registers, read-only for
+/// writes) and the memory manager's own handling applies.
+/// </remarks>
+/// <typeparam name="PageShift">Page size, as a power of 2 (8 = 256-byte pages)</typeparam>
+/// <typeparam name="PageCount">Number of pages in the address space</typeparam>
+template <uint32_t PageShift, uint32_t PageCount>
+class MemoryPageTable {
+public:
+	static constexpr uint32_t PageSize = 1 << PageShift;
+	static constexpr uint32_t PageMask = PageSize - 1;
+
+private:
+	uint8_t* _reads[PageCount] = {};
+	uint8_t* _writes[PageCount] = {};
+
+public:
+	[[nodiscard]] __forceinline uint8_t* GetReadPage(uint32_t addr) const { return _reads[addr >> PageShift]; }
+	[[nodiscard]] __forceinline uint8_t* GetWritePage(uint32_t addr) const { return _writes[addr >> PageShift]; }
+
+	/// <summary>Reads a byte, or returns openBus when the page isn't mapped</summary>
+	[[nodiscard]] __forceinline uint8_t Read(uint32_t addr, uint8_t openBus) const {
+		uint8_t* page = _reads[addr >> PageShift];
+		return page ? page[addr & PageMask] : openBus;
+	}
+
+	/// <summary>Writes a byte, ignored when the page isn't writable</summary>
+	__forceinline void Write(uint32_t addr, uint8_t value) {
+		if (uint8_t* page = _writes[addr >> PageShift]) {
+			page[addr & PageMask] = value;
+		}
+	}
+
+	/// <summary>
+	/// Maps [start, end) to the memory block, starting at offset (wrapped to the block's size). The block is
+	/// mirrored when it is smaller than the range, an empty block unmaps the range.
+	/// </summary>
+	void Map(uint32_t start, uint32_t end, uint8_t* memory, uint32_t size, uint32_t offset, bool readonly) {
+		if (size == 0 || !memory) {
+			Unmap(start, end);
+			return;
+		}
+
+		offset %= size;
+		for (uint32_t i = start; i < end; i += PageSize) {
+			uint8_t* src = memory + offset;
+			_reads[i >> PageShift] = src;
+			_writes[i >> PageShift] = readonly ? nullptr : src;
+
+			offset += PageSize;
+			if (offset >= size) {
+				offset = 0;
+			}
+		}
+	}
+
+	void Unmap(uint32_t start, uint32_t end) {
+		for (uint32_t i = start; i < end; i += PageSize) {
+			_reads[i >> PageShift] = nullptr;
+			_writes[i >> PageShift] = nullptr;
+		}
+	}
+};
@@ -0,0 +1,43 @@
+#include "pch.h"
+#include "Shared/MemoryUsageRegistry.h"
+#include "Utilities/StringUtilities.h"
+
+void MemoryUsageRegistry::Register(const string& name, IMemoryUsageReporter* reporter) {
+	auto lock = _lock.AcquireSafe();
+	Unregister(reporter);
+	_reporters.push_back({name, reporter});
+}
+
+void MemoryUsageRegistry::Unregister(IMemoryUsageReporter* reporter) {
+	auto lock = _lock.AcquireSafe();
+	std::erase_if(_reporters, [=](const Reporter& entry) { return entry.Instance == reporter; });
+}
+
+MemoryUsageNode MemoryUsageRegistry::GetUsage() {
+	auto lock = _lock.AcquireSafe();
+	MemoryUsageNode root = {"Total", 0, {}};
+	root.Children.reserve(_reporters.size());
+	for (Reporter& reporter : _reporters) {
+		MemoryUsageNode& node = root.Add(reporter.Name);
+		reporter.Instance->ReportMemoryUsage(node);
+	}
+	return root;
+}
+
+vector<MemoryUsageEntry> MemoryUsageRegistry::GetFlatUsage() {
+	vector<MemoryUsageEntry> entries;
+	Flatten(GetUsage(), 0, entries);
+	return entries;
+}
+
+void MemoryUsageRegistry::Flatten(const MemoryUsageNode& node, uint32_t depth, vector<MemoryUsageEntry>& entries) {
+	MemoryUsageEntry entry = {};
+	StringUtilities::CopyToBuffer(node.Name, entry.Name, sizeof(entry.Name) - 1);
+	entry.Bytes = node.GetTotal();
+	entry.Depth = depth;
+	entries.push_back(entry);
+
+	for (const MemoryUsageNode& child : node.Children) {
+		Flatten(child, depth + 1, entries);
+	}
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include "pch.h"
+#include "Shared/Interfaces/IMemoryUsageReporter.h"
+#include "Utilities/SimpleLock.h"
+
+/// <summary>
+/// Flattened memory usage tree node, for interop (depth-first order, children follow their parent).
+/// </summary>
+struct MemoryUsageEntry {
+	char Name[64];
+	uint64_t Bytes; ///< Total, including the children
+	uint32_t Depth; ///< 0 = root
+};
+
+/// <summary>
+/// Registry of the subsystems that report their memory usage, builds the memory footprint tree.
+/// </summary>
+/// <remarks>
+/// Owned by the Emulator, subsystems register when they are created (or at startup for the
+/// permanent ones) and unregister before being destroyed.
+///
+/// Thread safety: registration is synchronized. GetUsage() must be called from the emulation
+/// thread or with the emulator lock held, since the reporters read their state without locking.
+/// </remarks>
+class MemoryUsageRegistry {
+private:
+	struct Reporter {
+		string Name;
+		IMemoryUsageReporter* Instance;
+	};
+
+	SimpleLock _lock{"Memory usage"};
+	vector<Reporter> _reporters;
+
+	static void Flatten(const MemoryUsageNode& node, uint32_t depth, vector<MemoryUsageEntry>& entries);
+
+public:
+	/// <summary>Register a reporter, its node is added to the root under the given name</summary>
+	void Register(const string& name, IMemoryUsageReporter* reporter);
+
+	/// <summary>Unregister a reporter (no effect if it's not registered)</summary>
+	void Unregister(IMemoryUsageReporter* reporter);
+
+	/// <summary>Build the memory usage tree (root = "Total", one child per reporter, in registration order)</summary>
+	[[nodiscard]] MemoryUsageNode GetUsage();
+
+	/// <summary>Build the memory usage tree, flattened depth-first</summary>
+	[[nodiscard]] vector<MemoryUsageEntry> GetFlatUsage();
+};
@@ -100,6 +100,7 @@ private:
 		{"MovieStopped",                  "Movie stopped."},
 		{"Movies",                        "Movies"},
 		{"NetPlay",                       "Net Play"},
+		{"NetplayDesync",                 "A client is out of sync (frame %1), sending it the current state."},
 		{"NetplayNotAllowed",             "This action is not allowed while connected to a server."},
 		{"NetplayVersionMismatch",        "Netplay client is not running the same version of Nexen and has been disconnected."},
 		{"Overclock",                     "Overclock"},
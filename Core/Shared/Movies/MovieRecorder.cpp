@@ -1,5 +1,6 @@
 #include "pch.h"
 #include <deque>
+#include <filesystem>
 #include "Utilities/HexUtilities.h"
 #include "Utilities/FolderUtilities.h"
 #include "Utilities/ZipWriter.h"
@@ -26,6 +27,7 @@ MovieRecorder::MovieRecorder(Emulator* emu) {
 
 MovieRecorder::~MovieRecorder() {
 	Stop();
+	StopWriter();
 }
 
 bool MovieRecorder::Record(const RecordMovieOptions& options) {
@@ -33,7 +35,6 @@ bool MovieRecorder::Record(const RecordMovieOptions& options) {
 	_author = options.Author;
 	_description = options.Description;
 	_writer = std::make_unique<ZipWriter>();
-	_inputData = stringstream();
 	_saveStateData = stringstream();
 	_hasSaveState = false;
 
@@ -42,6 +43,8 @@ bool MovieRecorder::Record(const RecordMovieOptions& options) {
 		_writer.reset();
 		return false;
 	} else {
+		StartWriter();
+
 		_emu->Lock();
 		_emu->GetNotificationManager()->RegisterNotificationListener(shared_from_this());
 
@@ -116,11 +119,80 @@ void MovieRecorder::WriteBool(stringstream& out, string_view name, bool enabled)
 	out << name << " " << (enabled ? "true" : "false") << "\n";
 }
 
+void MovieRecorder::StartWriter() {
+	StopWriter();
+	_inputData = std::make_unique<ZipFileCompressor>();
+	_pendingInput.clear();
+	_formatters.clear();
+	_recoveryFile.open(GetRecoveryFilename(), std::ios::out | std::ios::binary | std::ios::trunc);
+	_stopWriter = false;
+	_writerThread = std::thread(&MovieRecorder::WriterLoop, this);
+}
+
+void MovieRecorder::StopWriter() {
+	if (_writerThread.joinable()) {
+		_stopWriter = true;
+		_inputAdded.Signal();
+		_writerThread.join();
+	}
+	if (_recoveryFile.is_open()) {
+		_recoveryFile.close();
+	}
+}
+
+string MovieRecorder::GetRecoveryFilename() {
+	return _filename + ".Input.txt.recovery";
+}
+
+void MovieRecorder::WriterLoop() {
+	vector<RecordedInput> input;
+	string text;
+	string state;
+	while (true) {
+		_inputAdded.Wait(200);
+
+		// Read before taking the input, the frames recorded before StopWriter() are always written
+		bool stop = _stopWriter;
+		{
+			auto lock = _pendingInputLock.AcquireSafe();
+			input.swap(_pendingInput);
+		}
+
+		for (RecordedInput& entry : input) {
+			if (entry.EndOfFrame) {
+				text += '\n';
+			} else {
+				text += '|';
+				if (entry.Formatter) {
+					entry.Formatter->SetRawState(entry.State);
+					entry.Formatter->GetTextState(state);
+					text += state;
+				}
+			}
+		}
+		input.clear();
+
+		if (!text.empty()) {
+			_inputData->Write(text.data(), text.size());
+			if (_recoveryFile.is_open()) {
+				_recoveryFile.write(text.data(), text.size());
+				_recoveryFile.flush();
+			}
+			text.clear();
+		}
+
+		if (stop) {
+			break;
+		}
+	}
+}
+
 bool MovieRecorder::Stop() {
 	if (_writer) {
 		_emu->UnregisterInputRecorder(this);
+		StopWriter();
 
-		_writer->AddFile(_inputData, "Input.txt");
+		_writer->AddFile(*_inputData, "Input.txt");
 
 		stringstream out;
 		GetGameSettings(out);
@@ -149,7 +221,10 @@ bool MovieRecorder::Stop() {
 		}
 
 		bool result = _writer->Save();
+		_writer.reset();
 		if (result) {
+			std::error_code error;
+			std::filesystem::remove(GetRecoveryFilename(), error);
 			MessageManager::DisplayMessage("Movies", "MovieSaved", FolderUtilities::GetFilename(_filename, true));
 		}
 		return result;
@@ -159,11 +234,19 @@ bool MovieRecorder::Stop() {
 }
 
 void MovieRecorder::RecordInput(const vector<shared_ptr<BaseControlDevice>>& devices) {
-	for (const shared_ptr<BaseControlDevice>& device : devices) {
-		device->GetTextState(_textStateBuf);
-		_inputData << '|' << _textStateBuf;
+	shared_ptr<IConsole> console = _emu->GetConsole();
+	{
+		auto lock = _pendingInputLock.AcquireSafe();
+		for (const shared_ptr<BaseControlDevice>& device : devices) {
+			shared_ptr<BaseControlDevice>& formatter = _formatters[{device->GetPort(), device->GetControllerType()}];
+			if (!formatter && console) {
+				formatter = console->GetControlManager()->CreateControllerDevice(device->GetControllerType(), device->GetPort());
+			}
+			_pendingInput.push_back({formatter, device->GetRawState()});
+		}
+		_pendingInput.push_back({nullptr, {}, true});
 	}
-	_inputData << '\n';
+	_inputAdded.Signal();
 }
 
 void MovieRecorder::OnLoadBattery(const string& extension, vector<uint8_t> batteryData) {
@@ -196,23 +279,27 @@ bool MovieRecorder::CreateMovie(const string& movieFile, deque<RewindData>& data
 			_hasSaveState = true;
 			_saveStateData = stringstream();
 			_emu->GetSaveStateManager()->GetSaveStateHeader(_saveStateData);
-			data[startPosition].GetStateData(_saveStateData, data, startPosition);
+			data[startPosition].GetStateData(_saveStateData);
 		}
 
-		_inputData = stringstream();
+		_inputData = std::make_unique<ZipFileCompressor>();
 
+		string line;
 		for (uint32_t i = startPosition; i < endPosition; i++) {
 			const RewindData& rewindData = data[i];
 			for (uint32_t j = 0; j < RewindManager::BufferSize; j++) {
+				line.clear();
 				for (const auto& device : devices) {
 					uint8_t port = device->GetPort();
 					if (j < rewindData.InputLogs[port].size()) {
 						device->SetRawState(rewindData.InputLogs[port][j]);
 						device->GetTextState(_textStateBuf);
-						_inputData << '|' << _textStateBuf;
+						line += '|';
+						line += _textStateBuf;
 					}
 				}
-				_inputData << '\n';
+				line += '\n';
+				_inputData->Write(line.data(), line.size());
 			}
 		}
 
@@ -1,16 +1,34 @@
 #pragma once
 #include "pch.h"
 #include <deque>
+#include <map>
+#include <thread>
 #include <unordered_map>
 #include "Shared/Interfaces/IInputRecorder.h"
 #include "Shared/Interfaces/INotificationListener.h"
 #include "Shared/BatteryManager.h"
 #include "Shared/RewindData.h"
 #include "Shared/Movies/MovieTypes.h"
+#include "Shared/ControlDeviceState.h"
+#include "Shared/SettingTypes.h"
+#include "Utilities/AutoResetEvent.h"
+#include "Utilities/SimpleLock.h"
 
 class ZipWriter;
+class ZipFileCompressor;
 class Emulator;
+class BaseControlDevice;
 
+/// <summary>
+/// Records a movie (input log, settings, initial state/battery files) to a zip file.
+/// </summary>
+/// <remarks>
+/// RecordInput() (emulation thread) only copies each device's raw state. A writing thread formats the input as text
+/// and compresses it as the recording goes, so the emulation thread doesn't format text and the whole input log is
+/// never kept in memory uncompressed. The text is also appended to a recovery file
+/// (&lt;movie&gt;.Input.txt.recovery, deleted once the movie is saved), which keeps the input of a recording
+/// interrupted by a crash.
+/// </remarks>
 class MovieRecorder final : public INotificationListener, public IInputRecorder, public IBatteryRecorder, public IBatteryProvider, public std::enable_shared_from_this<MovieRecorder> {
 private:
 	static constexpr uint32_t MovieFormatVersion = 2;
@@ -21,8 +39,28 @@ private:
 	string _description;
 	unique_ptr<ZipWriter> _writer;
 	std::unordered_map<string, vector<uint8_t>> _batteryData;
-	stringstream _inputData;
+	unique_ptr<ZipFileCompressor> _inputData;
 	string _textStateBuf;
+
+	/// <summary>Input of a device for one frame, or end of frame marker</summary>
+	struct RecordedInput {
+		shared_ptr<BaseControlDevice> Formatter; ///< Device of the same type/port, only used to format State as text (null if none)
+		ControlDeviceState State;
+		bool EndOfFrame = false;
+	};
+
+	SimpleLock _pendingInputLock;
+	vector<RecordedInput> _pendingInput; ///< Recorded but not written yet
+	AutoResetEvent _inputAdded;
+	std::thread _writerThread;
+	atomic<bool> _stopWriter = false;
+	ofstream _recoveryFile;
+	std::map<std::pair<uint8_t, ControllerType>, shared_ptr<BaseControlDevice>> _formatters; ///< Emulation thread only
+
+	void StartWriter();
+	void StopWriter();
+	void WriterLoop();
+	[[nodiscard]] string GetRecoveryFilename();
 	bool _hasSaveState = false;
 	stringstream _saveStateData;
 
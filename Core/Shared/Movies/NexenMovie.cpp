@@ -25,12 +25,17 @@ NexenMovie::NexenMovie(Emulator* emu, bool forTest) {
 }
 
 NexenMovie::~NexenMovie() {
+	StopInputLoading();
 	_emu->UnregisterInputProvider(this);
 }
 
 void NexenMovie::Stop() {
 	if (_playing) {
-		bool isEndOfMovie = _lastPollCounter >= _inputData.size();
+		bool isEndOfMovie;
+		{
+			auto lock = _inputLock.AcquireSafe();
+			isEndOfMovie = _inputLoaded && _lastPollCounter >= _inputFrames.size();
+		}
 
 		if (!_forTest) {
 			MessageManager::DisplayMessage("Movies", isEndOfMovie ? "MovieEnded" : "MovieStopped");
@@ -50,6 +55,7 @@ void NexenMovie::Stop() {
 		_playing = false;
 	}
 
+	StopInputLoading();
 	_emu->UnregisterInputProvider(this);
 	_controlManager = nullptr;
 }
@@ -63,8 +69,18 @@ bool NexenMovie::SetInput(BaseControlDevice* device) {
 		_deviceIndex = 0;
 	}
 
-	if (_inputData.size() > inputRowIndex && _deviceCount > _deviceIndex) {
-		device->SetTextState(StringUtilities::GetNthSegmentView(_inputData[inputRowIndex], '|', _deviceIndex));
+	if (WaitForFrame(inputRowIndex) && _deviceCount > _deviceIndex) {
+		auto lock = _inputLock.AcquireSafe();
+		InputLine& line = _inputLines[_inputFrames[inputRowIndex]];
+		ParsedDeviceState& parsed = line.States[_deviceIndex];
+		if (parsed.Valid && parsed.Type == device->GetControllerType()) {
+			device->SetRawState(parsed.State);
+		} else {
+			device->SetTextState(StringUtilities::GetNthSegmentView(line.Text, '|', _deviceIndex));
+			parsed.Valid = true;
+			parsed.Type = device->GetControllerType();
+			parsed.State = device->GetRawState();
+		}
 
 		_deviceIndex++;
 		if (_deviceIndex >= _deviceCount) {
@@ -78,6 +94,114 @@ bool NexenMovie::SetInput(BaseControlDevice* device) {
 	return true;
 }
 
+bool NexenMovie::WaitForFrame(uint32_t frame) {
+	_playbackFrame = frame;
+	while (true) {
+		{
+			auto lock = _inputLock.AcquireSafe();
+			if (frame < _inputFrames.size()) {
+				return true;
+			} else if (_inputLoaded) {
+				return false;
+			}
+		}
+
+		// The loading thread is normally far ahead, this only happens right after the movie starts (or on a slow disk)
+		std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(1));
+	}
+}
+
+void NexenMovie::StartInputLoading(string movieData) {
+	StopInputLoading();
+	_stopLoading = false;
+	_loadingThread = std::thread([this, data = std::move(movieData)]() {
+		LoadInput(data);
+	});
+}
+
+void NexenMovie::StopInputLoading() {
+	_stopLoading = true;
+	if (_loadingThread.joinable()) {
+		_loadingThread.join();
+	}
+}
+
+void NexenMovie::LoadInput(const string& movieData) {
+	// Separate reader: the main reader is used by other threads (battery files)
+	ZipReader reader;
+	reader.LoadArchive((void*)movieData.data(), movieData.size());
+
+	std::unordered_map<string, uint32_t> lineIndexes;
+	string pendingLine;
+	reader.ExtractFile("Input.txt", [&](const uint8_t* data, size_t size) {
+		string_view chunk((const char*)data, size);
+		size_t start = 0;
+		size_t end;
+		while ((end = chunk.find('\n', start)) != string_view::npos) {
+			if (pendingLine.empty()) {
+				AddInputLine(chunk.substr(start, end - start), lineIndexes);
+			} else {
+				// Line started in the previous chunk
+				pendingLine.append(chunk.substr(start, end - start));
+				AddInputLine(pendingLine, lineIndexes);
+				pendingLine.clear();
+			}
+			start = end + 1;
+		}
+		pendingLine.append(chunk.substr(start));
+
+		while (!_stopLoading) {
+			size_t loadedFrames;
+			{
+				auto lock = _inputLock.AcquireSafe();
+				loadedFrames = _inputFrames.size();
+			}
+			if (loadedFrames < (size_t)_playbackFrame + NexenMovie::MaxFramesAhead) {
+				break;
+			}
+			std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(10));
+		}
+		return !_stopLoading;
+	});
+
+	if (!pendingLine.empty()) {
+		AddInputLine(pendingLine, lineIndexes);
+	}
+
+	auto lock = _inputLock.AcquireSafe();
+	_inputFrames.shrink_to_fit();
+	_inputLoaded = true;
+}
+
+void NexenMovie::AddInputLine(string_view line, std::unordered_map<string, uint32_t>& lineIndexes) {
+	if (!line.starts_with("|")) {
+		return;
+	}
+	if (line.ends_with('\r')) {
+		line.remove_suffix(1);
+	}
+
+	// Frame line minus the leading '|'
+	string_view frameData = line.substr(1);
+
+	auto lock = _inputLock.AcquireSafe();
+	if (_deviceCount == 0) {
+		_deviceCount = StringUtilities::CountSegments(frameData, '|');
+	}
+
+	if (!_inputFrames.empty() && _inputLines[_inputFrames.back()].Text == frameData) {
+		// Same input as the previous frame (most common case)
+		_inputFrames.push_back(_inputFrames.back());
+		return;
+	}
+
+	auto result = lineIndexes.try_emplace(string(frameData), (uint32_t)_inputLines.size());
+	if (result.second) {
+		_inputLines.push_back({result.first->first, vector<ParsedDeviceState>(_deviceCount)});
+	}
+	_inputFrames.push_back(result.first->second);
+}
+
 bool NexenMovie::IsPlaying() {
 	return _playing;
 }
@@ -107,36 +231,16 @@ bool NexenMovie::Play(VirtualFile& file) {
 	_reader = std::make_unique<ZipReader>();
 	_reader->LoadArchive(ss);
 
-	stringstream settingsData, inputData;
+	stringstream settingsData;
 	if (!_reader->GetStream("GameSettings.txt", settingsData)) {
 		MessageManager::Log("[Movie] File not found: GameSettings.txt");
 		return false;
 	}
-	if (!_reader->GetStream("Input.txt", inputData)) {
+	if (!_reader->CheckFile("Input.txt")) {
 		MessageManager::Log("[Movie] File not found: Input.txt");
 		return false;
 	}
 
-	// Pre-allocate using fast newline count from raw data (avoids double-pass getline)
-	{
-		const string& rawInput = inputData.str();
-		size_t lineEstimate = std::ranges::count(rawInput, '\n') + 1;
-		_inputData.reserve(lineEstimate);
-	}
-
-	string line;
-	while (std::getline(inputData, line)) {
-		if (line.starts_with("|")) {
-			// Store the frame line (minus leading '|') as a single flat string:
-			// e.g. "UDLRSsBA|UDLRSsBA" for a 2-controller NES game
-			string_view frameData = string_view(line).substr(1);
-			if (_deviceCount == 0) {
-				_deviceCount = StringUtilities::CountSegments(frameData, '|');
-			}
-			_inputData.emplace_back(frameData);
-		}
-	}
-
 	_deviceIndex = 0;
 
 	ParseSettings(settingsData);
@@ -153,6 +257,9 @@ bool NexenMovie::Play(VirtualFile& file) {
 		return false;
 	}
 
+	// The input is loaded while the game is reset and while the movie plays
+	StartInputLoading(ss.str());
+
 	auto emuLock = _emu->AcquireLock(false);
 
 	if (!ApplySettings(settingsData)) {
@@ -1,9 +1,13 @@
 #pragma once
 
 #include "pch.h"
+#include <thread>
 #include "Utilities/VirtualFile.h"
+#include "Utilities/SimpleLock.h"
 #include "Shared/BatteryManager.h"
 #include "Shared/Interfaces/INotificationListener.h"
+#include "Shared/ControlDeviceState.h"
+#include "Shared/SettingTypes.h"
 #include "Shared/Movies/MovieManager.h"
 
 class ZipReader;
@@ -22,8 +26,40 @@ private:
 	bool _playing = false;
 	size_t _deviceIndex = 0;
 	uint32_t _lastPollCounter = 0;
-	vector<string> _inputData;
-	size_t _deviceCount = 0;	vector<string> _cheats;
+
+	/// <summary>Device state parsed from an input line (parsed the first time the line is used by that device)</summary>
+	struct ParsedDeviceState {
+		bool Valid = false;
+		ControllerType Type = {};
+		ControlDeviceState State = {};
+	};
+
+	/// <summary>Distinct input line of the movie (e.g "UDLRSsBA|UDLRSsBA" for a 2-controller NES game)</summary>
+	struct InputLine {
+		string Text;
+		vector<ParsedDeviceState> States; ///< Per device index
+	};
+
+	/// <summary>
+	/// Most frames repeat an earlier line (same buttons held, no input), each line is only stored and parsed once
+	/// and the frames refer to it by index.
+	/// </summary>
+	/// <remarks>
+	/// Input.txt is decompressed and split into lines by _loadingThread while the movie plays (up to
+	/// MaxFramesAhead frames ahead of the emulation), so long movies start immediately. Protected by _inputLock.
+	/// </remarks>
+	vector<InputLine> _inputLines;
+	vector<uint32_t> _inputFrames; ///< Index in _inputLines for each frame
+	size_t _deviceCount = 0;
+	bool _inputLoaded = false; ///< True once the whole Input.txt has been processed
+	SimpleLock _inputLock;
+
+	static constexpr uint32_t MaxFramesAhead = 10000;
+
+	std::thread _loadingThread;
+	atomic<bool> _stopLoading = false;
+	atomic<uint32_t> _playbackFrame = 0; ///< Frame being played, the loading thread waits when it is far enough ahead
+	vector<string> _cheats;
 	vector<CheatCode> _originalCheats;
 	stringstream _emuSettingsBackup;
 	unordered_map<string, string> _settings;
@@ -41,6 +77,14 @@ private:
 	void LoadCheats();
 	bool LoadCheat(const string& cheatData, CheatCode& code);
 
+	void StartInputLoading(string movieData);
+	void StopInputLoading();
+	void LoadInput(const string& movieData);
+	void AddInputLine(string_view line, std::unordered_map<string, uint32_t>& lineIndexes);
+
+	/// <summary>Waits until the frame's input is loaded, returns false if the movie has no input for the frame</summary>
+	bool WaitForFrame(uint32_t frame);
+
 public:
 	NexenMovie(Emulator* emu, bool silent);
 	virtual ~NexenMovie();
@@ -2,68 +2,158 @@
 #include <algorithm>
 #include "Shared/NotificationManager.h"
 
-void NotificationManager::RegisterNotificationListener(shared_ptr<INotificationListener> notificationListener) {
+NotificationManager::NotificationManager() {
+	_list = std::make_unique<ListenerList>();
+	_currentList = _list.get();
+}
+
+NotificationManager::~NotificationManager() {
+	if (_dispatchThread) {
+		_stopDispatch = true;
+		_queueSignal.Signal();
+		_dispatchThread->join();
+	}
+}
+
+void NotificationManager::Publish(unique_ptr<ListenerList> list) {
+	list->HasQueuedListeners = std::any_of(list->Entries.begin(), list->Entries.end(), [](const ListenerEntry& entry) {
+		return entry.Delivery == NotificationDelivery::Queued;
+	});
+
+	_retiredLists.push_back(std::move(_list));
+	_list = std::move(list);
+	_currentList = _list.get();
+
+	// Readers increment the counter before loading the list pointer: when no reader is active after the new
+	// list was published, any reader that starts from now on will get the new list, so the old ones can be freed.
+	if (_activeReaders == 0) {
+		_retiredLists.clear();
+	}
+}
+
+unique_ptr<NotificationManager::ListenerList> NotificationManager::CopyLiveListeners() {
+	unique_ptr<ListenerList> list = std::make_unique<ListenerList>();
+	list->Entries.reserve(_list->Entries.size() + 1);
+	for (const ListenerEntry& entry : _list->Entries) {
+		if (!entry.Listener.expired()) {
+			list->Entries.push_back(entry);
+		}
+	}
+	return list;
+}
+
+void NotificationManager::RegisterNotificationListener(shared_ptr<INotificationListener> notificationListener, NotificationDelivery delivery) {
 	auto lock = _lock.AcquireSafe();
 
-	// Cleanup expired listeners while lock is held to avoid lock re-entry in hot registration paths.
-	_listeners.erase(
-		std::remove_if(
-			_listeners.begin(),
-			_listeners.end(),
-			[](const weak_ptr<INotificationListener>& ptr) { return ptr.expired(); }),
-		_listeners.end());
-
-	for (const weak_ptr<INotificationListener>& listener : _listeners) {
-		shared_ptr<INotificationListener> existing = listener.lock();
-		if (existing && existing == notificationListener) {
+	// Cleanup expired listeners in the same pass (the listener list is rebuilt anyway)
+	unique_ptr<ListenerList> list = CopyLiveListeners();
+	auto existing = std::find_if(list->Entries.begin(), list->Entries.end(), [&](const ListenerEntry& entry) {
+		return entry.Key == notificationListener.get();
+	});
+
+	if (existing != list->Entries.end()) {
+		if (existing->Delivery == delivery) {
 			// This listener is already registered, do nothing
 			return;
 		}
+		existing->Delivery = delivery;
+	} else {
+		list->Entries.push_back({notificationListener, notificationListener.get(), delivery});
 	}
 
-	_listeners.push_back(notificationListener);
+	if (delivery == NotificationDelivery::Queued && !_dispatchThread) {
+		_dispatchThread = std::make_unique<std::thread>(&NotificationManager::DispatchThread, this);
+	}
+
+	Publish(std::move(list));
+}
+
+void NotificationManager::UnregisterNotificationListener(INotificationListener* notificationListener) {
+	auto lock = _lock.AcquireSafe();
+	unique_ptr<ListenerList> list = CopyLiveListeners();
+	std::erase_if(list->Entries, [=](const ListenerEntry& entry) { return entry.Key == notificationListener; });
+	Publish(std::move(list));
 }
 
 void NotificationManager::CleanupNotificationListeners() {
 	auto lock = _lock.AcquireSafe();
+	Publish(CopyLiveListeners());
+}
 
-	// Remove expired listeners
-	_listeners.erase(
-	    std::remove_if(
-	        _listeners.begin(),
-	        _listeners.end(),
-	        [](const weak_ptr<INotificationListener>& ptr) { return ptr.expired(); }),
-	    _listeners.end());
+void NotificationManager::Dispatch(ConsoleNotificationType type, void* parameter, bool queued) {
+	bool hasExpiredListeners = false;
+	bool hasQueuedListeners = false;
+
+	_activeReaders++;
+	const ListenerList* list = _currentList;
+	for (const ListenerEntry& entry : list->Entries) {
+		if (queued != (entry.Delivery == NotificationDelivery::Queued && NotificationManager::IsQueueable(type))) {
+			hasQueuedListeners |= !queued;
+			continue;
+		}
+
+		shared_ptr<INotificationListener> listener = entry.Listener.lock();
+		if (listener) {
+			listener->ProcessNotification(type, parameter);
+		} else {
+			hasExpiredListeners = true;
+		}
+	}
+	_activeReaders--;
+
+	if (hasQueuedListeners && _queuedDeliveryEnabled) {
+		Enqueue(type, parameter);
+	}
+
+	// Prune dead listeners for the next notifications, unless a list update is already in progress
+	if (hasExpiredListeners && _lock.TryAcquire(0)) {
+		Publish(CopyLiveListeners());
+		_lock.Release();
+	}
 }
 
 void NotificationManager::SendNotification(ConsoleNotificationType type, void* parameter) {
-	// Build a strong snapshot under lock and prune expired listeners in one pass.
-	// This keeps callback execution lock-free while reducing weak_ptr lock churn.
-	// Reuses _snapshot member to avoid heap allocation on every notification.
+	Dispatch(type, parameter, false);
+}
+
+void NotificationManager::Enqueue(ConsoleNotificationType type, void* parameter) {
+	if (type == ConsoleNotificationType::PpuFrameDone) {
+		// Frame buffer pointer, only valid during the SendNotification() call
+		parameter = nullptr;
+	}
+
 	{
-		auto lock = _lock.AcquireSafe();
-		_snapshot.clear();
-		_snapshot.reserve(_listeners.size());
-
-		auto writeIt = _listeners.begin();
-		for (auto readIt = _listeners.begin(); readIt != _listeners.end(); readIt++) {
-			shared_ptr<INotificationListener> listener = readIt->lock();
-			if (!listener) {
-				continue;
+		auto lock = _queueLock.AcquireSafe();
+		for (const QueuedNotification& pending : _queue) {
+			if (pending.Type == type && pending.Parameter == parameter) {
+				// Already pending, the listeners will see it once
+				return;
 			}
-
-			*writeIt = *readIt;
-			writeIt++;
-			_snapshot.push_back(std::move(listener));
 		}
-
-		_listeners.erase(writeIt, _listeners.end());
+		if (_queue.size() >= NotificationManager::MaxQueueSize) {
+			return;
+		}
+		_queue.push_back({type, parameter});
 	}
+	_queueSignal.Signal();
+}
 
-	for (size_t i = 0; i < _snapshot.size(); i++) {
-		_snapshot[i]->ProcessNotification(type, parameter);
-	}
+void NotificationManager::DispatchThread() {
+	vector<QueuedNotification> notifications;
+	while (!_stopDispatch) {
+		_queueSignal.Wait();
 
-	// Release shared_ptr refs after callbacks complete
-	_snapshot.clear();
+		{
+			auto lock = _queueLock.AcquireSafe();
+			notifications.swap(_queue);
+		}
+
+		for (const QueuedNotification& notification : notifications) {
+			if (_stopDispatch) {
+				return;
+			}
+			Dispatch(notification.Type, notification.Parameter, true);
+		}
+		notifications.clear();
+	}
 }
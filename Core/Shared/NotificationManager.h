@@ -1,8 +1,16 @@
 #pragma once
 #include "pch.h"
+#include <thread>
 #include "Shared/Interfaces/INotificationListener.h"
+#include "Utilities/AutoResetEvent.h"
 #include "Utilities/SimpleLock.h"
 
+/// <summary>How a listener receives the notifications</summary>
+enum class NotificationDelivery {
+	Synchronous, ///< Called by the thread that sends the notification (all notification types)
+	Queued       ///< High-frequency notifications (see IsQueueable) are delivered by the dispatch thread, the others synchronously
+};
+
 /// <summary>
 /// Event notification broadcast system for emulator events.
 /// Notifies registered listeners about console state changes and important events.
@@ -31,32 +39,104 @@
 /// notificationMgr.RegisterNotificationListener(listener);
 /// </code>
 ///
+/// Listener list (read-copy-update):
+/// - The list is immutable once published, register/unregister build a new list under _lock and swap it in
+/// - SendNotification() reads the current list without locking (registering/unregistering listeners from
+///   within a callback is allowed, the change applies to the next notification)
+/// - Replaced lists are freed by the next update made while no thread is reading a list
+///
+/// Queued delivery:
+/// - For listeners that don't need to run on the sending thread (e.g the UI): frequent notifications are
+///   queued and delivered by a dispatch thread, so slow callbacks don't stall the emulation thread
+/// - Pending notifications with the same type and parameter are merged (a slow listener skips frames)
+/// - Only types whose parameter is a value (or unused) are queued, the parameter of PpuFrameDone (frame
+///   buffer pointer, only valid during the call) is always nullptr when queued
+///
 /// Cleanup:
 /// - Automatic cleanup of dead weak_ptr references
 /// - Safe to destroy listeners without unregistering
-/// - Thread-safe registration and broadcast
 ///
-/// Thread safety: All methods synchronized via SimpleLock.
+/// Thread safety: all methods can be called from any thread.
 /// </remarks>
 class NotificationManager {
 private:
-	SimpleLock _lock;                                   ///< Thread synchronization lock
-	vector<weak_ptr<INotificationListener>> _listeners; ///< Registered listeners (weak refs)
-	vector<shared_ptr<INotificationListener>> _snapshot; ///< Reusable snapshot buffer (avoids heap alloc per notification)
+	struct ListenerEntry {
+		weak_ptr<INotificationListener> Listener;
+		INotificationListener* Key; ///< Identifies the listener (Listener may have expired)
+		NotificationDelivery Delivery;
+	};
+
+	struct ListenerList {
+		vector<ListenerEntry> Entries;
+		bool HasQueuedListeners = false;
+	};
+
+	struct QueuedNotification {
+		ConsoleNotificationType Type;
+		void* Parameter;
+	};
+
+	static constexpr size_t MaxQueueSize = 256;
+
+	SimpleLock _lock{"Notifications"};                ///< Serializes list updates (never taken by SendNotification)
+	unique_ptr<ListenerList> _list;                   ///< Current list (owned)
+	atomic<const ListenerList*> _currentList;         ///< Current list (read without lock)
+	atomic<uint32_t> _activeReaders = 0;              ///< Threads iterating over a list
+	vector<unique_ptr<ListenerList>> _retiredLists;   ///< Replaced lists that may still be read
+
+	SimpleLock _queueLock{"Notification queue"};
+	vector<QueuedNotification> _queue;
+	AutoResetEvent _queueSignal;
+	unique_ptr<std::thread> _dispatchThread;
+	atomic<bool> _stopDispatch = false;
+	atomic<bool> _queuedDeliveryEnabled = true;
+
+	/// <summary>Publish a new list (_lock must be held)</summary>
+	void Publish(unique_ptr<ListenerList> list);
+
+	/// <summary>Copy of the current list without its expired listeners (_lock must be held)</summary>
+	[[nodiscard]] unique_ptr<ListenerList> CopyLiveListeners();
 
 	/// <summary>Remove dead listener references (expired weak_ptr)</summary>
 	void CleanupNotificationListeners();
 
+	/// <summary>Call the listeners of the current list with the given delivery mode</summary>
+	void Dispatch(ConsoleNotificationType type, void* parameter, bool queued);
+
+	void Enqueue(ConsoleNotificationType type, void* parameter);
+	void DispatchThread();
+
 public:
+	NotificationManager();
+	~NotificationManager();
+
+	NotificationManager(const NotificationManager&) = delete;
+	NotificationManager& operator=(const NotificationManager&) = delete;
+
+	/// <summary>True for the notification types delivered by the dispatch thread to queued listeners</summary>
+	[[nodiscard]] static constexpr bool IsQueueable(ConsoleNotificationType type) {
+		return type == ConsoleNotificationType::PpuFrameDone;
+	}
+
 	/// <summary>
 	/// Register notification listener.
 	/// </summary>
 	/// <param name="notificationListener">Listener to register (as shared_ptr)</param>
+	/// <param name="delivery">Synchronous (default) or queued delivery of the high-frequency notifications</param>
 	/// <remarks>
 	/// Stores weak_ptr - safe if listener destroyed without unregistering.
 	/// Listener receives all future notifications via ProcessNotification().
+	/// Registering a listener again only updates its delivery mode.
+	/// </remarks>
+	void RegisterNotificationListener(shared_ptr<INotificationListener> notificationListener, NotificationDelivery delivery = NotificationDelivery::Synchronous);
+
+	/// <summary>
+	/// Unregister notification listener (no effect if it's not registered).
+	/// </summary>
+	/// <remarks>
+	/// A notification that is being sent by another thread can still reach the listener.
 	/// </remarks>
-	void RegisterNotificationListener(shared_ptr<INotificationListener> notificationListener);
+	void UnregisterNotificationListener(INotificationListener* notificationListener);
 
 	/// <summary>
 	/// Broadcast notification to all registered listeners.
@@ -64,10 +144,15 @@ public:
 	/// <param name="type">Notification type (event category)</param>
 	/// <param name="parameter">Optional event-specific data pointer</param>
 	/// <remarks>
-	/// Calls ProcessNotification() on each live listener.
-	/// Takes a snapshot of the listener list under lock, then iterates
-	/// outside the lock to minimize contention during callbacks.
+	/// Calls ProcessNotification() on each live listener (queued listeners are called later by the
+	/// dispatch thread for IsQueueable types). Lock-free: reads the current listener list snapshot.
 	/// Thread-safe - can be called from any thread.
 	/// </remarks>
 	void SendNotification(ConsoleNotificationType type, void* parameter = nullptr);
+
+	/// <summary>
+	/// When disabled, the queued listeners (UI refreshes) don't receive the IsQueueable notifications, so the
+	/// emulation thread doesn't wake up the dispatch thread on every frame (headless mode).
+	/// </summary>
+	void SetQueuedDeliveryEnabled(bool enabled) { _queuedDeliveryEnabled = enabled; }
 };
@@ -6,9 +6,12 @@
 #include "Shared/MessageManager.h"
 #include "Shared/NotificationManager.h"
 #include "Shared/Movies/MovieManager.h"
+#include "Shared/Video/BaseVideoFilter.h"
 #include "Utilities/VirtualFile.h"
 #include "Utilities/FolderUtilities.h"
 #include "Utilities/md5.h"
+#include "Utilities/FastHash.h"
+#include "Utilities/PNGHelper.h"
 #include "Utilities/ZipWriter.h"
 #include "Utilities/ZipReader.h"
 #include "Utilities/ArchiveReader.h"
@@ -23,34 +26,39 @@ RecordedRomTest::~RecordedRomTest() {
 	Reset();
 }
 
-void RecordedRomTest::SaveFrame() {
+std::array<uint8_t, 16> RecordedRomTest::GetFrameHash() {
 	PpuFrameInfo frame = _emu->GetPpuFrame();
 
-	uint8_t md5Hash[16];
-	GetMd5Sum(md5Hash, frame.FrameBuffer, frame.FrameBufferSize);
+	std::array<uint8_t, 16> hash = {};
+	if (_useFastHash) {
+		uint64_t value = FastHash::Hash(frame.FrameBuffer, frame.FrameBufferSize);
+		memcpy(hash.data(), &value, sizeof(value));
+	} else {
+		GetMd5Sum(hash.data(), frame.FrameBuffer, frame.FrameBufferSize);
+	}
+	return hash;
+}
+
+void RecordedRomTest::SaveFrame() {
+	std::array<uint8_t, 16> hash = GetFrameHash();
 
-	if (memcmp(_previousHash, md5Hash, 16) == 0 && _currentCount < 255) {
+	if (_previousHash == hash && _currentCount < 255) {
 		_currentCount++;
 	} else {
-		std::array<uint8_t, 16> hash;
-		std::copy_n(md5Hash, 16, hash.begin());
 		_screenshotHashes.push_back(hash);
 		if (_currentCount > 0) {
 			_repetitionCount.push_back(_currentCount);
 		}
 		_currentCount = 1;
 
-		memcpy(_previousHash, md5Hash, 16);
+		_previousHash = hash;
 
 		_signal.Signal();
 	}
 }
 
 void RecordedRomTest::ValidateFrame() {
-	PpuFrameInfo frame = _emu->GetPpuFrame();
-
-	uint8_t md5Hash[16];
-	GetMd5Sum(md5Hash, frame.FrameBuffer, frame.FrameBufferSize);
+	std::array<uint8_t, 16> hash = GetFrameHash();
 
 	if (_currentCount == 0) {
 		_currentCount = _repetitionCount.front();
@@ -59,7 +67,7 @@ void RecordedRomTest::ValidateFrame() {
 	}
 	_currentCount--;
 
-	if (memcmp(_screenshotHashes.front().data(), md5Hash, 16) != 0) {
+	if (_screenshotHashes.front() != hash) {
 		_badFrameCount++;
 		_isLastFrameGood = false;
 		//_console->BreakIfDebugging();
@@ -67,6 +75,11 @@ void RecordedRomTest::ValidateFrame() {
 		_isLastFrameGood = true;
 	}
 
+	if (_badFrameCount > 0 && _capturedFrames < MismatchCaptureFrames) {
+		// Only pay for full frames once the test has diverged
+		CaptureFrame();
+	}
+
 	if (_currentCount == 0 && _repetitionCount.empty()) {
 		// End of test
 		_runningTest = false;
@@ -82,6 +95,10 @@ void RecordedRomTest::ProcessNotification(ConsoleNotificationType type, void* pa
 			} else if (_runningTest) {
 				ValidateFrame();
 			}
+			if (_recording || _runningTest) {
+				// Every frame is hashed, including in headless mode
+				_emu->RequestFrameRender();
+			}
 			break;
 
 		default:
@@ -89,8 +106,29 @@ void RecordedRomTest::ProcessNotification(ConsoleNotificationType type, void* pa
 	}
 }
 
+void RecordedRomTest::CaptureFrame() {
+	PpuFrameInfo frame = _emu->GetPpuFrame();
+	if (!frame.FrameBuffer || frame.FrameBufferSize == 0) {
+		return;
+	}
+
+	FrameInfo baseFrameInfo;
+	baseFrameInfo.Width = frame.Width;
+	baseFrameInfo.Height = frame.Height;
+
+	unique_ptr<BaseVideoFilter> filter(_emu->GetVideoFilter(true));
+	filter->SetBaseFrameInfo(baseFrameInfo);
+	FrameInfo frameInfo = filter->SendFrame((uint16_t*)frame.FrameBuffer, 0, 0, nullptr);
+
+	string testName = FolderUtilities::GetFilename(_filename, false);
+	string pngFilename = FolderUtilities::CombinePath(FolderUtilities::GetFolderName(_filename), testName + "_frame" + std::to_string(_emu->GetFrameCount()) + ".png");
+	PNGHelper::WritePNG(pngFilename, filter->GetOutputBuffer(), frameInfo.Width, frameInfo.Height);
+	_capturedFrames++;
+}
+
 void RecordedRomTest::Reset() {
-	memset(_previousHash, 0xFF, 16);
+	_previousHash.fill(0xFF);
+	_capturedFrames = 0;
 
 	_currentCount = 0;
 	_repetitionCount.clear();
@@ -103,8 +141,9 @@ void RecordedRomTest::Reset() {
 	_badFrameCount = 0;
 }
 
-void RecordedRomTest::Record(const string& filename, bool reset) {
+void RecordedRomTest::Record(const string& filename, bool reset, bool useFastHash) {
 	_emu->GetNotificationManager()->RegisterNotificationListener(shared_from_this());
+	_emu->RequestFrameRender();
 	_filename = filename;
 
 	string mrtFilename = FolderUtilities::CombinePath(FolderUtilities::GetFolderName(filename), FolderUtilities::GetFilename(filename, false) + ".mrt");
@@ -113,6 +152,7 @@ void RecordedRomTest::Record(const string& filename, bool reset) {
 	if (_file) {
 		_emu->Lock();
 		Reset();
+		_useFastHash = useFastHash;
 
 		EmuSettings* settings = _emu->GetSettings();
 		settings->GetSnesConfig().RamPowerOnState = RamState::AllZeros;
@@ -146,9 +186,11 @@ void RecordedRomTest::Record(const string& filename, bool reset) {
 RomTestResult RecordedRomTest::Run(const string& filename) {
 	RomTestResult result = {};
 	_emu->GetNotificationManager()->RegisterNotificationListener(shared_from_this());
+	_emu->RequestFrameRender();
 
 	EmuSettings* settings = _emu->GetSettings();
 	string testName = FolderUtilities::GetFilename(filename, false);
+	_filename = filename;
 
 	ZipReader zipReader;
 	zipReader.LoadArchive(filename);
@@ -178,13 +220,15 @@ RomTestResult RecordedRomTest::Run(const string& filename) {
 	if (testData && testMovie.IsValid() && testRom.IsValid()) {
 		char header[3];
 		testData.read((char*)&header, 3);
-		if (memcmp((char*)&header, "MRT", 3) != 0) {
+		bool useFastHash = memcmp((char*)&header, "MRH", 3) == 0;
+		if (!useFastHash && memcmp((char*)&header, "MRT", 3) != 0) {
 			// Invalid test file
 			result.ErrorCode = -3;
 			return result;
 		}
 
 		Reset();
+		_useFastHash = useFastHash;
 
 		uint32_t hashCount;
 		testData.read((char*)&hashCount, sizeof(uint32_t));
@@ -194,8 +238,8 @@ RomTestResult RecordedRomTest::Run(const string& filename) {
 			testData.read((char*)&repeatCount, sizeof(uint8_t));
 			_repetitionCount.push_back(repeatCount);
 
-			std::array<uint8_t, 16> screenshotHash;
-			testData.read(reinterpret_cast<char*>(screenshotHash.data()), 16);
+			std::array<uint8_t, 16> screenshotHash = {};
+			testData.read(reinterpret_cast<char*>(screenshotHash.data()), GetHashSize());
 			_screenshotHashes.push_back(screenshotHash);
 		}
 
@@ -271,14 +315,14 @@ void RecordedRomTest::Save() {
 	// Stop playing/recording the movie
 	_emu->GetMovieManager()->Stop();
 
-	_file.write("MRT", 3);
+	_file.write(_useFastHash ? "MRH" : "MRT", 3);
 
 	uint32_t hashCount = (uint32_t)_screenshotHashes.size();
 	_file.write((char*)&hashCount, sizeof(uint32_t));
 
 	for (uint32_t i = 0; i < hashCount; i++) {
 		_file.write((char*)&_repetitionCount[i], sizeof(uint8_t));
-		_file.write((char*)&_screenshotHashes[i][0], 16);
+		_file.write((char*)&_screenshotHashes[i][0], GetHashSize());
 	}
 
 	_file.close();
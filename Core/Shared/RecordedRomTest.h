@@ -44,10 +44,12 @@ struct RomTestResult {
 /// 3. Compare against recorded hashes
 /// 4. Return result (Passed/Failed/PassedWithWarnings)
 ///
-/// File format:
-/// - Frame hash (MD5, 16 bytes)
-/// - Repetition count (RLE compressed)
-/// - Deque of hashes with counts
+/// File format ("MRT" = MD5 hashes, "MRH" = 64-bit FastHash hashes):
+/// - Header + hash count
+/// - Per entry: repetition count (RLE compressed) + frame hash (16 or 8 bytes)
+///
+/// FastHash mode stores half as much per entry and hashes frames several times faster.
+/// On the first mismatch, the next few frames are written as PNG next to the test file.
 ///
 /// Failure detection:
 /// - _badFrameCount tracks consecutive mismatches
@@ -78,8 +80,12 @@ private:
 	int _badFrameCount = 0;        ///< Consecutive bad frame counter
 	bool _isLastFrameGood = false; ///< Last frame matched flag
 
-	uint8_t _previousHash[16] = {};                        ///< Previous frame MD5 hash
+	static constexpr uint32_t MismatchCaptureFrames = 3; ///< Frames saved as PNG from the first mismatch on
+
+	std::array<uint8_t, 16> _previousHash = {};            ///< Previous frame hash
 	std::deque<std::array<uint8_t, 16>> _screenshotHashes; ///< Recorded frame hashes (no manual memory management)
+	bool _useFastHash = false;                             ///< 64-bit FastHash instead of MD5 (zero-padded to 16 bytes)
+	uint32_t _capturedFrames = 0;                          ///< Mismatch frames written so far
 	std::deque<uint8_t> _repetitionCount;                  ///< RLE repetition counts
 	uint8_t _currentCount = 0;                             ///< Current repetition count
 
@@ -101,6 +107,15 @@ private:
 	/// <summary>Write test file to disk</summary>
 	void Save();
 
+	/// <summary>Hash the current frame (MD5 or FastHash, depending on the test format)</summary>
+	std::array<uint8_t, 16> GetFrameHash();
+
+	/// <summary>Write the current frame as a PNG next to the test file, for diagnosis</summary>
+	void CaptureFrame();
+
+	/// <summary>Number of hash bytes stored per entry in the test file</summary>
+	uint32_t GetHashSize() { return _useFastHash ? 8 : 16; }
+
 public:
 	/// <summary>
 	/// Construct ROM test recorder/validator.
@@ -122,7 +137,8 @@ public:
 	/// </summary>
 	/// <param name="filename">Output test filename</param>
 	/// <param name="reset">Reset emulator before recording if true</param>
-	void Record(const string& filename, bool reset);
+	/// <param name="useFastHash">Record 64-bit FastHash hashes instead of MD5</param>
+	void Record(const string& filename, bool reset, bool useFastHash = false);
 
 	/// <summary>
 	/// Run validation test.
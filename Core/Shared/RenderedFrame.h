@@ -1,7 +1,9 @@
 #pragma once
 #include "pch.h"
+#include <span>
 #include "Shared/SettingTypes.h"
 #include "Shared/ControlDeviceState.h"
+#include "Shared/Video/GpuPostProcess.h"
 
 /// <summary>
 /// Complete frame data packet containing rendered video, metadata, and input state.
@@ -16,6 +18,9 @@
 /// - VideoPhaseOffset: NES NTSC video phase offset for dot crawl simulation
 /// - InputData: Controller state for this frame (input display, movie recording)
 ///
+/// InputData is a view (usually of the control manager's port states), only valid during the call the frame
+/// is passed to. Code that keeps a frame for later (e.g another thread) copies it with CopyFrom().
+///
 /// Frame buffer format: 32-bit ARGB (0xAARRGGBB)
 /// Width/Height: Native resolution * Scale (e.g., 256x240 → 512x480 at Scale=2.0)
 /// </remarks>
@@ -54,9 +59,13 @@ struct RenderedFrame {
 	/// - Input display overlay
 	/// - Movie recording (.nexen-movie, .mmo files)
 	/// - Network play synchronization
-	/// Empty vector if input tracking is disabled.
+	/// Empty if input tracking is disabled. Not owned by the frame, see CopyFrom().
 	/// </remarks>
-	vector<ControllerData> InputData;
+	std::span<const ControllerData> InputData;
+
+	/// <summary>Effects left for the rendering device to apply (see IRenderingDevice::SupportsGpuPostProcess)</summary>
+	/// <remarks>Inactive unless the renderer supports it - Width/Height are then the pre-upscale size.</remarks>
+	GpuPostProcess PostProcess;
 
 	/// <summary>
 	/// Default constructor - initializes to 256x240 resolution with null buffers.
@@ -89,7 +98,7 @@ struct RenderedFrame {
 	/// <param name="frameNumber">Frame counter value</param>
 	/// <param name="inputData">Controller input state for this frame</param>
 	/// <param name="videoPhaseOffset">NES NTSC video phase offset (default 0)</param>
-	RenderedFrame(void* buffer, uint32_t width, uint32_t height, double scale, uint32_t frameNumber, const vector<ControllerData>& inputData, uint32_t videoPhaseOffset = 0) : FrameBuffer(buffer),
+	RenderedFrame(void* buffer, uint32_t width, uint32_t height, double scale, uint32_t frameNumber, std::span<const ControllerData> inputData, uint32_t videoPhaseOffset = 0) : FrameBuffer(buffer),
 	                                                                                                                                                                          Data(nullptr),
 	                                                                                                                                                                          Width(width),
 	                                                                                                                                                                          Height(height),
@@ -97,4 +106,14 @@ struct RenderedFrame {
 	                                                                                                                                                                          FrameNumber(frameNumber),
 	                                                                                                                                                                          VideoPhaseOffset(videoPhaseOffset),
 	                                                                                                                                                                          InputData(inputData) {}
+
+	/// <summary>
+	/// Copies a frame that must remain usable after the call it was passed to: its input data is copied into
+	/// inputDataStorage (reusing its capacity, so this doesn't allocate once the storage is large enough).
+	/// </summary>
+	void CopyFrom(const RenderedFrame& frame, vector<ControllerData>& inputDataStorage) {
+		*this = frame;
+		inputDataStorage.assign(frame.InputData.begin(), frame.InputData.end());
+		InputData = inputDataStorage;
+	}
 };
@@ -0,0 +1,352 @@
+#include "pch.h"
+#include <filesystem>
+#include "Shared/RewindArchive.h"
+#include "Shared/RewindCompressor.h"
+#include "Utilities/CompressionHelper.h"
+#include "Utilities/MemoryMappedFile.h"
+
+/// <summary>Last bytes of a sealed archive file</summary>
+struct RewindArchive::SealedFooter {
+	static constexpr uint32_t MagicValue = 0x4852584E; ///< "NXRH"
+	static constexpr uint32_t CurrentVersion = 1;
+
+	uint32_t Magic;
+	uint32_t Version;
+	uint64_t IndexOffset;
+	uint64_t IndexSize;
+	uint32_t KeySize;
+	char Key[RewindArchive::MaxSealKeySize];
+};
+
+RewindArchive::RewindArchive(const string& filename) {
+	_filename = filename;
+}
+
+RewindArchive::~RewindArchive() {
+	{
+		std::lock_guard<std::mutex> lock(_lock);
+		_stopWriteThread = true;
+	}
+	_writeCv.notify_one();
+	if (_writeThread.joinable()) {
+		_writeThread.join();
+	}
+
+	if (_fileOpened) {
+		_file.close();
+		_readFile.close();
+		_mappedFile.reset();
+		if (!_sealed) {
+			std::error_code err;
+			std::filesystem::remove(_filename, err);
+		}
+	}
+}
+
+void RewindArchive::StartWriter() {
+	_writeThread = std::thread([this]() { WriteLoop(); });
+}
+
+bool RewindArchive::Append(RewindStateBlocks& state, uint32_t& index) {
+	RewindCompressor::Wait(state);
+
+	{
+		std::lock_guard<std::mutex> lock(_lock);
+		if (_writeFailed || _sealed) {
+			return false;
+		}
+
+		if (!_fileOpened) {
+			_file.open(_filename, ios::out | ios::binary | ios::trunc);
+			_fileOpened = _file.good();
+			if (!_fileOpened) {
+				_writeFailed = true;
+				return false;
+			}
+			StartWriter();
+		}
+
+		ArchivedState archived;
+		archived.StateSize = state.StateSize;
+		archived.Blocks.reserve(state.Blocks.size());
+
+		for (size_t i = 0; i < state.Blocks.size(); i++) {
+			if (i < _lastBlocks.size() && _lastBlocks[i] == state.Blocks[i]) {
+				// Same block as the previous state, already in the file (or queued)
+				archived.Blocks.push_back(_lastLocations[i]);
+				continue;
+			}
+
+			const shared_ptr<const vector<uint8_t>>& block = state.Blocks[i];
+			archived.Blocks.push_back({_fileSize, (uint32_t)block->size()});
+			_writeQueue.push_back({_fileSize, block});
+			_unwrittenBlocks[_fileSize] = block;
+			_fileSize += block->size();
+		}
+
+		_lastBlocks = state.Blocks;
+		_lastLocations = archived.Blocks;
+
+		index = (uint32_t)_states.size();
+		_states.push_back(std::move(archived));
+	}
+	_writeCv.notify_one();
+	return true;
+}
+
+void RewindArchive::WriteLoop() {
+	vector<PendingBlock> blocks;
+	while (true) {
+		{
+			std::unique_lock<std::mutex> lock(_lock);
+			_writeCv.wait(lock, [this] { return _stopWriteThread || !_writeQueue.empty(); });
+			if (_writeQueue.empty()) {
+				return;
+			}
+			blocks.assign(_writeQueue.begin(), _writeQueue.end());
+			_writeQueue.clear();
+		}
+
+		// Blocks are queued in file order, the file is only appended to
+		for (PendingBlock& block : blocks) {
+			_file.write((const char*)block.Data->data(), block.Data->size());
+		}
+		_file.flush();
+		bool success = _file.good();
+
+		{
+			std::lock_guard<std::mutex> lock(_lock);
+			if (success) {
+				for (PendingBlock& block : blocks) {
+					_unwrittenBlocks.erase(block.Offset);
+				}
+			} else {
+				// Keep the blocks in memory (Decode still works), and stop archiving new states
+				_writeFailed = true;
+				_writeQueue.clear();
+			}
+		}
+		blocks.clear();
+		_writeDoneCv.notify_all();
+
+		if (!success) {
+			return;
+		}
+	}
+}
+
+void RewindArchive::WaitForWrites() {
+	std::unique_lock<std::mutex> lock(_lock);
+	_writeDoneCv.wait(lock, [this] { return _writeFailed || _unwrittenBlocks.empty(); });
+}
+
+bool RewindArchive::Decode(uint32_t index, vector<uint8_t>& output) {
+	ArchivedState archived;
+	vector<shared_ptr<const vector<uint8_t>>> memoryBlocks;
+	{
+		std::lock_guard<std::mutex> lock(_lock);
+		if (index >= _states.size()) {
+			return false;
+		}
+
+		archived = _states[index];
+		memoryBlocks.resize(archived.Blocks.size());
+		for (size_t i = 0; i < archived.Blocks.size(); i++) {
+			auto result = _unwrittenBlocks.find(archived.Blocks[i].Offset);
+			if (result != _unwrittenBlocks.end()) {
+				memoryBlocks[i] = result->second;
+			}
+		}
+	}
+
+	output.resize(archived.StateSize);
+	std::lock_guard<std::mutex> readLock(_readLock);
+	vector<uint8_t> fileBlock;
+	for (size_t i = 0; i < archived.Blocks.size(); i++) {
+		std::span<const uint8_t> block;
+		const BlockLocation& location = archived.Blocks[i];
+		if (memoryBlocks[i]) {
+			block = *memoryBlocks[i];
+		} else if (location.Offset + location.Size <= _mappedSize) {
+			// Written in a previous session
+			block = _mappedFile->GetSpan().subspan(location.Offset, location.Size);
+		} else {
+			// Written and flushed by the writer thread before it was removed from _unwrittenBlocks
+			if (!_readFile.is_open()) {
+				_readFile.open(_filename, ios::in | ios::binary);
+			}
+			fileBlock.resize(location.Size);
+			_readFile.seekg(location.Offset);
+			_readFile.read((char*)fileBlock.data(), location.Size);
+			if (!_readFile.good()) {
+				_readFile.clear();
+				return false;
+			}
+			block = fileBlock;
+		}
+
+		uint32_t offset = (uint32_t)i * RewindCompressor::BlockSize;
+		uint32_t len = std::min(RewindCompressor::BlockSize, archived.StateSize - offset);
+		if (!CompressionHelper::Decompress(block, output.data() + offset, len)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+uint32_t RewindArchive::GetCount() {
+	std::lock_guard<std::mutex> lock(_lock);
+	return (uint32_t)_states.size();
+}
+
+uint64_t RewindArchive::GetFileSize() {
+	std::lock_guard<std::mutex> lock(_lock);
+	return _fileSize;
+}
+
+bool RewindArchive::Seal(const string& key, const vector<uint8_t>& userData) {
+	if (key.size() > MaxSealKeySize) {
+		return false;
+	}
+
+	WaitForWrites();
+
+	std::lock_guard<std::mutex> lock(_lock);
+	if (!_fileOpened || _writeFailed || _sealed) {
+		return false;
+	}
+
+	// The writer thread is idle (nothing left to write), the index goes right after the last block
+	std::stringstream index;
+	auto write = [&index](const auto& value) { index.write((const char*)&value, sizeof(value)); };
+	write((uint32_t)_states.size());
+	for (const ArchivedState& state : _states) {
+		write(state.StateSize);
+		write((uint32_t)state.Blocks.size());
+		for (const BlockLocation& location : state.Blocks) {
+			write(location.Offset);
+			write(location.Size);
+		}
+	}
+	write((uint32_t)userData.size());
+	index.write((const char*)userData.data(), userData.size());
+
+	string indexData = index.str();
+	SealedFooter footer = {};
+	footer.Magic = SealedFooter::MagicValue;
+	footer.Version = SealedFooter::CurrentVersion;
+	footer.IndexOffset = _fileSize;
+	footer.IndexSize = indexData.size();
+	footer.KeySize = (uint32_t)key.size();
+	memcpy(footer.Key, key.data(), key.size());
+
+	_file.write(indexData.data(), indexData.size());
+	_file.write((const char*)&footer, sizeof(footer));
+	_file.flush();
+	if (!_file.good()) {
+		_file.clear();
+		return false;
+	}
+
+	_fileSize += indexData.size() + sizeof(footer);
+	_sealed = true;
+	return true;
+}
+
+bool RewindArchive::ReadFooter(std::span<const uint8_t> file, SealedFooter& footer) {
+	if (file.size() < sizeof(SealedFooter)) {
+		return false;
+	}
+
+	memcpy(&footer, file.data() + file.size() - sizeof(SealedFooter), sizeof(SealedFooter));
+	return footer.Magic == SealedFooter::MagicValue && footer.Version == SealedFooter::CurrentVersion && footer.KeySize <= MaxSealKeySize && footer.IndexOffset <= file.size() - sizeof(SealedFooter) && footer.IndexSize == file.size() - sizeof(SealedFooter) - footer.IndexOffset;
+}
+
+string RewindArchive::ReadSealedKey(const string& filename) {
+	ifstream file(filename, ios::in | ios::binary);
+	if (!file) {
+		return "";
+	}
+
+	file.seekg(0, ios::end);
+	uint64_t size = (uint64_t)file.tellg();
+	if (size < sizeof(SealedFooter)) {
+		return "";
+	}
+
+	// Only the footer is read, the key's offsets are checked against the real file size below
+	vector<uint8_t> tail(sizeof(SealedFooter));
+	file.seekg(size - sizeof(SealedFooter));
+	file.read((char*)tail.data(), tail.size());
+	SealedFooter footer;
+	if (!file.good() || tail.size() != sizeof(SealedFooter)) {
+		return "";
+	}
+	memcpy(&footer, tail.data(), sizeof(footer));
+	if (footer.Magic != SealedFooter::MagicValue || footer.Version != SealedFooter::CurrentVersion || footer.KeySize > MaxSealKeySize || footer.IndexOffset + footer.IndexSize + sizeof(SealedFooter) != size) {
+		return "";
+	}
+	return string(footer.Key, footer.KeySize);
+}
+
+shared_ptr<RewindArchive> RewindArchive::OpenSealed(const string& filename, vector<uint8_t>& userData) {
+	unique_ptr<MemoryMappedFile> mappedFile = std::make_unique<MemoryMappedFile>();
+	if (!mappedFile->Open(filename)) {
+		return nullptr;
+	}
+
+	std::span<const uint8_t> file = mappedFile->GetSpan();
+	SealedFooter footer;
+	if (!ReadFooter(file, footer)) {
+		return nullptr;
+	}
+
+	std::span<const uint8_t> index = file.subspan(footer.IndexOffset, footer.IndexSize);
+	size_t pos = 0;
+	auto read = [&](auto& value) {
+		if (pos + sizeof(value) > index.size()) {
+			return false;
+		}
+		memcpy(&value, index.data() + pos, sizeof(value));
+		pos += sizeof(value);
+		return true;
+	};
+
+	shared_ptr<RewindArchive> archive = std::make_shared<RewindArchive>(filename);
+	uint32_t stateCount = 0;
+	if (!read(stateCount)) {
+		return nullptr;
+	}
+
+	archive->_states.resize(stateCount);
+	for (ArchivedState& state : archive->_states) {
+		uint32_t blockCount = 0;
+		if (!read(state.StateSize) || !read(blockCount) || (uint64_t)blockCount * RewindCompressor::BlockSize < state.StateSize) {
+			return nullptr;
+		}
+		state.Blocks.resize(blockCount);
+		for (BlockLocation& location : state.Blocks) {
+			if (!read(location.Offset) || !read(location.Size) || location.Offset + location.Size > footer.IndexOffset) {
+				return nullptr;
+			}
+		}
+	}
+
+	uint32_t userDataSize = 0;
+	if (!read(userDataSize) || pos + userDataSize != index.size()) {
+		return nullptr;
+	}
+	userData.assign(index.data() + pos, index.data() + pos + userDataSize);
+
+	// New blocks are appended after the previous session's index (which is no longer used)
+	archive->_file.open(filename, ios::out | ios::binary | ios::app);
+	if (!archive->_file.good()) {
+		return nullptr;
+	}
+	archive->_fileOpened = true;
+	archive->_fileSize = file.size();
+	archive->_mappedSize = footer.IndexOffset;
+	archive->_mappedFile = std::move(mappedFile);
+	archive->StartWriter();
+	return archive;
+}
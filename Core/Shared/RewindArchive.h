@@ -0,0 +1,139 @@
+#pragma once
+#include "pch.h"
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <span>
+
+struct RewindStateBlocks;
+class MemoryMappedFile;
+
+/// <summary>
+/// Disk-backed store for rewind savestates that no longer fit in the rewind memory limit.
+/// </summary>
+/// <remarks>
+/// Used when the ArchiveRewindHistory preference is enabled: instead of being dropped, the oldest
+/// rewind states are moved to a temporary file, so the history viewer can reach any point of the
+/// play session (each state is followed by its input log, kept in memory by RewindData).
+///
+/// The file only contains compressed RewindCompressor blocks, the block table of each state is kept
+/// in memory. Blocks that are shared with the previously archived state are only written once (like
+/// in memory), every state can still be decoded on its own.
+///
+/// The file is created on the first Append() and deleted by the destructor.
+///
+/// Append() only reserves the blocks' location in the file: they are written by a background thread, so
+/// spilling states to the disk never blocks the emulation thread on I/O. Until a block is written, Decode()
+/// reads it from memory (the archive holds a reference to it). If a write fails, the block stays in memory
+/// and the following Append() calls fail (the oldest states are then dropped, as without an archive).
+///
+/// The file is read through a second handle, so Decode() doesn't wait for the writes in progress.
+///
+/// Persistence: Seal() writes the block tables (and the caller's data) at the end of the file, which is then kept
+/// when the archive is destroyed. OpenSealed() reattaches such a file in a later session: the existing blocks are
+/// memory-mapped (nothing is read until a state is decoded), and new states are appended after them.
+/// File layout: [blocks][index][footer], a sealed file can be reopened and sealed again any number of times
+/// (a reopened archive that isn't sealed again is deleted, like a new one).
+///
+/// Thread safety: Append() from the emulation thread, Decode() from any thread (e.g the history viewer).
+/// </remarks>
+class RewindArchive {
+private:
+	/// <summary>Location of a compressed block in the file</summary>
+	struct BlockLocation {
+		uint64_t Offset;
+		uint32_t Size;
+	};
+
+	/// <summary>Block table of an archived state</summary>
+	struct ArchivedState {
+		vector<BlockLocation> Blocks;
+		uint32_t StateSize = 0;
+	};
+
+	/// <summary>Block waiting to be written by the writer thread</summary>
+	struct PendingBlock {
+		uint64_t Offset;
+		shared_ptr<const vector<uint8_t>> Data;
+	};
+
+	string _filename;
+	std::ofstream _file; ///< Writer thread only (once opened)
+	std::ifstream _readFile;
+	bool _fileOpened = false;
+	uint64_t _fileSize = 0; ///< Including the blocks that are not written yet
+	std::mutex _lock;
+	std::mutex _readLock;
+
+	vector<ArchivedState> _states;
+
+	std::thread _writeThread;
+	std::condition_variable _writeCv;
+	std::condition_variable _writeDoneCv;
+	std::deque<PendingBlock> _writeQueue;
+	std::map<uint64_t, shared_ptr<const vector<uint8_t>>> _unwrittenBlocks; ///< Queued or being written (or failed), by offset
+	bool _writeFailed = false;
+	bool _stopWriteThread = false;
+	bool _sealed = false; ///< Index written, the file is kept
+
+	unique_ptr<MemoryMappedFile> _mappedFile; ///< Blocks of a reopened sealed file
+	uint64_t _mappedSize = 0;                 ///< Blocks before this offset are read from _mappedFile
+
+	struct SealedFooter;
+
+	// Blocks of the last archived state, to write shared blocks only once
+	// (holding them prevents their addresses from being reused by other blocks)
+	vector<shared_ptr<const vector<uint8_t>>> _lastBlocks;
+	vector<BlockLocation> _lastLocations;
+
+	void WriteLoop();
+	void StartWriter();
+
+	[[nodiscard]] static bool ReadFooter(std::span<const uint8_t> file, SealedFooter& footer);
+
+public:
+	static constexpr uint32_t MaxSealKeySize = 128;
+
+	/// <param name="filename">Temporary file to use (created on the first Append call)</param>
+	RewindArchive(const string& filename);
+	~RewindArchive();
+
+	RewindArchive(const RewindArchive&) = delete;
+	RewindArchive& operator=(const RewindArchive&) = delete;
+
+	/// <summary>Adds a compressed state to the archive, its blocks are written in the background (waits for the compressor if needed)</summary>
+	/// <param name="state">Block table to archive</param>
+	/// <param name="index">Index of the archived state, used to decode it</param>
+	/// <returns>False if the file could not be created or a previous write failed</returns>
+	bool Append(RewindStateBlocks& state, uint32_t& index);
+
+	/// <summary>Waits until every block appended so far is written to the file</summary>
+	void WaitForWrites();
+
+	/// <summary>Reads and decompresses an archived state</summary>
+	[[nodiscard]] bool Decode(uint32_t index, vector<uint8_t>& output);
+
+	/// <summary>
+	/// Writes the index at the end of the file (after the pending blocks), and keeps the file when the archive is
+	/// destroyed. key identifies what the history belongs to, userData is returned as is by OpenSealed().
+	/// No state can be appended to a sealed archive.
+	/// </summary>
+	bool Seal(const string& key, const vector<uint8_t>& userData);
+
+	/// <summary>Reads the key of a sealed archive file (footer only), returns an empty string if it isn't one</summary>
+	[[nodiscard]] static string ReadSealedKey(const string& filename);
+
+	/// <summary>Reattaches a sealed archive file, the new states are appended to it</summary>
+	/// <returns>Null if the file is not a valid sealed archive</returns>
+	[[nodiscard]] static shared_ptr<RewindArchive> OpenSealed(const string& filename, vector<uint8_t>& userData);
+
+	[[nodiscard]] const string& GetFilename() const { return _filename; }
+
+	/// <summary>Number of archived states</summary>
+	[[nodiscard]] uint32_t GetCount();
+
+	/// <summary>Size of the archive file, in bytes (including the blocks that are not written yet)</summary>
+	[[nodiscard]] uint64_t GetFileSize();
+};
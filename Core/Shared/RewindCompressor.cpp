@@ -0,0 +1,139 @@
+#include "pch.h"
+#include "Shared/RewindCompressor.h"
+#include "Utilities/CompressionHelper.h"
+
+RewindCompressor::RewindCompressor() {
+	_thread = std::thread([this]() { WorkerLoop(); });
+}
+
+RewindCompressor::~RewindCompressor() {
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_shutdownRequested = true;
+	}
+	_cv.notify_one();
+	if (_thread.joinable()) {
+		_thread.join();
+	}
+}
+
+shared_ptr<RewindStateBlocks> RewindCompressor::Enqueue(vector<uint8_t>&& data, shared_ptr<RewindStateBlocks> prevState) {
+	shared_ptr<RewindStateBlocks> state = std::make_shared<RewindStateBlocks>();
+	state->StateSize = (uint32_t)data.size();
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_queue.push({std::move(data), state, std::move(prevState)});
+	}
+	_cv.notify_one();
+
+	return state;
+}
+
+void RewindCompressor::WorkerLoop() {
+	while (true) {
+		Job job;
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_cv.wait(lock, [this] { return _shutdownRequested || !_queue.empty(); });
+
+			if (_shutdownRequested && _queue.empty()) {
+				return;
+			}
+
+			job = std::move(_queue.front());
+			_queue.pop();
+		}
+
+		ProcessJob(job);
+	}
+}
+
+void RewindCompressor::ProcessJob(Job& job) {
+	RewindStateBlocks& state = *job.State;
+	uint32_t size = (uint32_t)job.Data.size();
+	uint32_t blockCount = (size + BlockSize - 1) / BlockSize;
+
+	// Only dedup when the predecessor is the state we hold the raw data for
+	bool canDedup = job.PrevState && job.PrevState == _prevState && _prevData.size() == size && _prevState->Blocks.size() == blockCount;
+
+	state.Blocks.resize(blockCount);
+	uint32_t ownedBytes = 0;
+	for (uint32_t i = 0; i < blockCount; i++) {
+		uint32_t offset = i * BlockSize;
+		uint32_t len = std::min(BlockSize, size - offset);
+		if (canDedup && memcmp(job.Data.data() + offset, _prevData.data() + offset, len) == 0) {
+			state.Blocks[i] = _prevState->Blocks[i];
+		} else {
+			shared_ptr<vector<uint8_t>> block = std::make_shared<vector<uint8_t>>();
+			CompressionHelper::Compress(job.Data.data() + offset, len, 1, *block);
+			block->shrink_to_fit();
+			ownedBytes += (uint32_t)block->size();
+			state.Blocks[i] = std::move(block);
+		}
+	}
+
+	state.OwnedBytes = ownedBytes;
+	_prevData.swap(job.Data);
+	_prevState = job.State;
+
+	state.Ready = true;
+	state.Ready.notify_all();
+}
+
+void RewindCompressor::Wait(RewindStateBlocks& state) {
+	state.Ready.wait(false);
+}
+
+bool RewindCompressor::Decode(RewindStateBlocks& state, vector<uint8_t>& output) {
+	Wait(state);
+
+	output.resize(state.StateSize);
+	for (size_t i = 0; i < state.Blocks.size(); i++) {
+		uint32_t offset = (uint32_t)i * BlockSize;
+		uint32_t len = std::min(BlockSize, state.StateSize - offset);
+		if (!CompressionHelper::Decompress(*state.Blocks[i], output.data() + offset, len)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool RewindCompressor::Decode(const shared_ptr<RewindStateBlocks>& state, RewindDecodeCache& cache) {
+	Wait(*state);
+
+	// Blocks of the same index that point to the same compressed data decode to the same bytes
+	// cache.State stays null until the decode succeeds, Data is only partially up to date if it fails
+	shared_ptr<RewindStateBlocks> cached = std::move(cache.State);
+	bool canReuse = cached && cached->StateSize == state->StateSize && cached->Blocks.size() == state->Blocks.size() && cache.Data.size() == state->StateSize;
+	cache.Data.resize(state->StateSize);
+
+	for (size_t i = 0; i < state->Blocks.size(); i++) {
+		if (canReuse && cached->Blocks[i] == state->Blocks[i]) {
+			continue;
+		}
+
+		uint32_t offset = (uint32_t)i * BlockSize;
+		uint32_t len = std::min(BlockSize, state->StateSize - offset);
+		if (!CompressionHelper::Decompress(*state->Blocks[i], cache.Data.data() + offset, len)) {
+			return false;
+		}
+	}
+
+	cache.State = state;
+	return true;
+}
+
+uint32_t RewindCompressor::InheritSharedBlocks(RewindStateBlocks& next, RewindStateBlocks& dropped) {
+	Wait(next);
+	Wait(dropped);
+
+	uint32_t transferred = 0;
+	for (size_t i = 0, len = std::min(next.Blocks.size(), dropped.Blocks.size()); i < len; i++) {
+		if (next.Blocks[i] == dropped.Blocks[i]) {
+			transferred += (uint32_t)next.Blocks[i]->size();
+		}
+	}
+	next.OwnedBytes += transferred;
+	return transferred;
+}
@@ -0,0 +1,98 @@
+#pragma once
+#include "pch.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <queue>
+
+/// <summary>
+/// Block table for one rewind savestate, filled in by RewindCompressor's worker thread.
+/// </summary>
+/// <remarks>
+/// The state is split into fixed-size blocks. Each block is compressed on its own and
+/// held through a shared_ptr, so blocks that did not change since the previous snapshot
+/// are shared with it instead of being stored again.
+/// Every table is self-contained: decoding never needs the previous states.
+/// </remarks>
+struct RewindStateBlocks {
+	vector<shared_ptr<const vector<uint8_t>>> Blocks; ///< Compressed blocks (CompressionHelper format)
+	uint32_t StateSize = 0;                           ///< Uncompressed state size in bytes
+	atomic<uint32_t> OwnedBytes = 0;                  ///< Compressed bytes of blocks first stored by this state
+	atomic<bool> Ready = false;                       ///< Set by the worker once Blocks is complete
+};
+
+/// <summary>
+/// Last state decoded by RewindCompressor::Decode(), lets the next decode skip the blocks both states share.
+/// </summary>
+/// <remarks>
+/// Consecutive history states share most of their blocks, so rewinding (or stepping back in the debugger,
+/// which reloads the same state) only decompresses the blocks that changed since the previous load.
+/// </remarks>
+struct RewindDecodeCache {
+	shared_ptr<RewindStateBlocks> State; ///< Block table Data was decoded from (null when Data isn't a known state)
+	vector<uint8_t> Data;                ///< Decoded state
+
+	void Clear() { State.reset(); }
+};
+
+/// <summary>
+/// Background worker that splits rewind savestates into blocks, deduplicates unchanged
+/// blocks against the previous snapshot and compresses the changed ones.
+/// </summary>
+/// <remarks>
+/// The emulation thread only serializes the state and hands the raw buffer over with
+/// Enqueue(); it never waits unless the state is needed before the worker is done.
+///
+/// Deduplication compares against the raw copy of the last state processed by the worker.
+/// It is only used when the caller passes that same state as the predecessor - after a
+/// rewind or a history reset, the next state is stored in full.
+///
+/// Thread safety: Enqueue() from the emulation thread, Decode() from any thread.
+/// </remarks>
+class RewindCompressor {
+public:
+	static constexpr uint32_t BlockSize = 0x2000;
+
+private:
+	struct Job {
+		vector<uint8_t> Data;
+		shared_ptr<RewindStateBlocks> State;
+		shared_ptr<RewindStateBlocks> PrevState;
+	};
+
+	std::thread _thread;
+	std::queue<Job> _queue;
+	std::mutex _mutex;
+	std::condition_variable _cv;
+	bool _shutdownRequested = false;
+
+	// Worker thread state
+	vector<uint8_t> _prevData;
+	shared_ptr<RewindStateBlocks> _prevState;
+
+	void WorkerLoop();
+	void ProcessJob(Job& job);
+
+public:
+	RewindCompressor();
+	~RewindCompressor();
+
+	/// <summary>Queue a raw savestate for compression</summary>
+	/// <param name="data">Uncompressed state (moved)</param>
+	/// <param name="prevState">Block table of the previous snapshot in history (may be null)</param>
+	/// <returns>Block table, filled in asynchronously</returns>
+	[[nodiscard]] shared_ptr<RewindStateBlocks> Enqueue(vector<uint8_t>&& data, shared_ptr<RewindStateBlocks> prevState);
+
+	/// <summary>Wait for the worker to finish a block table</summary>
+	static void Wait(RewindStateBlocks& state);
+
+	/// <summary>Decompress a block table back into a full state (waits if needed)</summary>
+	static bool Decode(RewindStateBlocks& state, vector<uint8_t>& output);
+
+	/// <summary>Decompress a block table into cache.Data, only the blocks that differ from cache.State are decompressed</summary>
+	static bool Decode(const shared_ptr<RewindStateBlocks>& state, RewindDecodeCache& cache);
+
+	/// <summary>Transfer ownership of blocks shared between a state being dropped and its successor</summary>
+	/// <returns>Number of compressed bytes now owned by next</returns>
+	static uint32_t InheritSharedBlocks(RewindStateBlocks& next, RewindStateBlocks& dropped);
+};
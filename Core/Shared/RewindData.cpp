@@ -1,58 +1,71 @@
 #include "pch.h"
 #include "Shared/RewindData.h"
+#include "Shared/RewindCompressor.h"
+#include "Shared/RewindArchive.h"
 #include "Shared/Emulator.h"
 #include "Shared/SaveStateManager.h"
-#include "Utilities/CompressionHelper.h"
 
-void RewindData::GetStateData(stringstream& stateData, deque<RewindData>& prevStates, int32_t position) {
+void RewindData::GetStateData(stringstream& stateData) {
 	vector<uint8_t> data;
-	CompressionHelper::Decompress(_saveStateData, data);
-
-	if (!IsFullState) {
-		position = (position > 0 ? position : (int32_t)prevStates.size()) - 1;
-		ProcessXorState(data, prevStates, position);
+	if (DecodeState(data)) {
+		stateData.write((char*)data.data(), data.size());
 	}
+}
 
-	stateData.write((char*)data.data(), data.size());
+uint32_t RewindData::GetStateSize() const {
+	if (!_state) {
+		return 0;
+	}
+	RewindCompressor::Wait(*_state);
+	return _state->OwnedBytes;
 }
 
-template <typename T>
-void RewindData::ProcessXorState(T& data, deque<RewindData>& prevStates, int32_t position) {
-	// Find last full state and XOR with it
-	while (position >= 0 && position < prevStates.size()) {
-		RewindData& prevState = prevStates[position];
-		if (prevState.IsFullState) {
-			// XOR with previous state to restore state data to its initial state
-			if (!prevState._uncompressedData.empty()) {
-				for (size_t i = 0, len = std::min(prevState._uncompressedData.size(), data.size()); i < len; i++) {
-					data[i] ^= prevState._uncompressedData[i];
-				}
-			} else {
-				vector<uint8_t> prevStateData;
-				CompressionHelper::Decompress(prevState._saveStateData, prevStateData);
-				for (size_t i = 0, len = std::min(prevStateData.size(), data.size()); i < len; i++) {
-					data[i] ^= prevStateData[i];
-				}
-			}
-			break;
-		}
-		position--;
+bool RewindData::MoveToArchive(const shared_ptr<RewindArchive>& archive) {
+	if (!_state || !archive->Append(*_state, _archiveIndex)) {
+		return false;
 	}
+	_archive = archive;
+	_state.reset();
+	return true;
 }
 
-void RewindData::LoadState(Emulator* emu, deque<RewindData>& prevStates, int32_t position, bool sendNotification) {
-	if (_saveStateData.empty()) {
-		return;
+uint32_t RewindData::InheritSharedBlocks(RewindData& dropped) {
+	if (!_state || !dropped._state) {
+		return 0;
 	}
+	return RewindCompressor::InheritSharedBlocks(*_state, *dropped._state);
+}
 
+void RewindData::LoadState(Emulator* emu, bool sendNotification) {
 	vector<uint8_t> data;
-	CompressionHelper::Decompress(_saveStateData, data);
+	if (DecodeState(data)) {
+		LoadDecodedState(emu, data, sendNotification);
+	}
+}
 
-	if (!IsFullState) {
-		position = (position > 0 ? position : (int32_t)prevStates.size()) - 1;
-		ProcessXorState(data, prevStates, position);
+void RewindData::LoadState(Emulator* emu, RewindDecodeCache& cache, bool sendNotification) {
+	if (DecodeState(cache)) {
+		LoadDecodedState(emu, cache.Data, sendNotification);
 	}
+}
 
+bool RewindData::DecodeState(RewindDecodeCache& cache) {
+	if (_archive) {
+		// Archived blocks aren't shared through pointers, the whole state is read back
+		cache.Clear();
+		return _archive->Decode(_archiveIndex, cache.Data);
+	}
+	return _state && RewindCompressor::Decode(_state, cache);
+}
+
+bool RewindData::DecodeState(vector<uint8_t>& data) {
+	if (_archive) {
+		return _archive->Decode(_archiveIndex, data);
+	}
+	return _state && RewindCompressor::Decode(*_state, data);
+}
+
+void RewindData::LoadDecodedState(Emulator* emu, const vector<uint8_t>& data, bool sendNotification) {
 	stringstream stream;
 	stream.write((char*)data.data(), data.size());
 	stream.seekg(0, ios::beg);
@@ -60,33 +73,14 @@ void RewindData::LoadState(Emulator* emu, deque<RewindData>& prevStates, int32_t
 	(void)emu->Deserialize(stream, SaveStateManager::FileFormatVersion, true, std::nullopt, sendNotification);
 }
 
-void RewindData::SaveState(Emulator* emu, deque<RewindData>& prevStates, int32_t position) {
+void RewindData::SaveState(Emulator* emu, RewindCompressor& compressor, RewindData* prevState) {
 	std::stringstream state;
 	emu->Serialize(state, true, 0);
 
-	string data = std::move(state).str();
-
-	position = position > 0 ? position : (int32_t)prevStates.size();
-
-	if (position > 0 && (position % 30) != 0) {
-		position--;
-		ProcessXorState(data, prevStates, position);
-	} else {
-		IsFullState = true;
-		while (position > 0) {
-			position--;
-			RewindData& prevState = prevStates[position];
-			if (prevState.IsFullState) {
-				// Get rid of previous full state's uncompressed data once the next full state is added
-				prevState._uncompressedData = {};
-				break;
-			}
-		}
-
-		// Keep uncompressed data for the next 30 states - this avoids having to decompress the state 30 times
-		_uncompressedData.assign(reinterpret_cast<const uint8_t*>(data.data()), reinterpret_cast<const uint8_t*>(data.data() + data.size()));
-	}
+	string str = std::move(state).str();
+	vector<uint8_t> data(str.begin(), str.end());
 
-	CompressionHelper::Compress(data, 1, _saveStateData);
+	_state = compressor.Enqueue(std::move(data), prevState ? prevState->_state : nullptr);
+	_archive.reset();
 	FrameCount = 0;
 }
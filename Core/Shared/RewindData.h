@@ -1,92 +1,176 @@
 #pragma once
 #include "pch.h"
-#include <deque>
 #include "Shared/BaseControlDevice.h"
 
 class Emulator;
+class RewindCompressor;
+class RewindArchive;
+struct RewindStateBlocks;
+struct RewindDecodeCache;
 
 /// <summary>
-/// Savestate snapshot with XOR delta compression for rewind system.
+/// Input log of one controller port for a rewind segment, one entry per frame.
+/// </summary>
+/// <remarks>
+/// The entries are stored in a single array (reserved for a whole segment on the first push), and their
+/// states are inline (see ControlDeviceState), so recording a frame's input doesn't allocate.
+/// pop_front() only moves the start of the log.
+/// </remarks>
+class RewindInputLog {
+private:
+	static constexpr uint32_t ReservedSize = 32; ///< More than one segment's frames (RewindManager::BufferSize)
+
+	vector<ControlDeviceState> _states;
+	uint32_t _start = 0;
+
+public:
+	[[nodiscard]] size_t size() const { return _states.size() - _start; }
+	[[nodiscard]] bool empty() const { return _start == _states.size(); }
+
+	[[nodiscard]] const ControlDeviceState& operator[](size_t index) const { return _states[_start + index]; }
+	[[nodiscard]] const ControlDeviceState& front() const { return _states[_start]; }
+
+	[[nodiscard]] vector<ControlDeviceState>::const_iterator begin() const { return _states.begin() + _start; }
+	[[nodiscard]] vector<ControlDeviceState>::const_iterator end() const { return _states.end(); }
+
+	void push_back(const ControlDeviceState& state) {
+		if (_states.capacity() == 0) {
+			_states.reserve(ReservedSize);
+		}
+		_states.push_back(state);
+	}
+
+	void pop_front() {
+		if (++_start == _states.size()) {
+			clear();
+		}
+	}
+
+	void pop_back() {
+		_states.pop_back();
+		if (_start > _states.size()) {
+			_start = (uint32_t)_states.size();
+		}
+	}
+
+	void clear() {
+		_states.clear();
+		_start = 0;
+	}
+};
+
+/// <summary>
+/// Savestate snapshot with block-level deduplication for rewind system.
 /// Stores compressed savestate and input logs for frame-perfect replay.
 /// </summary>
 /// <remarks>
 /// Compression strategy:
-/// - First snapshot: Full savestate (uncompressed or zlib)
-/// - Subsequent: XOR delta against previous state (much smaller)
-/// - XOR compression: 10-100x size reduction for consecutive frames
+/// - SaveState() serializes on the emulation thread and hands the raw buffer to RewindCompressor
+/// - The worker splits it into fixed-size blocks and compares them with the previous snapshot
+/// - Unchanged blocks are shared with the previous snapshot, changed blocks are compressed
 ///
 /// Storage format:
-/// - _saveStateData: Compressed state (full or XOR delta)
-/// - _uncompressedData: Temporary buffer for decompression
+/// - _state: Block table shared between copies of this RewindData (filled in asynchronously)
 /// - InputLogs: Controller input for each port (for replay)
 ///
 /// Reconstruction:
-/// 1. LoadState() walks back through prevStates deque
-/// 2. Finds most recent full state (IsFullState=true)
-/// 3. Applies XOR deltas forward to target position
-/// 4. Deserializes final state into emulator
+/// - Each block table is self-contained, LoadState() only decompresses its own blocks
+/// - Waits for the worker if the state was captured but not compressed yet
+/// - States moved to a RewindArchive (disk) are read back from it
 ///
 /// Segment markers:
 /// - EndOfSegment: Boundary between rewind blocks (30 frames)
-/// - IsFullState: Full savestate vs delta
 ///
 /// Thread safety: Accessed from emulation thread only.
 /// </remarks>
 class RewindData {
 private:
-	vector<uint8_t> _saveStateData;    ///< Compressed savestate (full or XOR delta)
-	vector<uint8_t> _uncompressedData; ///< Temporary decompression buffer
-
-	/// <summary>
-	/// Process XOR compression/decompression against previous states.
-	/// </summary>
-	/// <param name="data">Current state data to compress/decompress</param>
-	/// <param name="prevStates">History of previous states</param>
-	/// <param name="position">Position in history (-1 = current)</param>
-	template <typename T>
-	void ProcessXorState(T& data, deque<RewindData>& prevStates, int32_t position);
+	shared_ptr<RewindStateBlocks> _state; ///< Compressed block table
+	shared_ptr<RewindArchive> _archive;   ///< Archive holding the state once it was moved to disk (_state is null)
+	uint32_t _archiveIndex = 0;           ///< Index of the state in _archive
 
 public:
 	/// <summary>Input logs per controller port (for replay)</summary>
-	std::deque<ControlDeviceState> InputLogs[BaseControlDevice::PortCount];
+	RewindInputLog InputLogs[BaseControlDevice::PortCount];
 
 	int32_t FrameCount = 0;    ///< Number of frames in this block
 	bool EndOfSegment = false; ///< Marks end of 30-frame segment
-	bool IsFullState = false;  ///< True = full state, false = XOR delta
 
 	/// <summary>
 	/// Get decompressed state data as stream.
 	/// </summary>
 	/// <param name="stateData">Output stream for state data</param>
-	/// <param name="prevStates">Previous states for XOR reconstruction</param>
-	/// <param name="position">Position in history (-1 = current)</param>
-	void GetStateData(stringstream& stateData, deque<RewindData>& prevStates, int32_t position);
+	void GetStateData(stringstream& stateData);
+
+	/// <summary>Get compressed size of the blocks owned by this state, in bytes</summary>
+	/// <remarks>Blocks shared with older states are owned (and counted) by the oldest one.</remarks>
+	[[nodiscard]] uint32_t GetStateSize() const;
+
+	/// <summary>
+	/// Move the state to a disk archive, freeing its in-memory blocks (input logs are kept).
+	/// </summary>
+	/// <returns>False if the archive could not be written (the state is unchanged)</returns>
+	bool MoveToArchive(const shared_ptr<RewindArchive>& archive);
+
+	/// <summary>True once the state was moved to a disk archive</summary>
+	[[nodiscard]] bool IsArchived() const { return _archive != nullptr; }
+
+	/// <summary>Index of the state in its archive (only valid when IsArchived())</summary>
+	[[nodiscard]] uint32_t GetArchiveIndex() const { return _archiveIndex; }
 
-	/// <summary>Get compressed state size in bytes</summary>
-	[[nodiscard]] uint32_t GetStateSize() const { return (uint32_t)_saveStateData.size(); }
+	/// <summary>Points to a state already in the archive (history restored from a sealed archive)</summary>
+	void AttachToArchive(const shared_ptr<RewindArchive>& archive, uint32_t index) {
+		_state.reset();
+		_archive = archive;
+		_archiveIndex = index;
+	}
+
+	/// <summary>
+	/// Take ownership of the blocks shared with an older state that is being dropped.
+	/// </summary>
+	/// <returns>Number of compressed bytes transferred to this state</returns>
+	uint32_t InheritSharedBlocks(RewindData& dropped);
 
 	/// <summary>
 	/// Load this savestate into emulator.
 	/// </summary>
 	/// <param name="emu">Emulator instance</param>
-	/// <param name="prevStates">Previous states for XOR reconstruction</param>
-	/// <param name="position">Position in history (-1 = current)</param>
 	/// <param name="sendNotification">Send state loaded notification if true</param>
-	/// <remarks>
-	/// Reconstructs full state from XOR deltas if needed.
-	/// Walks backward through prevStates to find full state, applies deltas forward.
-	/// </remarks>
-	void LoadState(Emulator* emu, deque<RewindData>& prevStates, int32_t position = -1, bool sendNotification = true);
+	void LoadState(Emulator* emu, bool sendNotification = true);
+
+	/// <summary>
+	/// Load this savestate into emulator, through a decode cache (see RewindDecodeCache).
+	/// </summary>
+	void LoadState(Emulator* emu, RewindDecodeCache& cache, bool sendNotification = true);
+
+	/// <summary>
+	/// Decompress this savestate without loading it (for callers that cache reconstructions).
+	/// </summary>
+	/// <param name="data">Output buffer for the decompressed state</param>
+	/// <returns>True if the state was decoded</returns>
+	[[nodiscard]] bool DecodeState(vector<uint8_t>& data);
+
+	/// <summary>
+	/// Decompress this savestate into cache.Data, reusing the blocks shared with the state decoded before it.
+	/// </summary>
+	[[nodiscard]] bool DecodeState(RewindDecodeCache& cache);
+
+	/// <summary>
+	/// Load a savestate previously decompressed by DecodeState() into emulator.
+	/// </summary>
+	/// <param name="emu">Emulator instance</param>
+	/// <param name="data">Decompressed state</param>
+	/// <param name="sendNotification">Send state loaded notification if true</param>
+	static void LoadDecodedState(Emulator* emu, const vector<uint8_t>& data, bool sendNotification = true);
 
 	/// <summary>
 	/// Save current emulator state to this snapshot.
 	/// </summary>
 	/// <param name="emu">Emulator instance</param>
-	/// <param name="prevStates">Previous states for XOR compression</param>
-	/// <param name="position">Position in history (-1 = current)</param>
+	/// <param name="compressor">Background block compressor</param>
+	/// <param name="prevState">Previous snapshot in history, used for block deduplication (may be null)</param>
 	/// <remarks>
-	/// First save is full state, subsequent saves are XOR deltas.
-	/// XOR compression: data[i] = current[i] ^ previous[i] (only stores differences).
+	/// Only serialization happens on the calling thread, compression runs on the worker.
 	/// </remarks>
-	void SaveState(Emulator* emu, deque<RewindData>& prevStates, int32_t position = -1);
+	void SaveState(Emulator* emu, RewindCompressor& compressor, RewindData* prevState);
 };
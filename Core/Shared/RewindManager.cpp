@@ -1,15 +1,21 @@
 #include "pch.h"
+#include <filesystem>
 #include "Shared/RewindManager.h"
+#include "Shared/RewindCompressor.h"
+#include "Shared/RewindArchive.h"
 #include "Shared/MessageManager.h"
 #include "Shared/Emulator.h"
 #include "Shared/EmuSettings.h"
+#include "Shared/FrameProfiler.h"
 #include "Shared/Video/VideoRenderer.h"
 #include "Shared/Audio/SoundMixer.h"
 #include "Shared/BaseControlDevice.h"
 #include "Shared/RenderedFrame.h"
 #include "Shared/BaseControlManager.h"
+#include "Utilities/FolderUtilities.h"
+#include "Utilities/sha1.h"
 
-RewindManager::RewindManager(Emulator* emu) {
+RewindManager::RewindManager(Emulator* emu) : _compressor(new RewindCompressor()) {
 	_emu = emu;
 	_settings = emu->GetSettings();
 }
@@ -42,7 +48,7 @@ void RewindManager::ClearBuffer() {
 	_historyBackup.clear();
 	_framesToFastForward = 0;
 	_videoHistory.clear();
-	_videoHistoryBuilder.clear();
+	ClearVideoHistoryBuilder();
 	_audioRingReadPos = 0;
 	_audioRingWritePos = 0;
 	_audioRingCount = 0;
@@ -50,6 +56,12 @@ void RewindManager::ClearBuffer() {
 	_rewindState = RewindState::Stopped;
 	_currentHistory = {};
 	_totalMemoryUsage = 0;
+	_decodeCache = {};
+	if (_archive) {
+		// The history viewer may still hold states from the previous archive, it deletes its file when released
+		_archivedHistory.clear();
+		_archive.reset();
+	}
 }
 
 void RewindManager::ProcessNotification(ConsoleNotificationType type, void* parameter) {
@@ -58,7 +70,7 @@ void RewindManager::ProcessNotification(ConsoleNotificationType type, void* para
 	}
 
 	if (type == ConsoleNotificationType::PpuFrameDone) {
-		_hasHistory = _history.size() >= 2;
+		_hasHistory = _history.size() + _archivedHistory.size() >= 2;
 		if (_settings->GetPreferences().RewindBufferSize > 0) {
 			switch (_rewindState) {
 				case RewindState::Starting:
@@ -94,6 +106,8 @@ void RewindManager::ProcessNotification(ConsoleNotificationType type, void* para
 		}
 	} else if (type == ConsoleNotificationType::StateLoaded) {
 		if (_rewindState == RewindState::Stopped) {
+			RestorePersistedHistory();
+
 			// A save state was loaded by the user, mark as the end of the current "segment" (for history viewer)
 			_currentHistory.EndOfSegment = true;
 			AddHistoryBlock();
@@ -109,33 +123,213 @@ RewindStats RewindManager::GetStats() {
 	return stats;
 }
 
+void RewindManager::ReportMemoryUsage(MemoryUsageNode& node) {
+	// Archived states are on disk, the video history only exists while rewinding (and belongs to the decode thread)
+	node.Add("States", _totalMemoryUsage);
+	node.Add("Audio playback buffer", _audioRingBuffer.capacity() * sizeof(int16_t));
+	node.Add("Decoded state cache", _decodeCache.Data.capacity());
+}
+
 void RewindManager::AddHistoryBlock() {
 	uint32_t maxHistorySize = _settings->GetPreferences().RewindBufferSize;
 	if (maxHistorySize > 0) {
 		// Use running total instead of O(n) iteration over entire history
 		uint64_t maxBytes = (uint64_t)maxHistorySize << 20; // Convert MB to bytes
 		while (_totalMemoryUsage > maxBytes && !_history.empty()) {
-			_totalMemoryUsage -= _history.front().GetStateSize();
-			_history.pop_front();
-
-			// Remove until next full state (deltas need their base)
-			while (!_history.empty() && !_history.front().IsFullState) {
-				_totalMemoryUsage -= _history.front().GetStateSize();
-				_history.pop_front();
-			}
+			TrimHistory();
 		}
 
 		if (_currentHistory.FrameCount > 0) {
+			// Compressed by the worker long ago (BufferSize frames), so this doesn't block
 			_totalMemoryUsage += _currentHistory.GetStateSize();
 			_history.push_back(_currentHistory);
 		}
 		_currentHistory = RewindData();
-		_currentHistory.SaveState(_emu, _history);
-		_totalMemoryUsage += _currentHistory.GetStateSize();
+		_currentHistory.SaveState(_emu, *_compressor, _history.empty() ? nullptr : &_history.back());
+	}
+}
+
+void RewindManager::TrimHistory() {
+	// States are self-contained, but blocks shared with the next state must stay counted
+	RewindData& oldest = _history.front();
+	uint64_t freedBytes = oldest.GetStateSize();
+	uint64_t sharedBytes = _history.size() > 1 ? _history[1].InheritSharedBlocks(oldest) : 0;
+	freedBytes = freedBytes > sharedBytes ? freedBytes - sharedBytes : 0;
+	_totalMemoryUsage -= std::min(freedBytes, _totalMemoryUsage);
+
+	if (oldest.IsArchived()) {
+		// Paged back in while rewinding, it's still in the archive
+		_archivedHistory.push_back(std::move(oldest));
+	} else if (_settings->GetPreferences().ArchiveRewindHistory) {
+		if (!_archive && _settings->GetPreferences().PersistRewindHistory) {
+			// Overwrites the history of a previous session that wasn't restored
+			_archive = std::make_shared<RewindArchive>(GetPersistentArchivePath());
+		} else if (!_archive) {
+			static std::atomic<uint32_t> archiveId = 0;
+			std::error_code err;
+			string tempFolder = std::filesystem::temp_directory_path(err).string();
+			if (err) {
+				tempFolder = FolderUtilities::GetHomeFolder();
+			}
+			string filename = "NexenRewind_" + std::to_string(std::chrono::system_clock::now().time_since_epoch().count()) + "_" + std::to_string(archiveId++) + ".tmp";
+			_archive = std::make_shared<RewindArchive>(FolderUtilities::CombinePath(tempFolder, filename));
+		}
+
+		if (oldest.MoveToArchive(_archive)) {
+			_archivedHistory.push_back(std::move(oldest));
+		}
 	}
+	_history.pop_front();
+}
+
+bool RewindManager::PageInArchivedState() {
+	if (!_history.empty() || _archivedHistory.empty()) {
+		return false;
+	}
+
+	// Rewinding past the states kept in memory: the state is decoded from the archive when it's loaded
+	_history.push_back(std::move(_archivedHistory.back()));
+	_archivedHistory.pop_back();
+	return true;
+}
+
+string RewindManager::GetPersistentArchivePath() {
+	string romFile = _emu->GetRomInfo().RomFile.GetFileName();
+	return FolderUtilities::CombinePath(FolderUtilities::GetSaveStateFolder(), FolderUtilities::GetFilename(romFile, false) + ".nexen-rewind");
+}
+
+string RewindManager::GetPersistentHistoryKey() {
+	vector<uint8_t> state = _emu->SerializeToBuffer();
+	return _emu->GetHash(HashType::Sha1) + ":" + SHA1::GetHash(state.data(), state.size());
+}
+
+void RewindManager::PersistHistory() {
+	if (!_settings->GetPreferences().PersistRewindHistory || _rewindState != RewindState::Stopped || _settings->GetPreferences().RewindBufferSize == 0) {
+		return;
+	}
+
+	string path = GetPersistentArchivePath();
+	if (!_archive) {
+		_archive = std::make_shared<RewindArchive>(path);
+	} else if (_archive->GetFilename() != path) {
+		// Created in the temp folder, the option was enabled during the session
+		return;
+	}
+
+	deque<RewindData> history = GetHistory();
+	if (history.back().FrameCount <= 0) {
+		history.pop_back();
+	}
+	if (history.empty()) {
+		return;
+	}
+
+	// Per state: archive index, frame count, end of segment flag and the input logs
+	vector<uint8_t> userData;
+	auto write = [&userData](const auto& value) {
+		const uint8_t* bytes = (const uint8_t*)&value;
+		userData.insert(userData.end(), bytes, bytes + sizeof(value));
+	};
+
+	write((uint32_t)history.size());
+	for (RewindData& data : history) {
+		if (!data.IsArchived() && !data.MoveToArchive(_archive)) {
+			return;
+		}
+
+		write(data.GetArchiveIndex());
+		write(data.FrameCount);
+		write((uint8_t)data.EndOfSegment);
+		for (int i = 0; i < BaseControlDevice::PortCount; i++) {
+			write((uint32_t)data.InputLogs[i].size());
+			for (const ControlDeviceState& input : data.InputLogs[i]) {
+				write((uint32_t)input.State.size());
+				userData.insert(userData.end(), input.State.begin(), input.State.end());
+			}
+		}
+	}
+
+	if (!_archive->Seal(GetPersistentHistoryKey(), userData)) {
+		MessageManager::Log("[Rewind] Could not save the rewind history: " + path);
+	}
+}
+
+void RewindManager::RestorePersistedHistory() {
+	// Only right after the game is loaded, the restored states would otherwise be older than the current history
+	if (!_settings->GetPreferences().PersistRewindHistory || _archive || !_archivedHistory.empty() || !_history.empty() || _settings->GetPreferences().RewindBufferSize == 0) {
+		return;
+	}
+
+	string path = GetPersistentArchivePath();
+	string key = RewindArchive::ReadSealedKey(path);
+	if (key.empty() || key != GetPersistentHistoryKey()) {
+		return;
+	}
+
+	vector<uint8_t> userData;
+	shared_ptr<RewindArchive> archive = RewindArchive::OpenSealed(path, userData);
+	if (!archive) {
+		return;
+	}
+
+	size_t pos = 0;
+	auto read = [&](auto& value) {
+		if (pos + sizeof(value) > userData.size()) {
+			return false;
+		}
+		memcpy(&value, userData.data() + pos, sizeof(value));
+		pos += sizeof(value);
+		return true;
+	};
+
+	uint32_t count = 0;
+	if (!read(count)) {
+		return;
+	}
+
+	deque<RewindData> restored;
+	for (uint32_t i = 0; i < count; i++) {
+		RewindData data;
+		uint32_t index = 0;
+		uint8_t endOfSegment = 0;
+		if (!read(index) || !read(data.FrameCount) || !read(endOfSegment) || index >= archive->GetCount()) {
+			return;
+		}
+		data.AttachToArchive(archive, index);
+		data.EndOfSegment = endOfSegment != 0;
+
+		for (int j = 0; j < BaseControlDevice::PortCount; j++) {
+			uint32_t inputCount = 0;
+			if (!read(inputCount)) {
+				return;
+			}
+			for (uint32_t k = 0; k < inputCount; k++) {
+				uint32_t size = 0;
+				if (!read(size) || pos + size > userData.size()) {
+					return;
+				}
+				ControlDeviceState input;
+				input.State.assign(userData.begin() + pos, userData.begin() + pos + size);
+				pos += size;
+				data.InputLogs[j].push_back(input);
+			}
+		}
+		restored.push_back(std::move(data));
+	}
+
+	if (restored.empty()) {
+		return;
+	}
+
+	// The previous session ends here, this session's history continues from the same state
+	restored.back().EndOfSegment = true;
+	_archive = archive;
+	_archivedHistory = std::move(restored);
+	MessageManager::Log("[Rewind] Restored " + std::to_string(_archivedHistory.size()) + " rewind states from the previous session");
 }
 
 void RewindManager::PopHistory() {
+	PageInArchivedState();
 	if (_history.empty() && _currentHistory.FrameCount <= 0 && !IsStepBack()) {
 		StopRewinding();
 	} else {
@@ -144,6 +338,10 @@ void RewindManager::PopHistory() {
 			_history.pop_back();
 		}
 
+		if (IsStepBack() && _currentHistory.FrameCount <= 1) {
+			PageInArchivedState();
+		}
+
 		if (IsStepBack() && _currentHistory.FrameCount <= 1 && !_history.empty() && !_history.back().EndOfSegment) {
 			// Go back an extra frame to ensure step back works across 30-frame chunks
 			_historyBackup.push_front(_currentHistory);
@@ -152,7 +350,7 @@ void RewindManager::PopHistory() {
 		}
 
 		_historyBackup.push_front(_currentHistory);
-		_currentHistory.LoadState(_emu, _history, -1, false);
+		_currentHistory.LoadState(_emu, _decodeCache, false);
 
 		if (!_audioHistoryBuilder.empty()) {
 			// Bulk insert into audio ring buffer (replaces O(n) deque front-insert)
@@ -201,7 +399,7 @@ void RewindManager::InternalStart(bool forDebugger) {
 	}
 
 	_rewindState = forDebugger ? RewindState::Debugging : RewindState::Starting;
-	_videoHistoryBuilder.clear();
+	ClearVideoHistoryBuilder();
 	_videoHistory.clear();
 	_audioHistoryBuilder.clear();
 	_audioRingReadPos = 0;
@@ -241,9 +439,7 @@ void RewindManager::ForceStop(bool deleteFutureData) {
 			if (!_videoHistory.empty()) {
 				// Update the frame on the screen to match the last frame generated during step back
 				// Needed to update the screen when stepping back to the previous frame
-				VideoFrame& frameData = _videoHistory.back();
-				RenderedFrame oldFrame(frameData.Data.data(), frameData.Width, frameData.Height, frameData.Scale, frameData.FrameNumber, frameData.InputData);
-				_emu->GetVideoRenderer()->UpdateFrame(oldFrame);
+				DisplayVideoHistoryFrame(_videoHistory.back());
 			}
 		} else {
 			while (_historyBackup.size() > 1) {
@@ -286,7 +482,7 @@ void RewindManager::Stop() {
 			_framesToFastForward = _historyBackup.front().FrameCount;
 		}
 
-		_currentHistory.LoadState(_emu, _history);
+		_currentHistory.LoadState(_emu, _decodeCache);
 		if (_framesToFastForward > 0) {
 			_rewindState = RewindState::Stopping;
 			_currentHistory.FrameCount = 0;
@@ -298,7 +494,7 @@ void RewindManager::Stop() {
 			_settings->ClearFlag(EmulationFlags::Rewind);
 		}
 
-		_videoHistoryBuilder.clear();
+		ClearVideoHistoryBuilder();
 		_videoHistory.clear();
 		_audioHistoryBuilder.clear();
 		_audioRingReadPos = 0;
@@ -308,6 +504,7 @@ void RewindManager::Stop() {
 }
 
 void RewindManager::ProcessEndOfFrame() {
+	PROFILE_SCOPE(_emu->GetFrameProfiler(), ProfilerStage::Rewind);
 	if (_rewindState >= RewindState::Starting) {
 		if (_currentHistory.FrameCount <= 0 && _rewindState != RewindState::Debugging) {
 			// If we're debugging, we want to keep running the emulation to the end of the next frame (even if it's incomplete)
@@ -352,11 +549,20 @@ void RewindManager::ProcessFrame(RenderedFrame& frame, bool forRewind) {
 			return;
 		}
 
-		// Reuse VideoFrame buffer via CopyFrom (avoids per-frame heap allocation)
-		_videoHistoryBuilder.emplace_back();
-		_videoHistoryBuilder.back().CopyFrom(frame);
+		// The previous frame can now be stored as a delta against this one
+		if (_hasPendingVideoFrame) {
+			if (_pendingVideoFrame.Width == frame.Width && _pendingVideoFrame.Height == frame.Height) {
+				_pendingVideoFrame.EncodeDelta((uint32_t*)frame.FrameBuffer, _videoEncodeBuffer);
+			}
+			_videoHistoryBuilder.push_back(std::move(_pendingVideoFrame));
+		}
+		_pendingVideoFrame.CopyFrom(frame);
+		_hasPendingVideoFrame = true;
 
-		if (_videoHistoryBuilder.size() == (size_t)_historyBackup.front().FrameCount) {
+		if (_videoHistoryBuilder.size() + 1 == (size_t)_historyBackup.front().FrameCount) {
+			// Last (newest) frame of the segment stays a keyframe - playback starts from it
+			_videoHistoryBuilder.push_back(std::move(_pendingVideoFrame));
+			_hasPendingVideoFrame = false;
 			for (int i = (int)_videoHistoryBuilder.size() - 1; i >= 0; i--) {
 				_videoHistory.push_front(std::move(_videoHistoryBuilder[i]));
 			}
@@ -367,9 +573,7 @@ void RewindManager::ProcessFrame(RenderedFrame& frame, bool forRewind) {
 			_rewindState = RewindState::Started;
 			_settings->ClearFlag(EmulationFlags::MaximumSpeed);
 			if (!_videoHistory.empty()) {
-				VideoFrame& frameData = _videoHistory.back();
-				RenderedFrame oldFrame(frameData.Data.data(), frameData.Width, frameData.Height, frameData.Scale, frameData.FrameNumber, frameData.InputData);
-				_emu->GetVideoRenderer()->UpdateFrame(oldFrame);
+				DisplayVideoHistoryFrame(_videoHistory.back());
 				_videoHistory.pop_back();
 			}
 		}
@@ -385,6 +589,65 @@ void RewindManager::ProcessFrame(RenderedFrame& frame, bool forRewind) {
 	}
 }
 
+void RewindManager::ClearVideoHistoryBuilder() {
+	_videoHistoryBuilder.clear();
+	_hasPendingVideoFrame = false;
+}
+
+void RewindManager::DisplayVideoHistoryFrame(VideoFrame& frameData) {
+	frameData.Decode(_videoDecodeBuffer);
+	RenderedFrame oldFrame(_videoDecodeBuffer.data(), frameData.Width, frameData.Height, frameData.Scale, frameData.FrameNumber, frameData.InputData);
+	oldFrame.PostProcess = frameData.PostProcess;
+	_emu->GetVideoRenderer()->UpdateFrame(oldFrame);
+}
+
+void VideoFrame::EncodeDelta(const uint32_t* nextFrame, vector<uint32_t>& scratch) {
+	uint32_t pixelCount = Width * Height;
+	scratch.clear();
+
+	uint32_t i = 0;
+	while (i < pixelCount) {
+		uint32_t start = i;
+		while (i < pixelCount && Data[i] == nextFrame[i]) {
+			i++;
+		}
+		uint32_t skip = i - start;
+
+		start = i;
+		while (i < pixelCount && Data[i] != nextFrame[i]) {
+			i++;
+		}
+		uint32_t count = i - start;
+
+		scratch.push_back(skip);
+		scratch.push_back(count);
+		for (uint32_t j = start; j < i; j++) {
+			scratch.push_back(Data[j] ^ nextFrame[j]);
+		}
+	}
+
+	Data.assign(scratch.begin(), scratch.end());
+	IsDelta = true;
+}
+
+void VideoFrame::Decode(vector<uint32_t>& buffer) const {
+	if (!IsDelta) {
+		buffer.assign(Data.begin(), Data.end());
+		return;
+	}
+
+	buffer.resize(Width * Height);
+	uint32_t pos = 0;
+	for (size_t i = 0; i + 1 < Data.size();) {
+		pos += Data[i];
+		uint32_t count = Data[i + 1];
+		i += 2;
+		for (uint32_t j = 0; j < count && pos < buffer.size(); j++) {
+			buffer[pos++] ^= Data[i++];
+		}
+	}
+}
+
 bool RewindManager::ProcessAudio(int16_t* soundBuffer, uint32_t sampleCount) {
 	if (_rewindState == RewindState::Starting || _rewindState == RewindState::Started) {
 		_audioHistoryBuilder.insert(_audioHistoryBuilder.end(), soundBuffer, soundBuffer + sampleCount * 2);
@@ -462,6 +725,7 @@ void RewindManager::RewindSeconds(uint32_t seconds) {
 		auto lock = _emu->AcquireLock();
 
 		for (uint32_t i = 0; i < removeCount; i++) {
+			PageInArchivedState();
 			if (!_history.empty()) {
 				_currentHistory = _history.back();
 				_history.pop_back();
@@ -469,7 +733,7 @@ void RewindManager::RewindSeconds(uint32_t seconds) {
 				break;
 			}
 		}
-		_currentHistory.LoadState(_emu, _history);
+		_currentHistory.LoadState(_emu, _decodeCache);
 	}
 }
 
@@ -478,7 +742,8 @@ bool RewindManager::HasHistory() {
 }
 
 deque<RewindData> RewindManager::GetHistory() {
-	deque<RewindData> history = _history;
+	deque<RewindData> history = _archivedHistory;
+	history.insert(history.end(), _history.begin(), _history.end());
 	history.push_back(_currentHistory);
 	return history;
 }
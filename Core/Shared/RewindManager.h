@@ -3,12 +3,15 @@
 #include <deque>
 #include "Shared/Interfaces/INotificationListener.h"
 #include "Shared/RewindData.h"
+#include "Shared/RewindCompressor.h"
 #include "Shared/RenderedFrame.h"
 #include "Shared/Interfaces/IInputProvider.h"
 #include "Shared/Interfaces/IInputRecorder.h"
+#include "Shared/Interfaces/IMemoryUsageReporter.h"
 
 class Emulator;
 class EmuSettings;
+class RewindArchive;
 
 /// <summary>Rewind state machine states</summary>
 enum class RewindState {
@@ -24,25 +27,44 @@ enum class RewindState {
 /// Stores rendered frame data and input state for replay.
 /// Data vector is reused across frames to avoid per-frame heap allocation.
 /// </summary>
+/// <remarks>
+/// Frames are either keyframes (raw RGBA) or deltas against the next (newer) frame.
+/// Rewind plays frames back newest first, so each delta is applied on top of the frame
+/// that was displayed just before it. Delta format is a sequence of runs:
+/// [unchanged pixel count][changed pixel count][changed pixels XOR next frame...]
+/// </remarks>
 struct VideoFrame {
-	vector<uint32_t> Data;            ///< RGBA pixel data (reused, not reallocated)
+	vector<uint32_t> Data;            ///< RGBA pixel data (keyframe) or XOR runs (delta)
+	bool IsDelta = false;             ///< True when Data is a delta against the next frame
 	uint32_t Width = 0;               ///< Frame width
 	uint32_t Height = 0;              ///< Frame height
 	double Scale = 0;                 ///< Display scale factor
 	uint32_t FrameNumber = 0;         ///< Frame sequence number
 	vector<ControllerData> InputData; ///< Input state for this frame
+	GpuPostProcess PostProcess;       ///< Effects left for the renderer
 
-	/// <summary>Copy frame data from a rendered frame, reusing existing buffer</summary>
+	/// <summary>Copy frame data from a rendered frame as a keyframe, reusing existing buffer</summary>
 	void CopyFrom(const RenderedFrame& frame) {
 		uint32_t pixelCount = frame.Width * frame.Height;
 		Data.resize(pixelCount);
 		memcpy(Data.data(), frame.FrameBuffer, pixelCount * sizeof(uint32_t));
+		IsDelta = false;
 		Width = frame.Width;
 		Height = frame.Height;
 		Scale = frame.Scale;
 		FrameNumber = frame.FrameNumber;
-		InputData = frame.InputData;
+		InputData.assign(frame.InputData.begin(), frame.InputData.end());
+		PostProcess = frame.PostProcess;
 	}
+
+	/// <summary>Convert this keyframe into a delta against the next frame (same dimensions)</summary>
+	/// <param name="nextFrame">Pixels of the next (newer) frame</param>
+	/// <param name="scratch">Reusable encode buffer</param>
+	void EncodeDelta(const uint32_t* nextFrame, vector<uint32_t>& scratch);
+
+	/// <summary>Decode this frame into buffer</summary>
+	/// <param name="buffer">For deltas, must contain the next frame's pixels</param>
+	void Decode(vector<uint32_t>& buffer) const;
 };
 
 /// <summary>Statistics about rewind buffer state</summary>
@@ -59,15 +81,20 @@ struct RewindStats {
 /// <remarks>
 /// Rewind architecture:
 /// - Saves full savestate every 30 frames (BufferSize)
-/// - XOR-delta compression between consecutive states
+/// - Block-level deduplication between consecutive states (RewindCompressor worker thread)
 /// - Video frames buffered separately for smooth playback
 /// - Audio samples buffered for continuous playback during rewind
 ///
 /// Memory usage:
 /// - Configurable history duration (default 5-10 seconds)
 /// - Compressed savestates (~10-50KB each depending on console)
-/// - Video frames (uncompressed RGBA, ~300KB per frame at 256x240)
+/// - Video frames (one RGBA keyframe per segment, XOR run deltas for the others)
 /// - Audio samples (16-bit stereo PCM)
+/// - With ArchiveRewindHistory, states over the limit are moved to a temporary file (RewindArchive)
+///   instead of being dropped, so the history viewer can reach the whole session. They are written
+///   in the background, and paged back in (one at a time) when rewinding past the states in memory
+/// - With PersistRewindHistory, the archive is kept next to the save states when the game is closed
+///   (see PersistHistory), and reattached when the state it ended on is loaded again (e.g resuming the game)
 ///
 /// Usage patterns:
 /// 1. Normal play: Records savestate+video/audio every 30 frames
@@ -75,12 +102,12 @@ struct RewindStats {
 /// 3. Debugger step-back: Single-frame rewind for debugging
 ///
 /// Performance:
-/// - Minimal overhead during normal play (~3% CPU for savestate compression)
+/// - Minimal overhead during normal play (serialization only, compression runs on a worker)
 /// - Fast rewind (instant state loading, pre-rendered frames)
 ///
 /// Thread safety: Accessed from emulation thread only.
 /// </remarks>
-class RewindManager : public INotificationListener, public IInputProvider, public IInputRecorder {
+class RewindManager : public INotificationListener, public IInputProvider, public IInputRecorder, public IMemoryUsageReporter {
 public:
 	/// <summary>Savestate interval in frames (30 = every 0.5 seconds at 60 FPS)</summary>
 	static constexpr int32_t BufferSize = 30;
@@ -91,16 +118,25 @@ private:
 
 	bool _hasHistory = false; ///< History data available
 
+	unique_ptr<RewindCompressor> _compressor; ///< Background block compression worker
+
 	deque<RewindData> _history;       ///< Savestate history (main timeline)
+	deque<RewindData> _archivedHistory; ///< States older than _history, moved to _archive (ArchiveRewindHistory)
+	shared_ptr<RewindArchive> _archive; ///< Disk store for _archivedHistory (created when first needed)
 	deque<RewindData> _historyBackup; ///< Backup history (for resume after rewind)
 	RewindData _currentHistory = {};  ///< Current savestate being built
 	uint64_t _totalMemoryUsage = 0;  ///< Running total of history memory usage in bytes
+	RewindDecodeCache _decodeCache;   ///< Last state loaded, consecutive loads only decompress the blocks that changed
 
 	RewindState _rewindState = RewindState::Stopped; ///< Current rewind state
 	int32_t _framesToFastForward = 0;                ///< Frames to skip when resuming
 
-	deque<VideoFrame> _videoHistory;         ///< Video frame snapshots
+	deque<VideoFrame> _videoHistory;         ///< Video frame snapshots (newest frame of each segment is a keyframe)
 	vector<VideoFrame> _videoHistoryBuilder; ///< Buffer for current video segment
+	VideoFrame _pendingVideoFrame;           ///< Latest frame, encoded once the next one arrives
+	bool _hasPendingVideoFrame = false;      ///< _pendingVideoFrame contains a frame
+	vector<uint32_t> _videoEncodeBuffer;     ///< Scratch buffer for delta encoding
+	vector<uint32_t> _videoDecodeBuffer;     ///< Last decoded frame (base for the next delta)
 
 	/// <summary>Audio ring buffer for rewind playback (replaces deque for cache-friendly bulk ops)</summary>
 	vector<int16_t> _audioRingBuffer;        ///< Contiguous audio sample ring buffer
@@ -114,9 +150,24 @@ private:
 	/// <summary>Add completed history block to deque</summary>
 	void AddHistoryBlock();
 
+	/// <summary>Drop the oldest history block (or move it to the archive) when over the memory limit</summary>
+	void TrimHistory();
+
 	/// <summary>Remove oldest history block to free memory</summary>
 	void PopHistory();
 
+	/// <summary>Moves the newest archived state back to _history when _history is empty (rewinding past the RAM window)</summary>
+	bool PageInArchivedState();
+
+	/// <summary>File the history is kept in between sessions (PersistRewindHistory)</summary>
+	[[nodiscard]] string GetPersistentArchivePath();
+
+	/// <summary>Identifies the ROM and the current state, a persisted history is only restored when they match</summary>
+	[[nodiscard]] string GetPersistentHistoryKey();
+
+	/// <summary>Reattaches the history persisted by a previous session, if it ended on the state that was just loaded</summary>
+	void RestorePersistedHistory();
+
 	/// <summary>Start rewind with state machine transition</summary>
 	void Start(bool forDebugger);
 
@@ -139,6 +190,12 @@ private:
 	/// <returns>True if audio data provided (from history), false if recording</returns>
 	bool ProcessAudio(int16_t* soundBuffer, uint32_t sampleCount);
 
+	/// <summary>Clear video segment builder and pending frame</summary>
+	void ClearVideoHistoryBuilder();
+
+	/// <summary>Send the most recent frame from video history to the renderer</summary>
+	void DisplayVideoHistoryFrame(VideoFrame& frameData);
+
 	/// <summary>Clear all history buffers and reset state</summary>
 	void ClearBuffer();
 
@@ -155,6 +212,12 @@ public:
 	/// <summary>Reset rewind state (clear history, stop rewinding)</summary>
 	void Reset();
 
+	/// <summary>
+	/// Moves the whole history to the archive and keeps its file for the next session (PersistRewindHistory).
+	/// Called when the game is closed, while the console is still loaded.
+	/// </summary>
+	void PersistHistory();
+
 	/// <summary>Handle emulator notifications (pause, reset, etc.)</summary>
 	void ProcessNotification(ConsoleNotificationType type, void* parameter) override;
 
@@ -195,12 +258,15 @@ public:
 	/// <summary>Check if any history data available</summary>
 	[[nodiscard]] bool HasHistory();
 
-	/// <summary>Get copy of history deque (for UI/debugging)</summary>
+	/// <summary>Get copy of history deque, including the archived states (for UI/debugging)</summary>
 	[[nodiscard]] deque<RewindData> GetHistory();
 
 	/// <summary>Get rewind buffer statistics</summary>
 	[[nodiscard]] RewindStats GetStats();
 
+	/// <summary>Report savestate history and playback buffers (IMemoryUsageReporter)</summary>
+	void ReportMemoryUsage(MemoryUsageNode& node) override;
+
 	/// <summary>Send video frame to display or history</summary>
 	void SendFrame(RenderedFrame& frame, bool forRewind);
 
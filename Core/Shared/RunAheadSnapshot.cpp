@@ -0,0 +1,183 @@
+#include "pch.h"
+#include "Shared/RunAheadSnapshot.h"
+#include "Utilities/miniz.h"
+
+uint32_t RunAheadSnapshot::CopyChangedPages(uint8_t* dst, uint8_t* src, uint32_t size) {
+	uint32_t copied = 0;
+	for (uint32_t offset = 0; offset < size; offset += PageSize) {
+		uint32_t len = std::min(PageSize, size - offset);
+		if (memcmp(dst + offset, src + offset, len) != 0) {
+			memcpy(dst + offset, src + offset, len);
+			copied++;
+		}
+	}
+	return copied;
+}
+
+void RunAheadSnapshot::BeginSave(Serializer& s, vector<SerializeValue>&& candidates) {
+	_candidates = std::move(candidates);
+	s.SetExternalBlocks(_candidates);
+}
+
+void RunAheadSnapshot::EndSave(Serializer& s) {
+	if (_compressed) {
+		Decompress();
+	}
+
+	vector<Block> blocks;
+	blocks.reserve(_candidates.size());
+	_copiedPages = 0;
+
+	for (size_t i = 0; i < _candidates.size(); i++) {
+		if (!s.IsExternalBlockUsed(i)) {
+			// Not part of the console's state, nothing to track
+			continue;
+		}
+
+		SerializeValue& candidate = _candidates[i];
+		auto prev = std::find_if(_blocks.begin(), _blocks.end(), [&](const Block& b) {
+			return b.Memory == candidate.DataPtr && b.Size == candidate.Size;
+		});
+
+		Block block;
+		if (prev != _blocks.end()) {
+			block = std::move(*prev);
+			_copiedPages += CopyChangedPages(block.Copy.data(), block.Memory, block.Size);
+		} else {
+			block.Memory = candidate.DataPtr;
+			block.Size = candidate.Size;
+			block.Copy.assign(block.Memory, block.Memory + block.Size);
+			_copiedPages += (block.Size + PageSize - 1) / PageSize;
+		}
+		blocks.push_back(std::move(block));
+	}
+
+	_blocks = std::move(blocks);
+}
+
+void RunAheadSnapshot::Restore() {
+	_copiedPages = 0;
+	if (_compressed) {
+		vector<uint8_t> data;
+		if (!Inflate(data)) {
+			return;
+		}
+		uint8_t* src = data.data();
+		for (Block& block : _blocks) {
+			_copiedPages += CopyChangedPages(block.Memory, src, block.Size);
+			src += block.Size;
+		}
+		return;
+	}
+
+	for (Block& block : _blocks) {
+		_copiedPages += CopyChangedPages(block.Memory, block.Copy.data(), block.Size);
+	}
+}
+
+void RunAheadSnapshot::Compress() {
+	if (_compressed || _blocks.empty()) {
+		return;
+	}
+
+	size_t totalSize = 0;
+	for (Block& block : _blocks) {
+		totalSize += block.Size;
+	}
+
+	vector<uint8_t> data;
+	data.reserve(totalSize);
+	for (Block& block : _blocks) {
+		data.insert(data.end(), block.Copy.begin(), block.Copy.end());
+	}
+
+	unsigned long compressedSize = compressBound((unsigned long)totalSize);
+	_compressedData.resize(compressedSize);
+	if (compress2(_compressedData.data(), &compressedSize, data.data(), (unsigned long)totalSize, MZ_BEST_SPEED) != MZ_OK) {
+		_compressedData.clear();
+		return;
+	}
+	_compressedData.resize(compressedSize);
+	_compressedData.shrink_to_fit();
+
+	for (Block& block : _blocks) {
+		vector<uint8_t>().swap(block.Copy);
+	}
+	_compressed = true;
+}
+
+bool RunAheadSnapshot::Inflate(vector<uint8_t>& out) const {
+	size_t totalSize = 0;
+	for (const Block& block : _blocks) {
+		totalSize += block.Size;
+	}
+
+	out.resize(totalSize);
+	unsigned long size = (unsigned long)totalSize;
+	return uncompress(out.data(), &size, _compressedData.data(), (unsigned long)_compressedData.size()) == MZ_OK && size == totalSize;
+}
+
+bool RunAheadSnapshot::Decompress() {
+	if (!_compressed) {
+		return true;
+	}
+
+	vector<uint8_t> data;
+	if (!Inflate(data)) {
+		Reset();
+		return false;
+	}
+
+	uint8_t* src = data.data();
+	for (Block& block : _blocks) {
+		block.Copy.assign(src, src + block.Size);
+		src += block.Size;
+	}
+	vector<uint8_t>().swap(_compressedData);
+	_compressed = false;
+	return true;
+}
+
+size_t RunAheadSnapshot::GetMemoryUsage() const {
+	if (_compressed) {
+		return _compressedData.size();
+	}
+
+	size_t size = 0;
+	for (const Block& block : _blocks) {
+		size += block.Copy.size();
+	}
+	return size;
+}
+
+bool RunAheadSnapshot::HasSameContent(const RunAheadSnapshot& other) const {
+	if (_blocks.size() != other._blocks.size()) {
+		return false;
+	}
+
+	for (size_t i = 0; i < _blocks.size(); i++) {
+		const Block& a = _blocks[i];
+		const Block& b = other._blocks[i];
+		if (a.Memory != b.Memory || a.Size != b.Size || memcmp(a.Copy.data(), b.Copy.data(), a.Size) != 0) {
+			return false;
+		}
+	}
+	return true;
+}
+
+uint32_t RunAheadSnapshot::GetChecksum() const {
+	uint32_t checksum = 0;
+	for (const Block& block : _blocks) {
+		// Rotate between blocks so identical blocks don't cancel each other out
+		checksum = ((checksum << 1) | (checksum >> 31)) ^ CRC32::GetCRC(block.Copy.data(), block.Size);
+	}
+	return checksum;
+}
+
+void RunAheadSnapshot::Reset() {
+	_candidates.clear();
+	_blocks.clear();
+	_copiedPages = 0;
+	vector<uint8_t>().swap(_compressedData);
+	_compressed = false;
+}
@@ -0,0 +1,115 @@
+#pragma once
+#include "pch.h"
+#include "Utilities/CRC32.h"
+#include "Utilities/Serializer.h"
+
+/// <summary>
+/// Page-tracked copy-on-write snapshot of large memory blocks for run-ahead.
+/// </summary>
+/// <remarks>
+/// Run-ahead saves and restores the whole console every frame. Most of that data is
+/// RAM (WRAM, VRAM, cart RAM, coprocessor RAM) and only a handful of pages change
+/// between two snapshots.
+///
+/// Usage per run-ahead frame:
+/// 1. BeginSave() hands the candidate blocks to the FastBinary serializer, which skips
+///    any StreamArray() call whose pointer/size matches a block
+/// 2. The console is streamed as usual (scalar CPU/PPU state, small arrays)
+/// 3. EndSave() copies only the pages of each skipped block that differ from the snapshot
+/// 4. Restore() copies back only the pages that differ from the snapshot, and must be
+///    called before the serializer load so Serialize() post-processing sees restored RAM
+///
+/// Dirty pages are detected by comparing against the snapshot copy (read-only memcmp)
+/// rather than through write barriers, so the cores need no changes.
+/// Blocks that the console never streams through StreamArray() are not tracked.
+///
+/// Long-lived snapshots (e.g the TAS greenzone) can be compressed: the block copies are
+/// replaced by a single deflate stream, which Restore() inflates on the fly. The next
+/// EndSave() decompresses automatically. HasSameContent() and GetChecksum() expect
+/// uncompressed snapshots.
+///
+/// Thread safety: Emulation thread only.
+/// </remarks>
+class RunAheadSnapshot {
+private:
+	static constexpr uint32_t PageSize = 0x1000;
+
+	struct Block {
+		uint8_t* Memory = nullptr;
+		uint32_t Size = 0;
+		vector<uint8_t> Copy;
+	};
+
+	vector<SerializeValue> _candidates;
+	vector<Block> _blocks;
+	uint32_t _copiedPages = 0;
+	vector<uint8_t> _compressedData;
+	bool _compressed = false;
+
+	/// <summary>Inflate the compressed block copies into out (blocks concatenated in order)</summary>
+	bool Inflate(vector<uint8_t>& out) const;
+
+	/// <summary>Copy pages that differ between src and dst.</summary>
+	/// <returns>Number of pages copied</returns>
+	static uint32_t CopyChangedPages(uint8_t* dst, uint8_t* src, uint32_t size);
+
+public:
+	/// <summary>Register blocks to snapshot and configure serializer to skip them</summary>
+	/// <param name="s">FastBinary serializer, already reset for saving</param>
+	/// <param name="candidates">Non-ROM memory regions of the console</param>
+	void BeginSave(Serializer& s, vector<SerializeValue>&& candidates);
+
+	/// <summary>Snapshot dirtied pages of every block the serializer skipped</summary>
+	void EndSave(Serializer& s);
+
+	/// <summary>Restore dirtied pages of every tracked block</summary>
+	void Restore();
+
+	/// <summary>Drop all snapshot copies (e.g. when the console is unloaded)</summary>
+	void Reset();
+
+	/// <summary>Replace the block copies by a single compressed buffer (no-op if already compressed)</summary>
+	void Compress();
+
+	/// <summary>Restore the uncompressed block copies</summary>
+	/// <returns>False if the compressed data is corrupted (the snapshot is reset)</returns>
+	bool Decompress();
+
+	[[nodiscard]] bool IsCompressed() const { return _compressed; }
+
+	/// <summary>Bytes used by the block copies (or by the compressed buffer)</summary>
+	[[nodiscard]] size_t GetMemoryUsage() const;
+
+	/// <summary>Number of pages copied by the last EndSave()/Restore() call</summary>
+	[[nodiscard]] uint32_t GetCopiedPageCount() const { return _copiedPages; }
+
+	/// <summary>Check if both snapshots track the same blocks with identical content</summary>
+	[[nodiscard]] bool HasSameContent(const RunAheadSnapshot& other) const;
+
+	/// <summary>Checksum of the content of every tracked block (used to compare states across machines)</summary>
+	[[nodiscard]] uint32_t GetChecksum() const;
+};
+
+/// <summary>
+/// Complete run-ahead savestate: FastBinary serializer data plus the page-tracked RAM blocks.
+/// </summary>
+struct RunAheadState {
+	Serializer Data;      ///< Scalar state and small arrays (FastBinary)
+	RunAheadSnapshot Ram; ///< Large RAM blocks skipped by Data
+
+	/// <summary>Memory used by the state (serializer buffer capacity + RAM blocks)</summary>
+	[[nodiscard]] size_t GetMemoryUsage() const {
+		return Data.GetBuffer().capacity() + Ram.GetMemoryUsage();
+	}
+
+	/// <summary>Check if both states hold the same console state</summary>
+	[[nodiscard]] bool Matches(const RunAheadState& other) const {
+		return Data.GetBuffer() == other.Data.GetBuffer() && Ram.HasSameContent(other.Ram);
+	}
+
+	/// <summary>Checksum of the whole state (serializer data and RAM blocks), e.g to detect netplay desyncs</summary>
+	[[nodiscard]] uint32_t GetChecksum() const {
+		const vector<uint8_t>& data = Data.GetBuffer();
+		return CRC32::GetCRC(data.data(), data.size()) ^ Ram.GetChecksum();
+	}
+};
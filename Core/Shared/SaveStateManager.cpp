@@ -116,16 +116,19 @@ time_t SaveStateManager::ParseTimestampFromFilename(const string& filename) {
 void SaveStateManager::SelectSaveSlot(int slotIndex) {
 	_lastIndex = slotIndex;
 	MessageManager::DisplayMessage("SaveStates", "SaveStateSlotSelected", std::to_string(_lastIndex));
+	QueueSlotPrefetch(_lastIndex);
 }
 
 void SaveStateManager::MoveToNextSlot() {
 	_lastIndex = (_lastIndex % MaxIndex) + 1;
 	MessageManager::DisplayMessage("SaveStates", "SaveStateSlotSelected", std::to_string(_lastIndex));
+	QueueSlotPrefetch(_lastIndex);
 }
 
 void SaveStateManager::MoveToPreviousSlot() {
 	_lastIndex = (_lastIndex == 1 ? SaveStateManager::MaxIndex : (_lastIndex - 1));
 	MessageManager::DisplayMessage("SaveStates", "SaveStateSlotSelected", std::to_string(_lastIndex));
+	QueueSlotPrefetch(_lastIndex);
 }
 
 void SaveStateManager::SaveState() {
@@ -159,6 +162,10 @@ void SaveStateManager::SaveState(ostream& stream) {
 }
 
 bool SaveStateManager::SaveState(const string& filepath, bool showSuccessMessage) {
+	return SaveState(filepath, showSuccessMessage, false);
+}
+
+bool SaveStateManager::SaveState(const string& filepath, bool showSuccessMessage, bool cacheSlot) {
 	if (!_emu->IsRunning()) {
 		return false;
 	}
@@ -194,6 +201,7 @@ bool SaveStateManager::SaveState(const string& filepath, bool showSuccessMessage
 
 	snapshot.filepath = filepath;
 	snapshot.showSuccessMessage = showSuccessMessage;
+	snapshot.cacheSlot = cacheSlot;
 
 	// Enqueue for background compression + write (no lock held)
 	{
@@ -214,7 +222,8 @@ void SaveStateManager::SaveState(int stateIndex, bool displayMessage) {
 		filepath = GetStateFilepath(stateIndex);
 	}
 
-	if (SaveState(filepath, false)) {
+	// The auto-save file is never loaded through LoadState(int), don't let it evict a slot
+	if (SaveState(filepath, false, stateIndex != AutoSaveStateIndex)) {
 		if (displayMessage) {
 			MessageManager::DisplayMessage("SaveStates", "SaveStateSaved", std::to_string(stateIndex));
 		}
@@ -265,7 +274,7 @@ bool SaveStateManager::GetVideoData(vector<uint8_t>& out, RenderedFrame& frame,
 	return false;
 }
 
-bool SaveStateManager::LoadState(istream& stream) {
+bool SaveStateManager::CanLoadState() {
 	if (!_emu->IsRunning()) {
 		// Can't load a state if no game is running
 		return false;
@@ -273,6 +282,32 @@ bool SaveStateManager::LoadState(istream& stream) {
 		MessageManager::DisplayMessage("Netplay", "NetplayNotAllowed");
 		return false;
 	}
+	return true;
+}
+
+bool SaveStateManager::ProcessDeserializeResult(DeserializeResult result, RenderedFrame& frame) {
+	if (result == DeserializeResult::Success) {
+		// Stop any movie that might have been playing/recording if a state is loaded
+		//(Note: Loading a state is disabled in the UI while a movie is playing/recording)
+		_emu->GetMovieManager()->Stop();
+
+		if (_emu->IsPaused() && !_emu->GetVideoRenderer()->IsRecording()) {
+			// Only send the saved frame if the emulation is paused and no avi recording is in progress
+			// Otherwise the avi recorder will receive an extra frame that has no sound, which will
+			// create a video vs audio desync in the avi file.
+			_emu->GetVideoDecoder()->UpdateFrame(frame, true, false);
+		}
+		return true;
+	} else if (result == DeserializeResult::InvalidFile) {
+		MessageManager::DisplayMessage("SaveStates", "SaveStateInvalidFile");
+	}
+	return false;
+}
+
+bool SaveStateManager::LoadState(istream& stream) {
+	if (!CanLoadState()) {
+		return false;
+	}
 
 	char header[3];
 	stream.read(header, 3);
@@ -312,22 +347,7 @@ bool SaveStateManager::LoadState(istream& stream) {
 		string romName(nameBuffer.data(), nameLength);
 
 		DeserializeResult result = _emu->Deserialize(stream, fileFormatVersion, false, stateConsoleType);
-
-		if (result == DeserializeResult::Success) {
-			// Stop any movie that might have been playing/recording if a state is loaded
-			//(Note: Loading a state is disabled in the UI while a movie is playing/recording)
-			_emu->GetMovieManager()->Stop();
-
-			if (_emu->IsPaused() && !_emu->GetVideoRenderer()->IsRecording()) {
-				// Only send the saved frame if the emulation is paused and no avi recording is in progress
-				// Otherwise the avi recorder will receive an extra frame that has no sound, which will
-				// create a video vs audio desync in the avi file.
-				_emu->GetVideoDecoder()->UpdateFrame(frame, true, false);
-			}
-			return true;
-		} else if (result == DeserializeResult::SpecificError) {
-			return false;
-		}
+		return ProcessDeserializeResult(result, frame);
 	}
 
 	MessageManager::DisplayMessage("SaveStates", "SaveStateInvalidFile");
@@ -362,11 +382,64 @@ bool SaveStateManager::LoadState(const string& filepath, bool showSuccessMessage
 
 bool SaveStateManager::LoadState(int stateIndex) {
 	string filepath = SaveStateManager::GetStateFilepath(stateIndex);
-	if (LoadState(filepath, false)) {
+
+	optional<bool> cachedResult = LoadCachedSlot(filepath);
+	bool result;
+	if (cachedResult.has_value()) {
+		result = cachedResult.value();
+	} else {
+		result = LoadState(filepath, false);
+		if (result) {
+			// Warm the cache so the next load of this slot skips the file
+			QueueSlotPrefetch(stateIndex);
+		}
+	}
+
+	if (result) {
 		MessageManager::DisplayMessage("SaveStates", "SaveStateLoaded", std::to_string(stateIndex));
-		return true;
 	}
-	return false;
+	return result;
+}
+
+optional<bool> SaveStateManager::LoadCachedSlot(const string& filepath) {
+	// Lock order matches SaveState(): emulator lock first, cache lock only held briefly by the writer
+	auto lock = _emu->AcquireLock();
+	std::lock_guard<std::mutex> cacheLock(_slotCacheMutex);
+
+	auto entry = std::find_if(_slotCache.begin(), _slotCache.end(), [&](const SaveStateSlotCacheEntry& e) {
+		return e.filepath == filepath;
+	});
+	if (entry == _slotCache.end()) {
+		return std::nullopt;
+	}
+
+	if (entry->writeTime != GetFileWriteTime(filepath)) {
+		// File was replaced or deleted outside of the manager
+		_slotCache.erase(entry);
+		return std::nullopt;
+	}
+
+	if (entry != _slotCache.begin()) {
+		std::rotate(_slotCache.begin(), entry, entry + 1);
+		entry = _slotCache.begin();
+	}
+
+	if (!CanLoadState()) {
+		return false;
+	}
+
+	RenderedFrame frame;
+	frame.FrameBuffer = entry->frameBuffer.data();
+	frame.Width = entry->frameWidth;
+	frame.Height = entry->frameHeight;
+	frame.Scale = entry->frameScale100 / 100.0;
+
+	DeserializeResult result = _emu->Deserialize(entry->stateData, entry->fileFormatVersion, (ConsoleType)entry->consoleType);
+	bool loaded = ProcessDeserializeResult(result, frame);
+	if (loaded) {
+		_emu->ProcessEvent(EventType::StateLoaded);
+	}
+	return loaded;
 }
 
 void SaveStateManager::SaveRecentGame(const string& romName, const string& romPath, const string& patchPath) {
@@ -376,16 +449,10 @@ void SaveStateManager::SaveRecentGame(const string& romName, const string& romPa
 	}
 
 	string filename = FolderUtilities::GetFilename(_emu->GetRomInfo().RomFile.GetFileName(), false) + ".rgd";
-	ZipWriter writer;
-	writer.Initialize(FolderUtilities::CombinePath(FolderUtilities::GetRecentGamesFolder(), filename));
-
-	std::stringstream pngStream;
-	_emu->GetVideoDecoder()->TakeScreenshot(pngStream);
-	writer.AddFile(pngStream, "Screenshot.png");
+	string path = FolderUtilities::CombinePath(FolderUtilities::GetRecentGamesFolder(), filename);
 
 	std::stringstream stateStream;
 	SaveStateManager::SaveState(stateStream);
-	writer.AddFile(stateStream, "Savestate.mss");
 
 	std::stringstream romInfoStream;
 	romInfoStream << romName << '\n';
@@ -398,8 +465,23 @@ void SaveStateManager::SaveRecentGame(const string& romName, const string& romPa
 		romInfoStream << "aspectratio=" << aspectRatio << '\n';
 	}
 
-	writer.AddFile(romInfoStream, "RomInfo.txt");
-	writer.Save();
+	// The thumbnail is downscaled and encoded by the screenshot encoder's thread, which then writes the file
+	auto writeFile = [path, state = stateStream.str(), romInfo = romInfoStream.str()](std::stringstream& png) {
+		ZipWriter writer;
+		writer.Initialize(path);
+		writer.AddFile(png, "Screenshot.png");
+
+		std::stringstream stateData(state);
+		writer.AddFile(stateData, "Savestate.mss");
+		std::stringstream romInfoData(romInfo);
+		writer.AddFile(romInfoData, "RomInfo.txt");
+		writer.Save();
+	};
+
+	if (!_emu->GetVideoDecoder()->TakeThumbnail(RecentGameThumbnailHeight, writeFile)) {
+		std::stringstream noScreenshot;
+		writeFile(noScreenshot);
+	}
 }
 
 void SaveStateManager::LoadRecentGame(const string& filename, bool resetGame) {
@@ -602,6 +684,7 @@ bool SaveStateManager::DeleteSaveState(const string& filepath) {
 	try {
 		namespace fs = std::filesystem;
 		if (fs::exists(filepath) && fs::is_regular_file(filepath)) {
+			InvalidateSlotCache(filepath);
 			return fs::remove(filepath);
 		}
 	} catch (const std::exception&) {
@@ -746,7 +829,11 @@ void SaveStateManager::BackgroundWriteLoop() {
 			_writeQueue.pop();
 		}
 
-		WriteSnapshotToDisk(snapshot);
+		if (snapshot.prefetchOnly) {
+			PrefetchSlot(snapshot.filepath);
+		} else {
+			WriteSnapshotToDisk(snapshot);
+		}
 	}
 }
 
@@ -795,11 +882,151 @@ void SaveStateManager::WriteSnapshotToDisk(SaveStateSnapshot& snapshot) {
 
 	file.close();
 
+	if (snapshot.cacheSlot) {
+		CacheWrittenSlot(snapshot);
+	}
+
 	if (snapshot.showSuccessMessage) {
 		MessageManager::DisplayMessage("SaveStates", "SaveStateSavedFile", snapshot.filepath);
 	}
 }
 
+void SaveStateManager::CacheWrittenSlot(SaveStateSnapshot& snapshot) {
+	SaveStateSlotCacheEntry entry;
+	entry.filepath = snapshot.filepath;
+	entry.writeTime = GetFileWriteTime(snapshot.filepath);
+	entry.fileFormatVersion = SaveStateManager::FileFormatVersion;
+	entry.consoleType = snapshot.consoleType;
+	entry.frameBuffer = std::move(snapshot.frameBuffer);
+	entry.frameWidth = snapshot.frameWidth;
+	entry.frameHeight = snapshot.frameHeight;
+	entry.frameScale100 = snapshot.frameScale100;
+	entry.stateData = std::move(snapshot.stateData);
+	InsertSlotCacheEntry(std::move(entry));
+}
+
+void SaveStateManager::PrefetchSlot(const string& filepath) {
+	{
+		std::lock_guard<std::mutex> lock(_slotCacheMutex);
+		auto entry = std::find_if(_slotCache.begin(), _slotCache.end(), [&](const SaveStateSlotCacheEntry& e) {
+			return e.filepath == filepath;
+		});
+		if (entry != _slotCache.end() && entry->writeTime == GetFileWriteTime(filepath)) {
+			// Already warm
+			return;
+		}
+	}
+
+	ifstream file(filepath, ios::in | ios::binary);
+	if (!file) {
+		return;
+	}
+
+	SaveStateSlotCacheEntry entry;
+	entry.filepath = filepath;
+	entry.writeTime = GetFileWriteTime(filepath);
+
+	char header[3];
+	file.read(header, 3);
+	if (!file || memcmp(header, "MSS", 3) != 0) {
+		return;
+	}
+
+	uint32_t emuVersion = ReadValue(file);
+	entry.fileFormatVersion = ReadValue(file);
+	if (emuVersion > _emu->GetSettings()->GetVersion() || entry.fileFormatVersion < SaveStateManager::MinimumSupportedVersion) {
+		// Leave version errors to the regular load path, which reports them
+		return;
+	}
+
+	if (entry.fileFormatVersion <= 3) {
+		// Skip over old SHA1 field
+		file.seekg(40, ios::cur);
+	}
+
+	entry.consoleType = ReadValue(file);
+
+	uint32_t frameBufferSize = ReadValue(file);
+	entry.frameWidth = ReadValue(file);
+	entry.frameHeight = ReadValue(file);
+	entry.frameScale100 = ReadValue(file);
+	uint32_t compressedFrameSize = ReadValue(file);
+	if (compressedFrameSize > 1024 * 1024 * 2 || frameBufferSize > 1024 * 1024 * 10) {
+		return;
+	}
+
+	_bgReadBuffer.resize(compressedFrameSize);
+	file.read((char*)_bgReadBuffer.data(), compressedFrameSize);
+	entry.frameBuffer.resize(frameBufferSize);
+	unsigned long frameSize = frameBufferSize;
+	if (!file || uncompress(entry.frameBuffer.data(), &frameSize, _bgReadBuffer.data(), compressedFrameSize) != MZ_OK) {
+		return;
+	}
+
+	uint32_t nameLength = ReadValue(file);
+	file.seekg(nameLength, ios::cur);
+
+	// State data, in Serializer::SaveTo format
+	char isCompressed = 0;
+	file.get(isCompressed);
+	if (isCompressed == 1) {
+		uint32_t originalSize = 0;
+		uint32_t compSize = 0;
+		file.read((char*)&originalSize, sizeof(uint32_t));
+		file.read((char*)&compSize, sizeof(uint32_t));
+		if (!file || originalSize >= 1024 * 1024 * 10 || compSize >= 1024 * 1024 * 10) {
+			return;
+		}
+
+		_bgReadBuffer.resize(compSize);
+		file.read((char*)_bgReadBuffer.data(), compSize);
+		entry.stateData.resize(originalSize);
+		unsigned long stateSize = originalSize;
+		if (!file || uncompress(entry.stateData.data(), &stateSize, _bgReadBuffer.data(), compSize) != MZ_OK) {
+			return;
+		}
+	} else {
+		entry.stateData.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	}
+
+	InsertSlotCacheEntry(std::move(entry));
+}
+
+void SaveStateManager::InsertSlotCacheEntry(SaveStateSlotCacheEntry&& entry) {
+	std::lock_guard<std::mutex> lock(_slotCacheMutex);
+	std::erase_if(_slotCache, [&](const SaveStateSlotCacheEntry& e) { return e.filepath == entry.filepath; });
+	_slotCache.push_front(std::move(entry));
+	while (_slotCache.size() > SlotCacheSize) {
+		_slotCache.pop_back();
+	}
+}
+
+void SaveStateManager::InvalidateSlotCache(const string& filepath) {
+	std::lock_guard<std::mutex> lock(_slotCacheMutex);
+	std::erase_if(_slotCache, [&](const SaveStateSlotCacheEntry& e) { return e.filepath == filepath; });
+}
+
+void SaveStateManager::QueueSlotPrefetch(int stateIndex) {
+	if (!_emu->IsRunning()) {
+		return;
+	}
+
+	SaveStateSnapshot request;
+	request.filepath = GetStateFilepath(stateIndex);
+	request.prefetchOnly = true;
+	{
+		std::lock_guard<std::mutex> lock(_writeMutex);
+		_writeQueue.push(std::move(request));
+	}
+	_writeCv.notify_one();
+}
+
+int64_t SaveStateManager::GetFileWriteTime(const string& filepath) {
+	std::error_code ec;
+	auto time = std::filesystem::last_write_time(filepath, ec);
+	return ec ? 0 : (int64_t)time.time_since_epoch().count();
+}
+
 void SaveStateManager::FlushPendingWrites() {
 	// Spin until write queue is empty
 	while (true) {
@@ -5,6 +5,8 @@
 #include <mutex>
 #include <condition_variable>
 #include <queue>
+#include <deque>
+#include "Utilities/ISerializable.h"
 
 class Emulator;
 struct RenderedFrame;
@@ -61,6 +63,24 @@ struct SaveStateSnapshot {
 	string romName;               ///< ROM filename without path
 	string filepath;              ///< Target save state file path
 	bool showSuccessMessage = false; ///< Display success message after write
+	bool cacheSlot = false;          ///< Keep a decompressed copy in the slot cache after writing
+	bool prefetchOnly = false;       ///< No write - load filepath into the slot cache instead
+};
+
+/// <summary>
+/// Decompressed copy of a numbered save slot, kept in memory by the background thread.
+/// Loading a cached slot is a plain deserialize: no file read, no zlib inflate.
+/// </summary>
+struct SaveStateSlotCacheEntry {
+	string filepath;              ///< Save state file this entry mirrors
+	int64_t writeTime = 0;        ///< File modification time when cached (detects external changes)
+	uint32_t fileFormatVersion = 0; ///< File format version of the cached state
+	uint32_t consoleType = 0;     ///< Console type (cast from ConsoleType)
+	vector<uint8_t> frameBuffer;  ///< Raw framebuffer (uncompressed)
+	uint32_t frameWidth = 0;      ///< Frame width in pixels
+	uint32_t frameHeight = 0;     ///< Frame height in pixels
+	uint32_t frameScale100 = 0;   ///< Frame scale * 100
+	vector<uint8_t> stateData;    ///< Serialized emulator state (uncompressed)
 };
 
 /// <summary>
@@ -90,6 +110,8 @@ struct SaveStateSnapshot {
 /// - Atomic _lastIndex for thread-safe slot tracking
 /// - Compression reduces state size (~10-50KB depending on console)
 /// - Fast save/load (~1-2ms for NES, ~5-10ms for SNES)
+/// - The last SlotCacheSize numbered slots are kept decompressed in memory, refreshed by the
+///   background thread on write / slot selection - LoadState(int) then skips file I/O and zlib
 ///
 /// Thread safety: All methods should be called with EmulatorLock held.
 /// </remarks>
@@ -101,6 +123,8 @@ private:
 	static constexpr uint32_t RecentPlayMaxSlots = 12;      ///< Maximum Recent Play saves
 	static constexpr uint32_t RecentPlayIntervalSec = 300;  ///< 5 minutes between saves
 
+	static constexpr uint32_t SlotCacheSize = 4; ///< Number of recently used slots kept decompressed
+
 	atomic<uint32_t> _lastIndex;      ///< Last used save state slot [LEGACY]
 	atomic<uint32_t> _recentPlaySlot; ///< Current Recent Play slot (0-11, wraps)
 	time_t _lastRecentPlayTime;       ///< Last Recent Play save timestamp
@@ -130,12 +154,53 @@ private:
 	std::condition_variable _writeCv;
 	bool _shutdownRequested = false;
 
+	// ========== Slot Cache (filled by the background thread) ==========
+	std::deque<SaveStateSlotCacheEntry> _slotCache; ///< Most recently used first
+	std::mutex _slotCacheMutex;
+
+	/// <summary>Persistent read buffer for slot prefetches (background thread only)</summary>
+	vector<uint8_t> _bgReadBuffer;
+
 	/// <summary>Background thread loop — dequeues snapshots, compresses, writes to disk</summary>
 	void BackgroundWriteLoop();
 
 	/// <summary>Write a single snapshot to disk (compression + file I/O)</summary>
 	void WriteSnapshotToDisk(SaveStateSnapshot& snapshot);
 
+	/// <summary>Move a written slot's uncompressed data into the slot cache (background thread)</summary>
+	void CacheWrittenSlot(SaveStateSnapshot& snapshot);
+
+	/// <summary>Read and decompress a slot file into the slot cache (background thread)</summary>
+	void PrefetchSlot(const string& filepath);
+
+	/// <summary>Insert an entry at the front of the slot cache, evicting the least recently used</summary>
+	void InsertSlotCacheEntry(SaveStateSlotCacheEntry&& entry);
+
+	/// <summary>Drop the cached copy of a file (e.g. after deletion)</summary>
+	void InvalidateSlotCache(const string& filepath);
+
+	/// <summary>Ask the background thread to warm the slot cache for a slot</summary>
+	void QueueSlotPrefetch(int stateIndex);
+
+	/// <summary>
+	/// Load a slot from the slot cache.
+	/// </summary>
+	/// <param name="filepath">Slot file path</param>
+	/// <returns>Load result, or nullopt if the slot is not cached (or the file changed since)</returns>
+	[[nodiscard]] optional<bool> LoadCachedSlot(const string& filepath);
+
+	/// <summary>Capture a snapshot and queue it for the background writer</summary>
+	[[nodiscard]] bool SaveState(const string& filepath, bool showSuccessMessage, bool cacheSlot);
+
+	/// <summary>Check that a state can be loaded right now (game running, no netplay)</summary>
+	[[nodiscard]] bool CanLoadState();
+
+	/// <summary>Finish a load after deserialization (stop movies, refresh the paused frame)</summary>
+	[[nodiscard]] bool ProcessDeserializeResult(DeserializeResult result, RenderedFrame& frame);
+
+	/// <summary>Get a file's modification time as a comparable integer (0 on error)</summary>
+	[[nodiscard]] static int64_t GetFileWriteTime(const string& filepath);
+
 	/// <summary>
 	/// Get filesystem path for save state slot (legacy mode).
 	/// </summary>
@@ -252,8 +317,11 @@ public:
 	/// <param name="stateIndex">Slot index (0-11)</param>
 	[[nodiscard]] bool LoadState(int stateIndex);
 
+	/// <summary>Maximum height of the game selection screen's screenshots (larger frames are downscaled)</summary>
+	static constexpr uint32_t RecentGameThumbnailHeight = 480;
+
 	/// <summary>
-	/// Save recent game info for quick resume.
+	/// Save recent game info for quick resume (the file is written in the background, see VideoDecoder::WaitForPendingScreenshots).
 	/// </summary>
 	/// <param name="romName">ROM name</param>
 	/// <param name="romPath">ROM file path</param>
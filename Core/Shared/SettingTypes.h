@@ -11,6 +11,7 @@ enum class EmulationFlags {
 	ConsoleMode = 0x10,
 	TestMode = 0x20,
 	OutputToStdout = 0x40,
+	ShareRomData = 0x80, ///< Use the process-wide ROM cache (SharedRomCache), the ROM can't be edited
 };
 
 enum class ScaleFilterType {
@@ -113,6 +114,14 @@ struct VideoConfig {
 	uint32_t FullscreenResHeight = 0;
 
 	uint32_t ScreenRotation = 0;
+
+	bool LowQualityFilterDuringTurbo = false;
+};
+
+enum class AudioResamplerQuality {
+	Standard = 0, ///< 4-point Hermite interpolation
+	High = 1,     ///< 16-tap windowed sinc
+	Best = 2      ///< 32-tap windowed sinc
 };
 
 struct AudioConfig {
@@ -123,6 +132,7 @@ struct AudioConfig {
 	uint32_t MasterVolume = 100;
 	uint32_t SampleRate = 48000;
 	uint32_t AudioLatency = 60;
+	AudioResamplerQuality ResamplerQuality = AudioResamplerQuality::Standard;
 
 	bool MuteSoundInBackground = false;
 	bool ReduceSoundInBackground = true;
@@ -540,6 +550,7 @@ struct SnesConfig {
 	bool EnableStrictBoardMappings = false;
 	RamState RamPowerOnState = RamState::Random;
 	int32_t SpcClockSpeedAdjustment = 0;
+	bool RunSpcOnSeparateThread = false;
 
 	uint32_t PpuExtraScanlinesBeforeNmi = 0;
 	uint32_t PpuExtraScanlinesAfterNmi = 0;
@@ -583,6 +594,7 @@ struct NesConfig {
 
 	ConsoleRegion Region = ConsoleRegion::Auto;
 	bool EnableHdPacks = true;
+	bool HdPackLazyLoading = false;
 	bool DisableGameDatabase = false;
 	bool FdsAutoLoadDisk = true;
 	bool FdsFastForwardOnLoad = false;
@@ -832,6 +844,8 @@ struct DebugConfig {
 	bool ScriptAllowIoOsAccess = false;
 	bool ScriptAllowNetworkAccess = false;
 	uint32_t ScriptTimeout = 1;
+	uint32_t ScriptFrameBudget = 0; ///< Per-frame time budget for script callbacks (ms), a warning is logged when exceeded (0 = disabled)
+	uint32_t ScriptGcStepBudget = 0; ///< Time budget for the Lua garbage collector at the end of each frame (us), the automatic collector is stopped (0 = automatic collector)
 };
 
 enum class HudDisplaySize {
@@ -851,11 +865,14 @@ struct PreferencesConfig {
 	bool ShowMovieIcons = false;
 	bool ShowTurboRewindIcons = false;
 	bool DisableGameSelectionScreen = false;
+	bool ArchiveRewindHistory = false; ///< Move rewind states over the memory limit to a temporary file instead of dropping them
+	bool PersistRewindHistory = false; ///< Keep the archived rewind history when the game is closed (restored when resuming it)
 
 	HudDisplaySize HudSize = HudDisplaySize::Fixed;
 
 	uint32_t AutoSaveStateDelay = 20;
 	uint32_t RewindBufferSize = 300;
+	uint32_t SaveDataFlushDelay = 0; ///< Seconds between the background flushes of the battery-backed save data, 0 = only saved on exit/reset
 
 	const char* SaveFolderOverride = nullptr;
 	const char* SaveStateFolderOverride = nullptr;
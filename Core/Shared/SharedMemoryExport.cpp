@@ -0,0 +1,149 @@
+#include "pch.h"
+#include "Shared/SharedMemoryExport.h"
+#include "Shared/RenderedFrame.h"
+
+static int64_t GetExportTimestamp() {
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+template <typename T>
+static T* GetRingEntry(SharedExportHeader* header, uint32_t offset, uint32_t entrySize, uint32_t entryCount, uint64_t sequence) {
+	return (T*)((uint8_t*)header + offset + (size_t)((sequence - 1) % entryCount) * entrySize);
+}
+
+bool SharedMemoryExport::Start(const string& name) {
+	if (!_memory.Create(name, TotalSize)) {
+		return false;
+	}
+
+	_header = (SharedExportHeader*)_memory.GetData();
+	_header->HeaderSize = sizeof(SharedExportHeader);
+	_header->VideoSlotCount = VideoSlotCount;
+	_header->VideoSlotSize = VideoSlotSize;
+	_header->VideoOffset = VideoOffset;
+	_header->AudioBlockCount = AudioBlockCount;
+	_header->AudioBlockSize = AudioBlockSize;
+	_header->AudioOffset = AudioOffset;
+	_header->Version = SharedExportHeader::CurrentVersion;
+
+	// Written last, consumers check it before reading anything else
+	std::atomic_ref<uint32_t>(_header->Magic).store(SharedExportHeader::MagicValue, std::memory_order_release);
+	return true;
+}
+
+void SharedMemoryExport::PublishFrame(const RenderedFrame& frame) {
+	uint32_t pitch = frame.Width * 4;
+	if ((uint64_t)pitch * frame.Height > MaxFrameBytes) {
+		_header->DroppedFrames.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	uint64_t sequence = ++_videoSequence;
+	SharedVideoFrameHeader* slot = GetRingEntry<SharedVideoFrameHeader>(_header, VideoOffset, VideoSlotSize, VideoSlotCount, sequence);
+	slot->Sequence.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	slot->Timestamp = GetExportTimestamp();
+	slot->FrameNumber = frame.FrameNumber;
+	slot->Width = frame.Width;
+	slot->Height = frame.Height;
+	slot->Pitch = pitch;
+	memcpy(slot + 1, frame.FrameBuffer, (size_t)pitch * frame.Height);
+
+	slot->Sequence.store(sequence, std::memory_order_release);
+	_header->VideoSequence.store(sequence, std::memory_order_release);
+}
+
+void SharedMemoryExport::PublishAudio(const int16_t* samples, uint32_t sampleCount, uint32_t sampleRate) {
+	int64_t timestamp = GetExportTimestamp();
+	while (sampleCount > 0) {
+		uint32_t count = std::min(sampleCount, MaxAudioSamples);
+		uint64_t sequence = ++_audioSequence;
+		SharedAudioBlockHeader* block = GetRingEntry<SharedAudioBlockHeader>(_header, AudioOffset, AudioBlockSize, AudioBlockCount, sequence);
+		block->Sequence.store(0, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		block->Timestamp = timestamp;
+		block->SampleRate = sampleRate;
+		block->SampleCount = count;
+		memcpy(block + 1, samples, count * 2 * sizeof(int16_t));
+
+		block->Sequence.store(sequence, std::memory_order_release);
+		_header->AudioSequence.store(sequence, std::memory_order_release);
+
+		samples += count * 2;
+		sampleCount -= count;
+	}
+}
+
+bool SharedMemoryExportReader::Open(const string& name) {
+	_header = nullptr;
+	if (!_memory.Open(name, SharedMemoryExport::TotalSize)) {
+		return false;
+	}
+
+	SharedExportHeader* header = (SharedExportHeader*)_memory.GetData();
+	if (std::atomic_ref<uint32_t>(header->Magic).load(std::memory_order_acquire) != SharedExportHeader::MagicValue || header->Version != SharedExportHeader::CurrentVersion) {
+		_memory.Close();
+		return false;
+	}
+	_header = header;
+	return true;
+}
+
+bool SharedMemoryExportReader::ReadLatestFrame(SharedVideoFrameHeader& info, vector<uint32_t>& pixels) {
+	uint64_t sequence = _header->VideoSequence.load(std::memory_order_acquire);
+	if (sequence == 0) {
+		return false;
+	}
+
+	SharedVideoFrameHeader* slot = GetRingEntry<SharedVideoFrameHeader>(_header, _header->VideoOffset, _header->VideoSlotSize, _header->VideoSlotCount, sequence);
+	if (slot->Sequence.load(std::memory_order_acquire) != sequence) {
+		return false;
+	}
+
+	info.Timestamp = slot->Timestamp;
+	info.FrameNumber = slot->FrameNumber;
+	info.Width = slot->Width;
+	info.Height = slot->Height;
+	info.Pitch = slot->Pitch;
+	if ((uint64_t)info.Width * info.Height * 4 > _header->VideoSlotSize - sizeof(SharedVideoFrameHeader)) {
+		return false;
+	}
+	pixels.resize((size_t)info.Width * info.Height);
+	memcpy(pixels.data(), slot + 1, pixels.size() * sizeof(uint32_t));
+
+	std::atomic_thread_fence(std::memory_order_acquire);
+	if (slot->Sequence.load(std::memory_order_relaxed) != sequence) {
+		return false;
+	}
+	info.Sequence.store(sequence, std::memory_order_relaxed);
+	return true;
+}
+
+bool SharedMemoryExportReader::ReadAudioBlock(uint64_t sequence, SharedAudioBlockHeader& info, vector<int16_t>& samples) {
+	if (sequence == 0 || sequence > _header->AudioSequence.load(std::memory_order_acquire)) {
+		return false;
+	}
+
+	SharedAudioBlockHeader* block = GetRingEntry<SharedAudioBlockHeader>(_header, _header->AudioOffset, _header->AudioBlockSize, _header->AudioBlockCount, sequence);
+	if (block->Sequence.load(std::memory_order_acquire) != sequence) {
+		return false;
+	}
+
+	info.Timestamp = block->Timestamp;
+	info.SampleRate = block->SampleRate;
+	info.SampleCount = block->SampleCount;
+	if ((uint64_t)info.SampleCount * 4 > _header->AudioBlockSize - sizeof(SharedAudioBlockHeader)) {
+		return false;
+	}
+	samples.resize((size_t)info.SampleCount * 2);
+	memcpy(samples.data(), block + 1, samples.size() * sizeof(int16_t));
+
+	std::atomic_thread_fence(std::memory_order_acquire);
+	if (block->Sequence.load(std::memory_order_relaxed) != sequence) {
+		return false;
+	}
+	info.Sequence.store(sequence, std::memory_order_relaxed);
+	return true;
+}
@@ -0,0 +1,127 @@
+#pragma once
+#include "pch.h"
+#include <atomic>
+#include "Utilities/SharedMemory.h"
+
+struct RenderedFrame;
+
+/// <summary>
+/// Header at the start of the shared memory export block (all values are little endian).
+/// </summary>
+/// <remarks>
+/// The block contains VideoSlotCount frame slots (at VideoOffset, VideoSlotSize bytes each) followed by
+/// AudioBlockCount audio blocks (at AudioOffset, AudioBlockSize bytes each), used as 2 rings: the Nth frame
+/// (N >= 1) is written to slot (N - 1) % VideoSlotCount, and the same goes for the audio blocks.
+/// </remarks>
+struct SharedExportHeader {
+	static constexpr uint32_t MagicValue = 0x4D53584E; ///< "NXSM"
+	static constexpr uint32_t CurrentVersion = 1;
+
+	uint32_t Magic;
+	uint32_t Version;
+	uint32_t HeaderSize;
+	uint32_t VideoSlotCount;
+	uint32_t VideoSlotSize; ///< Including the slot's header
+	uint32_t VideoOffset;
+	uint32_t AudioBlockCount;
+	uint32_t AudioBlockSize; ///< Including the block's header
+	uint32_t AudioOffset;
+	uint32_t Reserved[7];
+
+	alignas(64) std::atomic<uint64_t> VideoSequence; ///< Sequence number of the last published frame (0 = none yet)
+	std::atomic<uint64_t> DroppedFrames;              ///< Frames larger than a slot, not published
+	alignas(64) std::atomic<uint64_t> AudioSequence; ///< Sequence number of the last published audio block (0 = none yet)
+};
+
+/// <summary>
+/// Header of a frame slot, followed by the pixels (Height rows of Pitch bytes, 32-bit BGRA / 0xAARRGGBB).
+/// </summary>
+/// <remarks>
+/// Sequence works as a seqlock: it is 0 while the slot is being written, and the frame's sequence number once
+/// it is complete. Consumers read Sequence, use the slot, then check that Sequence didn't change (the slot was
+/// overwritten if it did - it is only reused after VideoSlotCount more frames).
+/// </remarks>
+struct SharedVideoFrameHeader {
+	std::atomic<uint64_t> Sequence;
+	int64_t Timestamp; ///< Presentation time, steady clock in microseconds (CLOCK_MONOTONIC / QueryPerformanceCounter)
+	uint32_t FrameNumber;
+	uint32_t Width;
+	uint32_t Height;
+	uint32_t Pitch;
+	uint32_t Reserved[8];
+};
+
+/// <summary>
+/// Header of an audio block, followed by SampleCount interleaved stereo samples (int16_t left/right).
+/// </summary>
+/// <remarks>Sequence works the same way as SharedVideoFrameHeader::Sequence.</remarks>
+struct SharedAudioBlockHeader {
+	std::atomic<uint64_t> Sequence;
+	int64_t Timestamp; ///< Time at which the block was mixed, same clock as the frames
+	uint32_t SampleRate;
+	uint32_t SampleCount; ///< Stereo sample pairs
+	uint32_t Reserved[10];
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Shared memory export requires lock-free 64-bit atomics");
+static_assert(sizeof(SharedVideoFrameHeader) == 64 && sizeof(SharedAudioBlockHeader) == 64);
+
+/// <summary>
+/// Opt-in export of the presented frames and mixed audio to a named shared memory block, so external consumers
+/// (OBS plugins, capture tools, ML pipelines) can read them in place - no screen capture, no copy, no encoding.
+/// </summary>
+/// <remarks>
+/// The video renderer publishes every frame it receives (after the video filters, before the GPU post-processing
+/// done by some renderers) and the sound mixer publishes every mixed block, each from a single thread. Frames are
+/// never waited for: a consumer that falls more than VideoSlotCount frames behind skips frames.
+/// </remarks>
+class SharedMemoryExport {
+public:
+	static constexpr uint32_t VideoSlotCount = 3;
+	static constexpr uint32_t MaxFrameBytes = 2560 * 1440 * 4;
+	static constexpr uint32_t AudioBlockCount = 32;
+	static constexpr uint32_t MaxAudioSamples = 4096;
+
+	static constexpr uint32_t VideoSlotSize = sizeof(SharedVideoFrameHeader) + MaxFrameBytes;
+	static constexpr uint32_t AudioBlockSize = sizeof(SharedAudioBlockHeader) + MaxAudioSamples * 4;
+	static constexpr uint32_t VideoOffset = 4096;
+	static constexpr uint32_t AudioOffset = VideoOffset + VideoSlotCount * VideoSlotSize;
+	static constexpr uint32_t TotalSize = AudioOffset + AudioBlockCount * AudioBlockSize;
+
+private:
+	SharedMemory _memory;
+	SharedExportHeader* _header = nullptr;
+	uint64_t _videoSequence = 0;
+	uint64_t _audioSequence = 0;
+
+public:
+	/// <summary>Creates the shared memory block, returns false if it couldn't be created</summary>
+	[[nodiscard]] bool Start(const string& name);
+
+	/// <summary>Publishes a 32-bit ARGB frame (called by the video renderer)</summary>
+	void PublishFrame(const RenderedFrame& frame);
+
+	/// <summary>Publishes interleaved stereo samples, split into several blocks if needed (called by the sound mixer)</summary>
+	void PublishAudio(const int16_t* samples, uint32_t sampleCount, uint32_t sampleRate);
+};
+
+/// <summary>
+/// Reads a shared memory export block (reference implementation of the consumer side, used by the tests).
+/// </summary>
+class SharedMemoryExportReader {
+private:
+	SharedMemory _memory;
+	SharedExportHeader* _header = nullptr;
+
+public:
+	/// <summary>Opens the block created by SharedMemoryExport::Start()</summary>
+	[[nodiscard]] bool Open(const string& name);
+
+	[[nodiscard]] const SharedExportHeader* GetHeader() const { return _header; }
+
+	/// <summary>Copies the last published frame, returns false if there is none (or it was overwritten while copying)</summary>
+	[[nodiscard]] bool ReadLatestFrame(SharedVideoFrameHeader& info, vector<uint32_t>& pixels);
+
+	/// <summary>Copies the audio block with the given sequence number, returns false if it isn't (or no longer) available</summary>
+	[[nodiscard]] bool ReadAudioBlock(uint64_t sequence, SharedAudioBlockHeader& info, vector<int16_t>& samples);
+};
@@ -0,0 +1,32 @@
+#include "pch.h"
+#include "Shared/SharedRomCache.h"
+
+std::mutex SharedRomCache::_lock;
+std::unordered_map<string, std::weak_ptr<const vector<uint8_t>>> SharedRomCache::_roms;
+
+shared_ptr<const vector<uint8_t>> SharedRomCache::GetOrLoad(const string& key, const std::function<vector<uint8_t>()>& load) {
+	std::lock_guard<std::mutex> lock(_lock);
+
+	// Drop the entries of ROMs that are no longer loaded
+	std::erase_if(_roms, [](const auto& entry) { return entry.second.expired(); });
+
+	auto it = _roms.find(key);
+	if (it != _roms.end()) {
+		if (shared_ptr<const vector<uint8_t>> rom = it->second.lock()) {
+			return rom;
+		}
+	}
+
+	shared_ptr<const vector<uint8_t>> rom = std::make_shared<const vector<uint8_t>>(load());
+	_roms[key] = rom;
+	return rom;
+}
+
+uint32_t SharedRomCache::GetCount() {
+	std::lock_guard<std::mutex> lock(_lock);
+	uint32_t count = 0;
+	for (const auto& entry : _roms) {
+		count += entry.second.expired() ? 0 : 1;
+	}
+	return count;
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include "pch.h"
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+/// <summary>
+/// Process-wide cache of read-only ROM buffers, shared by the emulator instances running the same ROM.
+/// </summary>
+/// <remarks>
+/// Used by instances with EmulationFlags::ShareRomData (e.g the headless instances that run recorded tests in
+/// parallel): instead of each instance holding its own copy of the ROM, they all reference the same buffer,
+/// found by a key describing its content (e.g SHA1 + size). Patched ROMs have a different hash, so they get
+/// their own entry.
+///
+/// The cache only holds weak references: a buffer is freed once the last instance using it is unloaded.
+/// Shared buffers must never be written to, the debugger and cheats can't edit a shared ROM (see
+/// ConsoleMemoryInfo::Shared).
+///
+/// Thread safety: GetOrLoad() can be called by any thread. A ROM is loaded once, other instances asking
+/// for the same key in the meantime wait for it.
+/// </remarks>
+class SharedRomCache {
+private:
+	static std::mutex _lock;
+	static std::unordered_map<string, std::weak_ptr<const vector<uint8_t>>> _roms;
+
+public:
+	/// <summary>Returns the buffer cached for key, or creates it with load() if no instance is using it</summary>
+	[[nodiscard]] static shared_ptr<const vector<uint8_t>> GetOrLoad(const string& key, const std::function<vector<uint8_t>()>& load);
+
+	/// <summary>Number of buffers currently in use</summary>
+	[[nodiscard]] static uint32_t GetCount();
+};
@@ -1,13 +1,9 @@
 #include "pch.h"
 #include "Shared/Emulator.h"
 #include "Shared/EmuSettings.h"
-#include "Shared/MessageManager.h"
 #include "Shared/Video/BaseVideoFilter.h"
-#include "Shared/Video/RotateFilter.h"
-#include "Shared/Video/ScaleFilter.h"
-#include "Shared/Video/ScanlineFilter.h"
-#include "Utilities/PNGHelper.h"
-#include "Utilities/FolderUtilities.h"
+#include "Shared/Video/ScreenshotEncoder.h"
+#include "Utilities/WorkerPool.h"
 
 #include <numbers>
 static constexpr double PI = std::numbers::pi;
@@ -21,6 +17,54 @@ BaseVideoFilter::~BaseVideoFilter() {
 	auto lock = _frameLock.AcquireSafe();
 }
 
+bool BaseVideoFilter::PaletteOptionsChanged(const VideoConfig& a, const VideoConfig& b) {
+	return a.Hue != b.Hue || a.Saturation != b.Saturation || a.Contrast != b.Contrast || a.Brightness != b.Brightness;
+}
+
+void BaseVideoFilter::ConvertFrame(const uint32_t* palette, uint16_t colorMask, const uint16_t* src, uint32_t srcWidth, uint32_t xOffset, uint32_t yOffset, uint32_t* out, uint32_t width, uint32_t height) {
+	const uint16_t* row = src + yOffset * srcWidth + xOffset;
+	for (uint32_t y = 0; y < height; y++) {
+		// 4 independent lookups per iteration so the loads can overlap
+		uint32_t x = 0;
+		for (; x + 4 <= width; x += 4) {
+			out[x] = palette[row[x] & colorMask];
+			out[x + 1] = palette[row[x + 1] & colorMask];
+			out[x + 2] = palette[row[x + 2] & colorMask];
+			out[x + 3] = palette[row[x + 3] & colorMask];
+		}
+		for (; x < width; x++) {
+			out[x] = palette[row[x] & colorMask];
+		}
+		row += srcWidth;
+		out += width;
+	}
+}
+
+void BaseVideoFilter::ConvertFrameBlended(const uint32_t* palette, uint16_t colorMask, const uint16_t* src, const uint16_t* prevSrc, uint32_t srcWidth, uint32_t xOffset, uint32_t yOffset, uint32_t* out, uint32_t width, uint32_t height) {
+	uint32_t start = yOffset * srcWidth + xOffset;
+	const uint16_t* row = src + start;
+	const uint16_t* prevRow = prevSrc + start;
+	for (uint32_t y = 0; y < height; y++) {
+		for (uint32_t x = 0; x < width; x++) {
+			out[x] = BlendArgb(palette[prevRow[x] & colorMask], palette[row[x] & colorMask]);
+		}
+		row += srcWidth;
+		prevRow += srcWidth;
+		out += width;
+	}
+}
+
+void BaseVideoFilter::ProcessRowSlices(uint32_t rowCount, const std::function<void(uint32_t, uint32_t)>& processRows) {
+	if (!_workerPool) {
+		_workerPool = std::make_unique<WorkerPool>(WorkerPool::GetDefaultWorkerCount(MaxSliceWorkers));
+	}
+
+	uint32_t sliceCount = std::max(1u, std::min(_workerPool->GetThreadCount(), rowCount / MinSliceRows));
+	_workerPool->Run(sliceCount, [&](uint32_t slice) {
+		processRows(rowCount * slice / sliceCount, rowCount * (slice + 1) / sliceCount);
+	});
+}
+
 void BaseVideoFilter::SetBaseFrameInfo(FrameInfo frameInfo) {
 	_baseFrameInfo = frameInfo;
 }
@@ -145,72 +189,20 @@ void BaseVideoFilter::YiqToRgb(double y, double i, double q, double& r, double&
 	b = std::max(0.0, std::min(1.0, (y + _yiqToRgbMatrix[4] * i + _yiqToRgbMatrix[5] * q)));
 }
 
-void BaseVideoFilter::TakeScreenshot(VideoFilterType filterType, string filename, std::stringstream* stream) {
-	uint32_t* pngBuffer;
-	FrameInfo frameInfo;
-	std::unique_ptr<uint32_t[]> frameBuffer;
+bool BaseVideoFilter::CaptureScreenshot(VideoFilterType filterType, ScreenshotRequest& request) {
 	{
 		auto lock = _frameLock.AcquireSafe();
 		if (_bufferSize == 0 || !GetOutputBuffer()) {
-			return;
+			return false;
 		}
 
-		frameBuffer = std::make_unique<uint32_t[]>(_bufferSize);
-		memcpy(frameBuffer.get(), GetOutputBuffer(), _bufferSize * sizeof(frameBuffer[0]));
-		frameInfo = _frameInfo;
-	}
-
-	pngBuffer = frameBuffer.get();
-
-	uint8_t scale = 1;
-
-	uint32_t screenRotation = _emu->GetSettings()->GetVideoConfig().ScreenRotation;
-	_emu->GetScreenRotationOverride(screenRotation);
-
-	unique_ptr<RotateFilter> rotateFilter(new RotateFilter(screenRotation));
-	if (screenRotation != 0) {
-		pngBuffer = rotateFilter->ApplyFilter(pngBuffer, frameInfo.Width, frameInfo.Height);
-		frameInfo = rotateFilter->GetFrameInfo(frameInfo);
-	}
-
-	unique_ptr<ScaleFilter> scaleFilter = ScaleFilter::GetScaleFilter(_emu, filterType);
-	if (scaleFilter) {
-		pngBuffer = scaleFilter->ApplyFilter(pngBuffer, frameInfo.Width, frameInfo.Height);
-		frameInfo = scaleFilter->GetFrameInfo(frameInfo);
-		scale = scaleFilter->GetScale();
-	}
-
-	ScanlineFilter::ApplyFilter(pngBuffer, frameInfo.Width, frameInfo.Height, _emu->GetSettings()->GetVideoConfig().ScanlineIntensity, scale);
-
-	if (!filename.empty()) {
-		PNGHelper::WritePNG(filename, pngBuffer, frameInfo.Width, frameInfo.Height);
-	} else {
-		PNGHelper::WritePNG(*stream, pngBuffer, frameInfo.Width, frameInfo.Height);
-	}
-}
-
-void BaseVideoFilter::TakeScreenshot(const string& romName, VideoFilterType filterType) {
-	string romFilename = FolderUtilities::GetFilename(romName, false);
-
-	int counter = 0;
-	string baseFilename = FolderUtilities::CombinePath(FolderUtilities::GetScreenshotFolder(), romFilename);
-	string ssFilename;
-	while (true) {
-		string counterStr = std::to_string(counter);
-		while (counterStr.length() < 3) {
-			counterStr = "0" + counterStr;
-		}
-		ssFilename = baseFilename + "_" + counterStr + ".png";
-		ifstream file(ssFilename, ios::in);
-		if (file) {
-			file.close();
-		} else {
-			break;
-		}
-		counter++;
+		request.FrameBuffer.assign(GetOutputBuffer(), GetOutputBuffer() + _bufferSize);
+		request.Frame = _frameInfo;
 	}
 
-	TakeScreenshot(filterType, ssFilename);
-
-	MessageManager::DisplayMessage("ScreenshotSaved", FolderUtilities::GetFilename(ssFilename, true));
+	request.FilterType = filterType;
+	request.ScreenRotation = _emu->GetSettings()->GetVideoConfig().ScreenRotation;
+	_emu->GetScreenRotationOverride(request.ScreenRotation);
+	request.ScanlineIntensity = _emu->GetSettings()->GetVideoConfig().ScanlineIntensity;
+	return true;
 }
@@ -2,8 +2,11 @@
 #include "pch.h"
 #include "Utilities/SimpleLock.h"
 #include "Shared/SettingTypes.h"
+#include <functional>
 
 class Emulator;
+class WorkerPool;
+struct ScreenshotRequest;
 
 /// <summary>
 /// Base class for all video filters - handles PPU output to RGB conversion.
@@ -29,6 +32,8 @@ class Emulator;
 /// - Internal: YIQ for NTSC color simulation
 /// - Output: 32-bit ARGB (0xAARRGGBB)
 /// - Supports hue/saturation adjustments
+/// - Default filters bake the color options into a palette LUT (InitPaletteLut)
+///   and convert frames with ConvertFrame/ConvertFrameBlended
 ///
 /// **Overscan:**
 /// - Configurable per-console and per-game
@@ -36,13 +41,13 @@ class Emulator;
 /// - SetOverscan/GetOverscan manage cropping dimensions
 ///
 /// **Screenshot:**
-/// - TakeScreenshot() captures filtered output
-/// - Supports PNG output to file or stream
+/// - CaptureScreenshot() copies the filtered output, ScreenshotEncoder does the rest (off-thread)
 ///
 /// **Threading:**
 /// - _frameLock protects output buffer
 /// - SendFrame() called from emulation thread
 /// - Output buffer read from render thread
+/// - ProcessRowSlices() spreads expensive filters over a small worker pool
 /// </remarks>
 class BaseVideoFilter {
 private:
@@ -53,6 +58,10 @@ private:
 	OverscanDimensions _overscan = {};
 	bool _isOddFrame = false;
 	uint32_t _videoPhaseOffset = 0;
+	unique_ptr<WorkerPool> _workerPool;
+
+	static constexpr uint32_t MinSliceRows = 16;
+	static constexpr uint32_t MaxSliceWorkers = 3;
 
 	void UpdateBufferSize();
 
@@ -68,11 +77,35 @@ protected:
 	void RgbToYiq(double r, double g, double b, double& y, double& i, double& q);
 	void YiqToRgb(double y, double i, double q, double& r, double& g, double& b);
 
+	/// <summary>Check if the color options baked into a palette LUT (hue/saturation/brightness/contrast) differ</summary>
+	[[nodiscard]] static bool PaletteOptionsChanged(const VideoConfig& a, const VideoConfig& b);
+
+	/// <summary>Fill a palette LUT, applying the configured color options on top of each base color</summary>
+	/// <param name="palette">LUT to fill (colorCount entries)</param>
+	/// <param name="decodeColor">Called as decodeColor(index, r, g, b) to get the 8-bit base color of an entry</param>
+	template <typename TDecodeColor>
+	void InitPaletteLut(uint32_t* palette, uint32_t colorCount, const VideoConfig& cfg, TDecodeColor decodeColor);
+
+	/// <summary>Convert a frame of palette indexes to ARGB, cropping it to width x height at (xOffset, yOffset)</summary>
+	/// <param name="colorMask">Mask applied to each source pixel (keeps lookups inside the palette)</param>
+	static void ConvertFrame(const uint32_t* palette, uint16_t colorMask, const uint16_t* src, uint32_t srcWidth, uint32_t xOffset, uint32_t yOffset, uint32_t* out, uint32_t width, uint32_t height);
+
+	/// <summary>Same as ConvertFrame, averaging each pixel with the same pixel of the previous frame (LCD ghosting)</summary>
+	static void ConvertFrameBlended(const uint32_t* palette, uint16_t colorMask, const uint16_t* src, const uint16_t* prevSrc, uint32_t srcWidth, uint32_t xOffset, uint32_t yOffset, uint32_t* out, uint32_t width, uint32_t height);
+
+	/// <summary>50% blend of two ARGB pixels</summary>
+	[[nodiscard]] __forceinline static constexpr uint32_t BlendArgb(uint32_t a, uint32_t b) {
+		return (((a ^ b) & 0xfffefefeL) >> 1) + (a & b);
+	}
+
 	virtual void ApplyFilter(uint16_t* ppuOutputBuffer) = 0;
 	virtual void OnBeforeApplyFilter();
 	[[nodiscard]] bool IsOddFrame();
 	[[nodiscard]] uint32_t GetVideoPhaseOffset();
-	[[nodiscard]] uint32_t GetBufferSize();
+
+	/// <summary>Split rows [0, rowCount) into slices and process them in parallel (blocks until done)</summary>
+	/// <param name="processRows">Called with a [firstRow, lastRow) range, concurrently for different ranges</param>
+	void ProcessRowSlices(uint32_t rowCount, const std::function<void(uint32_t, uint32_t)>& processRows);
 
 protected:
 	virtual FrameInfo GetFrameInfo();
@@ -87,9 +120,12 @@ public:
 	static void InitNtscFilter(T& ntscSetup, VideoConfig& cfg);
 
 	[[nodiscard]] uint32_t* GetOutputBuffer();
+
+	/// <summary>Size of the output buffer in bytes</summary>
+	[[nodiscard]] uint32_t GetBufferSize();
 	FrameInfo SendFrame(uint16_t* ppuOutputBuffer, uint32_t frameNumber, uint32_t videoPhaseOffset, void* frameData, bool enableOverscan = true);
-	void TakeScreenshot(const string& romName, VideoFilterType filterType);
-	void TakeScreenshot(VideoFilterType filterType, string filename, std::stringstream* stream = nullptr);
+	/// <summary>Copies the current output and the screenshot settings into request, returns false if there is no frame yet</summary>
+	bool CaptureScreenshot(VideoFilterType filterType, ScreenshotRequest& request);
 
 	[[nodiscard]] virtual HudScaleFactors GetScaleFactor() { return {1.0, 1.0}; }
 	[[nodiscard]] virtual OverscanDimensions GetOverscan();
@@ -98,3 +134,18 @@ public:
 
 	void SetBaseFrameInfo(FrameInfo frameInfo);
 };
+
+template <typename TDecodeColor>
+void BaseVideoFilter::InitPaletteLut(uint32_t* palette, uint32_t colorCount, const VideoConfig& cfg, TDecodeColor decodeColor) {
+	InitConversionMatrix(cfg.Hue, cfg.Saturation);
+
+	bool applyColorOptions = cfg.Hue != 0 || cfg.Saturation != 0 || cfg.Brightness != 0 || cfg.Contrast != 0;
+	for (uint32_t i = 0; i < colorCount; i++) {
+		uint8_t r, g, b;
+		decodeColor(i, r, g, b);
+		if (applyColorOptions) {
+			ApplyColorOptions(r, g, b, cfg.Brightness, cfg.Contrast);
+		}
+		palette[i] = 0xFF000000 | (r << 16) | (g << 8) | b;
+	}
+}
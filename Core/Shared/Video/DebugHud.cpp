@@ -23,6 +23,60 @@ void DebugHud::ClearScreen() {
 	_drawPixels.clear();
 	_prevDrawPixels.clear();
 	_dirtyIndices.clear();
+	_hasLastSignature = false;
+}
+
+uint64_t DebugHud::GetDrawSignature(FrameInfo frameInfo, OverscanDimensions overscan, uint32_t frameNumber, HudScaleFactors scaleFactors) {
+	_signatureBuffer.clear();
+	_signatureBuffer.push_back(((uint64_t)frameInfo.Width << 32) | frameInfo.Height);
+	_signatureBuffer.push_back(((uint64_t)overscan.Left << 48) | ((uint64_t)overscan.Right << 32) | ((uint64_t)overscan.Top << 16) | overscan.Bottom);
+
+	uint64_t scale;
+	memcpy(&scale, &scaleFactors.X, sizeof(scale));
+	_signatureBuffer.push_back(scale);
+	memcpy(&scale, &scaleFactors.Y, sizeof(scale));
+	_signatureBuffer.push_back(scale);
+
+	for (unique_ptr<DrawCommand>& command : _commands) {
+		if (command->IsActive(frameNumber)) {
+			_signatureBuffer.push_back(command->GetSignature());
+		}
+	}
+	return FastHash::Hash(_signatureBuffer.data(), _signatureBuffer.size() * sizeof(uint64_t));
+}
+
+bool DebugHud::IsLastDrawReusable(FrameInfo frameInfo, OverscanDimensions overscan, uint32_t frameNumber, HudScaleFactors scaleFactors) {
+	uint64_t signature = GetDrawSignature(frameInfo, overscan, frameNumber, scaleFactors);
+	if (_hasLastSignature && signature == _lastSignature) {
+		for (unique_ptr<DrawCommand>& command : _commands) {
+			command->SkipFrame(frameNumber);
+		}
+		RemoveExpiredCommands();
+		return true;
+	}
+
+	_lastSignature = signature;
+	_hasLastSignature = true;
+	return false;
+}
+
+void DebugHud::RemoveExpiredCommands() {
+	_commands.erase(std::remove_if(_commands.begin(), _commands.end(), [](const unique_ptr<DrawCommand>& c) { return c->Expired(); }), _commands.end());
+	_commandCount = (uint32_t)_commands.size();
+}
+
+bool DebugHud::DrawRetained(uint32_t* argbBuffer, FrameInfo frameInfo, OverscanDimensions overscan, uint32_t frameNumber, HudScaleFactors scaleFactors) {
+	auto lock = _commandLock.AcquireSafe();
+	if (IsLastDrawReusable(frameInfo, overscan, frameNumber, scaleFactors)) {
+		return false;
+	}
+
+	memset(argbBuffer, 0, frameInfo.Width * frameInfo.Height * sizeof(uint32_t));
+	for (unique_ptr<DrawCommand>& command : _commands) {
+		command->Draw(nullptr, 0, nullptr, argbBuffer, frameInfo, overscan, frameNumber, scaleFactors);
+	}
+	RemoveExpiredCommands();
+	return true;
 }
 
 bool DebugHud::Draw(uint32_t* argbBuffer, FrameInfo frameInfo, OverscanDimensions overscan, uint32_t frameNumber, HudScaleFactors scaleFactors, bool clearAndUpdate) {
@@ -32,6 +86,11 @@ bool DebugHud::Draw(uint32_t* argbBuffer, FrameInfo frameInfo, OverscanDimension
 	uint32_t bufferSize = frameInfo.Height * frameInfo.Width;
 
 	if (clearAndUpdate) {
+		if ((uint32_t)_drawPixels.size() == bufferSize && IsLastDrawReusable(frameInfo, overscan, frameNumber, scaleFactors)) {
+			// Same commands as the last pass, argbBuffer already holds the result
+			return false;
+		}
+
 		// Ensure flat buffers are sized for this frame
 		if ((uint32_t)_drawPixels.size() != bufferSize) {
 			_drawPixels.assign(bufferSize, 0);
@@ -69,8 +128,7 @@ bool DebugHud::Draw(uint32_t* argbBuffer, FrameInfo frameInfo, OverscanDimension
 		}
 	}
 
-	_commands.erase(std::remove_if(_commands.begin(), _commands.end(), [](const unique_ptr<DrawCommand>& c) { return c->Expired(); }), _commands.end());
-	_commandCount = (uint32_t)_commands.size();
+	RemoveExpiredCommands();
 
 	return isDirty;
 }
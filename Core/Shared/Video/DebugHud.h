@@ -18,6 +18,15 @@ private:
 	// Dirty pixel indices for fast diff/clear without scanning the full buffer
 	vector<uint32_t> _dirtyIndices;
 
+	// Retained drawing: signature of the command list/geometry the output buffer currently holds
+	vector<uint64_t> _signatureBuffer;
+	uint64_t _lastSignature = 0;
+	bool _hasLastSignature = false;
+
+	[[nodiscard]] uint64_t GetDrawSignature(FrameInfo frameInfo, OverscanDimensions overscan, uint32_t frameNumber, HudScaleFactors scaleFactors);
+	bool IsLastDrawReusable(FrameInfo frameInfo, OverscanDimensions overscan, uint32_t frameNumber, HudScaleFactors scaleFactors);
+	void RemoveExpiredCommands();
+
 public:
 	DebugHud();
 	~DebugHud();
@@ -25,6 +34,17 @@ public:
 	[[nodiscard]] bool HasCommands() { return _commandCount > 0; }
 
 	bool Draw(uint32_t* argbBuffer, FrameInfo frameInfo, OverscanDimensions overscan, uint32_t frameNumber, HudScaleFactors scaleFactors, bool clearAndUpdate = false);
+
+	/// <summary>
+	/// Clear and redraw a surface owned by the caller, unless it already holds this exact command list.
+	/// </summary>
+	/// <returns>True if the surface was redrawn</returns>
+	/// <remarks>
+	/// Scripts usually re-queue the same one-frame commands every frame - comparing the command
+	/// signatures against the last pass skips the clear, the rasterization and the texture upload.
+	/// The surface must not be modified by the caller between calls.
+	/// </remarks>
+	bool DrawRetained(uint32_t* argbBuffer, FrameInfo frameInfo, OverscanDimensions overscan, uint32_t frameNumber, HudScaleFactors scaleFactors);
 	void ClearScreen();
 
 	void DrawPixel(int x, int y, int color, int frameCount, int startFrame = -1);
@@ -6,6 +6,9 @@
 #include "Shared/Emulator.h"
 #include "Shared/RewindManager.h"
 #include "Shared/EmuSettings.h"
+#include "Shared/FrameProfiler.h"
+#include "Shared/MemoryUsageRegistry.h"
+#include "Utilities/SimpleLock.h"
 #include <format>
 
 void DebugStats::DisplayStats(Emulator* emu, double lastFrameTime) {
@@ -18,8 +21,8 @@ void DebugStats::DisplayStats(Emulator* emu, double lastFrameTime) {
 
 	int startFrame = emu->GetFrameCount();
 
-	hud->DrawRectangle(8, 8, 115, 49, 0x40000000, true, 1, startFrame);
-	hud->DrawRectangle(8, 8, 115, 49, 0xFFFFFF, false, 1, startFrame);
+	hud->DrawRectangle(8, 8, 115, 67, 0x40000000, true, 1, startFrame);
+	hud->DrawRectangle(8, 8, 115, 67, 0xFFFFFF, false, 1, startFrame);
 
 	hud->DrawString(10, 10, "Audio Stats", 0xFFFFFF, 0xFF000000, 1, startFrame);
 	hud->DrawString(10, 21, "Latency: ", 0xFFFFFF, 0xFF000000, 1, startFrame);
@@ -30,6 +33,8 @@ void DebugStats::DisplayStats(Emulator* emu, double lastFrameTime) {
 	hud->DrawString(10, 30, "Underruns: " + std::to_string(stats.BufferUnderrunEventCount), 0xFFFFFF, 0xFF000000, 1, startFrame);
 	hud->DrawString(10, 39, "Buffer Size: " + std::to_string(stats.BufferSize / 1024) + "kb", 0xFFFFFF, 0xFF000000, 1, startFrame);
 	hud->DrawString(10, 48, "Rate: " + std::to_string((uint32_t)(audioCfg.SampleRate * emu->GetSoundMixer()->GetRateAdjustment())) + "Hz", 0xFFFFFF, 0xFF000000, 1, startFrame);
+	hud->DrawString(10, 57, std::format("Out: {:.1f}/{:.1f} ms", stats.OutputLatencyP50, stats.OutputLatencyP99), 0xFFFFFF, 0xFF000000, 1, startFrame);
+	hud->DrawString(10, 66, std::format("Mix: {:.2f} ms", stats.MixTime), 0xFFFFFF, 0xFF000000, 1, startFrame);
 
 	hud->DrawRectangle(132, 8, 115, 49, 0x40000000, true, 1, startFrame);
 	hud->DrawRectangle(132, 8, 115, 49, 0xFFFFFF, false, 1, startFrame);
@@ -75,16 +80,83 @@ void DebugStats::DisplayStats(Emulator* emu, double lastFrameTime) {
 		hud->DrawLine(130 + i * 2, 60 + 50 - duration * 2, 130 + i * 2 + 2, 60 + 50 - nextDuration * 2, lineColor, 1, startFrame);
 	}
 
-	hud->DrawRectangle(8, 60, 115, 34, 0x40000000, true, 1, startFrame);
-	hud->DrawRectangle(8, 60, 115, 34, 0xFFFFFF, false, 1, startFrame);
+	bool isRecording = emu->GetSoundMixer()->IsRecording();
+	int miscHeight = isRecording ? 43 : 34;
+	hud->DrawRectangle(8, 78, 115, miscHeight, 0x40000000, true, 1, startFrame);
+	hud->DrawRectangle(8, 78, 115, miscHeight, 0xFFFFFF, false, 1, startFrame);
 
-	hud->DrawString(10, 62, "Misc. Stats", 0xFFFFFF, 0xFF000000, 1, startFrame);
+	hud->DrawString(10, 80, "Misc. Stats", 0xFFFFFF, 0xFF000000, 1, startFrame);
 
 	RewindStats rewindStats = emu->GetRewindManager()->GetStats();
 	double memUsage = (double)rewindStats.MemoryUsage / (1024 * 1024);
-	hud->DrawString(10, 73, std::format("Rewind mem.: {:.2f} MB", memUsage), 0xFFFFFF, 0xFF000000, 1, startFrame);
+	hud->DrawString(10, 91, std::format("Rewind mem.: {:.2f} MB", memUsage), 0xFFFFFF, 0xFF000000, 1, startFrame);
 
 	if (rewindStats.HistoryDuration > 0) {
-		hud->DrawString(9, 82, std::format("   Per min.: {:.2f} MB", memUsage * 60 * 60 / rewindStats.HistoryDuration), 0xFFFFFF, 0xFF000000, 1, startFrame);
+		hud->DrawString(9, 100, std::format("   Per min.: {:.2f} MB", memUsage * 60 * 60 / rewindStats.HistoryDuration), 0xFFFFFF, 0xFF000000, 1, startFrame);
+	}
+
+	if (isRecording) {
+		int dropColor = stats.RecordingDropCount > 0 ? 0xFF0000 : 0xFFFFFF;
+		hud->DrawString(10, 109, "WAV drops: " + std::to_string(stats.RecordingDropCount), dropColor, 0xFF000000, 1, startFrame);
+	}
+
+	// Named locks that made a thread wait since the overlay was opened (count, total ms and longest wait)
+	vector<LockContentionInfo> locks = SimpleLock::GetContentionInfo();
+	std::erase_if(locks, [](const LockContentionInfo& lock) { return lock.Contentions == 0; });
+	if (locks.size() > 3) {
+		locks.resize(3);
+	}
+	int lockTop = 78 + miscHeight + 4;
+	int memoryTop = lockTop;
+	if (!locks.empty()) {
+		int lockHeight = 12 + (int)locks.size() * 18;
+		hud->DrawRectangle(8, lockTop, 115, lockHeight, 0x40000000, true, 1, startFrame);
+		hud->DrawRectangle(8, lockTop, 115, lockHeight, 0xFFFFFF, false, 1, startFrame);
+		hud->DrawString(10, lockTop + 2, "Lock waits", 0xFFFFFF, 0xFF000000, 1, startFrame);
+
+		int y = lockTop + 13;
+		for (LockContentionInfo& lock : locks) {
+			int color = lock.MaxWait > 1 ? 0xFFA500 : 0xFFFFFF;
+			hud->DrawString(10, y, lock.Name, 0xFFFFFF, 0xFF000000, 1, startFrame);
+			hud->DrawString(14, y + 9, std::format("{}x {:.1f}ms max {:.2f}", lock.Contentions, lock.TotalWait, lock.MaxWait), color, 0xFF000000, 1, startFrame);
+			y += 18;
+		}
+		memoryTop = lockTop + lockHeight + 4;
+	}
+
+	// Memory footprint, with the 3 subsystems that use the most memory
+	MemoryUsageNode memory = emu->GetMemoryUsageRegistry()->GetUsage();
+	std::sort(memory.Children.begin(), memory.Children.end(), [](const MemoryUsageNode& a, const MemoryUsageNode& b) { return a.GetTotal() > b.GetTotal(); });
+	size_t memoryRows = std::min<size_t>(memory.Children.size(), 3);
+	int memoryHeight = 12 + (int)memoryRows * 9;
+	hud->DrawRectangle(8, memoryTop, 115, memoryHeight, 0x40000000, true, 1, startFrame);
+	hud->DrawRectangle(8, memoryTop, 115, memoryHeight, 0xFFFFFF, false, 1, startFrame);
+	hud->DrawString(10, memoryTop + 2, std::format("Memory: {:.1f} MB", memory.GetTotal() / (1024.0 * 1024)), 0xFFFFFF, 0xFF000000, 1, startFrame);
+	for (size_t i = 0; i < memoryRows; i++) {
+		double size = memory.Children[i].GetTotal() / (1024.0 * 1024);
+		hud->DrawString(14, memoryTop + 13 + (int)i * 9, std::format("{}: {:.1f} MB", memory.Children[i].Name, size), 0xFFFFFF, 0xFF000000, 1, startFrame);
+	}
+
+	FrameProfilerStats profile = emu->GetFrameProfiler()->GetStats();
+	if (profile.FrameCount > 0) {
+		// Average time per frame of each stage, with the worst frame (stages that took no time are hidden)
+		vector<int> stages;
+		for (int i = 0; i < (int)ProfilerStage::Count; i++) {
+			if (profile.Max[i] >= 0.01) {
+				stages.push_back(i);
+			}
+		}
+
+		int profileHeight = 12 + (int)stages.size() * 9;
+		hud->DrawRectangle(132, 95, 115, profileHeight, 0x40000000, true, 1, startFrame);
+		hud->DrawRectangle(132, 95, 115, profileHeight, 0xFFFFFF, false, 1, startFrame);
+		hud->DrawString(134, 97, "Frame times (ms)", 0xFFFFFF, 0xFF000000, 1, startFrame);
+
+		int y = 108;
+		for (int i : stages) {
+			string name = FrameProfiler::GetStageName((ProfilerStage)i);
+			hud->DrawString(134, y, std::format("{}: {:.2f}/{:.2f}", name, profile.Average[i], profile.Max[i]), 0xFFFFFF, 0xFF000000, 1, startFrame);
+			y += 9;
+		}
 	}
 }
@@ -1,6 +1,7 @@
 #pragma once
 #include "pch.h"
 #include "Shared/SettingTypes.h"
+#include "Utilities/FastHash.h"
 
 class DrawCommand {
 private:
@@ -109,6 +110,37 @@ protected:
 		}
 	}
 
+	void DrawRectangle(int x, int y, int width, int height, int color, bool fill) {
+		if (fill) {
+			for (int j = 0; j < height; j++) {
+				for (int i = 0; i < width; i++) {
+					DrawPixel(x + i, y + j, color);
+				}
+			}
+		} else {
+			for (int i = 0; i < width; i++) {
+				DrawPixel(x + i, y, color);
+				DrawPixel(x + i, y + height - 1, color);
+			}
+			for (int i = 1; i < height - 1; i++) {
+				DrawPixel(x, y + i, color);
+				DrawPixel(x + width - 1, y + i, color);
+			}
+		}
+	}
+
+	/// <summary>Invert the alpha byte of a script color - 0 = opaque, 255 = transparent (this way, no need to specify the alpha channel all the time)</summary>
+	[[nodiscard]] static int ToDrawColor(int color) {
+		return (~color & 0xFF000000) | (color & 0xFFFFFF);
+	}
+
+	/// <summary>Hash a command's parameters (plus the base drawing flags) for DebugHud's retained drawing</summary>
+	template <typename... T>
+	[[nodiscard]] uint64_t HashFields(uint32_t commandType, T... fields) {
+		int64_t values[] = {(int64_t)commandType, (int64_t)_useIntegerScaling, (int64_t)_overwritePixels, (int64_t)fields...};
+		return FastHash::Hash(values, sizeof(values));
+	}
+
 	__forceinline void BlendColors(uint8_t output[4], uint8_t input[4], bool keepAlpha = false) {
 		uint8_t alpha = input[3] + 1;
 		uint8_t invertedAlpha = 256 - input[3];
@@ -132,6 +164,24 @@ public:
 	virtual ~DrawCommand() {
 	}
 
+	/// <summary>Hash of everything that affects the pixels this command draws (frame lifetime excluded)</summary>
+	[[nodiscard]] virtual uint64_t GetSignature() = 0;
+
+	/// <summary>True if the command draws on this frame (resolves a pending start frame like Draw() does)</summary>
+	bool IsActive(uint32_t frameNumber) {
+		if (_startFrame < 0) {
+			_startFrame = frameNumber;
+		}
+		return _startFrame <= (int32_t)frameNumber;
+	}
+
+	/// <summary>Count this frame against the command's lifetime without drawing it (output retained by the caller)</summary>
+	void SkipFrame(uint32_t frameNumber) {
+		if (IsActive(frameNumber)) {
+			_frameCount--;
+		}
+	}
+
 	void Draw(uint32_t* drawnPixels, uint32_t drawnPixelsSize, vector<uint32_t>* dirtyIndices, uint32_t* argbBuffer, FrameInfo frameInfo, OverscanDimensions& overscan, uint32_t frameNumber, HudScaleFactors& scaleFactors) {
 		if (_startFrame < 0) {
 			// When no start frame was specified, start on the next drawn frame
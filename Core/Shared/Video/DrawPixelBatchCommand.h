@@ -0,0 +1,38 @@
+#pragma once
+#include "pch.h"
+#include "Shared/Video/DrawCommand.h"
+
+/// <summary>
+/// Draws a list of pixels with a single command (emu.drawPixels), instead of one DrawPixelCommand per pixel.
+/// </summary>
+class DrawPixelBatchCommand : public DrawCommand {
+public:
+	struct Pixel {
+		int X;
+		int Y;
+		int Color;
+	};
+
+private:
+	vector<Pixel> _pixels;
+
+protected:
+	void InternalDraw() {
+		for (Pixel& pixel : _pixels) {
+			DrawPixel(pixel.X, pixel.Y, pixel.Color);
+		}
+	}
+
+public:
+	uint64_t GetSignature() override {
+		return FastHash::Hash(_pixels.data(), _pixels.size() * sizeof(Pixel), HashFields(6, _pixels.size()));
+	}
+
+	DrawPixelBatchCommand(int frameCount, int startFrame, size_t pixelCount) : DrawCommand(startFrame, frameCount) {
+		_pixels.reserve(pixelCount);
+	}
+
+	void AddPixel(int x, int y, int color) {
+		_pixels.push_back({x, y, ToDrawColor(color)});
+	}
+};
@@ -12,6 +12,10 @@ protected:
 	}
 
 public:
+	uint64_t GetSignature() override {
+		return HashFields(2, _x, _y, _color);
+	}
+
 	DrawPixelCommand(int x, int y, int color, int frameCount, int startFrame) : DrawCommand(startFrame, frameCount), _x(x), _y(y), _color(color) {
 		// Invert alpha byte - 0 = opaque, 255 = transparent (this way, no need to specifiy alpha channel all the time)
 		_color = (~color & 0xFF000000) | (color & 0xFFFFFF);
@@ -0,0 +1,50 @@
+#pragma once
+#include "pch.h"
+#include "Shared/Video/DrawCommand.h"
+
+/// <summary>
+/// Draws a list of rectangles with a single command (emu.drawRectangles), instead of one DrawRectangleCommand per rectangle.
+/// </summary>
+class DrawRectangleBatchCommand : public DrawCommand {
+public:
+	struct Rect {
+		int X;
+		int Y;
+		int Width;
+		int Height;
+		int Color;
+	};
+
+private:
+	vector<Rect> _rects;
+	bool _fill;
+
+protected:
+	void InternalDraw() {
+		for (Rect& rect : _rects) {
+			DrawRectangle(rect.X, rect.Y, rect.Width, rect.Height, rect.Color, _fill);
+		}
+	}
+
+public:
+	uint64_t GetSignature() override {
+		return FastHash::Hash(_rects.data(), _rects.size() * sizeof(Rect), HashFields(7, _rects.size(), _fill));
+	}
+
+	DrawRectangleBatchCommand(bool fill, int frameCount, int startFrame, size_t rectCount) : DrawCommand(startFrame, frameCount), _fill(fill) {
+		_rects.reserve(rectCount);
+	}
+
+	void AddRectangle(int x, int y, int width, int height, int color) {
+		// Same as DrawRectangleCommand: negative sizes extend the rectangle to the left/top of (x, y)
+		if (width < 0) {
+			x += width + 1;
+			width = -width;
+		}
+		if (height < 0) {
+			y += height + 1;
+			height = -height;
+		}
+		_rects.push_back({x, y, width, height, ToDrawColor(color)});
+	}
+};
@@ -9,25 +9,14 @@ private:
 
 protected:
 	void InternalDraw() {
-		if (_fill) {
-			for (int j = 0; j < _height; j++) {
-				for (int i = 0; i < _width; i++) {
-					DrawPixel(_x + i, _y + j, _color);
-				}
-			}
-		} else {
-			for (int i = 0; i < _width; i++) {
-				DrawPixel(_x + i, _y, _color);
-				DrawPixel(_x + i, _y + _height - 1, _color);
-			}
-			for (int i = 1; i < _height - 1; i++) {
-				DrawPixel(_x, _y + i, _color);
-				DrawPixel(_x + _width - 1, _y + i, _color);
-			}
-		}
+		DrawRectangle(_x, _y, _width, _height, _color, _fill);
 	}
 
 public:
+	uint64_t GetSignature() override {
+		return HashFields(3, _x, _y, _width, _height, _color, _fill);
+	}
+
 	DrawRectangleCommand(int x, int y, int width, int height, int color, bool fill, int frameCount, int startFrame) : DrawCommand(startFrame, frameCount), _x(x), _y(y), _width(width), _height(height), _color(color), _fill(fill) {
 		if (width < 0) {
 			_x += width + 1;
@@ -25,6 +25,10 @@ protected:
 	}
 
 public:
+	uint64_t GetSignature() override {
+		return FastHash::Hash(_screenBuffer.get(), _width * _height * sizeof(uint32_t), HashFields(4, _width, _height));
+	}
+
 	DrawScreenBufferCommand(uint32_t width, uint32_t height, int startFrame) : DrawCommand(startFrame, 1, false) {
 		_width = width;
 		_height = height;
@@ -901,6 +901,10 @@ protected:
 	}
 
 public:
+	uint64_t GetSignature() override {
+		return FastHash::Hash(_text.data(), _text.size(), HashFields(5, _x, _y, _color, _backColor, _maxWidth));
+	}
+
 	DrawStringCommand(int x, int y, string text, int color, int backColor, int frameCount, int startFrame, int maxWidth = 0, bool overwritePixels = false) : DrawCommand(startFrame, frameCount, true), _x(x), _y(y), _color(color), _backColor(backColor), _maxWidth(maxWidth), _text(std::move(text)) {
 		// Invert alpha byte - 0 = opaque, 255 = transparent (this way, no need to specifiy alpha channel all the time)
 		_overwritePixels = overwritePixels;
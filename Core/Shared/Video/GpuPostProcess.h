@@ -0,0 +1,57 @@
+#pragma once
+#include "pch.h"
+
+/// <summary>
+/// Pixel effects a rendering device applies on the GPU instead of VideoDecoder's CPU chain.
+/// </summary>
+/// <remarks>
+/// Only covers the effects that are a plain upscale followed by a per-pixel brightness
+/// multiply (prescale, LCD grid, scanlines). The renderer draws the frame nearest-neighbor
+/// into a Scale-times larger target and multiplies it by the overlay from BuildOverlay(),
+/// which gives the same image as ScaleFilter + ScanlineFilter without the CPU passes
+/// or the larger frame copies between threads.
+///
+/// Screenshots and AVI recording always use the CPU chain.
+/// </remarks>
+struct GpuPostProcess {
+	uint32_t Scale = 1;                                   ///< Nearest-neighbor integer upscale (1 = none)
+	bool LcdGrid = false;                                 ///< Apply LcdGridBrightness to each 2x2 pixel block
+	uint8_t LcdGridBrightness[4] = {255, 255, 255, 255}; ///< Top-left, top-right, bottom-left, bottom-right (rotation already applied)
+	uint8_t ScanlineBrightness = 255;                     ///< Brightness of every ScanlineScale-th row (255 = no scanlines)
+	uint8_t ScanlineScale = 2;                            ///< Scanline period in upscaled rows
+
+	bool operator==(const GpuPostProcess&) const = default;
+
+	/// <summary>True when the overlay pass is needed (LCD grid or scanlines)</summary>
+	[[nodiscard]] bool NeedsOverlay() const {
+		return LcdGrid || ScanlineBrightness < 255;
+	}
+
+	/// <summary>True when the renderer has anything to do besides drawing the frame as-is</summary>
+	[[nodiscard]] bool IsActive() const {
+		return Scale > 1 || NeedsOverlay();
+	}
+
+	/// <summary>
+	/// Build the gray multiply overlay for an upscaled frame.
+	/// </summary>
+	/// <param name="buffer">ARGB output, width * height pixels</param>
+	/// <param name="width">Upscaled frame width</param>
+	/// <param name="height">Upscaled frame height</param>
+	/// <remarks>
+	/// Multiplying a frame by this overlay (c * o / 255 per channel) matches ScaleFilter's
+	/// LCD grid and ScanlineFilter's output (up to rounding when both are combined).
+	/// </remarks>
+	void BuildOverlay(uint32_t* buffer, uint32_t width, uint32_t height) const {
+		for (uint32_t y = 0; y < height; y++) {
+			bool isScanline = ScanlineBrightness < 255 && (y % ScanlineScale) == (uint32_t)(ScanlineScale - 1);
+			for (uint32_t x = 0; x < width; x++) {
+				uint32_t value = LcdGrid ? LcdGridBrightness[(y & 0x01) * 2 + (x & 0x01)] : 255;
+				if (isScanline) {
+					value = value * ScanlineBrightness / 255;
+				}
+				*(buffer++) = 0xFF000000 | (value * 0x010101);
+			}
+		}
+	}
+};
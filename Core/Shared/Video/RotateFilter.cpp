@@ -17,31 +17,49 @@ uint32_t RotateFilter::GetAngle() {
 	return _angle;
 }
 
+uint64_t RotateFilter::GetBufferSize() {
+	return _outputBuffer ? (uint64_t)_width * _height * sizeof(uint32_t) : 0;
+}
+
+template <bool clockwise>
+void RotateFilter::RotateTiled(const uint32_t* input, uint32_t width, uint32_t height) {
+	// 90/270 rotations are transposes: walking the whole destination in column order touches a new
+	// cache line for every pixel at large frame sizes, so the frame is processed tile by tile instead
+	uint32_t* output = _outputBuffer.get();
+	for (uint32_t tileY = 0; tileY < height; tileY += TileSize) {
+		uint32_t tileHeight = std::min(TileSize, height - tileY);
+		for (uint32_t tileX = 0; tileX < width; tileX += TileSize) {
+			uint32_t tileEnd = std::min(tileX + TileSize, width);
+			for (uint32_t x = tileX; x < tileEnd; x++) {
+				// One source column of the tile becomes a contiguous run in one output row
+				const uint32_t* src = input + tileY * width + x;
+				if constexpr (clockwise) {
+					uint32_t* dst = output + x * height + (height - 1 - tileY);
+					for (uint32_t y = 0; y < tileHeight; y++) {
+						*(dst--) = *src;
+						src += width;
+					}
+				} else {
+					uint32_t* dst = output + (width - 1 - x) * height + tileY;
+					for (uint32_t y = 0; y < tileHeight; y++) {
+						*(dst++) = *src;
+						src += width;
+					}
+				}
+			}
+		}
+	}
+}
+
 uint32_t* RotateFilter::ApplyFilter(uint32_t* inputArgbBuffer, uint32_t width, uint32_t height) {
 	UpdateOutputBuffer(width, height);
 
-	uint32_t* input = inputArgbBuffer;
 	if (_angle == 90) {
-		for (int i = (int)height - 1; i >= 0; i--) {
-			for (uint32_t j = 0; j < width; j++) {
-				_outputBuffer[j * height + i] = *input;
-				input++;
-			}
-		}
+		RotateTiled<true>(inputArgbBuffer, width, height);
 	} else if (_angle == 180) {
-		for (int i = (int)height - 1; i >= 0; i--) {
-			for (int j = (int)width - 1; j >= 0; j--) {
-				_outputBuffer[i * width + j] = *input;
-				input++;
-			}
-		}
+		std::reverse_copy(inputArgbBuffer, inputArgbBuffer + width * height, _outputBuffer.get());
 	} else if (_angle == 270) {
-		for (uint32_t i = 0; i < height; i++) {
-			for (int j = (int)width - 1; j >= 0; j--) {
-				_outputBuffer[j * height + i] = *input;
-				input++;
-			}
-		}
+		RotateTiled<false>(inputArgbBuffer, width, height);
 	}
 
 	return _outputBuffer.get();
@@ -9,13 +9,22 @@ private:
 	uint32_t _width = 0;
 	uint32_t _height = 0;
 
+	/// <summary>Rotation is done in square tiles so both the reads and the writes stay in cache</summary>
+	static constexpr uint32_t TileSize = 32;
+
 	void UpdateOutputBuffer(uint32_t width, uint32_t height);
 
+	template <bool clockwise>
+	void RotateTiled(const uint32_t* input, uint32_t width, uint32_t height);
+
 public:
 	RotateFilter(uint32_t angle);
 	~RotateFilter() = default;
 
 	uint32_t GetAngle();
+
+	/// <summary>Size of the output buffer in bytes</summary>
+	[[nodiscard]] uint64_t GetBufferSize();
 	uint32_t* ApplyFilter(uint32_t* inputArgbBuffer, uint32_t width, uint32_t height);
 	FrameInfo GetFrameInfo(FrameInfo baseFrameInfo);
 };
\ No newline at end of file
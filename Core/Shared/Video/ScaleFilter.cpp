@@ -2,28 +2,55 @@
 #include "Shared/Emulator.h"
 #include "Shared/EmuSettings.h"
 #include "Shared/Video/ScaleFilter.h"
+#include "Shared/Video/GpuPostProcess.h"
 #include "Utilities/xBRZ/xbrz.h"
 #include "Utilities/HQX/hqx.h"
 #include "Utilities/Scale2x/scalebit.h"
 #include "Utilities/KreedSaiEagle/SaiEagle.h"
+#include "Utilities/WorkerPool.h"
 
-bool ScaleFilter::_hqxInitDone = false;
+std::once_flag ScaleFilter::_hqxInitFlag;
+
+void ScaleFilter::InitHqx() {
+	std::call_once(_hqxInitFlag, []() { hqxInit(); });
+}
+
+void ScaleFilter::PrecomputeTables(VideoFilterType filter) {
+	static std::atomic_flag started = ATOMIC_FLAG_INIT;
+	if (filter == VideoFilterType::HQ2x || filter == VideoFilterType::HQ3x || filter == VideoFilterType::HQ4x) {
+		if (!started.test_and_set()) {
+			std::thread(InitHqx).detach();
+		}
+	}
+}
 
 ScaleFilter::ScaleFilter(Emulator* emu, ScaleFilterType scaleFilterType, uint32_t scale) {
 	_emu = emu;
 	_scaleFilterType = scaleFilterType;
 	_filterScale = scale;
 
-	if (!_hqxInitDone && _scaleFilterType == ScaleFilterType::HQX) {
-		hqxInit();
-		_hqxInitDone = true;
+	if (_scaleFilterType == ScaleFilterType::HQX) {
+		InitHqx();
+	}
+
+	if (_scaleFilterType == ScaleFilterType::xBRZ || _scaleFilterType == ScaleFilterType::HQX) {
+		uint32_t workerCount = WorkerPool::GetDefaultWorkerCount(MaxSliceWorkers);
+		if (workerCount > 0) {
+			_workerPool = std::make_unique<WorkerPool>(workerCount);
+		}
 	}
 }
 
+ScaleFilter::~ScaleFilter() = default;
+
 uint32_t ScaleFilter::GetScale() {
 	return _filterScale;
 }
 
+uint64_t ScaleFilter::GetBufferSize() {
+	return _outputBuffer ? (uint64_t)_width * _height * _filterScale * _filterScale * sizeof(uint32_t) : 0;
+}
+
 uint32_t ScaleFilter::ApplyBrightness(uint32_t argb, uint8_t brightness) {
 	uint8_t r = ((argb & 0xFF0000) >> 16) * brightness / 255;
 	uint8_t g = ((argb & 0xFF00) >> 8) * brightness / 255;
@@ -32,12 +59,12 @@ uint32_t ScaleFilter::ApplyBrightness(uint32_t argb, uint8_t brightness) {
 	return 0xFF000000 | (r << 16) | (g << 8) | b;
 }
 
-void ScaleFilter::ApplyLcdGridFilter(uint32_t* inputArgbBuffer) {
+void ScaleFilter::GetLcdGridBrightness(uint8_t& topLeft, uint8_t& topRight, uint8_t& bottomLeft, uint8_t& bottomRight) {
 	VideoConfig& cfg = _emu->GetSettings()->GetVideoConfig();
-	uint8_t topLeft = (uint8_t)(cfg.LcdGridTopLeftBrightness * 255);
-	uint8_t topRight = (uint8_t)(cfg.LcdGridTopRightBrightness * 255);
-	uint8_t bottomLeft = (uint8_t)(cfg.LcdGridBottomLeftBrightness * 255);
-	uint8_t bottomRight = (uint8_t)(cfg.LcdGridBottomRightBrightness * 255);
+	topLeft = (uint8_t)(cfg.LcdGridTopLeftBrightness * 255);
+	topRight = (uint8_t)(cfg.LcdGridTopRightBrightness * 255);
+	bottomLeft = (uint8_t)(cfg.LcdGridBottomLeftBrightness * 255);
+	bottomRight = (uint8_t)(cfg.LcdGridBottomRightBrightness * 255);
 
 	// Rotate lcd effect as needed
 	uint32_t screenRotation = _emu->GetSettings()->GetVideoConfig().ScreenRotation;
@@ -51,6 +78,11 @@ void ScaleFilter::ApplyLcdGridFilter(uint32_t* inputArgbBuffer) {
 		bottomRight = bottomLeft;
 		bottomLeft = orgTopLeft;
 	}
+}
+
+void ScaleFilter::ApplyLcdGridFilter(uint32_t* inputArgbBuffer) {
+	uint8_t topLeft, topRight, bottomLeft, bottomRight;
+	GetLcdGridBrightness(topLeft, topRight, bottomLeft, bottomRight);
 
 	for (uint32_t y = 0; y < _height; y++) {
 		for (uint32_t x = 0; x < _width; x++) {
@@ -82,6 +114,30 @@ void ScaleFilter::ApplyPrescaleFilter(uint32_t* inputArgbBuffer) {
 	}
 }
 
+void ScaleFilter::ApplySlicedFilter(uint32_t* inputArgbBuffer, uint32_t width, uint32_t height) {
+	// Slices cover disjoint source row ranges, neighboring rows are read from the full input
+	// frame, so the output is identical to processing the frame in a single call
+	uint32_t sliceCount = _workerPool ? std::min(_workerPool->GetThreadCount(), height / MinSliceRows) : 1;
+	if (sliceCount <= 1) {
+		if (_scaleFilterType == ScaleFilterType::xBRZ) {
+			xbrz::scale(_filterScale, inputArgbBuffer, _outputBuffer.get(), width, height, xbrz::ColorFormat::ARGB);
+		} else {
+			hqx(_filterScale, inputArgbBuffer, _outputBuffer.get(), width, height);
+		}
+		return;
+	}
+
+	_workerPool->Run(sliceCount, [=, this](uint32_t slice) {
+		int yFirst = (int)(height * slice / sliceCount);
+		int yLast = (int)(height * (slice + 1) / sliceCount);
+		if (_scaleFilterType == ScaleFilterType::xBRZ) {
+			xbrz::scale(_filterScale, inputArgbBuffer, _outputBuffer.get(), width, height, xbrz::ColorFormat::ARGB, xbrz::ScalerCfg(), yFirst, yLast);
+		} else {
+			hqx(_filterScale, inputArgbBuffer, _outputBuffer.get(), width, height, yFirst, yLast);
+		}
+	});
+}
+
 void ScaleFilter::UpdateOutputBuffer(uint32_t width, uint32_t height) {
 	if (!_outputBuffer || width != _width || height != _height) {
 		_width = width;
@@ -93,10 +149,8 @@ void ScaleFilter::UpdateOutputBuffer(uint32_t width, uint32_t height) {
 uint32_t* ScaleFilter::ApplyFilter(uint32_t* inputArgbBuffer, uint32_t width, uint32_t height) {
 	UpdateOutputBuffer(width, height);
 
-	if (_scaleFilterType == ScaleFilterType::xBRZ) {
-		xbrz::scale(_filterScale, inputArgbBuffer, _outputBuffer.get(), width, height, xbrz::ColorFormat::ARGB);
-	} else if (_scaleFilterType == ScaleFilterType::HQX) {
-		hqx(_filterScale, inputArgbBuffer, _outputBuffer.get(), width, height);
+	if (_scaleFilterType == ScaleFilterType::xBRZ || _scaleFilterType == ScaleFilterType::HQX) {
+		ApplySlicedFilter(inputArgbBuffer, width, height);
 	} else if (_scaleFilterType == ScaleFilterType::Scale2x) {
 		scale(_filterScale, _outputBuffer.get(), width * sizeof(uint32_t) * _filterScale, inputArgbBuffer, width * sizeof(uint32_t), 4, width, height);
 	} else if (_scaleFilterType == ScaleFilterType::_2xSai) {
@@ -194,4 +248,16 @@ FrameInfo ScaleFilter::GetFrameInfo(FrameInfo baseFrameInfo) {
 	info.Height *= this->GetScale();
 	info.Width *= this->GetScale();
 	return info;
-}
\ No newline at end of file
+}
+bool ScaleFilter::CanRunOnGpu() {
+	return _scaleFilterType == ScaleFilterType::Prescale || _scaleFilterType == ScaleFilterType::LcdGrid;
+}
+
+void ScaleFilter::GetGpuPostProcess(GpuPostProcess& postProcess) {
+	postProcess.Scale = _filterScale;
+	postProcess.LcdGrid = _scaleFilterType == ScaleFilterType::LcdGrid;
+	if (postProcess.LcdGrid) {
+		uint8_t* brightness = postProcess.LcdGridBrightness;
+		GetLcdGridBrightness(brightness[0], brightness[1], brightness[2], brightness[3]);
+	}
+}
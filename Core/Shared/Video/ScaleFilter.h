@@ -1,13 +1,19 @@
 #pragma once
 
 #include "pch.h"
+#include <mutex>
 #include "Shared/SettingTypes.h"
 
 class Emulator;
+class WorkerPool;
+struct GpuPostProcess;
 
 class ScaleFilter {
 private:
-	static bool _hqxInitDone;
+	static std::once_flag _hqxInitFlag;
+
+	/// <summary>Builds HQX's 64 MB RGB to YUV table (once per process, waits if another thread is building it)</summary>
+	static void InitHqx();
 
 	Emulator* _emu = nullptr;
 
@@ -17,19 +23,42 @@ private:
 	uint32_t _width = 0;
 	uint32_t _height = 0;
 
+	/// <summary>Slice workers for xBRZ/HQX (null when the filter is cheap or only one core is available)</summary>
+	unique_ptr<WorkerPool> _workerPool;
+
+	static constexpr uint32_t MinSliceRows = 16;
+	static constexpr uint32_t MaxSliceWorkers = 3;
+
 	uint32_t ApplyBrightness(uint32_t argb, uint8_t brightness);
+	void GetLcdGridBrightness(uint8_t& topLeft, uint8_t& topRight, uint8_t& bottomLeft, uint8_t& bottomRight);
 	void ApplyLcdGridFilter(uint32_t* inputArgbBuffer);
 
 	void ApplyPrescaleFilter(uint32_t* inputArgbBuffer);
+	void ApplySlicedFilter(uint32_t* inputArgbBuffer, uint32_t width, uint32_t height);
 	void UpdateOutputBuffer(uint32_t width, uint32_t height);
 
 public:
 	ScaleFilter(Emulator* emu, ScaleFilterType scaleFilterType, uint32_t scale);
-	~ScaleFilter() = default;
+	~ScaleFilter();
 
 	uint32_t GetScale();
+
+	/// <summary>Size of the output buffer in bytes</summary>
+	[[nodiscard]] uint64_t GetBufferSize();
 	uint32_t* ApplyFilter(uint32_t* inputArgbBuffer, uint32_t width, uint32_t height);
 	FrameInfo GetFrameInfo(FrameInfo baseFrameInfo);
 
+	/// <summary>True for filters a rendering device can reproduce exactly (prescale, LCD grid)</summary>
+	[[nodiscard]] bool CanRunOnGpu();
+
+	/// <summary>Describe this filter for the renderer instead of running ApplyFilter()</summary>
+	void GetGpuPostProcess(GpuPostProcess& postProcess);
+
 	static unique_ptr<ScaleFilter> GetScaleFilter(Emulator* emu, VideoFilterType filter);
+
+	/// <summary>
+	/// Starts building the lookup tables needed by the filter on a background thread (no-op if they are already built),
+	/// so that the first frame using the filter doesn't have to wait for them.
+	/// </summary>
+	static void PrecomputeTables(VideoFilterType filter);
 };
\ No newline at end of file
@@ -0,0 +1,165 @@
+#include "pch.h"
+#include "Shared/Video/ScreenshotEncoder.h"
+#include "Shared/Video/RotateFilter.h"
+#include "Shared/Video/ScaleFilter.h"
+#include "Shared/Video/ScanlineFilter.h"
+#include "Shared/MessageManager.h"
+#include "Utilities/FolderUtilities.h"
+
+ScreenshotEncoder::ScreenshotEncoder(Emulator* emu) {
+	_emu = emu;
+}
+
+ScreenshotEncoder::~ScreenshotEncoder() {
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_stopRequested = true;
+	}
+	_requestCv.notify_one();
+	if (_thread.joinable()) {
+		_thread.join();
+	}
+}
+
+void ScreenshotEncoder::Enqueue(ScreenshotRequest&& request) {
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		if (!_thread.joinable()) {
+			_thread = std::thread([this]() { EncoderLoop(); });
+		}
+		_doneCv.wait(lock, [this] { return _requests.size() < MaxPendingRequests; });
+		_requests.push_back(std::move(request));
+	}
+	_requestCv.notify_one();
+}
+
+void ScreenshotEncoder::WaitForIdle() {
+	std::unique_lock<std::mutex> lock(_mutex);
+	_doneCv.wait(lock, [this] { return _requests.empty() && _activeCount == 0; });
+}
+
+void ScreenshotEncoder::EncoderLoop() {
+	while (true) {
+		ScreenshotRequest request;
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_requestCv.wait(lock, [this] { return _stopRequested || !_requests.empty(); });
+			if (_requests.empty()) {
+				// Only stops once every pending screenshot is written
+				return;
+			}
+			request = std::move(_requests.front());
+			_requests.pop_front();
+			_activeCount++;
+		}
+		// A slot was freed in the queue
+		_doneCv.notify_all();
+
+		Process(request);
+
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_activeCount--;
+		}
+		_doneCv.notify_all();
+	}
+}
+
+void ScreenshotEncoder::Process(ScreenshotRequest& request) {
+	std::stringstream png;
+	if (!Encode(_emu, request, png)) {
+		return;
+	}
+
+	if (request.OnEncoded) {
+		request.OnEncoded(png);
+		return;
+	}
+
+	string path = GetNextScreenshotPath(request.RomName);
+	ofstream file(path, std::ios::out | std::ios::binary);
+	if (file.good()) {
+		file << png.rdbuf();
+		file.close();
+		MessageManager::DisplayMessage("ScreenshotSaved", FolderUtilities::GetFilename(path, true));
+	}
+}
+
+bool ScreenshotEncoder::Encode(Emulator* emu, ScreenshotRequest& request, std::stringstream& png) {
+	if (request.FrameBuffer.empty()) {
+		return false;
+	}
+
+	uint32_t* pngBuffer = request.FrameBuffer.data();
+	FrameInfo frameInfo = request.Frame;
+	uint8_t scale = 1;
+
+	unique_ptr<RotateFilter> rotateFilter(new RotateFilter(request.ScreenRotation));
+	if (request.ScreenRotation != 0) {
+		pngBuffer = rotateFilter->ApplyFilter(pngBuffer, frameInfo.Width, frameInfo.Height);
+		frameInfo = rotateFilter->GetFrameInfo(frameInfo);
+	}
+
+	unique_ptr<ScaleFilter> scaleFilter = ScaleFilter::GetScaleFilter(emu, request.FilterType);
+	if (scaleFilter) {
+		pngBuffer = scaleFilter->ApplyFilter(pngBuffer, frameInfo.Width, frameInfo.Height);
+		frameInfo = scaleFilter->GetFrameInfo(frameInfo);
+		scale = scaleFilter->GetScale();
+	}
+
+	ScanlineFilter::ApplyFilter(pngBuffer, frameInfo.Width, frameInfo.Height, request.ScanlineIntensity, scale);
+
+	vector<uint32_t> thumbnail;
+	if (request.MaxHeight > 0 && frameInfo.Height > request.MaxHeight) {
+		uint32_t factor = (frameInfo.Height + request.MaxHeight - 1) / request.MaxHeight;
+		Downscale(pngBuffer, frameInfo.Width, frameInfo.Height, factor, thumbnail);
+		pngBuffer = thumbnail.data();
+		frameInfo = {frameInfo.Width / factor, frameInfo.Height / factor};
+	}
+
+	return PNGHelper::WritePNG(png, pngBuffer, frameInfo.Width, frameInfo.Height, 24, request.CompressionLevel);
+}
+
+void ScreenshotEncoder::Downscale(const uint32_t* src, uint32_t width, uint32_t height, uint32_t factor, vector<uint32_t>& dst) {
+	uint32_t dstWidth = width / factor;
+	uint32_t dstHeight = height / factor;
+	uint32_t sampleCount = factor * factor;
+	dst.resize((size_t)dstWidth * dstHeight);
+
+	for (uint32_t y = 0; y < dstHeight; y++) {
+		for (uint32_t x = 0; x < dstWidth; x++) {
+			uint32_t r = 0, g = 0, b = 0;
+			for (uint32_t j = 0; j < factor; j++) {
+				const uint32_t* row = src + (size_t)(y * factor + j) * width + x * factor;
+				for (uint32_t i = 0; i < factor; i++) {
+					r += (row[i] >> 16) & 0xFF;
+					g += (row[i] >> 8) & 0xFF;
+					b += row[i] & 0xFF;
+				}
+			}
+			dst[(size_t)y * dstWidth + x] = 0xFF000000 | ((r / sampleCount) << 16) | ((g / sampleCount) << 8) | (b / sampleCount);
+		}
+	}
+}
+
+string ScreenshotEncoder::GetNextScreenshotPath(const string& romName) {
+	string romFilename = FolderUtilities::GetFilename(romName, false);
+	string baseFilename = FolderUtilities::CombinePath(FolderUtilities::GetScreenshotFolder(), romFilename);
+
+	// Called by the encoder thread only: the previous screenshot is always on the disk by the time the next name is picked
+	int counter = 0;
+	while (true) {
+		string counterStr = std::to_string(counter);
+		while (counterStr.length() < 3) {
+			counterStr = "0" + counterStr;
+		}
+		string ssFilename = baseFilename + "_" + counterStr + ".png";
+		ifstream file(ssFilename, ios::in);
+		if (file) {
+			file.close();
+		} else {
+			return ssFilename;
+		}
+		counter++;
+	}
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include "pch.h"
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include "Shared/SettingTypes.h"
+#include "Utilities/PNGHelper.h"
+
+class Emulator;
+
+/// <summary>
+/// Screenshot captured from the video filter's output, along with everything needed to finish it off-thread.
+/// </summary>
+struct ScreenshotRequest {
+	vector<uint32_t> FrameBuffer; ///< Copy of the filter's ARGB output
+	FrameInfo Frame = {};
+	VideoFilterType FilterType = VideoFilterType::None; ///< Scale filter to apply (xBRZ, HQx, etc.)
+	uint32_t ScreenRotation = 0;
+	double ScanlineIntensity = 0;
+	uint32_t MaxHeight = 0; ///< Thumbnails: downscales the image (by an integer factor) to at most this height, 0 = full size
+	int CompressionLevel = PNGHelper::DefaultCompressionLevel;
+
+	string RomName; ///< Saves the PNG as the next free <RomName>_NNN.png in the screenshot folder...
+	std::function<void(std::stringstream& png)> OnEncoded; ///< ...or hands it to this callback (on the encoder thread)
+};
+
+/// <summary>
+/// Finishes screenshots (rotation, scale filter, scanlines, downscaling, PNG encoding) on a worker thread.
+/// </summary>
+/// <remarks>
+/// Only the copy of the filter's output buffer is done by the thread taking the screenshot, so taking
+/// screenshots in a quick succession doesn't stall the emulation. The queue is bounded (MaxPendingRequests):
+/// when it is full, Enqueue() waits for the oldest screenshot to be written instead of dropping it.
+/// The worker thread is started on the first Enqueue() call, pending screenshots are written on destruction.
+/// </remarks>
+class ScreenshotEncoder {
+public:
+	static constexpr uint32_t MaxPendingRequests = 4;
+
+private:
+	Emulator* _emu = nullptr;
+
+	std::thread _thread;
+	std::mutex _mutex;
+	std::condition_variable _requestCv;
+	std::condition_variable _doneCv;
+	std::deque<ScreenshotRequest> _requests;
+	uint32_t _activeCount = 0;
+	bool _stopRequested = false;
+
+	void EncoderLoop();
+	void Process(ScreenshotRequest& request);
+
+	[[nodiscard]] static string GetNextScreenshotPath(const string& romName);
+
+public:
+	ScreenshotEncoder(Emulator* emu);
+	~ScreenshotEncoder();
+
+	/// <summary>Queues a screenshot, waits if MaxPendingRequests screenshots are already queued</summary>
+	void Enqueue(ScreenshotRequest&& request);
+
+	/// <summary>Waits until every queued screenshot is written</summary>
+	void WaitForIdle();
+
+	/// <summary>Applies the request's filters and encodes it to PNG on the calling thread</summary>
+	static bool Encode(Emulator* emu, ScreenshotRequest& request, std::stringstream& png);
+
+	/// <summary>Box-filters an ARGB image down by an integer factor (factor x factor pixels per output pixel)</summary>
+	static void Downscale(const uint32_t* src, uint32_t width, uint32_t height, uint32_t factor, vector<uint32_t>& dst);
+};
@@ -7,10 +7,12 @@
 #include "Shared/Emulator.h"
 #include "Shared/RewindManager.h"
 #include "Shared/EmuSettings.h"
+#include "Shared/FrameProfiler.h"
 #include "Shared/SettingTypes.h"
 #include "Shared/Video/ScaleFilter.h"
 #include "Shared/Video/RotateFilter.h"
 #include "Shared/Video/ScanlineFilter.h"
+#include "Shared/Video/ScreenshotEncoder.h"
 #include "Shared/Video/DebugHud.h"
 #include "Shared/InputHud.h"
 #include "Shared/RenderedFrame.h"
@@ -23,10 +25,12 @@ VideoDecoder::VideoDecoder(Emulator* emu) {
 	_stopFlag = false;
 	_baseFrameSize = {256, 239};
 	_lastFrameSize = _baseFrameSize;
+	_screenshotEncoder = std::make_unique<ScreenshotEncoder>(emu);
 }
 
 VideoDecoder::~VideoDecoder() {
 	StopThread();
+	_screenshotEncoder.reset();
 }
 
 void VideoDecoder::Init() {
@@ -85,6 +89,7 @@ void VideoDecoder::UpdateVideoFilter() {
 }
 
 void VideoDecoder::DecodeFrame(bool forRewind) {
+	PROFILE_SCOPE(_emu->GetFrameProfiler(), ProfilerStage::VideoFilter);
 	UpdateVideoFilter();
 
 	bool isAudioPlayer = _emu->GetAudioPlayerHud() != nullptr;
@@ -113,31 +118,67 @@ void VideoDecoder::DecodeFrame(bool forRewind) {
 		}
 	}
 
-	_emu->GetDebugHud()->Draw(outputBuffer, frameSize, overscan, _frame.FrameNumber, _videoFilter->GetScaleFactor());
+	{
+		PROFILE_SCOPE(_emu->GetFrameProfiler(), ProfilerStage::Hud);
+		_emu->GetDebugHud()->Draw(outputBuffer, frameSize, overscan, _frame.FrameNumber, _videoFilter->GetScaleFactor());
+	}
+
+	// Prescale, LCD grid and scanlines are left to the renderer when it can do them on the GPU
+	bool useGpuPostProcess = !isAudioPlayer && _emu->GetVideoRenderer()->IsGpuPostProcessAvailable();
+	GpuPostProcess& postProcess = _convertedFrame.PostProcess;
+	postProcess = {};
 
+	// Size of the fully filtered image, including the upscale done by the renderer
+	FrameInfo displaySize = frameSize;
 	if (_scaleFilter && !isAudioPlayer) {
-		outputBuffer = _scaleFilter->ApplyFilter(outputBuffer, frameSize.Width, frameSize.Height);
-		frameSize = _scaleFilter->GetFrameInfo(frameSize);
+		if (useGpuPostProcess && _scaleFilter->CanRunOnGpu()) {
+			_scaleFilter->GetGpuPostProcess(postProcess);
+		} else if (!forRewind && _emu->GetSettings()->GetVideoConfig().LowQualityFilterDuringTurbo && IsTurboSpeed()) {
+			// Low quality profile while fast-forwarding - the renderer stretches the unscaled frame instead
+		} else {
+			outputBuffer = _scaleFilter->ApplyFilter(outputBuffer, frameSize.Width, frameSize.Height);
+			frameSize = _scaleFilter->GetFrameInfo(frameSize);
+		}
+		displaySize = _scaleFilter->GetFrameInfo(displaySize);
 	}
 
 	if (!isAudioPlayer) {
-		uint8_t scale = std::max<uint8_t>(1, (uint8_t)((double)frameSize.Height / (_frame.Height - overscan.Top - overscan.Bottom)));
-		ScanlineFilter::ApplyFilter(outputBuffer, frameSize.Width, frameSize.Height, _emu->GetSettings()->GetVideoConfig().ScanlineIntensity, scale);
+		double scanlineIntensity = _emu->GetSettings()->GetVideoConfig().ScanlineIntensity;
+		FrameInfo scanlineSize = useGpuPostProcess ? displaySize : frameSize;
+		uint8_t scale = std::max<uint8_t>(1, (uint8_t)((double)scanlineSize.Height / (_frame.Height - overscan.Top - overscan.Bottom)));
+		if (useGpuPostProcess) {
+			if (scanlineIntensity > 0) {
+				postProcess.ScanlineBrightness = (uint8_t)((1.0 - scanlineIntensity) * 255);
+				postProcess.ScanlineScale = std::max<uint8_t>(2, scale);
+			}
+		} else {
+			ScanlineFilter::ApplyFilter(outputBuffer, frameSize.Width, frameSize.Height, scanlineIntensity, scale);
+		}
 	}
 
-	RenderedFrame convertedFrame((void*)outputBuffer, frameSize.Width, frameSize.Height, _frame.Scale, _frame.FrameNumber, std::move(_frame.InputData));
+	_convertedFrame.FrameBuffer = (void*)outputBuffer;
+	_convertedFrame.Width = frameSize.Width;
+	_convertedFrame.Height = frameSize.Height;
+	_convertedFrame.Scale = _frame.Scale;
+	_convertedFrame.FrameNumber = _frame.FrameNumber;
+	_convertedFrame.InputData = _frame.InputData;
 
 	double aspectRatio = _emu->GetSettings()->GetAspectRatio(_emu->GetRegion(), _baseFrameSize);
-	if (frameSize.Height != _lastFrameSize.Height || frameSize.Width != _lastFrameSize.Width || aspectRatio != _lastAspectRatio) {
+	if (displaySize.Height != _lastFrameSize.Height || displaySize.Width != _lastFrameSize.Width || aspectRatio != _lastAspectRatio) {
 		_emu->GetNotificationManager()->SendNotification(ConsoleNotificationType::ResolutionChanged);
 	}
 	_lastAspectRatio = aspectRatio;
-	_lastFrameSize = frameSize;
+	_lastFrameSize = displaySize;
+
+	_videoFilterMemory = _videoFilter->GetBufferSize();
+	_scaleFilterMemory = _scaleFilter ? _scaleFilter->GetBufferSize() : 0;
+	_rotateFilterMemory = _rotateFilter ? _rotateFilter->GetBufferSize() : 0;
 
 	// Rewind manager will take care of sending the correct frame to the video renderer
-	_emu->GetRewindManager()->SendFrame(convertedFrame, forRewind);
+	_emu->GetRewindManager()->SendFrame(_convertedFrame, forRewind);
 
 	_frameChanged = false;
+	_frameChanged.notify_all();
 }
 
 void VideoDecoder::DecodeThread() {
@@ -160,35 +201,60 @@ uint32_t VideoDecoder::GetFrameCount() {
 }
 
 void VideoDecoder::WaitForAsyncFrameDecode() {
-	while (_frameChanged) {
-		// Spin until decode is done
-		std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(15));
+	// Blocks until DecodeFrame() clears the flag (no polling delay)
+	_frameChanged.wait(true);
+}
+
+bool VideoDecoder::IsTurboSpeed() {
+	uint32_t speed = _emu->GetSettings()->GetEmulationSpeed();
+	return speed == 0 || speed > 100;
+}
+
+bool VideoDecoder::IsTurboFrameDue() {
+	// The renderer can't present faster than the display, which runs at roughly the console's frame rate.
+	// Frames arriving before the next presentation would be filtered and then overwritten unseen.
+	if (_turboFrameTimer.GetElapsedMS() < 1000.0 / _emu->GetFps()) {
+		return false;
 	}
+	_turboFrameTimer.Reset();
+	return true;
 }
 
-void VideoDecoder::UpdateFrame(RenderedFrame frame, bool sync, bool forRewind) {
+void VideoDecoder::UpdateFrame(const RenderedFrame& frame, bool sync, bool forRewind) {
 	if (_emu->IsRunAheadFrame()) {
 		return;
 	}
 
+	if (_emu->IsHeadless()) {
+		// No decode thread: only the requested frames are rendered, decode them right away (e.g for screenshots)
+		if (_emu->IsRenderSkipped()) {
+			_frameCount++;
+			return;
+		}
+		sync = true;
+	}
+
+	if (!sync && !forRewind && IsTurboSpeed() && !IsTurboFrameDue()) {
+		_frameCount++;
+		return;
+	}
+
 	if (_frameChanged) {
 		// Decoder still processing last frame
-		uint32_t speed = _emu->GetSettings()->GetEmulationSpeed();
-		if (speed == 0 || speed > 100) {
+		if (IsTurboSpeed()) {
 			// During turbo/unlimited speed, skip frame instead of blocking emulation
 			// This prevents the pure busy-spin from capping emulation speed
 			_frameCount++;
 			return;
 		}
-		// At normal or slow speed, wait with yield instead of pure busy-spin
-		while (_frameChanged) {
-			std::this_thread::yield();
-		}
+		// At normal or slow speed, sleep until the decoder is done with the previous frame
+		_frameChanged.wait(true);
 	}
 
 	_emu->OnBeforeSendFrame();
 
-	_frame = std::move(frame);
+	// Reuses the input data storage's capacity instead of allocating every frame
+	_frame.CopyFrom(frame, _frameInputData);
 	if (sync) {
 		DecodeFrame(forRewind);
 	} else {
@@ -206,6 +272,7 @@ void VideoDecoder::StartThread() {
 		_videoFilter->SetBaseFrameInfo(_baseFrameSize);
 		_stopFlag = false;
 		_frameChanged = false;
+		_frameChanged.notify_all();
 		_frameCount = 0;
 		_waitForFrame.Reset();
 
@@ -234,13 +301,40 @@ bool VideoDecoder::IsRunning() {
 }
 
 void VideoDecoder::TakeScreenshot() {
-	if (_videoFilter) {
-		_videoFilter->TakeScreenshot(_emu->GetRomInfo().RomFile.GetFileName(), _videoFilterType);
+	ScreenshotRequest request;
+	if (_videoFilter && _videoFilter->CaptureScreenshot(_videoFilterType, request)) {
+		request.RomName = _emu->GetRomInfo().RomFile.GetFileName();
+		_screenshotEncoder->Enqueue(std::move(request));
 	}
 }
 
 void VideoDecoder::TakeScreenshot(std::stringstream& stream) {
-	if (_videoFilter) {
-		_videoFilter->TakeScreenshot(_videoFilterType, "", &stream);
+	ScreenshotRequest request;
+	if (_videoFilter && _videoFilter->CaptureScreenshot(_videoFilterType, request)) {
+		request.CompressionLevel = PNGHelper::FastCompressionLevel;
+		ScreenshotEncoder::Encode(_emu, request, stream);
 	}
 }
+
+bool VideoDecoder::TakeThumbnail(uint32_t maxHeight, std::function<void(std::stringstream& png)> onEncoded) {
+	ScreenshotRequest request;
+	if (!_videoFilter || !_videoFilter->CaptureScreenshot(_videoFilterType, request)) {
+		return false;
+	}
+
+	request.MaxHeight = maxHeight;
+	request.CompressionLevel = PNGHelper::FastCompressionLevel;
+	request.OnEncoded = std::move(onEncoded);
+	_screenshotEncoder->Enqueue(std::move(request));
+	return true;
+}
+
+void VideoDecoder::WaitForPendingScreenshots() {
+	_screenshotEncoder->WaitForIdle();
+}
+
+void VideoDecoder::ReportMemoryUsage(MemoryUsageNode& node) {
+	node.Add("Video filter", _videoFilterMemory);
+	node.Add("Scale filter", _scaleFilterMemory);
+	node.Add("Rotate filter", _rotateFilterMemory);
+}
@@ -4,10 +4,14 @@
 #include "Utilities/AutoResetEvent.h"
 #include "Shared/SettingTypes.h"
 #include "Shared/RenderedFrame.h"
+#include "Shared/Interfaces/IMemoryUsageReporter.h"
+#include "Utilities/Timer.h"
+#include <functional>
 
 class BaseVideoFilter;
 class ScaleFilter;
 class RotateFilter;
+class ScreenshotEncoder;
 class IRenderingDevice;
 class Emulator;
 
@@ -29,7 +33,7 @@ class Emulator;
 ///
 /// Thread safety:
 /// - _stopStartLock protects thread lifecycle
-/// - Atomic flags for frame change notifications
+/// - Atomic flags for frame change notifications (atomic wait/notify, no spinning)
 /// - AutoResetEvent for efficient wait/notify
 ///
 /// Performance:
@@ -37,7 +41,7 @@ class Emulator;
 /// - Filters can be swapped at runtime (hot-reload)
 /// - Synchronous mode available for debugging/screenshots
 /// </remarks>
-class VideoDecoder {
+class VideoDecoder : public IMemoryUsageReporter {
 private:
 	Emulator* _emu;
 
@@ -52,19 +56,30 @@ private:
 	atomic<bool> _stopFlag;
 	uint32_t _frameCount = 0;
 	bool _forceFilterUpdate = false;
+	Timer _turboFrameTimer; ///< Time since the last frame accepted for decoding at turbo speed
 
 	double _lastAspectRatio = 0.0;
 
 	FrameInfo _baseFrameSize = {};
 	FrameInfo _lastFrameSize = {};
 	RenderedFrame _frame = {};
+	vector<ControllerData> _frameInputData; ///< Storage for _frame.InputData (the emulation thread's view is only valid during UpdateFrame)
+	RenderedFrame _convertedFrame = {}; ///< Filtered frame, its InputData points to _frameInputData
 
 	VideoFilterType _videoFilterType = VideoFilterType::None;
 	unique_ptr<BaseVideoFilter> _videoFilter;
 	unique_ptr<ScaleFilter> _scaleFilter;
 	unique_ptr<RotateFilter> _rotateFilter;
+	unique_ptr<ScreenshotEncoder> _screenshotEncoder;
+
+	/// <summary>Filter output buffer sizes, updated by the decode thread after each frame (read by ReportMemoryUsage)</summary>
+	atomic<uint64_t> _videoFilterMemory = 0;
+	atomic<uint64_t> _scaleFilterMemory = 0;
+	atomic<uint64_t> _rotateFilterMemory = 0;
 
 	void UpdateVideoFilter();
+	[[nodiscard]] bool IsTurboSpeed();
+	[[nodiscard]] bool IsTurboFrameDue();
 
 	void DecodeThread();
 
@@ -75,9 +90,21 @@ public:
 	void Init();
 
 	void DecodeFrame(bool synchronous = false);
+	/// <summary>Saves a screenshot to the screenshot folder (encoded and written in the background)</summary>
 	void TakeScreenshot();
+
+	/// <summary>Encodes a screenshot to stream synchronously (fast compression, e.g for Lua scripts)</summary>
 	void TakeScreenshot(std::stringstream& stream);
 
+	/// <summary>
+	/// Encodes a thumbnail (at most maxHeight pixels high) in the background, and passes it to onEncoded.
+	/// Returns false (and onEncoded is never called) if there is no frame to take the thumbnail from.
+	/// </summary>
+	bool TakeThumbnail(uint32_t maxHeight, std::function<void(std::stringstream& png)> onEncoded);
+
+	/// <summary>Waits until the screenshots and thumbnails taken so far are encoded</summary>
+	void WaitForPendingScreenshots();
+
 	void ForceFilterUpdate() { _forceFilterUpdate = true; }
 
 	[[nodiscard]] uint32_t GetFrameCount();
@@ -85,11 +112,14 @@ public:
 	[[nodiscard]] FrameInfo GetFrameInfo();
 	[[nodiscard]] double GetLastFrameScale() { return _frame.Scale; }
 
-	void UpdateFrame(RenderedFrame frame, bool sync, bool forRewind);
+	void UpdateFrame(const RenderedFrame& frame, bool sync, bool forRewind);
 
 	void WaitForAsyncFrameDecode();
 
 	[[nodiscard]] bool IsRunning();
 	void StartThread();
 	void StopThread();
+
+	/// <summary>Report the filter output buffers, as of the last decoded frame (IMemoryUsageReporter)</summary>
+	void ReportMemoryUsage(MemoryUsageNode& node) override;
 };
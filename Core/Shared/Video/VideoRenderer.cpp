@@ -4,10 +4,12 @@
 #include "Shared/Interfaces/IRenderingDevice.h"
 #include "Shared/Emulator.h"
 #include "Shared/EmuSettings.h"
+#include "Shared/FrameLimiter.h"
 #include "Shared/Video/DebugHud.h"
 #include "Shared/Video/SystemHud.h"
 #include "Shared/InputHud.h"
 #include "Shared/MessageManager.h"
+#include "Shared/SharedMemoryExport.h"
 #include "Utilities/Video/IVideoRecorder.h"
 #include "Utilities/Video/AviRecorder.h"
 #include "Utilities/Video/GifRecorder.h"
@@ -70,6 +72,9 @@ void VideoRenderer::RenderThread() {
 		_renderer->OnRendererThreadStarted();
 	}
 
+	// Reused between iterations so copying the last frame doesn't allocate
+	RenderedFrame frame;
+	vector<ControllerData> frameInputData;
 	while (!_stopFlag.load()) {
 		// Wait until a frame is ready, or until 32ms have passed (to allow HUD to update at ~30fps when paused)
 		bool forceRender = !_waitForRender.Wait(32);
@@ -81,11 +86,11 @@ void VideoRenderer::RenderThread() {
 			if (_emuHudSurface.UpdateSize(size.Width, size.Height)) {
 				_rendererHud->ClearScreen();
 			}
+			_hudSurfaceMemory = _emuHudSurface.GetBufferSize() + _scriptHudSurface.GetBufferSize();
 
-			RenderedFrame frame;
 			{
 				auto lock = _frameLock.AcquireSafe();
-				frame = _lastFrame;
+				frame.CopyFrom(_lastFrame, frameInputData);
 			}
 
 			_inputHud->DrawControllers(size, frame.InputData);
@@ -100,6 +105,10 @@ void VideoRenderer::RenderThread() {
 			if (forceRender || _needRedraw || _emuHudSurface.IsDirty || _scriptHudSurface.IsDirty) {
 				_needRedraw = false;
 				_renderer->Render(_emuHudSurface, _scriptHudSurface);
+				if (!forceRender) {
+					// New frame presented, used by the frame limiter to align frames with vsync
+					_emu->GetFrameLimiter()->OnFramePresented();
+				}
 			}
 		}
 	}
@@ -126,18 +135,16 @@ bool VideoRenderer::DrawScriptHud(RenderedFrame& frame) {
 		// Clear+draw HUD for scripts
 		//-Only when frame number changes (to prevent the HUD from disappearing when paused, etc.)
 		//-Only when commands are queued, otherwise skip drawing/clearing to avoid wasting CPU time
-		if (_needScriptHudClear) {
-			_scriptHudSurface.Clear();
-			_needScriptHudClear = false;
-			needRedraw = true;
-		}
-
-		if (_emu->GetScriptHud()->HasCommands()) {
+		//-Only when the commands differ from the ones already drawn on the surface
+		DebugHud* scriptHud = _emu->GetScriptHud();
+		if (scriptHud->HasCommands() || _needScriptHudClear) {
+			bool hasCommands = scriptHud->HasCommands();
 			auto [size, overscan] = GetScriptHudSize();
-			_emu->GetScriptHud()->Draw(_scriptHudSurface.Buffer.get(), size, overscan, frame.FrameNumber, {});
-			_needScriptHudClear = true;
-			_lastScriptHudFrameNumber = frame.FrameNumber;
-			needRedraw = true;
+			needRedraw = scriptHud->DrawRetained(_scriptHudSurface.Buffer.get(), size, overscan, frame.FrameNumber, {});
+			_needScriptHudClear = hasCommands;
+			if (hasCommands) {
+				_lastScriptHudFrameNumber = frame.FrameNumber;
+			}
 		}
 	}
 	return needRedraw;
@@ -161,9 +168,16 @@ void VideoRenderer::UpdateFrame(RenderedFrame& frame) {
 
 	ProcessAviRecording(frame);
 
+	if (_emu->IsSharedMemoryExportActive()) {
+		shared_ptr<SharedMemoryExport> sharedExport = _emu->GetSharedMemoryExport();
+		if (sharedExport) {
+			sharedExport->PublishFrame(frame);
+		}
+	}
+
 	{
 		auto lock = _frameLock.AcquireSafe();
-		_lastFrame = frame;
+		_lastFrame.CopyFrom(frame, _lastFrameInputData);
 	}
 
 	if (_renderer) {
@@ -179,6 +193,12 @@ void VideoRenderer::ClearFrame() {
 	}
 }
 
+bool VideoRenderer::IsGpuPostProcessAvailable() {
+	// AVI recording needs the fully filtered frame, keep the CPU chain while it runs
+	IRenderingDevice* renderer = _renderer;
+	return renderer && renderer->SupportsGpuPostProcess() && !IsRecording();
+}
+
 void VideoRenderer::RegisterRenderingDevice(IRenderingDevice* renderer) {
 	_renderer = renderer;
 	StartThread();
@@ -193,7 +213,8 @@ void VideoRenderer::UnregisterRenderingDevice(IRenderingDevice* renderer) {
 
 void VideoRenderer::ProcessAviRecording(RenderedFrame& frame) {
 	shared_ptr<IVideoRecorder> recorder = _recorder.lock();
-	if (recorder) {
+	if (recorder && !frame.PostProcess.IsActive()) {
+		// Frames decoded for the GPU path before recording started are skipped
 		if (!recorder->IsRecording()) {
 			recorder->StartRecording(frame.Width, frame.Height, 4, _emu->GetSettings()->GetAudioConfig().SampleRate, _emu->GetFps());
 		}
@@ -206,6 +227,7 @@ void VideoRenderer::ProcessAviRecording(RenderedFrame& frame) {
 
 			// Update the surface to match the frame's size
 			_aviRecorderSurface.UpdateSize(frame.Width, frame.Height);
+			_recorderSurfaceMemory = _aviRecorderSurface.GetBufferSize();
 
 			// Copy the game screen
 			memcpy(_aviRecorderSurface.Buffer.get(), frame.FrameBuffer, frame.Width * frame.Height * sizeof(uint32_t));
@@ -274,9 +296,15 @@ void VideoRenderer::StopRecording() {
 		MessageManager::DisplayMessage("VideoRecorder", "VideoRecorderStopped", recorder->GetOutputFile());
 	}
 	_aviRecorderSurface.UpdateSize(0, 0);
+	_recorderSurfaceMemory = 0;
 	_recorder.reset();
 }
 
 bool VideoRenderer::IsRecording() {
 	return _recorder != nullptr;
 }
+
+void VideoRenderer::ReportMemoryUsage(MemoryUsageNode& node) {
+	node.Add("HUD surfaces", _hudSurfaceMemory);
+	node.Add("Recording surface", _recorderSurfaceMemory);
+}
@@ -4,6 +4,7 @@
 #include "Shared/SettingTypes.h"
 #include "Shared/RenderedFrame.h"
 #include "Shared/Interfaces/IRenderingDevice.h"
+#include "Shared/Interfaces/IMemoryUsageReporter.h"
 #include "Utilities/AutoResetEvent.h"
 #include "Utilities/SimpleLock.h"
 #include "Utilities/safe_ptr.h"
@@ -59,7 +60,7 @@ struct RecordAviOptions {
 /// - Records post-filter, pre-HUD or post-HUD frames
 /// - Supports multiple codecs: Raw, ZMBV, Camstudio LZSS
 /// </remarks>
-class VideoRenderer {
+class VideoRenderer : public IMemoryUsageReporter {
 private:
 	Emulator* _emu;
 
@@ -75,7 +76,7 @@ private:
 	unique_ptr<DebugHud> _rendererHud;
 	unique_ptr<SystemHud> _systemHud;
 	unique_ptr<InputHud> _inputHud;
-	SimpleLock _hudLock;
+	SimpleLock _hudLock{"Renderer HUD"};
 
 	RenderSurfaceInfo _aviRecorderSurface = {};
 	RecordAviOptions _recorderOptions = {};
@@ -89,8 +90,13 @@ private:
 	uint32_t _lastScriptHudFrameNumber = 0;
 	bool _needRedraw = true;
 
+	/// <summary>Surface sizes, updated by the threads that resize them (read by ReportMemoryUsage)</summary>
+	atomic<uint64_t> _hudSurfaceMemory = 0;
+	atomic<uint64_t> _recorderSurfaceMemory = 0;
+
 	RenderedFrame _lastFrame;
-	SimpleLock _frameLock;
+	vector<ControllerData> _lastFrameInputData; ///< Storage for _lastFrame.InputData
+	SimpleLock _frameLock{"Renderer frame"};
 
 	safe_ptr<IVideoRecorder> _recorder;
 
@@ -116,6 +122,8 @@ public:
 
 	void UpdateFrame(RenderedFrame& frame);
 	void ClearFrame();
+	/// <summary>True if the current device can apply RenderedFrame::PostProcess (never while recording)</summary>
+	[[nodiscard]] bool IsGpuPostProcessAvailable();
 	void RegisterRenderingDevice(IRenderingDevice* renderer);
 	void UnregisterRenderingDevice(IRenderingDevice* renderer);
 
@@ -123,4 +131,7 @@ public:
 	void AddRecordingSound(int16_t* soundBuffer, uint32_t sampleCount, uint32_t sampleRate);
 	void StopRecording();
 	[[nodiscard]] bool IsRecording();
+
+	/// <summary>Report the HUD and recording surfaces (IMemoryUsageReporter)</summary>
+	void ReportMemoryUsage(MemoryUsageNode& node) override;
 };
@@ -74,6 +74,7 @@ void WsDebugger::Reset() {
 }
 
 void WsDebugger::OnBeforeBreak(CpuType cpuType) {
+	_cpu->SyncPrefetch();
 	_memoryManager->OnBeforeBreak();
 }
 
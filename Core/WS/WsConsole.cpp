@@ -141,7 +141,7 @@ LoadRomResult WsConsole::LoadRom(VirtualFile& romFile) {
 	_memoryManager = std::make_unique<WsMemoryManager>();
 	_cpu = std::make_unique<WsCpu>(_emu, this, _memoryManager.get());
 	_timer = std::make_unique<WsTimer>();
-	_serial = std::make_unique<WsSerial>(this);
+	_serial = std::make_unique<WsSerial>(_emu, this);
 	_dmaController = std::make_unique<WsDmaController>();
 	_ppu = std::make_unique<WsPpu>(_emu, this, _memoryManager.get(), _timer.get(), _workRam);
 	_apu = std::make_unique<WsApu>(_emu, this, _memoryManager.get(), _dmaController.get());
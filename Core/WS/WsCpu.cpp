@@ -80,6 +80,8 @@ T WsCpu::ReadMemory(uint16_t seg, uint16_t offset) {
 template <typename T>
 void WsCpu::WriteMemory(uint16_t seg, uint16_t offset, T value) {
 #ifndef DUMMYCPU
+	// The bytes the queue would have fetched so far must be read before the write
+	_prefetch.Sync();
 	_memoryManager->Write<T>(seg, offset, value);
 #else
 	LogMemoryOperation((seg << 4) + offset, value, MemoryOperationType::Write, MemoryType::WsMemory, std::is_same<T, uint16_t>::value);
@@ -100,6 +102,8 @@ T WsCpu::ReadPort(uint16_t port) {
 template <typename T>
 void WsCpu::WritePort(uint16_t port, T value) {
 #ifndef DUMMYCPU
+	// Port writes can change the wait states and the memory mappings
+	_prefetch.Sync();
 	_memoryManager->WritePort<T>(port, value);
 #else
 	LogMemoryOperation(port, value, MemoryOperationType::Write, MemoryType::WsPort, std::is_same<T, uint16_t>::value);
@@ -832,6 +836,12 @@ void WsCpu::ClearPrefetch() {
 #endif
 }
 
+void WsCpu::SyncPrefetch() {
+#ifndef DUMMYCPU
+	_prefetch.Sync();
+#endif
+}
+
 template <>
 uint8_t WsCpu::GetModRegister(uint8_t reg) {
 	uint16_t* regValue = _modRegLut8[reg & 0x03];
@@ -391,6 +391,9 @@ public:
 	__forceinline void IncCycleCount() { _state.CycleCount++; }
 	void ClearPrefetch();
 
+	/// <summary>Brings the prefetch queue up to date (it's updated lazily, see WsCpuPrefetch::Sync)</summary>
+	void SyncPrefetch();
+
 	[[nodiscard]] uint32_t GetProgramCounter(bool adjustForRepLoop = false);
 
 	void Exec();
@@ -19,32 +19,56 @@ void WsCpuPrefetch::PushByte(uint8_t value) {
 }
 
 void WsCpuPrefetch::Prefetch() {
+	// The queue is only updated when its content is needed (see Sync)
 	_cpu->ProcessCpuCycle();
+	_pendingCycles++;
+}
 
-	_waitCycles++;
-
-	if (IsFull()) {
-		return;
-	}
-
-	uint32_t addr = ((_fetchCs << 4) + _fetchIp) & 0xFFFFF;
-	uint8_t cycles = _memoryManager->GetWaitStates(addr);
-	if (_waitCycles < cycles) {
-		return;
-	}
-
-	_waitCycles = 0;
-
-	bool isWordBus = _memoryManager->IsWordBus(addr);
-
-	// TODOWS debugger can't see these reads
-	PushByte(_memoryManager->InternalRead(addr));
-	if (!IsFull() && isWordBus && (_fetchIp & 0x01)) {
-		PushByte(_memoryManager->InternalRead(((_fetchCs << 4) + _fetchIp)) & 0xFFFFF);
+void WsCpuPrefetch::Sync() {
+	// Applies the pending cycles in bulk - same result as updating the queue on every cycle:
+	// each cycle increments the wait counter and a fetch occurs once it reaches the address'
+	// wait states. Nothing that affects the fetches (fetch address, wait states, memory content)
+	// can change between 2 syncs: the CPU syncs before its writes and when the queue is read.
+	while (_pendingCycles > 0) {
+		if (IsFull()) {
+			// The wait counter keeps running (and wraps around) while the queue is full
+			_waitCycles += (uint8_t)_pendingCycles;
+			_pendingCycles = 0;
+			return;
+		}
+
+		uint32_t addr = ((_fetchCs << 4) + _fetchIp) & 0xFFFFF;
+		uint8_t cycles = _memoryManager->GetWaitStates(addr);
+
+		// Cycles until the counter (incremented before the comparison) reaches the wait states
+		uint32_t elapsed;
+		if (_waitCycles == 0xFF) {
+			elapsed = cycles + 1;
+		} else {
+			elapsed = _waitCycles + 1 >= cycles ? 1 : cycles - _waitCycles;
+		}
+
+		if (elapsed > _pendingCycles) {
+			_waitCycles += (uint8_t)_pendingCycles;
+			_pendingCycles = 0;
+			return;
+		}
+
+		_pendingCycles -= elapsed;
+		_waitCycles = 0;
+
+		bool isWordBus = _memoryManager->IsWordBus(addr);
+
+		// TODOWS debugger can't see these reads
+		PushByte(_memoryManager->InternalRead(addr));
+		if (!IsFull() && isWordBus && (_fetchIp & 0x01)) {
+			PushByte(_memoryManager->InternalRead(((_fetchCs << 4) + _fetchIp)) & 0xFFFFF);
+		}
 	}
 }
 
 void WsCpuPrefetch::ProcessRep(uint8_t opCode) {
+	Sync();
 	if (IsFull()) {
 		_writePos--;
 		_fetchIp--;
@@ -57,8 +81,10 @@ void WsCpuPrefetch::ProcessRep(uint8_t opCode) {
 }
 
 uint8_t WsCpuPrefetch::Read() {
+	Sync();
 	while (_size < 2) {
 		Prefetch();
+		Sync();
 	}
 
 	_size--;
@@ -72,9 +98,14 @@ void WsCpuPrefetch::Clear(uint16_t cs, uint16_t ip) {
 	_readPos = 0;
 	_writePos = 0;
 	_waitCycles = 0;
+	_pendingCycles = 0;
 }
 
 void WsCpuPrefetch::Serialize(Serializer& s) {
+	if (s.IsSaving()) {
+		Sync();
+	}
+
 	SV(_fetchCs);
 	SV(_fetchIp);
 	SV(_readPos);
@@ -16,6 +16,9 @@ private:
 
 	uint8_t _waitCycles = 0;
 
+	// Cycles that elapsed since the queue was last updated (not serialized, always 0 after Sync)
+	uint32_t _pendingCycles = 0;
+
 	uint8_t _data[16] = {};
 
 	WsMemoryManager* _memoryManager = nullptr;
@@ -28,6 +31,7 @@ public:
 	WsCpuPrefetch(WsCpu* cpu, WsMemoryManager* memoryManager);
 
 	void Prefetch();
+	void Sync();
 	void ProcessRep(uint8_t opCode);
 	uint8_t Read();
 	void Clear(uint16_t cs, uint16_t ip);
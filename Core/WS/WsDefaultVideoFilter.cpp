@@ -16,19 +16,13 @@ WsDefaultVideoFilter::WsDefaultVideoFilter(Emulator* emu, WsConsole* console, bo
 
 WsDefaultVideoFilter::~WsDefaultVideoFilter() = default;
 
-uint32_t WsDefaultVideoFilter::BlendPixels(uint32_t a, uint32_t b) {
-	return ((((a) ^ (b)) & 0xfffefefeL) >> 1) + ((a) & (b));
-}
-
 void WsDefaultVideoFilter::InitLookupTable() {
 	VideoConfig config = _emu->GetSettings()->GetVideoConfig();
 
-	InitConversionMatrix(config.Hue, config.Saturation);
-
-	for (int rgb444 = 0; rgb444 < 0x1000; rgb444++) {
-		uint8_t r = (rgb444 >> 8) & 0xF;
-		uint8_t g = (rgb444 >> 4) & 0xF;
-		uint8_t b = rgb444 & 0xF;
+	InitPaletteLut(_calculatedPalette, 0x1000, config, [this](uint32_t rgb444, uint8_t& r, uint8_t& g, uint8_t& b) {
+		r = (rgb444 >> 8) & 0xF;
+		g = (rgb444 >> 4) & 0xF;
+		b = rgb444 & 0xF;
 
 		if (_adjustColors) {
 			if (_console->GetModel() == WsModel::Monochrome) {
@@ -53,14 +47,7 @@ void WsDefaultVideoFilter::InitLookupTable() {
 			g = ColorUtilities::Convert4BitTo8Bit(g);
 			b = ColorUtilities::Convert4BitTo8Bit(b);
 		}
-
-		if (config.Hue != 0 || config.Saturation != 0 || config.Brightness != 0 || config.Contrast != 0) {
-			ApplyColorOptions(r, g, b, config.Brightness, config.Contrast);
-			_calculatedPalette[rgb444] = 0xFF000000 | (r << 16) | (g << 8) | b;
-		} else {
-			_calculatedPalette[rgb444] = 0xFF000000 | (r << 16) | (g << 8) | b;
-		}
-	}
+	});
 
 	_videoConfig = config;
 }
@@ -80,7 +67,7 @@ void WsDefaultVideoFilter::OnBeforeApplyFilter() {
 	WsConfig wsConfig = _emu->GetSettings()->GetWsConfig();
 
 	bool adjustColors = wsConfig.LcdAdjustColors;
-	if (_videoConfig.Hue != config.Hue || _videoConfig.Saturation != config.Saturation || _videoConfig.Contrast != config.Contrast || _videoConfig.Brightness != config.Brightness || _adjustColors != adjustColors) {
+	if (PaletteOptionsChanged(_videoConfig, config) || _adjustColors != adjustColors) {
 		_adjustColors = adjustColors;
 		InitLookupTable();
 	}
@@ -97,13 +84,9 @@ void WsDefaultVideoFilter::ApplyFilter(uint16_t* ppuOutputBuffer) {
 	FrameInfo size = _baseFrameInfo;
 
 	if (_blendFrames && _prevFrameSize.Width == size.Width && _prevFrameSize.Height == size.Height) {
-		for (uint32_t i = 0, len = size.Height * size.Width; i < len; i++) {
-			out[i] = BlendPixels(_calculatedPalette[_prevFrame[i]], _calculatedPalette[ppuOutputBuffer[i]]);
-		}
+		ConvertFrameBlended(_calculatedPalette, 0xFFF, ppuOutputBuffer, _prevFrame.get(), size.Width, 0, 0, out, size.Width, size.Height);
 	} else {
-		for (uint32_t i = 0, len = size.Height * size.Width; i < len; i++) {
-			out[i] = _calculatedPalette[ppuOutputBuffer[i]];
-		}
+		ConvertFrame(_calculatedPalette, 0xFFF, ppuOutputBuffer, size.Width, 0, 0, out, size.Width, size.Height);
 	}
 
 	if (_blendFrames) {
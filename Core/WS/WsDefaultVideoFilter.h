@@ -66,12 +66,6 @@ private:
 	bool _applyNtscFilter = false;  ///< Enable NTSC composite simulation
 	GenericNtscFilter _ntscFilter;  ///< NTSC filter for CRT effects
 
-	/// <summary>Fast pixel blending using bit manipulation (50% blend).</summary>
-	/// <param name="a">First pixel ARGB</param>
-	/// <param name="b">Second pixel ARGB</param>
-	/// <returns>Blended pixel ARGB</returns>
-	uint32_t BlendPixels(uint32_t a, uint32_t b);
-
 	/// <summary>Initialize 4K-entry RGB lookup table from settings.</summary>
 	void InitLookupTable();
 
@@ -62,53 +62,20 @@ void WsMemoryManager::RefreshMappings() {
 }
 
 void WsMemoryManager::Map(uint32_t start, uint32_t end, MemoryType type, uint32_t offset, bool readonly) {
-	uint8_t* src = (uint8_t*)_emu->GetMemory(type).Memory;
-	uint32_t size = _emu->GetMemory(type).Size;
-
-	if (size > 0) {
-		while (offset >= size) {
-			offset -= size;
-		}
-
-		src += offset;
-		for (uint32_t i = start; i < end; i += 0x1000) {
-			_reads[i >> 12] = src;
-			_writes[i >> 12] = readonly ? nullptr : src;
-
-			if (src) {
-				src += 0x1000;
-				offset = (offset + 0x1000);
-				if (offset >= size) {
-					offset = 0;
-					src = (uint8_t*)_emu->GetMemory(type).Memory;
-				}
-			}
-		}
-	} else {
-		Unmap(start, end);
-	}
+	ConsoleMemoryInfo memory = _emu->GetMemory(type);
+	_pages.Map(start, end, (uint8_t*)memory.Memory, memory.Size, offset, readonly);
 }
 
 void WsMemoryManager::Unmap(uint32_t start, uint32_t end) {
-	for (uint32_t i = start; i < end; i += 0x1000) {
-		_reads[i >> 12] = nullptr;
-		_writes[i >> 12] = nullptr;
-	}
+	_pages.Unmap(start, end);
 }
 
 uint8_t WsMemoryManager::DebugRead(uint32_t addr) {
-	uint8_t* handler = _reads[addr >> 12];
-	if (handler) {
-		return handler[addr & 0xFFF];
-	}
-	return 0;
+	return _pages.Read(addr, 0);
 }
 
 void WsMemoryManager::DebugWrite(uint32_t addr, uint8_t value) {
-	uint8_t* handler = _writes[addr >> 12];
-	if (handler) {
-		handler[addr & 0xFFF] = value;
-	}
+	_pages.Write(addr, value);
 }
 
 template <typename T>
@@ -430,6 +397,9 @@ uint8_t WsMemoryManager::GetActiveIrqs() {
 	if (_serial->HasSendIrq() && (_state.EnabledIrqs & (uint8_t)WsIrqSource::UartSendReady)) {
 		_state.ActiveIrqs |= (uint8_t)WsIrqSource::UartSendReady;
 	}
+	if ((_state.EnabledIrqs & (uint8_t)WsIrqSource::UartRecvReady) && _serial->HasReceiveIrq()) {
+		_state.ActiveIrqs |= (uint8_t)WsIrqSource::UartRecvReady;
+	}
 	return _state.ActiveIrqs;
 }
 
@@ -456,7 +426,7 @@ AddressInfo WsMemoryManager::GetAbsoluteAddress(uint32_t relAddr) {
 		return {(int)(relAddr & (_workRamSize - 1)), MemoryType::WsWorkRam};
 	}
 
-	uint8_t* ptr = _reads[relAddr >> 12];
+	uint8_t* ptr = _pages.GetReadPage(relAddr);
 	if (ptr >= _prgRom && ptr < _prgRom + _prgRomSize) {
 		return {(int)(ptr - _prgRom + (relAddr & 0xFFF)), MemoryType::WsPrgRom};
 	} else if (ptr >= _saveRam && ptr < _saveRam + _saveRamSize) {
@@ -4,6 +4,7 @@
 #include "WS/APU/WsApu.h"
 #include "WS/WsPpu.h"
 #include "WS/WsTypes.h"
+#include "Shared/MemoryPageTable.h"
 #include "Utilities/ISerializable.h"
 
 class WsConsole;
@@ -93,11 +94,8 @@ private:
 	/// <summary>Memory manager state (banking, color mode, etc.).</summary>
 	WsMemoryManagerState _state = {};
 
-	/// <summary>Read handler table (4KB pages).</summary>
-	uint8_t* _reads[256] = {};
-
-	/// <summary>Write handler table (4KB pages).</summary>
-	uint8_t* _writes[256] = {};
+	/// <summary>Read/write mapping tables (4KB pages).</summary>
+	MemoryPageTable<12, 0x100> _pages;
 
 	/// <summary>Checks if port is 16-bit (word access).</summary>
 	bool IsWordPort(uint16_t port);
@@ -146,14 +144,8 @@ public:
 	/// <param name="addr">20-bit address.</param>
 	/// <returns>Byte value or open bus ($90).</returns>
 	__forceinline uint8_t InternalRead(uint32_t addr) {
-		uint8_t* handler = _reads[addr >> 12];
-		uint8_t value = 0x90;  // Open bus default
-		if (handler) {
-			value = handler[addr & 0xFFF];
-		}
-
 		// TODOWS open bus
-		return value;
+		return _pages.Read(addr, 0x90);
 	}
 
 	/// <summary>
@@ -163,10 +155,7 @@ public:
 	/// <param name="value">Byte value.</param>
 	__forceinline void InternalWrite(uint32_t addr, uint8_t value) {
 		// TODOWS open bus
-		uint8_t* handler = _writes[addr >> 12];
-		if (handler) {
-			handler[addr & 0xFFF] = value;
-		}
+		_pages.Write(addr, value);
 	}
 
 	uint8_t DebugRead(uint32_t addr);
@@ -186,9 +175,15 @@ public:
 				return lo | (hi << 8);
 			} else {
 				Exec();
-				uint8_t lo = InternalRead(addr);
-				uint8_t hi = InternalRead(((seg << 4) + (uint16_t)(offset + 1)) & 0xFFFFF);
-				uint16_t value = lo | (hi << 8);
+				uint16_t value;
+				if (uint8_t* page = _pages.GetReadPage(addr)) [[likely]] {
+					// Aligned word, both bytes are in the same page
+					value = page[addr & 0xFFF] | (page[(addr & 0xFFF) + 1] << 8);
+				} else {
+					uint8_t lo = InternalRead(addr);
+					uint8_t hi = InternalRead(((seg << 4) + (uint16_t)(offset + 1)) & 0xFFFFF);
+					value = lo | (hi << 8);
+				}
 				_emu->ProcessMemoryRead<CpuType::Ws, 2>(addr, value, opType);
 				return value;
 			}
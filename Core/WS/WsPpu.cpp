@@ -3,8 +3,11 @@
 #include "WS/WsTimer.h"
 #include "WS/WsControlManager.h"
 #include "WS/WsMemoryManager.h"
+#include "WS/WsTileDecoder.h"
 #include "WS/APU/WsApu.h"
 #include "Shared/EmuSettings.h"
+#include "Shared/Emulator.h"
+#include "Shared/FrameProfiler.h"
 #include "Shared/NotificationManager.h"
 #include "Shared/RewindManager.h"
 #include "Shared/Video/VideoDecoder.h"
@@ -52,7 +55,9 @@ void WsPpu::SetVideoMode(WsVideoMode mode) {
 
 void WsPpu::ProcessHblank() {
 	_timer->TickHorizontalTimer();
-	if (_state.Scanline < WsConstants::ScreenHeight) {
+
+	// Rendering a scanline has no side effects (no sprite overflow/collision flags), it can be skipped entirely
+	if (_state.Scanline < WsConstants::ScreenHeight && !_skipRender) {
 		switch (_state.Mode) {
 			case WsVideoMode::Monochrome:
 				DrawScanline<WsVideoMode::Monochrome>();
@@ -89,7 +94,10 @@ void WsPpu::ProcessEndOfScanline() {
 		_state.Mode = _state.NextMode;
 		_state.Scanline = 0;
 		_emu->ProcessEvent(EventType::StartFrame, CpuType::Ws);
-		_currentBuffer = _currentBuffer == _outputBuffers[0].get() ? _outputBuffers[1].get() : _outputBuffers[0].get();
+		_skipRender = _emu->IsRenderSkipped();
+		if (!_skipRender) {
+			_currentBuffer = _currentBuffer == _outputBuffers[0].get() ? _outputBuffers[1].get() : _outputBuffers[0].get();
+		}
 		_showIcons = _emu->GetSettings()->GetWsConfig().LcdShowIcons;
 	} else if (_state.Scanline == 145) {
 		SendFrame();
@@ -106,6 +114,7 @@ void WsPpu::ProcessEndOfScanline() {
 
 template <WsVideoMode mode>
 void WsPpu::DrawScanline() {
+	PROFILE_SCOPE(_emu->GetFrameProfiler(), ProfilerStage::Ppu);
 	uint8_t rowIndex = _state.Scanline & 0x01;
 	std::fill(_rowData[rowIndex], _rowData[rowIndex] + WsConstants::ScreenWidth, PixelData{});
 
@@ -153,6 +162,7 @@ void WsPpu::DrawSprites() {
 			}
 
 			uint16_t tileDataAddr = (bank0Addr + tileIndex * tileSize + tileRow * tileBytesPerRow);
+			uint64_t tilePixels = WsTileDecoder::DecodeRow<mode>(_vram + tileDataAddr, hMirror);
 			for (int j = 0; j < 8; j++) {
 				uint8_t x = sprX + j;
 
@@ -165,12 +175,7 @@ void WsPpu::DrawSprites() {
 					continue;
 				}
 
-				int tileColumn = j;
-				if (hMirror) {
-					tileColumn = 7 - tileColumn;
-				}
-
-				uint8_t color = GetPixelColor<mode>(tileDataAddr, tileColumn);
+				uint8_t color = WsTileDecoder::GetPixel(tilePixels, j);
 				if (color != 0 || (!(palette & 0x04) && mode <= WsVideoMode::Color2bpp)) {
 					_rowData[rowIndex][x] = {palette, color, highPriority ? (uint8_t)2 : (uint8_t)1};
 				}
@@ -216,9 +221,6 @@ void WsPpu::DrawBackground() {
 		uint8_t palette = (tilemapData >> 9) & 0x0F;
 		bool vMirror = tilemapData & 0x8000;
 		bool hMirror = tilemapData & 0x4000;
-		if (hMirror) {
-			tileColumn = 7 - tileColumn;
-		}
 		if (vMirror) {
 			tileRow = 7 - tileRow;
 		}
@@ -226,9 +228,11 @@ void WsPpu::DrawBackground() {
 		uint16_t tilesetAddr = mode >= WsVideoMode::Color2bpp && (tilemapData & 0x2000) ? bank1Addr : bank0Addr;
 		uint16_t tileDataAddr = (tilesetAddr + tileIndex * tileSize + tileRow * tileBytesPerRow);
 
+		// Decode the tile's row once (already mirrored), then read its pixels from the first visible column
+		uint64_t tilePixels = WsTileDecoder::DecodeRow<mode>(_vram + tileDataAddr, hMirror);
 		for (int i = cycle, end = std::min<int>(cycle + counter, WsConstants::ScreenWidth); i < end; i++) {
-			uint8_t color = GetPixelColor<mode>(tileDataAddr, tileColumn);
-			tileColumn += (hMirror ? -1 : 1);
+			uint8_t color = WsTileDecoder::GetPixel(tilePixels, tileColumn);
+			tileColumn++;
 
 			if (_rowData[rowIndex][i].Priority >= layerIndex + 1) {
 				continue;
@@ -251,44 +255,6 @@ void WsPpu::DrawBackground() {
 	}
 }
 
-template <WsVideoMode mode>
-uint16_t WsPpu::GetPixelColor(uint16_t tileAddr, uint8_t column) {
-	switch (mode) {
-		case WsVideoMode::Monochrome: {
-			uint8_t tileData = _vram[tileAddr];
-			uint8_t tileData2 = _vram[tileAddr + 1];
-			return (
-			    ((tileData << column) & 0x80) >> 7 |
-			    ((tileData2 << column) & 0x80) >> 6);
-		}
-
-		case WsVideoMode::Color2bpp: {
-			uint8_t tileData = _vram[tileAddr];
-			uint8_t tileData2 = _vram[tileAddr + 1];
-			return (
-			    ((tileData << column) & 0x80) >> 7 |
-			    ((tileData2 << column) & 0x80) >> 6);
-		}
-
-		case WsVideoMode::Color4bpp: {
-			uint8_t tileData = _vram[tileAddr];
-			uint8_t tileData2 = _vram[tileAddr + 1];
-			uint8_t tileData3 = _vram[tileAddr + 2];
-			uint8_t tileData4 = _vram[tileAddr + 3];
-			return (
-			    ((tileData << column) & 0x80) >> 7 |
-			    ((tileData2 << column) & 0x80) >> 6 |
-			    ((tileData3 << column) & 0x80) >> 5 |
-			    ((tileData4 << column) & 0x80) >> 4);
-		}
-
-		case WsVideoMode::Color4bppPacked:
-			return (_vram[tileAddr + column / 2] >> (column & 0x01 ? 0 : 4)) & 0x0F;
-	}
-
-	return 0;
-}
-
 void WsPpu::ProcessSpriteCopy() {
 	if (_state.Cycle == 0) {
 		_state.SpriteCountLatch = _state.SpriteCount;
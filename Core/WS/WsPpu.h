@@ -67,6 +67,9 @@ private:
 	/// <summary>Current frame buffer.</summary>
 	uint16_t* _currentBuffer = nullptr;
 
+	/// <summary>Skip drawing the current frame (run-ahead frames, see Emulator::IsRenderSkipped).</summary>
+	bool _skipRender = false;
+
 	/// <summary>VRAM pointer (16KB).</summary>
 	uint8_t* _vram = nullptr;
 
@@ -122,10 +125,6 @@ private:
 	template <WsVideoMode mode, int layerIndex>
 	void DrawBackground();
 
-	/// <summary>Gets pixel color from tile data.</summary>
-	template <WsVideoMode mode>
-	__forceinline uint16_t GetPixelColor(uint16_t tileAddr, uint8_t column);
-
 	/// <summary>Gets the current background color.</summary>
 	__forceinline uint16_t GetBgColor() {
 		if (_state.Mode == WsVideoMode::Monochrome) {
@@ -172,7 +171,7 @@ public:
 		}
 
 		if (_state.Cycle < 224) {
-			if (_state.Scanline < WsConstants::ScreenHeight + 1 && _state.Scanline > 0) {
+			if (_state.Scanline < WsConstants::ScreenHeight + 1 && _state.Scanline > 0 && !_skipRender) {
 				// Palette lookup + output pixel on the first 224 cycles
 				uint8_t rowIndex = (_state.Scanline & 0x01) ^ 1;
 				PixelData& data = _rowData[rowIndex][_state.Cycle];
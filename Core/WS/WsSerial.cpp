@@ -1,19 +1,25 @@
 #include "pch.h"
 #include "WS/WsSerial.h"
 #include "WS/WsConsole.h"
+#include "Shared/Emulator.h"
+#include "Shared/LinkCable.h"
 #include "Utilities/Serializer.h"
 
-WsSerial::WsSerial(WsConsole* console) {
+WsSerial::WsSerial(Emulator* emu, WsConsole* console) {
+	_emu = emu;
 	_console = console;
 }
 
 uint8_t WsSerial::Read(uint16_t port) {
 	switch (port) {
 		case 0xB1:
+			ReceiveLinkCableData();
+			_state.HasReceiveData = false;
 			return _state.ReceiveBuffer;
 
 		case 0xB3:
 			UpdateState();
+			ReceiveLinkCableData();
 			return (
 			    (_state.HasReceiveData ? 0x01 : 0) |
 			    (_state.ReceiveOverflow ? 0x02 : 0) |
@@ -51,6 +57,32 @@ void WsSerial::UpdateState() {
 		uint64_t cyclesElapsed = _console->GetMasterClock() - _state.SendClock;
 		if (cyclesElapsed > cyclesPerByte) {
 			_state.HasSendData = false;
+
+			LinkCablePort* port = _emu->GetLinkCablePort();
+			if (port && port->IsPeerAttached()) {
+				port->Send({_console->GetMasterClock(), 0, LinkCableMessageType::Byte, _state.SendBuffer});
+			}
+		}
+	}
+}
+
+void WsSerial::ReceiveLinkCableData() {
+	LinkCablePort* port = _emu->GetLinkCablePort();
+	if (!port) {
+		return;
+	}
+
+	// Bytes received while the port is disabled are lost, and so are the ones received before the previous one was read
+	LinkCableMessage msg;
+	while (port->TryReceive(msg)) {
+		if (msg.Type != LinkCableMessageType::Byte || !_state.Enabled) {
+			continue;
+		}
+		if (_state.HasReceiveData) {
+			_state.ReceiveOverflow = true;
+		} else {
+			_state.ReceiveBuffer = (uint8_t)msg.Data;
+			_state.HasReceiveData = true;
 		}
 	}
 }
@@ -62,6 +94,11 @@ bool WsSerial::HasSendIrq() {
 	return _state.Enabled && !_state.HasSendData;
 }
 
+bool WsSerial::HasReceiveIrq() {
+	ReceiveLinkCableData();
+	return _state.Enabled && _state.HasReceiveData;
+}
+
 void WsSerial::Serialize(Serializer& s) {
 	SV(_state.Enabled);
 	SV(_state.HighSpeed);
@@ -3,17 +3,20 @@
 #include "WS/WsTypes.h"
 #include "Utilities/ISerializable.h"
 
+class Emulator;
 class WsConsole;
 
 class WsSerial final : public ISerializable {
 private:
 	WsSerialState _state = {};
+	Emulator* _emu = nullptr;
 	WsConsole* _console = nullptr;
 
 	void UpdateState();
+	void ReceiveLinkCableData();
 
 public:
-	WsSerial(WsConsole* console);
+	WsSerial(Emulator* emu, WsConsole* console);
 
 	WsSerialState& GetState() { return _state; }
 
@@ -21,6 +24,7 @@ public:
 	void Write(uint16_t port, uint8_t value);
 
 	bool HasSendIrq();
+	bool HasReceiveIrq();
 
 	void Serialize(Serializer& s) override;
 };
\ No newline at end of file
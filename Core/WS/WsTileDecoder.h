@@ -0,0 +1,68 @@
+#pragma once
+#include "pch.h"
+#include <array>
+#include "WS/WsTypes.h"
+
+/// <summary>Lookup table that spreads the 8 bits of a bitplane byte to bit 0 of 8 pixel bytes</summary>
+constexpr std::array<uint64_t, 256> BuildWsTileSpreadTable(bool mirrored) {
+	std::array<uint64_t, 256> table = {};
+	for (uint32_t value = 0; value < 256; value++) {
+		for (uint32_t pixel = 0; pixel < 8; pixel++) {
+			uint32_t bit = mirrored ? pixel : (7 - pixel);
+			table[value] |= (uint64_t)((value >> bit) & 0x01) << (pixel * 8);
+		}
+	}
+	return table;
+}
+
+/// <summary>Lookup table that splits a packed 4bpp byte into 2 pixel bytes (the high nibble is the leftmost pixel)</summary>
+constexpr std::array<uint16_t, 256> BuildWsTileNibbleTable(bool mirrored) {
+	std::array<uint16_t, 256> table = {};
+	for (uint32_t value = 0; value < 256; value++) {
+		table[value] = mirrored ? (uint16_t)((value & 0x0F) | ((value >> 4) << 8)) : (uint16_t)((value >> 4) | ((value & 0x0F) << 8));
+	}
+	return table;
+}
+
+/// <summary>
+/// Decodes WonderSwan tile rows (2bpp/4bpp planar, 4bpp packed) 8 pixels at a time.
+/// </summary>
+/// <remarks>
+/// Planar bytes are spread to 1 bit per pixel with a lookup table (one lookup, shift and OR per bitplane),
+/// packed bytes are split into their 2 nibbles with a lookup table. The colors are returned as the bytes of
+/// a uint64_t, leftmost pixel in the lowest byte (a row of color 0 pixels is 0).
+/// </remarks>
+class WsTileDecoder {
+private:
+	static constexpr std::array<uint64_t, 256> _spreadBits = BuildWsTileSpreadTable(false);
+	static constexpr std::array<uint64_t, 256> _spreadBitsMirrored = BuildWsTileSpreadTable(true);
+	static constexpr std::array<uint16_t, 256> _nibbles = BuildWsTileNibbleTable(false);
+	static constexpr std::array<uint16_t, 256> _nibblesMirrored = BuildWsTileNibbleTable(true);
+
+public:
+	/// <summary>Decodes the 8 pixels of a tile row (color indexes).</summary>
+	/// <param name="tileRow">Tile data for the row (2 bytes for 2bpp modes, 4 bytes for 4bpp modes)</param>
+	/// <param name="hMirror">Tile is flipped horizontally</param>
+	template <WsVideoMode mode>
+	[[nodiscard]] static __forceinline uint64_t DecodeRow(const uint8_t* tileRow, bool hMirror) {
+		if constexpr (mode == WsVideoMode::Color4bppPacked) {
+			if (hMirror) {
+				return (uint64_t)_nibblesMirrored[tileRow[3]] | ((uint64_t)_nibblesMirrored[tileRow[2]] << 16) | ((uint64_t)_nibblesMirrored[tileRow[1]] << 32) | ((uint64_t)_nibblesMirrored[tileRow[0]] << 48);
+			} else {
+				return (uint64_t)_nibbles[tileRow[0]] | ((uint64_t)_nibbles[tileRow[1]] << 16) | ((uint64_t)_nibbles[tileRow[2]] << 32) | ((uint64_t)_nibbles[tileRow[3]] << 48);
+			}
+		} else {
+			const uint64_t* spread = hMirror ? _spreadBitsMirrored.data() : _spreadBits.data();
+			uint64_t row = spread[tileRow[0]] | (spread[tileRow[1]] << 1);
+			if constexpr (mode == WsVideoMode::Color4bpp) {
+				row |= (spread[tileRow[2]] << 2) | (spread[tileRow[3]] << 3);
+			}
+			return row;
+		}
+	}
+
+	/// <summary>Color index of one pixel of a row returned by DecodeRow (0 = leftmost)</summary>
+	[[nodiscard]] static __forceinline uint8_t GetPixel(uint64_t row, uint32_t pixel) {
+		return (uint8_t)(row >> (pixel * 8));
+	}
+};
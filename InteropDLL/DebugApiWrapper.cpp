@@ -8,6 +8,7 @@
 #include "Core/Debugger/CdlManager.h"
 #include "Core/Debugger/Disassembler.h"
 #include "Core/Debugger/DisassemblySearch.h"
+#include "Core/Debugger/MemorySearch.h"
 #include "Core/Debugger/DebugTypes.h"
 #include "Core/Debugger/Breakpoint.h"
 #include "Core/Debugger/BreakpointManager.h"
@@ -72,6 +73,23 @@ DllExport bool __stdcall IsLightweightCdlActive() {
 	return _emu->IsLightweightCdlActive();
 }
 
+DllExport bool __stdcall ExportLightweightCdl(const char* path) {
+	return _emu->ExportLightweightCdl(path);
+}
+
+DllExport bool __stdcall MergeLightweightCdl(const char* path) {
+	return _emu->MergeLightweightCdl(path);
+}
+
+// Memory access heatmap (no debugger overhead)
+DllExport bool __stdcall StartMemoryHeatmap(const char* path) {
+	return _emu->StartMemoryHeatmap(path);
+}
+
+DllExport void __stdcall StopMemoryHeatmap() {
+	_emu->StopMemoryHeatmap();
+}
+
 DllExport bool __stdcall IsDebuggerRunning() {
 	return _emu->GetDebugger().GetDebugger() != nullptr;
 }
@@ -110,11 +128,18 @@ DllExport void __stdcall ClearExecutionTrace() {
 	WithDebugger(void, ClearExecutionTrace());
 }
 
+DllExport void __stdcall GetDebugSnapshot(DebugSnapshotItem items[], uint32_t itemCount, uint8_t* buffer, uint32_t bufferSize) {
+	for (uint32_t i = 0; i < itemCount; i++) {
+		items[i].Size = 0;
+	}
+	WithDebugger(void, GetSnapshot(items, itemCount, buffer, bufferSize));
+}
+
 DllExport void __stdcall StartLogTraceToFile(const char* filename) {
 	WithDebugger(void, GetTraceLogFileSaver()->StartLogging(filename));
 }
 DllExport void __stdcall StopLogTraceToFile() {
-	WithDebugger(void, GetTraceLogFileSaver()->StopLogging());
+	WithDebugger(void, StopTraceLogToFile());
 }
 
 DllExport void __stdcall SetBreakpoints(Breakpoint breakpoints[], uint32_t length) {
@@ -134,6 +159,12 @@ DllExport void __stdcall GetTokenList(CpuType cpuType, char* tokenList) {
 DllExport int64_t __stdcall EvaluateExpression(const char* expression, CpuType cpuType, EvalResultType* resultType, bool useCache) {
 	return WithDebugger(int64_t, EvaluateExpression(expression, cpuType, *resultType, useCache));
 }
+DllExport void __stdcall SetWatchExpressions(CpuType cpuType, char** expressions, uint32_t count) {
+	WithDebugger(void, SetWatchExpressions(cpuType, expressions, count));
+}
+DllExport bool __stdcall EvaluateWatchExpressions(CpuType cpuType, int64_t* values, EvalResultType* resultTypes, uint32_t count) {
+	return WithDebugger(bool, EvaluateWatchExpressions(cpuType, values, resultTypes, count));
+}
 
 DllExport void __stdcall GetCallstack(CpuType cpuType, StackFrameInfo* callstackArray, uint32_t& callstackSize) {
 	callstackSize = 0;
@@ -149,6 +180,10 @@ DllExport void __stdcall ResetProfiler(CpuType cpuType) {
 	WithToolVoid(GetCallstackManager(cpuType), GetProfiler()->Reset());
 }
 
+DllExport void __stdcall SetProfilerBackgroundMode(CpuType cpuType, bool enabled) {
+	WithToolVoid(GetCallstackManager(cpuType), GetProfiler()->SetBackgroundMode(enabled));
+}
+
 DllExport void __stdcall GetConsoleState(BaseState& state, ConsoleType consoleType) {
 	WithDebugger(void, GetConsoleState(state, consoleType));
 }
@@ -200,6 +235,30 @@ DllExport uint32_t __stdcall GetMemorySize(MemoryType type) {
 DllExport void __stdcall GetMemoryState(MemoryType type, uint8_t* buffer) {
 	WithDebugger(void, GetMemoryDumper()->GetMemoryState(type, buffer));
 }
+DllExport void __stdcall MemorySearchReset(MemoryType type) {
+	WithDebugger(void, GetMemorySearch()->Reset(type));
+}
+DllExport void __stdcall MemorySearchRefresh() {
+	WithDebugger(void, GetMemorySearch()->Refresh());
+}
+DllExport uint32_t __stdcall MemorySearchAddFilter(MemorySearchFilter filter) {
+	return WithDebugger(uint32_t, GetMemorySearch()->AddFilter(filter));
+}
+DllExport bool __stdcall MemorySearchUndo() {
+	return WithDebugger(bool, GetMemorySearch()->Undo());
+}
+DllExport bool __stdcall MemorySearchCanUndo() {
+	return WithDebugger(bool, GetMemorySearch()->CanUndo());
+}
+DllExport uint32_t __stdcall GetMemorySearchResultCount() {
+	return WithDebugger(uint32_t, GetMemorySearch()->GetResultCount());
+}
+DllExport uint32_t __stdcall GetMemorySearchResults(uint32_t start, uint32_t* results, uint32_t maxCount) {
+	return WithDebugger(uint32_t, GetMemorySearch()->GetResults(start, results, maxCount));
+}
+DllExport uint32_t __stdcall GetMemorySearchSnapshot(MemorySearchSnapshot type, uint8_t* buffer, uint32_t size) {
+	return WithDebugger(uint32_t, GetMemorySearch()->GetSnapshot(type, buffer, size));
+}
 DllExport uint8_t __stdcall GetMemoryValue(MemoryType type, uint32_t address) {
 	return WithDebugger(uint8_t, GetMemoryDumper()->GetMemoryValue(type, address));
 }
@@ -229,6 +288,9 @@ DllExport AddressInfo __stdcall GetRelativeAddress(AddressInfo absAddress, CpuTy
 DllExport void __stdcall SetLabel(uint32_t address, MemoryType memType, char* label, char* comment) {
 	WithDebugger(void, GetLabelManager()->SetLabel(address, memType, label, comment));
 }
+DllExport void __stdcall SetLabels(uint32_t count, uint32_t* addresses, MemoryType* memTypes, char** labels, char** comments) {
+	WithDebugger(void, GetLabelManager()->SetLabels(count, addresses, memTypes, labels, comments));
+}
 DllExport void __stdcall ClearLabels() {
 	WithDebugger(void, GetLabelManager()->ClearLabels());
 }
@@ -243,6 +305,9 @@ DllExport void __stdcall GetMemoryAccessCounts(uint32_t offset, uint32_t length,
 DllExport CdlStatistics __stdcall GetCdlStatistics(MemoryType memoryType) {
 	return WithDebugger(CdlStatistics, GetCdlManager()->GetCdlStatistics(memoryType));
 }
+DllExport uint32_t __stdcall GetCdlChangedPages(MemoryType memoryType, uint32_t token, uint32_t pages[], uint32_t maxCount, uint32_t* nextToken) {
+	return WithDebugger(uint32_t, GetCdlManager()->GetCdlChangedPages(memoryType, token, pages, maxCount, *nextToken));
+}
 DllExport uint32_t __stdcall GetCdlFunctions(MemoryType memoryType, uint32_t functions[], uint32_t maxSize) {
 	return WithDebugger(uint32_t, GetCdlManager()->GetCdlFunctions(memoryType, functions, maxSize));
 }
@@ -265,8 +330,8 @@ DllExport void __stdcall MarkBytesAs(MemoryType memoryType, uint32_t start, uint
 	WithDebugger(void, GetCdlManager()->MarkBytesAs(memoryType, start, end, flags));
 }
 
-DllExport void __stdcall GetTileView(CpuType cpuType, GetTileViewOptions options, uint8_t* source, uint32_t srcSize, uint32_t* colors, uint32_t* buffer) {
-	WithToolVoid(GetPpuTools(cpuType), GetTileView(options, source, srcSize, colors, buffer));
+DllExport void __stdcall GetTileView(CpuType cpuType, GetTileViewOptions options, uint8_t* source, uint32_t srcSize, uint32_t* colors, uint32_t colorCount, uint32_t* buffer) {
+	WithToolVoid(GetPpuTools(cpuType), GetTileView(options, source, srcSize, colors, colorCount, buffer));
 }
 
 DllExport void __stdcall GetPpuToolsState(CpuType cpuType, BaseState& state) {
@@ -344,6 +409,14 @@ DllExport void __stdcall GetScriptLog(int32_t scriptId, char* outScriptLog, uint
 	StringUtilities::CopyToBuffer(log, outScriptLog, maxLength);
 }
 
+DllExport uint32_t __stdcall GetScriptCallbackProfiles(int32_t scriptId, ScriptCallbackProfile* profiles, uint32_t maxCount) {
+	return WithTool(uint32_t, GetScriptManager(), GetScriptCallbackProfiles(scriptId, profiles, maxCount));
+}
+
+DllExport ScriptProfileSummary __stdcall GetScriptProfileSummary(int32_t scriptId) {
+	return WithTool(ScriptProfileSummary, GetScriptManager(), GetScriptProfileSummary(scriptId));
+}
+
 DllExport uint32_t __stdcall AssembleCode(CpuType cpuType, char* code, uint32_t startAddress, int16_t* assembledOutput) {
 	return WithTool(uint32_t, GetAssembler(cpuType), AssembleCode(code, startAddress, assembledOutput));
 }
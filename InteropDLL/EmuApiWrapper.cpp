@@ -6,19 +6,29 @@
 #include "Core/Shared/SystemActionManager.h"
 #include "Core/Shared/MessageManager.h"
 #include "Core/Shared/SaveStateManager.h"
+#include "Core/Shared/GreenzoneManager.h"
+#include "Core/Shared/BranchExplorer.h"
+#include "Core/Shared/FrameProfiler.h"
+#include "Core/Shared/FrameLimiter.h"
+#include "Core/Shared/MemoryUsageRegistry.h"
+#include "Core/Shared/CompressedDiscImage.h"
 #include <sstream>
 #include "Core/Shared/BatteryManager.h"
 #include "Core/Shared/Interfaces/INotificationListener.h"
 #include "Core/Shared/KeyManager.h"
 #include "Core/Shared/ShortcutKeyHandler.h"
 #include "Core/Shared/TimingInfo.h"
+#include "Core/Shared/Audio/SoundMixer.h"
 #include "Core/Shared/CheatManager.h"
 #include "Core/Shared/DebuggerRequest.h"
 #include "Core/Netplay/GameClient.h"
 #include "Core/Netplay/GameServer.h"
 #include "Utilities/ArchiveReader.h"
 #include "Utilities/FolderUtilities.h"
+#include "Utilities/Patches/PatchedRomCache.h"
 #include "Utilities/StringUtilities.h"
+#include "Utilities/SimpleLock.h"
+#include "Utilities/magic_enum.hpp"
 #include "InteropNotificationListeners.h"
 
 #ifdef _WIN32
@@ -52,6 +62,7 @@ static void* _viewerHandle = nullptr;
 static constexpr const char* _buildDateTime = __DATE__ ", " __TIME__;
 
 static InteropNotificationListeners _listeners;
+static unique_ptr<BranchExplorer> _branchExplorer;
 
 struct InteropRomInfo {
 	char RomPath[2000];
@@ -82,6 +93,10 @@ DllExport void __stdcall InitDll() {
 
 DllExport void __stdcall InitializeEmu(const char* homeFolder, void* windowHandle, void* viewerHandle, bool softwareRenderer, bool noAudio, bool noVideo, bool noInput) {
 	FolderUtilities::SetHomeFolder(homeFolder);
+	PatchedRomCache::SetFolder(FolderUtilities::GetPatchCacheFolder());
+
+	// No video output: don't decode/render frames nobody will see
+	_emu->SetHeadless(noVideo);
 
 	if (windowHandle != nullptr && viewerHandle != nullptr) {
 		_windowHandle = windowHandle;
@@ -168,6 +183,10 @@ DllExport TimingInfo __stdcall GetTimingInfo(CpuType cpuType) {
 	return _emu->GetTimingInfo(cpuType);
 }
 
+DllExport AudioStatistics __stdcall GetAudioStatistics() {
+	return _emu->GetSoundMixer()->GetStatistics();
+}
+
 DllExport void __stdcall TakeScreenshot() {
 	_emu->GetVideoDecoder()->TakeScreenshot();
 }
@@ -188,6 +207,11 @@ DllExport void __stdcall GetArchiveRomList(char* filename, char* outBuffer, uint
 	StringUtilities::CopyToBuffer(out.str(), outBuffer, maxLength);
 }
 
+DllExport bool __stdcall CompressDiscImage(char* cueFile, char* outFile) {
+	VirtualFile cue = string(cueFile);
+	return CompressedDiscImage::Create(cue, outFile);
+}
+
 DllExport bool __stdcall IsRunning() {
 	return _emu->IsRunning();
 }
@@ -218,6 +242,8 @@ DllExport bool __stdcall IsPaused() {
 }
 
 DllExport void __stdcall Release() {
+	_branchExplorer.reset();
+
 	if (_emu) {
 		_emu->Stop(true);
 		_emu->Release();
@@ -233,6 +259,10 @@ DllExport INotificationListener* __stdcall RegisterNotificationCallback(Notifica
 	return _listeners.RegisterNotificationCallback(callback, _emu.get());
 }
 
+DllExport INotificationListener* __stdcall RegisterQueuedNotificationCallback(NotificationListenerCallback callback) {
+	return _listeners.RegisterNotificationCallback(callback, _emu.get(), NotificationDelivery::Queued);
+}
+
 DllExport void __stdcall UnregisterNotificationCallback(INotificationListener* listener) {
 	_listeners.UnregisterNotificationCallback(listener);
 }
@@ -338,6 +368,95 @@ DllExport bool __stdcall LoadStateFromMemory(uint8_t* data, int32_t size) {
 	return _emu->GetSaveStateManager()->LoadState(stream);
 }
 
+// ========== TAS Greenzone API ==========
+
+DllExport void __stdcall SetGreenzoneOptions(GreenzoneOptions options) {
+	auto lock = _emu->AcquireLock();
+	_emu->GetGreenzoneManager()->SetOptions(options);
+}
+
+DllExport void __stdcall GreenzoneSeek(uint32_t frame) {
+	// Processed by the emulation thread (also while paused), GreenzoneInfo::SeekPending tells when it's done
+	_emu->GetGreenzoneManager()->RequestSeek(frame);
+}
+
+DllExport void __stdcall GreenzoneInvalidate(uint32_t firstChangedFrame) {
+	auto lock = _emu->AcquireLock();
+	_emu->GetGreenzoneManager()->Invalidate(firstChangedFrame);
+}
+
+DllExport void __stdcall GreenzoneClear() {
+	auto lock = _emu->AcquireLock();
+	_emu->GetGreenzoneManager()->Clear();
+}
+
+DllExport void __stdcall GetGreenzoneInfo(GreenzoneInfo& info) {
+	auto lock = _emu->AcquireLock();
+	info = _emu->GetGreenzoneManager()->GetInfo();
+}
+
+// ========== Branch Exploration API ==========
+
+DllExport bool __stdcall BranchExplorerInitialize(uint32_t workerCount) {
+	if (!_branchExplorer) {
+		_branchExplorer = std::make_unique<BranchExplorer>();
+	}
+	return _branchExplorer->Initialize(_emu.get(), workerCount);
+}
+
+DllExport uint32_t __stdcall BranchExplorerRun(char** sequences, uint32_t sequenceCount, BranchWatch* watches, uint32_t watchCount, uint32_t extraFrames, uint8_t* outValues, uint64_t* outHashes) {
+	if (!_branchExplorer) {
+		return 0;
+	}
+
+	vector<string> branches(sequences, sequences + sequenceCount);
+	vector<BranchWatch> watchList(watches, watches + watchCount);
+	vector<BranchResult> results = _branchExplorer->Run(branches, watchList, extraFrames);
+
+	// outValues receives the watched values of every branch back to back
+	for (size_t i = 0; i < results.size(); i++) {
+		if (outValues) {
+			memcpy(outValues, results[i].Values.data(), results[i].Values.size());
+			outValues += results[i].Values.size();
+		}
+		if (outHashes) {
+			outHashes[i] = results[i].Hash;
+		}
+	}
+	return (uint32_t)results.size();
+}
+
+DllExport void __stdcall BranchExplorerRelease() {
+	_branchExplorer.reset();
+}
+
+// ========== Frame Profiler API ==========
+
+DllExport void __stdcall SetFrameProfilerEnabled(bool enabled) {
+	// Also enabled while the debug stats overlay is visible, takes effect at the end of the next frame
+	_emu->GetFrameProfiler()->SetRequested(enabled);
+}
+
+DllExport void __stdcall GetFrameProfilerStats(FrameProfilerStats& stats) {
+	stats = _emu->GetFrameProfiler()->GetStats();
+}
+
+DllExport void __stdcall GetFramePacingStats(FramePacingStats& stats) {
+	stats = _emu->GetFrameLimiter()->GetStats();
+}
+
+DllExport uint32_t __stdcall GetMemoryUsage(MemoryUsageEntry* outEntries, uint32_t maxCount) {
+	vector<MemoryUsageEntry> entries;
+	{
+		auto lock = _emu->AcquireLock();
+		entries = _emu->GetMemoryUsageRegistry()->GetFlatUsage();
+	}
+
+	uint32_t count = std::min<uint32_t>(static_cast<uint32_t>(entries.size()), maxCount);
+	memcpy(outEntries, entries.data(), count * sizeof(MemoryUsageEntry));
+	return count;
+}
+
 DllExport void __stdcall LoadRecentGame(char* filepath, bool resetGame) {
 	_emu->GetSaveStateManager()->LoadRecentGame(filepath, resetGame);
 }
@@ -458,7 +577,12 @@ public:
 	void RefreshState() {}
 	void UpdateDevices() {}
 	bool IsMouseButtonPressed(MouseButton button) { return false; }
-	bool IsKeyPressed(uint16_t keyCode) { return keyCode == 10 && (_emu->GetFrameCount() % 7) <= 3; }
+
+	// Toggled on/off every 50ms (wall clock, so it works the same for every emulator instance running in parallel)
+	bool IsKeyPressed(uint16_t keyCode) {
+		int64_t ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		return keyCode == 10 && (ms / 50) % 2 == 0;
+	}
 
 	vector<uint16_t> GetPressedKeys() { return {}; }
 	string GetKeyName(uint16_t keyCode) { return ""; }
@@ -469,6 +593,30 @@ public:
 	void SetDisabled(bool disabled) {}
 };
 
+static void PgoConfigureInput(Emulator* emu) {
+	// Map key #10 to the start button for all consoles - the key is toggled on/off by PgoKeyManager
+	NesConfig& nesCfg = emu->GetSettings()->GetNesConfig();
+	nesCfg.Port1.Type = ControllerType::NesController;
+	nesCfg.Port1.Keys.Mapping1.Start = 10;
+
+	SnesConfig& snesCfg = emu->GetSettings()->GetSnesConfig();
+	snesCfg.Port1.Type = ControllerType::SnesController;
+	snesCfg.Port1.Keys.Mapping1.Start = 10;
+
+	GameboyConfig& gbCfg = emu->GetSettings()->GetGameboyConfig();
+	gbCfg.Model = GameboyModel::GameboyColor;
+	gbCfg.Controller.Keys.Mapping1.Start = 10;
+
+	PcEngineConfig& pceCfg = emu->GetSettings()->GetPcEngineConfig();
+	pceCfg.Port1.Type = ControllerType::PceController;
+	pceCfg.Port1.Keys.Mapping1.Start = 10;
+
+	emu->GetSettings()->GetGbaConfig().Controller.Keys.Mapping1.Start = 10;
+	emu->GetSettings()->GetSmsConfig().Port1.Keys.Mapping1.Start = 10;
+	emu->GetSettings()->GetWsConfig().ControllerHorizontal.Keys.Mapping1.Start = 10;
+	emu->GetSettings()->GetLynxConfig().Controller.Keys.Mapping1.Start = 10;
+}
+
 DllExport void __stdcall PgoRunTest(vector<string> testRoms, bool enableDebugger) {
 	FolderUtilities::SetHomeFolder("../PGONexenHome");
 	PgoKeyManager pgoKeyManager;
@@ -479,23 +627,7 @@ DllExport void __stdcall PgoRunTest(vector<string> testRoms, bool enableDebugger
 
 		KeyManager::SetSettings(_emu->GetSettings());
 		_emu->Initialize();
-
-		// Map key #10 to the start button for all consoles - this key is toggled on/off every 4 frames
-		NesConfig& nesCfg = _emu->GetSettings()->GetNesConfig();
-		nesCfg.Port1.Type = ControllerType::NesController;
-		nesCfg.Port1.Keys.Mapping1.Start = 10;
-
-		SnesConfig& snesCfg = _emu->GetSettings()->GetSnesConfig();
-		snesCfg.Port1.Type = ControllerType::SnesController;
-		snesCfg.Port1.Keys.Mapping1.Start = 10;
-
-		GameboyConfig& gbCfg = _emu->GetSettings()->GetGameboyConfig();
-		gbCfg.Model = GameboyModel::GameboyColor;
-		gbCfg.Controller.Keys.Mapping1.Start = 10;
-
-		PcEngineConfig& pceCfg = _emu->GetSettings()->GetPcEngineConfig();
-		pceCfg.Port1.Type = ControllerType::PceController;
-		pceCfg.Port1.Keys.Mapping1.Start = 10;
+		PgoConfigureInput(_emu.get());
 
 		_emu->GetSettings()->SetFlag(EmulationFlags::MaximumSpeed);
 		(void)_emu->LoadRom((VirtualFile)testRoms[i], VirtualFile());
@@ -512,4 +644,123 @@ DllExport void __stdcall PgoRunTest(vector<string> testRoms, bool enableDebugger
 		_emu->Release();
 	}
 }
+
+/// <summary>Settings combination used to train the PGO build (see PgoRunWorkloads)</summary>
+struct PgoWorkload {
+	const char* Name;
+	VideoFilterType Filter;
+	double ScanlineIntensity;
+	uint32_t RunAheadFrames;
+	bool Rewind;
+	bool AudioEffects;
+	bool Debugger;
+};
+
+// Each game runs once per workload: together they cover the code paths of the common configurations
+// (filters, run-ahead's state save/load, rewind's compression, audio effects, debugger hooks)
+static constexpr PgoWorkload _pgoWorkloads[] = {
+	{"default", VideoFilterType::None, 0, 0, true, false, false},
+	{"ntsc+runahead", VideoFilterType::NtscBlargg, 0, 1, false, false, false},
+	{"xbrz+scanlines+audiofx", VideoFilterType::xBRZ3x, 0.3, 0, true, true, false},
+	{"hq2x+runahead2", VideoFilterType::HQ2x, 0, 2, false, false, false},
+	{"debugger", VideoFilterType::None, 0, 0, true, false, true},
+};
+
+DllExport void __stdcall PgoRunWorkloads(vector<string> testRoms, uint32_t threadCount, uint32_t durationMs) {
+	FolderUtilities::SetHomeFolder("../PGONexenHome");
+	PgoKeyManager pgoKeyManager;
+	KeyManager::RegisterKeyManager(&pgoKeyManager);
+	KeyManager::SetSettings(_emu->GetSettings());
+
+	struct Job {
+		string Rom;
+		const PgoWorkload* Workload;
+		bool Loaded = false;
+		ConsoleType Console = ConsoleType::Snes;
+		uint32_t FrameCount = 0;
+	};
+
+	vector<Job> jobs;
+	for (const string& rom : testRoms) {
+		for (const PgoWorkload& workload : _pgoWorkloads) {
+			jobs.push_back({rom, &workload});
+		}
+	}
+
+	// Each job gets its own headless emulator, workers pull the next job from a shared index
+	// (a single process, so the profile counters of all the jobs end up in the same profile)
+	if (threadCount == 0) {
+		threadCount = std::max(1u, std::thread::hardware_concurrency());
+	}
+	threadCount = std::min<uint32_t>(threadCount, (uint32_t)jobs.size());
+
+	SimpleLock logLock;
+	atomic<uint32_t> nextJob = 0;
+	auto worker = [&]() {
+		uint32_t i;
+		while ((i = nextJob++) < jobs.size()) {
+			Job& job = jobs[i];
+			const PgoWorkload& workload = *job.Workload;
+
+			unique_ptr<Emulator> emu(new Emulator());
+			emu->Initialize(false);
+			PgoConfigureInput(emu.get());
+
+			EmuSettings* settings = emu->GetSettings();
+			settings->GetVideoConfig().VideoFilter = workload.Filter;
+			settings->GetVideoConfig().ScanlineIntensity = workload.ScanlineIntensity;
+			settings->GetEmulationConfig().RunAheadFrames = workload.RunAheadFrames;
+			settings->GetPreferences().RewindBufferSize = workload.Rewind ? 300 : 0;
+			settings->GetAudioConfig().ReverbEnabled = workload.AudioEffects;
+			settings->GetAudioConfig().CrossFeedEnabled = workload.AudioEffects;
+			settings->GetAudioConfig().EnableEqualizer = workload.AudioEffects;
+			settings->SetFlag(EmulationFlags::MaximumSpeed);
+
+			job.Loaded = emu->LoadRom((VirtualFile)job.Rom, VirtualFile());
+			if (job.Loaded) {
+				job.Console = emu->GetConsoleType();
+				if (workload.Debugger) {
+					// turn on debugger to profile the debugger's code too
+					emu->GetDebugger(true);
+				}
+				std::this_thread::sleep_for(std::chrono::milliseconds(durationMs));
+				job.FrameCount = emu->GetFrameCount();
+			}
+
+			emu->Stop(false);
+			emu->Release();
+
+			auto lock = logLock.AcquireSafe();
+			std::cout << "[" << workload.Name << "] " << job.Rom << ": " << (job.Loaded ? std::to_string(job.FrameCount) + " frames" : "could not load") << std::endl;
+		}
+	};
+
+	vector<std::thread> workers;
+	workers.reserve(threadCount);
+	for (uint32_t i = 0; i < threadCount; i++) {
+		workers.emplace_back(worker);
+	}
+	for (std::thread& t : workers) {
+		t.join();
+	}
+
+	// Coverage summary: consoles without any game aren't trained at all
+	std::cout << std::endl << "Training coverage:" << std::endl;
+	magic_enum::enum_for_each<ConsoleType>([&](ConsoleType console) {
+		uint32_t gameCount = 0;
+		uint64_t frameCount = 0;
+		for (Job& job : jobs) {
+			if (job.Loaded && job.Console == console) {
+				gameCount++;
+				frameCount += job.FrameCount;
+			}
+		}
+		std::cout << "  " << magic_enum::enum_name(console) << ": ";
+		if (gameCount > 0) {
+			std::cout << gameCount << " runs, " << frameCount << " frames" << std::endl;
+		} else {
+			std::cout << "NOT TRAINED (no game)" << std::endl;
+		}
+	});
+}
 }
@@ -43,6 +43,7 @@ DllExport void __stdcall DisableAllKeys(bool disabled) {
 DllExport void __stdcall SetKeyState(uint16_t scanCode, bool state) {
 	if (_keyManager) {
 		if (_keyManager->SetKeyState(scanCode, state)) {
+			KeyManager::OnInputEvent();
 			_emu->GetShortcutKeyHandler()->ProcessKeys();
 		}
 	}
@@ -74,6 +75,10 @@ DllExport void __stdcall ResetLagCounter() {
 	_emu->ResetLagCounter();
 }
 
+DllExport LatencyPercentiles __stdcall GetInputLatency() {
+	return KeyManager::GetInputLatency();
+}
+
 DllExport SystemMouseState __stdcall GetSystemMouseState(void* rendererHandle) {
 	if (_mouseManager) {
 		return _mouseManager->GetSystemMouseState(rendererHandle);
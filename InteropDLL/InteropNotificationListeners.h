@@ -13,15 +13,16 @@ class InteropNotificationListeners {
 	vector<shared_ptr<INotificationListener>> _externalNotificationListeners;
 
 public:
-	INotificationListener* RegisterNotificationCallback(NotificationListenerCallback callback, Emulator* emu) {
+	INotificationListener* RegisterNotificationCallback(NotificationListenerCallback callback, Emulator* emu, NotificationDelivery delivery = NotificationDelivery::Synchronous) {
 		auto lock = _externalNotificationListenerLock.AcquireSafe();
 		auto listener = shared_ptr<INotificationListener>(new InteropNotificationListener(callback));
 		_externalNotificationListeners.push_back(listener);
-		emu->GetNotificationManager()->RegisterNotificationListener(listener);
+		emu->GetNotificationManager()->RegisterNotificationListener(listener, delivery);
 		return listener.get();
 	}
 
 	void UnregisterNotificationCallback(INotificationListener* listener) {
+		// Releasing the last reference is enough (the emulator may already be gone), the manager drops expired listeners
 		auto lock = _externalNotificationListenerLock.AcquireSafe();
 		_externalNotificationListeners.erase(
 		    std::remove_if(
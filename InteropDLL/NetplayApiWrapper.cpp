@@ -8,8 +8,8 @@
 extern unique_ptr<Emulator> _emu;
 
 extern "C" {
-DllExport void __stdcall StartServer(uint16_t port, char* password) {
-	_emu->GetGameServer()->StartServer(port, password);
+DllExport void __stdcall StartServer(uint16_t port, char* password, uint32_t rollbackFrames, bool useUdp) {
+	_emu->GetGameServer()->StartServer(port, password, rollbackFrames, useUdp);
 }
 DllExport void __stdcall StopServer() {
 	_emu->GetGameServer()->StopServer();
@@ -2,6 +2,7 @@
 #include "Core/Shared/Emulator.h"
 #include "Core/Shared/Video/VideoRenderer.h"
 #include "Core/Shared/Audio/SoundMixer.h"
+#include "Core/Shared/Audio/AudioTrackExporter.h"
 #include "Core/Shared/Movies/MovieManager.h"
 
 extern unique_ptr<Emulator> _emu;
@@ -27,6 +28,21 @@ DllExport bool __stdcall WaveIsRecording() {
 	return _emu->GetSoundMixer()->IsRecording();
 }
 
+DllExport bool __stdcall SharedMemoryExportStart(char* name) {
+	return _emu->StartSharedMemoryExport(name);
+}
+DllExport void __stdcall SharedMemoryExportStop() {
+	_emu->StopSharedMemoryExport();
+}
+DllExport bool __stdcall SharedMemoryExportIsActive() {
+	return _emu->IsSharedMemoryExportActive();
+}
+
+DllExport void __stdcall ExportAudioTracks(char** filenames, uint32_t* trackNumbers, char** outputFiles, uint32_t count, AudioTrackExportOptions options, AudioTrackExportResult* results, uint32_t threadCount) {
+	// Runs on separate emulator instances, the main instance isn't affected
+	AudioTrackExporter::ExportTracks(filenames, trackNumbers, outputFiles, count, options, results, threadCount);
+}
+
 DllExport void __stdcall MoviePlay(char* filename) {
 	_emu->GetMovieManager()->Play(string(filename));
 }
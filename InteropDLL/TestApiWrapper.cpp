@@ -6,22 +6,53 @@
 extern unique_ptr<Emulator> _emu;
 shared_ptr<RecordedRomTest> _recordedRomTest;
 
+static RomTestResult RunBackgroundTest(const string& filename) {
+	unique_ptr<Emulator> emu(new Emulator());
+	emu->Initialize(false);
+	emu->GetSettings()->SetFlag(EmulationFlags::TestMode);
+	// Tests running in parallel often use the same ROM
+	emu->GetSettings()->SetFlag(EmulationFlags::ShareRomData);
+	shared_ptr<RecordedRomTest> romTest(new RecordedRomTest(emu.get(), true));
+	RomTestResult result = romTest->Run(filename);
+	emu->Release();
+	return result;
+}
+
 extern "C" {
 DllExport RomTestResult __stdcall RunRecordedTest(char* filename, bool inBackground) {
 	if (inBackground) {
-		unique_ptr<Emulator> emu(new Emulator());
-		emu->Initialize(false);
-		emu->GetSettings()->SetFlag(EmulationFlags::TestMode);
-		shared_ptr<RecordedRomTest> romTest(new RecordedRomTest(emu.get(), true));
-		RomTestResult result = romTest->Run(filename);
-		emu->Release();
-		return result;
+		return RunBackgroundTest(filename);
 	} else {
 		shared_ptr<RecordedRomTest> romTest(new RecordedRomTest(_emu.get(), false));
 		return romTest->Run(filename);
 	}
 }
 
+DllExport void __stdcall RunRecordedTests(char** filenames, uint32_t count, RomTestResult* results, uint32_t threadCount) {
+	// Each test gets its own headless emulator instance, workers pull the next test from a shared index
+	if (threadCount == 0) {
+		threadCount = std::max(1u, std::thread::hardware_concurrency());
+	}
+	threadCount = std::min(threadCount, count);
+
+	atomic<uint32_t> nextTest = 0;
+	auto worker = [&]() {
+		uint32_t i;
+		while ((i = nextTest++) < count) {
+			results[i] = RunBackgroundTest(filenames[i]);
+		}
+	};
+
+	vector<std::thread> workers;
+	workers.reserve(threadCount);
+	for (uint32_t i = 0; i < threadCount; i++) {
+		workers.emplace_back(worker);
+	}
+	for (std::thread& t : workers) {
+		t.join();
+	}
+}
+
 DllExport uint64_t __stdcall RunTest(char* filename, uint32_t address, MemoryType memType) {
 	unique_ptr<Emulator> emu(new Emulator());
 	emu->Initialize();
@@ -52,9 +83,9 @@ DllExport uint64_t __stdcall RunTest(char* filename, uint32_t address, MemoryTyp
 	return result;
 }
 
-DllExport void __stdcall RomTestRecord(char* filename, bool reset) {
+DllExport void __stdcall RomTestRecord(char* filename, bool reset, bool useFastHash) {
 	_recordedRomTest = std::make_unique<RecordedRomTest>(_emu.get(), false);
-	_recordedRomTest->Record(filename, reset);
+	_recordedRomTest->Record(filename, reset, useFastHash);
 }
 
 DllExport void __stdcall RomTestStop() {
@@ -1,6 +1,7 @@
 #include "Core/Shared/MessageManager.h"
 #include "Core/Shared/Emulator.h"
 #include "Core/Shared/EmuSettings.h"
+#include "Core/Shared/KeyManager.h"
 #include "LinuxGameController.h"
 
 #include "libevdev/libevdev.h"
@@ -11,6 +12,7 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <fcntl.h>
+#include <sys/eventfd.h>
 #include <iostream>
 
 std::shared_ptr<LinuxGameController> LinuxGameController::GetController(Emulator* emu, int deviceID, bool logInformation)
@@ -74,6 +76,8 @@ LinuxGameController::LinuxGameController(Emulator* emu, int deviceID, int fileDe
 		_rumbleEffect.reset();
 	}
 
+	_stopFd = eventfd(0, EFD_NONBLOCK);
+
 	_eventThread = std::thread([=]() {
 		int rc;
 		bool calibrate = true;
@@ -82,14 +86,20 @@ LinuxGameController::LinuxGameController(Emulator* emu, int deviceID, int fileDe
 			fd_set readSet;
 			FD_ZERO(&readSet);
 			FD_SET(_fd, &readSet);
+			if(_stopFd >= 0) {
+				FD_SET(_stopFd, &readSet);
+			}
 
-			//Timeout after 0.1 seconds (to allow thread to be terminated quickly)
+			//Sleep until the device sends events (or the destructor signals _stopFd)
+			//Only time out to calibrate after startup, or periodically if the eventfd couldn't be created
 			timeval timeout;
 			timeout.tv_sec = 0;
 			timeout.tv_usec = 100000;
+			bool useTimeout = calibrate || _stopFd < 0;
 
-			rc = select((int)_fd+1, &readSet, nullptr, nullptr, &timeout);
-			if(rc) {
+			rc = select(std::max(_fd, _stopFd) + 1, &readSet, nullptr, nullptr, useTimeout ? &timeout : nullptr);
+			if(rc > 0 && FD_ISSET(_fd, &readSet)) {
+				bool inputChanged = false;
 				do {
 					struct input_event ev;
 					rc = libevdev_next_event(_device, LIBEVDEV_READ_FLAG_NORMAL, &ev);
@@ -97,11 +107,22 @@ LinuxGameController::LinuxGameController(Emulator* emu, int deviceID, int fileDe
 						while (rc == LIBEVDEV_READ_STATUS_SYNC) {
 							rc = libevdev_next_event(_device, LIBEVDEV_READ_FLAG_SYNC, &ev);
 						}
+						inputChanged = true;
 					} else if(rc == LIBEVDEV_READ_STATUS_SUCCESS) {
 						//print_event(&ev);
+						inputChanged |= ev.type == EV_KEY || ev.type == EV_ABS;
 					}
 				} while(rc == LIBEVDEV_READ_STATUS_SYNC || rc == LIBEVDEV_READ_STATUS_SUCCESS);
-			} 
+
+				if(inputChanged) {
+					//Timestamped for the input latency measurements (time until the game polls its controllers)
+					KeyManager::OnInputEvent();
+				}
+			} else if(rc < 0 && errno != EINTR) {
+				rc = -errno;
+			} else {
+				rc = -EAGAIN;
+			}
 			
 			if(rc != LIBEVDEV_READ_STATUS_SYNC && rc != LIBEVDEV_READ_STATUS_SUCCESS && rc != -EAGAIN && rc != EWOULDBLOCK) {
 				//Device was disconnected
@@ -122,8 +143,15 @@ LinuxGameController::LinuxGameController(Emulator* emu, int deviceID, int fileDe
 
 LinuxGameController::~LinuxGameController()
 {
-	_stopFlag = true;	
+	_stopFlag = true;
+	if(_stopFd >= 0) {
+		uint64_t value = 1;
+		(void)write(_stopFd, &value, sizeof(value));
+	}
 	_eventThread.join();
+	if(_stopFd >= 0) {
+		close(_stopFd);
+	}
 
 	libevdev_free(_device);
 	close(_fd);
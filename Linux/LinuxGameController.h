@@ -10,6 +10,7 @@ class LinuxGameController
 {
 private:
 	int _fd = -1;
+	int _stopFd = -1; //eventfd, wakes up the event thread when it needs to stop
 	int _deviceID = -1;
 	libevdev *_device = nullptr;
 	bool _disconnected = false;
@@ -39,6 +39,7 @@ inline std::string ToUtf8(const fs::path& p) {
 
 extern "C" {
 	void __stdcall PgoRunTest(vector<string> testRoms, bool enableDebugger);
+	void __stdcall PgoRunWorkloads(vector<string> testRoms, uint32_t threadCount, uint32_t durationMs);
 }
 
 vector<string> GetFilesInFolder(string rootFolder, std::unordered_set<string> extensions)
@@ -64,6 +65,8 @@ vector<string> GetFilesInFolder(string rootFolder, std::unordered_set<string> ex
 	return files;
 }
 
+// Usage: pgohelper [romFolder] [threadCount] [durationMs]
+// Every game is run once per workload (filters, run-ahead, rewind, debugger, etc.), threadCount games at a time (0 = one per core)
 int main(int argc, char* argv[])
 {
 	string romFolder = "../PGOGames";
@@ -71,8 +74,12 @@ int main(int argc, char* argv[])
 		romFolder = argv[1];
 	}
 
-	vector<string> testRoms = GetFilesInFolder(romFolder, { ".sfc", ".gb", ".gbc", ".gbx", ".nes", ".pce", ".cue", ".sms", ".gg", ".sg", ".gba", ".col", ".ws", ".wsc" });
-	PgoRunTest(testRoms, true);
+	uint32_t threadCount = argc >= 3 ? (uint32_t)std::stoul(argv[2]) : 0;
+	uint32_t durationMs = argc >= 4 ? (uint32_t)std::stoul(argv[3]) : 5000;
+
+	vector<string> testRoms = GetFilesInFolder(romFolder, { ".sfc", ".gb", ".gbc", ".gbx", ".nes", ".pce", ".cue", ".sms", ".gg", ".sg", ".gba", ".col", ".ws", ".wsc", ".lnx", ".a26" });
+	std::ranges::sort(testRoms);
+	PgoRunWorkloads(testRoms, threadCount, durationMs);
 	return 0;
 }
 
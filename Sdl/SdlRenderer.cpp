@@ -85,6 +85,8 @@ bool SdlRenderer::Init()
 		}
 	}
 
+	_renderTargetSupported = SDL_RenderTargetSupported(_sdlRenderer) == SDL_TRUE;
+
 	return true;
 }
 
@@ -108,6 +110,16 @@ void SdlRenderer::Cleanup()
 		SDL_DestroyTexture(_sdlTexture);
 		_sdlTexture = nullptr;
 	}
+	if(_scaledTexture) {
+		SDL_DestroyTexture(_scaledTexture);
+		_scaledTexture = nullptr;
+	}
+	if(_overlayTexture) {
+		SDL_DestroyTexture(_overlayTexture);
+		_overlayTexture = nullptr;
+	}
+	_scaledWidth = 0;
+	_scaledHeight = 0;
 	if(_emuHud.Texture) {
 		SDL_DestroyTexture(_emuHud.Texture);
 		_emuHud.Texture = nullptr;
@@ -129,6 +141,11 @@ void SdlRenderer::OnRendererThreadStarted()
 	Reset();
 }
 
+bool SdlRenderer::SupportsGpuPostProcess()
+{
+	return _renderTargetSupported;
+}
+
 void SdlRenderer::Reset()
 {
 	Cleanup();
@@ -186,9 +203,82 @@ void SdlRenderer::UpdateFrame(RenderedFrame& frame)
 	}
 	
 	memcpy(_frameBuffer, frame.FrameBuffer, frame.Width * frame.Height *_bytesPerPixel);
+	_postProcess = frame.PostProcess;
 	_frameChanged = true;	
 }
 
+bool SdlRenderer::UpdateOverlay(const GpuPostProcess& postProcess)
+{
+	if(_overlayTexture && _overlayPostProcess == postProcess) {
+		return true;
+	}
+
+	if(!_overlayTexture) {
+		_overlayTexture = SDL_CreateTexture(_sdlRenderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, _scaledWidth, _scaledHeight);
+		if(!_overlayTexture) {
+			LogSdlError("[SDL] Failed to create post-process overlay texture");
+			return false;
+		}
+		//Multiplies the frame by the overlay's gray levels
+		SDL_SetTextureBlendMode(_overlayTexture, SDL_BLENDMODE_MOD);
+	}
+
+	_overlayBuffer.resize(_scaledWidth * _scaledHeight);
+	postProcess.BuildOverlay(_overlayBuffer.data(), _scaledWidth, _scaledHeight);
+	if(SDL_UpdateTexture(_overlayTexture, nullptr, _overlayBuffer.data(), _scaledWidth * _bytesPerPixel) != 0) {
+		LogSdlError("SDL_UpdateTexture failed (overlay)");
+		return false;
+	}
+	_overlayPostProcess = postProcess;
+	return true;
+}
+
+bool SdlRenderer::ApplyPostProcess(const GpuPostProcess& postProcess)
+{
+	uint32_t width = _frameWidth * postProcess.Scale;
+	uint32_t height = _frameHeight * postProcess.Scale;
+	if(!_scaledTexture || _scaledWidth != width || _scaledHeight != height) {
+		if(_scaledTexture) {
+			SDL_DestroyTexture(_scaledTexture);
+		}
+		if(_overlayTexture) {
+			SDL_DestroyTexture(_overlayTexture);
+			_overlayTexture = nullptr;
+		}
+
+		//Created with the current scale quality hint, used for the final stretch to the window
+		_scaledTexture = SDL_CreateTexture(_sdlRenderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, width, height);
+		if(!_scaledTexture) {
+			LogSdlError("[SDL] Failed to create post-process render target");
+			_scaledWidth = 0;
+			_scaledHeight = 0;
+			return false;
+		}
+		_scaledWidth = width;
+		_scaledHeight = height;
+	}
+
+	if(SDL_SetRenderTarget(_sdlRenderer, _scaledTexture) != 0) {
+		LogSdlError("SDL_SetRenderTarget failed");
+		return false;
+	}
+
+	//The upscale itself is always nearest-neighbor, like ScaleFilter's prescale
+	SDL_SetTextureScaleMode(_sdlTexture, SDL_ScaleModeNearest);
+	bool result = SDL_RenderCopy(_sdlRenderer, _sdlTexture, nullptr, nullptr) == 0;
+	SDL_SetTextureScaleMode(_sdlTexture, _useBilinearInterpolation ? SDL_ScaleModeLinear : SDL_ScaleModeNearest);
+
+	if(result && postProcess.NeedsOverlay()) {
+		result = UpdateOverlay(postProcess) && SDL_RenderCopy(_sdlRenderer, _overlayTexture, nullptr, nullptr) == 0;
+	}
+
+	SDL_SetRenderTarget(_sdlRenderer, nullptr);
+	if(!result) {
+		LogSdlError("SDL_RenderCopy failed (post-process)");
+	}
+	return result;
+}
+
 bool SdlRenderer::UpdateHudSize(HudRenderInfo& hud, uint32_t width, uint32_t height)
 {
 	if(!hud.Texture || hud.Width != width || hud.Height != height) {
@@ -231,14 +321,12 @@ void SdlRenderer::Render(RenderSurfaceInfo& emuHud, RenderSurfaceInfo& scriptHud
 	needUpdate |= UpdateHudSize(_emuHud, emuHud.Width, emuHud.Height);
 	needUpdate |= UpdateHudSize(_scriptHud, scriptHud.Width, scriptHud.Height);
 
-	if(SDL_RenderClear(_sdlRenderer) != 0) {
-		LogSdlError("SDL_RenderClear failed");
-	}
-
+	GpuPostProcess postProcess = {};
 	uint8_t *textureBuffer;
 	int rowPitch;
 	if(SDL_LockTexture(_sdlTexture, nullptr, (void**)&textureBuffer, &rowPitch) == 0) {
 		auto frameLock = _frameLock.AcquireSafe();
+		postProcess = _postProcess;
 		if(_frameBuffer && _frameWidth == _requiredWidth && _frameHeight == _requiredHeight) {
 			uint32_t* ppuFrameBuffer = _frameBuffer;
 			if(rowPitch != _frameWidth) {
@@ -264,10 +352,21 @@ void SdlRenderer::Render(RenderSurfaceInfo& emuHud, RenderSurfaceInfo& scriptHud
 		UpdateHudTexture(_scriptHud, scriptHud.Buffer.get());
 	}
 
+	//Post-process pass renders to its own target, so it runs before the window is cleared
+	SDL_Texture* screenTexture = _sdlTexture;
 	SDL_Rect source = {0, 0, (int)_frameWidth, (int)_frameHeight };
+	if(postProcess.IsActive() && _renderTargetSupported && ApplyPostProcess(postProcess)) {
+		screenTexture = _scaledTexture;
+		source = {0, 0, (int)_scaledWidth, (int)_scaledHeight };
+	}
+
+	if(SDL_RenderClear(_sdlRenderer) != 0) {
+		LogSdlError("SDL_RenderClear failed");
+	}
+
 	SDL_Rect dest = {0, 0, (int)_screenWidth, (int)_screenHeight };
 	
-	if(SDL_RenderCopy(_sdlRenderer, _sdlTexture, &source, &dest) != 0) {
+	if(SDL_RenderCopy(_sdlRenderer, screenTexture, &source, &dest) != 0) {
 		LogSdlError("SDL_RenderCopy failed");	
 	}
 
@@ -24,6 +24,16 @@ private:
 	SDL_Renderer *_sdlRenderer = nullptr;
 	SDL_Texture* _sdlTexture = nullptr;
 
+	//GPU post-process pass (prescale, LCD grid, scanlines)
+	SDL_Texture* _scaledTexture = nullptr;
+	SDL_Texture* _overlayTexture = nullptr;
+	uint32_t _scaledWidth = 0;
+	uint32_t _scaledHeight = 0;
+	GpuPostProcess _postProcess = {};
+	GpuPostProcess _overlayPostProcess = {};
+	vector<uint32_t> _overlayBuffer;
+	std::atomic<bool> _renderTargetSupported = false;
+
 	HudRenderInfo _emuHud = {};
 	HudRenderInfo _scriptHud = {};
 	
@@ -55,6 +65,9 @@ private:
 	void LogSdlError(const char* msg);
 	void SetScreenSize(uint32_t width, uint32_t height);
 	
+	bool ApplyPostProcess(const GpuPostProcess& postProcess);
+	bool UpdateOverlay(const GpuPostProcess& postProcess);
+
 	bool UpdateHudSize(HudRenderInfo& hud, uint32_t width, uint32_t height);
 	void UpdateHudTexture(HudRenderInfo& hud, uint32_t* src);
 
@@ -67,6 +80,7 @@ public:
 	void Render(RenderSurfaceInfo& emuHud, RenderSurfaceInfo& scriptHud) override;
 	void Reset() override;
 	void OnRendererThreadStarted() override;
+	bool SupportsGpuPostProcess() override;
 
 	void SetExclusiveFullscreenMode(bool fullscreen, void* windowHandle) override;
 };
@@ -32,11 +32,8 @@ void SdlSoundManager::Release()
 		SDL_CloseAudioDevice(_audioDeviceID);
 	}
 
-	if(_buffer) {
-		delete[] _buffer;
-		_buffer = nullptr;
-		_bufferSize = 0;
-	}
+	_ringBuffer.Reset(0);
+	_bufferSize = 0;
 }
 
 bool SdlSoundManager::InitializeAudio(uint32_t sampleRate, bool isStereo)
@@ -54,9 +51,8 @@ bool SdlSoundManager::InitializeAudio(uint32_t sampleRate, bool isStereo)
 
 	int bytesPerSample = 2 * (isStereo ? 2 : 1);
 	int32_t requestedByteLatency = (int32_t)((float)(sampleRate * _previousLatency) / 1000.0f * bytesPerSample);
-	_bufferSize = (int32_t)std::ceil((double)requestedByteLatency * 2 / 0x10000) * 0x10000;
-	_buffer = new uint8_t[_bufferSize];
-	memset(_buffer, 0, _bufferSize);
+	_ringBuffer.Reset((uint32_t)std::ceil((double)requestedByteLatency * 2 / 0x10000) * 0x10000);
+	_bufferSize = _ringBuffer.GetCapacity();
 
 	SDL_AudioSpec audioSpec;
 	SDL_memset(&audioSpec, 0, sizeof(audioSpec));
@@ -75,9 +71,7 @@ bool SdlSoundManager::InitializeAudio(uint32_t sampleRate, bool isStereo)
 		_audioDeviceID = SDL_OpenAudioDevice(nullptr, isCapture, &audioSpec, &obtainedSpec, 0);
 	}
 
-	_writePosition = 0;
-	_readPosition = 0;
-
+	_playing = false;
 	_needReset = false;
 
 	return _audioDeviceID != 0;
@@ -119,33 +113,16 @@ void SdlSoundManager::SetAudioDevice(const string& deviceName)
 
 void SdlSoundManager::ReadFromBuffer(uint8_t* output, uint32_t len)
 {
-	if(_readPosition + len < _bufferSize) {
-		memcpy(output, _buffer+_readPosition, len);
-		_readPosition += len;
-	} else {
-		int remainingBytes = (_bufferSize - _readPosition);
-		memcpy(output, _buffer+_readPosition, remainingBytes);
-		memcpy(output+remainingBytes, _buffer, len - remainingBytes);
-		_readPosition = len - remainingBytes;
-	}
-
-	if(_readPosition >= _writePosition && _readPosition - _writePosition < _bufferSize / 2) {
+	//Runs on SDL's audio thread, reads straight from the lock-free ring written by PlayBuffer
+	uint32_t bytesRead = _ringBuffer.Read(output, len);
+	_latencyTracker.OnConsumed(bytesRead);
+	if(bytesRead < len) {
+		//Underrun, play silence instead of whatever was left in the buffer
+		memset(output + bytesRead, 0, len - bytesRead);
 		_bufferUnderrunEventCount++;
 	}
 }
 
-void SdlSoundManager::WriteToBuffer(uint8_t* input, uint32_t len)
-{
-	if(_writePosition + len < _bufferSize) {
-		memcpy(_buffer+_writePosition, input, len);
-		_writePosition += len;
-	} else {
-		int remainingBytes = _bufferSize - _writePosition;
-		memcpy(_buffer+_writePosition, input, remainingBytes);
-		memcpy(_buffer, ((uint8_t*)input)+remainingBytes, len - remainingBytes);
-		_writePosition = len - remainingBytes;
-	}
-}
 void SdlSoundManager::PlayBuffer(int16_t *soundBuffer, uint32_t sampleCount, uint32_t sampleRate, bool isStereo)
 {
 	uint32_t bytesPerSample = 2 * (isStereo ? 2 : 1);
@@ -155,37 +132,36 @@ void SdlSoundManager::PlayBuffer(int16_t *soundBuffer, uint32_t sampleCount, uin
 		InitializeAudio(sampleRate, isStereo);
 	}
 
-	WriteToBuffer((uint8_t*)soundBuffer, sampleCount * bytesPerSample);
-
-	int32_t byteLatency = (int32_t)((float)(sampleRate * latency) / 1000.0f * bytesPerSample);
-	int32_t playWriteByteLatency = _writePosition - _readPosition;
-	if(playWriteByteLatency < 0) {
-		playWriteByteLatency = _bufferSize - _readPosition + _writePosition;
-	}
+	//Samples that don't fit are dropped (the buffer holds twice the requested latency)
+	uint32_t bytesWritten = _ringBuffer.Write((uint8_t*)soundBuffer, sampleCount * bytesPerSample);
+	_latencyTracker.OnQueued(bytesWritten, _mixStartTime);
 
-	if(playWriteByteLatency > byteLatency) {
+	uint32_t byteLatency = (uint32_t)((float)(sampleRate * latency) / 1000.0f * bytesPerSample);
+	if(!_playing && _ringBuffer.GetFillLevel() > byteLatency) {
 		//Start playing
 		SDL_PauseAudioDevice(_audioDeviceID, 0);
+		_playing = true;
 	}
 }
 
 void SdlSoundManager::Pause()
 {
 	SDL_PauseAudioDevice(_audioDeviceID, 1);
+	_playing = false;
 }
 
 void SdlSoundManager::Stop()
 {
+	//The callback is not running once the device is paused, safe to clear the ring
 	Pause();
 
-	_readPosition = 0;
-	_writePosition = 0;
+	_ringBuffer.Clear();
 	ResetStats();
 }
 
 void SdlSoundManager::ProcessEndOfFrame()
 {
-	ProcessLatency(_readPosition, _writePosition);
+	ProcessLatency(_ringBuffer.GetFillLevel());
 
 	uint32_t emulationSpeed = _emu->GetSettings()->GetEmulationSpeed();
 	if(_averageLatency > 0 && emulationSpeed <= 100 && emulationSpeed > 0 && std::abs(_averageLatency - _emu->GetSettings()->GetAudioConfig().AudioLatency) > 50) {
@@ -28,7 +28,6 @@ private:
 	static void FillAudioBuffer(void *userData, uint8_t *stream, int len);
 
 	void ReadFromBuffer(uint8_t* output, uint32_t len);
-	void WriteToBuffer(uint8_t* output, uint32_t len);
 
 private:
 	Emulator* _emu;
@@ -37,8 +36,5 @@ private:
 	bool _needReset = false;
 
 	uint16_t _previousLatency = 0;
-
-	uint8_t* _buffer = nullptr;
-	std::atomic<uint32_t> _writePosition{0};
-	std::atomic<uint32_t> _readPosition{0};
+	bool _playing = false;
 };
@@ -18,6 +18,7 @@ public sealed class AudioConfig : BaseConfig<AudioConfig> {
 	[Reactive][MinMax(0, 100)] public UInt32 MasterVolume { get; set; } = 100;
 	[Reactive] public AudioSampleRate SampleRate { get; set; } = AudioSampleRate._48000;
 	[Reactive][MinMax(15, 300)] public UInt32 AudioLatency { get; set; } = 60;
+	[Reactive] public AudioResamplerQuality ResamplerQuality { get; set; } = AudioResamplerQuality.Standard;
 
 	[Reactive] public bool MuteSoundInBackground { get; set; } = false;
 	[Reactive] public bool ReduceSoundInBackground { get; set; } = true;
@@ -67,6 +68,7 @@ public sealed class AudioConfig : BaseConfig<AudioConfig> {
 			MasterVolume = MasterVolume,
 			SampleRate = (UInt32)SampleRate,
 			AudioLatency = AudioLatency,
+			ResamplerQuality = ResamplerQuality,
 
 			MuteSoundInBackground = MuteSoundInBackground,
 			ReduceSoundInBackground = ReduceSoundInBackground,
@@ -118,6 +120,7 @@ public struct InteropAudioConfig {
 	public UInt32 MasterVolume;
 	public UInt32 SampleRate;
 	public UInt32 AudioLatency;
+	public AudioResamplerQuality ResamplerQuality;
 
 	[MarshalAs(UnmanagedType.I1)] public bool MuteSoundInBackground;
 	[MarshalAs(UnmanagedType.I1)] public bool ReduceSoundInBackground;
@@ -159,6 +162,12 @@ public struct InteropAudioConfig {
 	public UInt32 AudioPlayerSilenceDelay;
 }
 
+public enum AudioResamplerQuality {
+	Standard = 0,
+	High = 1,
+	Best = 2
+}
+
 public enum AudioSampleRate {
 	_11025 = 11025,
 	_22050 = 22050,
@@ -99,7 +99,9 @@ public sealed class DebugConfig {
 
 			ScriptAllowIoOsAccess = ScriptWindow.AllowIoOsAccess,
 			ScriptAllowNetworkAccess = ScriptWindow.AllowNetworkAccess,
-			ScriptTimeout = ScriptWindow.ScriptTimeout
+			ScriptTimeout = ScriptWindow.ScriptTimeout,
+			ScriptFrameBudget = ScriptWindow.ScriptFrameBudget,
+			ScriptGcStepBudget = ScriptWindow.ScriptGcStepBudget
 		});
 	}
 }
@@ -171,6 +173,8 @@ public struct InteropDebugConfig {
 	[MarshalAs(UnmanagedType.I1)] public bool ScriptAllowIoOsAccess;
 	[MarshalAs(UnmanagedType.I1)] public bool ScriptAllowNetworkAccess;
 	public UInt32 ScriptTimeout;
+	public UInt32 ScriptFrameBudget;
+	public UInt32 ScriptGcStepBudget;
 }
 
 public enum RefreshSpeed {
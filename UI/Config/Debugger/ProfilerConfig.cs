@@ -6,4 +6,5 @@ public sealed class ProfilerConfig : BaseWindowConfig<ProfilerConfig> {
 	[Reactive] public List<int> ColumnWidths { get; set; } = new();
 	[Reactive] public bool AutoRefresh { get; set; } = true;
 	[Reactive] public bool RefreshOnBreakPause { get; set; } = true;
+	[Reactive] public bool BackgroundMode { get; set; } = false;
 }
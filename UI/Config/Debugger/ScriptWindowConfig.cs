@@ -30,6 +30,8 @@ public sealed class ScriptWindowConfig : BaseWindowConfig<ScriptWindowConfig> {
 	[Reactive] public bool ShowLineNumbers { get; set; } = false;
 
 	[Reactive] public UInt32 ScriptTimeout { get; set; } = 1;
+	[Reactive] public UInt32 ScriptFrameBudget { get; set; } = 0;
+	[Reactive] public UInt32 ScriptGcStepBudget { get; set; } = 0;
 
 	public void AddRecentScript(string scriptFile) {
 		string? existingItem = RecentScripts.Where((file) => file == scriptFile).FirstOrDefault();
@@ -37,6 +37,7 @@ public sealed class NesConfig : BaseConfig<NesConfig> {
 	[Reactive] public ConsoleRegion Region { get; set; } = ConsoleRegion.Auto;
 
 	[Reactive] public bool EnableHdPacks { get; set; } = true;
+	[Reactive] public bool HdPackLazyLoading { get; set; } = false;
 	[Reactive] public bool DisableGameDatabase { get; set; } = false;
 	[Reactive] public bool FdsAutoLoadDisk { get; set; } = true;
 	[Reactive] public bool FdsFastForwardOnLoad { get; set; } = false;
@@ -158,6 +159,7 @@ public sealed class NesConfig : BaseConfig<NesConfig> {
 
 			Region = Region,
 			EnableHdPacks = EnableHdPacks,
+			HdPackLazyLoading = HdPackLazyLoading,
 			DisableGameDatabase = DisableGameDatabase,
 			FdsAutoLoadDisk = FdsAutoLoadDisk,
 			FdsFastForwardOnLoad = FdsFastForwardOnLoad,
@@ -292,6 +294,7 @@ public struct InteropNesConfig {
 
 	public ConsoleRegion Region;
 	[MarshalAs(UnmanagedType.I1)] public bool EnableHdPacks;
+	[MarshalAs(UnmanagedType.I1)] public bool HdPackLazyLoading;
 	[MarshalAs(UnmanagedType.I1)] public bool DisableGameDatabase;
 	[MarshalAs(UnmanagedType.I1)] public bool FdsAutoLoadDisk;
 	[MarshalAs(UnmanagedType.I1)] public bool FdsFastForwardOnLoad;
@@ -9,4 +9,6 @@ public sealed class NetplayConfig : BaseConfig<NetplayConfig> {
 
 	[Reactive] public UInt16 ServerPort { get; set; } = 8888;
 	[Reactive] public string ServerPassword { get; set; } = "";
+	[Reactive][MinMax(0, 10)] public UInt32 ServerRollbackFrames { get; set; } = 0;
+	[Reactive] public bool ServerUseUdp { get; set; } = false;
 }
@@ -50,8 +50,13 @@ public sealed class PreferencesConfig : BaseConfig<PreferencesConfig> {
 	[Reactive] public bool EnableAutoSaveState { get; set; } = true;
 	[Reactive] public UInt32 AutoSaveStateDelay { get; set; } = 20;
 
+	[Reactive] public bool EnableSaveDataFlush { get; set; } = false;
+	[Reactive] public UInt32 SaveDataFlushDelay { get; set; } = 30;
+
 	[Reactive] public bool EnableRewind { get; set; } = true;
 	[Reactive] public UInt32 RewindBufferSize { get; set; } = 300;
+	[Reactive] public bool ArchiveRewindHistory { get; set; } = false;
+	[Reactive] public bool PersistRewindHistory { get; set; } = false;
 
 	[Reactive] public bool AlwaysOnTop { get; set; } = false;
 
@@ -230,12 +235,15 @@ public sealed class PreferencesConfig : BaseConfig<PreferencesConfig> {
 			ShowMovieIcons = ShowMovieIcons,
 			ShowTurboRewindIcons = ShowTurboRewindIcons,
 			DisableGameSelectionScreen = GameSelectionScreenMode == GameSelectionMode.Disabled,
+			ArchiveRewindHistory = EnableRewind && ArchiveRewindHistory,
+			PersistRewindHistory = EnableRewind && ArchiveRewindHistory && PersistRewindHistory,
 			HudSize = HudSize,
 			SaveFolderOverride = OverrideSaveDataFolder ? SaveDataFolder : "",
 			SaveStateFolderOverride = OverrideSaveStateFolder ? SaveStateFolder : "",
 			ScreenshotFolderOverride = OverrideScreenshotFolder ? ScreenshotFolder : "",
 			RewindBufferSize = EnableRewind ? RewindBufferSize : 0,
-			AutoSaveStateDelay = EnableAutoSaveState ? AutoSaveStateDelay : 0
+			AutoSaveStateDelay = EnableAutoSaveState ? AutoSaveStateDelay : 0,
+			SaveDataFlushDelay = EnableSaveDataFlush ? SaveDataFlushDelay : 0
 		});
 	}
 }
@@ -274,11 +282,14 @@ public struct InteropPreferencesConfig {
 	[MarshalAs(UnmanagedType.I1)] public bool ShowMovieIcons;
 	[MarshalAs(UnmanagedType.I1)] public bool ShowTurboRewindIcons;
 	[MarshalAs(UnmanagedType.I1)] public bool DisableGameSelectionScreen;
+	[MarshalAs(UnmanagedType.I1)] public bool ArchiveRewindHistory;
+	[MarshalAs(UnmanagedType.I1)] public bool PersistRewindHistory;
 
 	public HudDisplaySize HudSize;
 
 	public UInt32 AutoSaveStateDelay;
 	public UInt32 RewindBufferSize;
+	public UInt32 SaveDataFlushDelay;
 
 	public string SaveFolderOverride;
 	public string SaveStateFolderOverride;
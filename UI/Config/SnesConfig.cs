@@ -58,6 +58,7 @@ public sealed class SnesConfig : BaseConfig<SnesConfig> {
 	[Reactive] public bool EnableStrictBoardMappings { get; set; } = false;
 	[Reactive] public RamState RamPowerOnState { get; set; } = RamState.Random;
 	[Reactive][MinMax(-999, 999)] public Int32 SpcClockSpeedAdjustment { get; set; } = 40;
+	[Reactive] public bool RunSpcOnSeparateThread { get; set; } = false;
 
 	//Overclocking
 	[Reactive][MinMax(0, 1000)] public UInt32 PpuExtraScanlinesBeforeNmi { get; set; } = 0;
@@ -119,6 +120,7 @@ public sealed class SnesConfig : BaseConfig<SnesConfig> {
 			GsuClockSpeed = this.GsuClockSpeed,
 			RamPowerOnState = this.RamPowerOnState,
 			SpcClockSpeedAdjustment = this.SpcClockSpeedAdjustment,
+			RunSpcOnSeparateThread = this.RunSpcOnSeparateThread,
 			BsxCustomDate = BsxUseCustomTime ? (this.BsxCustomDate.ToUnixTimeSeconds() + (long)this.BsxCustomTime.TotalSeconds) : -1
 		});
 	}
@@ -171,6 +173,7 @@ public struct InteropSnesConfig {
 	[MarshalAs(UnmanagedType.I1)] public bool EnableStrictBoardMappings;
 	public RamState RamPowerOnState;
 	public Int32 SpcClockSpeedAdjustment;
+	[MarshalAs(UnmanagedType.I1)] public bool RunSpcOnSeparateThread;
 
 	public UInt32 PpuExtraScanlinesBeforeNmi;
 	public UInt32 PpuExtraScanlinesAfterNmi;
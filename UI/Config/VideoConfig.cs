@@ -53,6 +53,8 @@ public sealed class VideoConfig : BaseConfig<VideoConfig> {
 
 	[Reactive] public ScreenRotation ScreenRotation { get; set; } = ScreenRotation.None;
 
+	[Reactive] public bool LowQualityFilterDuringTurbo { get; set; } = false;
+
 	public VideoConfig() {
 	}
 
@@ -112,7 +114,9 @@ public sealed class VideoConfig : BaseConfig<VideoConfig> {
 			FullscreenResWidth = (uint)(ExclusiveFullscreenResolution == FullscreenResolution.Default ? (ApplicationHelper.GetMainWindow()?.Screens.Primary?.Bounds.Width ?? 1920) : ExclusiveFullscreenResolution.GetWidth()),
 			FullscreenResHeight = (uint)(ExclusiveFullscreenResolution == FullscreenResolution.Default ? (ApplicationHelper.GetMainWindow()?.Screens.Primary?.Bounds.Height ?? 1080) : ExclusiveFullscreenResolution.GetHeight()),
 
-			ScreenRotation = (uint)ScreenRotation
+			ScreenRotation = (uint)ScreenRotation,
+
+			LowQualityFilterDuringTurbo = this.LowQualityFilterDuringTurbo
 		});
 	}
 }
@@ -160,6 +164,8 @@ public struct InteropVideoConfig {
 	public UInt32 FullscreenResHeight;
 
 	public UInt32 ScreenRotation;
+
+	[MarshalAs(UnmanagedType.I1)] public bool LowQualityFilterDuringTurbo;
 }
 
 public enum VideoFilterType {
@@ -61,7 +61,8 @@ public sealed class HexEditorDataProvider : IHexEditorDataProvider {
 			lastByteIndex = Length - 1;
 		}
 
-		_data = DebugApi.GetMemoryValues(_memoryType, (uint)firstByteIndex, (uint)lastByteIndex);
+		// Reuses the buffer from the previous refresh when the visible range has the same size
+		DebugApi.GetMemoryValues(_memoryType, (uint)firstByteIndex, (uint)lastByteIndex, ref _data);
 
 		_firstByteIndex = firstByteIndex;
 		int visibleByteCount = (int)(lastByteIndex - firstByteIndex + 1);
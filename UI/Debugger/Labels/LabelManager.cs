@@ -66,6 +66,19 @@ public sealed class LabelManager {
 	/// <summary>Counter for suspending events during bulk operations.</summary>
 	private static int _suspendEvents = 0;
 
+	/// <summary>Native label updates queued by <see cref="SetLabels"/>, sent to the core in a single call (null when not batching).</summary>
+	private static NativeLabelBatch? _nativeBatch = null;
+
+	/// <summary>
+	/// Native label updates, in the order they were made.
+	/// </summary>
+	private sealed class NativeLabelBatch {
+		public List<UInt32> Addresses { get; } = new();
+		public List<MemoryType> MemoryTypes { get; } = new();
+		public List<string> Labels { get; } = new();
+		public List<string> Comments { get; } = new();
+	}
+
 	/// <summary>
 	/// Suspends label update events. Use with <see cref="ResumeEvents"/> for bulk operations.
 	/// </summary>
@@ -154,15 +167,28 @@ public sealed class LabelManager {
 	public static void SetLabels(IEnumerable<CodeLabel> labels, bool raiseEvents = true) {
 		Dictionary<MemoryType, bool> isAvailable = new();
 
-		foreach (CodeLabel label in labels) {
-			//Check if label memory type is valid before adding it to the list
-			if (!isAvailable.TryGetValue(label.MemoryType, out bool available)) {
-				available = DebugApi.GetMemorySize(label.MemoryType) > 0;
-				isAvailable[label.MemoryType] = available;
-			}
+		//Send all native updates in a single call (the core pauses emulation once instead of once per label)
+		bool ownsBatch = _nativeBatch == null;
+		_nativeBatch ??= new NativeLabelBatch();
+		try {
+			foreach (CodeLabel label in labels) {
+				//Check if label memory type is valid before adding it to the list
+				if (!isAvailable.TryGetValue(label.MemoryType, out bool available)) {
+					available = DebugApi.GetMemorySize(label.MemoryType) > 0;
+					isAvailable[label.MemoryType] = available;
+				}
 
-			if (available) {
-				SetLabel(label, false);
+				if (available) {
+					SetLabel(label, false);
+				}
+			}
+		} finally {
+			if (ownsBatch) {
+				NativeLabelBatch batch = _nativeBatch!;
+				_nativeBatch = null;
+				if (batch.Addresses.Count > 0) {
+					DebugApi.SetLabels((UInt32)batch.Addresses.Count, batch.Addresses.ToArray(), batch.MemoryTypes.ToArray(), batch.Labels.ToArray(), batch.Comments.ToArray());
+				}
 			}
 		}
 
@@ -248,9 +274,9 @@ public sealed class LabelManager {
 			_labelsByKey[key] = label;
 
 			if (label.Length == 1) {
-				DebugApi.SetLabel(i, label.MemoryType, label.Label, comment.Replace(Environment.NewLine, "\n"));
+				SetNativeLabel(i, label.MemoryType, label.Label, comment.Replace(Environment.NewLine, "\n"));
 			} else {
-				DebugApi.SetLabel(i, label.MemoryType, label.Label + "+" + (i - label.Address).ToString(), comment.Replace(Environment.NewLine, "\n"));
+				SetNativeLabel(i, label.MemoryType, label.Label + "+" + (i - label.Address).ToString(), comment.Replace(Environment.NewLine, "\n"));
 
 				//Only set the comment on the first byte of multi-byte comments
 				comment = "";
@@ -269,6 +295,20 @@ public sealed class LabelManager {
 		return true;
 	}
 
+	/// <summary>
+	/// Sets a label in the native debugger core, or queues it when a batch is in progress.
+	/// </summary>
+	private static void SetNativeLabel(UInt32 address, MemoryType memType, string label, string comment) {
+		if (_nativeBatch != null) {
+			_nativeBatch.Addresses.Add(address);
+			_nativeBatch.MemoryTypes.Add(memType);
+			_nativeBatch.Labels.Add(label);
+			_nativeBatch.Comments.Add(comment);
+		} else {
+			DebugApi.SetLabel(address, memType, label, comment);
+		}
+	}
+
 	/// <summary>
 	/// Deletes a label from managed storage and native debugger core.
 	/// </summary>
@@ -285,7 +325,7 @@ public sealed class LabelManager {
 			}
 
 			if (_labelsByKey.Remove(key)) {
-				DebugApi.SetLabel(i, label.MemoryType, string.Empty, string.Empty);
+				SetNativeLabel(i, label.MemoryType, string.Empty, string.Empty);
 				if (raiseEvent) {
 					needEvent = true;
 				}
@@ -58,7 +58,17 @@ public sealed class NesStatusViewModel : BaseConsoleStatusViewModel {
 
 	[Reactive] public string StackPreview { get; private set; } = "";
 
+	private readonly DebugSnapshot _snapshot = new();
+	private readonly int _cpuStateItem;
+	private readonly int _ppuStateItem;
+	private readonly int _stackItem;
+	private byte[] _stackPage = [];
+
 	public NesStatusViewModel() {
+		_cpuStateItem = _snapshot.AddCpuState<NesCpuState>(CpuType.Nes);
+		_ppuStateItem = _snapshot.AddPpuState<NesPpuState>(CpuType.Nes);
+		_stackItem = _snapshot.AddMemory(MemoryType.NesMemory, 0x100, 0x100);
+
 		this.WhenAnyValue(x => x.FlagC, x => x.FlagD, x => x.FlagI, x => x.FlagN, x => x.FlagV, x => x.FlagZ).Subscribe(x => RegPS = (byte)(
 				(FlagN ? (byte)NesCpuFlags.Negative : 0) |
 				(FlagV ? (byte)NesCpuFlags.Overflow : 0) |
@@ -80,8 +90,10 @@ public sealed class NesStatusViewModel : BaseConsoleStatusViewModel {
 	}
 
 	protected override void InternalUpdateUiState() {
-		NesCpuState cpu = DebugApi.GetCpuState<NesCpuState>(CpuType.Nes);
-		NesPpuState ppu = DebugApi.GetPpuState<NesPpuState>(CpuType.Nes);
+		_snapshot.Fetch();
+		NesCpuState cpu = _snapshot.GetState<NesCpuState>(_cpuStateItem);
+		NesPpuState ppu = _snapshot.GetState<NesPpuState>(_ppuStateItem);
+		_snapshot.GetMemory(_stackItem, ref _stackPage);
 
 		UpdateCycleCount(cpu.CycleCount);
 
@@ -99,8 +111,8 @@ public sealed class NesStatusViewModel : BaseConsoleStatusViewModel {
 		FlagIrqFdsDisk = (cpu.IRQFlag & (byte)NesIrqSources.FdsDisk) != 0;
 
 		StringBuilder sb = new StringBuilder();
-		for (UInt32 i = (UInt32)0x100 + cpu.SP + 1; i < 0x200; i++) {
-			sb.Append($"${DebugApi.GetMemoryValue(MemoryType.NesMemory, i):X2} ");
+		for (int i = cpu.SP + 1; i < 0x100; i++) {
+			sb.Append($"${_stackPage[i]:X2} ");
 		}
 
 		StackPreview = sb.ToString();
@@ -27,7 +27,17 @@ public sealed class PceStatusViewModel : BaseConsoleStatusViewModel {
 
 	[Reactive] public string StackPreview { get; private set; } = "";
 
+	private readonly DebugSnapshot _snapshot = new();
+	private readonly int _cpuStateItem;
+	private readonly int _videoStateItem;
+	private readonly int _stackItem;
+	private byte[] _stackPage = [];
+
 	public PceStatusViewModel() {
+		_cpuStateItem = _snapshot.AddCpuState<PceCpuState>(CpuType.Pce);
+		_videoStateItem = _snapshot.AddPpuState<PceVideoState>(CpuType.Pce);
+		_stackItem = _snapshot.AddMemory(MemoryType.PceMemory, 0x2100, 0x100);
+
 		this.WhenAnyValue(x => x.FlagC, x => x.FlagD, x => x.FlagI, x => x.FlagN, x => x.FlagV, x => x.FlagZ, x => x.FlagT).Subscribe(x => RegPS = (byte)(
 				(FlagN ? (byte)PceCpuFlags.Negative : 0) |
 				(FlagV ? (byte)PceCpuFlags.Overflow : 0) |
@@ -51,8 +61,10 @@ public sealed class PceStatusViewModel : BaseConsoleStatusViewModel {
 	}
 
 	protected override void InternalUpdateUiState() {
-		PceCpuState cpu = DebugApi.GetCpuState<PceCpuState>(CpuType.Pce);
-		PceVideoState video = DebugApi.GetPpuState<PceVideoState>(CpuType.Pce);
+		_snapshot.Fetch();
+		PceCpuState cpu = _snapshot.GetState<PceCpuState>(_cpuStateItem);
+		PceVideoState video = _snapshot.GetState<PceVideoState>(_videoStateItem);
+		_snapshot.GetMemory(_stackItem, ref _stackPage);
 
 		UpdateCycleCount(cpu.CycleCount);
 
@@ -64,8 +76,8 @@ public sealed class PceStatusViewModel : BaseConsoleStatusViewModel {
 		RegPS = cpu.PS;
 
 		StringBuilder sb = new StringBuilder();
-		for (UInt32 i = (UInt32)0x2100 + cpu.SP + 1; i < 0x2200; i++) {
-			sb.Append($"${DebugApi.GetMemoryValue(MemoryType.PceMemory, i):X2} ");
+		for (int i = cpu.SP + 1; i < 0x100; i++) {
+			sb.Append($"${_stackPage[i]:X2} ");
 		}
 
 		StackPreview = sb.ToString();
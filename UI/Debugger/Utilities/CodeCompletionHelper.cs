@@ -335,6 +335,7 @@ public enum DocEntrySubcategory {
 	AccessCounters,
 	Cdl,
 	Cheats,
+	Network,
 	SaveStates,
 	Others
 }
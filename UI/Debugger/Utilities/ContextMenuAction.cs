@@ -458,6 +458,7 @@ public enum ActionType {
 	Refresh,
 	EnableAutoRefresh,
 	RefreshOnBreakPause,
+	ProfilerBackgroundMode,
 
 	ZoomIn,
 	ZoomOut,
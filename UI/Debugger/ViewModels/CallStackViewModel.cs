@@ -60,6 +60,18 @@ public sealed class CallStackViewModel : DisposableViewModel {
 	/// </summary>
 	private StackFrameInfo[] _stackFrames = [];
 
+	/// <summary>
+	/// Cached program counter (start of the current instruction).
+	/// </summary>
+	private UInt32 _programCounter;
+
+	/// <summary>
+	/// Fetches the callstack and the program counter with a single call.
+	/// </summary>
+	private readonly DebugSnapshot _snapshot = new();
+	private readonly int _callstackItem;
+	private readonly int _programCounterItem;
+
 	/// <summary>
 	/// Designer-only constructor. Do not use in production code.
 	/// </summary>
@@ -74,13 +86,17 @@ public sealed class CallStackViewModel : DisposableViewModel {
 	public CallStackViewModel(CpuType cpuType, DebuggerWindowViewModel debugger) {
 		Debugger = debugger;
 		CpuType = cpuType;
+		_callstackItem = _snapshot.AddCallstack(cpuType);
+		_programCounterItem = _snapshot.AddProgramCounter(cpuType, true);
 	}
 
 	/// <summary>
 	/// Updates the call stack by fetching current stack frames from the debug API.
 	/// </summary>
 	public void UpdateCallStack() {
-		_stackFrames = DebugApi.GetCallstack(CpuType);
+		_snapshot.Fetch();
+		_stackFrames = _snapshot.GetCallstack(_callstackItem);
+		_programCounter = _snapshot.GetProgramCounter(_programCounterItem);
 		RefreshCallStack();
 	}
 
@@ -116,8 +132,8 @@ public sealed class CallStackViewModel : DisposableViewModel {
 		stack.Insert(0, new StackInfo() {
 			EntryPoint = GetEntryPoint(stackFrames.Length > 0 ? stackFrames[^1] : null),
 			EntryPointAddr = stackFrames.Length > 0 ? stackFrames[^1].AbsTarget : null,
-			RelAddress = DebugApi.GetProgramCounter(CpuType, true),
-			Address = DebugApi.GetAbsoluteAddress(new AddressInfo() { Address = (int)DebugApi.GetProgramCounter(CpuType, true), Type = CpuType.ToMemoryType() })
+			RelAddress = _programCounter,
+			Address = DebugApi.GetAbsoluteAddress(new AddressInfo() { Address = (int)_programCounter, Type = CpuType.ToMemoryType() })
 		});
 
 		return stack;
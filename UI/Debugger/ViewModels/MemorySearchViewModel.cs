@@ -36,7 +36,9 @@ namespace Nexen.Debugger.ViewModels;
 /// </list>
 /// </para>
 /// <para>
-/// Maintains search history for undo functionality and supports sorting by various columns.
+/// The snapshots, filtering and undo history are handled by the core's memory search (DebugApi.MemorySearch*),
+/// the view model only fetches the remaining addresses and the snapshots it displays.
+/// Supports sorting by various columns.
 /// </para>
 /// </remarks>
 public sealed class MemorySearchViewModel : DisposableViewModel {
@@ -115,12 +117,6 @@ public sealed class MemorySearchViewModel : DisposableViewModel {
 	/// <summary>The memory snapshot from the last search operation.</summary>
 	private byte[] _lastSearchSnapshot = [];
 
-	/// <summary>Set of addresses that have been filtered out.</summary>
-	private HashSet<int> _hiddenAddresses = new();
-
-	/// <summary>History stack for undo functionality.</summary>
-	private List<SearchHistory> _undoHistory = new();
-
 	/// <summary>Flag to prevent recursive refreshes.</summary>
 	private bool _isRefreshing;
 
@@ -188,12 +184,13 @@ public sealed class MemorySearchViewModel : DisposableViewModel {
 	/// </summary>
 	/// <param name="forceSort">Whether to force a re-sort of the data.</param>
 	/// <remarks>
-	/// Saves the previous memory state before fetching the current state.
-	/// This enables comparison between current and previous values.
+	/// The core takes the new snapshot (the previous one is kept for "previous refresh value" filters),
+	/// both are then copied for display.
 	/// </remarks>
 	public void RefreshData(bool forceSort) {
-		PrevMemoryState = MemoryState;
-		MemoryState = DebugApi.GetMemoryState(MemoryType);
+		DebugApi.MemorySearchRefresh();
+		PrevMemoryState = DebugApi.GetMemorySearchSnapshot(MemorySearchSnapshot.PreviousRefresh, MemoryType);
+		MemoryState = DebugApi.GetMemorySearchSnapshot(MemorySearchSnapshot.Current, MemoryType);
 
 		Dispatcher.UIThread.Post(() => RefreshList(forceSort));
 	}
@@ -253,7 +250,7 @@ public sealed class MemorySearchViewModel : DisposableViewModel {
 			_innerData.RemoveRange(memoryState.Length, _innerData.Count - memoryState.Length);
 		}
 
-		int visibleCount = memoryState.Length - _hiddenAddresses.Count;
+		int visibleCount = Math.Min(AddressLookup.Length, memoryState.Length);
 		if (ListData.Count != visibleCount) {
 			ListData.Replace(_innerData.GetRange(0, visibleCount));
 		}
@@ -377,70 +374,45 @@ public sealed class MemorySearchViewModel : DisposableViewModel {
 	/// Adds a filter based on the current search criteria, hiding non-matching addresses.
 	/// </summary>
 	/// <remarks>
-	/// Saves current state to undo history before filtering.
-	/// Addresses that don't match the criteria are added to the hidden set.
-	/// Takes a new snapshot after filtering for subsequent comparisons.
+	/// The core saves the current state to its undo history, removes the addresses that don't match
+	/// and takes a new snapshot for subsequent comparisons.
 	/// </remarks>
 	public void AddFilter() {
-		_undoHistory.Add(new SearchHistory(_hiddenAddresses, _lastSearchSnapshot));
+		DebugApi.MemorySearchAddFilter(new InteropMemorySearchFilter() {
+			ValueSize = ValueSize,
+			Format = Format,
+			CompareTo = CompareTo,
+			Operator = Operator,
+			SpecificValue = SpecificValue,
+			SpecificAddress = (UInt32)SpecificAddress
+		});
 		IsUndoEnabled = true;
 
-		int count = _lastSearchSnapshot.Length;
-		for (int i = 0; i < count; i++) {
-			if (_hiddenAddresses.Contains(i)) {
-				continue;
-			} else if (!IsMatch(i)) {
-				_hiddenAddresses.Add(i);
-			}
-		}
-
-		UpdateAddressLookup();
-
-		_lastSearchSnapshot = DebugApi.GetMemoryState(MemoryType);
+		UpdateSearchResults();
 		RefreshList(true);
 	}
 
 	/// <summary>
-	/// Rebuilds the address lookup array excluding hidden addresses.
+	/// Fetches the remaining addresses and the last search snapshot from the core.
 	/// </summary>
-	/// <remarks>
-	/// Creates a contiguous array of visible addresses for display.
-	/// Called after filtering operations to update the visible address list.
-	/// </remarks>
-	private void UpdateAddressLookup() {
-		int count = _lastSearchSnapshot.Length;
-		int[] addressLookup = new int[count];
-		int visibleRowCounter = 0;
-
-		for (int i = 0; i < count; i++) {
-			if (!_hiddenAddresses.Contains(i)) {
-				addressLookup[visibleRowCounter] = i;
-				visibleRowCounter++;
-			}
-		}
-
-		Array.Resize(ref addressLookup, visibleRowCounter);
-		AddressLookup = addressLookup;
+	private void UpdateSearchResults() {
+		AddressLookup = DebugApi.GetMemorySearchResults();
+		_lastSearchSnapshot = DebugApi.GetMemorySearchSnapshot(MemorySearchSnapshot.LastSearch, MemoryType);
 	}
 
 	/// <summary>
 	/// Resets the search to show all addresses with fresh memory snapshots.
 	/// </summary>
 	/// <remarks>
-	/// Clears all hidden addresses and undo history.
+	/// Makes every address visible again and clears the undo history.
 	/// Takes a new memory snapshot as the baseline for comparisons.
 	/// </remarks>
 	public void ResetSearch() {
-		_lastSearchSnapshot = DebugApi.GetMemoryState(MemoryType);
-		// Build identity array directly instead of Enumerable.Range().ToArray()
-		int[] lookup = new int[_lastSearchSnapshot.Length];
-		for (int i = 0; i < lookup.Length; i++) lookup[i] = i;
-		AddressLookup = lookup;
+		DebugApi.MemorySearchReset(MemoryType);
+		UpdateSearchResults();
 		MaxAddress = Math.Max(0, _lastSearchSnapshot.Length - 1);
-		_hiddenAddresses.Clear();
-		_undoHistory.Clear();
 		IsUndoEnabled = false;
-		MemoryState = DebugApi.GetMemoryState(MemoryType);
+		MemoryState = _lastSearchSnapshot;
 		RefreshData(true);
 	}
 
@@ -448,16 +420,13 @@ public sealed class MemorySearchViewModel : DisposableViewModel {
 	/// Undoes the last filter operation, restoring the previous search state.
 	/// </summary>
 	/// <remarks>
-	/// Restores hidden addresses and search snapshot from the undo history.
+	/// The core restores the remaining addresses and search snapshot from its undo history.
 	/// Disables undo when the history is empty.
 	/// </remarks>
 	public void Undo() {
-		if (_undoHistory.Count > 0) {
-			_hiddenAddresses = _undoHistory[^1].HiddenAddresses;
-			_lastSearchSnapshot = _undoHistory[^1].SearchSnapshot;
-			_undoHistory.RemoveAt(_undoHistory.Count - 1);
-			IsUndoEnabled = _undoHistory.Count > 0;
-			UpdateAddressLookup();
+		if (DebugApi.MemorySearchUndo()) {
+			IsUndoEnabled = DebugApi.MemorySearchCanUndo();
+			UpdateSearchResults();
 			RefreshList(true);
 		}
 	}
@@ -469,31 +438,6 @@ public sealed class MemorySearchViewModel : DisposableViewModel {
 		DebugApi.ResetMemoryAccessCounts();
 		RefreshList(true);
 	}
-
-	/// <summary>
-	/// Stores the state of a search for undo functionality.
-	/// </summary>
-	private class SearchHistory {
-		/// <summary>
-		/// Set of addresses hidden by the filter.
-		/// </summary>
-		public HashSet<int> HiddenAddresses;
-
-		/// <summary>
-		/// Memory snapshot at the time of the filter.
-		/// </summary>
-		public byte[] SearchSnapshot;
-
-		/// <summary>
-		/// Creates a new search history entry.
-		/// </summary>
-		/// <param name="hiddenAddresses">The set of hidden addresses to copy.</param>
-		/// <param name="searchSnapshot">The memory snapshot to store.</param>
-		public SearchHistory(HashSet<int> hiddenAddresses, byte[] searchSnapshot) {
-			HiddenAddresses = new(hiddenAddresses);
-			SearchSnapshot = searchSnapshot;
-		}
-	}
 }
 
 /// <summary>
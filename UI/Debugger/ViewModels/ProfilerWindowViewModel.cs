@@ -103,6 +103,15 @@ public sealed class ProfilerWindowViewModel : DisposableViewModel {
 				ActionType = ActionType.RefreshOnBreakPause,
 				IsSelected = () => Config.RefreshOnBreakPause,
 				OnClick = () => Config.RefreshOnBreakPause = !Config.RefreshOnBreakPause
+			},
+			new ContextMenuSeparator(),
+			new ContextMenuAction() {
+				ActionType = ActionType.ProfilerBackgroundMode,
+				IsSelected = () => Config.BackgroundMode,
+				OnClick = () => {
+					Config.BackgroundMode = !Config.BackgroundMode;
+					ApplyBackgroundMode();
+				}
 			}
 		});
 
@@ -145,6 +154,16 @@ public sealed class ProfilerWindowViewModel : DisposableViewModel {
 
 		ProfilerTabs = tabs;
 		SelectedTab = tabs[0];
+		ApplyBackgroundMode();
+	}
+
+	/// <summary>
+	/// Enables/disables the core profilers' background aggregation mode, based on the config.
+	/// </summary>
+	private void ApplyBackgroundMode() {
+		foreach (ProfilerTab tab in ProfilerTabs) {
+			DebugApi.SetProfilerBackgroundMode(tab.CpuType, Config.BackgroundMode);
+		}
 	}
 
 	/// <summary>
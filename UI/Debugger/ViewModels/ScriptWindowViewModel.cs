@@ -52,6 +52,16 @@ public sealed class ScriptWindowViewModel : ViewModelBase {
 	/// </summary>
 	[Reactive] public string Log { get; set; } = "";
 
+	/// <summary>
+	/// Gets or sets the time spent in the script's callbacks (last frame, max, frames over budget).
+	/// </summary>
+	[Reactive] public string ProfileSummary { get; set; } = "";
+
+	/// <summary>
+	/// Gets or sets the call count and time spent in each of the script's callbacks (one line per callback).
+	/// </summary>
+	[Reactive] public string ProfileDetails { get; set; } = "";
+
 	/// <summary>
 	/// Gets or sets the display name for the script.
 	/// </summary>
@@ -397,7 +397,7 @@ public sealed class TileEditorViewModel : DisposableViewModel {
 						fixed (UInt32* ptr = _tileBuffer) {
 							AddressInfo addr = _tileAddresses[(y * _columnCount) + x];
 							byte[] sourceData = DebugApi.GetMemoryValues(addr.Type, (uint)addr.Address, (uint)(addr.Address + bytesPerTile - 1));
-							DebugApi.GetTileView(_cpuType, GetOptions(x, y), sourceData, sourceData.Length, PaletteColors, (IntPtr)ptr);
+							DebugApi.GetTileView(_cpuType, GetOptions(x, y), sourceData, sourceData.Length, PaletteColors, PaletteColors.Length, (IntPtr)ptr);
 							UInt32* viewer = (UInt32*)framebuffer.FrameBuffer.Address;
 							int rowPitch = ViewerBitmap.PixelSize.Width;
 							int baseOffset = (x * tileSize.Width) + (y * tileSize.Height * rowPitch);
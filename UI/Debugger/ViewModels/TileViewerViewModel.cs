@@ -620,7 +620,7 @@ public sealed class TileViewerViewModel : DisposableViewModel, ICpuTypeModel, IM
 		}
 
 		using (var framebuffer = ViewerBitmap.Lock()) {
-			DebugApi.GetTileView(CpuType, GetOptions(), _sourceData, _sourceData.Length, PaletteColors, framebuffer.FrameBuffer.Address);
+			DebugApi.GetTileView(CpuType, GetOptions(), _sourceData, _sourceData.Length, PaletteColors, PaletteColors.Length, framebuffer.FrameBuffer.Address);
 		}
 
 		if (IsNesChrModeEnabled) {
@@ -76,6 +76,12 @@ public sealed class WatchManager {
 	/// </summary>
 	private CpuType _cpuType;
 
+	/// <summary>
+	/// Expressions registered with <see cref="DebugApi.SetWatchExpressions"/>, in watch list order.
+	/// </summary>
+	/// <remarks>Array display entries are registered as empty strings (they are evaluated separately).</remarks>
+	private string[] _registeredExpressions = [];
+
 	/// <summary>
 	/// Per-CPU watch managers, created on demand.
 	/// </summary>
@@ -140,9 +146,9 @@ public sealed class WatchManager {
 	/// </returns>
 	/// <remarks>
 	/// <para>
-	/// Each expression is evaluated against the current emulator state using
-	/// <see cref="DebugApi.EvaluateExpression"/>. Format specifiers are processed
-	/// to control output formatting.
+	/// All expressions are evaluated against the current emulator state with a single
+	/// <see cref="DebugApi.EvaluateWatchExpressions"/> call. They are compiled by the core when
+	/// the watch list changes. Format specifiers are processed to control output formatting.
 	/// </para>
 	/// <para>
 	/// Array display syntax (e.g., "[$300,10]") is handled specially to show
@@ -156,12 +162,14 @@ public sealed class WatchManager {
 			defaultByteLength = 4;
 		}
 
-		var list = new List<WatchValueInfo>();
-		for (int i = 0; i < _watchEntries.Count; i++) {
+		int count = _watchEntries.Count;
+		string[] expressions = new string[count];
+		string[] exprsToEvaluate = new string[count];
+		WatchFormatStyle[] styles = new WatchFormatStyle[count];
+		int[] byteLengths = new int[count];
+		Match?[] arrayMatches = new Match?[count];
+		for (int i = 0; i < count; i++) {
 			string expression = _watchEntries[i].Trim();
-			string newValue = "";
-			EvalResultType resultType;
-
 			string exprToEvaluate = expression;
 			WatchFormatStyle style = defaultStyle;
 			int byteLength = defaultByteLength;
@@ -172,19 +180,50 @@ public sealed class WatchManager {
 
 			ProcessFormatSpecifier(ref exprToEvaluate, ref style, ref byteLength);
 
+			Match match = _arrayWatchRegex.Match(expression);
+			expressions[i] = expression;
+			styles[i] = style;
+			byteLengths[i] = byteLength;
+			arrayMatches[i] = match.Success ? match : null;
+			exprsToEvaluate[i] = match.Success ? "" : exprToEvaluate;
+		}
+
+		//Evaluate all expressions with a single call (they are only compiled again when the watch list changes)
+		Int64[] results = new Int64[count];
+		EvalResultType[] resultTypes = new EvalResultType[count];
+		if (!_registeredExpressions.SequenceEqual(exprsToEvaluate)) {
+			DebugApi.SetWatchExpressions(_cpuType, exprsToEvaluate, (UInt32)count);
+			_registeredExpressions = exprsToEvaluate;
+		}
+
+		if (!DebugApi.EvaluateWatchExpressions(_cpuType, results, resultTypes, (UInt32)count)) {
+			//The debugger was restarted since the expressions were registered
+			DebugApi.SetWatchExpressions(_cpuType, exprsToEvaluate, (UInt32)count);
+			if (!DebugApi.EvaluateWatchExpressions(_cpuType, results, resultTypes, (UInt32)count)) {
+				for (int i = 0; i < count; i++) {
+					if (arrayMatches[i] is null) {
+						results[i] = DebugApi.EvaluateExpression(exprsToEvaluate[i], _cpuType, out resultTypes[i], true);
+					}
+				}
+			}
+		}
+
+		var list = new List<WatchValueInfo>();
+		for (int i = 0; i < count; i++) {
+			string newValue = "";
 			Int64 numericValue = -1;
 
 			bool forceHasChanged = false;
-			Match match = _arrayWatchRegex.Match(expression);
-			if (match.Success) {
+			Match? match = arrayMatches[i];
+			if (match is not null) {
 				//Watch expression matches the array display syntax (e.g: [$300,10] = display 10 bytes starting from $300)
-				newValue = ProcessArrayDisplaySyntax(style, ref forceHasChanged, match);
+				newValue = ProcessArrayDisplaySyntax(styles[i], ref forceHasChanged, match);
 			} else {
-				Int64 result = DebugApi.EvaluateExpression(exprToEvaluate, _cpuType, out resultType, true);
-				switch (resultType) {
+				Int64 result = results[i];
+				switch (resultTypes[i]) {
 					case EvalResultType.Numeric:
 						numericValue = result;
-						newValue = FormatValue(result, style, byteLength);
+						newValue = FormatValue(result, styles[i], byteLengths[i]);
 						break;
 
 					case EvalResultType.Boolean: newValue = result == 0 ? "false" : "true"; break;
@@ -195,7 +234,7 @@ public sealed class WatchManager {
 			}
 
 			bool isChanged = forceHasChanged || (i < previousValues.Count && (previousValues[i].Value != newValue));
-			list.Add(new WatchValueInfo() { Expression = expression, Value = newValue, IsChanged = isChanged, NumericValue = numericValue });
+			list.Add(new WatchValueInfo() { Expression = expressions[i], Value = newValue, IsChanged = isChanged, NumericValue = numericValue });
 		}
 
 		list.Add(new WatchValueInfo());
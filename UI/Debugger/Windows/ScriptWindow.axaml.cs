@@ -3,6 +3,7 @@ using System.Collections.Generic;
 using System.ComponentModel;
 using System.Linq;
 using System.Reflection;
+using System.Text;
 using System.Xml;
 using Avalonia;
 using Avalonia.Controls;
@@ -25,6 +26,7 @@ using Nexen.Debugger.Utilities;
 using Nexen.Debugger.ViewModels;
 using Nexen.Debugger.Views;
 using Nexen.Interop;
+using Nexen.Localization;
 using Nexen.Utilities;
 
 namespace Nexen.Debugger.Windows; 
@@ -134,7 +136,34 @@ public class ScriptWindow : NexenWindow, INotificationHandler {
 				Model.Log = log;
 				_txtScriptLog.ScrollToEnd();
 			}
+			UpdateProfile();
+		} else {
+			Model.ProfileSummary = "";
+			Model.ProfileDetails = "";
+		}
+	}
+
+	private void UpdateProfile() {
+		ScriptProfileSummary summary = DebugApi.GetScriptProfileSummary(Model.ScriptId);
+		Model.ProfileSummary = ResourceHelper.GetMessage("ScriptProfileSummary", summary.LastFrameTime.ToString("0.00"), summary.MaxFrameTime.ToString("0.00"), summary.FramesOverBudget);
+		if (summary.FramesSkipped > 0) {
+			Model.ProfileSummary += ResourceHelper.GetMessage("ScriptProfileSkippedFrames", summary.FramesSkipped);
+		}
+		if (summary.TotalGcTime > 0) {
+			Model.ProfileSummary += ResourceHelper.GetMessage("ScriptProfileGcTime", summary.LastGcTime.ToString("0.00"), summary.MaxGcTime.ToString("0.00"));
+		}
+
+		StringBuilder sb = new();
+		foreach (ScriptCallbackProfile profile in DebugApi.GetScriptCallbackProfiles(Model.ScriptId)) {
+			if (profile.Type < 0) {
+				sb.Append(profile.Event.ToString());
+			} else {
+				string type = profile.Type switch { 0 => "Read", 1 => "Write", _ => "Exec" };
+				sb.Append($"{type} {profile.MemType} ${profile.StartAddress:X}-${profile.EndAddress:X}");
+			}
+			sb.AppendLine(ResourceHelper.GetMessage("ScriptCallbackProfile", profile.CallCount, profile.TotalTime.ToString("0.00"), profile.MaxTime.ToString("0.000")));
 		}
+		Model.ProfileDetails = sb.ToString().TrimEnd();
 	}
 
 	private void InitializeComponent() {
@@ -55,7 +55,8 @@ public enum EmulationFlags : UInt32 {
 	InBackground = 0x08,
 	ConsoleMode = 0x10,
 	TestMode = 0x20,
-	OutputToStdout = 0x40
+	OutputToStdout = 0x40,
+	ShareRomData = 0x80
 }
 
 public enum DebuggerFlags : UInt32 {
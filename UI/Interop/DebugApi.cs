@@ -23,6 +23,10 @@ public sealed class DebugApi {
 	[DllImport(DllPath)] public static extern void StartLightweightCdl();
 	[DllImport(DllPath)] public static extern void StopLightweightCdl();
 	[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool IsLightweightCdlActive();
+	[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool ExportLightweightCdl([MarshalAs(UnmanagedType.LPUTF8Str)] string path);
+	[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool MergeLightweightCdl([MarshalAs(UnmanagedType.LPUTF8Str)] string path);
+	[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool StartMemoryHeatmap([MarshalAs(UnmanagedType.LPUTF8Str)] string path);
+	[DllImport(DllPath)] public static extern void StopMemoryHeatmap();
 
 	[DllImport(DllPath)] public static extern void ResumeExecution();
 	[DllImport(DllPath)] public static extern void Step(CpuType cpuType, Int32 instructionCount, StepType type = StepType.Step);
@@ -48,6 +52,9 @@ public sealed class DebugApi {
 		return rows;
 	}
 
+	/// <summary>Batched state fetch, use <see cref="DebugSnapshot"/></summary>
+	[DllImport(DllPath)] internal static extern void GetDebugSnapshot([In, Out] InteropDebugSnapshotItem[] items, UInt32 itemCount, IntPtr buffer, UInt32 bufferSize);
+
 	public static UInt32 GetExecutionTraceSize() {
 		return DebugApi.GetExecutionTraceWrapper(IntPtr.Zero, 0, DebugApi.TraceLogBufferSize);
 	}
@@ -187,7 +194,18 @@ public sealed class DebugApi {
 		return Utf8Utilities.CallStringApi((ptr, len) => GetScriptLogWrapper(scriptId, ptr, len), 100000);
 	}
 
+	[DllImport(DllPath)] public static extern ScriptProfileSummary GetScriptProfileSummary(Int32 scriptId);
+	[DllImport(DllPath, EntryPoint = "GetScriptCallbackProfiles")] private static extern UInt32 GetScriptCallbackProfilesWrapper(Int32 scriptId, [In, Out] ScriptCallbackProfile[] profiles, UInt32 maxCount);
+	public static ScriptCallbackProfile[] GetScriptCallbackProfiles(Int32 scriptId) {
+		ScriptCallbackProfile[] profiles = new ScriptCallbackProfile[500];
+		UInt32 count = DebugApi.GetScriptCallbackProfilesWrapper(scriptId, profiles, (UInt32)profiles.Length);
+		Array.Resize(ref profiles, (int)count);
+		return profiles;
+	}
+
 	[DllImport(DllPath)] public static extern Int64 EvaluateExpression([MarshalAs(UnmanagedType.LPUTF8Str)] string expression, CpuType cpuType, out EvalResultType resultType, [MarshalAs(UnmanagedType.I1)] bool useCache);
+	[DllImport(DllPath)] public static extern void SetWatchExpressions(CpuType cpuType, [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPUTF8Str)] string[] expressions, UInt32 count);
+	[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool EvaluateWatchExpressions(CpuType cpuType, [In, Out] Int64[] values, [In, Out] EvalResultType[] resultTypes, UInt32 count);
 
 	[DllImport(DllPath)] public static extern DebuggerFeatures GetDebuggerFeatures(CpuType type);
 	[DllImport(DllPath)] public static extern CpuInstructionProgress GetInstructionProgress(CpuType type);
@@ -213,6 +231,7 @@ public sealed class DebugApi {
 	[DllImport(DllPath)] public static extern AddressInfo GetRelativeAddress(AddressInfo absAddress, CpuType cpuType);
 
 	[DllImport(DllPath)] public static extern void SetLabel(uint address, MemoryType memType, [MarshalAs(UnmanagedType.LPUTF8Str)] string label, [MarshalAs(UnmanagedType.LPUTF8Str)] string comment);
+	[DllImport(DllPath)] public static extern void SetLabels(UInt32 count, UInt32[] addresses, MemoryType[] memTypes, [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPUTF8Str)] string[] labels, [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPUTF8Str)] string[] comments);
 	[DllImport(DllPath)] public static extern void ClearLabels();
 
 	[DllImport(DllPath)] public static extern void SetBreakpoints([MarshalAs(UnmanagedType.LPArray, SizeParamIndex = 1)] InteropBreakpoint[] breakpoints, UInt32 length);
@@ -270,6 +289,33 @@ public sealed class DebugApi {
 		DebugApi.GetMemoryStateWrapper(type, dst);
 	}
 
+	[DllImport(DllPath)] public static extern void MemorySearchReset(MemoryType type);
+	[DllImport(DllPath)] public static extern void MemorySearchRefresh();
+	[DllImport(DllPath)] public static extern UInt32 MemorySearchAddFilter(InteropMemorySearchFilter filter);
+	[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool MemorySearchUndo();
+	[DllImport(DllPath)] [return: MarshalAs(UnmanagedType.I1)] public static extern bool MemorySearchCanUndo();
+	[DllImport(DllPath)] public static extern UInt32 GetMemorySearchResultCount();
+
+	[DllImport(DllPath, EntryPoint = "GetMemorySearchResults")] private static extern UInt32 GetMemorySearchResultsWrapper(UInt32 start, [In, Out] int[] results, UInt32 maxCount);
+	public static int[] GetMemorySearchResults() {
+		int[] results = new int[DebugApi.GetMemorySearchResultCount()];
+		UInt32 count = DebugApi.GetMemorySearchResultsWrapper(0, results, (UInt32)results.Length);
+		if (count != results.Length) {
+			Array.Resize(ref results, (int)count);
+		}
+		return results;
+	}
+
+	[DllImport(DllPath, EntryPoint = "GetMemorySearchSnapshot")] private static extern UInt32 GetMemorySearchSnapshotWrapper(MemorySearchSnapshot type, [In, Out] byte[] buffer, UInt32 size);
+	public static byte[] GetMemorySearchSnapshot(MemorySearchSnapshot type, MemoryType memType) {
+		byte[] buffer = new byte[DebugApi.GetMemorySize(memType)];
+		UInt32 length = DebugApi.GetMemorySearchSnapshotWrapper(type, buffer, (UInt32)buffer.Length);
+		if (length != buffer.Length) {
+			Array.Resize(ref buffer, (int)length);
+		}
+		return buffer;
+	}
+
 	[DllImport(DllPath)] private static extern DebugTilemapInfo GetTilemap(CpuType cpuType, InteropGetTilemapOptions options, IntPtr state, IntPtr ppuToolsState, byte[] vram, UInt32[] palette, IntPtr outputBuffer);
 	public unsafe static DebugTilemapInfo GetTilemap(CpuType cpuType, GetTilemapOptions options, BaseState state, BaseState ppuToolsState, byte[] vram, UInt32[] palette, IntPtr outputBuffer) {
 		Debug.Assert(state.GetType().IsValueType);
@@ -317,7 +363,7 @@ public sealed class DebugApi {
 		return info.Row >= 0 ? info : null;
 	}
 
-	[DllImport(DllPath)] public static extern void GetTileView(CpuType cpuType, GetTileViewOptions options, byte[] source, int srcSize, UInt32[] palette, IntPtr buffer);
+	[DllImport(DllPath)] public static extern void GetTileView(CpuType cpuType, GetTileViewOptions options, byte[] source, int srcSize, UInt32[] palette, int paletteSize, IntPtr buffer);
 
 	[DllImport(DllPath)] private static extern DebugSpritePreviewInfo GetSpritePreviewInfo(CpuType cpuType, GetSpritePreviewOptions options, IntPtr state, IntPtr ppuToolsState);
 	public unsafe static DebugSpritePreviewInfo GetSpritePreviewInfo(CpuType cpuType, GetSpritePreviewOptions options, BaseState state, BaseState ppuToolsState) {
@@ -420,6 +466,7 @@ public sealed class DebugApi {
 	}
 
 	[DllImport(DllPath)] public static extern void ResetProfiler(CpuType type);
+	[DllImport(DllPath)] public static extern void SetProfilerBackgroundMode(CpuType type, [MarshalAs(UnmanagedType.I1)] bool enabled);
 	[DllImport(DllPath, EntryPoint = "GetProfilerData")] private static extern void GetProfilerDataWrapper(CpuType type, IntPtr profilerData, ref UInt32 functionCount);
 	public static unsafe int GetProfilerData(CpuType type, ref ProfiledFunction[] profilerData) {
 		UInt32 functionCount = 0;
@@ -505,6 +552,19 @@ public sealed class DebugApi {
 		return functions;
 	}
 
+	[DllImport(DllPath)] private static extern UInt32 GetCdlChangedPages(MemoryType memType, UInt32 token, IntPtr pages, UInt32 maxCount, out UInt32 nextToken);
+	/// <summary>Returns the indexes of the 4KB CDL pages changed since the previous call (token 0 = all pages)</summary>
+	public unsafe static UInt32[] GetCdlChangedPages(MemoryType memType, ref UInt32 token) {
+		UInt32[] pages = new UInt32[Math.Max(1, (DebugApi.GetMemorySize(memType) + 0xFFF) >> 12)];
+		UInt32 count;
+		fixed (UInt32* pagesPtr = pages) {
+			count = DebugApi.GetCdlChangedPages(memType, token, (IntPtr)pagesPtr, (UInt32)pages.Length, out token);
+		}
+
+		Array.Resize(ref pages, (int)count);
+		return pages;
+	}
+
 	[DllImport(DllPath, EntryPoint = "AssembleCode")] private static extern UInt32 AssembleCodeWrapper(CpuType cpuType, [MarshalAs(UnmanagedType.LPUTF8Str)] string code, UInt32 startAddress, [In, Out] Int16[] assembledCodeBuffer);
 	public static Int16[] AssembleCode(CpuType cpuType, string code, UInt32 startAddress) {
 		code = code.Replace(Environment.NewLine, "\n");
@@ -1572,6 +1632,43 @@ public struct CdlStatistics {
 	public UInt32 TotalChrBytes;
 }
 
+public enum ScriptEventType {
+	Nmi,
+	Irq,
+	StartFrame,
+	EndFrame,
+	Reset,
+	ScriptEnded,
+	InputPolled,
+	StateLoaded,
+	StateSaved,
+	CodeBreak
+}
+
+public struct ScriptCallbackProfile {
+	/// <summary>0 = read, 1 = write, 2 = exec (memory callbacks), -1 = event callback</summary>
+	public Int32 Type;
+	public ScriptEventType Event;
+	public MemoryType MemType;
+	public UInt32 StartAddress;
+	public UInt32 EndAddress;
+	public UInt64 CallCount;
+	public double TotalTime;
+	public double MaxTime;
+}
+
+public struct ScriptProfileSummary {
+	public UInt64 FrameCount;
+	public UInt64 FramesOverBudget;
+	public double LastFrameTime;
+	public double MaxFrameTime;
+	public double TotalTime;
+	public UInt64 FramesSkipped;
+	public double LastGcTime;
+	public double MaxGcTime;
+	public double TotalGcTime;
+}
+
 public struct ProfiledFunction {
 	public UInt64 ExclusiveCycles;
 	public UInt64 InclusiveCycles;
@@ -1626,6 +1723,28 @@ public unsafe struct TraceRow {
 	}
 }
 
+/// <summary>
+/// Snapshots kept by the native memory search (must match the native <c>MemorySearchSnapshot</c> enum).
+/// </summary>
+public enum MemorySearchSnapshot {
+	Current,
+	PreviousRefresh,
+	LastSearch
+}
+
+/// <summary>
+/// Interop structure for a memory search filter.
+/// The layout must match the native <c>MemorySearchFilter</c> structure exactly.
+/// </summary>
+public struct InteropMemorySearchFilter {
+	public Nexen.Debugger.ViewModels.MemorySearchValueSize ValueSize;
+	public Nexen.Debugger.ViewModels.MemorySearchFormat Format;
+	public Nexen.Debugger.ViewModels.MemorySearchCompareTo CompareTo;
+	public Nexen.Debugger.ViewModels.MemorySearchOperator Operator;
+	public Int64 SpecificValue;
+	public UInt32 SpecificAddress;
+}
+
 public struct DisassemblySearchOptions {
 	[MarshalAs(UnmanagedType.I1)] public bool MatchCase;
 	[MarshalAs(UnmanagedType.I1)] public bool MatchWholeWord;
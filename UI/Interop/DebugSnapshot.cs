@@ -0,0 +1,164 @@
+using System;
+using System.Collections.Generic;
+using System.Runtime.InteropServices;
+
+namespace Nexen.Interop;
+/// <summary>
+/// Data fetched by a debug snapshot item (must match the native <c>DebugSnapshotItemType</c> enum).
+/// </summary>
+public enum DebugSnapshotItemType : byte {
+	CpuState,
+	PpuState,
+	ConsoleState,
+	ProgramCounter,
+	InstructionProgress,
+	Memory,
+	Callstack,
+	ExecutionTrace
+}
+
+/// <summary>
+/// Interop structure for one entry of a debug snapshot request.
+/// The layout must match the native <c>DebugSnapshotItem</c> structure exactly.
+/// </summary>
+public struct InteropDebugSnapshotItem {
+	public DebugSnapshotItemType Type;
+	public CpuType Cpu;
+	public MemoryType MemType;
+	public ConsoleType Console;
+	public UInt32 Start;
+	public UInt32 Length;
+	public UInt32 Offset;
+	public UInt32 Size;
+}
+
+/// <summary>
+/// Batched debugger state request: fetches all of its items (CPU/PPU/console states, memory ranges, callstack...)
+/// with a single call to the core, instead of one call (and one debugger lock) per value.
+/// </summary>
+/// <remarks>
+/// <para>
+/// Build the request once (each Add method returns the item's index), then call <see cref="Fetch"/> on every refresh
+/// and read the items back with the Get methods. The buffer is allocated once and reused between fetches.
+/// </para>
+/// <para>
+/// The emulation is only paused (once, for the whole snapshot) when the request contains a callstack or execution trace item.
+/// </para>
+/// </remarks>
+public sealed class DebugSnapshot {
+	private const int MaxCallstackSize = 512;
+
+	private readonly List<InteropDebugSnapshotItem> _itemList = new();
+	private InteropDebugSnapshotItem[] _items = [];
+	private byte[] _buffer = [];
+	private int _bufferSize = 0;
+
+	public int AddCpuState<T>(CpuType cpuType) where T : struct, BaseState {
+		return Add(new() { Type = DebugSnapshotItemType.CpuState, Cpu = cpuType, Length = (UInt32)Marshal.SizeOf<T>() });
+	}
+
+	public int AddPpuState<T>(CpuType cpuType) where T : struct, BaseState {
+		return Add(new() { Type = DebugSnapshotItemType.PpuState, Cpu = cpuType, Length = (UInt32)Marshal.SizeOf<T>() });
+	}
+
+	public int AddConsoleState<T>(ConsoleType consoleType) where T : struct, BaseState {
+		return Add(new() { Type = DebugSnapshotItemType.ConsoleState, Console = consoleType, Length = (UInt32)Marshal.SizeOf<T>() });
+	}
+
+	public int AddProgramCounter(CpuType cpuType, bool getInstPc) {
+		return Add(new() { Type = DebugSnapshotItemType.ProgramCounter, Cpu = cpuType, Start = getInstPc ? 1u : 0u, Length = sizeof(UInt32) });
+	}
+
+	public int AddInstructionProgress(CpuType cpuType) {
+		return Add(new() { Type = DebugSnapshotItemType.InstructionProgress, Cpu = cpuType, Length = (UInt32)Marshal.SizeOf<CpuInstructionProgress>() });
+	}
+
+	public int AddMemory(MemoryType memType, UInt32 start, UInt32 length) {
+		return Add(new() { Type = DebugSnapshotItemType.Memory, MemType = memType, Start = start, Length = length });
+	}
+
+	public int AddCallstack(CpuType cpuType) {
+		return Add(new() { Type = DebugSnapshotItemType.Callstack, Cpu = cpuType, Length = (UInt32)(Marshal.SizeOf<StackFrameInfo>() * MaxCallstackSize) });
+	}
+
+	public unsafe int AddExecutionTrace(UInt32 startOffset, UInt32 maxRowCount) {
+		return Add(new() { Type = DebugSnapshotItemType.ExecutionTrace, Start = startOffset, Length = (UInt32)(sizeof(TraceRow) * maxRowCount) });
+	}
+
+	private int Add(InteropDebugSnapshotItem item) {
+		// The core requires 8-byte aligned offsets
+		item.Offset = (UInt32)((_bufferSize + 7) & ~7);
+		_bufferSize = (int)(item.Offset + item.Length);
+		_itemList.Add(item);
+		_items = _itemList.ToArray();
+		return _items.Length - 1;
+	}
+
+	/// <summary>
+	/// Fetches every item of the request from the core.
+	/// </summary>
+	public unsafe void Fetch() {
+		if (_buffer.Length != _bufferSize) {
+			_buffer = new byte[_bufferSize];
+		}
+		fixed (byte* ptr = _buffer) {
+			DebugApi.GetDebugSnapshot(_items, (UInt32)_items.Length, (IntPtr)ptr, (UInt32)_bufferSize);
+		}
+	}
+
+	/// <summary>
+	/// Returns true if the item was fetched by the last <see cref="Fetch"/> call (e.g false if the CPU isn't running).
+	/// </summary>
+	public bool IsValid(int index) {
+		return _items[index].Size > 0;
+	}
+
+	public unsafe T GetState<T>(int index) where T : struct, BaseState {
+		if (!IsValid(index)) {
+			return new T();
+		}
+		fixed (byte* ptr = &_buffer[_items[index].Offset]) {
+			return Marshal.PtrToStructure<T>((IntPtr)ptr);
+		}
+	}
+
+	public UInt32 GetProgramCounter(int index) {
+		return IsValid(index) ? BitConverter.ToUInt32(_buffer, (int)_items[index].Offset) : 0;
+	}
+
+	public unsafe CpuInstructionProgress GetInstructionProgress(int index) {
+		if (!IsValid(index)) {
+			return new CpuInstructionProgress();
+		}
+		fixed (byte* ptr = &_buffer[_items[index].Offset]) {
+			return Marshal.PtrToStructure<CpuInstructionProgress>((IntPtr)ptr);
+		}
+	}
+
+	/// <summary>
+	/// Copies the item's memory range into dst (resized if needed).
+	/// </summary>
+	public void GetMemory(int index, ref byte[] dst) {
+		int size = (int)_items[index].Length;
+		if (dst.Length != size) {
+			Array.Resize(ref dst, size);
+		}
+		if (IsValid(index)) {
+			Array.Copy(_buffer, _items[index].Offset, dst, 0, size);
+		} else {
+			Array.Clear(dst);
+		}
+	}
+
+	public StackFrameInfo[] GetCallstack(int index) {
+		return MemoryMarshal.Cast<byte, StackFrameInfo>(GetData(index)).ToArray();
+	}
+
+	public TraceRow[] GetExecutionTrace(int index) {
+		return MemoryMarshal.Cast<byte, TraceRow>(GetData(index)).ToArray();
+	}
+
+	private Span<byte> GetData(int index) {
+		return _buffer.AsSpan((int)_items[index].Offset, (int)_items[index].Size);
+	}
+}
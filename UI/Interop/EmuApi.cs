@@ -34,6 +34,8 @@ public sealed class EmuApi {
 	}
 
 	[DllImport(DllPath)] public static extern IntPtr RegisterNotificationCallback(NotificationListener.NotificationCallback callback);
+	/// <summary>Register a callback that receives the frequent notifications (PpuFrameDone) from a dispatch thread instead of the emulation thread</summary>
+	[DllImport(DllPath)] public static extern IntPtr RegisterQueuedNotificationCallback(NotificationListener.NotificationCallback callback);
 	[DllImport(DllPath)] public static extern void UnregisterNotificationCallback(IntPtr notificationListener);
 
 	[DllImport(DllPath)] public static extern void InitializeEmu([MarshalAs(UnmanagedType.LPUTF8Str)] string homeFolder, IntPtr windowHandle, IntPtr dxViewerHandle, [MarshalAs(UnmanagedType.I1)] bool useSoftwareRenderer, [MarshalAs(UnmanagedType.I1)] bool noAudio, [MarshalAs(UnmanagedType.I1)] bool noVideo, [MarshalAs(UnmanagedType.I1)] bool noInput);
@@ -73,6 +75,7 @@ public sealed class EmuApi {
 	[DllImport(DllPath)] public static extern void SetExclusiveFullscreenMode([MarshalAs(UnmanagedType.I1)] bool fullscreen, IntPtr windowHandle);
 
 	[DllImport(DllPath)] public static extern TimingInfo GetTimingInfo(CpuType cpuType);
+	[DllImport(DllPath)] public static extern AudioStatistics GetAudioStatistics();
 
 	[DllImport(DllPath)] public static extern double GetAspectRatio();
 	[DllImport(DllPath)] public static extern FrameInfo GetBaseScreenSize();
@@ -96,6 +99,11 @@ public sealed class EmuApi {
 
 	[DllImport(DllPath)] public static extern IntPtr GetArchiveRomList([MarshalAs(UnmanagedType.LPUTF8Str)] string filename, IntPtr outFileList, Int32 maxLength);
 
+	/// <summary>Converts a CUE/BIN disc to a compressed disc image (.ncd)</summary>
+	[DllImport(DllPath)]
+	[return: MarshalAs(UnmanagedType.I1)]
+	public static extern bool CompressDiscImage([MarshalAs(UnmanagedType.LPUTF8Str)] string cueFile, [MarshalAs(UnmanagedType.LPUTF8Str)] string outFile);
+
 	[DllImport(DllPath)] public static extern void SaveState(UInt32 stateIndex);
 	[DllImport(DllPath)] public static extern void LoadState(UInt32 stateIndex);
 	[DllImport(DllPath)] public static extern void SaveStateFile([MarshalAs(UnmanagedType.LPUTF8Str)] string filepath);
@@ -118,6 +126,92 @@ public sealed class EmuApi {
 	/// <returns>True if the state was loaded successfully.</returns>
 	[DllImport(DllPath)] public static extern bool LoadStateFromMemory(IntPtr data, Int32 size);
 
+	// ========== TAS Greenzone API ==========
+
+	/// <summary>
+	/// Configure the native greenzone (savestate cache keyed by input frame). Disabling it drops every state.
+	/// </summary>
+	[DllImport(DllPath)] public static extern void SetGreenzoneOptions(GreenzoneOptions options);
+
+	/// <summary>
+	/// Seek to an input frame: loads the closest greenzone state before it and replays the remaining frames
+	/// without rendering. Asynchronous, the SeekPending flag of GetGreenzoneInfo() is cleared once the emulation thread processed it.
+	/// </summary>
+	[DllImport(DllPath)] public static extern void GreenzoneSeek(UInt32 frame);
+
+	/// <summary>
+	/// Drop the greenzone states that depend on the input of a frame (every state after it), after an edit.
+	/// </summary>
+	[DllImport(DllPath)] public static extern void GreenzoneInvalidate(UInt32 firstChangedFrame);
+
+	[DllImport(DllPath)] public static extern void GreenzoneClear();
+
+	// ========== Branch Exploration API ==========
+
+	/// <summary>
+	/// Clone the current game and state into headless worker emulators (0 = one worker per core).
+	/// Call again to restart the exploration from the current state.
+	/// </summary>
+	[DllImport(DllPath)] public static extern bool BranchExplorerInitialize(UInt32 workerCount);
+
+	[DllImport(DllPath, EntryPoint = "BranchExplorerRun")]
+	private static extern UInt32 BranchExplorerRunWrapper([In, MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPUTF8Str)] string[] sequences, UInt32 sequenceCount, [In] BranchWatch[] watches, UInt32 watchCount, UInt32 extraFrames, [Out] byte[] outValues, [Out] UInt64[] outHashes);
+
+	/// <summary>
+	/// Run each input sequence (movie format input lines) from the state given to BranchExplorerInitialize, in parallel.
+	/// Returns the watched memory values (all watches back to back, for each sequence) and their hash, per sequence.
+	/// </summary>
+	public static (byte[] values, UInt64[] hashes) BranchExplorerRun(string[] sequences, BranchWatch[] watches, UInt32 extraFrames) {
+		int valueSize = 0;
+		foreach (BranchWatch watch in watches) {
+			valueSize += (int)watch.Length;
+		}
+
+		byte[] values = new byte[valueSize * sequences.Length];
+		UInt64[] hashes = new UInt64[sequences.Length];
+		EmuApi.BranchExplorerRunWrapper(sequences, (UInt32)sequences.Length, watches, (UInt32)watches.Length, extraFrames, values, hashes);
+		return (values, hashes);
+	}
+
+	[DllImport(DllPath)] public static extern void BranchExplorerRelease();
+
+	// ========== Frame Profiler API ==========
+
+	/// <summary>
+	/// Measure where the time goes in each frame (also enabled while the debug stats overlay is shown).
+	/// </summary>
+	[DllImport(DllPath)] public static extern void SetFrameProfilerEnabled([MarshalAs(UnmanagedType.I1)] bool enabled);
+
+	/// <summary>
+	/// Time spent in each stage over the last frames, in ms per frame (indexed by ProfilerStage).
+	/// </summary>
+	[DllImport(DllPath)] public static extern void GetFrameProfilerStats(out FrameProfilerStats stats);
+
+	/// <summary>
+	/// Frame pacing (frame limiter) statistics over the last 120 frames, in ms.
+	/// </summary>
+	[DllImport(DllPath)] public static extern void GetFramePacingStats(out FramePacingStats stats);
+
+	[DllImport(DllPath, EntryPoint = "GetMemoryUsage")]
+	private static extern UInt32 GetMemoryUsageWrapper([Out] InteropMemoryUsageEntry[] outEntries, UInt32 maxCount);
+
+	/// <summary>
+	/// Get the memory footprint of the emulator's subsystems, as a tree flattened depth-first
+	/// (first entry = total, children follow their parent with Depth + 1).
+	/// </summary>
+	/// <param name="maxCount">Maximum number of entries to return</param>
+	public static MemoryUsageEntry[] GetMemoryUsage(int maxCount = 256) {
+		InteropMemoryUsageEntry[] interopArray = new InteropMemoryUsageEntry[maxCount];
+		UInt32 count = GetMemoryUsageWrapper(interopArray, (UInt32)maxCount);
+
+		MemoryUsageEntry[] result = new MemoryUsageEntry[count];
+		for (int i = 0; i < count; i++) {
+			result[i] = new MemoryUsageEntry(interopArray[i]);
+		}
+		return result;
+	}
+	[DllImport(DllPath)] public static extern void GetGreenzoneInfo(out GreenzoneInfo info);
+
 	// ========== Timestamped Save State API ==========
 
 	[DllImport(DllPath, EntryPoint = "SaveTimestampedState")]
@@ -284,11 +378,113 @@ public struct TimingInfo {
 	public UInt32 CycleCount;
 }
 
+public struct AudioStatistics {
+	public double AverageLatency;
+	public double CurrentLatency;
+	public UInt32 BufferUnderrunEventCount;
+	public UInt32 BufferSize;
+	public UInt32 RecordingDropCount;
+
+	public double ResampleTime;
+	public double MixTime;
+	public double OutputLatencyP50;
+	public double OutputLatencyP95;
+	public double OutputLatencyP99;
+	public double OutputLatencyMax;
+}
+
 public struct FrameInfo {
 	public UInt32 Width;
 	public UInt32 Height;
 }
 
+public struct GreenzoneOptions {
+	[MarshalAs(UnmanagedType.I1)] public bool Enabled;
+	public UInt32 Interval;
+	public UInt32 RecentCount;
+	public UInt64 MemoryBudget;
+}
+
+public struct BranchWatch {
+	public MemoryType Type;
+	public UInt32 Address;
+	public UInt32 Length;
+}
+
+public enum ProfilerStage {
+	Emulation,
+	Ppu,
+	Apu,
+	Coprocessor,
+	Audio,
+	Script,
+	RunAheadSave,
+	RunAheadLoad,
+	Rewind,
+	FrameLimiter,
+	VideoFilter,
+	Hud,
+	Count
+}
+
+public struct FrameProfilerStats {
+	[MarshalAs(UnmanagedType.ByValArray, SizeConst = (int)ProfilerStage.Count)] public double[] Average;
+	[MarshalAs(UnmanagedType.ByValArray, SizeConst = (int)ProfilerStage.Count)] public double[] Max;
+	public UInt32 FrameCount;
+}
+
+public struct FramePacingStats {
+	public double TargetFrameTime;
+	public double AverageFrameTime;
+	public double StdDeviation;
+	public double MinFrameTime;
+	public double MaxFrameTime;
+	public double WakeupSlack;
+	public double AverageSpin;
+	public UInt32 LateFrames;
+	public UInt32 FrameCount;
+}
+
+public struct GreenzoneInfo {
+	public UInt32 StateCount;
+	public UInt32 CompressedCount;
+	public UInt64 MemoryUsage;
+	public UInt32 FirstFrame;
+	public UInt32 LastFrame;
+	[MarshalAs(UnmanagedType.I1)] public bool SeekPending;
+}
+
+/// <summary>
+/// Interop struct for marshaling memory usage tree nodes from native code.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public struct InteropMemoryUsageEntry {
+	[MarshalAs(UnmanagedType.ByValArray, SizeConst = 64)]
+	public byte[] Name;
+	public UInt64 Bytes;
+	public UInt32 Depth;
+}
+
+/// <summary>
+/// Memory used by a subsystem (or part of one).
+/// </summary>
+public sealed class MemoryUsageEntry {
+	/// <summary>Subsystem/buffer name</summary>
+	public string Name { get; set; } = "";
+
+	/// <summary>Memory used in bytes, including the children</summary>
+	public ulong Bytes { get; set; }
+
+	/// <summary>Depth in the tree (0 = total)</summary>
+	public int Depth { get; set; }
+
+	public MemoryUsageEntry(InteropMemoryUsageEntry interop) {
+		Name = Utf8Utilities.GetStringFromArray(interop.Name);
+		Bytes = interop.Bytes;
+		Depth = (int)interop.Depth;
+	}
+}
+
 public enum RomFormat {
 	Unknown,
 
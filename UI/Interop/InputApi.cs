@@ -25,6 +25,11 @@ public sealed class InputApi {
 
 	[DllImport(DllPath)] public static extern void ResetLagCounter();
 
+	/// <summary>
+	/// Time between host input events (keyboard/mouse, evdev gamepads) and the emulated input polls that read them, in ms.
+	/// </summary>
+	[DllImport(DllPath)] public static extern LatencyPercentiles GetInputLatency();
+
 	[DllImport(DllPath)][return: MarshalAs(UnmanagedType.I1)] public static extern bool HasControlDevice(ControllerType type);
 
 	[DllImport(DllPath)] public static extern SystemMouseState GetSystemMouseState(IntPtr rendererHandle);
@@ -214,6 +219,18 @@ public struct ControllerStateInterop {
 	public byte[] StateBytes;
 }
 
+/// <summary>
+/// Percentiles of a latency measurement window, in milliseconds.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public struct LatencyPercentiles {
+	public double P50;
+	public double P95;
+	public double P99;
+	public double Max;
+	public double Average;
+}
+
 public enum CursorImage {
 	Hidden,
 	Arrow,
@@ -7,7 +7,7 @@ namespace Nexen.Interop;
 public sealed class NetplayApi {
 	private const string DllPath = EmuApi.DllName;
 
-	[DllImport(DllPath)] public static extern void StartServer(UInt16 port, [MarshalAs(UnmanagedType.LPUTF8Str)] string password);
+	[DllImport(DllPath)] public static extern void StartServer(UInt16 port, [MarshalAs(UnmanagedType.LPUTF8Str)] string password, UInt32 rollbackFrames, [MarshalAs(UnmanagedType.I1)] bool useUdp);
 	[DllImport(DllPath)] public static extern void StopServer();
 	[DllImport(DllPath)][return: MarshalAs(UnmanagedType.I1)] public static extern bool IsServerRunning();
 	[DllImport(DllPath)] public static extern void Connect([MarshalAs(UnmanagedType.LPUTF8Str)] string host, UInt16 port, [MarshalAs(UnmanagedType.LPUTF8Str)] string password, [MarshalAs(UnmanagedType.I1)] bool spectator);
@@ -14,7 +14,9 @@ public sealed class NotificationListener : IDisposable {
 
 	private bool _forHistoryViewer;
 
-	public NotificationListener(bool forHistoryViewer = false) {
+	/// <param name="forHistoryViewer">Listen to the history viewer's emulator instead of the main one</param>
+	/// <param name="queued">Receive PpuFrameDone from the core's dispatch thread (doesn't block the emulation thread, may skip frames)</param>
+	public NotificationListener(bool forHistoryViewer = false, bool queued = false) {
 		_forHistoryViewer = forHistoryViewer;
 		_callback = (int type, IntPtr parameter) => this.ProcessNotification(type, parameter);
 
@@ -22,7 +24,11 @@ public sealed class NotificationListener : IDisposable {
 			return;
 		}
 
-		_notificationListener = _forHistoryViewer ? HistoryApi.HistoryViewerRegisterNotificationCallback(_callback) : EmuApi.RegisterNotificationCallback(_callback);
+		if (_forHistoryViewer) {
+			_notificationListener = HistoryApi.HistoryViewerRegisterNotificationCallback(_callback);
+		} else {
+			_notificationListener = queued ? EmuApi.RegisterQueuedNotificationCallback(_callback) : EmuApi.RegisterNotificationCallback(_callback);
+		}
 	}
 
 	public void Dispose() {
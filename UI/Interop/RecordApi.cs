@@ -18,6 +18,10 @@ class RecordApi {
 	[DllImport(DllPath)] public static extern void WaveStop();
 	[DllImport(DllPath)][return: MarshalAs(UnmanagedType.I1)] public static extern bool WaveIsRecording();
 
+	[DllImport(DllPath)][return: MarshalAs(UnmanagedType.I1)] public static extern bool SharedMemoryExportStart([MarshalAs(UnmanagedType.LPUTF8Str)] string name);
+	[DllImport(DllPath)] public static extern void SharedMemoryExportStop();
+	[DllImport(DllPath)][return: MarshalAs(UnmanagedType.I1)] public static extern bool SharedMemoryExportIsActive();
+
 	[DllImport(DllPath)] public static extern void MoviePlay([MarshalAs(UnmanagedType.LPUTF8Str)] string filename);
 	[DllImport(DllPath)] public static extern void MovieRecord(RecordMovieOptions options);
 	[DllImport(DllPath)] public static extern void MovieStop();
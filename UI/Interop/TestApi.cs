@@ -10,8 +10,9 @@ class TestApi {
 	private const string DllPath = EmuApi.DllName;
 
 	[DllImport(DllPath)] public static extern RomTestResult RunRecordedTest([MarshalAs(UnmanagedType.LPUTF8Str)] string filename, [MarshalAs(UnmanagedType.I1)] bool inBackground);
+	[DllImport(DllPath)] public static extern void RunRecordedTests([In, MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPUTF8Str)] string[] filenames, UInt32 count, [Out] RomTestResult[] results, UInt32 threadCount);
 	[DllImport(DllPath)] public static extern UInt64 RunTest([MarshalAs(UnmanagedType.LPUTF8Str)] string filename, int address, MemoryType memType);
-	[DllImport(DllPath)] public static extern void RomTestRecord([MarshalAs(UnmanagedType.LPUTF8Str)] string filename, [MarshalAs(UnmanagedType.I1)] bool reset);
+	[DllImport(DllPath)] public static extern void RomTestRecord([MarshalAs(UnmanagedType.LPUTF8Str)] string filename, [MarshalAs(UnmanagedType.I1)] bool reset, [MarshalAs(UnmanagedType.I1)] bool useFastHash);
 	[DllImport(DllPath)] public static extern void RomTestStop();
 	[DllImport(DllPath)][return: MarshalAs(UnmanagedType.I1)] public static extern bool RomTestRecording();
 }
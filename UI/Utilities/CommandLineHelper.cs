@@ -28,6 +28,7 @@ public sealed class CommandLineHelper {
 	public bool LoadLastSessionRequested { get; private set; }
 	public string? MovieToRecord { get; private set; } = null;
 	public int TestRunnerTimeout { get; private set; } = 100;
+	public string? SharedMemoryExportName { get; private set; } = null;
 	public List<string> LuaScriptsToLoad { get; private set; } = new();
 	public List<string> FilesToLoad { get; private set; } = new();
 
@@ -87,6 +88,12 @@ public sealed class CommandLineHelper {
 							if (int.TryParse(values[1], out int timeout)) {
 								TestRunnerTimeout = timeout;
 							}
+						} else if (switchArg.StartsWith("sharedmemoryexport=")) {
+							//keep the name's case, external readers open it by name
+							string name = ConvertArg(arg).Substring("sharedmemoryexport=".Length);
+							if (!string.IsNullOrWhiteSpace(name)) {
+								SharedMemoryExportName = name;
+							}
 						} else {
 							if (!ConfigManager.ProcessSwitch(switchArg)) {
 								_errorMessages.Add(ResourceHelper.GetMessage("InvalidArgument", arg));
@@ -102,6 +109,11 @@ public sealed class CommandLineHelper {
 	}
 
 	public void OnAfterInit(MainWindow wnd) {
+		if (SharedMemoryExportName is not null) {
+			RecordApi.SharedMemoryExportStart(SharedMemoryExportName);
+			SharedMemoryExportName = null;
+		}
+
 		if (Fullscreen && FilesToLoad.Count == 0) {
 			wnd.ToggleFullscreen();
 			Fullscreen = false;
@@ -61,7 +61,7 @@ public sealed class FileDialogHelper {
 						"*.sfc", "*.fig", "*.smc", "*.bs", "*.st", "*.spc",
 						"*.nes", "*.fds", "*.qd", "*.unif", "*.unf", "*.studybox", "*.nsf", "*.nsfe",
 						"*.gb", "*.gbc", "*.gbx", "*.gbs",
-						"*.pce", "*.sgx", "*.cue", "*.hes",
+						"*.pce", "*.sgx", "*.cue", "*.ncd", "*.hes",
 						"*.sms", "*.gg", "*.sg", "*.col",
 						"*.gba",
 						"*.lnx", "*.lyx", "*.o", "*.atari-lynx",
@@ -74,7 +74,7 @@ public sealed class FileDialogHelper {
 					filter.Add(new FilePickerFileType("NES ROM files") { Patterns = new List<string>() { "*.nes", "*.fds", "*.qd", "*.unif", "*.unf", "*.studybox", "*.nsf", "*.nsfe" } });
 					filter.Add(new FilePickerFileType("GB ROM files") { Patterns = new List<string>() { "*.gb", "*.gbc", "*.gbx", "*.gbs" } });
 					filter.Add(new FilePickerFileType("GBA ROM files") { Patterns = new List<string>() { "*.gba" } });
-					filter.Add(new FilePickerFileType("PC Engine ROM files") { Patterns = new List<string>() { "*.pce", "*.sgx", "*.cue", "*.hes" } });
+					filter.Add(new FilePickerFileType("PC Engine ROM files") { Patterns = new List<string>() { "*.pce", "*.sgx", "*.cue", "*.ncd", "*.hes" } });
 					filter.Add(new FilePickerFileType("SMS / GG ROM files") { Patterns = new List<string>() { "*.sms", "*.gg" } });
 					filter.Add(new FilePickerFileType("SG-1000 ROM files") { Patterns = new List<string>() { "*.sg" } });
 					filter.Add(new FilePickerFileType("ColecoVision ROM files") { Patterns = new List<string>() { "*.col" } });
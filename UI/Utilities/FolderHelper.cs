@@ -12,7 +12,7 @@ public static class FolderHelper {
 			".sfc", ".smc", ".fig", ".swc", ".bs", ".st",
 	".gb", ".gbc", ".gbx",
 	".nes", ".unif", ".unf", ".fds", ".qd", ".studybox",
-	".pce", ".sgx", ".cue",
+	".pce", ".sgx", ".cue", ".ncd",
 	".sms", ".gg", ".sg", ".col",
 	".gba",
 	".ws", ".wsc"
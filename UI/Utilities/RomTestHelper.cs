@@ -40,18 +40,19 @@ public static class RomTestHelper {
 
 	public static void RecordTest() {
 		string filename = Path.Join(ConfigManager.TestFolder, EmuApi.GetRomInfo().GetRomName() + ".mtp");
-		TestApi.RomTestRecord(filename, true);
+		TestApi.RomTestRecord(filename, true, true);
 	}
 
 	public static void RunAllTests() {
 		Task.Run(() => {
-			ConcurrentDictionary<string, RomTestResult> results = new();
+			Dictionary<string, RomTestResult> results = new();
 
 			List<string> testFiles = Directory.EnumerateFiles(ConfigManager.TestFolder, "*.mtp", SearchOption.AllDirectories).ToList();
-			Parallel.ForEach(testFiles, new ParallelOptions() { MaxDegreeOfParallelism = Environment.ProcessorCount - 2 }, (string testFile) => {
-				string entryName = testFile.Substring(ConfigManager.TestFolder.Length);
-				results[entryName] = TestApi.RunRecordedTest(testFile, true);
-			});
+			RomTestResult[] testResults = new RomTestResult[testFiles.Count];
+			TestApi.RunRecordedTests(testFiles.ToArray(), (UInt32)testFiles.Count, testResults, (UInt32)Math.Max(1, Environment.ProcessorCount - 2));
+			for (int i = 0; i < testFiles.Count; i++) {
+				results[testFiles[i].Substring(ConfigManager.TestFolder.Length)] = testResults[i];
+			}
 
 			EmuApi.WriteLogEntry("==================");
 			List<string> failedTests = [];
@@ -26,7 +26,7 @@ public class NetplayStartServerWindow : NexenWindow {
 
 		Close(true);
 
-		NetplayApi.StartServer(cfg.ServerPort, cfg.ServerPassword);
+		NetplayApi.StartServer(cfg.ServerPort, cfg.ServerPassword, cfg.ServerRollbackFrames, cfg.ServerUseUdp);
 	}
 
 	private void Cancel_OnClick(object sender, RoutedEventArgs e) {
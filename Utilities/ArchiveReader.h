@@ -87,6 +87,15 @@ public:
 	/// <remarks>Pure virtual - must be implemented by derived classes</remarks>
 	virtual bool ExtractFile(const string& filename, vector<uint8_t>& output) = 0;
 
+	/// <summary>
+	/// Get CRC32 of a file from the archive's directory, without extracting it.
+	/// </summary>
+	/// <param name="filename">File path within archive</param>
+	/// <param name="crc">CRC32 of the uncompressed file (output)</param>
+	/// <returns>True if file found and the archive stores its CRC</returns>
+	/// <remarks>Lets ROM matching (netplay, movies, recent games) skip decompressing the file</remarks>
+	virtual bool GetFileCrc32(const string& filename, uint32_t& crc) = 0;
+
 	/// <summary>
 	/// Factory method: auto-detect archive format and create reader.
 	/// </summary>
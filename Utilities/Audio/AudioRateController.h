@@ -0,0 +1,68 @@
+#pragma once
+#include "pch.h"
+
+/// <summary>
+/// Closed-loop controller that tunes the output sample rate to keep the audio device's
+/// buffer at the requested latency.
+/// </summary>
+/// <remarks>
+/// PI controller on the (smoothed) buffer fill level. The proportional term corrects
+/// jitter quickly, the integral term converges on the actual clock ratio between the
+/// emulator and the sound card, so the buffer settles on its target instead of beside it.
+/// That is what allows small latency settings without underruns.
+///
+/// Gains are per second of audio so the behavior does not depend on how often it is updated.
+/// </remarks>
+class AudioRateController {
+public:
+	static constexpr double MaxAdjustment = 0.005;    ///< Max +/- deviation from the nominal rate (0.5%)
+	static constexpr double MaxIntegral = 0.004;      ///< Max clock drift the integral term can compensate
+	static constexpr double ProportionalGain = 0.001; ///< Rate adjustment per ms of latency error
+	static constexpr double IntegralGain = 0.0001;    ///< Rate adjustment per ms of error, per second
+	static constexpr double SmoothingTime = 0.15;     ///< Time constant of the fill level filter, in seconds
+
+private:
+	double _filteredLatency = 0;
+	double _integral = 0;
+	double _rateAdjustment = 1.0;
+	bool _hasLatency = false;
+
+public:
+	void Reset() {
+		_filteredLatency = 0;
+		_integral = 0;
+		_rateAdjustment = 1.0;
+		_hasLatency = false;
+	}
+
+	/// <summary>
+	/// Feed a new buffer fill measurement.
+	/// </summary>
+	/// <param name="latency">Current amount of audio buffered in the device, in ms</param>
+	/// <param name="targetLatency">Requested latency, in ms</param>
+	/// <param name="elapsed">Seconds of audio produced since the previous update</param>
+	/// <returns>Multiplier for the output sample rate (&lt; 1 when too much audio is buffered)</returns>
+	double Update(double latency, double targetLatency, double elapsed) {
+		if (!_hasLatency) {
+			_filteredLatency = latency;
+			_hasLatency = true;
+		} else {
+			_filteredLatency += (latency - _filteredLatency) * (elapsed / (SmoothingTime + elapsed));
+		}
+
+		double error = _filteredLatency - targetLatency;
+		double proportional = error * ProportionalGain;
+
+		// Only integrate while the output isn't saturated, otherwise a large initial error
+		// (e.g. right after startup) winds up the integral and overshoots the target later
+		if (std::abs(proportional + _integral) < MaxAdjustment) {
+			_integral = std::clamp(_integral + error * IntegralGain * elapsed, -MaxIntegral, MaxIntegral);
+		}
+
+		double adjustment = std::clamp(proportional + _integral, -MaxAdjustment, MaxAdjustment);
+		_rateAdjustment = 1.0 - adjustment;
+		return _rateAdjustment;
+	}
+
+	[[nodiscard]] double GetRateAdjustment() const { return _rateAdjustment; }
+};
@@ -2,5 +2,6 @@
 
 class CrossFeedFilter {
 public:
-	void ApplyFilter(int16_t* stereoBuffer, size_t sampleCount, int ratio);
+	/// <summary>Mix ratio% of each channel into the other (interleaved stereo float, unclamped)</summary>
+	void ApplyFilter(float* stereoBuffer, size_t sampleCount, int ratio);
 };
\ No newline at end of file
@@ -2,17 +2,51 @@
 #include "Equalizer.h"
 #include "orfanidis_eq.h"
 
-void Equalizer::ApplyEqualizer(uint32_t sampleCount, int16_t* samples) {
-	double outL, outR;
-	for (uint32_t i = 0; i < sampleCount; i++) {
-		double inL = samples[i * 2];
-		double inR = samples[i * 2 + 1];
+__forceinline void Equalizer::StereoSection::Process(double sample[2]) {
+	// Same operation order as orfanidis_eq's fo_section::df1_fo_process, for both channels at once
+	for (int ch = 0; ch < 2; ch++) {
+		double in = sample[ch];
+		double out = B[0] * in;
+		out += (B[1] * Num[0][ch] - Denum[0][ch] * A[1]);
+		out += (B[2] * Num[1][ch] - Denum[1][ch] * A[2]);
+		out += (B[3] * Num[2][ch] - Denum[2][ch] * A[3]);
+		out += (B[4] * Num[3][ch] - Denum[3][ch] * A[4]);
 
-		_equalizerLeft->sbs_process(&inL, &outL);
-		_equalizerRight->sbs_process(&inR, &outR);
+		Num[3][ch] = Num[2][ch];
+		Num[2][ch] = Num[1][ch];
+		Num[1][ch] = Num[0][ch];
+		// Prevent denormalized values (causes extreme performance loss)
+		Num[0][ch] = (in < 0.000000000001 && in > -0.000000000001) ? 0 : in;
 
-		samples[i * 2] = (int16_t)std::max(std::min(outL, 32767.0), -32768.0);
-		samples[i * 2 + 1] = (int16_t)std::max(std::min(outR, 32767.0), -32768.0);
+		Denum[3][ch] = Denum[2][ch];
+		Denum[2][ch] = Denum[1][ch];
+		Denum[1][ch] = Denum[0][ch];
+		out = (out < 0.000000000001 && out > -0.000000000001) ? 0 : out;
+		Denum[0][ch] = out;
+
+		sample[ch] = out;
+	}
+}
+
+void Equalizer::ApplyEqualizer(uint32_t sampleCount, float* samples) {
+	uint32_t valueCount = sampleCount * 2;
+	_mixBuffer.assign(valueCount, 0.0);
+	double* mix = _mixBuffer.data();
+
+	for (StereoBand& band : _bands) {
+		double gain = band.Gain;
+		for (uint32_t i = 0; i < valueCount; i += 2) {
+			double sample[2] = {samples[i], samples[i + 1]};
+			for (StereoSection& section : band.Sections) {
+				section.Process(sample);
+			}
+			mix[i] += gain * sample[0];
+			mix[i + 1] += gain * sample[1];
+		}
+	}
+
+	for (uint32_t i = 0; i < valueCount; i++) {
+		samples[i] = (float)mix[i];
 	}
 }
 
@@ -27,19 +61,25 @@ void Equalizer::UpdateEqualizers(std::span<const double, 20> bandGains, uint32_t
 			2000, 3000, 4000, 5000, 6000, 7000, 10000, 12500, 13000, 13500
 		};
 
-		_eqFrequencyGrid = std::make_unique<orfanidis_eq::freq_grid>();
+		orfanidis_eq::freq_grid frequencyGrid;
 		for (size_t i = 1; i < bands.size() - 1; i++) {
-			_eqFrequencyGrid->add_band((bands[i] + bands[i - 1]) / 2, bands[i], (bands[i + 1] + bands[i]) / 2);
+			frequencyGrid.add_band((bands[i] + bands[i - 1]) / 2, bands[i], (bands[i + 1] + bands[i]) / 2);
 		}
 
-		_equalizerLeft = std::make_unique<orfanidis_eq::eq1>(_eqFrequencyGrid.get(), orfanidis_eq::filter_type::butterworth);
-		_equalizerRight = std::make_unique<orfanidis_eq::eq1>(_eqFrequencyGrid.get(), orfanidis_eq::filter_type::butterworth);
-		_equalizerLeft->set_sample_rate(sampleRate);
-		_equalizerRight->set_sample_rate(sampleRate);
+		// The orfanidis equalizer is only used to design the filters, the stereo kernel runs them
+		orfanidis_eq::eq1 equalizer(&frequencyGrid, orfanidis_eq::filter_type::butterworth);
+		equalizer.set_sample_rate(sampleRate);
+
+		_bands.clear();
+		for (unsigned int i = 0; i < frequencyGrid.get_number_of_bands(); i++) {
+			equalizer.change_band_gain_db(i, bandGains[i]);
 
-		for (unsigned int i = 0; i < _eqFrequencyGrid->get_number_of_bands(); i++) {
-			_equalizerLeft->change_band_gain_db(i, bandGains[i]);
-			_equalizerRight->change_band_gain_db(i, bandGains[i]);
+			StereoBand& band = _bands.emplace_back();
+			band.Gain = equalizer.get_band_gain(i);
+			for (const orfanidis_eq::fo_section& section : equalizer.get_filter(i)->get_sections()) {
+				StereoSection& stereoSection = band.Sections.emplace_back();
+				section.get_coefficients(stereoSection.B, stereoSection.A);
+			}
 		}
 
 		_prevSampleRate = sampleRate;
@@ -4,16 +4,40 @@
 #include <array>
 #include <span>
 
+/// <summary>
+/// 20-band graphic equalizer (orfanidis butterworth band filters) for interleaved stereo float samples.
+/// </summary>
+/// <remarks>
+/// Both channels use the same coefficients, so each filter section runs the left and right
+/// channel together as a 2-lane kernel (one SSE2/NEON register of doubles). Processing is
+/// done one band at a time over the whole block, which keeps a band's filter state in registers
+/// instead of walking all 20 filter objects for every sample.
+/// </remarks>
 class Equalizer {
 private:
-	unique_ptr<orfanidis_eq::freq_grid> _eqFrequencyGrid;
-	unique_ptr<orfanidis_eq::eq1> _equalizerLeft;
-	unique_ptr<orfanidis_eq::eq1> _equalizerRight;
+	/// <summary>Fourth-order direct form I section shared by both channels</summary>
+	struct StereoSection {
+		double B[5] = {};
+		double A[5] = {};
+		double Num[4][2] = {};
+		double Denum[4][2] = {};
+
+		__forceinline void Process(double sample[2]);
+	};
+
+	struct StereoBand {
+		double Gain = 1.0;
+		vector<StereoSection> Sections;
+	};
+
+	vector<StereoBand> _bands;
+	vector<double> _mixBuffer;
 
 	uint32_t _prevSampleRate = 0;
 	std::array<double, 20> _prevEqualizerGains{};
 
 public:
-	void ApplyEqualizer(uint32_t sampleCount, int16_t* samples);
+	/// <summary>Apply the equalizer in place, no clamping (samples are in int16 scale)</summary>
+	void ApplyEqualizer(uint32_t sampleCount, float* samples);
 	void UpdateEqualizers(std::span<const double, 20> bandGains, uint32_t sampleRate);
 };
@@ -2,12 +2,12 @@
 #include "ReverbFilter.h"
 
 void ReverbFilter::ResetFilter() {
-	for (int i = 0; i < 5; i++) {
+	for (int i = 0; i < 10; i++) {
 		_delay[i].Reset();
 	}
 }
 
-void ReverbFilter::ApplyFilter(int16_t* stereoBuffer, size_t sampleCount, uint32_t sampleRate, double reverbStrength, double reverbDelay) {
+void ReverbFilter::ApplyFilter(float* stereoBuffer, size_t sampleCount, uint32_t sampleRate, double reverbStrength, double reverbDelay) {
 	for (int i = 0; i < 2; i++) {
 		_delay[i * 5].SetParameters(550 * reverbDelay, 0.25 * reverbStrength, sampleRate);
 		_delay[i * 5 + 1].SetParameters(330 * reverbDelay, 0.15 * reverbStrength, sampleRate);
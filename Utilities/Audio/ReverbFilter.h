@@ -6,10 +6,11 @@
 /// Single reverb delay line using a fixed-size circular buffer.
 /// Replaces std::deque per-sample push/pop with O(1) ring buffer
 /// operations for cache-friendly contiguous memory access.
+/// Works on one channel of an interleaved stereo float buffer (int16 scale, unclamped).
 /// </summary>
 class ReverbDelay {
 private:
-	std::vector<int16_t> _ringBuffer;
+	std::vector<float> _ringBuffer;
 	uint32_t _writePos = 0;
 	uint32_t _readPos = 0;
 	uint32_t _count = 0;
@@ -17,6 +18,10 @@ private:
 	uint32_t _delay = 0;
 	double _decay = 0;
 
+	__forceinline uint32_t Advance(uint32_t pos) {
+		return ++pos == _capacity ? 0 : pos;
+	}
+
 public:
 	void SetParameters(double delay, double decay, int32_t sampleRate) {
 		uint32_t delaySampleCount = (uint32_t)(delay / 1000 * sampleRate);
@@ -41,25 +46,25 @@ public:
 		}
 	}
 
-	void AddSamples(int16_t* buffer, size_t sampleCount) {
-		for (size_t i = 0; i < sampleCount; i++) {
-			if (_count < _capacity) {
-				_ringBuffer[_writePos] = buffer[i * 2];
-				_writePos = (_writePos + 1) % _capacity;
-				_count++;
-			}
+	void AddSamples(float* buffer, size_t sampleCount) {
+		size_t samplesToAdd = std::min<size_t>(_capacity - _count, sampleCount);
+		for (size_t i = 0; i < samplesToAdd; i++) {
+			_ringBuffer[_writePos] = buffer[i * 2];
+			_writePos = Advance(_writePos);
 		}
+		_count += (uint32_t)samplesToAdd;
 	}
 
-	void ApplyReverb(int16_t* buffer, size_t sampleCount) {
+	void ApplyReverb(float* buffer, size_t sampleCount) {
 		if (_count > _delay) {
 			size_t samplesToInsert = std::min<size_t>(_count - _delay, sampleCount);
+			float decay = (float)_decay;
 
 			for (size_t j = sampleCount - samplesToInsert; j < sampleCount; j++) {
-				buffer[j * 2] += (int16_t)((double)_ringBuffer[_readPos] * _decay);
-				_readPos = (_readPos + 1) % _capacity;
-				_count--;
+				buffer[j * 2] += _ringBuffer[_readPos] * decay;
+				_readPos = Advance(_readPos);
 			}
+			_count -= (uint32_t)samplesToInsert;
 		}
 	}
 };
@@ -70,5 +75,5 @@ private:
 
 public:
 	void ResetFilter();
-	void ApplyFilter(int16_t* stereoBuffer, size_t sampleCount, uint32_t sampleRate, double reverbStrength, double reverbDelay);
+	void ApplyFilter(float* stereoBuffer, size_t sampleCount, uint32_t sampleRate, double reverbStrength, double reverbDelay);
 };
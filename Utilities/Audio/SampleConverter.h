@@ -0,0 +1,27 @@
+#pragma once
+#include "pch.h"
+
+/// <summary>
+/// Conversions between int16 PCM and the float buffers used by SoundMixer's effect chain.
+/// </summary>
+/// <remarks>
+/// Floats keep the int16 scale (no normalization), so effects can reuse their int16 tuning and
+/// intermediate results can exceed the int16 range without clipping. The loops are branch-free
+/// and auto-vectorize (SSE2/NEON) in release builds.
+/// </remarks>
+class SampleConverter {
+public:
+	static void ToFloat(const int16_t* in, float* out, size_t count) {
+		for (size_t i = 0; i < count; i++) {
+			out[i] = in[i];
+		}
+	}
+
+	/// <summary>Apply gain, round and saturate to int16 (the only clamp in the chain)</summary>
+	static void ToInt16(const float* in, int16_t* out, size_t count, float gain) {
+		for (size_t i = 0; i < count; i++) {
+			float sample = std::clamp(in[i] * gain, -32768.0f, 32767.0f);
+			out[i] = (int16_t)(sample < 0 ? sample - 0.5f : sample + 0.5f);
+		}
+	}
+};
@@ -0,0 +1,223 @@
+#include "pch.h"
+#include "SincResampler.h"
+#include <cmath>
+
+namespace {
+	constexpr double Pi = 3.14159265358979323846;
+	constexpr uint32_t LaneCount = 4;
+
+	// Zeroth-order modified Bessel function of the first kind, for the Kaiser window
+	double BesselI0(double x) {
+		double sum = 1.0;
+		double term = 1.0;
+		for (int k = 1; k < 50; k++) {
+			term *= (x / (2 * k)) * (x / (2 * k));
+			sum += term;
+			if (term < sum * 1e-12) {
+				break;
+			}
+		}
+		return sum;
+	}
+}
+
+SincResampler::SincResampler(uint32_t tapCount) {
+	_tapCount = tapCount <= 16 ? 16 : 32;
+
+	// Longer filters get a steeper transition band and a stronger stopband
+	_kaiserBeta = tapCount >= 32 ? 9.0 : 7.0;
+	_rolloff = tapCount >= 32 ? 0.92 : 0.85;
+
+	_left.resize(_tapCount);
+	_right.resize(_tapCount);
+	BuildKernel(_rolloff);
+}
+
+void SincResampler::BuildKernel(double cutoff) {
+	_cutoff = cutoff;
+
+	// Each row holds the taps of one phase, followed by the difference to the next phase's taps
+	_kernel.resize(PhaseCount * _tapCount * 2);
+
+	vector<double> row(_tapCount);
+	vector<double> nextRow(_tapCount);
+	double half = _tapCount / 2.0;
+	double windowScale = 1.0 / BesselI0(_kaiserBeta);
+
+	auto buildRow = [&](uint32_t phase, vector<double>& taps) {
+		double fraction = (double)phase / PhaseCount;
+		double sum = 0;
+		for (uint32_t k = 0; k < _tapCount; k++) {
+			// Distance (in input samples) between tap k and the interpolated position
+			double x = (half - 1 + fraction) - k;
+			double sinc = x == 0 ? 1.0 : std::sin(Pi * cutoff * x) / (Pi * cutoff * x);
+			double ratio = x / half;
+			double window = ratio > -1 && ratio < 1 ? BesselI0(_kaiserBeta * std::sqrt(1 - ratio * ratio)) * windowScale : 0;
+			taps[k] = sinc * window;
+			sum += taps[k];
+		}
+
+		// Unity gain at DC for every phase
+		for (uint32_t k = 0; k < _tapCount; k++) {
+			taps[k] /= sum;
+		}
+	};
+
+	buildRow(0, row);
+	for (uint32_t phase = 0; phase < PhaseCount; phase++) {
+		buildRow(phase + 1, nextRow);
+		float* out = &_kernel[phase * _tapCount * 2];
+		for (uint32_t k = 0; k < _tapCount; k++) {
+			out[k] = (float)row[k];
+			out[_tapCount + k] = (float)(nextRow[k] - row[k]);
+		}
+		row.swap(nextRow);
+	}
+}
+
+void SincResampler::Reset() {
+	_left.assign(_tapCount, 0.0f);
+	_right.assign(_tapCount, 0.0f);
+	_position = 0.0;
+	_lastLeft = 0;
+	_lastRight = 0;
+	_pendingSamples.clear();
+}
+
+void SincResampler::SetVolume(double volume) {
+	_volume = (int32_t)(volume * 256);
+}
+
+void SincResampler::SetSampleRates(double srcRate, double dstRate) {
+	_rateRatio = srcRate / dstRate;
+
+	// Band-limit to the output rate when downsampling. Small changes (dynamic rate control)
+	// keep the current kernel, the rolloff leaves more than enough margin below nyquist.
+	double cutoff = std::min(1.0, dstRate / srcRate) * _rolloff;
+	if (std::abs(cutoff - _cutoff) > _cutoff * 0.02) {
+		BuildKernel(cutoff);
+	}
+}
+
+uint32_t SincResampler::GetPendingCount() {
+	return (uint32_t)_pendingSamples.size() / 2;
+}
+
+template <uint32_t TapCount>
+void SincResampler::Interpolate(uint32_t start, double fraction, int16_t& outLeft, int16_t& outRight) {
+	float scaledFraction = (float)(fraction * PhaseCount);
+	uint32_t phase = std::min((uint32_t)scaledFraction, PhaseCount - 1);
+	float weight = scaledFraction - phase;
+
+	const float* taps = &_kernel[phase * TapCount * 2];
+	const float* deltas = taps + TapCount;
+	const float* left = &_left[start];
+	const float* right = &_right[start];
+
+	float coeffs[TapCount];
+	for (uint32_t k = 0; k < TapCount; k++) {
+		coeffs[k] = taps[k] + weight * deltas[k];
+	}
+
+	// 4 independent lanes per channel, so the loops vectorize without reordering a single sum.
+	// One loop per channel and kept out of line: GCC -O3 scalarizes the combined/inlined version.
+	float sumLeft[LaneCount] = {};
+	float sumRight[LaneCount] = {};
+	for (uint32_t k = 0; k < TapCount; k += LaneCount) {
+		for (uint32_t j = 0; j < LaneCount; j++) {
+			sumLeft[j] += coeffs[k + j] * left[k + j];
+		}
+	}
+	for (uint32_t k = 0; k < TapCount; k += LaneCount) {
+		for (uint32_t j = 0; j < LaneCount; j++) {
+			sumRight[j] += coeffs[k + j] * right[k + j];
+		}
+	}
+
+	float leftValue = (sumLeft[0] + sumLeft[1]) + (sumLeft[2] + sumLeft[3]);
+	float rightValue = (sumRight[0] + sumRight[1]) + (sumRight[2] + sumRight[3]);
+
+	leftValue = std::clamp(leftValue, -32768.0f, 32767.0f);
+	rightValue = std::clamp(rightValue, -32768.0f, 32767.0f);
+	outLeft = (int16_t)(leftValue < 0 ? leftValue - 0.5f : leftValue + 0.5f);
+	outRight = (int16_t)(rightValue < 0 ? rightValue - 0.5f : rightValue + 0.5f);
+}
+
+template <uint32_t TapCount, bool addMode>
+uint32_t SincResampler::Filter(uint32_t length, int16_t* out, uint32_t outPos, uint32_t maxOutSampleCount) {
+	while ((uint32_t)_position + TapCount <= length) {
+		uint32_t start = (uint32_t)_position;
+		Interpolate<TapCount>(start, _position - start, _lastLeft, _lastRight);
+		if (outPos <= maxOutSampleCount - 2) {
+			WriteSample<addMode>(out, outPos, _lastLeft, _lastRight);
+			outPos += 2;
+		} else {
+			_pendingSamples.push_back(_lastLeft);
+			_pendingSamples.push_back(_lastRight);
+		}
+		_position += _rateRatio;
+	}
+	return outPos;
+}
+
+template <bool addMode>
+void SincResampler::WriteSample(int16_t* out, uint32_t pos, int16_t left, int16_t right) {
+	if (addMode) {
+		out[pos] = (int16_t)std::clamp<int32_t>(out[pos] + ((left * _volume) >> 8), INT16_MIN, INT16_MAX);
+		out[pos + 1] = (int16_t)std::clamp<int32_t>(out[pos + 1] + ((right * _volume) >> 8), INT16_MIN, INT16_MAX);
+	} else {
+		out[pos] = (int16_t)std::clamp<int32_t>((left * _volume) >> 8, INT16_MIN, INT16_MAX);
+		out[pos + 1] = (int16_t)std::clamp<int32_t>((right * _volume) >> 8, INT16_MIN, INT16_MAX);
+	}
+}
+
+template <bool addMode>
+uint32_t SincResampler::Resample(int16_t* in, uint32_t inSampleCount, int16_t* out, size_t maxOutSampleCount, bool fillToMax) {
+	maxOutSampleCount *= 2;
+	if (_pendingSamples.size() >= maxOutSampleCount) {
+		_pendingSamples.clear();
+	}
+
+	uint32_t outPos = (uint32_t)_pendingSamples.size();
+	for (uint32_t i = 0; i < outPos; i += 2) {
+		WriteSample<addMode>(out, i, _pendingSamples[i], _pendingSamples[i + 1]);
+	}
+	_pendingSamples.clear();
+
+	if (inSampleCount > 0) {
+		// Append the new samples after the history kept from the previous call
+		uint32_t length = _tapCount + inSampleCount;
+		_left.resize(length);
+		_right.resize(length);
+		for (uint32_t i = 0; i < inSampleCount; i++) {
+			_left[_tapCount + i] = in[i * 2];
+			_right[_tapCount + i] = in[i * 2 + 1];
+		}
+
+		if (_tapCount == 16) {
+			outPos = Filter<16, addMode>(length, out, outPos, (uint32_t)maxOutSampleCount);
+		} else {
+			outPos = Filter<32, addMode>(length, out, outPos, (uint32_t)maxOutSampleCount);
+		}
+
+		// Keep the last _tapCount samples as history for the next call
+		uint32_t consumed = length - _tapCount;
+		std::copy(_left.begin() + consumed, _left.end(), _left.begin());
+		std::copy(_right.begin() + consumed, _right.end(), _right.begin());
+		_left.resize(_tapCount);
+		_right.resize(_tapCount);
+		_position -= consumed;
+	}
+
+	if (fillToMax) {
+		while (outPos < maxOutSampleCount) {
+			WriteSample<addMode>(out, outPos, _lastLeft, _lastRight);
+			outPos += 2;
+		}
+	}
+
+	return outPos / 2;
+}
+
+template uint32_t SincResampler::Resample<true>(int16_t* in, uint32_t inSampleCount, int16_t* out, size_t maxOutSampleCount, bool fillToMax);
+template uint32_t SincResampler::Resample<false>(int16_t* in, uint32_t inSampleCount, int16_t* out, size_t maxOutSampleCount, bool fillToMax);
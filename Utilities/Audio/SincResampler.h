@@ -0,0 +1,66 @@
+#pragma once
+#include "pch.h"
+
+/// <summary>
+/// Polyphase windowed-sinc stereo resampler.
+/// </summary>
+/// <remarks>
+/// Same interface as HermiteResampler. The kernel is a Kaiser-windowed sinc stored as a
+/// table of PhaseCount + 1 phases that is linearly interpolated, so any (and continuously
+/// changing) rate ratio can be used without rebuilding it. The cutoff follows the output
+/// rate when downsampling, which removes the aliasing the Hermite path lets through.
+///
+/// The taps are processed in groups of 4 independent lanes (no intrinsics), which the
+/// compiler turns into SSE/AVX/NEON multiply-adds.
+/// </remarks>
+class SincResampler {
+public:
+	static constexpr uint32_t PhaseCount = 128;
+
+private:
+	uint32_t _tapCount;
+	double _kaiserBeta;
+	double _rolloff;
+	double _cutoff = 0;
+
+	vector<float> _kernel;
+
+	// Last _tapCount input samples, followed by the samples of the current call
+	vector<float> _left;
+	vector<float> _right;
+
+	int32_t _volume = 256;
+	double _rateRatio = 1.0;
+	double _position = 0.0;
+
+	int16_t _lastLeft = 0;
+	int16_t _lastRight = 0;
+
+	vector<int16_t> _pendingSamples = []{ vector<int16_t> v; v.reserve(256); return v; }();
+
+	void BuildKernel(double cutoff);
+	template <uint32_t TapCount>
+	__noinline void Interpolate(uint32_t start, double fraction, int16_t& outLeft, int16_t& outRight);
+
+	template <uint32_t TapCount, bool addMode>
+	uint32_t Filter(uint32_t length, int16_t* out, uint32_t outPos, uint32_t maxOutSampleCount);
+
+	template <bool addMode>
+	void WriteSample(int16_t* out, uint32_t pos, int16_t left, int16_t right);
+
+public:
+	/// <param name="tapCount">Filter length in input samples (16 or 32)</param>
+	SincResampler(uint32_t tapCount = 32);
+
+	void Reset();
+
+	void SetVolume(double volume);
+	void SetSampleRates(double srcRate, double dstRate);
+	uint32_t GetPendingCount();
+
+	/// <summary>Delay added by the filter, in input samples</summary>
+	[[nodiscard]] uint32_t GetLatency() const { return _tapCount / 2; }
+
+	template <bool addMode>
+	uint32_t Resample(int16_t* in, uint32_t inSampleCount, int16_t* out, size_t maxOutSampleCount, bool fillToMax = false);
+};
@@ -42,6 +42,18 @@ EXPORT void blip_clear(blip_t*);
 /** Adds positive/negative delta into buffer at specified clock time. */
 EXPORT void blip_add_delta(blip_t*, unsigned int clock_time, int delta);
 
+/** Timestamped delta for blip_add_deltas(). */
+typedef struct blip_delta_t {
+	unsigned int time;
+	int delta;
+} blip_delta_t;
+
+/** Same as calling blip_add_delta() for each entry (the output is bit-identical),
+without a call per delta. Lets an APU queue its changes for a scanline or frame
+and submit them at once. Keeping each buffer's deltas in time order (the order
+they are produced in) keeps the writes local. */
+void blip_add_deltas(blip_t*, blip_delta_t const deltas[], int count);
+
 /** Same as blip_add_delta(), but uses faster, lower-quality synthesis. */
 void blip_add_delta_fast(blip_t*, unsigned int clock_time, int delta);
 
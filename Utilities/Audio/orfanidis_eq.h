@@ -385,6 +385,20 @@ public:
 		return df1_fo_process(in);
 	}
 
+	// Coefficients for callers running their own (e.g. multi-channel) section implementation
+	void get_coefficients(eq_single_t b[5], eq_single_t a[5]) const {
+		b[0] = b0;
+		b[1] = b1;
+		b[2] = b2;
+		b[3] = b3;
+		b[4] = b4;
+		a[0] = a0;
+		a[1] = a1;
+		a[2] = a2;
+		a[3] = a3;
+		a[4] = a4;
+	}
+
 	virtual fo_section get() {
 		return *this;
 	}
@@ -471,6 +485,7 @@ public:
 	virtual ~bp_filter() {}
 
 	virtual eq_single_t process(eq_single_t in) = 0;
+	virtual const std::vector<fo_section>& get_sections() const = 0;
 };
 
 class butterworth_bp_filter : public bp_filter {
@@ -543,6 +558,10 @@ public:
 		return bw_gain;
 	}
 
+	const std::vector<fo_section>& get_sections() const override {
+		return sections_;
+	}
+
 	virtual eq_single_t process(eq_single_t in) {
 		eq_single_t p0 = in;
 		eq_single_t p1 = 0;
@@ -628,6 +647,10 @@ public:
 		return bw_gain;
 	}
 
+	const std::vector<fo_section>& get_sections() const override {
+		return sections_;
+	}
+
 	eq_single_t process(eq_single_t in) {
 		eq_single_t p0 = in;
 		eq_single_t p1 = 0;
@@ -710,6 +733,10 @@ public:
 		return bw_gain;
 	}
 
+	const std::vector<fo_section>& get_sections() const override {
+		return sections_;
+	}
+
 	eq_single_t process(eq_single_t in) {
 		eq_single_t p0 = in;
 		eq_single_t p1 = 0;
@@ -752,6 +779,14 @@ public:
 	}
 	~eq1() { cleanup_filters_array(); }
 
+	const bp_filter* get_filter(unsigned int band_number) const {
+		return filters_[band_number];
+	}
+
+	eq_single_t get_band_gain(unsigned int band_number) const {
+		return band_gains_[band_number];
+	}
+
 	eq_error_t set_eq(freq_grid& fg, filter_type eqt) {
 		band_gains_.clear();
 		cleanup_filters_array();
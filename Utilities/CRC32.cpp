@@ -4,6 +4,16 @@
 #include "pch.h"
 
 #include "CRC32.h"
+#include "Utilities/CpuFeatures.h"
+
+#ifdef NEXEN_ARCH_X86
+#include <immintrin.h>
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define NEXEN_ARM_CRC32 1
+#endif
 
 const size_t MaxSlice = 16;
 extern const uint32_t Crc32Lookup[MaxSlice][256];
@@ -35,12 +45,132 @@ extern const uint32_t Crc32Lookup[MaxSlice][256];
 #define __BYTE_ORDER __LITTLE_ENDIAN
 #endif
 
-uint32_t CRC32::GetCRC(uint8_t* buffer, std::streamoff length) {
-	return crc32_16bytes(buffer, length, 0);
+#ifdef NEXEN_ARCH_X86
+// Folds 64 bytes per iteration with carry-less multiplications, then reduces to 32 bits (Barrett reduction).
+// From Intel's "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction", with the bit-reflected
+// constants of the zlib polynomial. length must be >= 64 and a multiple of 16, crc is the non-finalized CRC.
+NEXEN_TARGET("pclmul,sse4.1")
+static inline __m128i crc32_fold(__m128i value, __m128i next, __m128i k) {
+	__m128i low = _mm_clmulepi64_si128(value, k, 0x00);
+	__m128i high = _mm_clmulepi64_si128(value, k, 0x11);
+	return _mm_xor_si128(_mm_xor_si128(high, next), low);
+}
+
+NEXEN_TARGET("pclmul,sse4.1")
+static uint32_t crc32_pclmul(const uint8_t* buffer, size_t length, uint32_t crc) {
+	alignas(16) static constexpr uint64_t k1k2[] = {0x0154442bd4, 0x01c6e41596};
+	alignas(16) static constexpr uint64_t k3k4[] = {0x01751997d0, 0x00ccaa009e};
+	alignas(16) static constexpr uint64_t k5k0[] = {0x0163cd6124, 0x0000000000};
+	alignas(16) static constexpr uint64_t poly[] = {0x01db710641, 0x01f7011641};
+
+	__m128i x1 = _mm_loadu_si128((const __m128i*)(buffer + 0x00));
+	__m128i x2 = _mm_loadu_si128((const __m128i*)(buffer + 0x10));
+	__m128i x3 = _mm_loadu_si128((const __m128i*)(buffer + 0x20));
+	__m128i x4 = _mm_loadu_si128((const __m128i*)(buffer + 0x30));
+	x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+
+	__m128i x0 = _mm_load_si128((const __m128i*)k1k2);
+	buffer += 64;
+	length -= 64;
+
+	// Fold 4x128 bits in parallel
+	while (length >= 64) {
+		__m128i x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+		__m128i x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+		__m128i x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+		__m128i x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+
+		x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+		x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+		x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+		x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128((const __m128i*)(buffer + 0x00)));
+		x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128((const __m128i*)(buffer + 0x10)));
+		x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128((const __m128i*)(buffer + 0x20)));
+		x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128((const __m128i*)(buffer + 0x30)));
+
+		buffer += 64;
+		length -= 64;
+	}
+
+	// Fold into 128 bits
+	x0 = _mm_load_si128((const __m128i*)k3k4);
+	x1 = crc32_fold(x1, x2, x0);
+	x1 = crc32_fold(x1, x3, x0);
+	x1 = crc32_fold(x1, x4, x0);
+
+	// Fold the remaining 16-byte blocks
+	while (length >= 16) {
+		x1 = crc32_fold(x1, _mm_loadu_si128((const __m128i*)buffer), x0);
+		buffer += 16;
+		length -= 16;
+	}
+
+	// Fold 128 bits to 64 bits
+	x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+	x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+	x1 = _mm_srli_si128(x1, 8);
+	x1 = _mm_xor_si128(x1, x2);
+
+	x0 = _mm_loadl_epi64((const __m128i*)k5k0);
+	x2 = _mm_srli_si128(x1, 4);
+	x1 = _mm_and_si128(x1, x3);
+	x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+
+	// Barrett reduction to 32 bits
+	x0 = _mm_load_si128((const __m128i*)poly);
+	x2 = _mm_and_si128(x1, x3);
+	x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+	x2 = _mm_and_si128(x2, x3);
+	x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+
+	return (uint32_t)_mm_extract_epi32(x1, 1);
+}
+#endif
+
+#ifdef NEXEN_ARM_CRC32
+// The ARMv8 CRC32 instructions use the zlib polynomial (unlike x86's crc32, which is CRC-32C)
+static uint32_t crc32_armv8(const uint8_t* buffer, size_t length, uint32_t crc) {
+	while (length >= 8) {
+		uint64_t value;
+		memcpy(&value, buffer, sizeof(value));
+		crc = __crc32d(crc, value);
+		buffer += 8;
+		length -= 8;
+	}
+	while (length-- != 0) {
+		crc = __crc32b(crc, *buffer++);
+	}
+	return crc;
+}
+#endif
+
+uint32_t CRC32::Compute(const uint8_t* data, size_t length) {
+#if defined(NEXEN_ARCH_X86)
+	if (length >= 64 && CpuFeatures::HasPclmul()) {
+		size_t blockLength = length & ~(size_t)15;
+		uint32_t crc = ~crc32_pclmul(data, blockLength, ~0u);
+		return crc32_16bytes(data + blockLength, length - blockLength, crc);
+	}
+#elif defined(NEXEN_ARM_CRC32)
+	return ~crc32_armv8(data, length, ~0u);
+#endif
+	return crc32_16bytes(data, length, 0);
+}
+
+uint32_t CRC32::GetCRC(const uint8_t* buffer, std::streamoff length) {
+	return Compute(buffer, (size_t)length);
 }
 
 uint32_t CRC32::GetCRC(vector<uint8_t>& data) {
-	return crc32_16bytes(data.data(), (std::streamoff)data.size(), 0);
+	return Compute(data.data(), data.size());
+}
+
+uint32_t CRC32::GetCRCPortable(const uint8_t* buffer, size_t length) {
+	return crc32_16bytes(buffer, length, 0);
 }
 
 uint32_t CRC32::GetCRC(const string& filename) {
@@ -57,7 +187,7 @@ uint32_t CRC32::GetCRC(const string& filename) {
 		file.read((char*)buffer.data(), fileSize);
 		file.close();
 
-		crc = crc32_16bytes(buffer.data(), fileSize, 0);
+		crc = Compute(buffer.data(), (size_t)fileSize);
 	}
 	return crc;
 }
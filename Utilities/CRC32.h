@@ -6,6 +6,10 @@
 /// All public methods are marked [[nodiscard]] to prevent accidentally discarding checksum results.
 /// Implementation adapted from https://github.com/stbrumme/crc32 (zlib license).
 /// </summary>
+/// <remarks>
+/// Buffers of 64 bytes or more use hardware acceleration when available: PCLMULQDQ folding on x86
+/// (detected at runtime), CRC32 instructions on ARMv8 builds that enable them. The results are identical.
+/// </remarks>
 class CRC32 {
 private:
 	/// <summary>
@@ -18,6 +22,9 @@ private:
 	/// <returns>Updated CRC32 value (NOT finalized - requires XOR with 0xFFFFFFFF)</returns>
 	static uint32_t crc32_16bytes(const void* data, size_t length, uint32_t previousCrc32);
 
+	/// <summary>Calculates the CRC with the fastest implementation supported by the CPU</summary>
+	static uint32_t Compute(const uint8_t* data, size_t length);
+
 public:
 	/// <summary>
 	/// Calculate CRC32 checksum for a memory buffer.
@@ -29,7 +36,7 @@ public:
 	/// Common use cases: ROM validation, save state integrity, patch verification.
 	/// Uses slice-by-16 algorithm for high performance (processes 16 bytes per iteration).
 	/// </remarks>
-	[[nodiscard]] static uint32_t GetCRC(uint8_t* buffer, std::streamoff length);
+	[[nodiscard]] static uint32_t GetCRC(const uint8_t* buffer, std::streamoff length);
 
 	/// <summary>
 	/// Calculate CRC32 checksum for a byte vector.
@@ -53,4 +60,10 @@ public:
 	/// Common use: ROM file verification against known-good checksums.
 	/// </remarks>
 	[[nodiscard]] static uint32_t GetCRC(const string& filename);
+
+	/// <summary>
+	/// Calculate CRC32 checksum with the table-driven implementation only (no hardware acceleration).
+	/// </summary>
+	/// <remarks>Reference for tests and benchmarks</remarks>
+	[[nodiscard]] static uint32_t GetCRCPortable(const uint8_t* buffer, size_t length);
 };
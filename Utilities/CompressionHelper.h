@@ -1,6 +1,7 @@
 #pragma once
 #include "pch.h"
 #include "miniz.h"
+#include <span>
 
 /// <summary>
 /// Compression utilities using miniz library (zlib-compatible deflate algorithm).
@@ -42,16 +43,24 @@ public:
 	/// Allocates temporary buffer (deleted after compression).
 	/// </remarks>
 	static void Compress(const string& data, int compressionLevel, vector<uint8_t>& output) {
-		unsigned long compressedSize = compressBound((unsigned long)data.size());
+		Compress((const uint8_t*)data.data(), data.size(), compressionLevel, output);
+	}
 
-		uint32_t originalSize = (uint32_t)data.size();
+	/// <summary>
+	/// Compress a raw buffer using zlib deflate algorithm.
+	/// </summary>
+	/// <remarks>Same output format as the string overload.</remarks>
+	static void Compress(const uint8_t* data, size_t dataSize, int compressionLevel, vector<uint8_t>& output) {
+		unsigned long compressedSize = compressBound((unsigned long)dataSize);
+
+		uint32_t originalSize = (uint32_t)dataSize;
 		uint32_t headerSize = sizeof(uint32_t) * 2;
 
 		// Pre-size output and compress directly into it (no temp allocation)
 		size_t prevSize = output.size();
 		output.resize(prevSize + headerSize + compressedSize);
 
-		compress2(output.data() + prevSize + headerSize, &compressedSize, (unsigned char*)data.c_str(), (unsigned long)data.size(), compressionLevel);
+		compress2(output.data() + prevSize + headerSize, &compressedSize, data, (unsigned long)dataSize, compressionLevel);
 
 		// Write headers
 		uint32_t size = (uint32_t)compressedSize;
@@ -102,4 +111,23 @@ public:
 
 		return true;
 	}
+
+	/// <summary>
+	/// Decompress data compressed by Compress() into a caller-provided buffer.
+	/// </summary>
+	/// <returns>True if the data was decompressed and its original size matches outputSize</returns>
+	static bool Decompress(std::span<const uint8_t> input, uint8_t* output, uint32_t outputSize) {
+		if (input.size() < sizeof(uint32_t) * 2) {
+			return false;
+		}
+
+		uint32_t decompressedSize;
+		memcpy(&decompressedSize, input.data(), sizeof(uint32_t));
+		if (decompressedSize != outputSize) {
+			return false;
+		}
+
+		unsigned long decompSize = decompressedSize;
+		return uncompress(output, &decompSize, input.data() + sizeof(uint32_t) * 2, (unsigned long)input.size() - sizeof(uint32_t) * 2) == MZ_OK;
+	}
 };
@@ -0,0 +1,46 @@
+#include "pch.h"
+#include "Utilities/CpuFeatures.h"
+
+#ifdef NEXEN_ARCH_X86
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+CpuFeatures::Features CpuFeatures::Detect() {
+	Features features;
+
+#ifdef NEXEN_ARCH_X86
+	uint32_t leaf1[4] = {};
+	uint32_t leaf7[4] = {};
+#ifdef _MSC_VER
+	int info[4] = {};
+	__cpuid(info, 0);
+	int maxLeaf = info[0];
+	__cpuid(info, 1);
+	memcpy(leaf1, info, sizeof(leaf1));
+	if (maxLeaf >= 7) {
+		__cpuidex(info, 7, 0);
+		memcpy(leaf7, info, sizeof(leaf7));
+	}
+#else
+	uint32_t maxLeaf = __get_cpuid_max(0, nullptr);
+	__get_cpuid(1, &leaf1[0], &leaf1[1], &leaf1[2], &leaf1[3]);
+	if (maxLeaf >= 7) {
+		__cpuid_count(7, 0, leaf7[0], leaf7[1], leaf7[2], leaf7[3]);
+	}
+#endif
+
+	bool ssse3 = leaf1[2] & (1 << 9);
+	bool sse41 = leaf1[2] & (1 << 19);
+	bool pclmul = leaf1[2] & (1 << 1);
+	bool sha = leaf7[1] & (1 << 29);
+
+	features.Pclmul = pclmul && sse41;
+	features.Sha = sha && ssse3 && sse41;
+#endif
+
+	return features;
+}
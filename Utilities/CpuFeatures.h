@@ -0,0 +1,43 @@
+#pragma once
+#include "pch.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define NEXEN_ARCH_X86 1
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+// MSVC allows intrinsics in any function
+#define NEXEN_TARGET(features)
+#else
+/// <summary>Compiles a function for CPU extensions that aren't enabled for the whole build (checked at runtime with CpuFeatures)</summary>
+#define NEXEN_TARGET(features) __attribute__((target(features)))
+#endif
+
+/// <summary>
+/// Runtime detection of the CPU extensions used by the optimized hashing code.
+/// </summary>
+/// <remarks>
+/// The build targets the baseline instruction set. Code paths that need newer extensions are compiled with
+/// NEXEN_TARGET and only called when the running CPU supports them. Detection runs once (first call).
+/// </remarks>
+class CpuFeatures {
+private:
+	struct Features {
+		bool Pclmul = false; ///< Carry-less multiply + SSE4.1 (x86)
+		bool Sha = false;    ///< SHA extensions + SSSE3/SSE4.1 (x86)
+	};
+
+	static Features Detect();
+
+	static const Features& Get() {
+		static const Features features = Detect();
+		return features;
+	}
+
+public:
+	/// <summary>PCLMULQDQ and SSE4.1 are available (CRC32 folding)</summary>
+	[[nodiscard]] static bool HasPclmul() { return Get().Pclmul; }
+
+	/// <summary>SHA-NI, SSSE3 and SSE4.1 are available (SHA-1 rounds)</summary>
+	[[nodiscard]] static bool HasSha() { return Get().Sha; }
+};
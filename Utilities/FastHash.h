@@ -0,0 +1,112 @@
+#pragma once
+#include "pch.h"
+
+/// <summary>
+/// Fast non-cryptographic 64-bit hash (XXH64 algorithm).
+/// Used where a digest only needs to detect changes, e.g. per-frame test hashes.
+/// </summary>
+/// <remarks>
+/// Reads 32 bytes per iteration in 4 independent lanes, several times faster than MD5.
+/// Output matches the reference XXH64 implementation (little-endian hosts).
+/// Not suitable for anything security-related.
+/// </remarks>
+class FastHash {
+private:
+	static constexpr uint64_t Prime1 = 0x9E3779B185EBCA87ull;
+	static constexpr uint64_t Prime2 = 0xC2B2AE3D27D4EB4Full;
+	static constexpr uint64_t Prime3 = 0x165667B19E3779F9ull;
+	static constexpr uint64_t Prime4 = 0x85EBCA77C2B2AE63ull;
+	static constexpr uint64_t Prime5 = 0x27D4EB2F165667C5ull;
+
+	__forceinline static uint64_t RotateLeft(uint64_t value, int bits) {
+		return (value << bits) | (value >> (64 - bits));
+	}
+
+	__forceinline static uint64_t Read64(const uint8_t* data) {
+		uint64_t value;
+		memcpy(&value, data, sizeof(value));
+		return value;
+	}
+
+	__forceinline static uint32_t Read32(const uint8_t* data) {
+		uint32_t value;
+		memcpy(&value, data, sizeof(value));
+		return value;
+	}
+
+	__forceinline static uint64_t Round(uint64_t acc, uint64_t input) {
+		acc += input * Prime2;
+		acc = RotateLeft(acc, 31);
+		return acc * Prime1;
+	}
+
+	__forceinline static uint64_t MergeRound(uint64_t acc, uint64_t value) {
+		acc ^= Round(0, value);
+		return acc * Prime1 + Prime4;
+	}
+
+public:
+	/// <summary>
+	/// Hash a memory buffer.
+	/// </summary>
+	/// <param name="data">Data to hash</param>
+	/// <param name="length">Number of bytes</param>
+	/// <param name="seed">Hash seed (0 for the reference default)</param>
+	/// <returns>64-bit hash</returns>
+	[[nodiscard]] static uint64_t Hash(const void* data, size_t length, uint64_t seed = 0) {
+		const uint8_t* p = (const uint8_t*)data;
+		const uint8_t* end = p + length;
+		uint64_t h;
+
+		if (length >= 32) {
+			uint64_t v1 = seed + Prime1 + Prime2;
+			uint64_t v2 = seed + Prime2;
+			uint64_t v3 = seed;
+			uint64_t v4 = seed - Prime1;
+
+			const uint8_t* limit = end - 32;
+			do {
+				v1 = Round(v1, Read64(p));
+				v2 = Round(v2, Read64(p + 8));
+				v3 = Round(v3, Read64(p + 16));
+				v4 = Round(v4, Read64(p + 24));
+				p += 32;
+			} while (p <= limit);
+
+			h = RotateLeft(v1, 1) + RotateLeft(v2, 7) + RotateLeft(v3, 12) + RotateLeft(v4, 18);
+			h = MergeRound(h, v1);
+			h = MergeRound(h, v2);
+			h = MergeRound(h, v3);
+			h = MergeRound(h, v4);
+		} else {
+			h = seed + Prime5;
+		}
+
+		h += (uint64_t)length;
+
+		while (p + 8 <= end) {
+			h ^= Round(0, Read64(p));
+			h = RotateLeft(h, 27) * Prime1 + Prime4;
+			p += 8;
+		}
+
+		if (p + 4 <= end) {
+			h ^= (uint64_t)Read32(p) * Prime1;
+			h = RotateLeft(h, 23) * Prime2 + Prime3;
+			p += 4;
+		}
+
+		while (p < end) {
+			h ^= (*p) * Prime5;
+			h = RotateLeft(h, 11) * Prime1;
+			p++;
+		}
+
+		h ^= h >> 33;
+		h *= Prime2;
+		h ^= h >> 29;
+		h *= Prime3;
+		h ^= h >> 32;
+		return h;
+	}
+};
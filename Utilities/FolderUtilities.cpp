@@ -99,6 +99,12 @@ string FolderUtilities::GetDebuggerFolder() {
 	return folder;
 }
 
+string FolderUtilities::GetPatchCacheFolder() {
+	string folder = CombinePath(GetHomeFolder(), "PatchCache");
+	CreateFolder(folder);
+	return folder;
+}
+
 string FolderUtilities::GetSaveStateFolder() {
 	string folder;
 	if (_saveStateFolderOverride.empty()) {
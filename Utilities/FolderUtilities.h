@@ -17,6 +17,7 @@
 /// - HD Pack folder: High-definition texture packs
 /// - Debugger folder: Debug symbols and labels
 /// - Recent games folder: Recently played games list
+/// - Patch cache folder: Patched ROMs (see PatchedRomCache)
 ///
 /// All folders can be overridden via SetFolderOverrides().
 /// Game folders track known ROM locations for quick access.
@@ -73,6 +74,9 @@ public:
 	/// <summary>Get recent games list folder path</summary>
 	[[nodiscard]] static string GetRecentGamesFolder();
 
+	/// <summary>Get patched ROM cache folder path</summary>
+	[[nodiscard]] static string GetPatchCacheFolder();
+
 	/// <summary>Get list of all subdirectories in folder</summary>
 	/// <param name="rootFolder">Root folder to scan</param>
 	/// <returns>List of subdirectory paths</returns>
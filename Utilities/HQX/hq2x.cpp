@@ -72,7 +72,7 @@
 #define PIXEL11_90  *(dp + dpL + 1) = Interp9(w[5], w[6], w[8]);
 #define PIXEL11_100 *(dp + dpL + 1) = Interp10(w[5], w[6], w[8]);
 
-void HQX_CALLCONV hq2x_32_rb(uint32_t* sp, uint32_t srb, uint32_t* dp, uint32_t drb, int Xres, int Yres) {
+void HQX_CALLCONV hq2x_32_rb(uint32_t* sp, uint32_t srb, uint32_t* dp, uint32_t drb, int Xres, int Yres, int yFirst, int yLast) {
 	int i, j, k;
 	int prevline, nextline;
 	uint32_t w[10];
@@ -93,7 +93,15 @@ void HQX_CALLCONV hq2x_32_rb(uint32_t* sp, uint32_t srb, uint32_t* dp, uint32_t
 	// | w7 | w8 | w9 |
 	// +----+----+----+
 
-	for (j = 0; j < Yres; j++) {
+	// Only process rows [yFirst, yLast) - neighbors are still read from the full image
+	if (yLast > Yres)
+		yLast = Yres;
+	sRowP += srb * yFirst;
+	sp = (uint32_t*)sRowP;
+	dRowP += drb * 2 * yFirst;
+	dp = (uint32_t*)dRowP;
+
+	for (j = yFirst; j < yLast; j++) {
 		if (j > 0)
 			prevline = -spL;
 		else
@@ -77,7 +77,7 @@
 #define PIXEL22_5  *(dp + dpL + dpL + 2) = Interp5(w[6], w[8]);
 #define PIXEL22_C  *(dp + dpL + dpL + 2) = w[5];
 
-void HQX_CALLCONV hq3x_32_rb(uint32_t* sp, uint32_t srb, uint32_t* dp, uint32_t drb, int Xres, int Yres) {
+void HQX_CALLCONV hq3x_32_rb(uint32_t* sp, uint32_t srb, uint32_t* dp, uint32_t drb, int Xres, int Yres, int yFirst, int yLast) {
 	int i, j, k;
 	int prevline, nextline;
 	uint32_t w[10];
@@ -98,7 +98,15 @@ void HQX_CALLCONV hq3x_32_rb(uint32_t* sp, uint32_t srb, uint32_t* dp, uint32_t
 	// | w7 | w8 | w9 |
 	// +----+----+----+
 
-	for (j = 0; j < Yres; j++) {
+	// Only process rows [yFirst, yLast) - neighbors are still read from the full image
+	if (yLast > Yres)
+		yLast = Yres;
+	sRowP += srb * yFirst;
+	sp = (uint32_t*)sRowP;
+	dRowP += drb * 3 * yFirst;
+	dp = (uint32_t*)dRowP;
+
+	for (j = yFirst; j < yLast; j++) {
 		if (j > 0)
 			prevline = -spL;
 		else
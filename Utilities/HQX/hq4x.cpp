@@ -164,7 +164,7 @@
 #define PIXEL33_81 *(dp + dpL + dpL + dpL + 3) = Interp8(w[5], w[6]);
 #define PIXEL33_82 *(dp + dpL + dpL + dpL + 3) = Interp8(w[5], w[8]);
 
-void HQX_CALLCONV hq4x_32_rb(uint32_t* sp, uint32_t srb, uint32_t* dp, uint32_t drb, int Xres, int Yres) {
+void HQX_CALLCONV hq4x_32_rb(uint32_t* sp, uint32_t srb, uint32_t* dp, uint32_t drb, int Xres, int Yres, int yFirst, int yLast) {
 	int i, j, k;
 	int prevline, nextline;
 	uint32_t w[10];
@@ -185,7 +185,15 @@ void HQX_CALLCONV hq4x_32_rb(uint32_t* sp, uint32_t srb, uint32_t* dp, uint32_t
 	// | w7 | w8 | w9 |
 	// +----+----+----+
 
-	for (j = 0; j < Yres; j++) {
+	// Only process rows [yFirst, yLast) - neighbors are still read from the full image
+	if (yLast > Yres)
+		yLast = Yres;
+	sRowP += srb * yFirst;
+	sp = (uint32_t*)sRowP;
+	dRowP += drb * 4 * yFirst;
+	dp = (uint32_t*)dRowP;
+
+	for (j = yFirst; j < yLast; j++) {
 		if (j > 0)
 			prevline = -spL;
 		else
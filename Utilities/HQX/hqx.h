@@ -22,6 +22,7 @@
 #define __HQX_H_
 
 #include <stdint.h>
+#include <limits.h>
 
 #if defined(__GNUC__)
 #ifdef __MINGW32__
@@ -44,14 +45,15 @@
 #endif
 
 void HQX_CALLCONV hqxInit(void);
-void HQX_CALLCONV hqx(uint32_t scale, uint32_t* src, uint32_t* dest, int width, int height);
+// Rows [yFirst, yLast) of the same image can be scaled by separate threads, the output matches a single call
+void HQX_CALLCONV hqx(uint32_t scale, uint32_t* src, uint32_t* dest, int width, int height, int yFirst = 0, int yLast = INT_MAX);
 
 void HQX_CALLCONV hq2x_32(uint32_t* src, uint32_t* dest, int width, int height);
 void HQX_CALLCONV hq3x_32(uint32_t* src, uint32_t* dest, int width, int height);
 void HQX_CALLCONV hq4x_32(uint32_t* src, uint32_t* dest, int width, int height);
 
-void HQX_CALLCONV hq2x_32_rb(uint32_t* src, uint32_t src_rowBytes, uint32_t* dest, uint32_t dest_rowBytes, int width, int height);
-void HQX_CALLCONV hq3x_32_rb(uint32_t* src, uint32_t src_rowBytes, uint32_t* dest, uint32_t dest_rowBytes, int width, int height);
-void HQX_CALLCONV hq4x_32_rb(uint32_t* src, uint32_t src_rowBytes, uint32_t* dest, uint32_t dest_rowBytes, int width, int height);
+void HQX_CALLCONV hq2x_32_rb(uint32_t* src, uint32_t src_rowBytes, uint32_t* dest, uint32_t dest_rowBytes, int width, int height, int yFirst = 0, int yLast = INT_MAX);
+void HQX_CALLCONV hq3x_32_rb(uint32_t* src, uint32_t src_rowBytes, uint32_t* dest, uint32_t dest_rowBytes, int width, int height, int yFirst = 0, int yLast = INT_MAX);
+void HQX_CALLCONV hq4x_32_rb(uint32_t* src, uint32_t src_rowBytes, uint32_t* dest, uint32_t dest_rowBytes, int width, int height, int yFirst = 0, int yLast = INT_MAX);
 
 #endif
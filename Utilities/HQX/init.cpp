@@ -25,28 +25,54 @@ uint32_t YUV1, YUV2;
 
 void HQX_CALLCONV hqxInit(void) {
 	/* Initalize RGB to YUV lookup table */
-	uint32_t c, r, g, b, y, u, v;
-	for (c = 0; c < 16777215; c++) {
-		r = (c & 0xFF0000) >> 16;
-		g = (c & 0x00FF00) >> 8;
-		b = c & 0x0000FF;
-		y = (uint32_t)(0.299 * r + 0.587 * g + 0.114 * b);
-		u = (uint32_t)(-0.169 * r - 0.331 * g + 0.5 * b) + 128;
-		v = (uint32_t)(0.5 * r - 0.419 * g - 0.081 * b) + 128;
-		RGBtoYUV[c] = (y << 16) + (u << 8) + v;
+	// y = 0.299 * r + 0.587 * g + 0.114 * b
+	// u = -0.169 * r - 0.331 * g + 0.5 * b + 128
+	// v = 0.5 * r - 0.419 * g - 0.081 * b + 128
+	// The products are computed once per channel value and the r+g part once per row, the sums are
+	// done in the same order as the formulas above, so the table is identical to evaluating them for every color
+	double yr[256], yg[256], yb[256], ur[256], ug[256], ub[256], vr[256], vg[256], vb[256];
+	for (int i = 0; i < 256; i++) {
+		yr[i] = 0.299 * i;
+		yg[i] = 0.587 * i;
+		yb[i] = 0.114 * i;
+		ur[i] = -0.169 * i;
+		ug[i] = 0.331 * i;
+		ub[i] = 0.5 * i;
+		vr[i] = 0.5 * i;
+		vg[i] = 0.419 * i;
+		vb[i] = 0.081 * i;
 	}
+
+	for (uint32_t r = 0; r < 256; r++) {
+		for (uint32_t g = 0; g < 256; g++) {
+			double yrg = yr[r] + yg[g];
+			double urg = ur[r] - ug[g];
+			double vrg = vr[r] - vg[g];
+			uint32_t* row = RGBtoYUV + ((r << 16) | (g << 8));
+			for (uint32_t b = 0; b < 256; b++) {
+				uint32_t y = (uint32_t)(int32_t)(yrg + yb[b]);
+				uint32_t u = (uint32_t)(int32_t)(urg + ub[b]) + 128;
+				uint32_t v = (uint32_t)(int32_t)(vrg - vb[b]) + 128;
+				row[b] = (y << 16) + (u << 8) + v;
+			}
+		}
+	}
+
+	// The last entry (white) was never initialized by the original loop, keep it that way (hqx's output depends on it)
+	RGBtoYUV[0xFFFFFF] = 0;
 }
 
-void HQX_CALLCONV hqx(uint32_t scale, uint32_t* src, uint32_t* dest, int width, int height) {
+void HQX_CALLCONV hqx(uint32_t scale, uint32_t* src, uint32_t* dest, int width, int height, int yFirst, int yLast) {
+	uint32_t rowBytes = width * 4;
 	switch (scale) {
 		case 2:
-			hq2x_32(src, dest, width, height);
+			hq2x_32_rb(src, rowBytes, dest, rowBytes * 2, width, height, yFirst, yLast);
 			break;
 		case 3:
-			hq3x_32(src, dest, width, height);
+			hq3x_32_rb(src, rowBytes, dest, rowBytes * 3, width, height, yFirst, yLast);
 			break;
 		case 4:
-			hq4x_32(src, dest, width, height);
+			hq4x_32_rb(src, rowBytes, dest, rowBytes * 4, width, height, yFirst, yLast);
 			break;
 	}
 }
\ No newline at end of file
@@ -0,0 +1,103 @@
+#include "pch.h"
+#include "Utilities/MemoryMappedFile.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#include "Utilities/UTF8Util.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MemoryMappedFile::~MemoryMappedFile() {
+	Close();
+}
+
+#ifdef _WIN32
+bool MemoryMappedFile::Open(const string& path) {
+	Close();
+
+	HANDLE file = CreateFileW(utf8::utf8::decode(path).c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+
+	LARGE_INTEGER size = {};
+	if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0 || (uint64_t)size.QuadPart > SIZE_MAX) {
+		CloseHandle(file);
+		return false;
+	}
+
+	HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mapping) {
+		CloseHandle(file);
+		return false;
+	}
+
+	void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (!view) {
+		CloseHandle(mapping);
+		CloseHandle(file);
+		return false;
+	}
+
+	_fileHandle = file;
+	_mappingHandle = mapping;
+	_data = (uint8_t*)view;
+	_size = (size_t)size.QuadPart;
+	return true;
+}
+
+void MemoryMappedFile::Close() {
+	if (_data) {
+		UnmapViewOfFile(_data);
+	}
+	if (_mappingHandle) {
+		CloseHandle((HANDLE)_mappingHandle);
+	}
+	if (_fileHandle) {
+		CloseHandle((HANDLE)_fileHandle);
+	}
+	_data = nullptr;
+	_size = 0;
+	_fileHandle = nullptr;
+	_mappingHandle = nullptr;
+}
+#else
+bool MemoryMappedFile::Open(const string& path) {
+	Close();
+
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0) {
+		return false;
+	}
+
+	struct stat info = {};
+	if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode) || info.st_size <= 0) {
+		close(fd);
+		return false;
+	}
+
+	void* view = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+	// The mapping stays valid after the descriptor is closed
+	close(fd);
+	if (view == MAP_FAILED) {
+		return false;
+	}
+
+	_data = (uint8_t*)view;
+	_size = (size_t)info.st_size;
+	return true;
+}
+
+void MemoryMappedFile::Close() {
+	if (_data) {
+		munmap(_data, _size);
+	}
+	_data = nullptr;
+	_size = 0;
+}
+#endif
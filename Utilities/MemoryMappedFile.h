@@ -0,0 +1,43 @@
+#pragma once
+#include "pch.h"
+#include <span>
+
+/// <summary>
+/// Read-only memory mapping of a file on disk.
+/// </summary>
+/// <remarks>
+/// Lets large uncompressed files (GBA ROMs, CD images, MSU-1 data) be read in place without
+/// copying them into a buffer first. Pages are only read from disk when they are accessed.
+///
+/// The mapping is read-only: writing through GetData() is undefined (access violation).
+/// Empty files can't be mapped, Open() fails for them.
+/// </remarks>
+class MemoryMappedFile {
+private:
+	uint8_t* _data = nullptr; ///< Start of the mapped view
+	size_t _size = 0;         ///< Size of the mapped view, in bytes
+
+#ifdef _WIN32
+	void* _fileHandle = nullptr;    ///< File HANDLE
+	void* _mappingHandle = nullptr; ///< File mapping HANDLE
+#endif
+
+public:
+	MemoryMappedFile() = default;
+	~MemoryMappedFile();
+
+	MemoryMappedFile(const MemoryMappedFile&) = delete;
+	MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+	/// <summary>Maps the whole file (UTF-8 path)</summary>
+	/// <returns>True if the file was mapped</returns>
+	[[nodiscard]] bool Open(const string& path);
+
+	/// <summary>Unmaps the file</summary>
+	void Close();
+
+	[[nodiscard]] bool IsOpen() const { return _data != nullptr; }
+	[[nodiscard]] const uint8_t* GetData() const { return _data; }
+	[[nodiscard]] size_t GetSize() const { return _size; }
+	[[nodiscard]] std::span<const uint8_t> GetSpan() const { return std::span<const uint8_t>(_data, _size); }
+};
@@ -6,7 +6,7 @@
 #define SPNG_USE_MINIZ
 #include "spng.h"
 
-bool PNGHelper::WritePNG(std::stringstream& stream, uint32_t* buffer, uint32_t xSize, uint32_t ySize, uint32_t bitsPerPixel) {
+bool PNGHelper::WritePNG(std::stringstream& stream, uint32_t* buffer, uint32_t xSize, uint32_t ySize, uint32_t bitsPerPixel, int compressionLevel) {
 	size_t pngSize = 0;
 
 	uint32_t size = xSize * ySize * bitsPerPixel / 8;
@@ -30,7 +30,7 @@ bool PNGHelper::WritePNG(std::stringstream& stream, uint32_t* buffer, uint32_t x
 		return false;
 	}
 
-	void* pngData = tdefl_write_image_to_png_file_in_memory_ex(convertedData.data(), xSize, ySize, bitsPerPixel / 8, &pngSize, MZ_DEFAULT_LEVEL, MZ_FALSE);
+	void* pngData = tdefl_write_image_to_png_file_in_memory_ex(convertedData.data(), xSize, ySize, bitsPerPixel / 8, &pngSize, compressionLevel, MZ_FALSE);
 	if (!pngData) {
 		std::cout << "tdefl_write_image_to_png_file_in_memory_ex() failed!" << std::endl;
 		return false;
@@ -18,6 +18,11 @@
 /// Color types: Grayscale, RGB, RGBA
 /// </remarks>
 class PNGHelper {
+public:
+	/// <summary>miniz compression levels: the default matches zlib's, the fast one is used when encoding time matters more than size</summary>
+	static constexpr int DefaultCompressionLevel = 6;
+	static constexpr int FastCompressionLevel = 1;
+
 private:
 	/// <summary>Internal PNG decoder with optional RGBA32 conversion</summary>
 	/// <param name="out_image">Decoded image data output</param>
@@ -39,6 +44,7 @@ public:
 	/// <param name="xSize">Image width in pixels</param>
 	/// <param name="ySize">Image height in pixels</param>
 	/// <param name="bitsPerPixel">Bits per pixel (24=RGB, 32=RGBA, default 24)</param>
+	/// <param name="compressionLevel">Deflate level, 0-10 (see DefaultCompressionLevel/FastCompressionLevel)</param>
 	/// <returns>True if write succeeded, false on error</returns>
 	/// <remarks>
 	/// Buffer format depends on bitsPerPixel:
@@ -46,7 +52,7 @@ public:
 	/// - 32bpp: RGBA (4 bytes per pixel)
 	/// Buffer size must be xSize * ySize * (bitsPerPixel/8) bytes.
 	/// </remarks>
-	static bool WritePNG(std::stringstream& stream, uint32_t* buffer, uint32_t xSize, uint32_t ySize, uint32_t bitsPerPixel = 24);
+	static bool WritePNG(std::stringstream& stream, uint32_t* buffer, uint32_t xSize, uint32_t ySize, uint32_t bitsPerPixel = 24, int compressionLevel = DefaultCompressionLevel);
 
 	/// <summary>
 	/// Write PNG image to file.
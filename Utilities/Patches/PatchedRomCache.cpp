@@ -0,0 +1,97 @@
+#include "pch.h"
+
+#if __has_include(<filesystem>)
+#include <filesystem>
+namespace fs = std::filesystem;
+#elif __has_include(<experimental/filesystem>)
+#include <experimental/filesystem>
+namespace fs = std::experimental::filesystem;
+#endif
+
+#include <algorithm>
+#include "Utilities/Patches/PatchedRomCache.h"
+#include "Utilities/FastHash.h"
+#include "Utilities/FolderUtilities.h"
+#include "Utilities/HexUtilities.h"
+#include "Utilities/PathUtil.h"
+
+string PatchedRomCache::_folder = "";
+
+void PatchedRomCache::SetFolder(const string& folder) {
+	_folder = folder;
+}
+
+string PatchedRomCache::GetEntryPath(std::span<const uint8_t> rom, std::span<const uint8_t> patch) {
+	if (_folder.empty() || rom.empty() || patch.empty()) {
+		return "";
+	}
+
+	string name = HexUtilities::ToHex(FastHash::Hash(rom.data(), rom.size())) + "_" + HexUtilities::ToHex((uint32_t)rom.size()) + "_" +
+	              HexUtilities::ToHex(FastHash::Hash(patch.data(), patch.size())) + "_" + HexUtilities::ToHex((uint32_t)patch.size()) + ".bin";
+	return FolderUtilities::CombinePath(_folder, name);
+}
+
+bool PatchedRomCache::Save(const string& entryPath, const vector<uint8_t>& patchedRom) {
+	if (entryPath.empty() || patchedRom.size() < MinRomSize) {
+		return false;
+	}
+
+	std::error_code errorCode;
+	FolderUtilities::CreateFolder(_folder);
+
+	// Write to a temporary file first, so that another instance never maps a partially written entry
+	fs::path path = PathUtil::FromUtf8(entryPath);
+	fs::path tmpPath = path;
+	tmpPath += ".tmp";
+	{
+		ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+		if (!out) {
+			return false;
+		}
+		out.write((const char*)patchedRom.data(), patchedRom.size());
+		if (!out) {
+			out.close();
+			fs::remove(tmpPath, errorCode);
+			return false;
+		}
+	}
+
+	fs::rename(tmpPath, path, errorCode);
+	if (errorCode) {
+		fs::remove(tmpPath, errorCode);
+		return false;
+	}
+
+	// Remove the least recently written entries until the cache fits in MaxCacheSize
+	struct CacheEntry {
+		fs::path Path;
+		fs::file_time_type Time;
+		uint64_t Size;
+	};
+	vector<CacheEntry> entries;
+	uint64_t totalSize = 0;
+	for (fs::directory_iterator it(PathUtil::FromUtf8(_folder), errorCode), end; !errorCode && it != end; it.increment(errorCode)) {
+		if (it->path().extension() == ".bin" && it->path() != path) {
+			uint64_t size = fs::file_size(it->path(), errorCode);
+			fs::file_time_type time = fs::last_write_time(it->path(), errorCode);
+			if (!errorCode) {
+				entries.push_back({it->path(), time, size});
+				totalSize += size;
+			}
+		}
+	}
+
+	totalSize += patchedRom.size();
+	std::sort(entries.begin(), entries.end(), [](const CacheEntry& a, const CacheEntry& b) { return a.Time < b.Time; });
+	for (CacheEntry& entry : entries) {
+		if (totalSize <= MaxCacheSize) {
+			break;
+		}
+		// Fails (and is kept) if the entry is currently mapped by another instance on Windows
+		if (fs::remove(entry.Path, errorCode)) {
+			totalSize -= entry.Size;
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "pch.h"
+#include <span>
+
+/// <summary>
+/// On-disk cache of patched ROMs, so that large IPS/UPS/BPS patches don't need to be applied again on every load.
+/// </summary>
+/// <remarks>
+/// Entries are content-addressed: the file name is built from a hash (and the size) of both the base ROM and
+/// the patch, so an edited ROM or patch simply gets a new entry. Cached files are loaded through a read-only
+/// memory mapping (see VirtualFile::ApplyPatch), which avoids the patching work and the full-size copies.
+///
+/// Only patched ROMs of at least MinRomSize bytes are cached (smaller ones are patched faster than they can
+/// be read back from disk). The oldest entries are removed when the cache grows beyond MaxCacheSize.
+///
+/// The cache is disabled until SetFolder() is called (e.g in unit tests and tools).
+/// </remarks>
+class PatchedRomCache {
+private:
+	static string _folder;
+
+public:
+	static constexpr size_t MinRomSize = 1024 * 1024;
+	static constexpr uint64_t MaxCacheSize = 512ull * 1024 * 1024;
+
+	/// <summary>Sets the folder used for the cache, an empty string disables the cache</summary>
+	static void SetFolder(const string& folder);
+
+	/// <summary>Path of the cache entry for the given ROM and patch (empty if the cache is disabled)</summary>
+	[[nodiscard]] static string GetEntryPath(std::span<const uint8_t> rom, std::span<const uint8_t> patch);
+
+	/// <summary>Writes the patched ROM to the cache entry, then trims the cache if needed</summary>
+	/// <returns>True if the entry was written</returns>
+	static bool Save(const string& entryPath, const vector<uint8_t>& patchedRom);
+};
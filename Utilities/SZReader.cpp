@@ -63,6 +63,29 @@ bool SZReader::ExtractFile(const string& filename, vector<uint8_t>& output) {
 	return result;
 }
 
+bool SZReader::GetFileCrc32(const string& filename, uint32_t& crc) {
+	bool result = false;
+	if (_initialized) {
+		char16_t* utf16Filename = (char16_t*)SzAlloc(nullptr, 2000);
+		for (uint32_t i = 0; i < _archive.NumFiles; i++) {
+			if (SzArEx_IsDir(&_archive, i)) {
+				continue;
+			}
+
+			SzArEx_GetFileNameUtf16(&_archive, i, (uint16_t*)utf16Filename);
+			if (filename == utf8::utf8::encode(std::u16string(utf16Filename))) {
+				if (SzBitWithVals_Check(&_archive.CRCs, i)) {
+					crc = _archive.CRCs.Vals[i];
+					result = true;
+				}
+				break;
+			}
+		}
+		SzFree(nullptr, utf16Filename);
+	}
+	return result;
+}
+
 vector<string> SZReader::InternalGetFileList() {
 	vector<string> filenames;
 	char16_t* utf16Filename = (char16_t*)SzAlloc(nullptr, 2000);
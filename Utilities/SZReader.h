@@ -52,4 +52,7 @@ public:
 	/// <param name="output">Output vector for decompressed data</param>
 	/// <returns>True if file found and extracted</returns>
 	bool ExtractFile(const string& filename, vector<uint8_t>& output);
+
+	/// <summary>Get file CRC32 from the 7z header (only stored for non-empty files)</summary>
+	bool GetFileCrc32(const string& filename, uint32_t& crc);
 };
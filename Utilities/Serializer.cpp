@@ -39,12 +39,46 @@ void Serializer::ResetForFastSave(uint32_t version) {
 	_readPos = 0;
 }
 
+void Serializer::SetExternalBlocks(const vector<SerializeValue>& blocks) {
+	_externalBlocks = blocks;
+	_externalBlockUsed.assign(blocks.size(), false);
+}
+
 void Serializer::ResetForFastLoad() {
 	_saving = false;
 	_readPos = 0;
 }
 
+void Serializer::MaterializeRecords() {
+	for (SerializeRecord& record : _records) {
+		_values.emplace(string(record.Key), record.Value);
+	}
+	_records.clear();
+	_recordIndex.clear();
+	_recordPos = 0;
+}
+
+SerializeValue* Serializer::FindRecordByIndex(const string& key) {
+	if (_recordIndex.empty()) {
+		_recordIndex.reserve(_records.size());
+		for (uint32_t i = 0; i < (uint32_t)_records.size(); i++) {
+			_recordIndex.emplace(_records[i].Key, i);
+		}
+	}
+
+	auto result = _recordIndex.find(string_view(key));
+	if (result == _recordIndex.end()) {
+		return nullptr;
+	}
+
+	// Resume positional matching after this record
+	_recordPos = result->second + 1;
+	return &_records[result->second].Value;
+}
+
 void Serializer::AddKeyPrefix(const string& prefix) {
+	MaterializeRecords();
+
 	vector<string> keys;
 	keys.reserve(_values.size());
 	for (auto& kvp : _values) {
@@ -58,6 +92,8 @@ void Serializer::AddKeyPrefix(const string& prefix) {
 }
 
 void Serializer::RemoveKeyPrefix(const string& prefix) {
+	MaterializeRecords();
+
 	vector<string> keys;
 	vector<string> keysToRemove;
 	keys.reserve(_values.size());
@@ -82,6 +118,8 @@ void Serializer::RemoveKeyPrefix(const string& prefix) {
 }
 
 void Serializer::RemoveKeys(vector<string>& keysToRemove) {
+	MaterializeRecords();
+
 	for (string& key : keysToRemove) {
 		_values.erase(key);
 	}
@@ -131,14 +169,29 @@ bool Serializer::LoadFrom(istream& file) {
 		file.read((char*)_data.data(), stateSize);
 	}
 
+	return ParseRecords();
+}
+
+bool Serializer::LoadFromBuffer(const vector<uint8_t>& data) {
+	if (_saving || _format != SerializeFormat::Binary) {
+		return false;
+	}
+
+	_data = data;
+	return ParseRecords();
+}
+
+bool Serializer::ParseRecords() {
+	// Keys are kept as views into _data - no per-key allocation, no hashing unless a lookup misses
 	uint32_t size = (uint32_t)_data.size();
 	uint32_t i = 0;
-	string key;
+	_records.clear();
+	_records.reserve(size / 16);
 	while (i < size) {
-		key.clear();
+		string_view key;
 		for (uint32_t j = i; j < size; j++) {
 			if (_data[j] == 0) {
-				key.append((char*)&_data[i]);
+				key = string_view((char*)&_data[i], j - i);
 				break;
 			} else if (_data[j] <= ' ' || _data[j] >= 127) {
 				// invalid characters in key, state is invalid
@@ -164,12 +217,13 @@ bool Serializer::LoadFrom(istream& file) {
 			return false;
 		}
 
-		_values.emplace(key, SerializeValue(i < _data.size() ? &_data[i] : nullptr, valueSize));
+		_records.push_back({key, SerializeValue(i < _data.size() ? &_data[i] : nullptr, valueSize)});
 
 		i += valueSize;
 	}
 
-	return _values.size() > 0;
+	_recordPos = 0;
+	return _records.size() > 0;
 }
 
 bool Serializer::LoadFromTextFormat(istream& file) {
@@ -255,18 +309,140 @@ void Serializer::LoadFromMap(unordered_map<string, SerializeMapValue>& map) {
 	_mapValues = map;
 }
 
+void Serializer::AddPodField(void* ptr, uint32_t size, const char* name, int index) {
+	uint8_t* start = (uint8_t*)ptr;
+	if (start < _podBase || start + size > _podBase + _podSize) {
+		// Not part of the block
+		_podLayout->IsValid = false;
+		return;
+	}
+	_podLayout->Fields.push_back({NormalizeName(name, index), (uint32_t)(start - _podBase), size});
+}
+
+void Serializer::FinalizePodLayout(SerializePodLayout& layout, uint32_t size) {
+	// FNV-1a
+	uint32_t hash = 2166136261u;
+	auto addToHash = [&hash](const void* data, size_t length) {
+		for (size_t i = 0; i < length; i++) {
+			hash = (hash ^ ((const uint8_t*)data)[i]) * 16777619u;
+		}
+	};
+
+	addToHash(&size, sizeof(size));
+	layout.Table.clear();
+	uint32_t count = (uint32_t)layout.Fields.size();
+	layout.Table.insert(layout.Table.end(), (uint8_t*)&count, (uint8_t*)&count + sizeof(count));
+	for (SerializePodField& field : layout.Fields) {
+		uint8_t nameLength = (uint8_t)std::min<size_t>(field.Name.size(), 255);
+		addToHash(field.Name.data(), nameLength);
+		addToHash(&field.Offset, sizeof(field.Offset));
+		addToHash(&field.Size, sizeof(field.Size));
+
+		layout.Table.insert(layout.Table.end(), (uint8_t*)&field.Offset, (uint8_t*)&field.Offset + sizeof(field.Offset));
+		layout.Table.insert(layout.Table.end(), (uint8_t*)&field.Size, (uint8_t*)&field.Size + sizeof(field.Size));
+		layout.Table.push_back(nameLength);
+		layout.Table.insert(layout.Table.end(), field.Name.begin(), field.Name.begin() + nameLength);
+	}
+	layout.Hash = hash;
+}
+
+void Serializer::WritePodBlock(const string& key, void* ptr, uint32_t size, const SerializePodLayout& layout) {
+	// Value: layout hash, block size, block, field list
+	_data.insert(_data.end(), key.begin(), key.end());
+	_data.push_back(0);
+	WriteValue((uint32_t)(8 + size + layout.Table.size()));
+	WriteValue(layout.Hash);
+	WriteValue(size);
+	_data.insert(_data.end(), (uint8_t*)ptr, (uint8_t*)ptr + size);
+	_data.insert(_data.end(), layout.Table.begin(), layout.Table.end());
+}
+
+bool Serializer::ReadPodBlock(const string& key, void* ptr, uint32_t size, const SerializePodLayout& layout) {
+	SerializeValue* savedValue = FindValue(key);
+	if (!savedValue) {
+		return false;
+	}
+
+	uint8_t* src = savedValue->DataPtr;
+	uint32_t srcSize = savedValue->Size;
+	if (srcSize < 8) {
+		return true;
+	}
+
+	uint32_t hash;
+	uint32_t blockSize;
+	ReadValue(hash, src);
+	ReadValue(blockSize, src + 4);
+	if (blockSize > srcSize - 8) {
+		return true;
+	}
+
+	uint8_t* block = src + 8;
+	if (hash == layout.Hash && blockSize == size) {
+		memcpy(ptr, block, size);
+		return true;
+	}
+
+	// The layout changed, copy the fields that still exist with the same size
+	uint8_t* table = block + blockSize;
+	uint8_t* end = src + srcSize;
+	if (table + 4 > end) {
+		return true;
+	}
+
+	uint32_t count;
+	ReadValue(count, table);
+	table += 4;
+	for (uint32_t i = 0; i < count && table + 9 <= end; i++) {
+		uint32_t offset;
+		uint32_t fieldSize;
+		ReadValue(offset, table);
+		ReadValue(fieldSize, table + 4);
+		uint8_t nameLength = table[8];
+		table += 9;
+		if (table + nameLength > end) {
+			break;
+		}
+
+		string_view fieldName((char*)table, nameLength);
+		table += nameLength;
+		if ((uint64_t)offset + fieldSize > blockSize) {
+			continue;
+		}
+
+		for (const SerializePodField& field : layout.Fields) {
+			if (field.Size == fieldSize && field.Name == fieldName) {
+				memcpy((uint8_t*)ptr + field.Offset, block + offset, fieldSize);
+				break;
+			}
+		}
+	}
+	return true;
+}
+
 string Serializer::NormalizeName(const char* name, int index) {
-	string valName = name[0] == '_' ? name + 1 : name;
-	if (valName.size() > 6 && memcmp(valName.c_str(), "state.", 6) == 0) {
-		valName = valName.substr(6);
+	string valName;
+	AppendNormalizedName(valName, name, index);
+	return valName;
+}
+
+void Serializer::AppendNormalizedName(string& out, const char* name, int index) {
+	const char* src = name[0] == '_' ? name + 1 : name;
+	size_t srcLen = strlen(src);
+	if (srcLen > 6 && memcmp(src, "state.", 6) == 0) {
+		src += 6;
+		srcLen -= 6;
 	}
 
-	for (size_t i = 0, len = valName.size(); i < len; i++) {
-		char c = valName[i];
+	// Lowercase the leading uppercase characters of each dot-separated segment
+	size_t start = out.size();
+	out.append(src, srcLen);
+	for (size_t i = start, len = out.size(); i < len; i++) {
+		char c = out[i];
 		if (c >= 'A' && c <= 'Z') {
-			valName[i] = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+			out[i] = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
 		} else {
-			size_t pos = valName.find_first_of('.', i);
+			size_t pos = out.find_first_of('.', i);
 			if (pos == string::npos) {
 				break;
 			} else {
@@ -276,15 +452,15 @@ string Serializer::NormalizeName(const char* name, int index) {
 	}
 
 	if (index >= 0) {
-		size_t pos = valName.find("[i]");
+		char indexStr[16];
+		int indexLen = snprintf(indexStr, sizeof(indexStr), "[%d]", index);
+		size_t pos = out.find("[i]", start);
 		if (pos != string::npos) {
-			valName.replace(pos, 3, "[" + std::to_string(index) + "]");
+			out.replace(pos, 3, indexStr, indexLen);
 		} else {
-			valName += "[" + std::to_string(index) + "]";
+			out.append(indexStr, indexLen);
 		}
 	}
-
-	return valName;
 }
 
 void Serializer::PushNamePrefix(const char* name, int index) {
@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "Utilities/ISerializable.h"
 #include "Utilities/FastString.h"
+#include "Utilities/SmallVector.h"
 #include "Utilities/magic_enum.hpp"
 #include "Utilities/safe_ptr.h"
 
@@ -69,6 +70,27 @@ struct SerializeValue {
 	}
 };
 
+/// <summary>Key/value record of a binary save state, in file order</summary>
+struct SerializeRecord {
+	string_view Key;      ///< Key (points into the serializer's data buffer)
+	SerializeValue Value; ///< Value
+};
+
+/// <summary>Field of a POD state block, as streamed by its field-wise code (see Serializer::StreamPod)</summary>
+struct SerializePodField {
+	string Name;     ///< Normalized name (without the key prefix)
+	uint32_t Offset; ///< Offset in the block
+	uint32_t Size;   ///< Size in bytes
+};
+
+/// <summary>Layout of a POD state block, built once per StreamPod call site from its field-wise code</summary>
+struct SerializePodLayout {
+	vector<SerializePodField> Fields;
+	vector<uint8_t> Table; ///< Field list, saved after the block in binary states (used to migrate older layouts)
+	uint32_t Hash = 0;     ///< Hash of the block's size and of each field's name, offset and size
+	bool IsValid = true;   ///< False when the field-wise code streams something outside of the block (or a non-POD value)
+};
+
 /// <summary>Serialization output format</summary>
 enum class SerializeFormat {
 	Binary,     ///< Compact binary format with string keys (save states)
@@ -86,9 +108,21 @@ private:
 	unordered_set<string> _usedKeys;
 	unordered_map<string, SerializeValue> _values;
 
+	/// <summary>Binary load: records in file order, matched positionally against Stream() calls</summary>
+	vector<SerializeRecord> _records;
+	/// <summary>Binary load: key index into _records, only built when a positional match fails</summary>
+	unordered_map<string_view, uint32_t> _recordIndex;
+	uint32_t _recordPos = 0;
+
+	/// <summary>Reusable key buffer (avoids allocating a string per value)</summary>
+	string _keyBuffer;
+
 	// Used by Lua API
 	unordered_map<string, SerializeMapValue> _mapValues;
 
+	/// <summary>Map format: key prefixes to save/load (empty = all keys)</summary>
+	vector<string> _keyFilter;
+
 	uint32_t _version = 0;
 	bool _saving = false;
 	SerializeFormat _format = SerializeFormat::Binary;
@@ -97,17 +131,71 @@ private:
 	/// <summary>Read position for FastBinary deserialization</summary>
 	uint32_t _readPos = 0;
 
+	/// <summary>Arrays captured outside the serializer (run-ahead page snapshot) — skipped in FastBinary</summary>
+	vector<SerializeValue> _externalBlocks;
+	vector<uint8_t> _externalBlockUsed;
+
+	/// <summary>StreamPod layout pass: fields are recorded instead of being streamed</summary>
+	SerializePodLayout* _podLayout = nullptr;
+	uint8_t* _podBase = nullptr;
+	uint32_t _podSize = 0;
+
 private:
 	bool LoadFromTextFormat(istream& file);
+	bool ParseRecords();
 	string NormalizeName(const char* name, int index);
+	void AppendNormalizedName(string& out, const char* name, int index);
 	void UpdatePrefix();
 
-	string GetKey(const char* name, int index) {
-		string valName = NormalizeName(name, index);
-		if (valName.empty()) {
+	void AddPodField(void* ptr, uint32_t size, const char* name, int index);
+	void FinalizePodLayout(SerializePodLayout& layout, uint32_t size);
+	void WritePodBlock(const string& key, void* ptr, uint32_t size, const SerializePodLayout& layout);
+	bool ReadPodBlock(const string& key, void* ptr, uint32_t size, const SerializePodLayout& layout);
+
+	template <typename TFields>
+	SerializePodLayout BuildPodLayout(void* ptr, uint32_t size, TFields& streamFields) {
+		SerializePodLayout layout;
+		_podLayout = &layout;
+		_podBase = (uint8_t*)ptr;
+		_podSize = size;
+		streamFields();
+		_podLayout = nullptr;
+		FinalizePodLayout(layout, size);
+		return layout;
+	}
+
+	/// <summary>Move binary records into the keyed map (needed before keys are renamed/removed)</summary>
+	void MaterializeRecords();
+	SerializeValue* FindRecordByIndex(const string& key);
+
+	/// <summary>Build the full key for a value</summary>
+	/// <remarks>Returns a reference to an internal buffer, only valid until the next call.</remarks>
+	string& GetKey(const char* name, int index) {
+		_keyBuffer.assign(_prefix);
+		AppendNormalizedName(_keyBuffer, name, index);
+		if (_keyBuffer.size() == _prefix.size()) {
 			throw std::runtime_error("invalid value name");
 		}
-		return _prefix + valName;
+		return _keyBuffer;
+	}
+
+	/// <summary>Find a loaded value by key</summary>
+	/// <remarks>
+	/// Binary states are read back in the order they were written, so the next record
+	/// normally matches and no hashing is needed. Out-of-order or missing keys (older
+	/// versions, compat prefixes) fall back to a key index.
+	/// </remarks>
+	SerializeValue* FindValue(const string& key) {
+		if (_recordPos < _records.size() && _records[_recordPos].Key == key) {
+			return &_records[_recordPos++].Value;
+		}
+
+		if (!_records.empty()) {
+			return FindRecordByIndex(key);
+		}
+
+		auto result = _values.find(key);
+		return result != _values.end() ? &result->second : nullptr;
 	}
 
 	template <typename T>
@@ -130,8 +218,53 @@ private:
 		}
 	}
 
+	/// <summary>Map format: true if the key starts with one of the filter prefixes (or there is no filter)</summary>
+	bool IsKeyInFilter(const string& key) {
+		if (_keyFilter.empty()) {
+			return true;
+		}
+		for (const string& filter : _keyFilter) {
+			if (key.compare(0, filter.size(), filter) == 0) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/// <summary>Map format: true if keys under the current prefix can match the filter (i.e the object must be streamed)</summary>
+	bool IsPrefixInFilter() {
+		if (_keyFilter.empty()) {
+			return true;
+		}
+		for (const string& filter : _keyFilter) {
+			size_t len = std::min(filter.size(), _prefix.size());
+			if (filter.compare(0, len, _prefix, 0, len) == 0) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void StreamObject(ISerializable* obj, const char* name, int index) {
+		if (_podLayout) [[unlikely]] {
+			_podLayout->IsValid = false;
+			return;
+		}
+
+		PushNamePrefix(name, index);
+		// With a key filter, objects that contain none of the requested keys are skipped entirely
+		if (_format != SerializeFormat::Map || IsPrefixInFilter()) {
+			obj->Serialize(*this);
+		}
+		PopNamePrefix();
+	}
+
 	template <typename T>
 	void WriteMapFormat(string& key, T& value) {
+		if (!IsKeyInFilter(key)) {
+			return;
+		}
+
 		if constexpr (std::is_same<T, bool>::value) {
 			_mapValues.try_emplace(key, SerializeMapValueFormat::Bool, (bool)value);
 		} else if constexpr (std::is_integral<T>::value) {
@@ -145,6 +278,10 @@ private:
 
 	template <typename T>
 	void ReadMapFormat(string& key, T& value) {
+		if (!IsKeyInFilter(key)) {
+			return;
+		}
+
 		auto result = _mapValues.find(key);
 		if (result != _mapValues.end()) {
 			SerializeMapValue mapVal = result->second;
@@ -207,6 +344,16 @@ private:
 		}
 	}
 
+	bool IsExternalBlock(void* ptr, uint32_t size) {
+		for (size_t i = 0; i < _externalBlocks.size(); i++) {
+			if (_externalBlocks[i].DataPtr == ptr && _externalBlocks[i].Size == size) {
+				_externalBlockUsed[i] = true;
+				return true;
+			}
+		}
+		return false;
+	}
+
 	__forceinline void CheckDuplicateKey([[maybe_unused]] string& key) {
 #ifdef DEBUG
 		if (!_usedKeys.emplace(key).second) {
@@ -227,19 +374,36 @@ public:
 	/// <summary>Reset for FastBinary load — rewinds read position to start of buffer</summary>
 	void ResetForFastLoad();
 
+	/// <summary>Set arrays that FastBinary must skip because they are snapshotted externally</summary>
+	/// <remarks>Matched by pointer and byte size. Must be identical for the save and the matching load.</remarks>
+	void SetExternalBlocks(const vector<SerializeValue>& blocks);
+
+	/// <summary>Check if an external block was skipped during the last save</summary>
+	[[nodiscard]] bool IsExternalBlockUsed(size_t index) { return index < _externalBlockUsed.size() && _externalBlockUsed[index]; }
+
 	uint32_t GetVersion() { return _version; }
 	bool IsSaving() { return _saving; }
 
 	SerializeFormat GetFormat() { return _format; }
 	unordered_map<string, SerializeMapValue>& GetMapValues() { return _mapValues; }
 
+	/// <summary>
+	/// Map format: only saves/loads the keys that start with one of the given prefixes (e.g "cpu.a" or "ppu.").
+	/// Objects that can't contain any of these keys are not streamed at all, so reading a few values doesn't
+	/// serialize the whole console.
+	/// </summary>
+	void SetKeyFilter(vector<string> prefixes) { _keyFilter = std::move(prefixes); }
+
 	/// <summary>Move the serialized data buffer out for async writing</summary>
 	[[nodiscard]] vector<uint8_t> GetData() { return std::move(_data); }
 
+	/// <summary>Access the serialized data without moving it out (e.g. to compare two FastBinary states)</summary>
+	[[nodiscard]] const vector<uint8_t>& GetBuffer() const { return _data; }
+
 	void SetErrorFlag() { _hasError = true; }
 	bool HasError() { return _hasError; }
 
-	bool IsValid() { return _values.size() > 0; }
+	bool IsValid() { return _values.size() > 0 || _records.size() > 0; }
 	void AddKeyPrefix(const string& prefix);
 	void RemoveKeyPrefix(const string& prefix);
 	void RemoveKeys(vector<string>& keys);
@@ -277,7 +441,12 @@ public:
 				return;
 			}
 
-			string key = GetKey(name, index);
+			if (_podLayout) [[unlikely]] {
+				AddPodField(&value, sizeof(T), name, index);
+				return;
+			}
+
+			string& key = GetKey(name, index);
 
 			CheckDuplicateKey(key);
 
@@ -305,11 +474,10 @@ public:
 			} else {
 				switch (_format) {
 					case SerializeFormat::Binary: {
-						auto result = _values.find(key);
-						if (result != _values.end()) {
-							SerializeValue& savedValue = result->second;
-							if (savedValue.Size >= sizeof(T)) {
-								ReadValue(value, savedValue.DataPtr);
+						SerializeValue* savedValue = FindValue(key);
+						if (savedValue) {
+							if (savedValue->Size >= sizeof(T)) {
+								ReadValue(value, savedValue->DataPtr);
 							} else {
 								// TODO review this - is it better to keep the state as-is if the data can't be found?
 								// Setting to 0 can break compatibility with old save states - maybe keeping the current state is safer?
@@ -322,9 +490,9 @@ public:
 					}
 
 					case SerializeFormat::Text: {
-						auto result = _values.find(key);
-						if (result != _values.end()) {
-							ReadTextFormat(result->second, value);
+						SerializeValue* savedValue = FindValue(key);
+						if (savedValue) {
+							ReadTextFormat(*savedValue, value);
 						} else {
 							// value = (T)0;
 						}
@@ -340,41 +508,31 @@ public:
 	}
 
 	void Stream(ISerializable& obj, const char* name, int index) {
-		PushNamePrefix(name, index);
-		obj.Serialize(*this);
-		PopNamePrefix();
+		StreamObject(&obj, name, index);
 	}
 
 	template <typename T>
 	void Stream(unique_ptr<T>& obj, const char* name, int index = -1) {
 		static_assert(std::is_base_of<ISerializable, T>::value, "[Serializer] Object does not implement ISerializable");
-		PushNamePrefix(name, index);
-		((ISerializable*)obj.get())->Serialize(*this);
-		PopNamePrefix();
+		StreamObject((ISerializable*)obj.get(), name, index);
 	}
 
 	template <typename T>
 	void Stream(const unique_ptr<T>& obj, const char* name, int index = -1) {
 		static_assert(std::is_base_of<ISerializable, T>::value, "[Serializer] Object does not implement ISerializable");
-		PushNamePrefix(name, index);
-		((ISerializable*)obj.get())->Serialize(*this);
-		PopNamePrefix();
+		StreamObject((ISerializable*)obj.get(), name, index);
 	}
 
 	template <typename T>
 	void Stream(shared_ptr<T>& obj, const char* name, int index = -1) {
 		static_assert(std::is_base_of<ISerializable, T>::value, "[Serializer] Object does not implement ISerializable");
-		PushNamePrefix(name, index);
-		((ISerializable*)obj.get())->Serialize(*this);
-		PopNamePrefix();
+		StreamObject((ISerializable*)obj.get(), name, index);
 	}
 
 	template <typename T>
 	void Stream(safe_ptr<T>& obj, const char* name, int index = -1) {
 		static_assert(std::is_base_of<ISerializable, T>::value, "[Serializer] Object does not implement ISerializable");
-		PushNamePrefix(name, index);
-		((ISerializable*)obj.get())->Serialize(*this);
-		PopNamePrefix();
+		StreamObject((ISerializable*)obj.get(), name, index);
 	}
 
 	template <typename T>
@@ -382,6 +540,10 @@ public:
 		// FastBinary: raw memcpy — no keys, no size prefix
 		if (_format == SerializeFormat::FastBinary) {
 			uint32_t bytes = elementCount * sizeof(T);
+			if (!_externalBlocks.empty() && IsExternalBlock(arrayValues, bytes)) {
+				return;
+			}
+
 			if (_saving) {
 				_data.insert(_data.end(), (uint8_t*)arrayValues, (uint8_t*)arrayValues + bytes);
 			} else {
@@ -393,7 +555,12 @@ public:
 			return;
 		}
 
-		string key = GetKey(name, -1);
+		if (_podLayout) [[unlikely]] {
+			AddPodField(arrayValues, elementCount * sizeof(T), name, -1);
+			return;
+		}
+
+		string& key = GetKey(name, -1);
 
 		CheckDuplicateKey(key);
 
@@ -431,15 +598,14 @@ public:
 				}
 			}
 		} else {
-			auto result = _values.find(key);
-			if (result != _values.end()) {
-				SerializeValue& savedValue = result->second;
+			SerializeValue* savedValue = FindValue(key);
+			if (savedValue) {
 				// Copy as much data as possible (up to the size of whichever is smaller - savedValue or arrayValues)
 				if constexpr (sizeof(T) == 1 || !isBigEndian) {
-					memcpy(arrayValues, savedValue.DataPtr, std::min<int>(savedValue.Size, sizeof(T) * elementCount));
+					memcpy(arrayValues, savedValue->DataPtr, std::min<int>(savedValue->Size, sizeof(T) * elementCount));
 				} else {
-					uint8_t* src = savedValue.DataPtr;
-					uint32_t maxCount = std::min<int>(elementCount, savedValue.Size / sizeof(T));
+					uint8_t* src = savedValue->DataPtr;
+					uint32_t maxCount = std::min<int>(elementCount, savedValue->Size / sizeof(T));
 					for (uint32_t i = 0; i < maxCount; i++) {
 						ReadValue(arrayValues[i], src);
 						src += sizeof(T);
@@ -453,6 +619,19 @@ public:
 
 	template <typename T>
 	void Stream(vector<T>& values, const char* name, int index = -1) {
+		StreamVector(values, name, index);
+	}
+
+	template <typename T, uint32_t InlineCapacity>
+	void Stream(SmallVector<T, InlineCapacity>& values, const char* name, int index = -1) {
+		StreamVector(values, name, index);
+	}
+
+	/// <summary>Streams a vector-like container (vector, SmallVector), both are saved in the same format</summary>
+	template <typename TVector>
+	void StreamVector(TVector& values, const char* name, int index = -1) {
+		using T = typename TVector::value_type;
+
 		// FastBinary: write count + raw data
 		if (_format == SerializeFormat::FastBinary) {
 			if (_saving) {
@@ -481,7 +660,12 @@ public:
 			return;
 		}
 
-		string key = GetKey(name, index);
+		if (_podLayout) [[unlikely]] {
+			_podLayout->IsValid = false;
+			return;
+		}
+
+		string& key = GetKey(name, index);
 
 		CheckDuplicateKey(key);
 
@@ -499,13 +683,12 @@ public:
 				WriteValue(values[i]);
 			}
 		} else {
-			auto result = _values.find(key);
-			if (result != _values.end()) {
-				SerializeValue& savedValue = result->second;
-				uint32_t elementCount = savedValue.Size / sizeof(T);
+			SerializeValue* savedValue = FindValue(key);
+			if (savedValue) {
+				uint32_t elementCount = savedValue->Size / sizeof(T);
 				values.resize(elementCount);
 
-				uint8_t* src = savedValue.DataPtr;
+				uint8_t* src = savedValue->DataPtr;
 				for (uint32_t i = 0; i < elementCount; i++) {
 					ReadValue(values[i], src);
 					src += sizeof(T);
@@ -516,8 +699,63 @@ public:
 		}
 	}
 
+	/// <summary>
+	/// Streams a trivially-copyable state struct as a single block: one memcpy in the FastBinary and Binary formats.
+	/// </summary>
+	/// <param name="value">State struct</param>
+	/// <param name="name">Key of the block</param>
+	/// <param name="streamFields">Field-wise code (SV/SVArray calls on the struct's fields), used by the Map/Text formats,
+	/// to load binary states saved before the struct was streamed as a block, and to build the block's layout</param>
+	/// <remarks>
+	/// The layout (name, offset and size of every field) is built once per call site by running streamFields in a
+	/// recording mode, so streamFields must stream the same fields every time and have no other side effects. If it
+	/// streams anything that isn't part of the struct, the struct is always streamed field by field.
+	///
+	/// Binary states store the layout's hash and field list with the block: when the layout changes (fields added,
+	/// removed or moved), the fields that still exist with the same size are copied one by one from the saved block,
+	/// the others keep their current value (same as a missing key for Stream()).
+	/// </remarks>
+	template <typename T, typename TFields>
+	void StreamPod(T& value, const char* name, TFields&& streamFields) {
+		static_assert(std::is_trivially_copyable<T>::value, "[Serializer] POD state block must be trivially copyable");
+
+		if (_format == SerializeFormat::FastBinary) {
+			StreamArray((uint8_t*)&value, sizeof(T), name);
+			return;
+		}
+
+		if (_format != SerializeFormat::Binary || _podLayout) {
+			// Readable formats (and a block nested in another one's layout pass) use the individual fields
+			streamFields();
+			return;
+		}
+
+		static const SerializePodLayout layout = BuildPodLayout(&value, sizeof(T), streamFields);
+		if (!layout.IsValid) {
+			streamFields();
+			return;
+		}
+
+		string& key = GetKey(name, -1);
+		CheckDuplicateKey(key);
+
+		if (_saving) {
+			WritePodBlock(key, &value, sizeof(T), layout);
+		} else if (!ReadPodBlock(key, &value, sizeof(T), layout)) {
+			// State saved before this struct was streamed as a block
+			streamFields();
+		}
+	}
+
 	bool ContainsKey(const char* name) {
-		string key = GetKey(name, -1);
+		string& key = GetKey(name, -1);
+		if (!_records.empty()) {
+			// Lookup only, don't move the positional cursor
+			uint32_t pos = _recordPos;
+			bool found = FindValue(key) != nullptr;
+			_recordPos = pos;
+			return found;
+		}
 		return _values.contains(key);
 	}
 
@@ -525,6 +763,9 @@ public:
 	void PopNamePrefix();
 	void SaveTo(ostream& file, int compressionLevel = 1);
 	bool LoadFrom(istream& file);
+
+	/// <summary>Load an uncompressed binary state (as returned by GetData()) without going through a stream</summary>
+	bool LoadFromBuffer(const vector<uint8_t>& data);
 	void LoadFromMap(unordered_map<string, SerializeMapValue>& map);
 };
 
@@ -550,7 +791,12 @@ inline void Serializer::Stream(string& value, const char* name, int index) {
 		return;
 	}
 
-	string key = GetKey(name, index);
+	if (_podLayout) [[unlikely]] {
+		_podLayout->IsValid = false;
+		return;
+	}
+
+	string& key = GetKey(name, index);
 
 	CheckDuplicateKey(key);
 
@@ -572,10 +818,9 @@ inline void Serializer::Stream(string& value, const char* name, int index) {
 			// Write string content
 			_data.insert(_data.end(), value.begin(), value.end());
 		} else {
-			auto result = _values.find(key);
-			if (result != _values.end()) {
-				SerializeValue& savedValue = result->second;
-				value = string(savedValue.DataPtr, savedValue.DataPtr + savedValue.Size);
+			SerializeValue* savedValue = FindValue(key);
+			if (savedValue) {
+				value = string(savedValue->DataPtr, savedValue->DataPtr + savedValue->Size);
 			} else {
 				value = "";
 			}
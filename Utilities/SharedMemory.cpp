@@ -0,0 +1,127 @@
+#include "pch.h"
+#include "Utilities/SharedMemory.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#include "Utilities/UTF8Util.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+SharedMemory::~SharedMemory() {
+	Close();
+}
+
+#ifdef _WIN32
+bool SharedMemory::Map(const string& name, size_t size, bool create) {
+	Close();
+	if (name.empty() || size == 0) {
+		return false;
+	}
+
+	string fullName = name.find('\\') == string::npos ? "Local\\" + name : name;
+	std::wstring wideName = utf8::utf8::decode(fullName);
+
+	HANDLE mapping;
+	if (create) {
+		mapping = CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, (DWORD)((uint64_t)size >> 32), (DWORD)size, wideName.c_str());
+	} else {
+		mapping = OpenFileMappingW(FILE_MAP_ALL_ACCESS, FALSE, wideName.c_str());
+	}
+	if (!mapping) {
+		return false;
+	}
+
+	void* view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+	if (!view) {
+		CloseHandle(mapping);
+		return false;
+	}
+
+	if (create && GetLastError() == ERROR_ALREADY_EXISTS) {
+		// Another instance used the same name, start from a clean block
+		memset(view, 0, size);
+	}
+
+	_mappingHandle = mapping;
+	_data = (uint8_t*)view;
+	_size = size;
+	_name = fullName;
+	_isOwner = create;
+	return true;
+}
+
+void SharedMemory::Close() {
+	if (_data) {
+		UnmapViewOfFile(_data);
+	}
+	if (_mappingHandle) {
+		CloseHandle((HANDLE)_mappingHandle);
+	}
+	_data = nullptr;
+	_size = 0;
+	_mappingHandle = nullptr;
+	_name.clear();
+	_isOwner = false;
+}
+#else
+bool SharedMemory::Map(const string& name, size_t size, bool create) {
+	Close();
+	if (name.empty() || size == 0) {
+		return false;
+	}
+
+	string fullName = name[0] == '/' ? name : "/" + name;
+	if (create) {
+		// Replace any stale block left by a process that didn't exit cleanly
+		shm_unlink(fullName.c_str());
+	}
+
+	int fd = shm_open(fullName.c_str(), create ? (O_RDWR | O_CREAT | O_EXCL) : O_RDWR, 0600);
+	if (fd < 0) {
+		return false;
+	}
+
+	struct stat info = {};
+	if (create ? ftruncate(fd, (off_t)size) != 0 : (fstat(fd, &info) != 0 || (size_t)info.st_size < size)) {
+		close(fd);
+		if (create) {
+			shm_unlink(fullName.c_str());
+		}
+		return false;
+	}
+
+	void* view = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+	// The mapping stays valid after the descriptor is closed
+	close(fd);
+	if (view == MAP_FAILED) {
+		if (create) {
+			shm_unlink(fullName.c_str());
+		}
+		return false;
+	}
+
+	_data = (uint8_t*)view;
+	_size = size;
+	_name = fullName;
+	_isOwner = create;
+	return true;
+}
+
+void SharedMemory::Close() {
+	if (_data) {
+		munmap(_data, _size);
+	}
+	if (_isOwner) {
+		shm_unlink(_name.c_str());
+	}
+	_data = nullptr;
+	_size = 0;
+	_name.clear();
+	_isOwner = false;
+}
+#endif
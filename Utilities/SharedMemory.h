@@ -0,0 +1,48 @@
+#pragma once
+#include "pch.h"
+
+/// <summary>
+/// Named read/write shared memory block, visible to other processes (POSIX shm or a Windows file mapping).
+/// </summary>
+/// <remarks>
+/// The creator owns the name: on POSIX systems, the block is unlinked when the creator closes it (processes
+/// that already opened it keep their mapping). On Windows, the mapping lives until every handle is closed.
+///
+/// Names follow the platform rules: on POSIX systems a leading '/' is added when missing, and on Windows
+/// the mapping is created in the session's Local\ namespace unless the name already contains a namespace.
+/// </remarks>
+class SharedMemory {
+private:
+	uint8_t* _data = nullptr; ///< Start of the mapped view
+	size_t _size = 0;         ///< Size of the mapped view, in bytes
+	string _name;             ///< Platform name (POSIX: used to unlink the block)
+	bool _isOwner = false;    ///< Created by this instance
+
+#ifdef _WIN32
+	void* _mappingHandle = nullptr; ///< File mapping HANDLE
+#endif
+
+	[[nodiscard]] bool Map(const string& name, size_t size, bool create);
+
+public:
+	SharedMemory() = default;
+	~SharedMemory();
+
+	SharedMemory(const SharedMemory&) = delete;
+	SharedMemory& operator=(const SharedMemory&) = delete;
+
+	/// <summary>Creates a zero-filled shared memory block (replaces an existing block with the same name)</summary>
+	/// <returns>True if the block was created and mapped</returns>
+	[[nodiscard]] bool Create(const string& name, size_t size) { return Map(name, size, true); }
+
+	/// <summary>Opens a block created by another instance or process</summary>
+	/// <returns>True if the block was mapped</returns>
+	[[nodiscard]] bool Open(const string& name, size_t size) { return Map(name, size, false); }
+
+	/// <summary>Unmaps the block (and removes its name if this instance created it)</summary>
+	void Close();
+
+	[[nodiscard]] bool IsOpen() const { return _data != nullptr; }
+	[[nodiscard]] uint8_t* GetData() const { return _data; }
+	[[nodiscard]] size_t GetSize() const { return _size; }
+};
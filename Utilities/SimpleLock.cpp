@@ -1,16 +1,60 @@
 #include "pch.h"
 #include <assert.h>
+#include <map>
+#include <mutex>
 #include "SimpleLock.h"
 #include <Timer.h>
 
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	#include <intrin.h>
+	#define CPU_PAUSE() _mm_pause()
+#elif defined(__x86_64__) || defined(__i386__)
+	#include <immintrin.h>
+	#define CPU_PAUSE() _mm_pause()
+#else
+	#define CPU_PAUSE() std::this_thread::yield()
+#endif
+
 thread_local std::thread::id SimpleLock::_threadID = std::this_thread::get_id();
+atomic<bool> SimpleLock::_telemetryEnabled = false;
+
+struct SimpleLock::Counters {
+	const char* Name;
+	atomic<uint64_t> Acquisitions = 0;
+	atomic<uint64_t> Contentions = 0;
+	atomic<uint64_t> TotalWait = 0; ///< Nanoseconds
+	atomic<uint64_t> MaxWait = 0;   ///< Nanoseconds
+};
+
+namespace {
+	/// <summary>Counters of each lock name (never freed, locks keep a pointer to them)</summary>
+	std::mutex& GetCountersLock() {
+		static std::mutex lock;
+		return lock;
+	}
+
+	std::map<string, unique_ptr<SimpleLock::Counters>>& GetAllCounters() {
+		static std::map<string, unique_ptr<SimpleLock::Counters>> counters;
+		return counters;
+	}
+}
 
 SimpleLock::SimpleLock() {
-	_lock.clear();
+	_state = 0;
 	_lockCount = 0;
 	_holderThreadID = std::thread::id();
 }
 
+SimpleLock::SimpleLock(const char* name) : SimpleLock() {
+	std::lock_guard<std::mutex> guard(GetCountersLock());
+	unique_ptr<Counters>& counters = GetAllCounters()[name];
+	if (!counters) {
+		counters = std::make_unique<Counters>();
+		counters->Name = name;
+	}
+	_counters = counters.get();
+}
+
 SimpleLock::~SimpleLock() {
 }
 
@@ -30,25 +74,68 @@ void SimpleLock::Acquire() {
 }
 
 bool SimpleLock::WaitForAcquire(uint32_t msTimeout) {
-	if (_lock.test_and_set()) {
-		Timer timer;
-		int attempts = 0;
-		while (_lock.test_and_set()) {
-			if (++attempts >= 10000) {
-				// Sleep between attempts after failing to acquire lock 10k times
-				std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(msTimeout > 0 ? 10 : 1));
+	uint32_t expected = 0;
+	if (_state.compare_exchange_strong(expected, 1, std::memory_order_acquire)) {
+		// Uncontended
+		if (_counters && _telemetryEnabled.load(std::memory_order_relaxed)) {
+			_counters->Acquisitions.fetch_add(1, std::memory_order_relaxed);
+		}
+		return true;
+	}
+	return WaitForAcquireContended(msTimeout);
+}
+
+bool SimpleLock::WaitForAcquireContended(uint32_t msTimeout) {
+	bool recordStats = _counters && _telemetryEnabled.load(std::memory_order_relaxed);
+	Timer timer;
+
+	bool acquired = false;
+	for (int i = 0; i < SimpleLock::SpinCount; i++) {
+		// Spin briefly first, the lock is usually held for a very short time
+		uint32_t expected = 0;
+		if (_state.load(std::memory_order_relaxed) == 0 && _state.compare_exchange_weak(expected, 1, std::memory_order_acquire)) {
+			acquired = true;
+			break;
+		}
+		CPU_PAUSE();
+	}
+
+	if (!acquired) {
+		if (msTimeout == 0) {
+			// Park until the holder releases the lock (state 2 tells it to wake us up)
+			while (_state.exchange(2, std::memory_order_acquire) != 0) {
+				_state.wait(2, std::memory_order_relaxed);
 			}
-			if (msTimeout > 0 && timer.GetElapsedMS() > msTimeout) {
-				return false;
+			acquired = true;
+		} else {
+			// Atomic waits can't time out, poll instead (only used by TryAcquire with a timeout)
+			while (!(acquired = _state.exchange(2, std::memory_order_acquire) == 0) && timer.GetElapsedMS() <= msTimeout) {
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
 			}
 		}
 	}
-	return true;
+
+	if (recordStats && acquired) {
+		uint64_t wait = (uint64_t)(timer.GetElapsedMS() * 1000000);
+		_counters->Acquisitions.fetch_add(1, std::memory_order_relaxed);
+		_counters->Contentions.fetch_add(1, std::memory_order_relaxed);
+		_counters->TotalWait.fetch_add(wait, std::memory_order_relaxed);
+		uint64_t maxWait = _counters->MaxWait.load(std::memory_order_relaxed);
+		while (wait > maxWait && !_counters->MaxWait.compare_exchange_weak(maxWait, wait, std::memory_order_relaxed)) {
+		}
+	}
+	return acquired;
 }
 
 bool SimpleLock::TryAcquire(uint32_t msTimeout) {
 	if (_lockCount == 0 || _holderThreadID != _threadID) {
-		if (!WaitForAcquire(msTimeout)) {
+		if (msTimeout == 0) {
+			// Try once
+			uint32_t expected = 0;
+			if (!_state.compare_exchange_strong(expected, 1, std::memory_order_acquire)) {
+				return false;
+			}
+		} else if (!WaitForAcquire(msTimeout)) {
 			return false;
 		}
 		_holderThreadID = _threadID;
@@ -80,13 +167,54 @@ void SimpleLock::Release() {
 		_lockCount--;
 		if (_lockCount == 0) {
 			_holderThreadID = std::thread::id();
-			_lock.clear();
+			if (_state.exchange(0, std::memory_order_release) == 2) {
+				// A thread may be parked in WaitForAcquire
+				_state.notify_one();
+			}
 		}
 	} else {
 		assert(false);
 	}
 }
 
+void SimpleLock::SetTelemetryEnabled(bool enabled) {
+	if (enabled == _telemetryEnabled.load(std::memory_order_relaxed)) {
+		return;
+	}
+
+	if (enabled) {
+		std::lock_guard<std::mutex> guard(GetCountersLock());
+		for (auto& [name, counters] : GetAllCounters()) {
+			counters->Acquisitions = 0;
+			counters->Contentions = 0;
+			counters->TotalWait = 0;
+			counters->MaxWait = 0;
+		}
+	}
+	_telemetryEnabled = enabled;
+}
+
+vector<LockContentionInfo> SimpleLock::GetContentionInfo() {
+	vector<LockContentionInfo> result;
+	{
+		std::lock_guard<std::mutex> guard(GetCountersLock());
+		for (auto& [name, counters] : GetAllCounters()) {
+			LockContentionInfo info;
+			info.Name = name;
+			info.Acquisitions = counters->Acquisitions;
+			info.Contentions = counters->Contentions;
+			info.TotalWait = counters->TotalWait / 1000000.0;
+			info.MaxWait = counters->MaxWait / 1000000.0;
+			result.push_back(info);
+		}
+	}
+
+	std::sort(result.begin(), result.end(), [](const LockContentionInfo& a, const LockContentionInfo& b) {
+		return a.TotalWait > b.TotalWait;
+	});
+	return result;
+}
+
 LockHandler::LockHandler(SimpleLock* lock) {
 	_lock = lock;
 	_lock->Acquire();
@@ -103,4 +231,4 @@ LockHandler::~LockHandler() {
 	if (!_released) {
 		_lock->Release();
 	}
-}
\ No newline at end of file
+}
@@ -4,6 +4,17 @@
 
 class SimpleLock;
 
+/// <summary>
+/// Contention counters of a named SimpleLock (all instances with the same name are combined).
+/// </summary>
+struct LockContentionInfo {
+	string Name;
+	uint64_t Acquisitions = 0; ///< Number of times the lock was acquired (excluding recursive acquisitions)
+	uint64_t Contentions = 0;  ///< Acquisitions that had to wait for another thread
+	double TotalWait = 0;      ///< Total time spent waiting (ms)
+	double MaxWait = 0;        ///< Longest wait (ms)
+};
+
 /// <summary>
 /// RAII lock guard for SimpleLock - automatically releases on scope exit.
 /// Provides exception-safe lock handling with manual early release option.
@@ -37,37 +48,63 @@ public:
 };
 
 /// <summary>
-/// Recursive mutex implementation using atomic_flag with thread ownership tracking.
+/// Adaptive recursive mutex with thread ownership tracking.
 /// Supports recursive locking (same thread can acquire multiple times).
 /// </summary>
 /// <remarks>
 /// Advantages over std::recursive_mutex:
 /// - AcquireSafe() returns RAII guard for exception safety
 /// - IsLockedByCurrentThread() for ownership checks
-/// - WaitForRelease() for spin-waiting until lock becomes free
+/// - WaitForRelease() for waiting until lock becomes free
 /// - TryAcquire() with timeout support
+/// - Optional contention counters (named locks, see SetTelemetryEnabled)
+///
+/// Acquiring a contended lock spins briefly (critical sections are usually short), then parks the thread with
+/// atomic wait/notify (futex on Linux, WaitOnAddress on Windows), so a thread waiting for a long time (e.g the UI
+/// waiting for the emulation thread to pause) uses no CPU and is woken up as soon as the lock is released.
+/// Lock state: 0 = free, 1 = locked, 2 = locked and a thread may be parked (Release() must wake it up).
 ///
 /// Thread-local storage tracks current thread ID for ownership checks.
 /// Lock count tracks recursive acquisitions (must release same number of times).
 /// </remarks>
 class SimpleLock {
+public:
+	/// <summary>Contention counters of a lock name (defined in SimpleLock.cpp)</summary>
+	struct Counters;
+
 private:
 	/// <summary>Thread-local storage for current thread ID</summary>
 	thread_local static std::thread::id _threadID;
 
+	/// <summary>Enables the contention counters of named locks</summary>
+	static atomic<bool> _telemetryEnabled;
+
+	static constexpr int SpinCount = 200; ///< Attempts before parking the thread
+
 	std::thread::id _holderThreadID; ///< Thread currently holding lock
 	uint32_t _lockCount;             ///< Recursive lock count (0 = unlocked)
-	atomic_flag _lock;               ///< Atomic flag for lock state
+	atomic<uint32_t> _state;         ///< 0 = free, 1 = locked, 2 = locked with waiters
+	Counters* _counters = nullptr;   ///< Contention counters (named locks only, shared by all locks with the same name)
 
-	/// <summary>Spin-wait until lock acquired or timeout</summary>
+	/// <summary>Wait until lock acquired or timeout</summary>
 	/// <param name="msTimeout">Timeout in milliseconds (0 = infinite)</param>
 	/// <returns>True if acquired, false if timed out</returns>
 	bool WaitForAcquire(uint32_t msTimeout);
 
+	/// <summary>Slow path of WaitForAcquire, when the lock is held by another thread</summary>
+	bool WaitForAcquireContended(uint32_t msTimeout);
+
 public:
 	/// <summary>Construct unlocked SimpleLock</summary>
 	SimpleLock();
 
+	/// <summary>Construct unlocked SimpleLock with contention counters (see GetContentionInfo)</summary>
+	/// <param name="name">Name displayed in the statistics (must be a string literal)</param>
+	explicit SimpleLock(const char* name);
+
+	SimpleLock(const SimpleLock&) = delete;
+	SimpleLock& operator=(const SimpleLock&) = delete;
+
 	/// <summary>Destructor - should only be called when lock is free</summary>
 	~SimpleLock();
 
@@ -111,7 +148,7 @@ public:
 	bool IsLockedByCurrentThread();
 
 	/// <summary>
-	/// Spin-wait until lock is released by owning thread.
+	/// Wait until lock is released by owning thread.
 	/// </summary>
 	/// <remarks>
 	/// Does NOT acquire lock - just waits until it becomes free.
@@ -127,4 +164,10 @@ public:
 	/// Only owning thread can release lock.
 	/// </remarks>
 	void Release();
+
+	/// <summary>Enables/disables the contention counters of named locks (resets them when enabled)</summary>
+	static void SetTelemetryEnabled(bool enabled);
+
+	/// <summary>Contention counters of every named lock, sorted by total wait time (highest first)</summary>
+	static vector<LockContentionInfo> GetContentionInfo();
 };
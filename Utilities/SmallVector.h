@@ -0,0 +1,185 @@
+#pragma once
+#include "pch.h"
+#include <initializer_list>
+#include <iterator>
+
+/// <summary>
+/// Vector of trivially copyable values that stores up to InlineCapacity elements inside the object.
+/// </summary>
+/// <remarks>
+/// Used for small values that are copied around every frame (e.g controller states), so that copying them
+/// doesn't allocate. Larger contents move to the heap, like a regular vector.
+///
+/// Supports the subset of std::vector's interface used by the callers (iterators are plain pointers).
+/// Iterators and pointers are invalidated by any operation that changes the size, and by copies/moves of
+/// the SmallVector itself (the inline storage moves with the object).
+/// </remarks>
+template <typename T, uint32_t InlineCapacity>
+class SmallVector {
+	static_assert(std::is_trivially_copyable<T>::value, "SmallVector only supports trivially copyable types");
+
+private:
+	T _inline[InlineCapacity];
+	T* _data = _inline;
+	uint32_t _size = 0;
+	uint32_t _capacity = InlineCapacity;
+
+	[[nodiscard]] bool IsInline() const { return _data == _inline; }
+
+	void Grow(uint32_t minCapacity) {
+		uint32_t capacity = std::max(minCapacity, _capacity * 2);
+		T* data = new T[capacity];
+		if (_size > 0) {
+			memcpy(data, _data, _size * sizeof(T));
+		}
+		if (!IsInline()) {
+			delete[] _data;
+		}
+		_data = data;
+		_capacity = capacity;
+	}
+
+	void CopyFrom(const T* src, uint32_t count) {
+		_size = 0;
+		reserve(count);
+		if (count > 0) {
+			memcpy(_data, src, count * sizeof(T));
+		}
+		_size = count;
+	}
+
+public:
+	using value_type = T;
+	using iterator = T*;
+	using const_iterator = const T*;
+
+	SmallVector() {}
+	SmallVector(std::initializer_list<T> values) { CopyFrom(values.begin(), (uint32_t)values.size()); }
+	SmallVector(const SmallVector& other) { CopyFrom(other._data, other._size); }
+
+	SmallVector(SmallVector&& other) noexcept {
+		if (other.IsInline()) {
+			CopyFrom(other._data, other._size);
+		} else {
+			// Take over the heap buffer
+			_data = other._data;
+			_size = other._size;
+			_capacity = other._capacity;
+			other._data = other._inline;
+			other._capacity = InlineCapacity;
+		}
+		other._size = 0;
+	}
+
+	~SmallVector() {
+		if (!IsInline()) {
+			delete[] _data;
+		}
+	}
+
+	SmallVector& operator=(const SmallVector& other) {
+		if (this != &other) {
+			CopyFrom(other._data, other._size);
+		}
+		return *this;
+	}
+
+	SmallVector& operator=(SmallVector&& other) noexcept {
+		if (this != &other) {
+			if (other.IsInline()) {
+				CopyFrom(other._data, other._size);
+			} else {
+				if (!IsInline()) {
+					delete[] _data;
+				}
+				_data = other._data;
+				_size = other._size;
+				_capacity = other._capacity;
+				other._data = other._inline;
+				other._capacity = InlineCapacity;
+			}
+			other._size = 0;
+		}
+		return *this;
+	}
+
+	SmallVector& operator=(std::initializer_list<T> values) {
+		CopyFrom(values.begin(), (uint32_t)values.size());
+		return *this;
+	}
+
+	[[nodiscard]] size_t size() const { return _size; }
+	[[nodiscard]] bool empty() const { return _size == 0; }
+	[[nodiscard]] size_t capacity() const { return _capacity; }
+
+	[[nodiscard]] T* data() { return _data; }
+	[[nodiscard]] const T* data() const { return _data; }
+	[[nodiscard]] T* begin() { return _data; }
+	[[nodiscard]] const T* begin() const { return _data; }
+	[[nodiscard]] T* end() { return _data + _size; }
+	[[nodiscard]] const T* end() const { return _data + _size; }
+
+	[[nodiscard]] T& operator[](size_t index) { return _data[index]; }
+	[[nodiscard]] const T& operator[](size_t index) const { return _data[index]; }
+
+	void clear() { _size = 0; }
+
+	void reserve(size_t capacity) {
+		if (capacity > _capacity) {
+			Grow((uint32_t)capacity);
+		}
+	}
+
+	void resize(size_t size, T value = T()) {
+		reserve(size);
+		for (size_t i = _size; i < size; i++) {
+			_data[i] = value;
+		}
+		_size = (uint32_t)size;
+	}
+
+	void push_back(T value) {
+		if (_size == _capacity) {
+			Grow(_size + 1);
+		}
+		_data[_size++] = value;
+	}
+
+	template <typename TIterator>
+		requires(!std::is_integral_v<TIterator>)
+	void assign(TIterator first, TIterator last) {
+		clear();
+		insert(end(), first, last);
+	}
+
+	/// <summary>Inserts count copies of value at pos</summary>
+	T* insert(const T* pos, size_t count, T value) {
+		uint32_t index = (uint32_t)(pos - _data);
+		reserve(_size + count);
+		memmove(_data + index + count, _data + index, (_size - index) * sizeof(T));
+		for (size_t i = 0; i < count; i++) {
+			_data[index + i] = value;
+		}
+		_size += (uint32_t)count;
+		return _data + index;
+	}
+
+	/// <summary>Inserts the [first, last) range at pos (the range must not be part of this SmallVector)</summary>
+	template <typename TIterator>
+		requires(!std::is_integral_v<TIterator>)
+	T* insert(const T* pos, TIterator first, TIterator last) {
+		uint32_t index = (uint32_t)(pos - _data);
+		uint32_t count = (uint32_t)std::distance(first, last);
+		reserve(_size + count);
+		memmove(_data + index + count, _data + index, (_size - index) * sizeof(T));
+		std::copy(first, last, _data + index);
+		_size += count;
+		return _data + index;
+	}
+
+	bool operator==(const SmallVector& other) const {
+		return _size == other._size && (_size == 0 || memcmp(_data, other._data, _size * sizeof(T)) == 0);
+	}
+
+	bool operator!=(const SmallVector& other) const { return !(*this == other); }
+};
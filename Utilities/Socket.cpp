@@ -8,6 +8,8 @@ using namespace std;
 #ifdef _WIN32
 #pragma comment(lib, "ws2_32.lib") // Winsock Library
 #define WIN32_LEAN_AND_MEAN
+// Default is 64 sockets per fd_set, not enough for a netplay server with many spectators
+#define FD_SETSIZE 256
 #include <winsock2.h>
 #include <Ws2tcpip.h>
 #include <Windows.h>
@@ -103,6 +105,8 @@ void Socket::Close() {
 	std::cout << "Socket closed." << std::endl;
 	shutdown(_socket, SD_SEND);
 	closesocket(_socket);
+	// Don't close the handle again in the destructor (it may have been reused by another socket/file)
+	_socket = INVALID_SOCKET;
 	SetConnectionErrorFlag();
 }
 
@@ -116,9 +120,9 @@ void Socket::Bind(uint16_t port) {
 	serverInf.sin_addr.s_addr = INADDR_ANY;
 	serverInf.sin_port = htons(port);
 
-	if (UPnPPortMapper::AddNATPortMapping(port, port, IPProtocol::TCP)) {
-		_UPnPPort = port;
-	}
+	// Mapped in the background, the socket can be used right away
+	UPnPPortMapper::AddNATPortMappingAsync(port, port, IPProtocol::TCP);
+	_UPnPPort = port;
 
 	if (::bind(_socket, (SOCKADDR*)(&serverInf), sizeof(serverInf)) == SOCKET_ERROR) {
 		std::cout << "Unable to bind socket." << std::endl;
@@ -164,7 +168,18 @@ bool Socket::Connect(const char* hostname, uint16_t port) {
 		// check if the socket is ready
 		int returnVal = select((int)_socket + 1, nullptr, &writeSockets, nullptr, &timeout);
 		if (returnVal > 0) {
-			result = true;
+			// The socket is also reported as writable when the connection failed (e.g refused)
+			int error = 0;
+#ifdef _WIN32
+			int errorSize = sizeof(error);
+#else
+			socklen_t errorSize = sizeof(error);
+#endif
+			getsockopt(_socket, SOL_SOCKET, SO_ERROR, (char*)&error, &errorSize);
+			result = error == 0;
+			if (!result) {
+				SetConnectionErrorFlag();
+			}
 		} else {
 			// Could not connect
 			if (returnVal == SOCKET_ERROR) {
@@ -231,6 +246,59 @@ int Socket::Send(char* buf, int len, int flags) {
 	return returnVal;
 }
 
+int Socket::TrySend(const char* buf, int len) {
+	if (_socket == INVALID_SOCKET) {
+		return 0;
+	}
+
+	int returnVal = send(_socket, buf, len, 0);
+	if (returnVal == SOCKET_ERROR) {
+		int nError = WSAGetLastError();
+		if (nError && !WouldBlock(nError)) {
+			SetConnectionErrorFlag();
+		}
+		return 0;
+	}
+	return returnVal;
+}
+
+void Socket::WaitForEvents(const vector<uintptr_t>& readHandles, const vector<uintptr_t>& writeHandles, int timeoutMs) {
+	fd_set readSockets;
+	fd_set writeSockets;
+	FD_ZERO(&readSockets);
+	FD_ZERO(&writeSockets);
+
+	uintptr_t maxHandle = 0;
+	int count = 0;
+	auto addHandles = [&](const vector<uintptr_t>& handles, fd_set& set) {
+		for (uintptr_t handle : handles) {
+#ifdef _WIN32
+			bool valid = handle != INVALID_SOCKET && set.fd_count < FD_SETSIZE;
+#else
+			// FD_SET can't be used with larger values, these sockets are only polled when the timeout expires
+			bool valid = handle != INVALID_SOCKET && handle < FD_SETSIZE;
+#endif
+			if (valid) {
+				FD_SET(handle, &set);
+				maxHandle = std::max(maxHandle, handle);
+				count++;
+			}
+		}
+	};
+	addHandles(readHandles, readSockets);
+	addHandles(writeHandles, writeSockets);
+
+	if (count == 0) {
+		std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(timeoutMs));
+		return;
+	}
+
+	TIMEVAL timeout;
+	timeout.tv_sec = timeoutMs / 1000;
+	timeout.tv_usec = (timeoutMs % 1000) * 1000;
+	select((int)maxHandle + 1, &readSockets, &writeSockets, nullptr, &timeout);
+}
+
 int Socket::Recv(char* buf, int len, int flags) {
 	int returnVal = recv(_socket, buf, len, flags);
 
@@ -44,7 +44,7 @@ private:
 
 	uintptr_t _socket = (uintptr_t)~0; ///< Socket handle (SOCKET on Windows, int on POSIX)
 	bool _connectionError = false;     ///< Connection error flag
-	int32_t _UPnPPort = -1;            ///< UPnP mapped port (-1 if none)
+	int32_t _UPnPPort = -1;            ///< Port the UPnP mapping was requested for (-1 if none)
 
 public:
 	/// <summary>Construct new socket and initialize platform networking</summary>
@@ -106,6 +106,14 @@ public:
 	/// <returns>Number of bytes sent, or -1 on error</returns>
 	int Send(char* buf, int len, int flags);
 
+	/// <summary>
+	/// Send as much data as the socket's buffer accepts, without waiting.
+	/// </summary>
+	/// <param name="buf">Data buffer to send</param>
+	/// <param name="len">Number of bytes to send</param>
+	/// <returns>Number of bytes sent (0 if the buffer is full or on error, see ConnectionError())</returns>
+	int TrySend(const char* buf, int len);
+
 	/// <summary>
 	/// Buffer data for later sending (batching optimization).
 	/// </summary>
@@ -125,4 +133,16 @@ public:
 	/// <param name="flags">Socket flags</param>
 	/// <returns>Number of bytes received, 0 on disconnect, -1 on error</returns>
 	int Recv(char* buf, int len, int flags);
+
+	/// <summary>Socket handle, for WaitForEvents()</summary>
+	[[nodiscard]] uintptr_t GetHandle() const { return _socket; }
+
+	/// <summary>
+	/// Wait until one of the sockets can be read (or accepts a connection) or written, or the timeout expires.
+	/// </summary>
+	/// <param name="readHandles">Sockets waited on for incoming data/connections</param>
+	/// <param name="writeHandles">Sockets waited on for room in their send buffer</param>
+	/// <param name="timeoutMs">Max wait time</param>
+	/// <remarks>Uses select(), invalid handles (closed sockets) are ignored.</remarks>
+	static void WaitForEvents(const vector<uintptr_t>& readHandles, const vector<uintptr_t>& writeHandles, int timeoutMs);
 };
@@ -218,7 +218,7 @@ public:
 	/// <param name="maxLen">Maximum length to read</param>
 	/// <returns>String up to first null byte or maxLen, whichever is shorter</returns>
 	/// <remarks>Useful for reading null-terminated strings from binary data.</remarks>
-	[[nodiscard]] static string GetString(uint8_t* src, int maxLen) {
+	[[nodiscard]] static string GetString(const uint8_t* src, int maxLen) {
 		for (int i = 0; i < maxLen; i++) {
 			if (src[i] == 0) {
 				return string(src, src + i);
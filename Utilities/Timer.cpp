@@ -4,6 +4,32 @@
 #include <thread>
 #include <chrono>
 
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+
+namespace {
+	/// <summary>High resolution waitable timer of the calling thread (null if not supported by the OS)</summary>
+	struct ThreadWaitableTimer {
+		HANDLE Handle;
+
+		ThreadWaitableTimer() {
+			Handle = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+		}
+
+		~ThreadWaitableTimer() {
+			if (Handle) {
+				CloseHandle(Handle);
+			}
+		}
+	};
+}
+#endif
+
 using namespace std::chrono;
 
 Timer::Timer() {
@@ -28,3 +54,24 @@ void Timer::WaitUntil(double targetMillisecond) const {
 		}
 	}
 }
+
+void Timer::Sleep(double milliseconds) {
+	if (milliseconds <= 0) {
+		return;
+	}
+
+#ifdef _WIN32
+	thread_local ThreadWaitableTimer timer;
+	if (timer.Handle) {
+		// Relative due time, in 100ns units
+		LARGE_INTEGER dueTime;
+		dueTime.QuadPart = -(LONGLONG)(milliseconds * 10000);
+		if (SetWaitableTimer(timer.Handle, &dueTime, 0, nullptr, nullptr, FALSE)) {
+			WaitForSingleObject(timer.Handle, INFINITE);
+			return;
+		}
+	}
+#endif
+
+	std::this_thread::sleep_for(duration<double, std::milli>(milliseconds));
+}
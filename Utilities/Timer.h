@@ -56,4 +56,15 @@ public:
 	/// Uses std::this_thread::sleep_for for efficient waiting.
 	/// </remarks>
 	void WaitUntil(double targetMillisecond) const;
+
+	/// <summary>
+	/// Sleep for a fractional number of milliseconds.
+	/// </summary>
+	/// <remarks>
+	/// Windows: uses a high resolution waitable timer when available (Windows 10 1803+, ~0.5ms precision without
+	/// changing the system timer resolution), otherwise the regular timer (1ms with timeBeginPeriod).
+	/// Other platforms: nanosleep (usually precise to ~0.1ms).
+	/// The actual delay can be longer than requested, never shorter.
+	/// </remarks>
+	static void Sleep(double milliseconds);
 };
\ No newline at end of file
@@ -1,4 +1,9 @@
 #include "pch.h"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 #include "UPnPPortMapper.h"
 
 #ifdef _WIN32
@@ -6,145 +11,270 @@
 #include <natupnp.h>
 #include <ws2tcpip.h>
 
-bool UPnPPortMapper::AddNATPortMapping(uint16_t internalPort, uint16_t externalPort, IPProtocol protocol) {
-	bool result = false;
+namespace {
+	/// <summary>IPv4 addresses of this computer (port mappings are added for each of them)</summary>
+	vector<wstring> GetLocalIPs() {
+		vector<wstring> localIPs;
+		ADDRINFOW* result = nullptr;
+		ADDRINFOW* current = nullptr;
+		ADDRINFOW hints;
+
+		ZeroMemory(&hints, sizeof(hints));
+		hints.ai_family = AF_INET;
+		hints.ai_socktype = SOCK_STREAM;
+		hints.ai_protocol = IPPROTO_TCP;
+
+		wchar_t hostName[255];
+		DWORD hostSize = 255;
+		GetComputerName(hostName, &hostSize);
+
+		if (GetAddrInfoW(hostName, nullptr, &hints, &result) == 0) {
+			current = result;
+			while (current != nullptr) {
+				wchar_t ipAddr[255];
+				DWORD ipSize = 255;
+
+				if (WSAAddressToString(current->ai_addr, (DWORD)current->ai_addrlen, nullptr, ipAddr, &ipSize) == 0) {
+					if (std::find(localIPs.begin(), localIPs.end(), ipAddr) == localIPs.end()) {
+						localIPs.push_back(ipAddr);
+					}
+				}
+				current = current->ai_next;
+			}
+			FreeAddrInfoW(result);
+		}
+
+		return localIPs;
+	}
 
-	CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+	/// <summary>Router's port mapping service (COM/IUPnPNAT), only used by the UPnP thread</summary>
+	class UPnPGateway {
+	public:
+		static constexpr bool IsSupported = true;
+
+	private:
+		bool _comInitialized = false;
+		IUPnPNAT* _nat = nullptr;
+		IStaticPortMappingCollection* _mappings = nullptr;
+
+	public:
+		bool Discover() {
+			if (!_comInitialized) {
+				CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+				_comInitialized = true;
+			}
+
+			if (!_nat && FAILED(CoCreateInstance(__uuidof(UPnPNAT), nullptr, CLSCTX_ALL, __uuidof(IUPnPNAT), (void**)&_nat))) {
+				_nat = nullptr;
+				return false;
+			}
 
-	IUPnPNAT* nat = nullptr;
-	HRESULT hResult = CoCreateInstance(__uuidof(UPnPNAT), nullptr, CLSCTX_ALL, __uuidof(IUPnPNAT), (void**)&nat);
+			// Slow part: waits for the router to answer (or for a timeout when there is no UPnP device)
+			if (FAILED(_nat->get_StaticPortMappingCollection(&_mappings)) || !_mappings) {
+				_mappings = nullptr;
+				return false;
+			}
+			return true;
+		}
 
-	BSTR proto = SysAllocString((protocol == IPProtocol::TCP) ? L"TCP" : L"UDP");
+		bool Add(uint16_t internalPort, uint16_t externalPort, IPProtocol protocol) {
+			BSTR proto = SysAllocString((protocol == IPProtocol::TCP) ? L"TCP" : L"UDP");
 
-	if (SUCCEEDED(hResult) && nat) {
-		IStaticPortMappingCollection* spmc = nullptr;
-		hResult = nat->get_StaticPortMappingCollection(&spmc);
-		if (SUCCEEDED(hResult) && spmc) {
-			IStaticPortMapping* spm = nullptr;
-			hResult = spmc->get_Item(externalPort, proto, &spm);
-			if (spm != nullptr) {
+			IStaticPortMapping* existing = nullptr;
+			if (SUCCEEDED(_mappings->get_Item(externalPort, proto, &existing)) && existing) {
 				// An identical mapping already exists, remove it
-				if (RemoveNATPortMapping(externalPort, protocol)) {
-					// std::cout << "Removed existing UPnP mapping." << std::endl;
+				existing->Release();
+				_mappings->Remove(externalPort, proto);
+			}
+
+			bool result = false;
+			BSTR desc = SysAllocString(L"Nexen NetPlay");
+			for (const wstring& localIP : GetLocalIPs()) {
+				BSTR clientStr = SysAllocString(localIP.c_str());
+				IStaticPortMapping* spm = nullptr;
+				HRESULT hResult = _mappings->Add(externalPort, proto, internalPort, clientStr, true, desc, &spm);
+				SysFreeString(clientStr);
+
+				if (SUCCEEDED(hResult) && spm) {
+					// Successfully added a new port mapping
+					result = true;
+				}
+				if (spm) {
 					spm->Release();
-					spm = nullptr;
 				}
 			}
+			SysFreeString(desc);
+			SysFreeString(proto);
 
-			if (!SUCCEEDED(hResult) || spm == nullptr) {
-				// std::cout << "Attempting to automatically forward port via UPnP..." << std::endl;
-
-				vector<wstring> localIPs = GetLocalIPs();
-				BSTR desc = SysAllocString(L"Nexen NetPlay");
-				spm = nullptr;
-
-				for (size_t i = 0, len = localIPs.size(); i < len; i++) {
-					BSTR clientStr = SysAllocString(localIPs[i].c_str());
-					hResult = spmc->Add(externalPort, proto, internalPort, clientStr, true, desc, &spm);
-					SysFreeString(clientStr);
-					SysFreeString(desc);
-
-					if (SUCCEEDED(hResult) && spm) {
-						// Successfully added a new port mapping
-						// std::cout << std::dec << "Forwarded port " << externalPort << " to IP " << utf8::utf8::encode(localIPs[i]) << std::endl;
-						result = true;
-					} else {
-						// std::cout << "Unable to add UPnP port mapping. IP: " << utf8::utf8::encode(localIPs[i]) << " HRESULT: 0x" << std::hex << hResult << std::endl;
-					}
+			return result;
+		}
 
-					if (spm) {
-						spm->Release();
-					}
-				}
-			} else {
-				// std::cout << "Unable to add UPnP port mapping." << std::endl;
-			}
-			spmc->Release();
+		bool Remove(uint16_t externalPort, IPProtocol protocol) {
+			BSTR proto = SysAllocString((protocol == IPProtocol::TCP) ? L"TCP" : L"UDP");
+			bool result = SUCCEEDED(_mappings->Remove(externalPort, proto));
+			SysFreeString(proto);
+			return result;
 		}
-		nat->Release();
-	}
+	};
+}
 
-	SysFreeString(proto);
+#else
 
-	CoUninitialize();
+namespace {
+	class UPnPGateway {
+	public:
+		static constexpr bool IsSupported = false;
 
-	return result;
+		bool Discover() { return false; }
+		bool Add(uint16_t internalPort, uint16_t externalPort, IPProtocol protocol) { return false; }
+		bool Remove(uint16_t externalPort, IPProtocol protocol) { return false; }
+	};
 }
 
-bool UPnPPortMapper::RemoveNATPortMapping(uint16_t externalPort, IPProtocol protocol) {
-	IUPnPNAT* nat = nullptr;
-	IStaticPortMappingCollection* spmc;
-	bool result = false;
+#endif
+
+namespace {
+	struct PortMapping {
+		uint16_t InternalPort;
+		uint16_t ExternalPort;
+		IPProtocol Protocol;
+
+		[[nodiscard]] bool Matches(uint16_t externalPort, IPProtocol protocol) const { return ExternalPort == externalPort && Protocol == protocol; }
+	};
+
+	/// <summary>
+	/// Thread that talks to the router: port mappings are queued by the sockets and added in the background.
+	/// </summary>
+	/// <remarks>
+	/// The gateway found by the first discovery is kept for the following mappings. A failed discovery
+	/// (no UPnP device, which takes a timeout to find out) is only retried after DiscoveryRetryDelay.
+	/// </remarks>
+	class UPnPWorker {
+	private:
+		static constexpr std::chrono::seconds DiscoveryRetryDelay = std::chrono::seconds(60);
+
+		std::thread _thread;
+		std::mutex _mutex;
+		std::condition_variable _requestCv;
+		std::condition_variable _doneCv;
+		std::deque<PortMapping> _additions;
+		std::deque<PortMapping> _removals;
+		vector<PortMapping> _mapped;
+		optional<PortMapping> _current; ///< Addition in progress
+		bool _cancelCurrent = false;    ///< The addition in progress was removed before it was done
+
+		// Only used by the worker thread
+		UPnPGateway _gateway;
+		bool _gatewayFound = false;
+		bool _discoveryDone = false;
+		std::chrono::steady_clock::time_point _lastDiscovery;
+
+		auto Find(std::deque<PortMapping>& mappings, uint16_t externalPort, IPProtocol protocol) {
+			return std::find_if(mappings.begin(), mappings.end(), [=](const PortMapping& m) { return m.Matches(externalPort, protocol); });
+		}
 
-	CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+		bool HasGateway() {
+			auto now = std::chrono::steady_clock::now();
+			if (!_gatewayFound && (!_discoveryDone || now - _lastDiscovery >= DiscoveryRetryDelay)) {
+				_gatewayFound = _gateway.Discover();
+				_discoveryDone = true;
+				_lastDiscovery = now;
+			}
+			return _gatewayFound;
+		}
+
+		void WorkerLoop() {
+			std::unique_lock<std::mutex> lock(_mutex);
+			while (true) {
+				_requestCv.wait(lock, [this]() { return !_additions.empty() || !_removals.empty(); });
+
+				if (!_removals.empty()) {
+					PortMapping mapping = _removals.front();
+					lock.unlock();
+					_gateway.Remove(mapping.ExternalPort, mapping.Protocol);
+					lock.lock();
+					_removals.pop_front();
+					_doneCv.notify_all();
+					continue;
+				}
 
-	HRESULT hResult = ::CoCreateInstance(__uuidof(UPnPNAT), nullptr, CLSCTX_ALL, __uuidof(IUPnPNAT), (void**)&nat);
+				PortMapping mapping = _additions.front();
+				_additions.pop_front();
+				_current = mapping;
+				_cancelCurrent = false;
+				lock.unlock();
 
-	BSTR proto = SysAllocString((protocol == IPProtocol::TCP) ? L"TCP" : L"UDP");
+				bool added = HasGateway() && _gateway.Add(mapping.InternalPort, mapping.ExternalPort, mapping.Protocol);
+				if (added) {
+					std::cout << "Forwarded port " << mapping.ExternalPort << " (UPnP)." << std::endl;
+				}
 
-	if (SUCCEEDED(hResult) && nat) {
-		hResult = nat->get_StaticPortMappingCollection(&spmc);
-		if (SUCCEEDED(hResult) && spmc) {
-			spmc->Remove(externalPort, proto);
-			spmc->Release();
-			result = true;
+				lock.lock();
+				if (added && _cancelCurrent) {
+					// The socket was closed in the meantime
+					lock.unlock();
+					_gateway.Remove(mapping.ExternalPort, mapping.Protocol);
+					lock.lock();
+				} else if (added) {
+					_mapped.push_back(mapping);
+				}
+				_current.reset();
+			}
 		}
-		nat->Release();
-	}
 
-	SysFreeString(proto);
+	public:
+		void Add(uint16_t internalPort, uint16_t externalPort, IPProtocol protocol) {
+			std::lock_guard<std::mutex> lock(_mutex);
+			if (!_thread.joinable()) {
+				_thread = std::thread([this]() { WorkerLoop(); });
+			}
+			_additions.push_back({internalPort, externalPort, protocol});
+			_requestCv.notify_one();
+		}
 
-	CoUninitialize();
+		bool Remove(uint16_t externalPort, IPProtocol protocol) {
+			std::unique_lock<std::mutex> lock(_mutex);
+			auto pending = Find(_additions, externalPort, protocol);
+			if (pending != _additions.end()) {
+				// Not sent to the router yet
+				_additions.erase(pending);
+				return true;
+			}
 
-	return result;
-}
+			if (_current && _current->Matches(externalPort, protocol)) {
+				// Removed by the worker once the router answers, no need to wait for it
+				_cancelCurrent = true;
+				return true;
+			}
 
-vector<wstring> UPnPPortMapper::GetLocalIPs() {
-	vector<wstring> localIPs;
-	ADDRINFOW* result = nullptr;
-	ADDRINFOW* current = nullptr;
-	ADDRINFOW hints;
-
-	ZeroMemory(&hints, sizeof(hints));
-	hints.ai_family = AF_INET;
-	hints.ai_socktype = SOCK_STREAM;
-	hints.ai_protocol = IPPROTO_TCP;
-
-	wchar_t hostName[255];
-	DWORD hostSize = 255;
-	GetComputerName(hostName, &hostSize);
-
-	if (GetAddrInfoW(hostName, nullptr, &hints, &result) == 0) {
-		current = result;
-		while (current != nullptr) {
-			wchar_t ipAddr[255];
-			DWORD ipSize = 255;
-
-			if (WSAAddressToString(current->ai_addr, (DWORD)current->ai_addrlen, nullptr, ipAddr, &ipSize) == 0) {
-				if (std::find(localIPs.begin(), localIPs.end(), ipAddr) == localIPs.end()) {
-					localIPs.push_back(ipAddr);
-				}
+			auto mapped = std::find_if(_mapped.begin(), _mapped.end(), [=](const PortMapping& m) { return m.Matches(externalPort, protocol); });
+			if (mapped == _mapped.end()) {
+				return false;
 			}
-			current = current->ai_next;
+			_mapped.erase(mapped);
+
+			// The router answered when the mapping was added, wait for it to be removed (the socket is being closed)
+			_removals.push_back({0, externalPort, protocol});
+			_requestCv.notify_one();
+			_doneCv.wait(lock, [&]() { return Find(_removals, externalPort, protocol) == _removals.end(); });
+			return true;
 		}
-		FreeAddrInfoW(result);
-	}
+	};
 
-	return localIPs;
+	UPnPWorker& GetWorker() {
+		// Never destroyed: the thread may be waiting for a router's answer when the process exits
+		static UPnPWorker* worker = new UPnPWorker();
+		return *worker;
+	}
 }
 
-#else
-
-bool UPnPPortMapper::AddNATPortMapping(uint16_t internalPort, uint16_t externalPort, IPProtocol protocol) {
-	return false;
+void UPnPPortMapper::AddNATPortMappingAsync(uint16_t internalPort, uint16_t externalPort, IPProtocol protocol) {
+	if constexpr (!UPnPGateway::IsSupported) {
+		return;
+	}
+	GetWorker().Add(internalPort, externalPort, protocol);
 }
 
 bool UPnPPortMapper::RemoveNATPortMapping(uint16_t externalPort, IPProtocol protocol) {
-	return false;
+	return GetWorker().Remove(externalPort, protocol);
 }
-
-vector<wstring> UPnPPortMapper::GetLocalIPs() {
-	return vector<wstring>();
-}
-
-#endif
\ No newline at end of file
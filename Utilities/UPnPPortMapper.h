@@ -23,6 +23,10 @@ enum class IPProtocol {
 /// 2. Discover UPnP-enabled routers via SSDP
 /// 3. Request port mapping via UPnP Internet Gateway Device (IGD) protocol
 ///
+/// Discovery can take seconds (or a timeout on networks without UPnP), so the requests are processed by a
+/// background thread: servers start listening right away, and the mapping is applied once the router answers.
+/// The discovered router is reused for the following mappings.
+///
 /// Requirements:
 /// - Router must support UPnP IGD
 /// - UPnP must be enabled in router settings
@@ -32,25 +36,13 @@ enum class IPProtocol {
 /// Security note: UPnP can be security risk - some routers have vulnerable implementations.
 /// </remarks>
 class UPnPPortMapper {
-private:
-	/// <summary>
-	/// Get list of local IP addresses on all network interfaces.
-	/// </summary>
-	/// <returns>Vector of IP addresses as wide strings</returns>
-	/// <remarks>
-	/// Enumerates all network adapters and extracts IPv4 addresses.
-	/// Excludes loopback (127.0.0.1) and link-local addresses.
-	/// </remarks>
-	static vector<wstring> GetLocalIPs();
-
 public:
 	/// <summary>
-	/// Add NAT port mapping on router.
+	/// Queue a NAT port mapping on router (returns immediately, the mapping is added in the background).
 	/// </summary>
 	/// <param name="internalPort">Local port on this machine</param>
 	/// <param name="externalPort">External port on router (visible to internet)</param>
 	/// <param name="protocol">TCP or UDP protocol</param>
-	/// <returns>True if mapping added successfully</returns>
 	/// <remarks>
 	/// Creates persistent port forwarding rule:
 	/// Internet → Router:externalPort → LocalIP:internalPort
@@ -58,16 +50,17 @@ public:
 	/// Mapping persists until RemoveNATPortMapping() called or router rebooted.
 	/// Multiple mappings can exist for same internal port with different protocols.
 	/// </remarks>
-	static bool AddNATPortMapping(uint16_t internalPort, uint16_t externalPort, IPProtocol protocol);
+	static void AddNATPortMappingAsync(uint16_t internalPort, uint16_t externalPort, IPProtocol protocol);
 
 	/// <summary>
 	/// Remove NAT port mapping from router.
 	/// </summary>
 	/// <param name="externalPort">External port to unmap</param>
 	/// <param name="protocol">TCP or UDP protocol</param>
-	/// <returns>True if mapping removed successfully</returns>
+	/// <returns>True if a mapping was removed, or a queued mapping was cancelled</returns>
 	/// <remarks>
-	/// Removes port forwarding rule created by AddNATPortMapping().
+	/// Removes port forwarding rule created by AddNATPortMappingAsync().
+	/// Waits for the router when the mapping was added, a mapping that is still in progress is removed once it's done.
 	/// Always call this on shutdown to clean up port mappings.
 	/// </remarks>
 	static bool RemoveNATPortMapping(uint16_t externalPort, IPProtocol protocol);
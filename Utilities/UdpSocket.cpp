@@ -0,0 +1,132 @@
+#include "pch.h"
+#include <cstring>
+#include "Utilities/UdpSocket.h"
+#include "Utilities/UPnPPortMapper.h"
+
+#ifdef _WIN32
+#pragma comment(lib, "ws2_32.lib") // Winsock Library
+#define WIN32_LEAN_AND_MEAN
+#include <winsock2.h>
+#include <Ws2tcpip.h>
+#include <Windows.h>
+typedef int socklen_t;
+#else
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/ioctl.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <unistd.h>
+
+#define INVALID_SOCKET (uintptr_t)-1
+#define SOCKET_ERROR   -1
+#define SOCKADDR_IN    sockaddr_in
+#define SOCKADDR       sockaddr
+#define closesocket    close
+#define ioctlsocket    ioctl
+#endif
+
+UdpSocket::UdpSocket() {
+#ifdef _WIN32
+	WSADATA wsaDat;
+	if (WSAStartup(MAKEWORD(2, 2), &wsaDat) != 0) {
+		std::cout << "WSAStartup failed." << std::endl;
+		return;
+	}
+	_cleanupWSA = true;
+#endif
+
+	_socket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	if (_socket == INVALID_SOCKET) {
+		std::cout << "UDP socket creation failed." << std::endl;
+		return;
+	}
+
+	// Non-blocking mode
+	u_long iMode = 1;
+	ioctlsocket(_socket, FIONBIO, &iMode);
+
+	int bufferSize = 0x40000;
+	setsockopt(_socket, SOL_SOCKET, SO_RCVBUF, (char*)&bufferSize, sizeof(int));
+	setsockopt(_socket, SOL_SOCKET, SO_SNDBUF, (char*)&bufferSize, sizeof(int));
+}
+
+UdpSocket::~UdpSocket() {
+	if (_UPnPPort != -1) {
+		UPnPPortMapper::RemoveNATPortMapping(static_cast<uint16_t>(_UPnPPort), IPProtocol::UDP);
+	}
+
+	if (_socket != INVALID_SOCKET) {
+		closesocket(_socket);
+	}
+
+#ifdef _WIN32
+	if (_cleanupWSA) {
+		WSACleanup();
+	}
+#endif
+}
+
+bool UdpSocket::Bind(uint16_t port, bool mapPort) {
+	if (_socket == INVALID_SOCKET) {
+		return false;
+	}
+
+	SOCKADDR_IN addr = {};
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = INADDR_ANY;
+	addr.sin_port = htons(port);
+
+	if (mapPort) {
+		// Mapped in the background, the socket can be used right away
+		UPnPPortMapper::AddNATPortMappingAsync(port, port, IPProtocol::UDP);
+		_UPnPPort = port;
+	}
+
+	if (::bind(_socket, (SOCKADDR*)&addr, sizeof(addr)) == SOCKET_ERROR) {
+		std::cout << "Unable to bind UDP socket." << std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool UdpSocket::Resolve(const char* hostname, uint16_t port, UdpEndpoint& endpoint) {
+	addrinfo hint = {};
+	hint.ai_family = AF_INET;
+	hint.ai_protocol = IPPROTO_UDP;
+	hint.ai_socktype = SOCK_DGRAM;
+
+	addrinfo* addrInfo;
+	if (getaddrinfo(hostname, std::to_string(port).c_str(), &hint, &addrInfo) != 0) {
+		return false;
+	}
+
+	SOCKADDR_IN* addr = (SOCKADDR_IN*)addrInfo->ai_addr;
+	endpoint.Address = addr->sin_addr.s_addr;
+	endpoint.Port = addr->sin_port;
+	freeaddrinfo(addrInfo);
+	return true;
+}
+
+void UdpSocket::SendTo(const UdpEndpoint& endpoint, const uint8_t* data, int length) {
+	SOCKADDR_IN addr = {};
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = endpoint.Address;
+	addr.sin_port = endpoint.Port;
+	sendto(_socket, (const char*)data, length, 0, (SOCKADDR*)&addr, sizeof(addr));
+}
+
+int UdpSocket::RecvFrom(uint8_t* buffer, int length, UdpEndpoint& from) {
+	SOCKADDR_IN addr = {};
+	socklen_t addrSize = sizeof(addr);
+	int returnVal = (int)recvfrom(_socket, (char*)buffer, length, 0, (SOCKADDR*)&addr, &addrSize);
+	if (returnVal < 0) {
+		// No datagram available (or error, e.g ICMP port unreachable on Windows)
+		return -1;
+	}
+
+	from.Address = addr.sin_addr.s_addr;
+	from.Port = addr.sin_port;
+	return returnVal;
+}
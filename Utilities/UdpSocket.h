@@ -0,0 +1,57 @@
+#pragma once
+
+#include "pch.h"
+
+/// <summary>
+/// IPv4 address and port of a UDP peer (both in network byte order).
+/// </summary>
+struct UdpEndpoint {
+	uint32_t Address = 0;
+	uint16_t Port = 0;
+
+	[[nodiscard]] bool IsValid() const { return Port != 0; }
+	bool operator==(const UdpEndpoint& other) const { return Address == other.Address && Port == other.Port; }
+};
+
+/// <summary>
+/// Cross-platform non-blocking UDP socket (datagrams, no connection).
+/// </summary>
+/// <remarks>
+/// Counterpart of Socket for traffic that must not wait for retransmissions (e.g netplay input): datagrams can be
+/// lost, duplicated or reordered, the caller is responsible for detecting it.
+///
+/// Thread safety: SendTo() and RecvFrom() can be called from different threads, Bind() must be called first.
+/// </remarks>
+class UdpSocket {
+private:
+#ifdef _WIN32
+	bool _cleanupWSA = false; ///< Track if WSA needs cleanup on Windows
+#endif
+
+	uintptr_t _socket = (uintptr_t)~0; ///< Socket handle (SOCKET on Windows, int on POSIX)
+	int32_t _UPnPPort = -1;            ///< Port the UPnP mapping was requested for (-1 if none)
+
+public:
+	UdpSocket();
+	~UdpSocket();
+
+	UdpSocket(const UdpSocket&) = delete;
+	UdpSocket& operator=(const UdpSocket&) = delete;
+
+	/// <summary>Binds the socket to a local port (0 = any port, for clients), returns false on error</summary>
+	/// <param name="mapPort">Ask the router to forward the port (UPnP), for servers</param>
+	bool Bind(uint16_t port, bool mapPort);
+
+	/// <summary>Resolves a hostname/IP address</summary>
+	static bool Resolve(const char* hostname, uint16_t port, UdpEndpoint& endpoint);
+
+	/// <summary>Sends a single datagram (dropped silently if the socket's buffer is full)</summary>
+	void SendTo(const UdpEndpoint& endpoint, const uint8_t* data, int length);
+
+	/// <summary>Receives a single datagram</summary>
+	/// <returns>Size of the datagram, or -1 if none is available</returns>
+	int RecvFrom(uint8_t* buffer, int length, UdpEndpoint& from);
+
+	/// <summary>Socket handle, for Socket::WaitForEvents()</summary>
+	[[nodiscard]] uintptr_t GetHandle() const { return _socket; }
+};
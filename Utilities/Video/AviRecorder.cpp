@@ -4,7 +4,6 @@
 AviRecorder::AviRecorder(VideoCodec codec, uint32_t compressionLevel) {
 	_recording = false;
 	_stopFlag = false;
-	_framePending = false;
 	_frameBufferLength = 0;
 	_sampleRate = 0;
 	_codec = codec;
@@ -15,8 +14,6 @@ AviRecorder::~AviRecorder() {
 	if (_recording) {
 		StopRecording();
 	}
-
-	_frameBuffer.reset();
 }
 
 bool AviRecorder::Init(const string& filename) {
@@ -37,7 +34,12 @@ bool AviRecorder::StartRecording(uint32_t width, uint32_t height, uint32_t bpp,
 		_height = height;
 		_fps = fps;
 		_frameBufferLength = height * width * bpp;
-		_frameBuffer = std::make_unique<uint8_t[]>(_frameBufferLength);
+		_stopFlag = false;
+		_frameQueue = {};
+		_freeBuffers.clear();
+		for (uint32_t i = 0; i < MaxQueuedFrames; i++) {
+			_freeBuffers.push_back(std::make_unique<uint8_t[]>(_frameBufferLength));
+		}
 
 		_aviWriter = std::make_unique<AviWriter>();
 		if (!_aviWriter->StartWrite(_outputFile, _codec, width, height, bpp, (uint32_t)(_fps * 1000000), audioSampleRate, _compressionLevel)) {
@@ -46,15 +48,26 @@ bool AviRecorder::StartRecording(uint32_t width, uint32_t height, uint32_t bpp,
 		}
 
 		_aviWriterThread = std::thread([this]() {
-			while (!_stopFlag) {
-				_waitFrame.Wait();
-				if (_stopFlag) {
-					break;
+			while (true) {
+				unique_ptr<uint8_t[]> frame;
+				{
+					std::unique_lock<std::mutex> lock(_queueMutex);
+					_frameCv.wait(lock, [this] { return _stopFlag || !_frameQueue.empty(); });
+					if (_frameQueue.empty()) {
+						// Stop requested and every queued frame has been written
+						return;
+					}
+					frame = std::move(_frameQueue.front());
+					_frameQueue.pop();
 				}
 
-				auto lock = _lock.AcquireSafe();
-				_aviWriter->AddFrame(_frameBuffer.get());
-				_framePending = false;
+				_aviWriter->AddFrame(frame.get());
+
+				{
+					std::lock_guard<std::mutex> lock(_queueMutex);
+					_freeBuffers.push_back(std::move(frame));
+				}
+				_bufferCv.notify_one();
 			}
 		});
 
@@ -67,8 +80,11 @@ void AviRecorder::StopRecording() {
 	if (_recording) {
 		_recording = false;
 
-		_stopFlag = true;
-		_waitFrame.Signal();
+		{
+			std::lock_guard<std::mutex> lock(_queueMutex);
+			_stopFlag = true;
+		}
+		_frameCv.notify_one();
 		_aviWriterThread.join();
 
 		_aviWriter->EndWrite();
@@ -81,15 +97,22 @@ bool AviRecorder::AddFrame(void* frameBuffer, uint32_t width, uint32_t height, d
 		if (_width != width || _height != height || _fps != fps) {
 			return false;
 		} else {
-			while (_framePending) {
-				// Previous frame isn't done processing yet, wait
-				std::this_thread::sleep_for(std::chrono::duration<int, std::milli>(1));
+			unique_ptr<uint8_t[]> buffer;
+			{
+				// Only blocks when the encoder is MaxQueuedFrames frames behind
+				std::unique_lock<std::mutex> lock(_queueMutex);
+				_bufferCv.wait(lock, [this] { return !_freeBuffers.empty(); });
+				buffer = std::move(_freeBuffers.back());
+				_freeBuffers.pop_back();
 			}
 
-			auto lock = _lock.AcquireSafe();
-			_framePending = true;
-			memcpy(_frameBuffer.get(), frameBuffer, _frameBufferLength);
-			_waitFrame.Signal();
+			memcpy(buffer.get(), frameBuffer, _frameBufferLength);
+
+			{
+				std::lock_guard<std::mutex> lock(_queueMutex);
+				_frameQueue.push(std::move(buffer));
+			}
+			_frameCv.notify_one();
 		}
 	}
 	return true;
@@ -1,8 +1,9 @@
 #pragma once
 #include "pch.h"
+#include <condition_variable>
+#include <mutex>
+#include <queue>
 #include <thread>
-#include "Utilities/AutoResetEvent.h"
-#include "Utilities/SimpleLock.h"
 #include "Utilities/Video/AviWriter.h"
 #include "Utilities/Video/IVideoRecorder.h"
 
@@ -18,8 +19,9 @@
 /// - Configurable compression levels
 ///
 /// Threading model:
-/// - AddFrame() buffers frame and signals AviWriter thread
-/// - AviWriter thread encodes and writes to disk
+/// - AddFrame() copies the frame into a free buffer and queues it
+/// - AviWriter thread encodes queued frames in order and writes them to disk
+/// - AddFrame() only blocks when MaxQueuedFrames frames are waiting for the encoder
 /// - AddSound() writes audio samples directly
 ///
 /// Supported codecs (VideoCodec enum):
@@ -38,20 +40,25 @@
 /// </remarks>
 class AviRecorder final : public IVideoRecorder {
 private:
+	/// <summary>Frames the encoder may fall behind before AddFrame() blocks</summary>
+	/// <remarks>Absorbs keyframes and busy scenes that take longer than a frame to encode.</remarks>
+	static constexpr uint32_t MaxQueuedFrames = 8;
+
 	std::thread _aviWriterThread; ///< Background encoding thread
 
 	unique_ptr<AviWriter> _aviWriter; ///< AVI file writer
 
-	string _outputFile;        ///< Output file path
-	SimpleLock _lock;          ///< Thread synchronization lock
-	AutoResetEvent _waitFrame; ///< Frame ready signal
+	string _outputFile; ///< Output file path
 
-	atomic<bool> _stopFlag;     ///< Stop signal for thread
-	atomic<bool> _framePending; ///< Frame waiting for encoding
+	std::mutex _queueMutex;                        ///< Protects _frameQueue, _freeBuffers and _stopFlag
+	std::condition_variable _frameCv;              ///< Signaled when a frame is queued or recording stops
+	std::condition_variable _bufferCv;             ///< Signaled when a frame buffer is returned
+	std::queue<unique_ptr<uint8_t[]>> _frameQueue; ///< Frames waiting for encoding, oldest first
+	vector<unique_ptr<uint8_t[]>> _freeBuffers;    ///< Preallocated buffers not in use
+	bool _stopFlag;                                ///< Stop signal for thread (after the queue is drained)
 
-	bool _recording;                         ///< Recording active flag
-	std::unique_ptr<uint8_t[]> _frameBuffer; ///< Frame data buffer
-	uint32_t _frameBufferLength;             ///< Frame buffer size in bytes
+	bool _recording;             ///< Recording active flag
+	uint32_t _frameBufferLength; ///< Frame buffer size in bytes
 	uint32_t _sampleRate;                    ///< Audio sample rate
 
 	double _fps;      ///< Frames per second
@@ -78,13 +85,13 @@ public:
 	/// <summary>Start recording with video/audio parameters</summary>
 	bool StartRecording(uint32_t width, uint32_t height, uint32_t bpp, uint32_t audioSampleRate, double fps) override;
 
-	/// <summary>Stop recording and finalize AVI file</summary>
+	/// <summary>Stop recording, encode the frames still queued and finalize AVI file</summary>
 	void StopRecording() override;
 
 	/// <summary>
-	/// Add video frame (buffered, signals encoding thread).
+	/// Add video frame (queued for the encoding thread).
 	/// </summary>
-	/// <remarks>Copies frame to internal buffer, signals AviWriter thread for encoding.</remarks>
+	/// <remarks>Copies frame to a free queue buffer, waits only when the queue is full.</remarks>
 	bool AddFrame(void* frameBuffer, uint32_t width, uint32_t height, double fps) override;
 
 	/// <summary>Add audio samples (written immediately)</summary>
@@ -273,6 +273,10 @@ void AviWriter::AddSound(int16_t* data, uint32_t sampleCount) {
 	}
 
 	auto lock = _audioLock.AcquireSafe();
+	if (_audioPos + sampleCount * 4 > sizeof(_audiobuf)) {
+		// Video encoding is too far behind, drop the samples rather than overrun the buffer
+		return;
+	}
 	memcpy(_audiobuf + _audioPos / 2, data, sampleCount * 4);
 	_audioPos += sampleCount * 4;
 }
@@ -15,7 +15,8 @@ enum class VideoCodec {
 
 class AviWriter {
 private:
-	static constexpr int WaveBufferSize = 16 * 1024;
+	// Audio keeps arriving while AviRecorder's frame queue is behind, so this holds ~0.3s at 48kHz
+	static constexpr int WaveBufferSize = 32 * 1024;
 	static constexpr int AviHeaderSize = 500;
 
 	std::unique_ptr<BaseCodec> _codec;
@@ -4,9 +4,47 @@
 #include <cstring>
 #include "CamstudioCodec.h"
 #include "miniz.h"
+#include "Utilities/WorkerPool.h"
+
+namespace {
+	// Same as zlib's adler32_combine: the adler32 of A+B from the adler32s of A and B
+	uint32_t CombineAdler32(uint32_t adler1, uint32_t adler2, uint32_t len2) {
+		constexpr uint32_t Base = 65521;
+		uint32_t rem = len2 % Base;
+		uint32_t sum1 = adler1 & 0xffff;
+		uint32_t sum2 = (uint32_t)(((uint64_t)rem * sum1) % Base);
+		sum1 += (adler2 & 0xffff) + Base - 1;
+		sum2 += ((adler1 >> 16) & 0xffff) + ((adler2 >> 16) & 0xffff) + Base - rem;
+		if (sum1 >= Base) {
+			sum1 -= Base;
+		}
+		if (sum1 >= Base) {
+			sum1 -= Base;
+		}
+		if (sum2 >= (Base << 1)) {
+			sum2 -= (Base << 1);
+		}
+		if (sum2 >= Base) {
+			sum2 -= Base;
+		}
+		return sum1 | (sum2 << 16);
+	}
+}
+
+CamstudioCodec::CamstudioCodec() : CamstudioCodec(WorkerPool::GetDefaultWorkerCount(MaxCompressWorkers)) {
+}
+
+CamstudioCodec::CamstudioCodec(uint32_t workerCount) {
+	if (workerCount > 0) {
+		_workerPool = std::make_unique<WorkerPool>(workerCount);
+	}
+}
 
 CamstudioCodec::~CamstudioCodec() {
 	deflateEnd(&_compressor);
+	for (uint32_t i = 0; i < _chunkCount; i++) {
+		deflateEnd(&_chunks[i].Compressor);
+	}
 }
 
 bool CamstudioCodec::SetupCompress(int width, int height, uint32_t compressionLevel) {
@@ -34,6 +72,33 @@ bool CamstudioCodec::SetupCompress(int width, int height, uint32_t compressionLe
 
 	deflateInit(&_compressor, compressionLevel);
 
+	// Bands smaller than this compress noticeably worse, keep a single stream for small frames
+	constexpr int MinRowsPerChunk = 32;
+	for (uint32_t i = 0; i < _chunkCount; i++) {
+		deflateEnd(&_chunks[i].Compressor);
+	}
+	_chunkCount = _workerPool ? std::min<uint32_t>(_workerPool->GetThreadCount(), _height / MinRowsPerChunk) : 0;
+	if (_chunkCount > 1) {
+		_chunks = std::make_unique<CompressChunk[]>(_chunkCount);
+		for (uint32_t i = 0; i < _chunkCount; i++) {
+			CompressChunk& chunk = _chunks[i];
+			chunk.StartRow = _height * i / _chunkCount;
+			chunk.EndRow = _height * (i + 1) / _chunkCount;
+			// Room for the sync flush marker on top of the bound
+			chunk.OutputLength = compressBound((chunk.EndRow - chunk.StartRow) * _rowStride) + 16;
+			chunk.Output = std::make_unique<uint8_t[]>(chunk.OutputLength);
+			deflateInit2(&chunk.Compressor, compressionLevel, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+		}
+		// 2 byte CSCD header, 2 byte zlib header and the adler32 trailer
+		_compressBufferLength = 2 + 2 + 4;
+		for (uint32_t i = 0; i < _chunkCount; i++) {
+			_compressBufferLength += _chunks[i].OutputLength;
+		}
+		_compressBuffer = std::make_unique<uint8_t[]>(_compressBufferLength);
+	} else {
+		_chunkCount = 0;
+	}
+
 	return true;
 }
 
@@ -47,7 +112,72 @@ void CamstudioCodec::LoadRow(uint8_t* inPointer, uint8_t* outPointer) {
 	}
 }
 
+void CamstudioCodec::LoadRows(uint8_t* frameData, bool isKeyFrame, int startRow, int endRow) {
+	uint8_t* rowBuffer = _currentFrame.get() + startRow * _rowStride;
+	for (int y = startRow; y < endRow; y++) {
+		LoadRow(frameData + (_height - y - 1) * _orgWidth * 4, rowBuffer);
+		rowBuffer += _rowStride;
+	}
+
+	int start = startRow * _rowStride;
+	int end = endRow * _rowStride;
+	if (!isKeyFrame) {
+		for (int i = start; i < end; i++) {
+			_buffer[i] = _currentFrame[i] - _prevFrame[i];
+		}
+	}
+	memcpy(_prevFrame.get() + start, _currentFrame.get() + start, end - start);
+}
+
+int CamstudioCodec::CompressChunks(bool isKeyFrame, uint8_t* frameData) {
+	uint8_t* input = isKeyFrame ? _currentFrame.get() : _buffer.get();
+
+	_workerPool->Run(_chunkCount, [&](uint32_t index) {
+		CompressChunk& chunk = _chunks[index];
+		LoadRows(frameData, isKeyFrame, chunk.StartRow, chunk.EndRow);
+
+		uint8_t* chunkInput = input + chunk.StartRow * _rowStride;
+		uint32_t length = (chunk.EndRow - chunk.StartRow) * _rowStride;
+		chunk.Adler = (uint32_t)mz_adler32(MZ_ADLER32_INIT, chunkInput, length);
+
+		deflateReset(&chunk.Compressor);
+		chunk.Compressor.next_in = chunkInput;
+		chunk.Compressor.avail_in = length;
+		chunk.Compressor.next_out = chunk.Output.get();
+		chunk.Compressor.avail_out = chunk.OutputLength;
+		deflate(&chunk.Compressor, index == _chunkCount - 1 ? MZ_FINISH : MZ_SYNC_FLUSH);
+		chunk.Written = chunk.OutputLength - chunk.Compressor.avail_out;
+	});
+
+	// zlib header (deflate, 32K window), then the bands in order and the adler32 of the whole input
+	uint8_t* out = _compressBuffer.get() + 2;
+	*(out++) = 0x78;
+	*(out++) = 0x9C;
+	uint32_t adler = _chunks[0].Adler;
+	for (uint32_t i = 0; i < _chunkCount; i++) {
+		CompressChunk& chunk = _chunks[i];
+		memcpy(out, chunk.Output.get(), chunk.Written);
+		out += chunk.Written;
+		if (i > 0) {
+			adler = CombineAdler32(adler, chunk.Adler, (chunk.EndRow - chunk.StartRow) * _rowStride);
+		}
+	}
+	*(out++) = (uint8_t)(adler >> 24);
+	*(out++) = (uint8_t)(adler >> 16);
+	*(out++) = (uint8_t)(adler >> 8);
+	*(out++) = (uint8_t)adler;
+
+	return (int)(out - _compressBuffer.get());
+}
+
 int CamstudioCodec::CompressFrame(bool isKeyFrame, uint8_t* frameData, uint8_t** compressedData) {
+	if (_chunkCount > 0) {
+		_compressBuffer[0] = (isKeyFrame ? 0x03 : 0x02) | (_compressionLevel << 4);
+		_compressBuffer[1] = 8; // 8-bit per color
+		*compressedData = _compressBuffer.get();
+		return CompressChunks(isKeyFrame, frameData);
+	}
+
 	deflateReset(&_compressor);
 
 	_compressor.next_out = _compressBuffer.get() + 2;
@@ -3,8 +3,33 @@
 #include "BaseCodec.h"
 #include "miniz.h"
 
+class WorkerPool;
+
 class CamstudioCodec : public BaseCodec {
 private:
+	/// <summary>
+	/// A horizontal band of the frame compressed on its own thread.
+	/// </summary>
+	/// <remarks>
+	/// Each band is a raw deflate stream ended with a sync flush (the last one with a finish),
+	/// so the concatenated bands plus a zlib header and the combined adler32 form one valid
+	/// zlib stream and the file stays readable by any CSCD decoder.
+	/// </remarks>
+	struct CompressChunk {
+		z_stream Compressor = {};
+		std::unique_ptr<uint8_t[]> Output;
+		uint32_t OutputLength = 0;
+		uint32_t Written = 0;
+		uint32_t Adler = 0;
+		int StartRow = 0;
+		int EndRow = 0;
+	};
+
+	static constexpr uint32_t MaxCompressWorkers = 3;
+	std::unique_ptr<WorkerPool> _workerPool;
+	std::unique_ptr<CompressChunk[]> _chunks;
+	uint32_t _chunkCount = 0;
+
 	std::unique_ptr<uint8_t[]> _prevFrame;
 	std::unique_ptr<uint8_t[]> _currentFrame;
 	std::unique_ptr<uint8_t[]> _buffer;
@@ -19,8 +44,12 @@ private:
 	int _height = 0;
 
 	void LoadRow(uint8_t* inPointer, uint8_t* outPointer);
+	void LoadRows(uint8_t* frameData, bool isKeyFrame, int startRow, int endRow);
+	int CompressChunks(bool isKeyFrame, uint8_t* frameData);
 
 public:
+	CamstudioCodec();
+	explicit CamstudioCodec(uint32_t workerCount);
 	virtual ~CamstudioCodec();
 
 	virtual bool SetupCompress(int width, int height, uint32_t compressionLevel) override;
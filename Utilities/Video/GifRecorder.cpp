@@ -27,11 +27,55 @@ bool GifRecorder::StartRecording(uint32_t width, uint32_t height, uint32_t bpp,
 
 	_recording = GifBegin(_gif.get(), _outputFile.c_str(), width, height, 2, 8, false);
 	_frameCounter = 0;
-	return _recording;
+	if (!_recording) {
+		return false;
+	}
+
+	_stopFlag = false;
+	_frameQueue = {};
+	_freeBuffers.clear();
+	for (uint32_t i = 0; i < MaxQueuedFrames; i++) {
+		_freeBuffers.push_back(std::make_unique<uint8_t[]>(width * height * 4));
+	}
+
+	_encoderThread = std::thread([this]() {
+		while (true) {
+			unique_ptr<uint8_t[]> frame;
+			{
+				std::unique_lock<std::mutex> lock(_queueMutex);
+				_frameCv.wait(lock, [this] { return _stopFlag || !_frameQueue.empty(); });
+				if (_frameQueue.empty()) {
+					// Stop requested and every queued frame has been written
+					return;
+				}
+				frame = std::move(_frameQueue.front());
+				_frameQueue.pop();
+			}
+
+			GifWriteFrame(_gif.get(), frame.get(), _width, _height, 2, 8, false);
+
+			{
+				std::lock_guard<std::mutex> lock(_queueMutex);
+				_freeBuffers.push_back(std::move(frame));
+			}
+			_bufferCv.notify_one();
+		}
+	});
+
+	return true;
 }
 
 void GifRecorder::StopRecording() {
 	if (_recording) {
+		_recording = false;
+
+		{
+			std::lock_guard<std::mutex> lock(_queueMutex);
+			_stopFlag = true;
+		}
+		_frameCv.notify_one();
+		_encoderThread.join();
+
 		GifEnd(_gif.get());
 	}
 }
@@ -39,13 +83,30 @@ void GifRecorder::StopRecording() {
 bool GifRecorder::AddFrame(void* frameBuffer, uint32_t width, uint32_t height, double fps) {
 	if (_width != width || _height != height || _fps != fps) {
 		return false;
+	} else if (!_recording) {
+		return true;
 	}
 
 	_frameCounter++;
 
 	if (fps < 55 || (_frameCounter % 6) != 0) {
 		// At 60 FPS, skip 1 of every 6 frames (max FPS for GIFs is 50fps)
-		GifWriteFrame(_gif.get(), (uint8_t*)frameBuffer, width, height, 2, 8, false);
+		unique_ptr<uint8_t[]> buffer;
+		{
+			// Only blocks when the encoder is MaxQueuedFrames frames behind
+			std::unique_lock<std::mutex> lock(_queueMutex);
+			_bufferCv.wait(lock, [this] { return !_freeBuffers.empty(); });
+			buffer = std::move(_freeBuffers.back());
+			_freeBuffers.pop_back();
+		}
+
+		memcpy(buffer.get(), frameBuffer, width * height * 4);
+
+		{
+			std::lock_guard<std::mutex> lock(_queueMutex);
+			_frameQueue.push(std::move(buffer));
+		}
+		_frameCv.notify_one();
 	}
 
 	return true;
@@ -1,5 +1,9 @@
 #pragma once
 #include "pch.h"
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
 #include "Utilities/Video/IVideoRecorder.h"
 
 struct GifWriter;
@@ -35,10 +39,27 @@ struct GifWriter;
 /// </code>
 ///
 /// Frame delay calculated from FPS for smooth playback.
+///
+/// Threading model (same as AviRecorder):
+/// - AddFrame() copies the frame into a free buffer and queues it
+/// - The encoder thread quantizes and LZW-encodes queued frames in order
+/// - Each frame after the first only encodes the rectangle that changed since the previous one
 /// </remarks>
 class GifRecorder final : public IVideoRecorder {
 private:
+	/// <summary>Frames the encoder may fall behind before AddFrame() blocks</summary>
+	static constexpr uint32_t MaxQueuedFrames = 8;
+
 	std::unique_ptr<GifWriter> _gif; ///< GIF writer instance
+	std::thread _encoderThread;      ///< Background quantization/encoding thread
+
+	std::mutex _queueMutex;                        ///< Protects _frameQueue, _freeBuffers and _stopFlag
+	std::condition_variable _frameCv;              ///< Signaled when a frame is queued or recording stops
+	std::condition_variable _bufferCv;             ///< Signaled when a frame buffer is returned
+	std::queue<unique_ptr<uint8_t[]>> _frameQueue; ///< Frames waiting for encoding, oldest first
+	vector<unique_ptr<uint8_t[]>> _freeBuffers;    ///< Preallocated buffers not in use
+	bool _stopFlag = false;                        ///< Stop signal for thread (after the queue is drained)
+
 	bool _recording = false;         ///< Recording active flag
 	uint32_t _frameCounter = 0;      ///< Frame count
 	string _outputFile;              ///< Output file path
@@ -60,14 +81,14 @@ public:
 	/// <remarks>audioSampleRate ignored - GIF has no audio support</remarks>
 	bool StartRecording(uint32_t width, uint32_t height, uint32_t bpp, uint32_t audioSampleRate, double fps) override;
 
-	/// <summary>Stop recording and finalize GIF file</summary>
+	/// <summary>Stop recording, encode the frames still queued and finalize GIF file</summary>
 	void StopRecording() override;
 
 	/// <summary>
 	/// Add video frame to GIF.
 	/// </summary>
 	/// <remarks>
-	/// Frame data is quantized to 256 colors using palette generation.
+	/// Frame data is queued, then quantized to 256 colors on the encoder thread.
 	/// Frame delay calculated from FPS for accurate timing.
 	/// </remarks>
 	bool AddFrame(void* frameBuffer, uint32_t width, uint32_t height, double fps) override;
@@ -27,6 +27,7 @@
 
 #include "miniz.h"
 #include "ZmbvCodec.h"
+#include "Utilities/WorkerPool.h"
 
 #define DBZV_VERSION_HIGH 0
 #define DBZV_VERSION_LOW  1
@@ -96,9 +97,12 @@ bool ZmbvCodec::SetupBuffers(zmbv_format_t _format, int blockwidth, int blockhei
 	if (yleft)
 		yblocks++;
 	blockcount = yblocks * xblocks;
+	blockrows = yblocks;
+	blocksPerRow = xblocks;
 	blocks = std::make_unique<FrameBlock[]>(blockcount);
+	matches = std::make_unique<BlockMatch[]>(blockcount);
 
-	if (!buf1 || !buf2 || !work || !blocks) {
+	if (!buf1 || !buf2 || !work || !blocks || !matches) {
 		FreeBuffers();
 		return false;
 	}
@@ -200,37 +204,59 @@ INLINE void ZmbvCodec::AddXorBlock(int vx, int vy, FrameBlock* block) {
 	}
 }
 
+template <class P>
+void ZmbvCodec::FindBestVector(FrameBlock* block, BlockMatch* match) {
+	int bestvx = 0;
+	int bestvy = 0;
+	int bestchange = CompareBlock<P>(0, 0, block);
+	int possibles = 64;
+	for (int v = 0; v < VectorCount && possibles; v++) {
+		if (bestchange < 4)
+			break;
+		int vx = VectorTable[v].x;
+		int vy = VectorTable[v].y;
+		if (PossibleBlock<P>(vx, vy, block) < 4) {
+			possibles--;
+			int testchange = CompareBlock<P>(vx, vy, block);
+			if (testchange < bestchange) {
+				bestchange = testchange;
+				bestvx = vx;
+				bestvy = vy;
+			}
+		}
+	}
+	match->vx = bestvx;
+	match->vy = bestvy;
+	match->change = bestchange;
+}
+
 template <class P>
 void ZmbvCodec::AddXorFrame(void) {
 	signed char* vectors = (signed char*)(work.get() + workUsed);
 	/* Align the following xor data on 4 byte boundary*/
 	workUsed = (workUsed + blockcount * 2 + 3) & ~3;
-	for (int b = 0; b < blockcount; b++) {
-		FrameBlock* block = &blocks[b];
-		int bestvx = 0;
-		int bestvy = 0;
-		int bestchange = CompareBlock<P>(0, 0, block);
-		int possibles = 64;
-		for (int v = 0; v < VectorCount && possibles; v++) {
-			if (bestchange < 4)
-				break;
-			int vx = VectorTable[v].x;
-			int vy = VectorTable[v].y;
-			if (PossibleBlock<P>(vx, vy, block) < 4) {
-				possibles--;
-				int testchange = CompareBlock<P>(vx, vy, block);
-				if (testchange < bestchange) {
-					bestchange = testchange;
-					bestvx = vx;
-					bestvy = vy;
-				}
-			}
+
+	/* The search only reads oldframe/newframe, so block rows are independent */
+	auto searchRow = [this](uint32_t row) {
+		for (int b = row * blocksPerRow, end = b + blocksPerRow; b < end; b++) {
+			FindBestVector<P>(&blocks[b], &matches[b]);
+		}
+	};
+	if (_workerPool) {
+		_workerPool->Run(blockrows, searchRow);
+	} else {
+		for (int row = 0; row < blockrows; row++) {
+			searchRow(row);
 		}
-		vectors[b * 2 + 0] = (bestvx << 1);
-		vectors[b * 2 + 1] = (bestvy << 1);
-		if (bestchange) {
+	}
+
+	for (int b = 0; b < blockcount; b++) {
+		BlockMatch& match = matches[b];
+		vectors[b * 2 + 0] = (match.vx << 1);
+		vectors[b * 2 + 1] = (match.vy << 1);
+		if (match.change) {
 			vectors[b * 2 + 0] |= 1;
-			AddXorBlock<P>(bestvx, bestvy, block);
+			AddXorBlock<P>(match.vx, match.vy, &blocks[b]);
 		}
 	}
 }
@@ -369,17 +395,26 @@ int ZmbvCodec::FinishCompressFrame(uint8_t** compressedData) {
 
 void ZmbvCodec::FreeBuffers() {
 	blocks.reset();
+	matches.reset();
 	buf1.reset();
 	buf2.reset();
 	work.reset();
 	_buf.reset();
 }
 
-ZmbvCodec::ZmbvCodec() {
+ZmbvCodec::ZmbvCodec() : ZmbvCodec(WorkerPool::GetDefaultWorkerCount(MaxSearchWorkers)) {
+}
+
+ZmbvCodec::ZmbvCodec(uint32_t workerCount) {
 	CreateVectorTable();
 	memset(&zstream, 0, sizeof(zstream));
+	if (workerCount > 0) {
+		_workerPool = std::make_unique<WorkerPool>(workerCount);
+	}
 }
 
+ZmbvCodec::~ZmbvCodec() = default;
+
 int ZmbvCodec::CompressFrame(bool isKeyFrame, uint8_t* frameData, uint8_t** compressedData) {
 	if (!PrepareCompressFrame(isKeyFrame ? 1 : 0, ZMBV_FORMAT_32BPP, nullptr)) {
 		return -1;
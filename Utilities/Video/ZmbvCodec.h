@@ -24,6 +24,8 @@
 #include "BaseCodec.h"
 #include "miniz.h"
 
+class WorkerPool;
+
 #ifdef _MSC_VER
 #define INLINE __forceinline
 #else
@@ -48,6 +50,10 @@ private:
 		int start = 0;
 		int dx = 0, dy = 0;
 	};
+	struct BlockMatch {
+		int vx = 0, vy = 0;
+		int change = 0;
+	};
 	struct CodecVector {
 		int x = 0, y = 0;
 		int slot = 0;
@@ -75,7 +81,13 @@ private:
 	int bufsize = 0;
 
 	int blockcount = 0;
+	int blockrows = 0, blocksPerRow = 0;
 	std::unique_ptr<FrameBlock[]> blocks;
+	std::unique_ptr<BlockMatch[]> matches;
+
+	// Motion search runs one block row per task, the xor data is then written in block order
+	static constexpr uint32_t MaxSearchWorkers = 3;
+	std::unique_ptr<WorkerPool> _workerPool;
 
 	int workUsed = 0, workPos = 0;
 
@@ -98,6 +110,8 @@ private:
 	template <class P>
 	void AddXorFrame(void);
 	template <class P>
+	void FindBestVector(FrameBlock* block, BlockMatch* match);
+	template <class P>
 	INLINE int PossibleBlock(int vx, int vy, FrameBlock* block);
 	template <class P>
 	INLINE int CompareBlock(int vx, int vy, FrameBlock* block);
@@ -112,6 +126,8 @@ private:
 
 public:
 	ZmbvCodec();
+	explicit ZmbvCodec(uint32_t workerCount);
+	~ZmbvCodec();
 	bool SetupCompress(int _width, int _height, uint32_t compressionLevel) override;
 	int CompressFrame(bool isKeyFrame, uint8_t* frameData, uint8_t** compressedData) override;
 	const char* GetFourCC() override;
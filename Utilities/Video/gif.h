@@ -335,6 +335,53 @@ int GifPickChangedPixels(const uint8_t* lastFrame, uint8_t* frame, int numPixels
 	return numChanged;
 }
 
+// Finds the smallest rectangle containing every pixel that differs from the previous image.
+// Only that rectangle is written as the next frame's sub-image, the rest of the canvas stays
+// as it was. A frame without changes still gets a 1x1 (transparent) rectangle so that its delay
+// is kept.
+void GifGetChangedRect(const uint8_t* lastFrame, const uint8_t* frame, uint32_t width, uint32_t height, uint32_t& left, uint32_t& top, uint32_t& rectWidth, uint32_t& rectHeight) {
+	uint32_t minX = width, maxX = 0;
+	uint32_t minY = height, maxY = 0;
+
+	for (uint32_t yy = 0; yy < height; ++yy) {
+		const uint8_t* lastPix = lastFrame + yy * width * 4;
+		const uint8_t* pix = frame + yy * width * 4;
+		for (uint32_t xx = 0; xx < width; ++xx, lastPix += 4, pix += 4) {
+			if (lastPix[0] != pix[0] || lastPix[1] != pix[1] || lastPix[2] != pix[2]) {
+				if (xx < minX)
+					minX = xx;
+				if (xx > maxX)
+					maxX = xx;
+				if (yy < minY)
+					minY = yy;
+				maxY = yy;
+			}
+		}
+	}
+
+	if (minY == height) {
+		left = top = 0;
+		rectWidth = rectHeight = 1;
+	} else {
+		left = minX;
+		top = minY;
+		rectWidth = maxX - minX + 1;
+		rectHeight = maxY - minY + 1;
+	}
+}
+
+// Copies a rectangle of an RGBA image into (or, when toImage is set, back out of) a tightly packed buffer
+void GifCopyRect(uint8_t* image, uint32_t width, uint32_t left, uint32_t top, uint32_t rectWidth, uint32_t rectHeight, uint8_t* rect, bool toImage) {
+	for (uint32_t yy = 0; yy < rectHeight; ++yy) {
+		uint8_t* imageRow = image + ((top + yy) * width + left) * 4;
+		uint8_t* rectRow = rect + yy * rectWidth * 4;
+		if (toImage)
+			memcpy(imageRow, rectRow, rectWidth * 4);
+		else
+			memcpy(rectRow, imageRow, rectWidth * 4);
+	}
+}
+
 // Creates a palette by placing all the image pixels in a k-d tree and then averaging the blocks at the bottom.
 // This is known as the "modified median split" technique
 void GifMakePalette(const uint8_t* lastFrame, const uint8_t* nextFrame, uint32_t width, uint32_t height, int bitDepth, bool buildForDither, GifPalette* pPal) {
@@ -757,15 +804,40 @@ bool GifWriteFrame(GifWriter* writer, const uint8_t* image, uint32_t width, uint
 	const uint8_t* oldImage = writer->firstFrame ? NULL : writer->oldImage;
 	writer->firstFrame = false;
 
+	// Only the part of the frame that changed is quantized and encoded
+	uint32_t left = 0, top = 0, rectWidth = width, rectHeight = height;
+	if (oldImage)
+		GifGetChangedRect(oldImage, image, width, height, left, top, rectWidth, rectHeight);
+
+	const bool isSubImage = rectWidth != width || rectHeight != height;
+	const uint8_t* nextImage = image;
+	const uint8_t* lastImage = oldImage;
+	uint8_t* outImage = writer->oldImage;
+	uint8_t* rectBuffer = NULL;
+	if (isSubImage) {
+		size_t rectSize = (size_t)rectWidth * rectHeight * 4;
+		rectBuffer = (uint8_t*)GIF_TEMP_MALLOC(rectSize * 3);
+		GifCopyRect((uint8_t*)image, width, left, top, rectWidth, rectHeight, rectBuffer, false);
+		GifCopyRect(writer->oldImage, width, left, top, rectWidth, rectHeight, rectBuffer + rectSize, false);
+		nextImage = rectBuffer;
+		lastImage = rectBuffer + rectSize;
+		outImage = rectBuffer + rectSize * 2;
+	}
+
 	GifPalette pal;
-	GifMakePalette((dither ? NULL : oldImage), image, width, height, bitDepth, dither, &pal);
+	GifMakePalette((dither ? NULL : lastImage), nextImage, rectWidth, rectHeight, bitDepth, dither, &pal);
 
 	if (dither)
-		GifDitherImage(oldImage, image, writer->oldImage, width, height, &pal);
+		GifDitherImage(lastImage, nextImage, outImage, rectWidth, rectHeight, &pal);
 	else
-		GifThresholdImage(oldImage, image, writer->oldImage, width, height, &pal);
+		GifThresholdImage(lastImage, nextImage, outImage, rectWidth, rectHeight, &pal);
 
-	GifWriteLzwImage(writer->f, writer->oldImage, 0, 0, width, height, delay, &pal);
+	GifWriteLzwImage(writer->f, outImage, left, top, rectWidth, rectHeight, delay, &pal);
+
+	if (isSubImage) {
+		GifCopyRect(writer->oldImage, width, left, top, rectWidth, rectHeight, outImage, true);
+		GIF_TEMP_FREE(rectBuffer);
+	}
 
 	return true;
 }
@@ -10,13 +10,15 @@
 #include "Utilities/Patches/BpsPatcher.h"
 #include "Utilities/Patches/IpsPatcher.h"
 #include "Utilities/Patches/UpsPatcher.h"
+#include "Utilities/Patches/PatchedRomCache.h"
 #include "Utilities/CRC32.h"
+#include "Utilities/MemoryMappedFile.h"
 
 const std::initializer_list<string> VirtualFile::RomExtensions = {
     ".nes", ".fds", ".qd", ".unif", ".unf", ".nsf", ".nsfe", ".studybox",
     ".sfc", ".swc", ".fig", ".smc", ".bs", ".st", ".spc",
     ".gb", ".gbc", ".gbx", ".gbs",
-    ".pce", ".sgx", ".cue", ".hes",
+    ".pce", ".sgx", ".cue", ".ncd", ".hes",
     ".sms", ".gg", ".sg", ".col",
     ".gba",
     ".ws", ".wsc"};
@@ -79,16 +81,16 @@ void VirtualFile::FromStream(std::istream& input, vector<uint8_t>& output) {
 
 void VirtualFile::LoadFile() {
 	if (_data.size() == 0) {
-		if (!_innerFile.empty()) {
+		if (_mappedFile) {
+			// Either the file itself, or the cached result of a patch (see ApplyPatch)
+			std::span<const uint8_t> mappedData = _mappedFile->GetSpan();
+			_data.assign(mappedData.begin(), mappedData.end());
+		} else if (!_innerFile.empty()) {
 			unique_ptr<ArchiveReader> reader = ArchiveReader::GetReader(_path);
 			if (reader) {
-				if (_innerFileIndex >= 0) {
-					vector<string> filelist = reader->GetFileList(VirtualFile::RomExtensions);
-					if ((int32_t)filelist.size() > _innerFileIndex) {
-						reader->ExtractFile(filelist[_innerFileIndex], _data);
-					}
-				} else {
-					reader->ExtractFile(_innerFile, _data);
+				string innerFile = GetInnerFileName(*reader);
+				if (!innerFile.empty()) {
+					reader->ExtractFile(innerFile, _data);
 				}
 			}
 		} else {
@@ -100,8 +102,57 @@ void VirtualFile::LoadFile() {
 	}
 }
 
+string VirtualFile::GetInnerFileName(ArchiveReader& reader) {
+	if (_innerFileIndex >= 0) {
+		vector<string> filelist = reader.GetFileList(VirtualFile::RomExtensions);
+		return (int32_t)filelist.size() > _innerFileIndex ? filelist[_innerFileIndex] : "";
+	}
+	return _innerFile;
+}
+
+bool VirtualFile::TryMapFile() {
+	if (_mappedFile) {
+		return true;
+	}
+
+	if (!_data.empty() || !_innerFile.empty() || _path.empty() || _mappingFailed) {
+		return false;
+	}
+
+	auto mappedFile = std::make_shared<MemoryMappedFile>();
+	if (!mappedFile->Open(_path)) {
+		_mappingFailed = true;
+		return false;
+	}
+
+	_mappedFile = mappedFile;
+	return true;
+}
+
+std::span<const uint8_t> VirtualFile::GetDataSpan() {
+	if (_data.empty() && TryMapFile()) {
+		return _mappedFile->GetSpan();
+	}
+
+	LoadFile();
+	return _data;
+}
+
+std::span<const uint8_t> VirtualFile::GetTemporaryData(MemoryMappedFile& tempMapping) {
+	if (_data.empty()) {
+		if (_mappedFile) {
+			return _mappedFile->GetSpan();
+		} else if (_innerFile.empty() && !_path.empty() && tempMapping.Open(_path)) {
+			return tempMapping.GetSpan();
+		}
+	}
+
+	LoadFile();
+	return _data;
+}
+
 bool VirtualFile::IsValid() {
-	if (_data.size() > 0) {
+	if (_data.size() > 0 || _mappedFile) {
 		return true;
 	}
 
@@ -147,20 +198,33 @@ string VirtualFile::GetFileExtension() {
 }
 
 string VirtualFile::GetSha1Hash() {
-	LoadFile();
-	return SHA1::GetHash(_data);
+	MemoryMappedFile tempMapping;
+	std::span<const uint8_t> data = GetTemporaryData(tempMapping);
+	return SHA1::GetHash(data.data(), data.size());
 }
 
 uint32_t VirtualFile::GetCrc32() {
-	LoadFile();
-	return CRC32::GetCRC(_data);
+	if (_data.empty() && IsArchive()) {
+		// Archives store the CRC of each file, no need to extract it
+		unique_ptr<ArchiveReader> reader = ArchiveReader::GetReader(_path);
+		uint32_t crc = 0;
+		if (reader && reader->GetFileCrc32(GetInnerFileName(*reader), crc)) {
+			return crc;
+		}
+	}
+
+	MemoryMappedFile tempMapping;
+	std::span<const uint8_t> data = GetTemporaryData(tempMapping);
+	return CRC32::GetCRC(data.data(), (std::streamoff)data.size());
 }
 
 size_t VirtualFile::GetSize() {
 	if (_data.size() > 0) {
 		return _data.size();
 	} else {
-		if (_fileSize >= 0) {
+		if (_mappedFile) {
+			return _mappedFile->GetSize();
+		} else if (_fileSize >= 0) {
 			return _fileSize;
 		} else if (IsArchive()) {
 			LoadFile();
@@ -180,7 +244,10 @@ size_t VirtualFile::GetSize() {
 bool VirtualFile::CheckFileSignature(const vector<string>& signatures, bool loadArchives) {
 	vector<uint8_t> partialData;
 
-	if (_data.empty()) {
+	if (_data.empty() && _mappedFile) {
+		std::span<const uint8_t> mappedData = _mappedFile->GetSpan();
+		partialData.assign(mappedData.begin(), mappedData.begin() + std::min<size_t>(mappedData.size(), 512));
+	} else if (_data.empty()) {
 		if (loadArchives) {
 			LoadFile();
 		} else {
@@ -222,28 +289,30 @@ vector<uint8_t>& VirtualFile::GetData() {
 }
 
 bool VirtualFile::ReadFile(vector<uint8_t>& out) {
-	LoadFile();
-	if (_data.size() > 0) {
-		out.resize(_data.size(), 0);
-		std::copy(_data.begin(), _data.end(), out.begin());
+	MemoryMappedFile tempMapping;
+	std::span<const uint8_t> data = GetTemporaryData(tempMapping);
+	if (data.size() > 0) {
+		out.assign(data.begin(), data.end());
 		return true;
 	}
 	return false;
 }
 
 bool VirtualFile::ReadFile(std::stringstream& out) {
-	LoadFile();
-	if (_data.size() > 0) {
-		out.write((char*)_data.data(), _data.size());
+	MemoryMappedFile tempMapping;
+	std::span<const uint8_t> data = GetTemporaryData(tempMapping);
+	if (data.size() > 0) {
+		out.write((const char*)data.data(), data.size());
 		return true;
 	}
 	return false;
 }
 
 bool VirtualFile::ReadFile(uint8_t* out, uint32_t expectedSize) {
-	LoadFile();
-	if (_data.size() == expectedSize) {
-		memcpy(out, _data.data(), _data.size());
+	MemoryMappedFile tempMapping;
+	std::span<const uint8_t> data = GetTemporaryData(tempMapping);
+	if (data.size() == expectedSize) {
+		memcpy(out, data.data(), data.size());
 		return true;
 	}
 	return false;
@@ -256,6 +325,10 @@ uint8_t VirtualFile::ReadByte(uint32_t offset) {
 		return 0;
 	}
 
+	if (_mappedFile) {
+		return offset < _mappedFile->GetSize() ? _mappedFile->GetData()[offset] : 0;
+	}
+
 	uint32_t chunkId = offset / VirtualFile::ChunkSize;
 	uint32_t chunkStart = chunkId * VirtualFile::ChunkSize;
 	if (_chunks[chunkId].size() == 0) {
@@ -273,8 +346,26 @@ bool VirtualFile::ApplyPatch(VirtualFile& patch) {
 	bool result = false;
 	if (IsValid() && patch.IsValid()) {
 		patch.LoadFile();
-		LoadFile();
 		if (patch._data.size() >= 5) {
+			string cachePath;
+			{
+				MemoryMappedFile tempMapping;
+				cachePath = PatchedRomCache::GetEntryPath(GetTemporaryData(tempMapping), patch._data);
+			}
+
+			if (!cachePath.empty()) {
+				auto cachedFile = std::make_shared<MemoryMappedFile>();
+				if (cachedFile->Open(cachePath)) {
+					// This patch was already applied to this ROM, use the cached result
+					_data = {};
+					_chunks.clear();
+					_useChunks = false;
+					_mappedFile = cachedFile;
+					return true;
+				}
+			}
+
+			LoadFile();
 			vector<uint8_t> patchedData;
 			std::stringstream ss;
 			(void)patch.ReadFile(ss);
@@ -287,7 +378,9 @@ bool VirtualFile::ApplyPatch(VirtualFile& patch) {
 				result = BpsPatcher::PatchBuffer(ss, _data, patchedData);
 			}
 			if (result) {
-				_data = patchedData;
+				_data = std::move(patchedData);
+				_mappedFile.reset();
+				(void)PatchedRomCache::Save(cachePath, _data);
 			}
 		}
 	}
@@ -1,6 +1,10 @@
 #pragma once
 #include "pch.h"
 #include <sstream>
+#include <span>
+
+class MemoryMappedFile;
+class ArchiveReader;
 
 /// <summary>
 /// Unified file abstraction supporting filesystem files, archive entries, and memory buffers.
@@ -17,6 +21,7 @@
 /// - Automatic archive detection and extraction
 /// - Lazy loading (data loaded on first access)
 /// - Chunked reading for large files (256KB chunks)
+/// - Zero-copy access to uncompressed files through a read-only memory mapping (GetDataSpan)
 /// - SHA1/CRC32 hashing
 /// - IPS/BPS patch application
 ///
@@ -40,12 +45,29 @@ private:
 	vector<vector<uint8_t>> _chunks; ///< Chunked data for large files
 	bool _useChunks = false;         ///< Chunked mode enabled flag
 
+	/// <summary>Read-only mapping of the file (filesystem files only), shared by copies of this VirtualFile</summary>
+	shared_ptr<MemoryMappedFile> _mappedFile;
+	bool _mappingFailed = false; ///< Mapping was tried and failed, use LoadFile() instead
+
 	/// <summary>Read stream data into vector</summary>
 	void FromStream(std::istream& input, vector<uint8_t>& output);
 
 	/// <summary>Lazy load file data from disk/archive</summary>
 	void LoadFile();
 
+	/// <summary>Name of the inner file in the archive (resolves _innerFileIndex), empty if it doesn't exist</summary>
+	string GetInnerFileName(ArchiveReader& reader);
+
+	/// <summary>Maps the file on disk if it isn't loaded yet and isn't in an archive</summary>
+	/// <returns>True if the file's content is available through _mappedFile</returns>
+	bool TryMapFile();
+
+	/// <summary>
+	/// Read-only view of the data for a single operation (hashing, copying). Unlike GetDataSpan(), plain files
+	/// are mapped in tempMapping instead of being kept mapped (or loaded) by this VirtualFile.
+	/// </summary>
+	std::span<const uint8_t> GetTemporaryData(MemoryMappedFile& tempMapping);
+
 public:
 	/// <summary>Standard ROM file extensions (.nes, .sfc, .gb, etc.)</summary>
 	static const std::initializer_list<string> RomExtensions;
@@ -113,6 +135,15 @@ public:
 	/// <returns>Reference to internal data vector</returns>
 	vector<uint8_t>& GetData();
 
+	/// <summary>
+	/// Get read-only view of the file data without copying it.
+	/// </summary>
+	/// <returns>Memory-mapped file content for uncompressed files, otherwise the loaded (extracted/patched) data</returns>
+	/// <remarks>
+	/// Valid until the VirtualFile (and all its copies) is destroyed, or until GetData()/ApplyPatch() is called.
+	/// </remarks>
+	[[nodiscard]] std::span<const uint8_t> GetDataSpan();
+
 	/// <summary>Read file data into vector</summary>
 	[[nodiscard]] bool ReadFile(vector<uint8_t>& out);
 
@@ -127,7 +158,7 @@ public:
 	/// <summary>Read single byte at offset (chunked mode compatible)</summary>
 	uint8_t ReadByte(uint32_t offset);
 
-	/// <summary>Apply IPS/BPS patch to this file</summary>
+	/// <summary>Apply IPS/UPS/BPS patch to this file (large patched ROMs are cached on disk and memory mapped, see PatchedRomCache)</summary>
 	/// <param name="patch">VirtualFile containing patch data</param>
 	/// <returns>True if patch applied successfully</returns>
 	[[nodiscard]] bool ApplyPatch(VirtualFile& patch);
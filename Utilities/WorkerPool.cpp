@@ -0,0 +1,77 @@
+#include "pch.h"
+#include "WorkerPool.h"
+
+WorkerPool::WorkerPool(uint32_t workerCount) {
+	for (uint32_t i = 0; i < workerCount; i++) {
+		_threads.emplace_back([this]() { WorkerLoop(); });
+	}
+}
+
+WorkerPool::~WorkerPool() {
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_shutdownRequested = true;
+	}
+	_taskCv.notify_all();
+	for (std::thread& thread : _threads) {
+		if (thread.joinable()) {
+			thread.join();
+		}
+	}
+}
+
+void WorkerPool::WorkerLoop() {
+	std::unique_lock<std::mutex> lock(_mutex);
+	while (true) {
+		_taskCv.wait(lock, [this] { return _shutdownRequested || _nextTask < _taskCount; });
+		if (_shutdownRequested) {
+			return;
+		}
+
+		uint32_t index = _nextTask++;
+		const std::function<void(uint32_t)>& task = *_task;
+		lock.unlock();
+		task(index);
+		lock.lock();
+
+		if (--_pendingTasks == 0) {
+			_doneCv.notify_one();
+		}
+	}
+}
+
+void WorkerPool::Run(uint32_t taskCount, const std::function<void(uint32_t)>& task) {
+	if (taskCount <= 1 || _threads.empty()) {
+		for (uint32_t i = 0; i < taskCount; i++) {
+			task(i);
+		}
+		return;
+	}
+
+	std::unique_lock<std::mutex> lock(_mutex);
+	_task = &task;
+	_taskCount = taskCount;
+	_nextTask = 0;
+	_pendingTasks = taskCount;
+	_taskCv.notify_all();
+
+	// Help out with the batch instead of idling
+	while (_nextTask < _taskCount) {
+		uint32_t index = _nextTask++;
+		lock.unlock();
+		task(index);
+		lock.lock();
+		_pendingTasks--;
+	}
+
+	_doneCv.wait(lock, [this] { return _pendingTasks == 0; });
+	_task = nullptr;
+	_taskCount = 0;
+	_nextTask = 0;
+}
+
+uint32_t WorkerPool::GetDefaultWorkerCount(uint32_t maxWorkers) {
+	// Leave room for the emulation, decode and render threads
+	uint32_t cores = std::thread::hardware_concurrency();
+	return cores > 3 ? std::min(cores - 3, maxWorkers) : 0;
+}
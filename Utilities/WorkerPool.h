@@ -0,0 +1,52 @@
+#pragma once
+#include "pch.h"
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/// <summary>
+/// Small fixed-size thread pool that runs a batch of independent tasks and waits for them.
+/// </summary>
+/// <remarks>
+/// Used to split per-frame work (e.g. video filters) into horizontal slices.
+/// The calling thread also executes tasks, so a pool with N workers uses N+1 threads.
+///
+/// Thread safety: Run() must only be called from one thread at a time.
+/// </remarks>
+class WorkerPool {
+private:
+	vector<std::thread> _threads;
+	std::mutex _mutex;
+	std::condition_variable _taskCv;
+	std::condition_variable _doneCv;
+	bool _shutdownRequested = false;
+
+	// Current batch, protected by _mutex
+	const std::function<void(uint32_t)>* _task = nullptr;
+	uint32_t _taskCount = 0;
+	uint32_t _nextTask = 0;
+	uint32_t _pendingTasks = 0;
+
+	void WorkerLoop();
+
+public:
+	/// <summary>Start the worker threads</summary>
+	/// <param name="workerCount">Number of worker threads (0 = run everything on the calling thread)</param>
+	explicit WorkerPool(uint32_t workerCount);
+	~WorkerPool();
+
+	WorkerPool(const WorkerPool&) = delete;
+	WorkerPool& operator=(const WorkerPool&) = delete;
+
+	/// <summary>Number of threads that execute tasks, including the calling thread</summary>
+	[[nodiscard]] uint32_t GetThreadCount() const { return (uint32_t)_threads.size() + 1; }
+
+	/// <summary>Run task(0) ... task(taskCount - 1) and wait until all of them are done</summary>
+	void Run(uint32_t taskCount, const std::function<void(uint32_t)>& task);
+
+	/// <summary>Worker count to use for a pool sharing the CPU with the emulation and render threads</summary>
+	/// <param name="maxWorkers">Upper limit on the number of workers</param>
+	[[nodiscard]] static uint32_t GetDefaultWorkerCount(uint32_t maxWorkers);
+};
@@ -71,3 +71,33 @@ bool ZipReader::ExtractFile(const string& filename, vector<uint8_t>& output) {
 
 	return false;
 }
+
+bool ZipReader::GetFileCrc32(const string& filename, uint32_t& crc) {
+	if (_initialized) {
+		int fileIndex = mz_zip_reader_locate_file(&_zipArchive, filename.c_str(), nullptr, 0);
+		mz_zip_archive_file_stat fileStat;
+		if (fileIndex >= 0 && mz_zip_reader_file_stat(&_zipArchive, fileIndex, &fileStat)) {
+			crc = fileStat.m_crc32;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ZipReader::ExtractFile(const string& filename, const std::function<bool(const uint8_t* data, size_t size)>& callback) {
+	if (!_initialized) {
+		return false;
+	}
+
+	int fileIndex = mz_zip_reader_locate_file(&_zipArchive, filename.c_str(), nullptr, 0);
+	if (fileIndex < 0) {
+		return false;
+	}
+
+	mz_file_write_func writeChunk = [](void* opaque, mz_uint64 fileOffset, const void* buffer, size_t size) -> size_t {
+		// Returning less than size aborts the extraction
+		auto& cb = *(const std::function<bool(const uint8_t*, size_t)>*)opaque;
+		return cb((const uint8_t*)buffer, size) ? size : 0;
+	};
+	return mz_zip_reader_extract_to_callback(&_zipArchive, fileIndex, writeChunk, (void*)&callback, 0) != 0;
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include "pch.h"
+#include <functional>
 #include "miniz.h"
 #include "ArchiveReader.h"
 
@@ -42,4 +43,15 @@ public:
 	/// <param name="output">Output vector for decompressed data</param>
 	/// <returns>True if file found and extracted</returns>
 	bool ExtractFile(const string& filename, vector<uint8_t>& output);
+
+	/// <summary>
+	/// Decompress file to callback in chunks (without holding the whole file in memory).
+	/// </summary>
+	/// <param name="filename">File path within archive</param>
+	/// <param name="callback">Receives each decompressed chunk in order, returns false to abort</param>
+	/// <returns>True if the whole file was extracted</returns>
+	bool ExtractFile(const string& filename, const std::function<bool(const uint8_t* data, size_t size)>& callback);
+
+	/// <summary>Get file CRC32 from the ZIP central directory</summary>
+	bool GetFileCrc32(const string& filename, uint32_t& crc);
 };
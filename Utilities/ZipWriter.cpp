@@ -2,8 +2,10 @@
 #include <string>
 #include <cstring>
 #include <sstream>
+#include <fstream>
 #include "ZipWriter.h"
 #include "FolderUtilities.h"
+#include "WorkerPool.h"
 
 ZipWriter::ZipWriter() {
 }
@@ -18,21 +20,120 @@ bool ZipWriter::Initialize(const string& filename) {
 }
 
 bool ZipWriter::Save() {
-	bool result = mz_zip_writer_finalize_archive(&_zipArchive) != 0;
+	CompressEntries();
+
+	bool result = true;
+	vector<uint8_t> compressedData;
+	for (PendingEntry& entry : _entries) {
+		vector<uint8_t>* data = &entry.CompressedData;
+		if (entry.Chunks.size() == 1) {
+			data = &entry.Chunks[0];
+		} else if (entry.Chunks.size() > 1) {
+			compressedData.clear();
+			for (vector<uint8_t>& chunk : entry.Chunks) {
+				compressedData.insert(compressedData.end(), chunk.begin(), chunk.end());
+			}
+			data = &compressedData;
+		}
+
+		if (!mz_zip_writer_add_mem_ex(&_zipArchive, entry.Filename.c_str(), data->data(), data->size(), "", 0, MZ_BEST_COMPRESSION | MZ_ZIP_FLAG_COMPRESSED_DATA, entry.Size, entry.Crc)) {
+			std::cout << "mz_zip_writer_add_mem_ex() failed!" << std::endl;
+			result = false;
+		}
+	}
+	_entries.clear();
+
+	result &= mz_zip_writer_finalize_archive(&_zipArchive) != 0;
 	result &= mz_zip_writer_end(&_zipArchive) != 0;
 	return result;
 }
 
+void ZipWriter::CompressEntries() {
+	// One task per chunk, plus one task per entry for the CRC (computed over the whole entry while its chunks are being compressed)
+	struct CompressTask {
+		PendingEntry* Entry;
+		size_t Offset;
+		size_t Length;
+		int32_t ChunkIndex; ///< -1 = CRC task
+	};
+
+	vector<CompressTask> tasks;
+	for (PendingEntry& entry : _entries) {
+		if (entry.Compressed) {
+			continue;
+		}
+		size_t size = entry.Data.size();
+		size_t chunkCount = std::max<size_t>(1, (size + ChunkSize - 1) / ChunkSize);
+		entry.Size = size;
+		entry.Chunks.resize(chunkCount);
+		tasks.push_back({&entry, 0, size, -1});
+		for (size_t i = 0; i < chunkCount; i++) {
+			size_t offset = i * ChunkSize;
+			tasks.push_back({&entry, offset, std::min(ChunkSize, size - offset), (int32_t)i});
+		}
+	}
+
+	if (tasks.empty()) {
+		return;
+	}
+
+	auto compressChunk = [&](uint32_t index) {
+		CompressTask& task = tasks[index];
+		PendingEntry& entry = *task.Entry;
+		const uint8_t* data = entry.Data.data() + task.Offset;
+		if (task.ChunkIndex < 0) {
+			entry.Crc = (uint32_t)mz_crc32(MZ_CRC32_INIT, data, task.Length);
+			return;
+		}
+
+		vector<uint8_t>& output = entry.Chunks[task.ChunkIndex];
+		output.reserve(task.Length / 2);
+		tdefl_put_buf_func_ptr putBuf = [](const void* buffer, int length, void* user) -> mz_bool {
+			vector<uint8_t>& out = *(vector<uint8_t>*)user;
+			out.insert(out.end(), (const uint8_t*)buffer, (const uint8_t*)buffer + length);
+			return MZ_TRUE;
+		};
+
+		// Every chunk but the last ends with a sync flush (byte-aligned, not marked as the final block)
+		bool lastChunk = task.ChunkIndex == (int32_t)entry.Chunks.size() - 1;
+		unique_ptr<tdefl_compressor> compressor = std::make_unique<tdefl_compressor>();
+		tdefl_init(compressor.get(), putBuf, &output, tdefl_create_comp_flags_from_zip_params(MZ_BEST_COMPRESSION, -MZ_DEFAULT_WINDOW_BITS, MZ_DEFAULT_STRATEGY));
+		tdefl_compress_buffer(compressor.get(), data, task.Length, lastChunk ? TDEFL_FINISH : TDEFL_SYNC_FLUSH);
+	};
+
+	uint32_t workerCount = std::min<uint32_t>(WorkerPool::GetDefaultWorkerCount(MaxCompressWorkers), (uint32_t)tasks.size() - 1);
+	WorkerPool pool(workerCount);
+	pool.Run((uint32_t)tasks.size(), compressChunk);
+
+	for (PendingEntry& entry : _entries) {
+		if (!entry.Compressed) {
+			entry.Compressed = true;
+			vector<uint8_t>().swap(entry.Data);
+		}
+	}
+}
+
 void ZipWriter::AddFile(const string& filepath, const string& zipFilename) {
-	if (!mz_zip_writer_add_file(&_zipArchive, zipFilename.c_str(), filepath.c_str(), "", 0, MZ_BEST_COMPRESSION)) {
-		std::cout << "mz_zip_writer_add_file() failed!" << std::endl;
+	ifstream file(filepath, std::ios::in | std::ios::binary);
+	if (!file) {
+		std::cout << "ZipWriter::AddFile() failed to open " << filepath << std::endl;
+		return;
 	}
+
+	file.seekg(0, std::ios::end);
+	size_t fileSize = (size_t)file.tellg();
+	file.seekg(0, std::ios::beg);
+
+	PendingEntry& entry = _entries.emplace_back();
+	entry.Filename = zipFilename;
+	entry.Data.resize(fileSize);
+	file.read((char*)entry.Data.data(), fileSize);
 }
 
 void ZipWriter::AddFile(vector<uint8_t>& fileData, const string& zipFilename) {
-	if (!mz_zip_writer_add_mem(&_zipArchive, zipFilename.c_str(), fileData.data(), fileData.size(), MZ_BEST_COMPRESSION)) {
-		std::cout << "mz_zip_writer_add_file() failed!" << std::endl;
-	}
+	PendingEntry& entry = _entries.emplace_back();
+	entry.Filename = zipFilename;
+	entry.Data = fileData;
 }
 
 void ZipWriter::AddFile(std::stringstream& filestream, const string& zipFilename) {
@@ -45,3 +146,42 @@ void ZipWriter::AddFile(std::stringstream& filestream, const string& zipFilename
 
 	AddFile(buffer, zipFilename);
 }
+
+void ZipWriter::AddFile(ZipFileCompressor& compressor, const string& zipFilename) {
+	compressor.Finish();
+	PendingEntry& entry = _entries.emplace_back();
+	entry.Filename = zipFilename;
+	entry.CompressedData = compressor._compressedData;
+	entry.Size = compressor._size;
+	entry.Crc = compressor._crc;
+	entry.Compressed = true;
+}
+
+ZipFileCompressor::ZipFileCompressor() {
+	_compressor = std::make_unique<tdefl_compressor>();
+
+	// Raw deflate stream (no zlib header), as stored in ZIP files
+	tdefl_put_buf_func_ptr output = [](const void* buffer, int length, void* user) -> mz_bool {
+		vector<uint8_t>& data = *(vector<uint8_t>*)user;
+		data.insert(data.end(), (const uint8_t*)buffer, (const uint8_t*)buffer + length);
+		return MZ_TRUE;
+	};
+	tdefl_init(_compressor.get(), output, &_compressedData, tdefl_create_comp_flags_from_zip_params(MZ_BEST_COMPRESSION, -MZ_DEFAULT_WINDOW_BITS, MZ_DEFAULT_STRATEGY));
+}
+
+void ZipFileCompressor::Write(const void* data, size_t size) {
+	if (_finished || size == 0) {
+		return;
+	}
+	_crc = (uint32_t)mz_crc32(_crc, (const mz_uint8*)data, size);
+	_size += size;
+	tdefl_compress_buffer(_compressor.get(), data, size, TDEFL_NO_FLUSH);
+}
+
+void ZipFileCompressor::Finish() {
+	if (!_finished) {
+		tdefl_compress_buffer(_compressor.get(), nullptr, 0, TDEFL_FINISH);
+		_compressor.reset();
+		_finished = true;
+	}
+}
@@ -23,11 +23,64 @@
 ///
 /// All files stored with deflate compression.
 /// ZIP format compatible with standard ZIP tools.
+///
+/// Entries are only compressed by Save(): large entries are split into independent chunks
+/// (pigz-style, each chunk a raw deflate stream ended with a sync flush, so the concatenation
+/// is one valid deflate stream) and every chunk of every entry is compressed on a worker pool.
+/// </remarks>
+class ZipWriter;
+
+/// <summary>
+/// Compresses the content of a ZIP entry incrementally (data written in small pieces over time, e.g a movie's input).
+/// </summary>
+/// <remarks>
+/// Only the compressed data is kept in memory, AddFile() stores it as is (no second compression pass).
+/// Not thread-safe, Write() and Finish() must be called from the same thread (or with external synchronization).
 /// </remarks>
+class ZipFileCompressor {
+private:
+	friend class ZipWriter;
+
+	unique_ptr<tdefl_compressor> _compressor;
+	vector<uint8_t> _compressedData;
+	uint64_t _size = 0;
+	uint32_t _crc = MZ_CRC32_INIT;
+	bool _finished = false;
+
+public:
+	ZipFileCompressor();
+
+	/// <summary>Compress data (appended to the file's content)</summary>
+	void Write(const void* data, size_t size);
+
+	/// <summary>Flush the compressor, no data can be written afterwards</summary>
+	void Finish();
+
+	[[nodiscard]] uint64_t GetSize() const { return _size; }
+};
+
 class ZipWriter {
 private:
+	/// <summary>Entries smaller than this are compressed as a single chunk (chunks don't share their dictionary, so smaller chunks compress worse)</summary>
+	static constexpr size_t ChunkSize = 256 * 1024;
+	static constexpr uint32_t MaxCompressWorkers = 7;
+
+	/// <summary>Entry waiting for Save() to compress it</summary>
+	struct PendingEntry {
+		string Filename;
+		vector<uint8_t> Data;                  ///< Uncompressed content (empty once compressed)
+		vector<vector<uint8_t>> Chunks;        ///< Compressed chunks, concatenated when writing the entry
+		vector<uint8_t> CompressedData;        ///< Content already compressed by a ZipFileCompressor
+		uint64_t Size = 0;
+		uint32_t Crc = MZ_CRC32_INIT;
+		bool Compressed = false;
+	};
+
 	mz_zip_archive _zipArchive; ///< Miniz ZIP archive structure
 	string _zipFilename;        ///< Output ZIP file path
+	vector<PendingEntry> _entries;
+
+	void CompressEntries();
 
 public:
 	/// <summary>Construct ZipWriter (call Initialize before adding files)</summary>
@@ -53,12 +106,12 @@ public:
 	/// <summary>
 	/// Add file from filesystem to ZIP.
 	/// </summary>
-	/// <param name="filepath">Source file path to read</param>
+	/// <param name="filepath">Source file path to read (read immediately)</param>
 	/// <param name="zipFilename">Path within ZIP archive</param>
 	void AddFile(const string& filepath, const string& zipFilename);
 
 	/// <summary>
-	/// Add file from memory vector to ZIP.
+	/// Add file from memory vector to ZIP (the data is copied).
 	/// </summary>
 	/// <param name="fileData">File data to compress</param>
 	/// <param name="zipFilename">Path within ZIP archive</param>
@@ -70,4 +123,11 @@ public:
 	/// <param name="filestream">Stream containing file data</param>
 	/// <param name="zipFilename">Path within ZIP archive</param>
 	void AddFile(std::stringstream& filestream, const string& zipFilename);
+
+	/// <summary>
+	/// Add file compressed with a ZipFileCompressor (finished automatically).
+	/// </summary>
+	/// <param name="compressor">Compressed file content</param>
+	/// <param name="zipFilename">Path within ZIP archive</param>
+	void AddFile(ZipFileCompressor& compressor, const string& zipFilename);
 };
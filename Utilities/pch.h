@@ -30,6 +30,16 @@ using std::unordered_map;
 using std::unordered_set;
 using std::optional;
 
+#ifndef __noinline
+#if defined(_MSC_VER)
+#define __noinline __declspec(noinline)
+#elif !defined(__MINGW32__) && (defined(__clang__) || defined(__GNUC__))
+#define __noinline __attribute__((noinline))
+#else
+#define __noinline
+#endif
+#endif
+
 #ifndef _MSC_VER
 // Some headers have functions marked as `__forceinline` but don't provide the bodies;
 // it fails to compile when LTO is not enabled.
@@ -19,10 +19,16 @@
 
 #include "pch.h"
 #include "sha1.h"
+#include "CpuFeatures.h"
 #include <sstream>
 #include <iomanip>
 #include <format>
 #include <fstream>
+#include <utility>
+
+#ifdef NEXEN_ARCH_X86
+#include <immintrin.h>
+#endif
 
 static const size_t BLOCK_INTS = 16; /* number of 32bit integers per SHA1 block */
 static const size_t BLOCK_BYTES = BLOCK_INTS * 4;
@@ -193,30 +199,114 @@ static void buffer_to_block(const std::string& buffer, uint32_t block[BLOCK_INTS
 	}
 }
 
+static void bytes_to_block(const uint8_t* data, uint32_t block[BLOCK_INTS]) {
+	for (size_t i = 0; i < BLOCK_INTS; i++) {
+		block[i] = data[4 * i + 3] | data[4 * i + 2] << 8 | data[4 * i + 1] << 16 | (uint32_t)data[4 * i + 0] << 24;
+	}
+}
+
+#ifdef NEXEN_ARCH_X86
+/*
+ * Hash 512-bit blocks with the SHA extensions (sha1rnds4 = 4 rounds, sha1msg1/sha1msg2 = message schedule)
+ */
+
+/* One group of 4 rounds, msg[] holds the last 16 words of the message schedule */
+template <int G>
+NEXEN_TARGET("sha,ssse3,sse4.1")
+static __forceinline void shani_group(__m128i& abcd, __m128i& e0, __m128i& prevAbcd, __m128i msg[4], const uint8_t* data, __m128i byteSwap) {
+	if constexpr (G < 4) {
+		msg[G] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + G * 16)), byteSwap);
+	} else {
+		__m128i w = _mm_xor_si128(_mm_sha1msg1_epu32(msg[G & 3], msg[(G + 1) & 3]), msg[(G + 2) & 3]);
+		msg[G & 3] = _mm_sha1msg2_epu32(w, msg[(G + 3) & 3]);
+	}
+
+	__m128i e = G == 0 ? _mm_add_epi32(e0, msg[0]) : _mm_sha1nexte_epu32(prevAbcd, msg[G & 3]);
+	prevAbcd = abcd;
+	abcd = _mm_sha1rnds4_epu32(abcd, e, G / 5);
+}
+
+template <int... G>
+NEXEN_TARGET("sha,ssse3,sse4.1")
+static __forceinline void shani_rounds(__m128i& abcd, __m128i& e0, __m128i& prevAbcd, __m128i msg[4], const uint8_t* data, __m128i byteSwap, std::integer_sequence<int, G...>) {
+	(shani_group<G>(abcd, e0, prevAbcd, msg, data, byteSwap), ...);
+}
+
+NEXEN_TARGET("sha,ssse3,sse4.1")
+static void transform_shani(uint32_t digest[], const uint8_t* data, size_t blockCount) {
+	const __m128i byteSwap = _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+
+	__m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)digest), 0x1B);
+	__m128i e0 = _mm_set_epi32((int)digest[4], 0, 0, 0);
+
+	for (; blockCount > 0; blockCount--, data += BLOCK_BYTES) {
+		__m128i abcdSave = abcd;
+		__m128i e0Save = e0;
+		__m128i prevAbcd = abcd;
+		__m128i msg[4];
+
+		shani_rounds(abcd, e0, prevAbcd, msg, data, byteSwap, std::make_integer_sequence<int, 20>());
+
+		e0 = _mm_sha1nexte_epu32(prevAbcd, e0Save);
+		abcd = _mm_add_epi32(abcd, abcdSave);
+	}
+
+	_mm_storeu_si128((__m128i*)digest, _mm_shuffle_epi32(abcd, 0x1B));
+	digest[4] = (uint32_t)_mm_extract_epi32(e0, 3);
+}
+#endif
+
+void SHA1::transformBlocks(const uint8_t* data, size_t blockCount) {
+#ifdef NEXEN_ARCH_X86
+	if (CpuFeatures::HasSha()) {
+		transform_shani(digest, data, blockCount);
+		transforms += blockCount;
+		return;
+	}
+#endif
+
+	uint32_t block[BLOCK_INTS];
+	for (size_t i = 0; i < blockCount; i++) {
+		bytes_to_block(data + i * BLOCK_BYTES, block);
+		transform(digest, block, transforms);
+	}
+}
+
 SHA1::SHA1() {
 	reset(digest, buffer, transforms);
 }
 
 void SHA1::update(const std::string& s) {
-	std::istringstream is(s);
-	update(is);
+	update((const uint8_t*)s.data(), s.size());
 }
 
 void SHA1::update(std::istream& is) {
-	char sbuf[BLOCK_BYTES];
-	uint32_t block[BLOCK_INTS];
+	char sbuf[BLOCK_BYTES * 256];
 
-	while (true) {
-		is.read(sbuf, BLOCK_BYTES - buffer.size());
-		buffer.append(sbuf, (size_t)is.gcount());
+	while (is) {
+		is.read(sbuf, sizeof(sbuf));
+		update((const uint8_t*)sbuf, (size_t)is.gcount());
+	}
+}
+
+void SHA1::update(const uint8_t* data, size_t size) {
+	if (!buffer.empty()) {
+		/* Complete the pending block first */
+		size_t count = std::min(size, BLOCK_BYTES - buffer.size());
+		buffer.append((const char*)data, count);
+		data += count;
+		size -= count;
 		if (buffer.size() != BLOCK_BYTES) {
 			return;
 		}
-
-		buffer_to_block(buffer, block);
-		transform(digest, block, transforms);
+		transformBlocks((const uint8_t*)buffer.data(), 1);
 		buffer.clear();
 	}
+
+	/* Hash whole blocks straight from the input, keep the remainder for the next call */
+	size_t blockCount = size / BLOCK_BYTES;
+	transformBlocks(data, blockCount);
+	buffer.assign((const char*)data + blockCount * BLOCK_BYTES, size % BLOCK_BYTES);
 }
 
 /*
@@ -263,20 +353,12 @@ std::string SHA1::final() {
 }
 
 std::string SHA1::GetHash(vector<uint8_t>& data) {
-	std::stringstream ss;
-	ss.write((char*)data.data(), data.size());
-
-	SHA1 checksum;
-	checksum.update(ss);
-	return checksum.final();
+	return GetHash(data.data(), data.size());
 }
 
-std::string SHA1::GetHash(uint8_t* data, size_t size) {
-	std::stringstream ss;
-	ss.write((char*)data, size);
-
+std::string SHA1::GetHash(const uint8_t* data, size_t size) {
 	SHA1 checksum;
-	checksum.update(ss);
+	checksum.update(data, size);
 	return checksum.final();
 }
 
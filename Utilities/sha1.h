@@ -28,13 +28,16 @@ public:
 	SHA1();
 	void update(const std::string& s);
 	void update(std::istream& is);
+	void update(const uint8_t* data, size_t size);
 	std::string final();
 	static std::string GetHash(const std::string& filename);
 	static std::string GetHash(std::istream& stream);
 	static std::string GetHash(vector<uint8_t>& data);
-	static std::string GetHash(uint8_t* data, size_t size);
+	static std::string GetHash(const uint8_t* data, size_t size);
 
 private:
+	void transformBlocks(const uint8_t* data, size_t blockCount);
+
 	uint32_t digest[5];
 	std::string buffer;
 	uint64_t transforms;
@@ -7,6 +7,7 @@
 #include "Core/Shared/MessageManager.h"
 #include "Core/Shared/SettingTypes.h"
 #include "Core/Shared/EmuSettings.h"
+#include "Core/Shared/RenderedFrame.h"
 #include "Utilities/UTF8Util.h"
 
 using namespace DirectX;
@@ -190,6 +191,7 @@ void Renderer::CleanupDevice() {
 }
 
 void Renderer::ResetTextureBuffers() {
+	ReleasePostProcessResources();
 	if (_pTexture) {
 		_pTexture->Release();
 		_pTexture = nullptr;
@@ -434,18 +436,20 @@ void Renderer::UpdateFrame(RenderedFrame& frame) {
 	if (_textureBuffer[0]) {
 		//_textureBuffer[0] may be null if directx failed to initialize properly
 		memcpy(_textureBuffer[0], frame.FrameBuffer, frame.Width * frame.Height * sizeof(uint32_t));
+		_postProcess[0] = frame.PostProcess;
 		_needFlip = true;
 		_frameChanged = true;
 	}
 }
 
-void Renderer::DrawScreen() {
+bool Renderer::UpdateScreenTexture() {
 	// Swap buffers - emulator always writes to _textureBuffer[0], screen always draws _textureBuffer[1]
 	if (_needFlip) {
 		auto lock = _textureLock.AcquireSafe();
 		uint8_t* textureBuffer = _textureBuffer[0];
 		_textureBuffer[0] = _textureBuffer[1];
 		_textureBuffer[1] = textureBuffer;
+		std::swap(_postProcess[0], _postProcess[1]);
 		_needFlip = false;
 
 		if (_frameChanged) {
@@ -460,7 +464,7 @@ void Renderer::DrawScreen() {
 	HRESULT hr = _pDeviceContext->Map(_pTexture, 0, D3D11_MAP_WRITE_DISCARD, 0, &dd);
 	if (FAILED(hr)) {
 		MessageManager::Log("DeviceContext::Map() failed - Error:" + std::to_string(hr));
-		return;
+		return false;
 	}
 	uint8_t* surfacePointer = (uint8_t*)dd.pData;
 	uint8_t* videoBuffer = _textureBuffer[1];
@@ -474,14 +478,173 @@ void Renderer::DrawScreen() {
 		memcpy(surfacePointer, videoBuffer, rowPitch * _emuFrameHeight);
 	}
 	_pDeviceContext->Unmap(_pTexture, 0);
+	return true;
+}
 
+void Renderer::DrawScreen(ID3D11ShaderResourceView* screenSrv) {
 	RECT destRect;
 	destRect.left = _leftMargin;
 	destRect.top = _topMargin;
 	destRect.right = _screenWidth + _leftMargin;
 	destRect.bottom = _screenHeight + _topMargin;
 
-	_spriteBatch->Draw(_pTextureSrv, destRect);
+	_spriteBatch->Draw(screenSrv, destRect);
+}
+
+bool Renderer::CreatePostProcessTarget(uint32_t width, uint32_t height) {
+	D3D11_TEXTURE2D_DESC desc = {};
+	desc.ArraySize = 1;
+	desc.BindFlags = D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET;
+	desc.Format = GetTextureFormat();
+	desc.MipLevels = 1;
+	desc.SampleDesc.Count = 1;
+	desc.Usage = D3D11_USAGE_DEFAULT;
+	desc.Width = width;
+	desc.Height = height;
+
+	HRESULT hr = _pd3dDevice->CreateTexture2D(&desc, nullptr, &_pScaledTexture);
+	if (FAILED(hr)) {
+		MessageManager::Log("D3DDevice::CreateTexture() failed (post-process) - Error:" + std::to_string(hr));
+		return false;
+	}
+
+	hr = _pd3dDevice->CreateRenderTargetView(_pScaledTexture, nullptr, &_pScaledRtv);
+	if (FAILED(hr)) {
+		MessageManager::Log("D3DDevice::CreateRenderTargetView() failed (post-process) - Error:" + std::to_string(hr));
+		return false;
+	}
+
+	_pScaledSrv = GetShaderResourceView(_pScaledTexture);
+	if (!_pScaledSrv) {
+		return false;
+	}
+
+	if (!_pMultiplyBlendState) {
+		// dest = dest * overlay
+		D3D11_BLEND_DESC blendDesc = {};
+		D3D11_RENDER_TARGET_BLEND_DESC& rt = blendDesc.RenderTarget[0];
+		rt.BlendEnable = TRUE;
+		rt.SrcBlend = rt.SrcBlendAlpha = D3D11_BLEND_ZERO;
+		rt.DestBlend = D3D11_BLEND_SRC_COLOR;
+		rt.DestBlendAlpha = D3D11_BLEND_SRC_ALPHA;
+		rt.BlendOp = rt.BlendOpAlpha = D3D11_BLEND_OP_ADD;
+		rt.RenderTargetWriteMask = D3D11_COLOR_WRITE_ENABLE_ALL;
+
+		hr = _pd3dDevice->CreateBlendState(&blendDesc, &_pMultiplyBlendState);
+		if (FAILED(hr)) {
+			MessageManager::Log("D3DDevice::CreateBlendState() failed - Error:" + std::to_string(hr));
+			return false;
+		}
+	}
+
+	_scaledWidth = width;
+	_scaledHeight = height;
+	return true;
+}
+
+void Renderer::ReleasePostProcessResources() {
+	if (_pScaledSrv) {
+		_pScaledSrv->Release();
+		_pScaledSrv = nullptr;
+	}
+	if (_pScaledRtv) {
+		_pScaledRtv->Release();
+		_pScaledRtv = nullptr;
+	}
+	if (_pScaledTexture) {
+		_pScaledTexture->Release();
+		_pScaledTexture = nullptr;
+	}
+	if (_overlay.Shader) {
+		_overlay.Shader->Release();
+		_overlay.Shader = nullptr;
+	}
+	if (_overlay.Texture) {
+		_overlay.Texture->Release();
+		_overlay.Texture = nullptr;
+	}
+	if (_pMultiplyBlendState) {
+		_pMultiplyBlendState->Release();
+		_pMultiplyBlendState = nullptr;
+	}
+	_scaledWidth = 0;
+	_scaledHeight = 0;
+}
+
+bool Renderer::UpdateOverlay(const GpuPostProcess& postProcess) {
+	bool sizeChanged = _overlay.Width != _scaledWidth || _overlay.Height != _scaledHeight || !_overlay.Texture || !_overlay.Shader;
+	if (!sizeChanged && _overlayPostProcess == postProcess) {
+		return true;
+	}
+
+	if (sizeChanged && !CreateHudTexture(_overlay, _scaledWidth, _scaledHeight)) {
+		return false;
+	}
+
+	_overlayBuffer.resize(_scaledWidth * _scaledHeight);
+	postProcess.BuildOverlay(_overlayBuffer.data(), _scaledWidth, _scaledHeight);
+
+	uint32_t rowPitch = _scaledWidth * sizeof(uint32_t);
+	D3D11_MAPPED_SUBRESOURCE dd;
+	HRESULT hr = _pDeviceContext->Map(_overlay.Texture, 0, D3D11_MAP_WRITE_DISCARD, 0, &dd);
+	if (FAILED(hr)) {
+		MessageManager::Log("DeviceContext::Map() failed - Error:" + std::to_string(hr));
+		return false;
+	}
+	uint8_t* surfacePointer = (uint8_t*)dd.pData;
+	uint8_t* overlayBuffer = (uint8_t*)_overlayBuffer.data();
+	for (uint32_t i = 0; i < _scaledHeight; i++) {
+		memcpy(surfacePointer, overlayBuffer, rowPitch);
+		overlayBuffer += rowPitch;
+		surfacePointer += dd.RowPitch;
+	}
+	_pDeviceContext->Unmap(_overlay.Texture, 0);
+
+	_overlayPostProcess = postProcess;
+	return true;
+}
+
+bool Renderer::ApplyPostProcess(const GpuPostProcess& postProcess) {
+	uint32_t width = _emuFrameWidth * postProcess.Scale;
+	uint32_t height = _emuFrameHeight * postProcess.Scale;
+	if (!_pScaledSrv || _scaledWidth != width || _scaledHeight != height) {
+		ReleasePostProcessResources();
+		if (!CreatePostProcessTarget(width, height)) {
+			ReleasePostProcessResources();
+			return false;
+		}
+	}
+
+	if (postProcess.NeedsOverlay() && !UpdateOverlay(postProcess)) {
+		return false;
+	}
+
+	D3D11_VIEWPORT vp = {};
+	vp.Width = (FLOAT)width;
+	vp.Height = (FLOAT)height;
+	vp.MaxDepth = 1.0f;
+	_pDeviceContext->OMSetRenderTargets(1, &_pScaledRtv, nullptr);
+	_pDeviceContext->RSSetViewports(1, &vp);
+
+	RECT rect = {0, 0, (LONG)width, (LONG)height};
+
+	// The upscale itself is always nearest-neighbor, like ScaleFilter's prescale
+	_spriteBatch->Begin(SpriteSortMode_Immediate, false);
+	_spriteBatch->Draw(_pTextureSrv, rect);
+	_spriteBatch->End();
+
+	if (postProcess.NeedsOverlay()) {
+		_spriteBatch->Begin(SpriteSortMode_Immediate, _pMultiplyBlendState);
+		_spriteBatch->Draw(_overlay.Shader, rect);
+		_spriteBatch->End();
+	}
+
+	// Back to the swap chain's buffer
+	vp.Width = (FLOAT)_realScreenWidth;
+	vp.Height = (FLOAT)_realScreenHeight;
+	_pDeviceContext->OMSetRenderTargets(1, &_pRenderTargetView, nullptr);
+	_pDeviceContext->RSSetViewports(1, &vp);
+	return true;
 }
 
 bool Renderer::CreateHudTexture(HudRenderInfo& hud, uint32_t newWidth, uint32_t newHeight) {
@@ -578,10 +741,17 @@ void Renderer::Render(RenderSurfaceInfo& emuHud, RenderSurfaceInfo& scriptHud) {
 	// Clear the back buffer
 	_pDeviceContext->ClearRenderTargetView(_pRenderTargetView, Colors::Black);
 
-	// Draw screen
-	_spriteBatch->Begin(SpriteSortMode_Immediate, cfg.UseBilinearInterpolation);
-	DrawScreen();
-	_spriteBatch->End();
+	// Draw screen (upscaled + overlay first when the decoder left post-processing to the GPU)
+	if (UpdateScreenTexture()) {
+		ID3D11ShaderResourceView* screenSrv = _pTextureSrv;
+		if (_postProcess[1].IsActive() && ApplyPostProcess(_postProcess[1])) {
+			screenSrv = _pScaledSrv;
+		}
+
+		_spriteBatch->Begin(SpriteSortMode_Immediate, cfg.UseBilinearInterpolation);
+		DrawScreen(screenSrv);
+		_spriteBatch->End();
+	}
 
 	// Draw HUD
 	_spriteBatch->Begin(SpriteSortMode_Immediate, false);
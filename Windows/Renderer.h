@@ -3,6 +3,7 @@
 #include "Common.h"
 #include "Core/Shared/Interfaces/IRenderingDevice.h"
 #include "Core/Shared/Interfaces/IMessageManager.h"
+#include "Core/Shared/Video/GpuPostProcess.h"
 #include "Utilities/FolderUtilities.h"
 #include "Utilities/SimpleLock.h"
 #include "Utilities/Timer.h"
@@ -38,6 +39,18 @@ private:
 	ID3D11Texture2D* _pTexture = nullptr;
 	ID3D11ShaderResourceView* _pTextureSrv = nullptr;
 
+	// GPU post-process pass (prescale, LCD grid, scanlines), _postProcess is paired with _textureBuffer
+	GpuPostProcess _postProcess[2] = {};
+	ID3D11Texture2D* _pScaledTexture = nullptr;
+	ID3D11RenderTargetView* _pScaledRtv = nullptr;
+	ID3D11ShaderResourceView* _pScaledSrv = nullptr;
+	uint32_t _scaledWidth = 0;
+	uint32_t _scaledHeight = 0;
+	HudRenderInfo _overlay = {};
+	GpuPostProcess _overlayPostProcess = {};
+	vector<uint32_t> _overlayBuffer;
+	ID3D11BlendState* _pMultiplyBlendState = nullptr;
+
 	HudRenderInfo _emuHud = {};
 	HudRenderInfo _scriptHud = {};
 
@@ -77,7 +90,13 @@ private:
 
 	ID3D11Texture2D* CreateTexture(uint32_t width, uint32_t height);
 	ID3D11ShaderResourceView* GetShaderResourceView(ID3D11Texture2D* texture);
-	void DrawScreen();
+	bool UpdateScreenTexture();
+	void DrawScreen(ID3D11ShaderResourceView* screenSrv);
+
+	bool CreatePostProcessTarget(uint32_t width, uint32_t height);
+	void ReleasePostProcessResources();
+	bool UpdateOverlay(const GpuPostProcess& postProcess);
+	bool ApplyPostProcess(const GpuPostProcess& postProcess);
 
 	bool CreateHudTexture(HudRenderInfo& hud, uint32_t newWidth, uint32_t newHeight);
 	void DrawHud(HudRenderInfo& hud, RenderSurfaceInfo& hudSurface);
@@ -100,4 +119,5 @@ public:
 	void ClearFrame() override;
 
 	void UpdateFrame(RenderedFrame& frame) override;
+	bool SupportsGpuPostProcess() override { return true; }
 };
\ No newline at end of file
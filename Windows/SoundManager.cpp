@@ -197,6 +197,7 @@ void SoundManager::ClearSecondaryBuffer() {
 
 	_secondaryBuffer->SetCurrentPosition(0);
 	_lastWriteOffset = 0;
+	_lastPlayCursor = 0;
 }
 
 void SoundManager::CopyToSecondaryBuffer(uint8_t* data, uint32_t size) {
@@ -263,6 +264,12 @@ void SoundManager::ProcessEndOfFrame() {
 
 	ProcessLatency(currentPlayCursor, _lastWriteOffset);
 
+	if (_playing) {
+		// The play cursor is only sampled once per frame, which is precise enough for the latency stats
+		_latencyTracker.OnConsumed((currentPlayCursor - _lastPlayCursor + _bufferSize) % _bufferSize);
+	}
+	_lastPlayCursor = currentPlayCursor;
+
 	AudioConfig cfg = _emu->GetSettings()->GetAudioConfig();
 	SetAudioDevice(cfg.AudioDevice);
 
@@ -288,6 +295,7 @@ void SoundManager::PlayBuffer(int16_t* soundBuffer, uint32_t sampleCount, uint32
 
 	uint32_t soundBufferSize = sampleCount * bytesPerSample;
 	CopyToSecondaryBuffer((uint8_t*)soundBuffer, soundBufferSize);
+	_latencyTracker.OnQueued(soundBufferSize, _mixStartTime);
 
 	if (!_playing) {
 		DWORD byteLatency = (int32_t)((float)(sampleRate * latency) / 1000.0f * bytesPerSample);
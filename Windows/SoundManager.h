@@ -41,6 +41,7 @@ private:
 	string _audioDeviceName = "";
 
 	DWORD _lastWriteOffset = 0;
+	DWORD _lastPlayCursor = 0;
 	uint32_t _previousLatency = 0;
 	bool _playing = false;
 
@@ -4,6 +4,8 @@
 #
 # ROM files must be copied to the PGOHelper/PGOGames folder beforehand - all supported rom files in that folder will be executed as part of the profiling process.
 # Using a variety of roms is recommended (e.g different consoles/mappers, etc.)
+# Each rom is run with several workloads (video filters, run-ahead, rewind, debugger, etc.), in parallel.
+# PGO_THREADS (default: 1 per core) and PGO_DURATION (ms per rom and workload, default: 5000) can be used to tune this.
 #
 # This will produce the following binary: bin/linux-x64/Release/linux-x64/publish/Nexen
 PLAT="x64"
@@ -19,12 +21,23 @@ eval cp bin/pgohelperlib.so ${OBJ}
 
 #run the instrumented binary
 cd ${OBJ}
-./pgohelper
+./pgohelper ../PGOGames ${PGO_THREADS:-0} ${PGO_DURATION:-5000}
 cd ..
 
 if [ "$USE_GCC" != true ]; then
 	#clang-specific steps to convert the profiling data and clean the files
 	llvm-profdata merge -output=pgo.profdata pgo.profraw
+
+	#list the hot-looking functions (cpu/ppu/apu loops, memory handlers, etc.) that the workloads never executed
+	DEMANGLE="cat"
+	if command -v c++filt >/dev/null 2>&1; then
+		DEMANGLE="c++filt"
+	fi
+	llvm-profdata show --all-functions pgo.profdata 2>/dev/null \
+		| awk '/^  [^ ].*:$/ { name = substr($1, 1, length($1) - 1) } /Function count: 0$/ { print name }' \
+		| ${DEMANGLE} \
+		| grep -E '(Exec|Run|Read|Write|Render|Draw|Process|Step|Clock|Sync)' > untrained.txt
+	echo "$(wc -l < untrained.txt) hot functions were not trained (see PGOHelper/untrained.txt)"
 	cd ..
 	eval make clean
 else
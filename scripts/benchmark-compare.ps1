@@ -0,0 +1,209 @@
+param(
+	[Parameter(Mandatory = $true)]
+	[string]$Results,
+	[string]$MachineProfile = "",
+	[string]$BaselineFolder = "~docs/benchmarks",
+	[double]$Threshold = 0.05,
+	[double]$MinTScore = 2.0,
+	[string]$Report = "",
+	[switch]$UpdateBaseline
+)
+
+# Compares a benchmark run with the baseline stored for this machine profile, and fails if a benchmark regressed.
+#
+# Accepted inputs:
+# - Core.Benchmarks (Google Benchmark): --benchmark_out=results.json --benchmark_out_format=json --benchmark_repetitions=5
+# - BenchmarkDotNet: the *-report-full.json files from BenchmarkDotNet.Artifacts/results (JsonExporter.Full)
+#
+# A benchmark is a regression when its mean time is more than $Threshold slower than the baseline AND the difference
+# is statistically significant (Welch t-score >= $MinTScore, computed from the repetitions). With a single repetition
+# on either side, only the threshold is used, so run with repetitions to avoid false positives from noisy runs.
+#
+# Exit codes: 0 = no regression, 1 = regression(s) found, 2 = invalid input/no baseline
+
+$ErrorActionPreference = "Stop"
+
+function Get-Mean([double[]]$values) {
+	return ($values | Measure-Object -Average).Average
+}
+
+function Get-Variance([double[]]$values) {
+	if ($values.Count -lt 2) {
+		return 0.0
+	}
+	$mean = Get-Mean $values
+	$sum = 0.0
+	foreach ($value in $values) {
+		$sum += ($value - $mean) * ($value - $mean)
+	}
+	return $sum / ($values.Count - 1)
+}
+
+function Get-TimeScale([string]$unit) {
+	switch ($unit) {
+		"ns" { return 1.0 }
+		"us" { return 1000.0 }
+		"ms" { return 1000000.0 }
+		"s" { return 1000000000.0 }
+		default { return 1.0 }
+	}
+}
+
+# Returns the profile name and a "benchmark name -> samples (ns)" table for a results file
+function Read-BenchmarkResults([string]$path) {
+	$json = Get-Content -Raw -Path $path | ConvertFrom-Json
+	$samples = [ordered]@{}
+	$statistics = @{}
+
+	if ($null -ne $json.context -and $null -ne $json.benchmarks) {
+		# Google Benchmark: one "iteration" entry per repetition, then aggregates (mean/median/stddev/cv)
+		$profileName = "{0}-{1}cpu" -f $json.context.host_name, $json.context.num_cpus
+		foreach ($entry in $json.benchmarks) {
+			$name = if ($entry.run_name) { $entry.run_name } else { $entry.name }
+			$time = [double]$entry.cpu_time * (Get-TimeScale $entry.time_unit)
+			if ($entry.run_type -eq "aggregate") {
+				# Only used when the run only reported aggregates (--benchmark_report_aggregates_only)
+				if (-not $statistics.ContainsKey($name)) {
+					$statistics[$name] = @{ Samples = [int]$entry.repetitions }
+				}
+				$statistics[$name][$entry.aggregate_name] = $time
+			} elseif ($null -eq $entry.error_occurred -or -not $entry.error_occurred) {
+				if (-not $samples.Contains($name)) {
+					$samples[$name] = [System.Collections.Generic.List[double]]::new()
+				}
+				$samples[$name].Add($time)
+			}
+		}
+
+		foreach ($name in $statistics.Keys) {
+			if (-not $samples.Contains($name) -and $statistics[$name].ContainsKey("mean")) {
+				$stat = $statistics[$name]
+				$samples[$name] = @{ Mean = $stat["mean"]; Variance = [math]::Pow([double]$stat["stddev"], 2); Samples = $stat["Samples"] }
+			}
+		}
+	} elseif ($null -ne $json.Benchmarks) {
+		# BenchmarkDotNet (times are in ns)
+		$profileName = "{0}-{1}" -f $json.HostEnvironmentInfo.ProcessorName, $json.HostEnvironmentInfo.OsVersion
+		foreach ($entry in $json.Benchmarks) {
+			if ($null -eq $entry.Statistics) {
+				continue
+			}
+			if ($null -ne $entry.Statistics.OriginalValues -and $entry.Statistics.OriginalValues.Count -gt 0) {
+				$samples[$entry.FullName] = [double[]]$entry.Statistics.OriginalValues
+			} else {
+				$samples[$entry.FullName] = @{ Mean = [double]$entry.Statistics.Mean; Variance = [math]::Pow([double]$entry.Statistics.StandardDeviation, 2); Samples = [int]$entry.Statistics.N }
+			}
+		}
+	} else {
+		Write-Error "$path is not a Google Benchmark or BenchmarkDotNet JSON file." -ErrorAction Continue
+		exit 2
+	}
+
+	$summaries = [ordered]@{}
+	foreach ($name in $samples.Keys) {
+		$value = $samples[$name]
+		if ($value -is [hashtable]) {
+			$summaries[$name] = $value
+		} else {
+			$values = [double[]]@($value)
+			$summaries[$name] = @{ Mean = (Get-Mean $values); Variance = (Get-Variance $values); Samples = $values.Count }
+		}
+	}
+
+	return @{ Profile = ($profileName -replace "[^A-Za-z0-9_.-]+", "_"); Benchmarks = $summaries }
+}
+
+$current = Read-BenchmarkResults $Results
+if ($MachineProfile -eq "") {
+	$MachineProfile = $current.Profile
+}
+
+# Baselines are stored per machine profile and per result file (e.g Core.Benchmarks and each BenchmarkDotNet suite)
+$suite = [System.IO.Path]::GetFileNameWithoutExtension($Results)
+$baselinePath = Join-Path $BaselineFolder (Join-Path $MachineProfile "$suite.json")
+
+if ($UpdateBaseline) {
+	New-Item -ItemType Directory -Force -Path (Split-Path $baselinePath) | Out-Null
+	Copy-Item -Force -Path $Results -Destination $baselinePath
+	Write-Host "Baseline updated: $baselinePath ($($current.Benchmarks.Count) benchmarks)"
+	exit 0
+}
+
+if (-not (Test-Path $baselinePath)) {
+	Write-Error "No baseline for profile '$MachineProfile' ($baselinePath), run with -UpdateBaseline first." -ErrorAction Continue
+	exit 2
+}
+
+$baseline = Read-BenchmarkResults $baselinePath
+$rows = @()
+foreach ($name in $current.Benchmarks.Keys) {
+	$new = $current.Benchmarks[$name]
+	if (-not $baseline.Benchmarks.Contains($name)) {
+		$rows += [pscustomobject]@{ Name = $name; Baseline = $null; Current = $new.Mean; Change = 0.0; TScore = $null; Status = "New" }
+		continue
+	}
+
+	$old = $baseline.Benchmarks[$name]
+	$change = if ($old.Mean -gt 0) { ($new.Mean - $old.Mean) / $old.Mean } else { 0.0 }
+
+	# Welch's t-test, needs at least 2 repetitions in both runs
+	$tScore = $null
+	if ($old.Samples -ge 2 -and $new.Samples -ge 2) {
+		$stdError = [math]::Sqrt($old.Variance / $old.Samples + $new.Variance / $new.Samples)
+		$tScore = if ($stdError -gt 0) { [math]::Abs($new.Mean - $old.Mean) / $stdError } else { [double]::PositiveInfinity }
+	}
+	$significant = $null -eq $tScore -or $tScore -ge $MinTScore
+
+	$status = "Unchanged"
+	if ($significant -and $change -gt $Threshold) {
+		$status = "Regressed"
+	} elseif ($significant -and $change -lt -$Threshold) {
+		$status = "Improved"
+	}
+	$rows += [pscustomobject]@{ Name = $name; Baseline = $old.Mean; Current = $new.Mean; Change = $change; TScore = $tScore; Status = $status }
+}
+
+foreach ($name in $baseline.Benchmarks.Keys) {
+	if (-not $current.Benchmarks.Contains($name)) {
+		$rows += [pscustomobject]@{ Name = $name; Baseline = $baseline.Benchmarks[$name].Mean; Current = $null; Change = 0.0; TScore = $null; Status = "Missing" }
+	}
+}
+
+function Format-Time($ns) {
+	if ($null -eq $ns) { return "-" }
+	if ($ns -ge 1000000) { return "{0:N2} ms" -f ($ns / 1000000) }
+	if ($ns -ge 1000) { return "{0:N2} us" -f ($ns / 1000) }
+	return "{0:N2} ns" -f $ns
+}
+
+$regressed = @($rows | Where-Object { $_.Status -eq "Regressed" })
+$improved = @($rows | Where-Object { $_.Status -eq "Improved" })
+
+$lines = @()
+$lines += "# Benchmark comparison: $(if ($regressed.Count -gt 0) { 'FAIL' } else { 'PASS' })"
+$lines += ""
+$lines += "- Profile: $MachineProfile"
+$lines += "- Baseline: $baselinePath"
+$lines += "- Threshold: {0:P0} (t-score >= {1})" -f $Threshold, $MinTScore
+$lines += "- Regressed: $($regressed.Count), improved: $($improved.Count), compared: $($rows.Count)"
+$lines += ""
+$lines += "| Status | Benchmark | Baseline | Current | Change | t-score |"
+$lines += "| ------ | --------- | -------- | ------- | ------ | ------- |"
+
+# Regressions first (worst first), then everything else by change
+$sorted = @($regressed | Sort-Object -Property Change -Descending) + @($rows | Where-Object { $_.Status -ne "Regressed" } | Sort-Object -Property Change -Descending)
+foreach ($row in $sorted) {
+	$status = if ($row.Status -eq "Regressed") { "**Regressed**" } else { $row.Status }
+	$tScore = if ($null -eq $row.TScore) { "-" } else { "{0:N1}" -f $row.TScore }
+	$lines += "| {0} | {1} | {2} | {3} | {4:+0.0%;-0.0%;0.0%} | {5} |" -f $status, $row.Name, (Format-Time $row.Baseline), (Format-Time $row.Current), $row.Change, $tScore
+}
+
+$lines | ForEach-Object { Write-Host $_ }
+if ($Report -ne "") {
+	$lines | Set-Content -Path $Report
+}
+
+if ($regressed.Count -gt 0) {
+	exit 1
+}
+exit 0